@@ -735,6 +735,14 @@ x.StreamVersion = uint32(xc.stream_version)
 x.ColoProxyScript = C.GoString(xc.colo_proxy_script)
 if err := x.UserspaceColoProxy.fromC(&xc.userspace_colo_proxy);err != nil {
 return fmt.Errorf("converting field UserspaceColoProxy: %v", err)
+}
+x.StripeFds = nil
+if n := int(xc.num_stripe_fds); n > 0 {
+cStripeFds := (*[1<<28]C.int)(unsafe.Pointer(xc.stripe_fds))[:n:n]
+x.StripeFds = make([]int, n)
+for i, v := range cStripeFds {
+x.StripeFds[i] = int(v)
+}
 }
 
  return nil}
@@ -750,6 +758,14 @@ if x.ColoProxyScript != "" {
 xc.colo_proxy_script = C.CString(x.ColoProxyScript)}
 if err := x.UserspaceColoProxy.toC(&xc.userspace_colo_proxy); err != nil {
 return fmt.Errorf("converting field UserspaceColoProxy: %v", err)
+}
+if numStripeFds := len(x.StripeFds); numStripeFds > 0 {
+xc.stripe_fds = (*C.int)(C.malloc(C.size_t(numStripeFds*numStripeFds)))
+xc.num_stripe_fds = C.int(numStripeFds)
+cStripeFds := (*[1<<28]C.int)(unsafe.Pointer(xc.stripe_fds))[:numStripeFds:numStripeFds]
+for i,v := range x.StripeFds {
+cStripeFds[i] = C.int(v)
+}
 }
 
  return nil
@@ -450,6 +450,7 @@ CheckpointedStream int
 StreamVersion uint32
 ColoProxyScript string
 UserspaceColoProxy Defbool
+StripeFds []int
 }
 
 type SchedParams struct {
@@ -0,0 +1,16 @@
+sbindir="/usr/local/sbin"
+bindir="/usr/local/bin"
+LIBEXEC="/usr/local/lib/xen"
+LIBEXEC_BIN="/usr/local/lib/xen/bin"
+libdir="/usr/local/lib"
+SHAREDIR="/usr/local/share"
+XENFIRMWAREDIR="/usr/local/lib/xen/boot"
+XEN_CONFIG_DIR="/etc/xen"
+XEN_SCRIPT_DIR="/etc/xen/scripts"
+XEN_LOCK_DIR="/var/lock"
+XEN_RUN_DIR="/var/run/xen"
+XEN_PAGING_DIR="/var/lib/xen/xenpaging"
+XEN_DUMP_DIR="/var/lib/xen/dump"
+XEN_LOG_DIR="/var/log/xen"
+XEN_LIB_DIR="/var/lib/xen"
+XEN_RUN_STORED="/var/run/xenstored"
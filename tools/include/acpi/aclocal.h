@@ -0,0 +1 @@
+/root/repo/tools/include/../../xen/include/acpi/aclocal.h
\ No newline at end of file
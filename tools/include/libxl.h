@@ -1498,6 +1498,24 @@ void libxl_mac_copy(libxl_ctx *ctx, libxl_mac *dst, const libxl_mac *src);
  */
 #define LIBXL_HAVE_CREATEINFO_XEND_SUSPEND_EVTCHN_COMPAT
 
+/*
+ * LIBXL_HAVE_SUSPEND_COMPRESS
+ *
+ * libxl_domain_suspend() accepts LIBXL_SUSPEND_COMPRESS, to send guest
+ * memory LZ4 compressed.  Only a receiving libxl which also defines
+ * LIBXL_HAVE_SUSPEND_COMPRESS can restore such a stream.
+ */
+#define LIBXL_HAVE_SUSPEND_COMPRESS 1
+
+/*
+ * LIBXL_HAVE_SUSPEND_STRIPED
+ *
+ * libxl_domain_suspend_striped() exists, and libxl_domain_restore_params
+ * has stripe_fds.  Guest memory is spread over the extra fds, which must
+ * be given in the same order on both sides.
+ */
+#define LIBXL_HAVE_SUSPEND_STRIPED 1
+
 typedef char **libxl_string_list;
 void libxl_string_list_dispose(libxl_string_list *sl);
 int libxl_string_list_length(const libxl_string_list *sl);
@@ -1856,6 +1874,20 @@ int libxl_domain_suspend(libxl_ctx *ctx, uint32_t domid, int fd,
                          LIBXL_EXTERNAL_CALLERS_ONLY;
 #define LIBXL_SUSPEND_DEBUG 1
 #define LIBXL_SUSPEND_LIVE 2
+#define LIBXL_SUSPEND_COMPRESS 4
+
+/*
+ * As libxl_domain_suspend(), but page data is striped across
+ * stripe_fds as well as fd, which still carries everything else.
+ * The receiver must pass the matching fds, in the same order, in
+ * libxl_domain_restore_params.stripe_fds.  Not for checkpointed
+ * streams.  None of the fds may be 0, 1 or 2.
+ */
+int libxl_domain_suspend_striped(libxl_ctx *ctx, uint32_t domid, int fd,
+                                 const int *stripe_fds, int num_stripe_fds,
+                                 int flags, /* LIBXL_SUSPEND_* */
+                                 const libxl_asyncop_how *ao_how)
+                                 LIBXL_EXTERNAL_CALLERS_ONLY;
 
 /*
  * Only suspend domain, do not save its state to file, do not destroy it.
@@ -0,0 +1,32 @@
+/* This file is automatically generated.  Do not edit. */
+#ifndef _SELINUX_FLASK_H_
+#define _SELINUX_FLASK_H_
+
+#if defined(__XEN__) || defined(__XEN_TOOLS__)
+
+/*
+ * Security object class definitions
+ */
+
+/*
+ * Security identifier indices for initial entities
+ */
+#define SECINITSID_XENBOOT                              1
+#define SECINITSID_XEN                                  2
+#define SECINITSID_DOM0                                 3
+#define SECINITSID_DOMIO                                4
+#define SECINITSID_DOMXEN                               5
+#define SECINITSID_UNLABELED                            6
+#define SECINITSID_SECURITY                             7
+#define SECINITSID_IOPORT                               8
+#define SECINITSID_IOMEM                                9
+#define SECINITSID_IRQ                                  10
+#define SECINITSID_DEVICE                               11
+#define SECINITSID_DOMU                                 12
+#define SECINITSID_DOMDM                                13
+
+#define SECINITSID_NUM                                  13
+
+#endif /* __XEN__ || __XEN_TOOLS__ */
+
+#endif
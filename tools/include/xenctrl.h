@@ -878,6 +878,46 @@ long long xc_logdirty_control(xc_interface *xch,
                               unsigned long pages,
                               unsigned int mode,
                               xc_shadow_op_stats_t *stats);
+/*
+ * As xc_logdirty_control(), for the pfns [start_pfn, start_pfn + pages)
+ * only.  The range's bits are written at their pfns' place in dirty_bitmap,
+ * so it may be the whole guest's, and start_pfn must be a multiple of 8.
+ *
+ * If dirty_pfns is given, the dirty pfns are instead listed there, up to
+ * *nr_dirty_pfns of them, and *nr_dirty_pfns is updated with the number
+ * listed.  Should the list fill, the operation stops early: the return value
+ * is the number of pfns dealt with, and only those are cleaned.
+ *
+ * stats->dirty_count is the number of dirty pfns among those dealt with.
+ * Fails with EINVAL on hypervisors without support for ranges.
+ */
+long long xc_logdirty_control_range(xc_interface *xch,
+                                    uint32_t domid,
+                                    unsigned int sop,
+                                    xc_hypercall_buffer_t *dirty_bitmap,
+                                    xc_hypercall_buffer_t *dirty_pfns,
+                                    unsigned long *nr_dirty_pfns,
+                                    unsigned long start_pfn,
+                                    unsigned long pages,
+                                    unsigned int mode,
+                                    xc_shadow_op_stats_t *stats);
+/*
+ * Take up to *nr_dirty_pfns pfns from the dirty ring of a domain whose
+ * log-dirty mode was enabled with XEN_DOMCTL_SHADOW_ENABLE_DIRTY_RING, in
+ * the order they were first dirtied, cleaning just those.  *nr_dirty_pfns is
+ * updated with the number taken.
+ *
+ * Fails with ENOBUFS, having taken nothing, if pfns were lost to the ring
+ * filling up: xc_logdirty_control() with XEN_DOMCTL_SHADOW_OP_CLEAN then
+ * reports everything dirty, and empties the ring.  Fails with EOPNOTSUPP if
+ * the domain has no ring.
+ */
+int xc_logdirty_drain_ring(xc_interface *xch,
+                           uint32_t domid,
+                           xc_hypercall_buffer_t *dirty_pfns,
+                           unsigned long *nr_dirty_pfns,
+                           unsigned int mode,
+                           xc_shadow_op_stats_t *stats);
 
 int xc_get_paging_mempool_size(xc_interface *xch, uint32_t domid, uint64_t *size);
 int xc_set_paging_mempool_size(xc_interface *xch, uint32_t domid, uint64_t size);
@@ -2033,6 +2073,14 @@ int xc_mem_paging_prep(xc_interface *xch, uint32_t domain_id, uint64_t gfn);
 int xc_mem_paging_load(xc_interface *xch, uint32_t domain_id,
                        uint64_t gfn, void *buffer);
 
+/*
+ * Mark a gfn with no memory behind it as paged out, so that its contents are
+ * requested from the pager (and supplied by xc_mem_paging_load()) when first
+ * accessed.
+ */
+int xc_mem_paging_populate_evicted(xc_interface *xch, uint32_t domain_id,
+                                   uint64_t gfn);
+
 /** 
  * Access tracking operations.
  * Supported only on Intel EPT 64 bit processors.
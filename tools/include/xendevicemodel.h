@@ -178,6 +178,25 @@ int xendevicemodel_destroy_ioreq_server(
 int xendevicemodel_set_ioreq_server_state(
     xendevicemodel_handle *dmod, domid_t domid, ioservid_t id, int enabled);
 
+/**
+ * This function sets the number of batch slots per vCPU an IOREQ Server
+ * handles, allowing several emulation requests to be passed to it at once.
+ * The slots are in the XENMEM_resource_ioreq_server_frame_batch frame of
+ * the server, which is not counted in the size of the resource reported by
+ * xenforeignmemory_resource_size() and has to be mapped on its own. The
+ * IOREQ Server must be disabled.
+ *
+ * @parm dmod a handle to an open devicemodel interface.
+ * @parm domid the domain id to be serviced
+ * @parm id the IOREQ Server id.
+ * @parm nr_slots pointer to the number of slots requested, set to the
+ *                number of slots granted on return (which may be 0).
+ * @return 0 on success, -1 on failure.
+ */
+int xendevicemodel_set_ioreq_server_batch(
+    xendevicemodel_handle *dmod, domid_t domid, ioservid_t id,
+    unsigned int *nr_slots);
+
 /**
  * This function sets the level of INTx pin of an emulated PCI device.
  *
@@ -26,6 +26,38 @@
 
 #define XCFLAGS_LIVE      (1 << 0)
 #define XCFLAGS_DEBUG     (1 << 1)
+/*
+ * Send guest memory compressed.  The restoring end must be new enough to
+ * understand COMPRESSED_PAGE_DATA records, and zstd support is subject to
+ * libzstd being available at both ends.
+ */
+#define XCFLAGS_COMPRESS_LZ4   (1 << 2)
+#define XCFLAGS_COMPRESS_ZSTD  (1 << 3)
+/*
+ * Keep a hash of each page sent, and send pages which are dirtied but found
+ * unchanged as such, rather than their data.  Costs 8 bytes of memory per
+ * guest page.  Ignored for COLO streams.
+ */
+#define XCFLAGS_ELIDE_UNCHANGED (1 << 4)
+/*
+ * Permit the precopy policy to move a live HVM migration into post-copy:
+ * the domain resumes on the restoring end with some of its memory still
+ * outstanding, which is then sent, ahead of the rest if the guest touches
+ * it, until none remains.  Requires recv_fd, a plain stream, and the restoring
+ * end to support mem_paging for the domain.  Once the domain has resumed at
+ * the far end, neither end holds a complete copy of the guest, so a failure
+ * of either loses it.
+ */
+#define XCFLAGS_POSTCOPY        (1 << 5)
+/*
+ * In the absence of a precopy_policy callback, end the precopy phase once the
+ * pages still dirty could be sent within save_callbacks.max_downtime_ms at
+ * the throughput measured so far, rather than after a fixed number of
+ * iterations.  A domain dirtying memory faster than it can be sent is slowed
+ * down by lowering its credit/credit2 scheduler cap until it converges.  The
+ * original cap is put back before xc_domain_save() returns.
+ */
+#define XCFLAGS_ADAPTIVE_PRECOPY (1 << 6)
 
 #define X86_64_B_SIZE   64 
 #define X86_32_B_SIZE   32
@@ -467,6 +499,11 @@ struct save_callbacks {
 #define XGS_POLICY_CONTINUE_PRECOPY 0  /* Remain in the precopy phase. */
 #define XGS_POLICY_STOP_AND_COPY    1  /* Immediately suspend and transmit the
                                         * remaining dirty pages. */
+#define XGS_POLICY_POSTCOPY         2  /* Immediately suspend, and transmit the
+                                        * remaining dirty pages after the
+                                        * domain has resumed at the far end.
+                                        * Stop-and-copy without
+                                        * XCFLAGS_POSTCOPY. */
     precopy_policy_t precopy_policy;
 
     /*
@@ -506,6 +543,21 @@ struct save_callbacks {
     /* Enable qemu-dm logging dirty pages to xen */
     int (*switch_qemu_logdirty)(uint32_t domid, unsigned enable, void *data); /* HVM only */
 
+    /*
+     * The longest the domain should be paused for the stop-and-copy phase,
+     * for XCFLAGS_ADAPTIVE_PRECOPY.  0 for the default of 300ms.
+     */
+    unsigned int max_downtime_ms;
+
+    /*
+     * Further streams to the restorer, over which page data is striped as
+     * STRIPED_DATA chunks.  All other records stay on io_fd.  The restorer
+     * must be given the same streams, in the same order.  XC_STREAM_PLAIN
+     * only.
+     */
+    const int *stripe_fds;
+    unsigned int nr_stripe_fds;
+
     /* to be provided as the last argument to each callback function */
     void *data;
 };
@@ -526,8 +578,8 @@ typedef enum {
  * @param flags XCFLAGS_xxx
  * @param stream_type XC_STREAM_PLAIN if the far end of the stream
  *        doesn't use checkpointing
- * @param recv_fd Only used for XC_STREAM_COLO.  Contains backchannel from
- *        the destination side.
+ * @param recv_fd Only used for XC_STREAM_COLO and XCFLAGS_POSTCOPY.  Contains
+ *        backchannel from the destination side.
  * @return 0 on success, -1 on failure
  */
 int xc_domain_save(xc_interface *xch, int io_fd, uint32_t dom,
@@ -551,7 +603,8 @@ struct restore_callbacks {
     int (*suspend)(void *data);
 
     /*
-     * Called after the secondary vm is ready to resume.
+     * Called after the secondary vm is ready to resume, or for a post-copy
+     * migration, once everything but the outstanding memory is in place.
      * Callback function resumes the guest & the device model,
      * returns to xc_domain_restore.
      */
@@ -583,6 +636,13 @@ struct restore_callbacks {
     void (*restore_results)(xen_pfn_t store_gfn, xen_pfn_t console_gfn,
                             void *data);
 
+    /*
+     * Further streams from the saver, carrying the page data striped over
+     * them.  As save_callbacks.stripe_fds, in the same order.
+     */
+    const int *stripe_fds;
+    unsigned int nr_stripe_fds;
+
     /* to be provided as the last argument to each callback function */
     void *data;
 };
@@ -590,7 +650,10 @@ struct restore_callbacks {
 /**
  * This function will restore a saved domain.
  *
- * Domain is restored in a suspended state ready to be unpaused.
+ * Domain is restored in a suspended state ready to be unpaused.  For a
+ * post-copy migration, the domain is instead resumed through the postcopy
+ * callback (after restore_results) and this function returns once the last
+ * of its memory has arrived.
  *
  * @param xch a handle to an open hypervisor interface
  * @param io_fd the file descriptor to restore a domain from
@@ -605,8 +668,8 @@ struct restore_callbacks {
  *        checkpointing
  * @param callbacks non-NULL to receive a callback to restore toolstack
  *        specific data
- * @param send_back_fd Only used for XC_STREAM_COLO.  Contains backchannel to
- *        the source side.
+ * @param send_back_fd Only used for XC_STREAM_COLO and post-copy migration.
+ *        Contains backchannel to the source side.
  * @return 0 on success, -1 on failure
  */
 int xc_domain_restore(xc_interface *xch, int io_fd, uint32_t dom,
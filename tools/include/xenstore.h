@@ -170,6 +170,34 @@ bool xs_set_permissions(struct xs_handle *h, xs_transaction_t t,
 			const char *path, struct xs_permissions *perms,
 			unsigned int num_perms);
 
+/* Batch of operations sent to the store daemon in as few requests as
+ * possible, instead of one round trip per operation.  Outside of a
+ * transaction the batch is done either completely or not at all, and
+ * must fit into a single request (E2BIG otherwise).  A daemon not
+ * supporting batches gets the operations one by one, which is atomic
+ * only inside a transaction.
+ *
+ * Adding an operation returns false on failure, which will make
+ * xs_batch_commit() fail, too.  Values read are stored in the locations
+ * passed to xs_batch_read() once xs_batch_commit() succeeded: call
+ * free() on them after use.  xs_batch_commit() always frees the batch,
+ * xs_batch_free() is for dropping it without committing.
+ */
+struct xs_batch;
+
+struct xs_batch *xs_batch_new(struct xs_handle *h, xs_transaction_t t);
+bool xs_batch_read(struct xs_batch *b, const char *path,
+		   void **value, unsigned int *len);
+bool xs_batch_write(struct xs_batch *b, const char *path,
+		    const void *data, unsigned int len);
+bool xs_batch_mkdir(struct xs_batch *b, const char *path);
+bool xs_batch_rm(struct xs_batch *b, const char *path);
+bool xs_batch_set_permissions(struct xs_batch *b, const char *path,
+			      struct xs_permissions *perms,
+			      unsigned int num_perms);
+bool xs_batch_commit(struct xs_batch *b);
+void xs_batch_free(struct xs_batch *b);
+
 /* Watch a node for changes (poll on fd to detect, or call read_watch()).
  * When the node (or any child) changes, fd will become readable.
  * Token is returned when watch is read, to allow matching.
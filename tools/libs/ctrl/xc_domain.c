@@ -657,6 +657,88 @@ long long xc_logdirty_control(xc_interface *xch,
     return (rc == 0) ? domctl.u.shadow_op.pages : rc;
 }
 
+long long xc_logdirty_control_range(xc_interface *xch,
+                                    uint32_t domid,
+                                    unsigned int sop,
+                                    xc_hypercall_buffer_t *dirty_bitmap,
+                                    xc_hypercall_buffer_t *dirty_pfns,
+                                    unsigned long *nr_dirty_pfns,
+                                    unsigned long start_pfn,
+                                    unsigned long pages,
+                                    unsigned int mode,
+                                    xc_shadow_op_stats_t *stats)
+{
+    int rc;
+    struct xen_domctl domctl = {
+        .cmd         = XEN_DOMCTL_shadow_op,
+        .domain      = domid,
+        .u.shadow_op = {
+            .op        = sop,
+            .pages     = pages,
+            .mode      = mode | XEN_DOMCTL_SHADOW_LOGDIRTY_RANGE,
+            .start_pfn = start_pfn,
+        }
+    };
+    DECLARE_HYPERCALL_BUFFER_ARGUMENT(dirty_bitmap);
+    DECLARE_HYPERCALL_BUFFER_ARGUMENT(dirty_pfns);
+
+    if ( dirty_pfns )
+    {
+        domctl.u.shadow_op.mode |= XEN_DOMCTL_SHADOW_LOGDIRTY_PFN_LIST;
+        domctl.u.shadow_op.nr_dirty_pfns = *nr_dirty_pfns;
+        set_xen_guest_handle(domctl.u.shadow_op.dirty_pfns, dirty_pfns);
+    }
+    else if ( dirty_bitmap )
+        /* The bits for the range land at their pfns' place in the bitmap. */
+        set_xen_guest_handle_impl(domctl.u.shadow_op.dirty_bitmap,
+                                  dirty_bitmap, start_pfn / 8);
+
+    rc = do_domctl(xch, &domctl);
+
+    if ( stats )
+        memcpy(stats, &domctl.u.shadow_op.stats,
+               sizeof(xc_shadow_op_stats_t));
+
+    if ( rc == 0 && dirty_pfns )
+        *nr_dirty_pfns = domctl.u.shadow_op.nr_dirty_pfns;
+
+    return (rc == 0) ? domctl.u.shadow_op.pages : rc;
+}
+
+int xc_logdirty_drain_ring(xc_interface *xch,
+                           uint32_t domid,
+                           xc_hypercall_buffer_t *dirty_pfns,
+                           unsigned long *nr_dirty_pfns,
+                           unsigned int mode,
+                           xc_shadow_op_stats_t *stats)
+{
+    int rc;
+    struct xen_domctl domctl = {
+        .cmd         = XEN_DOMCTL_shadow_op,
+        .domain      = domid,
+        .u.shadow_op = {
+            .op            = XEN_DOMCTL_SHADOW_OP_CLEAN,
+            .mode          = mode | XEN_DOMCTL_SHADOW_LOGDIRTY_PFN_LIST |
+                             XEN_DOMCTL_SHADOW_LOGDIRTY_RING,
+            .nr_dirty_pfns = *nr_dirty_pfns,
+        }
+    };
+    DECLARE_HYPERCALL_BUFFER_ARGUMENT(dirty_pfns);
+
+    set_xen_guest_handle(domctl.u.shadow_op.dirty_pfns, dirty_pfns);
+
+    rc = do_domctl(xch, &domctl);
+
+    if ( stats )
+        memcpy(stats, &domctl.u.shadow_op.stats,
+               sizeof(xc_shadow_op_stats_t));
+
+    if ( rc == 0 )
+        *nr_dirty_pfns = domctl.u.shadow_op.nr_dirty_pfns;
+
+    return rc;
+}
+
 int xc_get_paging_mempool_size(xc_interface *xch, uint32_t domid, uint64_t *size)
 {
     int rc;
@@ -119,6 +119,14 @@ int xc_mem_paging_load(xc_interface *xch, uint32_t domain_id,
                                gfn, buffer);
 }
 
+int xc_mem_paging_populate_evicted(xc_interface *xch, uint32_t domain_id,
+                                   uint64_t gfn)
+{
+    return xc_mem_paging_memop(xch, domain_id,
+                               XENMEM_paging_op_populate_evicted,
+                               gfn, NULL);
+}
+
 
 /*
  * Local variables:
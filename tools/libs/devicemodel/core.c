@@ -391,6 +391,30 @@ int xendevicemodel_set_ioreq_server_state(
     return xendevicemodel_op(dmod, domid, 1, &op, sizeof(op));
 }
 
+int xendevicemodel_set_ioreq_server_batch(
+    xendevicemodel_handle *dmod, domid_t domid, ioservid_t id,
+    unsigned int *nr_slots)
+{
+    struct xen_dm_op op;
+    struct xen_dm_op_set_ioreq_server_batch *data;
+    int rc;
+
+    memset(&op, 0, sizeof(op));
+
+    op.op = XEN_DMOP_set_ioreq_server_batch;
+    data = &op.u.set_ioreq_server_batch;
+
+    data->id = id;
+    data->nr_slots = *nr_slots;
+
+    rc = xendevicemodel_op(dmod, domid, 1, &op, sizeof(op));
+    if ( rc )
+        return rc;
+
+    *nr_slots = data->nr_slots;
+    return 0;
+}
+
 int xendevicemodel_set_pci_intx_level(
     xendevicemodel_handle *dmod, domid_t domid, uint16_t segment,
     uint8_t bus, uint8_t device, uint8_t intx, unsigned int level)
@@ -39,6 +39,12 @@ static const char *const mandatory_rec_types[] =
     [REC_TYPE_STATIC_DATA_END]              = "Static data end",
     [REC_TYPE_X86_CPUID_POLICY]             = "x86 CPUID policy",
     [REC_TYPE_X86_MSR_POLICY]               = "x86 MSR policy",
+    [REC_TYPE_COMPRESSED_PAGE_DATA]         = "Compressed page data",
+    [REC_TYPE_ELIDED_PAGE_DATA]             = "Elided page data",
+    [REC_TYPE_POSTCOPY_PFNS]                = "Post-copy pfns",
+    [REC_TYPE_POSTCOPY_TRANSITION]          = "Post-copy transition",
+    [REC_TYPE_POSTCOPY_FAULT]               = "Post-copy fault",
+    [REC_TYPE_STRIPED_DATA]                 = "Striped data",
 };
 
 const char *rec_type_to_str(uint32_t type)
@@ -141,6 +147,29 @@ int read_record(struct xc_sr_context *ctx, int fd, struct xc_sr_record *rec)
     return 0;
 };
 
+bool page_is_zero(const void *page)
+{
+    const uint64_t *p = page;
+    unsigned int i, j;
+    uint64_t acc;
+
+    /*
+     * OR a cacheline at a time, which the compiler can vectorise, and stop
+     * at the first one with anything set.  Pages with data mostly differ
+     * from zero near their start.
+     */
+    for ( i = 0; i < PAGE_SIZE / sizeof(*p); i += 8 )
+    {
+        for ( acc = 0, j = 0; j < 8; ++j )
+            acc |= p[i + j];
+
+        if ( acc )
+            return false;
+    }
+
+    return true;
+}
+
 static void __attribute__((unused)) build_assertions(void)
 {
     BUILD_BUG_ON(sizeof(struct xc_sr_ihdr) != 24);
@@ -148,6 +177,9 @@ static void __attribute__((unused)) build_assertions(void)
     BUILD_BUG_ON(sizeof(struct xc_sr_rhdr) != 8);
 
     BUILD_BUG_ON(sizeof(struct xc_sr_rec_page_data_header)  != 8);
+    BUILD_BUG_ON(sizeof(struct xc_sr_rec_compressed_page_data_header) != 8);
+    BUILD_BUG_ON(sizeof(struct xc_sr_rec_elided_page_data_header) != 8);
+    BUILD_BUG_ON(sizeof(struct xc_sr_rec_striped_data)      != 16);
     BUILD_BUG_ON(sizeof(struct xc_sr_rec_x86_pv_info)       != 8);
     BUILD_BUG_ON(sizeof(struct xc_sr_rec_x86_pv_p2m_frames) != 8);
     BUILD_BUG_ON(sizeof(struct xc_sr_rec_x86_pv_vcpu_hdr)   != 8);
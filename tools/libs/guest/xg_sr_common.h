@@ -17,6 +17,11 @@ const char *rec_type_to_str(uint32_t type);
 
 struct xc_sr_context;
 struct xc_sr_record;
+struct xc_sr_save_pipeline;
+struct xc_sr_restore_pipeline;
+struct xc_sr_restore_postcopy;
+struct xc_sr_compressor;
+struct xc_sr_stripes;
 
 /**
  * Save operations.  To be implemented for each type of guest, for use by the
@@ -211,6 +216,66 @@ static inline int update_blob(struct xc_sr_blob *blob,
     return 0;
 }
 
+/* Effectiveness of COMPRESSED_PAGE_DATA records. */
+struct xc_sr_compress_stats
+{
+    /* Pages of data considered for compression. */
+    uint64_t pages;
+    /* Octets those pages occupied in the stream, including length words. */
+    uint64_t bytes;
+    /* Pages which didn't compress, and were sent as they were. */
+    uint64_t raw_pages;
+    /* Records sent, and those sent as PAGE_DATA as compression didn't pay. */
+    uint64_t batches, raw_batches;
+};
+
+/* Pages left out of the page data records, as ELIDED_PAGE_DATA. */
+struct xc_sr_elide_stats
+{
+    uint64_t zero_pages;
+    uint64_t unchanged_pages;
+};
+
+/* The outstanding pages of a post-copy migration. */
+struct xc_sr_postcopy_stats
+{
+    /* Pages outstanding when the domain changed hosts. */
+    uint64_t pfns;
+    /* Pfns asked for in POSTCOPY_FAULT records, and pages sent for them. */
+    uint64_t faults;
+    uint64_t fault_pages;
+};
+
+/*
+ * State of the adaptive precopy policy: the rates measured over the precopy
+ * phase, and any scheduler cap applied to slow the domain down.
+ */
+struct xc_sr_adaptive_precopy
+{
+    unsigned int max_downtime_ms;
+
+    /* CLOCK_MONOTONIC time of the last fetch of the dirty bitmap. */
+    uint64_t clean_ns;
+
+    /* Pages per second sent (smoothed), and dirtied over the last round. */
+    uint64_t send_rate;
+    uint64_t dirty_rate;
+
+    /* Pages dirty at the end of the previous round. */
+    long prev_dirty_count;
+
+    /*
+     * XEN_SCHEDULER_* of the cap applied, or 0 if none is.  no_throttle once
+     * the domain's scheduler turns out not to support caps.
+     */
+    unsigned int sched;
+    bool no_throttle;
+    unsigned int nr_vcpus;
+    uint16_t orig_cap;
+    uint16_t cap;
+    unsigned int throttle_steps;
+};
+
 struct xc_sr_context
 {
     xc_interface *xch;
@@ -241,11 +306,62 @@ struct xc_sr_context
 
             struct precopy_stats stats;
 
-            xen_pfn_t *batch_pfns;
-            unsigned int nr_batch_pfns;
+            /* COMPRESSED_PAGE_DATA_ALG_*, or 0 to send PAGE_DATA records. */
+            uint32_t compression;
+            struct xc_sr_compress_stats compress_stats;
+
+            /*
+             * Whether to elide pages unchanged since they were last sent,
+             * and if so, the hash of the content and type of each page as
+             * last sent.  Zero if the restorer holds no data for the pfn.
+             */
+            bool elide_unchanged;
+            uint64_t *page_hashes;
+            struct xc_sr_elide_stats elide_stats;
+
+            /*
+             * Whether the caller permits post-copy, and whether the precopy
+             * policy has chosen it.  deferred_pages then holds the pfns
+             * still to be sent.
+             */
+            bool postcopy;
+            bool postcopy_active;
+            struct xc_sr_postcopy_stats postcopy_stats;
+
+            /* Whether to use the built-in adaptive precopy policy. */
+            bool adaptive_precopy;
+            struct xc_sr_adaptive_precopy adaptive;
+
+            /* Batches of pages in flight to the stream.  See xg_sr_save.c */
+            struct xc_sr_save_pipeline *pipeline;
             unsigned long *deferred_pages;
             unsigned long nr_deferred_pages;
             xc_hypercall_buffer_t dirty_bitmap_hbuf;
+
+            /*
+             * Fetching the dirty bitmap a range at a time, and as a list of
+             * pfns while few are dirty.  See get_dirty_bitmap() in
+             * xg_sr_save.c
+             */
+            bool no_logdirty_range;
+            unsigned long last_dirty_count;
+            xc_hypercall_buffer_t dirty_pfns_hbuf;
+
+            /*
+             * Taking the pfns dirtied from Xen's ring of them during the
+             * live phase.  See get_dirty_pfns_from_ring() in xg_sr_save.c
+             */
+            bool dirty_ring;
+
+            /*
+             * Further streams over which page data is striped, and the
+             * sequence number of the next chunk.  See write_striped_batch()
+             * in xg_sr_save.c
+             */
+            const int *stripe_fds;
+            unsigned int nr_stripe_fds;
+            struct xc_sr_stripes *stripes;
+            uint64_t stripe_seq;
         } save;
 
         struct /* Restore data. */
@@ -295,8 +411,38 @@ struct xc_sr_context
             unsigned long *populated_pfns;
             xen_pfn_t max_populated_pfn;
 
+            /*
+             * Whether aligned 2M runs of pfns may be populated as superpages,
+             * and how many were.
+             */
+            bool superpages;
+            uint64_t nr_superpages;
+
+            /* Page data being applied to the guest.  See xg_sr_restore.c */
+            struct xc_sr_restore_pipeline *pipeline;
+
+            /* Post-copy migration state.  See xg_sr_restore.c */
+            struct xc_sr_restore_postcopy *postcopy;
+            struct xc_sr_postcopy_stats postcopy_stats;
+
             /* Sender has invoked verify mode on the stream. */
             bool verify;
+
+            /* For the most recent COMPRESSED_PAGE_DATA record. */
+            struct xc_sr_compressor *compressor;
+            uint32_t compressor_alg;
+            struct xc_sr_compress_stats compress_stats;
+            struct xc_sr_elide_stats elide_stats;
+
+            /*
+             * Further streams carrying striped page data, and the sequence
+             * number of the chunk expected next.  See handle_striped_data()
+             * in xg_sr_restore.c
+             */
+            const int *stripe_fds;
+            unsigned int nr_stripe_fds;
+            struct xc_sr_stripes *stripes;
+            uint64_t stripe_seq;
         } restore;
     };
 
@@ -455,6 +601,71 @@ int populate_pfns(struct xc_sr_context *ctx, unsigned int count,
 /* Handle a STATIC_DATA_END record. */
 int handle_static_data_end(struct xc_sr_context *ctx);
 
+/* String representation of COMPRESSED_PAGE_DATA algorithms. */
+const char *compress_alg_to_str(uint32_t algorithm);
+
+/* Can this build compress and decompress pages with an algorithm? */
+bool compress_alg_supported(uint32_t algorithm);
+
+/*
+ * Allocate state for compressing and decompressing pages with an algorithm.
+ * A compressor may only be used by one thread at a time.
+ */
+struct xc_sr_compressor *alloc_compressor(xc_interface *xch,
+                                          uint32_t algorithm);
+void free_compressor(struct xc_sr_compressor *c);
+
+/*
+ * Compress a page into 'dst', which must have space for PAGE_SIZE - 1
+ * octets.  Returns the compressed length, or 0 if the page doesn't compress
+ * to less than a page.
+ */
+unsigned int compress_page(struct xc_sr_compressor *c,
+                           const void *page, void *dst);
+
+/*
+ * Expand 'len' octets of compressed data into a page.  Returns 0 on success,
+ * or -1 if the data doesn't expand to exactly one page.
+ */
+int decompress_page(struct xc_sr_compressor *c, const void *src,
+                    unsigned int len, void *page);
+
+/* Is every octet of a page zero? */
+bool page_is_zero(const void *page);
+
+/*
+ * Set up the further streams over which page data is striped, for saving or
+ * restoring.  See xg_sr_stripe.c
+ */
+struct xc_sr_stripes *setup_stripes(struct xc_sr_context *ctx,
+                                    const int *fds, unsigned int nr,
+                                    bool save);
+void teardown_stripes(struct xc_sr_stripes *s);
+
+/*
+ * Send a chunk, the records in iov[] headed by a copy of the STRIPED_DATA
+ * record, on the further stream it names.  The chunk is copied, so iov[] may
+ * be reused straight away.  Fails once any further stream has failed.
+ */
+int write_striped_chunk(struct xc_sr_stripes *s,
+                        const struct xc_sr_rec_striped_data *hdr,
+                        const struct iovec *iov, int iovcnt);
+
+/*
+ * End each further stream with an END record, and wait for everything to be
+ * written.
+ */
+int finish_stripes(struct xc_sr_stripes *s);
+
+/*
+ * Take the next chunk from a further stream, counted from 1: its
+ * STRIPED_DATA record, and an array of hdr->count records.  The caller frees
+ * the array, and the data of each record.
+ */
+int take_striped_chunk(struct xc_sr_stripes *s, unsigned int stream,
+                       struct xc_sr_rec_striped_data *hdr,
+                       struct xc_sr_record **recs);
+
 /* Page type known to the migration logic? */
 static inline bool is_known_page_type(uint32_t type)
 {
@@ -0,0 +1,361 @@
+/*
+ * Per-page compression of guest memory in the migration stream.
+ *
+ * Each page is compressed independently, so the restorer can expand any page
+ * of a COMPRESSED_PAGE_DATA record straight into the guest without reference
+ * to its neighbours, and so a page which doesn't compress costs nothing more
+ * than a length word.
+ *
+ * LZ4 is always available.  Only a decompressor for it is shared with the
+ * domain builder (../../xen/common/lz4), so a minimal greedy compressor for
+ * the LZ4 block format is implemented here.  Zstandard is available when
+ * libzstd was found at configure time.
+ */
+
+#include <assert.h>
+
+#include "xg_sr_common.h"
+
+#include "../../xen/include/xen/lz4.h"
+
+#if defined(HAVE_ZSTD)
+#include <zstd.h>
+
+/* Speed matters far more than ratio for live migration. */
+#define SR_ZSTD_LEVEL 1
+#endif
+
+/* Parameters of the LZ4 block format. */
+#define LZ4_MINMATCH     4
+#define LZ4_LASTLITERALS 5  /* The last 5 octets are always literals. */
+#define LZ4_MFLIMIT      12 /* No match may start in the last 12 octets. */
+#define LZ4_ML_BITS      4
+#define LZ4_ML_MASK      ((1U << LZ4_ML_BITS) - 1)
+#define LZ4_RUN_MASK     ((1U << (8 - LZ4_ML_BITS)) - 1)
+
+/* Offsets fit in 16 bits as the input is a single page. */
+#define LZ4_HASH_LOG     12
+
+struct xc_sr_compressor
+{
+    uint32_t algorithm;
+
+    union
+    {
+        /* Offset into the page of the last position with each hash. */
+        uint16_t lz4_table[1U << LZ4_HASH_LOG];
+
+#if defined(HAVE_ZSTD)
+        struct
+        {
+            ZSTD_CCtx *cctx;
+            ZSTD_DCtx *dctx;
+        } zstd;
+#endif
+    };
+};
+
+const char *compress_alg_to_str(uint32_t algorithm)
+{
+    switch ( algorithm )
+    {
+    case COMPRESSED_PAGE_DATA_ALG_LZ4:  return "lz4";
+    case COMPRESSED_PAGE_DATA_ALG_ZSTD: return "zstd";
+    default:                            return "Reserved";
+    }
+}
+
+bool compress_alg_supported(uint32_t algorithm)
+{
+    switch ( algorithm )
+    {
+    case COMPRESSED_PAGE_DATA_ALG_LZ4:
+        return true;
+
+#if defined(HAVE_ZSTD)
+    case COMPRESSED_PAGE_DATA_ALG_ZSTD:
+        return true;
+#endif
+
+    default:
+        return false;
+    }
+}
+
+struct xc_sr_compressor *alloc_compressor(xc_interface *xch,
+                                          uint32_t algorithm)
+{
+    struct xc_sr_compressor *c;
+
+    if ( !compress_alg_supported(algorithm) )
+    {
+        ERROR("Page compression algorithm %#x (%s) not supported",
+              algorithm, compress_alg_to_str(algorithm));
+        errno = EOPNOTSUPP;
+        return NULL;
+    }
+
+    c = calloc(1, sizeof(*c));
+    if ( !c )
+    {
+        ERROR("Unable to allocate page compressor");
+        return NULL;
+    }
+
+    c->algorithm = algorithm;
+
+#if defined(HAVE_ZSTD)
+    if ( algorithm == COMPRESSED_PAGE_DATA_ALG_ZSTD )
+    {
+        c->zstd.cctx = ZSTD_createCCtx();
+        c->zstd.dctx = ZSTD_createDCtx();
+        if ( !c->zstd.cctx || !c->zstd.dctx )
+        {
+            ERROR("Unable to allocate zstd contexts");
+            free_compressor(c);
+            errno = ENOMEM;
+            return NULL;
+        }
+    }
+#endif
+
+    return c;
+}
+
+void free_compressor(struct xc_sr_compressor *c)
+{
+    if ( !c )
+        return;
+
+#if defined(HAVE_ZSTD)
+    if ( c->algorithm == COMPRESSED_PAGE_DATA_ALG_ZSTD )
+    {
+        ZSTD_freeCCtx(c->zstd.cctx);
+        ZSTD_freeDCtx(c->zstd.dctx);
+    }
+#endif
+
+    free(c);
+}
+
+static inline uint32_t lz4_read32(const uint8_t *p)
+{
+    uint32_t val;
+
+    memcpy(&val, p, sizeof(val));
+
+    return val;
+}
+
+static inline unsigned int lz4_hash(uint32_t seq)
+{
+    return (seq * 2654435761U) >> (32 - LZ4_HASH_LOG);
+}
+
+/* Length of the common prefix of a and b, stopping at limit. */
+static inline unsigned int lz4_count(const uint8_t *a, const uint8_t *b,
+                                     const uint8_t *limit)
+{
+    const uint8_t *start = a;
+    uint64_t x, y;
+
+    while ( a + sizeof(x) <= limit )
+    {
+        memcpy(&x, a, sizeof(x));
+        memcpy(&y, b, sizeof(y));
+
+        if ( x != y )
+            return a - start + (__builtin_ctzll(x ^ y) >> 3);
+
+        a += sizeof(x);
+        b += sizeof(y);
+    }
+
+    while ( a < limit && *a == *b )
+    {
+        a++;
+        b++;
+    }
+
+    return a - start;
+}
+
+/* Encode a length field which has overflowed its 4 bit token nibble. */
+static inline uint8_t *lz4_put_length(uint8_t *op, unsigned int len)
+{
+    for ( ; len >= 255; len -= 255 )
+        *op++ = 255;
+    *op++ = len;
+
+    return op;
+}
+
+/*
+ * Compress one page into an LZ4 block, greedily taking the first match found
+ * through a single-entry hash table.  The search step grows across runs of
+ * unmatched data, so incompressible pages are rejected quickly.
+ */
+static unsigned int lz4_compress_page(struct xc_sr_compressor *c,
+                                      const uint8_t *src, uint8_t *dst)
+{
+    const uint8_t *ip = src + 1, *anchor = src, *ref;
+    const uint8_t *const iend = src + PAGE_SIZE;
+    const uint8_t *const mflimit = iend - LZ4_MFLIMIT;
+    const uint8_t *const matchlimit = iend - LZ4_LASTLITERALS;
+    uint8_t *op = dst, *token;
+    /* Anything not less than a page is of no use. */
+    uint8_t *const oend = dst + PAGE_SIZE - 1;
+    unsigned int h, lit, len;
+    uint32_t seq;
+
+    memset(c->lz4_table, 0, sizeof(c->lz4_table));
+
+    while ( ip <= mflimit )
+    {
+        seq = lz4_read32(ip);
+        h = lz4_hash(seq);
+        ref = src + c->lz4_table[h];
+        c->lz4_table[h] = ip - src;
+
+        if ( lz4_read32(ref) != seq || ref >= ip )
+        {
+            ip += 1 + ((ip - anchor) >> 6);
+            continue;
+        }
+
+        /* Extend the match backwards into the pending literals. */
+        while ( ip > anchor && ref > src && ip[-1] == ref[-1] )
+        {
+            ip--;
+            ref--;
+        }
+
+        lit = ip - anchor;
+        len = lz4_count(ip + LZ4_MINMATCH, ref + LZ4_MINMATCH, matchlimit);
+
+        /* Worst case for this sequence, and the final literals after it. */
+        if ( op + 1 + lit / 255 + 1 + lit + 2 + len / 255 + 1 +
+             1 + LZ4_LASTLITERALS > oend )
+            return 0;
+
+        token = op++;
+        if ( lit >= LZ4_RUN_MASK )
+        {
+            *token = LZ4_RUN_MASK << LZ4_ML_BITS;
+            op = lz4_put_length(op, lit - LZ4_RUN_MASK);
+        }
+        else
+            *token = lit << LZ4_ML_BITS;
+
+        memcpy(op, anchor, lit);
+        op += lit;
+
+        *op++ = (ip - ref);
+        *op++ = (ip - ref) >> 8;
+
+        if ( len >= LZ4_ML_MASK )
+        {
+            *token |= LZ4_ML_MASK;
+            op = lz4_put_length(op, len - LZ4_ML_MASK);
+        }
+        else
+            *token |= len;
+
+        ip += LZ4_MINMATCH + len;
+        anchor = ip;
+
+        /* Seed the table with the position just before the match end. */
+        if ( ip <= mflimit )
+            c->lz4_table[lz4_hash(lz4_read32(ip - 2))] = ip - 2 - src;
+    }
+
+    lit = iend - anchor;
+    if ( op + 1 + lit / 255 + 1 + lit > oend )
+        return 0;
+
+    if ( lit >= LZ4_RUN_MASK )
+    {
+        *op++ = LZ4_RUN_MASK << LZ4_ML_BITS;
+        op = lz4_put_length(op, lit - LZ4_RUN_MASK);
+    }
+    else
+        *op++ = lit << LZ4_ML_BITS;
+
+    memcpy(op, anchor, lit);
+    op += lit;
+
+    return op - dst;
+}
+
+unsigned int compress_page(struct xc_sr_compressor *c,
+                           const void *page, void *dst)
+{
+    switch ( c->algorithm )
+    {
+    case COMPRESSED_PAGE_DATA_ALG_LZ4:
+        return lz4_compress_page(c, page, dst);
+
+#if defined(HAVE_ZSTD)
+    case COMPRESSED_PAGE_DATA_ALG_ZSTD:
+    {
+        size_t len = ZSTD_compressCCtx(c->zstd.cctx, dst, PAGE_SIZE - 1,
+                                       page, PAGE_SIZE, SR_ZSTD_LEVEL);
+
+        /* Includes the output not fitting in PAGE_SIZE - 1 octets. */
+        if ( ZSTD_isError(len) )
+            return 0;
+
+        return len;
+    }
+#endif
+
+    default:
+        assert(!"Bad compression algorithm");
+        return 0;
+    }
+}
+
+int decompress_page(struct xc_sr_compressor *c, const void *src,
+                    unsigned int len, void *page)
+{
+    switch ( c->algorithm )
+    {
+    case COMPRESSED_PAGE_DATA_ALG_LZ4:
+    {
+        size_t out = PAGE_SIZE;
+
+        if ( lz4_decompress_unknownoutputsize(src, len, page, &out) ||
+             out != PAGE_SIZE )
+            return -1;
+
+        return 0;
+    }
+
+#if defined(HAVE_ZSTD)
+    case COMPRESSED_PAGE_DATA_ALG_ZSTD:
+    {
+        size_t out = ZSTD_decompressDCtx(c->zstd.dctx, page, PAGE_SIZE,
+                                         src, len);
+
+        if ( ZSTD_isError(out) || out != PAGE_SIZE )
+            return -1;
+
+        return 0;
+    }
+#endif
+
+    default:
+        assert(!"Bad compression algorithm");
+        return -1;
+    }
+}
+
+/*
+ * Local variables:
+ * mode: C
+ * c-file-style: "BSD"
+ * c-basic-offset: 4
+ * tab-width: 4
+ * indent-tabs-mode: nil
+ * End:
+ */
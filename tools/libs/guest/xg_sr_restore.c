@@ -1,6 +1,12 @@
 #include <arpa/inet.h>
 
 #include <assert.h>
+#include <poll.h>
+#include <pthread.h>
+#include <unistd.h>
+
+#include <xenevtchn.h>
+#include <xen/vm_event.h>
 
 #include "xg_sr_common.h"
 
@@ -72,25 +78,127 @@ static int read_headers(struct xc_sr_context *ctx)
 }
 
 /*
- * Is a pfn populated?
+ * The page data pipeline.
+ *
+ * Page data records are validated by the main thread as it reads them, and
+ * gathered into groups of consecutive records with distinct pfns.  When a
+ * group is complete, the main thread populates all of its pfns in one go,
+ * using superpage sized extents where the group covers a whole aligned
+ * chunk.  Each record is then handed to a pool of worker threads, which map
+ * the frames and copy, expand or clear the page contents.
+ *
+ * Workers may complete records in any order, so a record is only handed over
+ * once no earlier record with any of its pfns is still in progress.  Jobs
+ * live in a ring of nr_jobs slots, indexed by sequence number:
+ *
+ *   take_seq <= submit_seq <= fill_seq <= take_seq + nr_jobs
+ *
+ * - fill_seq:   the next job to be filled by the main thread.
+ * - submit_seq: the first job of the group not yet handed over.
+ * - take_seq:   the next handed over job to be picked up by a worker.
+ *
+ * The pipeline is drained before any other record is processed, so they
+ * always see the page data which preceded them in the stream.
+ *
+ * For PV guests, whose page tables are rewritten with reference to the rest
+ * of the p2m as they arrive, or if the xc_interface was opened non-reentrant,
+ * or only a single CPU is available, no threads are created and each group
+ * is processed by the main thread once populated.
  */
-static bool pfn_is_populated(const struct xc_sr_context *ctx, xen_pfn_t pfn)
+#define RESTORE_PIPELINE_MAX_WORKERS 4
+
+/* Limits on the records in a group, which are populated together. */
+#define RESTORE_GROUP_MAX_RECORDS 4
+#define RESTORE_GROUP_MAX_PFNS    (2 * MAX_BATCH_SIZE)
+
+/* Superpages, as used for populating whole aligned chunks. */
+#define SUPERPAGE_ORDER 9
+#define SUPERPAGE_NR_PFNS (1UL << SUPERPAGE_ORDER)
+
+enum xc_sr_job_state
 {
-    if ( pfn > ctx->restore.max_populated_pfn )
-        return false;
-    return test_bit(pfn, ctx->restore.populated_pfns);
-}
+    JOB_FREE,
+    JOB_GROUPED,
+    JOB_QUEUED,
+    JOB_RUNNING,
+};
+
+struct xc_sr_restore_job
+{
+    enum xc_sr_job_state state;
+
+    /* The record's body, which page_data and lengths point into. */
+    void *rec_data;
+
+    unsigned int count;
+    xen_pfn_t *pfns;
+    uint32_t *types;
+
+    /* For COMPRESSED_PAGE_DATA, also lengths and algorithm. */
+    void *page_data;
+    const uint32_t *lengths;
+    uint32_t algorithm;
+
+    /*
+     * For pages elided as zero, no page_data.  The pfns set in 'clear' are
+     * those which held data before the record, and need clearing.
+     */
+    bool zero;
+    unsigned long *clear;
+};
+
+struct xc_sr_restore_worker
+{
+    struct xc_sr_context *ctx;
+    pthread_t thread;
+    bool started;
+
+    /* For the most recent COMPRESSED_PAGE_DATA record. */
+    struct xc_sr_compressor *compressor;
+    uint32_t compressor_alg;
+};
+
+struct xc_sr_restore_pipeline
+{
+    pthread_mutex_t lock;
+    pthread_cond_t cond;
+
+    struct xc_sr_restore_job *jobs;
+    unsigned int nr_jobs;
+
+    unsigned long fill_seq, submit_seq, take_seq;
+    /* Handed over jobs not yet completed. */
+    unsigned int nr_pending;
+
+    /* Pfns of the group being gathered.  Main thread only. */
+    unsigned long *group_pfns;
+    xen_pfn_t max_group_pfn;
+    unsigned int nr_group_pfns;
+
+    /* Pfns of handed over jobs not yet completed.  Under the lock. */
+    unsigned long *busy_pfns;
+    xen_pfn_t max_busy_pfn;
+
+    bool threaded;
+    bool stop;
+    unsigned int nr_workers;
+    struct xc_sr_restore_worker workers[RESTORE_PIPELINE_MAX_WORKERS];
+
+    /* First failure of a worker, and the errno to go with it. */
+    int rc, err;
+};
 
 /*
- * Set a pfn as populated, expanding the tracking structures if needed. To
- * avoid realloc()ing too excessively, the size increased to the nearest power
- * of two large enough to contain the required pfn.
+ * Expand a bitmap of pfns, if needed, to cover a pfn.  To avoid realloc()ing
+ * too excessively, the size increased to the nearest power of two large
+ * enough to contain the required pfn.
  */
-static int pfn_set_populated(struct xc_sr_context *ctx, xen_pfn_t pfn)
+static int expand_pfn_bitmap(struct xc_sr_context *ctx, unsigned long **bitmap,
+                             xen_pfn_t *max_pfn, xen_pfn_t pfn)
 {
     xc_interface *xch = ctx->xch;
 
-    if ( pfn > ctx->restore.max_populated_pfn )
+    if ( pfn > *max_pfn )
     {
         xen_pfn_t new_max;
         size_t old_sz, new_sz;
@@ -107,28 +215,107 @@ static int pfn_set_populated(struct xc_sr_context *ctx, xen_pfn_t pfn)
         new_max |= new_max >> 32;
 #endif
 
-        old_sz = bitmap_size(ctx->restore.max_populated_pfn + 1);
+        old_sz = bitmap_size(*max_pfn + 1);
         new_sz = bitmap_size(new_max + 1);
-        p = realloc(ctx->restore.populated_pfns, new_sz);
+        p = realloc(*bitmap, new_sz);
         if ( !p )
         {
-            ERROR("Failed to realloc populated bitmap");
+            ERROR("Failed to realloc pfn bitmap");
             errno = ENOMEM;
             return -1;
         }
 
         memset((uint8_t *)p + old_sz, 0x00, new_sz - old_sz);
 
-        ctx->restore.populated_pfns    = p;
-        ctx->restore.max_populated_pfn = new_max;
+        *bitmap  = p;
+        *max_pfn = new_max;
     }
 
+    return 0;
+}
+
+/*
+ * Is a pfn populated?
+ */
+static bool pfn_is_populated(const struct xc_sr_context *ctx, xen_pfn_t pfn)
+{
+    if ( pfn > ctx->restore.max_populated_pfn )
+        return false;
+    return test_bit(pfn, ctx->restore.populated_pfns);
+}
+
+/*
+ * Set a pfn as populated, expanding the tracking structures if needed.
+ */
+static int pfn_set_populated(struct xc_sr_context *ctx, xen_pfn_t pfn)
+{
+    if ( expand_pfn_bitmap(ctx, &ctx->restore.populated_pfns,
+                           &ctx->restore.max_populated_pfn, pfn) )
+        return -1;
+
     assert(!test_bit(pfn, ctx->restore.populated_pfns));
     set_bit(pfn, ctx->restore.populated_pfns);
 
     return 0;
 }
 
+static int compare_pfns(const void *l, const void *r)
+{
+    xen_pfn_t lhs = *(const xen_pfn_t *)l, rhs = *(const xen_pfn_t *)r;
+
+    return (lhs > rhs) - (lhs < rhs);
+}
+
+/*
+ * Populate whole aligned chunks of a sorted set of pfns as superpages.
+ * Pfns of chunks which are populated are removed from the set, leaving
+ * those to be populated individually.
+ */
+static void populate_superpages(struct xc_sr_context *ctx,
+                                unsigned int *nr_pfns, xen_pfn_t *pfns,
+                                xen_pfn_t *chunks)
+{
+    xc_interface *xch = ctx->xch;
+    unsigned int i, j, nr_chunks = 0, nr_left = 0;
+    int done;
+
+    for ( i = 0; i + SUPERPAGE_NR_PFNS <= *nr_pfns; )
+    {
+        if ( !(pfns[i] & (SUPERPAGE_NR_PFNS - 1)) &&
+             pfns[i + SUPERPAGE_NR_PFNS - 1] ==
+             pfns[i] + SUPERPAGE_NR_PFNS - 1 )
+        {
+            chunks[nr_chunks++] = pfns[i];
+            i += SUPERPAGE_NR_PFNS;
+        }
+        else
+            ++i;
+    }
+
+    if ( !nr_chunks )
+        return;
+
+    /* Fragmentation in Xen may leave fewer superpages than asked for. */
+    done = xc_domain_populate_physmap(xch, ctx->domid, nr_chunks,
+                                      SUPERPAGE_ORDER, 0, chunks);
+    if ( done < 0 )
+        done = 0;
+
+    for ( i = 0, j = 0; i < *nr_pfns; ++i )
+    {
+        while ( j < done && chunks[j] + SUPERPAGE_NR_PFNS <= pfns[i] )
+            ++j;
+
+        if ( j < done && pfns[i] >= chunks[j] )
+            ctx->restore.ops.set_gfn(ctx, pfns[i], pfns[i]);
+        else
+            pfns[nr_left++] = pfns[i];
+    }
+
+    ctx->restore.nr_superpages += done;
+    *nr_pfns = nr_left;
+}
+
 /*
  * Given a set of pfns, obtain memory from Xen to fill the physmap for the
  * unpopulated subset.  If types is NULL, no page type checking is performed
@@ -163,6 +350,13 @@ int populate_pfns(struct xc_sr_context *ctx, unsigned int count,
         }
     }
 
+    if ( ctx->restore.superpages && nr_pfns >= SUPERPAGE_NR_PFNS )
+    {
+        qsort(pfns, nr_pfns, sizeof(*pfns), compare_pfns);
+        populate_superpages(ctx, &nr_pfns, pfns, mfns);
+        memcpy(mfns, pfns, nr_pfns * sizeof(*mfns));
+    }
+
     if ( nr_pfns )
     {
         rc = xc_domain_populate_physmap_exact(
@@ -196,18 +390,30 @@ int populate_pfns(struct xc_sr_context *ctx, unsigned int count,
 }
 
 /*
- * Given a list of pfns, their types, and a block of page data from the
- * stream, populate and record their types, map the relevant subset and copy
- * the data into the guest.
+ * Given a job of pfns, their types, and a block of page data from the
+ * stream, record their types, map the relevant subset and copy the data into
+ * the guest.  The pfns must already be populated.
+ *
+ * For a COMPRESSED_PAGE_DATA record, the lengths give the size of each page
+ * in the block of data, which is expanded with 'compressor' unless it is a
+ * full page.
+ *
+ * For pages elided from the stream as zero, the pages to clear are mapped
+ * instead.
  */
-static int process_page_data(struct xc_sr_context *ctx, unsigned int count,
-                             xen_pfn_t *pfns, uint32_t *types, void *page_data)
+static int process_page_data(struct xc_sr_context *ctx,
+                             const struct xc_sr_restore_job *job,
+                             struct xc_sr_compressor *compressor)
 {
     xc_interface *xch = ctx->xch;
+    unsigned int count = job->count;
+    const xen_pfn_t *pfns = job->pfns;
+    const uint32_t *types = job->types, *lengths = job->lengths;
+    void *page_data = job->page_data;
     xen_pfn_t *mfns = malloc(count * sizeof(*mfns));
     int *map_errs = malloc(count * sizeof(*map_errs));
     int rc;
-    void *mapping = NULL, *guest_page = NULL;
+    void *mapping = NULL, *guest_page = NULL, *bounce = NULL, *data;
     unsigned int i, /* i indexes the pfns from the record. */
         j,          /* j indexes the subset of pfns we decide to map. */
         nr_pages = 0;
@@ -220,10 +426,10 @@ static int process_page_data(struct xc_sr_context *ctx, unsigned int count,
         goto err;
     }
 
-    rc = populate_pfns(ctx, count, pfns, types);
-    if ( rc )
+    if ( lengths && !(bounce = malloc(PAGE_SIZE)) )
     {
-        ERROR("Failed to populate pfns for batch of %u pages", count);
+        rc = -1;
+        ERROR("Failed to allocate a page to expand page data into");
         goto err;
     }
 
@@ -231,189 +437,1807 @@ static int process_page_data(struct xc_sr_context *ctx, unsigned int count,
     {
         ctx->restore.ops.set_page_type(ctx, pfns[i], types[i]);
 
-        if ( page_type_has_stream_data(types[i]) )
-            mfns[nr_pages++] = ctx->restore.ops.pfn_to_gfn(ctx, pfns[i]);
+        if ( job->zero ? test_bit(i, job->clear)
+                       : page_type_has_stream_data(types[i]) )
+            mfns[nr_pages++] = ctx->restore.ops.pfn_to_gfn(ctx, pfns[i]);
+    }
+
+    /* Nothing to do? */
+    if ( nr_pages == 0 )
+        goto done;
+
+    mapping = guest_page = xenforeignmemory_map(
+        xch->fmem, ctx->domid, PROT_READ | PROT_WRITE,
+        nr_pages, mfns, map_errs);
+    if ( !mapping )
+    {
+        rc = -1;
+        PERROR("Unable to map %u mfns for %u pages of data",
+               nr_pages, count);
+        goto err;
+    }
+
+    if ( job->zero )
+    {
+        for ( j = 0; j < nr_pages; ++j, guest_page += PAGE_SIZE )
+        {
+            if ( map_errs[j] )
+            {
+                rc = -1;
+                ERROR("Mapping mfn %#"PRIpfn" to clear failed with %d",
+                      mfns[j], map_errs[j]);
+                goto err;
+            }
+
+            if ( !ctx->restore.verify )
+                memset(guest_page, 0, PAGE_SIZE);
+            else if ( !page_is_zero(guest_page) )
+                ERROR("verify mfn %#"PRIpfn" failed (expected zero page)",
+                      mfns[j]);
+        }
+
+        goto done;
+    }
+
+    for ( i = 0, j = 0; i < count; ++i )
+    {
+        if ( !page_type_has_stream_data(types[i]) )
+            continue;
+
+        if ( map_errs[j] )
+        {
+            rc = -1;
+            ERROR("Mapping pfn %#"PRIpfn" (mfn %#"PRIpfn", type %#"PRIx32") failed with %d",
+                  pfns[i], mfns[j], types[i], map_errs[j]);
+            goto err;
+        }
+
+        if ( !lengths )
+            data = page_data;
+        else if ( lengths[j] == PAGE_SIZE )
+            /* Sent uncompressed, but not necessarily suitably aligned. */
+            data = memcpy(bounce, page_data, PAGE_SIZE);
+        else
+        {
+            data = bounce;
+            if ( decompress_page(compressor, page_data, lengths[j], data) )
+            {
+                rc = -1;
+                ERROR("Failed to decompress pfn %#"PRIpfn" (%u bytes of %s)",
+                      pfns[i], lengths[j],
+                      compress_alg_to_str(job->algorithm));
+                goto err;
+            }
+        }
+
+        /* Undo page normalisation done by the saver. */
+        rc = ctx->restore.ops.localise_page(ctx, types[i], data);
+        if ( rc )
+        {
+            ERROR("Failed to localise pfn %#"PRIpfn" (type %#"PRIx32")",
+                  pfns[i], types[i] >> XEN_DOMCTL_PFINFO_LTAB_SHIFT);
+            goto err;
+        }
+
+        if ( ctx->restore.verify )
+        {
+            /* Verify mode - compare incoming data to what we already have. */
+            if ( memcmp(guest_page, data, PAGE_SIZE) )
+                ERROR("verify pfn %#"PRIpfn" failed (type %#"PRIx32")",
+                      pfns[i], types[i] >> XEN_DOMCTL_PFINFO_LTAB_SHIFT);
+        }
+        else
+        {
+            /* Regular mode - copy incoming data into place. */
+            memcpy(guest_page, data, PAGE_SIZE);
+        }
+
+        page_data += lengths ? lengths[j] : PAGE_SIZE;
+        ++j;
+        guest_page += PAGE_SIZE;
+    }
+
+ done:
+    rc = 0;
+
+ err:
+    if ( mapping )
+        xenforeignmemory_unmap(xch->fmem, mapping, nr_pages);
+
+    free(bounce);
+    free(map_errs);
+    free(mfns);
+
+    return rc;
+}
+
+/*
+ * Make sure *compressor, for the algorithm in *alg, is one for the algorithm
+ * of a job's record.
+ */
+static int get_compressor(struct xc_sr_context *ctx,
+                          const struct xc_sr_restore_job *job,
+                          struct xc_sr_compressor **compressor, uint32_t *alg)
+{
+    if ( job->lengths && (!*compressor || *alg != job->algorithm) )
+    {
+        free_compressor(*compressor);
+        *compressor = alloc_compressor(ctx->xch, job->algorithm);
+        if ( !*compressor )
+            return -1;
+
+        *alg = job->algorithm;
+    }
+
+    return 0;
+}
+
+/*
+ * Process a job, with a compressor for the algorithm of its record kept
+ * in *compressor.
+ */
+static int run_job(struct xc_sr_context *ctx, struct xc_sr_restore_job *job,
+                   struct xc_sr_compressor **compressor, uint32_t *alg)
+{
+    if ( get_compressor(ctx, job, compressor, alg) )
+        return -1;
+
+    return process_page_data(ctx, job, *compressor);
+}
+
+static void release_job(struct xc_sr_restore_job *job)
+{
+    free(job->clear);
+    free(job->types);
+    free(job->pfns);
+    free(job->rec_data);
+
+    job->clear = NULL;
+    job->types = NULL;
+    job->pfns = NULL;
+    job->rec_data = NULL;
+}
+
+/* Record the first failure of a worker.  Called with the lock held. */
+static void pipeline_set_error(struct xc_sr_restore_pipeline *pl, int err)
+{
+    if ( pl->rc )
+        return;
+
+    pl->rc = -1;
+    pl->err = err;
+}
+
+/*
+ * Worker thread.  Processes jobs once they are handed over, in any order.
+ */
+static void *pipeline_worker(void *arg)
+{
+    struct xc_sr_restore_worker *w = arg;
+    struct xc_sr_context *ctx = w->ctx;
+    struct xc_sr_restore_pipeline *pl = ctx->restore.pipeline;
+    struct xc_sr_restore_job *job;
+    unsigned int i;
+    bool skip;
+    int rc, err;
+
+    pthread_mutex_lock(&pl->lock);
+    for ( ; ; )
+    {
+        while ( !pl->stop && pl->take_seq == pl->submit_seq )
+            pthread_cond_wait(&pl->cond, &pl->lock);
+
+        if ( pl->stop )
+            break;
+
+        job = &pl->jobs[pl->take_seq++ % pl->nr_jobs];
+        job->state = JOB_RUNNING;
+        /* Don't bother with further work once the pipeline has failed. */
+        skip = pl->rc;
+        pthread_mutex_unlock(&pl->lock);
+
+        rc = skip ? 0 : run_job(ctx, job, &w->compressor, &w->compressor_alg);
+        err = errno;
+
+        pthread_mutex_lock(&pl->lock);
+        if ( rc )
+            pipeline_set_error(pl, err);
+        for ( i = 0; i < job->count; ++i )
+            clear_bit(job->pfns[i], pl->busy_pfns);
+        pthread_mutex_unlock(&pl->lock);
+
+        release_job(job);
+
+        pthread_mutex_lock(&pl->lock);
+        job->state = JOB_FREE;
+        pl->nr_pending--;
+        pthread_cond_broadcast(&pl->cond);
+    }
+    pthread_mutex_unlock(&pl->lock);
+
+    return NULL;
+}
+
+/*
+ * Hand a populated job over to the workers, once no earlier job with any of
+ * its pfns is in progress.  When running without threads, the job is
+ * processed immediately.
+ */
+static int submit_job(struct xc_sr_context *ctx, struct xc_sr_restore_job *job)
+{
+    struct xc_sr_restore_pipeline *pl = ctx->restore.pipeline;
+    unsigned int i;
+    int rc = 0;
+
+    if ( !pl->threaded )
+    {
+        rc = run_job(ctx, job, &ctx->restore.compressor,
+                     &ctx->restore.compressor_alg);
+        release_job(job);
+        job->state = JOB_FREE;
+        pl->submit_seq++;
+        pl->take_seq++;
+
+        return rc;
+    }
+
+    pthread_mutex_lock(&pl->lock);
+
+    for ( i = 0; i < job->count; ++i )
+    {
+        rc = expand_pfn_bitmap(ctx, &pl->busy_pfns, &pl->max_busy_pfn,
+                               job->pfns[i]);
+        if ( rc )
+            goto out;
+    }
+
+    for ( i = 0; i < job->count; )
+    {
+        if ( test_bit(job->pfns[i], pl->busy_pfns) )
+        {
+            pthread_cond_wait(&pl->cond, &pl->lock);
+            i = 0;
+        }
+        else
+            ++i;
+    }
+
+    for ( i = 0; i < job->count; ++i )
+        set_bit(job->pfns[i], pl->busy_pfns);
+
+    job->state = JOB_QUEUED;
+    pl->submit_seq++;
+    pl->nr_pending++;
+    pthread_cond_broadcast(&pl->cond);
+
+ out:
+    pthread_mutex_unlock(&pl->lock);
+
+    return rc;
+}
+
+/*
+ * Drop the jobs of a group which can't be handed over, keeping the ring in
+ * sequence.
+ */
+static void discard_group(struct xc_sr_context *ctx)
+{
+    struct xc_sr_restore_pipeline *pl = ctx->restore.pipeline;
+    struct xc_sr_restore_job *job;
+    unsigned int i;
+    int err = errno;
+
+    while ( pl->submit_seq != pl->fill_seq )
+    {
+        job = &pl->jobs[pl->submit_seq % pl->nr_jobs];
+
+        for ( i = 0; i < job->count; ++i )
+            clear_bit(job->pfns[i], pl->group_pfns);
+
+        release_job(job);
+        job->count = 0;
+
+        if ( !pl->threaded )
+        {
+            job->state = JOB_FREE;
+            pl->submit_seq++;
+            pl->take_seq++;
+            continue;
+        }
+
+        /* Workers retire the now empty job, as the pipeline has failed. */
+        pthread_mutex_lock(&pl->lock);
+        pipeline_set_error(pl, err);
+        job->state = JOB_QUEUED;
+        pl->submit_seq++;
+        pl->nr_pending++;
+        pthread_cond_broadcast(&pl->cond);
+        pthread_mutex_unlock(&pl->lock);
+    }
+
+    pl->nr_group_pfns = 0;
+    errno = err;
+}
+
+/*
+ * Populate the pfns of the gathered group of jobs, and hand the jobs over.
+ */
+static int flush_group(struct xc_sr_context *ctx)
+{
+    xc_interface *xch = ctx->xch;
+    struct xc_sr_restore_pipeline *pl = ctx->restore.pipeline;
+    struct xc_sr_restore_job *job;
+    unsigned long seq;
+    unsigned int i, nr = 0;
+    xen_pfn_t *pfns = NULL;
+    uint32_t *types = NULL;
+    int rc = -1;
+
+    if ( pl->submit_seq == pl->fill_seq )
+        return 0;
+
+    pfns = malloc(pl->nr_group_pfns * sizeof(*pfns));
+    types = malloc(pl->nr_group_pfns * sizeof(*types));
+    if ( !pfns || !types )
+    {
+        ERROR("Unable to allocate memory for %u pfns", pl->nr_group_pfns);
+        goto err;
+    }
+
+    for ( seq = pl->submit_seq; seq != pl->fill_seq; ++seq )
+    {
+        job = &pl->jobs[seq % pl->nr_jobs];
+
+        /* Only pages which held data before need clearing. */
+        if ( job->zero )
+        {
+            job->clear = bitmap_alloc(job->count);
+            if ( !job->clear )
+            {
+                ERROR("Unable to allocate memory for %u pfns", job->count);
+                goto err;
+            }
+
+            for ( i = 0; i < job->count; ++i )
+            {
+                if ( pfn_is_populated(ctx, job->pfns[i]) )
+                    set_bit(i, job->clear);
+            }
+        }
+
+        for ( i = 0; i < job->count; ++i )
+        {
+            clear_bit(job->pfns[i], pl->group_pfns);
+            pfns[nr] = job->pfns[i];
+            types[nr] = job->types[i];
+            ++nr;
+        }
+    }
+
+    assert(nr == pl->nr_group_pfns);
+    pl->nr_group_pfns = 0;
+
+    rc = populate_pfns(ctx, nr, pfns, types);
+    if ( rc )
+    {
+        ERROR("Failed to populate pfns for group of %u pages", nr);
+        goto err;
+    }
+
+    while ( pl->submit_seq != pl->fill_seq )
+    {
+        rc = submit_job(ctx, &pl->jobs[pl->submit_seq % pl->nr_jobs]);
+        if ( rc )
+            goto err;
+    }
+
+ err:
+    if ( rc )
+        discard_group(ctx);
+
+    free(types);
+    free(pfns);
+
+    return rc;
+}
+
+static bool postcopy_active(const struct xc_sr_context *ctx);
+static int postcopy_load_pages(struct xc_sr_context *ctx,
+                               const struct xc_sr_restore_job *job);
+
+/*
+ * Take over a validated page data record, adding it to the group being
+ * gathered.  The job's pfns and types arrays, and the record's data, become
+ * the pipeline's, whether successful or not.
+ *
+ * Once the domain is running in post-copy, pages are instead loaded
+ * straight away, as vcpus may be waiting on them.
+ */
+static int queue_page_data(struct xc_sr_context *ctx,
+                           struct xc_sr_record *rec,
+                           const struct xc_sr_restore_job *new)
+{
+    struct xc_sr_restore_pipeline *pl = ctx->restore.pipeline;
+    struct xc_sr_restore_job *job;
+    unsigned int i;
+    int rc = 0;
+
+    if ( postcopy_active(ctx) )
+    {
+        rc = postcopy_load_pages(ctx, new);
+        free(new->types);
+        free(new->pfns);
+
+        return rc;
+    }
+
+    /* A group may only hold one copy of a pfn. */
+    for ( i = 0; i < new->count; ++i )
+    {
+        if ( new->pfns[i] <= pl->max_group_pfn &&
+             test_bit(new->pfns[i], pl->group_pfns) )
+            break;
+    }
+
+    if ( i < new->count ||
+         pl->fill_seq - pl->submit_seq == RESTORE_GROUP_MAX_RECORDS ||
+         (pl->nr_group_pfns &&
+          pl->nr_group_pfns + new->count > RESTORE_GROUP_MAX_PFNS) )
+        rc = flush_group(ctx);
+
+    job = &pl->jobs[pl->fill_seq % pl->nr_jobs];
+
+    if ( pl->threaded )
+    {
+        pthread_mutex_lock(&pl->lock);
+        while ( job->state != JOB_FREE )
+            pthread_cond_wait(&pl->cond, &pl->lock);
+        pthread_mutex_unlock(&pl->lock);
+    }
+
+    *job = *new;
+    job->state = JOB_GROUPED;
+    job->rec_data = rec->data;
+    rec->data = NULL;
+    pl->fill_seq++;
+    pl->nr_group_pfns += job->count;
+
+    for ( i = 0; !rc && i < job->count; ++i )
+    {
+        rc = expand_pfn_bitmap(ctx, &pl->group_pfns, &pl->max_group_pfn,
+                               job->pfns[i]);
+        if ( !rc )
+            set_bit(job->pfns[i], pl->group_pfns);
+    }
+
+    if ( rc )
+        discard_group(ctx);
+
+    return rc;
+}
+
+/*
+ * Wait for all page data received so far to reach the guest.
+ */
+static int drain_pipeline(struct xc_sr_context *ctx)
+{
+    struct xc_sr_restore_pipeline *pl = ctx->restore.pipeline;
+    int rc;
+
+    rc = flush_group(ctx);
+
+    if ( !pl->threaded )
+        return rc;
+
+    pthread_mutex_lock(&pl->lock);
+
+    while ( pl->nr_pending )
+        pthread_cond_wait(&pl->cond, &pl->lock);
+
+    if ( !rc && pl->rc )
+    {
+        rc = pl->rc;
+        errno = pl->err;
+    }
+
+    pthread_mutex_unlock(&pl->lock);
+
+    return rc;
+}
+
+/*
+ * Stop and reap the worker threads.  Every handed over job must have been
+ * completed beforehand.
+ */
+static void stop_pipeline_threads(struct xc_sr_restore_pipeline *pl)
+{
+    unsigned int i;
+
+    pthread_mutex_lock(&pl->lock);
+    pl->stop = true;
+    pthread_cond_broadcast(&pl->cond);
+    pthread_mutex_unlock(&pl->lock);
+
+    for ( i = 0; i < pl->nr_workers; ++i )
+    {
+        if ( pl->workers[i].started )
+            pthread_join(pl->workers[i].thread, NULL);
+        pl->workers[i].started = false;
+    }
+
+    pthread_cond_destroy(&pl->cond);
+    pthread_mutex_destroy(&pl->lock);
+}
+
+/*
+ * Allocate the jobs and start the worker threads.  Failure to start the
+ * threads isn't fatal; the page data is then processed synchronously.
+ */
+static int setup_pipeline(struct xc_sr_context *ctx)
+{
+    xc_interface *xch = ctx->xch;
+    struct xc_sr_restore_pipeline *pl;
+    long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    unsigned int i;
+    int rc;
+
+    pl = calloc(1, sizeof(*pl));
+    if ( !pl )
+    {
+        ERROR("Unable to allocate page data pipeline");
+        return -1;
+    }
+    ctx->restore.pipeline = pl;
+
+    pl->max_group_pfn = pl->max_busy_pfn = (32 * 1024 / 4) - 1;
+    pl->group_pfns = bitmap_alloc(pl->max_group_pfn + 1);
+    pl->busy_pfns = bitmap_alloc(pl->max_busy_pfn + 1);
+    if ( !pl->group_pfns || !pl->busy_pfns )
+    {
+        ERROR("Unable to allocate memory for page data pipeline bitmaps");
+        return -1;
+    }
+
+    if ( ctx->dominfo.flags & XEN_DOMINF_hvm_guest &&
+         !(xch->flags & XC_OPENFLAG_NON_REENTRANT) && cpus > 1 )
+        pl->nr_workers = min_t(long, cpus - 1, RESTORE_PIPELINE_MAX_WORKERS);
+
+    pl->nr_jobs = RESTORE_GROUP_MAX_RECORDS + 2 * pl->nr_workers;
+    pl->jobs = calloc(pl->nr_jobs, sizeof(*pl->jobs));
+    if ( !pl->jobs )
+    {
+        ERROR("Unable to allocate %u page data jobs", pl->nr_jobs);
+        return -1;
+    }
+
+    if ( !pl->nr_workers )
+        return 0;
+
+    pthread_mutex_init(&pl->lock, NULL);
+    pthread_cond_init(&pl->cond, NULL);
+
+    for ( i = 0; i < pl->nr_workers; ++i )
+    {
+        pl->workers[i].ctx = ctx;
+
+        rc = pthread_create(&pl->workers[i].thread, NULL, pipeline_worker,
+                            &pl->workers[i]);
+        if ( rc )
+        {
+            errno = rc;
+            PERROR("Unable to create page data worker thread");
+            stop_pipeline_threads(pl);
+            goto sync;
+        }
+
+        pl->workers[i].started = true;
+    }
+
+    pl->threaded = true;
+    DPRINTF("Page data pipeline: %u workers, %u jobs",
+            pl->nr_workers, pl->nr_jobs);
+
+    return 0;
+
+ sync:
+    IPRINTF("Processing page data without a pipeline");
+    pl->nr_workers = 0;
+    pl->stop = false;
+
+    return 0;
+}
+
+static void teardown_pipeline(struct xc_sr_context *ctx)
+{
+    struct xc_sr_restore_pipeline *pl = ctx->restore.pipeline;
+    unsigned int i;
+
+    if ( !pl )
+        return;
+
+    discard_group(ctx);
+
+    if ( pl->threaded )
+    {
+        /* Let any jobs still in flight (after an error) complete. */
+        drain_pipeline(ctx);
+        stop_pipeline_threads(pl);
+    }
+
+    for ( i = 0; i < RESTORE_PIPELINE_MAX_WORKERS; ++i )
+        free_compressor(pl->workers[i].compressor);
+
+    for ( i = 0; pl->jobs && i < pl->nr_jobs; ++i )
+        release_job(&pl->jobs[i]);
+
+    free(pl->jobs);
+    free(pl->busy_pfns);
+    free(pl->group_pfns);
+    free(pl);
+    ctx->restore.pipeline = NULL;
+}
+
+/*
+ * Page data may only appear once the static data is complete.
+ */
+static int check_static_data_end(struct xc_sr_context *ctx)
+{
+    xc_interface *xch = ctx->xch;
+
+    /*
+     * v2 compatibility only exists for x86 streams.  This is a bit of a
+     * bodge, but it is less bad than duplicating handle_page_data() between
+     * different architectures.
+     */
+#if defined(__i386__) || defined(__x86_64__)
+    /* v2 compat.  Infer the position of STATIC_DATA_END. */
+    if ( ctx->restore.format_version < 3 && !ctx->restore.seen_static_data_end )
+    {
+        if ( handle_static_data_end(ctx) )
+        {
+            ERROR("Inferred STATIC_DATA_END record failed");
+            return -1;
+        }
+    }
+
+    if ( !ctx->restore.seen_static_data_end )
+    {
+        ERROR("No STATIC_DATA_END seen");
+        return -1;
+    }
+#endif
+
+    return 0;
+}
+
+/*
+ * Validate and decode the pfn array of a PAGE_DATA, COMPRESSED_PAGE_DATA or
+ * ELIDED_PAGE_DATA record, counting the pages which have data.
+ */
+static int decode_page_data_pfns(struct xc_sr_context *ctx,
+                                 unsigned int count, const uint64_t *rec_pfns,
+                                 xen_pfn_t *pfns, uint32_t *types,
+                                 unsigned int *pages_of_data)
+{
+    xc_interface *xch = ctx->xch;
+    unsigned int i;
+    xen_pfn_t pfn;
+    uint32_t type;
+
+    *pages_of_data = 0;
+
+    for ( i = 0; i < count; ++i )
+    {
+        pfn = rec_pfns[i] & PAGE_DATA_PFN_MASK;
+        if ( !ctx->restore.ops.pfn_is_valid(ctx, pfn) )
+        {
+            ERROR("pfn %#"PRIpfn" (index %u) outside domain maximum", pfn, i);
+            return -1;
+        }
+
+        type = (rec_pfns[i] & PAGE_DATA_TYPE_MASK) >> 32;
+        if ( !is_known_page_type(type) )
+        {
+            ERROR("Unknown type %#"PRIx32" for pfn %#"PRIpfn" (index %u)",
+                  type, pfn, i);
+            return -1;
+        }
+
+        if ( page_type_has_stream_data(type) )
+            /* NOTAB and all L1 through L4 tables (including pinned) should
+             * have a page worth of data in the record. */
+            (*pages_of_data)++;
+
+        pfns[i] = pfn;
+        types[i] = type;
+    }
+
+    return 0;
+}
+
+/*
+ * Validate a PAGE_DATA record from the stream, and queue the results for
+ * process_page_data() to actually perform the legwork.
+ */
+static int handle_page_data(struct xc_sr_context *ctx, struct xc_sr_record *rec)
+{
+    xc_interface *xch = ctx->xch;
+    struct xc_sr_rec_page_data_header *pages = rec->data;
+    struct xc_sr_restore_job job = {};
+    unsigned int pages_of_data;
+    int rc = -1;
+
+    xen_pfn_t *pfns = NULL;
+    uint32_t *types = NULL;
+
+    if ( check_static_data_end(ctx) )
+        goto err;
+
+    if ( rec->length < sizeof(*pages) )
+    {
+        ERROR("PAGE_DATA record truncated: length %u, min %zu",
+              rec->length, sizeof(*pages));
+        goto err;
+    }
+
+    if ( pages->count < 1 )
+    {
+        ERROR("Expected at least 1 pfn in PAGE_DATA record");
+        goto err;
+    }
+
+    if ( rec->length < sizeof(*pages) + (pages->count * sizeof(uint64_t)) )
+    {
+        ERROR("PAGE_DATA record (length %u) too short to contain %u"
+              " pfns worth of information", rec->length, pages->count);
+        goto err;
+    }
+
+    pfns = malloc(pages->count * sizeof(*pfns));
+    types = malloc(pages->count * sizeof(*types));
+    if ( !pfns || !types )
+    {
+        ERROR("Unable to allocate enough memory for %u pfns",
+              pages->count);
+        goto err;
+    }
+
+    if ( decode_page_data_pfns(ctx, pages->count, pages->pfn,
+                               pfns, types, &pages_of_data) )
+        goto err;
+
+    if ( rec->length != (sizeof(*pages) +
+                         (sizeof(uint64_t) * pages->count) +
+                         (PAGE_SIZE * pages_of_data)) )
+    {
+        ERROR("PAGE_DATA record wrong size: length %u, expected "
+              "%zu + %zu + %lu", rec->length, sizeof(*pages),
+              (sizeof(uint64_t) * pages->count), (PAGE_SIZE * pages_of_data));
+        goto err;
+    }
+
+    job.count = pages->count;
+    job.pfns = pfns;
+    job.types = types;
+    job.page_data = &pages->pfn[pages->count];
+    pfns = NULL;
+    types = NULL;
+
+    rc = queue_page_data(ctx, rec, &job);
+ err:
+    free(types);
+    free(pfns);
+
+    return rc;
+}
+
+/*
+ * Validate a COMPRESSED_PAGE_DATA record from the stream, and queue the
+ * results for process_page_data() to expand the pages into the guest.
+ */
+static int handle_compressed_page_data(struct xc_sr_context *ctx,
+                                       struct xc_sr_record *rec)
+{
+    xc_interface *xch = ctx->xch;
+    struct xc_sr_rec_compressed_page_data_header *pages = rec->data;
+    struct xc_sr_compress_stats *stats = &ctx->restore.compress_stats;
+    struct xc_sr_restore_job job = {};
+    unsigned int i, pages_of_data;
+    const uint32_t *lengths;
+    size_t data_len = 0;
+    int rc = -1;
+
+    xen_pfn_t *pfns = NULL;
+    uint32_t *types = NULL;
+
+    if ( check_static_data_end(ctx) )
+        goto err;
+
+    if ( rec->length < sizeof(*pages) )
+    {
+        ERROR("COMPRESSED_PAGE_DATA record truncated: length %u, min %zu",
+              rec->length, sizeof(*pages));
+        goto err;
+    }
+
+    if ( pages->count < 1 )
+    {
+        ERROR("Expected at least 1 pfn in COMPRESSED_PAGE_DATA record");
+        goto err;
+    }
+
+    if ( rec->length < sizeof(*pages) + (pages->count * sizeof(uint64_t)) )
+    {
+        ERROR("COMPRESSED_PAGE_DATA record (length %u) too short to contain"
+              " %u pfns worth of information", rec->length, pages->count);
+        goto err;
+    }
+
+    if ( !compress_alg_supported(pages->algorithm) )
+    {
+        ERROR("Page compression algorithm %#x (%s) not supported",
+              pages->algorithm, compress_alg_to_str(pages->algorithm));
+        errno = EOPNOTSUPP;
+        goto err;
+    }
+
+    if ( !stats->batches )
+        DPRINTF("Page data compressed with %s",
+                compress_alg_to_str(pages->algorithm));
+
+    pfns = malloc(pages->count * sizeof(*pfns));
+    types = malloc(pages->count * sizeof(*types));
+    if ( !pfns || !types )
+    {
+        ERROR("Unable to allocate enough memory for %u pfns",
+              pages->count);
+        goto err;
+    }
+
+    if ( decode_page_data_pfns(ctx, pages->count, pages->pfn,
+                               pfns, types, &pages_of_data) )
+        goto err;
+
+    if ( rec->length < (sizeof(*pages) +
+                        (sizeof(uint64_t) * pages->count) +
+                        (sizeof(*lengths) * pages_of_data)) )
+    {
+        ERROR("COMPRESSED_PAGE_DATA record (length %u) too short to contain"
+              " %u page lengths", rec->length, pages_of_data);
+        goto err;
+    }
+
+    lengths = (const uint32_t *)&pages->pfn[pages->count];
+
+    for ( i = 0; i < pages_of_data; ++i )
+    {
+        if ( lengths[i] == 0 || lengths[i] > PAGE_SIZE )
+        {
+            ERROR("Bad length %u for compressed page (index %u)",
+                  lengths[i], i);
+            goto err;
+        }
+
+        stats->raw_pages += (lengths[i] == PAGE_SIZE);
+        data_len += lengths[i];
+    }
+
+    if ( rec->length != (sizeof(*pages) +
+                         (sizeof(uint64_t) * pages->count) +
+                         (sizeof(*lengths) * pages_of_data) + data_len) )
+    {
+        ERROR("COMPRESSED_PAGE_DATA record wrong size: length %u, expected "
+              "%zu + %zu + %zu + %zu", rec->length, sizeof(*pages),
+              (sizeof(uint64_t) * pages->count),
+              (sizeof(*lengths) * pages_of_data), data_len);
+        goto err;
+    }
+
+    stats->pages += pages_of_data;
+    stats->bytes += (sizeof(*lengths) * pages_of_data) + data_len;
+    stats->batches++;
+
+    job.count = pages->count;
+    job.pfns = pfns;
+    job.types = types;
+    job.page_data = (void *)&lengths[pages_of_data];
+    job.lengths = lengths;
+    job.algorithm = pages->algorithm;
+    pfns = NULL;
+    types = NULL;
+
+    rc = queue_page_data(ctx, rec, &job);
+ err:
+    free(types);
+    free(pfns);
+
+    return rc;
+}
+
+/*
+ * Validate an ELIDED_PAGE_DATA record from the stream.  Zero pages are
+ * queued for process_page_data() to populate or clear.  Unchanged pages
+ * must already hold their data, so need nothing doing.
+ */
+static int handle_elided_page_data(struct xc_sr_context *ctx,
+                                   struct xc_sr_record *rec)
+{
+    xc_interface *xch = ctx->xch;
+    struct xc_sr_rec_elided_page_data_header *pages = rec->data;
+    struct xc_sr_restore_job job = {};
+    unsigned int i, pages_of_data;
+    int rc = -1;
+
+    xen_pfn_t *pfns = NULL;
+    uint32_t *types = NULL;
+
+    if ( check_static_data_end(ctx) )
+        goto err;
+
+    if ( rec->length < sizeof(*pages) )
+    {
+        ERROR("ELIDED_PAGE_DATA record truncated: length %u, min %zu",
+              rec->length, sizeof(*pages));
+        goto err;
+    }
+
+    if ( pages->count < 1 )
+    {
+        ERROR("Expected at least 1 pfn in ELIDED_PAGE_DATA record");
+        goto err;
+    }
+
+    if ( rec->length != sizeof(*pages) + (pages->count * sizeof(uint64_t)) )
+    {
+        ERROR("ELIDED_PAGE_DATA record wrong size: length %u, expected "
+              "%zu + %zu", rec->length, sizeof(*pages),
+              (sizeof(uint64_t) * pages->count));
+        goto err;
+    }
+
+    pfns = malloc(pages->count * sizeof(*pfns));
+    types = malloc(pages->count * sizeof(*types));
+    if ( !pfns || !types )
+    {
+        ERROR("Unable to allocate enough memory for %u pfns",
+              pages->count);
+        goto err;
+    }
+
+    if ( decode_page_data_pfns(ctx, pages->count, pages->pfn,
+                               pfns, types, &pages_of_data) )
+        goto err;
+
+    if ( pages_of_data != pages->count )
+    {
+        ERROR("ELIDED_PAGE_DATA record has %u pfns without data",
+              pages->count - pages_of_data);
+        goto err;
+    }
+
+    switch ( pages->reason )
+    {
+    case ELIDED_PAGE_DATA_ZERO:
+        ctx->restore.elide_stats.zero_pages += pages->count;
+
+        job.count = pages->count;
+        job.pfns = pfns;
+        job.types = types;
+        job.zero = true;
+        pfns = NULL;
+        types = NULL;
+
+        rc = queue_page_data(ctx, rec, &job);
+        break;
+
+    case ELIDED_PAGE_DATA_UNCHANGED:
+        for ( i = 0; i < pages->count; ++i )
+        {
+            /* The data may have been sent in the group being gathered. */
+            if ( !pfn_is_populated(ctx, pfns[i]) &&
+                 (flush_group(ctx) || !pfn_is_populated(ctx, pfns[i])) )
+            {
+                ERROR("pfn %#"PRIpfn" unchanged, but never sent", pfns[i]);
+                goto err;
+            }
+        }
+
+        rc = 0;
+        ctx->restore.elide_stats.unchanged_pages += pages->count;
+        break;
+
+    default:
+        ERROR("Unknown reason %#"PRIx32" for eliding page data",
+              pages->reason);
+        goto err;
+    }
+
+ err:
+    free(types);
+    free(pfns);
+
+    return rc;
+}
+
+static int process_record(struct xc_sr_context *ctx, struct xc_sr_record *rec);
+
+/*
+ * Process the chunk which a STRIPED_DATA record stands in for, taking its
+ * page data records from the further stream named.  Taking chunks in the
+ * order of the main stream applies page data in the order it was sent.
+ */
+static int handle_striped_data(struct xc_sr_context *ctx,
+                               struct xc_sr_record *rec)
+{
+    xc_interface *xch = ctx->xch;
+    struct xc_sr_rec_striped_data *sd = rec->data, hdr;
+    struct xc_sr_record *recs;
+    unsigned int i;
+    int rc = 0;
+
+    if ( rec->length != sizeof(*sd) )
+    {
+        ERROR("STRIPED_DATA record wrong size: length %u, expected %zu",
+              rec->length, sizeof(*sd));
+        return -1;
+    }
+
+    if ( sd->stream < 1 || sd->stream > ctx->restore.nr_stripe_fds )
+    {
+        ERROR("STRIPED_DATA record for stream %u, with %u further streams",
+              sd->stream, ctx->restore.nr_stripe_fds);
+        return -1;
+    }
+
+    if ( sd->seq != ctx->restore.stripe_seq )
+    {
+        ERROR("STRIPED_DATA record for chunk %"PRIu64", expected %"PRIu64,
+              sd->seq, ctx->restore.stripe_seq);
+        return -1;
+    }
+
+    if ( take_striped_chunk(ctx->restore.stripes, sd->stream, &hdr, &recs) )
+        return -1;
+
+    if ( memcmp(&hdr, sd, sizeof(hdr)) )
+    {
+        ERROR("Chunk %"PRIu64" expected on stream %u, found chunk %"PRIu64
+              " of %u records", sd->seq, sd->stream, hdr.seq, hdr.count);
+        rc = -1;
+    }
+
+    for ( i = 0; i < hdr.count; ++i )
+    {
+        if ( rc )
+        {
+            free(recs[i].data);
+            continue;
+        }
+
+        switch ( recs[i].type )
+        {
+        case REC_TYPE_PAGE_DATA:
+        case REC_TYPE_COMPRESSED_PAGE_DATA:
+        case REC_TYPE_ELIDED_PAGE_DATA:
+            rc = process_record(ctx, &recs[i]);
+            break;
+
+        default:
+            ERROR("Unexpected %s record in chunk %"PRIu64,
+                  rec_type_to_str(recs[i].type), sd->seq);
+            free(recs[i].data);
+            rc = -1;
+            break;
+        }
+    }
+
+    free(recs);
+    ctx->restore.stripe_seq++;
+
+    return rc;
+}
+
+/*
+ * Post-copy migration.
+ *
+ * POSTCOPY_PFNS records list the pfns whose contents will only be sent after
+ * the domain has been resumed here.  At the POSTCOPY_TRANSITION record, the
+ * domain is completed, and each of those pfns is marked as paged out so a
+ * vcpu touching one is paused and reported over a mem_paging ring.  The
+ * domain is then resumed, and from there on the page data in the stream is
+ * loaded as it arrives, while the pfns of faults are reported back to the
+ * sender so those pages are sent ahead of the rest.
+ */
+struct xc_sr_restore_postcopy
+{
+    /* Pfns whose contents have yet to arrive. */
+    unsigned long *outstanding;
+    /* Outstanding pfns already asked for in a POSTCOPY_FAULT record. */
+    unsigned long *requested;
+    xen_pfn_t max_pfn;
+    unsigned long nr_outstanding;
+
+    /* The mem_paging ring, once set up. */
+    xenevtchn_handle *xce;
+    evtchn_port_t port;
+    xen_pfn_t ring_pfn;
+    void *ring_page;
+    vm_event_back_ring_t back_ring;
+    bool notify;
+
+    /* Requests of vcpus waiting on an outstanding pfn. */
+    vm_event_request_t *waiting;
+    unsigned int nr_waiting;
+
+    /* Pfns for the next POSTCOPY_FAULT record. */
+    uint64_t *faults;
+
+    void *zero_page, *bounce;
+
+    /* The domain has been resumed. */
+    bool active;
+};
+
+static bool postcopy_active(const struct xc_sr_context *ctx)
+{
+    return ctx->restore.postcopy && ctx->restore.postcopy->active;
+}
+
+static bool pfn_is_outstanding(const struct xc_sr_restore_postcopy *pc,
+                               xen_pfn_t pfn)
+{
+    return pfn <= pc->max_pfn && test_bit(pfn, pc->outstanding);
+}
+
+/*
+ * Check that a post-copy migration can be received, and set up the state for
+ * one, if not already done.
+ */
+static struct xc_sr_restore_postcopy *get_postcopy(struct xc_sr_context *ctx)
+{
+    xc_interface *xch = ctx->xch;
+    struct xc_sr_restore_postcopy *pc = ctx->restore.postcopy;
+    struct restore_callbacks *callbacks = ctx->restore.callbacks;
+
+    if ( pc )
+        return pc;
+
+    if ( ctx->stream_type != XC_STREAM_PLAIN ||
+         ctx->restore.guest_type != DHDR_TYPE_X86_HVM )
+    {
+        ERROR("Post-copy only supported for a plain stream of an HVM guest");
+        return NULL;
+    }
+
+    if ( !callbacks || !callbacks->postcopy || !callbacks->restore_results ||
+         ctx->restore.send_back_fd < 0 )
+    {
+        ERROR("Post-copy needs postcopy and restore_results callbacks, "
+              "and a back channel");
+        return NULL;
+    }
+
+    pc = calloc(1, sizeof(*pc));
+    if ( !pc )
+    {
+        ERROR("Unable to allocate post-copy state");
+        return NULL;
+    }
+
+    pc->max_pfn = ctx->restore.p2m_size ? ctx->restore.p2m_size - 1 : 0;
+    pc->outstanding = bitmap_alloc(pc->max_pfn + 1);
+    pc->requested = bitmap_alloc(pc->max_pfn + 1);
+    pc->zero_page = calloc(1, PAGE_SIZE);
+    pc->bounce = malloc(PAGE_SIZE);
+    pc->ring_pfn = INVALID_PFN;
+    if ( !pc->outstanding || !pc->requested || !pc->zero_page || !pc->bounce )
+    {
+        ERROR("Unable to allocate post-copy state");
+        free(pc->bounce);
+        free(pc->zero_page);
+        free(pc->requested);
+        free(pc->outstanding);
+        free(pc);
+        return NULL;
+    }
+
+    ctx->restore.postcopy = pc;
+
+    return pc;
+}
+
+/*
+ * Remember the pfns of a POSTCOPY_PFNS record as outstanding.
+ */
+static int handle_postcopy_pfns(struct xc_sr_context *ctx,
+                                struct xc_sr_record *rec)
+{
+    xc_interface *xch = ctx->xch;
+    struct xc_sr_restore_postcopy *pc = get_postcopy(ctx);
+    const uint64_t *pfns = rec->data;
+    unsigned int i, nr = rec->length / sizeof(*pfns);
+    xen_pfn_t max_pfn, pfn;
+
+    if ( !pc )
+        return -1;
+
+    if ( pc->active )
+    {
+        ERROR("POSTCOPY_PFNS record after POSTCOPY_TRANSITION");
+        return -1;
+    }
+
+    if ( rec->length % sizeof(*pfns) )
+    {
+        ERROR("POSTCOPY_PFNS record length %u not a multiple of %zu",
+              rec->length, sizeof(*pfns));
+        return -1;
+    }
+
+    for ( i = 0; i < nr; ++i )
+    {
+        pfn = pfns[i];
+        if ( pfns[i] != pfn || !ctx->restore.ops.pfn_is_valid(ctx, pfn) )
+        {
+            ERROR("pfn %#"PRIx64" (index %u) outside domain maximum",
+                  pfns[i], i);
+            return -1;
+        }
+
+        max_pfn = pc->max_pfn;
+        if ( expand_pfn_bitmap(ctx, &pc->outstanding, &max_pfn, pfn) ||
+             expand_pfn_bitmap(ctx, &pc->requested, &pc->max_pfn, pfn) )
+            return -1;
+
+        if ( !test_and_set_bit(pfn, pc->outstanding) )
+            ++pc->nr_outstanding;
+    }
+
+    ctx->restore.postcopy_stats.pfns += nr;
+
+    return 0;
+}
+
+/*
+ * Set up a mem_paging ring for the domain, over which Xen reports vcpus
+ * touching a paged out pfn.
+ */
+static int start_postcopy_paging(struct xc_sr_context *ctx)
+{
+    xc_interface *xch = ctx->xch;
+    struct xc_sr_restore_postcopy *pc = ctx->restore.postcopy;
+    uint64_t ring_pfn;
+    uint32_t remote_port;
+    int rc;
+
+    pc->ring_page = xc_vm_event_enable(xch, ctx->domid,
+                                       HVM_PARAM_PAGING_RING_PFN,
+                                       &remote_port);
+    if ( !pc->ring_page )
+    {
+        PERROR("Failed to enable paging");
+        return -1;
+    }
+
+    /* The ring itself is taken out of the physmap. */
+    if ( xc_hvm_param_get(xch, ctx->domid, HVM_PARAM_PAGING_RING_PFN,
+                          &ring_pfn) )
+    {
+        PERROR("Failed to get the paging ring pfn");
+        return -1;
+    }
+
+    pc->ring_pfn = ring_pfn;
+    if ( pfn_is_outstanding(pc, pc->ring_pfn) )
+    {
+        clear_bit(pc->ring_pfn, pc->outstanding);
+        --pc->nr_outstanding;
+    }
+
+    pc->xce = xenevtchn_open(NULL, 0);
+    if ( !pc->xce )
+    {
+        PERROR("Failed to open event channel");
+        return -1;
+    }
+
+    rc = xenevtchn_bind_interdomain(pc->xce, ctx->domid, remote_port);
+    if ( rc < 0 )
+    {
+        PERROR("Failed to bind event channel");
+        return -1;
+    }
+
+    pc->port = rc;
+
+    SHARED_RING_INIT((vm_event_sring_t *)pc->ring_page);
+    BACK_RING_INIT(&pc->back_ring, (vm_event_sring_t *)pc->ring_page,
+                   XC_PAGE_SIZE);
+
+    pc->waiting = calloc(RING_SIZE(&pc->back_ring), sizeof(*pc->waiting));
+    pc->faults = malloc(RING_SIZE(&pc->back_ring) * sizeof(*pc->faults));
+    if ( !pc->waiting || !pc->faults )
+    {
+        ERROR("Unable to allocate post-copy request tracking");
+        return -1;
+    }
+
+    return 0;
+}
+
+/*
+ * Give up any memory behind the outstanding pfns, and mark them all as paged
+ * out.
+ */
+static int evict_outstanding(struct xc_sr_context *ctx)
+{
+    xc_interface *xch = ctx->xch;
+    struct xc_sr_restore_postcopy *pc = ctx->restore.postcopy;
+    xen_pfn_t pfn, *pfns = NULL;
+    unsigned int nr = 0;
+    int rc = -1;
+
+    pfns = malloc(MAX_BATCH_SIZE * sizeof(*pfns));
+    if ( !pfns )
+    {
+        ERROR("Unable to allocate memory for %u pfns", MAX_BATCH_SIZE);
+        goto err;
+    }
+
+    for ( pfn = 0; pfn <= pc->max_pfn; ++pfn )
+    {
+        if ( !test_bit(pfn, pc->outstanding) || !pfn_is_populated(ctx, pfn) )
+            continue;
+
+        clear_bit(pfn, ctx->restore.populated_pfns);
+        pfns[nr++] = pfn;
+
+        if ( nr == MAX_BATCH_SIZE )
+        {
+            if ( xc_domain_decrease_reservation_exact(xch, ctx->domid,
+                                                      nr, 0, pfns) )
+            {
+                PERROR("Failed to release %u outstanding pfns", nr);
+                goto err;
+            }
+            nr = 0;
+        }
+    }
+
+    if ( nr && xc_domain_decrease_reservation_exact(xch, ctx->domid,
+                                                    nr, 0, pfns) )
+    {
+        PERROR("Failed to release %u outstanding pfns", nr);
+        goto err;
+    }
+
+    for ( pfn = 0; pfn <= pc->max_pfn; ++pfn )
+    {
+        if ( !test_bit(pfn, pc->outstanding) )
+            continue;
+
+        if ( xc_mem_paging_populate_evicted(xch, ctx->domid, pfn) )
+        {
+            PERROR("Failed to mark pfn %#"PRIpfn" as paged out", pfn);
+            goto err;
+        }
+    }
+
+    rc = 0;
+
+ err:
+    free(pfns);
+    return rc;
+}
+
+/*
+ * Complete the domain, leaving the outstanding pfns paged out, and have it
+ * resumed.
+ */
+static int handle_postcopy_transition(struct xc_sr_context *ctx)
+{
+    xc_interface *xch = ctx->xch;
+    struct xc_sr_restore_postcopy *pc = get_postcopy(ctx);
+    struct restore_callbacks *callbacks = ctx->restore.callbacks;
+    int rc;
+
+    if ( !pc )
+        return -1;
+
+    if ( pc->active )
+    {
+        ERROR("Duplicate POSTCOPY_TRANSITION record");
+        return -1;
+    }
+
+    rc = ctx->restore.ops.stream_complete(ctx);
+    if ( rc )
+        return rc;
+
+    if ( pc->nr_outstanding )
+    {
+        rc = start_postcopy_paging(ctx);
+        if ( rc )
+            return rc;
+
+        rc = evict_outstanding(ctx);
+        if ( rc )
+            return rc;
+    }
+
+    IPRINTF("Post-copy: resuming domain with %lu pfns outstanding",
+            pc->nr_outstanding);
+
+    callbacks->restore_results(ctx->restore.xenstore_gfn,
+                               ctx->restore.console_gfn, callbacks->data);
+
+    rc = callbacks->postcopy(callbacks->data);
+    if ( rc != 1 )
+    {
+        ERROR("Failed to resume domain for post-copy");
+        return -1;
+    }
+
+    pc->active = true;
+
+    return 0;
+}
+
+static void postcopy_respond(struct xc_sr_restore_postcopy *pc,
+                             const vm_event_request_t *req)
+{
+    vm_event_back_ring_t *back_ring = &pc->back_ring;
+    vm_event_response_t rsp = {
+        .version = VM_EVENT_INTERFACE_VERSION,
+        .vcpu_id = req->vcpu_id,
+        .flags = req->flags & VM_EVENT_FLAG_VCPU_PAUSED,
+        .reason = req->reason,
+        .u.mem_paging.gfn = req->u.mem_paging.gfn,
+        .u.mem_paging.flags = req->u.mem_paging.flags,
+    };
+
+    memcpy(RING_GET_RESPONSE(back_ring, back_ring->rsp_prod_pvt),
+           &rsp, sizeof(rsp));
+    back_ring->rsp_prod_pvt++;
+    RING_PUSH_RESPONSES(back_ring);
+
+    pc->notify = true;
+}
+
+/*
+ * Let vcpus waiting on a pfn carry on.
+ */
+static void postcopy_release(struct xc_sr_restore_postcopy *pc, xen_pfn_t pfn)
+{
+    unsigned int i;
+
+    for ( i = 0; i < pc->nr_waiting; )
+    {
+        if ( pc->waiting[i].u.mem_paging.gfn != pfn )
+        {
+            ++i;
+            continue;
+        }
+
+        postcopy_respond(pc, &pc->waiting[i]);
+        pc->waiting[i] = pc->waiting[--pc->nr_waiting];
     }
+}
 
-    /* Nothing to do? */
-    if ( nr_pages == 0 )
-        goto done;
+static int postcopy_notify(struct xc_sr_context *ctx)
+{
+    xc_interface *xch = ctx->xch;
+    struct xc_sr_restore_postcopy *pc = ctx->restore.postcopy;
 
-    mapping = guest_page = xenforeignmemory_map(
-        xch->fmem, ctx->domid, PROT_READ | PROT_WRITE,
-        nr_pages, mfns, map_errs);
-    if ( !mapping )
+    if ( !pc->notify )
+        return 0;
+
+    pc->notify = false;
+
+    if ( xenevtchn_notify(pc->xce, pc->port) )
     {
-        rc = -1;
-        PERROR("Unable to map %u mfns for %u pages of data",
-               nr_pages, count);
-        goto err;
+        PERROR("Failed to notify paging event channel");
+        return -1;
     }
 
-    for ( i = 0, j = 0; i < count; ++i )
+    return 0;
+}
+
+/*
+ * Load the pages of a page data record into the outstanding pfns, in place
+ * of the pipeline.  Pages for pfns no longer outstanding, having been
+ * ballooned out meanwhile, are discarded.
+ */
+static int postcopy_load_pages(struct xc_sr_context *ctx,
+                               const struct xc_sr_restore_job *job)
+{
+    xc_interface *xch = ctx->xch;
+    struct xc_sr_restore_postcopy *pc = ctx->restore.postcopy;
+    const void *page_data = job->page_data;
+    const void *data;
+    unsigned int i, j;
+    xen_pfn_t pfn;
+    int rc;
+
+    if ( get_compressor(ctx, job, &ctx->restore.compressor,
+                        &ctx->restore.compressor_alg) )
+        return -1;
+
+    for ( i = 0, j = 0; i < job->count; ++i )
     {
-        if ( !page_type_has_stream_data(types[i]) )
-            continue;
+        pfn = job->pfns[i];
 
-        if ( map_errs[j] )
+        if ( job->zero || job->types[i] == XEN_DOMCTL_PFINFO_XALLOC )
+            data = pc->zero_page;
+        else if ( !page_type_has_stream_data(job->types[i]) )
+            data = NULL;
+        else if ( !job->lengths || job->lengths[j] == PAGE_SIZE )
         {
-            rc = -1;
-            ERROR("Mapping pfn %#"PRIpfn" (mfn %#"PRIpfn", type %#"PRIx32") failed with %d",
-                  pfns[i], mfns[j], types[i], map_errs[j]);
-            goto err;
+            data = page_data;
+            page_data += PAGE_SIZE;
+            ++j;
         }
-
-        /* Undo page normalisation done by the saver. */
-        rc = ctx->restore.ops.localise_page(ctx, types[i], page_data);
-        if ( rc )
+        else
         {
-            ERROR("Failed to localise pfn %#"PRIpfn" (type %#"PRIx32")",
-                  pfns[i], types[i] >> XEN_DOMCTL_PFINFO_LTAB_SHIFT);
-            goto err;
-        }
+            if ( decompress_page(ctx->restore.compressor, page_data,
+                                 job->lengths[j], pc->bounce) )
+            {
+                ERROR("Failed to decompress pfn %#"PRIpfn" (%u bytes of %s)",
+                      pfn, job->lengths[j],
+                      compress_alg_to_str(job->algorithm));
+                return -1;
+            }
 
-        if ( ctx->restore.verify )
-        {
-            /* Verify mode - compare incoming data to what we already have. */
-            if ( memcmp(guest_page, page_data, PAGE_SIZE) )
-                ERROR("verify pfn %#"PRIpfn" failed (type %#"PRIx32")",
-                      pfns[i], types[i] >> XEN_DOMCTL_PFINFO_LTAB_SHIFT);
+            data = pc->bounce;
+            page_data += job->lengths[j];
+            ++j;
         }
+
+        if ( !pfn_is_outstanding(pc, pfn) )
+            continue;
+
+        if ( data )
+            rc = xc_mem_paging_load(xch, ctx->domid, pfn, (void *)data);
         else
+            rc = xc_domain_decrease_reservation_exact(xch, ctx->domid,
+                                                      1, 0, &pfn);
+        if ( rc )
         {
-            /* Regular mode - copy incoming data into place. */
-            memcpy(guest_page, page_data, PAGE_SIZE);
+            PERROR("Failed to load outstanding pfn %#"PRIpfn, pfn);
+            return -1;
         }
 
-        ++j;
-        guest_page += PAGE_SIZE;
-        page_data += PAGE_SIZE;
-    }
+        clear_bit(pfn, pc->outstanding);
+        --pc->nr_outstanding;
 
- done:
-    rc = 0;
+        if ( data && pfn_set_populated(ctx, pfn) )
+            return -1;
 
- err:
-    if ( mapping )
-        xenforeignmemory_unmap(xch->fmem, mapping, nr_pages);
+        if ( test_bit(pfn, pc->requested) )
+            ++ctx->restore.postcopy_stats.fault_pages;
 
-    free(map_errs);
-    free(mfns);
+        postcopy_release(pc, pfn);
+    }
 
-    return rc;
+    return postcopy_notify(ctx);
 }
 
 /*
- * Validate a PAGE_DATA record from the stream, and pass the results to
- * process_page_data() to actually perform the legwork.
+ * Take the requests off the mem_paging ring.  Vcpus touching outstanding
+ * pfns wait for the data, and any pfns not yet asked for are reported to
+ * the sender.
  */
-static int handle_page_data(struct xc_sr_context *ctx, struct xc_sr_record *rec)
+static int consume_postcopy_requests(struct xc_sr_context *ctx)
 {
     xc_interface *xch = ctx->xch;
-    struct xc_sr_rec_page_data_header *pages = rec->data;
-    unsigned int i, pages_of_data = 0;
-    int rc = -1;
-
-    xen_pfn_t *pfns = NULL, pfn;
-    uint32_t *types = NULL, type;
+    struct xc_sr_restore_postcopy *pc = ctx->restore.postcopy;
+    vm_event_back_ring_t *back_ring = &pc->back_ring;
+    vm_event_request_t req;
+    struct xc_sr_rhdr rhdr = { .type = REC_TYPE_POSTCOPY_FAULT };
+    struct iovec iov[2] = {
+        { &rhdr, sizeof(rhdr) },
+        { pc->faults, 0 },
+    };
+    unsigned int nr_faults = 0;
+    xen_pfn_t pfn;
 
-    /*
-     * v2 compatibility only exists for x86 streams.  This is a bit of a
-     * bodge, but it is less bad than duplicating handle_page_data() between
-     * different architectures.
-     */
-#if defined(__i386__) || defined(__x86_64__)
-    /* v2 compat.  Infer the position of STATIC_DATA_END. */
-    if ( ctx->restore.format_version < 3 && !ctx->restore.seen_static_data_end )
+    while ( RING_HAS_UNCONSUMED_REQUESTS(back_ring) )
     {
-        rc = handle_static_data_end(ctx);
-        if ( rc )
+        memcpy(&req, RING_GET_REQUEST(back_ring, back_ring->req_cons),
+               sizeof(req));
+        back_ring->req_cons++;
+        back_ring->sring->req_event = back_ring->req_cons + 1;
+
+        if ( req.version != VM_EVENT_INTERFACE_VERSION )
         {
-            ERROR("Inferred STATIC_DATA_END record failed");
-            goto err;
+            ERROR("Paging request version %#x, expected %#x",
+                  req.version, VM_EVENT_INTERFACE_VERSION);
+            return -1;
         }
-        rc = -1;
-    }
 
-    if ( !ctx->restore.seen_static_data_end )
-    {
-        ERROR("No STATIC_DATA_END seen");
-        goto err;
-    }
-#endif
+        pfn = req.u.mem_paging.gfn;
 
-    if ( rec->length < sizeof(*pages) )
-    {
-        ERROR("PAGE_DATA record truncated: length %u, min %zu",
-              rec->length, sizeof(*pages));
-        goto err;
+        if ( !pfn_is_outstanding(pc, pfn) )
+        {
+            /* Already loaded since the fault was raised. */
+            postcopy_respond(pc, &req);
+            continue;
+        }
+
+        if ( req.u.mem_paging.flags & MEM_PAGING_DROP_PAGE )
+        {
+            /* Ballooned out by the guest before it arrived. */
+            clear_bit(pfn, pc->outstanding);
+            --pc->nr_outstanding;
+            postcopy_release(pc, pfn);
+            postcopy_respond(pc, &req);
+            continue;
+        }
+
+        pc->waiting[pc->nr_waiting++] = req;
+
+        if ( !test_and_set_bit(pfn, pc->requested) )
+            pc->faults[nr_faults++] = pfn;
     }
 
-    if ( pages->count < 1 )
+    if ( nr_faults )
     {
-        ERROR("Expected at least 1 pfn in PAGE_DATA record");
-        goto err;
+        rhdr.length = nr_faults * sizeof(*pc->faults);
+        iov[1].iov_len = rhdr.length;
+
+        if ( writev_exact(ctx->restore.send_back_fd, iov, ARRAY_SIZE(iov)) )
+        {
+            PERROR("Failed to report post-copy faults");
+            return -1;
+        }
+
+        ctx->restore.postcopy_stats.faults += nr_faults;
     }
 
-    if ( rec->length < sizeof(*pages) + (pages->count * sizeof(uint64_t)) )
+    return postcopy_notify(ctx);
+}
+
+static int handle_postcopy_event(struct xc_sr_context *ctx)
+{
+    xc_interface *xch = ctx->xch;
+    struct xc_sr_restore_postcopy *pc = ctx->restore.postcopy;
+    int port;
+
+    port = xenevtchn_pending(pc->xce);
+    if ( port < 0 )
     {
-        ERROR("PAGE_DATA record (length %u) too short to contain %u"
-              " pfns worth of information", rec->length, pages->count);
-        goto err;
+        PERROR("Failed to read paging event channel");
+        return -1;
     }
 
-    pfns = malloc(pages->count * sizeof(*pfns));
-    types = malloc(pages->count * sizeof(*types));
-    if ( !pfns || !types )
+    if ( xenevtchn_unmask(pc->xce, port) )
     {
-        ERROR("Unable to allocate enough memory for %u pfns",
-              pages->count);
-        goto err;
+        PERROR("Failed to unmask paging event channel");
+        return -1;
     }
 
-    for ( i = 0; i < pages->count; ++i )
+    return consume_postcopy_requests(ctx);
+}
+
+/*
+ * Receive the rest of the domain's memory while it runs, until the END
+ * record, and confirm it to the sender.
+ */
+static int restore_memory_postcopy(struct xc_sr_context *ctx)
+{
+    xc_interface *xch = ctx->xch;
+    struct xc_sr_restore_postcopy *pc = ctx->restore.postcopy;
+    struct xc_sr_rhdr end = { .type = REC_TYPE_END };
+    struct xc_sr_record rec;
+    struct pollfd pfds[2] = {
+        { .fd = ctx->fd, .events = POLLIN },
+        { .fd = pc->xce ? xenevtchn_fd(pc->xce) : -1, .events = POLLIN },
+    };
+    int rc;
+
+    xc_set_progress_prefix(xch, "Post-copy");
+
+    for ( ; ; )
     {
-        pfn = pages->pfn[i] & PAGE_DATA_PFN_MASK;
-        if ( !ctx->restore.ops.pfn_is_valid(ctx, pfn) )
+        if ( poll(pfds, ARRAY_SIZE(pfds), -1) < 0 )
         {
-            ERROR("pfn %#"PRIpfn" (index %u) outside domain maximum", pfn, i);
-            goto err;
+            if ( errno == EINTR )
+                continue;
+
+            PERROR("Failed to poll during post-copy");
+            return -1;
         }
 
-        type = (pages->pfn[i] & PAGE_DATA_TYPE_MASK) >> 32;
-        if ( !is_known_page_type(type) )
+        if ( pfds[1].revents )
         {
-            ERROR("Unknown type %#"PRIx32" for pfn %#"PRIpfn" (index %u)",
-                  type, pfn, i);
-            goto err;
+            rc = handle_postcopy_event(ctx);
+            if ( rc )
+                return rc;
         }
 
-        if ( page_type_has_stream_data(type) )
-            /* NOTAB and all L1 through L4 tables (including pinned) should
-             * have a page worth of data in the record. */
-            pages_of_data++;
+        if ( !pfds[0].revents )
+            continue;
 
-        pfns[i] = pfn;
-        types[i] = type;
+        rc = read_record(ctx, ctx->fd, &rec);
+        if ( rc )
+            return rc;
+
+        switch ( rec.type )
+        {
+        case REC_TYPE_PAGE_DATA:
+        case REC_TYPE_COMPRESSED_PAGE_DATA:
+        case REC_TYPE_ELIDED_PAGE_DATA:
+        case REC_TYPE_STRIPED_DATA:
+            rc = process_record(ctx, &rec);
+            if ( rc )
+                return rc;
+            break;
+
+        case REC_TYPE_END:
+            free(rec.data);
+
+            if ( pc->nr_outstanding )
+            {
+                ERROR("End of stream with %lu pfns outstanding",
+                      pc->nr_outstanding);
+                return -1;
+            }
+
+            /* Let go of vcpus which faulted as their pages arrived. */
+            if ( pc->xce )
+            {
+                rc = consume_postcopy_requests(ctx);
+                if ( rc )
+                    return rc;
+            }
+
+            if ( write_exact(ctx->restore.send_back_fd, &end, sizeof(end)) )
+            {
+                PERROR("Failed to confirm end of post-copy");
+                return -1;
+            }
+
+            xc_set_progress_prefix(xch, NULL);
+            return 0;
+
+        default:
+            ERROR("Unexpected %s record during post-copy",
+                  rec_type_to_str(rec.type));
+            free(rec.data);
+            return -1;
+        }
     }
+}
 
-    if ( rec->length != (sizeof(*pages) +
-                         (sizeof(uint64_t) * pages->count) +
-                         (PAGE_SIZE * pages_of_data)) )
+static void teardown_postcopy(struct xc_sr_context *ctx)
+{
+    xc_interface *xch = ctx->xch;
+    struct xc_sr_restore_postcopy *pc = ctx->restore.postcopy;
+
+    if ( !pc )
+        return;
+
+    if ( pc->ring_page )
     {
-        ERROR("PAGE_DATA record wrong size: length %u, expected "
-              "%zu + %zu + %lu", rec->length, sizeof(*pages),
-              (sizeof(uint64_t) * pages->count), (PAGE_SIZE * pages_of_data));
-        goto err;
+        xenforeignmemory_unmap(xch->fmem, pc->ring_page, 1);
+        xc_mem_paging_disable(xch, ctx->domid);
     }
 
-    rc = process_page_data(ctx, pages->count, pfns, types,
-                           &pages->pfn[pages->count]);
- err:
-    free(types);
-    free(pfns);
+    if ( pc->xce )
+    {
+        if ( pc->port )
+            xenevtchn_unbind(pc->xce, pc->port);
+        xenevtchn_close(pc->xce);
+    }
 
-    return rc;
+    free(pc->bounce);
+    free(pc->zero_page);
+    free(pc->faults);
+    free(pc->waiting);
+    free(pc->requested);
+    free(pc->outstanding);
+    free(pc);
+    ctx->restore.postcopy = NULL;
 }
 
 /*
@@ -490,7 +2314,6 @@ static int send_checkpoint_dirty_pfn_list(struct xc_sr_context *ctx)
     return rc;
 }
 
-static int process_record(struct xc_sr_context *ctx, struct xc_sr_record *rec);
 static int handle_checkpoint(struct xc_sr_context *ctx)
 {
     xc_interface *xch = ctx->xch;
@@ -534,6 +2357,10 @@ static int handle_checkpoint(struct xc_sr_context *ctx)
                 goto err;
         }
         ctx->restore.buffered_rec_num = 0;
+
+        rc = drain_pipeline(ctx);
+        if ( rc )
+            goto err;
         IPRINTF("All records processed");
     }
     else
@@ -648,6 +2475,22 @@ static int process_record(struct xc_sr_context *ctx, struct xc_sr_record *rec)
     xc_interface *xch = ctx->xch;
     int rc = 0;
 
+    switch ( rec->type )
+    {
+    case REC_TYPE_PAGE_DATA:
+    case REC_TYPE_COMPRESSED_PAGE_DATA:
+    case REC_TYPE_ELIDED_PAGE_DATA:
+    case REC_TYPE_STRIPED_DATA:
+        break;
+
+    default:
+        /* Everything else may depend on the page data already received. */
+        rc = drain_pipeline(ctx);
+        if ( rc )
+            goto out;
+        break;
+    }
+
     switch ( rec->type )
     {
     case REC_TYPE_END:
@@ -657,6 +2500,18 @@ static int process_record(struct xc_sr_context *ctx, struct xc_sr_record *rec)
         rc = handle_page_data(ctx, rec);
         break;
 
+    case REC_TYPE_COMPRESSED_PAGE_DATA:
+        rc = handle_compressed_page_data(ctx, rec);
+        break;
+
+    case REC_TYPE_ELIDED_PAGE_DATA:
+        rc = handle_elided_page_data(ctx, rec);
+        break;
+
+    case REC_TYPE_STRIPED_DATA:
+        rc = handle_striped_data(ctx, rec);
+        break;
+
     case REC_TYPE_VERIFY:
         DPRINTF("Verify mode enabled");
         ctx->restore.verify = true;
@@ -670,11 +2525,20 @@ static int process_record(struct xc_sr_context *ctx, struct xc_sr_record *rec)
         rc = handle_static_data_end(ctx);
         break;
 
+    case REC_TYPE_POSTCOPY_PFNS:
+        rc = handle_postcopy_pfns(ctx, rec);
+        break;
+
+    case REC_TYPE_POSTCOPY_TRANSITION:
+        rc = handle_postcopy_transition(ctx);
+        break;
+
     default:
         rc = ctx->restore.ops.process_record(ctx, rec);
         break;
     }
 
+ out:
     free(rec->data);
     rec->data = NULL;
 
@@ -715,6 +2579,22 @@ static int setup(struct xc_sr_context *ctx)
         goto err;
     }
 
+    if ( ctx->restore.nr_stripe_fds )
+    {
+        ctx->restore.stripes = setup_stripes(ctx, ctx->restore.stripe_fds,
+                                             ctx->restore.nr_stripe_fds,
+                                             false);
+        if ( !ctx->restore.stripes )
+        {
+            rc = -1;
+            goto err;
+        }
+    }
+
+    rc = setup_pipeline(ctx);
+    if ( rc )
+        goto err;
+
     ctx->restore.buffered_records = malloc(
         DEFAULT_BUF_RECORDS * sizeof(struct xc_sr_record));
     if ( !ctx->restore.buffered_records )
@@ -743,8 +2623,13 @@ static void cleanup(struct xc_sr_context *ctx)
         xc_hypercall_buffer_free_pages(
             xch, dirty_bitmap, NRPAGES(bitmap_size(ctx->restore.p2m_size)));
 
+    teardown_postcopy(ctx);
+    teardown_pipeline(ctx);
+    teardown_stripes(ctx->restore.stripes);
+
     free(ctx->restore.buffered_records);
     free(ctx->restore.populated_pfns);
+    free_compressor(ctx->restore.compressor);
 
     if ( ctx->restore.ops.cleanup(ctx) )
         PERROR("Failed to clean up");
@@ -806,7 +2691,18 @@ static int restore(struct xc_sr_context *ctx)
                 goto err;
         }
 
-    } while ( rec.type != REC_TYPE_END );
+    } while ( rec.type != REC_TYPE_END &&
+              rec.type != REC_TYPE_POSTCOPY_TRANSITION );
+
+    if ( rec.type == REC_TYPE_POSTCOPY_TRANSITION )
+    {
+        /* The domain was completed and resumed at the transition. */
+        rc = restore_memory_postcopy(ctx);
+        if ( rc )
+            goto err;
+
+        goto complete;
+    }
 
  remus_failover:
     if ( ctx->stream_type == XC_STREAM_COLO )
@@ -821,11 +2717,41 @@ static int restore(struct xc_sr_context *ctx)
      * With Remus, if we reach here, there must be some error on primary,
      * failover from the last checkpoint state.
      */
+    rc = drain_pipeline(ctx);
+    if ( rc )
+        goto err;
+
     rc = ctx->restore.ops.stream_complete(ctx);
     if ( rc )
         goto err;
 
+ complete:
     IPRINTF("Restore successful");
+    if ( ctx->restore.compress_stats.pages )
+        DPRINTF("Expanded %"PRIu64" pages of page data from %"PRIu64" bytes"
+                " (%"PRIu64" pages sent uncompressed)",
+                ctx->restore.compress_stats.pages,
+                ctx->restore.compress_stats.bytes,
+                ctx->restore.compress_stats.raw_pages);
+    if ( ctx->restore.nr_superpages )
+        DPRINTF("Populated %"PRIu64" superpages",
+                ctx->restore.nr_superpages);
+    if ( ctx->restore.elide_stats.zero_pages ||
+         ctx->restore.elide_stats.unchanged_pages )
+        DPRINTF("Elided from the stream: %"PRIu64" zero pages, %"PRIu64
+                " unchanged pages",
+                ctx->restore.elide_stats.zero_pages,
+                ctx->restore.elide_stats.unchanged_pages);
+    if ( ctx->restore.postcopy_stats.pfns )
+        DPRINTF("Post-copy: %"PRIu64" pfns received after resuming, %"PRIu64
+                " of them on demand for %"PRIu64" faults",
+                ctx->restore.postcopy_stats.pfns,
+                ctx->restore.postcopy_stats.fault_pages,
+                ctx->restore.postcopy_stats.faults);
+    if ( ctx->restore.stripe_seq )
+        DPRINTF("Page data striped over %u further streams in %"PRIu64
+                " chunks", ctx->restore.nr_stripe_fds,
+                ctx->restore.stripe_seq);
     goto done;
 
  err:
@@ -868,6 +2794,19 @@ int xc_domain_restore(xc_interface *xch, int io_fd, uint32_t dom,
     ctx.restore.callbacks = callbacks;
     ctx.restore.send_back_fd = send_back_fd;
 
+    if ( callbacks->nr_stripe_fds )
+    {
+        if ( stream_type != XC_STREAM_PLAIN )
+        {
+            ERROR("Page data can't be striped over a checkpointed stream");
+            errno = EINVAL;
+            return -1;
+        }
+
+        ctx.restore.stripe_fds = callbacks->stripe_fds;
+        ctx.restore.nr_stripe_fds = callbacks->nr_stripe_fds;
+    }
+
     /* Sanity check stream_type-related parameters */
     switch ( stream_type )
     {
@@ -911,6 +2850,7 @@ int xc_domain_restore(xc_interface *xch, int io_fd, uint32_t dom,
 
     ctx.restore.p2m_size = nr_pfns;
     ctx.restore.ops = hvm ? restore_ops_x86_hvm : restore_ops_x86_pv;
+    ctx.restore.superpages = hvm;
 
     if ( restore(&ctx) )
         return -1;
@@ -1,4 +1,8 @@
 #include <assert.h>
+#include <poll.h>
+#include <pthread.h>
+#include <time.h>
+#include <unistd.h>
 #include <arpa/inet.h>
 
 #include "xg_sr_common.h"
@@ -75,66 +79,488 @@ static int write_checkpoint_record(struct xc_sr_context *ctx)
 }
 
 /*
- * Writes a batch of memory as a PAGE_DATA record into the stream.  The batch
- * is constructed in ctx->save.batch_pfns.
+ * The page-send pipeline.
  *
- * This function:
- * - gets the types for each pfn in the batch.
- * - for each pfn with real data:
- *   - maps and attempts to localise the pages.
- * - construct and writes a PAGE_DATA record into the stream.
+ * Guest memory is sent in batches of up to MAX_BATCH_SIZE pfns.  The main
+ * thread walks the dirty bitmap and fills batches.  A pool of worker threads
+ * maps the guest frames and normalises their contents, and a single writer
+ * thread puts the resulting page data records into the stream, strictly in
+ * the order in which the batches were filled.  The stream is therefore
+ * identical to the one a single threaded sender would produce.
+ *
+ * Batches live in a ring of nr_batches slots, indexed by sequence number.
+ * Three sequence counters track their progress:
+ *
+ *   write_seq <= prep_seq <= fill_seq <= write_seq + nr_batches
+ *
+ * - fill_seq:  the next batch to be submitted by the main thread.
+ * - prep_seq:  the next submitted batch to be picked up by a worker.
+ * - write_seq: the next batch to be written into the stream.
+ *
+ * The pipeline is drained before any other record is written, so non page
+ * records keep their position in the stream relative to the page data.
+ *
+ * If the xc_interface was opened non-reentrant, or only a single CPU is
+ * available, no threads are created and each batch is prepared and written
+ * synchronously by the main thread.
  */
-static int write_batch(struct xc_sr_context *ctx)
+#define SAVE_PIPELINE_MAX_WORKERS 4
+
+enum xc_sr_batch_state
 {
-    xc_interface *xch = ctx->xch;
-    xen_pfn_t *mfns = NULL, *types = NULL;
-    void *guest_mapping = NULL;
-    void **guest_data = NULL;
-    void **local_pages = NULL;
-    int *errors = NULL, rc = -1;
-    unsigned int i, p, nr_pages = 0, nr_pages_mapped = 0;
-    unsigned int nr_pfns = ctx->save.nr_batch_pfns;
-    void *page, *orig_page;
-    uint64_t *rec_pfns = NULL;
-    struct iovec *iov = NULL; int iovcnt = 0;
-    struct xc_sr_rec_page_data_header hdr = { 0 };
-    struct xc_sr_record rec = {
-        .type = REC_TYPE_PAGE_DATA,
-    };
+    BATCH_FREE,
+    BATCH_FILLING,
+    BATCH_QUEUED,
+    BATCH_PREPARING,
+    BATCH_PREPARED,
+    BATCH_WRITING,
+};
 
-    assert(nr_pfns != 0);
+struct xc_sr_save_batch
+{
+    enum xc_sr_batch_state state;
+
+    /* The pfns making up this batch. */
+    xen_pfn_t *pfns;
+    unsigned int nr_pfns;
 
-    /* Mfns of the batch pfns. */
-    mfns = malloc(nr_pfns * sizeof(*mfns));
-    /* Types of the batch pfns. */
-    types = malloc(nr_pfns * sizeof(*types));
-    /* Errors from attempting to map the gfns. */
-    errors = malloc(nr_pfns * sizeof(*errors));
+    /* Pages of data in the record, and frames mapped at guest_mapping. */
+    unsigned int nr_pages, nr_pages_mapped;
+    void *guest_mapping;
+
+    /* Scratch space, each array sized for MAX_BATCH_SIZE entries. */
+    xen_pfn_t *mfns, *types;
+    int *errors;
     /* Pointers to page data to send.  Mapped gfns or local allocations. */
-    guest_data = calloc(nr_pfns, sizeof(*guest_data));
+    void **guest_data;
     /* Pointers to locally allocated pages.  Need freeing. */
-    local_pages = calloc(nr_pfns, sizeof(*local_pages));
+    void **local_pages;
+    uint64_t *rec_pfns;
     /* iovec[] for writev(). */
-    iov = malloc((nr_pfns + 4) * sizeof(*iov));
+    struct iovec *iov;
+    int iovcnt;
+
+    /* Entries of rec_pfns[], for the PAGE_DATA record. */
+    unsigned int nr_rec_pfns;
+
+    struct xc_sr_rhdr rhdr;
+    struct xc_sr_rec_page_data_header hdr;
 
-    if ( !mfns || !types || !errors || !guest_data || !local_pages || !iov )
+    /* Pfns left out of the PAGE_DATA record, with the reason why. */
+    struct xc_sr_save_elided
     {
-        ERROR("Unable to allocate arrays for a batch of %u pages",
-              nr_pfns);
-        goto err;
+        struct xc_sr_rhdr rhdr;
+        struct xc_sr_rec_elided_page_data_header hdr;
+        uint64_t *pfns;
+    } zero, unchanged;
+
+    /* Only when sending COMPRESSED_PAGE_DATA records. */
+    struct xc_sr_compressor *compressor;
+    struct xc_sr_rec_compressed_page_data_header chdr;
+    /* Compressed length of each page of data, or PAGE_SIZE if sent raw. */
+    uint32_t *lengths;
+    /* Compressed pages, back to back. */
+    uint8_t *cdata;
+    /* For ctx->save.compress_stats, once written. */
+    bool compressed;
+    unsigned int nr_raw_pages;
+    size_t data_len;
+};
+
+/*
+ * Batches which don't save at least 1/COMPRESS_MIN_SAVING of their size when
+ * compressed are sent as plain PAGE_DATA, sparing the restorer the work.
+ */
+#define COMPRESS_MIN_SAVING 16
+
+struct xc_sr_save_pipeline
+{
+    pthread_mutex_t lock;
+    pthread_cond_t cond;
+
+    struct xc_sr_save_batch *batches;
+    unsigned int nr_batches;
+
+    unsigned long fill_seq, prep_seq, write_seq;
+
+    /* Batch currently being filled by the main thread, if any. */
+    struct xc_sr_save_batch *filling;
+
+    bool threaded;
+    bool stop;
+    unsigned int nr_workers;
+    pthread_t writer;
+    pthread_t workers[SAVE_PIPELINE_MAX_WORKERS];
+
+    /* First failure of any pipeline stage, and the errno to go with it. */
+    int rc, err;
+};
+
+static int alloc_batch(struct xc_sr_context *ctx, struct xc_sr_save_batch *b)
+{
+    b->pfns = malloc(MAX_BATCH_SIZE * sizeof(*b->pfns));
+    b->mfns = malloc(MAX_BATCH_SIZE * sizeof(*b->mfns));
+    b->types = malloc(MAX_BATCH_SIZE * sizeof(*b->types));
+    b->errors = malloc(MAX_BATCH_SIZE * sizeof(*b->errors));
+    b->guest_data = calloc(MAX_BATCH_SIZE, sizeof(*b->guest_data));
+    b->local_pages = calloc(MAX_BATCH_SIZE, sizeof(*b->local_pages));
+    b->rec_pfns = malloc(MAX_BATCH_SIZE * sizeof(*b->rec_pfns));
+    b->zero.pfns = malloc(MAX_BATCH_SIZE * sizeof(*b->zero.pfns));
+    b->unchanged.pfns = malloc(MAX_BATCH_SIZE * sizeof(*b->unchanged.pfns));
+    /*
+     * Headers, pfns, lengths, a part per page, and padding, then the
+     * headers and pfns of two ELIDED_PAGE_DATA records.
+     */
+    b->iov = malloc((MAX_BATCH_SIZE + 5 + 6) * sizeof(*b->iov));
+
+    if ( !b->pfns || !b->mfns || !b->types || !b->errors || !b->guest_data ||
+         !b->local_pages || !b->rec_pfns || !b->zero.pfns ||
+         !b->unchanged.pfns || !b->iov )
+        return -1;
+
+    b->zero.hdr.reason = ELIDED_PAGE_DATA_ZERO;
+    b->unchanged.hdr.reason = ELIDED_PAGE_DATA_UNCHANGED;
+
+    if ( ctx->save.compression )
+    {
+        b->compressor = alloc_compressor(ctx->xch, ctx->save.compression);
+        b->lengths = malloc(MAX_BATCH_SIZE * sizeof(*b->lengths));
+        b->cdata = malloc(MAX_BATCH_SIZE * (PAGE_SIZE - 1));
+
+        if ( !b->compressor || !b->lengths || !b->cdata )
+            return -1;
     }
 
+    return 0;
+}
+
+static void free_batch(struct xc_sr_save_batch *b)
+{
+    free(b->cdata);
+    free(b->lengths);
+    free_compressor(b->compressor);
+    free(b->iov);
+    free(b->unchanged.pfns);
+    free(b->zero.pfns);
+    free(b->rec_pfns);
+    free(b->local_pages);
+    free(b->guest_data);
+    free(b->errors);
+    free(b->types);
+    free(b->mfns);
+    free(b->pfns);
+}
+
+/*
+ * Mark a pfn as needing to be resent once the guest is paused.  May be
+ * called concurrently from several pipeline workers.
+ */
+static void defer_page(struct xc_sr_context *ctx, xen_pfn_t pfn)
+{
+    struct xc_sr_save_pipeline *pl = ctx->save.pipeline;
+
+    if ( pl->threaded )
+        pthread_mutex_lock(&pl->lock);
+
+    set_bit(pfn, ctx->save.deferred_pages);
+    ++ctx->save.nr_deferred_pages;
+
+    if ( pl->threaded )
+        pthread_mutex_unlock(&pl->lock);
+}
+
+/*
+ * Construct the iovec[] for a PAGE_DATA record from a prepared batch.
+ */
+static void build_page_data(struct xc_sr_save_batch *b)
+{
+    unsigned int i, nr_pages = b->nr_pages;
+
+    b->compressed = false;
+    b->data_len = nr_pages * PAGE_SIZE;
+
+    b->hdr.count = b->nr_rec_pfns;
+
+    b->rhdr.type = REC_TYPE_PAGE_DATA;
+    b->rhdr.length = sizeof(b->hdr);
+    b->rhdr.length += b->nr_rec_pfns * sizeof(*b->rec_pfns);
+    b->rhdr.length += b->data_len;
+
+    b->iov[0].iov_base = &b->rhdr;
+    b->iov[0].iov_len = sizeof(b->rhdr);
+
+    b->iov[1].iov_base = &b->hdr;
+    b->iov[1].iov_len = sizeof(b->hdr);
+
+    b->iov[2].iov_base = b->rec_pfns;
+    b->iov[2].iov_len = b->nr_rec_pfns * sizeof(*b->rec_pfns);
+
+    b->iovcnt = 3;
+
+    if ( nr_pages )
+    {
+        for ( i = 0; i < b->nr_pfns; ++i )
+        {
+            if ( b->guest_data[i] )
+            {
+                b->iov[b->iovcnt].iov_base = b->guest_data[i];
+                b->iov[b->iovcnt].iov_len = PAGE_SIZE;
+                b->iovcnt++;
+                --nr_pages;
+            }
+        }
+    }
+
+    /* Sanity check we have queued all the pages we expected to. */
+    assert(nr_pages == 0);
+}
+
+/*
+ * Compress the pages of a prepared batch, and construct the iovec[] for a
+ * COMPRESSED_PAGE_DATA record.  Returns false, having built nothing, if
+ * compression doesn't pay for this batch.
+ */
+static bool build_compressed_page_data(struct xc_sr_context *ctx,
+                                       struct xc_sr_save_batch *b)
+{
+    static const uint8_t zeroes[(1U << REC_ALIGN_ORDER) - 1];
+    unsigned int i, p, len;
+    size_t data_len = 0, rec_len;
+    uint8_t *out = b->cdata;
+    struct iovec *iov;
+
+    if ( b->nr_pages == 0 )
+        return false;
+
+    b->nr_raw_pages = 0;
+
+    for ( i = 0, p = 0; i < b->nr_pfns; ++i )
+    {
+        if ( !b->guest_data[i] )
+            continue;
+
+        len = compress_page(b->compressor, b->guest_data[i], out);
+        if ( len == 0 )
+        {
+            len = PAGE_SIZE;
+            b->nr_raw_pages++;
+        }
+        else
+            out += len;
+
+        b->lengths[p++] = len;
+        data_len += len;
+    }
+
+    assert(p == b->nr_pages);
+
+    if ( data_len + p * sizeof(*b->lengths) >
+         (p * PAGE_SIZE) - (p * PAGE_SIZE) / COMPRESS_MIN_SAVING )
+        return false;
+
+    b->compressed = true;
+    b->data_len = data_len + p * sizeof(*b->lengths);
+
+    b->chdr.count = b->nr_rec_pfns;
+    b->chdr.algorithm = ctx->save.compression;
+
+    rec_len = sizeof(b->chdr) + b->nr_rec_pfns * sizeof(*b->rec_pfns) +
+        b->data_len;
+
+    b->rhdr.type = REC_TYPE_COMPRESSED_PAGE_DATA;
+    b->rhdr.length = rec_len;
+
+    b->iov[0].iov_base = &b->rhdr;
+    b->iov[0].iov_len = sizeof(b->rhdr);
+
+    b->iov[1].iov_base = &b->chdr;
+    b->iov[1].iov_len = sizeof(b->chdr);
+
+    b->iov[2].iov_base = b->rec_pfns;
+    b->iov[2].iov_len = b->nr_rec_pfns * sizeof(*b->rec_pfns);
+
+    b->iov[3].iov_base = b->lengths;
+    b->iov[3].iov_len = p * sizeof(*b->lengths);
+
+    b->iovcnt = 4;
+
+    /*
+     * Runs of compressed pages are contiguous in cdata, and go out as a
+     * single part.  Raw pages are sent straight from the guest mapping.
+     */
+    iov = NULL;
+    out = b->cdata;
+    for ( i = 0, p = 0; i < b->nr_pfns; ++i )
+    {
+        if ( !b->guest_data[i] )
+            continue;
+
+        len = b->lengths[p++];
+
+        if ( len == PAGE_SIZE )
+        {
+            iov = NULL;
+            b->iov[b->iovcnt].iov_base = b->guest_data[i];
+            b->iov[b->iovcnt].iov_len = PAGE_SIZE;
+            b->iovcnt++;
+            continue;
+        }
+
+        if ( !iov )
+        {
+            iov = &b->iov[b->iovcnt++];
+            iov->iov_base = out;
+            iov->iov_len = 0;
+        }
+
+        iov->iov_len += len;
+        out += len;
+    }
+
+    if ( rec_len != ROUNDUP(rec_len, REC_ALIGN_ORDER) )
+    {
+        b->iov[b->iovcnt].iov_base = (void *)zeroes;
+        b->iov[b->iovcnt].iov_len = ROUNDUP(rec_len, REC_ALIGN_ORDER) - rec_len;
+        b->iovcnt++;
+    }
+
+    return true;
+}
+
+/*
+ * Append an ELIDED_PAGE_DATA record to the iovec[] of a batch, if it has
+ * any pfns.
+ */
+static void build_elided_page_data(struct xc_sr_save_batch *b,
+                                   struct xc_sr_save_elided *e)
+{
+    if ( !e->hdr.count )
+        return;
+
+    e->rhdr.type = REC_TYPE_ELIDED_PAGE_DATA;
+    e->rhdr.length = sizeof(e->hdr) + e->hdr.count * sizeof(*e->pfns);
+
+    b->iov[b->iovcnt].iov_base = &e->rhdr;
+    b->iov[b->iovcnt].iov_len = sizeof(e->rhdr);
+    b->iovcnt++;
+
+    b->iov[b->iovcnt].iov_base = &e->hdr;
+    b->iov[b->iovcnt].iov_len = sizeof(e->hdr);
+    b->iovcnt++;
+
+    b->iov[b->iovcnt].iov_base = e->pfns;
+    b->iov[b->iovcnt].iov_len = e->hdr.count * sizeof(*e->pfns);
+    b->iovcnt++;
+}
+
+#define HASH_PRIME1 0x9e3779b185ebca87ULL
+#define HASH_PRIME2 0xc2b2ae3d27d4eb4fULL
+#define HASH_PRIME3 0x165667b19e3779f9ULL
+
+static inline uint64_t hash_rol(uint64_t x, unsigned int r)
+{
+    return (x << r) | (x >> (64 - r));
+}
+
+/*
+ * 64-bit hash of the content and type of a page, in four independent lanes
+ * to keep the multipliers busy.  Never zero.
+ */
+static uint64_t hash_page(const void *page, uint32_t type)
+{
+    const uint64_t *p = page;
+    uint64_t acc[4] = {
+        HASH_PRIME1 + HASH_PRIME2 + type, HASH_PRIME2, 0, -HASH_PRIME1,
+    };
+    uint64_t h;
+    unsigned int i, j;
+
+    for ( i = 0; i < PAGE_SIZE / sizeof(*p); i += ARRAY_SIZE(acc) )
+    {
+        for ( j = 0; j < ARRAY_SIZE(acc); ++j )
+            acc[j] = hash_rol(acc[j] + p[i + j] * HASH_PRIME2, 31) *
+                HASH_PRIME1;
+    }
+
+    h = hash_rol(acc[0], 1) + hash_rol(acc[1], 7) +
+        hash_rol(acc[2], 12) + hash_rol(acc[3], 18);
+
+    h ^= h >> 33;
+    h *= HASH_PRIME2;
+    h ^= h >> 29;
+    h *= HASH_PRIME3;
+    h ^= h >> 32;
+
+    return h ?: 1;
+}
+
+/*
+ * Decide whether a page of a batch needs its data sending.  Returns the
+ * ELIDED_PAGE_DATA_* reason for leaving it out, or 0 to send it.
+ *
+ * Pages are only looked up in ctx->save.page_hashes by the one pipeline
+ * worker preparing them, as a pfn is in at most one batch between drains.
+ */
+static uint32_t elide_page(struct xc_sr_context *ctx, xen_pfn_t pfn,
+                           uint32_t type, const void *page)
+{
+    uint64_t *hash = ctx->save.page_hashes ? &ctx->save.page_hashes[pfn]
+                                           : NULL, h;
+
+    if ( !page || page_is_zero(page) )
+    {
+        /* The restorer's copy is no longer one we can match against. */
+        if ( hash )
+            *hash = 0;
+
+        return page ? ELIDED_PAGE_DATA_ZERO : 0;
+    }
+
+    if ( !hash )
+        return 0;
+
+    h = hash_page(page, type);
+    if ( *hash == h )
+        return ELIDED_PAGE_DATA_UNCHANGED;
+
+    *hash = h;
+
+    return 0;
+}
+
+/*
+ * Prepare a batch of memory to be written as page data records.
+ *
+ * This function:
+ * - gets the types for each pfn in the batch.
+ * - for each pfn with real data:
+ *   - maps and attempts to localise the pages.
+ *   - leaves out the data of zero pages, and when enabled, of pages
+ *     unchanged since they were last sent.
+ * - constructs the iovec[] for the PAGE_DATA record, or when enabled and
+ *   worthwhile, compresses the pages into a COMPRESSED_PAGE_DATA record.
+ * - appends ELIDED_PAGE_DATA records for the pages left out.
+ *
+ * Must be followed by release_batch(), whether successful or not.
+ */
+static int prepare_batch(struct xc_sr_context *ctx, struct xc_sr_save_batch *b)
+{
+    xc_interface *xch = ctx->xch;
+    xen_pfn_t *mfns = b->mfns, *types = b->types;
+    int *errors = b->errors, rc = -1;
+    unsigned int i, p, nr_pages = 0;
+    unsigned int nr_pfns = b->nr_pfns;
+    void *page, *orig_page;
+
+    assert(nr_pfns != 0);
+
     for ( i = 0; i < nr_pfns; ++i )
     {
-        types[i] = mfns[i] = ctx->save.ops.pfn_to_gfn(ctx,
-                                                      ctx->save.batch_pfns[i]);
+        types[i] = mfns[i] = ctx->save.ops.pfn_to_gfn(ctx, b->pfns[i]);
 
         /* Likely a ballooned page. */
         if ( mfns[i] == INVALID_MFN )
-        {
-            set_bit(ctx->save.batch_pfns[i], ctx->save.deferred_pages);
-            ++ctx->save.nr_deferred_pages;
-        }
+            defer_page(ctx, b->pfns[i]);
     }
 
     rc = xc_get_pfn_type_batch(xch, ctx->domid, nr_pfns, types);
@@ -161,14 +587,14 @@ static int write_batch(struct xc_sr_context *ctx)
 
     if ( nr_pages > 0 )
     {
-        guest_mapping = xenforeignmemory_map(
+        b->guest_mapping = xenforeignmemory_map(
             xch->fmem, ctx->domid, PROT_READ, nr_pages, mfns, errors);
-        if ( !guest_mapping )
+        if ( !b->guest_mapping )
         {
             PERROR("Failed to map guest pages");
             goto err;
         }
-        nr_pages_mapped = nr_pages;
+        b->nr_pages_mapped = nr_pages;
 
         for ( i = 0, p = 0; i < nr_pfns; ++i )
         {
@@ -178,143 +604,567 @@ static int write_batch(struct xc_sr_context *ctx)
             if ( errors[p] )
             {
                 ERROR("Mapping of pfn %#"PRIpfn" (mfn %#"PRIpfn") failed %d",
-                      ctx->save.batch_pfns[i], mfns[p], errors[p]);
+                      b->pfns[i], mfns[p], errors[p]);
                 goto err;
             }
 
-            orig_page = page = guest_mapping + (p * PAGE_SIZE);
-            rc = ctx->save.ops.normalise_page(ctx, types[i], &page);
+            orig_page = page = b->guest_mapping + (p * PAGE_SIZE);
+            rc = ctx->save.ops.normalise_page(ctx, types[i], &page);
+
+            if ( orig_page != page )
+                b->local_pages[i] = page;
+
+            if ( rc )
+            {
+                if ( rc == -1 && errno == EAGAIN )
+                {
+                    defer_page(ctx, b->pfns[i]);
+                    types[i] = XEN_DOMCTL_PFINFO_XTAB;
+                    --nr_pages;
+                }
+                else
+                    goto err;
+            }
+            else
+                b->guest_data[i] = page;
+
+            rc = -1;
+            ++p;
+        }
+    }
+
+    b->nr_rec_pfns = b->zero.hdr.count = b->unchanged.hdr.count = 0;
+
+    for ( i = 0; i < nr_pfns; ++i )
+    {
+        uint64_t rec_pfn = ((uint64_t)(types[i]) << 32) | b->pfns[i];
+
+        switch ( elide_page(ctx, b->pfns[i], types[i], b->guest_data[i]) )
+        {
+        case ELIDED_PAGE_DATA_ZERO:
+            b->zero.pfns[b->zero.hdr.count++] = rec_pfn;
+            break;
+
+        case ELIDED_PAGE_DATA_UNCHANGED:
+            b->unchanged.pfns[b->unchanged.hdr.count++] = rec_pfn;
+            break;
+
+        default:
+            b->rec_pfns[b->nr_rec_pfns++] = rec_pfn;
+            continue;
+        }
+
+        b->guest_data[i] = NULL;
+        --nr_pages;
+    }
+
+    b->nr_pages = nr_pages;
+    b->iovcnt = 0;
+
+    if ( b->nr_rec_pfns &&
+         (!b->compressor || !build_compressed_page_data(ctx, b)) )
+        build_page_data(b);
+
+    build_elided_page_data(b, &b->zero);
+    build_elided_page_data(b, &b->unchanged);
+
+    rc = 0;
+
+ err:
+    return rc;
+}
+
+/*
+ * Send the records of a prepared batch as a chunk on the next of the further
+ * streams in turn, with a STRIPED_DATA record standing in for them in the
+ * main stream.
+ */
+static int write_striped_batch(struct xc_sr_context *ctx,
+                               struct xc_sr_save_batch *b)
+{
+    uint64_t seq = ctx->save.stripe_seq;
+    struct xc_sr_rhdr rhdr = {
+        .type = REC_TYPE_STRIPED_DATA,
+        .length = sizeof(struct xc_sr_rec_striped_data),
+    };
+    struct xc_sr_rec_striped_data sd = {
+        .stream = seq % ctx->save.nr_stripe_fds + 1,
+        /* A PAGE_DATA or COMPRESSED_PAGE_DATA, and two ELIDED_PAGE_DATA. */
+        .count = !!b->nr_rec_pfns + !!b->zero.hdr.count +
+                 !!b->unchanged.hdr.count,
+        .seq = seq,
+    };
+    struct iovec iov[] = {
+        { &rhdr, sizeof(rhdr) },
+        { &sd,   sizeof(sd) },
+    };
+
+    if ( !sd.count )
+        return 0;
+
+    if ( writev_exact(ctx->fd, iov, ARRAY_SIZE(iov)) ||
+         write_striped_chunk(ctx->save.stripes, &sd, b->iov, b->iovcnt) )
+        return -1;
+
+    ctx->save.stripe_seq++;
+
+    return 0;
+}
+
+/*
+ * Write a prepared batch into the stream, and account for its compression
+ * and elided pages.
+ */
+static int write_batch(struct xc_sr_context *ctx, struct xc_sr_save_batch *b)
+{
+    xc_interface *xch = ctx->xch;
+    struct xc_sr_compress_stats *stats = &ctx->save.compress_stats;
+    int rc;
+
+    if ( ctx->save.stripes )
+        rc = write_striped_batch(ctx, b);
+    else
+        rc = writev_exact(ctx->fd, b->iov, b->iovcnt);
+
+    if ( rc )
+    {
+        PERROR("Failed to write page data to stream");
+        return -1;
+    }
+
+    if ( b->compressor && b->nr_pages )
+    {
+        stats->pages += b->nr_pages;
+        stats->bytes += b->data_len;
+        stats->batches++;
+
+        if ( b->compressed )
+            stats->raw_pages += b->nr_raw_pages;
+        else
+        {
+            stats->raw_pages += b->nr_pages;
+            stats->raw_batches++;
+        }
+    }
+
+    ctx->save.elide_stats.zero_pages += b->zero.hdr.count;
+    ctx->save.elide_stats.unchanged_pages += b->unchanged.hdr.count;
+
+    return 0;
+}
+
+/*
+ * Drop the guest mappings and local pages of a batch, making it available
+ * for reuse.
+ */
+static void release_batch(struct xc_sr_context *ctx,
+                          struct xc_sr_save_batch *b)
+{
+    xc_interface *xch = ctx->xch;
+    unsigned int i;
+
+    if ( b->guest_mapping )
+        xenforeignmemory_unmap(xch->fmem, b->guest_mapping,
+                               b->nr_pages_mapped);
+    b->guest_mapping = NULL;
+    b->nr_pages_mapped = 0;
+
+    for ( i = 0; i < b->nr_pfns; ++i )
+    {
+        free(b->local_pages[i]);
+        b->local_pages[i] = NULL;
+        b->guest_data[i] = NULL;
+    }
+
+    b->nr_pfns = 0;
+    b->nr_pages = 0;
+    b->iovcnt = 0;
+
+    VALGRIND_MAKE_MEM_UNDEFINED(b->pfns, MAX_BATCH_SIZE * sizeof(*b->pfns));
+}
+
+/* Record the first failure of a pipeline stage.  Called with the lock held. */
+static void pipeline_set_error(struct xc_sr_save_pipeline *pl, int err)
+{
+    if ( pl->rc )
+        return;
+
+    pl->rc = -1;
+    pl->err = err;
+}
+
+/*
+ * Worker thread.  Maps and normalises submitted batches, in any order.
+ */
+static void *pipeline_worker(void *arg)
+{
+    struct xc_sr_context *ctx = arg;
+    struct xc_sr_save_pipeline *pl = ctx->save.pipeline;
+    struct xc_sr_save_batch *b;
+    bool skip;
+    int rc, err;
+
+    pthread_mutex_lock(&pl->lock);
+    for ( ; ; )
+    {
+        while ( !pl->stop && pl->prep_seq == pl->fill_seq )
+            pthread_cond_wait(&pl->cond, &pl->lock);
+
+        if ( pl->stop )
+            break;
+
+        b = &pl->batches[pl->prep_seq++ % pl->nr_batches];
+        b->state = BATCH_PREPARING;
+        /* Don't bother with further work once the pipeline has failed. */
+        skip = pl->rc;
+        pthread_mutex_unlock(&pl->lock);
+
+        rc = skip ? 0 : prepare_batch(ctx, b);
+        err = errno;
+
+        pthread_mutex_lock(&pl->lock);
+        if ( rc )
+            pipeline_set_error(pl, err);
+        b->state = BATCH_PREPARED;
+        pthread_cond_broadcast(&pl->cond);
+    }
+    pthread_mutex_unlock(&pl->lock);
+
+    return NULL;
+}
+
+/*
+ * Writer thread.  Writes prepared batches into the stream in sequence order.
+ */
+static void *pipeline_writer(void *arg)
+{
+    struct xc_sr_context *ctx = arg;
+    struct xc_sr_save_pipeline *pl = ctx->save.pipeline;
+    struct xc_sr_save_batch *b;
+    bool skip;
+    int rc, err;
+
+    pthread_mutex_lock(&pl->lock);
+    for ( ; ; )
+    {
+        b = &pl->batches[pl->write_seq % pl->nr_batches];
+
+        while ( !pl->stop && b->state != BATCH_PREPARED )
+            pthread_cond_wait(&pl->cond, &pl->lock);
+
+        if ( pl->stop )
+            break;
+
+        b->state = BATCH_WRITING;
+        skip = pl->rc;
+        pthread_mutex_unlock(&pl->lock);
+
+        rc = skip ? 0 : write_batch(ctx, b);
+        err = errno;
+        release_batch(ctx, b);
+
+        pthread_mutex_lock(&pl->lock);
+        if ( rc )
+            pipeline_set_error(pl, err);
+        b->state = BATCH_FREE;
+        pl->write_seq++;
+        pthread_cond_broadcast(&pl->cond);
+    }
+    pthread_mutex_unlock(&pl->lock);
+
+    return NULL;
+}
+
+/*
+ * Obtain a free batch for the main thread to fill, waiting for the writer
+ * to retire one if necessary.
+ */
+static int start_batch(struct xc_sr_context *ctx)
+{
+    struct xc_sr_save_pipeline *pl = ctx->save.pipeline;
+    struct xc_sr_save_batch *b;
+    int rc = 0;
+
+    assert(!pl->filling);
+
+    if ( !pl->threaded )
+    {
+        b = &pl->batches[0];
+        b->state = BATCH_FILLING;
+        pl->filling = b;
+
+        return 0;
+    }
+
+    pthread_mutex_lock(&pl->lock);
+
+    while ( !pl->rc && pl->fill_seq - pl->write_seq == pl->nr_batches )
+        pthread_cond_wait(&pl->cond, &pl->lock);
+
+    if ( pl->rc )
+    {
+        rc = pl->rc;
+        errno = pl->err;
+    }
+    else
+    {
+        b = &pl->batches[pl->fill_seq % pl->nr_batches];
+        assert(b->state == BATCH_FREE);
+        b->state = BATCH_FILLING;
+        pl->filling = b;
+    }
+
+    pthread_mutex_unlock(&pl->lock);
+
+    return rc;
+}
+
+/*
+ * Hand the batch being filled over to the pipeline.  When running without
+ * threads, the batch is sent to the stream immediately.
+ */
+static int submit_batch(struct xc_sr_context *ctx)
+{
+    struct xc_sr_save_pipeline *pl = ctx->save.pipeline;
+    struct xc_sr_save_batch *b = pl->filling;
+    int rc;
+
+    assert(b && b->state == BATCH_FILLING && b->nr_pfns);
+
+    pl->filling = NULL;
+
+    if ( !pl->threaded )
+    {
+        rc = prepare_batch(ctx, b);
+        if ( !rc )
+            rc = write_batch(ctx, b);
+        release_batch(ctx, b);
+        b->state = BATCH_FREE;
+
+        return rc;
+    }
+
+    pthread_mutex_lock(&pl->lock);
+    b->state = BATCH_QUEUED;
+    pl->fill_seq++;
+    pthread_cond_broadcast(&pl->cond);
+    pthread_mutex_unlock(&pl->lock);
+
+    return 0;
+}
+
+/*
+ * Wait for every submitted batch to be written into the stream.
+ */
+static int drain_pipeline(struct xc_sr_context *ctx)
+{
+    struct xc_sr_save_pipeline *pl = ctx->save.pipeline;
+    int rc = 0;
+
+    if ( !pl->threaded )
+        return 0;
+
+    pthread_mutex_lock(&pl->lock);
+
+    while ( pl->write_seq != pl->fill_seq )
+        pthread_cond_wait(&pl->cond, &pl->lock);
+
+    if ( pl->rc )
+    {
+        rc = pl->rc;
+        errno = pl->err;
+    }
+
+    pthread_mutex_unlock(&pl->lock);
+
+    return rc;
+}
+
+/*
+ * Flush the partially filled batch, and wait for all page data to reach the
+ * stream.
+ */
+static int flush_batch(struct xc_sr_context *ctx)
+{
+    struct xc_sr_save_pipeline *pl = ctx->save.pipeline;
+    int rc = 0;
+
+    if ( pl->filling && pl->filling->nr_pfns )
+        rc = submit_batch(ctx);
+
+    if ( !rc )
+        rc = drain_pipeline(ctx);
+
+    return rc;
+}
+
+/*
+ * Hand over the partially filled batch, without waiting for it to reach the
+ * stream.
+ */
+static int push_batch(struct xc_sr_context *ctx)
+{
+    struct xc_sr_save_pipeline *pl = ctx->save.pipeline;
+
+    if ( pl->filling && pl->filling->nr_pfns )
+        return submit_batch(ctx);
+
+    return 0;
+}
+
+/*
+ * Add a single pfn to the batch, submitting the batch once full.
+ */
+static int add_to_batch(struct xc_sr_context *ctx, xen_pfn_t pfn)
+{
+    struct xc_sr_save_pipeline *pl = ctx->save.pipeline;
+    int rc = 0;
+
+    if ( !pl->filling )
+    {
+        rc = start_batch(ctx);
+        if ( rc )
+            return rc;
+    }
+
+    pl->filling->pfns[pl->filling->nr_pfns++] = pfn;
+
+    if ( pl->filling->nr_pfns == MAX_BATCH_SIZE )
+        rc = submit_batch(ctx);
+
+    return rc;
+}
+
+/*
+ * Stop and reap the pipeline threads.  Every submitted batch must have been
+ * retired by the writer beforehand.
+ */
+static void stop_pipeline_threads(struct xc_sr_save_pipeline *pl,
+                                  bool writer, unsigned int nr_workers)
+{
+    unsigned int i;
+
+    pthread_mutex_lock(&pl->lock);
+    pl->stop = true;
+    pthread_cond_broadcast(&pl->cond);
+    pthread_mutex_unlock(&pl->lock);
 
-            if ( orig_page != page )
-                local_pages[i] = page;
+    if ( writer )
+        pthread_join(pl->writer, NULL);
+    for ( i = 0; i < nr_workers; ++i )
+        pthread_join(pl->workers[i], NULL);
 
-            if ( rc )
-            {
-                if ( rc == -1 && errno == EAGAIN )
-                {
-                    set_bit(ctx->save.batch_pfns[i], ctx->save.deferred_pages);
-                    ++ctx->save.nr_deferred_pages;
-                    types[i] = XEN_DOMCTL_PFINFO_XTAB;
-                    --nr_pages;
-                }
-                else
-                    goto err;
-            }
-            else
-                guest_data[i] = page;
+    pthread_cond_destroy(&pl->cond);
+    pthread_mutex_destroy(&pl->lock);
+}
 
-            rc = -1;
-            ++p;
-        }
-    }
+/*
+ * Allocate the batches and start the pipeline threads.  Failure to start
+ * the threads isn't fatal; the batches are then sent synchronously.
+ */
+static int setup_pipeline(struct xc_sr_context *ctx)
+{
+    xc_interface *xch = ctx->xch;
+    struct xc_sr_save_pipeline *pl;
+    long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    unsigned int i;
+    int rc;
 
-    rec_pfns = malloc(nr_pfns * sizeof(*rec_pfns));
-    if ( !rec_pfns )
+    pl = calloc(1, sizeof(*pl));
+    if ( !pl )
     {
-        ERROR("Unable to allocate %zu bytes of memory for page data pfn list",
-              nr_pfns * sizeof(*rec_pfns));
-        goto err;
+        ERROR("Unable to allocate page-send pipeline");
+        return -1;
     }
+    ctx->save.pipeline = pl;
 
-    hdr.count = nr_pfns;
-
-    rec.length = sizeof(hdr);
-    rec.length += nr_pfns * sizeof(*rec_pfns);
-    rec.length += nr_pages * PAGE_SIZE;
+    if ( !(xch->flags & XC_OPENFLAG_NON_REENTRANT) && cpus > 1 )
+        pl->nr_workers = min_t(long, cpus - 1, SAVE_PIPELINE_MAX_WORKERS);
 
-    for ( i = 0; i < nr_pfns; ++i )
-        rec_pfns[i] = ((uint64_t)(types[i]) << 32) | ctx->save.batch_pfns[i];
+    pl->nr_batches = pl->nr_workers ? 2 * pl->nr_workers + 2 : 1;
 
-    iov[0].iov_base = &rec.type;
-    iov[0].iov_len = sizeof(rec.type);
+    pl->batches = calloc(pl->nr_batches, sizeof(*pl->batches));
+    if ( !pl->batches )
+    {
+        ERROR("Unable to allocate %u page-send batches", pl->nr_batches);
+        return -1;
+    }
 
-    iov[1].iov_base = &rec.length;
-    iov[1].iov_len = sizeof(rec.length);
+    for ( i = 0; i < pl->nr_batches; ++i )
+    {
+        if ( alloc_batch(ctx, &pl->batches[i]) )
+        {
+            ERROR("Unable to allocate memory for a batch of %u pages",
+                  MAX_BATCH_SIZE);
+            return -1;
+        }
+    }
 
-    iov[2].iov_base = &hdr;
-    iov[2].iov_len = sizeof(hdr);
+    if ( !pl->nr_workers )
+        return 0;
 
-    iov[3].iov_base = rec_pfns;
-    iov[3].iov_len = nr_pfns * sizeof(*rec_pfns);
+    pthread_mutex_init(&pl->lock, NULL);
+    pthread_cond_init(&pl->cond, NULL);
 
-    iovcnt = 4;
+    rc = pthread_create(&pl->writer, NULL, pipeline_writer, ctx);
+    if ( rc )
+    {
+        errno = rc;
+        PERROR("Unable to create page-send writer thread");
+        stop_pipeline_threads(pl, false, 0);
+        goto sync;
+    }
 
-    if ( nr_pages )
+    for ( i = 0; i < pl->nr_workers; ++i )
     {
-        for ( i = 0; i < nr_pfns; ++i )
+        rc = pthread_create(&pl->workers[i], NULL, pipeline_worker, ctx);
+        if ( rc )
         {
-            if ( guest_data[i] )
-            {
-                iov[iovcnt].iov_base = guest_data[i];
-                iov[iovcnt].iov_len = PAGE_SIZE;
-                iovcnt++;
-                --nr_pages;
-            }
+            errno = rc;
+            PERROR("Unable to create page-send worker thread");
+            stop_pipeline_threads(pl, true, i);
+            goto sync;
         }
     }
 
-    if ( writev_exact(ctx->fd, iov, iovcnt) )
-    {
-        PERROR("Failed to write page data to stream");
-        goto err;
-    }
+    pl->threaded = true;
+    DPRINTF("Page-send pipeline: %u workers, %u batches",
+            pl->nr_workers, pl->nr_batches);
 
-    /* Sanity check we have sent all the pages we expected to. */
-    assert(nr_pages == 0);
-    rc = ctx->save.nr_batch_pfns = 0;
+    return 0;
 
- err:
-    free(rec_pfns);
-    if ( guest_mapping )
-        xenforeignmemory_unmap(xch->fmem, guest_mapping, nr_pages_mapped);
-    for ( i = 0; local_pages && i < nr_pfns; ++i )
-        free(local_pages[i]);
-    free(iov);
-    free(local_pages);
-    free(guest_data);
-    free(errors);
-    free(types);
-    free(mfns);
+ sync:
+    IPRINTF("Sending pages without a pipeline");
+    pl->nr_workers = 0;
+    pl->stop = false;
 
-    return rc;
+    return 0;
 }
 
-/*
- * Flush a batch of pfns into the stream.
- */
-static int flush_batch(struct xc_sr_context *ctx)
+static void teardown_pipeline(struct xc_sr_context *ctx)
 {
-    int rc = 0;
+    struct xc_sr_save_pipeline *pl = ctx->save.pipeline;
+    unsigned int i;
 
-    if ( ctx->save.nr_batch_pfns == 0 )
-        return rc;
-
-    rc = write_batch(ctx);
+    if ( !pl )
+        return;
 
-    if ( !rc )
+    if ( pl->threaded )
     {
-        VALGRIND_MAKE_MEM_UNDEFINED(ctx->save.batch_pfns,
-                                    MAX_BATCH_SIZE *
-                                    sizeof(*ctx->save.batch_pfns));
+        /* Let any batches still in flight (after an error) retire. */
+        drain_pipeline(ctx);
+        stop_pipeline_threads(pl, true, pl->nr_workers);
     }
 
-    return rc;
-}
-
-/*
- * Add a single pfn to the batch, flushing the batch if full.
- */
-static int add_to_batch(struct xc_sr_context *ctx, xen_pfn_t pfn)
-{
-    int rc = 0;
-
-    if ( ctx->save.nr_batch_pfns == MAX_BATCH_SIZE )
-        rc = flush_batch(ctx);
+    if ( pl->filling )
+        release_batch(ctx, pl->filling);
 
-    if ( rc == 0 )
-        ctx->save.batch_pfns[ctx->save.nr_batch_pfns++] = pfn;
+    for ( i = 0; pl->batches && i < pl->nr_batches; ++i )
+        free_batch(&pl->batches[i]);
 
-    return rc;
+    free(pl->batches);
+    free(pl);
+    ctx->save.pipeline = NULL;
 }
 
 /*
@@ -400,6 +1250,183 @@ static int send_dirty_pages(struct xc_sr_context *ctx,
     return ctx->save.ops.check_vm_state(ctx);
 }
 
+/*
+ * Fetch, and for a CLEAN reset, the log-dirty bitmap.  Where Xen supports
+ * it, this is done DIRTY_CHUNK_PFNS at a time, so each hypercall pauses the
+ * domain only for as long as its chunk takes.  While fewer than one pfn in
+ * 64 was dirty last time, the dirty pfns are fetched as a list, which costs
+ * less to copy out than the bitmap of the whole guest.
+ */
+#define DIRTY_CHUNK_PFNS    (1UL << 21)
+#define DIRTY_PFN_LIST_SIZE (1U << 12)
+
+static int get_dirty_bitmap(struct xc_sr_context *ctx, unsigned int sop,
+                            unsigned int mode, xc_shadow_op_stats_t *stats)
+{
+    xc_interface *xch = ctx->xch;
+    xc_shadow_op_stats_t chunk_stats;
+    unsigned long pfn, nr, nr_pfns, i;
+    bool sparse = ctx->save.last_dirty_count < ctx->save.p2m_size / 64;
+    long long done;
+    DECLARE_HYPERCALL_BUFFER_SHADOW(unsigned long, dirty_bitmap,
+                                    &ctx->save.dirty_bitmap_hbuf);
+    DECLARE_HYPERCALL_BUFFER_SHADOW(uint64_t, dirty_pfns,
+                                    &ctx->save.dirty_pfns_hbuf);
+
+    if ( ctx->save.no_logdirty_range )
+        goto whole;
+
+    if ( sparse )
+        bitmap_clear(dirty_bitmap, ctx->save.p2m_size);
+
+    stats->fault_count = stats->dirty_count = 0;
+
+    for ( pfn = 0; pfn < ctx->save.p2m_size; pfn += done )
+    {
+        nr = min(DIRTY_CHUNK_PFNS, ctx->save.p2m_size - pfn);
+        nr_pfns = DIRTY_PFN_LIST_SIZE;
+
+        done = xc_logdirty_control_range(
+            xch, ctx->domid, sop,
+            sparse ? NULL : HYPERCALL_BUFFER(dirty_bitmap),
+            sparse ? HYPERCALL_BUFFER(dirty_pfns) : NULL, &nr_pfns,
+            pfn, nr, mode, &chunk_stats);
+
+        if ( done < 0 && errno == EINVAL && pfn == 0 )
+        {
+            DPRINTF("Log-dirty ranges not supported: fetching whole bitmap");
+            ctx->save.no_logdirty_range = true;
+            goto whole;
+        }
+
+        if ( done <= 0 )
+        {
+            PERROR("Failed to retrieve logdirty bitmap for pfns %#lx-%#lx",
+                   pfn, pfn + nr - 1);
+            return -1;
+        }
+
+        if ( sparse )
+        {
+            for ( i = 0; i < nr_pfns; ++i )
+            {
+                if ( dirty_pfns[i] >= ctx->save.p2m_size )
+                {
+                    ERROR("Dirty pfn %#"PRIx64" out of range", dirty_pfns[i]);
+                    return -1;
+                }
+
+                set_bit(dirty_pfns[i], dirty_bitmap);
+            }
+        }
+
+        stats->fault_count += chunk_stats.fault_count;
+        stats->dirty_count += chunk_stats.dirty_count;
+    }
+
+    ctx->save.last_dirty_count = stats->dirty_count;
+
+    return 0;
+
+ whole:
+    if ( xc_logdirty_control(xch, ctx->domid, sop,
+                             HYPERCALL_BUFFER(dirty_bitmap),
+                             ctx->save.p2m_size, mode, stats) !=
+         ctx->save.p2m_size )
+    {
+        PERROR("Failed to retrieve logdirty bitmap");
+        return -1;
+    }
+
+    return 0;
+}
+
+/*
+ * Fetch, and reset, the pfns dirtied since the last CLEAN from Xen's dirty
+ * ring, in the order they were first dirtied.  This costs in proportion to
+ * the pages dirtied rather than the size of the guest.  Falls back to the
+ * bitmap where there is no ring, or pfns were lost to it filling up.
+ */
+static int get_dirty_pfns_from_ring(struct xc_sr_context *ctx,
+                                    xc_shadow_op_stats_t *stats)
+{
+    xc_interface *xch = ctx->xch;
+    xc_shadow_op_stats_t ring_stats;
+    unsigned long nr_pfns, i;
+    bool first = true;
+    DECLARE_HYPERCALL_BUFFER_SHADOW(unsigned long, dirty_bitmap,
+                                    &ctx->save.dirty_bitmap_hbuf);
+    DECLARE_HYPERCALL_BUFFER_SHADOW(uint64_t, dirty_pfns,
+                                    &ctx->save.dirty_pfns_hbuf);
+
+    bitmap_clear(dirty_bitmap, ctx->save.p2m_size);
+    stats->fault_count = stats->dirty_count = 0;
+
+    do {
+        nr_pfns = DIRTY_PFN_LIST_SIZE;
+
+        if ( xc_logdirty_drain_ring(xch, ctx->domid,
+                                    HYPERCALL_BUFFER(dirty_pfns), &nr_pfns,
+                                    0, &ring_stats) )
+        {
+            /*
+             * Whatever was lost is still dirty in the bitmap.  If this pass
+             * has already taken some pfns, leave the rest for the next.
+             */
+            if ( errno == ENOBUFS && !first )
+                break;
+
+            if ( errno == ENOBUFS )
+            {
+                DPRINTF("Dirty ring overflowed: fetching whole bitmap");
+
+                if ( xc_logdirty_control(xch, ctx->domid,
+                                         XEN_DOMCTL_SHADOW_OP_CLEAN,
+                                         HYPERCALL_BUFFER(dirty_bitmap),
+                                         ctx->save.p2m_size, 0, stats) !=
+                     ctx->save.p2m_size )
+                {
+                    PERROR("Failed to retrieve logdirty bitmap");
+                    return -1;
+                }
+
+                ctx->save.last_dirty_count = stats->dirty_count;
+                return 0;
+            }
+
+            if ( first && (errno == EOPNOTSUPP || errno == EINVAL) )
+            {
+                DPRINTF("Dirty ring not supported: using the bitmap");
+                ctx->save.dirty_ring = false;
+                return get_dirty_bitmap(ctx, XEN_DOMCTL_SHADOW_OP_CLEAN, 0,
+                                        stats);
+            }
+
+            PERROR("Failed to take pfns from the dirty ring");
+            return -1;
+        }
+
+        for ( i = 0; i < nr_pfns; ++i )
+        {
+            if ( dirty_pfns[i] >= ctx->save.p2m_size )
+            {
+                ERROR("Dirty pfn %#"PRIx64" out of range", dirty_pfns[i]);
+                return -1;
+            }
+
+            set_bit(dirty_pfns[i], dirty_bitmap);
+        }
+
+        stats->fault_count = ring_stats.fault_count;
+        stats->dirty_count += nr_pfns;
+        first = false;
+    } while ( nr_pfns == DIRTY_PFN_LIST_SIZE );
+
+    ctx->save.last_dirty_count = stats->dirty_count;
+
+    return 0;
+}
+
 /*
  * Send all pages in the guests p2m.  Used as the first iteration of the live
  * migration loop, and for a non-live save.
@@ -420,6 +1447,18 @@ static int enable_logdirty(struct xc_sr_context *ctx)
     int on1 = 0, off = 0, on2 = 0;
     int rc;
 
+    /*
+     * Ask for the dirty ring too, where Xen can keep one for this guest.
+     * Failing that, e.g. as logdirty is enabled for VRAM tracking, carry on
+     * with just the bitmap.
+     */
+    rc = xc_shadow_control(xch, ctx->domid, XEN_DOMCTL_SHADOW_OP_ENABLE,
+                           NULL, (XEN_DOMCTL_SHADOW_ENABLE_LOG_DIRTY |
+                                  XEN_DOMCTL_SHADOW_ENABLE_DIRTY_RING));
+    ctx->save.dirty_ring = rc == 0;
+    if ( ctx->save.dirty_ring )
+        return 0;
+
     /* This juggling is required if logdirty is enabled for VRAM tracking. */
     rc = xc_shadow_control(xch, ctx->domid,
                            XEN_DOMCTL_SHADOW_OP_ENABLE_LOGDIRTY,
@@ -482,11 +1521,244 @@ static int update_progress_string(struct xc_sr_context *ctx, char **str)
 
 static int simple_precopy_policy(struct precopy_stats stats, void *user)
 {
-    return ((stats.dirty_count >= 0 &&
-             stats.dirty_count < SPP_TARGET_DIRTY_COUNT) ||
-            stats.iteration >= SPP_MAX_ITERATIONS)
-        ? XGS_POLICY_STOP_AND_COPY
-        : XGS_POLICY_CONTINUE_PRECOPY;
+    return ((stats.dirty_count >= 0 &&
+             stats.dirty_count < SPP_TARGET_DIRTY_COUNT) ||
+            stats.iteration >= SPP_MAX_ITERATIONS)
+        ? XGS_POLICY_STOP_AND_COPY
+        : XGS_POLICY_CONTINUE_PRECOPY;
+}
+
+/*
+ * The default policy when post-copy is permitted.  As above, but if the dirty
+ * set is still large when the iterations run out, the domain is moved and the
+ * rest of its memory follows, rather than pausing it for as long as sending
+ * that takes.
+ */
+static int simple_postcopy_policy(struct precopy_stats stats, void *user)
+{
+    if ( stats.dirty_count >= 0 &&
+         stats.dirty_count < SPP_TARGET_DIRTY_COUNT )
+        return XGS_POLICY_STOP_AND_COPY;
+
+    return stats.iteration >= SPP_MAX_ITERATIONS
+        ? XGS_POLICY_POSTCOPY
+        : XGS_POLICY_CONTINUE_PRECOPY;
+}
+
+/*
+ * The adaptive precopy policy, for XCFLAGS_ADAPTIVE_PRECOPY.  Rather than
+ * counting iterations, it predicts the downtime stop-and-copy would cause
+ * from the number of dirty pages and the throughput achieved so far, and
+ * stops once that is within max_downtime_ms.
+ *
+ * Each round sends the pages dirtied while the last was being sent, so the
+ * dirty set only shrinks usefully while the domain dirties memory at less
+ * than half the rate it can be sent.  A domain dirtying faster has its
+ * scheduler cap lowered in proportion, down to a floor.  The iteration limit
+ * is the backstop for a domain which can't be slowed enough.
+ *
+ * The dirty rate counts each page once however often it was written, so
+ * once a domain dirties most of its memory each round, it says little more
+ * than how long the round took.  A dirty set which doesn't shrink, or which
+ * is near the size of the domain, has the cap halved instead.
+ */
+#define APP_MAX_ITERATIONS      30
+#define APP_DEFAULT_DOWNTIME_MS 300
+#define APP_MIN_CAP_PCT         10 /* Of each vcpu. */
+
+static uint64_t monotonic_ns(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+/* Pages per second, from a number of pages and an interval in ns. */
+static uint64_t page_rate(uint64_t pages, uint64_t ns)
+{
+    return pages * 1000000000ULL / (ns ?: 1);
+}
+
+static void record_send_rate(struct xc_sr_context *ctx, uint64_t pages,
+                             uint64_t ns)
+{
+    struct xc_sr_adaptive_precopy *ap = &ctx->save.adaptive;
+    uint64_t rate = page_rate(pages, ns);
+
+    /* Smoothed, as the link is shared and rounds vary greatly in size. */
+    ap->send_rate = ap->send_rate ? (ap->send_rate + rate) / 2 : rate;
+}
+
+static void record_dirty_rate(struct xc_sr_context *ctx, uint64_t pages)
+{
+    struct xc_sr_adaptive_precopy *ap = &ctx->save.adaptive;
+    uint64_t now = monotonic_ns();
+
+    /* Unsmoothed, to see the effect of the last change of cap at once. */
+    ap->dirty_rate = page_rate(pages, now - ap->clean_ns);
+    ap->clean_ns = now;
+}
+
+/*
+ * Find which scheduler the domain is under, and its cap to put back later.
+ * Only credit and credit2 have caps, and the domctl fails for the others.
+ */
+static int get_sched_cap(struct xc_sr_context *ctx)
+{
+    xc_interface *xch = ctx->xch;
+    struct xc_sr_adaptive_precopy *ap = &ctx->save.adaptive;
+    struct xen_domctl_sched_credit credit;
+    struct xen_domctl_sched_credit2 credit2;
+
+    if ( !xc_sched_credit_domain_get(xch, ctx->domid, &credit) )
+    {
+        ap->sched = XEN_SCHEDULER_CREDIT;
+        ap->orig_cap = credit.cap;
+    }
+    else if ( !xc_sched_credit2_domain_get(xch, ctx->domid, &credit2) )
+    {
+        ap->sched = XEN_SCHEDULER_CREDIT2;
+        ap->orig_cap = credit2.cap;
+    }
+    else
+    {
+        IPRINTF("Domain's scheduler has no cap: not throttling precopy");
+        ap->no_throttle = true;
+        return -1;
+    }
+
+    ap->cap = ap->orig_cap;
+
+    return 0;
+}
+
+static int set_sched_cap(struct xc_sr_context *ctx, uint16_t cap)
+{
+    xc_interface *xch = ctx->xch;
+    struct xc_sr_adaptive_precopy *ap = &ctx->save.adaptive;
+    int rc;
+
+    /* A weight of 0 leaves the domain's weight as it is. */
+    if ( ap->sched == XEN_SCHEDULER_CREDIT )
+    {
+        struct xen_domctl_sched_credit credit = { .cap = cap };
+
+        rc = xc_sched_credit_domain_set(xch, ctx->domid, &credit);
+    }
+    else
+    {
+        struct xen_domctl_sched_credit2 credit2 = { .cap = cap };
+
+        rc = xc_sched_credit2_domain_set(xch, ctx->domid, &credit2);
+    }
+
+    if ( rc )
+    {
+        PERROR("Failed to set scheduler cap of domain to %u%%", cap);
+        return rc;
+    }
+
+    ap->cap = cap;
+
+    return 0;
+}
+
+/*
+ * Scale the domain's cap by num / den, to bring its dirty rate down.
+ * Failure isn't fatal: the migration just takes its chances.
+ */
+static void throttle_domain(struct xc_sr_context *ctx, uint64_t num,
+                            uint64_t den)
+{
+    xc_interface *xch = ctx->xch;
+    struct xc_sr_adaptive_precopy *ap = &ctx->save.adaptive;
+    unsigned long max_cap = min(ap->nr_vcpus * 100UL, (unsigned long)UINT16_MAX);
+    unsigned long min_cap = ap->nr_vcpus * APP_MIN_CAP_PCT;
+    unsigned long cap;
+
+    if ( ap->no_throttle || (!ap->sched && get_sched_cap(ctx)) )
+        return;
+
+    /* A cap of 0 means uncapped. */
+    cap = ap->cap && ap->cap < max_cap ? ap->cap : max_cap;
+    if ( cap <= min_cap )
+        return;
+
+    cap = max(cap * num / (den ?: 1), min_cap);
+
+    if ( set_sched_cap(ctx, cap) )
+    {
+        ap->no_throttle = true;
+        return;
+    }
+
+    ap->throttle_steps++;
+    IPRINTF("Dirtying %"PRIu64" pages/s against %"PRIu64" sent: "
+            "capping domain at %lu%%", ap->dirty_rate, ap->send_rate, cap);
+}
+
+/* Put back the domain's cap from before the migration. */
+static void unthrottle_domain(struct xc_sr_context *ctx)
+{
+    struct xc_sr_adaptive_precopy *ap = &ctx->save.adaptive;
+
+    if ( ap->sched && ap->cap != ap->orig_cap )
+        set_sched_cap(ctx, ap->orig_cap);
+}
+
+static int adaptive_precopy_policy(struct precopy_stats stats, void *user)
+{
+    struct xc_sr_context *ctx = user;
+    xc_interface *xch = ctx->xch;
+    struct xc_sr_adaptive_precopy *ap = &ctx->save.adaptive;
+    uint64_t downtime_ms;
+    long prev_dirty_count = ap->prev_dirty_count;
+
+    ap->prev_dirty_count = stats.dirty_count;
+
+    /* Nothing to go on until a round is sent and the next bitmap fetched. */
+    if ( stats.iteration == 0 || stats.dirty_count < 0 )
+        return XGS_POLICY_CONTINUE_PRECOPY;
+
+    downtime_ms = stats.dirty_count * 1000ULL / (ap->send_rate ?: 1);
+
+    DPRINTF("Precopy iteration %u: %ld pages dirty, %"PRIu64" pages/s "
+            "dirtied, %"PRIu64" sent, %"PRIu64"ms predicted downtime",
+            stats.iteration, stats.dirty_count, ap->dirty_rate,
+            ap->send_rate, downtime_ms);
+
+    if ( stats.dirty_count < SPP_TARGET_DIRTY_COUNT ||
+         downtime_ms <= ap->max_downtime_ms )
+        return XGS_POLICY_STOP_AND_COPY;
+
+    /* Stop-and-copy, unless post-copy is permitted. */
+    if ( stats.iteration >= APP_MAX_ITERATIONS )
+        return XGS_POLICY_POSTCOPY;
+
+    if ( (prev_dirty_count > 0 && stats.dirty_count >= prev_dirty_count) ||
+         stats.dirty_count >= ctx->save.p2m_size / 8 * 7 )
+        throttle_domain(ctx, 1, 2);
+    else if ( ap->dirty_rate > ap->send_rate / 2 )
+        throttle_domain(ctx, ap->send_rate / 2, ap->dirty_rate);
+
+    return XGS_POLICY_CONTINUE_PRECOPY;
+}
+
+/*
+ * Ask the precopy policy what to do next.  Post-copy is taken to mean
+ * stop-and-copy unless the caller permitted it.
+ */
+static int precopy_decision(struct xc_sr_context *ctx,
+                            precopy_policy_t precopy_policy, void *data)
+{
+    int decision = precopy_policy(ctx->save.stats, data);
+
+    if ( decision == XGS_POLICY_POSTCOPY && !ctx->save.postcopy )
+        decision = XGS_POLICY_STOP_AND_COPY;
+
+    return decision;
 }
 
 /*
@@ -508,6 +1780,8 @@ static int send_memory_live(struct xc_sr_context *ctx)
     void *data = ctx->save.callbacks->data;
 
     struct precopy_stats *policy_stats;
+    bool adaptive = false;
+    uint64_t start_ns;
 
     rc = update_progress_string(ctx, &progress_str);
     if ( rc )
@@ -518,25 +1792,44 @@ static int send_memory_live(struct xc_sr_context *ctx)
     };
     policy_stats = &ctx->save.stats;
 
-    if ( precopy_policy == NULL )
-        precopy_policy = simple_precopy_policy;
+    if ( precopy_policy == NULL && ctx->save.adaptive_precopy )
+    {
+        precopy_policy = adaptive_precopy_policy;
+        data = ctx;
+        adaptive = true;
+        ctx->save.adaptive.clean_ns = monotonic_ns();
+    }
+    else if ( precopy_policy == NULL )
+        precopy_policy = ctx->save.postcopy ? simple_postcopy_policy
+                                            : simple_precopy_policy;
 
     bitmap_set(dirty_bitmap, ctx->save.p2m_size);
 
     for ( ; ; )
     {
-        policy_decision = precopy_policy(*policy_stats, data);
+        policy_decision = precopy_decision(ctx, precopy_policy, data);
         x++;
 
-        if ( stats.dirty_count > 0 && policy_decision != XGS_POLICY_ABORT )
+        if ( policy_decision == XGS_POLICY_POSTCOPY )
+            /* Leave the pages found dirty to be sent after the move. */
+            bitmap_or(ctx->save.deferred_pages, dirty_bitmap,
+                      ctx->save.p2m_size);
+        else if ( stats.dirty_count > 0 &&
+                  policy_decision != XGS_POLICY_ABORT )
         {
             rc = update_progress_string(ctx, &progress_str);
             if ( rc )
                 goto out;
 
+            start_ns = monotonic_ns();
+
             rc = send_dirty_pages(ctx, stats.dirty_count);
             if ( rc )
                 goto out;
+
+            if ( adaptive )
+                record_send_rate(ctx, stats.dirty_count,
+                                 monotonic_ns() - start_ns);
         }
 
         if ( policy_decision != XGS_POLICY_CONTINUE_PRECOPY )
@@ -546,23 +1839,21 @@ static int send_memory_live(struct xc_sr_context *ctx)
         policy_stats->total_written += policy_stats->dirty_count;
         policy_stats->dirty_count   = -1;
 
-        policy_decision = precopy_policy(*policy_stats, data);
+        policy_decision = precopy_decision(ctx, precopy_policy, data);
 
         if ( policy_decision != XGS_POLICY_CONTINUE_PRECOPY )
             break;
 
-        if ( xc_logdirty_control(
-                 xch, ctx->domid, XEN_DOMCTL_SHADOW_OP_CLEAN,
-                 &ctx->save.dirty_bitmap_hbuf, ctx->save.p2m_size,
-                 0, &stats) != ctx->save.p2m_size )
-        {
-            PERROR("Failed to retrieve logdirty bitmap");
-            rc = -1;
+        rc = ctx->save.dirty_ring
+             ? get_dirty_pfns_from_ring(ctx, &stats)
+             : get_dirty_bitmap(ctx, XEN_DOMCTL_SHADOW_OP_CLEAN, 0, &stats);
+        if ( rc )
             goto out;
-        }
 
         policy_stats->dirty_count = stats.dirty_count;
 
+        if ( adaptive )
+            record_dirty_rate(ctx, stats.dirty_count);
     }
 
     if ( policy_decision == XGS_POLICY_ABORT )
@@ -572,6 +1863,8 @@ static int send_memory_live(struct xc_sr_context *ctx)
         goto out;
     }
 
+    ctx->save.postcopy_active = policy_decision == XGS_POLICY_POSTCOPY;
+
  out:
     xc_set_progress_prefix(xch, NULL);
     free(progress_str);
@@ -648,16 +1941,10 @@ static int suspend_and_send_dirty(struct xc_sr_context *ctx)
     if ( rc )
         goto out;
 
-    if ( xc_logdirty_control(
-             xch, ctx->domid, XEN_DOMCTL_SHADOW_OP_CLEAN,
-             HYPERCALL_BUFFER(dirty_bitmap), ctx->save.p2m_size,
-             XEN_DOMCTL_SHADOW_LOGDIRTY_FINAL, &stats) !=
-         ctx->save.p2m_size )
-    {
-        PERROR("Failed to retrieve logdirty bitmap");
-        rc = -1;
+    rc = get_dirty_bitmap(ctx, XEN_DOMCTL_SHADOW_OP_CLEAN,
+                          XEN_DOMCTL_SHADOW_LOGDIRTY_FINAL, &stats);
+    if ( rc )
         goto out;
-    }
 
     if ( ctx->save.live )
     {
@@ -693,6 +1980,82 @@ static int suspend_and_send_dirty(struct xc_sr_context *ctx)
     return rc;
 }
 
+/* Number of pfns carried by each POSTCOPY_PFNS record. */
+#define POSTCOPY_PFNS_PER_RECORD 8192
+
+/*
+ * Suspend the domain and, rather than sending the pages still dirty, list
+ * them for the restorer to fetch on demand once the domain is running there.
+ * On return, deferred_pages holds the pfns still to be sent.
+ */
+static int suspend_and_send_postcopy_pfns(struct xc_sr_context *ctx)
+{
+    xc_interface *xch = ctx->xch;
+    xc_shadow_op_stats_t stats = { 0, ctx->save.p2m_size };
+    struct xc_sr_record rec = { .type = REC_TYPE_POSTCOPY_PFNS };
+    uint64_t *pfns = NULL;
+    unsigned int nr = 0;
+    xen_pfn_t p;
+    int rc;
+    DECLARE_HYPERCALL_BUFFER_SHADOW(unsigned long, dirty_bitmap,
+                                    &ctx->save.dirty_bitmap_hbuf);
+
+    rc = suspend_domain(ctx);
+    if ( rc )
+        goto out;
+
+    rc = get_dirty_bitmap(ctx, XEN_DOMCTL_SHADOW_OP_CLEAN,
+                          XEN_DOMCTL_SHADOW_LOGDIRTY_FINAL, &stats);
+    if ( rc )
+        goto out;
+
+    bitmap_or(ctx->save.deferred_pages, dirty_bitmap, ctx->save.p2m_size);
+    ctx->save.nr_deferred_pages = 0;
+
+    pfns = malloc(POSTCOPY_PFNS_PER_RECORD * sizeof(*pfns));
+    if ( !pfns )
+    {
+        ERROR("Unable to allocate post-copy pfn list");
+        rc = -1;
+        goto out;
+    }
+
+    rec.data = pfns;
+
+    for ( p = 0; p < ctx->save.p2m_size; ++p )
+    {
+        if ( !test_bit(p, ctx->save.deferred_pages) )
+            continue;
+
+        pfns[nr++] = p;
+        ++ctx->save.postcopy_stats.pfns;
+
+        if ( nr == POSTCOPY_PFNS_PER_RECORD )
+        {
+            rec.length = nr * sizeof(*pfns);
+            rc = write_record(ctx, &rec);
+            if ( rc )
+                goto out;
+            nr = 0;
+        }
+    }
+
+    if ( nr )
+    {
+        rec.length = nr * sizeof(*pfns);
+        rc = write_record(ctx, &rec);
+        if ( rc )
+            goto out;
+    }
+
+    DPRINTF("%"PRIu64" pfns left for post-copy",
+            ctx->save.postcopy_stats.pfns);
+
+ out:
+    free(pfns);
+    return rc;
+}
+
 static int verify_frames(struct xc_sr_context *ctx)
 {
     xc_interface *xch = ctx->xch;
@@ -702,6 +2065,10 @@ static int verify_frames(struct xc_sr_context *ctx)
 
     DPRINTF("Enabling verify mode");
 
+    /* The restorer can only verify pages which are actually sent. */
+    free(ctx->save.page_hashes);
+    ctx->save.page_hashes = NULL;
+
     rc = write_record(ctx, &rec);
     if ( rc )
         goto out;
@@ -743,6 +2110,13 @@ static int send_domain_memory_live(struct xc_sr_context *ctx)
     if ( rc )
         goto out;
 
+    if ( ctx->save.postcopy_active )
+    {
+        /* Verification can't follow pages which haven't been sent yet. */
+        rc = suspend_and_send_postcopy_pfns(ctx);
+        goto out;
+    }
+
     rc = suspend_and_send_dirty(ctx);
     if ( rc )
         goto out;
@@ -795,6 +2169,8 @@ static int setup(struct xc_sr_context *ctx)
     int rc;
     DECLARE_HYPERCALL_BUFFER_SHADOW(unsigned long, dirty_bitmap,
                                     &ctx->save.dirty_bitmap_hbuf);
+    DECLARE_HYPERCALL_BUFFER_SHADOW(uint64_t, dirty_pfns,
+                                    &ctx->save.dirty_pfns_hbuf);
 
     rc = ctx->save.ops.setup(ctx);
     if ( rc )
@@ -802,31 +2178,229 @@ static int setup(struct xc_sr_context *ctx)
 
     dirty_bitmap = xc_hypercall_buffer_alloc_pages(
         xch, dirty_bitmap, NRPAGES(bitmap_size(ctx->save.p2m_size)));
-    ctx->save.batch_pfns = malloc(MAX_BATCH_SIZE *
-                                  sizeof(*ctx->save.batch_pfns));
+    dirty_pfns = xc_hypercall_buffer_alloc_pages(
+        xch, dirty_pfns, NRPAGES(DIRTY_PFN_LIST_SIZE * sizeof(*dirty_pfns)));
     ctx->save.deferred_pages = bitmap_alloc(ctx->save.p2m_size);
+    ctx->save.last_dirty_count = ctx->save.p2m_size;
 
-    if ( !ctx->save.batch_pfns || !dirty_bitmap || !ctx->save.deferred_pages )
+    if ( !dirty_bitmap || !dirty_pfns || !ctx->save.deferred_pages )
     {
-        ERROR("Unable to allocate memory for dirty bitmaps, batch pfns and"
-              " deferred pages");
+        ERROR("Unable to allocate memory for dirty bitmaps and deferred pages");
         rc = -1;
         errno = ENOMEM;
         goto err;
     }
 
-    rc = 0;
+    if ( ctx->save.elide_unchanged )
+    {
+        ctx->save.page_hashes = calloc(ctx->save.p2m_size,
+                                       sizeof(*ctx->save.page_hashes));
+        if ( !ctx->save.page_hashes )
+        {
+            ERROR("Unable to allocate memory for page hashes");
+            rc = -1;
+            errno = ENOMEM;
+            goto err;
+        }
+    }
+
+    if ( ctx->save.nr_stripe_fds )
+    {
+        ctx->save.stripes = setup_stripes(ctx, ctx->save.stripe_fds,
+                                          ctx->save.nr_stripe_fds, true);
+        if ( !ctx->save.stripes )
+        {
+            rc = -1;
+            errno = ENOMEM;
+            goto err;
+        }
+    }
+
+    rc = setup_pipeline(ctx);
+    if ( rc )
+    {
+        errno = ENOMEM;
+        goto err;
+    }
 
  err:
     return rc;
 }
 
+/*
+ * Send the pages requested in a POSTCOPY_FAULT record ahead of the rest.
+ * Pfns already sent, or never outstanding, are ignored.
+ */
+static int handle_postcopy_fault(struct xc_sr_context *ctx,
+                                 struct xc_sr_record *rec,
+                                 unsigned long *remaining)
+{
+    xc_interface *xch = ctx->xch;
+    const uint64_t *pfns = rec->data;
+    unsigned int i, nr = rec->length / sizeof(*pfns);
+    int rc;
+
+    if ( rec->type != REC_TYPE_POSTCOPY_FAULT )
+    {
+        ERROR("Unexpected %s record during post-copy",
+              rec_type_to_str(rec->type));
+        return -1;
+    }
+
+    if ( rec->length % sizeof(*pfns) )
+    {
+        ERROR("POSTCOPY_FAULT record length %u not a multiple of %zu",
+              rec->length, sizeof(*pfns));
+        return -1;
+    }
+
+    for ( i = 0; i < nr; ++i )
+    {
+        ++ctx->save.postcopy_stats.faults;
+
+        if ( pfns[i] >= ctx->save.p2m_size ||
+             !test_and_clear_bit(pfns[i], ctx->save.deferred_pages) )
+            continue;
+
+        rc = add_to_batch(ctx, pfns[i]);
+        if ( rc )
+            return rc;
+
+        ++ctx->save.postcopy_stats.fault_pages;
+        --*remaining;
+    }
+
+    /* Don't hold the faulting vcpus up waiting for a full batch. */
+    return push_batch(ctx);
+}
+
+/*
+ * Send the pages left outstanding by suspend_and_send_postcopy_pfns(), while
+ * the domain runs on the restore side.  Pages are pushed in pfn order, but
+ * any which the restorer reports a fault on are sent first.
+ */
+static int send_memory_postcopy(struct xc_sr_context *ctx)
+{
+    xc_interface *xch = ctx->xch;
+    struct xc_sr_record rec = { .type = REC_TYPE_POSTCOPY_TRANSITION };
+    struct pollfd pfd = { .fd = ctx->save.recv_fd, .events = POLLIN };
+    unsigned long remaining = ctx->save.postcopy_stats.pfns;
+    xen_pfn_t cursor = 0;
+    unsigned int nr;
+    int rc;
+
+    /*
+     * The restorer drops its copy of every outstanding page, so none may be
+     * elided as unchanged.  The pipeline is idle at this point.
+     */
+    free(ctx->save.page_hashes);
+    ctx->save.page_hashes = NULL;
+
+    rc = write_record(ctx, &rec);
+    if ( rc )
+        return rc;
+
+    xc_set_progress_prefix(xch, "Post-copy");
+
+    while ( remaining )
+    {
+        rc = poll(&pfd, 1, 0);
+        if ( rc < 0 )
+        {
+            if ( errno == EINTR )
+                continue;
+
+            PERROR("Failed to poll for post-copy faults");
+            goto out;
+        }
+
+        if ( rc > 0 )
+        {
+            rc = read_record(ctx, ctx->save.recv_fd, &rec);
+            if ( rc )
+                goto out;
+
+            rc = handle_postcopy_fault(ctx, &rec, &remaining);
+            free(rec.data);
+            if ( rc )
+                goto out;
+
+            continue;
+        }
+
+        /*
+         * Outstanding pfns behind the cursor have all been sent, as faults
+         * only ever clear bits.
+         */
+        for ( nr = 0; nr < MAX_BATCH_SIZE && remaining; ++cursor )
+        {
+            if ( !test_and_clear_bit(cursor, ctx->save.deferred_pages) )
+                continue;
+
+            rc = add_to_batch(ctx, cursor);
+            if ( rc )
+                goto out;
+
+            ++nr;
+            --remaining;
+        }
+
+        rc = push_batch(ctx);
+        if ( rc )
+            goto out;
+
+        xc_report_progress_step(xch, ctx->save.postcopy_stats.pfns - remaining,
+                                ctx->save.postcopy_stats.pfns);
+    }
+
+    rc = flush_batch(ctx);
+
+ out:
+    xc_set_progress_prefix(xch, NULL);
+    return rc;
+}
+
+/*
+ * Wait for the restorer to confirm that every page arrived.  Faults on pages
+ * already in flight may still turn up beforehand.
+ */
+static int wait_postcopy_end(struct xc_sr_context *ctx)
+{
+    xc_interface *xch = ctx->xch;
+    struct xc_sr_record rec;
+    int rc;
+
+    for ( ; ; )
+    {
+        rc = read_record(ctx, ctx->save.recv_fd, &rec);
+        if ( rc )
+            return rc;
+
+        free(rec.data);
+
+        if ( rec.type == REC_TYPE_END )
+            return 0;
+
+        if ( rec.type != REC_TYPE_POSTCOPY_FAULT )
+        {
+            ERROR("Unexpected %s record during post-copy",
+                  rec_type_to_str(rec.type));
+            return -1;
+        }
+    }
+}
+
 static void cleanup(struct xc_sr_context *ctx)
 {
     xc_interface *xch = ctx->xch;
     DECLARE_HYPERCALL_BUFFER_SHADOW(unsigned long, dirty_bitmap,
                                     &ctx->save.dirty_bitmap_hbuf);
+    DECLARE_HYPERCALL_BUFFER_SHADOW(uint64_t, dirty_pfns,
+                                    &ctx->save.dirty_pfns_hbuf);
 
+    teardown_pipeline(ctx);
+    teardown_stripes(ctx->save.stripes);
+    unthrottle_domain(ctx);
 
     xc_shadow_control(xch, ctx->domid, XEN_DOMCTL_SHADOW_OP_OFF,
                       NULL, 0);
@@ -836,8 +2410,95 @@ static void cleanup(struct xc_sr_context *ctx)
 
     xc_hypercall_buffer_free_pages(xch, dirty_bitmap,
                                    NRPAGES(bitmap_size(ctx->save.p2m_size)));
+    xc_hypercall_buffer_free_pages(
+        xch, dirty_pfns, NRPAGES(DIRTY_PFN_LIST_SIZE * sizeof(*dirty_pfns)));
     free(ctx->save.deferred_pages);
-    free(ctx->save.batch_pfns);
+    free(ctx->save.page_hashes);
+}
+
+/*
+ * Log how well page compression worked for the stream.
+ */
+static void report_compression(struct xc_sr_context *ctx)
+{
+    xc_interface *xch = ctx->xch;
+    const struct xc_sr_compress_stats *stats = &ctx->save.compress_stats;
+    uint64_t ratio;
+
+    if ( !ctx->save.compression || !stats->pages )
+        return;
+
+    /* Percentage of the uncompressed size, to two decimal places. */
+    ratio = stats->bytes * 10000 / (stats->pages * PAGE_SIZE);
+
+    IPRINTF("Page compression (%s): %"PRIu64" pages sent in %"PRIu64
+            " bytes, %"PRIu64".%02"PRIu64"%% of their size",
+            compress_alg_to_str(ctx->save.compression), stats->pages,
+            stats->bytes, ratio / 100, ratio % 100);
+    IPRINTF("  %"PRIu64" pages, and %"PRIu64" of %"PRIu64
+            " batches, sent uncompressed", stats->raw_pages,
+            stats->raw_batches, stats->batches);
+}
+
+/*
+ * Log how many pages were left out of the page data records.
+ */
+static void report_elision(struct xc_sr_context *ctx)
+{
+    xc_interface *xch = ctx->xch;
+    const struct xc_sr_elide_stats *stats = &ctx->save.elide_stats;
+
+    if ( !stats->zero_pages && !stats->unchanged_pages )
+        return;
+
+    IPRINTF("Elided page data: %"PRIu64" zero pages, %"PRIu64
+            " pages unchanged since last sent",
+            stats->zero_pages, stats->unchanged_pages);
+}
+
+/*
+ * Log how much memory was left to be fetched after the domain moved.
+ */
+static void report_postcopy(struct xc_sr_context *ctx)
+{
+    xc_interface *xch = ctx->xch;
+    const struct xc_sr_postcopy_stats *stats = &ctx->save.postcopy_stats;
+
+    if ( !ctx->save.postcopy_active )
+        return;
+
+    IPRINTF("Post-copy: %"PRIu64" pages sent after the switch, %"PRIu64
+            " of them on demand for %"PRIu64" faults",
+            stats->pfns, stats->fault_pages, stats->faults);
+}
+
+/*
+ * Log how much the adaptive precopy policy had to slow the domain down.
+ */
+static void report_throttling(struct xc_sr_context *ctx)
+{
+    xc_interface *xch = ctx->xch;
+    const struct xc_sr_adaptive_precopy *ap = &ctx->save.adaptive;
+
+    if ( !ap->throttle_steps )
+        return;
+
+    IPRINTF("Adaptive precopy: domain capped %u times, finally at %u%%",
+            ap->throttle_steps, ap->cap);
+}
+
+/*
+ * Log how the page data was spread over the further streams.
+ */
+static void report_striping(struct xc_sr_context *ctx)
+{
+    xc_interface *xch = ctx->xch;
+
+    if ( !ctx->save.stripes )
+        return;
+
+    IPRINTF("Page data striped over %u further streams in %"PRIu64" chunks",
+            ctx->save.nr_stripe_fds, ctx->save.stripe_seq);
 }
 
 /*
@@ -952,12 +2613,39 @@ static int save(struct xc_sr_context *ctx, uint16_t guest_type)
         }
     } while ( ctx->stream_type != XC_STREAM_PLAIN );
 
+    if ( ctx->save.postcopy_active )
+    {
+        rc = send_memory_postcopy(ctx);
+        if ( rc )
+            goto err;
+    }
+
+    report_compression(ctx);
+    report_elision(ctx);
+    report_postcopy(ctx);
+    report_throttling(ctx);
+    report_striping(ctx);
+
     xc_report_progress_single(xch, "End of stream");
 
+    if ( ctx->save.stripes )
+    {
+        rc = finish_stripes(ctx->save.stripes);
+        if ( rc )
+            goto err;
+    }
+
     rc = write_end_record(ctx);
     if ( rc )
         goto err;
 
+    if ( ctx->save.postcopy_active )
+    {
+        rc = wait_postcopy_end(ctx);
+        if ( rc )
+            goto err;
+    }
+
     xc_report_progress_single(xch, "Complete");
     goto done;
 
@@ -994,6 +2682,44 @@ int xc_domain_save(xc_interface *xch, int io_fd, uint32_t dom,
     ctx.save.live  = !!(flags & XCFLAGS_LIVE);
     ctx.save.debug = !!(flags & XCFLAGS_DEBUG);
     ctx.save.recv_fd = recv_fd;
+    ctx.save.postcopy = !!(flags & XCFLAGS_POSTCOPY);
+    ctx.save.adaptive_precopy = !!(flags & XCFLAGS_ADAPTIVE_PRECOPY);
+    ctx.save.adaptive.max_downtime_ms =
+        callbacks->max_downtime_ms ?: APP_DEFAULT_DOWNTIME_MS;
+
+    if ( flags & XCFLAGS_COMPRESS_ZSTD )
+        ctx.save.compression = COMPRESSED_PAGE_DATA_ALG_ZSTD;
+    else if ( flags & XCFLAGS_COMPRESS_LZ4 )
+        ctx.save.compression = COMPRESSED_PAGE_DATA_ALG_LZ4;
+
+    /*
+     * With COLO, the secondary runs and changes its copy of memory behind
+     * our back.
+     */
+    ctx.save.elide_unchanged = (flags & XCFLAGS_ELIDE_UNCHANGED) &&
+        stream_type != XC_STREAM_COLO;
+
+    if ( callbacks->nr_stripe_fds )
+    {
+        if ( stream_type != XC_STREAM_PLAIN )
+        {
+            ERROR("Page data can't be striped over a checkpointed stream");
+            errno = EINVAL;
+            return -1;
+        }
+
+        ctx.save.stripe_fds = callbacks->stripe_fds;
+        ctx.save.nr_stripe_fds = callbacks->nr_stripe_fds;
+    }
+
+    if ( ctx.save.compression &&
+         !compress_alg_supported(ctx.save.compression) )
+    {
+        ERROR("Page compression with %s not supported by this build",
+              compress_alg_to_str(ctx.save.compression));
+        errno = EOPNOTSUPP;
+        return -1;
+    }
 
     if ( xc_domain_getinfo_single(xch, dom, &ctx.dominfo) < 0 )
     {
@@ -1002,6 +2728,17 @@ int xc_domain_save(xc_interface *xch, int io_fd, uint32_t dom,
     }
 
     hvm = ctx.dominfo.flags & XEN_DOMINF_hvm_guest;
+    ctx.save.adaptive.nr_vcpus = ctx.dominfo.max_vcpu_id + 1;
+
+    if ( ctx.save.postcopy &&
+         (!hvm || !ctx.save.live || stream_type != XC_STREAM_PLAIN ||
+          recv_fd < 0) )
+    {
+        ERROR("Post-copy needs a live, plain stream of an HVM domain, "
+              "and a back channel");
+        errno = EINVAL;
+        return -1;
+    }
 
     /* Sanity check stream_type-related parameters */
     switch ( stream_type )
@@ -76,6 +76,12 @@ struct xc_sr_rhdr
 #define REC_TYPE_STATIC_DATA_END            0x00000010U
 #define REC_TYPE_X86_CPUID_POLICY           0x00000011U
 #define REC_TYPE_X86_MSR_POLICY             0x00000012U
+#define REC_TYPE_COMPRESSED_PAGE_DATA       0x00000013U
+#define REC_TYPE_ELIDED_PAGE_DATA           0x00000014U
+#define REC_TYPE_POSTCOPY_PFNS              0x00000015U
+#define REC_TYPE_POSTCOPY_TRANSITION        0x00000016U
+#define REC_TYPE_POSTCOPY_FAULT             0x00000017U
+#define REC_TYPE_STRIPED_DATA               0x00000018U
 
 #define REC_TYPE_OPTIONAL             0x80000000U
 
@@ -90,6 +96,36 @@ struct xc_sr_rec_page_data_header
 #define PAGE_DATA_PFN_MASK  0x000fffffffffffffULL
 #define PAGE_DATA_TYPE_MASK 0xf000000000000000ULL
 
+/* COMPRESSED_PAGE_DATA */
+struct xc_sr_rec_compressed_page_data_header
+{
+    uint32_t count;
+    uint32_t algorithm;
+    uint64_t pfn[0];
+};
+
+#define COMPRESSED_PAGE_DATA_ALG_LZ4  0x00000001U
+#define COMPRESSED_PAGE_DATA_ALG_ZSTD 0x00000002U
+
+/* ELIDED_PAGE_DATA */
+struct xc_sr_rec_elided_page_data_header
+{
+    uint32_t count;
+    uint32_t reason;
+    uint64_t pfn[0];
+};
+
+#define ELIDED_PAGE_DATA_ZERO      0x00000001U
+#define ELIDED_PAGE_DATA_UNCHANGED 0x00000002U
+
+/* STRIPED_DATA */
+struct xc_sr_rec_striped_data
+{
+    uint32_t stream;
+    uint32_t count;
+    uint64_t seq;
+};
+
 /* X86_PV_INFO */
 struct xc_sr_rec_x86_pv_info
 {
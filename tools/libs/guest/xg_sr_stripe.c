@@ -0,0 +1,654 @@
+/*
+ * Striping of page data over further streams.
+ *
+ * Batches of page data are sent as chunks, round robin over the further
+ * streams, each chunk standing in the main stream as a STRIPED_DATA record.
+ * Every further stream has a thread of its own, so the streams make progress
+ * independently of each other and of the main stream.  When saving, chunks
+ * are copied into a short queue for the thread to write out.  When
+ * restoring, the thread reads chunks ahead into a short queue, for
+ * handle_striped_data() to take in the order of the main stream.
+ *
+ * The STRIPED_DATA record goes into the main stream before its chunk goes
+ * into the further stream, so a restorer waiting for a chunk never holds up
+ * the saver.  Each further stream ends with an END record, written before
+ * the END record of the main stream.
+ *
+ * Without threads, chunks are written and read synchronously instead.
+ */
+
+#include <assert.h>
+#include <pthread.h>
+
+#include "xg_sr_common.h"
+
+/* Chunks queued per stream.  A chunk holds at most one batch of pages. */
+#define STRIPE_QUEUE_LEN 4
+
+/* More records than a saver has any reason to put into one chunk. */
+#define STRIPE_MAX_RECORDS 64
+
+struct xc_sr_stripe_chunk
+{
+    /* Saving: the chunk, ready to write. */
+    void *buf;
+    size_t len;
+
+    /* Restoring: the STRIPED_DATA record heading the chunk, and the rest. */
+    struct xc_sr_rec_striped_data hdr;
+    struct xc_sr_record *recs;
+    unsigned int nr_recs;
+};
+
+struct xc_sr_stripe
+{
+    struct xc_sr_stripes *stripes;
+    int fd;
+
+    pthread_t thread;
+    bool started;
+    /* Whether the thread is blocked on fd, and may be cancelled. */
+    bool in_io;
+
+    /* Chunks [cons, prod) are queued. */
+    struct xc_sr_stripe_chunk queue[STRIPE_QUEUE_LEN];
+    unsigned int prod, cons;
+
+    /* Restoring: the chunk being read, and whether END has been read. */
+    struct xc_sr_stripe_chunk partial;
+    bool ended;
+};
+
+struct xc_sr_stripes
+{
+    struct xc_sr_context *ctx;
+    bool save;
+    bool threaded;
+
+    pthread_mutex_t lock;
+    pthread_cond_t cond;
+    bool stop;
+
+    /* First failure of any stream, and the errno to go with it. */
+    int rc, err;
+
+    unsigned int nr;
+    struct xc_sr_stripe stripe[];
+};
+
+static void free_chunk(struct xc_sr_stripe_chunk *c)
+{
+    unsigned int i;
+
+    free(c->buf);
+    c->buf = NULL;
+
+    for ( i = 0; i < c->nr_recs; ++i )
+        free(c->recs[i].data);
+    free(c->recs);
+    c->recs = NULL;
+    c->nr_recs = 0;
+}
+
+/*
+ * Read or write a stream from its thread.  The thread may be cancelled while
+ * blocked here, and only here, when the migration is being abandoned.
+ */
+static int stripe_io(struct xc_sr_stripe *st, void *buf, size_t len)
+{
+    struct xc_sr_stripes *s = st->stripes;
+    int rc, err;
+
+    if ( !s->threaded )
+        return s->save ? write_exact(st->fd, buf, len)
+                       : read_exact(st->fd, buf, len);
+
+    pthread_mutex_lock(&s->lock);
+    st->in_io = true;
+    pthread_mutex_unlock(&s->lock);
+
+    pthread_setcancelstate(PTHREAD_CANCEL_ENABLE, NULL);
+    rc = s->save ? write_exact(st->fd, buf, len)
+                 : read_exact(st->fd, buf, len);
+    err = errno;
+    pthread_setcancelstate(PTHREAD_CANCEL_DISABLE, NULL);
+
+    pthread_mutex_lock(&s->lock);
+    st->in_io = false;
+    pthread_mutex_unlock(&s->lock);
+
+    errno = err;
+
+    return rc;
+}
+
+/* Record the first failure of a stream.  Called with the lock held. */
+static void stripe_set_error(struct xc_sr_stripes *s, int err)
+{
+    if ( s->rc )
+        return;
+
+    s->rc = -1;
+    s->err = err;
+}
+
+/*
+ * Read a record of a chunk into partial.  Returns 1 for an END record at the
+ * start of a chunk, which marks the end of the stream.
+ */
+static int read_stripe_record(struct xc_sr_stripe *st)
+{
+    struct xc_sr_context *ctx = st->stripes->ctx;
+    xc_interface *xch = ctx->xch;
+    struct xc_sr_stripe_chunk *c = &st->partial;
+    unsigned int idx = st - st->stripes->stripe + 1;
+    struct xc_sr_record *rec;
+    struct xc_sr_rhdr rhdr;
+    size_t datasz;
+
+    if ( stripe_io(st, &rhdr, sizeof(rhdr)) )
+    {
+        PERROR("Failed to read record header from stream %u", idx);
+        return -1;
+    }
+
+    if ( !c->recs )
+    {
+        if ( rhdr.type == REC_TYPE_END && !rhdr.length )
+            return 1;
+
+        if ( rhdr.type != REC_TYPE_STRIPED_DATA ||
+             rhdr.length != sizeof(c->hdr) )
+        {
+            ERROR("Expected STRIPED_DATA record on stream %u, got %s, "
+                  "length %u", idx, rec_type_to_str(rhdr.type), rhdr.length);
+            return -1;
+        }
+
+        if ( stripe_io(st, &c->hdr, sizeof(c->hdr)) )
+        {
+            PERROR("Failed to read STRIPED_DATA record from stream %u", idx);
+            return -1;
+        }
+
+        if ( c->hdr.count < 1 || c->hdr.count > STRIPE_MAX_RECORDS )
+        {
+            ERROR("Chunk %"PRIu64" on stream %u has %u records",
+                  c->hdr.seq, idx, c->hdr.count);
+            return -1;
+        }
+
+        c->recs = calloc(c->hdr.count, sizeof(*c->recs));
+        if ( !c->recs )
+        {
+            ERROR("Unable to allocate %u records", c->hdr.count);
+            return -1;
+        }
+
+        return 0;
+    }
+
+    if ( rhdr.length > REC_LENGTH_MAX )
+    {
+        ERROR("Record (0x%08x, %s) length %#x exceeds max (%#x)", rhdr.type,
+              rec_type_to_str(rhdr.type), rhdr.length, REC_LENGTH_MAX);
+        return -1;
+    }
+
+    rec = &c->recs[c->nr_recs];
+    datasz = ROUNDUP(rhdr.length, REC_ALIGN_ORDER);
+
+    if ( datasz )
+    {
+        rec->data = malloc(datasz);
+        if ( !rec->data )
+        {
+            ERROR("Unable to allocate %zu bytes for record data (0x%08x, %s)",
+                  datasz, rhdr.type, rec_type_to_str(rhdr.type));
+            return -1;
+        }
+
+        /* Count it first, so it is freed if the read is cancelled. */
+        c->nr_recs++;
+
+        if ( stripe_io(st, rec->data, datasz) )
+        {
+            PERROR("Failed to read %zu bytes of data for record (0x%08x, %s) "
+                   "from stream %u", datasz, rhdr.type,
+                   rec_type_to_str(rhdr.type), idx);
+            return -1;
+        }
+    }
+    else
+    {
+        rec->data = NULL;
+        c->nr_recs++;
+    }
+
+    rec->type = rhdr.type;
+    rec->length = rhdr.length;
+
+    return 0;
+}
+
+/*
+ * Read the next chunk of a stream into partial.  Returns 1 at the end of the
+ * stream.
+ */
+static int read_stripe_chunk(struct xc_sr_stripe *st)
+{
+    int rc;
+
+    rc = read_stripe_record(st);
+    while ( !rc && st->partial.nr_recs < st->partial.hdr.count )
+        rc = read_stripe_record(st);
+
+    return rc;
+}
+
+/*
+ * Thread of a further stream being written.  Writes out queued chunks, until
+ * told to stop with none left.
+ */
+static void *stripe_writer(void *arg)
+{
+    struct xc_sr_stripe *st = arg;
+    struct xc_sr_stripes *s = st->stripes;
+    xc_interface *xch = s->ctx->xch;
+    struct xc_sr_stripe_chunk *c;
+    unsigned int idx = st - s->stripe + 1;
+    bool skip;
+    int rc, err;
+
+    pthread_setcancelstate(PTHREAD_CANCEL_DISABLE, NULL);
+
+    pthread_mutex_lock(&s->lock);
+    for ( ; ; )
+    {
+        while ( !s->stop && st->cons == st->prod )
+            pthread_cond_wait(&s->cond, &s->lock);
+
+        if ( st->cons == st->prod )
+            break;
+
+        c = &st->queue[st->cons % STRIPE_QUEUE_LEN];
+        /* Don't bother with further writes once a stream has failed. */
+        skip = s->rc;
+        pthread_mutex_unlock(&s->lock);
+
+        rc = skip ? 0 : stripe_io(st, c->buf, c->len);
+        err = errno;
+        if ( rc )
+            PERROR("Failed to write to stream %u", idx);
+        free_chunk(c);
+
+        pthread_mutex_lock(&s->lock);
+        if ( rc )
+            stripe_set_error(s, err);
+        st->cons++;
+        pthread_cond_broadcast(&s->cond);
+    }
+    pthread_mutex_unlock(&s->lock);
+
+    return NULL;
+}
+
+/*
+ * Thread of a further stream being read.  Reads chunks ahead into the queue,
+ * until the end of the stream or told to stop.
+ */
+static void *stripe_reader(void *arg)
+{
+    struct xc_sr_stripe *st = arg;
+    struct xc_sr_stripes *s = st->stripes;
+    int rc, err;
+
+    pthread_setcancelstate(PTHREAD_CANCEL_DISABLE, NULL);
+
+    pthread_mutex_lock(&s->lock);
+    for ( ; ; )
+    {
+        while ( !s->stop && st->prod - st->cons == STRIPE_QUEUE_LEN )
+            pthread_cond_wait(&s->cond, &s->lock);
+
+        if ( s->stop )
+            break;
+        pthread_mutex_unlock(&s->lock);
+
+        rc = read_stripe_chunk(st);
+        err = errno;
+
+        pthread_mutex_lock(&s->lock);
+        if ( rc < 0 )
+            stripe_set_error(s, err);
+        else if ( rc > 0 )
+            st->ended = true;
+        else
+        {
+            st->queue[st->prod++ % STRIPE_QUEUE_LEN] = st->partial;
+            memset(&st->partial, 0, sizeof(st->partial));
+        }
+        pthread_cond_broadcast(&s->cond);
+
+        if ( rc )
+            break;
+    }
+    pthread_mutex_unlock(&s->lock);
+
+    return NULL;
+}
+
+/*
+ * Stop the threads of the streams.  Any blocked on their stream are
+ * cancelled: the migration is over, one way or another.
+ */
+static void stop_stripe_threads(struct xc_sr_stripes *s)
+{
+    unsigned int i;
+
+    pthread_mutex_lock(&s->lock);
+    s->stop = true;
+    pthread_cond_broadcast(&s->cond);
+
+    for ( i = 0; i < s->nr; ++i )
+        if ( s->stripe[i].started && s->stripe[i].in_io )
+            pthread_cancel(s->stripe[i].thread);
+    pthread_mutex_unlock(&s->lock);
+
+    for ( i = 0; i < s->nr; ++i )
+    {
+        if ( s->stripe[i].started )
+            pthread_join(s->stripe[i].thread, NULL);
+        s->stripe[i].started = false;
+    }
+}
+
+struct xc_sr_stripes *setup_stripes(struct xc_sr_context *ctx,
+                                    const int *fds, unsigned int nr,
+                                    bool save)
+{
+    xc_interface *xch = ctx->xch;
+    struct xc_sr_stripes *s;
+    unsigned int i;
+    int rc;
+
+    s = calloc(1, sizeof(*s) + nr * sizeof(*s->stripe));
+    if ( !s )
+    {
+        ERROR("Unable to allocate state for %u further streams", nr);
+        return NULL;
+    }
+
+    s->ctx = ctx;
+    s->save = save;
+    s->nr = nr;
+
+    for ( i = 0; i < nr; ++i )
+    {
+        s->stripe[i].stripes = s;
+        s->stripe[i].fd = fds[i];
+    }
+
+    if ( xch->flags & XC_OPENFLAG_NON_REENTRANT )
+        goto sync;
+
+    pthread_mutex_init(&s->lock, NULL);
+    pthread_cond_init(&s->cond, NULL);
+    s->threaded = true;
+
+    for ( i = 0; i < nr; ++i )
+    {
+        rc = pthread_create(&s->stripe[i].thread, NULL,
+                            save ? stripe_writer : stripe_reader,
+                            &s->stripe[i]);
+        if ( rc )
+        {
+            errno = rc;
+            PERROR("Unable to create thread for stream %u", i + 1);
+            stop_stripe_threads(s);
+            pthread_cond_destroy(&s->cond);
+            pthread_mutex_destroy(&s->lock);
+            s->threaded = false;
+            s->stop = false;
+            goto sync;
+        }
+
+        s->stripe[i].started = true;
+    }
+
+    DPRINTF("Page data striped over %u further streams", nr);
+
+    return s;
+
+ sync:
+    IPRINTF("Page data striped over %u further streams, without threads",
+            nr);
+
+    return s;
+}
+
+void teardown_stripes(struct xc_sr_stripes *s)
+{
+    unsigned int i, j;
+
+    if ( !s )
+        return;
+
+    if ( s->threaded )
+    {
+        stop_stripe_threads(s);
+        pthread_cond_destroy(&s->cond);
+        pthread_mutex_destroy(&s->lock);
+    }
+
+    for ( i = 0; i < s->nr; ++i )
+    {
+        for ( j = 0; j < STRIPE_QUEUE_LEN; ++j )
+            free_chunk(&s->stripe[i].queue[j]);
+        free_chunk(&s->stripe[i].partial);
+    }
+
+    free(s);
+}
+
+/*
+ * Queue a chunk for a further stream, gathered from iov[] following its
+ * STRIPED_DATA record.  Fails if any stream has failed.
+ */
+static int queue_stripe_buf(struct xc_sr_stripes *s, unsigned int stream,
+                            void *buf, size_t len)
+{
+    struct xc_sr_context *ctx = s->ctx;
+    xc_interface *xch = ctx->xch;
+    struct xc_sr_stripe *st = &s->stripe[stream];
+    struct xc_sr_stripe_chunk *c;
+    int rc = 0;
+
+    if ( !s->threaded )
+    {
+        rc = write_exact(st->fd, buf, len);
+        if ( rc )
+            PERROR("Failed to write to stream %u", stream + 1);
+        free(buf);
+
+        return rc;
+    }
+
+    pthread_mutex_lock(&s->lock);
+
+    while ( !s->rc && st->prod - st->cons == STRIPE_QUEUE_LEN )
+        pthread_cond_wait(&s->cond, &s->lock);
+
+    if ( s->rc )
+    {
+        rc = s->rc;
+        errno = s->err;
+        free(buf);
+    }
+    else
+    {
+        c = &st->queue[st->prod++ % STRIPE_QUEUE_LEN];
+        c->buf = buf;
+        c->len = len;
+        pthread_cond_broadcast(&s->cond);
+    }
+
+    pthread_mutex_unlock(&s->lock);
+
+    return rc;
+}
+
+int write_striped_chunk(struct xc_sr_stripes *s,
+                        const struct xc_sr_rec_striped_data *hdr,
+                        const struct iovec *iov, int iovcnt)
+{
+    struct xc_sr_context *ctx = s->ctx;
+    xc_interface *xch = ctx->xch;
+    struct xc_sr_rhdr rhdr = {
+        .type = REC_TYPE_STRIPED_DATA,
+        .length = sizeof(*hdr),
+    };
+    size_t len = sizeof(rhdr) + sizeof(*hdr);
+    uint8_t *buf, *p;
+    int i;
+
+    assert(hdr->stream >= 1 && hdr->stream <= s->nr);
+
+    for ( i = 0; i < iovcnt; ++i )
+        len += iov[i].iov_len;
+
+    buf = malloc(len);
+    if ( !buf )
+    {
+        ERROR("Unable to allocate %zu bytes for chunk %"PRIu64,
+              len, hdr->seq);
+        return -1;
+    }
+
+    memcpy(buf, &rhdr, sizeof(rhdr));
+    memcpy(buf + sizeof(rhdr), hdr, sizeof(*hdr));
+    p = buf + sizeof(rhdr) + sizeof(*hdr);
+
+    for ( i = 0; i < iovcnt; ++i )
+    {
+        memcpy(p, iov[i].iov_base, iov[i].iov_len);
+        p += iov[i].iov_len;
+    }
+
+    return queue_stripe_buf(s, hdr->stream - 1, buf, len);
+}
+
+int finish_stripes(struct xc_sr_stripes *s)
+{
+    struct xc_sr_context *ctx = s->ctx;
+    xc_interface *xch = ctx->xch;
+    struct xc_sr_rhdr *end;
+    unsigned int i;
+    int rc = 0;
+
+    for ( i = 0; !rc && i < s->nr; ++i )
+    {
+        end = calloc(1, sizeof(*end));
+        if ( !end )
+        {
+            ERROR("Unable to allocate END record");
+            return -1;
+        }
+
+        end->type = REC_TYPE_END;
+        rc = queue_stripe_buf(s, i, end, sizeof(*end));
+    }
+
+    if ( rc || !s->threaded )
+        return rc;
+
+    pthread_mutex_lock(&s->lock);
+
+    for ( i = 0; !s->rc && i < s->nr; ++i )
+        while ( !s->rc && s->stripe[i].cons != s->stripe[i].prod )
+            pthread_cond_wait(&s->cond, &s->lock);
+
+    if ( s->rc )
+    {
+        rc = s->rc;
+        errno = s->err;
+    }
+
+    pthread_mutex_unlock(&s->lock);
+
+    /* Every thread is idle now, unless a stream failed. */
+    stop_stripe_threads(s);
+
+    return rc;
+}
+
+int take_striped_chunk(struct xc_sr_stripes *s, unsigned int stream,
+                       struct xc_sr_rec_striped_data *hdr,
+                       struct xc_sr_record **recs)
+{
+    struct xc_sr_context *ctx = s->ctx;
+    xc_interface *xch = ctx->xch;
+    struct xc_sr_stripe *st = &s->stripe[stream - 1];
+    struct xc_sr_stripe_chunk c, *q;
+    int rc = 0;
+
+    assert(stream >= 1 && stream <= s->nr);
+
+    if ( !s->threaded )
+    {
+        rc = read_stripe_chunk(st);
+        if ( rc > 0 )
+            st->ended = true;
+        if ( rc )
+            goto err;
+
+        c = st->partial;
+        memset(&st->partial, 0, sizeof(st->partial));
+        goto out;
+    }
+
+    pthread_mutex_lock(&s->lock);
+
+    while ( !s->rc && !st->ended && st->cons == st->prod )
+        pthread_cond_wait(&s->cond, &s->lock);
+
+    if ( st->cons != st->prod )
+    {
+        q = &st->queue[st->cons++ % STRIPE_QUEUE_LEN];
+        c = *q;
+        memset(q, 0, sizeof(*q));
+        pthread_cond_broadcast(&s->cond);
+    }
+    else
+    {
+        rc = -1;
+        if ( s->rc )
+            errno = s->err;
+    }
+
+    pthread_mutex_unlock(&s->lock);
+
+    if ( rc )
+        goto err;
+
+ out:
+    *hdr = c.hdr;
+    *recs = c.recs;
+
+    return 0;
+
+ err:
+    if ( st->ended )
+        ERROR("Stream %u ended before the chunk expected", stream);
+    return -1;
+}
+
+/*
+ * Local variables:
+ * mode: C
+ * c-file-style: "BSD"
+ * c-basic-offset: 4
+ * tab-width: 4
+ * indent-tabs-mode: nil
+ * End:
+ */
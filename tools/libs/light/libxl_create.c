@@ -2121,7 +2121,7 @@ static int do_domain_create(libxl_ctx *ctx, libxl_domain_config *d_config,
 {
     AO_CREATE(ctx, 0, ao_how);
     libxl__app_domain_create_state *cdcs;
-    int rc;
+    int i, rc;
 
     GCNEW(cdcs);
     cdcs->dcs.ao = ao;
@@ -2132,10 +2132,33 @@ static int do_domain_create(libxl_ctx *ctx, libxl_domain_config *d_config,
     cdcs->dcs.send_back_fd = send_back_fd;
     if (restore_fd >= 0) {
         cdcs->dcs.restore_params = *params;
+        for (i = 0; i < params->num_stripe_fds; i++) {
+            if (params->stripe_fds[i] <= 2) {
+                LOG(ERROR, "Stripe fd %d may not be stdin/out/err",
+                    params->stripe_fds[i]);
+                rc = ERROR_INVAL;
+                goto out_err;
+            }
+        }
         rc = libxl__fd_flags_modify_save(gc, cdcs->dcs.restore_fd,
                                          ~(O_NONBLOCK|O_NDELAY), 0,
                                          &cdcs->dcs.restore_fdfl);
         if (rc < 0) goto out_err;
+
+        GCNEW_ARRAY(cdcs->dcs.stripe_fdfls, params->num_stripe_fds);
+        for (i = 0; i < params->num_stripe_fds; i++) {
+            rc = libxl__fd_flags_modify_save(gc, params->stripe_fds[i],
+                                             ~(O_NONBLOCK|O_NDELAY), 0,
+                                             &cdcs->dcs.stripe_fdfls[i]);
+            if (rc < 0) {
+                while (i--)
+                    libxl__fd_flags_restore(gc, params->stripe_fds[i],
+                                            cdcs->dcs.stripe_fdfls[i]);
+                libxl__fd_flags_restore(gc, cdcs->dcs.restore_fd,
+                                        cdcs->dcs.restore_fdfl);
+                goto out_err;
+            }
+        }
     }
     cdcs->dcs.callback = domain_create_cb;
     cdcs->dcs.domid = INVALID_DOMID;
@@ -2338,7 +2361,7 @@ static void domain_create_cb(libxl__egc *egc,
                              int rc, uint32_t domid)
 {
     libxl__app_domain_create_state *cdcs = CONTAINER_OF(dcs, *cdcs, dcs);
-    int flrc;
+    int i, flrc;
     STATE_AO_GC(cdcs->dcs.ao);
 
     *cdcs->domid_out = domid;
@@ -2351,6 +2374,12 @@ static void domain_create_cb(libxl__egc *egc,
          * this one.
          */
         if (flrc && !rc) rc = flrc;
+
+        for (i = 0; i < dcs->restore_params.num_stripe_fds; i++) {
+            flrc = libxl__fd_flags_restore(gc,
+                    dcs->restore_params.stripe_fds[i], dcs->stripe_fdfls[i]);
+            if (flrc && !rc) rc = flrc;
+        }
     }
 
     libxl__ao_complete(egc, ao, rc);
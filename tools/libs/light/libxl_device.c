@@ -153,8 +153,10 @@ int libxl__device_generic_add(libxl__gc *gc, xs_transaction_t t,
     struct xs_permissions frontend_perms[2];
     struct xs_permissions ro_frontend_perms[2];
     struct xs_permissions backend_perms[2];
+    struct xs_batch *b = NULL;
     int create_transaction = t == XBT_NULL;
     int libxl_only = device->backend_kind == LIBXL__DEVICE_KIND_NONE;
+    bool ok;
     int rc;
 
     if (libxl_only) {
@@ -190,21 +192,32 @@ retry_transaction:
     rc = libxl__xs_rm_checked(gc, t, libxl_path);
     if (rc) goto out;
 
-    if (!libxl_only) {
-        rc = libxl__xs_write_checked(gc, t, GCSPRINTF("%s/frontend",libxl_path),
-                                     frontend_path);
-        if (rc) goto out;
-
-        rc = libxl__xs_write_checked(gc, t, GCSPRINTF("%s/backend",libxl_path),
-                                     backend_path);
-        if (rc) goto out;
-    }
-
+    /*
+     * Removing a path whose parent doesn't exist fails, so this can't be
+     * part of the batch below.
+     */
     if (fents || ro_fents) {
         if (!xs_rm(ctx->xsh, t, frontend_path) && errno != ENOENT)
             goto out;
-        if (!xs_mkdir(ctx->xsh, t, frontend_path))
+    }
+    if (bents && !libxl_only) {
+        if (!xs_rm(ctx->xsh, t, backend_path) && errno != ENOENT)
             goto out;
+    }
+
+    /* Everything else is sent to xenstored in one go. */
+    b = xs_batch_new(ctx->xsh, t);
+    if (!b) goto out;
+
+    if (!libxl_only) {
+        xs_batch_write(b, GCSPRINTF("%s/frontend", libxl_path),
+                       frontend_path, strlen(frontend_path));
+        xs_batch_write(b, GCSPRINTF("%s/backend", libxl_path),
+                       backend_path, strlen(backend_path));
+    }
+
+    if (fents || ro_fents) {
+        xs_batch_mkdir(b, frontend_path);
         /* Console 0 is a special case. It doesn't use the regular PV
          * state machine but also the frontend directory has
          * historically contained other information, such as the
@@ -212,42 +225,33 @@ retry_transaction:
          */
         if ((device->kind == LIBXL__DEVICE_KIND_CONSOLE && device->devid == 0) ||
             (device->kind == LIBXL__DEVICE_KIND_VUART)) {
-            if (!xs_set_permissions(ctx->xsh, t, frontend_path,
-                                    ro_frontend_perms, ARRAY_SIZE(ro_frontend_perms)))
-                goto out;
+            xs_batch_set_permissions(b, frontend_path, ro_frontend_perms,
+                                     ARRAY_SIZE(ro_frontend_perms));
         } else {
-            if (!xs_set_permissions(ctx->xsh, t, frontend_path,
-                                    frontend_perms, ARRAY_SIZE(frontend_perms)))
-                goto out;
-        }
-        if (!xs_write(ctx->xsh, t, GCSPRINTF("%s/backend", frontend_path),
-                      backend_path, strlen(backend_path)))
-            goto out;
-        if (fents) {
-            rc = libxl__xs_writev_perms(gc, t, frontend_path, fents,
-                                        frontend_perms, ARRAY_SIZE(frontend_perms));
-            if (rc) goto out;
-        }
-        if (ro_fents) {
-            rc = libxl__xs_writev_perms(gc, t, frontend_path, ro_fents,
-                                        ro_frontend_perms, ARRAY_SIZE(ro_frontend_perms));
-            if (rc) goto out;
+            xs_batch_set_permissions(b, frontend_path, frontend_perms,
+                                     ARRAY_SIZE(frontend_perms));
         }
+        xs_batch_write(b, GCSPRINTF("%s/backend", frontend_path),
+                       backend_path, strlen(backend_path));
+        rc = libxl__xs_batch_writev_perms(gc, b, frontend_path, fents,
+                                          frontend_perms,
+                                          ARRAY_SIZE(frontend_perms));
+        if (rc) goto out;
+        rc = libxl__xs_batch_writev_perms(gc, b, frontend_path, ro_fents,
+                                          ro_frontend_perms,
+                                          ARRAY_SIZE(ro_frontend_perms));
+        if (rc) goto out;
     }
 
     if (bents) {
         if (!libxl_only) {
-            if (!xs_rm(ctx->xsh, t, backend_path) && errno != ENOENT)
-                goto out;
-            if (!xs_mkdir(ctx->xsh, t, backend_path))
-                goto out;
-            if (!xs_set_permissions(ctx->xsh, t, backend_path, backend_perms,
-                                    ARRAY_SIZE(backend_perms)))
-                goto out;
-            if (!xs_write(ctx->xsh, t, GCSPRINTF("%s/frontend", backend_path),
-                          frontend_path, strlen(frontend_path)))
-                goto out;
-            rc = libxl__xs_writev(gc, t, backend_path, bents);
+            xs_batch_mkdir(b, backend_path);
+            xs_batch_set_permissions(b, backend_path, backend_perms,
+                                     ARRAY_SIZE(backend_perms));
+            xs_batch_write(b, GCSPRINTF("%s/frontend", backend_path),
+                           frontend_path, strlen(frontend_path));
+            rc = libxl__xs_batch_writev_perms(gc, b, backend_path, bents,
+                                              NULL, 0);
             if (rc) goto out;
         }
 
@@ -274,10 +278,14 @@ retry_transaction:
          * This duplication is superfluous and messy but as discussed
          * the proper fix is more intrusive than we want to do now.
          */
-        rc = libxl__xs_writev(gc, t, libxl_path, bents);
+        rc = libxl__xs_batch_writev_perms(gc, b, libxl_path, bents, NULL, 0);
         if (rc) goto out;
     }
 
+    ok = xs_batch_commit(b);
+    b = NULL;
+    if (!ok) goto out;
+
     if (!create_transaction)
         return 0;
 
@@ -292,6 +300,7 @@ retry_transaction:
     return 0;
 
  out:
+    xs_batch_free(b);
     if (create_transaction && t)
         libxl__xs_transaction_abort(gc, &t);
     return rc != 0 ? rc : ERROR_FAIL;
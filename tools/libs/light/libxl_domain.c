@@ -492,21 +492,28 @@ static void domain_suspend_cb(libxl__egc *egc,
                               libxl__domain_save_state *dss, int rc)
 {
     STATE_AO_GC(dss->ao);
-    int flrc;
+    int i, flrc;
 
     flrc = libxl__fd_flags_restore(gc, dss->fd, dss->fdfl);
     /* If suspend has failed already then report that error not this one. */
     if (flrc && !rc) rc = flrc;
 
+    for (i = 0; i < dss->num_stripe_fds; i++) {
+        flrc = libxl__fd_flags_restore(gc, dss->stripe_fds[i],
+                                       dss->stripe_fdfls[i]);
+        if (flrc && !rc) rc = flrc;
+    }
+
     libxl__ao_complete(egc,ao,rc);
 
 }
 
-int libxl_domain_suspend(libxl_ctx *ctx, uint32_t domid, int fd, int flags,
-                         const libxl_asyncop_how *ao_how)
+static int do_domain_suspend(libxl_ctx *ctx, uint32_t domid, int fd,
+                             const int *stripe_fds, int num_stripe_fds,
+                             int flags, const libxl_asyncop_how *ao_how)
 {
     AO_CREATE(ctx, domid, ao_how);
-    int rc;
+    int i, rc;
 
     libxl_domain_type type = libxl__domain_type(gc, domid);
     if (type == LIBXL_DOMAIN_TYPE_INVALID) {
@@ -514,6 +521,15 @@ int libxl_domain_suspend(libxl_ctx *ctx, uint32_t domid, int fd, int flags,
         goto out_err;
     }
 
+    for (i = 0; i < num_stripe_fds; i++) {
+        if (stripe_fds[i] <= 2) {
+            LOGD(ERROR, domid, "Stripe fd %d may not be stdin/out/err",
+                 stripe_fds[i]);
+            rc = ERROR_INVAL;
+            goto out_err;
+        }
+    }
+
     libxl__domain_save_state *dss;
     GCNEW(dss);
 
@@ -525,6 +541,7 @@ int libxl_domain_suspend(libxl_ctx *ctx, uint32_t domid, int fd, int flags,
     dss->type = type;
     dss->live = flags & LIBXL_SUSPEND_LIVE;
     dss->debug = flags & LIBXL_SUSPEND_DEBUG;
+    dss->compress = flags & LIBXL_SUSPEND_COMPRESS;
     dss->checkpointed_stream = LIBXL_CHECKPOINTED_STREAM_NONE;
 
     rc = libxl__fd_flags_modify_save(gc, dss->fd,
@@ -532,6 +549,26 @@ int libxl_domain_suspend(libxl_ctx *ctx, uint32_t domid, int fd, int flags,
                                      &dss->fdfl);
     if (rc < 0) goto out_err;
 
+    if (num_stripe_fds) {
+        GCNEW_ARRAY(dss->stripe_fds, num_stripe_fds);
+        GCNEW_ARRAY(dss->stripe_fdfls, num_stripe_fds);
+        memcpy(dss->stripe_fds, stripe_fds,
+               num_stripe_fds * sizeof(*stripe_fds));
+        for (i = 0; i < num_stripe_fds; i++) {
+            rc = libxl__fd_flags_modify_save(gc, dss->stripe_fds[i],
+                                             ~(O_NONBLOCK|O_NDELAY), 0,
+                                             &dss->stripe_fdfls[i]);
+            if (rc < 0) {
+                while (i--)
+                    libxl__fd_flags_restore(gc, dss->stripe_fds[i],
+                                            dss->stripe_fdfls[i]);
+                libxl__fd_flags_restore(gc, dss->fd, dss->fdfl);
+                goto out_err;
+            }
+        }
+        dss->num_stripe_fds = num_stripe_fds;
+    }
+
     libxl__domain_save(egc, dss);
     return AO_INPROGRESS;
 
@@ -539,6 +576,20 @@ int libxl_domain_suspend(libxl_ctx *ctx, uint32_t domid, int fd, int flags,
     return AO_CREATE_FAIL(rc);
 }
 
+int libxl_domain_suspend(libxl_ctx *ctx, uint32_t domid, int fd, int flags,
+                         const libxl_asyncop_how *ao_how)
+{
+    return do_domain_suspend(ctx, domid, fd, NULL, 0, flags, ao_how);
+}
+
+int libxl_domain_suspend_striped(libxl_ctx *ctx, uint32_t domid, int fd,
+                                 const int *stripe_fds, int num_stripe_fds,
+                                 int flags, const libxl_asyncop_how *ao_how)
+{
+    return do_domain_suspend(ctx, domid, fd, stripe_fds, num_stripe_fds,
+                             flags, ao_how);
+}
+
 static void domain_suspend_empty_cb(libxl__egc *egc,
                               libxl__domain_suspend_state *dss, int rc)
 {
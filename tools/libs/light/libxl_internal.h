@@ -944,6 +944,12 @@ _hidden int libxl__xs_writev_perms(libxl__gc *gc, xs_transaction_t t,
                                    const char *dir, char *kvs[],
                                    struct xs_permissions *perms,
                                    unsigned int num_perms);
+/* as writev_perms, but adds the writes to a batch (errors in the batch
+ * are reported by xs_batch_commit) */
+_hidden int libxl__xs_batch_writev_perms(libxl__gc *gc, struct xs_batch *b,
+                                         const char *dir, char *kvs[],
+                                         struct xs_permissions *perms,
+                                         unsigned int num_perms);
 /* _atonce creates a transaction and writes all keys at once */
 _hidden int libxl__xs_writev_atonce(libxl__gc *gc,
                              const char *dir, char **kvs);
@@ -3645,10 +3651,14 @@ struct libxl__domain_save_state {
     uint32_t domid;
     int fd;
     int fdfl; /* original flags on fd */
+    int *stripe_fds; /* further streams for page data, may be NULL */
+    int *stripe_fdfls; /* original flags on stripe_fds */
+    int num_stripe_fds;
     int recv_fd;
     libxl_domain_type type;
     int live;
     int debug;
+    int compress;
     int checkpointed_stream;
     const libxl_domain_remus_info *remus;
     /* private */
@@ -4212,6 +4222,7 @@ struct libxl__domain_create_state {
     libxl_domain_config guest_config_saved; /* vanilla config */
     int restore_fd, libxc_fd;
     int restore_fdfl; /* original flags of restore_fd */
+    int *stripe_fdfls; /* original flags of restore_params.stripe_fds */
     int send_back_fd;
     libxl_domain_restore_params restore_params;
     uint32_t domid;
@@ -39,6 +39,12 @@ static void helper_exited(libxl__egc *egc, libxl__ev_child *ch,
                           pid_t pid, int status);
 static void helper_done(libxl__egc *egc, libxl__save_helper_state *shs);
 
+static const unsigned long *append_stripe_fds(libxl__gc *gc,
+                                              const unsigned long *argnums,
+                                              int *num_argnums,
+                                              const int *stripe_fds,
+                                              int num_stripe_fds);
+
 /*----- entrypoints -----*/
 
 void libxl__xc_domain_restore(libxl__egc *egc, libxl__domain_create_state *dcs,
@@ -55,13 +61,18 @@ void libxl__xc_domain_restore(libxl__egc *egc, libxl__domain_create_state *dcs,
     unsigned cbflags =
         libxl__srm_callout_enumcallbacks_restore(&shs->callbacks.restore.a);
 
-    const unsigned long argnums[] = {
+    const unsigned long fixed_argnums[] = {
         domid,
         state->store_port,
         state->store_domid, state->console_port,
         state->console_domid,
         cbflags, dcs->restore_params.checkpointed_stream,
     };
+    int num_argnums = ARRAY_SIZE(fixed_argnums);
+    const unsigned long *argnums =
+        append_stripe_fds(gc, fixed_argnums, &num_argnums,
+                          dcs->restore_params.stripe_fds,
+                          dcs->restore_params.num_stripe_fds);
 
     shs->ao = ao;
     shs->domid = domid;
@@ -74,8 +85,10 @@ void libxl__xc_domain_restore(libxl__egc *egc, libxl__domain_create_state *dcs,
     shs->caller_state = dcs;
     shs->need_results = 1;
 
-    run_helper(egc, shs, "--restore-domain", restore_fd, send_back_fd, 0, 0,
-               argnums, ARRAY_SIZE(argnums));
+    run_helper(egc, shs, "--restore-domain", restore_fd, send_back_fd,
+               dcs->restore_params.stripe_fds,
+               dcs->restore_params.num_stripe_fds,
+               argnums, num_argnums);
 }
 
 void libxl__xc_domain_save(libxl__egc *egc, libxl__domain_save_state *dss,
@@ -86,10 +99,14 @@ void libxl__xc_domain_save(libxl__egc *egc, libxl__domain_save_state *dss,
     unsigned cbflags =
         libxl__srm_callout_enumcallbacks_save(&shs->callbacks.save.a);
 
-    const unsigned long argnums[] = {
+    const unsigned long fixed_argnums[] = {
         dss->domid, dss->xcflags, cbflags,
         dss->checkpointed_stream,
     };
+    int num_argnums = ARRAY_SIZE(fixed_argnums);
+    const unsigned long *argnums =
+        append_stripe_fds(gc, fixed_argnums, &num_argnums,
+                          dss->stripe_fds, dss->num_stripe_fds);
 
     shs->ao = ao;
     shs->domid = dss->domid;
@@ -99,8 +116,8 @@ void libxl__xc_domain_save(libxl__egc *egc, libxl__domain_save_state *dss,
     shs->need_results = 0;
 
     run_helper(egc, shs, "--save-domain", dss->fd, dss->recv_fd,
-               NULL, 0,
-               argnums, ARRAY_SIZE(argnums));
+               dss->stripe_fds, dss->num_stripe_fds,
+               argnums, num_argnums);
     return;
 }
 
@@ -122,6 +139,30 @@ void libxl__save_helper_init(libxl__save_helper_state *shs)
 
 /*----- helper execution -----*/
 
+/*
+ * The helper takes the number of stripe fds, then the fds themselves,
+ * after the save/restore specific parameters.  The fds are passed to
+ * the helper as preserve_fds, so they keep their numbers.
+ */
+static const unsigned long *append_stripe_fds(libxl__gc *gc,
+                                              const unsigned long *argnums,
+                                              int *num_argnums,
+                                              const int *stripe_fds,
+                                              int num_stripe_fds)
+{
+    unsigned long *all;
+    int i, n = *num_argnums;
+
+    GCNEW_ARRAY(all, n + 1 + num_stripe_fds);
+    memcpy(all, argnums, n * sizeof(*argnums));
+    all[n++] = num_stripe_fds;
+    for (i = 0; i < num_stripe_fds; i++)
+        all[n++] = stripe_fds[i];
+
+    *num_argnums = n;
+    return all;
+}
+
 /* This function can not fail. */
 static int dup_cloexec(libxl__gc *gc, int fd, const char *what)
 {
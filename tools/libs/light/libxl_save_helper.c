@@ -232,6 +232,27 @@ static void complete(int retval) {
     exit(0);
 }
 
+static void parse_stripe_fds(char ***argvp, const int **fds_r,
+                             unsigned int *nr_r)
+/* consumes the count and then that many fds from *argvp */
+{
+    char **argv = *argvp;
+    unsigned int i, nr;
+    int *fds;
+
+    assert(*++argv);
+    nr = strtoul(*argv,0,10);
+    fds = xmalloc(nr * sizeof(*fds));
+    for (i = 0; i < nr; i++) {
+        assert(*++argv);
+        fds[i] = atoi(*argv);
+    }
+
+    *argvp = argv;
+    *fds_r = fds;
+    *nr_r = nr;
+}
+
 int main(int argc, char **argv)
 {
     int r;
@@ -251,6 +272,7 @@ int main(int argc, char **argv)
         uint32_t flags =                    strtoul(NEXTARG,0,10);
         unsigned cbflags =                  strtoul(NEXTARG,0,10);
         xc_stream_type_t stream_type =      strtoul(NEXTARG,0,10);
+        parse_stripe_fds(&argv, &cb.stripe_fds, &cb.nr_stripe_fds);
         assert(!*++argv);
 
         helper_setcallbacks_save(&cb, cbflags);
@@ -273,6 +295,7 @@ int main(int argc, char **argv)
         domid_t console_domid =             strtoul(NEXTARG,0,10);
         unsigned cbflags =                  strtoul(NEXTARG,0,10);
         xc_stream_type_t stream_type =      strtoul(NEXTARG,0,10);
+        parse_stripe_fds(&argv, &cb.stripe_fds, &cb.nr_stripe_fds);
         assert(!*++argv);
 
         helper_setcallbacks_restore(&cb, cbflags);
@@ -45,8 +45,9 @@ char **libxl__xs_kvs_of_flexarray(libxl__gc *gc, flexarray_t *array)
     return kvs;
 }
 
-int libxl__xs_writev_perms(libxl__gc *gc, xs_transaction_t t,
-                           const char *dir, char *kvs[],
+/* Add the writes to batch b, or do them right away if b is NULL. */
+static int xs_writev_perms(libxl__gc *gc, xs_transaction_t t,
+                           struct xs_batch *b, const char *dir, char *kvs[],
                            struct xs_permissions *perms,
                            unsigned int num_perms)
 {
@@ -63,6 +64,12 @@ int libxl__xs_writev_perms(libxl__gc *gc, xs_transaction_t t,
             size_t length = strlen(kvs[i + 1]);
             if (length > UINT_MAX)
                 return ERROR_FAIL;
+            if (b) {
+                xs_batch_write(b, path, kvs[i + 1], length);
+                if (perms)
+                    xs_batch_set_permissions(b, path, perms, num_perms);
+                continue;
+            }
             if (!xs_write(ctx->xsh, t, path, kvs[i + 1], length))
                 return ERROR_FAIL;
             if (perms) {
@@ -74,6 +81,49 @@ int libxl__xs_writev_perms(libxl__gc *gc, xs_transaction_t t,
     return 0;
 }
 
+int libxl__xs_batch_writev_perms(libxl__gc *gc, struct xs_batch *b,
+                                 const char *dir, char *kvs[],
+                                 struct xs_permissions *perms,
+                                 unsigned int num_perms)
+{
+    return xs_writev_perms(gc, XBT_NULL, b, dir, kvs, perms, num_perms);
+}
+
+int libxl__xs_writev_perms(libxl__gc *gc, xs_transaction_t t,
+                           const char *dir, char *kvs[],
+                           struct xs_permissions *perms,
+                           unsigned int num_perms)
+{
+    libxl_ctx *ctx = libxl__gc_owner(gc);
+    struct xs_batch *b;
+    int rc;
+
+    if (!kvs)
+        return 0;
+
+    b = xs_batch_new(ctx->xsh, t);
+    if (!b)
+        return ERROR_FAIL;
+
+    rc = xs_writev_perms(gc, t, b, dir, kvs, perms, num_perms);
+    if (rc) {
+        xs_batch_free(b);
+        return rc;
+    }
+
+    if (xs_batch_commit(b))
+        return 0;
+
+    /*
+     * Outside of a transaction a batch must fit into a single request.
+     * Nothing has been written in that case, so do it the slow way.
+     */
+    if (t == XBT_NULL && errno == E2BIG)
+        return xs_writev_perms(gc, t, NULL, dir, kvs, perms, num_perms);
+
+    return ERROR_FAIL;
+}
+
 int libxl__xs_writev(libxl__gc *gc, xs_transaction_t t,
                      const char *dir, char *kvs[])
 {
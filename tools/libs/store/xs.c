@@ -94,6 +94,9 @@ struct xs_handle {
 	/* Filtering watch event in unwatch function? */
 	bool unwatch_filter;
 
+	/* Has XS_MULTI been rejected by xenstored? */
+	bool multi_unsupported;
+
 	/*
          * A list of replies. Currently only one will ever be outstanding
          * because we serialise requests. The requester can wait on the
@@ -970,6 +973,309 @@ unwind:
 	return false;
 }
 
+struct xs_batch_result {
+	void **value;
+	unsigned int *len;
+};
+
+struct xs_batch {
+	struct xs_handle *h;
+	xs_transaction_t t;
+
+	/* The operations in wire format, each with its own header. */
+	char *buf;
+	unsigned int len;
+
+	/* Where to store the results of reads. */
+	struct xs_batch_result *results;
+	unsigned int num;
+
+	/* First error adding an operation. */
+	int err;
+};
+
+struct xs_batch *xs_batch_new(struct xs_handle *h, xs_transaction_t t)
+{
+	struct xs_batch *b;
+
+	b = calloc(1, sizeof(*b));
+	if (!b)
+		return NULL;
+
+	b->h = h;
+	b->t = t;
+
+	return b;
+}
+
+void xs_batch_free(struct xs_batch *b)
+{
+	int saved_errno = errno;
+	unsigned int i;
+
+	if (!b)
+		return;
+
+	for (i = 0; i < b->num; i++) {
+		if (b->results[i].value) {
+			free(*b->results[i].value);
+			*b->results[i].value = NULL;
+		}
+	}
+
+	free(b->results);
+	free(b->buf);
+	free(b);
+	errno = saved_errno;
+}
+
+static bool xs_batch_add(struct xs_batch *b, enum xsd_sockmsg_type type,
+			 const char *path, const void *data, unsigned int len,
+			 void **value, unsigned int *value_len)
+{
+	struct xsd_sockmsg msg = { .type = type };
+	unsigned int path_len = strlen(path) + 1;
+	struct xs_batch_result *results;
+	char *buf;
+
+	if (b->err) {
+		errno = b->err;
+		return false;
+	}
+
+	msg.len = path_len + len;
+	if (len > XENSTORE_PAYLOAD_MAX ||
+	    msg.len + sizeof(msg) > XENSTORE_PAYLOAD_MAX) {
+		errno = E2BIG;
+		goto fail;
+	}
+
+	buf = realloc(b->buf, b->len + sizeof(msg) + msg.len);
+	if (!buf)
+		goto fail;
+	b->buf = buf;
+
+	results = realloc(b->results, (b->num + 1) * sizeof(*results));
+	if (!results)
+		goto fail;
+	b->results = results;
+
+	memcpy(buf + b->len, &msg, sizeof(msg));
+	memcpy(buf + b->len + sizeof(msg), path, path_len);
+	if (len)
+		memcpy(buf + b->len + sizeof(msg) + path_len, data, len);
+	b->len += sizeof(msg) + msg.len;
+
+	if (value)
+		*value = NULL;
+	results[b->num].value = value;
+	results[b->num].len = value_len;
+	b->num++;
+
+	return true;
+
+ fail:
+	b->err = errno;
+	return false;
+}
+
+bool xs_batch_read(struct xs_batch *b, const char *path,
+		   void **value, unsigned int *len)
+{
+	return xs_batch_add(b, XS_READ, path, NULL, 0, value, len);
+}
+
+bool xs_batch_write(struct xs_batch *b, const char *path,
+		    const void *data, unsigned int len)
+{
+	return xs_batch_add(b, XS_WRITE, path, data, len, NULL, NULL);
+}
+
+bool xs_batch_mkdir(struct xs_batch *b, const char *path)
+{
+	return xs_batch_add(b, XS_MKDIR, path, NULL, 0, NULL, NULL);
+}
+
+bool xs_batch_rm(struct xs_batch *b, const char *path)
+{
+	return xs_batch_add(b, XS_RM, path, NULL, 0, NULL, NULL);
+}
+
+bool xs_batch_set_permissions(struct xs_batch *b, const char *path,
+			      struct xs_permissions *perms,
+			      unsigned int num_perms)
+{
+	char buffer[XENSTORE_PAYLOAD_MAX];
+	unsigned int i, len = 0;
+
+	for (i = 0; i < num_perms; i++) {
+		if (sizeof(buffer) - len < MAX_STRLEN(unsigned int) + 1)
+			errno = E2BIG;
+		else if (xenstore_perm_to_string(&perms[i], buffer + len,
+						 sizeof(buffer) - len)) {
+			len += strlen(buffer + len) + 1;
+			continue;
+		}
+		if (!b->err)
+			b->err = errno;
+		return false;
+	}
+
+	return xs_batch_add(b, XS_SET_PERMS, path, buffer, len, NULL, NULL);
+}
+
+/* Store the reply of operation i, taking over value. */
+static void xs_batch_result(struct xs_batch *b, unsigned int i,
+			    void *value, unsigned int len)
+{
+	if (b->results[i].value) {
+		*b->results[i].value = value;
+		if (b->results[i].len)
+			*b->results[i].len = len;
+	} else
+		free(value);
+}
+
+/*
+ * Send the operations in the buffer from start to end, the first of them
+ * being operation number first, as one XS_MULTI request.
+ */
+static bool xs_batch_send(struct xs_batch *b, unsigned int first,
+			  unsigned int start, unsigned int end)
+{
+	struct xsd_sockmsg msg = { .type = XS_MULTI, .tx_id = b->t };
+	struct xsd_sockmsg hdr;
+	struct iovec iov[2];
+	unsigned int off, len, i;
+	char *reply, *value;
+
+	iov[0].iov_base = &msg;
+	iov[0].iov_len  = sizeof(msg);
+	iov[1].iov_base = b->buf + start;
+	iov[1].iov_len  = end - start;
+
+	reply = xs_talkv(b->h, iov, ARRAY_SIZE(iov), &len);
+	if (!reply)
+		return false;
+
+	for (off = 0, i = first; off < len; i++) {
+		if (len - off < sizeof(hdr))
+			goto err;
+		memcpy(&hdr, reply + off, sizeof(hdr));
+		off += sizeof(hdr);
+		if (hdr.len > len - off || i == b->num)
+			goto err;
+
+		if (b->results[i].value) {
+			value = malloc(hdr.len + 1);
+			if (!value) {
+				free_no_errno(reply);
+				return false;
+			}
+			memcpy(value, reply + off, hdr.len);
+			value[hdr.len] = 0;
+			xs_batch_result(b, i, value, hdr.len);
+		}
+		off += hdr.len;
+	}
+
+	free(reply);
+	return true;
+
+ err:
+	free(reply);
+	errno = EIO;
+	return false;
+}
+
+/*
+ * Send the batch in XS_MULTI requests.  More than one is needed if it
+ * doesn't fit into a single message, which is fine inside a transaction
+ * only.
+ */
+static bool xs_batch_multi(struct xs_batch *b)
+{
+	struct xsd_sockmsg hdr;
+	unsigned int first = 0, start = 0, off, i;
+
+	for (off = 0, i = 0; off < b->len; i++) {
+		memcpy(&hdr, b->buf + off, sizeof(hdr));
+		if (off + sizeof(hdr) + hdr.len - start > XENSTORE_PAYLOAD_MAX) {
+			if (b->t == XBT_NULL) {
+				errno = E2BIG;
+				return false;
+			}
+			if (!xs_batch_send(b, first, start, off))
+				return false;
+			first = i;
+			start = off;
+		}
+		off += sizeof(hdr) + hdr.len;
+	}
+
+	return xs_batch_send(b, first, start, b->len);
+}
+
+/* Send the batch as single requests, in case xenstored lacks XS_MULTI. */
+static bool xs_batch_single(struct xs_batch *b)
+{
+	struct xsd_sockmsg msg;
+	struct iovec iov[2];
+	unsigned int off, len, i;
+	void *reply;
+
+	for (off = 0, i = 0; off < b->len; i++) {
+		memcpy(&msg, b->buf + off, sizeof(msg));
+		msg.tx_id = b->t;
+
+		iov[0].iov_base = &msg;
+		iov[0].iov_len  = sizeof(msg);
+		iov[1].iov_base = b->buf + off + sizeof(msg);
+		iov[1].iov_len  = msg.len;
+		off += sizeof(msg) + msg.len;
+
+		reply = xs_talkv(b->h, iov, ARRAY_SIZE(iov), &len);
+		if (!reply)
+			return false;
+		xs_batch_result(b, i, reply, len);
+	}
+
+	return true;
+}
+
+bool xs_batch_commit(struct xs_batch *b)
+{
+	bool ret;
+
+	if (b->err) {
+		errno = b->err;
+		ret = false;
+		goto out;
+	}
+
+	if (!b->len) {
+		ret = true;
+		goto out;
+	}
+
+	if (!b->h->multi_unsupported) {
+		ret = xs_batch_multi(b);
+		if (ret || errno != ENOSYS)
+			goto out;
+		b->h->multi_unsupported = true;
+	}
+
+	ret = xs_batch_single(b);
+
+ out:
+	/* On success the values read belong to the caller. */
+	if (ret)
+		b->num = 0;
+	xs_batch_free(b);
+
+	return ret;
+}
+
 /* Always return false a functionality has been removed in Xen 4.9 */
 bool xs_restrict(struct xs_handle *h, unsigned domid)
 {
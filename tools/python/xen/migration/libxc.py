@@ -58,6 +58,12 @@ REC_TYPE_checkpoint_dirty_pfn_list  = 0x0000000f
 REC_TYPE_static_data_end            = 0x00000010
 REC_TYPE_x86_cpuid_policy           = 0x00000011
 REC_TYPE_x86_msr_policy             = 0x00000012
+REC_TYPE_compressed_page_data       = 0x00000013
+REC_TYPE_elided_page_data           = 0x00000014
+REC_TYPE_postcopy_pfns              = 0x00000015
+REC_TYPE_postcopy_transition        = 0x00000016
+REC_TYPE_postcopy_fault             = 0x00000017
+REC_TYPE_striped_data               = 0x00000018
 
 rec_type_to_str = {
     REC_TYPE_end                        : "End",
@@ -79,6 +85,12 @@ rec_type_to_str = {
     REC_TYPE_static_data_end            : "Static data end",
     REC_TYPE_x86_cpuid_policy           : "x86 CPUID policy",
     REC_TYPE_x86_msr_policy             : "x86 MSR policy",
+    REC_TYPE_compressed_page_data       : "Compressed page data",
+    REC_TYPE_elided_page_data           : "Elided page data",
+    REC_TYPE_postcopy_pfns              : "Post-copy pfns",
+    REC_TYPE_postcopy_transition        : "Post-copy transition",
+    REC_TYPE_postcopy_fault             : "Post-copy fault",
+    REC_TYPE_striped_data               : "Striped data",
 }
 
 # page_data
@@ -101,6 +113,19 @@ PAGE_DATA_TYPE_BROKEN        = (0xd << PAGE_DATA_TYPE_SHIFT) # Broken
 PAGE_DATA_TYPE_XALLOC        = (0xe << PAGE_DATA_TYPE_SHIFT) # Allocate-only
 PAGE_DATA_TYPE_XTAB          = (0xf << PAGE_DATA_TYPE_SHIFT) # Invalid
 
+# compressed_page_data
+COMPRESSED_PAGE_DATA_FORMAT   = "II"
+COMPRESSED_PAGE_DATA_ALG_LZ4  = 0x00000001
+COMPRESSED_PAGE_DATA_ALG_ZSTD = 0x00000002
+
+# elided_page_data
+ELIDED_PAGE_DATA_FORMAT    = "II"
+ELIDED_PAGE_DATA_ZERO      = 0x00000001
+ELIDED_PAGE_DATA_UNCHANGED = 0x00000002
+
+# striped_data
+STRIPED_DATA_FORMAT        = "IIQ"
+
 # x86_pv_info
 X86_PV_INFO_FORMAT        = "BBHI"
 
@@ -130,6 +155,7 @@ class VerifyLibxc(VerifyBase):
 
         self.version = 0
         self.squashed_pagedata_records = 0
+        self.striped_seq = 0
 
 
     def verify(self):
@@ -271,6 +297,17 @@ class VerifyLibxc(VerifyBase):
                 "PAGE_DATA record must contain a pfn record for each count")
 
         pfns = list(unpack("=%dQ" % (count, ), content[minsz:minsz + pfnsz]))
+        nr_pages = self.verify_page_data_pfns(pfns)
+
+        pagesz = nr_pages * 4096
+        if len(content) != minsz + pfnsz + pagesz:
+            raise RecordError("Expected %u + %u + %u, got %u" %
+                              (minsz, pfnsz, pagesz, len(content)))
+
+
+    def verify_page_data_pfns(self, pfns):
+        """ Verify the pfns of a page data record, returning the number of
+        pages expected to have data """
 
         nr_pages = 0
         for idx, pfn in enumerate(pfns):
@@ -288,10 +325,7 @@ class VerifyLibxc(VerifyBase):
                     <= PAGE_DATA_TYPE_L4TAB:
                 nr_pages += 1
 
-        pagesz = nr_pages * 4096
-        if len(content) != minsz + pfnsz + pagesz:
-            raise RecordError("Expected %u + %u + %u, got %u" %
-                              (minsz, pfnsz, pagesz, len(content)))
+        return nr_pages
 
 
     def verify_record_x86_pv_info(self, content):
@@ -476,6 +510,123 @@ class VerifyLibxc(VerifyBase):
                               (contentsz, sz))
 
 
+    def verify_record_compressed_page_data(self, content):
+        """ Compressed Page Data record """
+        minsz = calcsize(COMPRESSED_PAGE_DATA_FORMAT)
+
+        if len(content) <= minsz:
+            raise RecordError(
+                "COMPRESSED_PAGE_DATA record must be at least %d bytes long" %
+                (minsz, ))
+
+        count, alg = unpack(COMPRESSED_PAGE_DATA_FORMAT, content[:minsz])
+
+        if alg not in (COMPRESSED_PAGE_DATA_ALG_LZ4,
+                       COMPRESSED_PAGE_DATA_ALG_ZSTD):
+            raise RecordError("Unknown compression algorithm 0x%08x" % (alg, ))
+
+        pfnsz = count * 8
+        if (len(content) - minsz) < pfnsz:
+            raise RecordError("COMPRESSED_PAGE_DATA record must contain a pfn "
+                              "record for each count")
+
+        pfns = list(unpack("=%dQ" % (count, ), content[minsz:minsz + pfnsz]))
+        nr_pages = self.verify_page_data_pfns(pfns)
+
+        lensz = nr_pages * 4
+        if (len(content) - minsz - pfnsz) < lensz:
+            raise RecordError("COMPRESSED_PAGE_DATA record must contain a "
+                              "length for each page of data")
+
+        lengths = unpack("=%dI" % (nr_pages, ),
+                         content[minsz + pfnsz:minsz + pfnsz + lensz])
+
+        for idx, length in enumerate(lengths):
+            if not 0 < length <= 4096:
+                raise RecordError("Invalid length[%d]: %u" % (idx, length))
+
+        pagesz = sum(lengths)
+        if len(content) != minsz + pfnsz + lensz + pagesz:
+            raise RecordError("Expected %u + %u + %u + %u, got %u" %
+                              (minsz, pfnsz, lensz, pagesz, len(content)))
+
+
+    def verify_record_elided_page_data(self, content):
+        """ Elided Page Data record """
+        minsz = calcsize(ELIDED_PAGE_DATA_FORMAT)
+
+        if len(content) <= minsz:
+            raise RecordError(
+                "ELIDED_PAGE_DATA record must be at least %d bytes long" %
+                (minsz, ))
+
+        count, reason = unpack(ELIDED_PAGE_DATA_FORMAT, content[:minsz])
+
+        if reason not in (ELIDED_PAGE_DATA_ZERO, ELIDED_PAGE_DATA_UNCHANGED):
+            raise RecordError("Unknown elision reason 0x%08x" % (reason, ))
+
+        pfnsz = count * 8
+        if len(content) != minsz + pfnsz:
+            raise RecordError("Expected %u + %u, got %u" %
+                              (minsz, pfnsz, len(content)))
+
+        pfns = list(unpack("=%dQ" % (count, ), content[minsz:]))
+        nr_pages = self.verify_page_data_pfns(pfns)
+
+        if nr_pages != count:
+            raise RecordError("ELIDED_PAGE_DATA record has %u pfns without "
+                              "data" % (count - nr_pages, ))
+
+
+    def verify_record_postcopy_pfns(self, content):
+        """ Post-copy pfns record """
+
+        if len(content) == 0 or len(content) % 8 != 0:
+            raise RecordError("Record length %u, expected non-zero multiple "
+                              "of 8" % (len(content), ))
+
+        for pfn in unpack("=%dQ" % (len(content) // 8, ), content):
+            if pfn & ~PAGE_DATA_PFN_MASK:
+                raise RecordError("Invalid pfn 0x%x" % (pfn, ))
+
+
+    def verify_record_postcopy_transition(self, content):
+        """ Post-copy transition record """
+
+        if len(content) != 0:
+            raise RecordError("Post-copy transition record with non-zero "
+                              "length")
+
+
+    def verify_record_postcopy_fault(self, content):
+        """ Post-copy fault record """
+        raise RecordError("Found post-copy fault record in stream")
+
+
+    def verify_record_striped_data(self, content):
+        """ Striped data record """
+        sz = calcsize(STRIPED_DATA_FORMAT)
+
+        if len(content) != sz:
+            raise RecordError("Length expected %u, got %u" %
+                              (sz, len(content)))
+
+        stream, count, seq = unpack(STRIPED_DATA_FORMAT, content)
+
+        if stream == 0:
+            raise RecordError("STRIPED_DATA record for the main stream")
+
+        if count == 0:
+            raise RecordError("STRIPED_DATA record with no records")
+
+        if seq != self.striped_seq:
+            raise RecordError("STRIPED_DATA sequence %u, expected %u" %
+                              (seq, self.striped_seq))
+
+        self.info("  Stream %u, %u records, seq %u" % (stream, count, seq))
+        self.striped_seq += 1
+
+
 record_verifiers = {
     REC_TYPE_end:
         VerifyLibxc.verify_record_end,
@@ -525,4 +676,20 @@ record_verifiers = {
         VerifyLibxc.verify_record_x86_cpuid_policy,
     REC_TYPE_x86_msr_policy:
         VerifyLibxc.verify_record_x86_msr_policy,
+
+    REC_TYPE_compressed_page_data:
+        VerifyLibxc.verify_record_compressed_page_data,
+
+    REC_TYPE_elided_page_data:
+        VerifyLibxc.verify_record_elided_page_data,
+
+    REC_TYPE_postcopy_pfns:
+        VerifyLibxc.verify_record_postcopy_pfns,
+    REC_TYPE_postcopy_transition:
+        VerifyLibxc.verify_record_postcopy_transition,
+    REC_TYPE_postcopy_fault:
+        VerifyLibxc.verify_record_postcopy_fault,
+
+    REC_TYPE_striped_data:
+        VerifyLibxc.verify_record_striped_data,
     }
@@ -0,0 +1,1444 @@
+/*
+ * Save/restore throughput benchmark.
+ *
+ * Runs xc_domain_save() and xc_domain_restore() back to back in a single
+ * process, against a synthetic HVM guest.  The hypercalls and foreign
+ * mappings used by the migration code are replaced by in-process fakes
+ * (the definitions below interpose the ones in libxenctrl/libxenguest), and
+ * guest memory is a memfd, so no hypervisor is required.
+ *
+ * The stream is relayed between the two sides through a pair of pipes, which
+ * allows the link bandwidth to be limited and the stream size measured.  Page
+ * data may be striped over further streams, each relayed likewise.
+ * After the restore completes, the memory of the two guests is compared.
+ *
+ * For a post-copy migration, the mem_paging ring and its event channel are
+ * faked too, and a thread stands in for a vcpu of the resumed guest, reading
+ * random pages and raising a fault on each still paged out.
+ */
+#define _GNU_SOURCE
+
+#include <err.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <getopt.h>
+#include <inttypes.h>
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/resource.h>
+
+#include <xenctrl.h>
+#include <xenevtchn.h>
+#include <xenguest.h>
+#include <xen-tools/common-macros.h>
+#include <xen/vm_event.h>
+
+#include "xc_private.h"
+
+#define SAVE_DOMID    1
+#define RESTORE_DOMID 2
+
+#define BENCH_PAGE_SIZE 4096UL
+#define BITS_PER_LONG   (sizeof(unsigned long) * 8)
+
+struct fake_domain {
+    uint32_t domid;
+    unsigned long nr_pfns;
+    int memfd;
+    uint8_t *mem;
+    unsigned long *populated;
+    unsigned long *dirty;
+    /* Pfns paged out, for post-copy. */
+    unsigned long *paged;
+    bool suspended;
+    /* Xen's dirty ring, if enabled. */
+    unsigned long *ring;
+    unsigned long ring_prod, ring_cons;
+    bool ring_overflowed;
+    /* Whether the guest has run since the ring was last drained dry. */
+    bool ring_dirtied;
+};
+
+static struct fake_domain src, dst;
+
+/* Parameters */
+static unsigned long mem_mb = 1024;
+static unsigned int zero_pct;
+static unsigned int text_pct;
+static uint32_t save_flags;
+static unsigned long dirty_pages;
+static unsigned int same_pct;
+static unsigned int max_iters = 5;
+static unsigned long link_mbps;
+static int tee_fd = -1;
+static bool live = true;
+static bool postcopy;
+static bool adaptive;
+static bool expect_throttle;
+static unsigned long dirty_rate;
+static unsigned int max_downtime_ms;
+static unsigned long ring_size = 1UL << 16;
+static unsigned int nr_stripes;
+static unsigned long ring_drains, ring_overflows;
+static int verbose;
+
+/* Results */
+struct iter_stats {
+    unsigned long pages;
+    double start, end;
+};
+static struct iter_stats iters[64];
+static unsigned int nr_iters;
+static unsigned long long stream_bytes;
+static unsigned long guest_reads, guest_faults, guest_bad;
+static double fault_wait, fault_wait_max;
+
+/* The source domain's credit2 cap, as set by the adaptive precopy policy. */
+static uint16_t sched_cap;
+static unsigned int sched_cap_changes;
+static uint16_t sched_cap_min = UINT16_MAX;
+
+/* When the fake guest last dirtied memory. */
+static double dirtied;
+
+static double now(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static bool bench_test_bit(unsigned long nr, const unsigned long *addr)
+{
+    return addr[nr / BITS_PER_LONG] & (1UL << (nr % BITS_PER_LONG));
+}
+
+static void bench_set_bit(unsigned long nr, unsigned long *addr)
+{
+    addr[nr / BITS_PER_LONG] |= 1UL << (nr % BITS_PER_LONG);
+}
+
+static void bench_clear_bit(unsigned long nr, unsigned long *addr)
+{
+    addr[nr / BITS_PER_LONG] &= ~(1UL << (nr % BITS_PER_LONG));
+}
+
+/* For the paged bitmap, shared with the guest thread. */
+static bool paged_test(const struct fake_domain *d, unsigned long pfn)
+{
+    return __atomic_load_n(&d->paged[pfn / BITS_PER_LONG], __ATOMIC_ACQUIRE) &
+        (1UL << (pfn % BITS_PER_LONG));
+}
+
+static void paged_set(struct fake_domain *d, unsigned long pfn, bool paged)
+{
+    unsigned long mask = 1UL << (pfn % BITS_PER_LONG);
+
+    if ( paged )
+        __atomic_fetch_or(&d->paged[pfn / BITS_PER_LONG], mask,
+                          __ATOMIC_RELEASE);
+    else
+        __atomic_fetch_and(&d->paged[pfn / BITS_PER_LONG], ~mask,
+                           __ATOMIC_RELEASE);
+}
+
+static struct fake_domain *get_domain(uint32_t domid)
+{
+    if ( domid == SAVE_DOMID )
+        return &src;
+    if ( domid == RESTORE_DOMID )
+        return &dst;
+
+    errno = ESRCH;
+    return NULL;
+}
+
+/*
+ * Fill a page with zeroes, compressible text-like data or random data,
+ * according to zero_pct and text_pct.
+ */
+static void fill_page(uint8_t *page, unsigned int *seed)
+{
+    static const char *const words[] = {
+        "the ", "migration ", "of ", "a ", "guest ", "page ", "stream ",
+        "record ", "and ", "to ", "memory ", "with ", "domain ", "is ",
+        "xen ", "data\n",
+    };
+    unsigned int i, kind = (unsigned int)rand_r(seed) % 100;
+
+    if ( kind < zero_pct )
+    {
+        memset(page, 0, BENCH_PAGE_SIZE);
+        return;
+    }
+
+    if ( kind < zero_pct + text_pct )
+    {
+        for ( i = 0; i < BENCH_PAGE_SIZE; )
+        {
+            const char *w = words[rand_r(seed) % ARRAY_SIZE(words)];
+            size_t len = min_t(size_t, strlen(w), BENCH_PAGE_SIZE - i);
+
+            memcpy(page + i, w, len);
+            i += len;
+        }
+        return;
+    }
+
+    for ( i = 0; i < BENCH_PAGE_SIZE; i += sizeof(uint32_t) )
+    {
+        uint32_t val = rand_r(seed);
+
+        memcpy(page + i, &val, sizeof(val));
+    }
+}
+
+static void init_domain(struct fake_domain *d, uint32_t domid,
+                        unsigned long nr_pfns, bool fill)
+{
+    size_t bitmap_bytes = (nr_pfns + BITS_PER_LONG) / 8 + sizeof(unsigned long);
+    unsigned int seed = 1;
+    unsigned long pfn;
+
+    d->domid = domid;
+    d->nr_pfns = nr_pfns;
+    d->memfd = memfd_create("guest-memory", 0);
+    if ( d->memfd < 0 || ftruncate(d->memfd, nr_pfns * BENCH_PAGE_SIZE) )
+        err(1, "memfd");
+
+    d->mem = mmap(NULL, nr_pfns * BENCH_PAGE_SIZE, PROT_READ | PROT_WRITE,
+                  MAP_SHARED, d->memfd, 0);
+    if ( d->mem == MAP_FAILED )
+        err(1, "mmap guest memory");
+
+    d->populated = calloc(1, bitmap_bytes);
+    d->dirty = calloc(1, bitmap_bytes);
+    d->paged = calloc(1, bitmap_bytes);
+    if ( !d->populated || !d->dirty || !d->paged )
+        err(1, "calloc");
+
+    if ( !fill )
+        return;
+
+    for ( pfn = 0; pfn < nr_pfns; ++pfn )
+    {
+        fill_page(d->mem + pfn * BENCH_PAGE_SIZE, &seed);
+        bench_set_bit(pfn, d->populated);
+    }
+}
+
+/*
+ * Model the guest running for one precopy iteration: dirty_pages, and
+ * dirty_rate pages/s since the last iteration, slowed by any scheduler cap.
+ */
+static void dirty_domain(struct fake_domain *d)
+{
+    static unsigned int seed = 2;
+    double t = now();
+    unsigned long i, pfn, n = dirty_pages;
+
+    n += dirty_rate * (t - dirtied) * (sched_cap ? sched_cap / 100.0 : 1.0);
+    dirtied = t;
+
+    for ( i = 0; i < n; ++i )
+    {
+        pfn = ((unsigned long)rand_r(&seed) << 16 ^ rand_r(&seed)) % d->nr_pfns;
+        /* Some writes leave the page as it was. */
+        if ( rand_r(&seed) % 100 >= same_pct )
+            fill_page(d->mem + pfn * BENCH_PAGE_SIZE, &seed);
+        if ( bench_test_bit(pfn, d->dirty) )
+            continue;
+        bench_set_bit(pfn, d->dirty);
+
+        if ( !d->ring )
+            continue;
+        if ( d->ring_prod - d->ring_cons == ring_size )
+            d->ring_overflowed = true;
+        else
+            d->ring[d->ring_prod++ % ring_size] = pfn;
+    }
+}
+
+/*
+ * Fakes of the libxenctrl/libxenguest functions used by the migration code.
+ */
+int xc_domain_getinfo_single(xc_interface *xch, uint32_t domid,
+                             xc_domaininfo_t *info)
+{
+    struct fake_domain *d = get_domain(domid);
+
+    if ( !d )
+        return -1;
+
+    memset(info, 0, sizeof(*info));
+    info->domain = domid;
+    info->flags = XEN_DOMINF_hvm_guest;
+    if ( d->suspended )
+        info->flags |= XEN_DOMINF_shutdown | XEN_DOMINF_paused |
+            (SHUTDOWN_suspend << XEN_DOMINF_shutdownshift);
+    info->tot_pages = d->nr_pfns;
+    info->max_pages = d->nr_pfns;
+
+    return 0;
+}
+
+int xc_sched_credit_domain_get(xc_interface *xch, uint32_t domid,
+                               struct xen_domctl_sched_credit *sdom)
+{
+    errno = EINVAL;
+    return -1;
+}
+
+int xc_sched_credit_domain_set(xc_interface *xch, uint32_t domid,
+                               struct xen_domctl_sched_credit *sdom)
+{
+    errno = EINVAL;
+    return -1;
+}
+
+int xc_sched_credit2_domain_get(xc_interface *xch, uint32_t domid,
+                                struct xen_domctl_sched_credit2 *sdom)
+{
+    sdom->weight = 256;
+    sdom->cap = sched_cap;
+
+    return 0;
+}
+
+int xc_sched_credit2_domain_set(xc_interface *xch, uint32_t domid,
+                                struct xen_domctl_sched_credit2 *sdom)
+{
+    if ( sdom->cap > 100 )
+    {
+        errno = EINVAL;
+        return -1;
+    }
+
+    sched_cap = sdom->cap;
+    sched_cap_changes++;
+    if ( sched_cap )
+        sched_cap_min = min(sched_cap_min, sched_cap);
+
+    return 0;
+}
+
+int xc_version(xc_interface *xch, int cmd, void *arg)
+{
+    return (4 << 16) | 20;
+}
+
+int xc_domain_nr_gpfns(xc_interface *xch, uint32_t domid, xen_pfn_t *gpfns)
+{
+    struct fake_domain *d = get_domain(domid);
+
+    if ( !d )
+        return -1;
+
+    *gpfns = d->nr_pfns;
+
+    return 0;
+}
+
+int xc_shadow_control(xc_interface *xch, uint32_t domid, unsigned int sop,
+                      unsigned int *mb, unsigned int mode)
+{
+    struct fake_domain *d = get_domain(domid);
+
+    if ( d && sop == XEN_DOMCTL_SHADOW_OP_ENABLE &&
+         (mode & XEN_DOMCTL_SHADOW_ENABLE_DIRTY_RING) )
+    {
+        if ( !ring_size )
+        {
+            errno = EOPNOTSUPP;
+            return -1;
+        }
+
+        d->ring = calloc(ring_size, sizeof(*d->ring));
+        if ( !d->ring )
+            err(1, "calloc");
+    }
+
+    return 0;
+}
+
+int xc_logdirty_drain_ring(xc_interface *xch, uint32_t domid,
+                           xc_hypercall_buffer_t *dirty_pfns,
+                           unsigned long *nr_dirty_pfns, unsigned int mode,
+                           xc_shadow_op_stats_t *stats)
+{
+    struct fake_domain *d = get_domain(domid);
+    uint64_t *list = dirty_pfns->hbuf;
+    unsigned long pfn, found = 0;
+
+    if ( !d || !d->ring )
+    {
+        errno = EOPNOTSUPP;
+        return -1;
+    }
+
+    if ( !d->suspended && !d->ring_dirtied )
+    {
+        dirty_domain(d);
+        d->ring_dirtied = true;
+    }
+
+    if ( d->ring_overflowed )
+    {
+        ring_overflows++;
+        errno = ENOBUFS;
+        return -1;
+    }
+
+    ring_drains++;
+    while ( found < *nr_dirty_pfns && d->ring_cons != d->ring_prod )
+    {
+        pfn = d->ring[d->ring_cons++ % ring_size];
+
+        /* Skip entries for pfns since cleaned by a range. */
+        if ( !bench_test_bit(pfn, d->dirty) )
+            continue;
+
+        bench_clear_bit(pfn, d->dirty);
+        list[found++] = pfn;
+    }
+
+    if ( found < *nr_dirty_pfns )
+        d->ring_dirtied = false;
+
+    *nr_dirty_pfns = found;
+    if ( stats )
+    {
+        stats->dirty_count = found;
+        stats->fault_count = 0;
+    }
+
+    return 0;
+}
+
+long long xc_logdirty_control(xc_interface *xch, uint32_t domid,
+                              unsigned int sop,
+                              xc_hypercall_buffer_t *dirty_bitmap,
+                              unsigned long pages, unsigned int mode,
+                              xc_shadow_op_stats_t *stats)
+{
+    struct fake_domain *d = get_domain(domid);
+    size_t bytes = (pages + 7) / 8;
+    unsigned long pfn, count = 0;
+
+    if ( !d )
+        return -1;
+
+    /* Following an overflowed ring, the guest has run already. */
+    if ( !d->suspended && sop == XEN_DOMCTL_SHADOW_OP_CLEAN &&
+         !d->ring_dirtied )
+        dirty_domain(d);
+
+    if ( sop == XEN_DOMCTL_SHADOW_OP_CLEAN )
+    {
+        d->ring_prod = d->ring_cons = 0;
+        d->ring_overflowed = d->ring_dirtied = false;
+    }
+
+    for ( pfn = 0; pfn < pages; ++pfn )
+        count += bench_test_bit(pfn, d->dirty);
+
+    memcpy(dirty_bitmap->hbuf, d->dirty, bytes);
+    if ( sop == XEN_DOMCTL_SHADOW_OP_CLEAN )
+        memset(d->dirty, 0, bytes);
+
+    if ( stats )
+    {
+        stats->dirty_count = count;
+        stats->fault_count = 0;
+    }
+
+    return pages;
+}
+
+long long xc_logdirty_control_range(xc_interface *xch, uint32_t domid,
+                                    unsigned int sop,
+                                    xc_hypercall_buffer_t *dirty_bitmap,
+                                    xc_hypercall_buffer_t *dirty_pfns,
+                                    unsigned long *nr_dirty_pfns,
+                                    unsigned long start_pfn,
+                                    unsigned long pages, unsigned int mode,
+                                    xc_shadow_op_stats_t *stats)
+{
+    struct fake_domain *d = get_domain(domid);
+    uint64_t *list = dirty_pfns ? dirty_pfns->hbuf : NULL;
+    unsigned long *bitmap = dirty_bitmap ? dirty_bitmap->hbuf : NULL;
+    unsigned long pfn, end, found = 0;
+
+    if ( !d || (!list && (start_pfn & 7)) )
+    {
+        errno = EINVAL;
+        return -1;
+    }
+
+    if ( !d->suspended && sop == XEN_DOMCTL_SHADOW_OP_CLEAN &&
+         start_pfn == 0 )
+        dirty_domain(d);
+
+    end = min(start_pfn + pages, d->nr_pfns);
+    for ( pfn = start_pfn; pfn < end; ++pfn )
+    {
+        bool dirty = bench_test_bit(pfn, d->dirty);
+
+        if ( dirty && list )
+        {
+            if ( found == *nr_dirty_pfns )
+                break;
+            list[found] = pfn;
+        }
+        else if ( bitmap )
+        {
+            if ( dirty )
+                bench_set_bit(pfn, bitmap);
+            else
+                bench_clear_bit(pfn, bitmap);
+        }
+
+        found += dirty;
+        if ( dirty && sop == XEN_DOMCTL_SHADOW_OP_CLEAN )
+            bench_clear_bit(pfn, d->dirty);
+    }
+
+    if ( list )
+        *nr_dirty_pfns = found;
+
+    if ( stats )
+    {
+        stats->dirty_count = found;
+        stats->fault_count = 0;
+    }
+
+    return pfn - start_pfn;
+}
+
+int xc_get_pfn_type_batch(xc_interface *xch, uint32_t dom,
+                          unsigned int num, xen_pfn_t *arr)
+{
+    struct fake_domain *d = get_domain(dom);
+    unsigned int i;
+
+    if ( !d )
+        return -1;
+
+    for ( i = 0; i < num; ++i )
+        arr[i] = arr[i] < d->nr_pfns ? XEN_DOMCTL_PFINFO_NOTAB
+                                     : XEN_DOMCTL_PFINFO_XTAB;
+
+    return 0;
+}
+
+void *xenforeignmemory_map(xenforeignmemory_handle *fmem, uint32_t dom,
+                           int prot, size_t pages,
+                           const xen_pfn_t arr[], int err[])
+{
+    struct fake_domain *d = get_domain(dom);
+    uint8_t *addr, *p;
+    size_t i, run;
+
+    if ( !d )
+        return NULL;
+
+    addr = mmap(NULL, pages * BENCH_PAGE_SIZE, PROT_NONE,
+                MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if ( addr == MAP_FAILED )
+        return NULL;
+
+    /* Map each run of contiguous, populated gfns with a single mmap(). */
+    for ( i = 0; i < pages; i += run )
+    {
+        err[i] = 0;
+        if ( arr[i] >= d->nr_pfns || !bench_test_bit(arr[i], d->populated) )
+        {
+            err[i] = -EINVAL;
+            run = 1;
+            continue;
+        }
+
+        for ( run = 1; i + run < pages; ++run )
+        {
+            if ( arr[i + run] != arr[i] + run || arr[i + run] >= d->nr_pfns ||
+                 !bench_test_bit(arr[i + run], d->populated) )
+                break;
+            err[i + run] = 0;
+        }
+
+        p = mmap(addr + i * BENCH_PAGE_SIZE, run * BENCH_PAGE_SIZE, prot,
+                 MAP_SHARED | MAP_FIXED, d->memfd, arr[i] * BENCH_PAGE_SIZE);
+        if ( p == MAP_FAILED )
+        {
+            munmap(addr, pages * BENCH_PAGE_SIZE);
+            return NULL;
+        }
+    }
+
+    return addr;
+}
+
+static void *ring_page;
+
+int xenforeignmemory_unmap(xenforeignmemory_handle *fmem,
+                           void *addr, size_t pages)
+{
+    /* The guest thread may still be looking at the ring. */
+    if ( addr == ring_page )
+        return 0;
+
+    return munmap(addr, pages * BENCH_PAGE_SIZE);
+}
+
+void *xc__hypercall_buffer_alloc_pages(xc_interface *xch,
+                                       xc_hypercall_buffer_t *b, int nr_pages)
+{
+    void *p = mmap(NULL, nr_pages * BENCH_PAGE_SIZE, PROT_READ | PROT_WRITE,
+                   MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+    if ( p == MAP_FAILED )
+        return NULL;
+
+    b->hbuf = p;
+
+    return p;
+}
+
+void xc__hypercall_buffer_free_pages(xc_interface *xch,
+                                     xc_hypercall_buffer_t *b, int nr_pages)
+{
+    munmap(b->hbuf, nr_pages * BENCH_PAGE_SIZE);
+}
+
+int xc_domain_populate_physmap_exact(xc_interface *xch, uint32_t domid,
+                                     unsigned long nr_extents,
+                                     unsigned int extent_order,
+                                     unsigned int mem_flags,
+                                     xen_pfn_t *extent_start)
+{
+    struct fake_domain *d = get_domain(domid);
+    unsigned long i, j;
+
+    if ( !d )
+        return -1;
+
+    for ( i = 0; i < nr_extents; ++i )
+    {
+        for ( j = 0; j < (1UL << extent_order); ++j )
+        {
+            if ( extent_start[i] + j >= d->nr_pfns )
+            {
+                errno = EINVAL;
+                return -1;
+            }
+            bench_set_bit(extent_start[i] + j, d->populated);
+        }
+    }
+
+    return 0;
+}
+
+int xc_domain_populate_physmap(xc_interface *xch, uint32_t domid,
+                               unsigned long nr_extents,
+                               unsigned int extent_order,
+                               unsigned int mem_flags,
+                               xen_pfn_t *extent_start)
+{
+    if ( xc_domain_populate_physmap_exact(xch, domid, nr_extents,
+                                          extent_order, mem_flags,
+                                          extent_start) )
+        return -1;
+
+    return nr_extents;
+}
+
+int xc_hvm_param_get(xc_interface *handle, uint32_t dom, uint32_t param,
+                     uint64_t *value)
+{
+    struct fake_domain *d = get_domain(dom);
+
+    /* Keep the paging ring clear of guest memory. */
+    *value = param == HVM_PARAM_PAGING_RING_PFN && d ? d->nr_pfns : 0;
+
+    return 0;
+}
+
+int xc_hvm_param_set(xc_interface *handle, uint32_t dom, uint32_t param,
+                     uint64_t value)
+{
+    return 0;
+}
+
+int xc_domain_hvm_getcontext(xc_interface *xch, uint32_t domid,
+                             uint8_t *ctxt_buf, uint32_t size)
+{
+    if ( ctxt_buf )
+        memset(ctxt_buf, 0xa5, size);
+
+    return 64;
+}
+
+int xc_domain_hvm_setcontext(xc_interface *xch, uint32_t domid,
+                             uint8_t *hvm_ctxt, uint32_t size)
+{
+    return 0;
+}
+
+int xc_domain_get_tsc_info(xc_interface *xch, uint32_t domid,
+                           uint32_t *tsc_mode, uint64_t *elapsed_nsec,
+                           uint32_t *gtsc_khz, uint32_t *incarnation)
+{
+    *tsc_mode = 0;
+    *elapsed_nsec = 0;
+    *gtsc_khz = 1000000;
+    *incarnation = 0;
+
+    return 0;
+}
+
+int xc_domain_set_tsc_info(xc_interface *xch, uint32_t domid,
+                           uint32_t tsc_mode, uint64_t elapsed_nsec,
+                           uint32_t gtsc_khz, uint32_t incarnation)
+{
+    return 0;
+}
+
+int xc_clear_domain_pages(xc_interface *xch, uint32_t domid,
+                          unsigned long dst_pfn, int num)
+{
+    return 0;
+}
+
+int xc_dom_gnttab_seed(xc_interface *xch, uint32_t guest_domid, bool is_hvm,
+                       xen_pfn_t console_gfn, xen_pfn_t xenstore_gfn,
+                       uint32_t console_domid, uint32_t xenstore_domid)
+{
+    return 0;
+}
+
+int xc_cpu_policy_get_size(xc_interface *xch, uint32_t *nr_leaves,
+                           uint32_t *nr_msrs)
+{
+    *nr_leaves = 1;
+    *nr_msrs = 1;
+
+    return 0;
+}
+
+int xc_cpu_policy_get_domain(xc_interface *xch, uint32_t domid,
+                             xc_cpu_policy_t *policy)
+{
+    return 0;
+}
+
+int xc_cpu_policy_serialise(xc_interface *xch, const xc_cpu_policy_t *policy,
+                            xen_cpuid_leaf_t *leaves, uint32_t *nr_leaves,
+                            xen_msr_entry_t *msrs, uint32_t *nr_msrs)
+{
+    *nr_leaves = 0;
+    *nr_msrs = 0;
+
+    return 0;
+}
+
+int xc_domain_decrease_reservation_exact(xc_interface *xch, uint32_t domid,
+                                         unsigned long nr_extents,
+                                         unsigned int extent_order,
+                                         xen_pfn_t *extent_start)
+{
+    struct fake_domain *d = get_domain(domid);
+    unsigned long i;
+
+    if ( !d || extent_order )
+        return -1;
+
+    for ( i = 0; i < nr_extents; ++i )
+    {
+        if ( extent_start[i] >= d->nr_pfns )
+        {
+            errno = EINVAL;
+            return -1;
+        }
+
+        bench_clear_bit(extent_start[i], d->populated);
+        paged_set(d, extent_start[i], false);
+        memset(d->mem + extent_start[i] * BENCH_PAGE_SIZE, 0,
+               BENCH_PAGE_SIZE);
+    }
+
+    return 0;
+}
+
+/*
+ * The mem_paging ring, and its event channel.  Notifications from the guest
+ * to the pager are bytes on evtchn_pipe, and those back on resume_pipe.
+ */
+static int evtchn_pipe[2], resume_pipe[2];
+static bool paging_disabled;
+
+void *xc_vm_event_enable(xc_interface *xch, uint32_t domain_id, int param,
+                         uint32_t *port)
+{
+    if ( param != HVM_PARAM_PAGING_RING_PFN || !get_domain(domain_id) )
+    {
+        errno = EINVAL;
+        return NULL;
+    }
+
+    ring_page = aligned_alloc(XC_PAGE_SIZE, XC_PAGE_SIZE);
+    if ( !ring_page )
+        return NULL;
+
+    *port = 1;
+
+    return ring_page;
+}
+
+/* As Xen does, let go of any vcpus still waiting on the ring. */
+int xc_mem_paging_disable(xc_interface *xch, uint32_t domain_id)
+{
+    char c = 0;
+
+    __atomic_store_n(&paging_disabled, true, __ATOMIC_RELEASE);
+
+    return write(resume_pipe[1], &c, 1) == 1 ? 0 : -1;
+}
+
+int xc_mem_paging_populate_evicted(xc_interface *xch, uint32_t domain_id,
+                                   uint64_t gfn)
+{
+    struct fake_domain *d = get_domain(domain_id);
+
+    if ( !d || gfn >= d->nr_pfns || bench_test_bit(gfn, d->populated) )
+    {
+        errno = EBUSY;
+        return -1;
+    }
+
+    paged_set(d, gfn, true);
+
+    return 0;
+}
+
+int xc_mem_paging_load(xc_interface *xch, uint32_t domain_id,
+                       uint64_t gfn, void *buffer)
+{
+    struct fake_domain *d = get_domain(domain_id);
+
+    if ( !d || gfn >= d->nr_pfns || !paged_test(d, gfn) )
+    {
+        errno = ENOENT;
+        return -1;
+    }
+
+    memcpy(d->mem + gfn * BENCH_PAGE_SIZE, buffer, BENCH_PAGE_SIZE);
+    bench_set_bit(gfn, d->populated);
+    paged_set(d, gfn, false);
+
+    return 0;
+}
+
+xenevtchn_handle *xenevtchn_open(struct xentoollog_logger *logger,
+                                 unsigned int open_flags)
+{
+    return (xenevtchn_handle *)&evtchn_pipe;
+}
+
+int xenevtchn_close(xenevtchn_handle *xce)
+{
+    return 0;
+}
+
+int xenevtchn_fd(xenevtchn_handle *xce)
+{
+    return evtchn_pipe[0];
+}
+
+int xenevtchn_notify(xenevtchn_handle *xce, evtchn_port_t port)
+{
+    char c = 0;
+
+    return write(resume_pipe[1], &c, 1) == 1 ? 0 : -1;
+}
+
+xenevtchn_port_or_error_t
+xenevtchn_bind_interdomain(xenevtchn_handle *xce, uint32_t domid,
+                           evtchn_port_t remote_port)
+{
+    return 1;
+}
+
+int xenevtchn_unbind(xenevtchn_handle *xce, evtchn_port_t port)
+{
+    return 0;
+}
+
+xenevtchn_port_or_error_t xenevtchn_pending(xenevtchn_handle *xce)
+{
+    char c;
+
+    return read(evtchn_pipe[0], &c, 1) == 1 ? 1 : -1;
+}
+
+int xenevtchn_unmask(xenevtchn_handle *xce, evtchn_port_t port)
+{
+    return 0;
+}
+
+/*
+ * A vcpu of the guest resumed for post-copy.  Reads random pages, faulting on
+ * those still paged out, and checks each against the source.
+ */
+static bool guest_stop;
+
+static void guest_fault(vm_event_front_ring_t *front, unsigned long pfn)
+{
+    vm_event_request_t *req;
+    vm_event_response_t *rsp;
+    double t = now();
+    char c = 0;
+
+    req = RING_GET_REQUEST(front, front->req_prod_pvt);
+    memset(req, 0, sizeof(*req));
+    req->version = VM_EVENT_INTERFACE_VERSION;
+    req->reason = VM_EVENT_REASON_MEM_PAGING;
+    req->flags = VM_EVENT_FLAG_VCPU_PAUSED;
+    req->u.mem_paging.gfn = pfn;
+    front->req_prod_pvt++;
+    RING_PUSH_REQUESTS(front);
+
+    if ( write(evtchn_pipe[1], &c, 1) != 1 )
+        err(1, "guest notify");
+
+    while ( !RING_HAS_UNCONSUMED_RESPONSES(front) )
+    {
+        if ( __atomic_load_n(&paging_disabled, __ATOMIC_ACQUIRE) )
+            return;
+
+        if ( read(resume_pipe[0], &c, 1) != 1 )
+            err(1, "guest wait");
+    }
+
+    rsp = RING_GET_RESPONSE(front, front->rsp_cons);
+    if ( rsp->u.mem_paging.gfn != pfn ||
+         !(rsp->flags & VM_EVENT_FLAG_VCPU_PAUSED) )
+        errx(1, "Bad paging response for pfn %#lx", pfn);
+    front->rsp_cons++;
+
+    t = now() - t;
+    fault_wait += t;
+    if ( t > fault_wait_max )
+        fault_wait_max = t;
+    guest_faults++;
+}
+
+static void *guest_thread(void *arg)
+{
+    vm_event_front_ring_t front;
+    unsigned int seed = 3;
+    unsigned long pfn;
+
+    FRONT_RING_INIT(&front, (vm_event_sring_t *)ring_page, XC_PAGE_SIZE);
+
+    while ( !__atomic_load_n(&guest_stop, __ATOMIC_ACQUIRE) )
+    {
+        pfn = ((unsigned long)rand_r(&seed) << 16 ^ rand_r(&seed)) %
+            dst.nr_pfns;
+
+        if ( paged_test(&dst, pfn) )
+            guest_fault(&front, pfn);
+
+        if ( paged_test(&dst, pfn) )
+            errx(1, "pfn %#lx still paged out after resume", pfn);
+
+        guest_bad += !!memcmp(src.mem + pfn * BENCH_PAGE_SIZE,
+                              dst.mem + pfn * BENCH_PAGE_SIZE,
+                              BENCH_PAGE_SIZE);
+        guest_reads++;
+    }
+
+    return NULL;
+}
+
+/*
+ * Callbacks.
+ */
+static int suspend_cb(void *data)
+{
+    src.suspended = true;
+
+    return 1;
+}
+
+static int switch_qemu_logdirty_cb(uint32_t domid, unsigned int enable,
+                                   void *data)
+{
+    return 0;
+}
+
+static int precopy_policy_cb(struct precopy_stats stats, void *data)
+{
+    double t = now();
+
+    if ( stats.dirty_count >= 0 && nr_iters < ARRAY_SIZE(iters) )
+    {
+        iters[nr_iters].pages = stats.dirty_count;
+        iters[nr_iters].start = t;
+    }
+    else if ( stats.dirty_count < 0 && nr_iters < ARRAY_SIZE(iters) )
+        iters[nr_iters++].end = t;
+
+    if ( stats.dirty_count >= 0 && stats.dirty_count < 50 )
+        return XGS_POLICY_STOP_AND_COPY;
+
+    if ( stats.iteration < max_iters )
+        return XGS_POLICY_CONTINUE_PRECOPY;
+
+    if ( !postcopy )
+        return XGS_POLICY_STOP_AND_COPY;
+
+    /*
+     * Only dirtying at each logdirty round, the fake guest would leave
+     * nothing for post-copy if it were chosen before the last one.
+     */
+    return stats.dirty_count < 0 ? XGS_POLICY_CONTINUE_PRECOPY
+                                 : XGS_POLICY_POSTCOPY;
+}
+
+/*
+ * Stream relay, optionally limited to link_mbps, and copying the stream to
+ * tee_fd if set.
+ */
+#define RELAY_BUF_SIZE (1 << 20)
+
+/* One relay per stream, each limited to link_mbps separately. */
+struct relay {
+    int in, out;
+    bool tee;
+    unsigned long long bytes;
+};
+
+static void *relay_thread(void *arg)
+{
+    struct relay *r = arg;
+    uint8_t *buf = malloc(RELAY_BUF_SIZE);
+    double start = now();
+    ssize_t len, done, ret;
+
+    if ( !buf )
+        err(1, "relay buffer");
+
+    while ( (len = read(r->in, buf, RELAY_BUF_SIZE)) != 0 )
+    {
+        if ( len < 0 )
+        {
+            if ( errno == EINTR )
+                continue;
+            err(1, "relay read");
+        }
+
+        for ( done = 0; done < len; done += ret )
+        {
+            ret = write(r->out, buf + done, len - done);
+            if ( ret < 0 )
+                err(1, "relay write");
+        }
+
+        for ( done = 0; r->tee && tee_fd >= 0 && done < len; done += ret )
+        {
+            ret = write(tee_fd, buf + done, len - done);
+            if ( ret < 0 )
+                err(1, "stream copy write");
+        }
+
+        r->bytes += len;
+
+        if ( link_mbps )
+        {
+            double due = start + r->bytes / (link_mbps * 1e6 / 8);
+            double delay = due - now();
+
+            if ( delay > 0 )
+                usleep(delay * 1e6);
+        }
+    }
+
+    close(r->out);
+    free(buf);
+
+    return NULL;
+}
+
+struct restore_args {
+    xc_interface *xch;
+    int fd, send_back_fd;
+    const int *stripe_fds;
+    unsigned int nr_stripe_fds;
+    int rc;
+    double resumed;
+    pthread_t guest_tid;
+    bool guest_started;
+};
+
+static int restore_postcopy_cb(void *data)
+{
+    struct restore_args *ra = data;
+
+    ra->resumed = now();
+
+    /* Nothing outstanding means no ring. */
+    if ( !ring_page )
+        return 1;
+
+    if ( pthread_create(&ra->guest_tid, NULL, guest_thread, NULL) )
+        return 0;
+
+    ra->guest_started = true;
+
+    return 1;
+}
+
+static void restore_results_cb(xen_pfn_t store_gfn, xen_pfn_t console_gfn,
+                               void *data)
+{
+}
+
+static void *restore_thread(void *arg)
+{
+    struct restore_args *ra = arg;
+    struct restore_callbacks cb = {
+        .postcopy = restore_postcopy_cb,
+        .restore_results = restore_results_cb,
+        .stripe_fds = ra->stripe_fds,
+        .nr_stripe_fds = ra->nr_stripe_fds,
+        .data = ra,
+    };
+    unsigned long store_gfn, console_gfn;
+
+    ra->rc = xc_domain_restore(ra->xch, ra->fd, RESTORE_DOMID,
+                               0, &store_gfn, 0, 0, &console_gfn, 0,
+                               XC_STREAM_PLAIN, &cb, ra->send_back_fd);
+
+    if ( ra->guest_started )
+    {
+        __atomic_store_n(&guest_stop, true, __ATOMIC_RELEASE);
+        pthread_join(ra->guest_tid, NULL);
+    }
+
+    return NULL;
+}
+
+static xc_interface *fake_interface(xentoollog_logger *lg)
+{
+    xc_interface *xch = calloc(1, sizeof(*xch));
+
+    if ( !xch )
+        err(1, "calloc");
+
+    xch->error_handler = lg;
+    xch->dombuild_logger = lg;
+    /* Never dereferenced; the foreign memory calls above are fakes. */
+    xch->fmem = (xenforeignmemory_handle *)xch;
+
+    return xch;
+}
+
+static unsigned long verify(void)
+{
+    static const uint8_t zero[BENCH_PAGE_SIZE];
+    unsigned long pfn, bad = 0;
+
+    for ( pfn = 0; pfn < src.nr_pfns; ++pfn )
+    {
+        const uint8_t *s = src.mem + pfn * BENCH_PAGE_SIZE;
+
+        if ( bench_test_bit(pfn, dst.populated) )
+            bad += !!memcmp(s, dst.mem + pfn * BENCH_PAGE_SIZE,
+                            BENCH_PAGE_SIZE);
+        else
+            bad += !!memcmp(s, zero, BENCH_PAGE_SIZE);
+    }
+
+    return bad;
+}
+
+static void usage(const char *prog)
+{
+    fprintf(stderr,
+            "Usage: %s [options]\n"
+            "  -m MB    guest memory size (default %lu)\n"
+            "  -z PCT   percentage of zero pages (default %u)\n"
+            "  -t PCT   percentage of compressible text pages (default %u)\n"
+            "  -c ALG   compress page data with ALG (lz4 or zstd)\n"
+            "  -d N     pages dirtied per precopy iteration (default %lu)\n"
+            "  -r PPS   also dirty PPS pages/s while running (default 0)\n"
+            "  -s PCT   percentage of dirtied pages left unchanged (default %u)\n"
+            "  -u       elide pages unchanged since they were last sent\n"
+            "  -i N     maximum precopy iterations (default %u)\n"
+            "  -l MBPS  limit each stream to MBPS megabits/s (default unlimited)\n"
+            "  -w FILE  also write the stream to FILE\n"
+            "  -n       non-live save\n"
+            "  -p       post-copy once the precopy iterations run out\n"
+            "  -a       use the built-in adaptive precopy policy\n"
+            "  -D MS    maximum downtime for -a (default libxenguest's)\n"
+            "  -T       fail unless -a throttled the domain\n"
+            "  -R N     entries in the dirty ring, 0 for none (default %lu)\n"
+            "  -S N     stripe page data over N further streams\n"
+            "  -v       verbose libxenguest logging\n",
+            prog, mem_mb, zero_pct, text_pct, dirty_pages, same_pct,
+            max_iters, ring_size);
+    exit(2);
+}
+
+int main(int argc, char **argv)
+{
+    xentoollog_logger *lg;
+    xc_interface *save_xch, *restore_xch;
+    struct save_callbacks cb = {
+        .suspend = suspend_cb,
+        .switch_qemu_logdirty = switch_qemu_logdirty_cb,
+        .precopy_policy = precopy_policy_cb,
+    };
+    int save_pipe[2], restore_pipe[2], back_pipe[2] = { -1, -1 };
+    int main_save_fd = -1, main_restore_fd = -1;
+    int *stripe_save_fds = NULL, *stripe_restore_fds = NULL;
+    struct relay *relays;
+    struct restore_args ra = {};
+    pthread_t *relay_tids, restore_tid;
+    struct rusage ru;
+    double start, end, cpu;
+    unsigned long nr_pfns, bad;
+    unsigned int i;
+    int opt, rc;
+
+    while ( (opt = getopt(argc, argv, "m:z:t:c:d:r:s:ui:l:w:npaD:TR:S:v")) != -1 )
+    {
+        switch ( opt )
+        {
+        case 'm': mem_mb = strtoul(optarg, NULL, 0); break;
+        case 'z': zero_pct = strtoul(optarg, NULL, 0); break;
+        case 't': text_pct = strtoul(optarg, NULL, 0); break;
+        case 'c':
+            if ( !strcmp(optarg, "lz4") )
+                save_flags |= XCFLAGS_COMPRESS_LZ4;
+            else if ( !strcmp(optarg, "zstd") )
+                save_flags |= XCFLAGS_COMPRESS_ZSTD;
+            else
+                usage(argv[0]);
+            break;
+        case 'd': dirty_pages = strtoul(optarg, NULL, 0); break;
+        case 'r': dirty_rate = strtoul(optarg, NULL, 0); break;
+        case 's': same_pct = strtoul(optarg, NULL, 0); break;
+        case 'u': save_flags |= XCFLAGS_ELIDE_UNCHANGED; break;
+        case 'i': max_iters = strtoul(optarg, NULL, 0); break;
+        case 'l': link_mbps = strtoul(optarg, NULL, 0); break;
+        case 'w':
+            tee_fd = open(optarg, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+            if ( tee_fd < 0 )
+                err(1, "%s", optarg);
+            break;
+        case 'n': live = false; break;
+        case 'p': postcopy = true; break;
+        case 'a': adaptive = true; break;
+        case 'D': max_downtime_ms = strtoul(optarg, NULL, 0); break;
+        case 'T': expect_throttle = true; break;
+        case 'R': ring_size = strtoul(optarg, NULL, 0); break;
+        case 'S': nr_stripes = strtoul(optarg, NULL, 0); break;
+        case 'v': verbose++; break;
+        default: usage(argv[0]);
+        }
+    }
+
+    if ( !mem_mb || zero_pct + text_pct > 100 || (postcopy && !live) ||
+         (expect_throttle && !adaptive) )
+        usage(argv[0]);
+
+    nr_pfns = (mem_mb << 20) / BENCH_PAGE_SIZE;
+
+    printf("Guest: %lu MB, %u%% zero pages, %u%% text pages, "
+           "%lu pages dirtied/iteration\n",
+           mem_mb, zero_pct, text_pct, dirty_pages);
+
+    init_domain(&src, SAVE_DOMID, nr_pfns, true);
+    init_domain(&dst, RESTORE_DOMID, nr_pfns, false);
+
+    lg = (xentoollog_logger *)xtl_createlogger_stdiostream(
+        stderr, verbose > 1 ? XTL_DEBUG : verbose ? XTL_DETAIL : XTL_ERROR,
+        0);
+    if ( !lg )
+        errx(1, "Unable to create logger");
+
+    save_xch = fake_interface(lg);
+    restore_xch = fake_interface(lg);
+
+    relays = calloc(nr_stripes + 1, sizeof(*relays));
+    relay_tids = calloc(nr_stripes + 1, sizeof(*relay_tids));
+    if ( nr_stripes )
+    {
+        stripe_save_fds = calloc(nr_stripes, sizeof(*stripe_save_fds));
+        stripe_restore_fds = calloc(nr_stripes, sizeof(*stripe_restore_fds));
+    }
+    if ( !relays || !relay_tids ||
+         (nr_stripes && (!stripe_save_fds || !stripe_restore_fds)) )
+        err(1, "calloc");
+
+    /* Relay 0 carries the main stream, and the others the further ones. */
+    for ( i = 0; i <= nr_stripes; ++i )
+    {
+        if ( pipe(save_pipe) || pipe(restore_pipe) )
+            err(1, "pipe");
+
+        /* Larger pipes reduce the number of context switches per batch. */
+        fcntl(save_pipe[1], F_SETPIPE_SZ, 1 << 20);
+        fcntl(restore_pipe[1], F_SETPIPE_SZ, 1 << 20);
+
+        relays[i].in = save_pipe[0];
+        relays[i].out = restore_pipe[1];
+        relays[i].tee = !i;
+
+        if ( i )
+        {
+            stripe_save_fds[i - 1] = save_pipe[1];
+            stripe_restore_fds[i - 1] = restore_pipe[0];
+        }
+        else
+        {
+            main_save_fd = save_pipe[1];
+            main_restore_fd = restore_pipe[0];
+        }
+    }
+
+    cb.stripe_fds = stripe_save_fds;
+    cb.nr_stripe_fds = nr_stripes;
+
+    if ( adaptive )
+    {
+        /* The per-iteration table below needs the bench's own policy. */
+        cb.precopy_policy = NULL;
+        cb.max_downtime_ms = max_downtime_ms;
+        save_flags |= XCFLAGS_ADAPTIVE_PRECOPY;
+    }
+
+    if ( postcopy )
+    {
+        if ( pipe(back_pipe) || pipe(evtchn_pipe) || pipe(resume_pipe) )
+            err(1, "pipe");
+
+        save_flags |= XCFLAGS_POSTCOPY;
+    }
+
+    ra.xch = restore_xch;
+    ra.fd = main_restore_fd;
+    ra.send_back_fd = back_pipe[1];
+    ra.stripe_fds = stripe_restore_fds;
+    ra.nr_stripe_fds = nr_stripes;
+
+    start = dirtied = now();
+
+    for ( i = 0; i <= nr_stripes; ++i )
+        if ( pthread_create(&relay_tids[i], NULL, relay_thread, &relays[i]) )
+            errx(1, "Unable to create threads");
+
+    if ( pthread_create(&restore_tid, NULL, restore_thread, &ra) )
+        errx(1, "Unable to create threads");
+
+    rc = xc_domain_save(save_xch, main_save_fd, SAVE_DOMID,
+                        save_flags | (live ? XCFLAGS_LIVE : 0), &cb,
+                        XC_STREAM_PLAIN, back_pipe[0]);
+    close(main_save_fd);
+    for ( i = 0; i < nr_stripes; ++i )
+        close(stripe_save_fds[i]);
+
+    for ( i = 0; i <= nr_stripes; ++i )
+    {
+        pthread_join(relay_tids[i], NULL);
+        stream_bytes += relays[i].bytes;
+    }
+    pthread_join(restore_tid, NULL);
+    end = now();
+
+    if ( rc || ra.rc )
+        errx(1, "Migration failed: save %d, restore %d", rc, ra.rc);
+
+    getrusage(RUSAGE_SELF, &ru);
+    cpu = ru.ru_utime.tv_sec + ru.ru_utime.tv_usec / 1e6 +
+          ru.ru_stime.tv_sec + ru.ru_stime.tv_usec / 1e6;
+
+    for ( i = 0; i < nr_iters; ++i )
+    {
+        double t = iters[i].end - iters[i].start;
+
+        printf("  iteration %2u: %9lu pages in %8.3f ms (%8.1f MB/s)\n",
+               i, iters[i].pages, t * 1e3,
+               t > 0 ? iters[i].pages * BENCH_PAGE_SIZE / t / 1e6 : 0.0);
+    }
+
+    printf("Total: %.3f s, stream %llu bytes (%.1f MB/s of guest memory, "
+           "%.1f MB/s on the link)\n",
+           end - start, stream_bytes,
+           nr_pfns * BENCH_PAGE_SIZE / (end - start) / 1e6,
+           stream_bytes / (end - start) / 1e6);
+    printf("CPU: %.3f s (%.3f s per GB of guest memory)\n",
+           cpu, cpu / (nr_pfns * BENCH_PAGE_SIZE / 1e9));
+
+    for ( i = 0; nr_stripes && i <= nr_stripes; ++i )
+        printf("  stream %u: %llu bytes\n", i, relays[i].bytes);
+
+    if ( postcopy && ra.resumed )
+    {
+        printf("Post-copy: resumed after %.3f s, guest read %lu pages, "
+               "faulting on %lu (mean wait %.3f ms, max %.3f ms)\n",
+               ra.resumed - start, guest_reads, guest_faults,
+               guest_faults ? fault_wait / guest_faults * 1e3 : 0.0,
+               fault_wait_max * 1e3);
+
+        if ( guest_bad )
+        {
+            printf("FAIL: guest read %lu pages differing from the source\n",
+                   guest_bad);
+            return 1;
+        }
+    }
+
+    if ( live && ring_size )
+        printf("Dirty ring: drained %lu times, overflowed %lu times\n",
+               ring_drains, ring_overflows);
+
+    if ( adaptive )
+    {
+        printf("Throttling: scheduler cap changed %u times, lowest %u%%\n",
+               sched_cap_changes,
+               sched_cap_changes ? sched_cap_min : 0);
+
+        if ( sched_cap )
+        {
+            printf("FAIL: scheduler cap left at %u%%\n", sched_cap);
+            return 1;
+        }
+
+        if ( expect_throttle && !sched_cap_changes )
+        {
+            printf("FAIL: domain not throttled\n");
+            return 1;
+        }
+    }
+
+    bad = verify();
+    if ( bad )
+    {
+        printf("FAIL: %lu pages differ after restore\n", bad);
+        return 1;
+    }
+
+    printf("PASS: guest memory identical after restore\n");
+
+    return 0;
+}
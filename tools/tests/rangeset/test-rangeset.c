@@ -0,0 +1,499 @@
+/*
+ * Unit tests and lookup benchmark for the rangeset code.
+ *
+ * The operations are checked against a bitmap of the numbers contained in
+ * the set, and the lookup benchmark compares the rangeset with a plain walk
+ * of an ordered list of ranges, as done by the former implementation.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms and conditions of the GNU General Public
+ * License, version 2, as published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public
+ * License along with this program; If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <time.h>
+#include <unistd.h>
+
+#include "harness.h"
+
+#define UNIVERSE   1024
+#define MODEL_SIZE (4 * UNIVERSE)
+#define NR_OPS     20000
+
+static struct domain dom;
+static unsigned int nr_failures;
+
+#define fail(fmt, ...)                                          \
+({                                                              \
+    nr_failures++;                                              \
+    printf("FAIL %s:%d: " fmt "\n", __func__, __LINE__,         \
+           ##__VA_ARGS__);                                      \
+    false;                                                      \
+})
+
+/*
+ * Model of a rangeset: numbers base ... base + MODEL_SIZE - 1 are tracked in
+ * a bitmap, all others must not be in the set.
+ */
+struct model {
+    unsigned long base;
+    bool in[MODEL_SIZE];
+};
+
+struct collect {
+    unsigned int nr;
+    unsigned long s[MODEL_SIZE], e[MODEL_SIZE];
+};
+
+static int cf_check collect_range(unsigned long s, unsigned long e,
+                                  void *data)
+{
+    struct collect *c = data;
+
+    if ( c->nr == MODEL_SIZE )
+        return -E2BIG;
+    c->s[c->nr] = s;
+    c->e[c->nr] = e;
+    c->nr++;
+
+    return 0;
+}
+
+/* Compare the ranges reported for s ... e with the model. */
+static bool check_report(struct rangeset *r, const struct model *m,
+                         unsigned long s, unsigned long e)
+{
+    static struct collect c;
+    unsigned int i, n = 0;
+    unsigned long off, first, last;
+
+    c.nr = 0;
+    if ( rangeset_report_ranges(r, s, e, collect_range, &c) )
+        return fail("report %#lx-%#lx failed", s, e);
+
+    for ( i = 0; i < c.nr; i++ )
+    {
+        if ( c.s[i] < s || c.e[i] > e || c.s[i] > c.e[i] )
+            return fail("range %#lx-%#lx outside of %#lx-%#lx",
+                        c.s[i], c.e[i], s, e);
+        if ( c.s[i] < m->base || c.e[i] - m->base >= MODEL_SIZE )
+            return fail("range %#lx-%#lx outside of model", c.s[i], c.e[i]);
+        /* Adjacent ranges must have been merged. */
+        if ( i && c.s[i] <= c.e[i - 1] + 1 )
+            return fail("range %#lx-%#lx not merged with %#lx-%#lx",
+                        c.s[i], c.e[i], c.s[i - 1], c.e[i - 1]);
+    }
+
+    if ( e < m->base || s > m->base + MODEL_SIZE - 1 )
+        return true;
+
+    first = max(s, m->base) - m->base;
+    last = min(e, m->base + MODEL_SIZE - 1) - m->base;
+
+    for ( off = first; off <= last; off++ )
+    {
+        unsigned long v = m->base + off;
+
+        while ( n < c.nr && c.e[n] < v )
+            n++;
+        if ( m->in[off] != (n < c.nr && c.s[n] <= v) )
+            return fail("%#lx: expected %s", v,
+                        m->in[off] ? "present" : "absent");
+    }
+
+    return true;
+}
+
+static void model_set(struct model *m, unsigned long s, unsigned long e,
+                      bool in)
+{
+    unsigned long off;
+
+    for ( off = s - m->base; off <= e - m->base; off++ )
+        m->in[off] = in;
+}
+
+static bool model_contains(const struct model *m, unsigned long s,
+                           unsigned long e)
+{
+    unsigned long off;
+
+    for ( off = s - m->base; off <= e - m->base; off++ )
+        if ( !m->in[off] )
+            return false;
+
+    return true;
+}
+
+static bool model_overlaps(const struct model *m, unsigned long s,
+                           unsigned long e)
+{
+    unsigned long off;
+
+    for ( off = s - m->base; off <= e - m->base; off++ )
+        if ( m->in[off] )
+            return true;
+
+    return false;
+}
+
+/* First fit search as done by rangeset_claim_range(), within the model. */
+static bool model_claim(const struct model *m, unsigned long size,
+                        unsigned long *s)
+{
+    unsigned long off, free = 0;
+
+    for ( off = 0; off < MODEL_SIZE; off++ )
+    {
+        free = m->in[off] ? 0 : free + 1;
+        if ( free == size )
+        {
+            *s = m->base + off - size + 1;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+static void random_range(const struct model *m, unsigned long *s,
+                         unsigned long *e)
+{
+    unsigned long a = rand() % UNIVERSE, len;
+
+    /* Mostly short ranges, sometimes longer ones merging many others. */
+    len = (rand() % 8) ? rand() % 8 : rand() % (UNIVERSE / 4);
+    if ( a + len >= UNIVERSE )
+        len = UNIVERSE - 1 - a;
+
+    *s = m->base + a;
+    *e = *s + len;
+}
+
+/* Apply random operations to a rangeset and the model. */
+static void test_random(unsigned long base, bool claim)
+{
+    static struct model m;
+    struct rangeset *r = rangeset_new(&dom, "random", 0);
+    unsigned long s, e;
+    unsigned int i;
+    int rc;
+
+    memset(&m, 0, sizeof(m));
+    m.base = base;
+
+    for ( i = 0; i < NR_OPS; i++ )
+    {
+        random_range(&m, &s, &e);
+
+        switch ( rand() % 8 )
+        {
+        case 0: case 1: case 2:
+            rc = rangeset_add_range(r, s, e);
+            if ( rc )
+                fail("add %#lx-%#lx: %d", s, e, rc);
+            model_set(&m, s, e, true);
+            break;
+
+        case 3: case 4:
+            rc = rangeset_remove_range(r, s, e);
+            if ( rc )
+                fail("remove %#lx-%#lx: %d", s, e, rc);
+            model_set(&m, s, e, false);
+            break;
+
+        case 5:
+            if ( rangeset_contains_range(r, s, e) != model_contains(&m, s, e) )
+                fail("contains %#lx-%#lx", s, e);
+            if ( rangeset_contains_singleton(r, s) != m.in[s - base] )
+                fail("contains %#lx", s);
+            break;
+
+        case 6:
+            if ( rangeset_overlaps_range(r, s, e) != model_overlaps(&m, s, e) )
+                fail("overlaps %#lx-%#lx", s, e);
+            break;
+
+        case 7:
+        {
+            unsigned long size = 1 + rand() % 16, start, expected;
+
+            if ( !claim )
+                break;
+
+            /* Keep the claimed ranges within the model. */
+            if ( !model_claim(&m, size, &expected) )
+                break;
+
+            rc = rangeset_claim_range(r, size, &start);
+            if ( rc )
+                fail("claim %lu: %d", size, rc);
+            else if ( start != expected )
+                fail("claim %lu: got %#lx expected %#lx",
+                     size, start, expected);
+            else
+                model_set(&m, start, start + size - 1, true);
+            break;
+        }
+        }
+
+        if ( !(i % 64) )
+        {
+            random_range(&m, &s, &e);
+            check_report(r, &m, s, e);
+        }
+        if ( !(i % 1024) && !check_report(r, &m, 0, ~0UL) )
+            break;
+    }
+
+    check_report(r, &m, 0, ~0UL);
+
+    rangeset_purge(r);
+    if ( !rangeset_is_empty(r) )
+        fail("not empty after purge");
+
+    rangeset_destroy(r);
+}
+
+static bool check_ranges(struct rangeset *r, const unsigned long *ranges,
+                         unsigned int nr)
+{
+    static struct collect c;
+    unsigned int i;
+
+    c.nr = 0;
+    if ( rangeset_report_ranges(r, 0, ~0UL, collect_range, &c) )
+        return fail("report failed");
+    if ( c.nr != nr )
+        return fail("%u ranges, expected %u", c.nr, nr);
+    for ( i = 0; i < nr; i++ )
+        if ( c.s[i] != ranges[2 * i] || c.e[i] != ranges[2 * i + 1] )
+            return fail("range %u is %#lx-%#lx, expected %#lx-%#lx", i,
+                        c.s[i], c.e[i], ranges[2 * i], ranges[2 * i + 1]);
+
+    return true;
+}
+
+static int cf_check consume_half(unsigned long s, unsigned long e,
+                                 void *ctxt, unsigned long *c)
+{
+    unsigned long *total = ctxt;
+
+    *c = (e - s) / 2 + 1;
+    *total += *c;
+
+    return 0;
+}
+
+static void test_misc(void)
+{
+    struct rangeset *a = rangeset_new(&dom, "a", RANGESETF_prettyprint_hex);
+    struct rangeset *b = rangeset_new(NULL, "b", 0);
+    unsigned long s, total = 0;
+    unsigned int i;
+
+    /* Limit on the number of ranges. */
+    rangeset_limit(a, 3);
+    if ( rangeset_add_range(a, 10, 19) || rangeset_add_range(a, 30, 39) ||
+         rangeset_add_range(a, 50, 59) )
+        fail("add within limit");
+    if ( rangeset_add_singleton(a, 70) != -ENOMEM )
+        fail("add beyond limit");
+    if ( rangeset_add_range(a, 20, 29) )
+        fail("merging add at limit");
+    if ( rangeset_add_singleton(a, 70) )
+        fail("add after merge");
+    check_ranges(a, (const unsigned long[]){ 10, 39, 50, 59, 70, 70 }, 3);
+    if ( rangeset_remove_range(a, 52, 55) != -ENOMEM )
+        fail("split beyond limit");
+
+    /* Claim at the top of the number space. */
+    if ( rangeset_add_range(b, 0, ~0UL - 16) ||
+         rangeset_claim_range(b, 16, &s) || s != ~0UL - 15 ||
+         rangeset_claim_range(b, 1, &s) != -ENOSPC )
+        fail("claim at the top");
+    check_ranges(b, (const unsigned long[]){ 0, ~0UL }, 1);
+    if ( rangeset_remove_singleton(b, ~0UL) ||
+         rangeset_remove_singleton(b, 0) ||
+         !rangeset_contains_range(b, 1, ~0UL - 1) )
+        fail("remove at the edges");
+    rangeset_purge(b);
+
+    /* Merge and swap. */
+    if ( rangeset_add_range(b, 40, 49) || rangeset_add_range(b, 60, 69) ||
+         rangeset_merge(b, a) )
+        fail("merge");
+    check_ranges(b, (const unsigned long[]){ 10, 70 }, 1);
+    rangeset_swap(a, b);
+    check_ranges(a, (const unsigned long[]){ 10, 70 }, 1);
+    check_ranges(b, (const unsigned long[]){ 10, 39, 50, 59, 70, 70 }, 3);
+
+    /* Consume, half of every range per call. */
+    if ( rangeset_consume_ranges(b, consume_half, &total) ||
+         !rangeset_is_empty(b) || total != 41 )
+        fail("consume (total %lu)", total);
+
+    rangeset_destroy(b);
+
+    /* Many ranges, added in descending order and removed every other one. */
+    b = rangeset_new(NULL, "many", 0);
+    for ( i = 2000; i-- > 0; )
+        if ( rangeset_add_range(b, i * 4, i * 4 + 1) )
+            fail("add %u", i);
+    for ( i = 0; i < 2000; i += 2 )
+        if ( rangeset_remove_range(b, i * 4, i * 4 + 1) )
+            fail("remove %u", i);
+    for ( i = 0; i < 8000; i++ )
+        if ( rangeset_contains_singleton(b, i) != ((i & 7) >= 4 && (i & 7) < 6) )
+            fail("contains %u", i);
+
+    rangeset_destroy(b);
+    /* a is destroyed with the domain. */
+}
+
+/* The former linked list implementation of rangeset lookups. */
+struct list_range {
+    struct list_head list;
+    unsigned long s, e;
+};
+
+static bool list_contains(struct list_head *head, unsigned long s)
+{
+    struct list_range *x = NULL, *y;
+
+    list_for_each_entry ( y, head, list )
+    {
+        if ( y->s > s )
+            break;
+        x = y;
+    }
+
+    return x && x->e >= s;
+}
+
+static double now(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static void bench(void)
+{
+    static const unsigned int sizes[] = { 16, 256, 1024, 4096, 16384 };
+    unsigned int i, n, hits;
+    unsigned long *keys;
+    double t, t_tree, t_list;
+
+    printf("%8s %12s %12s %12s\n", "ranges", "lookups", "tree ns/op",
+           "list ns/op");
+
+    for ( i = 0; i < ARRAY_SIZE(sizes); i++ )
+    {
+        unsigned int nr = sizes[i], nr_lookups = 1 << 22;
+        struct rangeset *r = rangeset_new(NULL, "bench", 0);
+        struct list_range *ranges = calloc(nr, sizeof(*ranges));
+        LIST_HEAD(list);
+
+        /* Keep the list walks to a sensible duration. */
+        if ( nr > 1024 )
+            nr_lookups = 1 << 16;
+
+        keys = malloc(nr_lookups * sizeof(*keys));
+        if ( !r || !ranges || !keys )
+        {
+            fail("out of memory");
+            return;
+        }
+
+        for ( n = 0; n < nr; n++ )
+        {
+            ranges[n].s = n * 16;
+            ranges[n].e = n * 16 + 7;
+            list_add_tail(&ranges[n].list, &list);
+            if ( rangeset_add_range(r, ranges[n].s, ranges[n].e) )
+                fail("add %u", n);
+        }
+        for ( n = 0; n < nr_lookups; n++ )
+            keys[n] = rand() % (nr * 16);
+
+        hits = 0;
+        t = now();
+        for ( n = 0; n < nr_lookups; n++ )
+            hits += rangeset_contains_singleton(r, keys[n]);
+        t_tree = now() - t;
+
+        t = now();
+        for ( n = 0; n < nr_lookups; n++ )
+            hits -= list_contains(&list, keys[n]);
+        t_list = now() - t;
+
+        if ( hits )
+            fail("tree and list lookups differ");
+
+        printf("%8u %12u %12.1f %12.1f\n", nr, nr_lookups,
+               t_tree * 1e9 / nr_lookups, t_list * 1e9 / nr_lookups);
+
+        rangeset_destroy(r);
+        free(ranges);
+        free(keys);
+    }
+}
+
+int main(int argc, char **argv)
+{
+    bool do_bench = false;
+    int opt;
+
+    while ( (opt = getopt(argc, argv, "b")) != -1 )
+    {
+        switch ( opt )
+        {
+        case 'b':
+            do_bench = true;
+            break;
+        default:
+            fprintf(stderr, "usage: %s [-b]\n", argv[0]);
+            return 2;
+        }
+    }
+
+    srand(1);
+    rangeset_domain_initialise(&dom);
+
+    test_random(0, true);
+    test_random(~0UL - MODEL_SIZE + 1, false);
+    test_misc();
+
+    rangeset_domain_destroy(&dom);
+
+    if ( do_bench )
+        bench();
+
+    if ( nr_failures )
+    {
+        printf("%u failures\n", nr_failures);
+        return 1;
+    }
+
+    printf("All tests passed\n");
+    return 0;
+}
+
+/*
+ * Local variables:
+ * mode: C
+ * c-file-style: "BSD"
+ * c-basic-offset: 4
+ * indent-tabs-mode: nil
+ * End:
+ */
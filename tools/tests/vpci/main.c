@@ -1,5 +1,5 @@
 /*
- * Unit tests for the generic vPCI handler code.
+ * Unit tests and access benchmark for the generic vPCI handler code.
  *
  * Copyright (C) 2017 Citrix Systems R&D
  *
@@ -18,6 +18,9 @@
 
 #include "emul.h"
 
+#include <time.h>
+#include <unistd.h>
+
 /* Single vcpu (current), and single domain with a single PCI device. */
 static struct vpci vpci;
 
@@ -175,6 +178,69 @@ void multiwrite4_check(unsigned int reg)
     multiread4_check(reg, val);
 }
 
+static double now(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+/*
+ * Measure config space accesses per second with an increasing number of
+ * emulated registers, spread over the extended config space above the
+ * registers left by the tests.
+ */
+static void bench(void)
+{
+    static const unsigned int sizes[] = { 16, 64, 256, 960 };
+    static uint32_t store[PCI_CFG_SPACE_EXP_SIZE / 4];
+    unsigned int i, n, nr_accesses = 1 << 22;
+    unsigned int *offsets = malloc(nr_accesses * sizeof(*offsets));
+    uint32_t sum = 0;
+    double t, t_read, t_write;
+
+    assert(offsets);
+    for ( n = 0; n < nr_accesses; n++ )
+        offsets[n] = (rand() % (PCI_CFG_SPACE_EXP_SIZE / 4)) * 4;
+
+    printf("%10s %12s %12s %12s\n", "registers", "accesses", "reads/s",
+           "writes/s");
+
+    for ( i = 0; i < ARRAY_SIZE(sizes); i++ )
+    {
+        unsigned int nr = sizes[i];
+        unsigned int stride = ((PCI_CFG_SPACE_EXP_SIZE - 0x40) / nr) & ~3;
+
+        for ( n = 0; n < nr; n++ )
+            VPCI_ADD_REG(vpci_read32, vpci_write32, 0x40 + n * stride, 4,
+                         store[n]);
+
+        t = now();
+        for ( n = 0; n < nr_accesses; n++ )
+            sum += vpci_read((pci_sbdf_t){ .sbdf = 0 }, offsets[n], 4);
+        t_read = now() - t;
+
+        t = now();
+        for ( n = 0; n < nr_accesses; n++ )
+            vpci_write((pci_sbdf_t){ .sbdf = 0 }, offsets[n], 4, n);
+        t_write = now() - t;
+
+        printf("%10u %12u %11.1fM %11.1fM\n", nr, nr_accesses,
+               nr_accesses / t_read / 1e6, nr_accesses / t_write / 1e6);
+
+        for ( n = 0; n < nr; n++ )
+            VPCI_REMOVE_REG(0x40 + n * stride, 4);
+    }
+
+    /* Keep the reads from being optimised out. */
+    if ( !sum )
+        printf("\n");
+
+    free(offsets);
+}
+
 int
 main(int argc, char **argv)
 {
@@ -189,8 +255,23 @@ main(int argc, char **argv)
     uint32_t r24 = 0;
     uint8_t r28, r30;
     struct mask_data r32;
+    uint8_t r40[4] = { };
     unsigned int i;
-    int rc;
+    bool do_bench = false;
+    int opt, rc;
+
+    while ( (opt = getopt(argc, argv, "b")) != -1 )
+    {
+        switch ( opt )
+        {
+        case 'b':
+            do_bench = true;
+            break;
+        default:
+            fprintf(stderr, "usage: %s [-b]\n", argv[0]);
+            return 2;
+        }
+    }
 
     INIT_LIST_HEAD(&vpci.handlers);
     spin_lock_init(&vpci.lock);
@@ -407,6 +488,39 @@ main(int argc, char **argv)
     VPCI_REMOVE_INVALID_REG(16, 2);
     VPCI_REMOVE_INVALID_REG(30, 2);
 
+    /* Accesses keep finding the registers left around the removed ones. */
+    VPCI_READ_CHECK(28, 4, 0xffacffff);
+    VPCI_READ_CHECK(24, 4, 0xffffffff);
+    VPCI_READ_CHECK(12, 4, 0xffffffff);
+
+    /*
+     * Registers added in descending order, and removal of the first one in
+     * a dword.
+     *
+     * 32     24     16      8      0
+     *  +------+------+------+------+
+     *  |r40[3]|r40[2]|r40[1]|r40[0]| 40
+     *  +------+------+------+------+
+     *
+     */
+    for ( i = 4; i-- > 0; )
+        VPCI_ADD_REG(vpci_read8, vpci_write8, 40 + i, 1, r40[i]);
+    multiwrite4_check(40);
+    VPCI_REMOVE_REG(40, 1);
+    VPCI_READ_CHECK(40, 4, 0xc4693bff);
+    VPCI_REMOVE_REG(42, 1);
+    VPCI_READ_CHECK(40, 4, 0xc4ff3bff);
+
+    /* Registers in the extended config space. */
+    VPCI_ADD_REG(vpci_read32, vpci_write32, 0xffc, 4, r24);
+    VPCI_WRITE_CHECK(0xffc, 4, 0x12345678);
+    VPCI_READ_CHECK(0xffe, 2, 0x1234);
+    VPCI_REMOVE_REG(0xffc, 4);
+    VPCI_READ_CHECK(0xffc, 4, 0xffffffff);
+
+    if ( do_bench )
+        bench();
+
     return 0;
 }
 
@@ -0,0 +1,359 @@
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) _3dnow_x86_32_D_8f4[] = {
+0x895500eb, 0xe0ec81e5, 0xf3000000, 0xb01d100f,
+0xf3001007, 0xb405100f, 0xc7001007, 0x0000fc45,
+0x0ff3bf80, 0xf3e85d11, 0xf045110f, 0x5d110ff3,
+0x110ff3f8, 0x0ff3ec45, 0x0ff45d11, 0x0fe87d12,
+0xf3d07d13, 0xd04d100f, 0x0ff3d231, 0xb8d45510,
+0x00000000, 0xe84d2e0f, 0x0fc29b0f, 0xdaf7d045,
+0xff289589, 0xd231ffff, 0xec552e0f, 0xb5100ff3,
+0xffffff28, 0x0fc29b0f, 0xdaf7d045, 0xff249589,
+0x39baffff, 0xf3000005, 0x24bd100f, 0x0fffffff,
+0x130ff714, 0xffff28b5, 0x9d6f0fff, 0xffffff28,
+0x81cbd70f, 0x0000fff9, 0xf0850f00, 0xf3000006,
+0xe865100f, 0x6d100ff3, 0x580ff3ec, 0x580ff3e1,
+0xe5140fea, 0xd865130f, 0x65100ff3, 0xf3d231e8,
+0x0fe4580f, 0xf3d8652e, 0xec65100f, 0x0fc29b0f,
+0xdaf7d045, 0xff289589, 0x0ff3ffff, 0xd231e458,
+0xbd100ff3, 0xffffff28, 0xdc652e0f, 0x0fc29b0f,
+0xdaf7d045, 0xff249589, 0x3fbaffff, 0xf3000005,
+0x24ad100f, 0x0fffffff, 0x130ffd14, 0xffff28bd,
+0xa56f0fff, 0xffffff28, 0x81ccd70f, 0x0000fff9,
+0x68850f00, 0xf3000006, 0xd865100f, 0x6d100ff3,
+0x5c0ff3dc, 0x0ff3e865, 0x0fec6d5c, 0x130fe514,
+0xd231e065, 0xe04d2e0f, 0x0fc29b0f, 0xdaf7d045,
+0xff289589, 0xd231ffff, 0xe4552e0f, 0xb5100ff3,
+0xffffff28, 0x0fc29b0f, 0xdaf7d045, 0xff249589,
+0x44baffff, 0xf3000005, 0x24bd100f, 0x0fffffff,
+0x130ff714, 0xffff28b5, 0xad6f0fff, 0xffffff28,
+0x81cdd70f, 0x0000fff9, 0xf0850f00, 0xf3000005,
+0xe84d590f, 0x55590ff3, 0x590ff3ec, 0xca140fc0,
+0x0fc3140f, 0x0fd04d13, 0xf3d84513, 0xe84d100f,
+0x55100ff3, 0x100ff3f0, 0x0ff3ec45, 0xf3f45d10,
+0xf3d1580f, 0x0fd8580f, 0x130fd314, 0x280fe055,
+0xf3d231d9, 0xf05d5c0f, 0x65100ff3, 0x590ff3d0,
+0x0ff3e05d, 0x0fd8655c, 0x0ff3d028, 0x0ff4555c,
+0x0ff3e32e, 0x0fd45d10, 0x0ff3c29b, 0x0fe45559,
+0x0ff3d045, 0xf7dc5d5c, 0x289589da, 0x31ffffff,
+0x100ff3d2, 0xffff28bd, 0xda2e0fff, 0x0fc29b0f,
+0xdaf7d045, 0xff249589, 0x5bbaffff, 0xf3000005,
+0x24b5100f, 0x0fffffff, 0x130ffe14, 0xffff28bd,
+0xb56f0fff, 0xffffff28, 0x81ced70f, 0x0000fff9,
+0x28850f00, 0xf3000005, 0xfc5d100f, 0xf3d1280f,
+0x0fd8590f, 0x130fd314, 0xd231d055, 0x4d5e0ff3,
+0x5e0ff3f8, 0x2e0ffc45, 0x9b0fd04d, 0xd0450fc2,
+0x9589daf7, 0xffffff28, 0x2e0fd231, 0x0ff3d445,
+0xff28ad10, 0x9b0fffff, 0xd0450fc2, 0x9589daf7,
+0xffffff24, 0x000564ba, 0x100ff300, 0xffff24bd,
+0xef140fff, 0x28ad130f, 0x0fffffff, 0xff28bd6f,
+0xd70fffff, 0xfff981cf, 0x0f000000, 0x0004ae85,
+0x100ff300, 0xd231f845, 0x0d100ff3, 0x001007c0,
+0x55100ff3, 0xd8280fe8, 0xf3d9570f, 0xd05d590f,
+0x0fd1570f, 0x0ff3da2e, 0x0ffc5510, 0x0ff3c29b,
+0x0fec5d10, 0xdaf7d045, 0x89e2280f, 0xffff2895,
+0xe1570fff, 0x65590ff3, 0xcb570fd4, 0xb5100ff3,
+0xffffff28, 0x2e0fd231, 0xc29b0fe1, 0xf7d0450f,
+0x249589da, 0xbaffffff, 0x00000567, 0xad100ff3,
+0xffffff24, 0x0ff5140f, 0xff28b513, 0x6f0fffff,
+0xffff289d, 0xcbd70fff, 0x00fff981, 0x850f0000,
+0x0000041b, 0xe8450f0f, 0xc00f0f1d, 0x457f0f0d,
+0x100ff3d0, 0xd231d04d, 0xe84d2e0f, 0x4d100ff3,
+0xc29b0fd4, 0xf7d0450f, 0x289589da, 0x31ffffff,
+0x4d2e0fd2, 0x100ff3ec, 0xffff28bd, 0xc29b0fff,
+0xf7d0450f, 0x249589da, 0xbaffffff, 0x0000056e,
+0xb5100ff3, 0xffffff24, 0x0ffe140f, 0xff28bd13,
+0x6f0fffff, 0xffff28a5, 0xccd70fff, 0x00fff981,
+0x850f0000, 0x000003a7, 0xe84d0f0f, 0x450f0f96,
+0x0f0fbbe8, 0x7f0f96c0, 0x7f0fc04d, 0x0ff3c845,
+0xf3c84d10, 0xc44d110f, 0xc0456f0f, 0xe8450f0f,
+0x450f0fa6, 0x7f0fb6c0, 0x0f0fd045, 0x0f96d04d,
+0xbbd0450f, 0x96c00f0f, 0xb04d7f0f, 0xb8457f0f,
+0x4d100ff3, 0x110ff3b8, 0x6f0fb44d, 0x0f0fb045,
+0x31a6d045, 0x100ff3d2, 0x0f0fe84d, 0x0fb6b045,
+0x0f1dc00f, 0x0f0dc00f, 0xf3a8457f, 0xa865100f,
+0xa0457f0f, 0x5d100ff3, 0xe12e0fec, 0x65100ff3,
+0xc29b0fa4, 0xf7d0450f, 0x289589da, 0x31ffffff,
+0xe32e0fd2, 0xad100ff3, 0xffffff28, 0x0fc29b0f,
+0xdaf7d045, 0xff249589, 0x75baffff, 0xf3000005,
+0x24bd100f, 0x0fffffff, 0x130fef14, 0xffff28ad,
+0xad6f0fff, 0xffffff28, 0x81cdd70f, 0x0000fff9,
+0xc8850f00, 0xf3000002, 0xf3db590f, 0x0fc9590f,
+0x130fcb14, 0x0f0fd04d, 0x0f97d04d, 0xbbd0450f,
+0x97c00f0f, 0x904d7f0f, 0x98457f0f, 0x4d100ff3,
+0x110ff398, 0x6f0f944d, 0x6f0f904d, 0xc10f0fc1,
+0x450f0fb4, 0x0f0fa7d0, 0x7f0fb6c1, 0x0f0fd845,
+0x0f96d84d, 0xbbd8450f, 0x96c00f0f, 0x804d7f0f,
+0x88457f0f, 0x4d100ff3, 0x110ff388, 0x6f0f844d,
+0x0f0f8045, 0x31a6d845, 0x450f0fd2, 0x0f0fb680,
+0x0f0f1dc0, 0x7f0f0dc0, 0xffff7885, 0x100ff3ff,
+0xffff788d, 0x857f0fff, 0xffffff70, 0xe84d2e0f,
+0x8d100ff3, 0xffffff74, 0x0fc29b0f, 0xdaf7d045,
+0xff289589, 0xd231ffff, 0xec4d2e0f, 0xb5100ff3,
+0xffffff28, 0x0fc29b0f, 0xdaf7d045, 0xff249589,
+0x7cbaffff, 0xf3000005, 0x24ad100f, 0x0fffffff,
+0x130ff514, 0xffff28b5, 0xb56f0fff, 0xffffff28,
+0x81ced70f, 0x0000fff9, 0xd0850f00, 0x0f000001,
+0x1dd8550f, 0xe84d0f0f, 0xd20f0f96, 0x450f0f0d,
+0x0f0fbbe8, 0x7f0f96c0, 0xffff608d, 0x857f0fff,
+0xffffff68, 0x8d100ff3, 0xffffff68, 0x8d110ff3,
+0xffffff64, 0xe84d6f0f, 0x60856f0f, 0x0fffffff,
+0xff58957f, 0x0f0fffff, 0xd231a6c1, 0x48957f0f,
+0xf3ffffff, 0x588d100f, 0x0fffffff, 0xff60850f,
+0x0fb6ffff, 0x0f1dc00f, 0x0f0dc00f, 0xff50857f,
+0x2e0fffff, 0xffff508d, 0x857f0fff, 0xffffff40,
+0x8d100ff3, 0xffffff4c, 0x0fc29b0f, 0xdaf7d045,
+0xff289589, 0xd231ffff, 0x448d2e0f, 0xf3ffffff,
+0x28bd100f, 0x0fffffff, 0x450fc29b, 0x89daf7d0,
+0xffff2495, 0x057ebaff, 0x0ff30000, 0xff24b510,
+0x140fffff, 0xbd130ffe, 0xffffff28, 0x28bd6f0f,
+0x0fffffff, 0xff3dc7d7, 0x0f000000, 0x0000ee85,
+0x8d7f0f00, 0xffffff38, 0x8d100ff3, 0xffffff38,
+0x308d7f0f, 0xf3ffffff, 0x349d100f, 0xf3ffffff,
+0xf3c8590f, 0xf3da590f, 0xf045590f, 0x55590ff3,
+0xe9280ff4, 0x0feb140f, 0x130fc214, 0xffff28ad,
+0x856f0fff, 0xffffff28, 0xd845130f, 0x0fc86f0f,
+0xa4d84d0f, 0xe04d7f0f, 0xd8450f0f, 0x457f0f94,
+0x100ff3d8, 0xc031d845, 0x4d100ff3, 0x0000b9e8,
+0x0ff30000, 0xbae04558, 0x0000063d, 0x4d580ff3,
+0x590ff3f0, 0x2e0ff845, 0x100ff3c1, 0x9b0fdc45,
+0x100ff3c0, 0x450fec4d, 0x580ff3c1, 0xd8f7e445,
+0x4d580ff3, 0x590ff3f4, 0x8589fc45, 0xffffff28,
+0x0ff3c031, 0xff28b510, 0x2e0fffff, 0xc09b0fc1,
+0xf7c1450f, 0x248589d8, 0xf3ffffff, 0x24ad100f,
+0x0fffffff, 0x130ff514, 0xffff28b5, 0x9d6f0fff,
+0xffffff28, 0x3dc3d70f, 0x000000ff, 0xc9d1440f,
+0x00c3d089, 0x00000000, 0x00000000, 0x00000000,
+0x3f800000, 0x40000000, 0x00000000, 0x00000000,
+0x80000000, 0x00000000, 0x00000000, 0x00000000,
+0003720,
+};
+asm(".type _3dnow_x86_32_D_8f4, STT_NOTYPE;");
+asm(".type _3dnow_x86_32_D_8f4, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) _3dnow_x86_32_D_f4[] = {
+0x89551eeb, 0x458952e5, 0x80c031fc, 0xfffc287c,
+0x83400a75, 0xf37504f8, 0x02eb01b0, 0xc3c9c031,
+0x81e58955, 0x0000e8ec, 0x100ff300, 0x10049005,
+0x110ff300, 0xffff4085, 0x110ff3ff, 0xffff4485,
+0x110ff3ff, 0xffff4885, 0x40858bff, 0x89ffffff,
+0xffff3485, 0x100ff3ff, 0xffff4085, 0xb9c031ff,
+0x00000000, 0x34852e0f, 0x0fffffff, 0x450fc09b,
+0xe8d8f7c1, 0xffffff8a, 0x39b8c288, 0x84000005,
+0xfa840fd2, 0xf3000003, 0x3485100f, 0xf3ffffff,
+0x4085580f, 0xf3ffffff, 0x3885110f, 0xf3ffffff,
+0x4085100f, 0x31ffffff, 0x580ff3c0, 0x852e0fc0,
+0xffffff38, 0x0fc09b0f, 0xd8f7c145, 0xffff41e8,
+0xb8c288ff, 0x0000053f, 0x840fd284, 0x000003b1,
+0x85100ff3, 0xffffff38, 0x855c0ff3, 0xffffff40,
+0x85110ff3, 0xffffff18, 0xff18858b, 0x8589ffff,
+0xffffff74, 0xff388589, 0x8589ffff, 0xffffff3c,
+0x85100ff3, 0xffffff34, 0x2e0fc031, 0xffff3c85,
+0xc09b0fff, 0xf7c1450f, 0xfee4e8d8, 0xc288ffff,
+0x000544b8, 0x0fd28400, 0x00035484, 0x100ff300,
+0xffff3485, 0x590ff3ff, 0xffff4085, 0x110ff3ff,
+0xffff3485, 0x100ff3ff, 0xffff4485, 0x590ff3ff,
+0x110ff3c0, 0xffff3885, 0x100ff3ff, 0xffff4085,
+0x580ff3ff, 0xffff4485, 0x110ff3ff, 0xffff3c85,
+0x100ff3ff, 0xffff4085, 0xf3c031ff, 0x3495100f,
+0x0fffffff, 0x0ff3c828, 0xff448d5c, 0x0ff3ffff,
+0xff38955c, 0x0ff3ffff, 0xff3c8d59, 0x0ff3ffff,
+0xff3c8d11, 0x2e0fffff, 0xc09b0fd1, 0xf7c1450f,
+0xfe4ce8d8, 0xc288ffff, 0x00055bb8, 0x0fd28400,
+0x0002bc84, 0x590ff300, 0xffff4885, 0x110ff3ff,
+0xffff3485, 0x100ff3ff, 0xffff4085, 0xf3c031ff,
+0x48855e0f, 0x0fffffff, 0xff34852e, 0x0ff3ffff,
+0xff388511, 0x9b0fffff, 0xc1450fc0, 0xffe8d8f7,
+0x88fffffd, 0x0564b8c2, 0xd2840000, 0x026f840f,
+0x0ff30000, 0x04a01510, 0xc0310010, 0x85100ff3,
+0xffffff48, 0x8d100ff3, 0xffffff40, 0xf3c2570f,
+0x3485590f, 0x0fffffff, 0x2e0fca57, 0xc09b0fc1,
+0xf7c1450f, 0xfdb8e8d8, 0xc288ffff, 0x000567b8,
+0x0fd28400, 0x00022884, 0x2c0ff300, 0xffff4085,
+0x4c8589ff, 0xf3ffffff, 0x4c852a0f, 0xf3ffffff,
+0x3485110f, 0xf3ffffff, 0x3485100f, 0x31ffffff,
+0x852e0fc0, 0xffffff40, 0x0fc09b0f, 0xd8f7c145,
+0xfffd6de8, 0xb8c288ff, 0x0000056e, 0x840fd284,
+0x000001dd, 0x85530ff3, 0xffffff40, 0x85110ff3,
+0xffffff34, 0x85530ff3, 0xffffff34, 0xc02c0ff3,
+0xff4c8589, 0x0ff3ffff, 0xff4c8d2a, 0xc031ffff,
+0x85100ff3, 0xffffff40, 0x0fc82e0f, 0x450fc09b,
+0xe8d8f7c1, 0xfffffd1a, 0x75b8c288, 0x84000005,
+0x8a840fd2, 0xf3000001, 0xf3c0590f, 0x3485110f,
+0xf3ffffff, 0x3485520f, 0xf3ffffff, 0x3885110f,
+0xf3ffffff, 0x3885530f, 0xf3ffffff, 0x89c02c0f,
+0xffff4c85, 0x2a0ff3ff, 0xffff4c85, 0x0fc031ff,
+0xff40852e, 0x9b0fffff, 0xc1450fc0, 0xbfe8d8f7,
+0x88fffffc, 0x057cb8c2, 0xd2840000, 0x012f840f,
+0x0ff30000, 0xff38852c, 0x8589ffff, 0xffffff4c,
+0x85530ff3, 0xffffff40, 0xc02c0ff3, 0x8d2a0ff3,
+0xffffff4c, 0xff4c8589, 0x0ff3ffff, 0xff4c852a,
+0xc031ffff, 0x0fc82e0f, 0x450fc09b, 0xe8d8f7c1,
+0xfffffc6e, 0x7eb8c288, 0x84000005, 0xde840fd2,
+0xf3000000, 0x4085100f, 0xf3ffffff, 0xf3c0590f,
+0x3485110f, 0xf3ffffff, 0x408d100f, 0x31ffffff,
+0x510ff3c0, 0xffff3485, 0xc12e0fff, 0x0fc09b0f,
+0xd8f7c145, 0xfffc29e8, 0xb8c288ff, 0x0000059c,
+0x840fd284, 0x00000099, 0x85100ff3, 0xffffff48,
+0xc8590ff3, 0x85590ff3, 0xffffff44, 0x8d110ff3,
+0xffffff34, 0x85110ff3, 0xffffff38, 0x85100ff3,
+0xffffff34, 0x855f0ff3, 0xffffff38, 0x85110ff3,
+0xffffff3c, 0x85100ff3, 0xffffff34, 0x855d0ff3,
+0xffffff38, 0x85110ff3, 0xffffff38, 0x85100ff3,
+0xffffff38, 0x0ff3d231, 0xff408d10, 0xc889ffff,
+0x85580ff3, 0xffffff3c, 0x8d580ff3, 0xffffff44,
+0x85590ff3, 0xffffff48, 0x0fc12e0f, 0x440fc29b,
+0xe8d8f7c2, 0xfffffb8a, 0xc019013c, 0x00063d25,
+0x00c3c900, 0x00000000, 0x00000000, 0x00000000,
+0x3f800000, 0x00000000, 0x00000000, 0x00000000,
+0x80000000, 0x00000000, 0x00000000, 0x00000000,
+0002260,
+};
+asm(".type _3dnow_x86_32_D_f4, STT_NOTYPE;");
+asm(".type _3dnow_x86_32_D_f4, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) _3dnow_x86_64_D_8f4[] = {
+0xb84800eb, 0x3f800000, 0x40000000, 0xe5894855,
+0xe8458948, 0x000001b8, 0xe0c148fe, 0x4589481e,
+0x00b848f0, 0x003f8000, 0x48bf8000, 0xf3f84589,
+0xe84d7e0f, 0xd04d130f, 0x457e0ff3, 0x0539b8d0,
+0xc20f0000, 0x0f6600c8, 0xb60fd1d7, 0xfffa81d2,
+0x0f000000, 0x00035785, 0x7e0ff300, 0x580fe84d,
+0x4d130fc8, 0x7e0ff3d8, 0x0ff3e84d, 0xb8d8557e,
+0x0000053f, 0x0fc9580f, 0x6600cac2, 0x0fd1d70f,
+0xfa81d2b6, 0x000000ff, 0x0322850f, 0x0ff30000,
+0x0fe84d7e, 0x130fd15c, 0x0ff3e055, 0xb8e04d7e,
+0x00000544, 0x00c8c20f, 0xd1d70f66, 0x81d2b60f,
+0x0000fffa, 0xf5850f00, 0xf3000002, 0xf0557e0f,
+0x4d7e0ff3, 0xc8590fe8, 0x0fea280f, 0x0ff3ea59,
+0x0fe8457e, 0x280fd058, 0x7e0ff3da, 0x280ff055,
+0xcd5c0fe0, 0x00055bb8, 0xe25c0f00, 0x0fdc590f,
+0x6600cbc2, 0x0fd1d70f, 0xfa81d2b6, 0x000000ff,
+0x02aa850f, 0x0ff30000, 0x0ff84d7e, 0x0ff3c859,
+0xb8f85d7e, 0x00000564, 0x991d160f, 0x0f000002,
+0xc20fc35e, 0x0f6600c1, 0xb60fd0d7, 0xfffa81d2,
+0x0f000000, 0x00027785, 0x7e0ff300, 0x67b8f865,
+0xf3000005, 0x751d7e0f, 0x0f000002, 0x570fc428,
+0xc1590fc3, 0x4d7e0ff3, 0xcb570fe8, 0x00c1c20f,
+0xd0d70f66, 0x81d2b60f, 0x0000fffa, 0x3d850f00,
+0xf3000002, 0xe8457e0f, 0xc05b0ff3, 0xf3c05b0f,
+0xe84d7e0f, 0x00056eb8, 0xc1c20f00, 0xd70f6600,
+0xd2b60fd0, 0x00fffa81, 0x850f0000, 0x00000210,
+0xe8450f0f, 0x7e0ff396, 0x0ff3e845, 0x280fe8d6,
+0xc0c60ff5, 0x45130fe1, 0x4d0f0fc8, 0x0ff396c8,
+0x140ff9d6, 0xd60ff2f7, 0xc86f0fc6, 0xe84d0f0f,
+0xc80f0fa6, 0x4d7f0fb6, 0x450f0fd0, 0x0ff396d0,
+0xf3d0457e, 0x0fe8d60f, 0x0fe1c0c6, 0x0fc84513,
+0x96c84d0f, 0xf9d60ff3, 0x0fcf280f, 0x140ffd28,
+0xd60ff2f9, 0xc86f0fc7, 0xd04d0f0f, 0x7e0ff3a6,
+0x75b8e84d, 0x0f000005, 0x0fb6c80f, 0xf3c84d7f,
+0xc8757e0f, 0xc65b0ff3, 0x0fc05b0f, 0x6600c1c2,
+0x0fd0d70f, 0xfa81d2b6, 0x000000ff, 0x016e850f,
+0x280f0000, 0xc1590fc1, 0xd045130f, 0xd0450f0f,
+0x7e0ff397, 0x0ff3d045, 0xc60fe8d6, 0x130fe1c0,
+0x280fc845, 0x4d0f0fc5, 0x0ff397c8, 0x140ff9d6,
+0xf0280fc7, 0xe8d60ff2, 0xf2f0590f, 0x0fc6d60f,
+0xa7d0450f, 0xb6c50f0f, 0xd8457f0f, 0xd8450f0f,
+0x7e0ff396, 0x0ff3d845, 0xc60ff8d6, 0x130fe1c0,
+0x0f0fc845, 0xf396c84d, 0x0ff1d60f, 0x280fde28,
+0xf3140ff7, 0xc6d60ff2, 0x0fc86f0f, 0xa6d84d0f,
+0x00057cb8, 0xc80f0f00, 0x4d7f0fb6, 0x7e0ff3c8,
+0x0ff3c86d, 0x5b0fc55b, 0xc8c20fc0, 0xd70f6600,
+0xd2b60fd1, 0x00fffa81, 0x850f0000, 0x000000c0,
+0x457e0ff3, 0x450f0fd8, 0x0ff396e8, 0x5b0fc05b,
+0x7e0ff3c0, 0x0ff3e84d, 0xc60ff8d6, 0x130fe1c9,
+0x0f0fc84d, 0xf396c84d, 0x0ff1d60f, 0x0ff2fe14,
+0x0ff3c7d6, 0x0fe84d7e, 0x7eb8c86f, 0xf2000005,
+0x0fd1d60f, 0x0fa6ca0f, 0x0fb6c80f, 0xf3c84d7f,
+0xc86d7e0f, 0xdd5b0ff3, 0x0fdb5b0f, 0x6600c3c2,
+0x0fd0d70f, 0xfa81d2b6, 0x000000ff, 0x280f5275,
+0xc1280fda, 0x0fdc590f, 0x130fc459, 0x0ff3d85d,
+0x0fd86d7e, 0x5f0fd828, 0x7e0ff3dd, 0x5d0fd86d,
+0x45130fc5, 0x7e0ff3d8, 0x580fd845, 0x063dbaca,
+0x580f0000, 0xc4590fc3, 0x00c1c20f, 0xc0d70f66,
+0x3dc0b60f, 0x000000ff, 0x000000b8, 0xc2450f00,
+0x0000c35d, 0x00000000, 0x3f800000, 0x3f800000,
+0x80000000, 0x80000000,
+0001710,
+};
+asm(".type _3dnow_x86_64_D_8f4, STT_NOTYPE;");
+asm(".type _3dnow_x86_64_D_8f4, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) _3dnow_x86_64_D_f4[] = {
+0x485523eb, 0x7d89e589, 0x458d48fc, 0xea8948fc,
+0x75ff3880, 0xc0ff480c, 0x75d03948, 0xeb01b0f3,
+0x5dc03102, 0x894855c3, 0xec8148e5, 0x000000e0,
+0x05100ff3, 0x00000488, 0x85110ff3, 0xffffff40,
+0x85110ff3, 0xffffff44, 0x85110ff3, 0xffffff48,
+0xff40858b, 0x8589ffff, 0xffffff34, 0x0ff3ff31,
+0xff408510, 0x00b9ffff, 0x0f000000, 0xff34852e,
+0x0f40ffff, 0x450fc79b, 0xe8dff7f9, 0xffffff82,
+0x39b8c289, 0x84000005, 0x26840fd2, 0xf3000004,
+0x3485100f, 0xf3ffffff, 0x4085580f, 0xf3ffffff,
+0x3885110f, 0xf3ffffff, 0x4085100f, 0x31ffffff,
+0x580ff3ff, 0x852e0fc0, 0xffffff38, 0xc79b0f40,
+0xf7f9450f, 0xff38e8df, 0xc289ffff, 0x00053fb8,
+0x0fd28400, 0x0003dc84, 0x100ff300, 0xffff3885,
+0x5c0ff3ff, 0xffff4085, 0x110ff3ff, 0xffff2085,
+0x20858bff, 0x89ffffff, 0xffff7085, 0x388589ff,
+0x89ffffff, 0xffff3c85, 0xf3ff31ff, 0x3485100f,
+0x0fffffff, 0xff3c852e, 0x0f40ffff, 0x450fc79b,
+0xe8dff7f9, 0xfffffeda, 0x44b8c289, 0x84000005,
+0x7e840fd2, 0xf3000003, 0x3485100f, 0xf3ffffff,
+0x4085590f, 0xf3ffffff, 0x3485110f, 0xf3ffffff,
+0x4485100f, 0xf3ffffff, 0xf3c0590f, 0x3885110f,
+0xf3ffffff, 0x4085100f, 0xf3ffffff, 0x4485580f,
+0xf3ffffff, 0x3c85110f, 0xf3ffffff, 0x4085100f,
+0xf3ffffff, 0x3495100f, 0x31ffffff, 0x5c0ff3ff,
+0xffff3895, 0xc8280fff, 0x8d5c0ff3, 0xffffff44,
+0x8d590ff3, 0xffffff3c, 0xf3d12e0f, 0x3c8d110f,
+0x40ffffff, 0x0fc79b0f, 0xdff7f945, 0xfffe41e8,
+0xb8c289ff, 0x0000055b, 0x840fd284, 0x000002e5,
+0x85590ff3, 0xffffff48, 0x85110ff3, 0xffffff34,
+0x0ff3ff31, 0xff408510, 0x0ff3ffff, 0xff48855e,
+0x2e0fffff, 0xffff3485, 0x110ff3ff, 0xffff3885,
+0x9b0f40ff, 0xf9450fc7, 0xf3e8dff7, 0x89fffffd,
+0x0564b8c2, 0xd2840000, 0x0297840f, 0x0ff30000,
+0xff488510, 0x0ff3ffff, 0x02a21510, 0x0ff30000,
+0xff408d10, 0xff31ffff, 0x0fc2570f, 0x0ff3ca57,
+0xff348559, 0x2e0fffff, 0x9b0f40c1, 0xf9450fc7,
+0xabe8dff7, 0x89fffffd, 0x0567b8c2, 0xd2840000,
+0x024f840f, 0x0ff30000, 0xff40852c, 0x4589ffff,
+0x2a0ff3f8, 0x0ff3f845, 0xff348511, 0xff31ffff,
+0x85100ff3, 0xffffff34, 0x40852e0f, 0x40ffffff,
+0x0fc79b0f, 0xdff7f945, 0xfffd65e8, 0xb8c289ff,
+0x0000056e, 0x840fd284, 0x00000209, 0x85530ff3,
+0xffffff40, 0x85110ff3, 0xffffff34, 0x85530ff3,
+0xffffff34, 0xc02c0ff3, 0xf3f84589, 0xf84d2a0f,
+0x85100ff3, 0xffffff40, 0x2e0fff31, 0x9b0f40c8,
+0xf9450fc7, 0x17e8dff7, 0x89fffffd, 0x0575b8c2,
+0xd2840000, 0x01bb840f, 0x0ff30000, 0x0ff3c059,
+0xff348511, 0x0ff3ffff, 0xff348552, 0x0ff3ffff,
+0xff388511, 0x0ff3ffff, 0xff388553, 0x0ff3ffff,
+0x4589c02c, 0xf3ff31f8, 0xf8452a0f, 0x40852e0f,
+0x40ffffff, 0x0fc79b0f, 0xdff7f945, 0xfffcc1e8,
+0xb8c289ff, 0x0000057c, 0x840fd284, 0x00000165,
+0x852c0ff3, 0xffffff38, 0xf3f84589, 0x4085530f,
+0xf3ffffff, 0xf3c02c0f, 0xf84d2a0f, 0xf3f84589,
+0xf8452a0f, 0x2e0fff31, 0x9b0f40c8, 0xf9450fc7,
+0x7be8dff7, 0x89fffffc, 0x057eb8c2, 0xd2840000,
+0x011f840f, 0x48f30000, 0x40852c0f, 0x48ffffff,
+0xf3f84589, 0x452a0f48, 0x110ff3f8, 0xffff3485,
+0xf3ff31ff, 0x4085100f, 0x0fffffff, 0xff34852e,
+0x0f40ffff, 0x450fc79b, 0xe8dff7f9, 0xfffffc32,
+0x88b8c289, 0x84000005, 0xd6840fd2, 0xf3000000,
+0xf3c0590f, 0x3485110f, 0xf3ffffff, 0x408d100f,
+0x31ffffff, 0x510ff3ff, 0xffff3485, 0xc12e0fff,
+0xc79b0f40, 0xf7f9450f, 0xfbf4e8df, 0xc289ffff,
+0x00059cb8, 0x0fd28400, 0x00009884, 0x100ff300,
+0xffff4885, 0x590ff3ff, 0x590ff3c8, 0xffff4485,
+0x110ff3ff, 0xffff348d, 0x110ff3ff, 0xffff3885,
+0x100ff3ff, 0xffff3485, 0x5f0ff3ff, 0xffff3885,
+0x110ff3ff, 0xffff3c85, 0x100ff3ff, 0xffff3485,
+0x5d0ff3ff, 0xffff3885, 0x110ff3ff, 0xffff3885,
+0x100ff3ff, 0xffff3885, 0x580ff3ff, 0xffff3c85,
+0xf3ff31ff, 0x4885590f, 0xf3ffffff, 0x408d100f,
+0xf3ffffff, 0x448d580f, 0x0fffffff, 0x0f40c12e,
+0x450fc79b, 0xe8dff7f9, 0xfffffb56, 0xc019013c,
+0x00063d25, 0x00c3c900, 0x00000000, 0x00000000,
+0x3f800000, 0x00000000, 0x00000000, 0x00000000,
+0x80000000, 0x00000000, 0x00000000, 0x00000000,
+0002340,
+};
+asm(".type _3dnow_x86_64_D_f4, STT_NOTYPE;");
+asm(".type _3dnow_x86_64_D_f4, STT_FUNC;");
@@ -0,0 +1,1137 @@
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx_x86_32_D_16f4[] = {
+0x83e58955, 0x02e8f0e4, 0xc9000000, 0xe8d955c3,
+0xec81e589, 0x00000088, 0xd9c855d9, 0x1004d005,
+0x10fac500, 0x1004d42d, 0xd855d900, 0x55d9c9d9,
+0x11fac5e8, 0x05d9cc6d, 0x001004d8, 0x6d11fac5,
+0xdc55d9e0, 0xe0d9e8d9, 0xd9ec55d9, 0xd05dd9c9,
+0x55d9c9d9, 0xd9cad9f0, 0xc9d9d45d, 0xd9e45dd9,
+0xf8c5f45d, 0xc5c86528, 0x986529f8, 0x5d28f8c5,
+0x76f1c598, 0x0539b8c9, 0xe0c50000, 0xc400d4c2,
+0xd10e79e2, 0x043d830f, 0xe0c50000, 0xc5c85558,
+0xa85529f8, 0x6528f8c5, 0x053fb8c8, 0xd8c50000,
+0xe8c5d458, 0x00a855c2, 0x0e79e2c4, 0x14830fd1,
+0xc5000004, 0xa86528f8, 0x555cd8c5, 0x29f8c5c8,
+0xe0c5b855, 0x00b855c2, 0x000544b8, 0x79e2c400,
+0x830fd10e, 0x000003ef, 0x6528f8c5, 0x59e0c5d8,
+0xd8c5c85d, 0xf8c5e459, 0xc5c85528, 0xd87d58e8,
+0x755ce8c5, 0x055bb8d8, 0xe0c50000, 0xc8c5dc5c,
+0xe0c5f759, 0xc400dec2, 0xd90e79e2, 0x03b5830f,
+0xe8c50000, 0xc5e85d59, 0x985d29f8, 0x555ee8c5,
+0x0564b8e8, 0xe0c50000, 0xc400dac2, 0xd90e79e2,
+0x0391830f, 0xe2c40000, 0xe01d1879, 0xb8001004,
+0x00000567, 0x6528f8c5, 0x57d8c5e8, 0x59e8c5d3,
+0xe0c59855, 0xc5c85d57, 0x00d3c2e8, 0x0e79e2c4,
+0x60830fd1, 0xc5000003, 0xc8555bf9, 0xd25bf8c5,
+0x55c2e8c5, 0x6eb800c8, 0xc4000005, 0xd10e79e2,
+0x0341830f, 0xf8c50000, 0xc5c85553, 0x985529f8,
+0x5553f8c5, 0x0575b898, 0xf8c50000, 0xc5c87528,
+0xc5d25bf9, 0xc5d25bf8, 0x00d6c2e8, 0x0e79e2c4,
+0x10830fd1, 0xc5000003, 0xc5d659c8, 0x985529f8,
+0x5552f8c5, 0x29f8c598, 0xf8c5a855, 0xb8a85d28,
+0x0000057c, 0xd353f8c5, 0xd25bf9c5, 0xd25bf8c5,
+0xf2c2c8c5, 0x79e2c400, 0x830ff10e, 0x000002d7,
+0x5528f8c5, 0x5bf9c5c8, 0x057eb8db, 0xf8c50000,
+0xf8c5db5b, 0xf9c5f253, 0xf8c5f65b, 0xe0c5f65b,
+0xc400dec2, 0xd90e79e2, 0x02a9830f, 0xe8c50000,
+0xf8c5da59, 0xc5985d29, 0x985d51f8, 0x00059cb8,
+0xc2e0c500, 0xe2c400da, 0x0fd90e79, 0x00028683,
+0x79e2c400, 0x04f01d18, 0xe0c50010, 0xf8c5f25e,
+0xc4987529, 0x750879e3, 0xc8c50b98, 0x04f035c2,
+0xb8000010, 0x000005a4, 0x0e79e2c4, 0x54830ff1,
+0xc5000002, 0xd87559d8, 0xfa59d8c5, 0x7529f8c5,
+0x5fc0c5a8, 0xc0c5a875, 0xc5a87d5d, 0xa87d29f8,
+0x7558c8c5, 0x063db8a8, 0xe8c50000, 0xc5d85558,
+0xc5f459c8, 0x00d2c2c8, 0x0e79e2c4, 0x14830fd1,
+0xc4000002, 0x550479e3, 0x4eb81bc8, 0xc5000006,
+0xd855c2e8, 0x79e2c400, 0x830fd10e, 0x000001f7,
+0x5528f8c5, 0x0001b8d8, 0xf9c50000, 0xf9c5f86e,
+0xb800ff70, 0x00000653, 0xf25bf9c5, 0xf7fac9c5,
+0x7d28f8c5, 0x41e2c4c8, 0xe8c5f60c, 0xc400f6c2,
+0xf10e79e2, 0x01bd830f, 0xc0c50000, 0x5db8fa58,
+0xc4000006, 0x351879e2, 0x001004e4, 0xfec2c0c5,
+0x79e2c400, 0x830ff90e, 0x0000019b, 0x7514e8c5,
+0x15e8c5c8, 0xc8c5c87d, 0xa6b8f75c, 0xc5000006,
+0x00edc6d0, 0xf459c8c5, 0xedc2c8c5, 0x79e2c400,
+0x830fe90e, 0x0000016f, 0x6d12fac5, 0x79e2c4c8,
+0x04dc3518, 0x17b80010, 0xc5000007, 0xc4f458c8,
+0x3d1879e2, 0x001004e8, 0xf759c8c5, 0x6d5cd0c5,
+0xc2d0c5c8, 0xe2c400ee, 0x0fe90e79, 0x00013683,
+0x16fac500, 0xd8c5c86d, 0x1eb8db58, 0xc5000007,
+0xc87528f8, 0xdf59e0c5, 0xee5cd0c5, 0xebc2d0c5,
+0x79e2c400, 0x830fe90e, 0x0000010b, 0xc5dc45d9,
+0xb8db57e0, 0x0000072a, 0x7529f8c5, 0xc2e0c5a8,
+0x5dd901dc, 0xe445d9ac, 0xc4b45dd9, 0xd64a69e3,
+0x28f8c530, 0xe0c5a85d, 0xc400d2c2, 0xd10e79e2,
+0x00d1830f, 0xf8c50000, 0xb8c86528, 0x0000073a,
+0x0c59e3c4, 0xc50ad84d, 0x00c9c2e0, 0xdb76e1c5,
+0x0e79e2c4, 0xac830fcb, 0xc5000000, 0xc86528f8,
+0x4dd0dbc5, 0x28f8c5d8, 0x43b8c865, 0xc5000007,
+0xd855d0db, 0xcac2f0c5, 0x79e2c400, 0x830fcb0e,
+0x00000083, 0x5528f8c5, 0x0752b8c8, 0xe3c40000,
+0xd84d4069, 0xc2f0c5f1, 0x1005000d, 0xe2c40000,
+0x73cb0e79, 0x29f8c562, 0xe8c59855, 0xebc5d257,
+0xc5984d7c, 0x984d29f8, 0x4d7cebc5, 0xec05d998,
+0xc4001004, 0x4d1779e3, 0x45d90384, 0xdde9df84,
+0x752f7ad8, 0x28f8c52d, 0xc031c86d, 0x4d7dd3c5,
+0x7cf3c5d8, 0x7cf3c5ca, 0xc2f0c5ca, 0xe2c400ca,
+0x0fcb0e79, 0xf883c092, 0x25c01901, 0x00000767,
+0x5eb805eb, 0xc9000007, 0x000000c3, 0x00000000,
+0x40800000, 0x40000000, 0x40400000, 0xbf800000,
+0x80000000, 0x40a00000, 0x3f000000, 0x41200000,
+0x3f800000, 0x00000000, 0x00000000, 0x00000000,
+0x41a00000, 0x00000000, 0x00000000, 0x00000000,
+0002420,
+};
+asm(".type avx_x86_32_D_16f4, STT_NOTYPE;");
+asm(".type avx_x86_32_D_16f4, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx_x86_32_D_16f8[] = {
+0x83e58955, 0x02e8f0e4, 0xc9000000, 0xc03155c3,
+0xe589e8d9, 0xdd78ec83, 0x05d9c855, 0x00100470,
+0xd9d855dd, 0xf04589c9, 0xd9e855dd, 0xf445c7c9,
+0xbff00000, 0xddd05ddd, 0xf9c5e05d, 0xc5c87d28,
+0x987d29f9, 0xc976f1c5, 0x5528f9c5, 0x0539b898,
+0xe9c50000, 0xc400dfc2, 0xd90f79e2, 0x0406830f,
+0xe9c50000, 0xc5c85d58, 0xa85d29f9, 0x00053fb8,
+0x28f9c500, 0xc1c5c87d, 0xe1c5df58, 0x00a85dc2,
+0x0f79e2c4, 0xdd830fd9, 0xc5000003, 0xa87d28f9,
+0x5d5cc1c5, 0x29f9c5c8, 0x44b8b85d, 0xc5000005,
+0xb85dc2e9, 0x79e2c400, 0x830fd90f, 0x000003b8,
+0x7d28f9c5, 0x59e9c5d8, 0xc1c5c855, 0xf9c5e759,
+0xc5c85d28, 0xb8f758e1, 0x0000055b, 0x6d5ce1c5,
+0x5ce9c5d8, 0x59d1c5d4, 0xc2e9c5ee, 0xe2c400d5,
+0x0fd10f79, 0x00037f83, 0x59e1c500, 0xf9c5e855,
+0xb8985529, 0x00000564, 0x5d5ee1c5, 0xc2e9c5e8,
+0xe2c400d3, 0x0fd10f79, 0x00035b83, 0x12fbc500,
+0x10047825, 0x28f9c500, 0x67b8e85d, 0xc5000005,
+0xc5d457e1, 0xc86557d9, 0x5559e9c5, 0xc2e9c598,
+0xe2c400d4, 0x0fd10f79, 0x00032b83, 0xe6fbc500,
+0xfac5c855, 0x6eb8d2e6, 0xc5000005, 0xc855c2e9,
+0x79e2c400, 0x830fd10f, 0x0000030c, 0x555af9c5,
+0x53f8c5c8, 0x5af8c5d2, 0x29f9c5d2, 0xf9c59855,
+0xc598555a, 0xc5d253f8, 0xc86528f9, 0x000575b8,
+0x5af8c500, 0xe6fbc5d2, 0xe6fac5d2, 0xc2e9c5d2,
+0xe2c400d4, 0x0fd10f79, 0x0002cb83, 0x59d9c500,
+0x29f9c5d4, 0xf9c59855, 0xc598555a, 0xc5d252f8,
+0xc5d25af8, 0xa85529f9, 0x6d28f9c5, 0x5af9c5a8,
+0x057cb8d5, 0xf8c50000, 0xf8c5d253, 0xfbc5d25a,
+0xfac5d2e6, 0xd9c5d2e6, 0xc400e2c2, 0xe10f79e2,
+0x0282830f, 0xf9c50000, 0xc5c86528, 0xc5d45af9,
+0xb8ede6fb, 0x0000057e, 0xede6fac5, 0xd253f8c5,
+0xd25af8c5, 0xd2e6fbc5, 0xd2e6fac5, 0xeac2d1c5,
+0x79e2c400, 0x830fe90f, 0x0000024c, 0xd459d9c5,
+0x5529f9c5, 0x059cb898, 0xf9c50000, 0xc5985551,
+0x00d4c2e9, 0x0f79e2c4, 0x29830fd1, 0xc5000002,
+0x902d12fb, 0xc5001004, 0xc5d45ed1, 0x985529f9,
+0x0005a4b8, 0x79e3c400, 0x0b985509, 0x15c2e9c5,
+0x00100490, 0x79e2c400, 0x830fd10f, 0x000001f8,
+0x5559e1c5, 0x59e1c5d8, 0x29f9c5f4, 0xc9c5a855,
+0xc5a8555f, 0xa8755dc9, 0x7529f9c5, 0x063db8a8,
+0xe9c50000, 0xc5a85558, 0xd86558d9, 0xd359e9c5,
+0xd4c2e9c5, 0x79e2c400, 0x830fd10f, 0x000001b8,
+0x00064eb8, 0x79e3c400, 0x01c85505, 0x55c2e9c5,
+0xe2c400d8, 0x0fd10f79, 0x00019b83, 0x0001b800,
+0xf9c50000, 0xc5d85528, 0xc5e2e6fb, 0xc5f86ef9,
+0x00f770f9, 0xe6fad9c5, 0x2579e2c4, 0x73d9c5e4,
+0xf9c501f4, 0xb8c87d28, 0x00000653, 0x0d41e2c4,
+0xc2e9c5e4, 0xe2c400e4, 0x0fe10f79, 0x00015783,
+0x16e9c500, 0xf9c5c865, 0xc5c87d28, 0xb8f715e9,
+0x000006a8, 0xe65cd9c5, 0xe359d9c5, 0xe5c2d9c5,
+0x79e2c400, 0x830fe10f, 0x0000012c, 0x65120ff2,
+0x12fbc5c8, 0x1004802d, 0x28f9c500, 0xe1c5c875,
+0xd9c5ed58, 0xfbc5e65c, 0x04883d12, 0x17b80010,
+0xc5000007, 0xc5ef59d1, 0x00e5c2d9, 0x0f79e2c4,
+0xf1830fe1, 0xc5000000, 0xa87529f9, 0x7d10fbc5,
+0x57d9c5e0, 0x11fbc5e4, 0xd9c5b07d, 0xb801dbc2,
+0x0000072a, 0x4b69e3c4, 0xf9c530d6, 0xc5a85d28,
+0x00d2c2e1, 0x0f79e2c4, 0xb9830fd1, 0xb8000000,
+0x0000073a, 0x7528f9c5, 0x49e3c4c8, 0x02d8550d,
+0xdac2e1c5, 0x79e2c400, 0x830fd90f, 0x00000098,
+0x7528f9c5, 0xd0c9c5c8, 0x43b8d855, 0xc5000007,
+0xc87d28f9, 0x5dd0c1c5, 0xc2e9c5d8, 0xe2c400d3,
+0x73d10f79, 0x76e1c573, 0x28f9c5db, 0x52b8c855,
+0xc4000007, 0x4d4169e3, 0xf1c531d8, 0x04a00dc2,
+0xc4000010, 0xcb0f79e2, 0xf9c54e73, 0xc5985529,
+0x984d7cd9, 0x4d17f9c5, 0x7405d990, 0xdd001004,
+0xe9df9045, 0x2b7ad8dd, 0xc0312975, 0x7528f9c5,
+0x7dc9c5c8, 0xf1c5d84d, 0xf1c5cc7c, 0xc400ccc2,
+0xcb0f79e2, 0x83c0920f, 0xc01901f8, 0x00076725,
+0xb805eb00, 0x0000075e, 0x0000c3c9, 0x00000000,
+0x40000000, 0x40400000, 0x00000000, 0x80000000,
+0x00000000, 0xbff00000, 0x00000000, 0x3fe00000,
+0x00000000, 0x3ff00000, 0x00000000, 0x00000000,
+0x00000000, 0x40100000, 0x00000000, 0x00000000,
+0002260,
+};
+asm(".type avx_x86_32_D_16f8, STT_NOTYPE;");
+asm(".type avx_x86_32_D_16f8, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx_x86_32_D_32f4[] = {
+0x315500eb, 0x53e589c0, 0x000009bb, 0xe0e48300,
+0x00e0ec81, 0xc2890000, 0x24448940, 0xdbd9890c,
+0x290c2444, 0x01c2f6c1, 0x0c244c89, 0x7c845cd9,
+0x0c2444db, 0x9c849cd9, 0xd9000000, 0xd9e0d9e8,
+0xddc9dbe8, 0x08f883d9, 0xbc849cd9, 0x75000000,
+0x28fcc5c5, 0x008024bc, 0xfcc50000, 0x20247c29,
+0x4c28fcc5, 0xf4c52024, 0xc500d7c2, 0x81d250fc,
+0x0000fffa, 0x0539b800, 0x850f0000, 0x00000665,
+0x9458f4c5, 0x00008024, 0x29fcc500, 0xc5402454,
+0x24bc28fc, 0x00000080, 0xd758c4c5, 0x54c2ecc5,
+0xc5004024, 0x81d250fc, 0x0000fffa, 0x053fb800,
+0x850f0000, 0x0000062d, 0x7c28fcc5, 0xc4c54024,
+0x8024945c, 0xc5000000, 0x245429fc, 0xc2f4c560,
+0x00602454, 0xd250fcc5, 0x00fffa81, 0x44b80000,
+0x0f000005, 0x0005fc85, 0x28fcc500, 0x00a024b4,
+0xf4c50000, 0x80248c59, 0xc5000000, 0xc5de59cc,
+0x249428fc, 0x00000080, 0xee58ecc5, 0xa45cecc5,
+0x0000a024, 0x5cf4c500, 0x59dcc5cb, 0xc2f4c5e5,
+0xfcc500cc, 0xfa81d150, 0x000000ff, 0x00055bb8,
+0xae850f00, 0xc5000005, 0x249c59ec, 0x000000c0,
+0x5c29fcc5, 0xecc52024, 0xc0248c5e, 0xc5000000,
+0x00d9c2e4, 0xd350fcc5, 0x00fffa81, 0x64b80000,
+0x0f000005, 0x00057c85, 0x7de2c400, 0x07041518,
+0xfcc50010, 0xc024ac28, 0xc5000000, 0xc5ca57d4,
+0x249457ec, 0x00000080, 0x4c59f4c5, 0xf4c52024,
+0xc500cac2, 0x81d150fc, 0x0000fffa, 0x0567b800,
+0x850f0000, 0x0000053d, 0x8c5bfdc5, 0x00008024,
+0x5bfcc500, 0xc2f4c5c9, 0x0080248c, 0xc5000000,
+0x81d150fc, 0x0000fffa, 0x056eb800, 0x850f0000,
+0x00000511, 0x8c53fcc5, 0x00008024, 0x29fcc500,
+0xc520244c, 0x244c53fc, 0x28fcc520, 0x00802494,
+0xfdc50000, 0xfcc5c95b, 0xf4c5c95b, 0xc500cac2,
+0x81d150fc, 0x0000fffa, 0x0575b800, 0x850f0000,
+0x000004d1, 0xca59ecc5, 0x4c29fcc5, 0xfcc52024,
+0x20244c52, 0x4c29fcc5, 0xfcc54024, 0x40244c28,
+0xd953fcc5, 0xdb5bfdc5, 0xdb5bfcc5, 0xd3c2ecc5,
+0x50fcc500, 0xfffa81d2, 0xb8000000, 0x0000057c,
+0x048f850f, 0xfdc50000, 0xfcc5d15b, 0x80248c28,
+0xc5000000, 0xc5d25bfc, 0xc5d953fc, 0xc5db5bfd,
+0xc5db5bfc, 0x00d3c2ec, 0xd250fcc5, 0x00fffa81,
+0x7eb80000, 0x0f000005, 0x00045885, 0x59f4c500,
+0x29fcc5d1, 0xc5202454, 0x245451fc, 0xc2ecc520,
+0xfcc500d1, 0xfa81d250, 0x000000ff, 0x00059cb8,
+0x2e850f00, 0xc4000004, 0x15187de2, 0x00100720,
+0xd95eecc5, 0x5c29fcc5, 0xe3c42024, 0x245c087d,
+0xe4c50b20, 0x07201dc2, 0xc5000010, 0x81d350fc,
+0x0000fffa, 0x05a4b800, 0x850f0000, 0x000003f5,
+0x9c59d4c5, 0x0000a024, 0x59d4c500, 0x29fcc5e1,
+0xc540245c, 0x245c5fdc, 0x5ddcc540, 0xc5402464,
+0x246429fc, 0x58e4c540, 0xc540245c, 0x248c58f4,
+0x000000a0, 0xdd59e4c5, 0xc9c2e4c5, 0x50fcc500,
+0xfffa81d1, 0xb8000000, 0x0000063d, 0x03a3850f,
+0xe3c40000, 0x248c047d, 0x00000080, 0x28fcc51b,
+0x00a024a4, 0xe3c40000, 0x01c90675, 0xc9c2dcc5,
+0x50fcc500, 0xfffa81d1, 0xb8000000, 0x0000064e,
+0x036f850f, 0x01b80000, 0xc5000000, 0xc5dc5bfd,
+0xc5f86ef9, 0x00f770f9, 0xcefae1c5, 0x197de3c4,
+0xe1c501db, 0x53b8defa, 0xc4000006, 0xcb1875e3,
+0x28fcc501, 0x0080249c, 0xe2c40000, 0xc4c90c65,
+0xc90675e3, 0xc2dcc501, 0xfcc500c9, 0xfa81d150,
+0x000000ff, 0x031b850f, 0xe4c50000, 0xe2c4dc58,
+0x080d187d, 0xc5001007, 0x00d9c2e4, 0xd350fcc5,
+0x00fffa81, 0x5db80000, 0x0f000006, 0x0002f485,
+0x12fec500, 0x0080248c, 0xe2c40000, 0x001d187d,
+0xc5001007, 0x248c5cf4, 0x00000080, 0xdd58e4c5,
+0x187de2c4, 0x10070c35, 0x59e4c500, 0xc2f4c5de,
+0xfcc500cb, 0xfa81d150, 0x000000ff, 0x000717b8,
+0xae850f00, 0xc5000002, 0x249c16fe, 0x00000080,
+0x8c28fcc5, 0x00008024, 0x58d4c500, 0x5ce4c5d2,
+0x59ecc5d9, 0xc2e4c5d6, 0xfcc500da, 0xfa81d350,
+0x000000ff, 0x00071eb8, 0x76850f00, 0xd9000002,
+0x00a42484, 0xfcc50000, 0x40244c29, 0xd257e8c5,
+0xedc2ecc5, 0x5de3c401, 0xb850c94a, 0x0000072a,
+0x44245cd9, 0xac2484d9, 0xd9000000, 0xd94c245c,
+0x00b42484, 0x5cd90000, 0x84d95424, 0x0000bc24,
+0x245cd900, 0x28fcc55c, 0xc5402454, 0x00c9c2ec,
+0xd150fcc5, 0x00fffa81, 0x850f0000, 0x00000215,
+0xc4ffc883, 0x8c2c55e2, 0x00008024, 0x29fcc500,
+0x8960244c, 0xb80c2444, 0x00000733, 0x187de2c4,
+0xc50c245c, 0xc4cb55d4, 0x642e75e2, 0xfcc56024,
+0x60247428, 0xcac2ccc5, 0x50fcc500, 0xfffa81d1,
+0x0f000000, 0x0001cc85, 0x28fcc500, 0x008024bc,
+0xe3c40000, 0x248c0c45, 0x000000a0, 0xc2ecc5aa,
+0xfcc500d1, 0xfa81d250, 0x000000ff, 0x00073ab8,
+0x9e850f00, 0xc5000001, 0x24b428fc, 0x00000080,
+0x8cd0cfc5, 0x0000a024, 0x28fcc500, 0x008024bc,
+0xc7c50000, 0xa02494d0, 0xc5000000, 0x00cac2f4,
+0xd150fcc5, 0x00fffa81, 0x43b80000, 0x0f000007,
+0x00016085, 0x28fcc500, 0x0080249c, 0xe3c40000,
+0x24944065, 0x000000a0, 0x11fac5f1, 0xc40c2454,
+0xd2197de3, 0x0752b801, 0x44d90000, 0xfac50c24,
+0x0c245411, 0x0c2444d9, 0x5cd9c1de, 0xfac50c24,
+0x0c244c10, 0x0dc2f4c5, 0x00100740, 0x50fcc500,
+0xfffa81d1, 0x0f000000, 0x00010885, 0x0003ba00,
+0xfcc50000, 0x20245c29, 0xc957f0c5, 0x547cf7c5,
+0xd8c52024, 0xe3c4e212, 0x01d3197d, 0xe3c6d8c5,
+0x79e3c4e4, 0x0c245c17, 0x16e8c503, 0xe3c44ad3,
+0x01d4186d, 0x5429fcc5, 0xd0752024, 0x071005d9,
+0x44d90010, 0xe9df0c24, 0x8a0fd8dd, 0x000000b0,
+0x00aa850f, 0xfcc50000, 0x8024ac28, 0xc5000000,
+0x249c7dd7, 0x000000a0, 0xd328f8c5, 0xe212d8c5,
+0x197de3c4, 0xd8c501db, 0xc5e4e3c6, 0xc4d316e8,
+0xd4186de3, 0x7cefc501, 0x28f8c5d9, 0x12d8c5d3,
+0x7de3c4e2, 0xc501db19, 0xe4e3c6d8, 0xd316e8c5,
+0x186de3c4, 0xefc501d4, 0xf8c5d97c, 0xd8c5d328,
+0xe3c4e212, 0x01db197d, 0xe3c6d8c5, 0x16e8c5e4,
+0x6de3c4d3, 0xc501d418, 0xc5d17cef, 0xc5da28f8,
+0xc4e312d8, 0xd2197de3, 0xc6d8c501, 0xe0c5e4e2,
+0xe3c4da16, 0x01dc1865, 0xd9c2e4c5, 0x50fcc500,
+0x00ff3dc3, 0x67b80000, 0x0f000007, 0x05ebc244,
+0x00075eb8, 0xfc5d8b00, 0x0000c3c9, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0xbf800000, 0x80000000, 0x41100000, 0x3f000000,
+0x42100000, 0x00000000, 0x00000000, 0x00000000,
+0x3f800000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x42f00000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0003540,
+};
+asm(".type avx_x86_32_D_32f4, STT_NOTYPE;");
+asm(".type avx_x86_32_D_32f4, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx_x86_32_D_32f8[] = {
+0xd95500eb, 0x83e589e8, 0xec81e0e4, 0x000000e0,
+0x802494dd, 0xd9000000, 0x10060005, 0x2494dd00,
+0x000000a0, 0x94ddc9d9, 0x0000c024, 0x0405d900,
+0xdd001006, 0x00882494, 0x05d90000, 0x00100608,
+0xa82494dd, 0xd9000000, 0xdde0d9e8, 0x00c82494,
+0xc9d90000, 0x90249cdd, 0xd9000000, 0x249cddc9,
+0x000000b0, 0x94ddc9d9, 0x0000d024, 0xddcad900,
+0x0098249c, 0xc9d90000, 0xb8249cdd, 0xdd000000,
+0x00d8249c, 0xfdc50000, 0x8024bc28, 0xc5000000,
+0x247c29fd, 0x28fdc520, 0xc520244c, 0x00d7c2f5,
+0xd250fdc5, 0xb80ffa83, 0x00000539, 0x0548850f,
+0xf5c50000, 0x80249458, 0xc5000000, 0x245429fd,
+0x28fdc540, 0x008024b4, 0xcdc50000, 0xedc5d658,
+0x402454c2, 0x50fdc500, 0x0ffa83d2, 0x00053fb8,
+0x13850f00, 0xc5000005, 0x247c28fd, 0x5cc5c540,
+0x00802494, 0xfdc50000, 0x60245429, 0x54c2f5c5,
+0xc5006024, 0x83d250fd, 0x44b80ffa, 0x0f000005,
+0x0004e585, 0x28fdc500, 0x00a024ac, 0xf5c50000,
+0x80248c59, 0xc5000000, 0xc5dd59d5, 0x249428fd,
+0x00000080, 0xed58edc5, 0xa45cedc5, 0x0000a024,
+0x5cf5c500, 0x59ddc5cb, 0xc2f5c5e5, 0xfdc500cc,
+0xfa83d150, 0x055bb80f, 0x850f0000, 0x0000049a,
+0x8c59edc5, 0x0000c024, 0x29fdc500, 0xc520244c,
+0x24945eed, 0x000000c0, 0xcac2f5c5, 0x50fdc500,
+0x0ffa83d1, 0x000564b8, 0x6b850f00, 0xc4000004,
+0x1d197de2, 0x00100618, 0x9428fdc5, 0x0000c024,
+0x57edc500, 0x57e5c5cb, 0x0080249c, 0xf5c50000,
+0x20244c59, 0xcbc2f5c5, 0x50fdc500, 0x0ffa83d1,
+0x000567b8, 0x2f850f00, 0xc5000004, 0x248ce6ff,
+0x00000080, 0xc9e6fec5, 0x8cc2f5c5, 0x00008024,
+0xfdc50000, 0xfa83d150, 0x056eb80f, 0x850f0000,
+0x00000406, 0x8c5afdc5, 0x00008024, 0x75e3c400,
+0xc501c918, 0xc5c953fc, 0xc5c95afc, 0x244c29fd,
+0x5afdc520, 0xc520244c, 0x249c28fd, 0x00000080,
+0x4c29f8c5, 0xe3c41024, 0x01c91875, 0xc953fcc5,
+0xc95afcc5, 0xc9e6ffc5, 0xc9e6fec5, 0xcbc2f5c5,
+0x50fdc500, 0x0ffa83d1, 0x000575b8, 0xa7850f00,
+0xc5000003, 0xc5cb59e5, 0x244c29fd, 0x5afdc520,
+0xc420244c, 0xc91875e3, 0x52fcc501, 0x5afcc5c9,
+0x29fdc5c9, 0xc540244c, 0x246428fd, 0x5afdc540,
+0x057cb8cc, 0xf8c50000, 0x10244c29, 0x1875e3c4,
+0xfcc501c9, 0xfcc5c953, 0xffc5c95a, 0xfec5c9e6,
+0xe5c5c9e6, 0xc500d9c2, 0x83d350fd, 0x850f0ffa,
+0x00000346, 0x9c28fdc5, 0x00008024, 0x5afdc500,
+0xe6ffc5cb, 0xe6fec5e4, 0x057eb8e4, 0xf8c50000,
+0x10244c29, 0x1875e3c4, 0xfcc501c9, 0xfcc5c953,
+0xffc5c95a, 0xfec5c9e6, 0xddc5c9e6, 0xc500e1c2,
+0x83d450fd, 0x850f0ffa, 0x000002fe, 0xcb59e5c5,
+0x4c29fdc5, 0xfdc52024, 0x20244c51, 0xcbc2f5c5,
+0x50fdc500, 0x0ffa83d1, 0x00059cb8, 0xd7850f00,
+0xc4000002, 0x0d197de2, 0x00100640, 0xcb5ef5c5,
+0x4c29fdc5, 0xe3c42024, 0x244c097d, 0xf5c50b20,
+0x06400dc2, 0xc5000010, 0x83d150fd, 0xa4b80ffa,
+0x0f000005, 0x0002a185, 0x59edc500, 0x00a0248c,
+0xedc50000, 0xfdc5e359, 0x40244c29, 0x4c5fddc5,
+0xddc54024, 0x4024645d, 0x6429fdc5, 0xf5c54024,
+0x40244c58, 0x9c58e5c5, 0x0000a024, 0x59f5c500,
+0xc2f5c5ca, 0xfdc500cb, 0xfa83d150, 0x063db80f,
+0x850f0000, 0x00000252, 0x8c28fdc5, 0x00008024,
+0x28fdc500, 0x00a024a4, 0xe3c40000, 0x05d9057d,
+0x0665e3c4, 0xddc501db, 0xc500dbc2, 0x83d350fd,
+0x4eb80ffa, 0x0f000006, 0x00021d85, 0x0c05d900,
+0xc5001006, 0xb8cc58f5, 0x0000065d, 0x10245cdd,
+0x197de2c4, 0xc510245c, 0x00cbc2f5, 0xd150fdc5,
+0x0f0ffa83, 0x0001f185, 0x12ffc500, 0x0080248c,
+0xe2c40000, 0x2835197d, 0xc5001006, 0x249c28fd,
+0x00000080, 0xeb5cf5c5, 0x197de2c4, 0x1006200d,
+0x58edc500, 0x59f5c5c9, 0xc2d5c5ce, 0xfdc500c9,
+0xfa83d150, 0x0717b80f, 0x850f0000, 0x000001aa,
+0x5c29fdc5, 0xfbc54024, 0xa824b410, 0xc5000000,
+0x24bc10fb, 0x000000b8, 0x7411fbc5, 0xfbc54824,
+0x58247c11, 0xc957f1c5, 0xcac2f5c5, 0x28fdc501,
+0xc4402454, 0xdb4b5de3, 0xc2edc510, 0xfdc500db,
+0xfa83d350, 0x072ab80f, 0x850f0000, 0x0000015a,
+0x2d75e2c4, 0x0080249c, 0xf4c50000, 0x06600d55,
+0xfdc50010, 0x60245c29, 0x2f75e2c4, 0xc5602464,
+0x246c28fd, 0xc2d5c560, 0xfdc500ca, 0xfa83d150,
+0x0733b80f, 0x850f0000, 0x0000011e, 0xb428fdc5,
+0x00008024, 0x4de3c400, 0xa0248c0d, 0x0a000000,
+0xd1c2edc5, 0x50fdc500, 0x0ffa83d2, 0x00073ab8,
+0xf3850f00, 0xc5000000, 0x24bc28fd, 0x00000080,
+0x8cd0c5c5, 0x0000a024, 0x28fdc500, 0x00802494,
+0xedc50000, 0xa0249cd0, 0xc5000000, 0x00cbc2f5,
+0xd150fdc5, 0xb80ffa83, 0x00000743, 0x00b8850f,
+0xfdc50000, 0x20245429, 0xc957f1c5, 0x547cf5c5,
+0xe3c42024, 0x01da186d, 0x066de3c4, 0xe5c531d2,
+0xc50cd2c6, 0x245429fd, 0x7cf5c520, 0xc4202454,
+0xd2197de3, 0x17f9c501, 0xd9082454, 0x10061005,
+0x2444dd00, 0xdde9df08, 0x756a7ad8, 0x0000ba68,
+0xfdc50000, 0x8024ac28, 0xc5000000, 0x24947dd5,
+0x000000a0, 0x186de3c4, 0xe3c401da, 0x31d2066d,
+0xdac6e5c5, 0x7ce5c50c, 0x65e3c4d9, 0xc401d318,
+0xdb0665e3, 0xc6edc531, 0xedc50cd3, 0xe3c4d17c,
+0x01da186d, 0x066de3c4, 0xe5c531d2, 0xc50cd2c6,
+0x00c9c2ed, 0xc150fdc5, 0xb80ff883, 0x00000767,
+0xebc2440f, 0x075eb805, 0xc3c90000, 0x00000000,
+0x40800000, 0x40000000, 0x40400000, 0x40a00000,
+0x41200000, 0x00000000, 0x00000000, 0x80000000,
+0x00000000, 0xbff00000, 0x00000000, 0x3fe00000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x3ff00000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+0003200,
+};
+asm(".type avx_x86_32_D_32f8, STT_NOTYPE;");
+asm(".type avx_x86_32_D_32f8, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx_x86_32_D_f4[] = {
+0x31551aeb, 0x80e589c0, 0xff08287c, 0x83400a75,
+0xf37504f8, 0x02eb01b0, 0xc35dc031, 0x04244c8d,
+0xffe0e483, 0x8955fc71, 0xec8151e5, 0x00000124,
+0x0d10fac5, 0x00100560, 0x8d11fac5, 0xffffff28,
+0x8d11fac5, 0xffffff2c, 0x8d11fac5, 0xffffff30,
+0xff28858b, 0x8589ffff, 0xffffff1c, 0x9510fac5,
+0xffffff28, 0x00bac031, 0xc5000000, 0x1c952ef8,
+0x0fffffff, 0x450fc09b, 0x89d8f7c2, 0x7fe82404,
+0x83ffffff, 0xc18810c4, 0x000539b8, 0x0fc98400,
+0x0004c384, 0x10fac500, 0xffff1c95, 0x58eac5ff,
+0xffff2895, 0x11fac5ff, 0xffff2095, 0x10fac5ff,
+0xffff2895, 0x10ec83ff, 0xeac5c031, 0xf8c5d258,
+0xff20952e, 0x9b0fffff, 0xc2450fc0, 0x0489d8f7,
+0xff2ce824, 0xc483ffff, 0xb8c18810, 0x0000053f,
+0x840fc984, 0x00000470, 0x9510fac5, 0xffffff20,
+0x955ceac5, 0xffffff28, 0x9511fac5, 0xfffffee8,
+0xfee8858b, 0x8589ffff, 0xffffff5c, 0xff208589,
+0x8589ffff, 0xffffff24, 0x9510fac5, 0xffffff1c,
+0x3110ec83, 0x2ef8c5c0, 0xffff2495, 0xc09b0fff,
+0xf7c2450f, 0x240489d8, 0xfffec5e8, 0x10c483ff,
+0x44b8c188, 0x84000005, 0x09840fc9, 0xc5000004,
+0x1c9510fa, 0xc5ffffff, 0x289559ea, 0xc5ffffff,
+0x1c9511fa, 0xc5ffffff, 0x2c9510fa, 0xc5ffffff,
+0xc5d259ea, 0x209511fa, 0xc5ffffff, 0x289510fa,
+0xc5ffffff, 0x2c9558ea, 0xc5ffffff, 0x249511fa,
+0xc5ffffff, 0x289510fa, 0x83ffffff, 0xfac510ec,
+0xff1ca510, 0xc031ffff, 0x9d5ceac5, 0xffffff2c,
+0xa55cdac5, 0xffffff20, 0x9d59e2c5, 0xffffff24,
+0x9d11fac5, 0xffffff24, 0xe32ef8c5, 0x0fc09b0f,
+0xd8f7c245, 0xe8240489, 0xfffffe26, 0x8810c483,
+0x055bb8c1, 0xc9840000, 0x036a840f, 0xeac50000,
+0xff309559, 0xfac5ffff, 0xff1c9511, 0xfac5ffff,
+0xff289510, 0xec83ffff, 0xc5c03110, 0x30955eea,
+0xc5ffffff, 0x1c952ef8, 0xc5ffffff, 0x209511fa,
+0x0fffffff, 0x450fc09b, 0x89d8f7c2, 0xcfe82404,
+0x83fffffd, 0xc18810c4, 0x000564b8, 0x0fc98400,
+0x00031384, 0x10fac500, 0x10057025, 0x10ec8300,
+0x9510fac5, 0xffffff30, 0xfac5c031, 0xff289d10,
+0xe8c5ffff, 0xeac5d457, 0xff1c9559, 0xe0c5ffff,
+0xf8c5dc57, 0x9b0fd32e, 0xc2450fc0, 0x0489d8f7,
+0xfd7ce824, 0xc483ffff, 0xb8c18810, 0x00000567,
+0x840fc984, 0x000002c0, 0x852cfac5, 0xffffff28,
+0xff348589, 0xeac5ffff, 0xff34952a, 0xfac5ffff,
+0xff1c9511, 0xfac5ffff, 0xff1c9510, 0xec83ffff,
+0xc5c03110, 0x28952ef8, 0x0fffffff, 0x450fc09b,
+0x89d8f7c2, 0x27e82404, 0x83fffffd, 0xc18810c4,
+0x00056eb8, 0x0fc98400, 0x00026b84, 0x530ff300,
+0xffff2895, 0x11fac5ff, 0xffff1c95, 0x530ff3ff,
+0xffff1c95, 0x2cfac5ff, 0x348589c2, 0xc5ffffff,
+0x349d2ae2, 0x83ffffff, 0xc03110ec, 0x9510fac5,
+0xffffff28, 0xda2ef8c5, 0x0fc09b0f, 0xd8f7c245,
+0xe8240489, 0xfffffcca, 0x8810c483, 0x0575b8c1,
+0xc9840000, 0x020e840f, 0xeac50000, 0xfac5d259,
+0xff1c9511, 0x0ff3ffff, 0xff1c9552, 0xfac5ffff,
+0xff209511, 0x0ff3ffff, 0xff209553, 0xfac5ffff,
+0x8589c22c, 0xffffff34, 0x952aeac5, 0xffffff34,
+0x3110ec83, 0x2ef8c5c0, 0xffff2895, 0xc09b0fff,
+0xf7c2450f, 0x240489d8, 0xfffc65e8, 0x10c483ff,
+0x7cb8c188, 0x84000005, 0xa9840fc9, 0xc5000001,
+0x20852cfa, 0x89ffffff, 0xffff3485, 0x530ff3ff,
+0xffff2895, 0x2cfac5ff, 0x2ae2c5c2, 0xffff349d,
+0x348589ff, 0xc5ffffff, 0x34952aea, 0x83ffffff,
+0xc03110ec, 0xda2ef8c5, 0x0fc09b0f, 0xd8f7c245,
+0xe8240489, 0xfffffc0a, 0x8810c483, 0x057eb8c2,
+0xd2840000, 0x014e840f, 0xfac50000, 0xff289510,
+0xeac5ffff, 0xfac5d259, 0xff1c9511, 0xfac5ffff,
+0xff289510, 0xec83ffff, 0xbac03110, 0x00000000,
+0x9d510ff3, 0xffffff1c, 0xda2ef8c5, 0x0fc09b0f,
+0xd8f7c245, 0xe8240489, 0xfffffbb6, 0x8810c483,
+0x059cb8c1, 0xc9840000, 0x00fa840f, 0xf2c50000,
+0xfac5d25e, 0xff208d11, 0xfac5ffff, 0xff1c9511,
+0xc031ffff, 0x6610ec83, 0x8d0a3a0f, 0xffffff1c,
+0x2ef8c50b, 0xffff208d, 0x11fac5ff, 0xffff248d,
+0xc09b0fff, 0xf7c2450f, 0x240489d8, 0xfffb61e8,
+0x10c483ff, 0xa4b8c188, 0x84000005, 0xa5840fc9,
+0xc5000000, 0x308d10fa, 0xc5ffffff, 0x289559f2,
+0xc5ffffff, 0x2c8d59f2, 0xc5ffffff, 0x1c9511fa,
+0xc5ffffff, 0x208d11fa, 0xc5ffffff, 0x1c8d10fa,
+0xc5ffffff, 0x208d5ff2, 0xc5ffffff, 0x248d11fa,
+0xc5ffffff, 0x1c8d10fa, 0xc5ffffff, 0x208d5df2,
+0xc5ffffff, 0x208d11fa, 0xc5ffffff, 0x208d10fa,
+0x83ffffff, 0xfac510ec, 0xff289510, 0xc031ffff,
+0x8d58f2c5, 0xffffff24, 0x9558eac5, 0xffffff2c,
+0x8d59f2c5, 0xffffff30, 0xca2ef8c5, 0x0fc09b0f,
+0xd8f7c245, 0xe8240489, 0xfffffab6, 0x3c10c483,
+0x25c01901, 0x0000063d, 0xc9fc4d8b, 0xc3fc618d,
+0x3f800000, 0x00000000, 0x00000000, 0x00000000,
+0x80000000, 0x00000000, 0x00000000, 0x00000000,
+0002600,
+};
+asm(".type avx_x86_32_D_f4, STT_NOTYPE;");
+asm(".type avx_x86_32_D_f4, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx_x86_32_D_f8[] = {
+0x895500eb, 0xe0e483e5, 0x01e0ec81, 0xfbc50000,
+0x05900d10, 0xfbc50010, 0x68244c11, 0x4c11fbc5,
+0xfbc57024, 0x78244c11, 0x6824448b, 0x50244489,
+0x6c24448b, 0x54244489, 0x6c10fbc5, 0xf9c56824,
+0x50246c2e, 0x01b80c7a, 0xba000000, 0x00000000,
+0xc0310474, 0xd8f7d231, 0x18244489, 0xb800d283,
+0x00000539, 0x5489daf7, 0x6f0f1c24, 0x0f182444,
+0xfa81d0d7, 0x000000ff, 0x0506850f, 0xfbc50000,
+0x50247410, 0x5458cbc5, 0xfbc56824, 0x58245411,
+0xfbc5d231, 0x68245410, 0x000001b8, 0x58ebc500,
+0x2ef9c5d2, 0x7a582454, 0x31047402, 0xf7d231c0,
+0x244489d8, 0x00d28318, 0x00053fb8, 0x89daf700,
+0x0f1c2454, 0x18244c6f, 0x81d1d70f, 0x0000fffa,
+0xad850f00, 0xc5000004, 0x247c10fb, 0x5cc3c558,
+0xc5682454, 0x245411fb, 0x24548b20, 0x24448b20,
+0x24948924, 0x000000c8, 0xcc248489, 0x89000000,
+0x89582454, 0x895c2444, 0x89602454, 0x31642444,
+0x10fbc5d2, 0xb8502464, 0x00000001, 0x642ef9c5,
+0x027a6024, 0xc0310474, 0xd8f7d231, 0x18244489,
+0xb800d283, 0x00000544, 0x5489daf7, 0x6f0f1c24,
+0x0f182454, 0xfa81d2d7, 0x000000ff, 0x0432850f,
+0xfbc50000, 0x50246c10, 0x5459d3c5, 0xfbc56824,
+0x50245411, 0x5410fbc5, 0xebc57024, 0xfbc5d259,
+0x58245411, 0x7410fbc5, 0xcbc56824, 0x70245458,
+0x5411fbc5, 0xd2316024, 0x5410fbc5, 0xfbc56824,
+0x50247c10, 0x5c5cebc5, 0xc3c57024, 0x5824645c,
+0x5c59e3c5, 0x01b86024, 0xc5000000, 0x245c11fb,
+0x2ef9c560, 0x74027ae3, 0x31c03104, 0x89d8f7d2,
+0x83182444, 0x5bb800d2, 0xf7000005, 0x245489da,
+0x5c6f0f1c, 0xd70f1824, 0xfffa81d3, 0x0f000000,
+0x00039f85, 0x59ebc500, 0xc5782454, 0x245411fb,
+0xc5d23150, 0x246410fb, 0x0001b868, 0xdbc50000,
+0x7824545e, 0x5411fbc5, 0xf9c55824, 0x5024542e,
+0x0474027a, 0xd231c031, 0x4489d8f7, 0xd2831824,
+0x0564b800, 0xdaf70000, 0x1c245489, 0x24646f0f,
+0xd4d70f18, 0x00fffa81, 0x850f0000, 0x00000344,
+0x1d7efac5, 0x001005a0, 0xfbc5d231, 0x78246c10,
+0x7410fbc5, 0xd1c56824, 0x01b8d357, 0xc5000000,
+0x245459eb, 0x57c9c550, 0x2ef9c5db, 0x74027ad3,
+0x31c03104, 0x89d8f7d2, 0x83182444, 0x67b800d2,
+0xf7000005, 0x245489da, 0x6c6f0f1c, 0xd70f1824,
+0xfffa81d5, 0x0f000000, 0x0002e785, 0x2cfbc500,
+0x89682444, 0xc54c2444, 0x24542aeb, 0x11fbc54c,
+0x31502454, 0x10fbc5d2, 0xb850247c, 0x00000001,
+0x7c2ef9c5, 0x027a6824, 0xc0310474, 0xd8f7d231,
+0x18244489, 0xb800d283, 0x0000056e, 0x5489daf7,
+0x6f0f1c24, 0x0f182474, 0xfa81d6d7, 0x000000ff,
+0x028e850f, 0x0ff20000, 0x6824545a, 0xd2530ff3,
+0xd25a0ff3, 0x5413f9c5, 0x0ff25024, 0x5024545a,
+0xd2530ff3, 0xd25a0ff3, 0xc22cfbc5, 0x4c244489,
+0x5c2ae3c5, 0xd2314c24, 0x5410fbc5, 0x01b86824,
+0xc5000000, 0x7ada2ef9, 0x31047402, 0xf7d231c0,
+0x244489d8, 0x00d28318, 0x000575b8, 0x89daf700,
+0x0f1c2454, 0x18247c6f, 0x81d7d70f, 0x0000fffa,
+0x1d850f00, 0xc5000002, 0xc5d259eb, 0x245411fb,
+0x5a0ff250, 0xf3502454, 0xf3d2520f, 0xc5d25a0f,
+0x245413f9, 0x5a0ff258, 0xf3582454, 0xf3d2530f,
+0xc5d25a0f, 0x89c22cfb, 0xc54c2444, 0x24542aeb,
+0xb8d2314c, 0x00000001, 0x542ef9c5, 0x027a6824,
+0xc0310474, 0xd8f7d231, 0x18244489, 0xb800d283,
+0x0000057c, 0x5489daf7, 0x6f0f1c24, 0x0f182444,
+0xfa81d0d7, 0x000000ff, 0x01a6850f, 0xfbc50000,
+0x5824442c, 0x4c244489, 0x545a0ff2, 0x0ff36824,
+0x0ff3d253, 0xfbc5d25a, 0x448bd22c, 0x54894c24,
+0x443b4c24, 0x940f4c24, 0x0fd231c0, 0xd8f7c0b6,
+0x18244489, 0xb800d283, 0x0000057e, 0x5489daf7,
+0x6f0f1c24, 0x0f18244c, 0xfa81d1d7, 0x000000ff,
+0x014e850f, 0xfbc50000, 0x68245410, 0xd259ebc5,
+0x5411fbc5, 0xd2315024, 0x5410fbc5, 0x01b86824,
+0xf2000000, 0x245c510f, 0x2ef9c550, 0x74027ada,
+0x31c03104, 0x89d8f7d2, 0x83182444, 0x9cb800d2,
+0xf7000005, 0x245489da, 0x546f0f1c, 0xd70f1824,
+0xfffa81d2, 0x0f000000, 0x0000f785, 0x5ef3c500,
+0x11fbc5d2, 0xc558244c, 0x245411fb, 0xb8d23150,
+0x00000001, 0x0b3a0f66, 0x0b50244c, 0x4c11fbc5,
+0xf9c56024, 0x58244c2e, 0x0474027a, 0xd231c031,
+0x4489d8f7, 0xd2831824, 0x05a4b800, 0xdaf70000,
+0x1c245489, 0x245c6f0f, 0xd3d70f18, 0x00fffa81,
+0x850f0000, 0x0000009c, 0x4c10fbc5, 0xf3c57824,
+0x68245459, 0x4c59f3c5, 0xfbc57024, 0x50245411,
+0x4c11fbc5, 0xfbc55824, 0x50246410, 0x4c5fdbc5,
+0xfbc55824, 0x60244c11, 0x6c10fbc5, 0xd3c55024,
+0x58244c5d, 0x4c11fbc5, 0xd2315824, 0x7410fbc5,
+0xfbc55824, 0x68247c10, 0x4c58cbc5, 0xc3c56024,
+0x70245458, 0x4c59f3c5, 0x01b87824, 0xc5000000,
+0x7aca2ef9, 0x31047402, 0xf7d231c0, 0x244489d8,
+0x00d28318, 0x5489daf7, 0x00ba1c24, 0x0f000000,
+0x1824646f, 0x3dc4d70f, 0x000000ff, 0x00063db8,
+0xc2440f00, 0x0000c3c9, 0x00000000, 0x00000000,
+0x00000000, 0x3ff00000, 0x00000000, 0x00000000,
+0x00000000, 0x80000000, 0x00000000, 0x00000000,
+0002660,
+};
+asm(".type avx_x86_32_D_f8, STT_NOTYPE;");
+asm(".type avx_x86_32_D_f8, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx_x86_64_D_16f4[] = {
+0xb84800eb, 0x3f800000, 0x40000000, 0xe5894855,
+0xd0458948, 0x0000b848, 0x00004040, 0x89484080,
+0xb848d845, 0x40800000, 0x40400000, 0xe0458948,
+0x000001b8, 0xe0c148fe, 0x4589481e, 0x00b848e8,
+0x003f8000, 0x48bf8000, 0x48f04589, 0xc5f84589,
+0xd07d28f8, 0x7d29f8c5, 0x28f8c5a0, 0xf1c5a055,
+0x39b8c976, 0xc5000005, 0x00dfc2e8, 0x0e79e2c4,
+0x26830fd9, 0xc5000004, 0xd05d58e8, 0x5d29f8c5,
+0x28f8c5b0, 0x3fb8d05d, 0xc5000005, 0xc5db58e0,
+0xb05dc2e0, 0x79e2c400, 0x830fd90e, 0x000003fd,
+0x7d28f8c5, 0x5cc0c5b0, 0xf8c5d05d, 0xc5c05d29,
+0xc05dc2e8, 0x0544b800, 0xe2c40000, 0x0fd90e79,
+0x0003d883, 0x28f8c500, 0xe8c5e05d, 0xc5d05559,
+0xc5e359e0, 0xd05d28f8, 0x7558e0c5, 0x5ce0c5e0,
+0xe8c5e06d, 0x5bb8d45c, 0xc5000005, 0xc5ee59d0,
+0x00d5c2e8, 0x0e79e2c4, 0x9e830fd1, 0xc5000003,
+0xf05559e0, 0x5529f8c5, 0x5ee0c5a0, 0xe8c5f05d,
+0xb800d3c2, 0x00000564, 0x0e79e2c4, 0x7a830fd1,
+0xc4000003, 0x1d1879e2, 0x00000374, 0x6528f8c5,
+0x0567b8f0, 0xd8c50000, 0xe0c5d357, 0xc5d05d57,
+0xa05559e8, 0xd3c2e8c5, 0x79e2c400, 0x830fd10e,
+0x00000349, 0x555bf9c5, 0x5bf8c5d0, 0xc2e8c5d2,
+0xb800d055, 0x0000056e, 0x0e79e2c4, 0x2a830fd1,
+0xc5000003, 0xd05553f8, 0x5529f8c5, 0x53f8c5a0,
+0xf8c5a055, 0xb8d05d28, 0x00000575, 0xd25bf9c5,
+0xd25bf8c5, 0xd3c2e8c5, 0x79e2c400, 0x830fd10e,
+0x000002f9, 0xd359e0c5, 0x5529f8c5, 0x52f8c5a0,
+0xf8c5a055, 0xc5b05529, 0xb05528f8, 0x00057cb8,
+0x53f8c500, 0x5bf9c5ea, 0x5bf8c5ed, 0xc2e0c5ed,
+0xe2c400dd, 0x0fd90e79, 0x0002c083, 0x5bf9c500,
+0x28f8c5da, 0xf8c5d055, 0x7eb8db5b, 0xc5000005,
+0xc5ea53f8, 0xc5ed5bf9, 0xc5ed5bf8, 0x00ddc2e0,
+0x0e79e2c4, 0x92830fd9, 0xc5000002, 0xc5da59e8,
+0xa05d29f8, 0x5d51f8c5, 0x059cb8a0, 0xe0c50000,
+0xc400dac2, 0xd90e79e2, 0x026f830f, 0xe2c40000,
+0x792d1879, 0xc5000002, 0xc5da5ed0, 0xa05d29f8,
+0x0879e3c4, 0xb80ba05d, 0x000005a4, 0x1dc2e0c5,
+0x0000025b, 0x79e2c400, 0x830fd90e, 0x0000023d,
+0x5d59d8c5, 0x59d8c5e0, 0x29f8c5f2, 0xc8c5b05d,
+0xc5b05d5f, 0xb0755dc8, 0x7529f8c5, 0x58e0c5b0,
+0xe8c5b05d, 0xb8e05558, 0x0000063d, 0xdc59e0c5,
+0xd2c2e0c5, 0x79e2c400, 0x830fd10e, 0x000001fd,
+0x0479e3c4, 0xb81bd055, 0x0000064e, 0x55c2e8c5,
+0xe2c400e0, 0x0fd10e79, 0x0001e083, 0x28f8c500,
+0xf8c5e055, 0xb8d07528, 0x00000653, 0xda5bf9c5,
+0x1dfae1c5, 0x000001e8, 0x0c49e2c4, 0xc2e8c5db,
+0xe2c400db, 0x0fd90e79, 0x0001b083, 0x58c8c500,
+0x065db8f2, 0xc8c50000, 0x01e135c2, 0xc4000000,
+0xf10e79e2, 0x0193830f, 0xe8c50000, 0xc5d05d14,
+0xd07515e8, 0xde5ce0c5, 0x0006a6b8, 0x59e0c500,
+0xc2e0c5dc, 0x0001c61d, 0xe2c40000, 0x0fd90e79,
+0x00016883, 0x12fac500, 0xe2c4d05d, 0x61351879,
+0xc5000001, 0xd05d5ce0, 0x000717b8, 0x79e2c400,
+0x01523d18, 0xc8c50000, 0xc8c5f458, 0xe0c5f759,
+0xc400dec2, 0xd90e79e2, 0x012f830f, 0xfac50000,
+0xc5d05d16, 0xc5ed58d8, 0xd07528f8, 0x00071eb8,
+0x5ce0c500, 0x59d0c5de, 0xc2e0c5ef, 0xe2c400dd,
+0x0fd90e79, 0x00010483, 0x10fac500, 0xf8c5e45d,
+0xb8b07529, 0x0000072a, 0x5d11fac5, 0x10fac5b4,
+0xfac5ec5d, 0xc5bc5d11, 0xc5db57e0, 0x01dcc2e0,
+0x4a69e3c4, 0xf8c530d6, 0xc5b05d28, 0x00d2c2e0,
+0x0e79e2c4, 0xc2830fd1, 0xc5000000, 0xd07d28f8,
+0x00073ab8, 0x41e3c400, 0x0ae0550c, 0xdac2e0c5,
+0x79e2c400, 0x830fd90e, 0x000000a1, 0x6528f8c5,
+0xd0dbc5d0, 0xf8c5e055, 0xc5d07d28, 0xe05dd0c3,
+0x000743b8, 0xc2e8c500, 0xe2c400d3, 0x73d10e79,
+0x28f8c57c, 0xe3c4d05d, 0xe0554061, 0x0752b8f1,
+0xe8c50000, 0x009515c2, 0xc4000000, 0xd10e79e2,
+0xf8c55b73, 0xc5a05d29, 0xc5db57e0, 0xa0557ce3,
+0x5529f8c5, 0x7ce3c5a0, 0xe8c5a055, 0xc5ffd2c6,
+0x45152ef8, 0x7a000000, 0xc52d752f, 0xd06528f8,
+0x557ddbc5, 0xc5c031e0, 0xc5d37ceb, 0xc5d37ceb,
+0x00d3c2e8, 0x0e79e2c4, 0xc0920fd1, 0x1901f883,
+0x076725c0, 0x05eb0000, 0x00075eb8, 0x00c35d00,
+0x80000000, 0xbf800000, 0x3f000000, 0x41200000,
+0x3f800000, 0x00000000, 0x00000000, 0x00000000,
+0x00000001, 0x00000001, 0x00000001, 0x00000001,
+0x41a00000, 0x00000000, 0x00000000, 0x00000000,
+0x40a00000, 0x40a00000, 0x40a00000, 0x40a00000,
+0x40000000, 0x40000000, 0x40000000, 0x40000000,
+0002400,
+};
+asm(".type avx_x86_64_D_16f4, STT_NOTYPE;");
+asm(".type avx_x86_64_D_16f4, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx_x86_64_D_16f8[] = {
+0x485500eb, 0xfbc5e589, 0x04820d10, 0xfbc50000,
+0x044a1510, 0x8b480000, 0x00044b05, 0x11fbc500,
+0x8948d04d, 0xfbc5f845, 0xc5e05511, 0xf04d11fb,
+0x5511fbc5, 0x11fbc5d8, 0xf9c5e84d, 0xc5d07d28,
+0xa07d29f9, 0x5528f9c5, 0x76f1c5a0, 0x0539b8c9,
+0xe9c50000, 0xc400dfc2, 0xd90f79e2, 0x03f3830f,
+0xe9c50000, 0xc5d05d58, 0xb05d29f9, 0x5d28f9c5,
+0x053fb8d0, 0xe1c50000, 0xe1c5db58, 0x00b05dc2,
+0x0f79e2c4, 0xca830fd9, 0xc5000003, 0xb07d28f9,
+0x5d5cc1c5, 0x29f9c5d0, 0xe9c5c05d, 0x00c05dc2,
+0x000544b8, 0x79e2c400, 0x830fd90f, 0x000003a5,
+0x5d28f9c5, 0x59e9c5e0, 0xe1c5d055, 0xf9c5e359,
+0xc5d05d28, 0xe07558e1, 0x6d5ce1c5, 0x5ce9c5e0,
+0x055bb8d4, 0xd1c50000, 0xe9c5ee59, 0xc400d5c2,
+0xd10f79e2, 0x036b830f, 0xe1c50000, 0xc5f05559,
+0xa05529f9, 0x5d5ee1c5, 0xc2e9c5f0, 0x64b800d3,
+0xc4000005, 0xd10f79e2, 0x0347830f, 0xf9c50000,
+0xc5f05d28, 0x552512fb, 0xb8000003, 0x00000567,
+0xd457e1c5, 0x6557d9c5, 0x59e9c5d0, 0xe9c5a055,
+0xc400d4c2, 0xd10f79e2, 0x0317830f, 0xfbc50000,
+0xc5d055e6, 0xc5d2e6fa, 0xd055c2e9, 0x056eb800,
+0xe2c40000, 0x0fd10f79, 0x0002f883, 0x5af9c500,
+0xf8c5d055, 0xf8c5d253, 0xf9c5d25a, 0xc5a05529,
+0xa0555af9, 0xd253f8c5, 0x6d28f9c5, 0x0575b8d0,
+0xf8c50000, 0xfbc5d25a, 0xfac5d2e6, 0xe9c5d2e6,
+0xc400d5c2, 0xd10f79e2, 0x02b7830f, 0xd1c50000,
+0xf9c5d559, 0xc5a05529, 0xa0555af9, 0xd252f8c5,
+0xd25af8c5, 0x5529f9c5, 0x28f9c5b0, 0x7cb8b065,
+0xc5000005, 0xc5d45af9, 0xc5d253f8, 0xc5d25af8,
+0xc5d2e6fb, 0xc5d2e6fa, 0x00eac2d1, 0x0f79e2c4,
+0x6e830fe9, 0xc5000002, 0xc5e4e6fb, 0xc5ece6fa,
+0xd06528f9, 0x00057eb8, 0x5af9c500, 0x53f8c5d4,
+0x5af8c5d2, 0xe6fbc5d2, 0xe6fac5d2, 0xc2d1c5d2,
+0xe2c400d2, 0x0fd10f79, 0x00023883, 0x59d9c500,
+0x29f9c5d4, 0xf9c5a055, 0xc5a05551, 0x00d4c2e9,
+0x00059cb8, 0x79e2c400, 0x830fd10f, 0x00000215,
+0x2d12fbc5, 0x00000248, 0xd45ed1c5, 0x5529f9c5,
+0x79e3c4a0, 0x0ba05509, 0x0005a4b8, 0xc2e9c500,
+0x00022a15, 0xe2c40000, 0x0fd10f79, 0x0001e483,
+0x59e1c500, 0xe1c5e055, 0xf9c5f459, 0xc5b05529,
+0xb0555fc9, 0x755dc9c5, 0x29f9c5b0, 0xe9c5b075,
+0xc5b05558, 0xe06558d9, 0x00063db8, 0x59e9c500,
+0xc2e9c5d3, 0xe2c400d4, 0x0fd10f79, 0x0001a483,
+0x79e3c400, 0x01d05505, 0x00064eb8, 0xc2e9c500,
+0xc400e055, 0xd10f79e2, 0x0187830f, 0xf9c50000,
+0xc5e05528, 0xd07d28f9, 0x000653b8, 0xe6fbc500,
+0xfad9c5e2, 0x0001b725, 0x79e2c400, 0xd9c5e425,
+0xc401f473, 0xe40d41e2, 0xe4c2e9c5, 0x79e2c400,
+0x830fe10f, 0x0000014d, 0x6516e9c5, 0x28f9c5d0,
+0xe9c5d07d, 0xd9c5f715, 0xa8b8e65c, 0xc5000006,
+0xc5e359d9, 0x00e5c2d9, 0x0f79e2c4, 0x22830fe1,
+0xf2000001, 0xd065120f, 0x2d12fbc5, 0x00000128,
+0xed58e1c5, 0x7528f9c5, 0x12fbc5d0, 0x0001273d,
+0x0717b800, 0xd9c50000, 0xd1c5e65c, 0xd9c5ef59,
+0xc400e5c2, 0xe10f79e2, 0x00e7830f, 0xfbc50000,
+0xc5e86510, 0xb07529f9, 0x00072ab8, 0x11fbc500,
+0xd9c5b865, 0xd9c5e457, 0xc401dbc2, 0xd64b69e3,
+0x28f9c530, 0xe1c5b05d, 0xc400d2c2, 0xd10f79e2,
+0x00af830f, 0xf9c50000, 0xb8d07d28, 0x0000073a,
+0x0d41e3c4, 0xc502e055, 0x00dac2e1, 0x0f79e2c4,
+0x8e830fd9, 0xc5000000, 0xd07d28f9, 0x55d0c1c5,
+0x28f9c5e0, 0xc9c5d075, 0xb8e05dd0, 0x00000743,
+0xd3c2e9c5, 0x79e2c400, 0x6973d10f, 0x5d28f9c5,
+0x61e3c4d0, 0x31e05541, 0x000752b8, 0xc2e9c500,
+0x0000aa15, 0xe2c40000, 0x73d10f79, 0x29f9c548,
+0xd9c5a05d, 0xc5a0557c, 0xc5d215e9, 0x5d152ef9,
+0x7a000000, 0xc529752b, 0xd07d28f9, 0x557dc1c5,
+0xc5c031e0, 0xc5d47ce9, 0x00d4c2e9, 0x0f79e2c4,
+0xc0920fd1, 0x1901f883, 0x076725c0, 0x05eb0000,
+0x00075eb8, 0x00c35d00, 0x00000000, 0x00000000,
+0x00000000, 0x40000000, 0x00000000, 0xbff00000,
+0x00000000, 0x80000000, 0x00000000, 0x3fe00000,
+0x00000000, 0x40080000, 0x00000000, 0x00000000,
+0x00000000, 0x3ff00000, 0x00000000, 0x00000000,
+0x00000001, 0x00000001, 0x00000001, 0x00000001,
+0x00000000, 0x40100000, 0x00000000, 0x00000000,
+0002300,
+};
+asm(".type avx_x86_64_D_16f8, STT_NOTYPE;");
+asm(".type avx_x86_64_D_16f8, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx_x86_64_D_32f4[] = {
+0x315500eb, 0x0008bac0, 0x89480000, 0xe48348e5,
+0xec8348e0, 0x01488d68, 0xc92af2c5, 0xc129d189,
+0x4c11fac5, 0xf2c50884, 0xfac5c92a, 0x28844c11,
+0x0d10fac5, 0x00000628, 0x087501a8, 0x0d10fac5,
+0x0000063c, 0x4c11fac5, 0xff484884, 0xf88348c0,
+0xc5c27508, 0x247c28fc, 0x29fcc508, 0xc5a8247c,
+0x244c28fc, 0x0539b8a8, 0xf4c50000, 0xc500d7c2,
+0x81d250fc, 0x0000fffa, 0xdd850f00, 0xc5000005,
+0x245458f4, 0x29fcc508, 0xc5c82454, 0x247c28fc,
+0x053fb808, 0xc4c50000, 0xecc5d758, 0xc82454c2,
+0x50fcc500, 0xfffa81d2, 0x0f000000, 0x0005ab85,
+0x28fcc500, 0xc5c8247c, 0x24545cc4, 0x29fcc508,
+0xc5e82454, 0x2454c2f4, 0x44b800e8, 0xc5000005,
+0x81d250fc, 0x0000fffa, 0x7d850f00, 0xc5000005,
+0x247428fc, 0x59f4c528, 0xc508244c, 0xc5de59cc,
+0x245428fc, 0x58ecc508, 0x5cecc5ee, 0xc5282464,
+0xb8cb5cf4, 0x0000055b, 0xe559dcc5, 0xccc2f4c5,
+0x50fcc500, 0xfffa81d1, 0x0f000000, 0x00053b85,
+0x59ecc500, 0xc548244c, 0x244c29fc, 0x5eecc5a8,
+0xc5482454, 0x00cac2f4, 0x000564b8, 0x50fcc500,
+0xfffa81d1, 0x0f000000, 0x00050f85, 0x7de2c400,
+0x050e1518, 0xfcc50000, 0x48245c28, 0x000567b8,
+0x57e4c500, 0x57ecc5ca, 0xc5082454, 0x244c59f4,
+0xc2f4c5a8, 0xfcc500ca, 0xfa81d150, 0x000000ff,
+0x04d6850f, 0xfdc50000, 0x08244c5b, 0xc95bfcc5,
+0x4cc2f4c5, 0xb8000824, 0x0000056e, 0xd150fcc5,
+0x00fffa81, 0x850f0000, 0x000004b0, 0x4c53fcc5,
+0xfcc50824, 0xa8244c29, 0x4c53fcc5, 0xfcc5a824,
+0x08245428, 0x000575b8, 0x5bfdc500, 0x5bfcc5c9,
+0xc2f4c5c9, 0xfcc500ca, 0xfa81d150, 0x000000ff,
+0x0476850f, 0xecc50000, 0xfcc5ca59, 0xa8244c29,
+0x4c52fcc5, 0xfcc5a824, 0xc8244c29, 0x4c28fcc5,
+0x7cb8c824, 0xc5000005, 0xc5e153fc, 0xc5e45bfd,
+0xc5e45bfc, 0x00d4c2ec, 0xd250fcc5, 0x00fffa81,
+0x850f0000, 0x00000434, 0xd15bfdc5, 0x4c28fcc5,
+0xfcc50824, 0x7eb8d25b, 0xc5000005, 0xc5e153fc,
+0xc5e45bfd, 0xc5e45bfc, 0x00d4c2ec, 0xd250fcc5,
+0x00fffa81, 0x850f0000, 0x00000400, 0xd159f4c5,
+0x5429fcc5, 0xfcc5a824, 0xa8245451, 0x00059cb8,
+0xc2ecc500, 0xfcc500d1, 0xfa81d250, 0x000000ff,
+0x03d6850f, 0xe2c40000, 0xf125187d, 0xc5000003,
+0xc5d15edc, 0x245429fc, 0x7de3c4a8, 0xa8245408,
+0x05a4b80b, 0xecc50000, 0x03d115c2, 0xc5000000,
+0x81d250fc, 0x0000fffa, 0x9d850f00, 0xc5000003,
+0x245459e4, 0x59e4c528, 0x29fcc5e9, 0xc5c82454,
+0x24545fd4, 0x5dd4c5c8, 0xc5c8246c, 0x246c29fc,
+0x58ecc5c8, 0xc5c82454, 0x244c58f4, 0x063db828,
+0xecc50000, 0xecc5d359, 0xc500c9c2, 0x81d150fc,
+0x0000fffa, 0x51850f00, 0xc4000003, 0x4c047de3,
+0xc51b0824, 0x246c28fc, 0x064eb828, 0xe3c40000,
+0x01c90675, 0xc9c2d4c5, 0x50fcc500, 0xfffa81d1,
+0x0f000000, 0x00032385, 0x6ff9c500, 0x00037f35,
+0x5bfdc500, 0x0653b8d5, 0xe9c50000, 0xe3c4cefa,
+0x01d2197d, 0xd6fae9c5, 0x1875e3c4, 0xfcc501ca,
+0x08245428, 0x0c6de2c4, 0x75e3c4c9, 0xc501c906,
+0x00c9c2d4, 0xd150fcc5, 0x00fffa81, 0x850f0000,
+0x000002d8, 0xd558ecc5, 0x00065db8, 0x7de2c400,
+0x02d20d18, 0xecc50000, 0xc500d1c2, 0x81d250fc,
+0x0000fffa, 0xb1850f00, 0xc5000002, 0x244c12fe,
+0x7de2c408, 0x02a61518, 0xf4c50000, 0x08244c5c,
+0x000717b8, 0x7de2c400, 0x029e3518, 0xecc50000,
+0xecc5d358, 0xf4c5d659, 0xc500cac2, 0x81d150fc,
+0x0000fffa, 0x71850f00, 0xc5000002, 0x244c16fe,
+0x58e4c508, 0x28fcc5e4, 0xb8082454, 0x0000071e,
+0xca5cf4c5, 0xe659dcc5, 0xccc2f4c5, 0x50fcc500,
+0xfffa81d1, 0x0f000000, 0x00023f85, 0x10fac500,
+0xc52c244c, 0x245429fc, 0x072ab8c8, 0xfac50000,
+0xcc244c11, 0x4c10fac5, 0xfac53424, 0xd4244c11,
+0x4c10fac5, 0xfac53c24, 0xdc244c11, 0x4c10fac5,
+0xfac54424, 0xe4244c11, 0xc957f0c5, 0xcbc2f4c5,
+0x28fcc501, 0xc4c8245c, 0xd24a55e3, 0xc2e4c510,
+0xfcc500d2, 0xfa81d250, 0x000000ff, 0x01da850f,
+0xc8830000, 0x75e2c4ff, 0x0824542c, 0x5429fcc5,
+0x4489e824, 0xe2c49424, 0x2454187d, 0x0733b894,
+0xf4c50000, 0xe2c4ca55, 0x246c2e75, 0x28fcc5e8,
+0xc5e8247c, 0x00cbc2c4, 0xd150fcc5, 0x00fffa81,
+0x850f0000, 0x00000194, 0x7428fcc5, 0x3ab80824,
+0xc4000007, 0x4c0c4de3, 0xc5aa2824, 0x00d9c2e4,
+0xd350fcc5, 0x00fffa81, 0x850f0000, 0x0000016c,
+0x7c28fcc5, 0xc7c50824, 0x28244cd0, 0x7428fcc5,
+0xcfc50824, 0x282454d0, 0x000743b8, 0xc2f4c500,
+0xfcc500ca, 0xfa81d150, 0x000000ff, 0x013a850f,
+0xfcc50000, 0x08245c28, 0x4065e3c4, 0xf1282454,
+0x000752b8, 0x28f8c500, 0x7de3c4ca, 0xc501d219,
+0xc4ca58f2, 0xc92171e3, 0xc2f4c50e, 0x00014e0d,
+0xfcc50000, 0xfa81d150, 0x000000ff, 0x00fa850f,
+0xfcc50000, 0xa8245c29, 0x000003ba, 0x57f0c500,
+0x7cf7c5c9, 0xc4a82454, 0xd3197de3, 0x12d8c501,
+0x16e8c5e2, 0xc6d8c5d3, 0xe0c5e4e3, 0xc4ffebc6,
+0xd4186de3, 0x29fcc501, 0xffa82454, 0xc5d275ca,
+0xc92d2ef8, 0x0f000000, 0x0000aa8a, 0xa4850f00,
+0xc5000000, 0x247c28fc, 0x7dc7c508, 0xc528245c,
+0xc4d328f8, 0xdb197de3, 0x12d8c501, 0x16e8c5e2,
+0xc6d8c5d3, 0xe3c4e4e3, 0x01d4186d, 0xd97cefc5,
+0xd328f8c5, 0x197de3c4, 0xd8c501db, 0xe8c5e212,
+0xd8c5d316, 0xc4e4e3c6, 0xd4186de3, 0x7cefc501,
+0x28f8c5d9, 0x7de3c4d3, 0xc501db19, 0xc5e212d8,
+0xc5d316e8, 0xe4e3c6d8, 0x186de3c4, 0xefc501d4,
+0xf8c5d17c, 0xe3c4da28, 0x01d2197d, 0xe312d8c5,
+0xda16e0c5, 0xe2c6d8c5, 0x65e3c4e4, 0xc501dc18,
+0x00d9c2e4, 0xc350fcc5, 0x0000ff3d, 0x0767b800,
+0x440f0000, 0xb805ebc2, 0x0000075e, 0x0000c3c9,
+0xbf800000, 0x80000000, 0x41100000, 0x3f000000,
+0x42100000, 0x00000000, 0x00000000, 0x00000000,
+0x3f800000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x42f00000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000001, 0x00000001, 0x00000001, 0x00000001,
+0003320,
+};
+asm(".type avx_x86_64_D_32f4, STT_NOTYPE;");
+asm(".type avx_x86_64_D_32f4, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx_x86_64_D_32f8[] = {
+0x485500eb, 0x8348e589, 0x8348e0e4, 0xfbc568ec,
+0x05ca0d10, 0xfbc50000, 0x05821d10, 0xfbc50000,
+0x05822510, 0xfbc50000, 0x05822d10, 0xfbc50000,
+0x05821510, 0xfbc50000, 0x08244c11, 0x5c11fbc5,
+0xfbc52824, 0x48244c11, 0x6411fbc5, 0xfbc51024,
+0x30246c11, 0x5411fbc5, 0xfbc55024, 0x18246c11,
+0x6411fbc5, 0xfbc53824, 0x58244c11, 0x5c11fbc5,
+0xfbc52024, 0x40244c11, 0x5411fbc5, 0xfdc56024,
+0x08247c28, 0x7c29fdc5, 0xfdc5a824, 0xa8244c28,
+0x000539b8, 0xc2f5c500, 0xfdc500d7, 0xfa83d250,
+0xe1850f0f, 0xc5000004, 0x245458f5, 0x29fdc508,
+0xc5c82454, 0x247428fd, 0x053fb808, 0xcdc50000,
+0xedc5d658, 0xc82454c2, 0x50fdc500, 0x0ffa83d2,
+0x04b2850f, 0xfdc50000, 0xc8247c28, 0x545cc5c5,
+0xfdc50824, 0xe8245429, 0x54c2f5c5, 0xb800e824,
+0x00000544, 0xd250fdc5, 0x0f0ffa83, 0x00048785,
+0x28fdc500, 0xc5282474, 0x244c59f5, 0x59cdc508,
+0x28fdc5de, 0xc5082454, 0xc5ee58ed, 0x24645ced,
+0x5cf5c528, 0x055bb8cb, 0xddc50000, 0xf5c5e559,
+0xc500ccc2, 0x83d150fd, 0x850f0ffa, 0x00000448,
+0x4c59edc5, 0xfdc54824, 0xa8244c29, 0x545eedc5,
+0xf5c54824, 0xb800cac2, 0x00000564, 0xd150fdc5,
+0x0f0ffa83, 0x00041f85, 0x7de2c400, 0x044e1d19,
+0xfdc50000, 0x48245428, 0x000567b8, 0x57edc500,
+0x57e5c5cb, 0xc508245c, 0x244c59f5, 0xc2f5c5a8,
+0xfdc500cb, 0xfa83d150, 0xe9850f0f, 0xc5000003,
+0x244ce6ff, 0xe6fec508, 0xc2f5c5c9, 0x0008244c,
+0x00056eb8, 0x50fdc500, 0x0ffa83d1, 0x03c6850f,
+0xfdc50000, 0x08244c5a, 0x1875e3c4, 0xfcc501c9,
+0xfcc5c953, 0xfdc5c95a, 0xa8244c29, 0x4c5afdc5,
+0xf8c5a824, 0x98244c29, 0x1875e3c4, 0xfdc501c9,
+0x08246428, 0xc953fcc5, 0x000575b8, 0x5afcc500,
+0xe6ffc5c9, 0xe6fec5c9, 0xc2f5c5c9, 0xfdc500cc,
+0xfa83d150, 0x6d850f0f, 0xc5000003, 0xc5cc59dd,
+0x244c29fd, 0x5afdc5a8, 0xc4a8244c, 0xc91875e3,
+0x52fcc501, 0x5afcc5c9, 0x29fdc5c9, 0xc5c8244c,
+0x245c28fd, 0x057cb8c8, 0xfdc50000, 0xf8c5cb5a,
+0x98244c29, 0x1875e3c4, 0xfcc501c9, 0xfcc5c953,
+0xffc5c95a, 0xfec5c9e6, 0xddc5c9e6, 0xc500c9c2,
+0x83d150fd, 0x850f0ffa, 0x0000030c, 0xdbe6ffc5,
+0xe3e6fec5, 0x5c28fdc5, 0x7eb80824, 0xc5000005,
+0xc5cb5afd, 0x244c29f8, 0x75e3c498, 0xc501c918,
+0xc5c953fc, 0xc5c95afc, 0xc5c9e6ff, 0xc5c9e6fe,
+0x00c9c2dd, 0xd150fdc5, 0x0f0ffa83, 0x0002c785,
+0x59e5c500, 0x29fdc5cb, 0xc5a8244c, 0x244c51fd,
+0x059cb8a8, 0xf5c50000, 0xc500cbc2, 0x83d150fd,
+0x850f0ffa, 0x000002a0, 0x197de2c4, 0x0002ef0d,
+0x5ef5c500, 0x29fdc5cb, 0xc4a8244c, 0x4c097de3,
+0xb80ba824, 0x000005a4, 0x0dc2f5c5, 0x000002cf,
+0x50fdc500, 0x0ffa83d1, 0x026a850f, 0xedc50000,
+0x28244c59, 0xe359edc5, 0x4c29fdc5, 0xddc5c824,
+0xc8244c5f, 0x645dddc5, 0xfdc5c824, 0xc8246429,
+0x4c58f5c5, 0xe5c5c824, 0x28245c58, 0x00063db8,
+0x59f5c500, 0xc2f5c5ca, 0xfdc500cb, 0xfa83d150,
+0x21850f0f, 0xc5000002, 0x244c28fd, 0x28fdc508,
+0xb8282464, 0x0000064e, 0x057de3c4, 0xe3c405d9,
+0x01db0665, 0xdbc2ddc5, 0x50fdc500, 0x0ffa83d3,
+0x01f2850f, 0xf5c50000, 0x5db8cc58, 0xc4000006,
+0x1d197de2, 0x00000220, 0xcbc2f5c5, 0x50fdc500,
+0x0ffa83d1, 0x01ce850f, 0xffc50000, 0x08244c12,
+0x197de2c4, 0x0001ef2d, 0x28fdc500, 0xb808245c,
+0x00000717, 0x197de2c4, 0x0001f335, 0x58edc500,
+0x5cf5c5ed, 0x59d5c5cb, 0xc2f5c5ee, 0xfdc500cd,
+0xfa83d150, 0x8d850f0f, 0xc5000001, 0x244c10fb,
+0x29fdc530, 0xb8c8245c, 0x0000072a, 0x4c11fbc5,
+0xfbc5d024, 0x40244c10, 0x4c11fbc5, 0xf1c5e024,
+0xf5c5c957, 0xc501cac2, 0x245428fd, 0x5de3c4c8,
+0xc510db4b, 0x00dbc2ed, 0xd350fdc5, 0x0f0ffa83,
+0x00014385, 0xc8834800, 0x75e2c4ff, 0x08245c2d,
+0x5c29fdc5, 0x8948e824, 0xc4902444, 0x5c197de2,
+0x33b89024, 0xc5000007, 0xc4cb55f4, 0x642f75e2,
+0xfdc5e824, 0xe8247c28, 0xcac2c5c5, 0x50fdc500,
+0x0ffa83d1, 0x00fe850f, 0xfdc50000, 0x08247428,
+0x00073ab8, 0x4de3c400, 0x28244c0d, 0xc2edc50a,
+0xfdc500d1, 0xfa83d250, 0xd9850f0f, 0xc5000000,
+0x247c28fd, 0xd0c5c508, 0xc528244c, 0x245428fd,
+0xd0edc508, 0xb828245c, 0x00000743, 0xcbc2f5c5,
+0x50fdc500, 0x0ffa83d1, 0x00aa850f, 0xfdc50000,
+0xa8245429, 0xc957f1c5, 0x547cf5c5, 0xe3c4a824,
+0x01da186d, 0x066de3c4, 0xe5c531d2, 0xc50cd2c6,
+0x245429fd, 0x7cf5c5a8, 0xc4a82454, 0xd2197de3,
+0x15e9c501, 0x2ef9c5d2, 0x0000bb15, 0x75647a00,
+0x28fdc562, 0xc5082474, 0x24547dcd, 0x0000ba28,
+0xe3c40000, 0x01da186d, 0x066de3c4, 0xe5c531d2,
+0xc50cdac6, 0xc4d97ce5, 0xd31865e3, 0x65e3c401,
+0xc531db06, 0x0cd3c6ed, 0xd17cedc5, 0x186de3c4,
+0xe3c401da, 0x31d2066d, 0xd2c6e5c5, 0xc2edc50c,
+0xfdc500c9, 0xf883c150, 0x0767b80f, 0x440f0000,
+0xb805ebc2, 0x0000075e, 0x0000c3c9, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x40100000, 0x00000000, 0x40000000,
+0x00000000, 0x40080000, 0x00000000, 0xbff00000,
+0x00000000, 0x80000000, 0x00000000, 0x40140000,
+0x00000000, 0x3fe00000, 0x00000000, 0x40240000,
+0x00000000, 0x3ff00000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0003000,
+};
+asm(".type avx_x86_64_D_32f8, STT_NOTYPE;");
+asm(".type avx_x86_64_D_32f8, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx_x86_64_D_f4[] = {
+0x485523eb, 0x7d89e589, 0x458d48fc, 0xea8948fc,
+0x75ff3880, 0xc0ff480c, 0x75d03948, 0xeb01b0f3,
+0x5dc03102, 0x894855c3, 0xe48348e5, 0xec8148e0,
+0x00000100, 0x0d10fac5, 0x00000464, 0x4c11fac5,
+0xfac53824, 0x3c244c11, 0x4c11fac5, 0x448b4024,
+0x44893824, 0xff312c24, 0x5410fac5, 0xf8c53824,
+0x2c24542e, 0x000000b9, 0x9b0f4000, 0xf9450fc7,
+0x8be8dff7, 0x89ffffff, 0x0539b8c2, 0xd2840000,
+0x040c840f, 0xfac50000, 0x2c245410, 0x5458eac5,
+0xfac53824, 0x30245411, 0x5410fac5, 0xff313824,
+0xd258eac5, 0x542ef8c5, 0x0f403024, 0x450fc79b,
+0xe8dff7f9, 0xffffff4a, 0x3fb8c289, 0x84000005,
+0xcb840fd2, 0xc5000003, 0x245410fa, 0x5ceac530,
+0xc5382454, 0x241411fa, 0x8924048b, 0x89682444,
+0x89302444, 0x31342444, 0x10fac5ff, 0xc52c2454,
+0x24542ef8, 0x9b0f4034, 0xf9450fc7, 0xffe8dff7,
+0x89fffffe, 0x0544b8c2, 0xd2840000, 0x0380840f,
+0xfac50000, 0x2c245410, 0x5459eac5, 0xfac53824,
+0x2c245411, 0x5410fac5, 0xeac53c24, 0xfac5d259,
+0x30245411, 0x5410fac5, 0xeac53824, 0x3c245458,
+0x5411fac5, 0xfac53424, 0x38245410, 0x5c5ceac5,
+0xff313c24, 0x5c59e2c5, 0xfac53424, 0x2c246410,
+0x645cdac5, 0xf8c53024, 0xfac5e32e, 0x34245c11,
+0xc79b0f40, 0xf7f9450f, 0xfe84e8df, 0xc289ffff,
+0x00055bb8, 0x0fd28400, 0x00030584, 0x59eac500,
+0xc5402454, 0x245411fa, 0xc5ff312c, 0x245410fa,
+0x5eeac538, 0xc5402454, 0x24542ef8, 0x11fac52c,
+0x40302454, 0x0fc79b0f, 0xdff7f945, 0xfffe41e8,
+0xb8c289ff, 0x00000564, 0x840fd284, 0x000002c2,
+0x5410fac5, 0xfac54024, 0x02d22510, 0xfac50000,
+0x38245c10, 0xe8c5ff31, 0xe0c5d457, 0xeac5dc57,
+0x2c245459, 0xd32ef8c5, 0xc79b0f40, 0xf7f9450f,
+0xfdfce8df, 0xc289ffff, 0x000567b8, 0x0fd28400,
+0x00027d84, 0x2cfac500, 0x89382444, 0x00f82484,
+0xeac50000, 0xf824942a, 0xc5000000, 0x245411fa,
+0xc5ff312c, 0x245410fa, 0x2ef8c52c, 0x40382454,
+0x0fc79b0f, 0xdff7f945, 0xfffdb5e8, 0xb8c289ff,
+0x0000056e, 0x840fd284, 0x00000236, 0x54530ff3,
+0xfac53824, 0x2c245411, 0x54530ff3, 0xfac52c24,
+0x8489c22c, 0x0000f824, 0x2ae2c500, 0x00f8249c,
+0xfac50000, 0x38245410, 0xf8c5ff31, 0x0f40da2e,
+0x450fc79b, 0xe8dff7f9, 0xfffffd66, 0x75b8c289,
+0x84000005, 0xe7840fd2, 0xc5000001, 0xc5d259ea,
+0x245411fa, 0x520ff32c, 0xc52c2454, 0x245411fa,
+0x530ff330, 0xc5302454, 0x89c22cfa, 0x00f82484,
+0xeac50000, 0xf824942a, 0x31000000, 0x2ef8c5ff,
+0x40382454, 0x0fc79b0f, 0xdff7f945, 0xfffd11e8,
+0xb8c289ff, 0x0000057c, 0x840fd284, 0x00000192,
+0x442cfac5, 0x84893024, 0x0000f824, 0x530ff300,
+0xc5382454, 0xc5c22cfa, 0x249c2ae2, 0x000000f8,
+0xf8248489, 0xc5000000, 0x24942aea, 0x000000f8,
+0xf8c5ff31, 0x0f40da2e, 0x450fc79b, 0xe8dff7f9,
+0xfffffcbe, 0x7eb8c289, 0x84000005, 0x3f840fd2,
+0xc4000001, 0x442cfae1, 0x89483824, 0x00f82484,
+0xe1c40000, 0x24942aea, 0x000000f8, 0x5411fac5,
+0xff312c24, 0x5410fac5, 0xf8c53824, 0x2c24542e,
+0xc79b0f40, 0xf7f9450f, 0xfc74e8df, 0xc289ffff,
+0x000588b8, 0x0fd28400, 0x0000f584, 0x59eac500,
+0x11fac5d2, 0xc52c2454, 0x245410fa, 0xf3ff3138,
+0x245c510f, 0x2ef8c52c, 0x9b0f40da, 0xf9450fc7,
+0x3be8dff7, 0x89fffffc, 0x059cb8c2, 0xd2840000,
+0x00bc840f, 0xf2c50000, 0xfac5d25e, 0x30244c11,
+0x5411fac5, 0xff312c24, 0x0a3a0f66, 0x0b2c244c,
+0x4c2ef8c5, 0xfac53024, 0x34244c11, 0xc79b0f40,
+0xf7f9450f, 0xfbf8e8df, 0xc289ffff, 0x0005a4b8,
+0x74d28400, 0x10fac57d, 0xc540244c, 0x245459f2,
+0x59f2c538, 0xc53c244c, 0x245411fa, 0x11fac52c,
+0xc530244c, 0x244c10fa, 0x5ff2c52c, 0xc530244c,
+0x244c11fa, 0x10fac534, 0xc52c244c, 0x244c5df2,
+0x11fac530, 0xc530244c, 0x244c10fa, 0x58f2c530,
+0x3134244c, 0x59f2c5ff, 0xc540244c, 0x245410fa,
+0x58eac538, 0xc53c2454, 0x40ca2ef8, 0x0fc79b0f,
+0xdff7f945, 0xfffb79e8, 0x19013cff, 0x063d25c0,
+0xc3c90000, 0x00000000, 0x00000000, 0x00000000,
+0x3f800000, 0x00000000, 0x00000000, 0x00000000,
+0x80000000, 0x00000000, 0x00000000, 0x00000000,
+0002300,
+};
+asm(".type avx_x86_64_D_f4, STT_NOTYPE;");
+asm(".type avx_x86_64_D_f4, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx_x86_64_D_f8[] = {
+0x485500eb, 0x8348e589, 0x8148e0e4, 0x000148ec,
+0x10fbc500, 0x0004f70d, 0x11fbc500, 0xc5c0244c,
+0x244c11fb, 0x11fbc5c8, 0x48d0244c, 0xc024448b,
+0x24448948, 0xc5c031a8, 0x245410fb, 0x2ef9c5c0,
+0xbaa82454, 0x00000000, 0x48c09b0f, 0x48c2450f,
+0xe1c4d8f7, 0xb8e86ef9, 0x00000539, 0xcdd7f9c5,
+0x81c9b60f, 0x0000fff9, 0x98850f00, 0xc5000004,
+0x245410fb, 0x58ebc5a8, 0xc5c02454, 0x245411fb,
+0x10fbc5b0, 0x31c02454, 0x58ebc5c0, 0x2ef9c5d2,
+0x0fb02454, 0x0f48c09b, 0xf748c245, 0xf9e1c4d8,
+0x3fb8f06e, 0xc5000005, 0x0fced7f9, 0xf981c9b6,
+0x000000ff, 0x044d850f, 0xfbc50000, 0xb0245410,
+0x545cebc5, 0xfbc5c024, 0x88245411, 0x24448b48,
+0x44894888, 0x89482824, 0x48b02444, 0xb8244489,
+0xfbc5c031, 0xa8245410, 0x542ef9c5, 0x9b0fb824,
+0x450f48c0, 0xd8f748c2, 0x6ef9e1c4, 0x0544b8f8,
+0xf9c50000, 0xb60fcfd7, 0xfff981c9, 0x0f000000,
+0x0003f285, 0x10fbc500, 0xc5a82454, 0x245459eb,
+0x11fbc5c0, 0xc5a82454, 0x245410fb, 0x59ebc5c8,
+0x11fbc5d2, 0xc5b02454, 0x245410fb, 0x58ebc5c0,
+0xc5c82454, 0x245411fb, 0x10fbc5b8, 0xc5c02454,
+0x245c5ceb, 0xc5c031c8, 0x245c59e3, 0x10fbc5b8,
+0xc5a82464, 0x24645cdb, 0x2ef9c5b0, 0x11fbc5e3,
+0x0fb8245c, 0x0f48c09b, 0xf748c245, 0xf9e1c4d8,
+0x5bb8e86e, 0xc5000005, 0x0fcdd7f9, 0xf981c9b6,
+0x000000ff, 0x036d850f, 0xebc50000, 0xd0245459,
+0x5411fbc5, 0xc031a824, 0x5410fbc5, 0xebc5c024,
+0xd024545e, 0x542ef9c5, 0xfbc5a824, 0xb0245411,
+0x48c09b0f, 0x48c2450f, 0xe1c4d8f7, 0xb8f06ef9,
+0x00000564, 0xced7f9c5, 0x81c9b60f, 0x0000fff9,
+0x20850f00, 0xc5000003, 0x31257efa, 0xc5000003,
+0x245410fb, 0xc5c031d0, 0x245c10fb, 0x57e9c5c0,
+0x59ebc5d4, 0xc5a82454, 0xc5dc57e1, 0x0fd32ef9,
+0x0f48c09b, 0xf748c245, 0xf9e1c4d8, 0x67b8f86e,
+0xc5000005, 0x0fcfd7f9, 0xf981c9b6, 0x000000ff,
+0x02d1850f, 0xfbc50000, 0xc024442c, 0xd8244489,
+0x542aebc5, 0xfbc5d824, 0xa8245411, 0xfbc5c031,
+0xa8245410, 0x542ef9c5, 0x9b0fc024, 0x450f48c0,
+0xd8f748c2, 0x6ef9e1c4, 0x056eb8e8, 0xf9c50000,
+0xb60fcdd7, 0xfff981c9, 0x0f000000, 0x00028685,
+0x5a0ff200, 0xf3c02454, 0xf3d2530f, 0xc5d25a0f,
+0x245413f9, 0x5a0ff2a8, 0xf3a82454, 0xf3d2530f,
+0xc5d25a0f, 0x89c22cfb, 0xc5d82444, 0x245c2ae3,
+0x10fbc5d8, 0x31c02454, 0x2ef9c5c0, 0xc09b0fda,
+0xc2450f48, 0xc4d8f748, 0xf06ef9e1, 0x000575b8,
+0xd7f9c500, 0xc9b60fce, 0x00fff981, 0x850f0000,
+0x00000223, 0xd259ebc5, 0x5411fbc5, 0x0ff2a824,
+0xa824545a, 0xd2520ff3, 0xd25a0ff3, 0x5413f9c5,
+0x0ff2b024, 0xb024545a, 0xd2530ff3, 0xd25a0ff3,
+0xc22cfbc5, 0xd8244489, 0xebc5c031, 0xd824542a,
+0x542ef9c5, 0x9b0fc024, 0x450f48c0, 0xd8f748c2,
+0x6ef9e1c4, 0x057cb8f8, 0xf9c50000, 0xb60fd7d7,
+0xfffa81d2, 0x0f000000, 0x0001ba85, 0x2cfbc500,
+0x89b02444, 0xf2d82444, 0x24545a0f, 0x530ff3c0,
+0x5a0ff3d2, 0x2cfbc5d2, 0x24448bd2, 0x245489d8,
+0x24443bd8, 0xc0940fd8, 0x48c0b60f, 0xe1c4d8f7,
+0xb8e86ef9, 0x0000057e, 0xd5d7f9c5, 0x81d2b60f,
+0x0000fffa, 0x6c850f00, 0xc4000001, 0x442cfbe1,
+0x8948c024, 0xc4d82444, 0x542aebe1, 0xfbc5d824,
+0xa8245411, 0xfbc5c031, 0xc0245410, 0x542ef9c5,
+0x00baa824, 0x0f000000, 0x0f48c09b, 0xf748c245,
+0xf9e1c4d8, 0x88b8f06e, 0xc5000005, 0x0fced7f9,
+0xf981c9b6, 0x000000ff, 0x0119850f, 0xebc50000,
+0xfbc5d259, 0xa8245411, 0x5410fbc5, 0xc031c024,
+0x5c510ff2, 0xf9c5a824, 0x9b0fda2e, 0x450f48c0,
+0xd8f748c2, 0x6ef9e1c4, 0x059cb8f8, 0xf9c50000,
+0xb60fcfd7, 0xfff981c9, 0x0f000000, 0x0000d685,
+0x5ef3c500, 0x11fbc5d2, 0xc5b0244c, 0x245411fb,
+0x66c031a8, 0x4c0b3a0f, 0xc50ba824, 0x244c2ef9,
+0x11fbc5b0, 0x0fb8244c, 0x0f48c09b, 0xf748c245,
+0xf9e1c4d8, 0xa4b8e06e, 0xc5000005, 0x0fccd7f9,
+0xf981c9b6, 0x000000ff, 0x0089850f, 0xfbc50000,
+0xd0244c10, 0x5459f3c5, 0xf3c5c024, 0xc8244c59,
+0x5411fbc5, 0xfbc5a824, 0xb0244c11, 0x4c10fbc5,
+0xf3c5a824, 0xb0244c5f, 0x4c11fbc5, 0xfbc5b824,
+0xa8244c10, 0x4c5df3c5, 0xfbc5b024, 0xb0244c11,
+0x4c10fbc5, 0xf3c5b024, 0xb8244c58, 0xf3c5c031,
+0xd0244c59, 0x5410fbc5, 0xebc5c024, 0xc8245458,
+0xca2ef9c5, 0x48c09b0f, 0x48c2450f, 0xe1c4d8f7,
+0xc5e86ef9, 0x0fc5d7f9, 0xff3dc0b6, 0xb8000000,
+0x0000063d, 0xc9c2440f, 0x000000c3, 0x00000000,
+0x00000000, 0x3ff00000, 0x00000000, 0x00000000,
+0x00000000, 0x80000000, 0x00000000, 0x00000000,
+0002460,
+};
+asm(".type avx_x86_64_D_f8, STT_NOTYPE;");
+asm(".type avx_x86_64_D_f8, STT_FUNC;");
@@ -0,0 +1,72 @@
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx2_vaes_x86_32_D_16[] = {
+0x83e58955, 0x02e8f0e4, 0xc9000000, 0xc03155c3,
+0xc9eff1c5, 0xec83e589, 0x7ff9c538, 0x4488d84d,
+0x8340c805, 0xf67510f8, 0xf9c510b2, 0x00d0156f,
+0xe2c40010, 0xc85ddb79, 0x4d6ff9c5, 0x71e2c4c8,
+0xc4d865dd, 0x65de59e2, 0x74e1c5d8, 0xd7f9c5dc,
+0xfff981cb, 0x750000ff, 0x71e2c462, 0xc4d84ddf,
+0x4ddc71e2, 0x7ff9c5d8, 0xe2c4e84d, 0xe84ddb79,
+0x4d74f1c5, 0xd7f9c5c8, 0xfff981c9, 0x750000ff,
+0x79e3c441, 0x00c84ddf, 0x0071e2c4, 0x74f1c5da,
+0xd7f9c5cb, 0xfff981c9, 0x750000ff, 0x6ef9c52c,
+0x79e2c4ca, 0xf1c5c978, 0x48c84dfc, 0x4d7ff9c5,
+0x7b850fc8, 0x31ffffff, 0xb813ebc0, 0x0000004a,
+0x53b80ceb, 0xeb000000, 0x005eb805, 0xc3c90000,
+0x06050407, 0x00030201, 0x0e0d0c0f, 0x080b0a09,
+0000340,
+};
+asm(".type avx2_vaes_x86_32_D_16, STT_NOTYPE;");
+asm(".type avx2_vaes_x86_32_D_16, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx2_vaes_x86_32_D_32[] = {
+0x315500eb, 0xeff1c5c0, 0x83e589c9, 0xec83e0e4,
+0xc5e28960, 0x244c7ffd, 0x10048820, 0x20f88340,
+0x20b1f775, 0x000008b8, 0x6ef9c500, 0x7de2c4d9,
+0xe2c4db78, 0xc422db79, 0x4adb79e2, 0x5de3c410,
+0xc501e138, 0x240c6ffd, 0xdd75e2c4, 0xc4202454,
+0x54de6de2, 0xedc52024, 0xddc5d474, 0xe2c4e476,
+0x73d4177d, 0x75e2c444, 0x202454df, 0xdc6de2c4,
+0xc5202454, 0x24547ffd, 0x244c8d40, 0x79e2c440,
+0xe2c411db, 0x1069db79, 0x386de3c4, 0xf5c501d5,
+0xe2c4d274, 0x73d4177d, 0xfcf5c517, 0xfdc548cb,
+0x75240c7f, 0xebc0318d, 0x004ab80c, 0x05eb0000,
+0x000053b8, 0x00c3c900,
+0000267,
+};
+asm(".type avx2_vaes_x86_32_D_32, STT_NOTYPE;");
+asm(".type avx2_vaes_x86_32_D_32, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx2_vaes_x86_64_D_16[] = {
+0xc55500eb, 0x31c9eff1, 0xe58948c0, 0x4d7ff9c5,
+0x054488e0, 0xc0ff48d0, 0x10f88348, 0xf9c5f375,
+0x009a2d6f, 0xf9c50000, 0x00a2256f, 0xe2c40000,
+0xd055db79, 0x4d6ff9c5, 0x71e2c4d0, 0xc4e05ddd,
+0x5dde61e2, 0x74e9c5e0, 0xd7f9c5d3, 0xfffa81d2,
+0x750000ff, 0x71e2c456, 0xc4e04ddf, 0x4ddc71e2,
+0x7ff9c5e0, 0xe2c4f04d, 0xf04ddb79, 0x4d74f1c5,
+0xd7f9c5d0, 0xfffa81d1, 0x750000ff, 0x79e3c435,
+0x00d04ddf, 0x0071e2c4, 0x74f1c5d5, 0xd7f9c5ca,
+0xfffa81d1, 0x750000ff, 0xfcd9c520, 0xf9c5d04d,
+0xffd04d7f, 0x318775c8, 0xb813ebc0, 0x0000004a,
+0x53b80ceb, 0xeb000000, 0x005eb805, 0xc35d0000,
+0x06050407, 0x00030201, 0x0e0d0c0f, 0x080b0a09,
+0x10101010, 0x10101010, 0x10101010, 0x10101010,
+0000340,
+};
+asm(".type avx2_vaes_x86_64_D_16, STT_NOTYPE;");
+asm(".type avx2_vaes_x86_64_D_16, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx2_vaes_x86_64_D_32[] = {
+0xc55500eb, 0x31c9eff1, 0xe58948c0, 0xe0e48348,
+0x4c7ffdc5, 0x8d48c024, 0x88a0244c, 0xff480804,
+0xf88348c0, 0xb2f47520, 0x76ddc520, 0x748d48e4,
+0x08b8e024, 0xc5000000, 0xc4da6ef9, 0xdb787de2,
+0xdb79e2c4, 0x79e2c429, 0xc41049db, 0xe93855e3,
+0x6ffdc501, 0xc4a0244c, 0x54dd75e2, 0xe2c4c024,
+0x2454de6d, 0x74edc5c0, 0x7de2c4d5, 0x4273d417,
+0xdf75e2c4, 0xc4c02454, 0x54dc6de2, 0xfdc5c024,
+0xe024547f, 0xdb79e2c4, 0x79e2c416, 0xc4106edb,
+0xd5386de3, 0x74f5c501, 0x7de2c4d2, 0x1973d417,
+0xcbfcf5c5, 0x4c7ffdc5, 0xc8ffa024, 0xc0319275,
+0x4ab80ceb, 0xeb000000, 0x0053b805, 0xc3c90000,
+0000300,
+};
+asm(".type avx2_vaes_x86_64_D_32, STT_NOTYPE;");
+asm(".type avx2_vaes_x86_64_D_32, STT_FUNC;");
@@ -0,0 +1,217 @@
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx2_vpclmulqdq_x86_32_D_16[] = {
+0x83e58955, 0x02e8f0e4, 0xc9000000, 0x01b955c3,
+0xc5000000, 0x89c9eff1, 0x535657e5, 0x008cec81,
+0xf9c50000, 0x88a84d7f, 0x41a80d4c, 0x7510f983,
+0x6ff9c5f6, 0xf9c5a875, 0xc598757f, 0xc5e4efd9,
+0xb8657ff9, 0x6d6ff9c5, 0x51e3c498, 0x00b84d44,
+0x2971e2c4, 0xf9c5b84d, 0xff3dc1d7, 0x0f0000ff,
+0x00021b85, 0xb845c700, 0x00000001, 0x4589c031,
+0x6ff9c5bc, 0xe3c4b875, 0x984d4449, 0x7ff9c500,
+0xe3c4c84d, 0x984d4449, 0x79e3c410, 0x8901ca16,
+0xf9c5d455, 0xc5d04d7e, 0x985d6ff9, 0x2961e2c4,
+0xf9c5c84d, 0xff3dc1d7, 0x0f0000ff, 0x0001d685,
+0x61e3c400, 0x10984d44, 0x4461e3c4, 0xc4019855,
+0xca2971e2, 0xc1d7f9c5, 0x00ffff3d, 0xbb850f00,
+0xc4000001, 0x654461e3, 0xf9c50098, 0xc4c8657f,
+0x5d4461e3, 0xf9c51198, 0xc5d85d7f, 0x31edefd1,
+0x51e3c4db, 0xc408f40f, 0xcb0f51e3, 0xc5f63108,
+0xc5d46ff9, 0xc5fb6ff9, 0x88757ff9, 0x8d7ff9c5,
+0xffffff78, 0xd8f7d889, 0xc53fe083, 0xc5c86ef9,
+0xc5c9f3c1, 0xc5fb6ef9, 0xc5ffd3e1, 0xc4cfebf1,
+0x7d2969e2, 0xd7f9c5c8, 0xffff3dc7, 0xdf890000,
+0x014f850f, 0xe2c40000, 0xd87d2971, 0xc7d7f9c5,
+0x00ffff3d, 0x41850f00, 0xc5000001, 0xc5fe6ef9,
+0x98756ff9, 0xffd3c9c5, 0xf9c5d231, 0xe083f87e,
+0x70858901, 0xc5ffffff, 0x83d07ef9, 0xd28503e0,
+0x011d850f, 0x85390000, 0xffffff70, 0x0111850f,
+0xf8c50000, 0xff70bd17, 0x858bffff, 0xffffff70,
+0xe083d231, 0x70858901, 0xc5ffffff, 0x83c87ef9,
+0xd28503e0, 0x00f0850f, 0x85390000, 0xffffff70,
+0x00e4850f, 0xe3c40000, 0xc8550f51, 0x6ff9c508,
+0xf1c5c875, 0xc502d673, 0x3ef273e9, 0xcaebf1c5,
+0x4d7ff9c5, 0x51e3c4c8, 0x08d8550f, 0x6ff9c546,
+0xc383d875, 0x73f1c502, 0xfe8302d6, 0x73e9c540,
+0xf1c53ef2, 0xf9c5caeb, 0x74d84d7f, 0x3ffb8356,
+0xbd6ff9c5, 0xffffff78, 0xfeb82877, 0xc5ffffff,
+0x88756ff9, 0xcb6ef9c5, 0xd9c5f829, 0xe083c9d3,
+0x6ef9c53f, 0xf3c9c5d0, 0xebe9c5d2, 0xfed2e9d1,
+0x478dffff, 0x6ff9c5c2, 0xf9c58875, 0xff78bd6f,
+0xf9c5ffff, 0xc9c5c86e, 0xc1c5d1d3, 0xcce9c9d3,
+0xc5fffffe, 0xc00d6ff9, 0xc5001002, 0x984dd4f1,
+0x7ff9c549, 0x850f984d, 0xfffffdbf, 0x2febc031,
+0x000056b8, 0xb828eb00, 0x00000064, 0x73b821eb,
+0xeb000000, 0x0081b81a, 0x13eb0000, 0x000082b8,
+0xb80ceb00, 0x00000088, 0x89b805eb, 0x81000000,
+0x00008cc4, 0x5f5e5b00, 0x0000c35d, 0x00000000,
+0x10101010, 0x10101010, 0x10101010, 0x10101010,
+0001320,
+};
+asm(".type avx2_vpclmulqdq_x86_32_D_16, STT_NOTYPE;");
+asm(".type avx2_vpclmulqdq_x86_32_D_16, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx2_vpclmulqdq_x86_32_D_32[] = {
+0xb85500eb, 0x00000001, 0xc9eff1c5, 0x5657e589,
+0xe0e48353, 0x0120ec81, 0xfdc50000, 0xa0248c7f,
+0x88000000, 0x00a00484, 0x83400000, 0xf37520f8,
+0x782444c7, 0x00000008, 0xac6ffdc5, 0x0000a024,
+0x7ffdc500, 0x008024ac, 0xc9c50000, 0xfdc5f6ef,
+0xc024b47f, 0xc5000000, 0x24bc6ffd, 0x00000080,
+0x4445e3c4, 0x00c0248c, 0xc4000000, 0x8c2975e2,
+0x0000c024, 0x7de2c400, 0x04000d17, 0x830f0010,
+0x0000032c, 0xc02484c7, 0x01000000, 0x31000000,
+0x89c931d2, 0x00c42494, 0x84c70000, 0x0000d024,
+0x00000100, 0x248c8900, 0x000000d4, 0xac6ffdc5,
+0x0000c024, 0x55e3c400, 0x80248c44, 0x00000000,
+0x8c7ffdc5, 0x0000e024, 0x55e3c400, 0x80248c44,
+0x10000000, 0x1679e3c4, 0xfdc501ca, 0x00248c7f,
+0x89000001, 0x00ec2494, 0xf9c50000, 0xe8248c7e,
+0xc5000000, 0x249c6ffd, 0x00000080, 0x8c7efac5,
+0x00011024, 0xd6f9c500, 0x00f8248c, 0xe2c40000,
+0x248c2965, 0x000000e0, 0x177de2c4, 0x1004000d,
+0x90830f00, 0xc4000002, 0x8c4465e3, 0x00008024,
+0xe3c41000, 0x24944465, 0x00000080, 0x75e2c401,
+0xe2c4ca29, 0x000d177d, 0x0f001004, 0x00026d83,
+0x65e3c400, 0x8024bc44, 0x00000000, 0xbc7ffdc5,
+0x0000e024, 0x65e3c400, 0x80249c44, 0x11000000,
+0x9c7ffdc5, 0x00010024, 0xefd1c500, 0xc4c031ed,
+0xf70f55e3, 0x7ffdc508, 0x89202474, 0xc47c2444,
+0xf30f55e3, 0xc5c93108, 0xc5d76ffd, 0xc5e36ffd,
+0x24347ffd, 0xd8f7c889, 0xc53fe083, 0xc5c86ef9,
+0xc5c9f3dd, 0xc5e16ef9, 0xc5e4d3e5, 0xc4ccebf5,
+0xa4296de2, 0x0000e024, 0xc4cb8900, 0x25177de2,
+0x00100400, 0x0192830f, 0xe2c40000, 0x24a42975,
+0x00000100, 0x177de2c4, 0x10040025, 0x80830f00,
+0x31000001, 0x6ef9c5d2, 0xc57c2464, 0x24b46ffd,
+0x00000080, 0xf4d3cdc5, 0xd07ef9c5, 0xc503e083,
+0x24747ffd, 0x6ff9c540, 0xc5402474, 0x83f67ef9,
+0xd28501e6, 0x0150850f, 0xf0390000, 0x0148850f,
+0xf8c50000, 0x70247417, 0x7024548b, 0xf9c5f631,
+0xe083c87e, 0x01e28303, 0x850ff685, 0x00000131,
+0x850fd039, 0x00000129, 0xfdc5d231, 0x4024746f,
+0x397de3c4, 0xe3c401d2, 0x01f4397d, 0xd07ef9c5,
+0xe67ef9c5, 0x8303e083, 0xd28501e6, 0x00f8850f,
+0xc6390000, 0x00f0850f, 0xf8c50000, 0x40246417,
+0x4024748b, 0xe3c4d231, 0x01c9397d, 0xc87ef9c5,
+0x8303e083, 0xd28501e6, 0x00d3850f, 0xc6390000,
+0x00cb850f, 0xe3c40000, 0x24940f55, 0x000000e0,
+0x6ffdc508, 0x00e024a4, 0xf5c50000, 0xc502d473,
+0x3ef273ed, 0xcaebf5c5, 0x8c7ffdc5, 0x0000e024,
+0x2444ff00, 0x02c1837c, 0xa46ffdc5, 0x00010024,
+0x55e3c400, 0x0024940f, 0x08000001, 0xd473f5c5,
+0x247c8302, 0xedc5407c, 0xc53ef273, 0xc5caebf5,
+0x248c7ffd, 0x00000100, 0xf9836e74, 0x6ffdc53f,
+0x29772424, 0xfffffeb8, 0x6ffdc5ff, 0xc5202474,
+0x29c96ef9, 0xd3c5c5d8, 0x3fe083c9, 0xd06ef9c5,
+0xd2f3cdc5, 0xd1ebedc5, 0xfffe57e9, 0xc2438dff,
+0x746ffdc5, 0xf9c52024, 0xcdc5c86e, 0xfdc5d1d3,
+0xc524346f, 0xe9c9d3cd, 0xfffffe53, 0x000081b8,
+0xb850eb00, 0x00000082, 0x88b849eb, 0xeb000000,
+0x0089b842, 0x3beb0000, 0x78244cff, 0x0d6ffdc5,
+0x001003e0, 0x8cd4f5c5, 0x00008024, 0x7ffdc500,
+0x0080248c, 0x850f0000, 0xfffffc9e, 0x13ebc031,
+0x000056b8, 0xb80ceb00, 0x00000064, 0x73b805eb,
+0x8d000000, 0x5e5bf465, 0x00c35d5f, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x20202020, 0x20202020, 0x20202020, 0x20202020,
+0x20202020, 0x20202020, 0x20202020, 0x20202020,
+0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+0002040,
+};
+asm(".type avx2_vpclmulqdq_x86_32_D_32, STT_NOTYPE;");
+asm(".type avx2_vpclmulqdq_x86_32_D_32, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx2_vpclmulqdq_x86_64_D_16[] = {
+0xc55500eb, 0xb8c9eff1, 0x00000001, 0xc5e58948,
+0xc04d7ff9, 0xc0054488, 0x48c0ff48, 0x7510f883,
+0x6ff9c5f3, 0x10bfc07d, 0xc4000000, 0xc9ef3141,
+0x7d7ff9c5, 0x7f79c5b0, 0xf9c5d04d, 0xc4b06d6f,
+0x4d4451e3, 0xe2c400d0, 0xd04d2971, 0xc1d7f9c5,
+0x00ffff3d, 0xde850f00, 0x48000001, 0x01d045c7,
+0xc5000000, 0xd04d6ff9, 0x4471e3c4, 0xc500b055,
+0xe0557ff9, 0x4471e3c4, 0xc510b04d, 0xb0656ff9,
+0x4dd6f9c5, 0x59e2c4e8, 0xc5e04d29, 0x3dc1d7f9,
+0x0000ffff, 0x01a6850f, 0xe3c40000, 0xb04d4459,
+0x59e3c410, 0x01b05544, 0x2971e2c4, 0xd7f9c5ca,
+0xffff3dc1, 0x850f0000, 0x0000018b, 0x4459e3c4,
+0xc500b06d, 0xe06d7ff9, 0x4459e3c4, 0xc511b065,
+0xf0657ff9, 0xf6efc9c5, 0xd56ff9c5, 0xcc6ff9c5,
+0x63c4c931, 0x08c40f49, 0xb941f631, 0xfffffffe,
+0x0f49e3c4, 0x41c408fd, 0x89d06f79, 0x83d8f7c8,
+0xe1c43fe0, 0xc5d86ef9, 0xc5cbf3f1, 0xc5d96ef9,
+0xc5dbd3d9, 0xc4cbebf1, 0x5d2969e2, 0xc88941e0,
+0xc3d7f9c5, 0x00ffff3d, 0x1f850f00, 0xc4000001,
+0x5d2971e2, 0xd7f9c5f0, 0xffff3dc3, 0x850f0000,
+0x00000111, 0xf9c5f089, 0xc4b05d6f, 0xd86ef961,
+0x7ef9e1c4, 0x61c1c4d0, 0xe083dbd3, 0xf9e1c403,
+0xe283da7e, 0xc2394801, 0x00ee850f, 0xe3c40000,
+0x01da16f9, 0x7ef9e1c4, 0x01e283c8, 0x4803e083,
+0x850fc239, 0x000000db, 0x4d6ff9c5, 0x49e3c4e0,
+0xc508d10f, 0x02d173f1, 0xf273e9c5, 0xebf1c53e,
+0x7ff9c5ca, 0xf9c5e04d, 0xfff04d6f, 0x02c183c6,
+0x0f49e3c4, 0xf1c508d1, 0xc502d173, 0x3ef273e9,
+0xcaebf1c5, 0x4d7ff9c5, 0x40fe83f0, 0x79c54274,
+0xf983d17f, 0x4423773f, 0x2944c889, 0x3fe083c0,
+0x6ef9e1c4, 0xf3c1c5d8, 0x6ef9c5d3, 0xd3d1c5d9,
+0xebe9c5db, 0xff01e9d3, 0x8d41ffff, 0xe1c4c240,
+0xc5c86ef9, 0xc5d1d3c1, 0xe9c9d3b9, 0xffffff07,
+0x1010b848, 0x10101010, 0xe1c41010, 0xc5c86ef9,
+0xc5c96cf1, 0xb04dd4f1, 0x4d7ff9c5, 0x0fcfffb0,
+0xfffe0085, 0xebc031ff, 0x0056b82f, 0x28eb0000,
+0x000064b8, 0xb821eb00, 0x00000073, 0x81b81aeb,
+0xeb000000, 0x0082b813, 0x0ceb0000, 0x000088b8,
+0xb805eb00, 0x00000089, 0x0000c35d,
+0001152,
+};
+asm(".type avx2_vpclmulqdq_x86_64_D_16, STT_NOTYPE;");
+asm(".type avx2_vpclmulqdq_x86_64_D_16, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx2_vpclmulqdq_x86_64_D_32[] = {
+0xc55500eb, 0xb8c9eff1, 0x00000001, 0x48e58948,
+0x48e0e483, 0xc528ec83, 0x244c7ffd, 0x044488a8,
+0xc0ff48a8, 0x20f88348, 0xfdc5f375, 0xa824746f,
+0x000008bf, 0x2941c400, 0xd5c5d2ef, 0xfdc5ed76,
+0x8824747f, 0x547f7dc5, 0xfdc5c824, 0x88247c6f,
+0x4445e3c4, 0x00c8244c, 0x2975e2c4, 0xc4c8244c,
+0xcd177de2, 0x0247830f, 0xc7480000, 0x01c82444,
+0x48000000, 0xd82444c7, 0x00000001, 0x746ffdc5,
+0xe3c4c824, 0x244c444d, 0xfdc50088, 0xe8244c7f,
+0x444de3c4, 0x1088244c, 0x4c7ffdc5, 0x8b480824,
+0xc5182444, 0x24646ffd, 0xd6f9c588, 0x48f0244c,
+0xc4240489, 0x4c295de2, 0xe2c4e824, 0x0fcd177d,
+0x0001f383, 0x5de3c400, 0x88244c44, 0x5de3c410,
+0x88245444, 0x75e2c401, 0xe2c4ca29, 0x0fcd177d,
+0x0001da83, 0x5de3c400, 0x88247444, 0x7ffdc500,
+0xc4e82474, 0x64445de3, 0xc5118824, 0x24647ffd,
+0xefc1c508, 0x6ffdc5ff, 0x6ffdc5d6, 0xc4f631cc,
+0xcc0f4563, 0x41c93108, 0xfffffeb9, 0x4563c4ff,
+0xc408c60f, 0xd96f7d41, 0xd8f7c889, 0xc43fe083,
+0xd86ef9e1, 0xcbf3f5c5, 0xd96ef9c5, 0xdbd3ddc5,
+0xcbebf5c5, 0x296de2c4, 0x41e8245c, 0xe2c4c889,
+0x0fdd177d, 0x00016d83, 0x75e2c400, 0x08245c29,
+0x177de2c4, 0x62830fdd, 0x89000001, 0x6ffdc5f0,
+0xc488245c, 0xf06ef961, 0x7ef9e1c4, 0x65c1c4d0,
+0xe083ded3, 0xf9e1c403, 0xe283da7e, 0xc2394801,
+0x013e850f, 0xe3c40000, 0x01d816f9, 0x7ef9e1c4,
+0x01e083ca, 0x4803e283, 0x850fd039, 0x0000012b,
+0x397de3c4, 0xe3c401db, 0x01d2397d, 0x7ef9e1c4,
+0xf9e1c4da, 0xe283d07e, 0x03e08301, 0x0fc23948,
+0x0000ff85, 0x7de3c400, 0xc401c939, 0xd816f9e3,
+0xf9e1c401, 0xe083ca7e, 0x03e28301, 0x0fd03948,
+0x0000e685, 0x45e3c400, 0xe824540f, 0x6ffdc508,
+0xc5e8245c, 0x3ef273ed, 0xd373f5c5, 0xebf5c502,
+0x7ffdc5ca, 0xc4e8244c, 0x540f45e3, 0xc5080824,
+0x245c6ffd, 0x83c6ff08, 0xf5c502c1, 0xc502d373,
+0x3ef273ed, 0xcaebf5c5, 0x4c7ffdc5, 0xfe830824,
+0xc5427440, 0x83d97f7d, 0x23773ff9, 0x44c88944,
+0xe083c029, 0xf9e1c43f, 0xbdc5d86e, 0xf9c5d3f3,
+0xcdc5d96e, 0xedc5dbd3, 0xb9e9d3eb, 0x41fffffe,
+0xc4c2408d, 0xc86ef9e1, 0xd1d3bdc5, 0xc9d3b5c5,
+0xfffebfe9, 0x20b848ff, 0x20202020, 0xc4202020,
+0xf06ef9e1, 0x597de2c4, 0xd4f5c5ce, 0xc588244c,
+0x244c7ffd, 0x0fcfff88, 0xfffd9785, 0xebc031ff,
+0x0056b82f, 0x28eb0000, 0x000064b8, 0xb821eb00,
+0x00000073, 0x81b81aeb, 0xeb000000, 0x0082b813,
+0x0ceb0000, 0x000088b8, 0xb805eb00, 0x00000089,
+0x0000c3c9,
+0001342,
+};
+asm(".type avx2_vpclmulqdq_x86_64_D_32, STT_NOTYPE;");
+asm(".type avx2_vpclmulqdq_x86_64_D_32, STT_FUNC;");
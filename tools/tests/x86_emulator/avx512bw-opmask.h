@@ -0,0 +1,140 @@
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512bw_opmask_x86_32_D_4[] = {
+0x90f9e1c4, 0x1001a00d, 0x01a8a100, 0xfbc50010,
+0xe1c4d092, 0xc4d945ed, 0xe141ede1, 0x42dde1c4,
+0xede1c4eb, 0xe1c4f147, 0xb02d91f9, 0xc5001001,
+0x3bd693fb, 0x1001b015, 0xb8067400, 0x00000044,
+0xf9e1c4c3, 0xe1c4de44, 0xc4e146ed, 0x1d91f9e1,
+0x001001b0, 0xd493fbc5, 0x01b0153b, 0x06740010,
+0x000048b8, 0xe3c4c300, 0x01d93379, 0x3379e3c4,
+0xe3c402e3, 0x03e93379, 0x91f9e1c4, 0x1001b025,
+0x93fbc500, 0xb0153bd5, 0x74001001, 0x004db806,
+0xc4c30000, 0xd93179e3, 0x79e3c401, 0xc402e331,
+0xe93179e3, 0xf9e1c403, 0x01b02591, 0xfbc50010,
+0x153bd593, 0x001001b0, 0x52b80674, 0xc3000000,
+0x98f9e1c4, 0xb80677f6, 0x00000056, 0xfde1c4c3,
+0xe1c4d847, 0x74db98f9, 0x005db806, 0xc4c30000,
+0xd846fde1, 0x98f9e1c4, 0xb80672db, 0x00000064,
+0x79e3c4c3, 0xc510e331, 0xc4ec4bdc, 0x1d91f9e1,
+0x001001b0, 0xd593fbc5, 0x01b0153b, 0x06740010,
+0x00006cb8, 0xe1c4c300, 0xc4d94af5, 0xe13379e3,
+0xf9e1c401, 0x01b01d91, 0xfbc50010, 0x153bd493,
+0x001001b0, 0x74b80674, 0xc3000000, 0x99f9e1c4,
+0xb80677ca, 0x00000078, 0xfde1c4c3, 0xe1c4d847,
+0x74d899f9, 0x007fb806, 0xc4c30000, 0xe046fde1,
+0x99f9e1c4, 0xb80672e0, 0x00000086, 0xf9e1c4c3,
+0x01a00590, 0xf2620010, 0xf82848fe, 0x48fef262,
+0xe1c4df29, 0xb00591f9, 0xc5001001, 0x3bd393fb,
+0x1001b015, 0xb8067400, 0x00000091, 0xc3c031c3,
+0x830f8fb3, 0xff803ff0, 0x0ffc01ff, 0xcdf1f0c1,
+0x00000000, 0x00000000,
+0000670,
+};
+asm(".type avx512bw_opmask_x86_32_D_4, STT_NOTYPE;");
+asm(".type avx512bw_opmask_x86_32_D_4, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512bw_opmask_x86_32_D_8[] = {
+0x90f8e1c4, 0x1002100d, 0xf8e1c400, 0x02181590,
+0xe1c40010, 0xc4d945ec, 0xe141ece1, 0x42dce1c4,
+0xece1c4eb, 0xe1c4f147, 0x202d91f8, 0x83001002,
+0xe1c408ec, 0x243491f8, 0x0d3b5a59, 0x00100220,
+0x153b0675, 0x00100224, 0x44b80674, 0xc3000000,
+0x44f8e1c4, 0xece1c4de, 0xe1c4e146, 0x201d91f8,
+0x83001002, 0xe1c408ec, 0x242491f8, 0x0d3b5a59,
+0x00100220, 0x153b0675, 0x00100224, 0x48b80674,
+0xc3000000, 0x33f9e3c4, 0xe3c401d9, 0x02e333f9,
+0x33f9e3c4, 0xe1c403e9, 0x202591f8, 0x83001002,
+0xe1c408ec, 0x242c91f8, 0x0d3b5a59, 0x00100220,
+0x153b0675, 0x00100224, 0x4db80674, 0xc3000000,
+0x31f9e3c4, 0xe3c401d9, 0x02e331f9, 0x31f9e3c4,
+0xe1c403e9, 0x202591f8, 0x83001002, 0xe1c408ec,
+0x242c91f8, 0x0d3b5a59, 0x00100220, 0x153b0675,
+0x00100224, 0x52b80674, 0xc3000000, 0x98f8e1c4,
+0xb80677f6, 0x00000056, 0xfce1c4c3, 0xe1c4d847,
+0x74db98f8, 0x005db806, 0xc4c30000, 0xd846fce1,
+0x98f8e1c4, 0xb80672db, 0x00000064, 0xf9e3c4c3,
+0xc420e331, 0xec4bdce1, 0x91f8e1c4, 0x1002201d,
+0x08ec8300, 0x91f8e1c4, 0x5a59242c, 0x02200d3b,
+0x06750010, 0x0224153b, 0x06740010, 0x00006cb8,
+0xe1c4c300, 0xc4d94af4, 0xe133f9e3, 0xf8e1c401,
+0x02201d91, 0xec830010, 0xf8e1c408, 0x59242491,
+0x200d3b5a, 0x75001002, 0x24153b06, 0x74001002,
+0x0074b806, 0xc4c30000, 0xca99f8e1, 0x78b80677,
+0xc3000000, 0x47fce1c4, 0xf8e1c4d8, 0x0674d899,
+0x00007fb8, 0xe1c4c300, 0xc4e046fc, 0xe099f8e1,
+0x86b80672, 0xc3000000, 0x90f8e1c4, 0x10021005,
+0x7ef26200, 0x62f82848, 0x29487ef2, 0xf8e1c4df,
+0x02200591, 0xec830010, 0xf8e1c408, 0x59241c91,
+0x200d3b5a, 0x75001002, 0x24153b06, 0x74001002,
+0x0091b806, 0x31c30000, 0x0000c3c0, 0x00000000,
+0x830f8fb3, 0xff803ff0, 0x0ffc01ff, 0xcdf1f0c1,
+0x00000000, 0x00000000,
+0001050,
+};
+asm(".type avx512bw_opmask_x86_32_D_8, STT_NOTYPE;");
+asm(".type avx512bw_opmask_x86_32_D_8, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512bw_opmask_x86_64_D_4[] = {
+0x90f9e1c4, 0x00019f0d, 0xa1058b00, 0xc5000001,
+0xc4d092fb, 0xd945ede1, 0x41ede1c4, 0xdde1c4e1,
+0xe1c4eb42, 0xc4f147ed, 0x2d91f9e1, 0x00000188,
+0xd693fbc5, 0x017e153b, 0x06740000, 0x000044b8,
+0xe1c4c300, 0xc4de44f9, 0xe146ede1, 0x91f9e1c4,
+0x0001631d, 0x93fbc500, 0x59153bd4, 0x74000001,
+0x0048b806, 0xc4c30000, 0xd93379e3, 0x79e3c401,
+0xc402e333, 0xe93379e3, 0xf9e1c403, 0x01362591,
+0xfbc50000, 0x153bd593, 0x0000012c, 0x4db80674,
+0xc3000000, 0x3179e3c4, 0xe3c401d9, 0x02e33179,
+0x3179e3c4, 0xe1c403e9, 0x092591f9, 0xc5000001,
+0x3bd593fb, 0x0000ff15, 0xb8067400, 0x00000052,
+0xf9e1c4c3, 0x0677f698, 0x000056b8, 0xe1c4c300,
+0xc4d847fd, 0xdb98f9e1, 0x5db80674, 0xc3000000,
+0x46fde1c4, 0xf9e1c4d8, 0x0672db98, 0x000064b8,
+0xe3c4c300, 0x10e33179, 0xec4bdcc5, 0x91f9e1c4,
+0x0000b31d, 0x93fbc500, 0xa9153bd5, 0x74000000,
+0x006cb806, 0xc4c30000, 0xd94af5e1, 0x3379e3c4,
+0xe1c401e1, 0x8d1d91f9, 0xc5000000, 0x3bd493fb,
+0x00008315, 0xb8067400, 0x00000074, 0xf9e1c4c3,
+0x0677ca99, 0x000078b8, 0xe1c4c300, 0xc4d847fd,
+0xd899f9e1, 0x7fb80674, 0xc3000000, 0x46fde1c4,
+0xf9e1c4e0, 0x0672e099, 0x000086b8, 0xe1c4c300,
+0x310590f9, 0x62000000, 0x2848fef2, 0xfef262f8,
+0xc4df2948, 0x0591f9e1, 0x0000002c, 0xd393fbc5,
+0x0022153b, 0x06740000, 0x000091b8, 0xc031c300,
+0x000000c3, 0x00000000, 0x830f8fb3, 0xff803ff0,
+0x0ffc01ff, 0xcdf1f0c1, 0x00000000, 0x00000000,
+0000700,
+};
+asm(".type avx512bw_opmask_x86_64_D_4, STT_NOTYPE;");
+asm(".type avx512bw_opmask_x86_64_D_4, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512bw_opmask_x86_64_D_8[] = {
+0x90f8e1c4, 0x0001af0d, 0x058b4800, 0x000001b0,
+0x92fbe1c4, 0xece1c4d0, 0xe1c4d945, 0xc4e141ec,
+0xeb42dce1, 0x47ece1c4, 0xf8e1c4f1, 0x01962d91,
+0xe1c40000, 0x48d693fb, 0x018a153b, 0x06740000,
+0x000044b8, 0xe1c4c300, 0xc4de44f8, 0xe146ece1,
+0x91f8e1c4, 0x00016f1d, 0xfbe1c400, 0x3b48d493,
+0x00016315, 0xb8067400, 0x00000048, 0xf9e3c4c3,
+0xc401d933, 0xe333f9e3, 0xf9e3c402, 0xc403e933,
+0x2591f8e1, 0x00000140, 0x93fbe1c4, 0x153b48d5,
+0x00000134, 0x4db80674, 0xc3000000, 0x31f9e3c4,
+0xe3c401d9, 0x02e331f9, 0x31f9e3c4, 0xe1c403e9,
+0x112591f8, 0xc4000001, 0xd593fbe1, 0x05153b48,
+0x74000001, 0x0052b806, 0xc4c30000, 0xf698f8e1,
+0x56b80677, 0xc3000000, 0x47fce1c4, 0xf8e1c4d8,
+0x0674db98, 0x00005db8, 0xe1c4c300, 0xc4d846fc,
+0xdb98f8e1, 0x64b80672, 0xc3000000, 0x31f9e3c4,
+0xe1c420e3, 0xc4ec4bdc, 0x1d91f8e1, 0x000000b8,
+0x93fbe1c4, 0x153b48d5, 0x000000ac, 0x6cb80674,
+0xc3000000, 0x4af4e1c4, 0xf9e3c4d9, 0xc401e133,
+0x1d91f8e1, 0x00000090, 0x93fbe1c4, 0x153b48d4,
+0x00000084, 0x74b80674, 0xc3000000, 0x99f8e1c4,
+0xb80677ca, 0x00000078, 0xfce1c4c3, 0xe1c4d847,
+0x74d899f8, 0x007fb806, 0xc4c30000, 0xe046fce1,
+0x99f8e1c4, 0xb80672e0, 0x00000086, 0xf8e1c4c3,
+0x00320590, 0xf2620000, 0xf828487e, 0x487ef262,
+0xe1c4df29, 0x2d0591f8, 0xc4000000, 0xd393fbe1,
+0x21153b48, 0x74000000, 0x0091b806, 0x31c30000,
+0x0000c3c0, 0x00000000, 0x830f8fb3, 0xff803ff0,
+0x0ffc01ff, 0xcdf1f0c1, 0x00000000, 0x00000000,
+0000720,
+};
+asm(".type avx512bw_opmask_x86_64_D_8, STT_NOTYPE;");
+asm(".type avx512bw_opmask_x86_64_D_8, STT_FUNC;");
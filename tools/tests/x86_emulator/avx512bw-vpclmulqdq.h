@@ -0,0 +1,375 @@
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512bw_vpclmulqdq_x86_32_D_64[] = {
+0xb85500eb, 0x00000001, 0xc9eff1c5, 0x5657e589,
+0xc0e48353, 0x0200ec81, 0xf1620000, 0x4c7f48fd,
+0x84880224, 0x00008004, 0xf8834000, 0xc7f37540,
+0x043c2444, 0x62000000, 0x6f48fdf1, 0x6202246c,
+0x7f48fdf1, 0xc501246c, 0x62f6efc9, 0x7f48fdf1,
+0x62032474, 0x6f48fdf1, 0x62012464, 0x44485df3,
+0x0003244c, 0x48f5f362, 0x0324441f, 0x93f8c500,
+0x0fc0fec0, 0x00033085, 0x31c03100, 0x2484c7d2,
+0x000000c0, 0x00000001, 0xdb31c931, 0xc4248489,
+0xc7000000, 0x00d02484, 0x00010000, 0x94890000,
+0x0000d424, 0x2484c700, 0x000000e0, 0x00000001,
+0xe4248c89, 0xc7000000, 0x00f02484, 0x00010000,
+0x9c890000, 0x0000f424, 0xfdf16200, 0x246c6f48,
+0x55f36203, 0x244c4448, 0xf1620001, 0x4c7f48fd,
+0xf3620424, 0x4c444855, 0xc4100124, 0xca1679e3,
+0xfdf16201, 0x244c7f48, 0x24948905, 0x0000010c,
+0x087df162, 0x42244c7e, 0x48fdf162, 0x01245c6f,
+0x08fef162, 0x2a244c7e, 0x08fdf162, 0x23244cd6,
+0x08fef162, 0x2c244c7e, 0x08fdf162, 0x25244cd6,
+0x08fef162, 0x2e244c7e, 0x08fdf162, 0x27244cd6,
+0x48e5f362, 0x0424541f, 0x93f8c500, 0x0fc0fec2,
+0x00025b85, 0x65f36200, 0x244c4448, 0xf3621001,
+0x54444865, 0x62010124, 0x1f48f5f3, 0xf8c500da,
+0xc0fec393, 0x023d850f, 0xf3620000, 0x64444865,
+0x62000124, 0x7f48fdf1, 0x62042464, 0x444865f3,
+0x1101245c, 0x48fdf162, 0x05245c7f, 0x302444c7,
+0x00ff00ff, 0xc931c031, 0x342444c7, 0x00ff00ff,
+0x48fdf162, 0xf162d46f, 0xfb6f48fd, 0x90f8e1c4,
+0x6230244c, 0x0fc95df3, 0xf36208ec, 0xf30fc965,
+0xf7c28908, 0x3fe283da, 0x087df162, 0xf162ca6e,
+0xc9f348c5, 0x087df162, 0xf162f86e, 0xffd348e5,
+0x48f5f162, 0xf362cfeb, 0x641f48ed, 0xc5000424,
+0xfed493f8, 0x62c389c2, 0x7f48fdf1, 0x62062454,
+0x7f48fdf1, 0x0f07244c, 0x00014885, 0xf5f36200,
+0x246c1f48, 0xf8c50005, 0xc2fed593, 0x013a850f,
+0xf1620000, 0xc96e087d, 0x48fdf162, 0x01247c6f,
+0xf162d231, 0xc9d348c5, 0x48fdf162, 0x03244c7f,
+0xc0d4b48b, 0x31000000, 0x01e683ff, 0x30247489,
+0x80d4b48b, 0x83000001, 0xff8503e6, 0x0101850f,
+0x74390000, 0x850f3024, 0x000000f7, 0xc8d4bc8b,
+0x8b000000, 0x01c0d4b4, 0xe7830000, 0x247c8901,
+0x83ff3130, 0xff8503e6, 0x00dc850f, 0x74390000,
+0x850f3024, 0x000000d2, 0x8302c283, 0xa07508fa,
+0x48f5f162, 0x04245473, 0xfdf16202, 0x247c6f48,
+0x45f36204, 0x08d70fc9, 0x48edf162, 0x623ef273,
+0xeb48f5f1, 0xfdf162ca, 0x244c7f48, 0xf5f16204,
+0x24547348, 0xf1620205, 0x7c6f48fd, 0x62410524,
+0x0fc945f3, 0xc08308d7, 0xedf16202, 0x3ef27348,
+0x6240f983, 0xeb48f5f1, 0xfdf162ca, 0x244c7f48,
+0x836e7405, 0xf1623ff8, 0xfe6f48fd, 0xfeba2d77,
+0x62ffffff, 0x6e087df1, 0xddf162c8, 0x29c9d348,
+0x3fe283da, 0x087df162, 0xf162d26e, 0xd2f348d5,
+0x48edf162, 0x86e9d1eb, 0x8dfffffe, 0xf162c253,
+0xca6e087d, 0x48d5f162, 0xf162d1d3, 0xc9d348cd,
+0xfffe91e9, 0x0081b8ff, 0x50eb0000, 0x000082b8,
+0xb849eb00, 0x00000088, 0x89b842eb, 0xeb000000,
+0x244cff3b, 0xfdf2623c, 0xc80d5948, 0x62001003,
+0xd448f5f1, 0x6201244c, 0x7f48fdf1, 0x0f01244c,
+0xfffca285, 0xebc031ff, 0x0056b813, 0x0ceb0000,
+0x000064b8, 0xb805eb00, 0x00000073, 0x5bf4658d,
+0xc35d5f5e, 0x00000000, 0x40404040, 0x40404040,
+0001720,
+};
+asm(".type avx512bw_vpclmulqdq_x86_32_D_64, STT_NOTYPE;");
+asm(".type avx512bw_vpclmulqdq_x86_32_D_64, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512bw_vpclmulqdq_x86_32_D_16[] = {
+0x83e58955, 0x02e8f0e4, 0xc9000000, 0x01b955c3,
+0x62000000, 0xef08f5f1, 0x57e589c9, 0xec835356,
+0xfdf1627c, 0xa88d7f08, 0x88ffffff, 0x41a80d4c,
+0x7510f983, 0xfdf162f6, 0xa8ad6f08, 0x62ffffff,
+0x7f08fdf1, 0xffff98ad, 0xcdf162ff, 0x62f6ef08,
+0x7f08fdf1, 0xffffb8b5, 0xfdf162ff, 0x98a56f08,
+0x62ffffff, 0x44085df3, 0xffffb88d, 0xf36200ff,
+0x951f08f5, 0xffffffb8, 0x93f8c500, 0x0f033cc2,
+0x0002b285, 0xb845c700, 0x00000001, 0x5d89db31,
+0xfdf162bc, 0xb8ad6f08, 0x62ffffff, 0x440855f3,
+0xffff988d, 0xf16200ff, 0x8d7f08fd, 0xffffffc8,
+0x0855f362, 0xff988d44, 0xc410ffff, 0xca1679e3,
+0xd4558901, 0x087df162, 0x62f44d7e, 0x6f08fdf1,
+0xffff989d, 0xe5f262ff, 0xc89d2908, 0xc5ffffff,
+0x3cc393f8, 0x53850f03, 0x62000002, 0x440865f3,
+0xffff988d, 0xf36210ff, 0x95440865, 0xffffff98,
+0xf5f36201, 0x00e21f08, 0xc493f8c5, 0x850f033c,
+0x00000231, 0x0865f362, 0xff98a544, 0x6200ffff,
+0x7f08fdf1, 0xffffc8a5, 0x65f362ff, 0x989d4408,
+0x11ffffff, 0x08fdf162, 0xffd89d7f, 0xd231ffff,
+0x08cdf162, 0xc031f6ef, 0xba945589, 0x000000ff,
+0x08fdf162, 0xf8c5d46f, 0xf362ca92, 0xf40f095d,
+0xfdf16208, 0x62fb6f08, 0x7f08fdf1, 0xffff78b5,
+0x65f362ff, 0x08f30f89, 0xdbf7c389, 0x623fe383,
+0x6e087df1, 0xc5f162cb, 0x62c9f308, 0x6e087df1,
+0xe5f162f8, 0x62ffd308, 0xeb08f5f1, 0xedf362cf,
+0xc8851f08, 0x00ffffff, 0xd093f8c5, 0x8903fa80,
+0x95850fc3, 0x62000001, 0x1f08f5f3, 0xffffd885,
+0xf8c500ff, 0xfa80d093, 0x84850f03, 0x31000001,
+0x7df162ff, 0xe57d6e08, 0x08fdf162, 0xff98ad6f,
+0xf162ffff, 0xffd308d5, 0x087df162, 0xe283d27e,
+0x7df16203, 0x83fe7e08, 0xff8501e6, 0x0158850f,
+0xf2390000, 0x0150850f, 0xf1620000, 0x7d17087c,
+0x887d8bf1, 0x087df162, 0xe683ce7e, 0x01e78303,
+0xff31fa89, 0x850fff85, 0x00000135, 0x850ff239,
+0x0000012d, 0x08f5f162, 0xffc89573, 0x6202ffff,
+0x6f08fdf1, 0xffffc8ad, 0x55f362ff, 0x08d50f89,
+0x08edf162, 0x623ef273, 0xeb08f5f1, 0xfdf162ca,
+0xc88d7f08, 0xffffffff, 0xc0839445, 0xfdf16202,
+0xd8ad6f08, 0x62ffffff, 0x7308f5f1, 0xffffd895,
+0xf36202ff, 0xd50f8955, 0xedf16208, 0x3ef27308,
+0x40947d83, 0x08f5f162, 0xf162caeb, 0x8d7f08fd,
+0xffffffd8, 0xf8836874, 0xfdf1623f, 0x77fe6f08,
+0xfffebe39, 0xf162ffff, 0xad6f08fd, 0xffffff78,
+0x087df162, 0xde29c86e, 0x08ddf162, 0xf389c9d3,
+0x623fe383, 0x6e087df1, 0xd5f162d3, 0x62d2f308,
+0xeb08edf1, 0xfe8ee9d1, 0xeb83ffff, 0xfdf1623e,
+0x78ad6f08, 0x62ffffff, 0x6e087df1, 0xd5f162cb,
+0x62d1d308, 0xd308cdf1, 0xfe8fe9c9, 0xf262ffff,
+0x0d5908fd, 0x00100370, 0x08f5f162, 0xff988dd4,
+0x6249ffff, 0x7f08fdf1, 0xffff988d, 0x16850fff,
+0x31fffffd, 0xb82febc0, 0x00000056, 0x64b828eb,
+0xeb000000, 0x0073b821, 0x1aeb0000, 0x000081b8,
+0xb813eb00, 0x00000082, 0x88b80ceb, 0xeb000000,
+0x0089b805, 0xc4830000, 0x5f5e5b7c, 0x0000c35d,
+0x10101010, 0x10101010,
+0001570,
+};
+asm(".type avx512bw_vpclmulqdq_x86_32_D_16, STT_NOTYPE;");
+asm(".type avx512bw_vpclmulqdq_x86_32_D_16, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512bw_vpclmulqdq_x86_32_D_32[] = {
+0xb85500eb, 0x00000001, 0x08f5f162, 0xe589c9ef,
+0x83535657, 0xec81e0e4, 0x000000e0, 0x28fdf162,
+0x03244c7f, 0x60044488, 0x20f88340, 0x44c7f675,
+0x00081c24, 0xf1620000, 0x7c6f28fd, 0xf1620324,
+0x7c7f28fd, 0xf1620224, 0xedef08d5, 0x28fdf162,
+0x04246c7f, 0x28fdf162, 0x02247c6f, 0x2845f362,
+0x04244c44, 0xf5f36200, 0x24441f28, 0xf8c50004,
+0x0f3cc093, 0x0317850f, 0x84c70000, 0x00008024,
+0x00000100, 0x31c03100, 0x248489d2, 0x00000084,
+0x902484c7, 0x01000000, 0x89000000, 0x00942494,
+0xf1620000, 0x6c6f28fd, 0xf3620424, 0x4c442855,
+0x62000224, 0x7f28fdf1, 0x6205244c, 0x442855f3,
+0x1002244c, 0x1679e3c4, 0xf16201ca, 0x4c7f28fd,
+0x94890624, 0x0000ac24, 0x7df16200, 0x244c7e08,
+0xfdf1622a, 0x245c6f28, 0xfef16202, 0x244c7e08,
+0xfdf1621a, 0x244cd608, 0xe5f36217, 0x24541f28,
+0xf8c50005, 0x0f3cc293, 0x028a850f, 0xf3620000,
+0x4c442865, 0x62100224, 0x442865f3, 0x01022454,
+0x28f5f362, 0xc500da1f, 0x3cc393f8, 0x6c850f0f,
+0x62000002, 0x442865f3, 0x0002246c, 0x28fdf162,
+0x05246c7f, 0x2865f362, 0x02245c44, 0xfdf16211,
+0x245c7f28, 0x00ffbe06, 0xf16200ff, 0xf6ef08cd,
+0xfbc5d231, 0xc031ce92, 0x2965f362, 0x6208f30f,
+0x0fa955f3, 0xf16208fd, 0xd56f28fd, 0x28fdf162,
+0xf162e36f, 0x747f28fd, 0xc1890124, 0xe183d9f7,
+0x7df1623f, 0x62c96e08, 0xf328ddf1, 0x7df162c9,
+0x62e06e08, 0xd328e5f1, 0xf5f162e4, 0x62cceb28,
+0x1f28edf3, 0x00052464, 0xcc93f8c5, 0x890ff980,
+0xdf850fc6, 0x62000001, 0x1f28f5f3, 0x0006246c,
+0xcd93f8c5, 0x0f0ff980, 0x0001d085, 0x62db3100,
+0x6e087df1, 0xfdf162e2, 0x24746f28, 0xcdf16202,
+0x62e4d328, 0x7e087df1, 0x03e183d1, 0x087df162,
+0xe783e77e, 0x62db8501, 0x7f08fdf1, 0x850f2424,
+0x000001a0, 0x850fcf39, 0x00000198, 0x087cf162,
+0x8b242417, 0xdb31243c, 0x087df162, 0xe183c97e,
+0x01e78303, 0x850fdb85, 0x0000017f, 0x850fcf39,
+0x00000177, 0x28fdf362, 0x6201d239, 0x39287df3,
+0xff3101e6, 0x28fdf362, 0x6201e439, 0x7e087df1,
+0x03e183d1, 0x087df162, 0xe383e37e, 0x0fff8501,
+0x00013f85, 0x0fcb3900, 0x00013785, 0xfdf36200,
+0x01c93928, 0x087cf162, 0x8b243417, 0xe383241c,
+0x7df16201, 0x83c97e08, 0xff8503e1, 0x0119850f,
+0xcb390000, 0x0111850f, 0xf1620000, 0x547328f5,
+0x62020524, 0x6f28fdf1, 0x62052474, 0x0fa94df3,
+0xf16208d6, 0xf27328ed, 0xf5f1623e, 0x62caeb28,
+0x7f28fdf1, 0x6205244c, 0x7328f5f1, 0x02062454,
+0x28fdf162, 0x0624646f, 0x5df36242, 0x08d40fa9,
+0x6202c083, 0x7328edf1, 0xfa833ef2, 0xf5f16240,
+0x62caeb28, 0x7f28fdf1, 0x7406244c, 0x3ff8835c,
+0x28fdf162, 0x0124646f, 0xfeb92d77, 0x62ffffff,
+0x6e087df1, 0xd5f162c8, 0x29c9d328, 0x3fe183f1,
+0x087df162, 0xf162d16e, 0xd2f328c5, 0x28edf162,
+0x43e9d1eb, 0x8dfffffe, 0xf162c24e, 0x746f28fd,
+0xf1620124, 0xc96e087d, 0x28c5f162, 0xf162d1d3,
+0xc9d328cd, 0xfffe46e9, 0x244cffff, 0xfdf2621c,
+0xc80d5928, 0x62001003, 0xd428f5f1, 0x6202244c,
+0x7f28fdf1, 0x0f02244c, 0xfffcb985, 0xebc031ff,
+0x0056b82f, 0x28eb0000, 0x000064b8, 0xb821eb00,
+0x00000073, 0x81b81aeb, 0xeb000000, 0x0082b813,
+0x0ceb0000, 0x000088b8, 0xb805eb00, 0x00000089,
+0x5bf4658d, 0xc35d5f5e, 0x20202020, 0x20202020,
+0001720,
+};
+asm(".type avx512bw_vpclmulqdq_x86_32_D_32, STT_NOTYPE;");
+asm(".type avx512bw_vpclmulqdq_x86_32_D_32, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512bw_vpclmulqdq_x86_64_D_64[] = {
+0xc55500eb, 0xb8c9eff1, 0x00000001, 0x48e58948,
+0x48c0e483, 0x0188ec81, 0xf1620000, 0x8c7f48fd,
+0x00000824, 0x04448800, 0xc0ff4808, 0x40f88348,
+0xf162f375, 0xb46f48fd, 0x00000824, 0x0004be00,
+0xf1620000, 0xb47f48fd, 0xffffc824, 0xefc9c5ff,
+0xfdf162f6, 0x24b47f48, 0x00000048, 0x48fdf162,
+0xc824bc6f, 0x62ffffff, 0x444845f3, 0x0048248c,
+0x62000000, 0x1f48f5f3, 0x00482484, 0xc5000000,
+0xfec093f8, 0x3d850fc0, 0x48000003, 0x482444c7,
+0x00000001, 0x2444c748, 0x00000158, 0x44c74800,
+0x00016824, 0xc7480000, 0x01782444, 0x62000000,
+0x6f48fdf1, 0x004824a4, 0xf3620000, 0x8c44485d,
+0xffffc824, 0xf16200ff, 0x8c7f48fd, 0x00008824,
+0x5df36200, 0x24944448, 0xffffffc8, 0xfdf16210,
+0x24947f48, 0x000000c8, 0x24848b48, 0x000000d8,
+0x48fdf162, 0xc8248c6f, 0x62ffffff, 0x7e08fdf1,
+0x48122454, 0xa0248489, 0x48000000, 0xe824848b,
+0x48000000, 0xb0248489, 0x48000000, 0xf824848b,
+0x48000000, 0xc0248489, 0x62000000, 0x1f48f5f3,
+0x00882494, 0xc5000000, 0xfec293f8, 0x8c850fc0,
+0x62000002, 0x444875f3, 0xffc82494, 0x6210ffff,
+0x444875f3, 0xffc8249c, 0x6201ffff, 0x1f48edf3,
+0xf8c500db, 0xc0fec393, 0x0268850f, 0xf3620000,
+0xa4444875, 0xffffc824, 0xf16200ff, 0xa47f48fd,
+0x00008824, 0x75f36200, 0x248c4448, 0xffffffc8,
+0xfdf16211, 0x248c7f48, 0x000000c8, 0xf162d231,
+0xdc6f48fd, 0x48fdf162, 0xc931d16f, 0x00ffb848,
+0x00ff00ff, 0xba4100ff, 0xfffffffe, 0x92fbe1c4,
+0x757362c8, 0x08c10fc9, 0xc95df362, 0x6208fc0f,
+0x6f48fd51, 0xf7d089c8, 0x3fe083d8, 0x08fdf162,
+0xf162e86e, 0xd5f348ed, 0x087df162, 0xf162ea6e,
+0xedd348f5, 0x48edf162, 0xf362d5eb, 0xa41f48e5,
+0x00008824, 0xd7890000, 0x48fdf162, 0x08249c7f,
+0x62000001, 0x7f48fdf1, 0x01482494, 0xf8c50000,
+0xc0fec493, 0x0150850f, 0xf3620000, 0xac1f48ed,
+0x0000c824, 0xf8c50000, 0xc0fec593, 0x013f850f,
+0xf1620000, 0xac6f48fd, 0xffffc824, 0x7df162ff,
+0x31d16e08, 0xd5f162c0, 0x62d2d348, 0x7f48fdf1,
+0x00482494, 0x8b4c0000, 0x4c48044c, 0x0804848b,
+0x41000001, 0x4101e183, 0x4d03e083, 0x850fc139,
+0x00000104, 0x045c8b4c, 0x848b4c50, 0x00014804,
+0xd9894d00, 0x03e08341, 0x245c894c, 0xe18341c0,
+0xc1394d01, 0x00e5850f, 0x83480000, 0x834810c0,
+0xb27540f8, 0x48fdf162, 0x8824ac6f, 0x62000000,
+0x7348edf1, 0x00882494, 0x62020000, 0x0fc955f3,
+0xf16208dd, 0xf37348e5, 0xedf1623e, 0x62d3eb48,
+0x7f48fdf1, 0x00882494, 0xf1620000, 0xac6f48fd,
+0x0000c824, 0x83c1ff00, 0xf16202c2, 0x947348ed,
+0x0000c824, 0xf3620200, 0xdd0fc955, 0xe5f16208,
+0x3ef37348, 0x48edf162, 0xf162d3eb, 0x947f48fd,
+0x0000c824, 0x40f98300, 0xd1626c74, 0xd16f48fd,
+0x773ffa83, 0xd089442b, 0xe083f829, 0xfdf1623f,
+0x62e86e08, 0xf348c5f1, 0x7df162dd, 0x62ea6e08,
+0xd348ddf1, 0xe5f162ed, 0xe9ddeb48, 0xfffffe75,
+0x62c2478d, 0x6e08fdf1, 0xc5f162d0, 0x62dad348,
+0xd348bdf1, 0xfe80e9d2, 0x81b8ffff, 0xeb000000,
+0x0082b85a, 0x53eb0000, 0x000088b8, 0xb84ceb00,
+0x00000089, 0xb84845eb, 0x40404040, 0x40404040,
+0x48fdf262, 0xf162c87c, 0x8cd448f5, 0xffffc824,
+0xfdf162ff, 0x248c7f48, 0xffffffc8, 0x850fceff,
+0xfffffc8d, 0x13ebc031, 0x000056b8, 0xb80ceb00,
+0x00000064, 0x73b805eb, 0xc9000000, 0x000000c3,
+0001735,
+};
+asm(".type avx512bw_vpclmulqdq_x86_64_D_64, STT_NOTYPE;");
+asm(".type avx512bw_vpclmulqdq_x86_64_D_64, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512bw_vpclmulqdq_x86_64_D_16[] = {
+0x625500eb, 0xef08f5f1, 0x0001b8c9, 0x89480000,
+0xfdf162e5, 0xfc4d7f08, 0xc0054488, 0x48c0ff48,
+0x7510f883, 0xfdf162f3, 0xfc756f08, 0x000010be,
+0xfdf16200, 0xfb757f08, 0x08cdf162, 0xf162f6ef,
+0x757f08fd, 0xfdf162fd, 0xfb7d6f08, 0x0845f362,
+0x00fd4d44, 0x08f5f362, 0x00fd451f, 0xc093f8c5,
+0x850f033c, 0x0000022c, 0xd045c748, 0x00000001,
+0x08fdf162, 0x62fd4d6f, 0x440875f3, 0x6200fb55,
+0x7f08fdf1, 0xf362fe55, 0x4d440875, 0xf16210fb,
+0x5d6f08fd, 0xfdf162fb, 0xfd4d7e08, 0x08e5f262,
+0xc5fe5529, 0x3cc293f8, 0xec850f03, 0x62000001,
+0x440865f3, 0x6210fb4d, 0x440865f3, 0x6201fb55,
+0x1f08f5f3, 0xf8c500da, 0x033cc393, 0x01d0850f,
+0xf3620000, 0x6d440865, 0xf16200fb, 0x6d7f08fd,
+0x65f362fe, 0xfb5d4408, 0xfdf16211, 0xff5d7f08,
+0x0000ffb8, 0xfdf16200, 0x31d56f08, 0xc5ff31d2,
+0x62c892f8, 0x6f08fdf1, 0x657362cb, 0x08c30f89,
+0xfffeb841, 0xf362ffff, 0xfd0f8955, 0xfd516208,
+0x89c86f08, 0x83d8f7d0, 0xf1623fe0, 0xe06e08fd,
+0x08f5f162, 0xf162ccf3, 0xe26e087d, 0x08e5f162,
+0xf162e4d3, 0xcceb08f5, 0x08edf362, 0x00fe651f,
+0xc5d18941, 0x3cc493f8, 0x4a850f03, 0x62000001,
+0x1f08f5f3, 0xc500ff6d, 0x3cc593f8, 0x3d850f03,
+0x62000001, 0x6f08fd71, 0xf162fb55, 0xe76e087d,
+0x08fdf162, 0xe083d07e, 0xadf16203, 0x62e4d308,
+0x7e08fdf1, 0x01e183e1, 0x0fc83948, 0x00011685,
+0xf9e3c400, 0x6201e116, 0x7e08fdf1, 0x01e183c8,
+0x4803e083, 0x850fc139, 0x00000102, 0x08fdf162,
+0x62fe4d6f, 0x0f8975f3, 0xf16208d1, 0xd17308f5,
+0xedf16202, 0x3ef27308, 0x08f5f162, 0xf162caeb,
+0x4d7f08fd, 0xfdf162fe, 0xff4d6f08, 0xc283c7ff,
+0x75f36202, 0x08d10f89, 0x08f5f162, 0x6202d173,
+0x7308edf1, 0xf1623ef2, 0xcaeb08f5, 0x08fdf162,
+0x83ff4d7f, 0x527440ff, 0x08fdd162, 0xfa83c96f,
+0x442c773f, 0x2944c089, 0x3fe083c8, 0x08fdf162,
+0xf162e06e, 0xd4f308c5, 0x087df162, 0xf162e26e,
+0xe4d308d5, 0x08edf162, 0xd4e9d4eb, 0x41fffffe,
+0x62c2418d, 0x6e08fdf1, 0xc5f162c8, 0x62d1d308,
+0xd308bdf1, 0xfedee9c9, 0xb848ffff, 0x10101010,
+0x10101010, 0x08fdf262, 0xf162c87c, 0x4dd408f5,
+0xfdf162fb, 0xfb4d7f08, 0x850fceff, 0xfffffdae,
+0x2febc031, 0x000056b8, 0xb828eb00, 0x00000064,
+0x73b821eb, 0xeb000000, 0x0081b81a, 0x13eb0000,
+0x000082b8, 0xb80ceb00, 0x00000088, 0x89b805eb,
+0x5d000000, 0x000000c3,
+0001305,
+};
+asm(".type avx512bw_vpclmulqdq_x86_64_D_16, STT_NOTYPE;");
+asm(".type avx512bw_vpclmulqdq_x86_64_D_16, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512bw_vpclmulqdq_x86_64_D_32[] = {
+0x625500eb, 0xef08f5f1, 0x0001b8c9, 0x89480000,
+0xe48348e5, 0xec8348e0, 0xfdf16228, 0x248c7f28,
+0xffffffa8, 0xa8044488, 0x48c0ff48, 0x7520f883,
+0xfdf162f3, 0x24b46f28, 0xffffffa8, 0x000008bf,
+0xbd516200, 0x62c0ef08, 0x7f28fdf1, 0xff8824b4,
+0x7162ffff, 0x847f28fd, 0xffffc824, 0xfdf162ff,
+0x24b46f28, 0xffffff88, 0x284df362, 0xc8248c44,
+0x00ffffff, 0x28f5f362, 0xc824841f, 0x00ffffff,
+0xc093f8c5, 0x850f0f3c, 0x000002fb, 0x2444c748,
+0x000001c8, 0x44c74800, 0x0001d824, 0xf1620000,
+0xbc6f28fd, 0xffffc824, 0x45f362ff, 0x248c4428,
+0xffffff88, 0xfdf16200, 0x248c7f28, 0xffffffe8,
+0x2845f362, 0x88248c44, 0x10ffffff, 0x28fdf162,
+0x08248c7f, 0x48000000, 0x1824448b, 0x28fdf162,
+0x88249c6f, 0x62ffffff, 0x7e08fdf1, 0x48fe244c,
+0x62240489, 0x2928e5f2, 0xffe82494, 0xf8c5ffff,
+0x0f3cc293, 0x0284850f, 0xf3620000, 0x8c442865,
+0xffff8824, 0xf36210ff, 0x94442865, 0xffff8824,
+0xf36201ff, 0xda1f28f5, 0x93f8c500, 0x0f0f3cc3,
+0x00026085, 0x65f36200, 0x24bc4428, 0xffffff88,
+0xfdf16200, 0x24bc7f28, 0xffffffe8, 0x2865f362,
+0x88249c44, 0x11ffffff, 0x28fdf162, 0x08249c7f,
+0xb8000000, 0x00ff00ff, 0x28fdf162, 0xf631d76f,
+0xfbc5c931, 0x7362c892, 0xd30fa965, 0xfdf16208,
+0x41cb6f28, 0xfffffeb8, 0x457362ff, 0x08cf0fa9,
+0x28fd5162, 0xc889da6f, 0x087df162, 0xd8f7e16e,
+0x28e5f162, 0xe083e4d3, 0xfdf1623f, 0x62f06e08,
+0xf328f5f1, 0xf5f162ce, 0x62cceb28, 0x1f28edf3,
+0xffe824a4, 0x4100ffff, 0xf8c5c989, 0x0f3cc493,
+0x01c6850f, 0xf3620000, 0xac1f28f5, 0x00000824,
+0xf8c50000, 0x0f3cc593, 0x01b5850f, 0xf1620000,
+0xac6f28fd, 0xffff8824, 0x7df162ff, 0x62e66e08,
+0x7e08fdf1, 0x03e083d0, 0x28d5f162, 0xf162e4d3,
+0xe27e08fd, 0x4801e283, 0x850fc239, 0x0000018a,
+0x16f9e3c4, 0xf16201e0, 0xca7e08fd, 0x8301e083,
+0x394803e2, 0x76850fd0, 0x62000001, 0x3928fdf3,
+0xf36201e6, 0xe539287d, 0xfdf16201, 0x62f27e08,
+0x3928fdf3, 0xe28301d6, 0xfdf16201, 0x83f07e08,
+0x394803e0, 0x3f850fc2, 0xc4000001, 0xea16f9e3,
+0xfdf36201, 0x01cd3928, 0x6201e283, 0x7e08fdf1,
+0x03e083e8, 0x0fc23948, 0x00012485, 0xfdf16200,
+0x24ac6f28, 0xffffffe8, 0x28f5f162, 0xe8249473,
+0x02ffffff, 0xa955f362, 0x6208d50f, 0x7328edf1,
+0xf1623ef2, 0xcaeb28f5, 0x28fdf162, 0xe8248c7f,
+0x62ffffff, 0x6f28fdf1, 0x000824a4, 0xf1620000,
+0x947328f5, 0x00000824, 0xc6ff0200, 0x6202c183,
+0x0fa95df3, 0xf16208d4, 0xf27328ed, 0xf5f1623e,
+0x62caeb28, 0x7f28fdf1, 0x0008248c, 0xfe830000,
+0x62527440, 0x6f28fdd1, 0x3ff983cb, 0x89442c77,
+0x7df162c0, 0x44e16e08, 0xf162c829, 0xe4d328c5,
+0x623fe083, 0x6e08fdf1, 0xb5f162e8, 0x62d5f328,
+0xeb28edf1, 0xfe5ce9d4, 0x8d41ffff, 0xf162c241,
+0xc86e08fd, 0x28b5f162, 0xf162d1d3, 0xc9d328ad,
+0xfffe66e9, 0x20b848ff, 0x20202020, 0x62202020,
+0x7c28fdf2, 0xf5f162c8, 0x248cd428, 0xffffff88,
+0x28fdf162, 0x88248c7f, 0xffffffff, 0xcf850fcf,
+0x31fffffc, 0xb82febc0, 0x00000056, 0x64b828eb,
+0xeb000000, 0x0073b821, 0x1aeb0000, 0x000081b8,
+0xb813eb00, 0x00000082, 0x88b80ceb, 0xeb000000,
+0x0089b805, 0xc3c90000,
+0001670,
+};
+asm(".type avx512bw_vpclmulqdq_x86_64_D_32, STT_NOTYPE;");
+asm(".type avx512bw_vpclmulqdq_x86_64_D_32, STT_FUNC;");
@@ -0,0 +1,2522 @@
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512bw_x86_32_D_64i1[] = {
+0xb25500eb, 0xb9e58901, 0x00000008, 0x83c03153,
+0xec81c0e4, 0x00000380, 0x40049488, 0xb3000002,
+0x88d32841, 0x0280049c, 0xc3890000, 0x8301e383,
+0xdb1901fb, 0xfe02e380, 0x049c88cb, 0x000002c0,
+0x2101588d, 0x01f883d8, 0xfe00d983, 0x1c8c88c2,
+0x000002ff, 0x7440fb83, 0xebd88904, 0xfdf162bb,
+0x247c6f48, 0xfdf16209, 0x247c7f48, 0xfdf16206,
+0x245c6f48, 0x65f36206, 0x00c73f48, 0x91f8e1c4,
+0x01002484, 0x948b0000, 0x00010424, 0x24848b00,
+0x00000100, 0xfc850f42, 0x40000005, 0x05f5850f,
+0xf1620000, 0x4cfc4865, 0xf1620924, 0x4c7f48fd,
+0xf1620724, 0x7471485d, 0xb0010924, 0xfdf162fe,
+0x24546f48, 0x7df26207, 0x62c87a48, 0xdb48f5f1,
+0x6df362cc, 0x00d13f48, 0x91f8e1c4, 0x01002494,
+0x948b0000, 0x00010424, 0x24848b00, 0x00000100,
+0xa7850f42, 0x40000005, 0x05a0850f, 0xf1620000,
+0x54f8486d, 0xf1620924, 0x547f48fd, 0xf3620824,
+0x5c3f4865, 0xc4000824, 0x9c91f8e1, 0x00010024,
+0x24948b00, 0x00000104, 0x0024848b, 0x42000001,
+0x056f850f, 0x0f400000, 0x00056885, 0xfdf16200,
+0x244c6f48, 0xfdf16209, 0x245c6f48, 0x75f1620b,
+0x62d16048, 0x604865f1, 0x65f162fb, 0x62f36848,
+0x7f48fdf1, 0x6203247c, 0x7f48fdf1, 0x62022474,
+0xd5486df1, 0x62032454, 0x684875f1, 0x55f162e9,
+0x246cd548, 0xfdf16202, 0x00256f48, 0x62001007,
+0x6f48fdf1, 0x1007403d, 0xedf26200, 0x62e57548,
+0x7d48c5f2, 0x5df262d5, 0x80250048, 0x62001007,
+0x00486df2, 0x1007c015, 0xddf16200, 0xc5f2eb48,
+0x62d2efe9, 0x7f48fdf1, 0x62042474, 0x6f48fdf1,
+0x620c2474, 0x3f484df3, 0xf26206ca, 0x7466496d,
+0xf2620424, 0xd630487d, 0x487df262, 0x18246c30,
+0x48fdf162, 0x0c24646f, 0x48edf262, 0xf362ed12,
+0xf63b48fd, 0xfdf36201, 0x01e43b48, 0x487df262,
+0xf262f630, 0xe430487d, 0x48cdf262, 0xf262e412,
+0xe430487e, 0x487ef262, 0xf362ed30, 0xec3a48d5,
+0xfdf16201, 0x246c7f48, 0x6201b001, 0x6f48fdf1,
+0x620c246c, 0x7a487df2, 0x55f162e0, 0x62e4f848,
+0x7f48fdf1, 0x620c2464, 0x30487df2, 0x6218246c,
+0x7f48fdf1, 0xf262242c, 0x141248ed, 0xfdf16224,
+0x246c6f48, 0xfdf3620c, 0x01ec3b48, 0x487df262,
+0xf262e430, 0xe41248cd, 0x48fdf162, 0x0124746f,
+0x487ef262, 0xf262d230, 0xe430487e, 0x48edf362,
+0x6201d43a, 0xfc486df1, 0x4df362d2, 0x00e23f48,
+0x91f8e1c4, 0x8b402464, 0x8b442454, 0x42402444,
+0x03e6850f, 0x0f400000, 0x0003df85, 0xfdf16200,
+0x24746f48, 0x4df1620a, 0x62e66048, 0x68484df1,
+0x5df162d6, 0x2464d548, 0xfdf16203, 0x002d6f48,
+0x62001007, 0xd5486df1, 0x62022454, 0x7548ddf2,
+0xc5f262ea, 0x62e27d48, 0x004855f2, 0x1007802d,
+0x5df26200, 0xc0250048, 0x62001007, 0xeb48d5f1,
+0xfdf162ec, 0x246c7f48, 0xfdf16207, 0x24746f48,
+0x4df26204, 0x24543c48, 0xfdf16207, 0x24547f48,
+0x4df26208, 0x24643848, 0xfdf16207, 0x24647f48,
+0x6df16207, 0x2454fc48, 0xfdf16207, 0x002d6f48,
+0x62001007, 0x60486df1, 0x6df162e2, 0x62d26848,
+0xd5485df1, 0x62032464, 0xd5486df1, 0x62022454,
+0x7548ddf2, 0xc5f262ea, 0x62e27d48, 0xfc4875f1,
+0x620a2454, 0x004855f2, 0x1007802d, 0x5df26200,
+0xc0250048, 0x62001007, 0xeb48d5f1, 0x5df362e4,
+0x00ea3f48, 0x91f8e1c4, 0x010024ac, 0x948b0000,
+0x00010424, 0x24848b00, 0x00000100, 0xe0850f42,
+0x40000002, 0x02d9850f, 0xf1620000, 0xeb604865,
+0x4875f162, 0xf162d160, 0xdb684865, 0x4855f162,
+0xf162d2d5, 0xe1684875, 0x4865f162, 0xf162e4d5,
+0x1d6f48fd, 0x00100700, 0x48edf262, 0xf262dc75,
+0xd47d48c5, 0x4865f262, 0x07801d00, 0xf2620010,
+0x1500486d, 0x001007c0, 0x48e5f162, 0xf162daeb,
+0x5c7f48fd, 0xf2620624, 0x541c487d, 0xf3620624,
+0xf13f486d, 0xf8e1c400, 0x0024b491, 0x8b000001,
+0x01042494, 0x848b0000, 0x00010024, 0x850f4200,
+0x00000256, 0x4f850f40, 0x62000002, 0xfc4875f1,
+0xc60a2454, 0x03402484, 0x62410000, 0x78487df2,
+0x0340249c, 0xf3620000, 0xfa3f4865, 0xf8e1c400,
+0x0024bc91, 0x8b000001, 0x01042494, 0x848b0000,
+0x00010024, 0x850f4200, 0x00000215, 0x0e850f40,
+0xb8000002, 0x00000041, 0x487df262, 0xf362d87a,
+0xc23f4865, 0xf8e1c400, 0x00248491, 0x8b000001,
+0x01042494, 0x848b0000, 0x00010024, 0x850f4200,
+0x000001e4, 0xdd850f40, 0x31000001, 0xfdf162c0,
+0x244c7f48, 0x04948a0d, 0x00000340, 0x04948840,
+0x0000015f, 0x7520f883, 0x7df262ec, 0x24542048,
+0xfdf1620b, 0x24547f48, 0xfdf16206, 0x247c6f48,
+0x7ef26206, 0x247c3048, 0x8ac0311a, 0x0240048c,
+0x8c380000, 0x00034004, 0xb80a7400, 0x000006f1,
+0x00018fe9, 0xf8834000, 0x31e07520, 0xfdf162c0,
+0x244c7f48, 0x04948a0d, 0x00000340, 0x60049488,
+0x40000001, 0x7510f883, 0x7df262ec, 0x24542148,
+0x7df16216, 0x24547f48, 0x7df16206, 0x247c6f48,
+0x7ef26206, 0x247c3148, 0x8ac03134, 0x0240048c,
+0x8c380000, 0x00034004, 0xb80a7400, 0x00000700,
+0x00012fe9, 0xf8834000, 0x31e07510, 0xfdf162c0,
+0x244c7f48, 0x04948a0d, 0x00000340, 0x60049488,
+0x40000001, 0x7508f883, 0x6ff9c5ec, 0x016024bc,
+0xf2620000, 0xd722487d, 0x48fdf162, 0x0624547f,
+0x48fdf162, 0x06247c6f, 0x487ef262, 0xf9c5fa32,
+0x4024947f, 0x31000003, 0x048c8ac0, 0x00000240,
+0x40048c38, 0x74000003, 0x070fb80a, 0xc1e90000,
+0x40000000, 0x7508f883, 0x0001b8e0, 0xf1620000,
+0x4c7f48fd, 0x948a0724, 0x00028004, 0x04948800,
+0x000001c0, 0x8302c083, 0xea7541f8, 0x002484c7,
+0xaa000001, 0x62aaaaaa, 0x6f48fdf1, 0xc709247c,
+0x01042484, 0xaaaa0000, 0xe1c4aaaa, 0x248c90f8,
+0x00000100, 0x4945f262, 0x0a244c66, 0x4875f362,
+0x0724543f, 0xf8e1c400, 0x00249491, 0x8b000001,
+0x01042494, 0x848b0000, 0x00010024, 0x3f754200,
+0x313c7540, 0xb83debc0, 0x00000539, 0x3fb836eb,
+0xeb000005, 0x0544b82f, 0x28eb0000, 0x000621b8,
+0xb821eb00, 0x0000063d, 0x44b81aeb, 0xeb000006,
+0x065db813, 0x0ceb0000, 0x000661b8, 0xb805eb00,
+0x0000073a, 0xc9fc5d8b, 0x000000c3, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00020000, 0x00060004, 0x00220020, 0x00260024,
+0x000a0008, 0x000e000c, 0x002a0028, 0x002e002c,
+0x00120010, 0x00160014, 0x00320030, 0x00360034,
+0x001a0018, 0x001e001c, 0x003a0038, 0x003e003c,
+0x00030001, 0x00070005, 0x00230021, 0x00270025,
+0x000b0009, 0x000f000d, 0x002b0029, 0x002f002d,
+0x00130011, 0x00170015, 0x00330031, 0x00370035,
+0x001b0019, 0x001f001d, 0x003b0039, 0x003f003d,
+0xff02ff00, 0xff06ff04, 0xff0aff08, 0xff0eff0c,
+0xff02ff00, 0xff06ff04, 0xff0aff08, 0xff0eff0c,
+0xff02ff00, 0xff06ff04, 0xff0aff08, 0xff0eff0c,
+0xff02ff00, 0xff06ff04, 0xff0aff08, 0xff0eff0c,
+0x02ff00ff, 0x06ff04ff, 0x0aff08ff, 0x0eff0cff,
+0x02ff00ff, 0x06ff04ff, 0x0aff08ff, 0x0eff0cff,
+0x02ff00ff, 0x06ff04ff, 0x0aff08ff, 0x0eff0cff,
+0x02ff00ff, 0x06ff04ff, 0x0aff08ff, 0x0eff0cff,
+0004000,
+};
+asm(".type avx512bw_x86_32_D_64i1, STT_NOTYPE;");
+asm(".type avx512bw_x86_32_D_64i1, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512bw_x86_32_D_64u1[] = {
+0xb25500eb, 0xb9e58901, 0x00000008, 0x83c03153,
+0xec81c0e4, 0x00000200, 0x00049488, 0xb3000001,
+0x88d32841, 0x0140049c, 0xc3890000, 0x83c32140,
+0xd98301fb, 0x88c2fe00, 0x017f048c, 0xf8830000,
+0x62d57540, 0x6f48fdf1, 0x6204247c, 0x7f48fdf1,
+0x6201247c, 0x6f48fdf1, 0x62012454, 0x3f486df3,
+0xe1c400c7, 0x244491f8, 0x24548b18, 0x24448b1c,
+0x850f4218, 0x00000423, 0x1c850f40, 0x62000004,
+0xfc486df1, 0x6204244c, 0x7f48fdf1, 0x6202244c,
+0x71485df1, 0x01042474, 0xf162feb0, 0x4c6f48fd,
+0xf2620224, 0xd87a487d, 0x48e5f162, 0xf362dcdb,
+0xd33f4875, 0xf8e1c400, 0x18245491, 0x1c24548b,
+0x1824448b, 0xd7850f42, 0x40000003, 0x03d0850f,
+0xf1620000, 0x4cf84875, 0xf1620424, 0x4c7f48fd,
+0xf1620324, 0x5c6f48fd, 0xf3620324, 0xdb3f486d,
+0xf8e1c400, 0x18245c91, 0x1c24548b, 0x1824448b,
+0xa2850f42, 0x40000003, 0x039b850f, 0xf1620000,
+0x54eb48ed, 0xf1620524, 0x547f48fd, 0xf1620124,
+0x4cdb48f5, 0xf1620524, 0x5cef48e5, 0xf1620524,
+0x4cdf48f5, 0xf3620124, 0xe33f4875, 0xf8e1c400,
+0x18246491, 0x1c24548b, 0x1824448b, 0x5d850f42,
+0x40000003, 0x0356850f, 0xf1620000, 0x646f48fd,
+0xf1c50424, 0xf162c9ef, 0x7c6f48fd, 0xf3620624,
+0xf625484d, 0x45f362ff, 0x04c93f48, 0x497ff162,
+0xf162ce6f, 0xccdb48f5, 0x48fdf162, 0x03244c7f,
+0x487df262, 0xf262d130, 0x5c30487d, 0xf1620c24,
+0x7c6f48fd, 0xf2620624, 0xdb1248ed, 0x48fdf362,
+0x6201fd3b, 0x3b48fdf3, 0xf26201c9, 0xed30487d,
+0x487df262, 0xf262c930, 0xed1248f5, 0x487ef262,
+0xf262ed30, 0xdb30487e, 0x48e5f362, 0x6201dd3a,
+0xfc484df1, 0x62062474, 0x7f48fdf1, 0x62062474,
+0x30487df2, 0x620c2474, 0x6f48fdf1, 0x6206247c,
+0x1248edf2, 0xfdf362d6, 0x01fd3b48, 0x487df262,
+0xf262ed30, 0xcd1248f5, 0x487ef262, 0xf262d230,
+0xc930487e, 0x48edf362, 0x6201c93a, 0xfc4875f1,
+0x65f362c9, 0x00e93f48, 0x91f8e1c4, 0x8b18246c,
+0x8b1c2454, 0x42182444, 0x0269850f, 0x0f400000,
+0x00026285, 0x5df16200, 0x244cda48, 0xfdf16205,
+0x244c7f48, 0x5df16201, 0x245cde48, 0xfdf16205,
+0x245c7f48, 0x5df16202, 0x2454fc48, 0x75f16205,
+0x62cbfc48, 0x3f4875f3, 0xe1c400f2, 0x247491f8,
+0x24548b18, 0x24448b1c, 0x850f4218, 0x0000021e,
+0x17850f40, 0xc6000002, 0x01c02484, 0x62410000,
+0x78487df2, 0x01c0248c, 0xf3620000, 0xfa3f4875,
+0xf8e1c400, 0x18247c91, 0x1c24548b, 0x1824448b,
+0xee850f42, 0x40000001, 0x01e7850f, 0x41b80000,
+0x62000000, 0x7a487df2, 0x75f362c8, 0x00c23f48,
+0x91f8e1c4, 0x8b182444, 0x8b1c2454, 0x42182444,
+0x01c6850f, 0x0f400000, 0x0001bf85, 0x62c03100,
+0x7f48fdf1, 0x8a072464, 0x01c00494, 0x88400000,
+0x831f0454, 0xef7520f8, 0x487df262, 0x01244c30,
+0x48fdf162, 0x01244c7f, 0x48fdf162, 0x01247c6f,
+0x487ef262, 0x0e247c30, 0x8c8ac031, 0x00010004,
+0x048c3800, 0x000001c0, 0xf1b80a74, 0xe9000006,
+0x00000174, 0x20f88340, 0xc031e075, 0x48fdf162,
+0x0724647f, 0xc004948a, 0x88000001, 0x40200454,
+0x7510f883, 0x7df262ef, 0x244c3148, 0x7df16202,
+0x244c7f48, 0x7df16201, 0x24746f48, 0x7ef26201,
+0x24743148, 0x8ac0311c, 0x0100048c, 0x8c380000,
+0x0001c004, 0xb80a7400, 0x00000700, 0x000117e9,
+0xf8834000, 0x31e07510, 0xfdf162c0, 0x24647f48,
+0x04948a07, 0x000001c0, 0x20045488, 0x08f88340,
+0xf9c5ef75, 0x20247c6f, 0x487df262, 0xf162cf32,
+0x4c7f48fd, 0xf1620124, 0x746f48fd, 0xf2620124,
+0xf132487e, 0x8c7ff9c5, 0x0001c024, 0x8ac03100,
+0x0100048c, 0x8c380000, 0x0001c004, 0xb80a7400,
+0x0000070f, 0x0000afe9, 0xf8834000, 0xb8e07508,
+0x00000001, 0x48fdf162, 0x0224647f, 0x4004948a,
+0x88000001, 0x00800494, 0xc0830000, 0x41f88302,
+0x44c7ea75, 0xaaaa1824, 0xf162aaaa, 0x646f48fd,
+0x44c70424, 0xaaaa1c24, 0xe1c4aaaa, 0x244c90f8,
+0x5df26218, 0x244c6649, 0x75f36205, 0x24543f48,
+0xe1c40002, 0x245491f8, 0x24548b18, 0x24448b1c,
+0x3f754218, 0x313c7540, 0xb83debc0, 0x00000539,
+0x3fb836eb, 0xeb000005, 0x0544b82f, 0x28eb0000,
+0x000550b8, 0xb821eb00, 0x00000621, 0x34b81aeb,
+0xeb000006, 0x065db813, 0x0ceb0000, 0x000661b8,
+0xb805eb00, 0x0000073a, 0xc9fc5d8b, 0x000000c3,
+0002335,
+};
+asm(".type avx512bw_x86_32_D_64u1, STT_NOTYPE;");
+asm(".type avx512bw_x86_32_D_64u1, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512bw_x86_32_D_64i2[] = {
+0x315500eb, 0x57e589c9, 0x000010bf, 0x83535600,
+0xec81c0e4, 0x000002c0, 0x1c2444c7, 0x00000010,
+0x082444c6, 0xd1b70f00, 0x9801428d, 0x20b8c389,
+0x29000000, 0x448998d0, 0xc8890424, 0x8301e083,
+0x418d01f8, 0x83f61901, 0x854e02e6, 0xc60675c8,
+0x01082444, 0x9c89664f, 0x0000fe44, 0x01e28300,
+0x04245c8b, 0x44b48966, 0x0000017e, 0x6605e2c1,
+0xbe44bc89, 0xd1000001, 0x66d109e9, 0x3e449c89,
+0x0f000001, 0x8966c9b7, 0x01fe448c, 0xc1830000,
+0x20f88310, 0x448c8966, 0x0000023e, 0xc1890474,
+0x7c8083eb, 0x74000824, 0x247c8904, 0xfdf1621c,
+0x247c6f48, 0xfdf16204, 0x247c7f48, 0xfdf16201,
+0x244c6f48, 0xf5f36201, 0x00d73f48, 0xca93fbc5,
+0x0539ba41, 0x850f0000, 0x00000678, 0x4875f162,
+0x042454fd, 0x48fdf162, 0x0224547f, 0x4865f162,
+0x04247471, 0xfdf16201, 0x24546f48, 0x053fba02,
+0xf3620000, 0xdb3f48ed, 0x93fbc500, 0x850f41cb,
+0x00000640, 0x486df162, 0x042454f9, 0x48fdf162,
+0x0324547f, 0x48f5f362, 0x0324643f, 0x93fbc500,
+0x44ba41cc, 0x0f000005, 0x00061785, 0xfdf16200,
+0x247c6f48, 0x75f16205, 0x244cd548, 0x45f16204,
+0x62dfd548, 0x7f48fdf1, 0x6202245c, 0x6f48fdf1,
+0x62042454, 0xfd486df1, 0x6df162ef, 0x2464f948,
+0x75f16205, 0xbacbf948, 0x0000055b, 0x485df162,
+0xf362e5d5, 0xec3f48f5, 0x93fbc500, 0xf16241cd,
+0x647f48fd, 0x850f0324, 0x000005b8, 0x486df162,
+0x05244cd5, 0x48fdf162, 0x01244c7f, 0x2484c766,
+0x00000080, 0x8c8d0020, 0x00008024, 0x84c76600,
+0x0000be24, 0x66002000, 0xe883118b, 0x02c18302,
+0x0fc20166, 0x8966d2bf, 0x02f88311, 0x04948966,
+0x0000009e, 0x8966e175, 0x00a02494, 0xf1620000,
+0x746f48fd, 0xc8ba0124, 0x62000005, 0x75484df1,
+0xc5022474, 0x40c693fb, 0x0546850f, 0xf1620000,
+0x5ce5486d, 0xc9c50624, 0xf162f6ef, 0x4c6f48fd,
+0xf3620624, 0xc63f48f5, 0xfef26201, 0xbae02848,
+0x000005cf, 0x48e5f362, 0xc500fc3f, 0x40c793fb,
+0x050e850f, 0xf1620000, 0x64d54875, 0xf1620424,
+0x647f48fd, 0xf1620324, 0x74714865, 0x62030324,
+0x7f48fdf1, 0x6201245c, 0x714855f1, 0x02032474,
+0x4855f162, 0xedbafdfd, 0x62000005, 0x3f48e5f3,
+0xfbc500c7, 0x0f40c093, 0x0004c785, 0x65f16200,
+0x24647148, 0xf1620201, 0xdbfd4865, 0x0005f2ba,
+0xd5f36200, 0x00d33f48, 0xc293fbc5, 0xa1850f40,
+0xc7000004, 0x031c2444, 0x62000000, 0xd5486df1,
+0x24448be9, 0x2444891c, 0x1ff8c108, 0x0c244489,
+0x08fef162, 0x01247c7e, 0x4855f162, 0x44c7dff1,
+0x00021c24, 0x448b0000, 0x44891c24, 0xf8c10824,
+0x2444891f, 0xfef1620c, 0x247c7e08, 0x55f16201,
+0x62eff148, 0xfd4855f1, 0x0605bafd, 0xf3620000,
+0xdf3f48e5, 0x93fbc500, 0x850f40c3, 0x00000434,
+0x1c24448b, 0x08244489, 0x891ff8c1, 0x620c2444,
+0x7e08fef1, 0x6201247c, 0xe14865f1, 0x65f162df,
+0xbadbfd48, 0x00000609, 0x48d5f362, 0xc500e33f,
+0x40c493fb, 0x03fa850f, 0xf1620000, 0x7c6f48fd,
+0xf3620724, 0xce3f48c5, 0x6df16206, 0x62d9d5c9,
+0x1248e5f2, 0xb807246c, 0x00000001, 0x48fdf162,
+0x07247c6f, 0x487df262, 0xf162f07b, 0xf6f94845,
+0x48fdf162, 0x0724747f, 0x48e5f262, 0x07245c12,
+0x000621ba, 0x65f16200, 0x62dbfd48, 0x3f48d5f3,
+0xfbc500eb, 0x0f40c593, 0x00039785, 0x75f16200,
+0x245cd548, 0xfdf16205, 0x245c7f48, 0x5df16202,
+0x245cee48, 0x5df16202, 0x2464ea48, 0xfdf16202,
+0x24647f48, 0x65f16202, 0x245cfd48, 0x063dba02,
+0xf1620000, 0x64fd486d, 0xf1620524, 0xd9d54865,
+0x48e5f362, 0xc500f43f, 0x40c693fb, 0x0342850f,
+0xf1620000, 0xd9d5486d, 0x48fdf162, 0x01245c7f,
+0x487df262, 0x01245c1d, 0x48e5f362, 0xc500fa3f,
+0x40c793fb, 0x000644ba, 0x15850f00, 0xb8000003,
+0x00000001, 0x48fdf162, 0x0524646f, 0x48fdf162,
+0x04245c6f, 0x487df262, 0xf162d07b, 0xd2f9485d,
+0x000653ba, 0xedf26200, 0x62d38d48, 0x3f48edf3,
+0xfbc500c4, 0x0f40c093, 0x0002d785, 0x84c76600,
+0x00028024, 0x62002100, 0xfd485df1, 0x065dbad3,
+0xf2620000, 0x9c79487d, 0x00028024, 0xe5f36200,
+0x00d23f48, 0xc293fbc5, 0xa5850f40, 0xb8000002,
+0x00000021, 0x000661ba, 0x7df26200, 0x62d87b48,
+0x3f48e5f3, 0xfbc500da, 0x0f40c393, 0x00028385,
+0xfdf16200, 0x24546f48, 0xfdf16208, 0x62dc6f48,
+0x7d48edf2, 0x6204245c, 0x6f48fdf1, 0x62092474,
+0x7d48cdf2, 0x66042464, 0x802484c7, 0x10000002,
+0x65f16200, 0xbadcf948, 0x000006a6, 0x4865f162,
+0xf262d9d5, 0xa479487d, 0x00028024, 0xe5f36200,
+0x00e43f48, 0xc493fbc5, 0xfdf16240, 0x245c7f48,
+0x1d850f03, 0x62000002, 0xd54875f1, 0xc504245c,
+0x62e4efd9, 0x3f48f5f3, 0xf36201cc, 0xe425485d,
+0xfff162ff, 0x62ec6fc9, 0x7f48fdf1, 0x6201245c,
+0x7d48edf2, 0xfdf162dd, 0x245c7f48, 0x62c03102,
+0x6f48fdf1, 0x62012474, 0x7f48fdf1, 0x660a2474,
+0x8044948b, 0x66000002, 0x20445489, 0x10f88340,
+0xf262ed75, 0x5c23487d, 0xf1620124, 0xeb6f48fd,
+0x487df162, 0x03245c7f, 0x48e5f362, 0x02246c3f,
+0x93fbc500, 0xb3ba40c5, 0x0f000006, 0x00019385,
+0xefe1c500, 0xf5f362db, 0x01cb3f48, 0x49e5f262,
+0xf262cc66, 0xc97d48ed, 0x48d5f262, 0xf162d175,
+0x547f48fd, 0xc0310224, 0x48fdf162, 0x0124746f,
+0x48fdf162, 0x0a24747f, 0x44948b66, 0x00000280,
+0x44548966, 0xf8834020, 0x62ed7508, 0x24487df2,
+0x6202244c, 0x7f48fdf1, 0x6203244c, 0x3f48f5f3,
+0x00022474, 0xc693fbc5, 0x06bbba40, 0x850f0000,
+0x00000120, 0xf162c031, 0x4c6f48fd, 0xf1620424,
+0x4c7f48fd, 0x8b660a24, 0x02804494, 0x89660000,
+0x40204454, 0x7510f883, 0x7df262ed, 0x24542348,
+0x7df16201, 0x24547f48, 0x7df16201, 0x24746f48,
+0x7ef26201, 0x24743348, 0x66c03114, 0x80449c8b,
+0x66000002, 0x00449c39, 0x74000001, 0x06f1ba0a,
+0xbde90000, 0x40000000, 0x7510f883, 0x62c031de,
+0x7f48fdf1, 0x660a244c, 0x8044948b, 0x66000002,
+0x20445489, 0x08f88340, 0xf262ed75, 0x5424487d,
+0xf1620224, 0x547f48fd, 0xf1620124, 0x746f48fd,
+0xf2620124, 0x7434487e, 0xc0312824, 0x44b48b66,
+0x00000280, 0x44b43966, 0x00000100, 0x00ba0774,
+0xeb000007, 0xf883405f, 0xb8e17508, 0x00000001,
+0x48fdf162, 0x02244c7f, 0x44948b66, 0x00000140,
+0x44948966, 0x00000080, 0x8302c083, 0xe87521f8,
+0xaaaaaab8, 0x073abaaa, 0xf1620000, 0x6c6f48fd,
+0xfbc50424, 0xf262c892, 0x4c6649d5, 0xf3620524,
+0x7c3f48f5, 0xc5000224, 0x40c793fb, 0x000000b8,
+0xd0440f00, 0x89f4658d, 0x5f5e5bd0, 0x0000c35d,
+0003536,
+};
+asm(".type avx512bw_x86_32_D_64i2, STT_NOTYPE;");
+asm(".type avx512bw_x86_32_D_64i2, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512bw_x86_32_D_64u2[] = {
+0x315500eb, 0x57e589c0, 0x0010be56, 0x31530000,
+0xc0e483db, 0x02c0ec81, 0x44c70000, 0x00101c24,
+0xb70f0000, 0x014a8dd0, 0xb9f9b70f, 0x00000020,
+0x0c247c89, 0xb70fd129, 0x89c189f9, 0x8308247c,
+0x0f4901e1, 0x7c89f9b7, 0xc7890424, 0x75f88540,
+0x01b34e03, 0x0c244c8b, 0xe283efd1, 0xb4896601,
+0x0001be44, 0x05e2c100, 0xb70fd709, 0x8c8966ff,
+0x0000fe44, 0x244c8b00, 0xbc896608, 0x0001fe44,
+0x10c78300, 0x6620f883, 0x3e44bc89, 0x66000002,
+0x3e448c89, 0x8b000001, 0x6604244c, 0x7e448c89,
+0x0f000001, 0xffff7985, 0x74db84ff, 0x24748904,
+0xfdf1621c, 0x247c6f48, 0xfdf16204, 0x247c7f48,
+0xfdf16201, 0x24546f48, 0xedf36201, 0x00c73f48,
+0xc893fbc5, 0x0539ba41, 0x850f0000, 0x000005b8,
+0x486df162, 0x04244cfd, 0x48fdf162, 0x02244c7f,
+0x4865f162, 0x04247471, 0xfdf16201, 0x244c6f48,
+0x053fba02, 0xf3620000, 0xd33f48f5, 0x93fbc500,
+0x850f41ca, 0x00000580, 0x4875f162, 0x04244cf9,
+0x48fdf162, 0x03244c7f, 0x48fdf162, 0x03245c6f,
+0x48edf362, 0xc500db3f, 0x41cb93fb, 0x000544ba,
+0x51850f00, 0x62000005, 0xeb48edf1, 0x62052454,
+0x7f48fdf1, 0x62012454, 0xdb48f5f1, 0x6205244c,
+0x7f48fdf1, 0x6202244c, 0xef48e5f1, 0x62052454,
+0x7f48fdf1, 0x62032454, 0xdf48f5f1, 0x6201244c,
+0x3f48f5f3, 0xfbc500e2, 0xba41cc93, 0x00000550,
+0x0502850f, 0xf1620000, 0x546f48fd, 0xf1620424,
+0x4cd5486d, 0xf1620524, 0x4c7f48fd, 0xc7660124,
+0x00802484, 0x00200000, 0x80248c8d, 0x66000000,
+0xbe2484c7, 0x20000000, 0x118b6600, 0x8302e883,
+0x016602c1, 0xd2b70fc2, 0x83118966, 0x896602f8,
+0x009e0494, 0xe1750000, 0x24948966, 0x000000a0,
+0x48fdf162, 0x0124746f, 0x0005c8ba, 0x4df16200,
+0x246c7548, 0x93fbc502, 0x850f40c5, 0x00000488,
+0x486df162, 0x062464e4, 0x48fdf162, 0x06245c6f,
+0x48edf162, 0xf162cbdb, 0xcbfd4875, 0x48ddf362,
+0xc500f13f, 0x40c693fb, 0x0005d1ba, 0x55850f00,
+0x62000004, 0x7f48fdf1, 0x62032454, 0x714875f1,
+0x03032474, 0x48fdf162, 0x01244c7f, 0x485df162,
+0x03247471, 0x5df16202, 0xbaecfd48, 0x000005ed,
+0x48f5f362, 0xc500fd3f, 0x40c793fb, 0x0416850f,
+0xf1620000, 0x54714875, 0x62020124, 0xfd4875f1,
+0x05f2bac9, 0xf3620000, 0xc13f48dd, 0x93fbc500,
+0x850f40c0, 0x000003f0, 0x1c2444c7, 0x00000003,
+0x087df162, 0x07244c6e, 0x486df162, 0x44c7c9f1,
+0x00021c24, 0xf1620000, 0x646e087d, 0xf1620724,
+0xe4f1486d, 0x485df162, 0x05baecfd, 0x62000006,
+0x3f48f5f3, 0xfbc500d5, 0x0f40c293, 0x0003a785,
+0x7df16200, 0x246c6e08, 0x75f16207, 0x62cdd148,
+0xfd4875f1, 0x0609bac9, 0xf3620000, 0xd93f48dd,
+0x93fbc500, 0x850f40c3, 0x0000037c, 0xc9eff1c5,
+0x48fdf162, 0x07247c6f, 0x48c5f362, 0x6204c93f,
+0x254875f3, 0xf162ffc9, 0xe16fc9ff, 0x48ddf162,
+0xf262e2db, 0x6c1248dd, 0xf1620724, 0x74fd4875,
+0xf1620724, 0x747f48fd, 0xf2620724, 0x641248dd,
+0x21ba0724, 0x62000006, 0xfd485df1, 0xd5f362e4,
+0x00e43f48, 0xc493fbc5, 0x19850f40, 0x62000003,
+0x3a486df2, 0x62052464, 0x3e486df2, 0x6205246c,
+0xfd486df1, 0x62052454, 0xfd485df1, 0x0634bae5,
+0xf3620000, 0xea3f48dd, 0x93fbc500, 0x850f40c5,
+0x000002e4, 0x48fdf162, 0x0524646f, 0x485df162,
+0xf162e9fd, 0x546f48fd, 0xf2620424, 0xea8d48d5,
+0x48d5f362, 0xc500f43f, 0x40c693fb, 0x000653ba,
+0xb1850f00, 0x66000002, 0x802484c7, 0x21000002,
+0x5df16200, 0xbad2fd48, 0x0000065d, 0x487df262,
+0x8024ac79, 0x62000002, 0x3f48d5f3, 0xfbc500fa,
+0x0f40c793, 0x00027f85, 0x0021b800, 0x61ba0000,
+0x62000006, 0x7b487df2, 0xd5f362e8, 0x00c23f48,
+0xc093fbc5, 0x5d850f40, 0x62000002, 0x6f48fdf1,
+0x62082454, 0x6f48fdf1, 0xedf262ec, 0x246c7d48,
+0xfdf16204, 0x246c7f48, 0xfdf16201, 0x24746f48,
+0xcdf26209, 0x24647d48, 0x84c76604, 0x00028024,
+0x62001000, 0xfd4875f1, 0x06a6bacc, 0xf1620000,
+0xcdf94875, 0x48f5f162, 0xf362cbef, 0xdb254865,
+0x75f16255, 0x62cbf948, 0x79487df2, 0x0280249c,
+0xf3620000, 0xcb3f48f5, 0x93fbc500, 0x850f40c1,
+0x000001e4, 0xdbefe1c5, 0x48fdf162, 0x04244c6f,
+0x48edf262, 0xf262cb7d, 0xd37548f5, 0x48fdf162,
+0x02244c7f, 0x48fdf162, 0x0324547f, 0xf162c031,
+0x7c6f48fd, 0xf1620424, 0x7c7f48fd, 0x8b660a24,
+0x02804494, 0x89660000, 0x40204454, 0x7510f883,
+0x7df262ed, 0x244c3348, 0x7df16201, 0x244c7f48,
+0xf5f36201, 0x24543f48, 0xfbc50002, 0xba40c293,
+0x000006d3, 0x016e850f, 0xc0310000, 0x48fdf162,
+0x0424746f, 0x48fdf162, 0x0a24747f, 0x44948b66,
+0x00000280, 0x44548966, 0xf8834020, 0x62ed7508,
+0x34487df2, 0x6202244c, 0x7f48fdf1, 0x6201244c,
+0x3f48f5f3, 0x0003245c, 0xc393fbc5, 0x06daba40,
+0x850f0000, 0x00000120, 0xf162c031, 0x4c6f48fd,
+0xf1620424, 0x4c7f48fd, 0x8b660a24, 0x02804494,
+0x89660000, 0x40204454, 0x7510f883, 0x7df262ed,
+0x24543348, 0x7df16201, 0x24547f48, 0x7df16201,
+0x247c6f48, 0x7ef26201, 0x247c3348, 0x66c03114,
+0x80449c8b, 0x66000002, 0x00449c39, 0x74000001,
+0x06f1ba0a, 0xbde90000, 0x40000000, 0x7510f883,
+0x62c031de, 0x7f48fdf1, 0x660a244c, 0x8044948b,
+0x66000002, 0x20445489, 0x08f88340, 0xf262ed75,
+0x5434487d, 0xf1620224, 0x547f48fd, 0xf1620124,
+0x746f48fd, 0xf2620124, 0x7434487e, 0xc0312824,
+0x44b48b66, 0x00000280, 0x44b43966, 0x00000100,
+0x00ba0774, 0xeb000007, 0xf883405f, 0xb8e17508,
+0x00000001, 0x48fdf162, 0x02244c7f, 0x44948b66,
+0x00000140, 0x44948966, 0x00000080, 0x8302c083,
+0xe87521f8, 0xaaaaaab8, 0x073abaaa, 0xf1620000,
+0x7c6f48fd, 0xfbc50424, 0xf262c892, 0x4c6649c5,
+0xf3620524, 0x643f48f5, 0xc5000224, 0x40c493fb,
+0x000000b8, 0xd0440f00, 0x89f4658d, 0x5f5e5bd0,
+0x0000c35d,
+0003242,
+};
+asm(".type avx512bw_x86_32_D_64u2, STT_NOTYPE;");
+asm(".type avx512bw_x86_32_D_64u2, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512bw_x86_32_D_16i1[] = {
+0x83e58955, 0x02e8f0e4, 0xc9000000, 0x01b255c3,
+0x08b9e589, 0x53000000, 0xec81c031, 0x000000a4,
+0x40045488, 0xd32811b3, 0x50045c88, 0xe383c389,
+0x01fb8301, 0xe380db19, 0x88cbfe02, 0x8d60045c,
+0xd8210158, 0x8301f883, 0xc2fe00d9, 0x6f1c4c88,
+0x7410fb83, 0xebd88904, 0x7ff162c7, 0x246c6f08,
+0x7ff16204, 0x246c7f08, 0x7ff16201, 0x245c6f08,
+0x65f36201, 0x00c53f08, 0xd093f8c5, 0xfffffa81,
+0x39b80000, 0x0f000005, 0x00051785, 0x65f16200,
+0x244cfc08, 0x7ff16204, 0x244c7f08, 0x7ff16202,
+0x24746f08, 0x4df16204, 0x62d6fc08, 0x6f087ff1,
+0x6202244c, 0x3f0875f3, 0xf8c500d2, 0xfa81d293,
+0x0000ffff, 0x00053fb8, 0xd5850f00, 0x62000004,
+0xf80875f1, 0x6204244c, 0x7f087ff1, 0x6203244c,
+0x3f0865f3, 0x0003245c, 0xd393f8c5, 0xfffffa81,
+0x44b80000, 0x0f000005, 0x0004a785, 0x7ff16200,
+0x246c6f08, 0x7ff16204, 0x24646f08, 0x7df26206,
+0x62d53028, 0x30287df2, 0x6df162f4, 0x62d6d528,
+0x6f087ff1, 0x6207247c, 0x30287ef2, 0x75f162d2,
+0xc5c9ef08, 0x62c964c1, 0xdb0875f1, 0x7df262ca,
+0x62c93028, 0x30287df2, 0x6207245c, 0x1228f5f2,
+0x7ef262db, 0x241c3028, 0xf16201b0, 0x7c6f087f,
+0xf2620724, 0xd87a087d, 0x0845f162, 0xf162fbf8,
+0x7c7f087f, 0xf2620724, 0x7c30287d, 0xf2620724,
+0xcf1228f5, 0x087ff162, 0x62243c6f, 0x30287ef2,
+0x75f162c9, 0xb8c9fc08, 0x00000621, 0x0845f362,
+0xc500e13f, 0x81d493f8, 0x00fffffa, 0xf1850f00,
+0x62000003, 0x6f087ff1, 0x6205247c, 0x30287df2,
+0x75f162cf, 0x62ced528, 0x7f087ff1, 0x62012454,
+0x30287ef2, 0x6202244c, 0x3c086df2, 0x6202244c,
+0x38086df2, 0x62022454, 0x7f087ff1, 0x62022454,
+0xfc0875f1, 0x6202244c, 0xfc0855f1, 0x063db8d7,
+0xf2620000, 0xc930287d, 0x2875f162, 0xf262ced5,
+0xc930287e, 0x0875f362, 0xc500ea3f, 0x81d593f8,
+0x00fffffa, 0x79850f00, 0x62000003, 0x1c087df2,
+0x6201244c, 0x3f0875f3, 0xf8c500f5, 0xfa81d693,
+0x0000ffff, 0x000644b8, 0x55850f00, 0x62000003,
+0xf80845f1, 0x7ff162db, 0x244c6f08, 0x064eb804,
+0xf2620000, 0xdb000875, 0x0865f362, 0xc500ff3f,
+0x81d793f8, 0x00fffffa, 0x25850f00, 0xc6000003,
+0x00902484, 0x62110000, 0xfc0845f1, 0x065db8c9,
+0xf2620000, 0x9478087d, 0x00009024, 0x6df36200,
+0x00c13f08, 0xd093f8c5, 0xfffffa81, 0x850f0000,
+0x000002f0, 0x000011b8, 0x7df26200, 0x62d07a08,
+0x3f086df3, 0xf8c500d1, 0xfa81d293, 0x0000ffff,
+0x000661b8, 0xc9850f00, 0x62000002, 0x600845f1,
+0x6204244c, 0x680845f1, 0xc604247c, 0x00902484,
+0x62080000, 0xf80875f1, 0x06a6b8cf, 0xf2620000,
+0xc930287d, 0x2875f162, 0xf262ced5, 0x9c78087d,
+0x00009024, 0x7ef26200, 0x62c93028, 0x3f0875f3,
+0xf8c500db, 0xfa81d393, 0x0000ffff, 0x0272850f,
+0xf1620000, 0x5c6f087f, 0xf2620424, 0xcb30287d,
+0x284df162, 0xf262d1d5, 0xd230287e, 0x0875f162,
+0xf162c9ef, 0x547f087f, 0xf1c50124, 0xf162e464,
+0xd460086d, 0x087ff162, 0x01246c6f, 0x087df262,
+0xf362e520, 0xe23f085d, 0x93f8c500, 0xfffa81d4,
+0xb80000ff, 0x000006b3, 0x0216850f, 0xf1c50000,
+0x60244c64, 0x0875f162, 0xf162c960, 0xe160085d,
+0x087ff162, 0x0124746f, 0x087df262, 0xf362d621,
+0xec3f086d, 0x93f8c500, 0xfffa81d5, 0xb80000ff,
+0x000006bb, 0x01da850f, 0xf1620000, 0xc9600875,
+0x086df162, 0xf162c960, 0x4c7f087f, 0xf1620224,
+0x6c6f087f, 0xf2620124, 0xd522087d, 0x087ff162,
+0x0324547f, 0x086df362, 0xc500f13f, 0x81d693f8,
+0x00fffffa, 0x06c4b800, 0x850f0000, 0x00000194,
+0x087ff162, 0x08245c7f, 0x087ff162, 0x0824746f,
+0x087df262, 0xf162ce20, 0x4c7f087f, 0xf1620124,
+0x6c6f087f, 0xf2620124, 0xe930087e, 0x087ff162,
+0x09244c7f, 0x4c8ac031, 0x8c384004, 0x00009004,
+0xb80a7400, 0x000006f1, 0x000147e9, 0xf8834000,
+0x62e37508, 0x7f087ff1, 0x6208245c, 0x6f087ff1,
+0x62082474, 0x21087df2, 0x7ff162ce, 0x244c7f08,
+0x7ff16201, 0x246c6f08, 0x7ef26201, 0x62e93108,
+0x7f087ff1, 0x3109244c, 0x044c8ac0, 0x048c3840,
+0x00000090, 0x00b80a74, 0xe9000007, 0x000000f4,
+0x04f88340, 0xf162e375, 0x5c7f087f, 0xf1620824,
+0x746f087f, 0xf2620824, 0xce22087d, 0x087ff162,
+0x01244c7f, 0x087ff162, 0x0124646f, 0x087ef262,
+0xf162e132, 0x4c7f087f, 0x448a0924, 0x84384024,
+0x00009024, 0x8a1c7500, 0x38412444, 0x00912484,
+0x0f750000, 0x000001b8, 0x7ff16200, 0x245c7f08,
+0xb80aeb02, 0x0000070f, 0x000087e9, 0x04548a00,
+0x04548850, 0x02c08320, 0x7511f883, 0xaaaab8f0,
+0xf162ffff, 0x4c6f087f, 0xf8c50424, 0xf262c892,
+0x54660975, 0xf3620524, 0x7c3f086d, 0xc5000224,
+0x81d793f8, 0x00fffffa, 0x073ab800, 0x44750000,
+0xf4c50fb0, 0xf362c946, 0xd90f8975, 0x7df26201,
+0xb0d07a08, 0x75f16201, 0x62cadb08, 0x7a087df2,
+0x75f162d0, 0xbacafc08, 0x00000000, 0x0865f362,
+0xc500c13f, 0x3dc093f8, 0x0000ffff, 0x00074ab8,
+0xc2440f00, 0x00a4c481, 0x5d5b0000, 0x000000c3,
+0002655,
+};
+asm(".type avx512bw_x86_32_D_16i1, STT_NOTYPE;");
+asm(".type avx512bw_x86_32_D_16i1, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512bw_x86_32_D_16u1[] = {
+0x83e58955, 0x02e8f0e4, 0xc9000000, 0x01b255c3,
+0x08b9e589, 0x53000000, 0xec81c031, 0x00000094,
+0x30045488, 0xd32811b3, 0x40045c88, 0xe383c389,
+0x88cbfe01, 0x8950045c, 0xc32140c3, 0x8301fb83,
+0xc2fe00d9, 0x5f044c88, 0x7510f883, 0x7ff162d3,
+0x24746f08, 0x7ff16203, 0x24347f08, 0x087ff162,
+0x6224146f, 0x3f086df3, 0xf8c500c6, 0xfa81d093,
+0x0000ffff, 0x000539b8, 0xa5850f00, 0x62000004,
+0xfc086df1, 0x6203244c, 0x7f087ff1, 0x6201244c,
+0x6f087ff1, 0x6203247c, 0xfc0845f1, 0x7ff162df,
+0x244c6f08, 0x75f36201, 0x00d33f08, 0xd293f8c5,
+0xfffffa81, 0x3fb80000, 0x0f000005, 0x00046385,
+0x75f16200, 0x244cf808, 0x7ff16203, 0x244c7f08,
+0x7ff16202, 0x245c6f08, 0x6df36202, 0x00db3f08,
+0xd393f8c5, 0xfffffa81, 0x44b80000, 0x0f000005,
+0x00042f85, 0x6df16200, 0x2454eb08, 0x7ff16204,
+0x24147f08, 0x0875f162, 0x04244cdb, 0x0865f162,
+0x04245cef, 0x0875f162, 0x62240cdf, 0x3f0875f3,
+0xf8c500e3, 0xfa81d493, 0x0000ffff, 0x000550b8,
+0xed850f00, 0x62000003, 0x6f087ff1, 0xc503245c,
+0x62c976f1, 0x6f087ff1, 0x5df162d3, 0xc5e4ef08,
+0x246474d9, 0x75f36260, 0x40d42508, 0x287df262,
+0xf262d230, 0x6430287d, 0xf2620624, 0xe41228ed,
+0x287ef262, 0xf162e430, 0x6cfc0875, 0xf1620624,
+0x6c7f087f, 0xf2620624, 0x6c30287d, 0xf2620624,
+0xd51228ed, 0x000621b8, 0x7ef26200, 0x62d23028,
+0xfc086df1, 0x5df362d2, 0x00ea3f08, 0xd593f8c5,
+0xfffffa81, 0x850f0000, 0x00000368, 0x0865f162,
+0x042454da, 0x0865f162, 0x042464de, 0x0865f162,
+0x04245cfc, 0x086df162, 0x34b8d4fc, 0x62000006,
+0x3f086df3, 0xf8c500f3, 0xfa81d693, 0x0000ffff,
+0x032e850f, 0xf1620000, 0x546f087f, 0xf1620424,
+0xe1fc086d, 0x087ff162, 0x03245c6f, 0x0865f262,
+0xf362e400, 0xfa3f085d, 0x93f8c500, 0xfffa81d7,
+0xb80000ff, 0x0000064e, 0x02f6850f, 0x84c60000,
+0x00008024, 0xf1621100, 0xdbfc086d, 0x00065db8,
+0x7df26200, 0x24a47808, 0x00000080, 0x085df362,
+0xc500c33f, 0x81d093f8, 0x00fffffa, 0xc1850f00,
+0xb8000002, 0x00000011, 0x087df262, 0xf362e07a,
+0xd33f085d, 0x93f8c500, 0xfffa81d2, 0xb80000ff,
+0x00000661, 0x029a850f, 0xf1620000, 0x5c60086d,
+0xf1620324, 0x5468086d, 0x84c60324, 0x00008024,
+0xf1620800, 0xcafc0875, 0x086df362, 0x05245425,
+0x75f16255, 0xb8cbf808, 0x000006a6, 0x0875f162,
+0x05244cef, 0x0875f162, 0xf262caf8, 0x9478087d,
+0x00008024, 0x75f36200, 0x00da3f08, 0xd393f8c5,
+0xfffffa81, 0x850f0000, 0x00000238, 0x087df262,
+0x06245c30, 0x087df262, 0xf162cb30, 0x5c7f087f,
+0xf1620124, 0x4c7f087f, 0xf1620224, 0x746f087f,
+0xf2620324, 0xd630087d, 0x086df362, 0xc500e33f,
+0x81d493f8, 0x00fffffa, 0x06d3b800, 0x850f0000,
+0x000001f0, 0x087ff162, 0x03247c6f, 0x087df262,
+0xf362d731, 0xe93f086d, 0x93f8c500, 0xfffa81d5,
+0xb80000ff, 0x000006da, 0x01c6850f, 0xf1620000,
+0x6c6f087f, 0xf2620324, 0xd532087d, 0x087df262,
+0xf362c930, 0xf13f086d, 0x93f8c500, 0xfffa81d6,
+0xb80000ff, 0x000006e1, 0x0196850f, 0xf1620000,
+0x4c6f087f, 0xf1620324, 0x4c7f087f, 0xf1620724,
+0x746f087f, 0xf2620724, 0xd630087d, 0x087ff162,
+0x6224147f, 0x6f087ff1, 0xf262243c, 0xfa30087e,
+0x087ff162, 0x0824547f, 0x4c8ac031, 0x8c383004,
+0x00008004, 0xb80a7400, 0x000006f1, 0x000143e9,
+0xf8834000, 0x62e37508, 0x7f087ff1, 0x6207244c,
+0x6f087ff1, 0x6207246c, 0x31087df2, 0x7ff162d5,
+0x24147f08, 0x087ff162, 0x6224346f, 0x31087ef2,
+0x7ff162f2, 0x24547f08, 0x8ac03108, 0x3830044c,
+0x0080048c, 0x0a740000, 0x000700b8, 0x00f2e900,
+0x83400000, 0xe37504f8, 0x087ff162, 0x07244c7f,
+0x087ff162, 0x07247c6f, 0x087df262, 0xf162d732,
+0x147f087f, 0x7ff16224, 0x242c6f08, 0x087ef262,
+0xf162ea32, 0x547f087f, 0x448a0824, 0x84383024,
+0x00008024, 0x8a1c7500, 0x38312444, 0x00812484,
+0x0f750000, 0x000001b8, 0x7ff16200, 0x244c7f08,
+0xb80aeb01, 0x0000070f, 0x000087e9, 0x04548a00,
+0x04548840, 0x02c08310, 0x7511f883, 0xaaaab8f0,
+0xf162ffff, 0x4c6f087f, 0xf8c50324, 0xf262c892,
+0x54660975, 0xf3620424, 0x7c3f086d, 0xc5000124,
+0x81d793f8, 0x00fffffa, 0x073ab800, 0x44750000,
+0xf4c50fb0, 0xf362c946, 0xd90f8975, 0x7df26201,
+0xb0d07a08, 0x75f16201, 0x62cadb08, 0x7a087df2,
+0x75f162d0, 0xbacafc08, 0x00000000, 0x0865f362,
+0xc500c13f, 0x3dc093f8, 0x0000ffff, 0x00074ab8,
+0xc2440f00, 0x0094c481, 0x5d5b0000, 0x000000c3,
+0002455,
+};
+asm(".type avx512bw_x86_32_D_16u1, STT_NOTYPE;");
+asm(".type avx512bw_x86_32_D_16u1, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512bw_x86_32_D_16i2[] = {
+0x83e58955, 0x02e8f0e4, 0xc9000000, 0xe58955c3,
+0x10be5657, 0x53000000, 0xec81db31, 0x000000bc,
+0xb9c3b70f, 0x00000008, 0x2901788d, 0x0fd889c1,
+0xe083ffbf, 0xc9bf0f01, 0x8d01f883, 0xd2190143,
+0x4a02e283, 0x0175d885, 0x7c89664e, 0xf8838645,
+0x4c896608, 0x89669645, 0x66a64554, 0xb6457489,
+0xc3890474, 0xf162baeb, 0xbd6f08ff, 0xffffff88,
+0x08fff162, 0xff58bd7f, 0xf162ffff, 0x8d6f08ff,
+0xffffff58, 0x08f5f362, 0xc500c73f, 0xfed093f8,
+0x0539b8c2, 0x850f0000, 0x00000667, 0x0875f162,
+0xff8895fd, 0xf162ffff, 0x957f08ff, 0xffffff68,
+0x0865f162, 0xff88b571, 0x6201ffff, 0x6f08fff1,
+0xffff6895, 0x053fb8ff, 0xf3620000, 0xd33f08ed,
+0x93f8c500, 0x0fc2fed2, 0x00062685, 0x6df16200,
+0x8895f908, 0x62ffffff, 0x7f08fff1, 0xffff7895,
+0xf5f362ff, 0x789d3f08, 0x00ffffff, 0xd393f8c5,
+0x44b8c2fe, 0x0f000005, 0x0005f685, 0xfff16200,
+0x98b56f08, 0x62ffffff, 0xd50875f1, 0xffff888d,
+0x4df162ff, 0x62ded508, 0x6f08fff1, 0xffff8895,
+0x6df162ff, 0x62eefd08, 0xf9086df1, 0xffff98a5,
+0x75f162ff, 0xb8cbf908, 0x0000055b, 0x085df162,
+0xf362e5d5, 0xe43f08f5, 0x93f8c500, 0x0fc2fed4,
+0x00059e85, 0x6df16200, 0x988dd508, 0x62ffffff,
+0x3f08f5f3, 0x1007102d, 0xf8c50000, 0xc2fed593,
+0x0005c8b8, 0x78850f00, 0x62000005, 0xe5086df1,
+0xffffa89d, 0xfff162ff, 0xa88d6f08, 0x62ffffff,
+0x71085df1, 0xcfb80fe1, 0x62000005, 0x3f08e5f3,
+0xf8c500f4, 0xc2fed693, 0x0545850f, 0xf1620000,
+0xdad50875, 0x08fff162, 0xff789d7f, 0xf162ffff,
+0xb5710865, 0xffffff78, 0xfff16203, 0x589d7f08,
+0x62ffffff, 0x71085df1, 0xffff78b5, 0xf16202ff,
+0xecfd085d, 0x0005edb8, 0xe5f36200, 0x00fd3f08,
+0xd793f8c5, 0x850fc2fe, 0x000004f7, 0x0865f162,
+0xff58a571, 0x6202ffff, 0xfd0865f1, 0x05f2b8db,
+0xf3620000, 0xc33f08dd, 0x93f8c500, 0x0fc2fed0,
+0x0004ce85, 0x5485c700, 0x03ffffff, 0x62000000,
+0xd5086df1, 0x54858be1, 0x89ffffff, 0xffff4085,
+0x1ff8c1ff, 0xff448589, 0xf162ffff, 0x7d7e08fe,
+0x5df162e8, 0xc7dff108, 0xffff5485, 0x000002ff,
+0x54858b00, 0x89ffffff, 0xffff4085, 0x1ff8c1ff,
+0xff448589, 0xf162ffff, 0x757e08fe, 0x5df162e8,
+0x62e6f108, 0xfd085df1, 0x0605b8ec, 0xf3620000,
+0xd53f08e5, 0x93f8c500, 0x0fc2fed2, 0x00045285,
+0x54858b00, 0x89ffffff, 0xffff4085, 0x1ff8c1ff,
+0xff448589, 0xf162ffff, 0x7d7e08fe, 0x65f162e8,
+0x62dfe108, 0xfd0865f1, 0x0609b8db, 0xf3620000,
+0xdb3f08dd, 0x93f8c500, 0x0fc2fed3, 0x00041285,
+0x65f16200, 0x62dbef08, 0x6f08fff1, 0xffffb8b5,
+0xcdf362ff, 0x06cb3f08, 0x896df162, 0xf262e1d5,
+0xad1208dd, 0xffffffb8, 0x000001b8, 0xfff16200,
+0xb8bd6f08, 0x62ffffff, 0x7b087df2, 0x45f162d8,
+0x62f3f908, 0x7f08fff1, 0xffffb8b5, 0xddf262ff,
+0xb8a51208, 0xb8ffffff, 0x00000621, 0x085df162,
+0xf362e4fd, 0xe43f08d5, 0x93f8c500, 0x0fc2fed4,
+0x00039e85, 0x75f16200, 0x98a5d508, 0x62ffffff,
+0xd50875f1, 0xfff162ea, 0x68a57f08, 0x62ffffff,
+0xee0855f1, 0xffff68a5, 0x55f162ff, 0x68adea08,
+0x62ffffff, 0x7f08fff1, 0xffff68ad, 0x5df162ff,
+0x68a5fd08, 0xb8ffffff, 0x0000063d, 0x086df162,
+0xff98adfd, 0xf162ffff, 0xe1d5085d, 0x08ddf362,
+0xc500ed3f, 0xfed593f8, 0x34850fc2, 0x62000003,
+0xd5086df1, 0xfff162e1, 0x58a57f08, 0x62ffffff,
+0x1d087df2, 0xffff58a5, 0xddf362ff, 0x00f23f08,
+0xd693f8c5, 0x44b8c2fe, 0x0f000006, 0x00030285,
+0x7ff16200, 0x88a57008, 0x1bffffff, 0x08fff162,
+0xff98956f, 0xf162ffff, 0xe470087e, 0x7df1621b,
+0x4ee47008, 0x08ddf362, 0xc500fa3f, 0xfed793f8,
+0x064eb8c2, 0x850f0000, 0x000002c7, 0x086df162,
+0xf162dbf9, 0xa56f08ff, 0xffffff88, 0x000653b8,
+0xe5f26200, 0x62dc8d08, 0x3f08e5f3, 0xf8c500c2,
+0xc2fed093, 0x0299850f, 0xc7660000, 0x0009d845,
+0x086df162, 0x5db8dcfd, 0x62000006, 0x79087df2,
+0xf362ec65, 0xd33f08dd, 0x93f8c500, 0x0fc2fed2,
+0x00026e85, 0x0009b800, 0xf2620000, 0xe07b087d,
+0x08ddf362, 0xc500db3f, 0xfed393f8, 0x0661b8c2,
+0x850f0000, 0x0000024b, 0x086df162, 0xff889d61,
+0xf162ffff, 0x9569086d, 0xffffff88, 0xd845c766,
+0xf1620004, 0xd2f90865, 0x0006a6b8, 0x6df16200,
+0x62d1d508, 0x79087df2, 0xf362ec5d, 0xe33f08ed,
+0x93f8c500, 0x0fc2fed4, 0x00020685, 0x75f16200,
+0x8895d508, 0x62ffffff, 0x710875f1, 0xf1620fe1,
+0x957f08ff, 0xffffff58, 0x086df162, 0xf162d961,
+0xb56f08ff, 0xffffff58, 0x087df262, 0xf362d623,
+0xeb3f08ed, 0x93f8c500, 0xb8c2fed5, 0x000006b3,
+0x01bd850f, 0xf1620000, 0xc9610875, 0x086df162,
+0xf162c961, 0x8d7f08ff, 0xffffff68, 0x08fff162,
+0xff58bd6f, 0xf262ffff, 0xd724087d, 0x08fff162,
+0xff78957f, 0xf362ffff, 0xf13f08ed, 0x93f8c500,
+0xb8c2fed6, 0x000006bb, 0x0175850f, 0xf1620000,
+0x8d6f08ff, 0xffffff88, 0x08fff162, 0xffc88d7f,
+0xf162ffff, 0xb56f08ff, 0xffffffc8, 0x087df262,
+0xf162d623, 0x957f08ff, 0xffffff58, 0x08fff162,
+0xff58bd6f, 0xf262ffff, 0xfa33087e, 0x08fff162,
+0xffd8957f, 0xc031ffff, 0x45748b66, 0x743966d8,
+0x0a748845, 0x0006f1b8, 0x0115e900, 0x83400000,
+0xe47504f8, 0x08fff162, 0xffc88d7f, 0xf162ffff,
+0xb56f08ff, 0xffffffc8, 0x087df262, 0xf162d624,
+0x957f08ff, 0xffffff58, 0x08fff162, 0xff58bd6f,
+0xf262ffff, 0xfa34087e, 0x08fff162, 0xffd8957f,
+0x458bffff, 0x453966d8, 0xbf850f88, 0x66000000,
+0x66da458b, 0x0f8a4539, 0x0000b185, 0x458b6600,
+0xfff1629a, 0x688d7f08, 0x66ffffff, 0xff6a8589,
+0x8b66ffff, 0x89669e45, 0xffff6e85, 0x458b66ff,
+0x858966a2, 0xffffff72, 0xa6458b66, 0x76858966,
+0xb0ffffff, 0xfff162aa, 0x888d6f08, 0xc5ffffff,
+0x62c892f8, 0x6609f5f2, 0xffff9895, 0xedf362ff,
+0x68bd3f08, 0x00ffffff, 0xd793f8c5, 0x3ab8c2fe,
+0x75000007, 0x0007b84e, 0xf4c50000, 0xf362c946,
+0xd90f8975, 0x7df26202, 0xb8d07b08, 0x00000001,
+0x0875f162, 0xf262cadb, 0xd07b087d, 0x0875f162,
+0x00bacafd, 0x62000000, 0x3f08e5f3, 0xf8c500c1,
+0xc0fec093, 0x00074ab8, 0xc2440f00, 0x00b805eb,
+0x81000007, 0x0000bcc4, 0x5f5e5b00, 0x0000c35d,
+0x000e0008, 0x00140012, 0x00120014, 0x0008000e,
+0003440,
+};
+asm(".type avx512bw_x86_32_D_16i2, STT_NOTYPE;");
+asm(".type avx512bw_x86_32_D_16i2, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512bw_x86_32_D_16u2[] = {
+0x83e58955, 0x02e8f0e4, 0xc9000000, 0xc03155c3,
+0x5657e589, 0x0010bb53, 0xec810000, 0x000000ac,
+0xb9d0b70f, 0x00000008, 0xc789d129, 0x8901728d,
+0x01e283c2, 0xf8854a40, 0x0ff6b70f, 0xb70fc9b7,
+0x4b0175d2, 0x45748966, 0x08f88386, 0x454c8966,
+0x54896696, 0x8966a645, 0x75b6455c, 0xfff162c3,
+0x88bd6f08, 0x62ffffff, 0x7f08fff1, 0xffff58bd,
+0xfff162ff, 0x58956f08, 0x62ffffff, 0x3f08edf3,
+0xf8c500c7, 0xc2fed093, 0x000539b8, 0xa4850f00,
+0x62000005, 0xfd086df1, 0xffff888d, 0xfff162ff,
+0x688d7f08, 0x62ffffff, 0x710865f1, 0xffff88b5,
+0xf16201ff, 0x8d6f08ff, 0xffffff68, 0x00053fb8,
+0xf5f36200, 0x00d33f08, 0xd293f8c5, 0x850fc2fe,
+0x00000563, 0x0875f162, 0xff888df9, 0xf162ffff,
+0x8d7f08ff, 0xffffff78, 0x08fff162, 0xff789d6f,
+0xf362ffff, 0xdb3f08ed, 0x93f8c500, 0xb8c2fed3,
+0x00000544, 0x052d850f, 0xf1620000, 0x95eb086d,
+0xffffff98, 0x08fff162, 0xff58957f, 0xf162ffff,
+0x8ddb0875, 0xffffff98, 0x0865f162, 0xff989def,
+0xf162ffff, 0x8ddf0875, 0xffffff58, 0x08f5f362,
+0xc500e33f, 0xfed493f8, 0x0550b8c2, 0x850f0000,
+0x000004e3, 0x08fff162, 0xff88956f, 0xf162ffff,
+0x8dd5086d, 0xffffff98, 0x08f5f362, 0x06502d3f,
+0xc5000010, 0xfed593f8, 0x05c8b8c2, 0x850f0000,
+0x000004b3, 0x086df162, 0xffa8a5e4, 0xf162ffff,
+0x9d6f08ff, 0xffffffa8, 0x086df162, 0xf162cbdb,
+0xcbfd0875, 0x08ddf362, 0xc500f13f, 0xfed693f8,
+0x05d1b8c2, 0x850f0000, 0x0000047b, 0x08fff162,
+0xff78957f, 0xf162ffff, 0xb5710875, 0xffffff78,
+0xfff16203, 0x588d7f08, 0x62ffffff, 0x71085df1,
+0xffff78b5, 0xf16202ff, 0xecfd085d, 0x0005edb8,
+0xf5f36200, 0x00fd3f08, 0xd793f8c5, 0x850fc2fe,
+0x00000433, 0x0875f162, 0xff589571, 0x6202ffff,
+0xfd0875f1, 0x05f2b8c9, 0xf3620000, 0xc13f08dd,
+0x93f8c500, 0x0fc2fed0, 0x00040a85, 0x5485c700,
+0x03ffffff, 0x62000000, 0x6e087df1, 0xf162d54d,
+0xc9f1086d, 0xff5485c7, 0x0002ffff, 0xf1620000,
+0x656e087d, 0x6df162d5, 0x62e4f108, 0xfd085df1,
+0x0605b8ec, 0xf3620000, 0xd53f08f5, 0x93f8c500,
+0x0fc2fed2, 0x0003be85, 0x7df16200, 0xd56d6e08,
+0x0875f162, 0xf162cdd1, 0xc9fd0875, 0x000609b8,
+0xddf36200, 0x00d93f08, 0xd393f8c5, 0x850fc2fe,
+0x00000393, 0xc976f1c5, 0x08fff162, 0xf162e26f,
+0xedef0855, 0x6d75d1c5, 0x75f362b8, 0x40e52508,
+0x08ddf262, 0xffb8ad12, 0xf162ffff, 0xb5fd0875,
+0xffffffb8, 0x08fff162, 0xffb8b57f, 0xf262ffff,
+0xa51208dd, 0xffffffb8, 0x000621b8, 0x5df16200,
+0x62e4fd08, 0x3f08d5f3, 0xf8c500e4, 0xc2fed493,
+0x0331850f, 0xf2620000, 0xa53a086d, 0xffffff98,
+0x086df262, 0xff98ad3e, 0xf162ffff, 0x95fd086d,
+0xffffff98, 0x085df162, 0x34b8e5fd, 0x62000006,
+0x3f08ddf3, 0xf8c500ea, 0xc2fed593, 0x02f5850f,
+0xf1620000, 0xa570087f, 0xffffff88, 0xfff1621b,
+0x98956f08, 0x62ffffff, 0x70087ef1, 0xf1621be4,
+0xe470087d, 0xddf3624e, 0x00f23f08, 0xd693f8c5,
+0x4eb8c2fe, 0x0f000006, 0x0002ba85, 0x6df16200,
+0x62e9fd08, 0x6f08fff1, 0xffff88a5, 0x0653b8ff,
+0xf2620000, 0xec8d08d5, 0x08d5f362, 0xc500fa3f,
+0xfed793f8, 0x8c850fc2, 0x66000002, 0x09d845c7,
+0x6df16200, 0xb8e4fd08, 0x0000065d, 0x087df262,
+0x62ec6d79, 0x3f08d5f3, 0xf8c500c4, 0xc2fed093,
+0x0261850f, 0x09b80000, 0x62000000, 0x7b087df2,
+0xd5f362e8, 0x00cc3f08, 0xd193f8c5, 0x61b8c2fe,
+0x0f000006, 0x00023e85, 0x6df16200, 0x88a56108,
+0x62ffffff, 0x69086df1, 0xffff8895, 0x45c766ff,
+0x620004d8, 0xfd0875f1, 0x06a6b8ca, 0xf1620000,
+0xccf90875, 0x0875f162, 0xf362cbef, 0xdb250865,
+0x75f16255, 0x62cbf908, 0x79087df2, 0xf362ec55,
+0xd23f08f5, 0x93f8c500, 0x0fc2fed2, 0x0001e685,
+0x7df26200, 0xf1553308, 0x087df262, 0xf162da33,
+0x957f08ff, 0xffffff68, 0x08fff162, 0xff789d7f,
+0xf162ffff, 0xb56f08ff, 0xffffff88, 0x087df262,
+0xf362ce33, 0xda3f08f5, 0x93f8c500, 0xb8c2fed3,
+0x000006d3, 0x019d850f, 0xf1620000, 0xbd6f08ff,
+0xffffff88, 0x087df262, 0xf362cf34, 0xe33f08f5,
+0x93f8c500, 0xb8c2fed4, 0x000006da, 0x0175850f,
+0xf1620000, 0x8d6f08ff, 0xffffff88, 0x08fff162,
+0xffc88d7f, 0xf162ffff, 0xb56f08ff, 0xffffffc8,
+0x087df262, 0xf162d633, 0x957f08ff, 0xffffff58,
+0x08fff162, 0xff58bd6f, 0xf262ffff, 0xfa33087e,
+0x08fff162, 0xffd8957f, 0xc031ffff, 0x457c8b66,
+0x7c3966d8, 0x0a748845, 0x0006f1b8, 0x0115e900,
+0x83400000, 0xe47504f8, 0x08fff162, 0xffc88d7f,
+0xf162ffff, 0xb56f08ff, 0xffffffc8, 0x087df262,
+0xf162d634, 0x957f08ff, 0xffffff58, 0x08fff162,
+0xff58bd6f, 0xf262ffff, 0xfa34087e, 0x08fff162,
+0xffd8957f, 0x458bffff, 0x453966d8, 0xbf850f88,
+0x66000000, 0x66da458b, 0x0f8a4539, 0x0000b185,
+0x458b6600, 0xfff1629a, 0x688d7f08, 0x66ffffff,
+0xff6a8589, 0x8b66ffff, 0x89669e45, 0xffff6e85,
+0x458b66ff, 0x858966a2, 0xffffff72, 0xa6458b66,
+0x76858966, 0xb0ffffff, 0xfff162aa, 0x888d6f08,
+0xc5ffffff, 0x62c892f8, 0x6609f5f2, 0xffff9895,
+0xedf362ff, 0x68ad3f08, 0x00ffffff, 0xd593f8c5,
+0x3ab8c2fe, 0x75000007, 0x0007b84e, 0xf4c50000,
+0xf362c946, 0xd90f8975, 0x7df26202, 0xb8d07b08,
+0x00000001, 0x0875f162, 0xf262cadb, 0xd07b087d,
+0x0875f162, 0x00bacafd, 0x62000000, 0x3f08e5f3,
+0xf8c500f1, 0xc0fec693, 0x00074ab8, 0xc2440f00,
+0x00b805eb, 0x81000007, 0x0000acc4, 0x5f5e5b00,
+0x0000c35d, 0x00000000, 0x00000000, 0x00000000,
+0x000e0008, 0x00140012, 0x00120014, 0x0008000e,
+0003140,
+};
+asm(".type avx512bw_x86_32_D_16u2, STT_NOTYPE;");
+asm(".type avx512bw_x86_32_D_16u2, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512bw_x86_32_D_32i1[] = {
+0xb25500eb, 0xb9e58901, 0x00000008, 0x83c03153,
+0xec81e0e4, 0x00000120, 0x80049488, 0xb3000000,
+0x88d32821, 0x00a0049c, 0xc3890000, 0x8301e383,
+0xdb1901fb, 0xfe02e380, 0x049c88cb, 0x000000c0,
+0x2101588d, 0x01f883d8, 0xfe00d983, 0x1c8c88c2,
+0x000000df, 0x7420fb83, 0xebd88904, 0x7ff162bb,
+0x247c6f28, 0x7ff16204, 0x247c7f28, 0x7ff16201,
+0x245c6f28, 0x65f36201, 0x00c73f28, 0xd093fbc5,
+0x0539b842, 0x850f0000, 0x0000038e, 0x2865f162,
+0x04244cfc, 0x287ff162, 0x02244c7f, 0x287ff162,
+0x04247c6f, 0x2845f162, 0xf162d7fc, 0x4c6f287f,
+0xf3620224, 0xd23f2875, 0x93fbc500, 0x3fb842d2,
+0x0f000005, 0x00035185, 0x75f16200, 0x244cf828,
+0x7ff16204, 0x244c7f28, 0x65f36203, 0x245c3f28,
+0xfbc50003, 0xb842d393, 0x00000544, 0x0328850f,
+0xf1620000, 0x546f287f, 0xf2620424, 0x5c30487d,
+0xf2620624, 0xe230487d, 0x485df162, 0xf162e3d5,
+0x7c6f287f, 0xf1620724, 0xc9ef0875, 0x487ef262,
+0xc5c5e430, 0xf162c964, 0xccdb2875, 0x487df262,
+0xf262c930, 0x6c30487d, 0xf2620724, 0xed1248f5,
+0x487ef262, 0x01b0ed30, 0x287ff162, 0x07247c6f,
+0x287df262, 0xf162f07a, 0xf6f82845, 0x287ff162,
+0x0724747f, 0x487df262, 0x07247430, 0x48f5f262,
+0x21b8ce12, 0x62000006, 0x30487ef2, 0x75f162c9,
+0x62c9fc28, 0x3f2855f3, 0xfbc500e1, 0x0f42d493,
+0x00028585, 0x7df26200, 0x244c3048, 0x75f16205,
+0x62cbd548, 0x7f287ff1, 0x62012464, 0x30487ef2,
+0x6202244c, 0x3c285df2, 0x6202244c, 0x7f287ff1,
+0x6203244c, 0x38285df2, 0x62022464, 0x7f287ff1,
+0x62022464, 0xfc2875f1, 0xb802244c, 0x0000063d,
+0x487df262, 0xf162c930, 0xcbd54875, 0x286df162,
+0x05245cfc, 0x487ef262, 0xf362c930, 0xeb3f2875,
+0x93fbc500, 0x850f42d5, 0x0000020e, 0x287df262,
+0x01244c1c, 0x2875f362, 0xc500f23f, 0x42d693fb,
+0x000644b8, 0xef850f00, 0xc6000001, 0x01002484,
+0xb8210000, 0x0000065d, 0x287df262, 0x00248c78,
+0x62000001, 0x3f2875f3, 0xfbc500fb, 0x0f42d793,
+0x0001c585, 0x0021b800, 0xf2620000, 0xc87a287d,
+0x2875f362, 0xc500c33f, 0x42d093fb, 0x000661b8,
+0xa3850f00, 0x31000001, 0x7ff162c0, 0x24547f28,
+0x04948a08, 0x00000100, 0x04548840, 0x10f8830f,
+0xf262ef75, 0x4c20287d, 0xf1620124, 0x4c7f287f,
+0xf1620124, 0x6c6f287f, 0xf2620124, 0x6c30287e,
+0xc0311024, 0x80048c8a, 0x38000000, 0x0100048c,
+0x0a740000, 0x0006f1b8, 0x014ce900, 0x83400000,
+0xe07510f8, 0xf162c031, 0x547f287f, 0x948a0824,
+0x00010004, 0x04548800, 0xf8834010, 0x62ef7508,
+0x6f087ff1, 0x62012474, 0x21287df2, 0x7ff162ce,
+0x244c7f28, 0x7ff16201, 0x246c6f28, 0x7ef26201,
+0x62e93128, 0x7f087ff1, 0x3110244c, 0x048c8ac0,
+0x00000080, 0x00048c38, 0x74000001, 0x0700b80a,
+0xe3e90000, 0x40000000, 0x7508f883, 0x75f162e0,
+0x62c9ef08, 0x200875f3, 0x0080248c, 0x62000000,
+0x200875f3, 0x0081248c, 0x62010000, 0x200875f3,
+0x0082248c, 0x62020000, 0x200875f3, 0x0083248c,
+0x62030000, 0x7f087ff1, 0x6201244c, 0x6f087ff1,
+0x62012474, 0x22287df2, 0x7ff162ce, 0x244c7f28,
+0x7ff16201, 0x247c6f28, 0x7ef26201, 0x62f93228,
+0x7f087ff1, 0x3110244c, 0x048c8ac0, 0x00000080,
+0x00048c38, 0x74000001, 0x070fb807, 0x5aeb0000,
+0x04f88340, 0x01b8e375, 0x62000000, 0x7f287ff1,
+0x8a022454, 0x00a00494, 0x54880000, 0xc0834004,
+0x21f88302, 0xaab8ed75, 0xbaaaaaaa, 0x00000000,
+0x287ff162, 0x0424546f, 0xc892fbc5, 0x296df262,
+0x05244c66, 0x2875f362, 0x02244c3f, 0x93fbc500,
+0x3ab840c1, 0x0f000007, 0x5d8bc244, 0x00c3c9fc,
+0002037,
+};
+asm(".type avx512bw_x86_32_D_32i1, STT_NOTYPE;");
+asm(".type avx512bw_x86_32_D_32i1, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512bw_x86_32_D_32u1[] = {
+0xb25500eb, 0xb9e58901, 0x00000008, 0x83c03153,
+0xec81e0e4, 0x00000100, 0x80049488, 0xb3000000,
+0x88d32821, 0x00a0049c, 0xc3890000, 0x83c32140,
+0xd98301fb, 0x88c2fe00, 0x00bf048c, 0xf8830000,
+0x62d57520, 0x6f287ff1, 0x6204246c, 0x7f287ff1,
+0x6201246c, 0x6f287ff1, 0x62012454, 0x3f286df3,
+0xfbc500c5, 0xb842d093, 0x00000539, 0x036a850f,
+0xf1620000, 0x4cfc286d, 0xf1620424, 0x4c7f287f,
+0xf1620224, 0x746f287f, 0xf1620424, 0xdefc284d,
+0x287ff162, 0x02244c6f, 0x2875f362, 0xc500d33f,
+0x42d293fb, 0x00053fb8, 0x2d850f00, 0x62000003,
+0xf82875f1, 0x6204244c, 0x7f287ff1, 0x6203244c,
+0x6f287ff1, 0x6203245c, 0x3f286df3, 0xfbc500db,
+0xb842d393, 0x00000544, 0x02fe850f, 0xf1620000,
+0x54eb286d, 0xf1620524, 0x547f287f, 0xf1620124,
+0x4cdb2875, 0xf1620524, 0x5cef2865, 0xf1620524,
+0x4cdf2875, 0xf3620124, 0xe33f2875, 0x93fbc500,
+0x50b842d4, 0x0f000005, 0x0002bf85, 0x7ff16200,
+0x24546f28, 0x76e5c504, 0x7ff162db, 0x62ca6f28,
+0xef085df1, 0x74ddc5e4, 0x00c024a4, 0xf3620000,
+0xcc252865, 0x7ff16240, 0x244c7f28, 0x7df26203,
+0x62c93048, 0x30487df2, 0x62062464, 0x1248f5f2,
+0x7ef262e4, 0x62e43048, 0xfc2865f1, 0x6206245c,
+0x7f287ff1, 0x6206245c, 0x30487df2, 0x6206245c,
+0x1248f5f2, 0x0621b8cb, 0xf2620000, 0xc930487e,
+0x2875f162, 0xf362c9fc, 0xe93f285d, 0x93fbc500,
+0x850f42d5, 0x00000234, 0x286df162, 0x05244cda,
+0x287ff162, 0x01244c7f, 0x286df162, 0x052464de,
+0x287ff162, 0x0224647f, 0x286df162, 0x05245cfc,
+0x2875f162, 0x34b8ccfc, 0x62000006, 0x3f2875f3,
+0xfbc500f3, 0x0f42d693, 0x0001ef85, 0x2484c600,
+0x000000e0, 0x065db821, 0xf2620000, 0x8c78287d,
+0x0000e024, 0x75f36200, 0x00fb3f28, 0xd793fbc5,
+0xc5850f42, 0xb8000001, 0x00000021, 0x287df262,
+0xf362c87a, 0xc33f2875, 0x93fbc500, 0x61b842d0,
+0x0f000006, 0x0001a385, 0x62c03100, 0x7f287ff1,
+0x8a072454, 0x00e00494, 0x88400000, 0x830f0454,
+0xef7510f8, 0x287df262, 0x01244c30, 0x287ff162,
+0x01244c7f, 0x287ff162, 0x01247c6f, 0x287ef262,
+0x0e247c30, 0x8c8ac031, 0x00008004, 0x048c3800,
+0x000000e0, 0xf1b80a74, 0xe9000006, 0x0000014c,
+0x10f88340, 0xc031e075, 0x287ff162, 0x0724547f,
+0xe004948a, 0x88000000, 0x40100454, 0x7508f883,
+0x7ff162ef, 0x246c6f08, 0x7df26201, 0x62cd3128,
+0x7f287ff1, 0x6201244c, 0x6f287ff1, 0x62012474,
+0x31287ef2, 0x7ff162f1, 0x244c7f08, 0x8ac0310e,
+0x0080048c, 0x8c380000, 0x0000e004, 0xb80a7400,
+0x00000700, 0x0000e3e9, 0xf8834000, 0x62e07508,
+0xef0875f1, 0x75f362c9, 0x248c2008, 0x00000080,
+0x75f36200, 0x248c2008, 0x00000081, 0x75f36201,
+0x248c2008, 0x00000082, 0x75f36202, 0x248c2008,
+0x00000083, 0x7ff16203, 0x244c7f08, 0x7ff16201,
+0x247c6f08, 0x7df26201, 0x62cf3228, 0x7f287ff1,
+0x6201244c, 0x6f287ff1, 0x6201246c, 0x32287ef2,
+0x7ff162e9, 0x244c7f08, 0x8ac0310e, 0x0080048c,
+0x8c380000, 0x0000e004, 0xb8077400, 0x0000070f,
+0x83405aeb, 0xe37504f8, 0x000001b8, 0x7ff16200,
+0x24547f28, 0x04948a02, 0x000000a0, 0x40045488,
+0x8302c083, 0xed7521f8, 0xaaaaaab8, 0x0000baaa,
+0xf1620000, 0x746f287f, 0xfbc50424, 0xf262c892,
+0x4c66294d, 0xf3620524, 0x4c3f2875, 0xc5000224,
+0x40c193fb, 0x00073ab8, 0xc2440f00, 0xc9fc5d8b,
+0x000000c3,
+0001741,
+};
+asm(".type avx512bw_x86_32_D_32u1, STT_NOTYPE;");
+asm(".type avx512bw_x86_32_D_32u1, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512bw_x86_32_D_32i2[] = {
+0x315500eb, 0x57e589c9, 0x000010bf, 0x83535600,
+0xec81e0e4, 0x00000180, 0x2c2444c7, 0x00000010,
+0x182444c6, 0xd1b70f00, 0x9801428d, 0x10b8c389,
+0x29000000, 0x448998d0, 0xc8891424, 0x8301e083,
+0x418d01f8, 0x83f61901, 0x854e02e6, 0xc60675c8,
+0x01182444, 0x9c89664f, 0x00009e44, 0x01e28300,
+0x14245c8b, 0x44b48966, 0x000000de, 0x6604e2c1,
+0xfe44bc89, 0xd1000000, 0x66d109e9, 0xbe449c89,
+0x0f000000, 0x8966c9b7, 0x011e448c, 0xc1830000,
+0x10f88308, 0x448c8966, 0x0000013e, 0xc1890474,
+0x7c8083eb, 0x74001824, 0x247c8904, 0xfff1622c,
+0x247c6f28, 0xfff16205, 0x247c7f28, 0xfff16202,
+0x244c6f28, 0xf5f36202, 0x00c73f28, 0xc893f8c5,
+0xfffff981, 0x39ba0000, 0x0f000005, 0x0006ac85,
+0x75f16200, 0x2454fd28, 0xfff16205, 0x24547f28,
+0x65f16203, 0x24747128, 0xf1620105, 0x546f28ff,
+0x3fba0324, 0x62000005, 0x3f28edf3, 0xf8c500d3,
+0xf981ca93, 0x0000ffff, 0x066f850f, 0xf1620000,
+0x54f9286d, 0xf1620524, 0x547f28ff, 0xf3620424,
+0x5c3f28f5, 0xc5000424, 0x81cb93f8, 0x00fffff9,
+0x0544ba00, 0x850f0000, 0x00000641, 0x28fff162,
+0x06247c6f, 0x2875f162, 0x05244cd5, 0x2845f162,
+0xf162dfd5, 0x5c7f28ff, 0xf1620324, 0x546f28ff,
+0xf1620524, 0xeffd286d, 0x286df162, 0x062464f9,
+0x2875f162, 0x5bbacbf9, 0x62000005, 0xd5285df1,
+0xf5f362e5, 0x00e43f28, 0xcc93f8c5, 0xfffff981,
+0xf1620000, 0x647f28ff, 0x850f0424, 0x000005dd,
+0x286df162, 0x06244cd5, 0x28fff162, 0x02244c7f,
+0x2444c766, 0x8d001060, 0x6660245c, 0x7e2444c7,
+0xd9890010, 0x83138b66, 0xc38302e8, 0xc2016602,
+0x66d2bf0f, 0xf8831389, 0x54896602, 0xe4756e04,
+0x24548966, 0xfff16270, 0x247c6f28, 0x05c8ba02,
+0xf3620000, 0x6c3f28c5, 0xc5000324, 0x3dc593f8,
+0x0000ffff, 0x0573850f, 0xf1620000, 0x5ce5286d,
+0xf1620724, 0x4c6f28ff, 0xf1620724, 0xe171285d,
+0x05cfba0f, 0xf3620000, 0xf43f28e5, 0x93f8c500,
+0xffff3dc6, 0x850f0000, 0x00000541, 0x2875f162,
+0x052464d5, 0x28fff162, 0x0424647f, 0x2865f162,
+0x04247471, 0xfff16203, 0x245c7f28, 0x55f16202,
+0x24747128, 0xf1620204, 0xf5fd2855, 0x0005edba,
+0xe5f36200, 0x00fe3f28, 0xc793f8c5, 0x00ffff3d,
+0xf6850f00, 0x62000004, 0x712865f1, 0x02022464,
+0x2865f162, 0xf2badbfd, 0x62000005, 0x3f28d5f3,
+0xf8c500c3, 0xff3dc093, 0x0f0000ff, 0x0004cc85,
+0x2444c700, 0x0000032c, 0x6df16200, 0x8be9d528,
+0x892c2444, 0xc1182444, 0x44891ff8, 0xf1621c24,
+0x7c7e08fe, 0xf1620324, 0xdff12855, 0x2c2444c7,
+0x00000002, 0x2c24448b, 0x18244489, 0x891ff8c1,
+0x621c2444, 0x7e08fef1, 0x62032474, 0xf12855f1,
+0x55f162ee, 0xbaf5fd28, 0x00000605, 0x28e5f362,
+0xc500d63f, 0x3dc293f8, 0x0000ffff, 0x045b850f,
+0x448b0000, 0x44892c24, 0xf8c11824, 0x2444891f,
+0xfef1621c, 0x247c7e08, 0x65f16203, 0x62dfe128,
+0xfd2865f1, 0x0609badb, 0xf3620000, 0xdb3f28d5,
+0x93f8c500, 0xffff3dc3, 0x850f0000, 0x0000041d,
+0x0865f162, 0xf162dbef, 0x746f28ff, 0xf3620824,
+0xcb3f28cd, 0x6df16206, 0x62d9d5a9, 0x1228e5f2,
+0xb808246c, 0x00000001, 0x28fff162, 0x08247c6f,
+0x287df262, 0xf162f07b, 0xf6f92845, 0x28fff162,
+0x0824747f, 0x28e5f262, 0x08245c12, 0x000621ba,
+0x65f16200, 0x62dbfd28, 0x3f28d5f3, 0xf8c500e3,
+0xff3dc493, 0x0f0000ff, 0x0003b085, 0x75f16200,
+0x245cd528, 0xfff16206, 0x245c7f28, 0x5df16203,
+0x245cee28, 0x5df16203, 0x2464ea28, 0xfff16203,
+0x24647f28, 0x65f16203, 0x245cfd28, 0x063dba03,
+0xf1620000, 0x64fd286d, 0xf1620624, 0xd9d52865,
+0x28e5f362, 0xc500ec3f, 0x3dc593f8, 0x0000ffff,
+0x0357850f, 0xf1620000, 0xd9d5286d, 0x28fff162,
+0x02245c7f, 0x287df262, 0x02245c1d, 0x28e5f362,
+0xc500f23f, 0x3dc693f8, 0x0000ffff, 0x000644ba,
+0x26850f00, 0xb8000003, 0x00000001, 0x28fff162,
+0x06245c6f, 0x28fff162, 0x0524646f, 0x287df262,
+0xf162d07b, 0xd2f92865, 0x000653ba, 0xedf26200,
+0x62d48d28, 0x3f28edf3, 0xf8c500fb, 0xff3dc793,
+0x0f0000ff, 0x0002e485, 0x84c76600, 0x00016024,
+0x62001100, 0xfd2865f1, 0x065dbad4, 0xf2620000,
+0xa479287d, 0x00016024, 0xddf36200, 0x00c23f28,
+0xc093f8c5, 0x00ffff3d, 0xae850f00, 0xb8000002,
+0x00000011, 0x000661ba, 0x7df26200, 0x62e07b28,
+0x3f28ddf3, 0xf8c500ca, 0xff3dc193, 0x0f0000ff,
+0x00028885, 0xfff16200, 0x24646f28, 0xfff16209,
+0x62d36f28, 0x7d28ddf2, 0x62052454, 0x6f28fff1,
+0x620a2474, 0x7d28cdf2, 0x6605245c, 0x602484c7,
+0x08000001, 0x6df16200, 0xbad3f928, 0x000006a6,
+0x286df162, 0xf262d1d5, 0x9c79287d, 0x00016024,
+0xedf36200, 0x00d33f28, 0xc293f8c5, 0x00ffff3d,
+0xfff16200, 0x24547f28, 0x1e850f04, 0x62000002,
+0xd52875f1, 0x62052454, 0x712865f1, 0xf1620fe1,
+0x547f28ff, 0xf2620224, 0xd37d28dd, 0x28fff162,
+0x0324547f, 0xf162c031, 0x7c6f28ff, 0xf1620224,
+0x7c7f28ff, 0x8b660b24, 0x01604494, 0x89660000,
+0x40304454, 0x7508f883, 0x7df262ed, 0x24542328,
+0xedf36203, 0x245c3f28, 0xf8c50003, 0xff3dc393,
+0xba0000ff, 0x000006b3, 0x01af850f, 0xf1620000,
+0xe1712875, 0xddf2620f, 0x62c97d28, 0x7d28ddf2,
+0xfff162d1, 0x24547f28, 0x55f16203, 0x62edef08,
+0xc40855f1, 0x0020244c, 0x0875f162, 0x21244cc4,
+0x75f16201, 0x244cc408, 0xf1620222, 0x4cc40875,
+0x62032324, 0x24287df2, 0xfff162c9, 0x244c7f28,
+0xf5f36204, 0x00e23f28, 0xc493f8c5, 0x00ffff3d,
+0x06bbba00, 0x850f0000, 0x00000141, 0xf162c031,
+0x546f28ff, 0xf1620524, 0x547f28ff, 0x8b660b24,
+0x01604494, 0x89660000, 0x40304454, 0x7508f883,
+0x7df262ed, 0x244c2328, 0xfff16203, 0x244c7f28,
+0xfff16202, 0x24746f28, 0x7ef26202, 0x24743328,
+0x66c03116, 0x6044b48b, 0x66000001, 0xa044b439,
+0x74000000, 0x06f1ba0a, 0xdee90000, 0x40000000,
+0x7508f883, 0x45f162de, 0x62ffef08, 0xc40845f1,
+0x0050244c, 0x0875f162, 0x51244cc4, 0x75f16201,
+0x244cc408, 0xf1620252, 0x4cc40875, 0x62035324,
+0x7f08fff1, 0x6203244c, 0x6f08fff1, 0x6203246c,
+0x24287df2, 0xfff162cd, 0x244c7f28, 0xfff16202,
+0x24746f28, 0x7ef26202, 0x62f13428, 0x7f08fff1,
+0x3116244c, 0xbc8b66c0, 0x00016044, 0xbc396600,
+0x0000a044, 0xba077400, 0x00000700, 0x83405feb,
+0xe17504f8, 0x000001b8, 0xfff16200, 0x24547f28,
+0x948b6603, 0x0000c044, 0x14896600, 0x02c08341,
+0x7511f883, 0xaaaab8ec, 0x3abaffff, 0x62000007,
+0x6f28fff1, 0xc505247c, 0x62c892f8, 0x6629c5f2,
+0x6206244c, 0x3f28f5f3, 0x0003246c, 0xc593f8c5,
+0x00ffff3d, 0x0000b800, 0x440f0000, 0xf4658dd0,
+0x5e5bd089, 0x00c35d5f,
+0003627,
+};
+asm(".type avx512bw_x86_32_D_32i2, STT_NOTYPE;");
+asm(".type avx512bw_x86_32_D_32i2, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512bw_x86_32_D_32u2[] = {
+0x315500eb, 0x57e589c0, 0x0010be56, 0x31530000,
+0xe0e483db, 0x0180ec81, 0x44c70000, 0x00102c24,
+0xb70f0000, 0x014a8dd0, 0xb9f9b70f, 0x00000010,
+0x1c247c89, 0xb70fd129, 0x89c189f9, 0x8318247c,
+0x0f4901e1, 0x7c89f9b7, 0xc7891424, 0x75f88540,
+0x01b34e03, 0x1c244c8b, 0xe283efd1, 0xb4896601,
+0x0000fe44, 0x04e2c100, 0xb70fd709, 0x8c8966ff,
+0x00009e44, 0x244c8b00, 0xbc896618, 0x00011e44,
+0x08c78300, 0x6610f883, 0x3e44bc89, 0x66000001,
+0xbe448c89, 0x8b000000, 0x6614244c, 0xde448c89,
+0x0f000000, 0xffff7985, 0x74db84ff, 0x24748904,
+0xfff1622c, 0x247c6f28, 0xfff16205, 0x247c7f28,
+0xfff16202, 0x24546f28, 0xedf36202, 0x00c73f28,
+0xc893f8c5, 0xfffff981, 0x39ba0000, 0x0f000005,
+0x00060b85, 0x6df16200, 0x244cfd28, 0xfff16205,
+0x244c7f28, 0x65f16203, 0x24747128, 0xf1620105,
+0x4c6f28ff, 0x3fba0324, 0x62000005, 0x3f28f5f3,
+0xf8c500d3, 0xf981ca93, 0x0000ffff, 0x05ce850f,
+0xf1620000, 0x4cf92875, 0xf1620524, 0x4c7f28ff,
+0xf1620424, 0x5c6f28ff, 0xf3620424, 0xdb3f28ed,
+0x93f8c500, 0xfff981cb, 0xba0000ff, 0x00000544,
+0x059a850f, 0xf1620000, 0x54eb286d, 0xf1620624,
+0x547f28ff, 0xf1620224, 0x4cdb2875, 0xf1620624,
+0x4c7f28ff, 0xf1620324, 0x54ef2865, 0xf1620624,
+0x547f28ff, 0xf1620424, 0x4cdf2875, 0xf3620224,
+0xe23f28f5, 0x93f8c500, 0xfff981cc, 0xba0000ff,
+0x00000550, 0x0546850f, 0xf1620000, 0x546f28ff,
+0xf1620524, 0x4cd5286d, 0xf1620624, 0x4c7f28ff,
+0xc7660224, 0x10602444, 0x245c8d00, 0x44c76660,
+0x00107e24, 0x8b66d989, 0x02e88313, 0x6602c383,
+0xb70fc201, 0x138966d2, 0x6602f883, 0x6e045489,
+0x8966e475, 0x62702454, 0x6f28fff1, 0xba022474,
+0x000005c8, 0x28cdf362, 0x03246c3f, 0x93f8c500,
+0xffff3dc5, 0x850f0000, 0x000004d4, 0x286df162,
+0x072464e4, 0x28fff162, 0x07245c6f, 0x286df162,
+0xf162cbdb, 0xcbfd2875, 0x28ddf362, 0xc500f13f,
+0x3dc693f8, 0x0000ffff, 0x0005d1ba, 0x9d850f00,
+0x62000004, 0x7f28fff1, 0x62042454, 0x712875f1,
+0x03042474, 0x28fff162, 0x02244c7f, 0x285df162,
+0x04247471, 0x5df16202, 0xbaecfd28, 0x000005ed,
+0x28f5f362, 0xc500fd3f, 0x3dc793f8, 0x0000ffff,
+0x045a850f, 0xf1620000, 0x54712875, 0x62020224,
+0xfd2875f1, 0x05f2bac9, 0xf3620000, 0xc13f28dd,
+0x93f8c500, 0xffff3dc0, 0x850f0000, 0x00000430,
+0x2c2444c7, 0x00000003, 0x087df162, 0x0b244c6e,
+0x286df162, 0x44c7c9f1, 0x00022c24, 0xf1620000,
+0x646e087d, 0xf1620b24, 0xe4f1286d, 0x285df162,
+0x05baecfd, 0x62000006, 0x3f28f5f3, 0xf8c500cd,
+0xff3dc193, 0x0f0000ff, 0x0003e385, 0x7df16200,
+0x246c6e08, 0x75f1620b, 0x62cdd128, 0xfd2875f1,
+0x0609bac9, 0xf3620000, 0xd13f28dd, 0x93f8c500,
+0xffff3dc2, 0x850f0000, 0x000003b4, 0xc976f5c5,
+0x28fff162, 0xf162e26f, 0xedef0855, 0xac75d5c5,
+0x00010024, 0x75f36200, 0x40e52528, 0x28ddf262,
+0x08246c12, 0x2875f162, 0x082474fd, 0x28fff162,
+0x0824747f, 0x28ddf262, 0x08246412, 0x000621ba,
+0x5df16200, 0x62e4fd28, 0x3f28d5f3, 0xf8c500dc,
+0xff3dc393, 0x0f0000ff, 0x00035385, 0x6df26200,
+0x24643a28, 0x6df26206, 0x246c3e28, 0x6df16206,
+0x2454fd28, 0x5df16206, 0xbae5fd28, 0x00000634,
+0x28ddf362, 0xc500e23f, 0x3dc493f8, 0x0000ffff,
+0x031a850f, 0xf1620000, 0x646f28ff, 0xf1620624,
+0xe9fd285d, 0x28fff162, 0x0524546f, 0x28d5f262,
+0xf362ea8d, 0xec3f28d5, 0x93f8c500, 0xffff3dc5,
+0x53ba0000, 0x0f000006, 0x0002e385, 0x84c76600,
+0x00016024, 0x62001100, 0xfd285df1, 0x065dbad2,
+0xf2620000, 0xac79287d, 0x00016024, 0xd5f36200,
+0x00f23f28, 0xc693f8c5, 0x00ffff3d, 0xad850f00,
+0xb8000002, 0x00000011, 0x000661ba, 0x7df26200,
+0x62e87b28, 0x3f28d5f3, 0xf8c500fa, 0xff3dc793,
+0x0f0000ff, 0x00028785, 0xfff16200, 0x24546f28,
+0xfff16209, 0x62ec6f28, 0x7d28edf2, 0x6205246c,
+0x7f28fff1, 0x6202246c, 0x6f28fff1, 0x620a247c,
+0x7d28c5f2, 0x66052464, 0x602484c7, 0x08000001,
+0x75f16200, 0xbaccfd28, 0x000006a6, 0x2875f162,
+0xf162cdf9, 0xcbef2875, 0x2865f362, 0x6255db25,
+0xf92875f1, 0x7df262cb, 0x249c7928, 0x00000160,
+0x28f5f362, 0xc500c33f, 0x3dc093f8, 0x0000ffff,
+0x020a850f, 0xf1620000, 0xdbef0865, 0x28fff162,
+0x05244c6f, 0x28edf262, 0xf262cb7d, 0xd37528f5,
+0x28fff162, 0x03244c7f, 0x28fff162, 0x0424547f,
+0xf162c031, 0x746f28ff, 0xf1620524, 0x747f28ff,
+0x8b660b24, 0x01604494, 0x89660000, 0x40304454,
+0x7508f883, 0x7df262ed, 0x244c3328, 0xf5f36203,
+0x244c3f28, 0xf8c50003, 0xff3dc193, 0xba0000ff,
+0x000006d3, 0x0196850f, 0xf1620000, 0xffef0845,
+0x0845f162, 0x50244cc4, 0x75f16200, 0x244cc408,
+0xf1620151, 0x4cc40875, 0x62025224, 0xc40875f1,
+0x0353244c, 0x287df262, 0xf162c934, 0x4c7f28ff,
+0xf3620224, 0x543f28f5, 0xc5000424, 0x3dc293f8,
+0x0000ffff, 0x0006daba, 0x41850f00, 0x31000001,
+0xfff162c0, 0x24546f28, 0xfff16205, 0x24547f28,
+0x948b660b, 0x00016044, 0x54896600, 0x83403044,
+0xed7508f8, 0x287df262, 0x03244c33, 0x28fff162,
+0x02244c7f, 0x28fff162, 0x0224746f, 0x287ef262,
+0x16247433, 0x8b66c031, 0x016044b4, 0x39660000,
+0x00a044b4, 0x0a740000, 0x0006f1ba, 0x00dee900,
+0x83400000, 0xde7508f8, 0x0845f162, 0xf162ffef,
+0x4cc40845, 0x62005024, 0xc40875f1, 0x0151244c,
+0x0875f162, 0x52244cc4, 0x75f16202, 0x244cc408,
+0xf1620353, 0x4c7f08ff, 0xf1620324, 0x746f08ff,
+0xf2620324, 0xce34287d, 0x28fff162, 0x02244c7f,
+0x28fff162, 0x02247c6f, 0x287ef262, 0xf162f934,
+0x4c7f08ff, 0xc0311624, 0x44b48b66, 0x00000160,
+0x44b43966, 0x000000a0, 0x00ba0774, 0xeb000007,
+0xf883405f, 0xb8e17504, 0x00000001, 0x28fff162,
+0x0324547f, 0x44948b66, 0x000000c0, 0x41148966,
+0x8302c083, 0xec7511f8, 0xffaaaab8, 0x073abaff,
+0xf1620000, 0x746f28ff, 0xf8c50524, 0xf262c892,
+0x4c6629cd, 0xf3620624, 0x5c3f28f5, 0xc5000324,
+0x3dc393f8, 0x0000ffff, 0x000000b8, 0xd0440f00,
+0x89f4658d, 0x5f5e5bd0, 0x0000c35d,
+0003372,
+};
+asm(".type avx512bw_x86_32_D_32u2, STT_NOTYPE;");
+asm(".type avx512bw_x86_32_D_32u2, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512bw_x86_64_D_64i1[] = {
+0xb85500eb, 0x00000001, 0x000008be, 0x41b74000,
+0x48e58948, 0x48c0e483, 0x01c8ec81, 0xfa890000,
+0x88ff488d, 0x00870484, 0xc2290000, 0xc7049488,
+0x89000000, 0x01e283ca, 0x1901fa83, 0x83c121d2,
+0xcaff02e2, 0x8301f983, 0x948800de, 0x00010704,
+0xb4884000, 0x00014704, 0xc0ff4800, 0x41f88348,
+0xf162bc75, 0xb46f48fd, 0x00008824, 0xfdf16200,
+0x24b47f48, 0xffffffc8, 0x48fdf162, 0xc8249c6f,
+0xb8ffffff, 0x00000539, 0x4865f362, 0xc400c63f,
+0xd093fbe1, 0x0fc2ff48, 0x00053185, 0x65f16200,
+0x248cfc48, 0x00000088, 0x48fdf162, 0x08248c7f,
+0xb0000000, 0xfdf162fe, 0x24946f48, 0x00000008,
+0x485df162, 0x8824b471, 0x01000000, 0x487df262,
+0x3fb8c87a, 0x62000005, 0xdb48f5f1, 0x6df362cc,
+0x00d93f48, 0x93fbe1c4, 0xc2ff48d3, 0x04dc850f,
+0xf1620000, 0x94f8486d, 0x00008824, 0xfdf16200,
+0x24947f48, 0x00000048, 0x4865f362, 0x4824a43f,
+0x00000000, 0x000544b8, 0xfbe1c400, 0xff48d493,
+0xa7850fc2, 0x62000004, 0x6f48fdf1, 0x010824bc,
+0xf1620000, 0x9c6f48fd, 0x00008824, 0xfdf16200,
+0xb9356f48, 0x62000004, 0x6f48fd71, 0x0004ef05,
+0x45716200, 0x62e76048, 0x604865f1, 0x457162cb,
+0x62df6848, 0x6f48fd71, 0x00051315, 0x1df16200,
+0x62c9d548, 0x684865f1, 0xfd7162d3, 0x3d0d6f48,
+0x62000005, 0x6f48fdf1, 0x014824bc, 0xf1620000,
+0xd2d54825, 0x48fdf162, 0xf262e16f, 0xe27d48cd,
+0x48bdf262, 0xd262ca7d, 0xc9004875, 0x485dd262,
+0xf162e200, 0xe1eb48dd, 0xc9eff1c5, 0x4845f362,
+0x6206c93f, 0x664975f2, 0xfdf162d4, 0x24ac6f48,
+0x00000148, 0x487df262, 0xf262ca30, 0xbc30487d,
+0x00014824, 0xfdf36200, 0x01d23b48, 0x487df262,
+0xf362d230, 0xed3b48fd, 0xf5f26201, 0x62ff1248,
+0x30487df2, 0xedf262ed, 0x62ed1248, 0x30487ef2,
+0x7ef262ff, 0x62ed3048, 0x3a48c5f3, 0x716201fd,
+0xb46f48fd, 0x00014824, 0x6201b000, 0x7a487df2,
+0x0df162e8, 0x62edf848, 0x7f48fdf1, 0x014824ac,
+0xf1620000, 0xac6f48fd, 0x00014824, 0x0621b800,
+0x72620000, 0xac30487d, 0x00014824, 0xfdf36200,
+0x01ed3b48, 0x48f5d262, 0xf262cd12, 0xed30487d,
+0x48edf262, 0xf262d512, 0xc930487e, 0x487ef262,
+0xf362d230, 0xca3a48f5, 0x75f16201, 0x62c9fc48,
+0x3f4845f3, 0xe1c400e9, 0x48d593fb, 0x850fc2ff,
+0x0000032a, 0x48fdf162, 0xc824bc6f, 0x62000000,
+0x7f48fdf1, 0xffc824a4, 0xf162ffff, 0xd7604845,
+0x4845f162, 0xd162cf68, 0xd4d5486d, 0x4875d162,
+0xf162cbd5, 0xea6f48fd, 0x48bdf262, 0xf262d17d,
+0xe97d48cd, 0x486dd262, 0xd262d100, 0xca004855,
+0x48f5f162, 0xf162caeb, 0x8c7f48fd, 0x00000824,
+0x5df26200, 0x248c3c48, 0x00000008, 0x48fdf162,
+0x48248c7f, 0x62000000, 0x38485df2, 0x000824a4,
+0xf1620000, 0xa47f48fd, 0x00000824, 0x75f16200,
+0x248cfc48, 0x00000008, 0x00063db8, 0x75f16200,
+0x62d16048, 0x684875f1, 0x75d162c9, 0x62cbd548,
+0xd5486dd1, 0xedf262d4, 0x62f17548, 0x7548ed72,
+0x65f162c1, 0x62cffc48, 0x00484dd2, 0x3d5262f2,
+0x62c10048, 0xeb48cdd1, 0x4df362f0, 0x00f13f48,
+0x93fbe1c4, 0xc2ff48d6, 0x0240850f, 0xf2620000,
+0x941c487d, 0xffffc824, 0x6df362ff, 0x00fb3f48,
+0x000644b8, 0xfbe1c400, 0xff48d793, 0x1b850fc2,
+0xc6000002, 0x01882484, 0xb8410000, 0x0000065d,
+0x487df262, 0x88249478, 0x62000001, 0x3f486df3,
+0xe1c400c1, 0x48d093fb, 0x850fc2ff, 0x000001ee,
+0x000041b8, 0x7df26200, 0x62d07a48, 0x3f486df3,
+0x61b800c9, 0xc4000006, 0xd193fbe1, 0x0fc2ff48,
+0x0001c985, 0xfdf16200, 0x249c7f48, 0x00000188,
+0x948ac031, 0x00018804, 0xc0ff4800, 0xa7045488,
+0x20f88348, 0xf262ec75, 0x8c20487d, 0xffffa824,
+0xfdf162ff, 0x248c7f48, 0xffffffc8, 0x48fdf162,
+0xc824b46f, 0x62ffffff, 0x30487ef2, 0x018824b4,
+0xc0310000, 0x04bc8a40, 0x00000088, 0x04bc3840,
+0x00000188, 0xf1b80a74, 0xe9000006, 0x0000015e,
+0x48c0ff48, 0x7520f883, 0xfdf162db, 0x249c7f48,
+0x00000188, 0x948ac031, 0x00018804, 0x04548800,
+0xc0ff48a8, 0x10f88348, 0xf262ec75, 0x8c21487d,
+0xffffa824, 0x7df162ff, 0x248c7f48, 0xffffffc8,
+0x487df162, 0xc824a46f, 0x62ffffff, 0x31487ef2,
+0x018824a4, 0xc0310000, 0x04b48a40, 0x00000088,
+0x04b43840, 0x00000188, 0x00b80a74, 0xe9000007,
+0x000000ea, 0x48c0ff48, 0x7510f883, 0xfdf162db,
+0x249c7f48, 0x00000188, 0x948ac031, 0x00018804,
+0x04548800, 0xc0ff48a8, 0x08f88348, 0xf9c5ec75,
+0xa824746f, 0x487df262, 0xf162ce22, 0x8c7f48fd,
+0xffffc824, 0xfdf162ff, 0x24a46f48, 0xffffffc8,
+0x487ef262, 0xf9c5e132, 0x88248c7f, 0x31000001,
+0xbc8a40c0, 0x00008804, 0xbc384000, 0x00018804,
+0xb8077400, 0x0000070f, 0xff4874eb, 0xf88348c0,
+0x62de7508, 0x7f48fdf1, 0x0008249c, 0x01b80000,
+0x8a000000, 0x00c80494, 0x54880000, 0x83480804,
+0x834802c0, 0xeb7541f8, 0x48fdf162, 0x88249c6f,
+0xba000000, 0x00000000, 0xaaaab848, 0xaaaaaaaa,
+0xe1c4aaaa, 0x62d092fb, 0x664a65f2, 0x00c8248c,
+0xf3620000, 0x943f4875, 0x00000824, 0xe1c40000,
+0x48c293fb, 0x3ab8c0ff, 0x0f000007, 0xc3c9c244,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00020000, 0x00060004, 0x00220020, 0x00260024,
+0x000a0008, 0x000e000c, 0x002a0028, 0x002e002c,
+0x00120010, 0x00160014, 0x00320030, 0x00360034,
+0x001a0018, 0x001e001c, 0x003a0038, 0x003e003c,
+0x00030001, 0x00070005, 0x00230021, 0x00270025,
+0x000b0009, 0x000f000d, 0x002b0029, 0x002f002d,
+0x00130011, 0x00170015, 0x00330031, 0x00370035,
+0x001b0019, 0x001f001d, 0x003b0039, 0x003f003d,
+0xff02ff00, 0xff06ff04, 0xff0aff08, 0xff0eff0c,
+0xff02ff00, 0xff06ff04, 0xff0aff08, 0xff0eff0c,
+0xff02ff00, 0xff06ff04, 0xff0aff08, 0xff0eff0c,
+0xff02ff00, 0xff06ff04, 0xff0aff08, 0xff0eff0c,
+0x02ff00ff, 0x06ff04ff, 0x0aff08ff, 0x0eff0cff,
+0x02ff00ff, 0x06ff04ff, 0x0aff08ff, 0x0eff0cff,
+0x02ff00ff, 0x06ff04ff, 0x0aff08ff, 0x0eff0cff,
+0x02ff00ff, 0x06ff04ff, 0x0aff08ff, 0x0eff0cff,
+0003400,
+};
+asm(".type avx512bw_x86_64_D_64i1, STT_NOTYPE;");
+asm(".type avx512bw_x86_64_D_64i1, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512bw_x86_64_D_64u1[] = {
+0xb85500eb, 0x00000001, 0x000008ba, 0x41b64000,
+0x48e58948, 0x48c0e483, 0x0188ec81, 0xf1890000,
+0x87048488, 0x29000000, 0x048c88c1, 0x000000c7,
+0x21ff488d, 0x01f983c1, 0x8800da83, 0x01070494,
+0xff480000, 0xf88348c0, 0x62d37541, 0x6f48fdf1,
+0x008824bc, 0xf1620000, 0xbc7f48fd, 0xffffc824,
+0xfdf162ff, 0x24946f48, 0xffffffc8, 0x000539b8,
+0x6df36200, 0x00c73f48, 0x93fbe1c4, 0xc2ff48d0,
+0x045f850f, 0xf1620000, 0x8cfc486d, 0x00008824,
+0xfdf16200, 0x248c7f48, 0x00000008, 0xf162feb0,
+0x8c6f48fd, 0x00000824, 0x5df16200, 0x24b47148,
+0x00000088, 0x7df26201, 0xb8d87a48, 0x0000053f,
+0x48e5f162, 0xf362dcdb, 0xdb3f4875, 0xfbe1c400,
+0xff48d393, 0x0a850fc2, 0x62000004, 0xf84875f1,
+0x0088248c, 0xf1620000, 0x8c7f48fd, 0x00004824,
+0xfdf16200, 0x249c6f48, 0x00000048, 0x000544b8,
+0x6df36200, 0x00e33f48, 0x93fbe1c4, 0xc2ff48d4,
+0x03cf850f, 0xf1620000, 0x94eb48ed, 0x0000c824,
+0xfdf16200, 0x24947f48, 0xffffffc8, 0x48f5f162,
+0xc8248cdb, 0x62000000, 0xef48e5f1, 0x00c8249c,
+0xf1620000, 0x8cdf48f5, 0xffffc824, 0x0550b8ff,
+0xf3620000, 0xeb3f4875, 0xfbe1c400, 0xff48d593,
+0x7e850fc2, 0xc5000003, 0x62c9eff1, 0x25484df3,
+0xf162fff6, 0xbc6f48fd, 0x00010824, 0xfdf16200,
+0x24ac6f48, 0x00000088, 0x4845f362, 0x6204c93f,
+0x6f497ff1, 0xf5f162ce, 0x62cddb48, 0x7f48fdf1,
+0x0048248c, 0xf1620000, 0xbc6f48fd, 0x00010824,
+0x7df26200, 0x62d13048, 0x30487df2, 0x010824a4,
+0xf3620000, 0xc93b48fd, 0x7df26201, 0x62c93048,
+0x3b48fdf3, 0xf26201fb, 0xe41248ed, 0x487df262,
+0xf262db30, 0xdb1248f5, 0x487ef262, 0xf262e430,
+0xdb30487e, 0x48ddf362, 0x6201e33a, 0xfc484df1,
+0x010824b4, 0xf1620000, 0xb47f48fd, 0x00010824,
+0xfdf16200, 0x24bc6f48, 0x00000108, 0x000621b8,
+0x7df26200, 0x24b43048, 0x00000108, 0x48fdf362,
+0x6201fb3b, 0x1248edf2, 0x7df262d6, 0x62db3048,
+0x1248f5f2, 0x7ef262cb, 0x62d23048, 0x30487ef2,
+0xedf362c9, 0x01c93a48, 0x4875f162, 0xf362c9fc,
+0xf13f485d, 0xfbe1c400, 0xff48d693, 0x72850fc2,
+0x62000002, 0xda4855f1, 0x00c8248c, 0xf1620000,
+0x8c7f48fd, 0xffffc824, 0x55f162ff, 0x249cde48,
+0x000000c8, 0x48fdf162, 0x08249c7f, 0x62000000,
+0xfc4855f1, 0x00c82494, 0xf1620000, 0xcbfc4875,
+0x000634b8, 0x75f36200, 0x00fa3f48, 0x93fbe1c4,
+0xc2ff48d7, 0x021b850f, 0x84c60000, 0x00014824,
+0x5db84100, 0x62000006, 0x78487df2, 0x0148248c,
+0xf3620000, 0xc23f4875, 0xfbe1c400, 0xff48d093,
+0xee850fc2, 0xb8000001, 0x00000041, 0x487df262,
+0xf362c87a, 0xca3f4875, 0x0661b800, 0xe1c40000,
+0x48d193fb, 0x850fc2ff, 0x000001c9, 0x48fdf162,
+0x4824ac7f, 0x31000001, 0x04948ac0, 0x00000148,
+0x88c0ff48, 0x48a70454, 0x7520f883, 0x7df262ec,
+0x248c3048, 0xffffffa8, 0x48fdf162, 0xc8248c7f,
+0x62ffffff, 0x6f48fdf1, 0xffc824b4, 0xf262ffff,
+0xb430487e, 0x00014824, 0x40c03100, 0x8804bc8a,
+0x40000000, 0x4804bc38, 0x74000001, 0x06f1b80a,
+0x5ee90000, 0x48000001, 0x8348c0ff, 0xdb7520f8,
+0x48fdf162, 0x4824ac7f, 0x31000001, 0x04948ac0,
+0x00000148, 0xa8045488, 0x48c0ff48, 0x7510f883,
+0x7df262ec, 0x248c3148, 0xffffffa8, 0x487df162,
+0xc8248c7f, 0x62ffffff, 0x6f487df1, 0xffc824bc,
+0xf262ffff, 0xbc31487e, 0x00014824, 0x40c03100,
+0x8804b48a, 0x40000000, 0x4804b438, 0x74000001,
+0x0700b80a, 0xeae90000, 0x48000000, 0x8348c0ff,
+0xdb7510f8, 0x48fdf162, 0x4824ac7f, 0x31000001,
+0x04948ac0, 0x00000148, 0xa8045488, 0x48c0ff48,
+0x7508f883, 0x6ff9c5ec, 0x62a82474, 0x32487df2,
+0xfdf162ce, 0x248c7f48, 0xffffffc8, 0x48fdf162,
+0xc824bc6f, 0x62ffffff, 0x32487ef2, 0x7ff9c5f9,
+0x0148248c, 0xc0310000, 0x04bc8a40, 0x00000088,
+0x04bc3840, 0x00000148, 0x0fb80774, 0xeb000007,
+0xc0ff4874, 0x08f88348, 0xf162de75, 0xac7f48fd,
+0x00000824, 0x0001b800, 0x948a0000, 0x0000c804,
+0x04548800, 0xc0834808, 0xf8834802, 0x62eb7541,
+0x6f48fdf1, 0x008824ac, 0x00ba0000, 0x48000000,
+0xaaaaaab8, 0xaaaaaaaa, 0xfbe1c4aa, 0xf262d092,
+0x8c664a55, 0x0000c824, 0x75f36200, 0x24943f48,
+0x00000008, 0xfbe1c400, 0xff48c293, 0x073ab8c0,
+0x440f0000, 0x00c3c9c2,
+0002347,
+};
+asm(".type avx512bw_x86_64_D_64u1, STT_NOTYPE;");
+asm(".type avx512bw_x86_64_D_64u1, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512bw_x86_64_D_64i2[] = {
+0x315500eb, 0xc03145c0, 0x000010bf, 0x20bb4100,
+0x48000000, 0x4853e589, 0x48c0e483, 0x0248ec81,
+0x44c70000, 0x0010a424, 0xc6890000, 0x8dd98945,
+0xc1890158, 0x4101e683, 0x8d44c129, 0xc2890150,
+0x1901fe83, 0x02e683f6, 0xc385ceff, 0xcfff0575,
+0x8301b041, 0xe9d101e2, 0x94894466, 0x00008844,
+0x05e2c100, 0x44b48966, 0x00000108, 0x8966ca09,
+0x014844bc, 0x89660000, 0x01884494, 0xc2830000,
+0x89446610, 0x00c8448c, 0x89660000, 0x01c84494,
+0xff480000, 0xf88348c0, 0x458f7520, 0x0474c084,
+0xa4247c89, 0x48fdf162, 0x8824ac6f, 0x62000000,
+0x7f48fdf1, 0xffc824ac, 0xf162ffff, 0x8c6f48fd,
+0xffffc824, 0x0539b8ff, 0xf3620000, 0xc53f48f5,
+0x93fbc500, 0x0fc2ffd0, 0x00076385, 0x75f16200,
+0x2494fd48, 0x00000088, 0x48fdf162, 0x0824947f,
+0x62000000, 0x6f48fdf1, 0x00082494, 0x3fb80000,
+0x62000005, 0x714865f1, 0x008824b4, 0x62010000,
+0x3f48edf3, 0xfbc500d3, 0xc2ffd293, 0x071e850f,
+0xf1620000, 0x94f9486d, 0x00008824, 0xfdf16200,
+0x24947f48, 0x00000048, 0x48f5f362, 0x48249c3f,
+0x00000000, 0x000544b8, 0x93fbc500, 0x0fc2ffd3,
+0x0006eb85, 0xfdf16200, 0x24b46f48, 0x000000c8,
+0x4875f162, 0x88248cd5, 0x62000000, 0xd5484df1,
+0xfdf162d6, 0x24947f48, 0x00000008, 0x48fdf162,
+0x8824bc6f, 0x62000000, 0xfd4845f1, 0x45f162e6,
+0x249cf948, 0x000000c8, 0x4875f162, 0x5bb8caf9,
+0x62000005, 0xd54865f1, 0xf5f362dc, 0x00e33f48,
+0x48fdf162, 0x48249c7f, 0xc5000000, 0xffd493fb,
+0x79850fc2, 0x62000006, 0xd54845f1, 0x00c8248c,
+0xf1620000, 0x8c7f48fd, 0xffffc824, 0x44c766ff,
+0x00200824, 0x1ebfc031, 0x48000000, 0x4424748d,
+0x2444c766, 0x89002046, 0xf18948fa, 0x0366c229,
+0x48080454, 0x8966c129, 0x480a0454, 0x6602c083,
+0x83481189, 0xdf751ef8, 0x24548966, 0xfdf16228,
+0x24ac6f48, 0xffffffc8, 0x0005c8b8, 0x55f16200,
+0x24ac7548, 0x00000008, 0xd593fbc5, 0x850fc2ff,
+0x000005fc, 0x4845f162, 0x082494e5, 0x62000001,
+0x6f48fdf1, 0x0108248c, 0xc9c50000, 0xf362f6ef,
+0xed254855, 0x05cfb8ff, 0xf3620000, 0xce3f48f5,
+0xcdf26201, 0x62dd6649, 0x3f48edf3, 0xfbc500f3,
+0xc2ffd693, 0x05b6850f, 0xf1620000, 0xa4d54875,
+0x00008824, 0xfdf16200, 0x24a47f48, 0x00000048,
+0x486df162, 0x4824b471, 0x03000000, 0x48fdf162,
+0xc824947f, 0x62ffffff, 0x714865f1, 0x004824b4,
+0x62020000, 0xfd486571, 0x05edb8c3, 0xd3620000,
+0xf83f48ed, 0x93fbc500, 0x0fc2ffd7, 0x00055f85,
+0x6df16200, 0x24a47148, 0xffffffc8, 0x6df16202,
+0xb8d2fd48, 0x000005f2, 0x48e5f362, 0xc500c23f,
+0xffd093fb, 0x35850fc2, 0x62000005, 0xd54845f1,
+0x2444c7d9, 0x000003a4, 0x44634800, 0xf162a424,
+0xd06e08fd, 0x4865f162, 0x44c7d2f1, 0x0002a424,
+0x63480000, 0x62a42444, 0x6e08fd71, 0x65d162c8,
+0x62d9f148, 0xfd486571, 0x0605b8c3, 0xd3620000,
+0xd03f48ed, 0x93fbc500, 0x0fc2ffd2, 0x0004df85,
+0x44634800, 0x7162a424, 0xd06e08fd, 0x486dd162,
+0xf162d2e1, 0xd2fd486d, 0x000609b8, 0xe5f36200,
+0x00da3f48, 0xd393fbc5, 0x850fc2ff, 0x000004b0,
+0x48fdf162, 0x48249c6f, 0x62000001, 0x3f48e5f3,
+0xf16206ce, 0xd1d5c945, 0x48edf262, 0x4824b412,
+0x62000001, 0x6f48fd71, 0x0148249c, 0x01b80000,
+0x62000000, 0x7b487df2, 0x25f162d8, 0x62dbf948,
+0x7f48fdf1, 0x0148249c, 0xf2620000, 0x941248ed,
+0x00014824, 0x0621b800, 0xf1620000, 0xd2fd486d,
+0x48cdf362, 0xc500e23f, 0xffd493fb, 0x3d850fc2,
+0x62000004, 0xd54875f1, 0x00c82494, 0xf1620000,
+0x947f48fd, 0x00000824, 0x5df16200, 0x2494ee48,
+0x00000008, 0x485df162, 0x0824a4ea, 0x62000000,
+0x7f48fdf1, 0x000824a4, 0xf1620000, 0x94fd486d,
+0x00000824, 0x063db800, 0xf1620000, 0x9cfd4845,
+0x0000c824, 0x6df16200, 0x62d1d548, 0x3f48edf3,
+0xfbc500eb, 0xc2ffd593, 0x03d2850f, 0xf1620000,
+0xd1d54845, 0x48fdf162, 0xc824947f, 0x62ffffff,
+0x1d487df2, 0xffc82494, 0xf362ffff, 0xf73f48ed,
+0x0644b800, 0xfbc50000, 0xc2ffd693, 0x039e850f,
+0xf1620000, 0xa46f48fd, 0x0000c824, 0x0001b800,
+0xf1620000, 0x9c6f48fd, 0x00008824, 0x7df26200,
+0xb8d07b48, 0x00000653, 0x485df162, 0xf262d2f9,
+0xd38d48ed, 0x48edf362, 0xc500fc3f, 0xffd793fb,
+0x59850fc2, 0x62000003, 0xfd485df1, 0x065db8d3,
+0xc7660000, 0x02082484, 0x00210000, 0x487df262,
+0x08249c79, 0x62000002, 0x3f48e5f3, 0xfbc500c2,
+0xc2ffd093, 0x0326850f, 0x21b80000, 0x62000000,
+0x7b487df2, 0xe5f362d8, 0x00d23f48, 0x000661b8,
+0x93fbc500, 0x0fc2ffd2, 0x00030385, 0xfdf16200,
+0x24946f48, 0x00000188, 0x48fdf162, 0xf262dc6f,
+0x9c7d48ed, 0x00008824, 0xfdf16200, 0x24b46f48,
+0x000001c8, 0x48cdf262, 0x8824a47d, 0x62000000,
+0xf94865f1, 0x06a6b8dc, 0xc7660000, 0x02082484,
+0x00100000, 0x4865f162, 0xf262d9d5, 0xa479487d,
+0x00020824, 0xe5f36200, 0x00dc3f48, 0x48fdf162,
+0x48249c7f, 0xc5000000, 0xffd393fb, 0x8d850fc2,
+0x62000002, 0xd54875f1, 0x0088249c, 0xd9c50000,
+0xf162e4ef, 0x9c7f48fd, 0xffffc824, 0xf5f362ff,
+0x01cc3f48, 0x49fff162, 0xf262e56f, 0xdc7d48ed,
+0x48fdf162, 0x08249c7f, 0x62000000, 0x6f48fdf1,
+0xffc824b4, 0xc031ffff, 0x48fdf162, 0x0824b47f,
+0x66000002, 0x0804948b, 0x48000002, 0x6602c083,
+0xa6045489, 0x20f88348, 0xf262e975, 0xa423487d,
+0xffffa824, 0xfdf162ff, 0x62dc6f48, 0x7f487df1,
+0x004824a4, 0xf3620000, 0xa43f48dd, 0x00000824,
+0xb3b80000, 0xc5000006, 0xffd493fb, 0xed850fc2,
+0xc5000001, 0x62e4efd9, 0x3f48f5f3, 0xf26201cc,
+0xcd6649dd, 0x48fdf162, 0xf262e16f, 0xe17d48ed,
+0x48e5f262, 0xf162d475, 0x947f48fd, 0x00000824,
+0xfdf16200, 0x24ac6f48, 0xffffffc8, 0xf162c031,
+0xac7f48fd, 0x00020824, 0x948b6600, 0x00020804,
+0x54896600, 0x8348a804, 0x834802c0, 0xe97510f8,
+0x487df262, 0xa8248c24, 0x62ffffff, 0x7f48fdf1,
+0x0048248c, 0xf3620000, 0xac3f48f5, 0x00000824,
+0xbbb80000, 0xc5000006, 0xffd593fb, 0x5d850fc2,
+0x62000001, 0x6f48fdf1, 0x0088248c, 0xc0310000,
+0x48fdf162, 0x08248c7f, 0x66000002, 0x0804948b,
+0x66000002, 0xa8045489, 0x02c08348, 0x20f88348,
+0xf262e975, 0x9423487d, 0xffffa824, 0x7df162ff,
+0x24947f48, 0xffffffc8, 0x487df162, 0xc824ac6f,
+0x62ffffff, 0x33487ef2, 0x020824ac, 0xc0310000,
+0x049c8b66, 0x00000088, 0x049c3966, 0x00000208,
+0xf1b80a74, 0xe9000006, 0x000000e4, 0x02c08348,
+0x20f88348, 0xf162da75, 0x8c7f48fd, 0x00020824,
+0x66c03100, 0x0804948b, 0x66000002, 0xa8045489,
+0x02c08348, 0x10f88348, 0xf262e975, 0x9424487d,
+0xffffa824, 0xfdf162ff, 0x24947f48, 0xffffffc8,
+0x48fdf162, 0xc824bc6f, 0x62ffffff, 0x34487ef2,
+0x020824bc, 0xc0310000, 0x049c8b66, 0x00000088,
+0x049c3966, 0x00000208, 0x00b80774, 0xeb000007,
+0xc083486f, 0xf8834802, 0x62dd7510, 0x7f48fdf1,
+0x0008248c, 0x02b80000, 0x66000000, 0xc804948b,
+0x66000000, 0x08045489, 0x04c08348, 0x42f88348,
+0xf162e975, 0xb46f48fd, 0x00008824, 0xaaaab800,
+0x00baaaaa, 0xc5000000, 0x62c892fb, 0x6649cdf2,
+0x00c8248c, 0xf3620000, 0xb43f48f5, 0x00000824,
+0xfbc50000, 0xc0ffc693, 0x00073ab8, 0xc2440f00,
+0xf85d8b48, 0x0000c3c9,
+0004106,
+};
+asm(".type avx512bw_x86_64_D_64i2, STT_NOTYPE;");
+asm(".type avx512bw_x86_64_D_64i2, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512bw_x86_64_D_64u2[] = {
+0x315500eb, 0xc03145c0, 0x000010b9, 0x20ba4100,
+0x48000000, 0x4853e589, 0x48c0e483, 0x0248ec81,
+0x44c70000, 0x0010a424, 0xc7890000, 0x8dd18945,
+0xc6890158, 0x8901e783, 0x588d44c2, 0xc1294101,
+0xc385cfff, 0xc9ff0575, 0x8301b041, 0xeed101e2,
+0x9c894466, 0x00008844, 0x05e2c100, 0x44bc8966,
+0x00000108, 0x8966f209, 0x0148448c, 0x89660000,
+0x01884494, 0xc2830000, 0x89446610, 0x00c8448c,
+0x89660000, 0x01c84494, 0xff480000, 0xf88348c0,
+0x45977520, 0x0474c084, 0xa4244c89, 0x48fdf162,
+0x8824bc6f, 0x62000000, 0x7f48fdf1, 0xffc824bc,
+0xf162ffff, 0x946f48fd, 0xffffc824, 0x0539b8ff,
+0xf3620000, 0xc73f48ed, 0x93fbc500, 0x0fc2ffd0,
+0x0006ae85, 0x6df16200, 0x248cfd48, 0x00000088,
+0x48fdf162, 0x08248c7f, 0x62000000, 0x6f48fdf1,
+0x0008248c, 0x3fb80000, 0x62000005, 0x714865f1,
+0x008824b4, 0x62010000, 0x3f48f5f3, 0xfbc500d3,
+0xc2ffd293, 0x0669850f, 0xf1620000, 0x8cf94875,
+0x00008824, 0xfdf16200, 0x248c7f48, 0x00000048,
+0x48fdf162, 0x48249c6f, 0xb8000000, 0x00000544,
+0x48edf362, 0xc500db3f, 0xffd393fb, 0x30850fc2,
+0x62000006, 0xeb48edf1, 0x00c82494, 0xf1620000,
+0x947f48fd, 0xffffc824, 0xf5f162ff, 0x248cdb48,
+0x000000c8, 0x48fdf162, 0x08248c7f, 0x62000000,
+0xef48e5f1, 0x00c82494, 0xf1620000, 0x947f48fd,
+0x00004824, 0xf5f16200, 0x248cdf48, 0xffffffc8,
+0x000550b8, 0xf5f36200, 0x00e23f48, 0xd493fbc5,
+0x850fc2ff, 0x000005cb, 0x48fdf162, 0x8824946f,
+0x62000000, 0xd5486df1, 0x00c8248c, 0xf1620000,
+0x8c7f48fd, 0xffffc824, 0x44c766ff, 0x00200824,
+0x1ebfc031, 0x48000000, 0x4424748d, 0x2444c766,
+0x89002046, 0xf18948fa, 0x0366c229, 0x48080454,
+0x8966c129, 0x480a0454, 0x6602c083, 0x83481189,
+0xdf751ef8, 0x24548966, 0xfdf16228, 0x24b46f48,
+0xffffffc8, 0x0005c8b8, 0x4df16200, 0x24ac7548,
+0x00000008, 0xd593fbc5, 0x850fc2ff, 0x00000543,
+0x486df162, 0x08249ce4, 0x62000001, 0x6f48fdf1,
+0x010824a4, 0xd1b80000, 0x62000005, 0xdb48edf1,
+0x75f162cc, 0x62ccfd48, 0x3f48e5f3, 0xfbc500f1,
+0xc2ffd693, 0x0509850f, 0xf1620000, 0x947f48fd,
+0x00004824, 0x75f16200, 0x24b47148, 0x00000048,
+0xfdf16203, 0x248c7f48, 0xffffffc8, 0x4865f162,
+0x4824b471, 0x02000000, 0x4865f162, 0xedb8ebfd,
+0x62000005, 0x3f48f5f3, 0xfbc500fd, 0xc2ffd793,
+0x04bd850f, 0xf1620000, 0x94714875, 0xffffc824,
+0xf16202ff, 0xc9fd4875, 0x0005f2b8, 0xe5f36200,
+0x00c13f48, 0xd093fbc5, 0x850fc2ff, 0x00000493,
+0xa42444c7, 0x00000003, 0x087df162, 0xe9244c6e,
+0x486df162, 0x44c7c9f1, 0x0002a424, 0xf1620000,
+0x5c6e087d, 0xf162e924, 0xdbf1486d, 0x4865f162,
+0x05b8ebfd, 0x62000006, 0x3f48f5f3, 0xfbc500d5,
+0xc2ffd293, 0x0449850f, 0xf1620000, 0x6c6e087d,
+0xf162e924, 0xcdd14875, 0x4875f162, 0x09b8c9fd,
+0x62000006, 0x3f48e5f3, 0xfbc500d9, 0xc2ffd393,
+0x041d850f, 0xf1620000, 0xbc6f48fd, 0x00014824,
+0xeff1c500, 0xc5f362c9, 0x04c93f48, 0x4875f362,
+0x62ffc925, 0x6fc9fff1, 0xe5f162d9, 0x62dadb48,
+0x1248e5f2, 0x014824ac, 0xf1620000, 0xb4fd4875,
+0x00014824, 0xfdf16200, 0x24b47f48, 0x00000148,
+0x48e5f262, 0x48249c12, 0xb8000001, 0x00000621,
+0x4865f162, 0xf362dbfd, 0xe33f48d5, 0x93fbc500,
+0x0fc2ffd4, 0x0003aa85, 0x6df26200, 0x249c3a48,
+0x000000c8, 0x486df262, 0xc824ac3e, 0x62000000,
+0xfd486df1, 0x00c82494, 0xf1620000, 0xddfd4865,
+0x000634b8, 0xe5f36200, 0x00ea3f48, 0xd593fbc5,
+0x850fc2ff, 0x0000036b, 0x48fdf162, 0xc8249c6f,
+0xb8000000, 0x00000653, 0x48fdf162, 0x8824946f,
+0x62000000, 0xfd4865f1, 0xd5f262e9, 0x62ea8d48,
+0x3f48d5f3, 0xfbc500f3, 0xc2ffd693, 0x0331850f,
+0xf1620000, 0xd2fd4865, 0x00065db8, 0x84c76600,
+0x00020824, 0x62002100, 0x79487df2, 0x020824ac,
+0xf3620000, 0xfa3f48d5, 0x93fbc500, 0x0fc2ffd7,
+0x0002fe85, 0x0021b800, 0xf2620000, 0xe87b487d,
+0x48d5f362, 0xb800c23f, 0x00000661, 0xd093fbc5,
+0x850fc2ff, 0x000002db, 0x48fdf162, 0x8824946f,
+0x62000001, 0x6f48fdf1, 0xedf262eb, 0x24ac7d48,
+0x00000088, 0x48fdf162, 0xc824ac7f, 0x62ffffff,
+0x6f48fdf1, 0x01c824b4, 0xf2620000, 0x9c7d48cd,
+0x00008824, 0x75f16200, 0xb8cbfd48, 0x000006a6,
+0x2484c766, 0x00000208, 0xf1620010, 0xcdf94875,
+0x48f5f162, 0xf362ccef, 0xe425485d, 0x75f16255,
+0x62ccf948, 0x79487df2, 0x0208249c, 0xf3620000,
+0xcb3f48f5, 0x93fbc500, 0x0fc2ffd1, 0x00025285,
+0xfdf16200, 0x248c6f48, 0x00000088, 0xdbefe1c5,
+0x48edf262, 0xf262cb7d, 0xd37548f5, 0x48fdf162,
+0x08248c7f, 0x62000000, 0x7f48fdf1, 0x00482494,
+0xf1620000, 0xbc6f48fd, 0x00008824, 0x62c03100,
+0x7f48fdf1, 0x020824bc, 0x8b660000, 0x02080494,
+0x83480000, 0x896602c0, 0x48a60454, 0x7520f883,
+0x7df262e9, 0x248c3348, 0xffffffa8, 0x487df162,
+0xc8248c7f, 0x62ffffff, 0x3f48f5f3, 0x00082494,
+0xb8000000, 0x000006d3, 0xd293fbc5, 0x850fc2ff,
+0x000001bf, 0x48fdf162, 0x8824b46f, 0x31000000,
+0xfdf162c0, 0x24b47f48, 0x00000208, 0x04948b66,
+0x00000208, 0x04548966, 0xc08348a8, 0xf8834802,
+0x62e97510, 0x34487df2, 0xffa8248c, 0xf162ffff,
+0x8c7f48fd, 0xffffc824, 0xf5f362ff, 0x249c3f48,
+0x00000048, 0x06dab800, 0xfbc50000, 0xc2ffd393,
+0x015d850f, 0xf1620000, 0x8c6f48fd, 0x00008824,
+0x62c03100, 0x7f48fdf1, 0x0208248c, 0x8b660000,
+0x02080494, 0x89660000, 0x48a80454, 0x4802c083,
+0x7520f883, 0x7df262e9, 0x24943348, 0xffffffa8,
+0x487df162, 0xc824947f, 0x62ffffff, 0x6f487df1,
+0xffc824bc, 0xf262ffff, 0xbc33487e, 0x00020824,
+0x66c03100, 0x88049c8b, 0x66000000, 0x08049c39,
+0x74000002, 0x06f1b80a, 0xe4e90000, 0x48000000,
+0x4802c083, 0x7520f883, 0xfdf162da, 0x248c7f48,
+0x00000208, 0x8b66c031, 0x02080494, 0x89660000,
+0x48a80454, 0x4802c083, 0x7510f883, 0x7df262e9,
+0x24943448, 0xffffffa8, 0x48fdf162, 0xc824947f,
+0x62ffffff, 0x6f48fdf1, 0xffc824a4, 0xf262ffff,
+0xa434487e, 0x00020824, 0x66c03100, 0x88049c8b,
+0x66000000, 0x08049c39, 0x74000002, 0x0700b807,
+0x6feb0000, 0x02c08348, 0x10f88348, 0xf162dd75,
+0x8c7f48fd, 0x00000824, 0x0002b800, 0x8b660000,
+0x00c80494, 0x89660000, 0x48080454, 0x4804c083,
+0x7542f883, 0xfdf162e9, 0x24b46f48, 0x00000088,
+0xaaaaaab8, 0x0000baaa, 0xfbc50000, 0xf262c892,
+0x8c6649cd, 0x0000c824, 0xf5f36200, 0x24a43f48,
+0x00000008, 0x93fbc500, 0xb8c0ffc4, 0x0000073a,
+0x48c2440f, 0xc9f85d8b, 0x000000c3,
+0003611,
+};
+asm(".type avx512bw_x86_64_D_64u2, STT_NOTYPE;");
+asm(".type avx512bw_x86_64_D_64u2, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512bw_x86_64_D_16i1[] = {
+0xb85500eb, 0x00000001, 0x000008be, 0x11b74000,
+0x48e58948, 0x8918ec83, 0xff488dfa, 0xb7044488,
+0x5488c229, 0xca89c704, 0x8301e283, 0xd21901fa,
+0xe283c121, 0x83caff02, 0xde8301f9, 0x04548800,
+0x748840d7, 0xff48e704, 0xf88348c0, 0x62c87511,
+0x6f087ff1, 0xffb8248c, 0xf162ffff, 0x8c7f087f,
+0xffff8824, 0x7ff162ff, 0x249c6f08, 0xffffff88,
+0x000539b8, 0x65f36200, 0x00c13f08, 0xd093f8c5,
+0x0fc2ff66, 0x00056385, 0x65f16200, 0x248cfc08,
+0xffffffb8, 0x087ff162, 0x98248c7f, 0x62ffffff,
+0x6f087ff1, 0xffb82494, 0xf162ffff, 0x8c6f087f,
+0xffff9824, 0x053fb8ff, 0xf1620000, 0xd2fc086d,
+0x0875f362, 0xc500d23f, 0x66d293f8, 0x850fc2ff,
+0x00000518, 0x0875f162, 0xb8248cf8, 0x62ffffff,
+0x7f087ff1, 0xffa8248c, 0xf362ffff, 0x9c3f0865,
+0xffffa824, 0x44b800ff, 0xc5000005, 0x66d393f8,
+0x850fc2ff, 0x000004e4, 0x087ff162, 0xb824b46f,
+0x62ffffff, 0x6f087ff1, 0xffd824ac, 0xf162ffff,
+0xc9ef0875, 0x087ff162, 0xe824a46f, 0x62ffffff,
+0x30287df2, 0x7df262d6, 0x62fd3028, 0xd5286df1,
+0x64d9c5d7, 0x7ef262c9, 0x62d23028, 0xdb0875f1,
+0x7df262ca, 0x249c3028, 0xffffffe8, 0x287df262,
+0xf262c930, 0xdb1228f5, 0x287ef262, 0xf162db30,
+0x256f087f, 0x00000478, 0x087f7162, 0xe8248c6f,
+0x62ffffff, 0xf8083571, 0x7f7162c4, 0x24847f08,
+0xffffffe8, 0x287d7262, 0xe8248430, 0xb8ffffff,
+0x00000621, 0x28f5d262, 0xf262c812, 0xc930287e,
+0x0875f162, 0xf362c9fc, 0xe13f0865, 0x93f8c500,
+0xc2ff66d4, 0x0422850f, 0xf1620000, 0x9c6f087f,
+0xffffc824, 0x7ff162ff, 0x24947f08, 0xffffff88,
+0x287df262, 0xf162cb30, 0xcfd52875, 0x287ef262,
+0x98248c30, 0x62ffffff, 0x3c086df2, 0xff98248c,
+0xf262ffff, 0x9438086d, 0xffff9824, 0x7ff162ff,
+0x24947f08, 0xffffff98, 0x0875f162, 0x98248cfc,
+0x62ffffff, 0xfc084df1, 0x063db8d3, 0xf2620000,
+0xc930287d, 0x2875f162, 0xf262cfd5, 0xc930287e,
+0x0875f362, 0xc500ea3f, 0x66d593f8, 0x850fc2ff,
+0x00000398, 0x087df262, 0x88248c1c, 0x62ffffff,
+0x3f0875f3, 0x44b800f6, 0xc5000006, 0x66d693f8,
+0x850fc2ff, 0x00000374, 0x087ff162, 0xb8248c6f,
+0x62ffffff, 0xf80865f1, 0x064eb8e4, 0xf2620000,
+0xe4000875, 0x085df362, 0xc500fb3f, 0x66d793f8,
+0x850fc2ff, 0x00000344, 0x0865f162, 0x44c6c9fc,
+0xb8110824, 0x0000065d, 0x087df262, 0x08245478,
+0x086df362, 0xc500c13f, 0x66d093f8, 0x850fc2ff,
+0x00000318, 0x000011b8, 0x7df26200, 0x62d07a08,
+0x3f086df3, 0x61b800d1, 0xc5000006, 0x66d293f8,
+0x850fc2ff, 0x000002f4, 0x0865f162, 0xb8248c60,
+0x62ffffff, 0x680865f1, 0xffb8249c, 0xf162ffff,
+0xcbf80875, 0x082444c6, 0x06a6b808, 0xf2620000,
+0xc930287d, 0x2875f162, 0xf262cfd5, 0x5c78087d,
+0xf2620824, 0xc930287e, 0x0875f362, 0xc500db3f,
+0x66d393f8, 0x850fc2ff, 0x000002a0, 0x087ff162,
+0xb824a46f, 0x62ffffff, 0x30287df2, 0x45f162cc,
+0x62d1d528, 0xef0875f1, 0x64f1c5c9, 0x7ef262ed,
+0x62d23028, 0x7f087ff1, 0xff882494, 0xf162ffff,
+0xd560086d, 0x087ff162, 0x8824b46f, 0x62ffffff,
+0x20087df2, 0x65f362de, 0x00e23f08, 0x0006b3b8,
+0x93f8c500, 0xc2ff66d4, 0x023e850f, 0xf1620000,
+0xcd600855, 0x0865f162, 0xf162d960, 0xbc6f087f,
+0xffff8824, 0x7df262ff, 0x62d72108, 0x3f086df3,
+0xbbb800eb, 0xc5000006, 0x66d593f8, 0x850fc2ff,
+0x00000208, 0x0875f162, 0xf162c960, 0xc960086d,
+0x087ff162, 0x98248c7f, 0x62ffffff, 0x6f087ff1,
+0xff8824ac, 0xf262ffff, 0xd522087d, 0x087ff162,
+0xa824947f, 0x62ffffff, 0x3f086df3, 0xc4b800f1,
+0xc5000006, 0x66d693f8, 0x850fc2ff, 0x000001bc,
+0x087ff162, 0xf824a47f, 0x62ffffff, 0x6f087ff1,
+0xfff824b4, 0xf262ffff, 0xce20087d, 0x087ff162,
+0x88248c7f, 0x62ffffff, 0x6f087ff1, 0xff8824bc,
+0xf262ffff, 0xf930087e, 0x087ff162, 0x08248c7f,
+0x31000000, 0x7c8a40c0, 0x3840b804, 0x7408047c,
+0x06f1b80a, 0x61e90000, 0x48000001, 0x8348c0ff,
+0xe17508f8, 0x087ff162, 0xf824a47f, 0x62ffffff,
+0x6f087ff1, 0xfff824ac, 0xf262ffff, 0xcd21087d,
+0x087ff162, 0x88248c7f, 0x62ffffff, 0x6f087ff1,
+0xff8824b4, 0xf262ffff, 0xf131087e, 0x087ff162,
+0x08248c7f, 0x31000000, 0x748a40c0, 0x3840b804,
+0x74080474, 0x0700b80a, 0xfde90000, 0x48000000,
+0x8348c0ff, 0xe17504f8, 0x087ff162, 0xf824a47f,
+0x62ffffff, 0x6f087ff1, 0xfff824bc, 0xf262ffff,
+0xcf22087d, 0x087ff162, 0x88248c7f, 0x62ffffff,
+0x6f087ff1, 0xff8824ac, 0xf262ffff, 0xe932087e,
+0x087ff162, 0x08248c7f, 0x8a000000, 0x38b82444,
+0x75082444, 0x24448a1c, 0x244438b9, 0x62127509,
+0x7f087ff1, 0xff9824a4, 0x01b8ffff, 0xeb000000,
+0x070fb80a, 0x81e90000, 0x8a000000, 0x88c80454,
+0x48980454, 0x4802c083, 0x7511f883, 0x7ff162ee,
+0x248c6f08, 0xffffffb8, 0xffaaaab8, 0x92f8c5ff,
+0x073ab8c8, 0xf2620000, 0x94660975, 0xffffc824,
+0x6df362ff, 0x248c3f08, 0xffffff98, 0x93f8c500,
+0xc7ff66f9, 0xf3623675, 0xd10f8975, 0x75f16201,
+0x390ddb08, 0x62000000, 0xfc0875f1, 0x00001f0d,
+0x0000ba00, 0xf3620000, 0xf93f086d, 0x93f8c500,
+0xc0ff66c7, 0x00074ab8, 0xc2440f00, 0x0000c3c9,
+0x01010101, 0x01010101, 0x01010101, 0x01010101,
+0x0f0f0f0f, 0x0f0f0f0f, 0x0f0f0f0f, 0x0f0f0f0f,
+0003020,
+};
+asm(".type avx512bw_x86_64_D_16i1, STT_NOTYPE;");
+asm(".type avx512bw_x86_64_D_16i1, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512bw_x86_64_D_16u1[] = {
+0xb85500eb, 0x00000001, 0x000008b9, 0x11b74000,
+0x48e58948, 0x8918ec83, 0xff508dfe, 0xb7044488,
+0x8840c629, 0x89c70474, 0x83c221d6, 0xceff01e6,
+0x8301fa83, 0x884000d9, 0x88d70474, 0x48e7044c,
+0x8348c0ff, 0xcf7511f8, 0x087ff162, 0xb8248c6f,
+0x62ffffff, 0x7f087ff1, 0xff88248c, 0xf162ffff,
+0x946f087f, 0xffff8824, 0x0539b8ff, 0xf3620000,
+0xc13f086d, 0x93f8c500, 0xc2ff66d0, 0x0503850f,
+0xf1620000, 0x8cfc086d, 0xffffb824, 0x7ff162ff,
+0x248c7f08, 0xffffff98, 0x087ff162, 0xb8249c6f,
+0x62ffffff, 0x6f087ff1, 0xff98248c, 0x3fb8ffff,
+0x62000005, 0xfc0865f1, 0x75f362db, 0x00d33f08,
+0xd293f8c5, 0x0fc2ff66, 0x0004b885, 0x75f16200,
+0x248cf808, 0xffffffb8, 0x087ff162, 0xa8248c7f,
+0x62ffffff, 0x6f087ff1, 0xffa8249c, 0x44b8ffff,
+0x62000005, 0x3f086df3, 0xf8c500db, 0xff66d393,
+0x7e850fc2, 0x62000004, 0xeb086df1, 0xffc82494,
+0xf162ffff, 0x947f087f, 0xffff8824, 0x75f162ff,
+0x248cdb08, 0xffffffc8, 0x0865f162, 0xc8249cef,
+0x62ffffff, 0xdf0875f1, 0xff88248c, 0x50b8ffff,
+0x62000005, 0x3f0875f3, 0xf8c500e3, 0xff66d493,
+0x2e850fc2, 0x62000004, 0xef085df1, 0x7ff162e4,
+0x249c6f08, 0xffffffb8, 0xc976f1c5, 0x6474d9c5,
+0xf162e824, 0xd36f087f, 0x0875f362, 0x6240d425,
+0x30287df2, 0xffe824a4, 0xf262ffff, 0xd230287d,
+0x28edf262, 0xf262e412, 0xe430287e, 0x0875f162,
+0xe824acfc, 0x62ffffff, 0x7f087ff1, 0xffe824ac,
+0xf262ffff, 0xac30287d, 0xffffe824, 0x0621b8ff,
+0xf2620000, 0xd51228ed, 0x287ef262, 0xf162d230,
+0xd2fc086d, 0x085df362, 0xc500ea3f, 0x66d593f8,
+0x850fc2ff, 0x0000039d, 0x0865f162, 0xc82494da,
+0x62ffffff, 0xde0865f1, 0xffc824a4, 0xf162ffff,
+0x9cfc0865, 0xffffc824, 0x6df162ff, 0xb8d4fc08,
+0x00000634, 0x086df362, 0xc500f33f, 0x66d693f8,
+0x850fc2ff, 0x0000035d, 0x087ff162, 0xc824946f,
+0x62ffffff, 0x6f087ff1, 0xffb8249c, 0x4eb8ffff,
+0x62000006, 0xfc086df1, 0x65f262e1, 0x62e40008,
+0x3f085df3, 0xf8c500fa, 0xff66d793, 0x22850fc2,
+0x62000003, 0xfc086df1, 0x2444c6db, 0x5db81108,
+0x62000006, 0x78087df2, 0x62082464, 0x3f085df3,
+0xf8c500c3, 0xff66d093, 0xf6850fc2, 0xb8000002,
+0x00000011, 0x087df262, 0xf362e07a, 0xd33f085d,
+0x0661b800, 0xf8c50000, 0xff66d293, 0xd2850fc2,
+0x62000002, 0x60086df1, 0xffb8249c, 0xf162ffff,
+0x9468086d, 0xffffb824, 0x75f162ff, 0xc6cafc08,
+0x08082444, 0x0006a6b8, 0x6df36200, 0x24942508,
+0xffffffd8, 0x75f16255, 0x62cbf808, 0xef0875f1,
+0xffd8248c, 0xf162ffff, 0xcaf80875, 0x087df262,
+0x08245478, 0x0875f362, 0xc500da3f, 0x66d393f8,
+0x850fc2ff, 0x0000026d, 0x087df262, 0xf7245c30,
+0x087df262, 0xf162cb30, 0x9c7f087f, 0xffff9824,
+0x7ff162ff, 0x248c7f08, 0xffffffa8, 0x087ff162,
+0xb824b46f, 0x62ffffff, 0x30087df2, 0x6df362d6,
+0x00e33f08, 0x0006d3b8, 0x93f8c500, 0xc2ff66d4,
+0x021f850f, 0xf1620000, 0xbc6f087f, 0xffffb824,
+0x7df262ff, 0x62d73108, 0x3f086df3, 0xdab800e9,
+0xc5000006, 0x66d593f8, 0x850fc2ff, 0x000001f5,
+0x087ff162, 0xb824b46f, 0x62ffffff, 0x32087df2,
+0x7df262d6, 0xb8c93008, 0x000006e1, 0x086df362,
+0xc500f13f, 0x66d693f8, 0x850fc2ff, 0x000001c5,
+0x087ff162, 0xb8248c6f, 0x62ffffff, 0x7f087ff1,
+0xfff8248c, 0xf162ffff, 0xbc6f087f, 0xfffff824,
+0x7df262ff, 0x62d73008, 0x7f087ff1, 0xff882494,
+0xf162ffff, 0xac6f087f, 0xffff8824, 0x7ef262ff,
+0x62ea3008, 0x7f087ff1, 0x00082494, 0xc0310000,
+0x047c8a40, 0x7c3840b8, 0x0a740804, 0x0006f1b8,
+0x015fe900, 0xff480000, 0xf88348c0, 0x62e17508,
+0x7f087ff1, 0xfff8248c, 0xf162ffff, 0xb46f087f,
+0xfffff824, 0x7df262ff, 0x62d63108, 0x7f087ff1,
+0xff882494, 0xf162ffff, 0xbc6f087f, 0xffff8824,
+0x7ef262ff, 0x62fa3108, 0x7f087ff1, 0x00082494,
+0xc0310000, 0xb8044c8a, 0x08044c38, 0x00b80a74,
+0xe9000007, 0x000000fd, 0x48c0ff48, 0x7504f883,
+0x7ff162e3, 0x248c7f08, 0xfffffff8, 0x087ff162,
+0xf824ac6f, 0x62ffffff, 0x32087df2, 0x7ff162d5,
+0x24947f08, 0xffffff88, 0x087ff162, 0x8824b46f,
+0x62ffffff, 0x32087ef2, 0x7ff162f2, 0x24947f08,
+0x00000008, 0xb824448a, 0x08244438, 0x448a1c75,
+0x4438b924, 0x12750924, 0x087ff162, 0x98248c7f,
+0xb8ffffff, 0x00000001, 0x0fb80aeb, 0xe9000007,
+0x00000081, 0xc804548a, 0x98045488, 0x02c08348,
+0x11f88348, 0xf162ee75, 0x8c6f087f, 0xffffb824,
+0xaaaab8ff, 0xf8c5ffff, 0x3ab8c892, 0x62000007,
+0x660975f2, 0xffc82494, 0xf362ffff, 0x8c3f086d,
+0xffff9824, 0xf8c500ff, 0xff66f993, 0x623675c7,
+0x0f8975f3, 0xf16201d1, 0x0ddb0875, 0x00000030,
+0x0875f162, 0x00360dfc, 0x00ba0000, 0x62000000,
+0x3f086df3, 0xf8c500f9, 0xff66c793, 0x074ab8c0,
+0x440f0000, 0x00c3c9c2, 0x00000000, 0x00000000,
+0x0f0f0f0f, 0x0f0f0f0f, 0x0f0f0f0f, 0x0f0f0f0f,
+0x01010101, 0x01010101, 0x01010101, 0x01010101,
+0002660,
+};
+asm(".type avx512bw_x86_64_D_16u1, STT_NOTYPE;");
+asm(".type avx512bw_x86_64_D_16u1, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512bw_x86_64_D_16i2[] = {
+0xb85500eb, 0x00000001, 0x000010b9, 0x09b94100,
+0x48000000, 0x8348e589, 0x708d28ec, 0xcf8944ff,
+0x45448966, 0x29f2899e, 0x01e283c7, 0x457c8966,
+0x01fa83ae, 0xe283d219, 0x85caff02, 0x940f40c6,
+0x548966c6, 0x0f40be45, 0xf129f6b6, 0x454c8966,
+0xc0ff48ce, 0x09f88348, 0xf162c075, 0x556f08ff,
+0xfff162fa, 0xf7557f08, 0x08fff162, 0xb8f74d6f,
+0x00000539, 0x08f5f362, 0xc500c23f, 0xfed093f8,
+0x73850fc2, 0x62000005, 0xfd0875f1, 0xf162fa55,
+0x557f08ff, 0xfff162f8, 0xf8556f08, 0x0865f162,
+0x01fa7571, 0x00053fb8, 0xedf36200, 0x00d33f08,
+0xd293f8c5, 0x850fc2fe, 0x0000053e, 0x086df162,
+0x62fa55f9, 0x7f08fff1, 0xf362f955, 0x5d3f08f5,
+0x44b800f9, 0xc5000005, 0xfed393f8, 0x17850fc2,
+0x62000005, 0x6f08fff1, 0xf162fb55, 0x4dd50875,
+0x6df162fa, 0x62d2d508, 0x6f08fff1, 0xf162fa6d,
+0x65fd0855, 0x55f162fb, 0xfb5df908, 0x0875f162,
+0x5bb8caf9, 0x62000005, 0xd50865f1, 0xf5f362dc,
+0x00e33f08, 0xd493f8c5, 0x850fc2fe, 0x000004ca,
+0x0855f162, 0x62fb4dd5, 0x3f08f5f3, 0x0004be2d,
+0xc8b80000, 0xc5000005, 0xfed593f8, 0xa7850fc2,
+0x62000004, 0xe50855f1, 0xf162fc55, 0x4d6f08ff,
+0x05cfb8fc, 0xf1620000, 0xe1710865, 0xedf3620f,
+0x00f33f08, 0xd693f8c5, 0x850fc2fe, 0x0000047a,
+0x0875f162, 0xf162d5d5, 0x557f08ff, 0x6df162f9,
+0xf9757108, 0xfff16203, 0xf7557f08, 0x0865f162,
+0x02f97571, 0x0865f162, 0xedb8e3fd, 0x62000005,
+0x3f08edf3, 0xf8c500fc, 0xc2fed793, 0x0438850f,
+0xf1620000, 0x6571086d, 0xf16202f7, 0xd2fd086d,
+0x0005f2b8, 0xe5f36200, 0x00c23f08, 0xd093f8c5,
+0x850fc2fe, 0x00000412, 0xff6c85c7, 0x0003ffff,
+0xf1620000, 0xd9d50855, 0x6c856348, 0x62ffffff,
+0x6e08fdf1, 0x65f162d0, 0xc7d2f108, 0xffff6c85,
+0x000002ff, 0x85634800, 0xffffff6c, 0x08fdf162,
+0xf162f86e, 0xdff10865, 0x0865f162, 0x05b8e3fd,
+0x62000006, 0x3f08edf3, 0xf8c500d4, 0xc2fed293,
+0x03b4850f, 0x63480000, 0xffff6c85, 0xfdf162ff,
+0x62f06e08, 0xe1086df1, 0x6df162d6, 0xb8d2fd08,
+0x00000609, 0x08e5f362, 0xc500da3f, 0xfed393f8,
+0x83850fc2, 0x62000003, 0x6f08fff1, 0xf162fd7d,
+0xd2ef086d, 0x08c5f362, 0x6206ca3f, 0xd58955f1,
+0xedf262d1, 0xfd751208, 0x08fff162, 0x036e1d6f,
+0xf1620000, 0x7d6f08ff, 0x45f162fd, 0x62e3f908,
+0x7f08fff1, 0xf262fd65, 0x551208ed, 0x0621b8fd,
+0xf1620000, 0xd2fd086d, 0x08cdf362, 0xc500e23f,
+0xfed493f8, 0x1f850fc2, 0x62000003, 0xd50875f1,
+0xf162fb55, 0xe5d50875, 0x08fff162, 0x62f8557f,
+0xee085df1, 0xf162f855, 0x65ea085d, 0xfff162f8,
+0xf8657f08, 0x086df162, 0x62f855fd, 0xfd0855f1,
+0x3db8fb65, 0x62000006, 0xd5086df1, 0xedf362d1,
+0x00ec3f08, 0xd593f8c5, 0x850fc2fe, 0x000002ca,
+0x0855f162, 0xf162d1d5, 0x557f08ff, 0x7df262f7,
+0xf7551d08, 0x000644b8, 0xedf36200, 0x00f53f08,
+0xd693f8c5, 0x850fc2fe, 0x0000029e, 0x087ff162,
+0x1bfa6570, 0x08fff162, 0xb8fb556f, 0x0000064e,
+0x087ef162, 0x621be470, 0x70087df1, 0xf3624ee4,
+0xfa3f08dd, 0x93f8c500, 0x0fc2fed7, 0x00026985,
+0xfff16200, 0xfa656f08, 0x086df162, 0x53b8dbf9,
+0x62000006, 0x8d08e5f2, 0xe5f362dc, 0x00c23f08,
+0xd093f8c5, 0x850fc2fe, 0x0000023e, 0x086df162,
+0xc766dcfd, 0x0009f045, 0x00065db8, 0x7df26200,
+0xf8657908, 0x08ddf362, 0xc500d33f, 0xfed293f8,
+0x13850fc2, 0xb8000002, 0x00000009, 0x087df262,
+0xf362e07b, 0xdb3f08dd, 0x0661b800, 0xf8c50000,
+0xc2fed393, 0x01f0850f, 0xf1620000, 0x5d61086d,
+0x6df162fa, 0xfa556908, 0x0865f162, 0xc766d2f9,
+0x0004f045, 0x0006a6b8, 0x6df16200, 0x62d1d508,
+0x79087df2, 0xf362f85d, 0xe33f08ed, 0x93f8c500,
+0x0fc2fed4, 0x0001b185, 0x75f16200, 0xfa55d508,
+0x0875f162, 0x620fe171, 0x7f08fff1, 0xf162f755,
+0xd961086d, 0x08fff162, 0x62f7756f, 0x23087df2,
+0xedf362d6, 0x00eb3f08, 0x0006b3b8, 0x93f8c500,
+0x0fc2fed5, 0x00017185, 0x75f16200, 0x62c96108,
+0x61086df1, 0xfff162c9, 0xf84d7f08, 0x08fff162,
+0x62f7756f, 0x24087df2, 0xfff162d6, 0xf9557f08,
+0x08edf362, 0xb800f13f, 0x000006bb, 0xd693f8c5,
+0x850fc2fe, 0x00000132, 0x08fff162, 0x62fa4d6f,
+0x7f08fff1, 0xf162fe4d, 0x7d6f08ff, 0x7df262fe,
+0x62d72308, 0x7f08fff1, 0xf162f755, 0x756f08ff,
+0x7ef262f7, 0x62f23308, 0x7f08fff1, 0xc031ff55,
+0x054c8b66, 0x4c3966a0, 0x0a74f005, 0x0006f1b8,
+0x00e4e900, 0x83480000, 0x834802c0, 0xe07508f8,
+0x08fff162, 0x62fe4d7f, 0x6f08fff1, 0xf262fe7d,
+0xd724087d, 0x08fff162, 0x62f7557f, 0x6f08fff1,
+0xf262f76d, 0xea34087e, 0x08fff162, 0x8bff557f,
+0x3966a045, 0x850ff045, 0x00000099, 0xa2458b66,
+0xf2453966, 0x008b850f, 0x8b660000, 0xf162b245,
+0x4d7f08ff, 0x458966f8, 0x458b6682, 0x458966b6,
+0x458b6686, 0x458966ba, 0x458b668a, 0x458966be,
+0xfff1628e, 0xfa4d6f08, 0xf8c5aab0, 0x3ab8c892,
+0x62000007, 0x6609f5f2, 0xf362fb55, 0x7d3f08ed,
+0xf8c500f8, 0xc2fed793, 0xf4c54075, 0xf362c946,
+0xd10f8975, 0x0000ba02, 0xf1620000, 0x0ddb0875,
+0x0000004c, 0x0875f162, 0x00320dfd, 0xf3620000,
+0xc13f08ed, 0x93f8c500, 0xb8c0fec0, 0x0000074a,
+0xebc2440f, 0x0700b805, 0xc3c90000, 0x00000000,
+0x000e0008, 0x00140012, 0x00120014, 0x0008000e,
+0x00010001, 0x00010001, 0x00010001, 0x00010001,
+0x00070007, 0x00070007, 0x00070007, 0x00070007,
+0003060,
+};
+asm(".type avx512bw_x86_64_D_16i2, STT_NOTYPE;");
+asm(".type avx512bw_x86_64_D_16i2, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512bw_x86_64_D_16u2[] = {
+0xb85500eb, 0x00000001, 0x000010ba, 0x09b94100,
+0x48000000, 0x8348e589, 0x708d28ec, 0xcf8944ff,
+0x45448966, 0x29f1899e, 0x01e183c7, 0x457c8966,
+0x85c9ffae, 0x940f40c6, 0x4c8966c6, 0x0f40be45,
+0xf229f6b6, 0x45548966, 0xc0ff48ce, 0x09f88348,
+0xf162c875, 0x4d6f08ff, 0xfff162fa, 0xf74d7f08,
+0x08fff162, 0xb8f7556f, 0x00000539, 0x08edf362,
+0xc500c13f, 0xfed093f8, 0xf2850fc2, 0x62000004,
+0xfd086df1, 0xf162fa4d, 0x4d7f08ff, 0xfff162f8,
+0xf84d6f08, 0x0865f162, 0x01fa7571, 0x00053fb8,
+0xf5f36200, 0x00d33f08, 0xd293f8c5, 0x850fc2fe,
+0x000004bd, 0x0875f162, 0x62fa4df9, 0x7f08fff1,
+0xf162f94d, 0x5d6f08ff, 0x0544b8f9, 0xf3620000,
+0xdb3f08ed, 0x93f8c500, 0x0fc2fed3, 0x00049085,
+0x6df16200, 0xfb55eb08, 0x08fff162, 0x62f7557f,
+0xdb0875f1, 0xf162fb4d, 0x5def0865, 0x75f162fb,
+0xf74ddf08, 0x000550b8, 0xf5f36200, 0x00e33f08,
+0xd493f8c5, 0x850fc2fe, 0x00000455, 0x08fff162,
+0x62fa556f, 0xd5086df1, 0xf362fb4d, 0x2d3f08f5,
+0x0000044b, 0x05c8b800, 0xf8c50000, 0xc2fed593,
+0x042b850f, 0xf1620000, 0x5de4086d, 0xfff162fc,
+0xfc656f08, 0x0005d1b8, 0x6df16200, 0x62ccdb08,
+0xfd0875f1, 0xe5f362cc, 0x00f13f08, 0xd693f8c5,
+0x850fc2fe, 0x000003f9, 0x08fff162, 0x62f9557f,
+0x710875f1, 0x6203f975, 0x7f08fff1, 0xf162f74d,
+0x75710865, 0xf16202f9, 0xebfd0865, 0x0005edb8,
+0xf5f36200, 0x00fd3f08, 0xd793f8c5, 0x850fc2fe,
+0x000003bd, 0x0875f162, 0x02f75571, 0x0875f162,
+0xf2b8c9fd, 0x62000005, 0x3f08e5f3, 0xf8c500c1,
+0xc2fed093, 0x0397850f, 0x85c70000, 0xffffff6c,
+0x00000003, 0x087df162, 0x62db4d6e, 0xf1086df1,
+0x6c85c7c9, 0x02ffffff, 0x62000000, 0x6e087df1,
+0xf162db5d, 0xdbf1086d, 0x0865f162, 0x05b8ebfd,
+0x62000006, 0x3f08f5f3, 0xf8c500d5, 0xc2fed293,
+0x034b850f, 0xf1620000, 0x6d6e087d, 0x75f162db,
+0x62cdd108, 0xfd0875f1, 0x0609b8c9, 0xf3620000,
+0xd93f08e5, 0x93f8c500, 0x0fc2fed3, 0x00032085,
+0x55f16200, 0xc5edef08, 0x62c976f1, 0x6f08fff1,
+0x75d1c5da, 0xf362d06d, 0xdd250875, 0xe5f26240,
+0xfd6d1208, 0x0875f162, 0x62fd75fd, 0x7f08fff1,
+0xf262fd75, 0x5d1208e5, 0x0621b8fd, 0xf1620000,
+0xdbfd0865, 0x08d5f362, 0xc500e33f, 0xfed493f8,
+0xca850fc2, 0x62000002, 0x3a086df2, 0xf262fb5d,
+0x6d3e086d, 0x6df162fb, 0xfb55fd08, 0x0865f162,
+0x34b8ddfd, 0x62000006, 0x3f08e5f3, 0xf8c500ea,
+0xc2fed593, 0x0297850f, 0xf1620000, 0x5d70087f,
+0xf1621bfa, 0x556f08ff, 0x064eb8fb, 0xf1620000,
+0xdb70087e, 0x7df1621b, 0x4edb7008, 0x08e5f362,
+0xc500f23f, 0xfed693f8, 0x62850fc2, 0x62000002,
+0x6f08fff1, 0xf162fa5d, 0xe9fd086d, 0x000653b8,
+0xd5f26200, 0x62eb8d08, 0x3f08d5f3, 0xf8c500fa,
+0xc2fed793, 0x0237850f, 0xf1620000, 0xdbfd086d,
+0xf045c766, 0x5db80009, 0x62000006, 0x79087df2,
+0xf362f86d, 0xc33f08d5, 0x93f8c500, 0x0fc2fed0,
+0x00020c85, 0x0009b800, 0xf2620000, 0xe87b087d,
+0x08d5f362, 0xb800cb3f, 0x00000661, 0xd193f8c5,
+0x850fc2fe, 0x000001e9, 0x086df162, 0x62fa5d61,
+0x69086df1, 0xf162fa55, 0xcafd0875, 0xf045c766,
+0xa6b80004, 0x62000006, 0xf90875f1, 0x75f162cb,
+0x62ccef08, 0x25085df3, 0xf16255e4, 0xccf90875,
+0x087df262, 0x62f85579, 0x3f08f5f3, 0xf8c500d2,
+0xc2fed293, 0x0197850f, 0xf2620000, 0x5533087d,
+0x7df262f4, 0x62da3308, 0x7f08fff1, 0xf162f855,
+0x5d7f08ff, 0xfff162f9, 0xfa7d6f08, 0x087df262,
+0xf362cf33, 0xda3f08f5, 0x06d3b800, 0xf8c50000,
+0xc2fed393, 0x0157850f, 0xf1620000, 0x756f08ff,
+0x7df262fa, 0x62ce3408, 0x3f08f5f3, 0xdab800e3,
+0xc5000006, 0xfed493f8, 0x32850fc2, 0x62000001,
+0x6f08fff1, 0xf162fa4d, 0x4d7f08ff, 0xfff162fe,
+0xfe7d6f08, 0x087df262, 0xf162d733, 0x557f08ff,
+0xfff162f7, 0xf7756f08, 0x087ef262, 0xf162f233,
+0x557f08ff, 0x66c031ff, 0xa005748b, 0x05743966,
+0xb80a74f0, 0x000006f1, 0x0000e4e9, 0xc0834800,
+0xf8834802, 0x62e07508, 0x7f08fff1, 0xf162fe4d,
+0x7d6f08ff, 0x7df262fe, 0x62d73408, 0x7f08fff1,
+0xf162f755, 0x756f08ff, 0x7ef262f7, 0x62f23408,
+0x7f08fff1, 0x458bff55, 0x453966a0, 0x99850ff0,
+0x66000000, 0x66a2458b, 0x0ff24539, 0x00008b85,
+0x458b6600, 0xfff162b2, 0xf84d7f08, 0x82458966,
+0xb6458b66, 0x86458966, 0xba458b66, 0x8a458966,
+0xbe458b66, 0x8e458966, 0x08fff162, 0xb0fa4d6f,
+0x92f8c5aa, 0x073ab8c8, 0xf2620000, 0x556609f5,
+0xedf362fb, 0xf86d3f08, 0x93f8c500, 0x75c2fed5,
+0x46f4c540, 0x75f362c9, 0x02d10f89, 0x000000ba,
+0x75f16200, 0x450ddb08, 0x62000000, 0xfd0875f1,
+0x00004b0d, 0xedf36200, 0x00f13f08, 0xc693f8c5,
+0x4ab8c0fe, 0x0f000007, 0x05ebc244, 0x000700b8,
+0x00c3c900, 0x00000000, 0x00000000, 0x00000000,
+0x000e0008, 0x00140012, 0x00120014, 0x0008000e,
+0x00070007, 0x00070007, 0x00070007, 0x00070007,
+0x00010001, 0x00010001, 0x00010001, 0x00010001,
+0002660,
+};
+asm(".type avx512bw_x86_64_D_16u2, STT_NOTYPE;");
+asm(".type avx512bw_x86_64_D_16u2, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512bw_x86_64_D_32i1[] = {
+0xb85500eb, 0x00000001, 0x000008be, 0x21b74000,
+0x48e58948, 0x48e0e483, 0x00a8ec81, 0xfa890000,
+0x88ff488d, 0x29070444, 0x045488c2, 0x83ca8927,
+0xfa8301e2, 0x21d21901, 0x02e283c1, 0xf983caff,
+0x00de8301, 0x47045488, 0x04748840, 0xc0ff4867,
+0x21f88348, 0xf162c875, 0xbc6f287f, 0x00000824,
+0x7ff16200, 0x24bc7f28, 0xffffffa8, 0x287ff162,
+0xa8249c6f, 0xb8ffffff, 0x00000539, 0x2865f362,
+0xc500c73f, 0xffd093fb, 0x16850fc2, 0x62000004,
+0xfc2865f1, 0x0008248c, 0xf1620000, 0x8c7f287f,
+0xffffc824, 0x7ff162ff, 0x24ac6f28, 0x00000008,
+0x287ff162, 0xc8248c6f, 0xb8ffffff, 0x0000053f,
+0x2855f162, 0xf362d5fc, 0xd23f2875, 0x93fbc500,
+0x0fc2ffd2, 0x0003cc85, 0x75f16200, 0x248cf828,
+0x00000008, 0x287ff162, 0xe8248c7f, 0x62ffffff,
+0x3f2865f3, 0xffe8249c, 0xb800ffff, 0x00000544,
+0xd393fbc5, 0x850fc2ff, 0x00000399, 0x287ff162,
+0x08249c6f, 0x62000000, 0x30487df2, 0x004824ac,
+0xf1620000, 0xc9ef0875, 0x287ff162, 0x6824bc6f,
+0x62000000, 0x30487df2, 0x6df162d3, 0xc5d5d548,
+0x62c964c5, 0x30487ef2, 0x75f162d2, 0x62cadb28,
+0x30487df2, 0x006824a4, 0xf2620000, 0xc930487d,
+0x48f5f262, 0xf262e412, 0xe430487e, 0xf16201b0,
+0xbc6f287f, 0x00006824, 0x7df26200, 0x62f07a28,
+0xf82845f1, 0x7ff162f6, 0x24b47f28, 0x00000068,
+0x487df262, 0x6824b430, 0xb8000000, 0x00000621,
+0x48f5f262, 0xf262ce12, 0xc930487e, 0x2875f162,
+0xf362c9fc, 0xe13f285d, 0x93fbc500, 0x0fc2ffd4,
+0x0002e085, 0x7df26200, 0x248c3048, 0x00000028,
+0x287ff162, 0xa824947f, 0x62ffffff, 0xd54875f1,
+0x7ef262cd, 0x248c3048, 0xffffffc8, 0x286df262,
+0xc8248c3c, 0x62ffffff, 0x7f287ff1, 0xffe8248c,
+0xf262ffff, 0x9438286d, 0xffffc824, 0x7ff162ff,
+0x24947f28, 0xffffffc8, 0x2875f162, 0xc8248cfc,
+0x62ffffff, 0xfc2865f1, 0x00282494, 0x3db80000,
+0x62000006, 0x30487df2, 0x75f162c9, 0x62cdd548,
+0x30487ef2, 0x75f362c9, 0x00ea3f28, 0xd593fbc5,
+0x850fc2ff, 0x0000024d, 0x287df262, 0xa8248c1c,
+0x62ffffff, 0x3f2875f3, 0x44b800f3, 0xc5000006,
+0xffd693fb, 0x2a850fc2, 0xc6000002, 0x00882484,
+0xb8210000, 0x0000065d, 0x287df262, 0x88248c78,
+0x62000000, 0x3f2875f3, 0xfbc500fa, 0xc2ffd793,
+0x01ff850f, 0x21b80000, 0x62000000, 0x7a287df2,
+0x75f362c8, 0x00c23f28, 0x000661b8, 0x93fbc500,
+0x0fc2ffd0, 0x0001dc85, 0x7ff16200, 0x249c7f28,
+0x00000088, 0x948ac031, 0x00008804, 0xc0ff4800,
+0x97045488, 0x10f88348, 0xf262ec75, 0x8c20287d,
+0xffff9824, 0x7ff162ff, 0x248c7f28, 0xffffffa8,
+0x287ff162, 0xa824a46f, 0x62ffffff, 0x30287ef2,
+0x008824a4, 0xc0310000, 0x047c8a40, 0xbc384008,
+0x00008804, 0xb80a7400, 0x000006f1, 0x000174e9,
+0xc0ff4800, 0x10f88348, 0xf162de75, 0x9c7f287f,
+0x00008824, 0x8ac03100, 0x00880494, 0x54880000,
+0xff489804, 0xf88348c0, 0x62ec7508, 0x6f087ff1,
+0xff9824ac, 0xf262ffff, 0xcd21287d, 0x287ff162,
+0xa8248c7f, 0x62ffffff, 0x6f287ff1, 0xffa824b4,
+0xf262ffff, 0xf131287e, 0x087ff162, 0x88248c7f,
+0x31000000, 0x748a40c0, 0x38400804, 0x008804b4,
+0x0a740000, 0x000700b8, 0x00f7e900, 0xff480000,
+0xf88348c0, 0x62de7508, 0xef0875f1, 0x75f362c9,
+0x244c2008, 0xf3620008, 0x4c200875, 0x62010924,
+0x200875f3, 0x020a244c, 0x0875f362, 0x0b244c20,
+0x7ff16203, 0x248c7f08, 0xffffff98, 0x087ff162,
+0x9824bc6f, 0x62ffffff, 0x22287df2, 0x7ff162cf,
+0x248c7f28, 0xffffffa8, 0x287ff162, 0xa824a46f,
+0x62ffffff, 0x32287ef2, 0x7ff162e1, 0x248c7f08,
+0x00000088, 0x8a40c031, 0x4008047c, 0x8804bc38,
+0x74000000, 0x070fb807, 0x69eb0000, 0x48c0ff48,
+0x7504f883, 0x7ff162e1, 0x249c7f28, 0xffffffc8,
+0x000001b8, 0x04548a00, 0x04548828, 0xc08348c8,
+0xf8834802, 0x62ee7521, 0x6f287ff1, 0x000824ac,
+0xaab80000, 0xbaaaaaaa, 0x00000000, 0xc892fbc5,
+0x2955f262, 0x28248c66, 0x62000000, 0x3f2875f3,
+0xffc8248c, 0xc500ffff, 0xffc193fb, 0x073ab8c0,
+0x440f0000, 0x00c3c9c2,
+0002247,
+};
+asm(".type avx512bw_x86_64_D_32i1, STT_NOTYPE;");
+asm(".type avx512bw_x86_64_D_32i1, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512bw_x86_64_D_32u1[] = {
+0xb85500eb, 0x00000001, 0x000008ba, 0x21b64000,
+0x48e58948, 0x48e0e483, 0x0088ec81, 0xf1890000,
+0x07044488, 0x4c88c129, 0x488d2704, 0x83c121ff,
+0xda8301f9, 0x04548800, 0xc0ff4847, 0x21f88348,
+0xf162dc75, 0xac6f287f, 0x00000824, 0x7ff16200,
+0x24ac7f28, 0xffffffa8, 0x287ff162, 0xa824946f,
+0xb8ffffff, 0x00000539, 0x286df362, 0xc500c53f,
+0xffd093fb, 0xd7850fc2, 0x62000003, 0xfc286df1,
+0x0008248c, 0xf1620000, 0x8c7f287f, 0xffffc824,
+0x7ff162ff, 0x24b46f28, 0x00000008, 0x287ff162,
+0xc8248c6f, 0xb8ffffff, 0x0000053f, 0x284df162,
+0xf362defc, 0xd33f2875, 0x93fbc500, 0x0fc2ffd2,
+0x00038d85, 0x75f16200, 0x248cf828, 0x00000008,
+0x287ff162, 0xe8248c7f, 0x62ffffff, 0x6f287ff1,
+0xffe8249c, 0x44b8ffff, 0x62000005, 0x3f286df3,
+0xfbc500db, 0xc2ffd393, 0x0354850f, 0xf1620000,
+0x94eb286d, 0x00002824, 0x7ff16200, 0x24947f28,
+0xffffffa8, 0x2875f162, 0x28248cdb, 0x62000000,
+0xef2865f1, 0x0028249c, 0xf1620000, 0x8cdf2875,
+0xffffa824, 0x0550b8ff, 0xf3620000, 0xe33f2875,
+0x93fbc500, 0x0fc2ffd4, 0x00030585, 0x65f16200,
+0x62dbef08, 0x6f287ff1, 0x00082494, 0xddc50000,
+0xe5c5e476, 0x48245c74, 0x287ff162, 0xf362ca6f,
+0xcb25285d, 0x7ff16240, 0x248c7f28, 0xffffffe8,
+0x487df262, 0x48249c30, 0x62000000, 0x30487df2,
+0xf5f262c9, 0x62db1248, 0x30487ef2, 0x5df162db,
+0x24a4fc28, 0x00000048, 0x287ff162, 0x4824a47f,
+0x62000000, 0x30487df2, 0x004824a4, 0x21b80000,
+0x62000006, 0x1248f5f2, 0x7ef262cc, 0x62c93048,
+0xfc2875f1, 0x65f362c9, 0x00e93f28, 0xd593fbc5,
+0x850fc2ff, 0x0000026a, 0x286df162, 0x28248cda,
+0x62000000, 0x7f287ff1, 0xffa8248c, 0xf162ffff,
+0xa4de286d, 0x00002824, 0x7ff16200, 0x24a47f28,
+0xffffffc8, 0x286df162, 0x28249cfc, 0x62000000,
+0xfc2875f1, 0x0634b8cc, 0xf3620000, 0xf33f2875,
+0x93fbc500, 0x0fc2ffd6, 0x00021585, 0x2444c600,
+0x5db82168, 0x62000006, 0x78287df2, 0x6268244c,
+0x3f2875f3, 0xfbc500fb, 0xc2ffd793, 0x01f0850f,
+0x21b80000, 0x62000000, 0x7a287df2, 0x75f362c8,
+0x00c33f28, 0x000661b8, 0x93fbc500, 0x0fc2ffd0,
+0x0001cd85, 0x7ff16200, 0x24947f28, 0x00000068,
+0x548ac031, 0xff486804, 0x045488c0, 0xf8834897,
+0x62ef7510, 0x30287df2, 0xff98248c, 0xf162ffff,
+0x8c7f287f, 0xffffa824, 0x7ff162ff, 0x24bc6f28,
+0xffffffa8, 0x287ef262, 0x6824bc30, 0x31000000,
+0x7c8a40c0, 0x38400804, 0x7468047c, 0x06f1b80a,
+0x6be90000, 0x48000001, 0x8348c0ff, 0xe17510f8,
+0x287ff162, 0x6824947f, 0x31000000, 0x04548ac0,
+0x04548868, 0xc0ff4898, 0x08f88348, 0xf162ef75,
+0xac6f087f, 0xffff9824, 0x7df262ff, 0x62cd3128,
+0x7f287ff1, 0xffa8248c, 0xf162ffff, 0xb46f287f,
+0xffffa824, 0x7ef262ff, 0x62f13128, 0x7f087ff1,
+0x0068248c, 0xc0310000, 0x04748a40, 0x74384008,
+0x0a746804, 0x000700b8, 0x00f4e900, 0xff480000,
+0xf88348c0, 0x62e17508, 0xef0875f1, 0x75f362c9,
+0x244c2008, 0xf3620008, 0x4c200875, 0x62010924,
+0x200875f3, 0x020a244c, 0x0875f362, 0x0b244c20,
+0x7ff16203, 0x248c7f08, 0xffffff98, 0x087ff162,
+0x9824bc6f, 0x62ffffff, 0x32287df2, 0x7ff162cf,
+0x248c7f28, 0xffffffa8, 0x287ff162, 0xa824ac6f,
+0x62ffffff, 0x32287ef2, 0x7ff162e9, 0x248c7f08,
+0x00000068, 0x8a40c031, 0x4008047c, 0x68047c38,
+0x0fb80774, 0xeb000007, 0xc0ff4869, 0x04f88348,
+0xf162e475, 0x947f287f, 0xffffc824, 0x0001b8ff,
+0x548a0000, 0x54882804, 0x8348c804, 0x834802c0,
+0xee7521f8, 0x287ff162, 0x0824b46f, 0xb8000000,
+0xaaaaaaaa, 0x000000ba, 0x92fbc500, 0x4df262c8,
+0x248c6629, 0x00000028, 0x2875f362, 0xc8248c3f,
+0x00ffffff, 0xc193fbc5, 0x3ab8c0ff, 0x0f000007,
+0xc3c9c244,
+0002124,
+};
+asm(".type avx512bw_x86_64_D_32u1, STT_NOTYPE;");
+asm(".type avx512bw_x86_64_D_32u1, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512bw_x86_64_D_32i2[] = {
+0x315500eb, 0xc03145c0, 0x000010bf, 0x10bb4100,
+0x48000000, 0x4853e589, 0x48e0e483, 0x00e8ec81,
+0x44c70000, 0x00109424, 0xc6890000, 0x8dd98945,
+0xc1890158, 0x4101e683, 0x8d44c129, 0xc2890150,
+0x1901fe83, 0x02e683f6, 0xc385ceff, 0xcfff0575,
+0x8301b041, 0xe9d101e2, 0x44748966, 0x04e2c148,
+0x54894466, 0xca090844, 0x4c894466, 0x89662844,
+0x00884494, 0xc2830000, 0x7c896608, 0x89666844,
+0x00a84494, 0xff480000, 0xf88348c0, 0x459b7510,
+0x0474c084, 0x94247c89, 0x28fff162, 0x0824bc6f,
+0x62000000, 0x7f28fff1, 0xffa824bc, 0xf162ffff,
+0x8c6f28ff, 0xffffa824, 0x0539b8ff, 0xf3620000,
+0xc73f28f5, 0x93f8c500, 0xc2ff66d0, 0x0745850f,
+0xf1620000, 0x94fd2875, 0x00000824, 0xfff16200,
+0x24947f28, 0xffffffc8, 0x28fff162, 0xc824946f,
+0x62ffffff, 0x712865f1, 0x000824b4, 0xb8010000,
+0x0000053f, 0x28edf362, 0xc500d33f, 0x66d293f8,
+0x850fc2ff, 0x000006ff, 0x286df162, 0x082494f9,
+0x62000000, 0x7f28fff1, 0xffe82494, 0xf362ffff,
+0x9c3f28f5, 0xffffe824, 0x44b800ff, 0xc5000005,
+0x66d393f8, 0x850fc2ff, 0x000006cb, 0x28fff162,
+0x2824b46f, 0x62000000, 0xd52875f1, 0x0008248c,
+0xf1620000, 0xd6d5284d, 0x28fff162, 0xc824947f,
+0x62ffffff, 0x6f28fff1, 0x000824ac, 0xf1620000,
+0xe6fd2855, 0x2855f162, 0x28249cf9, 0x62000000,
+0xf92875f1, 0x055bb8ca, 0xf1620000, 0xdcd52865,
+0x28f5f362, 0x6200e33f, 0x7f28fff1, 0xffe8249c,
+0xf8c5ffff, 0xff66d493, 0x58850fc2, 0x62000006,
+0xd52855f1, 0x0028248c, 0xf1620000, 0x8c7f28ff,
+0xffffa824, 0x44c766ff, 0x0010c824, 0x0ebfc031,
+0x48000000, 0xe424748d, 0x2444c766, 0x890010e6,
+0xf18948fa, 0x0366c229, 0x48c80454, 0x8966c129,
+0x48ca0454, 0x6602c083, 0x83481189, 0xdf750ef8,
+0x24548966, 0xfff162d8, 0x24bc6f28, 0xffffffa8,
+0x0005c8b8, 0x45f16200, 0x24ac7528, 0xffffffc8,
+0xd593f8c5, 0x0fc2ff66, 0x0005da85, 0x55f16200,
+0x2494e528, 0x00000048, 0x28fff162, 0x48248c6f,
+0xb8000000, 0x000005cf, 0x2865f162, 0x620fe171,
+0x3f28edf3, 0xf8c500f3, 0xff66d693, 0xa4850fc2,
+0x62000005, 0xd52875f1, 0x000824a4, 0xf1620000,
+0xa47f28ff, 0xffffe824, 0x6df162ff, 0x24b47128,
+0xffffffe8, 0xfff16203, 0x24947f28, 0xffffffa8,
+0x2865f162, 0xe824b471, 0x02ffffff, 0x2865f162,
+0xedb8f3fd, 0x62000005, 0x3f28edf3, 0xf8c500fe,
+0xff66d793, 0x4c850fc2, 0x62000005, 0x71286df1,
+0xffa824a4, 0x6202ffff, 0xfd286df1, 0x05f2b8d2,
+0xf3620000, 0xc23f28e5, 0x93f8c500, 0xc2ff66d0,
+0x0521850f, 0xf1620000, 0xd9d52855, 0x942444c7,
+0x00000003, 0x24446348, 0xfdf16294, 0x62d06e08,
+0xf12865f1, 0x2444c7d2, 0x00000294, 0x44634800,
+0xf1629424, 0xf06e08fd, 0x2865f162, 0xf162def1,
+0xf3fd2865, 0x000605b8, 0xedf36200, 0x00d63f28,
+0xd293f8c5, 0x0fc2ff66, 0x0004ca85, 0x44634800,
+0xf1629424, 0xf86e08fd, 0x286df162, 0xf162d7e1,
+0xd2fd286d, 0x000609b8, 0xe5f36200, 0x00da3f28,
+0xd393f8c5, 0x0fc2ff66, 0x00049a85, 0xfff16200,
+0x24b46f28, 0x00000068, 0x086df162, 0xf362d2ef,
+0xca3f28cd, 0x55f16206, 0x62d1d5a9, 0x1228edf2,
+0x006824b4, 0x01b80000, 0x62000000, 0x6f28fff1,
+0x006824bc, 0xf2620000, 0xd87b287d, 0x2845f162,
+0xf162dbf9, 0x9c7f28ff, 0x00006824, 0xedf26200,
+0x24941228, 0x00000068, 0x000621b8, 0x6df16200,
+0x62d2fd28, 0x3f28cdf3, 0xf8c500e2, 0xff66d493,
+0x20850fc2, 0x62000004, 0xd52875f1, 0x00282494,
+0xf1620000, 0x947f28ff, 0xffffc824, 0x5df162ff,
+0x2494ee28, 0xffffffc8, 0x285df162, 0xc824a4ea,
+0x62ffffff, 0x7f28fff1, 0xffc824a4, 0xf162ffff,
+0x94fd286d, 0xffffc824, 0x55f162ff, 0x249cfd28,
+0x00000028, 0x00063db8, 0x6df16200, 0x62d1d528,
+0x3f28edf3, 0xf8c500eb, 0xff66d593, 0xb4850fc2,
+0x62000003, 0xd52855f1, 0xfff162d1, 0x24947f28,
+0xffffffa8, 0x287df262, 0xa824941d, 0x62ffffff,
+0x3f28edf3, 0x44b800f5, 0xc5000006, 0x66d693f8,
+0x850fc2ff, 0x0000037f, 0x000001b8, 0xfff16200,
+0x24a46f28, 0x00000028, 0x28fff162, 0x08249c6f,
+0x62000000, 0x7b287df2, 0x0653b8d0, 0xf1620000,
+0xd2f9285d, 0x28edf262, 0xf362d38d, 0xfc3f28ed,
+0x93f8c500, 0xc2ff66d7, 0x0339850f, 0xf1620000,
+0xd3fd285d, 0x00065db8, 0x84c76600, 0x0000c824,
+0x62001100, 0x79287df2, 0x6264245c, 0x3f28e5f3,
+0xf8c500c2, 0xff66d093, 0x08850fc2, 0xb8000003,
+0x00000011, 0x287df262, 0xf362d87b, 0xca3f28e5,
+0x0661b800, 0xf8c50000, 0xff66d193, 0xe4850fc2,
+0x62000002, 0x6f28fff1, 0x00882494, 0xf1620000,
+0xdc6f28ff, 0x28edf262, 0x08249c7d, 0x62000000,
+0x6f28fff1, 0x00a824ac, 0xf2620000, 0xa47d28d5,
+0x00000824, 0x65f16200, 0xb8dcf928, 0x000006a6,
+0x2484c766, 0x000000c8, 0xf1620008, 0xd9d52865,
+0x287df262, 0x64246479, 0x28e5f362, 0x6200d43f,
+0x7f28fff1, 0xffe8249c, 0xf8c5ffff, 0xff66d293,
+0x70850fc2, 0x62000002, 0x71285df1, 0xf1620fe1,
+0x9cd52875, 0x00000824, 0xfff16200, 0x249c7f28,
+0xffffffa8, 0x28edf262, 0xf162dc7d, 0x9c7f28ff,
+0xffffc824, 0xfff162ff, 0x24ac6f28, 0xffffffa8,
+0xf162c031, 0xac7f28ff, 0x0000c824, 0x948b6600,
+0x0000c804, 0xc0834800, 0x54896602, 0x83489604,
+0xe97510f8, 0x287df262, 0x98249c23, 0x62ffffff,
+0x3f28e5f3, 0xffc8249c, 0xb800ffff, 0x000006b3,
+0xd393f8c5, 0x0fc2ff66, 0x0001ea85, 0x75f16200,
+0x0fe17128, 0x28fff162, 0xf262e16f, 0xe17d28ed,
+0x28e5f262, 0xf162d475, 0x947f28ff, 0xffffc824,
+0x45f162ff, 0x62ffef08, 0xc40845f1, 0x00d4244c,
+0x0875f162, 0xd5244cc4, 0x75f16201, 0x244cc408,
+0xf16202d6, 0x4cc40875, 0x6203d724, 0x24287df2,
+0xfff162c9, 0x248c7f28, 0xffffffe8, 0x28f5f362,
+0xb800e23f, 0x000006bb, 0xd493f8c5, 0x0fc2ff66,
+0x00017285, 0xfff16200, 0x24946f28, 0x00000008,
+0xf162c031, 0x947f28ff, 0x0000c824, 0x948b6600,
+0x0000c804, 0x54896600, 0x83489804, 0x834802c0,
+0xe97510f8, 0x287df262, 0x98248c23, 0x62ffffff,
+0x7f28fff1, 0xffa8248c, 0xf162ffff, 0xb46f28ff,
+0xffffa824, 0x7ef262ff, 0x24b43328, 0x000000c8,
+0x8b66c031, 0x6608045c, 0xc8049c39, 0x74000000,
+0x06f1b80a, 0xfce90000, 0x48000000, 0x4802c083,
+0x7510f883, 0x45f162dd, 0x62ffef08, 0xc40845f1,
+0x0004244c, 0x0875f162, 0x05244cc4, 0x75f16201,
+0x244cc408, 0xf1620206, 0x4cc40875, 0x62030724,
+0x7f08fff1, 0xff98248c, 0xf162ffff, 0xbc6f08ff,
+0xffff9824, 0x7df262ff, 0x62cf2428, 0x7f28fff1,
+0xffa8248c, 0xf162ffff, 0xac6f28ff, 0xffffa824,
+0x7ef262ff, 0x62e93428, 0x7f08fff1, 0x00c8248c,
+0xc0310000, 0x045c8b66, 0x9c396608, 0x0000c804,
+0xb8077400, 0x00000700, 0x83486deb, 0x834802c0,
+0xe07508f8, 0x28fff162, 0xc824947f, 0xb8ffffff,
+0x00000002, 0x04548b66, 0x54896628, 0x8348c804,
+0x834804c0, 0xec7522f8, 0x28fff162, 0x0824b46f,
+0xb8000000, 0xffffaaaa, 0x000000ba, 0x92f8c500,
+0xcdf262c8, 0x248c6629, 0x00000028, 0x28f5f362,
+0xc824ac3f, 0x00ffffff, 0xc593f8c5, 0xb8c0ff66,
+0x0000073a, 0x48c2440f, 0xc9f85d8b, 0x000000c3,
+0004035,
+};
+asm(".type avx512bw_x86_64_D_32i2, STT_NOTYPE;");
+asm(".type avx512bw_x86_64_D_32i2, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512bw_x86_64_D_32u2[] = {
+0x315500eb, 0xc03145c0, 0x000010b9, 0x10ba4100,
+0x48000000, 0x4853e589, 0x48e0e483, 0x00e8ec81,
+0x44c70000, 0x00109424, 0xc7890000, 0x8dd18945,
+0xc6890158, 0x8901e783, 0x588d44c2, 0xc1294101,
+0xc385cfff, 0xc9ff0575, 0x8301b041, 0xeed101e2,
+0x447c8966, 0x04e2c148, 0x5c894466, 0xf2090844,
+0x4c894466, 0x89662844, 0x00884494, 0xc2830000,
+0x4c896608, 0x89666844, 0x00a84494, 0xff480000,
+0xf88348c0, 0x45a37510, 0x0474c084, 0x94244c89,
+0x28fff162, 0x0824bc6f, 0x62000000, 0x7f28fff1,
+0xffa824bc, 0xf162ffff, 0x946f28ff, 0xffffa824,
+0x0539b8ff, 0xf3620000, 0xc73f28ed, 0x93f8c500,
+0xc2ff66d0, 0x06af850f, 0xf1620000, 0x8cfd286d,
+0x00000824, 0xfff16200, 0x248c7f28, 0xffffffc8,
+0x28fff162, 0xc8248c6f, 0x62ffffff, 0x712865f1,
+0x000824b4, 0xb8010000, 0x0000053f, 0x28f5f362,
+0xc500d33f, 0x66d293f8, 0x850fc2ff, 0x00000669,
+0x2875f162, 0x08248cf9, 0x62000000, 0x7f28fff1,
+0xffe8248c, 0xf162ffff, 0x9c6f28ff, 0xffffe824,
+0x0544b8ff, 0xf3620000, 0xdb3f28ed, 0x93f8c500,
+0xc2ff66d3, 0x062f850f, 0xf1620000, 0x94eb286d,
+0x00002824, 0xfff16200, 0x24947f28, 0xffffffa8,
+0x2875f162, 0x28248cdb, 0x62000000, 0x7f28fff1,
+0xffc8248c, 0xf162ffff, 0x94ef2865, 0x00002824,
+0xfff16200, 0x24947f28, 0xffffffe8, 0x2875f162,
+0xa8248cdf, 0xb8ffffff, 0x00000550, 0x28f5f362,
+0xc500e23f, 0x66d493f8, 0x850fc2ff, 0x000005c9,
+0x28fff162, 0x0824946f, 0x62000000, 0xd5286df1,
+0x0028248c, 0xf1620000, 0x8c7f28ff, 0xffffa824,
+0x44c766ff, 0x0010c824, 0x0ebfc031, 0x48000000,
+0xe424748d, 0x2444c766, 0x890010e6, 0xf18948fa,
+0x0366c229, 0x48c80454, 0x8966c129, 0x48ca0454,
+0x6602c083, 0x83481189, 0xdf750ef8, 0x24548966,
+0xfff162d8, 0x24b46f28, 0xffffffa8, 0x0005c8b8,
+0x4df16200, 0x24ac7528, 0xffffffc8, 0xd593f8c5,
+0x0fc2ff66, 0x00054085, 0x6df16200, 0x249ce428,
+0x00000048, 0x28fff162, 0x4824a46f, 0xb8000000,
+0x000005d1, 0x286df162, 0xf162ccdb, 0xccfd2875,
+0x28e5f362, 0xc500f13f, 0x66d693f8, 0x850fc2ff,
+0x00000505, 0x28fff162, 0xe824947f, 0x62ffffff,
+0x712875f1, 0xffe824b4, 0x6203ffff, 0x7f28fff1,
+0xffa8248c, 0xf162ffff, 0xb4712865, 0xffffe824,
+0xf16202ff, 0xebfd2865, 0x0005edb8, 0xf5f36200,
+0x00fd3f28, 0xd793f8c5, 0x0fc2ff66, 0x0004b885,
+0x75f16200, 0x24947128, 0xffffffa8, 0x75f16202,
+0xb8c9fd28, 0x000005f2, 0x28e5f362, 0xc500c13f,
+0x66d093f8, 0x850fc2ff, 0x0000048d, 0x942444c7,
+0x00000003, 0x087df162, 0xe5244c6e, 0x286df162,
+0x44c7c9f1, 0x00029424, 0xf1620000, 0x5c6e087d,
+0xf162e524, 0xdbf1286d, 0x2865f162, 0x05b8ebfd,
+0x62000006, 0x3f28f5f3, 0xf8c500cd, 0xff66d193,
+0x42850fc2, 0x62000004, 0x6e087df1, 0x62e5246c,
+0xd12875f1, 0x75f162cd, 0xb8c9fd28, 0x00000609,
+0x28e5f362, 0xc500d13f, 0x66d293f8, 0x850fc2ff,
+0x00000415, 0x0855f162, 0xf5c5edef, 0xf162c976,
+0xda6f28ff, 0x6c75d5c5, 0xf3626824, 0xdd252875,
+0xe5f26240, 0x24ac1228, 0x00000068, 0x2875f162,
+0x6824b4fd, 0x62000000, 0x7f28fff1, 0x006824b4,
+0xf2620000, 0x9c1228e5, 0x00006824, 0x0621b800,
+0xf1620000, 0xdbfd2865, 0x28d5f362, 0xc500db3f,
+0x66d393f8, 0x850fc2ff, 0x000003ad, 0x286df262,
+0x28249c3a, 0x62000000, 0x3e286df2, 0x002824ac,
+0xf1620000, 0x94fd286d, 0x00002824, 0x65f16200,
+0xb8ddfd28, 0x00000634, 0x28e5f362, 0xc500e23f,
+0x66d493f8, 0x850fc2ff, 0x0000036d, 0x28fff162,
+0x28249c6f, 0x62000000, 0x6f28fff1, 0x00082494,
+0x53b80000, 0x62000006, 0xfd2865f1, 0xd5f262e9,
+0x62ea8d28, 0x3f28d5f3, 0xf8c500eb, 0xff66d593,
+0x32850fc2, 0x62000003, 0xfd2865f1, 0x065db8d2,
+0xc7660000, 0x00c82484, 0x00110000, 0x287df262,
+0x64246c79, 0x28d5f362, 0xc500f23f, 0x66d693f8,
+0x850fc2ff, 0x00000301, 0x000011b8, 0x7df26200,
+0x62e87b28, 0x3f28d5f3, 0x61b800fa, 0xc5000006,
+0x66d793f8, 0x850fc2ff, 0x000002dd, 0x28fff162,
+0x8824946f, 0x62000000, 0x6f28fff1, 0xedf262eb,
+0x24ac7d28, 0x00000008, 0x28fff162, 0xa824ac7f,
+0x62ffffff, 0x6f28fff1, 0x00a824bc, 0xf2620000,
+0x9c7d28c5, 0x00000824, 0x75f16200, 0xb8cbfd28,
+0x000006a6, 0x2484c766, 0x000000c8, 0xf1620008,
+0xcdf92875, 0x2875f162, 0xf362ccef, 0xe425285d,
+0x75f16255, 0x62ccf928, 0x79287df2, 0x6264245c,
+0x3f28f5f3, 0xf8c500c3, 0xff66d093, 0x56850fc2,
+0x62000002, 0x6f28fff1, 0x0008248c, 0xf1620000,
+0xdbef0865, 0x28edf262, 0xf262cb7d, 0xd37528f5,
+0x28fff162, 0xc8248c7f, 0x62ffffff, 0x7f28fff1,
+0xffe82494, 0xf162ffff, 0xb46f28ff, 0x00000824,
+0x62c03100, 0x7f28fff1, 0x00c824b4, 0x8b660000,
+0x00c80494, 0x83480000, 0x896602c0, 0x48960454,
+0x7510f883, 0x7df262e9, 0x248c3328, 0xffffff98,
+0x28f5f362, 0xc8248c3f, 0x00ffffff, 0x0006d3b8,
+0x93f8c500, 0xc2ff66d1, 0x01cb850f, 0xf1620000,
+0xffef0845, 0x0845f162, 0x04244cc4, 0x75f16200,
+0x244cc408, 0xf1620105, 0x4cc40875, 0x62020624,
+0xc40875f1, 0x0307244c, 0x287df262, 0xf162c934,
+0x8c7f28ff, 0xffffa824, 0xf5f362ff, 0x24943f28,
+0xffffffe8, 0x06dab800, 0xf8c50000, 0xff66d293,
+0x72850fc2, 0x62000001, 0x6f28fff1, 0x00082494,
+0xc0310000, 0x28fff162, 0xc824947f, 0x66000000,
+0xc804948b, 0x66000000, 0x98045489, 0x02c08348,
+0x10f88348, 0xf262e975, 0x8c33287d, 0xffff9824,
+0xfff162ff, 0x248c7f28, 0xffffffa8, 0x28fff162,
+0xa824bc6f, 0x62ffffff, 0x33287ef2, 0x00c824bc,
+0xc0310000, 0x045c8b66, 0x9c396608, 0x0000c804,
+0xb80a7400, 0x000006f1, 0x0000fce9, 0xc0834800,
+0xf8834802, 0x62dd7510, 0xef084df1, 0x4df162f6,
+0x244cc408, 0xf1620004, 0x4cc40875, 0x62010524,
+0xc40875f1, 0x0206244c, 0x0875f162, 0x07244cc4,
+0xfff16203, 0x248c7f08, 0xffffff98, 0x08fff162,
+0x9824a46f, 0x62ffffff, 0x34287df2, 0xfff162cc,
+0x248c7f28, 0xffffffa8, 0x28fff162, 0xa824b46f,
+0x62ffffff, 0x34287ef2, 0xfff162f1, 0x248c7f08,
+0x000000c8, 0x8b66c031, 0x6608045c, 0xc8049c39,
+0x74000000, 0x0700b807, 0x6deb0000, 0x02c08348,
+0x08f88348, 0xf162e075, 0x947f28ff, 0xffffc824,
+0x0002b8ff, 0x8b660000, 0x66280454, 0xc8045489,
+0x04c08348, 0x22f88348, 0xf162ec75, 0xbc6f28ff,
+0x00000824, 0xaaaab800, 0x00baffff, 0xc5000000,
+0x62c892f8, 0x6629c5f2, 0x0028248c, 0xf3620000,
+0x9c3f28f5, 0xffffc824, 0xf8c500ff, 0xff66c393,
+0x073ab8c0, 0x440f0000, 0x5d8b48c2, 0x00c3c9f8,
+0003577,
+};
+asm(".type avx512bw_x86_64_D_32u2, STT_NOTYPE;");
+asm(".type avx512bw_x86_64_D_32u2, STT_FUNC;");
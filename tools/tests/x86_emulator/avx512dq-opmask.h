@@ -0,0 +1,120 @@
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512dq_opmask_x86_32_D_1[] = {
+0x0d90f9c5, 0x00100168, 0x100170a1, 0x92f9c500,
+0x45edc5d0, 0x41edc5d9, 0x42ddc5e1, 0x47edc5eb,
+0x91f9c5f1, 0x1001782d, 0x93f9c500, 0x78153bd6,
+0x74001001, 0x0044b806, 0xc5c30000, 0xc5de44f9,
+0xc5e146ed, 0x781d91f9, 0xc5001001, 0x3bd493f9,
+0x10017815, 0xb8067400, 0x00000048, 0x79e3c4c3,
+0xc401d932, 0xe33279e3, 0x79e3c402, 0xc503e932,
+0x782591f9, 0xc5001001, 0x3bd593f9, 0x10017815,
+0xb8067400, 0x0000004d, 0x79e3c4c3, 0xc401d930,
+0xe33079e3, 0x79e3c402, 0xc503e930, 0x782591f9,
+0xc5001001, 0x3bd593f9, 0x10017815, 0xb8067400,
+0x00000052, 0x98f9c5c3, 0xb80677f6, 0x00000056,
+0x47fdc5c3, 0x98f9c5d8, 0xb80674db, 0x0000005d,
+0x46fdc5c3, 0x98f9c5d8, 0xb80672db, 0x00000064,
+0x4af5c5c3, 0x79e3c4d9, 0xc501e132, 0x781d91f9,
+0xc5001001, 0x3bd493f9, 0x10017815, 0xb8067400,
+0x00000074, 0x99f9c5c3, 0xb80677ca, 0x00000078,
+0x47fdc5c3, 0x99f9c5d8, 0xb80674d8, 0x0000007f,
+0x46fdc5c3, 0x99f9c5e0, 0xb80672e0, 0x00000086,
+0x90f9c5c3, 0x10016805, 0xfef26200, 0x62f83848,
+0x3948fef2, 0x91f9c5df, 0x10017805, 0x93f9c500,
+0x78153bd3, 0x74001001, 0x0091b806, 0x31c30000,
+0x0000c3c0, 0x00000000, 0x830f8fb3, 0xff803ff0,
+0x0ffc01ff, 0xcdf1f0c1, 0x00000000, 0x00000000,
+0000600,
+};
+asm(".type avx512dq_opmask_x86_32_D_1, STT_NOTYPE;");
+asm(".type avx512dq_opmask_x86_32_D_1, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512dq_opmask_x86_32_D_2[] = {
+0x0d90f8c5, 0x00100188, 0x100190a1, 0x92f8c500,
+0x45ecc5d0, 0x41ecc5d9, 0x42dcc5e1, 0x47ecc5eb,
+0x91f8c5f1, 0x1001982d, 0x93f8c500, 0x98153bd6,
+0x74001001, 0x0044b806, 0xc5c30000, 0xc5de44f8,
+0xc5e146ec, 0x981d91f8, 0xc5001001, 0x3bd493f8,
+0x10019815, 0xb8067400, 0x00000048, 0xf9e3c4c3,
+0xc401d932, 0xe332f9e3, 0xf9e3c402, 0xc503e932,
+0x982591f8, 0xc5001001, 0x3bd593f8, 0x10019815,
+0xb8067400, 0x0000004d, 0xf9e3c4c3, 0xc401d930,
+0xe330f9e3, 0xf9e3c402, 0xc503e930, 0x982591f8,
+0xc5001001, 0x3bd593f8, 0x10019815, 0xb8067400,
+0x00000052, 0x98f8c5c3, 0xb80677f6, 0x00000056,
+0x47fcc5c3, 0x98f8c5d8, 0xb80674db, 0x0000005d,
+0x46fcc5c3, 0x98f8c5d8, 0xb80672db, 0x00000064,
+0xf9e3c4c3, 0xc508e330, 0xc5ec4bdd, 0x981d91f8,
+0xc5001001, 0x3bd593f8, 0x10019815, 0xb8067400,
+0x0000006c, 0x4af4c5c3, 0xf9e3c4d9, 0xc501e132,
+0x981d91f8, 0xc5001001, 0x3bd493f8, 0x10019815,
+0xb8067400, 0x00000074, 0x99f8c5c3, 0xb80677ca,
+0x00000078, 0x47fcc5c3, 0x99f8c5d8, 0xb80674d8,
+0x0000007f, 0x46fcc5c3, 0x99f8c5e0, 0xb80672e0,
+0x00000086, 0x90f8c5c3, 0x10018805, 0x7ef26200,
+0x62f83848, 0x39487ef2, 0x91f8c5df, 0x10019805,
+0x93f8c500, 0x98153bd3, 0x74001001, 0x0091b806,
+0x31c30000, 0x0000c3c0, 0x830f8fb3, 0xff803ff0,
+0x0ffc01ff, 0xcdf1f0c1, 0x00000000, 0x00000000,
+0000640,
+};
+asm(".type avx512dq_opmask_x86_32_D_2, STT_NOTYPE;");
+asm(".type avx512dq_opmask_x86_32_D_2, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512dq_opmask_x86_64_D_1[] = {
+0x0d90f9c5, 0x00000160, 0x0162058b, 0xf9c50000,
+0xedc5d092, 0xedc5d945, 0xddc5e141, 0xedc5eb42,
+0xf9c5f147, 0x014e2d91, 0xf9c50000, 0x153bd693,
+0x00000144, 0x44b80674, 0xc3000000, 0xde44f9c5,
+0xe146edc5, 0x1d91f9c5, 0x0000012c, 0xd493f9c5,
+0x0122153b, 0x06740000, 0x000048b8, 0xe3c4c300,
+0x01d93279, 0x3279e3c4, 0xe3c402e3, 0x03e93279,
+0x2591f9c5, 0x00000100, 0xd593f9c5, 0x00f6153b,
+0x06740000, 0x00004db8, 0xe3c4c300, 0x01d93079,
+0x3079e3c4, 0xe3c402e3, 0x03e93079, 0x2591f9c5,
+0x000000d4, 0xd593f9c5, 0x00ca153b, 0x06740000,
+0x000052b8, 0xf9c5c300, 0x0677f698, 0x000056b8,
+0xfdc5c300, 0xf9c5d847, 0x0674db98, 0x00005db8,
+0xfdc5c300, 0xf9c5d846, 0x0672db98, 0x000064b8,
+0xf5c5c300, 0xe3c4d94a, 0x01e13279, 0x1d91f9c5,
+0x00000084, 0xd493f9c5, 0x007a153b, 0x06740000,
+0x000074b8, 0xf9c5c300, 0x0677ca99, 0x000078b8,
+0xfdc5c300, 0xf9c5d847, 0x0674d899, 0x00007fb8,
+0xfdc5c300, 0xf9c5e046, 0x0672e099, 0x000086b8,
+0xf9c5c300, 0x002e0590, 0xf2620000, 0xf83848fe,
+0x48fef262, 0xf9c5df39, 0x002a0591, 0xf9c50000,
+0x153bd393, 0x00000020, 0x91b80674, 0xc3000000,
+0x00c3c031, 0x00000000, 0x830f8fb3, 0xff803ff0,
+0x0ffc01ff, 0xcdf1f0c1, 0x00000000, 0x00000000,
+0000600,
+};
+asm(".type avx512dq_opmask_x86_64_D_1, STT_NOTYPE;");
+asm(".type avx512dq_opmask_x86_64_D_1, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512dq_opmask_x86_64_D_2[] = {
+0x0d90f8c5, 0x00000180, 0x0182058b, 0xf8c50000,
+0xecc5d092, 0xecc5d945, 0xdcc5e141, 0xecc5eb42,
+0xf8c5f147, 0x016e2d91, 0xf8c50000, 0x153bd693,
+0x00000164, 0x44b80674, 0xc3000000, 0xde44f8c5,
+0xe146ecc5, 0x1d91f8c5, 0x0000014c, 0xd493f8c5,
+0x0142153b, 0x06740000, 0x000048b8, 0xe3c4c300,
+0x01d932f9, 0x32f9e3c4, 0xe3c402e3, 0x03e932f9,
+0x2591f8c5, 0x00000120, 0xd593f8c5, 0x0116153b,
+0x06740000, 0x00004db8, 0xe3c4c300, 0x01d930f9,
+0x30f9e3c4, 0xe3c402e3, 0x03e930f9, 0x2591f8c5,
+0x000000f4, 0xd593f8c5, 0x00ea153b, 0x06740000,
+0x000052b8, 0xf8c5c300, 0x0677f698, 0x000056b8,
+0xfcc5c300, 0xf8c5d847, 0x0674db98, 0x00005db8,
+0xfcc5c300, 0xf8c5d846, 0x0672db98, 0x000064b8,
+0xe3c4c300, 0x08e330f9, 0xec4bddc5, 0x1d91f8c5,
+0x000000a4, 0xd593f8c5, 0x009a153b, 0x06740000,
+0x00006cb8, 0xf4c5c300, 0xe3c4d94a, 0x01e132f9,
+0x1d91f8c5, 0x00000080, 0xd493f8c5, 0x0076153b,
+0x06740000, 0x000074b8, 0xf8c5c300, 0x0677ca99,
+0x000078b8, 0xfcc5c300, 0xf8c5d847, 0x0674d899,
+0x00007fb8, 0xfcc5c300, 0xf8c5e046, 0x0672e099,
+0x000086b8, 0xf8c5c300, 0x002a0590, 0xf2620000,
+0xf838487e, 0x487ef262, 0xf8c5df39, 0x00260591,
+0xf8c50000, 0x153bd393, 0x0000001c, 0x91b80674,
+0xc3000000, 0x00c3c031, 0x830f8fb3, 0xff803ff0,
+0x0ffc01ff, 0xcdf1f0c1, 0x00000000, 0x00000000,
+0000640,
+};
+asm(".type avx512dq_opmask_x86_64_D_2, STT_NOTYPE;");
+asm(".type avx512dq_opmask_x86_64_D_2, STT_FUNC;");
@@ -0,0 +1,5780 @@
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512dq_x86_32_D_64i4[] = {
+0x315500eb, 0x57e589c0, 0x0020be56, 0x31530000,
+0xc0e483db, 0x02c0ec81, 0x44c70000, 0x00203c24,
+0xc2890000, 0x000011bf, 0x40d18900, 0x2901e183,
+0x244c89c7, 0x01f98328, 0xe183c919, 0xd0854902,
+0xb34e0375, 0x848c8901, 0x000001bc, 0x28244c8b,
+0x8489ead1, 0x00013c84, 0x84bc8900, 0x0000017c,
+0xfc84b489, 0xc1000001, 0xca0904e1, 0x3c849489,
+0x83000002, 0xf88308c2, 0x84948910, 0x0000027c,
+0xdb84a075, 0x74890474, 0xf1623c24, 0x746f487d,
+0xf1620524, 0x747f487d, 0xf1620224, 0x4c6f487d,
+0xf3620224, 0xd61f4875, 0x93f8c500, 0xfff981ca,
+0xba0000ff, 0x00000539, 0x07ca850f, 0xf1620000,
+0x54fe4875, 0xf1620524, 0x547f487d, 0xf1620324,
+0x74724865, 0x62010524, 0x6f487df1, 0xba032454,
+0x0000053f, 0x486df362, 0xc500db1f, 0x81cb93f8,
+0x00fffff9, 0x8d850f00, 0x62000007, 0xfa486df1,
+0x62052454, 0x7f487df1, 0x62042454, 0x1f4875f3,
+0x00042464, 0xcc93f8c5, 0xfffff981, 0x44ba0000,
+0x0f000005, 0x00075f85, 0x7df16200, 0x247c6f48,
+0x75f26206, 0x24544048, 0x45f26205, 0x62df4048,
+0x7f487df1, 0x6203245c, 0x6f487df1, 0x6205244c,
+0xfe4875f1, 0x75f162ef, 0x2464fa48, 0x6df16206,
+0xbad3fa48, 0x0000055b, 0x485df262, 0xf362e540,
+0xec1f486d, 0x93f8c500, 0xfff981cd, 0x620000ff,
+0x7f487df1, 0x0f042464, 0x0006fb85, 0x75f26200,
+0x24544048, 0x7df16206, 0x24547f48, 0x2484c702,
+0x000000c0, 0x00000010, 0xc024948d, 0xc7000000,
+0x00fc2484, 0x00100000, 0x0a8b0000, 0x8302e883,
+0xc10104c2, 0xf8830a89, 0x448c8902, 0x000000dc,
+0x8c89e875, 0x0000e024, 0x7df16200, 0x24746f48,
+0x05c8ba02, 0xf1620000, 0x7476484d, 0xf8c50324,
+0x44c7c693, 0x00023c24, 0xff3d0000, 0x0f0000ff,
+0x00068385, 0x75f16200, 0x2454ef48, 0x7df16207,
+0x24547f48, 0xedf26202, 0x24542848, 0xfdf16206,
+0x24547f48, 0x8bc93103, 0x01808c84, 0xacf70000,
+0x0000808c, 0x8c848900, 0x00000100, 0x048c9489,
+0x83000001, 0xf98302c1, 0x62dc7510, 0x6f487df1,
+0x6203247c, 0x764845f1, 0xc504247c, 0x3dc793f8,
+0x0000ffff, 0x0005e1ba, 0x19850f00, 0x62000006,
+0x404875f2, 0x6207245c, 0x7f487df1, 0x6204245c,
+0x72486df1, 0x03042474, 0x487df162, 0x0224547f,
+0x485df162, 0x04247472, 0x5df16202, 0xbaecfe48,
+0x000005ed, 0x486df362, 0xc500c51f, 0x3dc093f8,
+0x0000ffff, 0x05ce850f, 0xf1620000, 0x6472486d,
+0x62020224, 0xfe486df1, 0x05f2bad2, 0xf3620000,
+0xd21f485d, 0x93f8c500, 0xffff3dc2, 0x850f0000,
+0x000005a4, 0x3c2444c7, 0x00000003, 0x3c24448b,
+0x28244489, 0x891ff8c1, 0x622c2444, 0x7e08fef1,
+0x62052474, 0xf24865f1, 0x2444c7d6, 0x0000023c,
+0x24448b00, 0x2444893c, 0x1ff8c128, 0x2c244489,
+0x08fef162, 0x05247c7e, 0x4865f162, 0xf162dff2,
+0xe3fe4865, 0x000605ba, 0x6df36200, 0x00dc1f48,
+0xc393f8c5, 0x00ffff3d, 0x39850f00, 0x8b000005,
+0x893c2444, 0xc1282444, 0x44891ff8, 0xf1622c24,
+0x747e08fe, 0xf1620524, 0xd6e2486d, 0x486df162,
+0x09bad2fe, 0x62000006, 0x1f4865f3, 0xf8c500e2,
+0xff3dc493, 0x0f0000ff, 0x0004fb85, 0xefe9c500,
+0x7df162d2, 0x247c6f48, 0x45f36208, 0x06ca1f48,
+0xc975f262, 0x07245c40, 0x4865f262, 0x08246447,
+0x000001b8, 0x7df16200, 0x24746f48, 0x7df26208,
+0x62d07c48, 0xfa484df1, 0x7df162d2, 0x24547f48,
+0x65f26208, 0x24544748, 0x0621ba08, 0xf1620000,
+0xeafe486d, 0x485df362, 0xc500ed1f, 0x3dc593f8,
+0x0000ffff, 0x048e850f, 0xf2620000, 0x5446486d,
+0x26ba0824, 0x62000006, 0x1f486df3, 0xf8c500f3,
+0xff3dc693, 0x0f0000ff, 0x00046b85, 0x7df16200,
+0x24546f48, 0x6df26207, 0x245c4048, 0x6df26206,
+0x24644048, 0x7df16205, 0x245c7f48, 0x5df26203,
+0x245c3d48, 0x5df26203, 0x24643948, 0x7df16203,
+0x24647f48, 0x65f16203, 0x245cfe48, 0x063dba03,
+0xf1620000, 0x64fe4875, 0xf2620624, 0xda404865,
+0x4865f362, 0xc500fc1f, 0x3dc793f8, 0x0000ffff,
+0x0402850f, 0xf2620000, 0xda404875, 0x487df162,
+0x02245c7f, 0x487df262, 0x02245c1e, 0x4865f362,
+0xc500c11f, 0x3dc093f8, 0x0000ffff, 0x000644ba,
+0xd1850f00, 0x62000003, 0x6f487df1, 0x6205247c,
+0x6f487df1, 0x6206245c, 0x434845f3, 0xf1621bcf,
+0xc970487d, 0x75f3621b, 0x00d31f48, 0xc293f8c5,
+0x00ffff3d, 0x064eba00, 0x850f0000, 0x00000398,
+0x000001b8, 0x7df16200, 0x244c6f48, 0x0653ba05,
+0xf2620000, 0xe07c487d, 0x4865f162, 0xf262e4fa,
+0xe136485d, 0x485df362, 0xc500db1f, 0x3dc393f8,
+0x0000ffff, 0x035e850f, 0x44c70000, 0x00116024,
+0xf1620000, 0xe1fe4865, 0x00065dba, 0x7df26200,
+0x246c5848, 0x55f36218, 0x00e41f48, 0xc493f8c5,
+0x00ffff3d, 0x2d850f00, 0xb8000003, 0x00000011,
+0x000661ba, 0x7df26200, 0x62e87c48, 0x1f4855f3,
+0xf8c500ec, 0xff3dc593, 0x0f0000ff, 0x00030785,
+0x7df36200, 0x244c3b48, 0xf2620003, 0x645b487d,
+0xf3620324, 0x6c3a4875, 0x62010324, 0x1f485df3,
+0xf8c500f5, 0xff3dc693, 0xba0000ff, 0x0000066c,
+0x02d2850f, 0xf3620000, 0x4c39487d, 0x62000624,
+0x5a487df2, 0x6206246c, 0x384875f3, 0x01062464,
+0x485df362, 0x06246438, 0x5df36202, 0x24643848,
+0xf3620306, 0xfc1f4855, 0x93f8c500, 0xffff3dc7,
+0x7cba0000, 0x0f000006, 0x00028b85, 0x7df16200,
+0x24646e08, 0x5df36250, 0x24642208, 0xf9c50151,
+0x6024647f, 0x487df262, 0x0c246459, 0x00000cb8,
+0x70f9c500, 0x4460246c, 0xc892f8c5, 0x4975f362,
+0xb800cd38, 0x00000030, 0xc892f8c5, 0x4975f362,
+0x06244c38, 0x00c0b801, 0xf9c50000, 0x60246c70,
+0x92f8c544, 0x75f362c8, 0x01cd3849, 0x000300b8,
+0x92f8c500, 0x75f362c8, 0x244c3849, 0x00b80206,
+0xc500000c, 0x246c70f9, 0xf8c54460, 0xf362c892,
+0xcd384975, 0x3000b802, 0xf8c50000, 0xf362c892,
+0x4c384975, 0xb8030624, 0xffffc000, 0x6c70f9c5,
+0xba446024, 0x00000696, 0xc892f8c5, 0x4975f362,
+0x6203cd38, 0x1f485df3, 0xf8c500c1, 0xff3dc093,
+0x0f0000ff, 0x0001bf85, 0x7df16200, 0x244c6f48,
+0x7df16209, 0x62e36f48, 0x7e4875f2, 0x62052464,
+0x6f487df1, 0x620a2474, 0x7e484df2, 0xc705245c,
+0x08602444, 0x62000000, 0xfa485df1, 0x06a6badb,
+0xf2620000, 0xda404865, 0x487df262, 0x18246458,
+0x4865f362, 0xc500d41f, 0x3dc293f8, 0x0000ffff,
+0x0162850f, 0xf2620000, 0x5c40486d, 0xd9c50524,
+0xf362e4ef, 0xc41f486d, 0x7ef26201, 0x62d03848,
+0x7f487df1, 0x6202245c, 0x764865f2, 0x7df162ca,
+0x244c7f48, 0x7df16203, 0x247c6f48, 0x7df36202,
+0x247c3b48, 0xf2620003, 0x5425487d, 0xf1620324,
+0x547f48fd, 0xf3620424, 0xd91f486d, 0x93f8c500,
+0xffff3dc3, 0xb3ba0000, 0x0f000006, 0x0000f785,
+0x7df16200, 0x244c6f48, 0x7df36205, 0x244c3b48,
+0xfdc50003, 0x6024746f, 0x747ffdc5, 0xf2624024,
+0x5425487d, 0xf1620224, 0x547f48fd, 0xf1620224,
+0x7c6f48fd, 0xf2620224, 0x7c35487e, 0xc0310324,
+0x40849c8b, 0x39000001, 0x7460845c, 0x06f1ba0a,
+0xa1e90000, 0x40000000, 0x7508f883, 0x0001b8e3,
+0xf1620000, 0x4c7f487d, 0x948b0324, 0x00018084,
+0x84948900, 0x000000c0, 0x8302c083, 0xea7511f8,
+0xffaaaab8, 0x7df162ff, 0x244c6f48, 0x073aba05,
+0xf8c50000, 0xf262c892, 0x54644975, 0xf3620624,
+0x641f486d, 0xc5000324, 0x3dc493f8, 0x0000ffff,
+0xf3624675, 0xd9034875, 0x000fb801, 0x4aba0000,
+0x62000007, 0x7c487df2, 0x0001b8d0, 0xf1620000,
+0xcadb4875, 0x487df262, 0xf162d07c, 0xcafe4875,
+0x4865f362, 0xc500e91f, 0x3dc593f8, 0x0000ffff,
+0x000000b8, 0xd0440f00, 0x89f4658d, 0x5f5e5bd0,
+0x0000c35d,
+0004222,
+};
+asm(".type avx512dq_x86_32_D_64i4, STT_NOTYPE;");
+asm(".type avx512dq_x86_32_D_64i4, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512dq_x86_32_D_64u4[] = {
+0x315500eb, 0x57e589c0, 0x0020be56, 0x31530000,
+0xc0e483db, 0x02c0ec81, 0x44c70000, 0x00203c24,
+0xc1890000, 0x000011ba, 0xc2294000, 0x2c245489,
+0xe283ca89, 0x8dc88501, 0x7c89ff7a, 0x03752824,
+0x8b01b34e, 0xc12c247c, 0x848904e2, 0x00013c84,
+0x89e9d100, 0x01fc84b4, 0xca090000, 0x3c849489,
+0x83000002, 0xf88308c2, 0x84bc8910, 0x0000017c,
+0x28247c8b, 0x7c849489, 0x89000002, 0x01bc84bc,
+0x9e750000, 0x0474db84, 0x3c247489, 0x487df162,
+0x05247c6f, 0x487df162, 0x02247c7f, 0x487df162,
+0x0224546f, 0x486df362, 0xc500c71f, 0x81c893f8,
+0x00fffff9, 0x0539ba00, 0x850f0000, 0x00000729,
+0x486df162, 0x05244cfe, 0x487df162, 0x03244c7f,
+0x4865f162, 0x05247472, 0x7df16201, 0x244c6f48,
+0x053fba03, 0xf3620000, 0xd31f4875, 0x93f8c500,
+0xfff981ca, 0x0f0000ff, 0x0006ec85, 0x75f16200,
+0x244cfa48, 0x7df16205, 0x244c7f48, 0x7df16204,
+0x245c6f48, 0x6df36204, 0x00db1f48, 0xcb93f8c5,
+0xfffff981, 0x44ba0000, 0x0f000005, 0x0006b885,
+0x6df16200, 0x2454eb48, 0x7df16206, 0x24547f48,
+0x75f16202, 0x244cdb48, 0x7df16206, 0x244c7f48,
+0x65f16203, 0x2454ef48, 0x7df16206, 0x24547f48,
+0x75f16204, 0x244cdf48, 0x75f36202, 0x00e21f48,
+0xcc93f8c5, 0xfffff981, 0x50ba0000, 0x0f000005,
+0x00066485, 0x7df16200, 0x244c6f48, 0x75f26205,
+0x24544048, 0x7df16206, 0x24547f48, 0x2484c702,
+0x000000c0, 0x00000010, 0xc024948d, 0xc7000000,
+0x00fc2484, 0x00100000, 0x0a8b0000, 0x8302e883,
+0xc10104c2, 0xf8830a89, 0x448c8902, 0x000000dc,
+0x8c89e875, 0x0000e024, 0x7df16200, 0x24746f48,
+0x05c8ba02, 0xf1620000, 0x6c76484d, 0xf8c50324,
+0x44c7c593, 0x00023c24, 0xff3d0000, 0x0f0000ff,
+0x0005e485, 0x75f16200, 0x2454ef48, 0x7df16207,
+0x24547f48, 0xedf16202, 0x2454f448, 0xfdf16206,
+0x24547f48, 0x8bc93103, 0x01808c84, 0xa4f70000,
+0x0000808c, 0x8c848900, 0x00000100, 0x048c9489,
+0x83000001, 0xf98302c1, 0x62dc7510, 0x6f487df1,
+0x6203247c, 0x764845f1, 0xc5042474, 0x3dc693f8,
+0x0000ffff, 0x0005e1ba, 0x7a850f00, 0x62000005,
+0x7f487df1, 0x6204244c, 0x72486df1, 0x03042474,
+0x487df162, 0x0224547f, 0x4865f162, 0x04247472,
+0x65f16202, 0xbae3fe48, 0x000005ed, 0x486df362,
+0xc500fc1f, 0x3dc793f8, 0x0000ffff, 0x0537850f,
+0xf1620000, 0x5472486d, 0x62020224, 0xfe486df1,
+0x05f2bad2, 0xf3620000, 0xc21f4865, 0x93f8c500,
+0xffff3dc0, 0x850f0000, 0x0000050d, 0x3c2444c7,
+0x00000003, 0x087df162, 0x0f24546e, 0x4875f162,
+0x44c7d2f2, 0x00023c24, 0xf1620000, 0x5c6e087d,
+0xf1620f24, 0xdbf24875, 0x4865f162, 0x05bae3fe,
+0x62000006, 0x1f486df3, 0xf8c500d4, 0xff3dc293,
+0x0f0000ff, 0x0004c085, 0x7df16200, 0x24646e08,
+0x6df1620f, 0x62d4d248, 0xfe486df1, 0x0609bad2,
+0xf3620000, 0xda1f4865, 0x93f8c500, 0xffff3dc3,
+0x850f0000, 0x00000491, 0xd2efe9c5, 0x487df162,
+0x0824746f, 0x484df362, 0x6204ca1f, 0x25486df3,
+0xf162ffd2, 0xe26fc97d, 0x485df162, 0xf262e1db,
+0x6c47485d, 0xf1620824, 0x5cfe486d, 0xf1620824,
+0x5c7f487d, 0xf2620824, 0x5c47485d, 0x21ba0824,
+0x62000006, 0xfe4865f1, 0x55f362f3, 0x00e61f48,
+0xc493f8c5, 0x00ffff3d, 0x2a850f00, 0x62000004,
+0x454865f2, 0xba08245c, 0x00000626, 0x4865f362,
+0xc500ec1f, 0x3dc593f8, 0x0000ffff, 0x0407850f,
+0xf2620000, 0x5c3b4875, 0xf2620624, 0x643f4875,
+0xf1620624, 0x4cfe4875, 0xf1620624, 0xdcfe4865,
+0x000634ba, 0x65f36200, 0x00f11f48, 0xc693f8c5,
+0x00ffff3d, 0xce850f00, 0x62000003, 0x6f487df1,
+0x6205247c, 0x6f487df1, 0x6206245c, 0x434845f3,
+0xf1621bcf, 0xc970487d, 0x75f3621b, 0x00fb1f48,
+0xc793f8c5, 0x00ffff3d, 0x064eba00, 0x850f0000,
+0x00000395, 0x4865f162, 0xf162e2fe, 0x4c6f487d,
+0x53ba0524, 0x62000006, 0x36485df2, 0x5df362e1,
+0x00c31f48, 0xc093f8c5, 0x00ffff3d, 0x66850f00,
+0xc7000003, 0x11602444, 0x62000000, 0xfe4865f1,
+0x065dbae1, 0xf2620000, 0x6c58487d, 0xf3621824,
+0xd41f4855, 0x93f8c500, 0xffff3dc2, 0x850f0000,
+0x00000335, 0x000011b8, 0x0661ba00, 0xf2620000,
+0xe87c487d, 0x4855f362, 0xc500dc1f, 0x3dc393f8,
+0x0000ffff, 0x030f850f, 0xf3620000, 0x4c3b487d,
+0x62000324, 0x5b487df2, 0x62032464, 0x3a4875f3,
+0x0103246c, 0x485df362, 0xc500e51f, 0x3dc493f8,
+0x0000ffff, 0x00066cba, 0xda850f00, 0x62000002,
+0x39487df3, 0x0006244c, 0x487df262, 0x06246c5a,
+0x4875f362, 0x06246438, 0x5df36201, 0x24643848,
+0xf3620206, 0x6438485d, 0x62030624, 0x1f4855f3,
+0xf8c500ec, 0xff3dc593, 0xba0000ff, 0x0000067c,
+0x0293850f, 0xf1620000, 0x646e087d, 0xf3625024,
+0x6422085d, 0xc5015124, 0x24647ff9, 0x7df26260,
+0x24645948, 0x000cb80c, 0xf9c50000, 0x60246c70,
+0x92f8c544, 0x75f362c8, 0x00cd3849, 0x000030b8,
+0x92f8c500, 0x75f362c8, 0x244c3849, 0xc0b80106,
+0xc5000000, 0x246c70f9, 0xf8c54460, 0xf362c892,
+0xcd384975, 0x0300b801, 0xf8c50000, 0xf362c892,
+0x4c384975, 0xb8020624, 0x00000c00, 0x6c70f9c5,
+0xc5446024, 0x62c892f8, 0x384975f3, 0x00b802cd,
+0xc5000030, 0x62c892f8, 0x384975f3, 0x0306244c,
+0xffc000b8, 0x70f9c5ff, 0x4460246c, 0x000696ba,
+0x92f8c500, 0x75f362c8, 0x03cd3849, 0x485df362,
+0xc500f11f, 0x3dc693f8, 0x0000ffff, 0x01c7850f,
+0xf1620000, 0x4c6f487d, 0xf1620924, 0xe36f487d,
+0x4875f262, 0x0524647e, 0x487df162, 0x0a24746f,
+0x484df262, 0x05245c7e, 0x602444c7, 0x00000008,
+0x486df162, 0xf362d3fe, 0x5c254865, 0x62550724,
+0xfa486df1, 0x06a6bad4, 0xf1620000, 0x54ef486d,
+0xf1620724, 0xd3fa486d, 0x487df262, 0x18245c58,
+0x486df362, 0xc500fb1f, 0x3dc793f8, 0x0000ffff,
+0x0153850f, 0xe1c50000, 0xf162dbef, 0x546f487d,
+0xf2620524, 0xd37e4875, 0x486df262, 0xf162cb76,
+0x547f487d, 0xf1620324, 0x4c7f487d, 0xf1620424,
+0x7c6f487d, 0xf3620524, 0x7c3b487d, 0x62000324,
+0x35487df2, 0x6203244c, 0x1f4875f3, 0xf8c500c2,
+0xff3dc093, 0xba0000ff, 0x000006d3, 0x00f7850f,
+0xf1620000, 0x4c6f487d, 0xf3620524, 0x4c3b487d,
+0xc5000324, 0x24746ffd, 0x7ffdc560, 0x62402474,
+0x35487df2, 0x62022454, 0x7f48fdf1, 0x62022454,
+0x6f48fdf1, 0x6202247c, 0x35487ef2, 0x3103247c,
+0x84bc8bc0, 0x00000140, 0x60847c39, 0xf1ba0a74,
+0xe9000006, 0x000000a1, 0x08f88340, 0x01b8e375,
+0x62000000, 0x7f487df1, 0x8b03244c, 0x01808494,
+0x94890000, 0x0000c084, 0x02c08300, 0x7511f883,
+0xaaaab8ea, 0xf162ffff, 0x4c6f487d, 0x3aba0524,
+0xc5000007, 0x62c892f8, 0x644975f2, 0x62062454,
+0x1f486df3, 0x00032454, 0xc293f8c5, 0x00ffff3d,
+0x62467500, 0x034875f3, 0x0fb801d9, 0xba000000,
+0x0000074a, 0x487df262, 0x01b8d07c, 0x62000000,
+0xdb4875f1, 0x7df262ca, 0x62d07c48, 0xfe4875f1,
+0x65f362ca, 0x00d91f48, 0xc393f8c5, 0x00ffff3d,
+0x0000b800, 0x440f0000, 0xf4658dd0, 0x5e5bd089,
+0x00c35d5f,
+0003763,
+};
+asm(".type avx512dq_x86_32_D_64u4, STT_NOTYPE;");
+asm(".type avx512dq_x86_32_D_64u4, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512dq_x86_32_D_64i8[] = {
+0x895500eb, 0xff3157e5, 0x0001be56, 0xbb530000,
+0x00000040, 0x81c0e483, 0x0002c0ec, 0xff468d00,
+0x4489d231, 0x09b84824, 0x89000000, 0x2444c7f1,
+0xffffff40, 0x89f029ff, 0x8b382444, 0x19482444,
+0x245489fa, 0x2444c73c, 0xffffff44, 0x01e083ff,
+0x0e75c289, 0x402444c7, 0x00000001, 0x4489c031,
+0x4c854424, 0x01754824, 0xccb4894b, 0x00000138,
+0x3103e2c1, 0xcc8489c0, 0x000001fc, 0x4824448b,
+0x08fef162, 0x07247c7e, 0x3cccbc89, 0x62000001,
+0x7e08fef1, 0x6208245c, 0xd608fdf1, 0x892fcc7c,
+0x01f8cc9c, 0xf1620000, 0x5cd608fd, 0xe8d137cc,
+0xd231d009, 0x38cc8489, 0x83000002, 0x948904c0,
+0x00023ccc, 0x00d28300, 0x8901c683, 0x0278cc84,
+0xf0890000, 0x8900d783, 0x027ccc94, 0xf0830000,
+0x0ff80909, 0xffff3485, 0xfdf162ff, 0x247c6f48,
+0xfdf16205, 0x247c7f48, 0xfdf16202, 0x244c6f48,
+0xf5f36202, 0x00c71f48, 0xd093f9c5, 0x39b8c2fe,
+0x0f000005, 0x00055185, 0xf5f16200, 0x2454d448,
+0xfdf16205, 0x24547f48, 0xe5f16203, 0x24747348,
+0xf1620105, 0x546f48fd, 0x3fb80324, 0x62000005,
+0x1f48edf3, 0xf9c500d3, 0xc2fed293, 0x0518850f,
+0xf1620000, 0x54fb48ed, 0xf1620524, 0x547f48fd,
+0xf3620424, 0x5c1f48f5, 0xc5000424, 0xfed393f9,
+0x0544b8c2, 0x850f0000, 0x000004ee, 0x48fdf162,
+0x06247c6f, 0x48f5f262, 0x05244c40, 0x48c5f262,
+0xf162d740, 0x5c6f48fd, 0xf1620524, 0xefd448e5,
+0x48e5f162, 0x062464fb, 0x48f5f162, 0x5bb8cafb,
+0x62000005, 0x4048ddf2, 0xf5f362e5, 0x00e41f48,
+0xd493f9c5, 0x850fc2fe, 0x0000049e, 0x48e5f262,
+0x06244c40, 0x48f5f362, 0x06802d1f, 0xc5000010,
+0xfed593f9, 0x05c8b8c2, 0x850f0000, 0x0000047a,
+0x48fdf162, 0x0724546f, 0x48e5f262, 0xf162e240,
+0x647f48fd, 0xf1620424, 0x747348f5, 0x62030424,
+0x7f48fdf1, 0x6202244c, 0x7348d5f1, 0x02042474,
+0x48d5f162, 0xedb8f5d4, 0x62000005, 0x1f48f5f3,
+0xf9c500f6, 0xc2fed693, 0x042c850f, 0xf1620000,
+0x647248f5, 0x62020224, 0xd448f5f1, 0x05f2b8c9,
+0xf3620000, 0xf91f48d5, 0x93f9c500, 0x0fc2fed7,
+0x00040585, 0x2444c700, 0x0000035c, 0x24448b00,
+0x2444895c, 0x1ff8c148, 0x4c244489, 0x08fef162,
+0x0924747e, 0x48ddf162, 0x44c7cef3, 0x00025c24,
+0x448b0000, 0x44895c24, 0xf8c14824, 0x2444891f,
+0xfef1624c, 0x247c7e08, 0xddf16209, 0x62e7f348,
+0xd448ddf1, 0x0605b8ec, 0xf3620000, 0xc51f48f5,
+0x93f9c500, 0x0fc2fed0, 0x00039d85, 0x24448b00,
+0x2444895c, 0x1ff8c148, 0x4c244489, 0x08fef162,
+0x0924747e, 0x48f5f162, 0xf162cee2, 0xc9d448f5,
+0x000609b8, 0xddf36200, 0x00d11f48, 0xd293f9c5,
+0x850fc2fe, 0x00000362, 0xc9eff1c5, 0x48fdf162,
+0x08247c6f, 0x48c5f362, 0x6206c91f, 0x40c9e5f2,
+0xfdf162ca, 0x244c7f48, 0xf5f26204, 0x246c4748,
+0xfdf16208, 0x24746f48, 0xcdf16208, 0xc025fb58,
+0x62001006, 0x7f48fdf1, 0x62082464, 0x4748f5f2,
+0xb808244c, 0x00000621, 0x48fdf162, 0x03244c7f,
+0x48f5f162, 0xf362c9d4, 0xd91f48d5, 0x93f9c500,
+0x0fc2fed3, 0x0002f185, 0xfdf16200, 0x247c6f48,
+0xc5f26203, 0x244c4648, 0x0626b808, 0xf3620000,
+0x641f48f5, 0xc5000424, 0xfed493f9, 0xc7850fc2,
+0x62000002, 0x4048e5f2, 0xfdf162ea, 0x24646f48,
+0xddf26206, 0x62ca4048, 0x7f48fdf1, 0x6202246c,
+0x7f48fdf1, 0x6203244c, 0x3d48d5f2, 0x6203244c,
+0x3948d5f2, 0x6203246c, 0x7f48fdf1, 0x6203246c,
+0xd448f5f1, 0x6203244c, 0xd448e5f1, 0x063db8ec,
+0xf2620000, 0xca4048f5, 0x48f5f362, 0xc500ed1f,
+0xfed593f9, 0x5f850fc2, 0x62000002, 0x1f48fdf2,
+0x6202244c, 0x1f48f5f3, 0xf9c500f3, 0xc2fed693,
+0x000644b8, 0x3f850f00, 0x62000002, 0x6f48fdf1,
+0x62052474, 0x4348cdf3, 0xf1621bce, 0xc970487d,
+0xf5f3624e, 0x00fc1f48, 0xd793f9c5, 0x4eb8c2fe,
+0x0f000006, 0x00021185, 0xfdf26200, 0xc01d5948,
+0x62001006, 0xfb48ddf1, 0x0653b8cb, 0xf2620000,
+0x4c3648f5, 0xf3620524, 0xc41f48f5, 0x93f9c500,
+0x0fc2fed0, 0x0001e185, 0xfdf36200, 0x244c0048,
+0xf3621b05, 0xc94348f5, 0xf5f3624e, 0x00cc1f48,
+0xd193f9c5, 0x58b8c2fe, 0x0f000006, 0x0001b985,
+0xfdf16200, 0x244c6f48, 0x2444c705, 0x00000960,
+0x89d23100, 0x62642454, 0xd448f5f1, 0x065db8f4,
+0xf2620000, 0x6c5948fd, 0xf3620c24, 0xd61f48d5,
+0x93f9c500, 0x0fc2fed2, 0x00017d85, 0xfdf36200,
+0x244c3b48, 0xf2620003, 0x6c5b48fd, 0xf3620324,
+0x743a48f5, 0x62010324, 0x1f48d5f3, 0xf9c500de,
+0xc0fec393, 0x00066cb8, 0x4b850f00, 0x62000001,
+0x3948fdf3, 0x0006244c, 0x48fdf262, 0x06246c5a,
+0x48f5f362, 0x06244c38, 0xf5f36201, 0x244c3848,
+0xf3620206, 0x4c3848f5, 0x62030624, 0x1f48d5f3,
+0xf9c500e1, 0xc0fec493, 0x00067cb8, 0x07850f00,
+0x62000001, 0x6f48fdf1, 0x6209244c, 0x7648ddf2,
+0x6205244c, 0x6f48fdf1, 0x620a247c, 0x7e48c5f2,
+0xc7052464, 0x04602444, 0x62000000, 0xfb48f5f1,
+0x89c031cc, 0x62642444, 0x4048f5f2, 0x06a6b8ca,
+0xf2620000, 0x545948fd, 0xf3620c24, 0xea1f48f5,
+0x93f9c500, 0x0fc2fed5, 0x0000ad85, 0xfef16200,
+0x244c7e08, 0xfdf16231, 0x24746f48, 0xfdf16205,
+0x24747f48, 0xfdf16203, 0x244cd608, 0xfef16219,
+0x244c7e08, 0xfdf16233, 0x244cd608, 0xfef1621b,
+0x244c7e08, 0xfdf16235, 0x244cd608, 0xfef1621d,
+0x244c7e08, 0xfdf16237, 0x244cd608, 0x62aab01f,
+0x6f48fdf1, 0xc505244c, 0x62c892f9, 0x6449f5f2,
+0x62062454, 0x1f48edf3, 0x00032474, 0xd693f9c5,
+0x3ab8c2fe, 0x75000007, 0xf5f36231, 0x01d10348,
+0x58f5f162, 0x06c80ddb, 0xf1620010, 0xcbd448f5,
+0x000000ba, 0xedf36200, 0x00f91f48, 0xc793f9c5,
+0x4ab8c0fe, 0x0f000007, 0x658dc244, 0x5f5e5bf4,
+0x0000c35d, 0x00000000, 0x00000000, 0x00000000,
+0x00000008, 0x00000000, 0x0000000e, 0x00000000,
+0x00000012, 0x00000000, 0x00000014, 0x00000000,
+0x00000014, 0x00000000, 0x00000012, 0x00000000,
+0x0000000e, 0x00000000, 0x00000008, 0x00000000,
+0x00000001, 0x00000000, 0x00000007, 0x00000000,
+0003320,
+};
+asm(".type avx512dq_x86_32_D_64i8, STT_NOTYPE;");
+asm(".type avx512dq_x86_32_D_64i8, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512dq_x86_32_D_64u8[] = {
+0x895500eb, 0xff3157e5, 0x0001be56, 0xbb530000,
+0x00000040, 0x81c0e483, 0x0002c0ec, 0xff468d00,
+0x4489d231, 0x09b84c24, 0x89000000, 0x89f029f1,
+0x8b402444, 0x194c2444, 0x245489fa, 0x01e08344,
+0x48244489, 0x24448948, 0x7485993c, 0x01754c24,
+0x7df1624b, 0x62f86e08, 0x220845f3, 0xb48901fa,
+0x000138cc, 0xccbc8900, 0x0000013c, 0x548bc031,
+0x84894824, 0x0001fccc, 0x24448b00, 0xfef1624c,
+0x24747e08, 0xcc9c8908, 0x000001f8, 0x08fdf162,
+0x2fcc74d6, 0x08fdf162, 0x37cc7cd6, 0xd103e2c1,
+0x31d009e8, 0xcc8489d2, 0x00000238, 0x8904c083,
+0x023ccc94, 0xd2830000, 0x01c68300, 0x78cc8489,
+0x89000002, 0x00d783f0, 0x7ccc9489, 0x83000002,
+0xf80909f0, 0xff43850f, 0xf162ffff, 0x746f48fd,
+0xf1620524, 0x747f48fd, 0xf1620224, 0x546f48fd,
+0xf3620224, 0xc61f48ed, 0x93f9c500, 0xb8c2fed0,
+0x00000539, 0x04de850f, 0xf1620000, 0x4cd448ed,
+0xf1620524, 0x4c7f48fd, 0xf1620324, 0x747348e5,
+0x62010524, 0x6f48fdf1, 0xb803244c, 0x0000053f,
+0x48f5f362, 0xc500d31f, 0xfed293f9, 0xa5850fc2,
+0x62000004, 0xfb48f5f1, 0x6205244c, 0x7f48fdf1,
+0x6204244c, 0x6f48fdf1, 0x6204245c, 0x1f48edf3,
+0xf9c500db, 0xc2fed393, 0x000544b8, 0x75850f00,
+0x62000004, 0xeb48edf1, 0x62062454, 0x7f48fdf1,
+0x62022454, 0xdb48f5f1, 0x6206244c, 0xef48e5f1,
+0x6206245c, 0xdf48f5f1, 0x6202244c, 0x1f48f5f3,
+0xf9c500e3, 0xc2fed493, 0x000550b8, 0x35850f00,
+0x62000004, 0x6f48fdf1, 0x6205245c, 0x4048e5f2,
+0x6206244c, 0x1f48f5f3, 0x1006002d, 0xf9c50000,
+0xc2fed593, 0x0005c8b8, 0x09850f00, 0x62000004,
+0x7f48fdf1, 0x6204245c, 0x7348f5f1, 0x03042474,
+0x48fdf162, 0x02244c7f, 0x48edf162, 0x04247473,
+0xedf16202, 0xb8e2d448, 0x000005ed, 0x48f5f362,
+0xc500f41f, 0xfed693f9, 0xc9850fc2, 0x62000003,
+0x7348f5f1, 0x02022454, 0x48f5f162, 0xf2b8c9d4,
+0x62000005, 0x1f48edf3, 0xf9c500f9, 0xc2fed793,
+0x03a2850f, 0x44c70000, 0x00035c24, 0xf1620000,
+0x4c6e087d, 0xf1621724, 0xc9f348e5, 0x5c2444c7,
+0x00000002, 0x087df162, 0x1724546e, 0x48e5f162,
+0xf162d2f3, 0xe2d448ed, 0x000605b8, 0xf5f36200,
+0x00c41f48, 0xd093f9c5, 0x850fc2fe, 0x00000358,
+0x087df162, 0x1724646e, 0x48f5f162, 0xf162ccd3,
+0xc9d448f5, 0x000609b8, 0xedf36200, 0x00d11f48,
+0xd293f9c5, 0x850fc2fe, 0x0000032c, 0xc9eff1c5,
+0x48fdf162, 0x08247c6f, 0x48c5f362, 0x6204c91f,
+0x254875f3, 0xf162ffc9, 0xd16fc9fd, 0x48edf162,
+0xf162d3db, 0x547f48fd, 0xf2620424, 0x644748ed,
+0xf1620824, 0x6cd448f5, 0xf1620824, 0x6c7f48fd,
+0xf2620824, 0x544748ed, 0x21b80824, 0x62000006,
+0x7f48fdf1, 0x62032454, 0xd448edf1, 0xddf362d2,
+0x00da1f48, 0xd393f9c5, 0x850fc2fe, 0x000002b8,
+0x48fdf162, 0x0324746f, 0x48cdf262, 0x08245445,
+0x000626b8, 0xedf36200, 0x24641f48, 0xf9c50004,
+0xc2fed493, 0x028e850f, 0xf2620000, 0x543b48e5,
+0xf2620624, 0x643f48e5, 0xf1620624, 0x5cd448e5,
+0xf1620624, 0xd4d448ed, 0x000634b8, 0xedf36200,
+0x00eb1f48, 0xd593f9c5, 0x850fc2fe, 0x00000258,
+0x48fdf162, 0x05247c6f, 0x48fdf162, 0x06245c6f,
+0x48c5f362, 0x621bd743, 0x70487df1, 0xf3624ed2,
+0xf31f48ed, 0x93f9c500, 0xb8c2fed6, 0x0000064e,
+0x0222850f, 0xf1620000, 0xd1d448e5, 0x000653b8,
+0xedf26200, 0x24543648, 0xedf36205, 0x00fb1f48,
+0xd793f9c5, 0x850fc2fe, 0x000001fc, 0x48fdf362,
+0x05245400, 0xedf3621b, 0x4ed24348, 0x48edf362,
+0xc500c31f, 0xfed093f9, 0x0658b8c2, 0x850f0000,
+0x000001d4, 0x48fdf162, 0x0524546f, 0x602444c7,
+0x00000009, 0x5489d231, 0xf1626424, 0xebd448ed,
+0x00065db8, 0xfdf26200, 0x24645948, 0xddf3620c,
+0x00cd1f48, 0xd193f9c5, 0x850fc2fe, 0x00000198,
+0x48fdf362, 0x0324543b, 0xfdf26200, 0x24645b48,
+0xedf36203, 0x246c3a48, 0xf3620103, 0xd51f48dd,
+0x93f9c500, 0xb8c0fec2, 0x0000066c, 0x0166850f,
+0xf3620000, 0x543948fd, 0x62000624, 0x5a48fdf2,
+0x62062464, 0x3848edf3, 0x01062454, 0x48edf362,
+0x06245438, 0xedf36202, 0x24543848, 0xf3620306,
+0xda1f48dd, 0x93f9c500, 0xb8c0fec3, 0x0000067c,
+0x0122850f, 0xf1620000, 0x546f48fd, 0xf2620924,
+0x547648e5, 0xf1620524, 0x6c6f48fd, 0xf2620a24,
+0x5c7e48d5, 0x44c70524, 0x00046024, 0xf1620000,
+0xcbd448f5, 0x4489c031, 0xf1626424, 0xcafb48f5,
+0x48edf362, 0x07245425, 0xf5f16255, 0x244cef48,
+0xf5f16207, 0xb8cafb48, 0x000006a6, 0x48fdf262,
+0x0c245459, 0x48f5f362, 0xc500e21f, 0xfed493f9,
+0xb1850fc2, 0x62000000, 0x7e08fef1, 0x6231244c,
+0x6f48fdf1, 0x62052474, 0x7f48fdf1, 0x62032474,
+0xd608fdf1, 0x6219244c, 0x7e08fef1, 0x6233244c,
+0xd608fdf1, 0x621b244c, 0x7e08fef1, 0x6235244c,
+0xd608fdf1, 0x621d244c, 0x7e08fef1, 0x6237244c,
+0xd608fdf1, 0xb01f244c, 0xfdf162aa, 0x244c6f48,
+0x92f9c505, 0xf5f262c8, 0x24546449, 0xedf36206,
+0x246c1f48, 0xf9c50003, 0xc2fed593, 0x00073ab8,
+0x62357500, 0x0348f5f3, 0xf16201d1, 0x0ddb58f5,
+0x00100640, 0x58f5f162, 0x06480dd4, 0x00ba0010,
+0x62000000, 0x1f48edf3, 0xf9c500f1, 0xc0fec693,
+0x00074ab8, 0xc2440f00, 0x5bf4658d, 0xc35d5f5e,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000008, 0x00000000, 0x0000000e, 0x00000000,
+0x00000012, 0x00000000, 0x00000014, 0x00000000,
+0x00000014, 0x00000000, 0x00000012, 0x00000000,
+0x0000000e, 0x00000000, 0x00000008, 0x00000000,
+0x00000007, 0x00000000, 0x00000001, 0x00000000,
+0003120,
+};
+asm(".type avx512dq_x86_32_D_64u8, STT_NOTYPE;");
+asm(".type avx512dq_x86_32_D_64u8, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512dq_x86_32_D_64f4[] = {
+0x000322e9, 0xc0315500, 0xe483e589, 0x81e8d9c0,
+0x000100ec, 0x0011b900, 0x54d90000, 0x89403824,
+0x244489ca, 0x83c2292c, 0x44db10f8, 0x54892c24,
+0x5cd92c24, 0x44db3c84, 0x5cd92c24, 0x94d97c84,
+0x0000bc84, 0x62d77500, 0x28487cf1, 0x62012454,
+0x28487cf1, 0x6202244c, 0x58586cf1, 0x100e4025,
+0x5cf16200, 0x62e15948, 0x28487cf1, 0x75f262d9,
+0x245c9848, 0x5cf16201, 0x00c3c248, 0xd093f8c5,
+0xfffffa81, 0xa7b80000, 0x0f000000, 0x00027685,
+0x7df26200, 0x001d1848, 0x6200100e, 0x28487cf1,
+0x5cf162e9, 0x62e35748, 0x9e4875f2, 0x6201246c,
+0xc2485cf1, 0xf8c500cd, 0xfa81d193, 0x0000ffff,
+0x0000abb8, 0x40850f00, 0x62000002, 0x58586cf1,
+0x100e0415, 0x6cf16200, 0x62d15948, 0x28487cf1,
+0x75f262e1, 0x24649a48, 0x6cf16201, 0x00d4c248,
+0xd293f8c5, 0xfffffa81, 0xafb80000, 0x0f000000,
+0x00020a85, 0x7cf16200, 0x62e12848, 0x57486cf1,
+0x75f262d3, 0x24649c48, 0x6cf16201, 0x00dcc248,
+0xd393f8c5, 0xfffffa81, 0xb3b80000, 0x0f000000,
+0x0001de85, 0x7cf16200, 0x24542848, 0x6cf16201,
+0x62e15848, 0x18487df2, 0x620e246c, 0x28487cf1,
+0x62022474, 0x98484df2, 0x5cf162ea, 0x00e5c248,
+0xd493f8c5, 0xfffffa81, 0xbbb80000, 0x0f000000,
+0x0001a285, 0x7cf16200, 0x62ea2848, 0x28487cf1,
+0x6202247c, 0x57485cf1, 0x45f262e3, 0x246c9e58,
+0x5cf1620e, 0x00edc248, 0xd593f8c5, 0xfffffa81,
+0xc0b80000, 0x0f000000, 0x00016e85, 0x6cf16200,
+0x62c95c48, 0x18487df2, 0x620e2464, 0x28487cf1,
+0x62022474, 0x9a484df2, 0x74f162e2, 0x00f4c248,
+0xd693f8c5, 0xfffffa81, 0xc5b80000, 0x0f000000,
+0x00013a85, 0x7cf16200, 0x62e22848, 0x28487cf1,
+0x6202247c, 0x574874f1, 0x45f262cb, 0x24649c58,
+0x74f1620e, 0x00fcc248, 0xd793f8c5, 0xfffffa81,
+0xcab80000, 0x0f000000, 0x00010685, 0x245cd900,
+0x6cf1623c, 0x246c5948, 0x7cf16202, 0x24642848,
+0x64f16203, 0x244c5748, 0x55f26203, 0x2464b658,
+0x55f2620f, 0x244cb658, 0x7cf1620f, 0x245c2848,
+0x7cf16202, 0x62ea2848, 0xa64865f2, 0x6203246c,
+0xc2485cf1, 0xf8c500c5, 0xfa81d093, 0x0000ffff,
+0x0000d4b8, 0xaa850f00, 0x62000000, 0xa7486df2,
+0x6203245c, 0xc24874f1, 0xf8c500cb, 0xfa81d193,
+0x0000ffff, 0x0000d8b8, 0x86850f00, 0x62000000,
+0x59486cf1, 0x6202246c, 0x28487cf1, 0x6203245c,
+0x28487cf1, 0x55f262e3, 0x2464b658, 0x7cf1620f,
+0x62ea2848, 0x964865f2, 0x6202246c, 0xc2485cf1,
+0xf8c500d5, 0xfa81d293, 0x0000ffff, 0x0000deb8,
+0x62427500, 0x974865f2, 0x62022454, 0xc24874f1,
+0xf8c500da, 0xfa81d393, 0x0000ffff, 0x0000e2b8,
+0x31227500, 0xdd1eebc0, 0xdd1aebd8, 0xdd16ebd8,
+0xdd12ebd8, 0xdd0eebd8, 0xdd0aebd8, 0xdd06ebd8,
+0xdd02ebd8, 0x55c3c9d8, 0xe589c031, 0xc0e48353,
+0x02c0ec81, 0xc1890000, 0x24448940, 0x0011ba14,
+0x44db0000, 0xc2291424, 0x14245489, 0xe283ca89,
+0x849cd901, 0x000000fc, 0x142444db, 0x3c849cd9,
+0xd9000001, 0xd9e0d9e8, 0xddc9dbe8, 0x04e2c1d9,
+0x9cd9e9d1, 0x00017c84, 0x89ca0900, 0x01bc8494,
+0xc2830000, 0x10f88308, 0xfc849489, 0x75000001,
+0x7cf162a5, 0x24742848, 0x7cf16204, 0x24742948,
+0x7cf16201, 0x244c2848, 0x74f16201, 0x00c6c248,
+0xd093f8c5, 0xfffffa81, 0x39b80000, 0x0f000005,
+0x000a1d85, 0x74f16200, 0x24545848, 0x7cf16204,
+0x24542948, 0x7cf16202, 0x24542848, 0x7cf16202,
+0x247c2848, 0x44f16204, 0x62df5848, 0xc2486cf1,
+0xf8c500d3, 0xfa81d293, 0x0000ffff, 0x00053fb8,
+0xdb850f00, 0x62000009, 0x5c486cf1, 0x62042454,
+0x29487cf1, 0x62032454, 0xc24874f1, 0x0003245c,
+0xd393f8c5, 0xfffffa81, 0x44b80000, 0x0f000005,
+0x0009ad85, 0x7cf16200, 0x24742848, 0x74f16205,
+0x244c5948, 0x4cf16204, 0x62de5948, 0x28487cf1,
+0x62042454, 0x58486cf1, 0x6cf162ee, 0x24645c48,
+0x74f16205, 0x62cb5c48, 0x59485cf1, 0x74f162e5,
+0x00e4c248, 0xd493f8c5, 0xfffffa81, 0x5bb80000,
+0x0f000005, 0x00095985, 0x6cf16200, 0x244c5948,
+0x7cf16206, 0x244c2948, 0x6cf16201, 0x24545e48,
+0x74f16206, 0x00eac248, 0xd593f8c5, 0xfffffa81,
+0x64b80000, 0x0f000005, 0x00092585, 0x7df26200,
+0x000d1848, 0x6200100e, 0x28487cf1, 0x6206245c,
+0x574864f1, 0x74f162d1, 0x244c5748, 0x6cf16204,
+0x24545948, 0x6cf16201, 0x00f1c248, 0xd693f8c5,
+0xfffffa81, 0x67b80000, 0x0f000005, 0x0008e185,
+0x7df16200, 0x244c5b48, 0x7cf16204, 0x62c95b48,
+0xc24874f1, 0x0004247c, 0xd793f8c5, 0xfffffa81,
+0x6eb80000, 0x0f000005, 0x0008b585, 0x7df26200,
+0x244c4c48, 0x7cf16204, 0x244c2948, 0x7cf16201,
+0x24642848, 0x7df26204, 0x244c4c48, 0x7df16201,
+0x62c95b48, 0x5b487cf1, 0x74f162c9, 0x00c4c248,
+0xd093f8c5, 0xfffffa81, 0x75b80000, 0x0f000005,
+0x00086d85, 0x5cf16200, 0x62cc5948, 0x29487cf1,
+0x6201244c, 0x4e487df2, 0x6201244c, 0x29487cf1,
+0x6202244c, 0x28487cf1, 0x6202244c, 0x4c487df2,
+0x7df162d1, 0x62d25b48, 0x5b487cf1, 0x6cf162d2,
+0x00d4c248, 0xd293f8c5, 0xfffffa81, 0x7cb80000,
+0x0f000005, 0x00081985, 0x7df26200, 0x24544c48,
+0x7df16204, 0x62c95b48, 0x5b487df1, 0x7cf162d2,
+0x62c95b48, 0x5b487cf1, 0x74f162d2, 0x00dac248,
+0xd393f8c5, 0xfffffa81, 0x7eb80000, 0x0f000005,
+0x0007dd85, 0x7cf16200, 0x247c2848, 0x7df36204,
+0x247c1b48, 0xfcc50014, 0x8024b428, 0xc5000002,
+0x247429fc, 0x7df16220, 0x244c7b48, 0xfdf16201,
+0x244c7f48, 0x7df36209, 0x247c1b48, 0xfcc50114,
+0x8024b428, 0xc5000002, 0x247429fc, 0x7df16220,
+0x244c7b48, 0xfdf16201, 0x244c7f48, 0xfcf1620a,
+0x24545b48, 0xfcf1620a, 0x244c5b48, 0xf5f36209,
+0x01ca1a48, 0x4874f162, 0x042464c2, 0x93f8c500,
+0xfffa81d4, 0xb80000ff, 0x00000588, 0x0750850f,
+0xf1620000, 0x4c79487c, 0xf1620424, 0xc97a487f,
+0x4874f162, 0x04246cc2, 0x93f8c500, 0xfffa81d5,
+0xb80000ff, 0x0000058f, 0x0724850f, 0xf1620000,
+0x7c28487c, 0xf3620424, 0x7c1b487d, 0xc5001424,
+0x24b428fc, 0x00000280, 0x7429fcc5, 0xf1622024,
+0x4c79487d, 0xf1620124, 0x4c7f48fd, 0xf3620924,
+0x7c1b487d, 0xc5011424, 0x24b428fc, 0x00000280,
+0x7429fcc5, 0xf1622024, 0x4c79487d, 0xf1620124,
+0x4c7f48fd, 0xf1620a24, 0x4c7a48ff, 0xf1620a24,
+0x547a48ff, 0xf3620924, 0xd11a48ed, 0x7cf16201,
+0x244c2848, 0x6cf16204, 0x00f1c248, 0xd693f8c5,
+0xfffffa81, 0x96b80000, 0x0f000005, 0x00069185,
+0x74f16200, 0x62d15948, 0x29487cf1, 0x62012454,
+0x51487cf1, 0x62012454, 0xc2486cf1, 0xf8c500f9,
+0xfa81d793, 0x0000ffff, 0x00059cb8, 0x5f850f00,
+0x62000006, 0x18487df2, 0x100e4015, 0x6cf16200,
+0x62c95e48, 0x29487cf1, 0x6201244c, 0x08487df3,
+0x0b012464, 0x487cf162, 0x0e400d28, 0xa4b80010,
+0x62000005, 0xc24874f1, 0xf8c500c4, 0xfa81d093,
+0x0000ffff, 0x0618850f, 0xf3620000, 0x4c56487d,
+0xc50b0424, 0x62e457d8, 0xc24874f1, 0xf8c500d4,
+0xfa81d293, 0x0000ffff, 0x0005abb8, 0xef850f00,
+0x62000005, 0x58486cf1, 0x6204244c, 0x5e486cf1,
+0x7cf162c9, 0x244c2948, 0x7df36201, 0x244c5648,
+0xf1620b01, 0x7c28487c, 0xf1620124, 0xd9c24844,
+0x93f8c500, 0xfffa81d3, 0xb80000ff, 0x000005b1,
+0x05ac850f, 0xf2620000, 0x0d18487d, 0x00100e08,
+0x4874f162, 0x04244c59, 0x487cf162, 0x01244c29,
+0x487df362, 0x01244c08, 0x7df3620b, 0x24645648,
+0xf1620b01, 0xcc584874, 0x487cf162, 0x01247428,
+0x484cf162, 0xc500e1c2, 0x81d493f8, 0x00fffffa,
+0x05bbb800, 0x850f0000, 0x00000556, 0x4864f162,
+0x04246459, 0x4864f162, 0x05245c59, 0x487cf162,
+0x02245c29, 0x485df362, 0x02244c50, 0x5df36205,
+0x24645048, 0xf1620402, 0x6429487c, 0xf1620224,
+0x4c584874, 0xf1620224, 0x7c28487c, 0xf1620424,
+0x4c594874, 0xf1620624, 0x5c584844, 0xf1620524,
+0xebc24874, 0x93f8c500, 0xfffa81d5, 0xb80000ff,
+0x0000063d, 0x04e8850f, 0xf1620000, 0x7428487c,
+0xf1620424, 0x5c28487c, 0xf3620524, 0xce23484d,
+0x7df3621b, 0x1bc90448, 0x4874f162, 0xc500f3c2,
+0x81d693f8, 0x00fffffa, 0x064eb800, 0x850f0000,
+0x000004ae, 0x487cf162, 0x04244c28, 0x4875f362,
+0x621be123, 0x04487df3, 0xf1621be4, 0xfbc2485c,
+0x93f8c500, 0xfffa81d7, 0xb80000ff, 0x00000653,
+0x047c850f, 0x84c70000, 0x00028024, 0x88000000,
+0x64f16241, 0xb8e95848, 0x0000065d, 0x487df262,
+0x8024a418, 0x62000002, 0xc2485cf1, 0xf8c500c5,
+0xfa81d093, 0x0000ffff, 0x0444850f, 0xf3620000,
+0x4c1b487d, 0x62001424, 0x1b487df2, 0x62142464,
+0x1a4875f3, 0x0114246c, 0x485cf162, 0xc500d5c2,
+0x3dc293f8, 0x0000ffff, 0x6cb80a74, 0xe9000006,
+0x0000040e, 0x487df362, 0x28244c19, 0x7df26200,
+0x246c1a48, 0x75f36228, 0x24641848, 0xf3620128,
+0x6418485d, 0x62022824, 0x18485df3, 0x03282464,
+0x4854f162, 0xc500dcc2, 0x3dc393f8, 0x0000ffff,
+0x7cb80a74, 0xe9000006, 0x000003c6, 0x087ef162,
+0x40246410, 0x085df362, 0x41246421, 0x29f8c510,
+0x028024a4, 0xf2620000, 0x6419487d, 0xe3c45024,
+0x24ac0479, 0x00000280, 0x000cb844, 0xf8c50000,
+0xf362c892, 0xcd184975, 0x0030b800, 0xf8c50000,
+0xf362c892, 0x4c184975, 0xc4012824, 0xac0479e3,
+0x00028024, 0xc0b84400, 0xc5000000, 0x62c892f8,
+0x184975f3, 0x00b801cd, 0xc5000003, 0x62c892f8,
+0x184975f3, 0x0228244c, 0x0479e3c4, 0x028024ac,
+0xb8440000, 0x00000c00, 0xc892f8c5, 0x4975f362,
+0xb802cd18, 0x00003000, 0xc892f8c5, 0x4975f362,
+0x28244c18, 0x79e3c403, 0x8024ac04, 0x44000002,
+0xffc000b8, 0x92f8c5ff, 0x75f362c8, 0x03cd1849,
+0x485cf162, 0xc500e1c2, 0x3dc493f8, 0x0000ffff,
+0x96b80a74, 0xe9000006, 0x000002e6, 0x487cf162,
+0x07244c28, 0x4865f262, 0x04244c77, 0x487df162,
+0x08247c6f, 0x4845f262, 0x04245c7f, 0x487cf162,
+0x02245c29, 0x4874f162, 0x84c7cb5c, 0x00028024,
+0x00000000, 0x74f16241, 0x244c5948, 0x7df26206,
+0x249c1848, 0x00000280, 0x4874f162, 0xc500ebc2,
+0x81d593f8, 0x00fffffa, 0x06a6b800, 0xf1620000,
+0x4c29487c, 0x850f0324, 0x00000276, 0x487cf162,
+0x04246c28, 0x487df362, 0x14246c1b, 0x28fcc500,
+0x028024b4, 0xfcc50000, 0x4024b429, 0x62000002,
+0x5a487cf1, 0x6212244c, 0x2948fdf1, 0x6201244c,
+0x5a48fdf1, 0xc501244c, 0x248c29fc, 0x00000280,
+0x84d9c031, 0x00010084, 0x8484d900, 0x00000280,
+0xd8dde9df, 0x0a74027a, 0x0006f1b8, 0x0210e900,
+0x83400000, 0xda7508f8, 0x487ef162, 0x04246412,
+0x487df262, 0x0e040d18, 0xf1620010, 0x645c485c,
+0xf1620424, 0x4c584874, 0xf2620624, 0x1d18487d,
+0x00100e0c, 0x4874f162, 0xf162cb59, 0xf1c2485c,
+0x93f8c500, 0xfffa81d6, 0xb80000ff, 0x00000717,
+0x01bc850f, 0xf1620000, 0x4c16487e, 0xf1620424,
+0x4c29487c, 0xf1620124, 0x6428487c, 0xf1620424,
+0x5458486c, 0xf1620624, 0xcc5c4874, 0x486cf162,
+0xf162d359, 0xfac24874, 0x93f8c500, 0xfffa81d7,
+0xb80000ff, 0x0000071e, 0x0174850f, 0x01b80000,
+0x62000000, 0x29487cf1, 0xd9022464, 0x01408484,
+0x9cd90000, 0x00008084, 0x02c08300, 0x7511f883,
+0xaaaab8ea, 0xf162ffff, 0x7c28487c, 0xf8c50424,
+0xf262c892, 0x4c654945, 0xf1620524, 0x44c24874,
+0xc5000224, 0x81d093f8, 0x00fffffa, 0x073ab800,
+0x850f0000, 0x0000011a, 0xf162e8d9, 0x4c28487c,
+0xf1620524, 0x6c28487c, 0x94d90424, 0x00028024,
+0x55f26200, 0x248cb658, 0x00000280, 0x487cf162,
+0x04247428, 0x484cf162, 0x0524545c, 0x494cf162,
+0x05245458, 0x4874f162, 0xc500d2c2, 0x81d293f8,
+0x00fffffa, 0x0743b800, 0x850f0000, 0x000000c0,
+0x487df362, 0x04244c26, 0x7cf16200, 0x244c2948,
+0x7df26201, 0x244c4248, 0x7cf16204, 0x244c2948,
+0x31c93102, 0x7df162d2, 0x62c96e08, 0xd608fdf1,
+0xdf03244c, 0xd918246c, 0x00809484, 0xe9df0000,
+0x627ad8dd, 0x428d6475, 0x025a8d01, 0xfb83c321,
+0x00d18301, 0x0a75c285, 0x3c8444d9, 0x537ae9df,
+0xf8835575, 0x89047410, 0xddbaebc2, 0x7cf162d8,
+0x246c2848, 0x55f26201, 0x244c2c48, 0x7cf16202,
+0x24742848, 0x077db804, 0xf1620000, 0xd9c2484c,
+0x93f8c500, 0xfffa81d3, 0x750000ff, 0xf243e825,
+0xd8f7ffff, 0xd8dd1ceb, 0xd8dd02eb, 0x000773b8,
+0xdd0feb00, 0xdd02ebd8, 0x0778b8d8, 0x02eb0000,
+0x5d8bd8dd, 0x00c3c9fc, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x80000000, 0xbf800000, 0x3e800000, 0x3f000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x3f800000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0007200,
+};
+asm(".type avx512dq_x86_32_D_64f4, STT_NOTYPE;");
+asm(".type avx512dq_x86_32_D_64f4, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512dq_x86_32_D_64f8[] = {
+0x0002eee9, 0xc0315500, 0xe483e589, 0x00ec81c0,
+0xb9000001, 0x00000009, 0x54dde8d9, 0x89403024,
+0x892c2444, 0x2444dbca, 0x83c2292c, 0x548908f8,
+0x5cdd2c24, 0x44db38c4, 0x5cdd2c24, 0x94dd78c4,
+0x0000b8c4, 0x62d77500, 0x2848fdf1, 0x62012454,
+0x2848fdf1, 0x6202244c, 0x5858edf1, 0x100b8025,
+0xddf16200, 0x62e15948, 0x2848fdf1, 0xf5f262d9,
+0x245c9848, 0xddf16201, 0x00c3c248, 0xd093f9c5,
+0xa7b8c2fe, 0x0f000000, 0x00024685, 0xfdf26200,
+0x401d1948, 0x6200100b, 0x2848fdf1, 0xddf162e9,
+0x62e35748, 0x9e48f5f2, 0x6201246c, 0xc248ddf1,
+0xf9c500cd, 0xc2fed193, 0x0000abb8, 0x14850f00,
+0x62000002, 0x5858edf1, 0x100b4815, 0xedf16200,
+0x62d15948, 0x2848fdf1, 0xf5f262e1, 0x24649a48,
+0xedf16201, 0x00d4c248, 0xd293f9c5, 0xafb8c2fe,
+0x0f000000, 0x0001e285, 0xfdf16200, 0x62e12848,
+0x5748edf1, 0xf5f262d3, 0x24649c48, 0xedf16201,
+0x00dcc248, 0xd393f9c5, 0xb3b8c2fe, 0x0f000000,
+0x0001ba85, 0xfdf16200, 0x24542848, 0xedf16201,
+0x62e15848, 0x1948fdf2, 0x6206246c, 0x2848fdf1,
+0x62022474, 0x9848cdf2, 0xddf162ea, 0x00e5c248,
+0xd493f9c5, 0xbbb8c2fe, 0x0f000000, 0x00018285,
+0xfdf16200, 0x62ea2848, 0x2848fdf1, 0x6202247c,
+0x5748ddf1, 0xc5f262e3, 0x246c9e58, 0xddf16206,
+0x00edc248, 0xd593f9c5, 0xc0b8c2fe, 0x0f000000,
+0x00015285, 0xedf16200, 0x62c95c48, 0x1948fdf2,
+0x62062464, 0x2848fdf1, 0x62022474, 0x9a48cdf2,
+0xf5f162e2, 0x00f4c248, 0xd693f9c5, 0xc5b8c2fe,
+0x0f000000, 0x00012285, 0xfdf16200, 0x62e22848,
+0x2848fdf1, 0x6202247c, 0x5748f5f1, 0xc5f262cb,
+0x24649c58, 0xf5f16206, 0x00fcc248, 0xd793f9c5,
+0xcab8c2fe, 0x0f000000, 0x0000f285, 0x245cdd00,
+0xedf16238, 0x246c5948, 0xfdf16202, 0x24642848,
+0xe5f16203, 0x244c5748, 0xd5f26203, 0x2464b658,
+0xd5f26207, 0x244cb658, 0xfdf16207, 0x245c2848,
+0xfdf16202, 0x62ea2848, 0xa648e5f2, 0x6203246c,
+0xc248ddf1, 0xf9c500c5, 0xc2fed093, 0x0000d4b8,
+0x9a850f00, 0x62000000, 0xa748edf2, 0x6203245c,
+0xc248f5f1, 0xf9c500cb, 0xc2fed193, 0x0000d8b8,
+0x627e7500, 0x5948edf1, 0x6202246c, 0x2848fdf1,
+0x6203245c, 0x2848fdf1, 0xd5f262e3, 0x2464b658,
+0xfdf16207, 0x62ea2848, 0x9648e5f2, 0x6202246c,
+0xc248ddf1, 0xf9c500d5, 0xc2fed293, 0x0000deb8,
+0x623e7500, 0x9748e5f2, 0x62022454, 0xc248f5f1,
+0xf9c500da, 0xc2fed393, 0x0000e2b8, 0x31227500,
+0xdd1eebc0, 0xdd1aebd8, 0xdd16ebd8, 0xdd12ebd8,
+0xdd0eebd8, 0xdd0aebd8, 0xdd06ebd8, 0xdd02ebd8,
+0x55c3c9d8, 0xe589c031, 0x000009ba, 0xe4835300,
+0x40ec81c0, 0x89000002, 0x448940c3, 0xd1891424,
+0x142444db, 0x4c89c129, 0xd9891424, 0xdd01e183,
+0x00f8c49c, 0x44db0000, 0x9cdd1424, 0x000138c4,
+0xd9e8d900, 0xdbe8d9e0, 0xd1d9ddc9, 0x03e1c1eb,
+0x78c49cdd, 0x09000001, 0xc48c89d9, 0x000001b8,
+0xc183db31, 0xc49c8904, 0x000001bc, 0x8300d383,
+0x8c8908f8, 0x0001f8c4, 0xc49c8900, 0x000001fc,
+0xf1629575, 0x742848fd, 0xf1620424, 0x742948fd,
+0xf1620124, 0x4c2848fd, 0xf1620124, 0xc6c248f5,
+0x93f9c500, 0xb8c2fed0, 0x00000539, 0x075d850f,
+0xf1620000, 0x545848f5, 0xf1620424, 0x542948fd,
+0xf1620224, 0x542848fd, 0xf1620224, 0x7c2848fd,
+0xf1620424, 0xdf5848c5, 0x48edf162, 0xc500d3c2,
+0xfed293f9, 0x053fb8c2, 0x850f0000, 0x0000071f,
+0x48edf162, 0x0424545c, 0x48fdf162, 0x03245429,
+0x48f5f162, 0x03245cc2, 0x93f9c500, 0xb8c2fed3,
+0x00000544, 0x06f5850f, 0xf1620000, 0x6c2848fd,
+0xf1620524, 0x4c5948f5, 0xf1620424, 0xdd5948d5,
+0x48fdf162, 0x04245428, 0x48edf162, 0xf162ed58,
+0x645c48ed, 0xf1620524, 0xcb5c48f5, 0x48ddf162,
+0xf162e559, 0xe4c248f5, 0x93f9c500, 0xb8c2fed4,
+0x0000055b, 0x06a5850f, 0xf1620000, 0x4c5948ed,
+0xf1620624, 0x4c2948fd, 0xf1620124, 0x545e48ed,
+0xf1620624, 0xeac248f5, 0x93f9c500, 0xb8c2fed5,
+0x00000564, 0x0675850f, 0xf2620000, 0x0d1948fd,
+0x00100b40, 0x48fdf162, 0x06245428, 0x48edf162,
+0xf162d957, 0x4c5748f5, 0xf1620424, 0x5c5948e5,
+0xf1620124, 0xf1c248e5, 0x93f9c500, 0xb8c2fed6,
+0x00000567, 0x0635850f, 0xf1620000, 0x4ce648ff,
+0xf1620424, 0xc9e6487e, 0x48f5f162, 0x04247cc2,
+0x93f9c500, 0xb8c2fed7, 0x0000056e, 0x060d850f,
+0xf2620000, 0x4c4c48fd, 0xf1620424, 0x4c2948fd,
+0xf1620124, 0x642848fd, 0xf2620424, 0x4c4c48fd,
+0xf1620124, 0xc9e648ff, 0x487ef162, 0xf162c9e6,
+0xc4c248f5, 0x93f9c500, 0xb8c2fed0, 0x00000575,
+0x05c9850f, 0xf1620000, 0xcc5948dd, 0x48fdf162,
+0x01244c29, 0x48fdf262, 0x01244c4e, 0x48fdf162,
+0x02244c29, 0x48fdf162, 0x02244c28, 0x48fdf262,
+0xf162d94c, 0xdbe648ff, 0x487ef162, 0xf162dbe6,
+0xd4c248e5, 0x93f9c500, 0xb8c2fed2, 0x0000057c,
+0x0579850f, 0xf2620000, 0x5c4c48fd, 0xf1620424,
+0xc9e648ff, 0x48fff162, 0xf162dbe6, 0xc9e6487e,
+0x487ef162, 0xf162dbe6, 0xdbc248f5, 0x93f9c500,
+0xb8c2fed3, 0x0000057e, 0x0541850f, 0xf1620000,
+0x4c7b48fd, 0xf1620424, 0xc9e648fe, 0x48f5f162,
+0x042464c2, 0x93f9c500, 0xb8c2fed4, 0x00000588,
+0x0519850f, 0xf1620000, 0x4c7948fc, 0xf1620424,
+0xc97a487e, 0x48f5f162, 0x04246cc2, 0x93f9c500,
+0xb8c2fed5, 0x0000058f, 0x04f1850f, 0xf1620000,
+0x5c7948fd, 0xf1620424, 0xdb7a48fe, 0x48fdf162,
+0x04244c28, 0x48e5f162, 0xc500f1c2, 0xfed693f9,
+0x0596b8c2, 0x850f0000, 0x000004c3, 0x48f5f162,
+0xf162d959, 0x5c2948fd, 0xf1620124, 0x5c5148fd,
+0xf1620124, 0xf9c248e5, 0x93f9c500, 0xb8c2fed7,
+0x0000059c, 0x0495850f, 0xf2620000, 0x1d1948fd,
+0x00100b80, 0x48e5f162, 0xf162c95e, 0x4c2948fd,
+0xf3620124, 0x640948fd, 0x620b0124, 0x2848fdf1,
+0x100b800d, 0x05a4b800, 0xf1620000, 0xccc248f5,
+0x93f9c500, 0x0fc2fed1, 0x00045285, 0xfdf36200,
+0x244c5648, 0xd9c50b04, 0xf162e457, 0xc4c248f5,
+0x93f9c500, 0xb8c2fed0, 0x000005ab, 0x042d850f,
+0xf1620000, 0x4c5848e5, 0xf1620424, 0xd95e48e5,
+0x48fdf162, 0x01245c29, 0x48fdf362, 0x01244c56,
+0xfdf1620b, 0x24742848, 0xcdf16201, 0x00d1c248,
+0xd293f9c5, 0xb1b8c2fe, 0x0f000005, 0x0003ee85,
+0xfdf26200, 0x500d1948, 0x6200100b, 0x5948f5f1,
+0x6204244c, 0x2948fdf1, 0x6201244c, 0x0948fdf3,
+0x0b01244c, 0x48fdf362, 0x01245c56, 0xf5f1620b,
+0x62cb5848, 0x2848fdf1, 0x6201247c, 0xc248c5f1,
+0xf9c500d9, 0xc2fed393, 0x0005bbb8, 0x9c850f00,
+0x62000003, 0x5948edf1, 0x6204245c, 0x5948edf1,
+0x62052454, 0x2948fdf1, 0x62022454, 0x5048e5f3,
+0x0502244c, 0x48e5f362, 0x02245c50, 0xfdf16204,
+0x245c2948, 0xf5f16202, 0x244c5848, 0xfdf16202,
+0x246c2848, 0xf5f16204, 0x244c5948, 0xd5f16206,
+0x24545848, 0xf5f16205, 0x00e2c248, 0xd493f9c5,
+0x3db8c2fe, 0x0f000006, 0x00033285, 0xfdf16200,
+0x24742848, 0xfdf16204, 0x24542848, 0xcdf36205,
+0x1bce2348, 0x48fdf362, 0x6255c905, 0xc248f5f1,
+0xf9c500ea, 0xc2fed593, 0x00064eb8, 0xfc850f00,
+0x62000002, 0x2848fdf1, 0x6204244c, 0x2348f5f3,
+0xf3621bd9, 0xdb0548fd, 0xe5f16255, 0x00f2c248,
+0xd693f9c5, 0x53b8c2fe, 0x0f000006, 0x0002ce85,
+0xc005d900, 0x6200100b, 0x5848edf1, 0x065db8e1,
+0x5cdd0000, 0xf2622024, 0x5c1948fd, 0xf1620424,
+0xfcc248e5, 0x93f9c500, 0x0fc2fed7, 0x00029e85,
+0xfdf36200, 0x244c1b48, 0xf2620001, 0x5c1b48fd,
+0xf3620124, 0x641a48f5, 0x62010124, 0xc248e5f1,
+0xf9c500cc, 0xc0fec193, 0x00066cb8, 0x6c850f00,
+0x62000002, 0x1948fdf3, 0x0002244c, 0x48fdf262,
+0x02245c1a, 0x48f5f362, 0x02244c18, 0xf5f36201,
+0x244c1848, 0xf3620202, 0x4c1848f5, 0x62030224,
+0xc248e5f1, 0xf9c500c1, 0xc0fec093, 0x00067cb8,
+0x28850f00, 0x62000002, 0x2848fdf1, 0x6207244c,
+0x7748edf2, 0x6204244c, 0x6f48fdf1, 0x6208247c,
+0x7f48c5f2, 0xd9042454, 0x100bc405, 0xf5f16200,
+0x62ca5c48, 0x5948f5f1, 0xb806244c, 0x000006a6,
+0x48fdf162, 0x03244c29, 0x20245cdd, 0x48fdf262,
+0x04245419, 0x48f5f162, 0xc500d2c2, 0xfed293f9,
+0xc8850fc2, 0x62000001, 0x1248fff1, 0x62042454,
+0x1948fdf2, 0x100b480d, 0xfdf16200, 0x245c2848,
+0xf5f16204, 0x244c5848, 0xedf16206, 0x62d35c48,
+0x5958f5f1, 0x100b580d, 0xedf16200, 0x00d9c248,
+0xd393f9c5, 0x17b8c2fe, 0x0f000007, 0x00017e85,
+0xfdf16200, 0x245c2948, 0xfff16202, 0x246c1008,
+0xfff16229, 0x24741008, 0xfff1622b, 0x246c1108,
+0xfff16211, 0x247c1008, 0xfff1622d, 0x246c1008,
+0xfff1622f, 0x24741108, 0xfff16213, 0x247c1108,
+0xfff16215, 0x246c1108, 0x62aab017, 0x2848fdf1,
+0xc5042474, 0x62c892f9, 0x6549cdf2, 0x6205244c,
+0xc248f5f1, 0x00022464, 0xd493f9c5, 0x3ab8c2fe,
+0x0f000007, 0x00010685, 0x2444c700, 0xf0000024,
+0x62c0313f, 0x2848fdf1, 0x8905244c, 0x62202444,
+0x2848fdf1, 0x6204247c, 0xb658c5f2, 0x6204244c,
+0x2848fdf1, 0x6204246c, 0x5c48d5f1, 0x62052454,
+0x5849d5f1, 0x62052454, 0xc248f5f1, 0xf9c500ea,
+0xc2fed593, 0x000743b8, 0xb0850f00, 0x62000000,
+0x2648fdf3, 0x0004244c, 0x48fdf162, 0x01244c29,
+0x48fdf262, 0x04244c42, 0x48fdf162, 0x02244c29,
+0xd231c931, 0x087df162, 0xf162c96e, 0x4cd608fd,
+0x6cdf0324, 0x84dd1824, 0x000080d4, 0xdde9df00,
+0x75607ad8, 0x01428d5e, 0x21025a8d, 0x01fb83c3,
+0x8500d183, 0xd90e75d0, 0xc444dde8, 0xdde9df38,
+0x75477ad8, 0x08f88345, 0xc2890474, 0xf162b6eb,
+0x7c2848fd, 0xf2620124, 0x4c2c48c5, 0xf1620224,
+0x6c2848fd, 0x7db80424, 0x62000007, 0xc248d5f1,
+0xf9c500f1, 0xc2fed693, 0x16e81575, 0xf7fffff5,
+0xb80cebd8, 0x00000773, 0x78b805eb, 0x8b000007,
+0xc3c9fc5d, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x80000000, 0x00000000, 0xbff00000,
+0x00000000, 0x3fd00000, 0x00000000, 0x3fe00000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x3ff00000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x41100000, 0x40800000,
+0005710,
+};
+asm(".type avx512dq_x86_32_D_64f8, STT_NOTYPE;");
+asm(".type avx512dq_x86_32_D_64f8, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512dq_x86_32_D_16i4[] = {
+0x83e58955, 0x02e8f0e4, 0xc9000000, 0x20b955c3,
+0x89000000, 0x57c031e5, 0x000005bf, 0x81535600,
+0x0000bcec, 0x89c38900, 0x40da89fe, 0x2901e283,
+0x01fa83c6, 0xe283d219, 0xd8854a02, 0x89490175,
+0x83848544, 0x748904f8, 0x54899485, 0x4c89a485,
+0xd175b485, 0x087df162, 0xff88b56f, 0xf162ffff,
+0xb57f087d, 0xffffff58, 0x087df162, 0xff588d6f,
+0xf362ffff, 0xc61f0875, 0x93f9c500, 0x0ffa80d0,
+0x000539b8, 0xd1850f00, 0x62000005, 0xfe0875f1,
+0xffff8895, 0x7df162ff, 0x68957f08, 0x62ffffff,
+0x720865f1, 0xffff88b5, 0xf16201ff, 0x956f087d,
+0xffffff68, 0x00053fb8, 0x6df36200, 0x00d31f08,
+0xd293f9c5, 0x0f0ffa80, 0x00058f85, 0x6df16200,
+0x8895fa08, 0x62ffffff, 0x7f087df1, 0xffff7895,
+0x75f362ff, 0x789d1f08, 0x00ffffff, 0xd393f9c5,
+0xb80ffa80, 0x00000544, 0x055e850f, 0xf1620000,
+0xbd6f087d, 0xffffff98, 0x0875f262, 0xff888d40,
+0xf262ffff, 0xdf400845, 0x087df162, 0xff88956f,
+0xf162ffff, 0xeffe086d, 0x086df162, 0xff98a5fa,
+0xf162ffff, 0xcbfa0875, 0x00055bb8, 0x5df26200,
+0x62e54008, 0x1f0875f3, 0xf9c500e4, 0xfa80d493,
+0x05850f0f, 0x62000005, 0x40086df2, 0xffff988d,
+0x75f362ff, 0x702d1f08, 0x00001006, 0xd593f9c5,
+0xb80ffa80, 0x000005c8, 0x04de850f, 0xf1620000,
+0x8def086d, 0xffffffa8, 0x087df162, 0xf162c87e,
+0x8d7f087d, 0xffffff58, 0x08f5f262, 0xff988d28,
+0x6df7ffff, 0x78858998, 0x8bffffff, 0x9589a045,
+0xffffff7c, 0xff60adf7, 0x4589ffff, 0x05e1b880,
+0x55890000, 0x75f36284, 0x78b51f08, 0x00ffffff,
+0xd693f9c5, 0x0f0ffa80, 0x00047f85, 0x6df26200,
+0xa89d4008, 0x62ffffff, 0x7f087df1, 0xffff789d,
+0x75f162ff, 0x78b57208, 0x03ffffff, 0x087df162,
+0xff588d7f, 0xf162ffff, 0xb572085d, 0xffffff78,
+0x5df16202, 0xb8ecfe08, 0x000005ed, 0x0875f362,
+0xc500fd1f, 0x80d793f9, 0x850f0ffa, 0x0000042c,
+0x0875f162, 0xff58a572, 0x6202ffff, 0xfe0875f1,
+0x05f2b8c9, 0xf3620000, 0xc11f085d, 0x93f9c500,
+0x0ffa80d0, 0x0402850f, 0x85c70000, 0xffffff54,
+0x00000003, 0xff54858b, 0x8589ffff, 0xffffff40,
+0x891ff8c1, 0xffff4485, 0xfef162ff, 0xe8757e08,
+0x0865f162, 0x85c7cef2, 0xffffff54, 0x00000002,
+0xff54858b, 0x8589ffff, 0xffffff40, 0x891ff8c1,
+0xffff4485, 0xfef162ff, 0xe87d7e08, 0x0865f162,
+0xf162dff2, 0xe3fe0865, 0x000605b8, 0x75f36200,
+0x00cc1f08, 0xd193f9c5, 0x0f0ffa80, 0x00038b85,
+0x54858b00, 0x89ffffff, 0xffff4085, 0x1ff8c1ff,
+0xff448589, 0xf162ffff, 0x757e08fe, 0x75f162e8,
+0x62cee208, 0xfe0875f1, 0x0609b8c9, 0xf3620000,
+0xd11f0865, 0x93f9c500, 0x0ffa80d2, 0x034a850f,
+0xf1620000, 0xc9ef0875, 0x087df162, 0xffb8bd6f,
+0xf362ffff, 0xc91f0845, 0x6df26206, 0xa89d4089,
+0x62ffffff, 0x470865f2, 0xffffb8a5, 0x0001b8ff,
+0xf1620000, 0xad6f087d, 0xffffffb8, 0x087df262,
+0xf162c87c, 0xc9fa0855, 0x087df162, 0xffb88d7f,
+0xf262ffff, 0x8d470865, 0xffffffb8, 0x000621b8,
+0x75f16200, 0x62e9fe08, 0x1f085df3, 0xf9c500dd,
+0xfa80d393, 0xd1850f0f, 0x62000002, 0x460875f2,
+0xffffb88d, 0x0626b8ff, 0xf3620000, 0xe31f0875,
+0x93f9c500, 0x0ffa80d4, 0x02ae850f, 0xf1620000,
+0x8d6f087d, 0xffffffa8, 0x0875f262, 0xff989d40,
+0xf262ffff, 0xe2400875, 0x087df162, 0xff689d7f,
+0xf262ffff, 0x9d3d085d, 0xffffff68, 0x085df262,
+0xff68a539, 0xf162ffff, 0xa57f087d, 0xffffff68,
+0x0865f162, 0xff689dfe, 0x3db8ffff, 0x62000006,
+0xfe086df1, 0xffff98a5, 0x65f262ff, 0x62d94008,
+0x1f0865f3, 0xf9c500ec, 0xfa80d593, 0x39850f0f,
+0x62000002, 0x40086df2, 0x7df162d9, 0x589d7f08,
+0x62ffffff, 0x1e087df2, 0xffff589d, 0x65f362ff,
+0x00f21f08, 0xd693f9c5, 0xb80ffa80, 0x00000644,
+0x0206850f, 0xf1620000, 0x956f087d, 0xffffff98,
+0x087df162, 0xff889d6f, 0xf162ffff, 0xe370087d,
+0x5df3621b, 0x00fa1f08, 0xd793f9c5, 0xb80ffa80,
+0x0000064e, 0x01d2850f, 0x45c70000, 0x000005d8,
+0x6df16200, 0xb8dbfe08, 0x0000065d, 0x087df262,
+0x62f66558, 0x1f085df3, 0xf9c500c3, 0xfa80d093,
+0xa5850f0f, 0xb8000001, 0x00000005, 0x087df262,
+0xf362e07c, 0xcb1f085d, 0x93f9c500, 0x0ffa80d1,
+0x000661b8, 0x81850f00, 0x62000001, 0x62086df1,
+0xffff889d, 0x6df162ff, 0x88956a08, 0xc7ffffff,
+0x0002d845, 0xf1620000, 0xd2fa0865, 0x0006a6b8,
+0x6df26200, 0x62d14008, 0x58087df2, 0xf362f65d,
+0xd31f086d, 0x93f9c500, 0x0ffa80d2, 0x013a850f,
+0xf2620000, 0x95400875, 0xffffff88, 0x0875f162,
+0x621fe172, 0x7f087df1, 0xffff5895, 0x6df162ff,
+0x62d16208, 0x6f087df1, 0xffff58b5, 0x7df262ff,
+0x62ce2508, 0x1f0875f3, 0xf9c500da, 0xfa80d393,
+0x06b3b80f, 0x850f0000, 0x000000f0, 0x087df162,
+0xff88956f, 0xf162ffff, 0x957f087d, 0xffffffc8,
+0x087df162, 0xffc8bd6f, 0xf262ffff, 0xcf25087d,
+0x087df162, 0xff588d7f, 0xf162ffff, 0xad6f087d,
+0xffffff58, 0x087ef262, 0xf162e935, 0x8d7f087d,
+0xffffffd8, 0x3988458b, 0x850fd845, 0x00000097,
+0x398c458b, 0x850fdc45, 0x0000008b, 0x629c458b,
+0x7f087df1, 0xffff6895, 0x6c8589ff, 0x8bffffff,
+0x8589a445, 0xffffff74, 0x087df162, 0xff888d6f,
+0xe3c4ffff, 0x98550271, 0x6df3620a, 0x68a51f08,
+0x00ffffff, 0xd493f9c5, 0xb80ffa80, 0x0000073a,
+0xf3624a75, 0xd9030875, 0x0003b801, 0x00ba0000,
+0x62000000, 0x7c087df2, 0x0001b8d0, 0xf1620000,
+0xcadb0875, 0x087df262, 0xf162d07c, 0xcafe0875,
+0x0865f362, 0xc500e91f, 0x3cc593f9, 0x074ab80f,
+0x440f0000, 0xb805ebc2, 0x000006f1, 0x00bcc481,
+0x5e5b0000, 0x00c35d5f, 0x00000000, 0x00000000,
+0x00000004, 0x00000006, 0x00000006, 0x00000004,
+0003200,
+};
+asm(".type avx512dq_x86_32_D_16i4, STT_NOTYPE;");
+asm(".type avx512dq_x86_32_D_16i4, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512dq_x86_32_D_16u4[] = {
+0x83e58955, 0x02e8f0e4, 0xc9000000, 0x20ba55c3,
+0x89000000, 0x57c031e5, 0x000005bf, 0x81535600,
+0x0000acec, 0x89c38900, 0x40d989fe, 0x2901e183,
+0xd88549c6, 0x894a0175, 0x83848544, 0x748904f8,
+0x4c899485, 0x5489a485, 0xd975b485, 0x087df162,
+0xff88bd6f, 0xf162ffff, 0xbd7f087d, 0xffffff58,
+0x087df162, 0xff58956f, 0xf362ffff, 0xc71f086d,
+0x93f9c500, 0x0ffa80d0, 0x000539b8, 0x0a850f00,
+0x62000005, 0xfe086df1, 0xffff888d, 0x7df162ff,
+0x688d7f08, 0x62ffffff, 0x720865f1, 0xffff88b5,
+0xf16201ff, 0x8d6f087d, 0xffffff68, 0x00053fb8,
+0x75f36200, 0x00cb1f08, 0xd193f9c5, 0x0f0ffa80,
+0x0004c885, 0x75f16200, 0x888dfa08, 0x62ffffff,
+0x7f087df1, 0xffff788d, 0x7df162ff, 0x789d6f08,
+0x62ffffff, 0x1f086df3, 0xf9c500d3, 0xfa80d293,
+0x0544b80f, 0x850f0000, 0x00000491, 0x086df162,
+0xff9895eb, 0xf162ffff, 0x957f087d, 0xffffff58,
+0x0875f162, 0xff988ddb, 0xf162ffff, 0x9def0865,
+0xffffff98, 0x0875f162, 0xff588ddf, 0xf362ffff,
+0xdb1f0875, 0x93f9c500, 0x0ffa80d3, 0x000550b8,
+0x46850f00, 0x62000004, 0x6f087df1, 0xffff8895,
+0x6df262ff, 0x988d4008, 0x62ffffff, 0x1f0875f3,
+0x1005a025, 0xf9c50000, 0xfa80d493, 0x05c8b80f,
+0x850f0000, 0x00000415, 0x086df162, 0xffa88def,
+0xf162ffff, 0xc87e087d, 0x087df162, 0xff588d7f,
+0xf162ffff, 0x8df408f5, 0xffffff98, 0x899865f7,
+0xffff7885, 0xa0458bff, 0xff7c9589, 0xa5f7ffff,
+0xffffff60, 0xb8804589, 0x000005e1, 0x62845589,
+0x1f0875f3, 0xffff78ad, 0xf9c500ff, 0xfa80d593,
+0xb6850f0f, 0x62000003, 0x7f087df1, 0xffff7895,
+0x75f162ff, 0x78b57208, 0x03ffffff, 0x087df162,
+0xff588d7f, 0xf162ffff, 0xb5720865, 0xffffff78,
+0x65f16202, 0xb8e3fe08, 0x000005ed, 0x0875f362,
+0xc500f41f, 0x80d693f9, 0x850f0ffa, 0x0000036d,
+0x0875f162, 0xff589572, 0x6202ffff, 0xfe0875f1,
+0x05f2b8c9, 0xf3620000, 0xf91f0865, 0x93f9c500,
+0x0ffa80d7, 0x0343850f, 0x85c70000, 0xffffff54,
+0x00000003, 0x087df162, 0x62d54d6e, 0xf2086df1,
+0x5485c7c9, 0x02ffffff, 0x62000000, 0x6e087df1,
+0xf162d55d, 0xdbf2086d, 0x0865f162, 0x05b8e3fe,
+0x62000006, 0x1f0875f3, 0xf9c500c4, 0xfa80d093,
+0xf6850f0f, 0x62000002, 0x6e087df1, 0xf162d565,
+0xccd20875, 0x0875f162, 0x09b8c9fe, 0x62000006,
+0x1f0865f3, 0xf9c500c9, 0xfa80d193, 0xca850f0f,
+0xc5000002, 0x62c976f1, 0x6f087df1, 0x65f162e2,
+0xc5dbef08, 0xb85d76e1, 0x0875f362, 0x6240e325,
+0x47085df2, 0xffffb8ad, 0x75f162ff, 0xb89dfe08,
+0x62ffffff, 0x7f087df1, 0xffffb89d, 0x5df262ff,
+0xb89d4708, 0xb8ffffff, 0x00000621, 0x0865f162,
+0xf362f3fe, 0xd61f0855, 0x93f9c500, 0x0ffa80d2,
+0x0267850f, 0xf2620000, 0x9d450865, 0xffffffb8,
+0x000626b8, 0x65f36200, 0x00dc1f08, 0xd393f9c5,
+0x0f0ffa80, 0x00024485, 0x6df26200, 0x989d3b08,
+0x62ffffff, 0x3f086df2, 0xffff98a5, 0x6df162ff,
+0x9895fe08, 0x62ffffff, 0xfe0865f1, 0x0634b8dc,
+0xf3620000, 0xe21f0865, 0x93f9c500, 0x0ffa80d4,
+0x0207850f, 0xf1620000, 0x956f087d, 0xffffff98,
+0x087df162, 0xff889d6f, 0xf162ffff, 0xe370087d,
+0x5df3621b, 0x00ea1f08, 0xd593f9c5, 0xb80ffa80,
+0x0000064e, 0x01d3850f, 0x45c70000, 0x000005d8,
+0x6df16200, 0xb8dbfe08, 0x0000065d, 0x087df262,
+0x62f66558, 0x1f085df3, 0xf9c500f3, 0xfa80d693,
+0xa6850f0f, 0xb8000001, 0x00000005, 0x087df262,
+0xf362e07c, 0xfb1f085d, 0x93f9c500, 0x0ffa80d7,
+0x000661b8, 0x82850f00, 0x62000001, 0x62086df1,
+0xffff889d, 0x6df162ff, 0x88956a08, 0xc7ffffff,
+0x0002d845, 0xf1620000, 0xcafe0875, 0x086df362,
+0xffa89525, 0x6255ffff, 0xfa0875f1, 0x06a6b8cb,
+0xf1620000, 0x8def0875, 0xffffffa8, 0x0875f162,
+0xf262cafa, 0x5558087d, 0x75f362f6, 0x00c21f08,
+0xd093f9c5, 0x0f0ffa80, 0x00012085, 0x7df26200,
+0xf1553508, 0x087df162, 0xff88ad6f, 0xf262ffff,
+0xcd35087d, 0x0875f362, 0xc500ca1f, 0x80d193f9,
+0xd3b80ffa, 0x0f000006, 0x0000f085, 0x7df16200,
+0x88956f08, 0x62ffffff, 0x7f087df1, 0xffffc895,
+0x7df162ff, 0xc8b56f08, 0x62ffffff, 0x35087df2,
+0x7df162ce, 0x588d7f08, 0x62ffffff, 0x6f087df1,
+0xffff58bd, 0x7ef262ff, 0x62f93508, 0x7f087df1,
+0xffffd88d, 0x88458bff, 0x0fd84539, 0x00009785,
+0x8c458b00, 0x0fdc4539, 0x00008b85, 0x9c458b00,
+0x087df162, 0xff68957f, 0x8589ffff, 0xffffff6c,
+0x89a4458b, 0xffff7485, 0x7df162ff, 0x888d6f08,
+0xc4ffffff, 0x550271e3, 0xf3620a98, 0x951f086d,
+0xffffff68, 0x93f9c500, 0x0ffa80d2, 0x00073ab8,
+0x624a7500, 0x030875f3, 0x03b801d9, 0xba000000,
+0x00000000, 0x087df262, 0x01b8d07c, 0x62000000,
+0xdb0875f1, 0x7df262ca, 0x62d07c08, 0xfe0875f1,
+0x65f362ca, 0x00d91f08, 0xc393f9c5, 0x4ab80f3c,
+0x0f000007, 0x05ebc244, 0x0006f1b8, 0xacc48100,
+0x5b000000, 0xc35d5f5e, 0x00000000, 0x00000000,
+0x00000004, 0x00000006, 0x00000006, 0x00000004,
+0002660,
+};
+asm(".type avx512dq_x86_32_D_16u4, STT_NOTYPE;");
+asm(".type avx512dq_x86_32_D_16u4, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512dq_x86_32_D_16i8[] = {
+0x83e58955, 0x02e8f0e4, 0xc9000000, 0xc03155c3,
+0xec81e589, 0x00000088, 0x31cc4589, 0x89d231c0,
+0xc031dc45, 0x31ec4589, 0xd44589c0, 0x45c7c031,
+0x000001c8, 0xd845c700, 0x00000002, 0x3fe845c7,
+0xc7000000, 0x0002d045, 0x45c70000, 0x000001e0,
+0xe4458900, 0x3ef045c7, 0x89000000, 0xf162f455,
+0xbd6f08fd, 0xffffffc8, 0x08fdf162, 0xff98bd7f,
+0xf162ffff, 0x8d6f08fd, 0xffffff98, 0x08f5f362,
+0xc500c71f, 0x80d093f9, 0x39b803fa, 0x0f000005,
+0x0004a385, 0xf5f16200, 0xc895d408, 0x62ffffff,
+0x7f08fdf1, 0xffffa895, 0xe5f162ff, 0xc8b57308,
+0x01ffffff, 0x08fdf162, 0xffa8956f, 0x3fb8ffff,
+0x62000005, 0x1f08edf3, 0xf9c500d3, 0xfa80d293,
+0x61850f03, 0x62000004, 0xfb08edf1, 0xffffc895,
+0xfdf162ff, 0xb8957f08, 0x62ffffff, 0x1f08f5f3,
+0xffffb89d, 0xf9c500ff, 0xfa80d393, 0x0544b803,
+0x850f0000, 0x00000430, 0x08fdf162, 0xffd8bd6f,
+0xf262ffff, 0x8d4008f5, 0xffffffc8, 0x08c5f262,
+0xf162d740, 0x9d6f08fd, 0xffffffc8, 0x08e5f162,
+0xf162efd4, 0xa5fb08e5, 0xffffffd8, 0x08f5f162,
+0x5bb8cafb, 0x62000005, 0x4008ddf2, 0xf5f362e5,
+0x00e41f08, 0xd493f9c5, 0x0f03fa80, 0x0003d785,
+0xe5f26200, 0xd88d4008, 0x62ffffff, 0x5908fdf2,
+0x10054015, 0xf5f36200, 0x00ea1f08, 0xd593f9c5,
+0xb803fa80, 0x000005c8, 0x03aa850f, 0x45c70000,
+0x00000180, 0x89c93100, 0xf162844d, 0x557e08fe,
+0x6cf162f0, 0x50151608, 0x62001005, 0x4008e5f2,
+0xfdf162e2, 0xb8a57f08, 0x62ffffff, 0x7308f5f1,
+0xffffb8b5, 0xf16203ff, 0x8d7f08fd, 0xffffff98,
+0x08d5f162, 0xffb8b573, 0x6202ffff, 0xd408d5f1,
+0x05edb8f5, 0xf3620000, 0xf61f08f5, 0x93f9c500,
+0x03fa80d6, 0x033e850f, 0xf1620000, 0xa57208f5,
+0xffffff98, 0xf5f16202, 0xb8c9d408, 0x000005f2,
+0x08d5f362, 0xc500f91f, 0x80d793f9, 0x850f03fa,
+0x00000314, 0x038c45c7, 0x8b000000, 0x45898c45,
+0x1ff8c180, 0x62844589, 0x7e08fef1, 0xf162f07d,
+0xcff308dd, 0x028c45c7, 0x8b000000, 0x45898c45,
+0x1ff8c180, 0x62844589, 0x7e08fef1, 0xf162f07d,
+0xe7f308dd, 0x08ddf162, 0x05b8ecd4, 0x62000006,
+0x1f08f5f3, 0xf9c500c5, 0xfa80d093, 0xb5850f03,
+0x8b000002, 0x45898c45, 0x1ff8c180, 0x62844589,
+0x7e08fef1, 0xf162f07d, 0xcfe208f5, 0x08f5f162,
+0x09b8c9d4, 0x62000006, 0x1f08ddf3, 0xf9c500d1,
+0xfa80d293, 0x7d850f03, 0x62000002, 0xef08f5f1,
+0xfdf162c9, 0xe8bd6f08, 0x62ffffff, 0x1f08c5f3,
+0xf26206c9, 0xcb4089ed, 0x08fdf162, 0xffb88d7f,
+0xf262ffff, 0xad4708f5, 0xffffffe8, 0x08fdf262,
+0x05482559, 0xf1620010, 0xb56f08fd, 0xffffffe8,
+0x08cdf162, 0xf162f4fb, 0xb57f08fd, 0xffffffe8,
+0x08f5f262, 0xffe88d47, 0x21b8ffff, 0x62000006,
+0x7f08fdf1, 0xffffa88d, 0xf5f162ff, 0x62c9d408,
+0x1f08d5f3, 0xf9c500d9, 0xfa80d393, 0xf5850f03,
+0x62000001, 0x6f08fdf1, 0xffffa8bd, 0xc5f262ff,
+0xe88d4608, 0xb8ffffff, 0x00000626, 0x08f5f362,
+0xffb8a51f, 0xc500ffff, 0x80d493f9, 0x850f03fa,
+0x000001c4, 0x08e5f262, 0xf162f240, 0x8d6f08fd,
+0xffffffd8, 0x08f5f262, 0xf162ea40, 0xb57f08fd,
+0xffffff98, 0x08fdf162, 0xffa8ad7f, 0xf262ffff,
+0xad3d08cd, 0xffffffa8, 0x08cdf262, 0xffa8b539,
+0xf162ffff, 0xb57f08fd, 0xffffffa8, 0x08d5f162,
+0xffa8add4, 0xf162ffff, 0xf1d408e5, 0x00063db8,
+0xd5f26200, 0x62ea4008, 0x1f08d5f3, 0xf9c500ee,
+0xfa80d593, 0x4d850f03, 0x62000001, 0x1f08fdf2,
+0xffff98ad, 0xd5f362ff, 0x00f31f08, 0xd693f9c5,
+0xb803fa80, 0x00000644, 0x012a850f, 0xf1620000,
+0x9d6f08fd, 0xffffffc8, 0x087df162, 0x624eeb70,
+0x1f08d5f3, 0xf9c500f9, 0xfa80d793, 0x064eb803,
+0x850f0000, 0x00000100, 0x039045c7, 0x31000000,
+0xf5f162d2, 0x89dbd408, 0x5db89455, 0x62000006,
+0x5908fdf2, 0xf362f26d, 0xc31f08d5, 0x93f9c500,
+0x03fa80d0, 0x00ce850f, 0xf1620000, 0x9d6c08f5,
+0xffffffc8, 0x08f5f162, 0xffc88d6d, 0x45c7ffff,
+0x00000190, 0xe5f16200, 0x31c9fb08, 0x944589c0,
+0x08f5f262, 0xa6b8ca40, 0x62000006, 0x5908fdf2,
+0xf362f255, 0xca1f08f5, 0x93f9c500, 0x03fa80d1,
+0x0082850f, 0xf1620000, 0xb56f08fd, 0xffffffc8,
+0x08fef162, 0x62fc4d7e, 0x7f08fdf1, 0xffffa8b5,
+0xfdf162ff, 0xf64dd608, 0xf162aab0, 0x8d6f08fd,
+0xffffffc8, 0xc892f9c5, 0x09f5f262, 0xffd89564,
+0xf362ffff, 0x951f08ed, 0xffffffa8, 0x93f9c500,
+0x03fa80d2, 0x00073ab8, 0x622d7500, 0x0308f5f3,
+0xf16201d1, 0xccdb08f5, 0x08f5f162, 0x00baccd4,
+0x62000000, 0x1f08edf3, 0xf9c500d9, 0x033cc393,
+0x00074ab8, 0xc2440f00, 0x0000c3c9, 0x00000000,
+0x00000002, 0x00000000, 0x00000001, 0x00000000,
+0xffffffff, 0xffffffff,
+0002530,
+};
+asm(".type avx512dq_x86_32_D_16i8, STT_NOTYPE;");
+asm(".type avx512dq_x86_32_D_16i8, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512dq_x86_32_D_16u8[] = {
+0x83e58955, 0x02e8f0e4, 0xc9000000, 0xc03155c3,
+0xec81e589, 0x00000088, 0x31dc4589, 0x89c931c0,
+0xc031ec45, 0x31d44589, 0xe44589c0, 0x45c7c031,
+0x000001c8, 0xcc4d8900, 0x02d845c7, 0xc7000000,
+0x003fe845, 0x45c70000, 0x000002d0, 0xe045c700,
+0x00000001, 0x3ef045c7, 0x89000000, 0xf162f445,
+0xb56f08fd, 0xffffffc8, 0x08fdf162, 0xff98b57f,
+0xf162ffff, 0x956f08fd, 0xffffff98, 0x08edf362,
+0xc500c61f, 0x80d093f9, 0x39b803fa, 0x0f000005,
+0x00043385, 0xedf16200, 0xc88dd408, 0x62ffffff,
+0x7f08fdf1, 0xffffa88d, 0xe5f162ff, 0xc8b57308,
+0x01ffffff, 0x08fdf162, 0xffa88d6f, 0x3fb8ffff,
+0x62000005, 0x1f08f5f3, 0xf9c500d3, 0xfa80d293,
+0xf1850f03, 0x62000003, 0xfb08f5f1, 0xffffc88d,
+0xfdf162ff, 0xb88d7f08, 0x62ffffff, 0x6f08fdf1,
+0xffffb89d, 0xedf362ff, 0x00db1f08, 0xd393f9c5,
+0xb803fa80, 0x00000544, 0x03ba850f, 0xf1620000,
+0x95eb08ed, 0xffffffd8, 0x08fdf162, 0xff98957f,
+0xf162ffff, 0x8ddb08f5, 0xffffffd8, 0x08e5f162,
+0xffd89def, 0xf162ffff, 0x8ddf08f5, 0xffffff98,
+0x08f5f362, 0xc500e31f, 0x80d493f9, 0x50b803fa,
+0x0f000005, 0x00036f85, 0xfdf16200, 0xc8956f08,
+0x62ffffff, 0x4008edf2, 0xffffd88d, 0xfdf262ff,
+0xd01d5908, 0x62001004, 0x1f08f5f3, 0xf9c500eb,
+0xfa80d593, 0x05c8b803, 0x850f0000, 0x00000338,
+0x08fdf162, 0xffb8957f, 0xf162ffff, 0xb57308f5,
+0xffffffb8, 0xfdf16203, 0x988d7f08, 0x62ffffff,
+0x7308e5f1, 0xffffb8b5, 0xf16202ff, 0xe3d408e5,
+0x0005edb8, 0xf5f36200, 0x00f41f08, 0xd693f9c5,
+0x0f03fa80, 0x0002ef85, 0xf5f16200, 0x98957308,
+0x02ffffff, 0x08f5f162, 0xf2b8c9d4, 0x62000005,
+0x1f08e5f3, 0xf9c500f9, 0xfa80d793, 0xc5850f03,
+0xc7000002, 0x00038c45, 0xf1620000, 0x4d6e087d,
+0xedf162e3, 0xc7c9f308, 0x00028c45, 0xf1620000,
+0x5d6e087d, 0xedf162e3, 0x62dbf308, 0xd408e5f1,
+0x0605b8e3, 0xf3620000, 0xc41f08f5, 0x93f9c500,
+0x03fa80d0, 0x027e850f, 0xf1620000, 0x656e087d,
+0xf5f162e3, 0x62ccd308, 0xd408f5f1, 0x0609b8c9,
+0xf3620000, 0xc91f08e5, 0x93f9c500, 0x03fa80d1,
+0x0252850f, 0xf1c50000, 0xf162c976, 0xda6f08fd,
+0x08ddf162, 0xe2c4e4ef, 0xe8652959, 0x08f5f362,
+0x6240dc25, 0x7f08fdf1, 0xffffb89d, 0xe5f262ff,
+0xe8a54708, 0x62ffffff, 0xd408f5f1, 0xffffe8ad,
+0xfdf162ff, 0xe8ad7f08, 0x62ffffff, 0x4708e5f2,
+0xffffe89d, 0x0621b8ff, 0xf1620000, 0x9d7f08fd,
+0xffffffa8, 0x08e5f162, 0xf362dbd4, 0xd31f08dd,
+0x93f9c500, 0x03fa80d2, 0x01da850f, 0xf1620000,
+0xbd6f08fd, 0xffffffa8, 0x08c5f262, 0xffe89d45,
+0x26b8ffff, 0x62000006, 0x1f08e5f3, 0xffffb89d,
+0xf9c500ff, 0xfa80d393, 0xa9850f03, 0x62000001,
+0x3b08edf2, 0xffffd89d, 0xedf262ff, 0xd8a53f08,
+0x62ffffff, 0xd408edf1, 0xffffd895, 0xe5f162ff,
+0xb8dcd408, 0x00000634, 0x08e5f362, 0xc500e21f,
+0x80d493f9, 0x850f03fa, 0x0000016c, 0x08fdf162,
+0xffd8a56f, 0xf162ffff, 0x9d6f08fd, 0xffffffc8,
+0x087df162, 0x624ed370, 0x1f08edf3, 0xf9c500ec,
+0xfa80d593, 0x064eb803, 0x850f0000, 0x00000138,
+0x039045c7, 0x31000000, 0xddf162d2, 0x89dbd408,
+0x5db89455, 0x62000006, 0x5908fdf2, 0xf362f255,
+0xf31f08ed, 0x93f9c500, 0x03fa80d6, 0x0106850f,
+0x45c70000, 0xffffff80, 0x8445c7ff, 0xffffffff,
+0x08fef162, 0x62f0557e, 0x7e08fef1, 0xddf162da,
+0xc8ad6c08, 0x62ffffff, 0x6d08ddf1, 0xffffc895,
+0x9045c7ff, 0x00000001, 0x08f5f162, 0xc031cad4,
+0x08edf362, 0x8955d325, 0xf1629445, 0xcdfb08f5,
+0x08f5f162, 0xf162cbef, 0xcafb08f5, 0x0006a6b8,
+0xfdf26200, 0xf2555908, 0x08f5f362, 0xc500fa1f,
+0x80d793f9, 0x850f03fa, 0x0000008c, 0x08fdf162,
+0xffc8b56f, 0xf162ffff, 0x4d7e08fe, 0xfdf162fc,
+0xa8b57f08, 0x62ffffff, 0xd608fdf1, 0xaab0f64d,
+0x08fdf162, 0xffc88d6f, 0xf9c5ffff, 0xf262c892,
+0x956409f5, 0xffffffd8, 0x08edf362, 0xffa8851f,
+0xc500ffff, 0x80d093f9, 0x3ab803fa, 0x75000007,
+0xf5f36237, 0x01d90308, 0x08fdf262, 0x04d81559,
+0xf1620010, 0xcadb08f5, 0x08f5f162, 0x00bacad4,
+0x62000000, 0x1f08e5f3, 0xf9c500c9, 0x033cc193,
+0x00074ab8, 0xc2440f00, 0x0000c3c9, 0x00000000,
+0x00000002, 0x00000000, 0x00000001, 0x00000000,
+0002340,
+};
+asm(".type avx512dq_x86_32_D_16u8, STT_NOTYPE;");
+asm(".type avx512dq_x86_32_D_16u8, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512dq_x86_32_D_16f4[] = {
+0x83e58955, 0x06e8f0e4, 0xc9000003, 0xe8d955c3,
+0xec83e589, 0xc455d948, 0xd9c855d9, 0x100e2805,
+0xd855d900, 0x55d9c9d9, 0xe005d9e8, 0xd900100d,
+0x05d9cc55, 0x00100e24, 0xd9dc55d9, 0xec55d9ca,
+0x5dd9cad9, 0xe05dd9d0, 0xd9f055d9, 0xd45dd9c9,
+0xd9e455d9, 0xf162f45d, 0x8d28087c, 0xffffffd8,
+0x0000a7b8, 0x7cf16200, 0x00152808, 0x6200100e,
+0x28087cf1, 0x75f262d9, 0xc89d9808, 0x62ffffff,
+0xc2086cf1, 0xf9c500c3, 0xe280d093, 0x0ffa800f,
+0x0279850f, 0xf1620000, 0x1528087c, 0x00100e10,
+0x0000abb8, 0x7cf16200, 0x62d92808, 0x9e0875f2,
+0xffffc89d, 0x6cf162ff, 0x00cbc208, 0xd193f9c5,
+0x800fe280, 0x850f0ffa, 0x00000243, 0x087cf162,
+0x0e201528, 0xafb80010, 0x62000000, 0x28087cf1,
+0x75f262d9, 0xc89d9a08, 0x62ffffff, 0xc2086cf1,
+0xf9c500d3, 0xe280d293, 0x0ffa800f, 0x020d850f,
+0xf1620000, 0x1528087c, 0x00100e30, 0x0000b3b8,
+0x7cf16200, 0x62d92808, 0x9c0875f2, 0xffffc89d,
+0x6cf162ff, 0x00dbc208, 0xd393f9c5, 0x800fe280,
+0x850f0ffa, 0x000001d7, 0x087cf162, 0xffc89528,
+0xf162ffff, 0xd958086c, 0x087df262, 0xb8f16518,
+0x000000bb, 0x087cf162, 0xffd8b528, 0xf262ffff,
+0xe298084d, 0x0864f162, 0xc500e4c2, 0x80d493f9,
+0xfa800fe2, 0x94850f0f, 0x62000001, 0x18087df2,
+0x100e3025, 0x00c0b800, 0xf1620000, 0xea28087c,
+0x087cf162, 0xffd8b528, 0xf162ffff, 0xdc570864,
+0x184df262, 0x62f16d9e, 0xc20864f1, 0xf9c500ed,
+0xe280d593, 0x0ffa800f, 0x0151850f, 0xf1620000,
+0xc95c086c, 0x087df262, 0xb8f15d18, 0x000000c5,
+0x087cf162, 0xffd8bd28, 0xf262ffff, 0xda9a0845,
+0x0874f162, 0xc500f3c2, 0x80d693f9, 0xfa800fe2,
+0x18850f0f, 0x62000001, 0x28087cf1, 0xffffd8b5,
+0x74f162ff, 0xb8cc5708, 0x000000ca, 0x087cf162,
+0xf262da28, 0x5d9c184d, 0x74f162f1, 0x00fbc208,
+0xd793f9c5, 0x800fe280, 0x850f0ffa, 0x000000df,
+0x086cf162, 0xffd8ad59, 0xf162ffff, 0x8d28087c,
+0xffffffe8, 0xf1d0d3c5, 0x087cf162, 0xffd89d28,
+0xd4b8ffff, 0x62000000, 0x28087cf1, 0x65f262fa,
+0xe8bda608, 0x62ffffff, 0xc2084cf1, 0xf9c500c7,
+0xe280d093, 0x0ffa800f, 0x0091850f, 0xf1620000,
+0xcc570874, 0xe9d0d3c5, 0x086df262, 0xffe89da7,
+0xf162ffff, 0xcbc20854, 0x00d8b800, 0xf9c50000,
+0xe280d193, 0x0ffa800f, 0xf1626575, 0x8d59086c,
+0xffffffd8, 0x4dd0f3c5, 0x7cf162e8, 0xe89d2808,
+0xb8ffffff, 0x000000de, 0x087cf162, 0xf262e228,
+0xa5960865, 0xffffffd8, 0x0874f162, 0xc500d4c2,
+0x80d293f9, 0xfa800fe2, 0x6224750f, 0x970865f2,
+0xffffd895, 0x54f162ff, 0x00dac208, 0x0000e2b8,
+0x93f9c500, 0x0fe280d3, 0x750ffa80, 0xc9c03102,
+0xe8d955c3, 0x8157e589, 0x0000a4ec, 0x9855d900,
+0x0e2805d9, 0x55d90010, 0xd9c9d9a8, 0x05d9b855,
+0x00100de0, 0xd99c55d9, 0x100e2405, 0xac55d900,
+0xe0d9e8d9, 0xd9bc55d9, 0xa05dd9c9, 0x55d9c9d9,
+0xd9cad9b0, 0xcbd9c055, 0xd9a45dd9, 0xb45dd9ca,
+0x5dd9c9d9, 0x7cf162c4, 0x98b52808, 0x62ffffff,
+0x29087cf1, 0xffff68b5, 0x7cf162ff, 0x688d2808,
+0xb8ffffff, 0x00000539, 0x0874f162, 0xc500c6c2,
+0x80d093f9, 0xfa800fe2, 0xd4850f0f, 0x62000009,
+0x580874f1, 0xffff9895, 0x7cf162ff, 0x78952908,
+0x62ffffff, 0x28087cf1, 0xffff98bd, 0x053fb8ff,
+0xf1620000, 0xdf580844, 0x087cf162, 0xff789528,
+0xf162ffff, 0xd3c2086c, 0x93f9c500, 0x0fe280d2,
+0x0f0ffa80, 0x00098e85, 0x6cf16200, 0x98955c08,
+0x62ffffff, 0x29087cf1, 0xffff8895, 0x74f162ff,
+0x889dc208, 0x00ffffff, 0x000544b8, 0x93f9c500,
+0x0fe280d3, 0x0f0ffa80, 0x00095e85, 0x7cf16200,
+0xa8b52808, 0x62ffffff, 0x590874f1, 0xffff988d,
+0x4cf162ff, 0x62de5908, 0x28087cf1, 0xffff9895,
+0x6cf162ff, 0x62ee5808, 0x5c086cf1, 0xffffa8a5,
+0x055bb8ff, 0xf1620000, 0xcb5c0874, 0x085cf162,
+0xf162e559, 0xe4c20874, 0x93f9c500, 0x0fe280d4,
+0x0f0ffa80, 0x00090685, 0x6cf16200, 0xb88d5908,
+0x62ffffff, 0x29087cf1, 0xffff688d, 0x6cf162ff,
+0xb8955e08, 0xb8ffffff, 0x00000564, 0x0874f162,
+0xc500eac2, 0x80d593f9, 0xfa800fe2, 0xd0850f0f,
+0x62000008, 0x18087df2, 0x100e300d, 0x0567b800,
+0xf1620000, 0x9d28087c, 0xffffffb8, 0x0864f162,
+0xf162d157, 0x9559086c, 0xffffff68, 0x0874f162,
+0xff988d57, 0xf162ffff, 0xf1c2086c, 0x93f9c500,
+0x0fe280d6, 0x0f0ffa80, 0x00088a85, 0x7df16200,
+0x988d5b08, 0x62ffffff, 0x5b087cf1, 0x74f162c9,
+0x98bdc208, 0x00ffffff, 0x00056eb8, 0x93f9c500,
+0x0fe280d7, 0x0f0ffa80, 0x00085e85, 0x7df26200,
+0x988d4c08, 0x62ffffff, 0x29087cf1, 0xffff688d,
+0x7df262ff, 0x688d4c08, 0xb8ffffff, 0x00000575,
+0x087cf162, 0xff98a528, 0xf162ffff, 0xc95b087d,
+0x087cf162, 0xf162c95b, 0xc4c20874, 0x93f9c500,
+0x0fe280d0, 0x0f0ffa80, 0x00081285, 0x5cf16200,
+0x62cc5908, 0x29087cf1, 0xffff688d, 0x7df262ff,
+0x688d4e08, 0x62ffffff, 0x29087cf1, 0xffff788d,
+0x7cf162ff, 0x788d2808, 0xb8ffffff, 0x0000057c,
+0x087df262, 0xf162d14c, 0xd25b087d, 0x087cf162,
+0xf162d25b, 0xd4c2086c, 0x93f9c500, 0x0fe280d2,
+0x0f0ffa80, 0x0007ba85, 0x7df26200, 0x98954c08,
+0x62ffffff, 0x5b087df1, 0x057eb8c9, 0xf1620000,
+0xc95b087c, 0x087df162, 0xf162d25b, 0xd25b087c,
+0x0874f162, 0xc500dac2, 0x80d393f9, 0xfa800fe2,
+0x80850f0f, 0x62000007, 0x28087cf1, 0xffff98bd,
+0x7cf162ff, 0xc8bd2908, 0x62ffffff, 0x7b087df1,
+0xf162f94d, 0x8d7f087d, 0xffffffd8, 0x0874f162,
+0xf162c957, 0xf7120874, 0x087cf162, 0xffc8b529,
+0xf162ffff, 0x4d7b087d, 0x7df162f9, 0xe88d7f08,
+0x62ffffff, 0x5b08fcf1, 0xffffd895, 0x6df362ff,
+0x0eca2108, 0x086cf162, 0x6255d2c6, 0x5b08fcf1,
+0xffffe8a5, 0x75f362ff, 0x10ca2108, 0x0874f162,
+0xf162cc16, 0xa5c20874, 0xffffff98, 0x0588b800,
+0xf9c50000, 0xe280d493, 0x0ffa800f, 0x06e9850f,
+0xf1620000, 0x8d79087c, 0xffffff98, 0x087ff162,
+0xf162c97a, 0xadc20874, 0xffffff98, 0x058fb800,
+0xf9c50000, 0xe280d593, 0x0ffa800f, 0x06bd850f,
+0xf1620000, 0xbd28087c, 0xffffff98, 0x087cf162,
+0xffc8bd29, 0xf162ffff, 0x4d79087d, 0x7df162f9,
+0xd88d7f08, 0x62ffffff, 0x570874f1, 0x74f162c9,
+0x62ef1208, 0x29087cf1, 0xffffc8ad, 0x7df162ff,
+0xf94d7908, 0x087df162, 0xffe88d7f, 0xf162ffff,
+0x8d7a08ff, 0xffffffd8, 0x0875f362, 0x620ed121,
+0xc60874f1, 0xf16255c9, 0xa57a08ff, 0xffffffe8,
+0x086df362, 0x6210d121, 0x16086cf1, 0x7cf162d4,
+0x988d2808, 0xb8ffffff, 0x00000596, 0x086cf162,
+0xc500f1c2, 0x80d693f9, 0xfa800fe2, 0x20850f0f,
+0x62000006, 0x590874f1, 0x7cf162d1, 0x68952908,
+0x62ffffff, 0x51087cf1, 0xffff6895, 0x059cb8ff,
+0xf1620000, 0xf9c2086c, 0x93f9c500, 0x0fe280d7,
+0x0f0ffa80, 0x0005ee85, 0x7df26200, 0x40151808,
+0x6200100e, 0x5e086cf1, 0x7cf162c9, 0x688d2908,
+0x62ffffff, 0x08087df3, 0xffff68a5, 0xa4b80bff,
+0x62000005, 0x10087ef1, 0x100e400d, 0x74f16200,
+0x00ccc208, 0xd193f9c5, 0x800fe280, 0x850f0ffa,
+0x000005a7, 0x087df362, 0xff988d56, 0x620bffff,
+0x57085cf1, 0x05abb8e4, 0xf1620000, 0xc4c20874,
+0x93f9c500, 0x0fe280d0, 0x0f0ffa80, 0x00057e85,
+0x6cf16200, 0x988d5808, 0x62ffffff, 0x5e086cf1,
+0x7cf162d1, 0x68952908, 0x62ffffff, 0x56087df3,
+0xffff688d, 0xf1620bff, 0xb528087c, 0xffffff68,
+0x0005b1b8, 0x4cf16200, 0x00d1c208, 0xd293f9c5,
+0x800fe280, 0x850f0ffa, 0x00000537, 0x087df262,
+0x0de80d18, 0xf1620010, 0x8d590874, 0xffffff98,
+0x087cf162, 0xff688d29, 0xf362ffff, 0x8d08087d,
+0xffffff68, 0x7df3620b, 0x68955608, 0x0bffffff,
+0x0874f162, 0xbbb8ca58, 0x62000005, 0x28087cf1,
+0xffff68bd, 0x44f162ff, 0x00d9c208, 0xd393f9c5,
+0x800fe280, 0x850f0ffa, 0x000004db, 0x0864f162,
+0xffa88d59, 0xf162ffff, 0x95590864, 0xffffff98,
+0x087cf162, 0xff788d29, 0xf362ffff, 0x8d50086d,
+0xffffff78, 0x6df36205, 0x78955008, 0x04ffffff,
+0x087cf162, 0xff789529, 0xf162ffff, 0x8d580874,
+0xffffff78, 0x00063db8, 0x7cf16200, 0x98ad2808,
+0x62ffffff, 0x590874f1, 0x54f162cb, 0xa8955808,
+0x62ffffff, 0xc20874f1, 0xf9c500e2, 0xe280d493,
+0x0ffa800f, 0x0461850f, 0xf1620000, 0xb528087c,
+0xffffff98, 0x00064eb8, 0x7cf16200, 0xa88d2808,
+0x62ffffff, 0xc6084cf1, 0xf1621bd6, 0xe9c2086c,
+0x93f9c500, 0x0fe280d5, 0x0f0ffa80, 0x00042e85,
+0x7cf16200, 0x98952808, 0xb8ffffff, 0x00000653,
+0x087df362, 0x621be204, 0xc2085cf1, 0xf9c500f1,
+0xe280d693, 0x0ffa800f, 0x0405850f, 0xf1620000,
+0xd2580874, 0x00065db8, 0xe845c700, 0x40a00000,
+0x087df262, 0x62fa6518, 0xc2085cf1, 0xf9c500fa,
+0xe280d793, 0x0ffa800f, 0x03d9850f, 0xf1620000,
+0x95140874, 0xffffff98, 0x0874f162, 0xff988d15,
+0xf162ffff, 0xc95c086c, 0x62e85dd9, 0x18087df2,
+0xa6b8fa55, 0x62000006, 0x590874f1, 0x74f162cb,
+0x00cac208, 0x087cf162, 0xff888d29, 0xf9c5ffff,
+0xe280d193, 0x0ffa800f, 0x038b850f, 0xf1620000,
+0xbd28087c, 0xffffff98, 0x087cf162, 0xffd8bd29,
+0xf162ffff, 0x4d5a087c, 0xfdf162fb, 0x688d2908,
+0x62ffffff, 0x5a08fdf1, 0xffff688d, 0x7cf162ff,
+0xe88d2908, 0xd9ffffff, 0x45d99845, 0xdde9dfe8,
+0x75617ad8, 0x9c45d95f, 0xdfec45d9, 0x7ad8dde9,
+0x62517553, 0x12087ef1, 0xffff9895, 0x7df262ff,
+0xe40d1808, 0xb800100d, 0x00000717, 0x0874f162,
+0xf262cb58, 0x2d18087d, 0x00100dec, 0x0874f162,
+0xf162cd59, 0x955c086c, 0xffffff98, 0x086cf162,
+0xc500c1c2, 0x80d093f9, 0xfa800fe2, 0xe90f740f,
+0x000002e5, 0x0006f1b8, 0x02dbe900, 0xf1620000,
+0x8d16087e, 0xffffff98, 0x1864f162, 0x0e401558,
+0x1eb80010, 0x62000007, 0x28087cf1, 0xffff98a5,
+0x6cf162ff, 0x62d55908, 0x5c0874f1, 0x74f162cc,
+0x00d2c208, 0xd293f9c5, 0x800fe280, 0x850f0ffa,
+0x00000295, 0x62ac45d9, 0x570874f1, 0x887d8dc9,
+0x087cf162, 0xff78a529, 0x2ab8ffff, 0xc5000007,
+0x01cbc2f0, 0xff7c9dd9, 0x45d9ffff, 0x845dd9b4,
+0xe1f7f9c5, 0x0875f362, 0x6255c925, 0x6f087df1,
+0xffffa8ad, 0xf7f9c5ff, 0x7cf162e9, 0x788d2808,
+0x62ffffff, 0x28087cf1, 0xffff88b5, 0x4cf162ff,
+0x00d9c208, 0xd393f9c5, 0x800fe280, 0x850f0ffa,
+0x00000225, 0x087cf162, 0xff98bd28, 0x0ab0ffff,
+0xc892f9c5, 0x00073ab8, 0x45f26200, 0xa8956509,
+0x62ffffff, 0xc2086cf1, 0xf9c500e1, 0xe280d493,
+0x0ffa800f, 0x01ef850f, 0xf1620000, 0xad28087c,
+0xffffff98, 0x4dd0d3c5, 0x7cf162a8, 0x98952808,
+0xb8ffffff, 0x00000743, 0x086cf162, 0xffa89d5c,
+0xf162ffff, 0x9d58096c, 0xffffffa8, 0x0874f162,
+0xc500ebc2, 0x80d593f9, 0xfa800fe2, 0xa6850f0f,
+0x62000001, 0x29087cf1, 0xffff6895, 0x74f162ff,
+0xc5c95708, 0x68957cf3, 0x62ffffff, 0x29087cf1,
+0xffff6895, 0x7cf3c5ff, 0xffff6895, 0xf005d9ff,
+0x6200100d, 0x17087df3, 0xd903d755, 0xffff5c85,
+0xdde9dfff, 0xf38a0fd8, 0x0f000000, 0x0000ed85,
+0x7cf16200, 0x98b52808, 0xb8ffffff, 0x00000767,
+0x557dcbc5, 0x7cebc5a8, 0x7cebc5d1, 0x6cf162d1,
+0x00f1c208, 0xd693f9c5, 0x800fe280, 0x850f0ffa,
+0x00000125, 0x087df362, 0xff988d26, 0x6200ffff,
+0x29087cf1, 0xffff688d, 0x7df262ff, 0x988d4208,
+0x62ffffff, 0x29087cf1, 0xffff788d, 0x31c931ff,
+0x7df162d2, 0x62c96e08, 0xd608fdf1, 0xaddfec4d,
+0xffffff60, 0x789584d9, 0xdfffffff, 0x7ad8dde9,
+0x8d727574, 0x7a8d0142, 0x83c72102, 0xd18301ff,
+0x75d08500, 0xd9e8d911, 0xff648584, 0xe9dfffff,
+0x587ad8dd, 0xf8835675, 0x89047404, 0x62b2ebc2,
+0x28087cf1, 0xffff68bd, 0x077db8ff, 0xf2620000,
+0x8d2c0845, 0xffffff78, 0x087cf162, 0xff98ad28,
+0xf162ffff, 0xf9c20854, 0x93f9c500, 0x0fe280d7,
+0x750ffa80, 0xf2b3e874, 0xd8f7ffff, 0x5eb86beb,
+0xeb000007, 0x0773b864, 0x5deb0000, 0x000778b8,
+0xdd56eb00, 0xdd52ebd8, 0xdd4eebd8, 0xdd4aebd8,
+0xdd46ebd8, 0xdd42ebd8, 0xdd3eebd8, 0xdd3aebd8,
+0xdd36ebd8, 0xdd32ebd8, 0xdd2eebd8, 0xdd2aebd8,
+0xdd26ebd8, 0xdd22ebd8, 0xdd1eebd8, 0xdd1aebd8,
+0xdd16ebd8, 0xdd12ebd8, 0xdd0eebd8, 0xdd0aebd8,
+0xdd06ebd8, 0xdd02ebd8, 0xa4c481d8, 0x5f000000,
+0x0000c35d, 0x00000000, 0x00000000, 0x00000000,
+0x40000000, 0xbf800000, 0x3e800000, 0x3f000000,
+0x41200000, 0x00000000, 0x00000000, 0x00000000,
+0x41000000, 0x41100000, 0x41000000, 0x40a00000,
+0xc1000000, 0xc1100000, 0xc1000000, 0xc0a00000,
+0x00000000, 0x40400000, 0x40800000, 0x40400000,
+0x80000000, 0xc0400000, 0xc0800000, 0xc0400000,
+0x3f800000, 0x00000000, 0x00000000, 0x00000000,
+0007120,
+};
+asm(".type avx512dq_x86_32_D_16f4, STT_NOTYPE;");
+asm(".type avx512dq_x86_32_D_16f4, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512dq_x86_32_D_16f8[] = {
+0x83e58955, 0xc0e8f0e4, 0xc9000002, 0xe8d955c3,
+0xec83e589, 0xc055dd48, 0xd9c855dd, 0x100b7005,
+0xd855dd00, 0x55ddc9d9, 0xddc9d9e8, 0x55ddd05d,
+0xf05ddde0, 0x08fdf162, 0x0b801528, 0xf1620010,
+0x8d2808fd, 0xffffffd8, 0x08fdf162, 0xf262d928,
+0x9d9808f5, 0xffffffc8, 0x08edf162, 0xc500c3c2,
+0x80d093f9, 0xa7b803fa, 0x0f000000, 0x00025885,
+0xfdf16200, 0x90152808, 0x6200100b, 0x2808fdf1,
+0xf5f262d9, 0xc89d9e08, 0x62ffffff, 0xc208edf1,
+0xf9c500cb, 0xfa80d193, 0x00abb803, 0x850f0000,
+0x00000225, 0x08fdf162, 0x0ba01528, 0xf1620010,
+0xd92808fd, 0x08f5f262, 0xffc89d9a, 0xf162ffff,
+0xd3c208ed, 0x93f9c500, 0x03fa80d2, 0x0000afb8,
+0xf2850f00, 0x62000001, 0x2808fdf1, 0x100bb015,
+0xfdf16200, 0x62d92808, 0x9c08f5f2, 0xffffc89d,
+0xedf162ff, 0x00dbc208, 0xd393f9c5, 0xb803fa80,
+0x000000b3, 0x01bf850f, 0xf1620000, 0x952808fd,
+0xffffffc8, 0x08edf162, 0xf162d958, 0x651208ff,
+0xfdf162f8, 0xd8b52808, 0x62ffffff, 0x9808cdf2,
+0xe5f162e2, 0x00e4c208, 0xd493f9c5, 0xb803fa80,
+0x000000bb, 0x017f850f, 0xf1620000, 0x251208ff,
+0x00100bb0, 0x08fdf162, 0xf162ea28, 0xb52808fd,
+0xffffffd8, 0x08e5f162, 0xf262dc57, 0x6d9e18cd,
+0xe5f162f8, 0x00edc208, 0xd593f9c5, 0xb803fa80,
+0x000000c0, 0x013f850f, 0xf1620000, 0xc95c08ed,
+0x08fff162, 0x62f85d12, 0x2808fdf1, 0xffffd8bd,
+0xc5f262ff, 0x62da9a08, 0xc208f5f1, 0xf9c500f3,
+0xfa80d693, 0x00c5b803, 0x850f0000, 0x00000109,
+0x08fdf162, 0xf162da28, 0xb52808fd, 0xffffffd8,
+0x08f5f162, 0xf262cc57, 0x5d9c18cd, 0xf5f162f8,
+0x00fbc208, 0xd793f9c5, 0xb803fa80, 0x000000ca,
+0x00d3850f, 0xf1620000, 0x8d2808fd, 0xffffffe8,
+0x08edf162, 0xffd8ad59, 0xd1c5ffff, 0xf162f1d0,
+0x9d2808fd, 0xffffffd8, 0x08fdf162, 0xf262fa28,
+0xbda608e5, 0xffffffe8, 0x08cdf162, 0xc500c7c2,
+0x80d093f9, 0xd4b803fa, 0x0f000000, 0x00008885,
+0xf5f16200, 0xc5cc5708, 0x62e9d0d1, 0xa708edf2,
+0xffffe89d, 0xd5f162ff, 0x00cbc208, 0xd193f9c5,
+0xb803fa80, 0x000000d8, 0xf1625f75, 0x8d5908ed,
+0xffffffd8, 0x4dd0f1c5, 0xfdf162e8, 0xe89d2808,
+0x62ffffff, 0x2808fdf1, 0xe5f262e2, 0xd8a59608,
+0x62ffffff, 0xc208f5f1, 0xf9c500d4, 0xfa80d293,
+0x00deb803, 0x21750000, 0x08e5f262, 0xffd89597,
+0xf162ffff, 0xdac208d5, 0x93f9c500, 0x03fa80d3,
+0x0000e2b8, 0x31027500, 0x55c3c9c0, 0xe8d9c031,
+0x8157e589, 0x000084ec, 0xc855dd00, 0x0b7005d9,
+0x55dd0010, 0x89c9d9d8, 0x55ddf045, 0xc7c9d9e8,
+0x0000f445, 0x5dddbff0, 0xe055ddd0, 0x08fdf162,
+0xffc8b528, 0xf162ffff, 0xb52908fd, 0xffffff98,
+0x08fdf162, 0xff988d28, 0xf162ffff, 0xc6c208f5,
+0x93f9c500, 0x03fa80d0, 0x000539b8, 0xbc850f00,
+0x62000007, 0x5808f5f1, 0xffffc895, 0xfdf162ff,
+0xa8952908, 0x62ffffff, 0x2808fdf1, 0xffffa895,
+0xfdf162ff, 0xc8bd2808, 0x62ffffff, 0x5808c5f1,
+0xedf162df, 0x00d3c208, 0xd293f9c5, 0xb803fa80,
+0x0000053f, 0x0779850f, 0xf1620000, 0x955c08ed,
+0xffffffc8, 0x08fdf162, 0xffb89529, 0xf162ffff,
+0x9dc208f5, 0xffffffb8, 0x93f9c500, 0x03fa80d3,
+0x000544b8, 0x4c850f00, 0x62000007, 0x2808fdf1,
+0xffffd8ad, 0xf5f162ff, 0xc88d5908, 0x62ffffff,
+0x5908d5f1, 0xfdf162dd, 0xc8952808, 0x62ffffff,
+0x5808edf1, 0xedf162ed, 0xd8a55c08, 0x62ffffff,
+0x5c08f5f1, 0xddf162cb, 0x62e55908, 0xc208f5f1,
+0xf9c500e4, 0xfa80d493, 0x055bb803, 0x850f0000,
+0x000006f7, 0x08edf162, 0xffe88d59, 0xf162ffff,
+0x8d2908fd, 0xffffff98, 0x08edf162, 0xffe8955e,
+0xf162ffff, 0xeac208f5, 0x93f9c500, 0x03fa80d5,
+0x000564b8, 0xc4850f00, 0x62000006, 0x1208fff1,
+0x100bb015, 0xfdf16200, 0xe88d2808, 0x62ffffff,
+0x5708f5f1, 0xedf162da, 0xc8955708, 0x62ffffff,
+0x5908e5f1, 0xffff989d, 0xe5f162ff, 0x00f2c208,
+0xd693f9c5, 0xb803fa80, 0x00000567, 0x0681850f,
+0xf1620000, 0x95e608ff, 0xffffffc8, 0x087ef162,
+0xf162d2e6, 0xbdc208ed, 0xffffffc8, 0x93f9c500,
+0x03fa80d7, 0x00056eb8, 0x58850f00, 0x62000006,
+0x4c08fdf2, 0xffffc895, 0xfdf162ff, 0x98952908,
+0x62ffffff, 0x2808fdf1, 0xffffc8a5, 0xfdf262ff,
+0x98954c08, 0x62ffffff, 0xe608fff1, 0x7ef162d2,
+0x62d2e608, 0xc208edf1, 0xf9c500c4, 0xfa80d093,
+0x0575b803, 0x850f0000, 0x0000060f, 0x08ddf162,
+0xf162d459, 0x952908fd, 0xffffff98, 0x08fdf262,
+0xff98954e, 0xf162ffff, 0x952908fd, 0xffffffa8,
+0x08fdf162, 0xffa89528, 0xf262ffff, 0xda4c08fd,
+0x08fff162, 0xf162dbe6, 0xdbe6087e, 0x08e5f162,
+0xc500d4c2, 0x80d293f9, 0x7cb803fa, 0x0f000005,
+0x0005ba85, 0xfdf26200, 0xc89d4c08, 0x62ffffff,
+0xe608fff1, 0xfff162d2, 0x62dbe608, 0xe6087ef1,
+0x7ef162d2, 0x62dbe608, 0xc208edf1, 0xf9c500db,
+0xfa80d393, 0x057eb803, 0x850f0000, 0x00000583,
+0x08fdf162, 0xffc8957b, 0xf162ffff, 0xd2e608fe,
+0x08edf162, 0xffc8a5c2, 0xc500ffff, 0x80d493f9,
+0x88b803fa, 0x0f000005, 0x00055a85, 0xfcf16200,
+0xc8957908, 0x62ffffff, 0x7a087ef1, 0xedf162d2,
+0xc8adc208, 0x00ffffff, 0xd593f9c5, 0xb803fa80,
+0x0000058f, 0x0531850f, 0xf1620000, 0x9d7908fd,
+0xffffffc8, 0x08fef162, 0xf162db7a, 0x952808fd,
+0xffffffc8, 0x08e5f162, 0xc500f2c2, 0x80d693f9,
+0x96b803fa, 0x0f000005, 0x00050285, 0xedf16200,
+0x62da5908, 0x2908fdf1, 0xffff989d, 0xfdf162ff,
+0x989d5108, 0x62ffffff, 0xc208e5f1, 0xf9c500fa,
+0xfa80d793, 0x059cb803, 0x850f0000, 0x000004d3,
+0x08fff162, 0x0ba81d12, 0xf1620010, 0xd25e08e5,
+0x08fdf162, 0xff989529, 0xf362ffff, 0xa50908fd,
+0xffffff98, 0xfef1620b, 0xc0157e08, 0xb800100b,
+0x000005a4, 0x08edf162, 0xc500ccc2, 0x80d193f9,
+0x850f03fa, 0x0000048f, 0x08fdf362, 0xffc89556,
+0x620bffff, 0x5708ddf1, 0xedf162e4, 0x00c4c208,
+0xd093f9c5, 0xb803fa80, 0x000005ab, 0x0469850f,
+0xf1620000, 0x955808e5, 0xffffffc8, 0x08e5f162,
+0xf162da5e, 0x9d2908fd, 0xffffff98, 0x08fdf362,
+0xff989556, 0x620bffff, 0x2808fdf1, 0xffff98b5,
+0xcdf162ff, 0x00d2c208, 0xd293f9c5, 0xb803fa80,
+0x000005b1, 0x0425850f, 0xf1620000, 0x151208ff,
+0x00100bd0, 0x08edf162, 0xffc89559, 0xf162ffff,
+0x952908fd, 0xffffff98, 0x08fdf362, 0xff989509,
+0x620bffff, 0x5608fdf3, 0xffff989d, 0xf1620bff,
+0xd35808ed, 0x08fdf162, 0xff98bd28, 0xf162ffff,
+0xdac208c5, 0x93f9c500, 0x03fa80d3, 0x0005bbb8,
+0xcc850f00, 0x62000003, 0x5908f5f1, 0xffffd895,
+0xf5f162ff, 0xc89d5908, 0x62ffffff, 0x2908fdf1,
+0xffffa895, 0xe5f362ff, 0xa8955008, 0x05ffffff,
+0x08e5f362, 0xffa89d50, 0x6204ffff, 0x2908fdf1,
+0xffffa89d, 0xedf162ff, 0xa8955808, 0x62ffffff,
+0x2808fdf1, 0xffffc8ad, 0xedf162ff, 0x62d15908,
+0x5808d5f1, 0xffffd89d, 0xedf162ff, 0x00e3c208,
+0xd493f9c5, 0xb803fa80, 0x0000063d, 0x0355850f,
+0xf1620000, 0xb52808fd, 0xffffffc8, 0x08fdf162,
+0xffd89528, 0xf162ffff, 0xdec608cd, 0xe5f16201,
+0x00eac208, 0xd593f9c5, 0xb803fa80, 0x0000064e,
+0x0325850f, 0xf1620000, 0x9d2808fd, 0xffffffc8,
+0x08fdf362, 0x6201e305, 0xc208ddf1, 0xf9c500f2,
+0xfa80d693, 0x0653b803, 0x850f0000, 0x000002ff,
+0x0b7405d9, 0xf1620010, 0xdb5808ed, 0x00065db8,
+0x9055dd00, 0x08fdf262, 0x62f26559, 0xc208ddf1,
+0xf9c500fb, 0xfa80d793, 0xd4850f03, 0xd9000002,
+0xedf162c9, 0xf95d1608, 0x08fdf162, 0xffc8bd28,
+0xf162ffff, 0xd71508ed, 0x08e5f162, 0x5dddd25c,
+0xedf16290, 0x62d15908, 0x5908fdf2, 0xf162f25d,
+0xcbc208ed, 0x93f9c500, 0x03fa80d1, 0x0006a6b8,
+0xfdf16200, 0xb8952908, 0x0fffffff, 0x00028885,
+0x120ff200, 0xf162c855, 0xa52808fd, 0xffffffc8,
+0x18f5f162, 0x0bb81d58, 0xf1620010, 0xd45c08ed,
+0x18e5f162, 0x0bd81d59, 0xf1620010, 0xc3c208ed,
+0x93f9c500, 0x03fa80d0, 0x000717b8, 0x4a850f00,
+0x8d000002, 0xf162b87d, 0xa52908fd, 0xffffffa8,
+0x08fff162, 0x62fc6d10, 0x5708edf1, 0xfff162d2,
+0xf66d1108, 0xc9c2e9c5, 0xf7f9c501, 0x75f362e1,
+0x55c92508, 0x08fdf162, 0xffd8b56f, 0xf9c5ffff,
+0xf162f1f7, 0x8d2808fd, 0xffffffa8, 0x08fdf162,
+0xffb8bd28, 0xf162ffff, 0xd1c208c5, 0x93f9c500,
+0x03fa80d2, 0x00072ab8, 0xe2850f00, 0xb0000001,
+0xfdf162aa, 0xc8ad2808, 0xc5ffffff, 0x62c892f9,
+0x6509d5f2, 0xffffd89d, 0xe5f162ff, 0x00d9c208,
+0xd393f9c5, 0xb803fa80, 0x0000073a, 0x01b3850f,
+0xf1620000, 0xb52808fd, 0xffffffc8, 0x4dd0c9c5,
+0xfdf162d8, 0xc89d2808, 0x62ffffff, 0x5c08e5f1,
+0xffffd8a5, 0xe5f162ff, 0xd8a55809, 0x62ffffff,
+0xc208f5f1, 0xf9c500e4, 0xfa80d493, 0x0743b803,
+0x850f0000, 0x00000171, 0x08fdf162, 0xff989d29,
+0xe9c5ffff, 0x62984d7c, 0x1708fdf1, 0x45ddf04d,
+0xdde9df80, 0xc08a0fd8, 0x0f000000, 0x0000ba85,
+0xfdf16200, 0xc8bd2808, 0xc5ffffff, 0xd84d7dc1,
+0xca7cf1c5, 0x08f5f162, 0xc500eac2, 0x80d593f9,
+0x67b803fa, 0x0f000007, 0x00011e85, 0xfdf36200,
+0xc88d2608, 0x00ffffff, 0x08fdf162, 0xff988d29,
+0xf262ffff, 0x954208fd, 0xffffffc8, 0x08fdf162,
+0xffa89529, 0xeed9ffff, 0xdfa845dd, 0x7ad8dde9,
+0xd968756a, 0x9845dde8, 0x667ae9df, 0x45dd6875,
+0x7ae9dfb0, 0xdd527550, 0xe9dfa045, 0x587ad8dd,
+0xf2625675, 0x8d2c08f5, 0xffffffa8, 0x08fdf162,
+0xffc8ad28, 0x7db8ffff, 0x62000007, 0xc208d5f1,
+0xf9c500f1, 0xfa80d693, 0x9c850f03, 0xe8000000,
+0xfffff549, 0x90e9d8f7, 0xb8000000, 0x0000075e,
+0x000086e9, 0xebd8dd00, 0xb8d8dd02, 0x00000773,
+0xd8dd79eb, 0xd8dd02eb, 0x000778b8, 0xdd6ceb00,
+0xdd68ebd8, 0xdd64ebd8, 0xdd60ebd8, 0xdd5cebd8,
+0xdd58ebd8, 0xdd54ebd8, 0xdd50ebd8, 0xdd4cebd8,
+0xdd48ebd8, 0xdd44ebd8, 0xdd40ebd8, 0xdd3cebd8,
+0xdd38ebd8, 0xdd34ebd8, 0xdd30ebd8, 0xdd2cebd8,
+0xdd28ebd8, 0xdd24ebd8, 0xdd20ebd8, 0xdd1cebd8,
+0xdd18ebd8, 0xebd8ddd8, 0xebd8dd12, 0xebd8dd0e,
+0xebd8dd0a, 0xebd8dd06, 0x81d8dd02, 0x000084c4,
+0xc35d5f00, 0x00000000, 0x00000000, 0x00000000,
+0x40000000, 0x40400000, 0x00000000, 0x00000000,
+0x00000000, 0x40100000, 0x00000000, 0x40080000,
+0x00000000, 0xc0100000, 0x00000000, 0xc0080000,
+0x00000000, 0x00000000, 0x00000000, 0x3ff00000,
+0x00000000, 0x80000000, 0x00000000, 0xbff00000,
+0x00000000, 0x3ff00000, 0x00000000, 0x00000000,
+0x00000000, 0x3fd00000, 0x00000000, 0x3fe00000,
+0005740,
+};
+asm(".type avx512dq_x86_32_D_16f8, STT_NOTYPE;");
+asm(".type avx512dq_x86_32_D_16f8, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512dq_x86_32_D_32i4[] = {
+0xb95500eb, 0x00000020, 0xc031e589, 0x83535657,
+0xec81e0e4, 0x00000160, 0x09bfc389, 0x89000000,
+0xe28340da, 0x83c72901, 0xf61901fa, 0x4e02e683,
+0x0175d885, 0x84848949, 0x0000009c, 0x8903e2c1,
+0x00bc84bc, 0xebd10000, 0xdc84b489, 0x09000000,
+0x849489da, 0x0000011c, 0x8304c283, 0x8c8908f8,
+0x0000fc84, 0x84948900, 0x0000013c, 0xf162aa75,
+0x746f287d, 0xf1620524, 0x747f287d, 0xf1620224,
+0x4c6f287d, 0xf3620224, 0xc61f2875, 0x93f9c500,
+0xb8c2fed0, 0x00000539, 0x06a0850f, 0xf1620000,
+0x54fe2875, 0xf1620524, 0x547f287d, 0xf1620324,
+0x74722865, 0x62010524, 0x6f287df1, 0xb8032454,
+0x0000053f, 0x286df362, 0xc500d31f, 0xfed293f9,
+0x67850fc2, 0x62000006, 0xfa286df1, 0x62052454,
+0x7f287df1, 0x62042454, 0x1f2875f3, 0x0004245c,
+0xd393f9c5, 0x44b8c2fe, 0x0f000005, 0x00063d85,
+0x7df16200, 0x247c6f28, 0x75f26206, 0x24544028,
+0x45f26205, 0x62e74028, 0x6f287df1, 0x6205244c,
+0xfe2875f1, 0x75f162ef, 0x245cfa28, 0x6df16206,
+0xb8d4fa28, 0x0000055b, 0x2865f262, 0xf362dd40,
+0xe31f286d, 0x93f9c500, 0x62c2fed4, 0x7f287df1,
+0x0f04245c, 0x0005e585, 0x75f26200, 0x24544028,
+0x6df36206, 0x602d1f28, 0x00001007, 0xd593f9c5,
+0x1c2444c7, 0x00000002, 0xc8b8c2fe, 0x0f000005,
+0x0005b985, 0x75f16200, 0x2454ef28, 0x7df16207,
+0x24547f28, 0xedf26202, 0x24542828, 0x7df16206,
+0x24547f28, 0x8bc93103, 0x00c08c84, 0x6cf70000,
+0x8489408c, 0x0000808c, 0x8c948900, 0x00000084,
+0x8302c183, 0xdf7508f9, 0x287df162, 0x0324746f,
+0x284df162, 0x04247476, 0xd693f9c5, 0xe1b8c2fe,
+0x0f000005, 0x00055585, 0x75f26200, 0x245c4028,
+0x7df16207, 0x245c7f28, 0x6df16204, 0x24747228,
+0xf1620304, 0x547f287d, 0xf1620224, 0x7472285d,
+0x62020424, 0xfe285df1, 0x05edb8ec, 0xf3620000,
+0xfd1f286d, 0x93f9c500, 0x0fc2fed7, 0x00050d85,
+0x6df16200, 0x24647228, 0xf1620202, 0xd2fe286d,
+0x0005f2b8, 0x5df36200, 0x00c21f28, 0xd093f9c5,
+0x850fc2fe, 0x000004e6, 0x1c2444c7, 0x00000003,
+0x1c24448b, 0x08244489, 0x891ff8c1, 0x620c2444,
+0x7e08fef1, 0x6201247c, 0xf22865f1, 0x2444c7d7,
+0x0000021c, 0x24448b00, 0x2444891c, 0x1ff8c108,
+0x0c244489, 0x08fef162, 0x0124747e, 0x2865f162,
+0xf162def2, 0xe3fe2865, 0x000605b8, 0x6df36200,
+0x00d41f28, 0xd293f9c5, 0x850fc2fe, 0x0000047e,
+0x1c24448b, 0x08244489, 0x891ff8c1, 0x620c2444,
+0x7e08fef1, 0x6201247c, 0xe2286df1, 0x6df162d7,
+0xb8d2fe28, 0x00000609, 0x2865f362, 0xc500da1f,
+0xfed393f9, 0x43850fc2, 0x62000004, 0xef086df1,
+0x7df162d2, 0x24746f28, 0x4df36208, 0x06ca1f28,
+0xa975f262, 0x07245c40, 0x2865f262, 0x08246447,
+0x000001b8, 0x7df16200, 0x247c6f28, 0x7df26208,
+0x62d07c28, 0xfa2845f1, 0x7df162d2, 0x24547f28,
+0x65f26208, 0x24544728, 0x0621b808, 0xf1620000,
+0xeafe286d, 0x285df362, 0xc500e51f, 0xfed493f9,
+0xd7850fc2, 0x62000003, 0x46286df2, 0xb8082454,
+0x00000626, 0x286df362, 0xc500eb1f, 0xfed593f9,
+0xb7850fc2, 0x62000003, 0x6f287df1, 0x62072454,
+0x40286df2, 0x6206245c, 0x40286df2, 0x62052464,
+0x7f287df1, 0x6203245c, 0x3d285df2, 0x6203245c,
+0x39285df2, 0x62032464, 0x7f287df1, 0x62032464,
+0xfe2865f1, 0xb803245c, 0x0000063d, 0x2875f162,
+0x062464fe, 0x2865f262, 0xf362da40, 0xf41f2865,
+0x93f9c500, 0x0fc2fed6, 0x00035185, 0x75f26200,
+0x62da4028, 0x7f287df1, 0x6202245c, 0x1e287df2,
+0x6202245c, 0x1f2865f3, 0xf9c500f9, 0xc2fed793,
+0x000644b8, 0x23850f00, 0x62000003, 0x6f287df1,
+0x62052474, 0x6f287df1, 0x62062464, 0x43284df3,
+0xf16201ce, 0xc970287d, 0x75f3621b, 0x00c41f28,
+0xd093f9c5, 0x4eb8c2fe, 0x0f000006, 0x0002ed85,
+0x0001b800, 0xf1620000, 0x4c6f287d, 0xf2620524,
+0xd87c287d, 0x285df162, 0x53b8dbfa, 0x62000006,
+0x362865f2, 0x65f362d9, 0x00d41f28, 0xd293f9c5,
+0x850fc2fe, 0x000002b6, 0x302444c7, 0x00000009,
+0x285df162, 0x5db8d9fe, 0x62000006, 0x58287df2,
+0x620c246c, 0x1f2855f3, 0xf9c500db, 0xc2fed393,
+0x0288850f, 0x09b80000, 0x62000000, 0x7c287df2,
+0x55f362e8, 0x00e31f28, 0xd493f9c5, 0x61b8c2fe,
+0x0f000006, 0x00026585, 0x7df36200, 0x244c3928,
+0xf2620003, 0x5c5a287d, 0xf3620324, 0x6c382875,
+0x62010324, 0x1f2865f3, 0xf9c500ed, 0xc0fec593,
+0x00066cb8, 0x33850f00, 0x62000002, 0x210875f3,
+0xf3620ed9, 0xc816087d, 0x65f36201, 0x01d82208,
+0x087df162, 0x03245c7f, 0x287df262, 0x06245c59,
+0xf1620cb0, 0x6c70087d, 0xc5440324, 0x62c892f9,
+0x382975f3, 0x30b000cd, 0xc892f9c5, 0x2975f362,
+0x03244c38, 0x62c0b001, 0x70087df1, 0x4403246c,
+0xc892f9c5, 0x2975f362, 0x6201cd38, 0x1f2865f3,
+0xf9c500f1, 0xc0fec693, 0x00067cb8, 0xbb850f00,
+0x62000001, 0x6f287df1, 0x6209244c, 0x6f287df1,
+0x75f262dc, 0x245c7e28, 0x7df16205, 0x247c6f28,
+0x45f2620a, 0x24647e28, 0x2444c705, 0x00000430,
+0x65f16200, 0xb8dcfa28, 0x000006a6, 0x2865f262,
+0xf262da40, 0x6458287d, 0xf3620c24, 0xfc1f2865,
+0x93f9c500, 0x0fc2fed7, 0x00016185, 0x6df26200,
+0x245c4028, 0x6df16205, 0x1fe27228, 0x2865f262,
+0xf162ca76, 0x5c7f287d, 0xf1620224, 0x4c7f287d,
+0xf1620324, 0x746f287d, 0xf3620224, 0x7439287d,
+0x62000324, 0x25287df2, 0x62032454, 0x7f287df1,
+0x62042454, 0x1f286df3, 0xf9c500c1, 0xc2fed093,
+0x0006b3b8, 0x03850f00, 0x62000001, 0x6f287df1,
+0x6205244c, 0x39287df3, 0x0003244c, 0x087df162,
+0x03247c6f, 0x087df162, 0x02247c7f, 0x287df262,
+0x02245425, 0x287df162, 0x0224547f, 0x287df162,
+0x0224746f, 0x287ef262, 0x03247435, 0xb48bc031,
+0x0000a084, 0x84743900, 0xb80a7430, 0x000006f1,
+0x0000a9e9, 0xf8834000, 0x8be37504, 0x00c42484,
+0xf1620000, 0x4c7f287d, 0x44890324, 0x848b6424,
+0x0000cc24, 0x24448900, 0x24848b6c, 0x000000d4,
+0x74244489, 0xdc24848b, 0x89000000, 0xb07c2444,
+0x7df162aa, 0x244c6f28, 0x92f9c505, 0x75f262c8,
+0x24546429, 0x6df36206, 0x24541f28, 0xf9c50003,
+0xc2fed293, 0x00073ab8, 0x62437500, 0x032875f3,
+0x07b801d9, 0xba000000, 0x00000000, 0x287df262,
+0x01b8d07c, 0x62000000, 0xdb2875f1, 0x7df262ca,
+0x62d07c28, 0xfe2875f1, 0x65f362ca, 0x00d91f28,
+0xc393f9c5, 0x4ab8c0fe, 0x0f000007, 0x658dc244,
+0x5f5e5bf4, 0x0000c35d, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000008, 0x0000000e, 0x00000012, 0x00000014,
+0x00000014, 0x00000012, 0x0000000e, 0x00000008,
+0003600,
+};
+asm(".type avx512dq_x86_32_D_32i4, STT_NOTYPE;");
+asm(".type avx512dq_x86_32_D_32i4, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512dq_x86_32_D_32u4[] = {
+0xb95500eb, 0x00000020, 0xc031e589, 0x83535657,
+0xec81e0e4, 0x00000160, 0x09bec389, 0x40000000,
+0xe283da89, 0x8dc62901, 0xd885ff7a, 0x89490175,
+0x009c8484, 0xe2c10000, 0x84b48903, 0x000000bc,
+0xbc89ebd1, 0x0000dc84, 0x89da0900, 0x011c8494,
+0xc2830000, 0x08f88304, 0xfc848c89, 0x89000000,
+0x013c8494, 0xb0750000, 0x287df162, 0x05247c6f,
+0x287df162, 0x02247c7f, 0x287df162, 0x0224546f,
+0x286df362, 0xc500c71f, 0xfed093f9, 0x0539b8c2,
+0x850f0000, 0x00000606, 0x286df162, 0x05244cfe,
+0x287df162, 0x03244c7f, 0x2865f162, 0x05247472,
+0x7df16201, 0x244c6f28, 0x053fb803, 0xf3620000,
+0xd31f2875, 0x93f9c500, 0x0fc2fed2, 0x0005cd85,
+0x75f16200, 0x244cfa28, 0x7df16205, 0x244c7f28,
+0x7df16204, 0x245c6f28, 0x6df36204, 0x00db1f28,
+0xd393f9c5, 0x44b8c2fe, 0x0f000005, 0x00059d85,
+0x6df16200, 0x2454eb28, 0x7df16206, 0x24547f28,
+0x75f16202, 0x244cdb28, 0x65f16206, 0x2454ef28,
+0x7df16206, 0x24547f28, 0x75f16204, 0x244cdf28,
+0x75f36202, 0x00e21f28, 0xd493f9c5, 0x50b8c2fe,
+0x0f000005, 0x00055585, 0x7df16200, 0x244c6f28,
+0x75f26205, 0x24544028, 0x6df36206, 0xc02d1f28,
+0x00001006, 0xd593f9c5, 0x1c2444c7, 0x00000002,
+0xc8b8c2fe, 0x0f000005, 0x00052185, 0x75f16200,
+0x2454ef28, 0x7df16207, 0x24547f28, 0xedf16202,
+0x2454f428, 0x7df16206, 0x24547f28, 0x8bc93103,
+0x00c08c84, 0x64f70000, 0x8489408c, 0x0000808c,
+0x8c948900, 0x00000084, 0x8302c183, 0xdf7508f9,
+0x287df162, 0x0324746f, 0x284df162, 0x04247476,
+0xd693f9c5, 0xe1b8c2fe, 0x0f000005, 0x0004bd85,
+0x7df16200, 0x244c7f28, 0x6df16204, 0x24747228,
+0xf1620304, 0x547f287d, 0xf1620224, 0x74722865,
+0x62020424, 0xfe2865f1, 0x05edb8e3, 0xf3620000,
+0xfc1f286d, 0x93f9c500, 0x0fc2fed7, 0x00047d85,
+0x6df16200, 0x24547228, 0xf1620202, 0xd2fe286d,
+0x0005f2b8, 0x65f36200, 0x00c21f28, 0xd093f9c5,
+0x850fc2fe, 0x00000456, 0x1c2444c7, 0x00000003,
+0x087df162, 0x0724546e, 0x2875f162, 0x44c7d2f2,
+0x00021c24, 0xf1620000, 0x5c6e087d, 0xf1620724,
+0xdbf22875, 0x2865f162, 0x05b8e3fe, 0x62000006,
+0x1f286df3, 0xf9c500d4, 0xc2fed293, 0x040c850f,
+0xf1620000, 0x646e087d, 0xf1620724, 0xd4d2286d,
+0x286df162, 0x09b8d2fe, 0x62000006, 0x1f2865f3,
+0xf9c500da, 0xc2fed393, 0x03e0850f, 0xedc50000,
+0xf162d276, 0xe16f287d, 0x0865f162, 0xe5c5dbef,
+0x00249c76, 0x62000001, 0x25286df3, 0xf26240e3,
+0x6c47285d, 0xf1620824, 0x5cfe286d, 0xf1620824,
+0x5c7f287d, 0xf2620824, 0x5c47285d, 0x21b80824,
+0x62000006, 0xfe2865f1, 0x55f362f3, 0x00e61f28,
+0xd493f9c5, 0x850fc2fe, 0x00000382, 0x2865f262,
+0x08245c45, 0x000626b8, 0x65f36200, 0x00ec1f28,
+0xd593f9c5, 0x850fc2fe, 0x00000362, 0x2875f262,
+0x06245c3b, 0x2875f262, 0x0624643f, 0x2875f162,
+0x06244cfe, 0x2865f162, 0x34b8dcfe, 0x62000006,
+0x1f2865f3, 0xf9c500f1, 0xc2fed693, 0x032c850f,
+0xf1620000, 0x7c6f287d, 0xf1620524, 0x5c6f287d,
+0xf3620624, 0xcf432845, 0x7df16201, 0x1bc97028,
+0x2875f362, 0xc500fb1f, 0xfed793f9, 0x064eb8c2,
+0x850f0000, 0x000002f6, 0x2865f162, 0xf162e2fe,
+0x4c6f287d, 0x53b80524, 0x62000006, 0x36285df2,
+0x5df362e1, 0x00c31f28, 0xd093f9c5, 0x850fc2fe,
+0x000002ca, 0x302444c7, 0x00000009, 0x2865f162,
+0x5db8e1fe, 0x62000006, 0x58287df2, 0x620c246c,
+0x1f2855f3, 0xf9c500d4, 0xc2fed293, 0x029c850f,
+0x09b80000, 0x62000000, 0x7c287df2, 0x55f362e8,
+0x00dc1f28, 0xd393f9c5, 0x61b8c2fe, 0x0f000006,
+0x00027985, 0x7df36200, 0x244c3928, 0xf2620003,
+0x645a287d, 0xf3620324, 0x6c382875, 0x62010324,
+0x1f285df3, 0xf9c500e5, 0xc0fec493, 0x00066cb8,
+0x47850f00, 0x62000002, 0x210875f3, 0xf3620ee1,
+0xc816087d, 0x5df36201, 0x01e02208, 0x087df162,
+0x0324647f, 0x287df262, 0x06246459, 0xf1620cb0,
+0x6c70087d, 0xc5440324, 0x62c892f9, 0x382975f3,
+0x30b000cd, 0xc892f9c5, 0x2975f362, 0x03244c38,
+0x62c0b001, 0x70087df1, 0x4403246c, 0xc892f9c5,
+0x2975f362, 0x6201cd38, 0x1f285df3, 0xf9c500e9,
+0xc0fec593, 0x00067cb8, 0xcf850f00, 0x62000001,
+0x6f287df1, 0x6209244c, 0x6f287df1, 0x75f262e3,
+0x24647e28, 0x7df16205, 0x24746f28, 0x4df2620a,
+0x245c7e28, 0x2444c705, 0x00000430, 0x6df16200,
+0x62d3fe28, 0x252865f3, 0x5507245c, 0x286df162,
+0xa6b8d4fa, 0x62000006, 0xef286df1, 0x62072454,
+0xfa286df1, 0x7df262d3, 0x245c5828, 0x6df3620c,
+0x00f31f28, 0xd693f9c5, 0x850fc2fe, 0x0000015e,
+0x0865f162, 0xf162dbef, 0x546f287d, 0xf2620524,
+0xd37e2875, 0x286df262, 0xf162cb76, 0x547f287d,
+0xf1620324, 0x4c7f287d, 0xf1620424, 0x7c6f287d,
+0xf3620524, 0x7c39287d, 0x62000324, 0x35287df2,
+0x6203244c, 0x1f2875f3, 0xf9c500fa, 0xc2fed793,
+0x0006d3b8, 0x03850f00, 0x62000001, 0x6f287df1,
+0x6205244c, 0x39287df3, 0x0003244c, 0x087df162,
+0x0324746f, 0x087df162, 0x0224747f, 0x287df262,
+0x02245435, 0x287df162, 0x0224547f, 0x287df162,
+0x02247c6f, 0x287ef262, 0x03247c35, 0xbc8bc031,
+0x0000a084, 0x847c3900, 0xb80a7430, 0x000006f1,
+0x0000a9e9, 0xf8834000, 0x8be37504, 0x00c42484,
+0xf1620000, 0x4c7f287d, 0x44890324, 0x848b6424,
+0x0000cc24, 0x24448900, 0x24848b6c, 0x000000d4,
+0x74244489, 0xdc24848b, 0x89000000, 0xb07c2444,
+0x7df162aa, 0x244c6f28, 0x92f9c505, 0x75f262c8,
+0x24546429, 0x6df36206, 0x24441f28, 0xf9c50003,
+0xc2fed093, 0x00073ab8, 0x62437500, 0x032875f3,
+0x07b801d9, 0xba000000, 0x00000000, 0x287df262,
+0x01b8d07c, 0x62000000, 0xdb2875f1, 0x7df262ca,
+0x62d07c28, 0xfe2875f1, 0x65f362ca, 0x00d11f28,
+0xc293f9c5, 0x4ab8c0fe, 0x0f000007, 0x658dc244,
+0x5f5e5bf4, 0x0000c35d, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000008, 0x0000000e, 0x00000012, 0x00000014,
+0x00000014, 0x00000012, 0x0000000e, 0x00000008,
+0003340,
+};
+asm(".type avx512dq_x86_32_D_32u4, STT_NOTYPE;");
+asm(".type avx512dq_x86_32_D_32u4, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512dq_x86_32_D_32i8[] = {
+0x895500eb, 0xff3157e5, 0x0001be56, 0xbb530000,
+0x00000040, 0x81e0e483, 0x000160ec, 0xff468d00,
+0x4489d231, 0x05b81824, 0x89000000, 0x2444c7f1,
+0xffffff10, 0x89f029ff, 0x8b082444, 0x19182444,
+0x245489fa, 0x2444c70c, 0xffffff14, 0x01e083ff,
+0x0e75c289, 0x102444c7, 0x00000001, 0x4489c031,
+0x4c851424, 0x01751824, 0xccb4894b, 0x00000098,
+0x3102e2c1, 0xcc8489c0, 0x000000fc, 0x1824448b,
+0x08fef162, 0x01247c7e, 0x9cccbc89, 0x62000000,
+0x7e08fef1, 0x62022474, 0xd608fdf1, 0x8917cc7c,
+0x00f8cc9c, 0xf1620000, 0x74d608fd, 0xe8d11bcc,
+0xd231d009, 0x18cc8489, 0x83000001, 0x948902c0,
+0x00011ccc, 0x00d28300, 0x8901c683, 0x0138cc84,
+0xf0890000, 0x8900d783, 0x013ccc94, 0xf0830000,
+0x0ff80905, 0xffff3485, 0xfdf162ff, 0x247c6f28,
+0xfdf16205, 0x247c7f28, 0xfdf16202, 0x244c6f28,
+0xf5f36202, 0x00c71f28, 0xd093f9c5, 0xb80ffa80,
+0x00000539, 0x04fb850f, 0xf1620000, 0x54d428f5,
+0xf1620524, 0x547f28fd, 0xf1620324, 0x747328e5,
+0x62010524, 0x6f28fdf1, 0xb8032454, 0x0000053f,
+0x28edf362, 0xc500d31f, 0x80d293f9, 0x850f0ffa,
+0x000004c1, 0x28edf162, 0x052454fb, 0x28fdf162,
+0x0424547f, 0x28f5f362, 0x04245c1f, 0x93f9c500,
+0x0ffa80d3, 0x000544b8, 0x96850f00, 0x62000004,
+0x6f28fdf1, 0x62062474, 0x4028f5f2, 0x6205244c,
+0x4028cdf2, 0xfdf162de, 0x24546f28, 0xedf16205,
+0x62eed428, 0xfb28edf1, 0x62062464, 0xfb28f5f1,
+0x055bb8cb, 0xf2620000, 0xe54028dd, 0x28f5f362,
+0xc500e41f, 0x80d493f9, 0x850f0ffa, 0x00000445,
+0x28edf262, 0x06244c40, 0x28f5f362, 0x06202d1f,
+0xc5000010, 0x80d593f9, 0xc8b80ffa, 0x0f000005,
+0x00042085, 0xfdf16200, 0x245c6f28, 0xedf26207,
+0x62e34028, 0x7f28fdf1, 0x62042464, 0x7328f5f1,
+0x03042474, 0x28fdf162, 0x02244c7f, 0x28d5f162,
+0x04247473, 0xd5f16202, 0xb8f5d428, 0x000005ed,
+0x28f5f362, 0xc500f61f, 0x80d693f9, 0x850f0ffa,
+0x000003d1, 0x28f5f162, 0x02246472, 0xf5f16202,
+0xb8c9d428, 0x000005f2, 0x28d5f362, 0xc500f91f,
+0x80d793f9, 0x850f0ffa, 0x000003a9, 0x2c2444c7,
+0x00000003, 0x2c24448b, 0x18244489, 0x891ff8c1,
+0x621c2444, 0x7e08fef1, 0x6203247c, 0xf328ddf1,
+0x2444c7cf, 0x0000022c, 0x24448b00, 0x2444892c,
+0x1ff8c118, 0x1c244489, 0x08fef162, 0x0324747e,
+0x28ddf162, 0xf162e6f3, 0xecd428dd, 0x000605b8,
+0xf5f36200, 0x00c51f28, 0xd093f9c5, 0x0f0ffa80,
+0x00034085, 0x24448b00, 0x2444892c, 0x1ff8c118,
+0x1c244489, 0x08fef162, 0x03247c7e, 0x28f5f162,
+0xf162cfe2, 0xc9d428f5, 0x000609b8, 0xddf36200,
+0x00d11f28, 0xd293f9c5, 0x0f0ffa80, 0x00030485,
+0xf5f16200, 0x62c9ef08, 0x6f28fdf1, 0x62082474,
+0x1f28cdf3, 0xf26206c9, 0xcb40a9ed, 0x28fdf162,
+0x04244c7f, 0x28f5f262, 0x08246c47, 0x28fdf162,
+0x08247c6f, 0x38c5f162, 0x064025fb, 0xf1620010,
+0x647f28fd, 0xf2620824, 0x4c4728f5, 0x21b80824,
+0x62000006, 0x7f28fdf1, 0x6203244c, 0xd428f5f1,
+0xd5f362c9, 0x00d91f28, 0xd393f9c5, 0x0f0ffa80,
+0x00029085, 0xfdf16200, 0x24746f28, 0xcdf26203,
+0x244c4628, 0x0626b808, 0xf3620000, 0x641f28f5,
+0xc5000424, 0x80d493f9, 0x850f0ffa, 0x00000265,
+0x28edf262, 0xf162eb40, 0x646f28fd, 0xf2620624,
+0xcb4028dd, 0x28fdf162, 0x02246c7f, 0x28fdf162,
+0x03244c7f, 0x28d5f262, 0x03244c3d, 0x28d5f262,
+0x03246c39, 0x28fdf162, 0x03246c7f, 0x28f5f162,
+0x03244cd4, 0x28edf162, 0x3db8ecd4, 0x62000006,
+0x4028f5f2, 0xf5f362cb, 0x00ed1f28, 0xd593f9c5,
+0x0f0ffa80, 0x0001fc85, 0xfdf26200, 0x244c1f28,
+0xf5f36202, 0x00f21f28, 0xd693f9c5, 0xb80ffa80,
+0x00000644, 0x01db850f, 0xf1620000, 0x7c6f28fd,
+0xf3620524, 0xcf4328c5, 0x7df16201, 0x4ec97028,
+0x28f5f362, 0xc500fc1f, 0x80d793f9, 0x4eb80ffa,
+0x0f000006, 0x0001ac85, 0xfdf26200, 0x40155928,
+0x62001006, 0xfb28ddf1, 0x0653b8ca, 0xf2620000,
+0x4c3628f5, 0xf3620524, 0xc41f28f5, 0x93f9c500,
+0x0ffa80d0, 0x017b850f, 0xf3620000, 0x4c0028fd,
+0x621b0524, 0x1f28f5f3, 0xf9c500cc, 0xfa80d193,
+0x0658b80f, 0x850f0000, 0x00000159, 0x28fdf162,
+0x05244c6f, 0x302444c7, 0x00000005, 0x5489d231,
+0xf1623424, 0xf4d428f5, 0x00065db8, 0xfdf26200,
+0x246c5928, 0xd5f36206, 0x00d61f28, 0xd293f9c5,
+0x0f0ffa80, 0x00011c85, 0xfdf36200, 0x244c3928,
+0xf2620003, 0x6c5a28fd, 0xf3620324, 0x4c3828f5,
+0x62010324, 0x1f28d5f3, 0xf9c500d9, 0x0f3cc393,
+0x6cb80a74, 0xe9000006, 0x000000e9, 0x28fdf162,
+0x09244c6f, 0x28ddf262, 0x05244c76, 0x28fdf162,
+0x0a24746f, 0x28cdf262, 0x0524647e, 0x302444c7,
+0x00000002, 0x28f5f162, 0xc031ccfb, 0x34244489,
+0x28f5f262, 0xa6b8cb40, 0x62000006, 0x5928fdf2,
+0x6206245c, 0x1f28f5f3, 0xf9c500e3, 0xfa80d493,
+0x8e850f0f, 0x62000000, 0x7e08fef1, 0x6219244c,
+0x6f28fdf1, 0x6205247c, 0x7f28fdf1, 0x6203247c,
+0xd608fdf1, 0x620d244c, 0x7e08fef1, 0x621b244c,
+0xd608fdf1, 0xb00f244c, 0xfdf162aa, 0x244c6f28,
+0x92f9c505, 0xf5f262c8, 0x245c6429, 0xe5f36206,
+0x246c1f28, 0xf9c50003, 0xfa80d593, 0x073ab80f,
+0x31750000, 0x28f5f362, 0x6201d903, 0xdb38f5f1,
+0x1006480d, 0xf5f16200, 0xbacad428, 0x00000000,
+0x28e5f362, 0xc500f11f, 0x3cc693f9, 0x074ab80f,
+0x440f0000, 0xf4658dc2, 0x5d5f5e5b, 0x000000c3,
+0x00000004, 0x00000000, 0x00000006, 0x00000000,
+0x00000006, 0x00000000, 0x00000004, 0x00000000,
+0x00000001, 0x00000000, 0x00000003, 0x00000000,
+0003120,
+};
+asm(".type avx512dq_x86_32_D_32i8, STT_NOTYPE;");
+asm(".type avx512dq_x86_32_D_32i8, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512dq_x86_32_D_32u8[] = {
+0x895500eb, 0xff3157e5, 0x0001be56, 0xbb530000,
+0x00000040, 0x81e0e483, 0x000160ec, 0xff468d00,
+0x4489d231, 0x05b81c24, 0x89000000, 0x89f029f1,
+0x8b102444, 0x191c2444, 0x245489fa, 0x01e08314,
+0x18244489, 0x24448948, 0x7485990c, 0x01751c24,
+0x7df1624b, 0x62f86e08, 0x220845f3, 0xb48901fa,
+0x000098cc, 0xccbc8900, 0x0000009c, 0x548bc031,
+0x84891824, 0x0000fccc, 0x24448b00, 0xfef1621c,
+0x24747e08, 0xcc9c8902, 0x000000f8, 0x08fdf162,
+0x17cc74d6, 0x08fdf162, 0x1bcc7cd6, 0xd102e2c1,
+0x31d009e8, 0xcc8489d2, 0x00000118, 0x8902c083,
+0x011ccc94, 0xd2830000, 0x01c68300, 0x38cc8489,
+0x89000001, 0x00d783f0, 0x3ccc9489, 0x83000001,
+0xf80905f0, 0xff43850f, 0xf162ffff, 0x746f28fd,
+0xf1620524, 0x747f28fd, 0xf1620224, 0x546f28fd,
+0xf3620224, 0xc61f28ed, 0x93f9c500, 0x0ffa80d0,
+0x000539b8, 0x80850f00, 0x62000004, 0xd428edf1,
+0x6205244c, 0x7f28fdf1, 0x6203244c, 0x7328e5f1,
+0x01052474, 0x28fdf162, 0x03244c6f, 0x00053fb8,
+0xf5f36200, 0x00d31f28, 0xd293f9c5, 0x0f0ffa80,
+0x00044685, 0xf5f16200, 0x244cfb28, 0xfdf16205,
+0x244c7f28, 0xfdf16204, 0x245c6f28, 0xedf36204,
+0x00db1f28, 0xd393f9c5, 0xb80ffa80, 0x00000544,
+0x0415850f, 0xf1620000, 0x54eb28ed, 0xf1620624,
+0x547f28fd, 0xf1620224, 0x4cdb28f5, 0xf1620624,
+0x5cef28e5, 0xf1620624, 0x4cdf28f5, 0xf3620224,
+0xe31f28f5, 0x93f9c500, 0x0ffa80d4, 0x000550b8,
+0xd4850f00, 0x62000003, 0x6f28fdf1, 0x62052454,
+0x4028edf2, 0x6206244c, 0x1f28f5f3, 0x1005a02d,
+0xf9c50000, 0xfa80d593, 0x05c8b80f, 0x850f0000,
+0x000003a7, 0x28fdf162, 0x0424547f, 0x28f5f162,
+0x04247473, 0xfdf16203, 0x244c7f28, 0xe5f16202,
+0x24747328, 0xf1620204, 0xe3d428e5, 0x0005edb8,
+0xf5f36200, 0x00f41f28, 0xd693f9c5, 0x0f0ffa80,
+0x00036685, 0xf5f16200, 0x24547328, 0xf1620202,
+0xc9d428f5, 0x0005f2b8, 0xe5f36200, 0x00f91f28,
+0xd793f9c5, 0x0f0ffa80, 0x00033e85, 0x2444c700,
+0x0000032c, 0x7df16200, 0x244c6e08, 0xedf1620b,
+0xc7c9f328, 0x022c2444, 0x62000000, 0x6e087df1,
+0x620b245c, 0xf328edf1, 0xe5f162db, 0xb8e3d428,
+0x00000605, 0x28f5f362, 0xc500c41f, 0x80d093f9,
+0x850f0ffa, 0x000002f3, 0x087df162, 0x0b24646e,
+0x28f5f162, 0xf162ccd3, 0xc9d428f5, 0x000609b8,
+0xe5f36200, 0x00c91f28, 0xd193f9c5, 0x0f0ffa80,
+0x0002c685, 0x76f5c500, 0xfdf162c9, 0x62da6f28,
+0xef08ddf1, 0x5de2c4e4, 0x0024a429, 0x62000001,
+0x2528f5f3, 0xf16240dc, 0x5c7f28fd, 0xf2620424,
+0x644728e5, 0xf1620824, 0x6cd428f5, 0xf1620824,
+0x6c7f28fd, 0xf2620824, 0x5c4728e5, 0x21b80824,
+0x62000006, 0x7f28fdf1, 0x6203245c, 0xd428e5f1,
+0xddf362db, 0x00d31f28, 0xd293f9c5, 0x0f0ffa80,
+0x00025685, 0xfdf16200, 0x247c6f28, 0xc5f26203,
+0x245c4528, 0x0626b808, 0xf3620000, 0x5c1f28e5,
+0xc5000424, 0x80d393f9, 0x850f0ffa, 0x0000022b,
+0x28edf262, 0x06245c3b, 0x28edf262, 0x0624643f,
+0x28edf162, 0x062454d4, 0x28e5f162, 0x34b8dcd4,
+0x62000006, 0x1f28e5f3, 0xf9c500e2, 0xfa80d493,
+0xf4850f0f, 0x62000001, 0x6f28fdf1, 0x6205246c,
+0x6f28fdf1, 0x62062454, 0x4328d5f3, 0xf16201dd,
+0xdb70287d, 0xe5f3624e, 0x00ea1f28, 0xd593f9c5,
+0xb80ffa80, 0x0000064e, 0x01bd850f, 0xf1620000,
+0xd9d428ed, 0x000653b8, 0xe5f26200, 0x245c3628,
+0xe5f36205, 0x00f21f28, 0xd693f9c5, 0x0f0ffa80,
+0x00019685, 0xfdf36200, 0x245c0028, 0xf3621b05,
+0xfa1f28e5, 0x93f9c500, 0x0ffa80d7, 0x000658b8,
+0x74850f00, 0x62000001, 0x6f28fdf1, 0xc705245c,
+0x05302444, 0x31000000, 0x245489d2, 0xe5f16234,
+0xb8ead428, 0x0000065d, 0x28fdf262, 0x06246459,
+0x28ddf362, 0xc500c51f, 0x80d093f9, 0x850f0ffa,
+0x00000137, 0x28fdf362, 0x03245c39, 0xfdf26200,
+0x24645a28, 0xe5f36203, 0x245c3828, 0xf3620103,
+0xcb1f28dd, 0x93f9c500, 0x740f3cc1, 0x066cb80a,
+0x04e90000, 0x62000001, 0x6f28fdf1, 0x6209245c,
+0x7628edf2, 0x6205245c, 0x6f28fdf1, 0x620a2474,
+0x7e28cdf2, 0xc7052454, 0x02302444, 0x62000000,
+0xd428f5f1, 0x62c031ca, 0x2528edf3, 0x55072454,
+0x34244489, 0x28f5f162, 0xf162cbfb, 0x4cef28f5,
+0xf1620724, 0xcafb28f5, 0x0006a6b8, 0xfdf26200,
+0x24545928, 0xf5f36206, 0x00d21f28, 0xd293f9c5,
+0x0f0ffa80, 0x00009285, 0xfef16200, 0x244c7e08,
+0xfdf16219, 0x247c6f28, 0xfdf16205, 0x247c7f28,
+0xfdf16203, 0x244cd608, 0xfef1620d, 0x244c7e08,
+0xfdf1621b, 0x244cd608, 0x62aab00f, 0x6f28fdf1,
+0xc505244c, 0x62c892f9, 0x6429f5f2, 0x62062454,
+0x1f28edf3, 0x0003245c, 0xd393f9c5, 0xb80ffa80,
+0x0000073a, 0xf3623575, 0xd10328f5, 0xf5f16201,
+0xc00ddb38, 0x62001005, 0xd438f5f1, 0x1005c80d,
+0x0000ba00, 0xf3620000, 0xe11f28ed, 0x93f9c500,
+0xb80f3cc4, 0x0000074a, 0x8dc2440f, 0x5e5bf465,
+0x00c35d5f, 0x00000000, 0x00000000, 0x00000000,
+0x00000004, 0x00000000, 0x00000006, 0x00000000,
+0x00000006, 0x00000000, 0x00000004, 0x00000000,
+0x00000003, 0x00000000, 0x00000001, 0x00000000,
+0002720,
+};
+asm(".type avx512dq_x86_32_D_32u8, STT_NOTYPE;");
+asm(".type avx512dq_x86_32_D_32u8, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512dq_x86_32_D_32f4[] = {
+0x000298e9, 0xc0315500, 0xe483e589, 0x83e8d9e0,
+0x09b980c4, 0xd9000000, 0x401c2454, 0x4489ca89,
+0xc2290c24, 0xdb08f883, 0x890c2444, 0xd90c2454,
+0xdb1c845c, 0xd90c2444, 0xd93c845c, 0x755c8454,
+0x62d8ddda, 0x28287cf1, 0x62012454, 0x28287cf1,
+0x6202244c, 0x58386cf1, 0x100cc025, 0x5cf16200,
+0xb8e15928, 0x000000a7, 0x287cf162, 0xf262d928,
+0x5c982875, 0xf1620124, 0xc3c2285c, 0x98f9c504,
+0x14850fc0, 0x62000002, 0x18287df2, 0x100ca01d,
+0x7cf16200, 0x62e92828, 0x57285cf1, 0x75f262e3,
+0x246c9e28, 0x00abb801, 0xf1620000, 0xc5c2285c,
+0x98f9c504, 0xe0850fc0, 0x62000001, 0x58386cf1,
+0x100ca415, 0x6cf16200, 0xb8d15928, 0x000000af,
+0x287cf162, 0xf262e128, 0x649a2875, 0xf1620124,
+0xc4c2286c, 0x98f9c504, 0xac850fc0, 0xb8000001,
+0x000000b3, 0x287cf162, 0xf162e128, 0xd357286c,
+0x2875f262, 0x0124649c, 0x286cf162, 0xc504c4c2,
+0x0fc098f9, 0x00018285, 0x7cf16200, 0x24542828,
+0x6cf16201, 0xb8e15828, 0x000000bb, 0x287df262,
+0x07246c18, 0x287cf162, 0x02247428, 0x284df262,
+0xf162ea98, 0xc5c2285c, 0x98f9c504, 0x48850fc0,
+0xb8000001, 0x000000c0, 0x287cf162, 0xf162ea28,
+0x7428287c, 0xf1620224, 0xe357285c, 0x384df262,
+0x07246c9e, 0x285cf162, 0xc504c5c2, 0x0fc098f9,
+0x00011685, 0x6cf16200, 0xb8c95c28, 0x000000c5,
+0x287df262, 0x07246418, 0x287cf162, 0x02247c28,
+0x2845f262, 0xf162e29a, 0xc4c22874, 0x98f9c504,
+0xe4850fc0, 0xb8000000, 0x000000ca, 0x287cf162,
+0xf162e228, 0x7428287c, 0xf1620224, 0xcb572874,
+0x384df262, 0x0724649c, 0x2874f162, 0xc504c4c2,
+0x0fc098f9, 0x0000b285, 0x7cf16200, 0x244c2828,
+0x6cf16203, 0x246c5928, 0xd0d7c502, 0x00d4b8f1,
+0xf1620000, 0x6428287c, 0xf1620224, 0xfa28287c,
+0x285df262, 0x03247ca6, 0x284cf162, 0xc504c7c2,
+0x75c098f9, 0x74f16276, 0xc5cb5728, 0xb8e9d0d7,
+0x000000d8, 0x286df262, 0x032464a7, 0x2854f162,
+0xc504c4c2, 0x75c098f9, 0x6cf16252, 0x244c5928,
+0xd0f7c502, 0xb860244c, 0x000000de, 0x287cf162,
+0x03245c28, 0x287cf162, 0xf262e228, 0x64962865,
+0xf1620224, 0xc4c22874, 0x98f9c504, 0xb81c75c0,
+0x000000e2, 0x2865f262, 0x02245497, 0x2854f162,
+0xc504c2c2, 0x75c098f9, 0xc9c03102, 0xc03155c3,
+0x8353e589, 0xec81e0e4, 0x00000160, 0x8940c189,
+0xba042444, 0x00000009, 0x042444db, 0x5489c229,
+0xca890424, 0xd901e283, 0xdb7c845c, 0xd9042444,
+0x009c849c, 0xe8d90000, 0xe8d9e0d9, 0xd9ddc9db,
+0xd103e2c1, 0x849cd9e9, 0x000000bc, 0x9489ca09,
+0x0000dc84, 0x04c28300, 0x8908f883, 0x00fc8494,
+0xa8750000, 0x287cf162, 0x04247428, 0x287cf162,
+0x01247429, 0x000539b8, 0x7cf16200, 0x244c2828,
+0x74f16201, 0x04c6c228, 0xc098f9c5, 0x094f850f,
+0xf1620000, 0x54582874, 0xf1620424, 0x5429287c,
+0x3fb80224, 0x62000005, 0x28287cf1, 0x62022454,
+0x28287cf1, 0x6204247c, 0x582844f1, 0x6cf162df,
+0x04c3c228, 0xc098f9c5, 0x0913850f, 0xf1620000,
+0x545c286c, 0xf1620424, 0x5429287c, 0x44b80324,
+0x62000005, 0xc22874f1, 0x04032444, 0xc098f9c5,
+0x08eb850f, 0xf1620000, 0x7428287c, 0xf1620524,
+0x4c592874, 0xf1620424, 0xde59284c, 0x287cf162,
+0x04245428, 0x286cf162, 0x5bb8ee58, 0x62000005,
+0x5c286cf1, 0x62052464, 0x5c2874f1, 0x5cf162cb,
+0x62e55928, 0xc22874f1, 0xf9c504c4, 0x850fc098,
+0x0000089d, 0x286cf162, 0x06244c59, 0x287cf162,
+0x01244c29, 0x000564b8, 0x6cf16200, 0x24545e28,
+0x74f16206, 0x04c2c228, 0xc098f9c5, 0x086f850f,
+0xf2620000, 0x0d18287d, 0x00100ca0, 0x287cf162,
+0x06245c28, 0x000567b8, 0x64f16200, 0x62d15728,
+0x572874f1, 0x6204244c, 0x59286cf1, 0x62012454,
+0xc2286cf1, 0xf9c504c1, 0x850fc098, 0x00000831,
+0x287df162, 0x04244c5b, 0x287cf162, 0x6eb8c95b,
+0x62000005, 0xc22874f1, 0x04042444, 0xc098f9c5,
+0x080b850f, 0xf2620000, 0x4c4c287d, 0xf1620424,
+0x4c29287c, 0x75b80124, 0x62000005, 0x28287cf1,
+0x62042464, 0x4c287df2, 0x6201244c, 0x5b287df1,
+0x7cf162c9, 0x62c95b28, 0xc22874f1, 0xf9c504c4,
+0x850fc098, 0x000007c9, 0x285cf162, 0xf162cc59,
+0x4c29287c, 0xf2620124, 0x4c4e287d, 0xf1620124,
+0x4c29287c, 0x7cb80224, 0x62000005, 0x28287cf1,
+0x6202244c, 0x4c287df2, 0x7df162d1, 0x62d25b28,
+0x5b287cf1, 0x6cf162d2, 0x04c4c228, 0xc098f9c5,
+0x077b850f, 0x7eb80000, 0x62000005, 0x4c287df2,
+0x62042454, 0x5b287df1, 0x7df162c9, 0x62d25b28,
+0x5b287cf1, 0x7cf162c9, 0x62d25b28, 0xc22874f1,
+0xf9c504c2, 0x850fc098, 0x00000745, 0x287cf162,
+0x04247c28, 0x287df362, 0x14247c19, 0x7cf16200,
+0x24742808, 0x7cf16214, 0x24742908, 0x7df36201,
+0x247c1928, 0xf1620114, 0x7428087c, 0xf1621424,
+0x4c7b287d, 0xf1620124, 0x4c7f287d, 0xf1620924,
+0x7429087c, 0xf1620124, 0x4c7b287d, 0xf1620124,
+0x4c7f287d, 0xf1620a24, 0x545b28fc, 0xf1620a24,
+0x4c5b28fc, 0xf3620924, 0xca182875, 0x0588b801,
+0xf1620000, 0x44c22874, 0xc5040424, 0x0fc098f9,
+0x0006bc85, 0x7cf16200, 0x244c7928, 0x7ff16204,
+0xb8c97a28, 0x0000058f, 0x2874f162, 0x042444c2,
+0x98f9c504, 0x96850fc0, 0x62000006, 0x28287cf1,
+0x6204247c, 0x19287df3, 0x0014247c, 0x087cf162,
+0x14247428, 0x087cf162, 0x01247429, 0x287df362,
+0x14247c19, 0x7cf16201, 0x24742808, 0x7df16214,
+0x244c7928, 0x7df16201, 0x244c7f28, 0x7cf16209,
+0x24742908, 0x7df16201, 0x244c7928, 0x7df16201,
+0x244c7f28, 0xfff1620a, 0x244c7a28, 0xfff1620a,
+0x24547a28, 0x6df36209, 0x01d11828, 0x000596b8,
+0x7cf16200, 0x244c2828, 0x6cf16204, 0x04c1c228,
+0xc098f9c5, 0x0607850f, 0xf1620000, 0xd1592874,
+0x287cf162, 0x01245429, 0x00059cb8, 0x7cf16200,
+0x24545128, 0x6cf16201, 0x04c1c228, 0xc098f9c5,
+0x05db850f, 0xf2620000, 0x1518287d, 0x00100cc0,
+0x286cf162, 0xf162c95e, 0x4c29287c, 0xf3620124,
+0x6408287d, 0x620b0124, 0x28287cf1, 0x100cc00d,
+0x05a4b800, 0xf1620000, 0xc4c22874, 0x98f9c504,
+0x9a850fc0, 0x62000005, 0x56287df3, 0x0b04244c,
+0x085cf162, 0xabb8e457, 0x62000005, 0xc22874f1,
+0xf9c504c4, 0x850fc098, 0x00000575, 0x286cf162,
+0x04244c58, 0x286cf162, 0xf162c95e, 0x4c29287c,
+0xf3620124, 0x4c56287d, 0xb80b0124, 0x000005b1,
+0x287cf162, 0x01247c28, 0x2844f162, 0xc504c1c2,
+0x0fc098f9, 0x00053885, 0x7df26200, 0xa80d1828,
+0x6200100c, 0x592874f1, 0x6204244c, 0x29287cf1,
+0x6201244c, 0x08287df3, 0x0b01244c, 0x287df362,
+0x01246456, 0x05bbb80b, 0xf1620000, 0xcc582874,
+0x287cf162, 0x01247428, 0x284cf162, 0xc504c1c2,
+0x0fc098f9, 0x0004e885, 0x64f16200, 0x24645928,
+0x64f16204, 0x245c5928, 0x7cf16205, 0x245c2928,
+0x5df36202, 0x244c5028, 0xf3620502, 0x6450285d,
+0x62040224, 0x29287cf1, 0xb8022464, 0x0000063d,
+0x2874f162, 0x02244c58, 0x287cf162, 0x04247c28,
+0x2874f162, 0x06244c59, 0x2844f162, 0x05245c58,
+0x2874f162, 0xc504c3c2, 0x0fc098f9, 0x00048085,
+0x064eb800, 0xf1620000, 0x7428287c, 0xf1620424,
+0x5c28287c, 0xf3620524, 0xce23284d, 0x74f16201,
+0x1bc9c628, 0x2874f162, 0xc504c3c2, 0x0fc098f9,
+0x00044c85, 0x0653b800, 0xf1620000, 0x4c28287c,
+0xf3620424, 0xe1232875, 0x7df36201, 0x1be40428,
+0x285cf162, 0xc504c3c2, 0x0fc098f9, 0x00042085,
+0x2484c700, 0x00000140, 0x41100000, 0x2864f162,
+0x5db8e958, 0x62000006, 0x18287df2, 0x62502464,
+0xc2285cf1, 0xf9c504c5, 0x850fc098, 0x000003f1,
+0x287df362, 0x14244c19, 0x7df26200, 0x24641a28,
+0x066cb814, 0xf3620000, 0x6c182875, 0x62011424,
+0xc2285cf1, 0xf9c504c5, 0x850fc098, 0x000003c1,
+0x0874f162, 0x6255e9c6, 0x210875f3, 0xf3620ee1,
+0xe521085d, 0x7cf16210, 0x24642908, 0x7df26214,
+0x24641928, 0x7df36228, 0x246c0408, 0x0cb04414,
+0xc892f9c5, 0x2975f362, 0xb000cd18, 0x92f9c530,
+0x75f362c8, 0x244c1829, 0xf3620114, 0x6c04087d,
+0xb0441424, 0x92f9c5c0, 0x067cb8c8, 0xf3620000,
+0xcd182975, 0x5cf16201, 0x04c1c228, 0xc098f9c5,
+0x034b850f, 0xf1620000, 0x4c28287c, 0xf2620724,
+0x4c772865, 0xf1620424, 0x7c6f287d, 0xf2620824,
+0x5c7f2845, 0xf1620424, 0x5c29287c, 0xf1620224,
+0xcb5c2874, 0x402484c7, 0x00000001, 0x62408000,
+0x592874f1, 0x6206244c, 0x18287df2, 0xb850245c,
+0x000006a6, 0x2874f162, 0x6204c3c2, 0x29287cf1,
+0xc503244c, 0x0fc098f9, 0x0002e485, 0x7cf16200,
+0x246c2828, 0x7df36204, 0x246c1928, 0xf1620014,
+0x7428087c, 0xf1621424, 0x7429087c, 0xf1621224,
+0x4c5a287c, 0xf1621224, 0x4c2928fd, 0xf1620124,
+0x4c5a28fd, 0xf1620124, 0x4c29087c, 0xc0311424,
+0x808484d9, 0xd9000000, 0x01408484, 0xe9df0000,
+0x027ad8dd, 0xf1b80a74, 0xe9000006, 0x00000281,
+0x04f88340, 0xf162da75, 0x6412287e, 0xf2620424,
+0x0d18287d, 0x00100ca4, 0x285cf162, 0x0424645c,
+0x2874f162, 0x06244c58, 0x287df262, 0x0cac1d18,
+0x17b80010, 0x62000007, 0x592874f1, 0x5cf162cb,
+0x04c1c228, 0xc098f9c5, 0x0233850f, 0xf1620000,
+0x4c16287e, 0x1eb80424, 0x62000007, 0x28287cf1,
+0x62042464, 0x58286cf1, 0x62062454, 0x5c2874f1,
+0x6cf162cc, 0x62d35928, 0xc22874f1, 0xf9c504c2,
+0x850fc098, 0x000001f9, 0xa42484d9, 0x62000000,
+0x29287cf1, 0xd9022464, 0xd944245c, 0x00ac2484,
+0x5cd90000, 0x84d94c24, 0x0000b424, 0x245cd900,
+0x2484d954, 0x000000bc, 0x5c245cd9, 0xf162aab0,
+0x7c28287c, 0xf9c50424, 0x3ab8c892, 0x62000007,
+0x652945f2, 0x6205244c, 0xc22874f1, 0x04022444,
+0xc098f9c5, 0x0197850f, 0xf1620000, 0x6c28287c,
+0xd7c50424, 0xa0248cd0, 0xb8000000, 0x00000743,
+0x287cf162, 0x04245428, 0x286cf162, 0x05245c5c,
+0x296cf162, 0x05245c58, 0x2874f162, 0xc504c3c2,
+0x0fc098f9, 0x00015885, 0x0003ba00, 0xf1620000,
+0x5429287c, 0xf1620124, 0x1d6f287d, 0x00100ce0,
+0x086cf162, 0xc54ad257, 0x244c7cef, 0x65f26220,
+0x62c91628, 0x29287cf1, 0x7501244c, 0x75f362e9,
+0x07f10328, 0x0cb005d9, 0xf1620010, 0x7411087e,
+0x44d90124, 0xe9df0424, 0x8a0fd8dd, 0x000000ee,
+0x00e8850f, 0x67b80000, 0x62000007, 0x28287cf1,
+0xc504247c, 0x248c7dc7, 0x000000a0, 0x2865f262,
+0xf7c5c916, 0xf262ca7c, 0xc9162865, 0xca7cf7c5,
+0x2865f262, 0xf7c5c916, 0xf262ca7c, 0xc9162865,
+0x2874f162, 0xc504c2c2, 0x0fc098f9, 0x0000b085,
+0x7df36200, 0x244c2628, 0xf1620004, 0x4c29287c,
+0xf2620124, 0x4c42287d, 0xf1620424, 0x4c29287c,
+0xc9310224, 0x087df162, 0xf162ca6e, 0x4cd608fd,
+0x6cdf0124, 0x44d90824, 0xe9df408c, 0x657ad8dd,
+0x418d6375, 0x02598d01, 0xfb83c321, 0x00d28301,
+0x0e75c885, 0x44d9e8d9, 0xe9df1c84, 0x4c7ad8dd,
+0xf8834a75, 0x89047408, 0x62b9ebc1, 0x28287cf1,
+0x6201246c, 0x2c2855f2, 0x6202244c, 0x28287cf1,
+0xb8042474, 0x0000077d, 0x284cf162, 0xc504c1c2,
+0x75c098f9, 0xf39be81c, 0xd8f7ffff, 0x5eb813eb,
+0xeb000007, 0x0773b80c, 0x05eb0000, 0x000778b8,
+0xfc5d8b00, 0x0000c3c9, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x80000000, 0xbf800000, 0x3e800000, 0x3f000000,
+0x42100000, 0x00000000, 0x00000000, 0x00000000,
+0x3f800000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000001, 0x00000004, 0x00000005,
+0x00000002, 0x00000003, 0x00000006, 0x00000007,
+0006400,
+};
+asm(".type avx512dq_x86_32_D_32f4, STT_NOTYPE;");
+asm(".type avx512dq_x86_32_D_32f4, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512dq_x86_32_D_32f8[] = {
+0x0002cbe9, 0xe8d95500, 0xe483e589, 0x80c483e0,
+0x182454dd, 0x202454dd, 0x0c0005d9, 0x54dd0010,
+0xc9d94024, 0x602454dd, 0x0c0405d9, 0x54dd0010,
+0x05d92824, 0x00100c08, 0x482454dd, 0x54ddcad9,
+0xcad96824, 0x30245cdd, 0x50245cdd, 0x702454dd,
+0x5cddc9d9, 0x54dd3824, 0x5cdd5824, 0xf1627824,
+0x152828fd, 0x00100c20, 0x28fdf162, 0x02244c28,
+0x28fdf162, 0xf262d928, 0x5c9828f5, 0xf1620124,
+0xc3c228ed, 0x93f9c500, 0x0ffa80d0, 0x0000a7b8,
+0x37850f00, 0x62000002, 0x2828fdf1, 0x100c4015,
+0xfdf16200, 0x62d92828, 0x9e28f5f2, 0x6201245c,
+0xc228edf1, 0xf9c500cb, 0xfa80d193, 0x00abb80f,
+0x850f0000, 0x00000206, 0x28fdf162, 0x0c601528,
+0xf1620010, 0xd92828fd, 0x28f5f262, 0x01245c9a,
+0x28edf162, 0xc500d3c2, 0x80d293f9, 0xafb80ffa,
+0x0f000000, 0x0001d585, 0xfdf16200, 0x80152828,
+0x6200100c, 0x2828fdf1, 0xf5f262d9, 0x245c9c28,
+0xedf16201, 0x00dbc228, 0xd393f9c5, 0xb80ffa80,
+0x000000b3, 0x01a4850f, 0xf1620000, 0x542828fd,
+0xf1620124, 0xd95828ed, 0x28fdf262, 0x03246419,
+0x28fdf162, 0x02247428, 0x28cdf262, 0xf162e298,
+0xe4c228e5, 0x93f9c500, 0x0ffa80d4, 0x0000bbb8,
+0x67850f00, 0x62000001, 0x1928fdf2, 0x100c8025,
+0xfdf16200, 0x62ea2828, 0x2828fdf1, 0x62022474,
+0x5728e5f1, 0xcdf262dc, 0x246c9e38, 0xe5f16203,
+0x00edc228, 0xd593f9c5, 0xb80ffa80, 0x000000c0,
+0x0128850f, 0xf1620000, 0xc95c28ed, 0x28fdf262,
+0x03245c19, 0x28fdf162, 0x02247c28, 0x28c5f262,
+0xf162da9a, 0xf3c228f5, 0x93f9c500, 0x0ffa80d6,
+0x0000c5b8, 0xf3850f00, 0x62000000, 0x2828fdf1,
+0xfdf162da, 0x24742828, 0xf5f16202, 0x62cc5728,
+0x9c38cdf2, 0x6203245c, 0xc228f5f1, 0xf9c500fb,
+0xfa80d793, 0x00cab80f, 0x850f0000, 0x000000be,
+0x28fdf162, 0x03244c28, 0x28edf162, 0x02246c59,
+0xf1d0d5c5, 0x28fdf162, 0x02245c28, 0x28fdf162,
+0xf262fa28, 0x7ca628e5, 0xf1620324, 0xc7c228cd,
+0x93f9c500, 0x0ffa80d0, 0x0000d4b8, 0x627f7500,
+0x5728f5f1, 0xd0d5c5cc, 0xedf262e9, 0x245ca728,
+0xd5f16203, 0x00cbc228, 0xd193f9c5, 0xb80ffa80,
+0x000000d8, 0xf1625875, 0x4c5928ed, 0xf5c50224,
+0x60244cd0, 0x28fdf162, 0x03245c28, 0x28fdf162,
+0xf262e228, 0x649628e5, 0xf1620224, 0xd4c228f5,
+0x93f9c500, 0x0ffa80d2, 0x0000deb8, 0x621f7500,
+0x9728e5f2, 0x62022454, 0xc228d5f1, 0xf9c500da,
+0xfa80d393, 0x00e2b80f, 0x02750000, 0xc3c9c031,
+0x89e8d955, 0xe48353e5, 0xe0ec81e0, 0xdd000000,
+0x00802494, 0x05d90000, 0x00100c00, 0xa02494dd,
+0xd9000000, 0x2494ddc9, 0x000000c0, 0x0c0405d9,
+0x94dd0010, 0x00008824, 0x0805d900, 0xdd00100c,
+0x00a82494, 0xe8d90000, 0x94dde0d9, 0x0000c824,
+0xddc9d900, 0x0090249c, 0xc9d90000, 0xb02494dd,
+0xd9000000, 0x2494ddca, 0x000000d0, 0x9cddcbd9,
+0x00009824, 0xddcad900, 0x00b8249c, 0xc9d90000,
+0xd8249cdd, 0x62000000, 0x2828fdf1, 0x62042474,
+0x2928fdf1, 0x62012474, 0x2828fdf1, 0x6201244c,
+0xc228f5f1, 0xf9c500c6, 0xfa80d093, 0x0539b80f,
+0x850f0000, 0x00000808, 0x28f5f162, 0x04245458,
+0x28fdf162, 0x02245429, 0x28fdf162, 0x02245428,
+0x28fdf162, 0x04247c28, 0x28c5f162, 0xf162df58,
+0xd3c228ed, 0x93f9c500, 0x0ffa80d2, 0x00053fb8,
+0xcd850f00, 0x62000007, 0x5c28edf1, 0x62042454,
+0x2928fdf1, 0x62032454, 0xc228f5f1, 0x0003245c,
+0xd393f9c5, 0xb80ffa80, 0x00000544, 0x07a6850f,
+0xf1620000, 0x6c2828fd, 0xf1620524, 0x4c5928f5,
+0xf1620424, 0xdd5928d5, 0x28fdf162, 0x04245428,
+0x28edf162, 0xf162ed58, 0x645c28ed, 0xf1620524,
+0xcb5c28f5, 0x28ddf162, 0xf162e559, 0xe4c228f5,
+0x93f9c500, 0x0ffa80d4, 0x00055bb8, 0x59850f00,
+0x62000007, 0x5928edf1, 0x6206244c, 0x2928fdf1,
+0x6201244c, 0x5e28edf1, 0x62062454, 0xc228f5f1,
+0xf9c500ea, 0xfa80d593, 0x0564b80f, 0x850f0000,
+0x0000072c, 0x28fdf262, 0x0c800d19, 0xf1620010,
+0x542828fd, 0xf1620624, 0xd95728ed, 0x28f5f162,
+0x04244c57, 0x28e5f162, 0x01245c59, 0x28e5f162,
+0xc500f1c2, 0x80d693f9, 0x67b80ffa, 0x0f000005,
+0x0006ef85, 0xfff16200, 0x244ce628, 0x7ef16204,
+0x62c9e628, 0xc228f5f1, 0x0004247c, 0xd793f9c5,
+0xb80ffa80, 0x0000056e, 0x06ca850f, 0xf2620000,
+0x4c4c28fd, 0xf1620424, 0x4c2928fd, 0xf1620124,
+0x642828fd, 0xf2620424, 0x4c4c28fd, 0xf1620124,
+0xc9e628ff, 0x287ef162, 0xf162c9e6, 0xc4c228f5,
+0x93f9c500, 0x0ffa80d0, 0x000575b8, 0x89850f00,
+0x62000006, 0x5928ddf1, 0xfdf162cc, 0x244c2928,
+0xfdf26201, 0x244c4e28, 0xfdf16201, 0x244c2928,
+0xfdf16202, 0x244c2828, 0xfdf26202, 0x62d94c28,
+0xe628fff1, 0x7ef162db, 0x62dbe628, 0xc228e5f1,
+0xf9c500d4, 0xfa80d293, 0x057cb80f, 0x850f0000,
+0x0000063c, 0x28fdf262, 0x04245c4c, 0x28fff162,
+0xf162c9e6, 0xdbe628ff, 0x287ef162, 0xf162c9e6,
+0xdbe6287e, 0x28f5f162, 0xc500dbc2, 0x80d393f9,
+0x7eb80ffa, 0x0f000005, 0x00060785, 0xfdf16200,
+0x244c7b28, 0xfef16204, 0x62c9e628, 0xc228f5f1,
+0x00042464, 0xd493f9c5, 0xb80ffa80, 0x00000588,
+0x05e2850f, 0xf1620000, 0x4c7928fc, 0xf1620424,
+0xc97a287e, 0x28f5f162, 0x04246cc2, 0x93f9c500,
+0x0ffa80d5, 0x00058fb8, 0xbd850f00, 0x62000005,
+0x7928fdf1, 0x6204245c, 0x7a28fef1, 0xfdf162db,
+0x244c2828, 0xe5f16204, 0x00f1c228, 0xd693f9c5,
+0xb80ffa80, 0x00000596, 0x0592850f, 0xf1620000,
+0xd95928f5, 0x28fdf162, 0x01245c29, 0x28fdf162,
+0x01245c51, 0x28e5f162, 0xc500f9c2, 0x80d793f9,
+0x9cb80ffa, 0x0f000005, 0x00056785, 0xfdf26200,
+0xa01d1928, 0x6200100c, 0x5e28e5f1, 0xfdf162c9,
+0x244c2928, 0xfdf36201, 0x24640928, 0xf1620b01,
+0x0d2828fd, 0x00100ca0, 0x0005a4b8, 0xf5f16200,
+0x00ccc228, 0xd193f9c5, 0x0f0ffa80, 0x00052785,
+0xfdf36200, 0x244c5628, 0xf1620b04, 0xe45708dd,
+0x28f5f162, 0xc500c4c2, 0x80d093f9, 0xabb80ffa,
+0x0f000005, 0x00050385, 0xe5f16200, 0x244c5828,
+0xe5f16204, 0x62d95e28, 0x2928fdf1, 0x6201245c,
+0x5628fdf3, 0x0b01244c, 0x28fdf162, 0x01247428,
+0x28cdf162, 0xc500d1c2, 0x80d293f9, 0xb1b80ffa,
+0x0f000005, 0x0004c785, 0xfdf26200, 0xc00d1928,
+0x6200100c, 0x5928f5f1, 0x6204244c, 0x2928fdf1,
+0x6201244c, 0x0928fdf3, 0x0b01244c, 0x28fdf362,
+0x01245c56, 0xf5f1620b, 0x62cb5828, 0x2828fdf1,
+0x6201247c, 0xc228c5f1, 0xf9c500d9, 0xfa80d393,
+0x05bbb80f, 0x850f0000, 0x00000478, 0x28edf162,
+0x04245c59, 0x28edf162, 0x05245459, 0x28fdf162,
+0x02245429, 0x28e5f362, 0x02244c50, 0xe5f36205,
+0x245c5028, 0xf1620402, 0x5c2928fd, 0xf1620224,
+0x4c5828f5, 0xf1620224, 0x6c2828fd, 0xf1620424,
+0x4c5928f5, 0xf1620624, 0x545828d5, 0xf1620524,
+0xe2c228f5, 0x93f9c500, 0x0ffa80d4, 0x00063db8,
+0x11850f00, 0x62000004, 0x2828fdf1, 0x62042474,
+0x2828fdf1, 0x62052454, 0x2328cdf3, 0xf16201ce,
+0xc9c628f5, 0xf5f16205, 0x00eac228, 0xd593f9c5,
+0xb80ffa80, 0x0000064e, 0x03de850f, 0xf1620000,
+0x4c2828fd, 0xf3620424, 0xd92328f5, 0xfdf36201,
+0x05db0528, 0x28e5f162, 0xc500f2c2, 0x80d693f9,
+0x53b80ffa, 0x0f000006, 0x0003b385, 0x0c05d900,
+0x6200100c, 0x5828edf1, 0x065db8e1, 0x5cdd0000,
+0xf2621024, 0x5c1928fd, 0xf1620224, 0xfcc228e5,
+0x93f9c500, 0x0ffa80d7, 0x0386850f, 0xf3620000,
+0x4c1928fd, 0x62000124, 0x1a28fdf2, 0x6201245c,
+0x1828f5f3, 0x0101244c, 0x28e5f162, 0xc500c9c2,
+0x3cc193f9, 0xdd0c740f, 0x066cb8d8, 0x53e90000,
+0xc7000003, 0x00012404, 0xc0310000, 0x08f5f162,
+0x4489c9ef, 0xf1620424, 0x0d160874, 0x00100cd8,
+0x08fef162, 0x62241c7e, 0x160864f1, 0x100ce01d,
+0xf5f36200, 0x01cb3828, 0x28fdf162, 0xf262d96f,
+0x5c7728ed, 0x04c70424, 0x00000224, 0x31d23100,
+0x245489c9, 0xfef16204, 0x240c7e08, 0x032404c7,
+0x62000000, 0x160874f1, 0x100ce80d, 0x244c8900,
+0xfef16204, 0x24247e08, 0x085cf162, 0x0cf02516,
+0xf3620010, 0xcc3828f5, 0xedf26201, 0x244c7728,
+0x245cdd04, 0xe5f16210, 0x62c95c28, 0x5928f5f1,
+0x6206244c, 0x1928fdf2, 0x62022454, 0xc228f5f1,
+0xf9c500c2, 0xfa80d093, 0x06a6b80f, 0xf1620000,
+0x4c2928fd, 0x850f0324, 0x0000028a, 0x28fff162,
+0x04245412, 0x28fdf262, 0x0cc80d19, 0xf1620010,
+0x5c2828fd, 0xf1620424, 0x4c5828f5, 0xf1620624,
+0xd35c28ed, 0x38f5f162, 0x0cd00d59, 0xf1620010,
+0xd1c228ed, 0x93f9c500, 0x0ffa80d2, 0x000717b8,
+0x3f850f00, 0x62000002, 0x2928fdf1, 0x6202245c,
+0x1008fff1, 0x6215247c, 0x1008fff1, 0x6217246c,
+0x1108fff1, 0x6209247c, 0x1108fff1, 0xb00b246c,
+0xfdf162aa, 0x24742828, 0x92f9c504, 0xcdf262c8,
+0x244c6529, 0xf5f16205, 0x245cc228, 0xf9c50002,
+0xfa80d393, 0x073ab80f, 0x850f0000, 0x000001e6,
+0x28fdf162, 0x04247c28, 0x8cd0c5c5, 0x0000a024,
+0xfdf16200, 0x24542828, 0xedf16204, 0x245c5c28,
+0xedf16205, 0x245c5829, 0xf5f16205, 0x00e3c228,
+0xd493f9c5, 0xb80ffa80, 0x00000743, 0x01a4850f,
+0xf1620000, 0x542928fd, 0xf1620124, 0xd25708ed,
+0x4c7cedc5, 0xf3622024, 0xc90128fd, 0xfdf162d8,
+0x244c2928, 0x7cedc501, 0x6220244c, 0x0328f5f3,
+0x05d903e9, 0x00100c10, 0x08fff162, 0xdd242c11,
+0xe9df2404, 0x8a0fd8dd, 0x000000ef, 0x00e9850f,
+0xf1620000, 0x742828fd, 0xcdc50424, 0xa0248c7d,
+0x62000000, 0x0128fdf3, 0xf5c5d8c9, 0xf362ca7c,
+0xc90128fd, 0x7cf5c5d8, 0xfdf362ca, 0xd8c90128,
+0x28f5f162, 0xc500eac2, 0x80d593f9, 0x67b80ffa,
+0x0f000007, 0x00010d85, 0xfdf36200, 0x244c2628,
+0xf1620004, 0x4c2928fd, 0xf2620124, 0x4c4228fd,
+0xf1620424, 0x4c2928fd, 0xc9310224, 0xf162d231,
+0xc96e087d, 0x08fdf162, 0x01244cd6, 0x08246cdf,
+0x40d444dd, 0xd8dde9df, 0x6675687a, 0x8d01428d,
+0xc321025a, 0x8301fb83, 0xd08500d1, 0xe8d90e75,
+0x18c444dd, 0xd8dde9df, 0x4d754f7a, 0x7404f883,
+0xebc28904, 0xfdf162b9, 0x247c2828, 0xc5f26201,
+0x244c2c28, 0xfdf16202, 0x246c2828, 0x077db804,
+0xf1620000, 0xf1c228d5, 0x93f9c500, 0x0ffa80d6,
+0x8ee87475, 0xf7fffff4, 0xb86bebd8, 0x0000075e,
+0x73b864eb, 0xeb000007, 0x0778b85d, 0x56eb0000,
+0x52ebd8dd, 0x4eebd8dd, 0x4aebd8dd, 0x46ebd8dd,
+0x42ebd8dd, 0x3eebd8dd, 0x3aebd8dd, 0x36ebd8dd,
+0x32ebd8dd, 0x2eebd8dd, 0x2aebd8dd, 0x26ebd8dd,
+0x22ebd8dd, 0x1eebd8dd, 0x1aebd8dd, 0x16ebd8dd,
+0x12ebd8dd, 0x0eebd8dd, 0x0aebd8dd, 0x06ebd8dd,
+0x02ebd8dd, 0x5d8bd8dd, 0x00c3c9fc, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x40800000, 0x40000000, 0x40400000, 0x40a00000,
+0x41200000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x40200000, 0x00000000, 0x40220000,
+0x00000000, 0x40200000, 0x00000000, 0x40140000,
+0x00000000, 0xc0200000, 0x00000000, 0xc0220000,
+0x00000000, 0xc0200000, 0x00000000, 0xc0140000,
+0x00000000, 0x00000000, 0x00000000, 0x40080000,
+0x00000000, 0x40100000, 0x00000000, 0x40080000,
+0x00000000, 0x80000000, 0x00000000, 0xc0080000,
+0x00000000, 0xc0100000, 0x00000000, 0xc0080000,
+0x00000000, 0x3ff00000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x3fd00000, 0x00000000, 0xbff00000,
+0x00000000, 0x3fe00000, 0x00000004, 0x00000000,
+0x00000005, 0x00000000, 0x00000006, 0x00000000,
+0x00000007, 0x00000000,
+0006370,
+};
+asm(".type avx512dq_x86_32_D_32f8, STT_NOTYPE;");
+asm(".type avx512dq_x86_32_D_32f8, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512dq_x86_32_D_f4[] = {
+0x00020de9, 0xe5895500, 0x6268ec83, 0x10087ef1,
+0x1008300d, 0x7ef16200, 0xea4d1108, 0x087ef162,
+0x62e84d11, 0x11087ef1, 0xf162e94d, 0x4d10087e,
+0x00a7b8e9, 0x45c70000, 0x000000ac, 0x75f26240,
+0xe84d9908, 0x0875f362, 0x620ec921, 0xc20876f1,
+0xc500eb45, 0x66d093f8, 0xb1850f4a, 0x62000001,
+0x10087ef1, 0xabb8e94d, 0xc7000000, 0x0000ac45,
+0xf262c000, 0x4d9f0875, 0x75f362e8, 0x0ec92108,
+0x0876f162, 0x00eb4dc2, 0xd193f8c5, 0x850f4a66,
+0x0000017c, 0x087ef162, 0xb8e94d10, 0x000000af,
+0x00ac45c7, 0x62000000, 0x9b0875f2, 0xf362e84d,
+0xc9210875, 0x76f1620e, 0xeb55c208, 0x93f8c500,
+0x0f4a66d2, 0x00014785, 0x7ef16200, 0xe94d1008,
+0x0000b3b8, 0xac45c700, 0x80000000, 0x0875f262,
+0x62e84d9d, 0x210875f3, 0xf1620ec9, 0x5dc20876,
+0xf8c500eb, 0x4a66d393, 0x0112850f, 0xf1620000,
+0x4d10087e, 0x7ef162e8, 0xe96d1008, 0x0876f162,
+0xf162d558, 0x5d10087e, 0x00bbb8ea, 0xf1620000,
+0x7510087e, 0x7ef162e9, 0xeb551108, 0x084df262,
+0x62e85d99, 0x210865f3, 0xf1620edb, 0x65c20866,
+0xf8c500eb, 0x4a66d493, 0x00c2850f, 0xf1620000,
+0x1d10087e, 0x00100840, 0x0000c0b8, 0x7ef16200,
+0xea651008, 0x087ef162, 0xc5e97d10, 0x62d357e8,
+0x9f0845f2, 0xf162e865, 0x5511087e, 0x5df362eb,
+0x0ed42108, 0x086ef162, 0x00eb6dc2, 0xd593f8c5,
+0x7c754a66, 0x0876f162, 0xf162cd5c, 0x5510087e,
+0x00c5b8ea, 0xf1620000, 0x7510087e, 0x7ef162e9,
+0xeb4d1108, 0x084df262, 0x62e8559b, 0x21086df3,
+0xf1620ed2, 0x75c2086e, 0xf8c500eb, 0x4a66d693,
+0xf0c53e75, 0xcab8cb57, 0x62000000, 0x10087ef1,
+0xf162ea55, 0x7d10087e, 0x7ef162e9, 0xeb4d1108,
+0x0845f262, 0x62e8559d, 0x21086df3, 0xf1620eca,
+0x7dc20876, 0xf8c500eb, 0x4a66d793, 0xc0310275,
+0x8955c3c9, 0xc0e483e5, 0x0100ec81, 0xf1620000,
+0x0d10087e, 0x00100830, 0x087ef162, 0x1c244c11,
+0x087ef162, 0x1d244c11, 0x087ef162, 0x1e244c11,
+0x7024448b, 0x64244489, 0x087ef162, 0x19245410,
+0x000539b8, 0x7ef16200, 0x24541108, 0x7ef16220,
+0x24541008, 0x6ef1621c, 0x2444c208, 0xf8c50020,
+0x4a66d093, 0x05af850f, 0xf1620000, 0x5410087e,
+0xf1621924, 0x5458086e, 0xf1621c24, 0x5411087e,
+0xf1621a24, 0x5410087e, 0x3fb81a24, 0x62000005,
+0x11087ef1, 0x62202454, 0x10087ef1, 0x621c2454,
+0x58086ef1, 0x6df362d2, 0x0ed22108, 0x086ef162,
+0x20244cc2, 0x93f8c500, 0x0f4a66d1, 0x00055885,
+0x7ef16200, 0x24541008, 0x6ef1621a, 0x24545c08,
+0x7ef1621c, 0x24141108, 0x8924048b, 0x009c2484,
+0x44890000, 0x44896824, 0xf1626c24, 0x5410087e,
+0x44b81924, 0x62000005, 0x11087ef1, 0x62202454,
+0x10087ef1, 0x621b2454, 0xc2086ef1, 0x00202454,
+0xd293f8c5, 0x850f4a66, 0x000004fd, 0x087ef162,
+0x19245410, 0x086ef162, 0x1c245459, 0x087ef162,
+0x19245411, 0x087ef162, 0x1d245410, 0x086ef162,
+0xf162d259, 0x5411087e, 0xf1621a24, 0x5410087e,
+0xf1621c24, 0x5458086e, 0xf1621d24, 0x5411087e,
+0xf1621b24, 0x5c10087e, 0x5bb81c24, 0x62000005,
+0x10087ef1, 0x62192464, 0x5c0866f1, 0x621d2454,
+0x5c085ef1, 0x621a2464, 0x59086ef1, 0x621b2454,
+0x11087ef1, 0x62202464, 0x11087ef1, 0x621b2454,
+0x21086df3, 0xf1620ed2, 0x5cc2086e, 0xc5002024,
+0x66d393f8, 0x5e850f4a, 0x62000004, 0x590866f1,
+0x621e245c, 0x11087ef1, 0x6219245c, 0x10087ef1,
+0xb819245c, 0x00000564, 0x087ef162, 0x1c245410,
+0x087ef162, 0x20245c11, 0x086ef162, 0x1e24545e,
+0x087ef162, 0x1a245411, 0x086df362, 0x620ed221,
+0xc2086ef1, 0x00202464, 0xd493f8c5, 0x850f4a66,
+0x00000405, 0x087ef162, 0x08401d10, 0x67b80010,
+0x62000005, 0x10087ef1, 0xc51e2454, 0x62d357e8,
+0x59086ef1, 0x62192454, 0x11087ef1, 0x62202454,
+0x10087ef1, 0xc51c2454, 0x62d357e8, 0x21086df3,
+0xf1620ed2, 0x6cc2086e, 0xc5002024, 0x66d593f8,
+0xb2850f4a, 0xc5000003, 0x24442cfa, 0x24848970,
+0x00000080, 0x942aeac5, 0x00008024, 0x7ef16200,
+0x24541108, 0x7ef16219, 0x24541008, 0x056eb819,
+0xf1620000, 0x5411087e, 0xf1622024, 0x5410087e,
+0xf1621c24, 0x74c2086e, 0xc5002024, 0x66d693f8,
+0x62850f4a, 0x62000003, 0x4d086df2, 0x621c2454,
+0x11087ef1, 0x62192454, 0x4d086df2, 0xc5192454,
+0x89c22cfa, 0x00802484, 0xeac50000, 0x8024942a,
+0xb8000000, 0x00000575, 0x087ef162, 0x20245411,
+0x087ef162, 0x1c245410, 0x086df362, 0x620eda21,
+0xc20866f1, 0x0020247c, 0xd793f8c5, 0x850f4a66,
+0x00000305, 0x086ef162, 0xf162d259, 0x5411087e,
+0xf2621924, 0x544f086d, 0xf1621924, 0x5411087e,
+0xf2621a24, 0x544d086d, 0xfac51a24, 0x8489c22c,
+0x00008024, 0x2aeac500, 0x00802494, 0x7cb80000,
+0x62000005, 0x11087ef1, 0x62202454, 0x10087ef1,
+0x621c2454, 0xc2086ef1, 0x00202444, 0xd093f8c5,
+0x850f4a66, 0x000002a1, 0x442cfac5, 0x84896824,
+0x00008024, 0x2aeac500, 0x00802494, 0xf1620000,
+0x5411087e, 0xf2621f24, 0x544d086d, 0xfac51c24,
+0x8489c22c, 0x00008024, 0x2aeac500, 0x00802494,
+0x7eb80000, 0x62000005, 0x21086df3, 0xf1620ed2,
+0x4cc2086e, 0xc5001f24, 0x66d193f8, 0x46850f4a,
+0x62000002, 0x79087ef1, 0x891c2444, 0x00802484,
+0xf1620000, 0x547b086e, 0xf1622024, 0x5411087e,
+0xf1621924, 0x5410087e, 0x8fb81924, 0x62000005,
+0x11087ef1, 0x62202454, 0x10087ef1, 0x621c2454,
+0x21086df3, 0xf1620eda, 0x54c20866, 0xc5002024,
+0x66d293f8, 0xee850f4a, 0x62000001, 0x59086ef1,
+0x7ef162d2, 0x24541108, 0x6ef16219, 0x24545108,
+0x7ef16219, 0x24541108, 0x059cb820, 0xf1620000,
+0x5410087e, 0xf3621c24, 0xda21086d, 0x66f1620e,
+0x245cc208, 0xf8c50020, 0x4a66d393, 0x01a7850f,
+0xf1620000, 0xd25e0876, 0x087ef162, 0x1a244c11,
+0x087ef162, 0x19245411, 0x087ef162, 0x1a245c10,
+0x0005a4b8, 0x6df36200, 0x24540a08, 0xf1620b19,
+0x5411087e, 0xf3621b24, 0xd221086d, 0x7ef1620e,
+0x245c1108, 0x6ef16220, 0x2464c208, 0xf8c50020,
+0x4a66d493, 0x014f850f, 0xf1620000, 0x5410087e,
+0xf1621e24, 0x5c59086e, 0xf1621c24, 0x5459086e,
+0xf1621d24, 0x5c11087e, 0xf1621924, 0x5411087e,
+0xf1621a24, 0x5410087e, 0xf1621924, 0x545f086e,
+0xf1621a24, 0x5411087e, 0xf1621b24, 0x5410087e,
+0xf1621924, 0x545d086e, 0xf1621a24, 0x5411087e,
+0xf1621a24, 0x5410087e, 0x3db81a24, 0x8b000006,
+0x62702454, 0x58086ef1, 0x621b2454, 0x59086ef1,
+0x891e2454, 0x00f82494, 0xf1620000, 0x5411087e,
+0xf1622024, 0x5410087e, 0xf1623e24, 0x5458086e,
+0xf3621d24, 0xd221086d, 0x6ef1620e, 0x246cc208,
+0xf8c50020, 0x4966cd93, 0x009b850f, 0x54890000,
+0xf3626824, 0x5427086d, 0x62001c24, 0x11087ef1,
+0x62192454, 0x43086df2, 0x621c2454, 0x11087ef1,
+0xc51a2454, 0x62d257e8, 0x2e087cf1, 0x7a1a2454,
+0x625a755c, 0x2e087cf1, 0x7a19244c, 0x62557557,
+0x10087ef1, 0xb81c2454, 0x0000077d, 0x087ef162,
+0x19244c10, 0x0875f262, 0x1a244c2d, 0x087ef162,
+0x20245411, 0x087ef162, 0x1b244c11, 0x0875f362,
+0x620ec921, 0xc20876f1, 0x00202474, 0xd693f8c5,
+0x15754a66, 0xfff7ece8, 0xebd8f7ff, 0x0773b80c,
+0x05eb0000, 0x000778b8, 0x00c3c900, 0x00000000,
+0x3f800000, 0x00000000, 0x00000000, 0x00000000,
+0x80000000, 0x00000000, 0x00000000, 0x00000000,
+0004120,
+};
+asm(".type avx512dq_x86_32_D_f4, STT_NOTYPE;");
+asm(".type avx512dq_x86_32_D_f4, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512dq_x86_32_D_f8[] = {
+0x000230e9, 0xe5895500, 0x00b8ec81, 0xf1620000,
+0x0d1008ff, 0x00100860, 0x08fff162, 0x62eb4d11,
+0x1108fff1, 0xf162e94d, 0x4d1108ff, 0x6485c7ea,
+0x00ffffff, 0x31400000, 0xfff162c0, 0xea4d1008,
+0xff608589, 0xf262ffff, 0x4d9908f5, 0xfef162e9,
+0x62c97e08, 0xc208f7f1, 0xc500ec45, 0x66d093f8,
+0x00a7b84a, 0x850f0000, 0x000001c7, 0xff6485c7,
+0x0000ffff, 0xc931c000, 0x08fff162, 0x89ea4d10,
+0xffff608d, 0xf5f262ff, 0xe94d9f08, 0x08fef162,
+0xf162c97e, 0x4dc208f7, 0xf8c500ec, 0x4a66d193,
+0x0000abb8, 0x88850f00, 0x31000001, 0xfff162d2,
+0xea4d1008, 0x08f5f262, 0x89e94d9b, 0xffff6095,
+0xfef162ff, 0xb8c97e08, 0x000000af, 0xff649589,
+0xf162ffff, 0x55c208f7, 0xf8c500ec, 0x4a66d293,
+0x014d850f, 0x85c70000, 0xffffff64, 0x80000000,
+0xf162c031, 0x4d1008ff, 0x608589ea, 0x62ffffff,
+0x9d08f5f2, 0xf162e94d, 0xc97e08fe, 0x08f7f162,
+0x00ec5dc2, 0xd393f8c5, 0xb3b84a66, 0x0f000000,
+0x00010e85, 0xfff16200, 0xe94d1008, 0x08fff162,
+0x62ea6d10, 0x5808f7f1, 0xfff162d5, 0xeb5d1008,
+0x08fff162, 0x62ea7510, 0x1108fff1, 0xf262ec55,
+0x5d9908cd, 0xfef162e9, 0xb8db7e08, 0x000000bb,
+0x08e7f162, 0x00ec65c2, 0xd493f8c5, 0x850f4a66,
+0x000000bf, 0x08fef162, 0x08701d7e, 0xf1620010,
+0x651008ff, 0x57e9c5eb, 0xfff162d3, 0xea7d1008,
+0x08fff162, 0x62ec5511, 0x9f08c5f2, 0xf162e965,
+0xd47e08fe, 0x0000c0b8, 0xeff16200, 0xec6dc208,
+0x93f8c500, 0x754a66d5, 0xf7f1627a, 0x62cd5c08,
+0x1008fff1, 0xf162eb55, 0x751008ff, 0xfff162ea,
+0xec4d1108, 0x08cdf262, 0x62e9559b, 0x7e08fef1,
+0x00c5b8d2, 0xf1620000, 0x75c208ef, 0xf8c500ec,
+0x4a66d693, 0xf1c53d75, 0xf162cb57, 0x551008ff,
+0xfff162eb, 0xec4d1108, 0x08fff162, 0x62ea7d10,
+0x9d08c5f2, 0xf162e955, 0xca7e08fe, 0x08f7f162,
+0x00ec7dc2, 0xd793f8c5, 0xcab84a66, 0x75000000,
+0xc9c03102, 0xe58955c3, 0x81c0e483, 0x000180ec,
+0xfff16200, 0x600d1008, 0x62001008, 0x1108fff1,
+0x620d244c, 0x1108fff1, 0x620e244c, 0x1108fff1,
+0x620f244c, 0x7e08fef1, 0x620d2454, 0xd608fdf1,
+0x620a2454, 0x1008fff1, 0x620a246c, 0x7e08fef1,
+0x620d2454, 0x1108fff1, 0x6210246c, 0xc208eff1,
+0x00102444, 0xd093f8c5, 0x39b84a66, 0x0f000005,
+0x0005b285, 0xfff16200, 0x24741008, 0xcff1620a,
+0x24545808, 0xfff1620d, 0x24541108, 0xfff1620b,
+0x247c1008, 0xfff1620b, 0x24541008, 0xfff1620d,
+0x247c1108, 0xeff16210, 0x62d25808, 0x7e08fef1,
+0x053fb8d2, 0xf1620000, 0x4cc208ef, 0xc5001024,
+0x66d193f8, 0x5c850f4a, 0x62000005, 0x1008fff1,
+0x620b2464, 0x5c08dff1, 0x620d2454, 0x1108fff1,
+0xf1622414, 0x147e08fe, 0xfdf16224, 0x2454d608,
+0xfdf16217, 0x2454d608, 0xfdf1620b, 0x2454d608,
+0xfff1620c, 0x246c1008, 0xfef1620a, 0x24547e08,
+0xfff1620c, 0x246c1108, 0xeff16210, 0x2454c208,
+0xf8c50010, 0x4a66d293, 0x000544b8, 0xf4850f00,
+0x62000004, 0x1008fff1, 0x620a2474, 0x5908cff1,
+0x620d2454, 0x1108fff1, 0x620a2454, 0x1008fff1,
+0x620e2454, 0x5908eff1, 0xfff162d2, 0x24541108,
+0xfff1620b, 0x247c1008, 0xc7f1620d, 0x24545808,
+0xfff1620e, 0x24541108, 0xfff1620c, 0x245c1008,
+0xfff1620d, 0x24641008, 0xe7f1620a, 0x24545c08,
+0xdff1620e, 0x24645c08, 0xeff1620b, 0x24545908,
+0xfff1620c, 0x24641108, 0xfff16210, 0x24541108,
+0xfef1620c, 0xb8d27e08, 0x0000055b, 0x08eff162,
+0x10245cc2, 0x93f8c500, 0x0f4a66d3, 0x00045685,
+0xe7f16200, 0x245c5908, 0xfff1620f, 0x245c1108,
+0xfff1620a, 0x246c1008, 0xfff1620d, 0x24741008,
+0xd7f1620a, 0x24545e08, 0xfff1620f, 0x24741108,
+0xfff16210, 0x24541108, 0xfef1620b, 0x62d27e08,
+0xc208eff1, 0x00102464, 0xd493f8c5, 0x64b84a66,
+0x0f000005, 0x0003fe85, 0xfef16200, 0x701d7e08,
+0x62001008, 0x1008fff1, 0x620f247c, 0x1008fff1,
+0xc50d2464, 0x62d357c1, 0x5908eff1, 0x620a2454,
+0x1108fff1, 0xc5102454, 0x62d357d9, 0x7e08fef1,
+0x0567b8d2, 0xf1620000, 0x6cc208ef, 0xc5001024,
+0x66d593f8, 0xac850f4a, 0xc5000003, 0x24442cfb,
+0x24848968, 0x00000080, 0x942aebc5, 0x00008024,
+0xfff16200, 0x24541108, 0xfff1620a, 0x246c1008,
+0xfef1620a, 0x24547e08, 0xfff1620d, 0x246c1108,
+0xeff16210, 0x2474c208, 0xf8c50010, 0x4a66d693,
+0x00056eb8, 0x5c850f00, 0x62000003, 0x4d08edf2,
+0x620d2454, 0x1308fdf1, 0x620a2454, 0x4d08edf2,
+0xc50a2454, 0x89c22cfb, 0x00802484, 0xebc50000,
+0x8024942a, 0xb8000000, 0x00000575, 0x08fff162,
+0x10245411, 0x08fff162, 0x0d245410, 0x08fef162,
+0xf162da7e, 0x7cc208e7, 0xc5001024, 0x66d793f8,
+0x00850f4a, 0x62000003, 0x5908eff1, 0xfff162d2,
+0x24541108, 0xedf2620a, 0x24544f08, 0xfdf1620a,
+0x24541308, 0xedf2620b, 0x24544d08, 0x2cfbc50b,
+0x248489c2, 0x00000080, 0x942aebc5, 0x00008024,
+0x057cb800, 0xf1620000, 0x541108ff, 0xf1621024,
+0x547e08fe, 0xf1620d24, 0x44c208ef, 0xc5001024,
+0x66d093f8, 0x9c850f4a, 0xc5000002, 0x24442cfb,
+0x24848958, 0x00000080, 0x942aebc5, 0x00008024,
+0xfff16200, 0x24541108, 0xedf26210, 0x24544d08,
+0x2cfbc50d, 0x244489c2, 0x2aebc54c, 0xb84c2454,
+0x0000057e, 0x08fef162, 0xf162d27e, 0x4cc208ef,
+0xc5001024, 0x66d193f8, 0x48850f4a, 0x62000002,
+0x79087ff1, 0x890d2444, 0x00802484, 0xf1620000,
+0x547b086f, 0xf1622024, 0x541308fd, 0xf1620a24,
+0x741008ff, 0xf1620a24, 0x541008ff, 0xf1620d24,
+0x741108ff, 0xf1621024, 0xda7e08fe, 0x00058fb8,
+0xe7f16200, 0x2454c208, 0xf8c50010, 0x4a66d293,
+0x01f1850f, 0xf1620000, 0xd25908ef, 0x08fff162,
+0x0a245411, 0x08eff162, 0x0a245451, 0x08fdf162,
+0x10245413, 0x08fff162, 0x0d245410, 0x08fef162,
+0xf162da7e, 0x5cc208e7, 0xc5001024, 0x66d393f8,
+0x059cb84a, 0x850f0000, 0x000001ab, 0x08f7f162,
+0xf162d25e, 0x4c1108ff, 0xf1620b24, 0x541108ff,
+0xf3620a24, 0x540b08ed, 0x620b0a24, 0x1008fff1,
+0x620b247c, 0x1108fff1, 0x620c2454, 0x1108fff1,
+0x6210247c, 0x7e08fef1, 0x05a4b8d2, 0xf1620000,
+0x64c208ef, 0xc5001024, 0x66d493f8, 0x54850f4a,
+0x62000001, 0x1008fff1, 0x620f2454, 0x5908eff1,
+0x620d245c, 0x5908eff1, 0x620e2454, 0x1108fff1,
+0x620a245c, 0x1108fff1, 0x620b2454, 0x1008fff1,
+0x620a2464, 0x5f08dff1, 0x620b2454, 0x1108fff1,
+0x620c2454, 0x1008fff1, 0x620a246c, 0x5d08d7f1,
+0x620b2454, 0x1108fff1, 0x620b2454, 0x1008fff1,
+0x620b2474, 0x7e08fef1, 0x620d245c, 0x5808cff1,
+0x620c2454, 0xd608fdf1, 0x622e245c, 0x5908eff1,
+0x620f2454, 0x1008fff1, 0x622e247c, 0x1108fff1,
+0x62102454, 0x5808c7f1, 0x620e2454, 0x7e08fef1,
+0xeff162d2, 0x246cc208, 0xf8c50010, 0x4a66d593,
+0x00063db8, 0x9c850f00, 0x62000000, 0xd608fdf1,
+0x620b245c, 0x2708edf3, 0x000d2454, 0x08fdf162,
+0x0a245413, 0x08edf262, 0x0d245443, 0x08fdf162,
+0x0b245413, 0xd257e9c5, 0x08fdf162, 0x0b24542e,
+0x5775597a, 0x08fdf162, 0x0a244c2e, 0x5275547a,
+0x08fef162, 0x0a244c7e, 0x08fff162, 0x0d246410,
+0x00077db8, 0xf5f26200, 0x244c2d08, 0xfff1620b,
+0x24641108, 0xfff16210, 0x244c1108, 0x14f1c50c,
+0xf7f162ca, 0x2474c208, 0xf8c50010, 0x4a66d693,
+0xbee81575, 0xf7fffff7, 0xb80cebd8, 0x00000773,
+0x78b805eb, 0xc9000007, 0x000000c3, 0x00000000,
+0x00000000, 0x3ff00000, 0x00000000, 0x00000000,
+0x00000000, 0x80000000, 0x00000000, 0x00000000,
+0004200,
+};
+asm(".type avx512dq_x86_32_D_f8, STT_NOTYPE;");
+asm(".type avx512dq_x86_32_D_f8, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512dq_x86_64_D_64i4[] = {
+0xb85500eb, 0x00000001, 0xbfc03145, 0x00000020,
+0x0011bb41, 0x89480000, 0xe48348e5, 0xec8148c0,
+0x00000248, 0xc42444c7, 0x00000020, 0x45ff488d,
+0x8941da89, 0x41ca89c1, 0xe283c229, 0x01fa8301,
+0xe683f619, 0x85ceff02, 0xff0575c1, 0x01b041cf,
+0xd104e2c1, 0x8c8944e9, 0x0000c484, 0x44ca0900,
+0x04849489, 0x89000001, 0x01c48494, 0xc2830000,
+0x84b48908, 0x00000144, 0x8484bc89, 0x89000001,
+0x02048494, 0xff480000, 0xf88348c0, 0x459d7511,
+0x0474c084, 0xc4247c89, 0x487df162, 0xc824b46f,
+0x62000000, 0x7f487df1, 0x000824b4, 0xf1620000,
+0x8c6f487d, 0x00000824, 0x0539b800, 0xf3620000,
+0xd61f4875, 0x93f8c500, 0xc2ff66d2, 0x0875850f,
+0xf1620000, 0x94fe4875, 0x0000c824, 0x7df16200,
+0x24947f48, 0x00000048, 0x487df162, 0x4824946f,
+0xb8000000, 0x0000053f, 0x4865f162, 0xc824b472,
+0x01000000, 0x486df362, 0xc500db1f, 0x66d393f8,
+0x850fc2ff, 0x0000082f, 0x486df162, 0xc82494fa,
+0x62000000, 0x7f487df1, 0x00882494, 0xf3620000,
+0xa41f4875, 0x00008824, 0x44b80000, 0xc5000005,
+0x66d493f8, 0x850fc2ff, 0x000007fb, 0x487df162,
+0x0824bc6f, 0x62000001, 0x404875f2, 0x00c8248c,
+0xf2620000, 0xd7404845, 0x487df162, 0x4824947f,
+0x62000000, 0x6f487df1, 0x00c824ac, 0xf1620000,
+0xe7fe4855, 0x4855f162, 0x08249cfa, 0x62000001,
+0xfa4875f1, 0x055bb8ca, 0xf2620000, 0xdc404865,
+0x4875f362, 0x6200eb1f, 0x7f487df1, 0x0088249c,
+0xf8c50000, 0xff66d593, 0x88850fc2, 0x62000007,
+0x404855f2, 0x0108248c, 0xf1620000, 0x8c7f487d,
+0x00000824, 0x2444c700, 0x00001048, 0x448d4800,
+0x0eba4824, 0xc7000000, 0x00842484, 0x00100000,
+0x89480000, 0xc68948c7, 0x8348088b, 0x834804ef,
+0xd10104c0, 0x4f890889, 0x02ea833c, 0x4c89ea75,
+0xf1626824, 0xb46f487d, 0x00000824, 0x05c8b800,
+0x44c70000, 0x0002c424, 0xf1620000, 0xb476484d,
+0x00004824, 0x93f8c500, 0xc2ff66d6, 0x0705850f,
+0xf1620000, 0x8cef4855, 0x00014824, 0x7df16200,
+0x248c7f48, 0x00000008, 0x48f5f262, 0x08248c28,
+0x62000001, 0x7f48fdf1, 0x0048248c, 0xc0310000,
+0x04546348, 0x8c634808, 0x00010804, 0xaf0f4800,
+0x049489d1, 0x00000088, 0x20eac148, 0x8c049489,
+0x48000000, 0x4808c083, 0x7540f883, 0x7df162d3,
+0x24bc6f48, 0x00000048, 0x0005e1b8, 0x45f16200,
+0x24bc7648, 0x00000088, 0xd793f8c5, 0x0fc2ff66,
+0x00068285, 0x55f26200, 0x24944048, 0x00000148,
+0x487df162, 0x8824947f, 0x62000000, 0x724875f1,
+0x008824b4, 0x62030000, 0x7f487df1, 0x0008248c,
+0xf1620000, 0xb4724865, 0x00008824, 0xf1620200,
+0xe3fe4865, 0x0005edb8, 0x75f36200, 0x00c41f48,
+0xd093f8c5, 0x0fc2ff66, 0x00062a85, 0x75f16200,
+0x24a47248, 0x00000008, 0x75f16202, 0xb8c9fe48,
+0x000005f2, 0x4865f362, 0xc500d11f, 0x66d293f8,
+0x850fc2ff, 0x000005ff, 0xc42444c7, 0x00000003,
+0x24446348, 0xfdf162c4, 0x62c86e08, 0xf2486df1,
+0x2444c7c9, 0x000002c4, 0x44634800, 0xf162c424,
+0xf06e08fd, 0x486df162, 0xf162d6f2, 0xdafe486d,
+0x000605b8, 0x75f36200, 0x00db1f48, 0xd393f8c5,
+0x0fc2ff66, 0x0005ae85, 0x44634800, 0xf162c424,
+0xf86e08fd, 0x4875f162, 0xf162cfe2, 0xc9fe4875,
+0x000609b8, 0x6df36200, 0x00e11f48, 0xd493f8c5,
+0x0fc2ff66, 0x00057e85, 0x7df16200, 0x24b46f48,
+0x00000188, 0xc9eff1c5, 0x484df362, 0x6206c91f,
+0x40c955f2, 0x01482494, 0xf2620000, 0x9c47486d,
+0x00018824, 0x7df16200, 0x24bc6f48, 0x00000188,
+0x000001b8, 0x7df26200, 0x62c87c48, 0xfa4845f1,
+0x7df162c9, 0x248c7f48, 0x00000188, 0x486df262,
+0x88248c47, 0xb8000001, 0x00000621, 0x4875f162,
+0xf362e1fe, 0xec1f4865, 0x93f8c500, 0xc2ff66d5,
+0x0501850f, 0xf2620000, 0x8c464875, 0x00018824,
+0x0626b800, 0xf3620000, 0xf21f4875, 0x93f8c500,
+0xc2ff66d6, 0x04dd850f, 0xf1620000, 0xa46f487d,
+0x00014824, 0x5df26200, 0x248c4048, 0x00000108,
+0x485df262, 0xc8249440, 0x62000000, 0x7f487df1,
+0x0048248c, 0xf2620000, 0x8c3d486d, 0x00004824,
+0x6df26200, 0x24943948, 0x00000048, 0x487df162,
+0x4824947f, 0x62000000, 0xfe4875f1, 0x0048248c,
+0x3db80000, 0x62000006, 0xfe4855f1, 0x01082494,
+0xf2620000, 0xcc404875, 0x4875f362, 0xc500fa1f,
+0x66d793f8, 0x850fc2ff, 0x0000045b, 0x4855f262,
+0xf162cc40, 0x8c7f487d, 0x00000824, 0x7df26200,
+0x248c1e48, 0x00000008, 0x4875f362, 0xb800c51f,
+0x00000644, 0xd093f8c5, 0x0fc2ff66, 0x00042685,
+0x7df16200, 0x24b46f48, 0x000000c8, 0x00064eb8,
+0x7df16200, 0x249c6f48, 0x00000108, 0x484df362,
+0x621bce43, 0x70487df1, 0xf3621bc9, 0xd31f4875,
+0x93f8c500, 0xc2ff66d2, 0x03e9850f, 0xf1620000,
+0x8c6f487d, 0x0000c824, 0x0001b800, 0xf2620000,
+0xd07c487d, 0x000653b8, 0x65f16200, 0x62d2fa48,
+0x36486df2, 0x6df362d1, 0x00db1f48, 0xd393f8c5,
+0x0fc2ff66, 0x0003ae85, 0x65f16200, 0xc7d1fe48,
+0x11e82444, 0xb8000000, 0x0000065d, 0x487df262,
+0xfa246c58, 0x4855f362, 0xc500e21f, 0x66d493f8,
+0x850fc2ff, 0x0000037f, 0x000011b8, 0x7df26200,
+0x62e87c48, 0x1f4855f3, 0x61b800ea, 0xc5000006,
+0x66d593f8, 0x850fc2ff, 0x0000035b, 0x487df362,
+0xe8248c3b, 0x00ffffff, 0x487df262, 0xe824945b,
+0x62ffffff, 0x3a4875f3, 0xffe824ac, 0x6201ffff,
+0x1f486df3, 0xf8c500f5, 0xff66c693, 0x066cb8c0,
+0x850f0000, 0x0000031f, 0x487df362, 0xe8248c39,
+0x00ffffff, 0x487df262, 0xe824ac5a, 0x62ffffff,
+0x384875f3, 0xffe82494, 0x6201ffff, 0x38486df3,
+0xffe82494, 0x6202ffff, 0x38486df3, 0xffe82494,
+0x6203ffff, 0x1f4855f3, 0xf8c500fa, 0xff66c793,
+0x067cb8c0, 0x850f0000, 0x000002cb, 0x087df162,
+0x3224546e, 0x086df362, 0x33245422, 0x7ff9c501,
+0x62e82454, 0x59487df2, 0xc5fd2454, 0x246c70f9,
+0x0cb844e8, 0xc5000000, 0x62c892f8, 0x384975f3,
+0x30b800cd, 0xc5000000, 0x62c892f8, 0x384975f3,
+0xffe8248c, 0xc501ffff, 0x246c70f9, 0xc0b844e8,
+0xc5000000, 0x62c892f8, 0x384975f3, 0x00b801cd,
+0xc5000003, 0x62c892f8, 0x384975f3, 0xffe8248c,
+0xc502ffff, 0x246c70f9, 0x00b844e8, 0xc500000c,
+0x62c892f8, 0x384975f3, 0x00b802cd, 0xc5000030,
+0x62c892f8, 0x384975f3, 0xffe8248c, 0xc503ffff,
+0x246c70f9, 0x00b844e8, 0xc5ffffc0, 0x62c892f8,
+0x384975f3, 0xf36203cd, 0xc11f486d, 0x93f8c500,
+0xc0ff66c0, 0x000696b8, 0xf8850f00, 0x62000001,
+0x6f487df1, 0x01c8248c, 0xf1620000, 0xd36f487d,
+0x4875f262, 0xc824947e, 0x62000000, 0x6f487df1,
+0x020824bc, 0xf2620000, 0x9c7e4845, 0x0000c824,
+0x6df16200, 0xc7d3fa48, 0x08e82444, 0xb8000000,
+0x000006a6, 0x486df262, 0xf262d440, 0x5c58487d,
+0xf362fa24, 0xd31f486d, 0x93f8c500, 0xc2ff66d2,
+0x0191850f, 0xe1c50000, 0xf262dbef, 0x9440485d,
+0x0000c824, 0x7df16200, 0x24947f48, 0x00000008,
+0x485df362, 0x6201c31f, 0x38487ef2, 0x6df262d8,
+0x62cb7648, 0x7f487df1, 0x0048248c, 0xf1620000,
+0xb46f487d, 0x00000824, 0x7df36200, 0x24b43b48,
+0xffffffe8, 0x7df26200, 0x24942548, 0xffffffe8,
+0x48fdf162, 0x8824947f, 0x62000000, 0x1f486df3,
+0xb3b800d9, 0xc5000006, 0x66d393f8, 0x850fc2ff,
+0x00000113, 0x487df162, 0xc8248c6f, 0x62000000,
+0x3b487df3, 0xffe8248c, 0xc500ffff, 0x247c6ffd,
+0x7ffdc5e8, 0x62c8247c, 0x25487df2, 0xffc82494,
+0xf162ffff, 0x947f48fd, 0x00000824, 0xfdf16200,
+0x24b46f48, 0x00000008, 0x487ef262, 0xe824b435,
+0x31ffffff, 0x04bc8bc0, 0x000000c8, 0xe8047c39,
+0xf1b80a74, 0xe9000006, 0x000000ab, 0x04c08348,
+0x20f88348, 0xf162df75, 0x8c7f487d, 0x00004824,
+0x0004b800, 0x948b0000, 0x00010804, 0x06148900,
+0x08c08348, 0x44f88348, 0xf162ec75, 0x8c6f487d,
+0x0000c824, 0xaaaab800, 0xf8c5ffff, 0x3ab8c892,
+0x62000007, 0x644975f2, 0x01082494, 0xf3620000,
+0xa41f486d, 0x00004824, 0xf8c50000, 0xff66d493,
+0x624475c2, 0x034875f3, 0x0fb801d9, 0xba000000,
+0x00000000, 0x487df262, 0x01b8d07c, 0x62000000,
+0xdb4875f1, 0x7df262ca, 0x62d07c48, 0xfe4875f1,
+0x65f362ca, 0x00e91f48, 0xc593f8c5, 0xb8c0ff66,
+0x0000074a, 0xc9c2440f, 0x000000c3,
+0004511,
+};
+asm(".type avx512dq_x86_64_D_64i4, STT_NOTYPE;");
+asm(".type avx512dq_x86_64_D_64i4, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512dq_x86_64_D_64u4[] = {
+0x315500eb, 0xb9ff31c0, 0x00000020, 0x0010bb41,
+0x89480000, 0xe48348e5, 0xec8148c0, 0x00000248,
+0xc42444c7, 0x00000020, 0x8945c289, 0x408d44da,
+0x83c68901, 0x294101e2, 0x4a8d44c2, 0xc08541ff,
+0xc9ff0575, 0xc101b740, 0xeed104e2, 0x84848944,
+0x000000c8, 0x8944f209, 0x01088494, 0x94890000,
+0x0001c884, 0x08c28300, 0x848c8944, 0x00000148,
+0x88848c89, 0x89000001, 0x02088494, 0xff480000,
+0xf88348c0, 0x40a17510, 0x0474ff84, 0xc4244c89,
+0x487df162, 0xc824bc6f, 0x62000000, 0x7f487df1,
+0x000824bc, 0xf1620000, 0x946f487d, 0x00000824,
+0x0539b800, 0xf3620000, 0xc71f486d, 0x93f8c500,
+0xc2ff66d0, 0x07e3850f, 0xf1620000, 0x8cfe486d,
+0x0000c824, 0x7df16200, 0x248c7f48, 0x00000048,
+0x487df162, 0x48248c6f, 0xb8000000, 0x0000053f,
+0x4865f162, 0xc824b472, 0x01000000, 0x4875f362,
+0xc500d31f, 0x66d293f8, 0x850fc2ff, 0x0000079d,
+0x4875f162, 0xc8248cfa, 0x62000000, 0x7f487df1,
+0x0088248c, 0xf1620000, 0x9c6f487d, 0x00008824,
+0x0544b800, 0xf3620000, 0xdb1f486d, 0x93f8c500,
+0xc2ff66d3, 0x0763850f, 0xf1620000, 0x94eb486d,
+0x00010824, 0x7df16200, 0x24947f48, 0x00000008,
+0x4875f162, 0x08248cdb, 0x62000001, 0x7f487df1,
+0x0048248c, 0xf1620000, 0x94ef4865, 0x00010824,
+0x7df16200, 0x24947f48, 0x00000088, 0x4875f162,
+0x08248cdf, 0xb8000000, 0x00000550, 0x4875f362,
+0xc500e21f, 0x66d493f8, 0x850fc2ff, 0x000006fd,
+0x487df162, 0xc824946f, 0x62000000, 0x40486df2,
+0x0108248c, 0xf1620000, 0x8c7f487d, 0x00000824,
+0x2444c700, 0x00001048, 0x448d4800, 0x0eba4824,
+0xc7000000, 0x00842484, 0x00100000, 0x89480000,
+0xc78948c6, 0x8348088b, 0x834804ee, 0xd10104c0,
+0x4e890889, 0x02ea833c, 0x4c89ea75, 0xf1626824,
+0xb46f487d, 0x00000824, 0x05c8b800, 0x44c70000,
+0x0002c424, 0xf1620000, 0xac76484d, 0x00004824,
+0x93f8c500, 0xc2ff66d5, 0x066f850f, 0xf1620000,
+0x8cef486d, 0x00014824, 0x7df16200, 0x248c7f48,
+0x00000008, 0x48f5f162, 0x08248cf4, 0x62000001,
+0x7f48fdf1, 0x0048248c, 0xc0310000, 0x0804548b,
+0x08048c8b, 0x48000001, 0x89d1af0f, 0x00880494,
+0xc1480000, 0x948920ea, 0x00008c04, 0xc0834800,
+0xf8834808, 0x62d57540, 0x6f487df1, 0x004824bc,
+0xe1b80000, 0x62000005, 0x764845f1, 0x008824b4,
+0xf8c50000, 0xff66d693, 0xee850fc2, 0x62000005,
+0x7f487df1, 0x00882494, 0xf1620000, 0xb4724875,
+0x00008824, 0xf1620300, 0x8c7f487d, 0x00000824,
+0x65f16200, 0x24b47248, 0x00000088, 0x65f16202,
+0xb8e3fe48, 0x000005ed, 0x4875f362, 0xc500fc1f,
+0x66d793f8, 0x850fc2ff, 0x000005a1, 0x4875f162,
+0x08249472, 0x02000000, 0x4875f162, 0xf2b8c9fe,
+0x62000005, 0x1f4865f3, 0xf8c500c1, 0xff66d093,
+0x76850fc2, 0xc7000005, 0x03c42444, 0x62000000,
+0x6e087df1, 0x62f1244c, 0xf2486df1, 0x2444c7c9,
+0x000002c4, 0x7df16200, 0x245c6e08, 0x6df162f1,
+0x62dbf248, 0xfe4865f1, 0x0605b8e3, 0xf3620000,
+0xd41f4875, 0x93f8c500, 0xc2ff66d2, 0x052b850f,
+0xf1620000, 0x646e087d, 0xf162f124, 0xccd24875,
+0x4875f162, 0x09b8c9fe, 0x62000006, 0x1f4865f3,
+0xf8c500d9, 0xff66d393, 0xfe850fc2, 0xc5000004,
+0x62c9eff1, 0x254855f3, 0xf162ffed, 0xb46f487d,
+0x00018824, 0x4df36200, 0x04c91f48, 0x4975f262,
+0xf162e564, 0xe2db485d, 0x485df262, 0x88248c47,
+0x62000001, 0xfe4855f1, 0x0188249c, 0xf1620000,
+0x9c7f487d, 0x00018824, 0x5df26200, 0x249c4748,
+0x00000188, 0x000621b8, 0x65f16200, 0x62f3fe48,
+0x1f4875f3, 0xf8c500e6, 0xff66d493, 0x8a850fc2,
+0x62000004, 0x454865f2, 0x0188249c, 0x26b80000,
+0x62000006, 0x1f4865f3, 0xf8c500ec, 0xff66d593,
+0x66850fc2, 0x62000004, 0x3b486df2, 0x0108249c,
+0xf2620000, 0x8c3f486d, 0x00010824, 0x6df16200,
+0x2494fe48, 0x00000108, 0x4865f162, 0x34b8d9fe,
+0x62000006, 0x1f4865f3, 0xf8c500f2, 0xff66d693,
+0x26850fc2, 0x62000004, 0x6f487df1, 0x00c824bc,
+0x4eb80000, 0x62000006, 0x6f487df1, 0x01082494,
+0xf3620000, 0xdf434845, 0x7df1621b, 0x1bdb7048,
+0x4865f362, 0xc500fa1f, 0x66d793f8, 0x850fc2ff,
+0x000003e9, 0x487df162, 0xc8248c6f, 0x62000000,
+0xfe486df1, 0x0653b8dd, 0xf2620000, 0xd9364865,
+0x4865f362, 0xc500c21f, 0x66d093f8, 0x850fc2ff,
+0x000003b9, 0x486df162, 0x44c7d9fe, 0x0011e824,
+0x5db80000, 0x62000006, 0x58487df2, 0x62fa2464,
+0x1f485df3, 0xf8c500d3, 0xff66d293, 0x8a850fc2,
+0xb8000003, 0x00000011, 0x487df262, 0xf362e07c,
+0xdb1f485d, 0x0661b800, 0xf8c50000, 0xff66d393,
+0x66850fc2, 0x62000003, 0x3b487df3, 0xffe8248c,
+0x6200ffff, 0x5b487df2, 0xffe8249c, 0xf362ffff,
+0xa43a4875, 0xffffe824, 0xf36201ff, 0xe41f4865,
+0x93f8c500, 0xc0ff66c4, 0x00066cb8, 0x2a850f00,
+0x62000003, 0x39487df3, 0xffe8248c, 0x6200ffff,
+0x5a487df2, 0xffe824a4, 0xf362ffff, 0x9c384875,
+0xffffe824, 0xf36201ff, 0x9c384865, 0xffffe824,
+0xf36202ff, 0x9c384865, 0xffffe824, 0xf36203ff,
+0xeb1f485d, 0x93f8c500, 0xc0ff66c5, 0x00067cb8,
+0xd6850f00, 0x62000002, 0x6e087df1, 0x6232245c,
+0x220865f3, 0x0133245c, 0x5c7ff9c5, 0xf262e824,
+0x5c59487d, 0xf9c5fd24, 0xe8246470, 0x000cb844,
+0xf8c50000, 0xf362c892, 0xcc384975, 0x0030b800,
+0xf8c50000, 0xf362c892, 0x8c384975, 0xffffe824,
+0xf9c501ff, 0xe8246470, 0x00c0b844, 0xf8c50000,
+0xf362c892, 0xcc384975, 0x0300b801, 0xf8c50000,
+0xf362c892, 0x8c384975, 0xffffe824, 0xf9c502ff,
+0xe8246470, 0x0c00b844, 0xf8c50000, 0xf362c892,
+0xcc384975, 0x3000b802, 0xf8c50000, 0xf362c892,
+0x8c384975, 0xffffe824, 0xf9c503ff, 0xe8246470,
+0xc000b844, 0xf8c5ffff, 0xf362c892, 0xcc384975,
+0x65f36203, 0x00f11f48, 0xc693f8c5, 0xb8c0ff66,
+0x00000696, 0x0203850f, 0xf1620000, 0x9c6f487d,
+0x0001c824, 0x7df16200, 0x62e26f48, 0x7e4865f2,
+0x00c824a4, 0xf1620000, 0xb46f487d, 0x00020824,
+0x4df26200, 0x24947e48, 0x000000c8, 0x4855f162,
+0x44c7cafe, 0x0008e824, 0xa6b80000, 0x62000006,
+0x25486df3, 0x01482494, 0x62550000, 0xfa4875f1,
+0x75f162cc, 0x248cef48, 0x00000148, 0x4875f162,
+0xf262cafa, 0x5458487d, 0xf362fa24, 0xfa1f4875,
+0x93f8c500, 0xc2ff66d7, 0x017f850f, 0xf1620000,
+0x8c6f487d, 0x0000c824, 0xefe9c500, 0x65f262d2,
+0x62ca7e48, 0x764875f2, 0x7df162da, 0x248c7f48,
+0x00000048, 0x487df162, 0x88249c7f, 0x62000000,
+0x6f487df1, 0x00c824ac, 0xf3620000, 0xac3b487d,
+0xffffe824, 0xf26200ff, 0x9435487d, 0xffffe824,
+0x6df362ff, 0x00c11f48, 0x0006d3b8, 0x93f8c500,
+0xc2ff66d0, 0x0113850f, 0xf1620000, 0x8c6f487d,
+0x0000c824, 0x7df36200, 0x248c3b48, 0xffffffe8,
+0x6ffdc500, 0xc5e8247c, 0x247c7ffd, 0x7df262c8,
+0x24943548, 0xffffffc8, 0x48fdf162, 0x0824947f,
+0x62000000, 0x6f48fdf1, 0x000824ac, 0xf2620000,
+0xac35487e, 0xffffe824, 0x8bc031ff, 0x00c804b4,
+0x74390000, 0x0a74e804, 0x0006f1b8, 0x00abe900,
+0x83480000, 0x834804c0, 0xdf7520f8, 0x487df162,
+0x48248c7f, 0xb8000000, 0x00000004, 0x0804948b,
+0x89000001, 0x83480714, 0x834808c0, 0xec7544f8,
+0x487df162, 0xc8248c6f, 0xb8000000, 0xffffaaaa,
+0xc892f8c5, 0x00073ab8, 0x75f26200, 0x24946449,
+0x00000108, 0x486df362, 0x4824941f, 0x00000000,
+0xd293f8c5, 0x75c2ff66, 0x75f36244, 0x01d90348,
+0x00000fb8, 0x0000ba00, 0xf2620000, 0xd07c487d,
+0x000001b8, 0x75f16200, 0x62cadb48, 0x7c487df2,
+0x75f162d0, 0x62cafe48, 0x1f4865f3, 0xf8c500d9,
+0xff66c393, 0x074ab8c0, 0x440f0000, 0x00c3c9c2,
+0004257,
+};
+asm(".type avx512dq_x86_64_D_64u4, STT_NOTYPE;");
+asm(".type avx512dq_x86_64_D_64u4, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512dq_x86_64_D_64i8[] = {
+0xb85500eb, 0x00000001, 0x000040bf, 0x09ba4100,
+0x48000000, 0x8348e589, 0x8148c0e4, 0x000208ec,
+0xff488d00, 0x48d0894d, 0x80c48489, 0x89000000,
+0xc02949ca, 0x4c01e283, 0xc0c48489, 0x83000000,
+0x194801fa, 0xc93145f6, 0x4802e683, 0xc185ceff,
+0xc1940f41, 0x4803e2c1, 0x00c4b489, 0xd1000001,
+0xcf2944e9, 0xfe89ca09, 0xc4948948, 0x00000180,
+0x04c28348, 0xc4b48948, 0x00000140, 0xc4948948,
+0x000001c0, 0x48c0ff48, 0x7509f883, 0xfdf16294,
+0x24bc6f48, 0x00000088, 0x48fdf162, 0xc824bc7f,
+0x62ffffff, 0x6f48fdf1, 0xffc8248c, 0x39b8ffff,
+0x62000005, 0x1f48f5f3, 0xf9c500c7, 0xc2fed093,
+0x05ff850f, 0xf1620000, 0x94d448f5, 0x00008824,
+0xfdf16200, 0x24947f48, 0x00000008, 0x48fdf162,
+0x0824946f, 0xb8000000, 0x0000053f, 0x48e5f162,
+0x8824b473, 0x01000000, 0x48edf362, 0xc500d31f,
+0xfed293f9, 0xba850fc2, 0x62000005, 0xfb48edf1,
+0x00882494, 0xf1620000, 0x947f48fd, 0x00004824,
+0xf5f36200, 0x249c1f48, 0x00000048, 0x0544b800,
+0xf9c50000, 0xc2fed393, 0x0587850f, 0xf1620000,
+0xb46f48fd, 0x0000c824, 0xf5f26200, 0x248c4048,
+0x00000088, 0x48cdf262, 0xf162d640, 0xac6f48fd,
+0x00008824, 0xd5f16200, 0x62e6d448, 0xfb48d5f1,
+0x00c8249c, 0xf1620000, 0xcafb48f5, 0x00055bb8,
+0xe5f26200, 0x62dc4048, 0x1f48f5f3, 0xf9c500e3,
+0xc2fed493, 0x052b850f, 0xf2620000, 0x8c4048d5,
+0x0000c824, 0xf5f36200, 0x502d1f48, 0x00000005,
+0x0005c8b8, 0x93f9c500, 0x0fc2fed5, 0x00050485,
+0xfdf16200, 0x249c6f48, 0x00000108, 0x48d5f262,
+0xf162d340, 0x947f48fd, 0x00004824, 0xf5f16200,
+0x24b47348, 0x00000048, 0xfdf16203, 0x248c7f48,
+0xffffffc8, 0x48ddf162, 0x4824b473, 0x02000000,
+0x48ddf162, 0xedb8f4d4, 0x62000005, 0x1f48f5f3,
+0xf9c500f6, 0xc2fed693, 0x04a7850f, 0xf1620000,
+0xa47248f5, 0xffffc824, 0xf16202ff, 0xc9d448f5,
+0x0005f2b8, 0xddf36200, 0x00f91f48, 0xd793f9c5,
+0x850fc2fe, 0x0000047d, 0xa42444c7, 0x00000003,
+0x24446348, 0xfdf162a4, 0x62c86e08, 0xf348edf1,
+0x2444c7c9, 0x000002a4, 0x44634800, 0xf162a424,
+0xf86e08fd, 0x48edf162, 0xf162d7f3, 0xe2d448ed,
+0x000605b8, 0xf5f36200, 0x00c41f48, 0xd093f9c5,
+0x850fc2fe, 0x0000042d, 0x24446348, 0xfdf162a4,
+0x62f06e08, 0xe248f5f1, 0xf5f162ce, 0xb8c9d448,
+0x00000609, 0x48edf362, 0xc500d11f, 0xfed293f9,
+0xfe850fc2, 0x62000003, 0x6f48fdf1, 0x014824bc,
+0xf1c50000, 0xf362c9ef, 0xc91f48c5, 0xd5f26206,
+0x62cb40c9, 0x7f48fdf1, 0x0048248c, 0xf2620000,
+0xa44748f5, 0x00014824, 0xfdf16200, 0x24b46f48,
+0x00000148, 0x000001b8, 0xfdf26200, 0x62d07c48,
+0xfb48cdf1, 0xfdf162d2, 0x24947f48, 0x00000148,
+0x48f5f262, 0x48248c47, 0xb8000001, 0x00000621,
+0x48fdf162, 0x08248c7f, 0x62000000, 0xd448f5f1,
+0xddf362c9, 0x00d91f48, 0xd393f9c5, 0x850fc2fe,
+0x00000371, 0x48fdf162, 0x0824bc6f, 0xb8000000,
+0x00000626, 0x48c5f262, 0x48248c46, 0x62000001,
+0x1f48f5f3, 0x004824a4, 0xc5000000, 0xfed493f9,
+0x3e850fc2, 0x62000003, 0x6f48fdf1, 0x00c82494,
+0xf2620000, 0xe34048d5, 0x48edf262, 0xf162cb40,
+0xa47f48fd, 0xffffc824, 0xfdf162ff, 0x248c7f48,
+0x00000008, 0x48ddf262, 0x08248c3d, 0x62000000,
+0x3948ddf2, 0x000824a4, 0xf1620000, 0xa47f48fd,
+0x00000824, 0xf5f16200, 0x248cd448, 0x00000008,
+0x48d5f162, 0x3db8e2d4, 0x62000006, 0x4048f5f2,
+0xf5f362cb, 0x00ec1f48, 0xd593f9c5, 0x850fc2fe,
+0x000002c1, 0x48fdf262, 0xc8248c1f, 0x62ffffff,
+0x1f48f5f3, 0x44b800f5, 0xc5000006, 0xfed693f9,
+0x9e850fc2, 0x62000002, 0x6f48fdf1, 0x008824b4,
+0x4eb80000, 0x62000006, 0x4348cdf3, 0xf1621bce,
+0xc970487d, 0xf5f3624e, 0x00fa1f48, 0xd793f9c5,
+0x850fc2fe, 0x0000026d, 0x000001b8, 0xfdf26200,
+0xb8c87c48, 0x00000653, 0x48edf162, 0xf262c9fb,
+0x8c3648f5, 0x00008824, 0xf5f36200, 0x00c21f48,
+0xd093f9c5, 0x850fc2fe, 0x00000239, 0x48fdf362,
+0x88248c00, 0x1b000000, 0x000658b8, 0xf5f36200,
+0x4ec94348, 0x48f5f362, 0xc500ca1f, 0xfed193f9,
+0x0e850fc2, 0x62000002, 0x6f48fdf1, 0x0088248c,
+0x5db80000, 0x48000006, 0xa82444c7, 0x00000009,
+0x48fdf262, 0xf5246c59, 0x48f5f162, 0xf362e2d4,
+0xd41f48d5, 0x93f9c500, 0x0fc2fed2, 0x0001d485,
+0x0009b800, 0xf2620000, 0xe87c48fd, 0x48d5f362,
+0xb800dc1f, 0x00000661, 0xd393f9c5, 0x850fc2fe,
+0x000001b1, 0x48fdf362, 0xa8248c3b, 0x00ffffff,
+0x48fdf262, 0xa824a45b, 0x62ffffff, 0x3a48f5f3,
+0xffa824ac, 0x6201ffff, 0x1f48ddf3, 0xf9c500e5,
+0xc0fec493, 0x00066cb8, 0x76850f00, 0x62000001,
+0x3948fdf3, 0xffa8248c, 0x6200ffff, 0x5a48fdf2,
+0xffa824a4, 0xf362ffff, 0x8c3848f5, 0xffffa824,
+0xf36201ff, 0x8c3848f5, 0xffffa824, 0xf36202ff,
+0x8c3848f5, 0xffffa824, 0xf36203ff, 0xe91f48dd,
+0x93f9c500, 0xb8c0fec5, 0x0000067c, 0x0123850f,
+0xf1620000, 0x8c6f48fd, 0x00018824, 0xedf26200,
+0x248c7648, 0x00000088, 0x48fdf162, 0xc824bc6f,
+0x62000001, 0x7e48c5f2, 0x00882494, 0xf1620000,
+0xcafb48f5, 0x0006a6b8, 0x44c74800, 0x0004a824,
+0xf2620000, 0xcb4048f5, 0x48fdf262, 0xf5245459,
+0x48f5f362, 0xc500f21f, 0xfed693f9, 0xc2850fc2,
+0x48000000, 0xd024848b, 0x62000000, 0x6f48fdf1,
+0x008824b4, 0xf1620000, 0xb47f48fd, 0x00000824,
+0x44894800, 0x8b481024, 0x00e02484, 0x89480000,
+0x48202444, 0xf024848b, 0x48000000, 0x30244489,
+0x24848b48, 0x00000100, 0x24448948, 0xfdf16240,
+0x248c6f48, 0x00000088, 0xf9c5aab0, 0x3ab8c892,
+0x62000007, 0x6449f5f2, 0x00c82494, 0xf3620000,
+0xbc1f48ed, 0x00000824, 0xf9c50000, 0xc2fed793,
+0xf3624375, 0xd90348f5, 0x0007b801, 0x00ba0000,
+0x62000000, 0x7c48fdf2, 0x0001b8d0, 0xf1620000,
+0xcadb48f5, 0x48fdf262, 0xf162d07c, 0xcad448f5,
+0x48e5f362, 0xc500c11f, 0xfec093f9, 0x074ab8c0,
+0x440f0000, 0x00c3c9c2, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000008, 0x00000000, 0x0000000e, 0x00000000,
+0x00000012, 0x00000000, 0x00000014, 0x00000000,
+0x00000014, 0x00000000, 0x00000012, 0x00000000,
+0x0000000e, 0x00000000, 0x00000008, 0x00000000,
+0003500,
+};
+asm(".type avx512dq_x86_64_D_64i8, STT_NOTYPE;");
+asm(".type avx512dq_x86_64_D_64i8, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512dq_x86_64_D_64u8[] = {
+0xb85500eb, 0x00000001, 0x000040be, 0x09ba4100,
+0x48000000, 0x8348e589, 0x8148c0e4, 0x000208ec,
+0xff488d00, 0x45d0894d, 0x8948c931, 0x0080c484,
+0xca890000, 0x83c02949, 0xc18501e2, 0xc484894c,
+0x000000c0, 0xc1940f41, 0xd1ff7a8d, 0x03e2c1e9,
+0x44ff6348, 0xca09ce29, 0xc4bc8948, 0x00000100,
+0x8948f789, 0x0180c494, 0x83480000, 0x894804c2,
+0x0140c4bc, 0x89480000, 0x01c0c494, 0xff480000,
+0xf88348c0, 0x629a7509, 0x6f48fdf1, 0x008824b4,
+0xf1620000, 0xb47f48fd, 0xffffc824, 0xfdf162ff,
+0x24946f48, 0xffffffc8, 0x000539b8, 0xedf36200,
+0x00c61f48, 0xd093f9c5, 0x850fc2fe, 0x000005a1,
+0x48edf162, 0x88248cd4, 0x62000000, 0x7f48fdf1,
+0x0008248c, 0xf1620000, 0x8c6f48fd, 0x00000824,
+0x053fb800, 0xf1620000, 0xb47348e5, 0x00008824,
+0xf3620100, 0xd31f48f5, 0x93f9c500, 0x0fc2fed2,
+0x00055c85, 0xf5f16200, 0x248cfb48, 0x00000088,
+0x48fdf162, 0x48248c7f, 0x62000000, 0x6f48fdf1,
+0x0048249c, 0x44b80000, 0x62000005, 0x1f48edf3,
+0xf9c500db, 0xc2fed393, 0x0523850f, 0xf1620000,
+0x94eb48ed, 0x0000c824, 0xfdf16200, 0x24947f48,
+0xffffffc8, 0x48f5f162, 0xc8248cdb, 0x62000000,
+0xef48e5f1, 0x00c8249c, 0xf1620000, 0x8cdf48f5,
+0xffffc824, 0x0550b8ff, 0xf3620000, 0xe31f48f5,
+0x93f9c500, 0x0fc2fed4, 0x0004d485, 0xfdf16200,
+0x249c6f48, 0x00000088, 0x48e5f262, 0xc8248c40,
+0x62000000, 0x1f48f5f3, 0x0004d22d, 0xc8b80000,
+0xc5000005, 0xfed593f9, 0xa2850fc2, 0x62000004,
+0x7f48fdf1, 0x0048249c, 0xf1620000, 0xb47348f5,
+0x00004824, 0xf1620300, 0x8c7f48fd, 0xffffc824,
+0xedf162ff, 0x24b47348, 0x00000048, 0xedf16202,
+0xb8e2d448, 0x000005ed, 0x48f5f362, 0xc500f41f,
+0xfed693f9, 0x56850fc2, 0x62000004, 0x7348f5f1,
+0xffc82494, 0x6202ffff, 0xd448f5f1, 0x05f2b8c9,
+0xf3620000, 0xf91f48ed, 0x93f9c500, 0x0fc2fed7,
+0x00042c85, 0x2444c700, 0x000003a4, 0x7df16200,
+0x244c6e08, 0xe5f162e9, 0xc7c9f348, 0x02a42444,
+0x62000000, 0x6e087df1, 0x62e92454, 0xf348e5f1,
+0xedf162d2, 0xb8e2d448, 0x00000605, 0x48f5f362,
+0xc500c41f, 0xfed093f9, 0xe2850fc2, 0x62000003,
+0x6e087df1, 0x62e92464, 0xd348f5f1, 0xf5f162cc,
+0xb8c9d448, 0x00000609, 0x48edf362, 0xc500d11f,
+0xfed293f9, 0xb6850fc2, 0x62000003, 0x6f48fdf1,
+0x014824bc, 0xf1c50000, 0xf362c9ef, 0xc91f48c5,
+0x75f36204, 0xffc92548, 0xc9fdf162, 0xf162d16f,
+0xd3db48ed, 0x48fdf162, 0x4824947f, 0x62000000,
+0x4748edf2, 0x014824a4, 0xf1620000, 0xacd448f5,
+0x00014824, 0xfdf16200, 0x24ac7f48, 0x00000148,
+0x48edf262, 0x48249447, 0xb8000001, 0x00000621,
+0x48fdf162, 0x0824947f, 0x62000000, 0xd448edf1,
+0xddf362d2, 0x00da1f48, 0xd393f9c5, 0x850fc2fe,
+0x0000032d, 0x48fdf162, 0x0824b46f, 0xb8000000,
+0x00000626, 0x48cdf262, 0x48249445, 0x62000001,
+0x1f48edf3, 0x004824a4, 0xc5000000, 0xfed493f9,
+0xfa850fc2, 0x62000002, 0x3b48e5f2, 0x00c82494,
+0xf2620000, 0xa43f48e5, 0x0000c824, 0xe5f16200,
+0x249cd448, 0x000000c8, 0x48edf162, 0x34b8d4d4,
+0x62000006, 0x1f48edf3, 0xf9c500eb, 0xc2fed593,
+0x02bb850f, 0xf1620000, 0xbc6f48fd, 0x00008824,
+0x064eb800, 0xf1620000, 0x9c6f48fd, 0x0000c824,
+0xc5f36200, 0x1bd74348, 0x487df162, 0x624ed270,
+0x1f48edf3, 0xf9c500f3, 0xc2fed693, 0x027f850f,
+0xf1620000, 0xd1d448e5, 0x000653b8, 0xedf26200,
+0x24943648, 0x00000088, 0x48edf362, 0xc500fb1f,
+0xfed793f9, 0x56850fc2, 0x62000002, 0x0048fdf3,
+0x00882494, 0xb81b0000, 0x00000658, 0x48edf362,
+0x624ed243, 0x1f48edf3, 0xf9c500c3, 0xc2fed093,
+0x022b850f, 0xf1620000, 0x946f48fd, 0x00008824,
+0x065db800, 0xc7480000, 0x09a82444, 0x62000000,
+0x5948fdf2, 0x62f5246c, 0xd448edf1, 0xd5f362e3,
+0x00cc1f48, 0xd193f9c5, 0x850fc2fe, 0x000001f1,
+0x000009b8, 0xfdf26200, 0x62e87c48, 0x1f48d5f3,
+0x61b800d4, 0xc5000006, 0xfed293f9, 0xce850fc2,
+0x62000001, 0x3b48fdf3, 0xffa82494, 0x6200ffff,
+0x5b48fdf2, 0xffa824a4, 0xf362ffff, 0xac3a48ed,
+0xffffa824, 0xf36201ff, 0xdd1f48dd, 0x93f9c500,
+0xb8c0fec3, 0x0000066c, 0x0193850f, 0xf3620000,
+0x943948fd, 0xffffa824, 0xf26200ff, 0xa45a48fd,
+0xffffa824, 0xedf362ff, 0x24943848, 0xffffffa8,
+0xedf36201, 0x24943848, 0xffffffa8, 0xedf36202,
+0x24943848, 0xffffffa8, 0xddf36203, 0x00e21f48,
+0xc493f9c5, 0x7cb8c0fe, 0x0f000006, 0x00014085,
+0xfdf16200, 0x24946f48, 0x00000188, 0x48e5f262,
+0x88249476, 0x62000000, 0x6f48fdf1, 0x01c824b4,
+0xf2620000, 0x9c7e48cd, 0x00008824, 0xf5f16200,
+0xb8cbd448, 0x000006a6, 0x2444c748, 0x000004a8,
+0xf5f16200, 0x62cafb48, 0x2548edf3, 0x01082494,
+0x62550000, 0xef48f5f1, 0x0108248c, 0xf1620000,
+0xcafb48f5, 0x48fdf262, 0xf5245459, 0x48f5f362,
+0xc500ea1f, 0xfed593f9, 0xc2850fc2, 0x48000000,
+0xd024848b, 0x62000000, 0x6f48fdf1, 0x008824bc,
+0xf1620000, 0xbc7f48fd, 0x00000824, 0x44894800,
+0x8b481024, 0x00e02484, 0x89480000, 0x48202444,
+0xf024848b, 0x48000000, 0x30244489, 0x24848b48,
+0x00000100, 0x24448948, 0xfdf16240, 0x248c6f48,
+0x00000088, 0xf9c5aab0, 0x3ab8c892, 0x62000007,
+0x6449f5f2, 0x00c82494, 0xf3620000, 0xb41f48ed,
+0x00000824, 0xf9c50000, 0xc2fed693, 0xf3624375,
+0xd90348f5, 0x0007b801, 0x00ba0000, 0x62000000,
+0x7c48fdf2, 0x0001b8d0, 0xf1620000, 0xcadb48f5,
+0x48fdf262, 0xf162d07c, 0xcad448f5, 0x48e5f362,
+0xc500f91f, 0xfec793f9, 0x074ab8c0, 0x440f0000,
+0x00c3c9c2, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000008, 0x00000000, 0x0000000e, 0x00000000,
+0x00000012, 0x00000000, 0x00000014, 0x00000000,
+0x00000014, 0x00000000, 0x00000012, 0x00000000,
+0x0000000e, 0x00000000, 0x00000008, 0x00000000,
+0003300,
+};
+asm(".type avx512dq_x86_64_D_64u8, STT_NOTYPE;");
+asm(".type avx512dq_x86_64_D_64u8, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512dq_x86_64_D_64f4[] = {
+0x000333e9, 0x01b85500, 0xb9000000, 0x00000011,
+0x48e58948, 0x48c0e483, 0x0088ec81, 0xf1620000,
+0x2d10087e, 0x00000dd8, 0x087ef162, 0xf0246c11,
+0xc82af2c5, 0xf162ca89, 0x6c11087e, 0xc2291184,
+0x087ef162, 0xf1844c11, 0xca2af2c5, 0x087ef162,
+0x01844c11, 0x48c0ff48, 0x7511f883, 0x7cf162d3,
+0x24942848, 0xffffffc8, 0x487cf162, 0x08248c28,
+0x62000000, 0x58586cf1, 0x000d831d, 0x64f16200,
+0x62d95948, 0x28487cf1, 0x75f262e1, 0x24a49848,
+0xffffffc8, 0x0000a7b8, 0x64f16200, 0x00c4c248,
+0xd093f8c5, 0x0fc2ff66, 0x00028985, 0x7cf16200,
+0x62f12848, 0x9e4875f2, 0xffc824b4, 0xabb8ffff,
+0x62000000, 0x18487df2, 0x000cf325, 0x64f16200,
+0x62dc5748, 0xc24864f1, 0xf8c500ce, 0xff66d193,
+0x4f850fc2, 0x62000002, 0x58586cf1, 0x000cd315,
+0x6cf16200, 0x62d15948, 0x28487cf1, 0x75f262d9,
+0x249c9a48, 0xffffffc8, 0x0000afb8, 0x6cf16200,
+0x00d3c248, 0xd293f8c5, 0x0fc2ff66, 0x00021585,
+0x7cf16200, 0x62d92848, 0x57486cf1, 0x00b3b8d4,
+0xf2620000, 0x9c9c4875, 0xffffc824, 0x6cf162ff,
+0x00dbc248, 0xd393f8c5, 0x0fc2ff66, 0x0001e585,
+0x7cf16200, 0x24942848, 0xffffffc8, 0x486cf162,
+0xf262d958, 0x7418487d, 0xf162f024, 0xbc28487c,
+0x00000824, 0x00bbb800, 0xf2620000, 0xf2984845,
+0x4864f162, 0xc500e6c2, 0x66d493f8, 0x850fc2ff,
+0x000001a2, 0x487cf162, 0x0824bc28, 0x62000000,
+0x28487cf1, 0x64f162f2, 0xb8dc5748, 0x000000c0,
+0x5845f262, 0xf024749e, 0x4864f162, 0xc500eec2,
+0x66d593f8, 0x850fc2ff, 0x0000016a, 0x486cf162,
+0xf262c95c, 0x5c18487d, 0xf162f024, 0xbc28487c,
+0x00000824, 0x00c5b800, 0xf2620000, 0xda9a4845,
+0x4874f162, 0xc500f3c2, 0x66d693f8, 0x850fc2ff,
+0x00000132, 0x487cf162, 0x0824bc28, 0x62000000,
+0x28487cf1, 0x74f162da, 0xb8cc5748, 0x000000ca,
+0x5845f262, 0xf0245c9c, 0x4874f162, 0xc500fbc2,
+0x66d793f8, 0x850fc2ff, 0x000000fa, 0x486cf162,
+0x08249c59, 0x62000000, 0x11087ef1, 0x62f1246c,
+0x28487cf1, 0x004824b4, 0xf1620000, 0x8c57485c,
+0x00004824, 0x65f26200, 0x2474b658, 0x65f262f1,
+0x244cb658, 0x7cf162f1, 0x249c2848, 0x00000008,
+0x487cf162, 0xd4b8e228, 0x62000000, 0xa64865f2,
+0x004824a4, 0xf1620000, 0xc4c2484c, 0x93f8c500,
+0xc2ff66d0, 0x008c850f, 0xf2620000, 0x9ca7486d,
+0x00004824, 0x00d8b800, 0xf1620000, 0xcbc24874,
+0x93f8c500, 0xc2ff66d1, 0xf1626c75, 0x9c28487c,
+0x00004824, 0x6cf16200, 0x24ac5948, 0x00000008,
+0x487cf162, 0xf262e328, 0x64b65855, 0xf162f124,
+0xea28487c, 0x4865f262, 0x0824ac96, 0xb8000000,
+0x000000de, 0x485cf162, 0xc500d5c2, 0x66d293f8,
+0x2275c2ff, 0x4865f262, 0x08249497, 0xb8000000,
+0x000000e2, 0x4874f162, 0xc500dac2, 0x66d393f8,
+0x0275c2ff, 0xc3c9c031, 0xbec03155, 0x00000010,
+0x48e58948, 0x48c0e483, 0x02c0ec81, 0x508d0000,
+0xc5c18901, 0x89ca2af2, 0x62c229f2, 0x11087ef1,
+0xc540844c, 0x89ca2af2, 0x7ef162c2, 0x844c1108,
+0x7ef16250, 0x490d1008, 0x8300000a, 0x0a7501e2,
+0x087ef162, 0x0a760d10, 0xf1620000, 0x4c11087e,
+0xe2c16084, 0x09e9d104, 0x849489ca, 0x000001c0,
+0x8908c283, 0x02008494, 0xff480000, 0xf88348c0,
+0x629b7510, 0x28487cf1, 0x62042474, 0x29487cf1,
+0x62012474, 0x28487cf1, 0xb801244c, 0x00000539,
+0x4874f162, 0xc500c6c2, 0x66d093f8, 0x850fc2ff,
+0x000009b9, 0x4874f162, 0x04245458, 0x487cf162,
+0x02245429, 0x487cf162, 0x04247c28, 0x00053fb8,
+0x7cf16200, 0x24542848, 0x44f16202, 0x62df5848,
+0xc2486cf1, 0xf8c500d3, 0xff66d293, 0x7a850fc2,
+0x62000009, 0x5c486cf1, 0x62042454, 0x29487cf1,
+0x62032454, 0xc24874f1, 0x0003245c, 0x000544b8,
+0x93f8c500, 0xc2ff66d3, 0x094f850f, 0xf1620000,
+0x7428487c, 0xf1620524, 0x4c594874, 0xf1620424,
+0xde59484c, 0x487cf162, 0x04245428, 0x486cf162,
+0xf162ee58, 0x645c486c, 0xf1620524, 0xcb5c4874,
+0x00055bb8, 0x5cf16200, 0x62e55948, 0xc24874f1,
+0xf8c500e4, 0xff66d493, 0xfe850fc2, 0x62000008,
+0x59486cf1, 0x6206244c, 0x29487cf1, 0x6201244c,
+0x5e486cf1, 0xb8062454, 0x00000564, 0x4874f162,
+0xc500eac2, 0x66d593f8, 0x850fc2ff, 0x000008cd,
+0x487df262, 0x08e60d18, 0x67b80000, 0x62000005,
+0x28487cf1, 0x6206245c, 0x574864f1, 0x74f162d1,
+0x244c5748, 0x6cf16204, 0x24545948, 0x6cf16201,
+0x00f1c248, 0xd693f8c5, 0x0fc2ff66, 0x00088c85,
+0x7df16200, 0x244c5b48, 0x7cf16204, 0x62c95b48,
+0xc24874f1, 0x0004247c, 0x00056eb8, 0x93f8c500,
+0xc2ff66d7, 0x0863850f, 0xf2620000, 0x4c4c487d,
+0xf1620424, 0x4c29487c, 0xf1620124, 0x6428487c,
+0xf2620424, 0x4c4c487d, 0xf1620124, 0xc95b487d,
+0x487cf162, 0x75b8c95b, 0x62000005, 0xc24874f1,
+0xf8c500c4, 0xff66d093, 0x1e850fc2, 0x62000008,
+0x59485cf1, 0x7cf162cc, 0x244c2948, 0x7df26201,
+0x244c4e48, 0x7cf16201, 0x244c2948, 0x7cf16202,
+0x244c2848, 0x057cb802, 0xf2620000, 0xd14c487d,
+0x487df162, 0xf162d25b, 0xd25b487c, 0x486cf162,
+0xc500d4c2, 0x66d293f8, 0x850fc2ff, 0x000007cd,
+0x487df262, 0x0424544c, 0x487df162, 0xf162c95b,
+0xd25b487d, 0x487cf162, 0xf162c95b, 0xd25b487c,
+0x4874f162, 0xb800dac2, 0x0000057e, 0xd393f8c5,
+0x0fc2ff66, 0x00079485, 0x7cf16200, 0x247c2848,
+0x7df36204, 0x247c1b48, 0xfcc50014, 0x8024b428,
+0xc5000002, 0x247429fc, 0x7df36220, 0x247c1b48,
+0xfcc50114, 0x8024b428, 0x62000002, 0x7b487df1,
+0x6201244c, 0x7f48fdf1, 0xc509244c, 0x247429fc,
+0x7df16220, 0x244c7b48, 0xfdf16201, 0x244c7f48,
+0xfcf1620a, 0x24545b48, 0xfcf1620a, 0x244c5b48,
+0xf5f36209, 0x01ca1a48, 0x4874f162, 0x042464c2,
+0x0588b800, 0xf8c50000, 0xff66d493, 0x0a850fc2,
+0x62000007, 0x79487cf1, 0x6204244c, 0x7a487ff1,
+0x74f162c9, 0x246cc248, 0x8fb80004, 0xc5000005,
+0x66d593f8, 0x850fc2ff, 0x000006e1, 0x487cf162,
+0x04247c28, 0x487df362, 0x14247c1b, 0x28fcc500,
+0x028024b4, 0xfcc50000, 0x20247429, 0x487df362,
+0x14247c1b, 0x28fcc501, 0x028024b4, 0xf1620000,
+0x4c79487d, 0xf1620124, 0x4c7f48fd, 0xfcc50924,
+0x20247429, 0x487df162, 0x01244c79, 0x48fdf162,
+0x0a244c7f, 0x48fff162, 0x0a24547a, 0x48fff162,
+0x09244c7a, 0x48f5f362, 0x6201d21a, 0x28487cf1,
+0xb804244c, 0x00000596, 0x486cf162, 0xc500f1c2,
+0x66d693f8, 0x850fc2ff, 0x00000651, 0x4874f162,
+0xf162d159, 0x5429487c, 0xf1620124, 0x5451487c,
+0xf1620124, 0xf9c2486c, 0x059cb800, 0xf8c50000,
+0xff66d793, 0x22850fc2, 0x62000006, 0x18487df2,
+0x00067b15, 0x6cf16200, 0x62c95e48, 0x29487cf1,
+0x6201244c, 0x08487df3, 0x0b012464, 0x0005a4b8,
+0x7cf16200, 0x550d2848, 0x62000006, 0xc24874f1,
+0xf8c500c4, 0xff66d093, 0xde850fc2, 0x62000005,
+0x56487df3, 0x0b04244c, 0xe457d8c5, 0x0005abb8,
+0x74f16200, 0x00d4c248, 0xd293f8c5, 0x0fc2ff66,
+0x0005b885, 0x6cf16200, 0x244c5848, 0x6cf16204,
+0x62c95e48, 0x29487cf1, 0x6201244c, 0x56487df3,
+0x0b01244c, 0x487cf162, 0x01247c28, 0x0005b1b8,
+0x44f16200, 0x00d9c248, 0xd393f8c5, 0x0fc2ff66,
+0x00057885, 0x7df26200, 0x990d1848, 0x62000005,
+0x594874f1, 0x6204244c, 0x29487cf1, 0x6201244c,
+0x08487df3, 0x0b01244c, 0x487df362, 0x01246456,
+0x74f1620b, 0x62cc5848, 0x28487cf1, 0xb8012474,
+0x000005bb, 0x484cf162, 0xc500e1c2, 0x66d493f8,
+0x850fc2ff, 0x00000525, 0x4864f162, 0x04246459,
+0x4864f162, 0x05245c59, 0x487cf162, 0x02245c29,
+0x485df362, 0x02244c50, 0x5df36205, 0x24645048,
+0xf1620402, 0x6429487c, 0xf1620224, 0x4c584874,
+0x3db80224, 0x62000006, 0x28487cf1, 0x6204247c,
+0x594874f1, 0x6206244c, 0x584844f1, 0x6205245c,
+0xc24874f1, 0xf8c500eb, 0xff66d593, 0xba850fc2,
+0x62000004, 0x28487cf1, 0xb8042474, 0x0000064e,
+0x487cf162, 0x05245c28, 0x484df362, 0x621bce23,
+0x04487df3, 0xf1621bc9, 0xf3c24874, 0x93f8c500,
+0xc2ff66d6, 0x0483850f, 0xf1620000, 0x4c28487c,
+0x53b80424, 0x62000006, 0x234875f3, 0xf3621be1,
+0xe404487d, 0x5cf1621b, 0x00fbc248, 0xd793f8c5,
+0x0fc2ff66, 0x00045485, 0x64f16200, 0xb8e95848,
+0x0000065d, 0x802484c7, 0x00000002, 0x62418800,
+0x18487df2, 0x028024a4, 0xf1620000, 0xc5c2485c,
+0x93f8c500, 0xc2ff66d0, 0x041f850f, 0xf3620000,
+0x4c1b487d, 0x62001424, 0x1b487df2, 0x62142464,
+0x1a4875f3, 0x0114246c, 0x485cf162, 0xc500d5c2,
+0x66c293f8, 0x6cb8c0ff, 0x0f000006, 0x0003ec85,
+0x7df36200, 0x244c1948, 0xf2620028, 0x6c1a487d,
+0xf3622824, 0x64184875, 0x62012824, 0x18485df3,
+0x02282464, 0x485df362, 0x28246418, 0x54f16203,
+0x00dcc248, 0xc393f8c5, 0xb8c0ff66, 0x0000067c,
+0x03a7850f, 0xf1620000, 0x6410087e, 0xf3624024,
+0x6421085d, 0xc5104124, 0x24a429f8, 0x00000280,
+0x487df262, 0x50246419, 0x0479e3c4, 0x028024ac,
+0xb8440000, 0x0000000c, 0xc892f8c5, 0x4975f362,
+0xb800cd18, 0x00000030, 0xc892f8c5, 0x4975f362,
+0x28244c18, 0x79e3c401, 0x8024ac04, 0x44000002,
+0x0000c0b8, 0x92f8c500, 0x75f362c8, 0x01cd1849,
+0x000300b8, 0x92f8c500, 0x75f362c8, 0x244c1849,
+0xe3c40228, 0x24ac0479, 0x00000280, 0x0c00b844,
+0xf8c50000, 0xf362c892, 0xcd184975, 0x3000b802,
+0xf8c50000, 0xf362c892, 0x4c184975, 0xc4032824,
+0xac0479e3, 0x00028024, 0x00b84400, 0xc5ffffc0,
+0x62c892f8, 0x184975f3, 0xf16203cd, 0xe1c2485c,
+0x93f8c500, 0xc0ff66c4, 0x000696b8, 0xca850f00,
+0x62000002, 0x28487cf1, 0x6207244c, 0x774865f2,
+0x6204244c, 0x6f487df1, 0x6208247c, 0x7f4845f2,
+0x6204245c, 0x29487cf1, 0x6202245c, 0x5c4874f1,
+0x06a6b8cb, 0x84c70000, 0x00028024, 0x00000000,
+0x74f16241, 0x244c5948, 0x7df26206, 0x249c1848,
+0x00000280, 0x4874f162, 0x6200ebc2, 0x29487cf1,
+0xc503244c, 0x66d593f8, 0x850fc2ff, 0x0000025d,
+0x487cf162, 0x04246c28, 0x487df362, 0x14246c1b,
+0x28fcc500, 0x028024b4, 0xfcc50000, 0x4024b429,
+0x62000002, 0x5a487cf1, 0x6212244c, 0x2948fdf1,
+0x6201244c, 0x5a48fdf1, 0xc501244c, 0x248c29fc,
+0x00000280, 0xf162c031, 0x8c10087e, 0x00028004,
+0x7cf16200, 0x044c2e08, 0x74027a40, 0x06f1b80a,
+0xf6e90000, 0x48000001, 0x4804c083, 0x7520f883,
+0x7ef162d5, 0x245c1248, 0x7df26204, 0x010d1848,
+0xb8000002, 0x00000717, 0x4874f162, 0x06244c58,
+0x487df262, 0x01f22518, 0xf1620000, 0x5c5c4864,
+0xf1620424, 0xcc594874, 0x4864f162, 0xc500f1c2,
+0x66d693f8, 0x850fc2ff, 0x000001a1, 0x487ef162,
+0x04244c16, 0x487cf162, 0x01244c29, 0x486cf162,
+0x06245458, 0x00071eb8, 0x7cf16200, 0x245c2848,
+0x74f16204, 0x62cb5c48, 0x59486cf1, 0x74f162d4,
+0x00fac248, 0xd793f8c5, 0x0fc2ff66, 0x00015c85,
+0x7cf16200, 0x245c2948, 0x0004b802, 0xf1620000,
+0x4c10087e, 0x83485004, 0xf16208c0, 0x4c11087e,
+0x83481e04, 0xe67544f8, 0x487cf162, 0x04247c28,
+0xffaaaab8, 0x92f8c5ff, 0x073ab8c8, 0xf2620000,
+0x4c654945, 0xf1620524, 0x44c24874, 0xc5000224,
+0x66d093f8, 0x850fc2ff, 0x00000101, 0x087ef162,
+0x015a1d10, 0xf1620000, 0x4c28487c, 0xf1620524,
+0x6c28487c, 0xf1620424, 0x9c11087e, 0x00028024,
+0x55f26200, 0x248cb658, 0x00000280, 0x487cf162,
+0x04247428, 0x000743b8, 0x4cf16200, 0x24545c48,
+0x4cf16205, 0x24545849, 0x74f16205, 0x00d2c248,
+0xd293f8c5, 0x0fc2ff66, 0x0000a085, 0x7df36200,
+0x244c2648, 0xf1620004, 0x4c29487c, 0xf2620124,
+0x4c42487d, 0xf1620424, 0x4c29487c, 0xc0310224,
+0xf162d231, 0xca7b0876, 0x087cf162, 0x20844c2e,
+0x5d755f7a, 0x8d01788d, 0xfe210270, 0x8301fe83,
+0xc78500d2, 0xf1620c75, 0x5c2e087c, 0x487a1084,
+0xff484675, 0xf88348c0, 0x62c77510, 0x28487cf1,
+0xb801246c, 0x0000077d, 0x487cf162, 0x04247428,
+0x4855f262, 0x02244c2c, 0x484cf162, 0xc500d9c2,
+0x66d393f8, 0x1575c2ff, 0xfff278e8, 0xebd8f7ff,
+0x0773b80c, 0x05eb0000, 0x000778b8, 0x00c3c900,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x80000000, 0xbf800000, 0x3e800000, 0x3f000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x3f800000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0007100,
+};
+asm(".type avx512dq_x86_64_D_64f4, STT_NOTYPE;");
+asm(".type avx512dq_x86_64_D_64f4, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512dq_x86_64_D_64f8[] = {
+0x000326e9, 0x01b85500, 0xb9000000, 0x00000009,
+0x48e58948, 0x48c0e483, 0x0088ec81, 0xf1620000,
+0x2d1008ff, 0x00000b58, 0x08fff162, 0xf7246c11,
+0xc82af3c5, 0xf162ca89, 0x6c1108ff, 0xc22908c4,
+0x08fff162, 0xf8c44c11, 0xca2af3c5, 0x08fff162,
+0x48c40c11, 0x8348c0ff, 0xd47509f8, 0x48fdf162,
+0xc8249428, 0x62ffffff, 0x2848fdf1, 0x0008248c,
+0xf1620000, 0x1d5858ed, 0x00000b04, 0x48e5f162,
+0xf162d959, 0xe12848fd, 0x48f5f262, 0xc824a498,
+0xb8ffffff, 0x000000a7, 0x48e5f162, 0xc500c4c2,
+0xfed093f9, 0x7e850fc2, 0x62000002, 0x2848fdf1,
+0xf5f262f1, 0x24b49e48, 0xffffffc8, 0x0000abb8,
+0xfdf26200, 0x75251948, 0x6200000a, 0x5748e5f1,
+0xe5f162dc, 0x00cec248, 0xd193f9c5, 0x850fc2fe,
+0x00000245, 0x58edf162, 0x0a5a1558, 0xf1620000,
+0xd15948ed, 0x48fdf162, 0xf262d928, 0x9c9a48f5,
+0xffffc824, 0x00afb8ff, 0xf1620000, 0xd3c248ed,
+0x93f9c500, 0x0fc2fed2, 0x00020c85, 0xfdf16200,
+0x62d92848, 0x5748edf1, 0x00b3b8d4, 0xf2620000,
+0x9c9c48f5, 0xffffc824, 0xedf162ff, 0x00dbc248,
+0xd393f9c5, 0x850fc2fe, 0x000001dd, 0x48fdf162,
+0xc8249428, 0x62ffffff, 0x5848edf1, 0xfdf262d9,
+0x24741948, 0xfdf162f7, 0x24bc2848, 0x00000008,
+0x0000bbb8, 0xc5f26200, 0x62f29848, 0xc248e5f1,
+0xf9c500e6, 0xc2fed493, 0x019b850f, 0xf1620000,
+0xbc2848fd, 0x00000824, 0xfdf16200, 0x62f22848,
+0x5748e5f1, 0x00c0b8dc, 0xf2620000, 0x749e58c5,
+0xf162f724, 0xeec248e5, 0x93f9c500, 0x0fc2fed5,
+0x00016485, 0xedf16200, 0x62c95c48, 0x1948fdf2,
+0x62f7245c, 0x2848fdf1, 0x000824bc, 0xc5b80000,
+0x62000000, 0x9a48c5f2, 0xf5f162da, 0x00f3c248,
+0xd693f9c5, 0x850fc2fe, 0x0000012d, 0x48fdf162,
+0x0824bc28, 0x62000000, 0x2848fdf1, 0xf5f162da,
+0xb8cc5748, 0x000000ca, 0x58c5f262, 0xf7245c9c,
+0x48f5f162, 0xc500fbc2, 0xfed793f9, 0xf6850fc2,
+0x62000000, 0x5948edf1, 0x0008249c, 0xf1620000,
+0x6c1108ff, 0xf162f824, 0xb42848fd, 0x00004824,
+0xddf16200, 0x248c5748, 0x00000048, 0x58e5f262,
+0xf82474b6, 0x58e5f262, 0xf8244cb6, 0x48fdf162,
+0x08249c28, 0x62000000, 0x2848fdf1, 0x00d4b8e2,
+0xf2620000, 0xa4a648e5, 0x00004824, 0xcdf16200,
+0x00c4c248, 0xd093f9c5, 0x850fc2fe, 0x00000089,
+0x48edf262, 0x48249ca7, 0xb8000000, 0x000000d8,
+0x48f5f162, 0xc500cbc2, 0xfed193f9, 0x626a75c2,
+0x2848fdf1, 0x0048249c, 0xf1620000, 0xac5948ed,
+0x00000824, 0xfdf16200, 0x62e32848, 0xb658d5f2,
+0x62f82464, 0x2848fdf1, 0xe5f262ea, 0x24ac9648,
+0x00000008, 0x0000deb8, 0xddf16200, 0x00d5c248,
+0xd293f9c5, 0x2175c2fe, 0x48e5f262, 0x08249497,
+0xb8000000, 0x000000e2, 0x48f5f162, 0xc500dac2,
+0xfed393f9, 0x310275c2, 0x55c3c9c0, 0x08bec031,
+0x48000000, 0x8348e589, 0x8148c0e4, 0x000240ec,
+0x01508d00, 0xfd3d8b48, 0x89000007, 0x2af3c5c1,
+0x29f289ca, 0xfff162c2, 0xc44c1108, 0x2af3c520,
+0x62c289ca, 0x1108fff1, 0x6228c44c, 0x6e08fdf1,
+0x01e283cf, 0x8b480d75, 0x0008033d, 0xfdf16200,
+0x62cf6e08, 0x1108fff1, 0xc130c44c, 0xe9d103e2,
+0x8948ca09, 0x01c0c494, 0x83480000, 0x894804c2,
+0x0200c494, 0xff480000, 0xf88348c0, 0x62927508,
+0x2848fdf1, 0x62042474, 0x2948fdf1, 0x62012474,
+0x2848fdf1, 0xb801244c, 0x00000539, 0x48f5f162,
+0xc500c6c2, 0xfed093f9, 0x54850fc2, 0x62000007,
+0x5848f5f1, 0x62042454, 0x2948fdf1, 0x62022454,
+0x2848fdf1, 0xb804247c, 0x0000053f, 0x48fdf162,
+0x02245428, 0x48c5f162, 0xf162df58, 0xd3c248ed,
+0x93f9c500, 0x0fc2fed2, 0x00071685, 0xedf16200,
+0x24545c48, 0xfdf16204, 0x24542948, 0xf5f16203,
+0x245cc248, 0x44b80003, 0xc5000005, 0xfed393f9,
+0xec850fc2, 0x62000006, 0x2848fdf1, 0x6205246c,
+0x5948f5f1, 0x6204244c, 0x5948d5f1, 0xfdf162dd,
+0x24542848, 0xedf16204, 0x62ed5848, 0x5c48edf1,
+0x62052464, 0x5c48f5f1, 0x055bb8cb, 0xf1620000,
+0xe55948dd, 0x48f5f162, 0xc500e4c2, 0xfed493f9,
+0x9c850fc2, 0x62000006, 0x5948edf1, 0x6206244c,
+0x2948fdf1, 0x6201244c, 0x5e48edf1, 0xb8062454,
+0x00000564, 0x48f5f162, 0xc500eac2, 0xfed593f9,
+0x6c850fc2, 0x62000006, 0x1948fdf2, 0x00066f0d,
+0x0567b800, 0xf1620000, 0x542848fd, 0xf1620624,
+0xd95748ed, 0x48f5f162, 0x04244c57, 0x48e5f162,
+0x01245c59, 0x48e5f162, 0xc500f1c2, 0xfed693f9,
+0x2c850fc2, 0x62000006, 0xe648fff1, 0x6204244c,
+0xe6487ef1, 0xf5f162c9, 0x247cc248, 0x6eb80004,
+0xc5000005, 0xfed793f9, 0x04850fc2, 0x62000006,
+0x4c48fdf2, 0x6204244c, 0x2948fdf1, 0x6201244c,
+0x2848fdf1, 0x62042464, 0x4c48fdf2, 0x6201244c,
+0xe648fff1, 0x7ef162c9, 0xb8c9e648, 0x00000575,
+0x48f5f162, 0xc500c4c2, 0xfed093f9, 0xc0850fc2,
+0x62000005, 0x5948ddf1, 0xfdf162cc, 0x244c2948,
+0xfdf26201, 0x244c4e48, 0xfdf16201, 0x244c2948,
+0xfdf16202, 0x244c2848, 0x057cb802, 0xf2620000,
+0xd94c48fd, 0x48fff162, 0xf162dbe6, 0xdbe6487e,
+0x48e5f162, 0xc500d4c2, 0xfed293f9, 0x70850fc2,
+0x62000005, 0x4c48fdf2, 0x6204245c, 0xe648fff1,
+0xfff162c9, 0x62dbe648, 0xe6487ef1, 0x7ef162c9,
+0x62dbe648, 0xc248f5f1, 0x7eb800db, 0xc5000005,
+0xfed393f9, 0x38850fc2, 0x62000005, 0x7b48fdf1,
+0x6204244c, 0xe648fef1, 0xf5f162c9, 0x2464c248,
+0x88b80004, 0xc5000005, 0xfed493f9, 0x10850fc2,
+0x62000005, 0x7948fcf1, 0x6204244c, 0x7a487ef1,
+0xf5f162c9, 0x246cc248, 0x8fb80004, 0xc5000005,
+0xfed593f9, 0xe8850fc2, 0x62000004, 0x7948fdf1,
+0x6204245c, 0x7a48fef1, 0xfdf162db, 0x244c2848,
+0x0596b804, 0xf1620000, 0xf1c248e5, 0x93f9c500,
+0x0fc2fed6, 0x0004ba85, 0xf5f16200, 0x62d95948,
+0x2948fdf1, 0x6201245c, 0x5148fdf1, 0x6201245c,
+0xc248e5f1, 0x9cb800f9, 0xc5000005, 0xfed793f9,
+0x8c850fc2, 0x62000004, 0x1948fdf2, 0x0004cf1d,
+0xe5f16200, 0x62c95e48, 0x2948fdf1, 0x6201244c,
+0x0948fdf3, 0x0b012464, 0x0005a4b8, 0xfdf16200,
+0xa90d2848, 0x62000004, 0xc248f5f1, 0xf9c500cc,
+0xc2fed193, 0x0449850f, 0xf3620000, 0x4c5648fd,
+0xc50b0424, 0xb8e457d9, 0x000005ab, 0x48f5f162,
+0xc500c4c2, 0xfed093f9, 0x24850fc2, 0x62000004,
+0x5848e5f1, 0x6204244c, 0x5e48e5f1, 0xfdf162d9,
+0x245c2948, 0xfdf36201, 0x244c5648, 0xf1620b01,
+0x742848fd, 0xb1b80124, 0x62000005, 0xc248cdf1,
+0xf9c500d1, 0xc2fed293, 0x03e5850f, 0xf2620000,
+0x0d1948fd, 0x000003f8, 0x48f5f162, 0x04244c59,
+0x48fdf162, 0x01244c29, 0x48fdf362, 0x01244c09,
+0xfdf3620b, 0x245c5648, 0xf1620b01, 0xcb5848f5,
+0x48fdf162, 0x01247c28, 0x0005bbb8, 0xc5f16200,
+0x00d9c248, 0xd393f9c5, 0x850fc2fe, 0x00000393,
+0x48edf162, 0x04245c59, 0x48edf162, 0x05245459,
+0x48fdf162, 0x02245429, 0x48e5f362, 0x02244c50,
+0xe5f36205, 0x245c5048, 0xf1620402, 0x5c2948fd,
+0xf1620224, 0x4c5848f5, 0x3db80224, 0x62000006,
+0x2848fdf1, 0x6204246c, 0x5948f5f1, 0x6206244c,
+0x5848d5f1, 0x62052454, 0xc248f5f1, 0xf9c500e2,
+0xc2fed493, 0x0329850f, 0xf1620000, 0x742848fd,
+0x4eb80424, 0x62000006, 0x2848fdf1, 0x62052454,
+0x2348cdf3, 0xf3621bce, 0xc90548fd, 0xf5f16255,
+0x00eac248, 0xd593f9c5, 0x850fc2fe, 0x000002f3,
+0x48fdf162, 0x04244c28, 0x000653b8, 0xf5f36200,
+0x1bd92348, 0x48fdf362, 0x6255db05, 0xc248e5f1,
+0xf9c500f2, 0xc2fed693, 0x02c5850f, 0xf1620000,
+0xe15848ed, 0xdd058b48, 0x48000002, 0x20244489,
+0x00065db8, 0xfdf26200, 0x245c1948, 0xe5f16204,
+0x00fcc248, 0xd793f9c5, 0x850fc2fe, 0x00000293,
+0x48fdf362, 0x01244c1b, 0xfdf26200, 0x245c1b48,
+0xf5f36201, 0x24641a48, 0xf1620101, 0xccc248e5,
+0x93f9c500, 0xb8c0fec1, 0x0000066c, 0x0261850f,
+0xf3620000, 0x4c1948fd, 0x62000224, 0x1a48fdf2,
+0x6202245c, 0x1848f5f3, 0x0102244c, 0x48f5f362,
+0x02244c18, 0xf5f36202, 0x244c1848, 0xf1620302,
+0xc1c248e5, 0x93f9c500, 0xb8c0fec0, 0x0000067c,
+0x021d850f, 0xf1620000, 0x4c2848fd, 0xf2620724,
+0x4c7748ed, 0xf1620424, 0x7c6f48fd, 0xf2620824,
+0x547f48c5, 0xf1620424, 0xca5c48f5, 0x1d058b48,
+0x62000002, 0x5948f5f1, 0x4806244c, 0x20244489,
+0x0006a6b8, 0xfdf26200, 0x24541948, 0xf5f16204,
+0x00d2c248, 0x48fdf162, 0x03244c29, 0xd293f9c5,
+0x850fc2fe, 0x000001bb, 0x48fff162, 0x04245412,
+0x48fdf262, 0x01be0d19, 0x17b80000, 0x62000007,
+0x5848f5f1, 0x6206244c, 0x2848fdf1, 0x6204245c,
+0x5958f5f1, 0x0001bf0d, 0xedf16200, 0x62d35c48,
+0xc248edf1, 0xf9c500d9, 0xc2fed393, 0x0171850f,
+0xf1620000, 0x4c1008ff, 0xf1622924, 0x5c2948fd,
+0xf1620224, 0x4c1108ff, 0xf1621124, 0x4c1008ff,
+0xf1622b24, 0x4c1108ff, 0xf1621324, 0x4c1008ff,
+0xf1622d24, 0x4c1108ff, 0xf1621524, 0x4c1008ff,
+0xf1622f24, 0x4c1108ff, 0xf1621724, 0x6c2848fd,
+0xaab00424, 0xc892f9c5, 0x00073ab8, 0xd5f26200,
+0x244c6549, 0xf5f16205, 0x2464c248, 0xf9c50002,
+0xc2fed493, 0x00f9850f, 0xf1620000, 0x1d1008ff,
+0x0000013c, 0x48fdf162, 0x05244c28, 0x48fdf162,
+0x04247428, 0x08fff162, 0x04245c11, 0x58cdf262,
+0x04244cb6, 0x48fdf162, 0x04247c28, 0x000743b8,
+0xc5f16200, 0x24545c48, 0xc5f16205, 0x24545849,
+0xf5f16205, 0x00eac248, 0xd593f9c5, 0x850fc2fe,
+0x0000009f, 0x48fdf362, 0x04244c26, 0xfdf16200,
+0x244c2948, 0xfdf26201, 0x244c4248, 0xfdf16204,
+0x244c2948, 0x31c03102, 0x77f162d2, 0x62ca7b08,
+0x2e08fdf1, 0x7a10c44c, 0x8d5c755e, 0x708d0178,
+0x83fe2102, 0xd28301fe, 0x75c78500, 0xfdf1620c,
+0xc45c2e08, 0x75477a08, 0xc0ff4845, 0x08f88348,
+0xf162c775, 0x742848fd, 0x7db80124, 0x62000007,
+0x2848fdf1, 0x6204247c, 0x2c48cdf2, 0x6202244c,
+0xc248c5f1, 0xf9c500f1, 0xc2fed693, 0xe2e81575,
+0xf7fffff4, 0xb80cebd8, 0x00000773, 0x78b805eb,
+0xc9000007, 0x000000c3, 0x00000000, 0x00000000,
+0x00000000, 0x80000000, 0x00000000, 0xbff00000,
+0x00000000, 0x3fd00000, 0x00000000, 0x40220000,
+0x00000000, 0x40100000, 0x00000000, 0x3fe00000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x3ff00000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0005700,
+};
+asm(".type avx512dq_x86_64_D_64f8, STT_NOTYPE;");
+asm(".type avx512dq_x86_64_D_64f8, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512dq_x86_64_D_16i4[] = {
+0xb85500eb, 0x00000001, 0x000020b9, 0x05b94100,
+0x48000000, 0x8348e589, 0x788d28ec, 0xc88945ff,
+0x9c854489, 0x2941fa89, 0x01e283c0, 0x85448944,
+0x01fa83ac, 0xe283d219, 0x85caff02, 0x940f40f8,
+0x855489c7, 0xb60f40bc, 0x89f929ff, 0x48cc854c,
+0x8348c0ff, 0xc27505f8, 0x087df162, 0x62fa556f,
+0x7f087df1, 0xf162f755, 0x4d6f087d, 0x0539b8f7,
+0xf3620000, 0xc21f0875, 0x93f9c500, 0x0ffa80d0,
+0x04e0850f, 0xf1620000, 0x55fe0875, 0x7df162fa,
+0xf8557f08, 0x087df162, 0x62f8556f, 0x720865f1,
+0xb801fa75, 0x0000053f, 0x086df362, 0xc500d31f,
+0x80d293f9, 0x850f0ffa, 0x000004aa, 0x086df162,
+0x62fa55fa, 0x7f087df1, 0xf362f955, 0x5d1f0875,
+0x44b800f9, 0xc5000005, 0x80d393f9, 0x850f0ffa,
+0x00000482, 0x087df162, 0x62fb556f, 0x400875f2,
+0xf262fa4d, 0xd240086d, 0x087df162, 0x62fa656f,
+0xfe085df1, 0xf162fb6d, 0x5dfa085d, 0x75f162fb,
+0xb8cafa08, 0x0000055b, 0x0865f262, 0xf362dd40,
+0xe31f0875, 0x93f9c500, 0x0ffa80d4, 0x0434850f,
+0xf2620000, 0x4d40085d, 0x75f362fb, 0x2c2d1f08,
+0x00000004, 0x0005c8b8, 0x93f9c500, 0x0ffa80d5,
+0x0410850f, 0xf1620000, 0x4def085d, 0x7df162fc,
+0xf74d7f08, 0x087df162, 0xf262c87e, 0x4d2808f5,
+0x556348fb, 0x489848b0, 0x48c2af0f, 0x48b85563,
+0x48904589, 0xff788563, 0x0f48ffff, 0x8948c2af,
+0xe1b89845, 0x62000005, 0x1f0875f3, 0xc500f975,
+0x80d693f9, 0x850f0ffa, 0x000003ba, 0x085df262,
+0x62fc5540, 0x7f087df1, 0xf162f955, 0x75720875,
+0xf16203f9, 0x4d7f087d, 0x65f162f7, 0xf9757208,
+0x65f16202, 0xb8ebfe08, 0x000005ed, 0x0875f362,
+0xc500fd1f, 0x80d793f9, 0x850f0ffa, 0x00000376,
+0x0875f162, 0x02f76572, 0x0875f162, 0xf2b8c9fe,
+0x62000005, 0x1f0865f3, 0xf9c500c1, 0xfa80d093,
+0x4f850f0f, 0xc7000003, 0xffff6c85, 0x000003ff,
+0x85634800, 0xffffff6c, 0x08fdf162, 0xf162c86e,
+0xc9f2086d, 0xff6c85c7, 0x0002ffff, 0x63480000,
+0xffff6c85, 0xfdf162ff, 0x62f06e08, 0xf2086df1,
+0x6df162d6, 0xb8dafe08, 0x00000605, 0x0875f362,
+0xc500cb1f, 0x80d193f9, 0x850f0ffa, 0x000002f6,
+0x6c856348, 0x62ffffff, 0x6e08fdf1, 0x75f162f8,
+0x62cfe208, 0xfe0875f1, 0x0609b8c9, 0xf3620000,
+0xd11f086d, 0x93f9c500, 0x0ffa80d2, 0x02c4850f,
+0xf1620000, 0x756f087d, 0x75f162fd, 0x62c9ef08,
+0x1f084df3, 0xf26206c9, 0x5540895d, 0x6df262fc,
+0xfd5d4708, 0x087df162, 0x62fd7d6f, 0xfa0845f1,
+0x0002ab0d, 0x7df16200, 0xfd4d7f08, 0x086df262,
+0xb8fd4d47, 0x00000621, 0x0875f162, 0xf362e9fe,
+0xdd1f0865, 0x93f9c500, 0x0ffa80d3, 0x0264850f,
+0xf2620000, 0x4d460875, 0x0626b8fd, 0xf3620000,
+0xe21f0875, 0x93f9c500, 0x0ffa80d4, 0x0244850f,
+0xf1620000, 0x4d6f087d, 0x75f262fc, 0xfb554008,
+0x087df162, 0x62f8557f, 0x400875f2, 0x65f262dc,
+0xf8553d08, 0x0865f262, 0x62f85d39, 0x7f087df1,
+0xf162f85d, 0x55fe086d, 0x5df162f8, 0xfb5dfe08,
+0x00063db8, 0x6df26200, 0x62d14008, 0x1f086df3,
+0xf9c500eb, 0xfa80d593, 0xe7850f0f, 0x62000001,
+0x40085df2, 0x7df162d1, 0xf7557f08, 0x087df262,
+0xb8f7551e, 0x00000644, 0x086df362, 0xc500f41f,
+0x80d693f9, 0x850f0ffa, 0x000001ba, 0x087df162,
+0x62fa5d6f, 0x6f087df1, 0x4eb8fb55, 0x62000006,
+0x70087df1, 0xf3621be3, 0xfa1f085d, 0x93f9c500,
+0x0ffa80d7, 0x018c850f, 0xf1620000, 0xdbfe086d,
+0x05f045c7, 0xb8000000, 0x0000065d, 0x087df262,
+0x62fc6558, 0x1f085df3, 0xf9c500c3, 0xfa80d093,
+0x5f850f0f, 0xb8000001, 0x00000005, 0x087df262,
+0xf362e07c, 0xcb1f085d, 0x0661b800, 0xf9c50000,
+0xfa80d193, 0x3b850f0f, 0x62000001, 0x62086df1,
+0xf162fa5d, 0x556a086d, 0x65f162fa, 0xc7d2fa08,
+0x0002f045, 0xa6b80000, 0x62000006, 0x40086df2,
+0x7df262d1, 0xfc5d5808, 0x086df362, 0xc500d31f,
+0x80d293f9, 0x850f0ffa, 0x000000fa, 0x0875f262,
+0x62fa5540, 0x720875f1, 0xf1621fe1, 0x557f087d,
+0x6df162f7, 0x62d16208, 0x6f087df1, 0xf262f775,
+0xce25087d, 0x0875f362, 0xb800da1f, 0x000006b3,
+0xd393f9c5, 0x0f0ffa80, 0x0000b985, 0x7df16200,
+0xfa556f08, 0x087df162, 0x62fe557f, 0x6f087df1,
+0xf262fe7d, 0xcf25087d, 0x087df162, 0x62f74d7f,
+0x6f087df1, 0xf262f76d, 0xe935087e, 0x087df162,
+0x8bff4d7f, 0x4539a045, 0x8b7675f0, 0x4539a445,
+0x8b6e75f4, 0xf162b445, 0x557f087d, 0x844589f8,
+0x89bc458b, 0xf1628c45, 0x4d6f087d, 0x073ab8fa,
+0xe3c40000, 0xb0550271, 0x6df3620a, 0xf8651f08,
+0x93f9c500, 0x0ffa80d4, 0xf3623c75, 0xd1030875,
+0x75f16201, 0x550ddb08, 0xba000000, 0x00000000,
+0x0875f162, 0x00360dfe, 0xf3620000, 0xe91f086d,
+0x93f9c500, 0xb80f3cc5, 0x0000074a, 0xebc2440f,
+0x06f1b805, 0xc3c90000, 0x00000000, 0x00000000,
+0x00000004, 0x00000006, 0x00000006, 0x00000004,
+0x00000001, 0x00000001, 0x00000001, 0x00000001,
+0x00000003, 0x00000003, 0x00000003, 0x00000003,
+0002640,
+};
+asm(".type avx512dq_x86_64_D_16i4, STT_NOTYPE;");
+asm(".type avx512dq_x86_64_D_16i4, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512dq_x86_64_D_16u4[] = {
+0x315500eb, 0x0020bac0, 0xb9410000, 0x00000004,
+0x48e58948, 0x8928ec83, 0x01708dc1, 0x45cf8944,
+0xe183c031, 0x89c72901, 0xffa08574, 0x89c685c9,
+0x41b0857c, 0x89c0940f, 0x44c0854c, 0x5489c229,
+0xff48d085, 0xf88348c0, 0x62cc7504, 0x6f087df1,
+0xf162fa4d, 0x4d7f087d, 0x7df162f7, 0xf7556f08,
+0x000539b8, 0x6df36200, 0x00c11f08, 0xd093f9c5,
+0x0f0ffa80, 0x00045f85, 0x6df16200, 0xfa4dfe08,
+0x087df162, 0x62f84d7f, 0x6f087df1, 0xf162f84d,
+0x75720865, 0x3fb801fa, 0x62000005, 0x1f0875f3,
+0xf9c500cb, 0xfa80d193, 0x29850f0f, 0x62000004,
+0xfa0875f1, 0xf162fa4d, 0x4d7f087d, 0x7df162f9,
+0xf95d6f08, 0x000544b8, 0x6df36200, 0x00d31f08,
+0xd293f9c5, 0x0f0ffa80, 0x0003fb85, 0x6df16200,
+0xfb55eb08, 0x087df162, 0x62f7557f, 0xdb0875f1,
+0xf162fb4d, 0x5def0865, 0x75f162fb, 0xf74ddf08,
+0x000550b8, 0x75f36200, 0x00db1f08, 0xd393f9c5,
+0x0f0ffa80, 0x0003bf85, 0x7df16200, 0xfa556f08,
+0x086df262, 0x62fb4d40, 0x1f0875f3, 0x0003ae25,
+0xc8b80000, 0xc5000005, 0x80d493f9, 0x850f0ffa,
+0x00000394, 0x086df162, 0x62fc4def, 0x7f087df1,
+0xf162f74d, 0xc87e087d, 0x08f5f162, 0x8bfb4df4,
+0x0f48b055, 0x558bc2af, 0x458948b8, 0x78858b90,
+0x48ffffff, 0x48c2af0f, 0xb8984589, 0x000005e1,
+0x0875f362, 0x00f96d1f, 0xd593f9c5, 0x0f0ffa80,
+0x00034385, 0x7df16200, 0xf9557f08, 0x0875f162,
+0x03f97572, 0x087df162, 0x62f74d7f, 0x720865f1,
+0x6202f975, 0xfe0865f1, 0x05edb8e3, 0xf3620000,
+0xf41f0875, 0x93f9c500, 0x0ffa80d6, 0x0306850f,
+0xf1620000, 0x55720875, 0xf16202f7, 0xc9fe0875,
+0x0005f2b8, 0x65f36200, 0x00f91f08, 0xd793f9c5,
+0x0f0ffa80, 0x0002df85, 0x6c85c700, 0x03ffffff,
+0x62000000, 0x6e087df1, 0xf162db4d, 0xc9f2086d,
+0xff6c85c7, 0x0002ffff, 0xf1620000, 0x5d6e087d,
+0x6df162db, 0x62dbf208, 0xfe0865f1, 0x0605b8e3,
+0xf3620000, 0xc41f0875, 0x93f9c500, 0x0ffa80d0,
+0x0292850f, 0xf1620000, 0x656e087d, 0x75f162db,
+0x62ccd208, 0xfe0875f1, 0x0609b8c9, 0xf3620000,
+0xc91f0865, 0x93f9c500, 0x0ffa80d1, 0x0266850f,
+0xf1620000, 0xdbef0865, 0xc976f1c5, 0x087df162,
+0xe1c5e26f, 0x62d05d76, 0x250875f3, 0xf26240e3,
+0x6d47085d, 0x75f162fd, 0xfd5dfe08, 0x087df162,
+0x62fd5d7f, 0x47085df2, 0x21b8fd5d, 0x62000006,
+0xfe0865f1, 0x55f362f3, 0x00d61f08, 0xd293f9c5,
+0x0f0ffa80, 0x00020f85, 0x65f26200, 0xfd5d4508,
+0x000626b8, 0x65f36200, 0x00dc1f08, 0xd393f9c5,
+0x0f0ffa80, 0x0001ef85, 0x6df26200, 0xfb5d3b08,
+0x086df262, 0x62fb653f, 0xfe086df1, 0xf162fb55,
+0xdcfe0865, 0x000634b8, 0x65f36200, 0x00e21f08,
+0xd493f9c5, 0x0f0ffa80, 0x0001bb85, 0x7df16200,
+0xfa5d6f08, 0x087df162, 0xb8fb556f, 0x0000064e,
+0x087df162, 0x621be370, 0x1f085df3, 0xf9c500ea,
+0xfa80d593, 0x8d850f0f, 0x62000001, 0xfe086df1,
+0xf045c7db, 0x00000005, 0x00065db8, 0x7df26200,
+0xfc655808, 0x085df362, 0xc500f31f, 0x80d693f9,
+0x850f0ffa, 0x00000160, 0x000005b8, 0x7df26200,
+0x62e07c08, 0x1f085df3, 0x61b800fb, 0xc5000006,
+0x80d793f9, 0x850f0ffa, 0x0000013c, 0x086df162,
+0x62fa5d62, 0x6a086df1, 0xf162fa55, 0xcafe0875,
+0x086df362, 0x55fc5525, 0x0006a6b8, 0xf045c700,
+0x00000002, 0x0875f162, 0xf162cbfa, 0x4def0875,
+0x75f162fc, 0x62cafa08, 0x58087df2, 0xf362fc55,
+0xc21f0875, 0x93f9c500, 0x0ffa80d0, 0x00e6850f,
+0xf2620000, 0x5535087d, 0x7df162f4, 0xfa7d6f08,
+0x087df262, 0xf362cf35, 0xca1f0875, 0x06d3b800,
+0xf9c50000, 0xfa80d193, 0xb9850f0f, 0x62000000,
+0x6f087df1, 0xf162fa55, 0x557f087d, 0x7df162fe,
+0xfe6d6f08, 0x087df262, 0xf162cd35, 0x4d7f087d,
+0x7df162f7, 0xf7756f08, 0x087ef262, 0xf162f135,
+0x4d7f087d, 0xa0458bff, 0x75f04539, 0xa4458b76,
+0x75f44539, 0xb4458b6e, 0x087df162, 0x89f8557f,
+0x458b8445, 0x8c4589bc, 0x087df162, 0xb8fa4d6f,
+0x0000073a, 0x0271e3c4, 0x620ab055, 0x1f086df3,
+0xc500f855, 0x80d293f9, 0x3c750ffa, 0x0875f362,
+0x6201d103, 0xdb0875f1, 0x0000430d, 0x0000ba00,
+0xf1620000, 0x0dfe0875, 0x00000044, 0x086df362,
+0xc500d91f, 0x3cc393f9, 0x074ab80f, 0x440f0000,
+0xb805ebc2, 0x000006f1, 0x0000c3c9, 0x00000000,
+0x00000004, 0x00000006, 0x00000006, 0x00000004,
+0x00000003, 0x00000003, 0x00000003, 0x00000003,
+0x00000001, 0x00000001, 0x00000001, 0x00000001,
+0002420,
+};
+asm(".type avx512dq_x86_64_D_16u4, STT_NOTYPE;");
+asm(".type avx512dq_x86_64_D_16u4, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512dq_x86_64_D_16i8[] = {
+0x485500eb, 0xc748e589, 0x0001d045, 0xc7480000,
+0x0002e045, 0xc7480000, 0x003ff045, 0xc7480000,
+0x0002d845, 0xc7480000, 0x0001e845, 0xc7480000,
+0x003ef845, 0xf1620000, 0x556f08fd, 0xfdf162fd,
+0xfa557f08, 0x08fdf162, 0xb8fa4d6f, 0x00000539,
+0x08f5f362, 0xc500c21f, 0x80d093f9, 0x850f03fa,
+0x0000040c, 0x08f5f162, 0x62fd55d4, 0x7f08fdf1,
+0xf162fb55, 0x556f08fd, 0xe5f162fb, 0xfd757308,
+0x053fb801, 0xf3620000, 0xd31f08ed, 0x93f9c500,
+0x03fa80d2, 0x03d6850f, 0xf1620000, 0x55fb08ed,
+0xfdf162fd, 0xfc557f08, 0x08f5f362, 0x00fc5d1f,
+0x000544b8, 0x93f9c500, 0x03fa80d3, 0x03ae850f,
+0xf1620000, 0x556f08fd, 0xf5f262fe, 0xfd4d4008,
+0x08edf262, 0xf162d240, 0x656f08fd, 0xddf162fd,
+0xfe6dd408, 0x08ddf162, 0x62fe5dfb, 0xfb08f5f1,
+0x055bb8ca, 0xf2620000, 0xdd4008e5, 0x08f5f362,
+0xc500e31f, 0x80d493f9, 0x850f03fa, 0x00000360,
+0x08ddf262, 0x62fe4d40, 0x1f08f5f3, 0x00035e2d,
+0xc8b80000, 0xc5000005, 0x80d593f9, 0x850f03fa,
+0x0000033c, 0x08fdf162, 0x03622d6f, 0xf2620000,
+0xd54008dd, 0x08fdf162, 0x62fc557f, 0x7308f5f1,
+0x6203fc75, 0x7f08fdf1, 0xf162fa4d, 0x757308e5,
+0xf16202fc, 0xf3d408e5, 0x0005edb8, 0xf5f36200,
+0x00f61f08, 0xd693f9c5, 0x0f03fa80, 0x0002ef85,
+0xf5f16200, 0xfa657208, 0xf5f16202, 0xb8c9d408,
+0x000005f2, 0x08e5f362, 0xc500f91f, 0x80d793f9,
+0x850f03fa, 0x000002c8, 0x039445c7, 0x48000000,
+0x62944563, 0x6e08fdf1, 0xedf162c8, 0xc7c9f308,
+0x00029445, 0x63480000, 0xf1629445, 0xf86e08fd,
+0x08edf162, 0xf162d7f3, 0xdad408ed, 0x000605b8,
+0xf5f36200, 0x00c31f08, 0xd093f9c5, 0x0f03fa80,
+0x00027b85, 0x45634800, 0xfdf16294, 0x62f06e08,
+0xe208f5f1, 0xf5f162ce, 0xb8c9d408, 0x00000609,
+0x08edf362, 0xc500d11f, 0x80d293f9, 0x850f03fa,
+0x0000024c, 0x08fdf162, 0x62ff7d6f, 0xef08f5f1,
+0xc5f362c9, 0x06c91f08, 0x89d5f262, 0xf162cc40,
+0x4d7f08fd, 0xf5f262fc, 0xff5d4708, 0x000001b8,
+0xfdf16200, 0xff756f08, 0x08fdf262, 0xf162d07c,
+0xd2fb08cd, 0x08fdf162, 0x62ff557f, 0x4708f5f2,
+0x21b8ff4d, 0x62000006, 0x7f08fdf1, 0xf162fb4d,
+0xc9d408f5, 0x08e5f362, 0xc500d91f, 0x80d393f9,
+0x850f03fa, 0x000001d8, 0x08fdf162, 0x62fb7d6f,
+0x4608c5f2, 0x26b8ff4d, 0x62000006, 0x1f08f5f3,
+0xc500fc65, 0x80d493f9, 0x850f03fa, 0x000001b0,
+0x08fdf162, 0x62fe4d6f, 0x4008ddf2, 0xf5f262dd,
+0x62d54008, 0x7f08fdf1, 0xf162fa5d, 0x557f08fd,
+0xe5f262fb, 0xfb553d08, 0x08e5f262, 0x62fb5d39,
+0x7f08fdf1, 0xf162fb5d, 0x55d408ed, 0xddf162fb,
+0xb8d9d408, 0x0000063d, 0x08edf262, 0xf362d540,
+0xeb1f08ed, 0x93f9c500, 0x03fa80d5, 0x014e850f,
+0xf2620000, 0x551f08fd, 0xedf362fa, 0x00f41f08,
+0x000644b8, 0x93f9c500, 0x03fa80d6, 0x012e850f,
+0xf1620000, 0x556f08fd, 0x064eb8fd, 0xf1620000,
+0xda70087d, 0xe5f3624e, 0x00f91f08, 0xd793f9c5,
+0x0f03fa80, 0x00010785, 0xf5f16200, 0x48d2d408,
+0x039845c7, 0xb8000000, 0x0000065d, 0x08fdf262,
+0x62f35d59, 0x1f08e5f3, 0xf9c500c2, 0xfa80d093,
+0xd9850f03, 0xb8000000, 0x00000003, 0x08fdf262,
+0xf362d87c, 0xca1f08e5, 0x0661b800, 0xf9c50000,
+0xfa80d193, 0xb5850f03, 0x62000000, 0x6c08f5f1,
+0xf162fd55, 0x4d6d08f5, 0xedf162fd, 0x48c9fb08,
+0x019845c7, 0xb8000000, 0x000006a6, 0x08f5f262,
+0xf262cd40, 0x555908fd, 0xf5f362f3, 0x00d21f08,
+0xd293f9c5, 0x7503fa80, 0xfdf16277, 0xfd756f08,
+0xe8458b48, 0x08fdf162, 0x48fb757f, 0x62b84589,
+0x6f08fdf1, 0xaab0fd4d, 0xc892f9c5, 0x00073ab8,
+0xf5f26200, 0xfe556409, 0x08edf362, 0x00fb5d1f,
+0xd393f9c5, 0x7503fa80, 0xf5f36237, 0x01d90308,
+0x000000ba, 0xfdf16200, 0x41156f08, 0x62000000,
+0xdb08f5f1, 0xf5f162ca, 0x62cad408, 0x1f08e5f3,
+0xf9c500e1, 0x033cc493, 0x00074ab8, 0xc2440f00,
+0x0000c35d, 0x00000000, 0x00000000, 0x00000000,
+0x00000002, 0x00000000, 0x00000002, 0x00000000,
+0x00000001, 0x00000000, 0x00000001, 0x00000000,
+0x00000001, 0x00000000, 0xffffffff, 0xffffffff,
+0002260,
+};
+asm(".type avx512dq_x86_64_D_16i8, STT_NOTYPE;");
+asm(".type avx512dq_x86_64_D_16i8, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512dq_x86_64_D_16u8[] = {
+0x485500eb, 0xc748e589, 0x0001d045, 0xc7480000,
+0x0002e045, 0xc7480000, 0x003ff045, 0xc7480000,
+0x0002d845, 0xc7480000, 0x0001e845, 0xc7480000,
+0x003ef845, 0xf1620000, 0x4d6f08fd, 0xfdf162fd,
+0xfa4d7f08, 0x08fdf162, 0xb8fa556f, 0x00000539,
+0x08edf362, 0xc500c11f, 0x80d093f9, 0x850f03fa,
+0x000003b4, 0x08edf162, 0x62fd4dd4, 0x7f08fdf1,
+0xf162fb4d, 0x4d6f08fd, 0xe5f162fb, 0xfd757308,
+0x053fb801, 0xf3620000, 0xd31f08f5, 0x93f9c500,
+0x03fa80d2, 0x037e850f, 0xf1620000, 0x4dfb08f5,
+0xfdf162fd, 0xfc4d7f08, 0x08fdf162, 0xb8fc5d6f,
+0x00000544, 0x08edf362, 0xc500db1f, 0x80d393f9,
+0x850f03fa, 0x00000350, 0x08edf162, 0x62fe55eb,
+0x7f08fdf1, 0xf162fa55, 0x4ddb08f5, 0xe5f162fe,
+0xfe5def08, 0x08f5f162, 0xb8fa4ddf, 0x00000550,
+0x08f5f362, 0xc500e31f, 0x80d493f9, 0x850f03fa,
+0x00000314, 0x08fdf162, 0x62fd556f, 0x4008edf2,
+0xf362fe4d, 0x2d1f08f5, 0x00000303, 0x05c8b800,
+0xf9c50000, 0xfa80d593, 0xe9850f03, 0x62000002,
+0x7f08fdf1, 0xf162fc55, 0x757308f5, 0xf16203fc,
+0x4d7f08fd, 0xe5f162fa, 0xfc757308, 0xe5f16202,
+0xb8e3d408, 0x000005ed, 0x08f5f362, 0xc500f41f,
+0x80d693f9, 0x850f03fa, 0x000002ac, 0x08f5f162,
+0x02fa5573, 0x08f5f162, 0xf2b8c9d4, 0x62000005,
+0x1f08e5f3, 0xf9c500f9, 0xfa80d793, 0x85850f03,
+0xc7000002, 0x00039445, 0xf1620000, 0x4d6e087d,
+0xedf162e5, 0xc7c9f308, 0x00029445, 0xf1620000,
+0x5d6e087d, 0xedf162e5, 0x62dbf308, 0xd408e5f1,
+0x0605b8e3, 0xf3620000, 0xc41f08f5, 0x93f9c500,
+0x03fa80d0, 0x023e850f, 0xf1620000, 0x656e087d,
+0xf5f162e5, 0x62ccd308, 0xd408f5f1, 0x0609b8c9,
+0xf3620000, 0xc91f08e5, 0x93f9c500, 0x03fa80d1,
+0x0212850f, 0xf1620000, 0xe4ef08dd, 0xc976f1c5,
+0x08fdf162, 0xe2c4da6f, 0xf0652959, 0x08f5f362,
+0x6240dc25, 0x7f08fdf1, 0xf262fc5d, 0x654708e5,
+0xf5f162ff, 0xff6dd408, 0x08fdf162, 0x62ff6d7f,
+0x4708e5f2, 0x21b8ff5d, 0x62000006, 0x7f08fdf1,
+0xf162fb5d, 0xdbd408e5, 0x08ddf362, 0xc500d31f,
+0x80d293f9, 0x850f03fa, 0x000001ac, 0x08fdf162,
+0x62fb756f, 0x4508cdf2, 0x26b8ff5d, 0x62000006,
+0x1f08e5f3, 0xc500fc5d, 0x80d393f9, 0x850f03fa,
+0x00000184, 0x08edf262, 0x62fe5d3b, 0x3f08edf2,
+0xf162fe65, 0x55d408ed, 0xe5f162fe, 0xb8dcd408,
+0x00000634, 0x08e5f362, 0xc500e21f, 0x80d493f9,
+0x850f03fa, 0x00000150, 0x08fdf162, 0x62fd5d6f,
+0x6f08fdf1, 0x4eb8fe55, 0x62000006, 0x70087df1,
+0xf3624ee3, 0xea1f08dd, 0x93f9c500, 0x03fa80d5,
+0x0122850f, 0xf1620000, 0xdbd408ed, 0x9845c748,
+0x00000003, 0x00065db8, 0xfdf26200, 0xf3655908,
+0x08ddf362, 0xc500f31f, 0x80d693f9, 0x850f03fa,
+0x000000f4, 0x000003b8, 0xfdf26200, 0x62e07c08,
+0x1f08ddf3, 0x61b800fb, 0xc5000006, 0x80d793f9,
+0x850f03fa, 0x000000d0, 0x08edf162, 0x62fd5d6c,
+0x6d08edf1, 0xf162fd55, 0xcad408f5, 0x9845c748,
+0x00000001, 0x0006a6b8, 0xedf36200, 0xcc152508,
+0x55000000, 0x08f5f162, 0xf162cbfb, 0x0def08f5,
+0x000000bc, 0x08f5f162, 0xf262cafb, 0x555908fd,
+0xf5f362f3, 0x00c21f08, 0xd093f9c5, 0x7503fa80,
+0xfdf16277, 0xfd7d6f08, 0xe8458b48, 0x08fdf162,
+0x48fb7d7f, 0x62b84589, 0x6f08fdf1, 0xaab0fd4d,
+0xc892f9c5, 0x00073ab8, 0xf5f26200, 0xfe556409,
+0x08edf362, 0x00fb4d1f, 0xd193f9c5, 0x7503fa80,
+0xf5f36237, 0x01d90308, 0x000000ba, 0xfdf16200,
+0x39156f08, 0x62000000, 0xdb08f5f1, 0xf5f162ca,
+0x62cad408, 0x1f08e5f3, 0xf9c500d1, 0x033cc293,
+0x00074ab8, 0xc2440f00, 0x0000c35d, 0x00000000,
+0x00000002, 0x00000000, 0x00000002, 0x00000000,
+0x00000001, 0x00000000, 0x00000001, 0x00000000,
+0xffffffff, 0xffffffff, 0x00000000, 0x00000000,
+0002120,
+};
+asm(".type avx512dq_x86_64_D_16u8, STT_NOTYPE;");
+asm(".type avx512dq_x86_64_D_16u8, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512dq_x86_64_D_16f4[] = {
+0x0002d2e9, 0x00b84800, 0x003f8000, 0x55400000,
+0x48e58948, 0x48d04589, 0x400000b8, 0x80000040,
+0x45894840, 0x00b848d8, 0x00408000, 0x48404000,
+0xb8e04589, 0xfe000001, 0x1ee0c148, 0x00cc45c7,
+0x483f8000, 0x48e84589, 0x8000002d, 0x45894800,
+0x458948f0, 0x7cf162f8, 0xfe4d2808, 0x0000a7b8,
+0x7cf16200, 0xa5152808, 0x6200000b, 0x28087cf1,
+0x75f262d9, 0xfd5d9808, 0x086cf162, 0xc500c3c2,
+0x83d093f9, 0xfa800fe2, 0x46850f0f, 0x62000002,
+0x28087cf1, 0x75f262d9, 0xfd5d9e08, 0x0000abb8,
+0x7cf16200, 0x75152808, 0x6200000b, 0xc2086cf1,
+0xf9c500cb, 0xe283d193, 0x0ffa800f, 0x0213850f,
+0xf1620000, 0xd928087c, 0x0875f262, 0xb8fd5d9a,
+0x000000af, 0x087cf162, 0x0b521528, 0xf1620000,
+0xd3c2086c, 0x93f9c500, 0x0fe283d2, 0x0f0ffa80,
+0x0001e085, 0x7cf16200, 0x62d92808, 0x9c0875f2,
+0xb3b8fd5d, 0x62000000, 0x28087cf1, 0x000b2f15,
+0x6cf16200, 0x00dbc208, 0xd393f9c5, 0x800fe283,
+0x850f0ffa, 0x000001ad, 0x087cf162, 0x62fd5528,
+0x58086cf1, 0x7df262d9, 0xf3651808, 0x087cf162,
+0xb8fe7528, 0x000000bb, 0x084df262, 0xf162e298,
+0xe4c20864, 0x93f9c500, 0x0fe283d4, 0x0f0ffa80,
+0x00017085, 0x7cf16200, 0xfe752808, 0x087cf162,
+0xc0b8e228, 0x62000000, 0x18087df2, 0x000abf2d,
+0x4df26200, 0xf3659e18, 0x0864f162, 0xf162dd57,
+0xecc20864, 0x93f9c500, 0x0fe283d5, 0x0f0ffa80,
+0x00013085, 0x6cf16200, 0x62c95c08, 0x18087df2,
+0xf162f35d, 0x7d28087c, 0x00c5b8fe, 0xf2620000,
+0xda9a0845, 0x0874f162, 0xc500f3c2, 0x83d693f9,
+0xfa800fe2, 0xfa850f0f, 0x62000000, 0x28087cf1,
+0xf162fe75, 0xda28087c, 0x0874f162, 0xcab8cd57,
+0x62000000, 0x9c184df2, 0xf162f35d, 0xfbc20874,
+0x93f9c500, 0x0fe283d7, 0x0f0ffa80, 0x0000c485,
+0x6cf16200, 0xfe4d5908, 0x087cf162, 0xc5ff5d28,
+0x62f3d0f3, 0x28087cf1, 0xf162fe65, 0xfa28087c,
+0x0000d4b8, 0x5df26200, 0xff7da608, 0x084cf162,
+0xc500c7c2, 0x83d093f9, 0xfa800fe2, 0x82850f0f,
+0x62000000, 0x570864f1, 0xd0f3c5dd, 0x6df262cb,
+0xff65a708, 0x0000d8b8, 0x74f16200, 0x00ccc208,
+0xd193f9c5, 0x800fe283, 0x59750ffa, 0x086cf162,
+0xc5fe5d59, 0xf05dd0e3, 0x087cf162, 0x62ff6528,
+0x28087cf1, 0x00deb8ea, 0xf2620000, 0x6d96085d,
+0x64f162fe, 0x00d5c208, 0xd293f9c5, 0x800fe283,
+0x21750ffa, 0x085df262, 0xb8fe5597, 0x000000e2,
+0x0874f162, 0xc500dac2, 0x83d393f9, 0xfa800fe2,
+0x3102750f, 0x48c35dc0, 0x800000b8, 0x0000003f,
+0x89485540, 0xec8148e5, 0x00000090, 0xa0458948,
+0x0000b848, 0x00004040, 0x89484080, 0xb848a845,
+0x40800000, 0x40400000, 0xb0458948, 0x000001b8,
+0xe0c148fe, 0x4589481e, 0x00b848b8, 0x003f8000,
+0x48bf8000, 0x48c04589, 0x62c84589, 0x28087cf1,
+0xf162fa55, 0x5529087c, 0x7cf162f7, 0xf74d2808,
+0x000539b8, 0x74f16200, 0x00c2c208, 0xd093f9c5,
+0x800fe283, 0x850f0ffa, 0x000008a4, 0x0874f162,
+0x62fa5558, 0x29087cf1, 0xf162f855, 0x5d28087c,
+0x7cf162fa, 0xf8552808, 0x00053fb8, 0x64f16200,
+0x62db5808, 0xc2086cf1, 0xf9c500d3, 0xe283d293,
+0x0ffa800f, 0x0866850f, 0xf1620000, 0x555c086c,
+0x7cf162fa, 0xf9552908, 0x0874f162, 0x00f95dc2,
+0x000544b8, 0x93f9c500, 0x0fe283d3, 0x0f0ffa80,
+0x00083b85, 0x7cf16200, 0xfb552808, 0x0874f162,
+0x62fa4d59, 0x59086cf1, 0x7cf162da, 0xfa552808,
+0x086cf162, 0x62fb6d58, 0x5c086cf1, 0xf162fb65,
+0xcb5c0874, 0x00055bb8, 0x5cf16200, 0x62e55908,
+0xc20874f1, 0xf9c500e4, 0xe283d493, 0x0ffa800f,
+0x07ea850f, 0xf1620000, 0x4d59086c, 0x7cf162fc,
+0xf74d2908, 0x086cf162, 0x62fc555e, 0xc20874f1,
+0x64b800ea, 0xc5000005, 0x83d593f9, 0xfa800fe2,
+0xb9850f0f, 0x62000007, 0x18087df2, 0x0007ef0d,
+0x7cf16200, 0xfc652808, 0x000567b8, 0x5cf16200,
+0x62d15708, 0x570874f1, 0xf162fa4d, 0x5559086c,
+0x6cf162f7, 0x00f1c208, 0xd693f9c5, 0x800fe283,
+0x850f0ffa, 0x00000778, 0x087df162, 0x62fa4d5b,
+0x5b087cf1, 0x74f162c9, 0xfa7dc208, 0x056eb800,
+0xf9c50000, 0xe283d793, 0x0ffa800f, 0x074e850f,
+0xf2620000, 0x4d4c087d, 0x7cf162fa, 0xf74d2908,
+0x087df262, 0x62f74d4c, 0x28087cf1, 0x75b8fa5d,
+0x62000005, 0x5b087df1, 0x7cf162c9, 0x62c95b08,
+0xc20874f1, 0xf9c500c3, 0xe283d093, 0x0ffa800f,
+0x070a850f, 0xf1620000, 0xcb590864, 0x087cf162,
+0x62f74d29, 0x4e087df2, 0xf162f74d, 0x4d29087c,
+0x7cf162f8, 0xf84d2808, 0x00057cb8, 0x7df26200,
+0x62d14c08, 0x5b087df1, 0x7cf162d2, 0x62d25b08,
+0xc2086cf1, 0xf9c500d3, 0xe283d293, 0x0ffa800f,
+0x06ba850f, 0xf2620000, 0x554c087d, 0x7df162fa,
+0xb8c95b08, 0x0000057e, 0x087cf162, 0xf162c95b,
+0xd25b087d, 0x087cf162, 0xf162d25b, 0xdac20874,
+0x93f9c500, 0x0fe283d3, 0x0f0ffa80, 0x00067f85,
+0x7cf16200, 0xfa7d2808, 0x087cf162, 0x62fd7d29,
+0x7b087df1, 0xf162fa4d, 0x4d7f087d, 0x74f162fe,
+0x62c95708, 0x120874f1, 0x7cf162f7, 0xfd752908,
+0x087df162, 0x62fa4d7b, 0x7f087df1, 0xf162ff4d,
+0x555b08fc, 0x6df362fe, 0x0eca2108, 0x086cf162,
+0x6255d2c6, 0x5b08fcf1, 0xf362ff5d, 0xca210875,
+0x74f16210, 0x62cb1608, 0xc20874f1, 0xb800fa65,
+0x00000588, 0xd493f9c5, 0x800fe283, 0x850f0ffa,
+0x000005fc, 0x087cf162, 0x62fa4d79, 0x7a087ff1,
+0x74f162c9, 0xfa6dc208, 0x058fb800, 0xf9c50000,
+0xe283d593, 0x0ffa800f, 0x05d2850f, 0xf1620000,
+0x7d28087c, 0x7cf162fa, 0xfd7d2908, 0x087df162,
+0x62fa4d79, 0x7f087df1, 0xf162fe4d, 0xc9570874,
+0x0874f162, 0xf162f712, 0x7529087c, 0x7df162fd,
+0xfa4d7908, 0x087df162, 0x62ff4d7f, 0x7a08fff1,
+0xf362fe55, 0xca21086d, 0x6cf1620e, 0x55d2c608,
+0x08fff162, 0x62ff5d7a, 0x210875f3, 0xf16210ca,
+0xcb160874, 0x087cf162, 0xb8fa5528, 0x00000596,
+0x0874f162, 0xc500f2c2, 0x83d693f9, 0xfa800fe2,
+0x49850f0f, 0x62000005, 0x59086cf1, 0x7cf162ca,
+0xf74d2908, 0x087cf162, 0xb8f74d51, 0x0000059c,
+0x0874f162, 0xc500fac2, 0x83d793f9, 0xfa800fe2,
+0x19850f0f, 0x62000005, 0x18087df2, 0x00055f0d,
+0x74f16200, 0x62d25e08, 0x29087cf1, 0xf362f755,
+0x5d08087d, 0xa4b80bf7, 0x62000005, 0x10087ef1,
+0x00053b15, 0x6cf16200, 0x00cbc208, 0xd193f9c5,
+0x800fe283, 0x850f0ffa, 0x000004d4, 0x087df362,
+0x0bfa5556, 0x0864f162, 0xabb8db57, 0x62000005,
+0xc2086cf1, 0xf9c500c3, 0xe283d093, 0x0ffa800f,
+0x04aa850f, 0xf1620000, 0x55580874, 0x74f162fa,
+0x62d25e08, 0x29087cf1, 0xf362f755, 0x5556087d,
+0xf1620bf7, 0x7d28087c, 0x05b1b8f7, 0xf1620000,
+0xd2c20844, 0x93f9c500, 0x0fe283d2, 0x0f0ffa80,
+0x00046b85, 0x7df26200, 0xc1151808, 0x62000004,
+0x59086cf1, 0xf162fa55, 0x5529087c, 0x7df362f7,
+0xf7550808, 0x7df3620b, 0xf75d5608, 0x6cf1620b,
+0xb8d35808, 0x000005bb, 0x087cf162, 0x62f77528,
+0xc2084cf1, 0xf9c500da, 0xe283d393, 0x0ffa800f,
+0x041a850f, 0xf1620000, 0x5559085c, 0x5cf162fb,
+0xfa5d5908, 0x087cf162, 0x62f85529, 0x500865f3,
+0x6205f855, 0x500865f3, 0x6204f85d, 0x29087cf1,
+0xf162f85d, 0x5558086c, 0x7cf162f8, 0xfa7d2808,
+0x00063db8, 0x44f16200, 0xfb5d5808, 0x086cf162,
+0xf162d459, 0xe3c2086c, 0x93f9c500, 0x0fe283d4,
+0x0f0ffa80, 0x0003b785, 0x7cf16200, 0xfa552808,
+0x00064eb8, 0x6cf16200, 0x1bdac608, 0x087cf162,
+0x62fb5528, 0xc20864f1, 0xf9c500ea, 0xe283d593,
+0x0ffa800f, 0x0386850f, 0xf1620000, 0x5d28087c,
+0x0653b8fa, 0xf3620000, 0xeb04087d, 0x54f1621b,
+0x00f2c208, 0xd693f9c5, 0x800fe283, 0x850f0ffa,
+0x0000035c, 0x086cf162, 0x45c7db58, 0xa00000f0,
+0x065db840, 0xf2620000, 0x6d18087d, 0x54f162fc,
+0x00fbc208, 0xd793f9c5, 0x800fe283, 0x850f0ffa,
+0x0000032c, 0x086cf162, 0x62fa5d14, 0x15086cf1,
+0xf162fa55, 0xd25c0864, 0x00f045c7, 0xb8400000,
+0x000006a6, 0x087df262, 0x62fc5d18, 0x59086cf1,
+0x6cf162d4, 0x00cbc208, 0x087cf162, 0xc5f95529,
+0x83d193f9, 0xfa800fe2, 0xe1850f0f, 0x62000002,
+0x28087cf1, 0xf162fa6d, 0x6d29087c, 0x7cf162fe,
+0xfc555a08, 0x08fdf162, 0x62f75529, 0x5a08fdf1,
+0xf162f755, 0x5529087c, 0x7ef162ff, 0xfc551008,
+0x087cf162, 0x7ae8552e, 0x625d755f, 0x10087ef1,
+0xf162fd55, 0x552e087c, 0x754d7ae9, 0x7ef1624b,
+0xfa5d1208, 0x087df262, 0x02e61518, 0xf1620000,
+0x5d5c0864, 0x0717b8fa, 0xf2620000, 0x2d18087d,
+0x000002d4, 0x086cf162, 0xf162d458, 0xd559086c,
+0x0864f162, 0xc500c2c2, 0x83d093f9, 0xfa800fe2,
+0xe90f740f, 0x00000248, 0x0006f1b8, 0x023ee900,
+0xf1620000, 0x5516087e, 0x5cf162fa, 0x62c95808,
+0x28087cf1, 0x1eb8fa5d, 0x62000007, 0x5c086cf1,
+0x74f162d3, 0x62cd5908, 0xc2086cf1, 0xf9c500d1,
+0xe283d293, 0x0ffa800f, 0x0202850f, 0xf1620000,
+0x4d10087e, 0x7cf162ed, 0xf85d2908, 0x907d8d48,
+0x00072ab8, 0x7ef16200, 0xe14d1108, 0x087ef162,
+0x62ef4d10, 0x11087ef1, 0xf162e34d, 0xc9570874,
+0xccc2f0c5, 0xf7f9c501, 0x7df162d9, 0xfb756f08,
+0x086df362, 0xc555d125, 0x62f2f7f9, 0x28087cf1,
+0xf162f84d, 0x7528087c, 0x4cf162f9, 0x00d9c208,
+0xd393f9c5, 0x800fe283, 0x850f0ffa, 0x00000190,
+0x087cf162, 0xb0fa7d28, 0x92f9c50a, 0x073ab8c8,
+0xf2620000, 0x55650945, 0x6cf162fb, 0x00e1c208,
+0xd493f9c5, 0x800fe283, 0x850f0ffa, 0x00000160,
+0x087cf162, 0xc5fa7d28, 0xb04dd0c3, 0x087cf162,
+0x62fa5528, 0x28087cf1, 0x43b8fb65, 0x62000007,
+0x5c086cf1, 0x6cf162dc, 0x62dc5809, 0xc20874f1,
+0xf9c500eb, 0xe283d593, 0x0ffa800f, 0x011e850f,
+0xf1620000, 0x5529087c, 0x74f162f7, 0xc5c95708,
+0x70957cf3, 0x62ffffff, 0x29087cf1, 0xf3c5f755,
+0xff70957c, 0xf162ffff, 0xd2c6086c, 0x7cf162ff,
+0x55152e08, 0x0f000001, 0x0000d08a, 0xca850f00,
+0x62000000, 0x28087cf1, 0xcbc5fa75, 0xb8b0557d,
+0x00000767, 0xd17cebc5, 0xd17cebc5, 0x086cf162,
+0xc500f1c2, 0x83d693f9, 0xfa800fe2, 0xad850f0f,
+0x62000000, 0x26087df3, 0x6200fa4d, 0x29087cf1,
+0xf262f74d, 0x4d42087d, 0x7cf162fa, 0xf84d2908,
+0x087ef162, 0x00d60d10, 0xc0310000, 0xf162d231,
+0xd27b086e, 0x087cf162, 0xe085542e, 0x6475667a,
+0x8d01788d, 0xfe210270, 0x8301fe83, 0xc78500d2,
+0xf1620c75, 0x4c2e087c, 0x4f7adc85, 0xff484d75,
+0xf88348c0, 0x62c77504, 0x28087cf1, 0xf162f76d,
+0x7528087c, 0x077db8fa, 0xf2620000, 0x4d2c0855,
+0x4cf162f8, 0x00f9c208, 0xd793f9c5, 0x800fe283,
+0x1c750ffa, 0xfff41ce8, 0xebd8f7ff, 0x075eb813,
+0x0ceb0000, 0x000773b8, 0xb805eb00, 0x00000778,
+0x0000c3c9, 0x00000000, 0x00000000, 0x00000000,
+0x41000000, 0x41100000, 0x41000000, 0x40a00000,
+0xc1000000, 0xc1100000, 0xc1000000, 0xc0a00000,
+0x00000000, 0x40400000, 0x40800000, 0x40400000,
+0x80000000, 0xc0400000, 0xc0800000, 0xc0400000,
+0x3f800000, 0x00000000, 0x00000000, 0x00000000,
+0x3e800000, 0xbf800000, 0x3f000000, 0x41200000,
+0006160,
+};
+asm(".type avx512dq_x86_64_D_16f4, STT_NOTYPE;");
+asm(".type avx512dq_x86_64_D_16f4, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512dq_x86_64_D_16f8[] = {
+0x0002a3e9, 0x89485500, 0xfff162e5, 0x250d1008,
+0x6200000a, 0x1008fff1, 0x0009d315, 0xfff16200,
+0xf94d1108, 0x08fff162, 0x62fa4d11, 0x1108fff1,
+0xf162fc55, 0x4d1108ff, 0xfff162fe, 0xfb551108,
+0x08fff162, 0x62fd4d11, 0x1108fff1, 0xf162ff4d,
+0x4d2808fd, 0x00a7b8fe, 0xf1620000, 0x152808fd,
+0x000009ac, 0x08fdf162, 0xf262d928, 0x5d9808f5,
+0xedf162fd, 0x00c3c208, 0xd093f9c5, 0x0f03fa80,
+0x00022185, 0xfdf16200, 0x62d92808, 0x9e08f5f2,
+0xabb8fd5d, 0x62000000, 0x2808fdf1, 0x00097f15,
+0xedf16200, 0x00cbc208, 0xd193f9c5, 0x0f03fa80,
+0x0001f185, 0xfdf16200, 0x62d92808, 0x9a08f5f2,
+0xafb8fd5d, 0x62000000, 0x2808fdf1, 0x00095f15,
+0xedf16200, 0x00d3c208, 0xd293f9c5, 0x0f03fa80,
+0x0001c185, 0xfdf16200, 0x62d92808, 0x9c08f5f2,
+0xb3b8fd5d, 0x62000000, 0x2808fdf1, 0x00093f15,
+0xedf16200, 0x00dbc208, 0xd393f9c5, 0x0f03fa80,
+0x00019185, 0xfdf16200, 0xfd552808, 0x08edf162,
+0xf162d958, 0x752808fd, 0xfff162fe, 0xf9651208,
+0x0000bbb8, 0xcdf26200, 0x62e29808, 0xc208e5f1,
+0xf9c500e4, 0xfa80d493, 0x57850f03, 0x62000001,
+0x2808fdf1, 0xf162fe75, 0xe22808fd, 0x0000c0b8,
+0xfff16200, 0xd52d1208, 0x62000008, 0x5708e5f1,
+0xcdf262dd, 0xf9659e18, 0x08e5f162, 0xc500ecc2,
+0x80d593f9, 0x850f03fa, 0x0000011a, 0x08edf162,
+0xf162c95c, 0x7d2808fd, 0xfff162fe, 0xf95d1208,
+0x0000c5b8, 0xc5f26200, 0x62da9a08, 0xc208f5f1,
+0xf9c500f3, 0xfa80d693, 0xe7850f03, 0x62000000,
+0x2808fdf1, 0xf162fe75, 0xda2808fd, 0x08f5f162,
+0xcab8cd57, 0x62000000, 0x9c18cdf2, 0xf162f95d,
+0xfbc208f5, 0x93f9c500, 0x03fa80d7, 0x00b4850f,
+0xf1620000, 0x4d5908ed, 0xfdf162fe, 0xff5d2808,
+0xf3d0f1c5, 0x08fdf162, 0x62fe6528, 0x2808fdf1,
+0x00d4b8fa, 0xf2620000, 0x7da608dd, 0xcdf162ff,
+0x00c7c208, 0xd093f9c5, 0x7503fa80, 0xe5f16279,
+0xc5dd5708, 0x62cbd0f1, 0xa708edf2, 0xd8b8ff65,
+0x62000000, 0xc208f5f1, 0xf9c500cc, 0xfa80d193,
+0x62537503, 0x5908edf1, 0xe1c5fe5d, 0x62f05dd0,
+0x2808fdf1, 0xf162ff65, 0xea2808fd, 0x0000deb8,
+0xddf26200, 0xfe6d9608, 0x08e5f162, 0xc500d5c2,
+0x80d293f9, 0x1e7503fa, 0x08ddf262, 0xb8fe5597,
+0x000000e2, 0x08f5f162, 0xc500dac2, 0x80d393f9,
+0x027503fa, 0xc35dc031, 0xe5894855, 0x70ec8348,
+0x91058b48, 0x62000007, 0x1008fff1, 0x00077725,
+0xfff16200, 0x250d1008, 0x48000007, 0x62f84589,
+0x1108fff1, 0xf162fa65, 0x4d1108ff, 0xfff162fc,
+0xfe651108, 0x08fff162, 0x62fb4d11, 0x1108fff1,
+0xf162fd65, 0x552808fd, 0xfdf162fd, 0xfa552908,
+0x08fdf162, 0xb8fa4d28, 0x00000539, 0x08f5f162,
+0xc500c2c2, 0x80d093f9, 0x850f03fa, 0x000006cc,
+0x08f5f162, 0x62fd5558, 0x2908fdf1, 0xf162fb55,
+0x5d2808fd, 0xfdf162fd, 0xfb552808, 0x00053fb8,
+0xe5f16200, 0x62db5808, 0xc208edf1, 0xf9c500d3,
+0xfa80d293, 0x91850f03, 0x62000006, 0x5c08edf1,
+0xf162fd55, 0x552908fd, 0xf5f162fc, 0xfc5dc208,
+0x0544b800, 0xf9c50000, 0xfa80d393, 0x69850f03,
+0x62000006, 0x2808fdf1, 0xf162fe55, 0x4d5908f5,
+0xedf162fd, 0x62da5908, 0x2808fdf1, 0xf162fd55,
+0x755808ed, 0xedf162fe, 0xfe6d5c08, 0x08f5f162,
+0x5bb8cb5c, 0x62000005, 0x5908d5f1, 0xf5f162ee,
+0x00e5c208, 0xd493f9c5, 0x0f03fa80, 0x00061b85,
+0xedf16200, 0xff4d5908, 0x08fdf162, 0x62fa4d29,
+0x5e08edf1, 0xf162ff55, 0xeac208f5, 0x0564b800,
+0xf9c50000, 0xfa80d593, 0xed850f03, 0x62000005,
+0x2808fdf1, 0x67b8ff4d, 0x62000005, 0x1208fff1,
+0x00062b15, 0xf5f16200, 0x62da5708, 0x5708edf1,
+0xf162fd55, 0x5d5908e5, 0xe5f162fa, 0x00f2c208,
+0xd693f9c5, 0x0f03fa80, 0x0005af85, 0xfff16200,
+0xfd55e608, 0x087ef162, 0xf162d2e6, 0x7dc208ed,
+0x6eb800fd, 0xc5000005, 0x80d793f9, 0x850f03fa,
+0x00000588, 0x08fdf262, 0x62fd554c, 0x2908fdf1,
+0xf162fa55, 0x6d2808fd, 0xfdf262fd, 0xfa554c08,
+0x08fff162, 0xf162d2e6, 0xd2e6087e, 0x000575b8,
+0xedf16200, 0x00c5c208, 0xd093f9c5, 0x0f03fa80,
+0x00054785, 0xd5f16200, 0x62d55908, 0x2908fdf1,
+0xf262fa55, 0x554e08fd, 0xfdf162fa, 0xfb552908,
+0x08fdf162, 0xb8fb5528, 0x0000057c, 0x08fdf262,
+0xf162da4c, 0xdbe608ff, 0x087ef162, 0xf162dbe6,
+0xd5c208e5, 0x93f9c500, 0x03fa80d2, 0x04fa850f,
+0xf2620000, 0x5d4c08fd, 0xfff162fd, 0x62d2e608,
+0xe608fff1, 0x7ef162db, 0x62d2e608, 0xe6087ef1,
+0xedf162db, 0x00dbc208, 0x00057eb8, 0x93f9c500,
+0x03fa80d3, 0x04c2850f, 0xf1620000, 0x557b08fd,
+0xfef162fd, 0x62d2e608, 0xc208edf1, 0xb800fd65,
+0x00000588, 0xd493f9c5, 0x0f03fa80, 0x00049b85,
+0xfcf16200, 0xfd557908, 0x087ef162, 0xf162d27a,
+0x6dc208ed, 0x8fb800fd, 0xc5000005, 0x80d593f9,
+0x850f03fa, 0x00000474, 0x08fdf162, 0x62fd5d79,
+0x7a08fef1, 0xfdf162db, 0xfd552808, 0x000596b8,
+0xe5f16200, 0x00f2c208, 0xd693f9c5, 0x0f03fa80,
+0x00044785, 0xedf16200, 0x62da5908, 0x2908fdf1,
+0xf162fa5d, 0x5d5108fd, 0xe5f162fa, 0x00fac208,
+0x00059cb8, 0x93f9c500, 0x03fa80d7, 0x041a850f,
+0xf1620000, 0xdc1208ff, 0x08e5f162, 0xf162d25e,
+0x552908fd, 0xfdf362fa, 0xfa6d0908, 0x05a4b80b,
+0xf1620000, 0x156e08fd, 0x00000454, 0x08edf162,
+0xc500cdc2, 0x80d193f9, 0x850f03fa, 0x000003dc,
+0x08fdf362, 0x0bfd5556, 0x08d5f162, 0xabb8ed57,
+0x62000005, 0xc208edf1, 0xf9c500c5, 0xfa80d093,
+0xb5850f03, 0x62000003, 0x5808e5f1, 0xf162fd55,
+0xda5e08e5, 0x08fdf162, 0x62fa5d29, 0x5608fdf3,
+0x620bfa55, 0x2808fdf1, 0xb1b8fa7d, 0x62000005,
+0xc208c5f1, 0xf9c500d2, 0xfa80d293, 0x79850f03,
+0x62000003, 0x1208fff1, 0x00037b15, 0xedf16200,
+0xfd555908, 0x08fdf162, 0x62fa5529, 0x0908fdf3,
+0x620bfa55, 0x5608fdf3, 0x620bfa5d, 0x5808edf1,
+0xfdf162d3, 0xfa752808, 0x0005bbb8, 0xcdf16200,
+0x00dac208, 0xd393f9c5, 0x0f03fa80, 0x00032b85,
+0xf5f16200, 0xfe555908, 0x08f5f162, 0x62fd5d59,
+0x2908fdf1, 0xf362fb55, 0x555008e5, 0xf36205fb,
+0x5d5008e5, 0xf16204fb, 0x5d2908fd, 0xedf162fb,
+0xfb555808, 0x08fdf162, 0xb8fd7d28, 0x0000063d,
+0x08c5f162, 0x62fe5d58, 0x5908edf1, 0xedf162d1,
+0x00e3c208, 0xd493f9c5, 0x0f03fa80, 0x0002cb85,
+0xfdf16200, 0xfd552808, 0x00064eb8, 0xedf16200,
+0x01dac608, 0x08fdf162, 0x62fe5528, 0xc208e5f1,
+0xf9c500ea, 0xfa80d593, 0x9d850f03, 0x62000002,
+0x2808fdf1, 0x53b8fd5d, 0x62000006, 0x0508fdf3,
+0xf16201eb, 0xf2c208d5, 0x93f9c500, 0x03fa80d6,
+0x0276850f, 0xf1620000, 0xdb5808ed, 0x00065db8,
+0xfff16200, 0x8d2d1008, 0x62000002, 0x1108fff1,
+0xf262f36d, 0x755908fd, 0xcdf162f3, 0x00fbc208,
+0xd793f9c5, 0x0f03fa80, 0x00023f85, 0xedf16200,
+0xfa5d1608, 0x08fdf162, 0x62fd7528, 0x1508edf1,
+0xe5f162d6, 0x62d25c08, 0x1108fff1, 0xa6b8f365,
+0x62000006, 0x5908fdf2, 0xf162f35d, 0xd15908ed,
+0x08edf162, 0x6200cbc2, 0x2908fdf1, 0xf9c5fc55,
+0xfa80d193, 0xf1850f03, 0xf2000001, 0xd055120f,
+0x18f5f162, 0x023e1d58, 0xf1620000, 0x652808fd,
+0x0717b8fd, 0xf1620000, 0xd45c08ed, 0x18e5f162,
+0x01da1d59, 0xf1620000, 0xc3c208ed, 0x93f9c500,
+0x03fa80d0, 0x01b2850f, 0xf1620000, 0x551008ff,
+0xfdf162fd, 0xfb652908, 0xc07d8d48, 0x00072ab8,
+0xfff16200, 0xf7551108, 0x08edf162, 0xe9c5d257,
+0xc501c9c2, 0x62e1f7f9, 0x6f08fdf1, 0xf362fe7d,
+0xd9250865, 0xf7f9c555, 0xfdf162fb, 0xfb4d2808,
+0x08fdf162, 0x62fc7d28, 0xc208c5f1, 0xf9c500d1,
+0xfa80d293, 0x51850f03, 0x62000001, 0x2808fdf1,
+0xaab0fd75, 0xc892f9c5, 0x00073ab8, 0xcdf26200,
+0xfe5d6509, 0x08e5f162, 0xc500d9c2, 0x80d393f9,
+0x850f03fa, 0x00000124, 0x08fdf162, 0xc5fd7d28,
+0xe04dd0c1, 0x08fdf162, 0x62fd5d28, 0x2808fdf1,
+0x43b8fe75, 0x62000007, 0x5c08e5f1, 0xe5f162e6,
+0x62e65809, 0xc208f5f1, 0xf9c500e4, 0xfa80d493,
+0xe5850f03, 0x62000000, 0x2908fdf1, 0xe9c5fa5d,
+0x62a04d7c, 0x1508f5f1, 0xfdf162c9, 0x0fcd2e08,
+0x0000b48a, 0xae850f00, 0x62000000, 0x2808fdf1,
+0xc1c5fd7d, 0xb8e04d7d, 0x00000767, 0xca7cf1c5,
+0x08f5f162, 0xc500eac2, 0x80d593f9, 0x850f03fa,
+0x00000098, 0x08fdf362, 0x00fd4d26, 0x08fdf162,
+0x62fa4d29, 0x4208fdf2, 0xf162fd55, 0x552908fd,
+0xedf162fb, 0x62d25708, 0x2e08fdf1, 0x607af655,
+0xf1625e75, 0x151008ff, 0x000000ac, 0x08fdf162,
+0x7af4552e, 0x62507552, 0x2e08fdf1, 0x407af755,
+0xf1623e75, 0x552e08fd, 0x753c7af5, 0xf5f2623a,
+0xfb4d2c08, 0x08fdf162, 0xb8fd7d28, 0x0000077d,
+0x08c5f162, 0xc500f1c2, 0x80d693f9, 0x1c7503fa,
+0xfff630e8, 0xebd8f7ff, 0x075eb813, 0x0ceb0000,
+0x000773b8, 0xb805eb00, 0x00000778, 0x0000c3c9,
+0x00000000, 0x40000000, 0x00000000, 0x3fd00000,
+0x00000000, 0x3fe00000, 0x00000000, 0x00000000,
+0x00000000, 0x40100000, 0x00000000, 0x40080000,
+0x00000000, 0xc0100000, 0x00000000, 0xc0080000,
+0x00000000, 0x00000000, 0x00000000, 0x3ff00000,
+0x00000000, 0x80000000, 0x00000000, 0xbff00000,
+0x00000000, 0x3ff00000, 0x00000000, 0x00000000,
+0005140,
+};
+asm(".type avx512dq_x86_64_D_16f8, STT_NOTYPE;");
+asm(".type avx512dq_x86_64_D_16f8, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512dq_x86_64_D_32i4[] = {
+0xb85500eb, 0x00000001, 0x000020bf, 0x09bb4100,
+0x48000000, 0x8348e589, 0x8148e0e4, 0x0000e8ec,
+0xff488d00, 0x89d98945, 0x89248444, 0xc12941ca,
+0x4401e283, 0x44844c89, 0x1901fa83, 0xd23145f6,
+0xff02e683, 0x41c885ce, 0xc1c2940f, 0x748903e2,
+0xe9d16484, 0x09d72944, 0x84bc89ca, 0x00000084,
+0xa4849489, 0x83000000, 0x948904c2, 0x0000c484,
+0xc0ff4800, 0x09f88348, 0xf162a775, 0xb46f287d,
+0x00002824, 0x7df16200, 0x24b47f28, 0xffffffc8,
+0x287df162, 0xc8248c6f, 0xb8ffffff, 0x00000539,
+0x2875f362, 0xc500c61f, 0xfed093f9, 0x58850fc2,
+0x62000007, 0xfe2875f1, 0x00282494, 0xf1620000,
+0x947f287d, 0xffffe824, 0x7df162ff, 0x24946f28,
+0xffffffe8, 0x2865f162, 0x2824b472, 0x01000000,
+0x00053fb8, 0x6df36200, 0x00d31f28, 0xd293f9c5,
+0x850fc2fe, 0x00000713, 0x286df162, 0x282494fa,
+0x62000000, 0x7f287df1, 0x00082494, 0xf3620000,
+0x9c1f2875, 0x00000824, 0x44b80000, 0xc5000005,
+0xfed393f9, 0xe0850fc2, 0x62000006, 0x6f287df1,
+0x004824bc, 0xf2620000, 0x8c402875, 0x00002824,
+0x45f26200, 0x62df4028, 0x6f287df1, 0x002824a4,
+0xf1620000, 0xeffe285d, 0x285df162, 0x482494fa,
+0x62000000, 0xfa2875f1, 0x055bb8cb, 0xf2620000,
+0xd540286d, 0x2875f362, 0x6200e21f, 0x7f287df1,
+0x00082494, 0xf9c50000, 0xc2fed493, 0x0679850f,
+0xf2620000, 0x8c40285d, 0x00004824, 0x75f36200,
+0x782d1f28, 0x00000006, 0xa42444c7, 0x00000002,
+0x0005c8b8, 0x93f9c500, 0x0fc2fed5, 0x00064a85,
+0x5df16200, 0x248cef28, 0x00000068, 0x287df162,
+0xc8248c7f, 0x62ffffff, 0x2828f5f2, 0x0048248c,
+0xf1620000, 0x8c7f287d, 0xffffe824, 0x48c031ff,
+0xc8045463, 0x044c6348, 0xaf0f4848, 0x045489d1,
+0xeac14808, 0x04548920, 0xc083480c, 0xf8834808,
+0x62dc7520, 0x6f287df1, 0xffe824b4, 0xe1b8ffff,
+0x62000005, 0x76284df1, 0x000824b4, 0xf9c50000,
+0xc2fed693, 0x05d1850f, 0xf2620000, 0x9440285d,
+0x00006824, 0x7df16200, 0x24947f28, 0x00000008,
+0x2875f162, 0x0824b472, 0x03000000, 0x287df162,
+0xc8248c7f, 0x62ffffff, 0x722865f1, 0x000824b4,
+0x62020000, 0xfe2865f1, 0x05edb8eb, 0xf3620000,
+0xfd1f2875, 0x93f9c500, 0x0fc2fed7, 0x00057a85,
+0x75f16200, 0x24a47228, 0xffffffc8, 0x75f16202,
+0xb8c9fe28, 0x000005f2, 0x2865f362, 0xc500c11f,
+0xfed093f9, 0x50850fc2, 0xc7000005, 0x03a42444,
+0x48000000, 0xa4244463, 0x08fdf162, 0xf162c86e,
+0xc9f2286d, 0xa42444c7, 0x00000002, 0x24446348,
+0xfdf162a4, 0x62f86e08, 0xf2286df1, 0x6df162d7,
+0xb8dafe28, 0x00000605, 0x2875f362, 0xc500d31f,
+0xfed293f9, 0x00850fc2, 0x48000005, 0xa4244463,
+0x08fdf162, 0xf162f06e, 0xcee22875, 0x2875f162,
+0x09b8c9fe, 0x62000006, 0x1f286df3, 0xf9c500d9,
+0xc2fed393, 0x04d1850f, 0xf1620000, 0xbc6f287d,
+0x00008824, 0x75f16200, 0x62c9ef08, 0x1f2845f3,
+0xf26206c9, 0x9440a95d, 0x00006824, 0x6df26200,
+0x249c4728, 0x00000088, 0x287df162, 0x8824b46f,
+0xb8000000, 0x00000001, 0x287df262, 0xf162c87c,
+0xc9fa284d, 0x287df162, 0x88248c7f, 0x62000000,
+0x47286df2, 0x0088248c, 0x21b80000, 0x62000006,
+0xfe2875f1, 0x65f362e9, 0x00e51f28, 0xd493f9c5,
+0x850fc2fe, 0x00000453, 0x2875f262, 0x88248c46,
+0xb8000000, 0x00000626, 0x2875f362, 0xc500ea1f,
+0xfed593f9, 0x30850fc2, 0x62000004, 0x6f287df1,
+0x006824ac, 0xf2620000, 0x8c402855, 0x00004824,
+0x55f26200, 0x249c4028, 0x00000028, 0x287df162,
+0xe8248c7f, 0x62ffffff, 0x3d2865f2, 0xffe82494,
+0xf262ffff, 0x9c392865, 0xffffe824, 0x7df162ff,
+0x249c7f28, 0xffffffe8, 0x286df162, 0xe82494fe,
+0x62ffffff, 0xfe285df1, 0x0048248c, 0x3db80000,
+0x62000006, 0x40286df2, 0x6df362d5, 0x00f11f28,
+0xd693f9c5, 0x850fc2fe, 0x000003af, 0x285df262,
+0xf162cd40, 0x8c7f287d, 0xffffc824, 0x7df262ff,
+0x248c1e28, 0xffffffc8, 0x2875f362, 0xb800fc1f,
+0x00000644, 0xd793f9c5, 0x850fc2fe, 0x0000037b,
+0x287df162, 0x2824bc6f, 0x62000000, 0x6f287df1,
+0x0048249c, 0x4eb80000, 0x62000006, 0x432845f3,
+0xf16201d7, 0xd270287d, 0x6df3621b, 0x00c31f28,
+0xd093f9c5, 0x850fc2fe, 0x0000033f, 0x000001b8,
+0x7df16200, 0x248c6f28, 0x00000028, 0x287df262,
+0x53b8d07c, 0x62000006, 0xfa2865f1, 0x6df262d2,
+0x62d13628, 0x1f286df3, 0xf9c500d3, 0xc2fed293,
+0x0305850f, 0xf1620000, 0xd1fe2865, 0xb82444c7,
+0x00000009, 0x00065db8, 0x7df26200, 0x24645828,
+0x5df362ee, 0x00da1f28, 0xd393f9c5, 0x850fc2fe,
+0x000002d7, 0x000009b8, 0x7df26200, 0x62e07c28,
+0x1f285df3, 0x61b800e2, 0xc5000006, 0xfed493f9,
+0xb4850fc2, 0x62000002, 0x39287df3, 0xffb8248c,
+0x6200ffff, 0x5a287df2, 0xffb82494, 0xf362ffff,
+0xa4382875, 0xffffb824, 0xf36201ff, 0xec1f286d,
+0x93f9c500, 0xb8c0fec5, 0x0000066c, 0x0279850f,
+0xf3620000, 0xd1210875, 0x7df3620e, 0x01c81608,
+0x086df362, 0x6201d022, 0x7f087df1, 0xffb82494,
+0xf262ffff, 0x5459287d, 0xf162f724, 0xa470087d,
+0xffffb824, 0x0cb044ff, 0xc892f9c5, 0x2975f362,
+0xb000cc38, 0x92f9c530, 0x75f362c8, 0x248c3829,
+0xffffffb8, 0x7df16201, 0x24a47008, 0xffffffb8,
+0xc5c0b044, 0x62c892f9, 0x382975f3, 0xf36201cc,
+0xf11f286d, 0x93f9c500, 0xb8c0fec6, 0x0000067c,
+0x01f5850f, 0xf1620000, 0x946f287d, 0x0000a824,
+0x7df16200, 0x62e36f28, 0x7e286df2, 0x002824a4,
+0xf1620000, 0xb46f287d, 0x0000c824, 0x4df26200,
+0x249c7e28, 0x00000028, 0x285df162, 0x44c7dbfa,
+0x0004b824, 0xa6b80000, 0x62000006, 0x402865f2,
+0x7df262dd, 0x244c5828, 0x65f362ee, 0x00f91f28,
+0xd793f9c5, 0x850fc2fe, 0x0000018f, 0x2875f162,
+0x621fe572, 0x402855f2, 0x0028249c, 0xf1620000,
+0x9c7f287d, 0xffffc824, 0x65f262ff, 0x62d17628,
+0x7f287df1, 0xffe82494, 0xf162ffff, 0xbc6f287d,
+0xffffc824, 0x7df362ff, 0x24bc3928, 0xffffffb8,
+0x7df26200, 0x248c2528, 0xffffffb8, 0x287df162,
+0x08248c7f, 0x62000000, 0x1f2875f3, 0xb3b800c2,
+0xc5000006, 0xfed093f9, 0x1c850fc2, 0x62000001,
+0x6f287df1, 0x0028248c, 0xf3620000, 0x8c39287d,
+0xffffb824, 0xf16200ff, 0xb46f087d, 0xffffb824,
+0x7df162ff, 0x24b47f08, 0xffffffa8, 0x287df262,
+0xa8249425, 0x62ffffff, 0x7f287df1, 0xffc82494,
+0xf162ffff, 0xbc6f287d, 0xffffc824, 0x7ef262ff,
+0x24bc3528, 0xffffffb8, 0x7c8bc031, 0x7c392804,
+0x0a74b804, 0x0006f1b8, 0x00ade900, 0x83480000,
+0x834804c0, 0xe27510f8, 0x4c24448b, 0x287df162,
+0xe8248c7f, 0x89ffffff, 0x8bec2444, 0x89542444,
+0x8bf42444, 0x895c2444, 0x8bfc2444, 0x89642444,
+0x62042444, 0x6f287df1, 0x0028248c, 0xaab00000,
+0xc892f9c5, 0x00073ab8, 0x75f26200, 0x24946429,
+0x00000048, 0x286df362, 0xe824941f, 0x00ffffff,
+0xd293f9c5, 0x4375c2fe, 0x2875f362, 0xb801d903,
+0x00000007, 0x000000ba, 0x7df26200, 0xb8d07c28,
+0x00000001, 0x2875f162, 0xf262cadb, 0xd07c287d,
+0x2875f162, 0xf362cafe, 0xd91f2865, 0x93f9c500,
+0xb8c0fec3, 0x0000074a, 0xc9c2440f, 0x000000c3,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000008, 0x0000000e, 0x00000012, 0x00000014,
+0x00000014, 0x00000012, 0x0000000e, 0x00000008,
+0004100,
+};
+asm(".type avx512dq_x86_64_D_32i4, STT_NOTYPE;");
+asm(".type avx512dq_x86_64_D_32i4, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512dq_x86_64_D_32u4[] = {
+0x315500eb, 0x0020bec0, 0xbb410000, 0x00000008,
+0x48e58948, 0x48e0e483, 0x00e8ec81, 0x788d0000,
+0x45c28901, 0xc189d989, 0x83c12941, 0x314501e2,
+0x41c785d2, 0x44c2940f, 0xd1ff428d, 0x847c89e9,
+0x03e2c128, 0x44d62944, 0x48844c89, 0x8944ca09,
+0x89688444, 0x00a88494, 0xc2830000, 0x84b48904,
+0x00000088, 0xc8849489, 0x48000000, 0x8348c0ff,
+0xaa7508f8, 0x287df162, 0x2824bc6f, 0x62000000,
+0x7f287df1, 0xffc824bc, 0xf162ffff, 0x946f287d,
+0xffffc824, 0x0539b8ff, 0xf3620000, 0xc71f286d,
+0x93f9c500, 0x0fc2fed0, 0x0006c885, 0x6df16200,
+0x248cfe28, 0x00000028, 0x287df162, 0xe8248c7f,
+0x62ffffff, 0x6f287df1, 0xffe8248c, 0xf162ffff,
+0xb4722865, 0x00002824, 0x3fb80100, 0x62000005,
+0x1f2875f3, 0xf9c500d3, 0xc2fed293, 0x0683850f,
+0xf1620000, 0x8cfa2875, 0x00002824, 0x7df16200,
+0x248c7f28, 0x00000008, 0x287df162, 0x08249c6f,
+0xb8000000, 0x00000544, 0x286df362, 0xc500db1f,
+0xfed393f9, 0x4a850fc2, 0x62000006, 0xeb286df1,
+0x00482494, 0xf1620000, 0x947f287d, 0xffffc824,
+0x75f162ff, 0x248cdb28, 0x00000048, 0x2865f162,
+0x482494ef, 0x62000000, 0x7f287df1, 0x00082494,
+0xf1620000, 0x8cdf2875, 0xffffc824, 0x0550b8ff,
+0xf3620000, 0xe21f2875, 0x93f9c500, 0x0fc2fed4,
+0x0005f085, 0x7df16200, 0x24946f28, 0x00000028,
+0x286df262, 0x48248c40, 0x62000000, 0x1f2875f3,
+0x0005da2d, 0x44c70000, 0x0002a424, 0xc8b80000,
+0xc5000005, 0xfed593f9, 0xb6850fc2, 0x62000005,
+0xef286df1, 0x0068248c, 0xf1620000, 0x8c7f287d,
+0xffffc824, 0xf5f162ff, 0x248cf428, 0x00000048,
+0x287df162, 0xe8248c7f, 0x31ffffff, 0x04548bc0,
+0x044c8bc8, 0xaf0f4848, 0x045489d1, 0xeac14808,
+0x04548920, 0xc083480c, 0xf8834808, 0x62de7520,
+0x6f287df1, 0xffe824b4, 0xe1b8ffff, 0x62000005,
+0x76284df1, 0x000824b4, 0xf9c50000, 0xc2fed693,
+0x053f850f, 0xf1620000, 0x947f287d, 0x00000824,
+0x75f16200, 0x24b47228, 0x00000008, 0x7df16203,
+0x248c7f28, 0xffffffc8, 0x2865f162, 0x0824b472,
+0x02000000, 0x2865f162, 0xedb8e3fe, 0x62000005,
+0x1f2875f3, 0xf9c500fc, 0xc2fed793, 0x04f3850f,
+0xf1620000, 0x94722875, 0xffffc824, 0xf16202ff,
+0xc9fe2875, 0x0005f2b8, 0x65f36200, 0x00c11f28,
+0xd093f9c5, 0x850fc2fe, 0x000004c9, 0xa42444c7,
+0x00000003, 0x087df162, 0xe9244c6e, 0x286df162,
+0x44c7c9f2, 0x0002a424, 0xf1620000, 0x5c6e087d,
+0xf162e924, 0xdbf2286d, 0x2865f162, 0x05b8e3fe,
+0x62000006, 0x1f2875f3, 0xf9c500d4, 0xc2fed293,
+0x047f850f, 0xf1620000, 0x646e087d, 0xf162e924,
+0xccd22875, 0x2875f162, 0x09b8c9fe, 0x62000006,
+0x1f2865f3, 0xf9c500d9, 0xc2fed393, 0x0453850f,
+0xf1620000, 0xdbef0865, 0xed76d5c5, 0x287df162,
+0xe5c5e26f, 0x88249c76, 0x62000000, 0x252855f3,
+0xf26240e3, 0x8c47285d, 0x00008824, 0x55f16200,
+0x249cfe28, 0x00000088, 0x287df162, 0x88249c7f,
+0x62000000, 0x47285df2, 0x0088249c, 0x21b80000,
+0x62000006, 0xfe2865f1, 0x75f362f3, 0x00e61f28,
+0xd493f9c5, 0x850fc2fe, 0x000003e9, 0x2865f262,
+0x88249c45, 0xb8000000, 0x00000626, 0x2865f362,
+0xc500ec1f, 0xfed593f9, 0xc6850fc2, 0x62000003,
+0x3b286df2, 0x0048249c, 0xf2620000, 0x8c3f286d,
+0x00004824, 0x6df16200, 0x2494fe28, 0x00000048,
+0x2865f162, 0x34b8d9fe, 0x62000006, 0x1f2865f3,
+0xf9c500f2, 0xc2fed693, 0x0387850f, 0xf1620000,
+0xbc6f287d, 0x00002824, 0x7df16200, 0x24946f28,
+0x00000048, 0x00064eb8, 0x45f36200, 0x01df4328,
+0x287df162, 0x621bdb70, 0x1f2865f3, 0xf9c500fa,
+0xc2fed793, 0x034b850f, 0xf1620000, 0x8c6f287d,
+0x00002824, 0x6df16200, 0xb8ddfe28, 0x00000653,
+0x2865f262, 0xf362d936, 0xc21f2865, 0x93f9c500,
+0x0fc2fed0, 0x00031c85, 0x6df16200, 0xc7d9fe28,
+0x09b82444, 0xb8000000, 0x0000065d, 0x287df262,
+0xee246458, 0x285df362, 0xc500d31f, 0xfed293f9,
+0xee850fc2, 0xb8000002, 0x00000009, 0x287df262,
+0xf362e07c, 0xdb1f285d, 0x0661b800, 0xf9c50000,
+0xc2fed393, 0x02cb850f, 0xf3620000, 0x8c39287d,
+0xffffb824, 0xf26200ff, 0x9c5a287d, 0xffffb824,
+0x75f362ff, 0x24a43828, 0xffffffb8, 0x65f36201,
+0x00e41f28, 0xc493f9c5, 0x6cb8c0fe, 0x0f000006,
+0x00029085, 0x75f36200, 0x0ed92108, 0x087df362,
+0x6201c816, 0x220865f3, 0xf16201d8, 0x9c7f087d,
+0xffffb824, 0x7df262ff, 0x245c5928, 0x7df162f7,
+0x24a47008, 0xffffffb8, 0xc50cb044, 0x62c892f9,
+0x382975f3, 0x30b000cc, 0xc892f9c5, 0x2975f362,
+0xb8248c38, 0x01ffffff, 0x087df162, 0xb824a470,
+0x44ffffff, 0xf9c5c0b0, 0xf362c892, 0xcc382975,
+0x65f36201, 0x00e91f28, 0xc593f9c5, 0x7cb8c0fe,
+0x0f000006, 0x00020c85, 0x7df16200, 0x249c6f28,
+0x000000a8, 0x287df162, 0xf262e26f, 0xa47e2865,
+0x00002824, 0x7df16200, 0x24b46f28, 0x000000c8,
+0x284df262, 0x2824947e, 0x62000000, 0xfe2855f1,
+0x6df362ca, 0x24942528, 0x00000068, 0x06a6b855,
+0x44c70000, 0x0004b824, 0xf1620000, 0xccfa2875,
+0x2875f162, 0x68248cef, 0x62000000, 0xfa2875f1,
+0x7df262ca, 0x24545828, 0x75f362ee, 0x00f21f28,
+0xd693f9c5, 0x850fc2fe, 0x00000189, 0x287df162,
+0x28248c6f, 0x62000000, 0xef086df1, 0x65f262d2,
+0x62ca7e28, 0x762875f2, 0x7df162da, 0x248c7f28,
+0xffffffe8, 0x287df162, 0x08249c7f, 0x62000000,
+0x6f287df1, 0x002824bc, 0xf3620000, 0xbc39287d,
+0xffffb824, 0xf26200ff, 0x9435287d, 0xffffb824,
+0x6df362ff, 0x00f91f28, 0x0006d3b8, 0x93f9c500,
+0x0fc2fed7, 0x00011c85, 0x7df16200, 0x248c6f28,
+0x00000028, 0x287df362, 0xb8248c39, 0x00ffffff,
+0x087df162, 0xb824ac6f, 0x62ffffff, 0x7f087df1,
+0xffa824ac, 0xf262ffff, 0x9435287d, 0xffffa824,
+0x7df162ff, 0x24947f28, 0xffffffc8, 0x287df162,
+0xc824b46f, 0x62ffffff, 0x35287ef2, 0xffb824b4,
+0xc031ffff, 0x2804748b, 0xb8047439, 0xf1b80a74,
+0xe9000006, 0x000000ad, 0x04c08348, 0x10f88348,
+0x448be275, 0xf1624c24, 0x8c7f287d, 0xffffe824,
+0x244489ff, 0x24448bec, 0x24448954, 0x24448bf4,
+0x2444895c, 0x24448bfc, 0x24448964, 0x7df16204,
+0x248c6f28, 0x00000028, 0xf9c5aab0, 0x3ab8c892,
+0x62000007, 0x642975f2, 0x00482494, 0xf3620000,
+0x841f286d, 0xffffe824, 0xf9c500ff, 0xc2fed093,
+0xf3624375, 0xd9032875, 0x0007b801, 0x00ba0000,
+0x62000000, 0x7c287df2, 0x0001b8d0, 0xf1620000,
+0xcadb2875, 0x287df262, 0xf162d07c, 0xcafe2875,
+0x2865f362, 0xc500d11f, 0xfec293f9, 0x074ab8c0,
+0x440f0000, 0x00c3c9c2, 0x00000000, 0x00000000,
+0x00000008, 0x0000000e, 0x00000012, 0x00000014,
+0x00000014, 0x00000012, 0x0000000e, 0x00000008,
+0003640,
+};
+asm(".type avx512dq_x86_64_D_32u4, STT_NOTYPE;");
+asm(".type avx512dq_x86_64_D_32u4, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512dq_x86_64_D_32i8[] = {
+0xb85500eb, 0x00000001, 0x000040bf, 0x05ba4100,
+0x48000000, 0x8348e589, 0x8148e0e4, 0x0000c8ec,
+0xff488d00, 0x48d0894d, 0x89c40489, 0xc02949ca,
+0x4c01e283, 0x20c44489, 0x4801fa83, 0x3145f619,
+0x02e683c9, 0x85ceff48, 0x940f41c1, 0x02e2c1c1,
+0xc4748948, 0x44e9d140, 0xca09cf29, 0x8948fe89,
+0x0080c494, 0x83480000, 0x894802c2, 0x4860c474,
+0xa0c49489, 0x48000000, 0x8348c0ff, 0xa17505f8,
+0x28fdf162, 0x0824bc6f, 0x62000000, 0x7f28fdf1,
+0xffa824bc, 0xf162ffff, 0x8c6f28fd, 0xffffa824,
+0x0539b8ff, 0xf3620000, 0xc71f28f5, 0x93f9c500,
+0x0ffa80d0, 0x059b850f, 0xf1620000, 0x94d428f5,
+0x00000824, 0xfdf16200, 0x24947f28, 0xffffffc8,
+0x28fdf162, 0xc824946f, 0x62ffffff, 0x7328e5f1,
+0x000824b4, 0xb8010000, 0x0000053f, 0x28edf362,
+0xc500d31f, 0x80d293f9, 0x850f0ffa, 0x00000555,
+0x28edf162, 0x082494fb, 0x62000000, 0x7f28fdf1,
+0xffe82494, 0xf362ffff, 0x9c1f28f5, 0xffffe824,
+0x44b800ff, 0xc5000005, 0x80d393f9, 0x850f0ffa,
+0x00000521, 0x28fdf162, 0x2824b46f, 0x62000000,
+0x4028f5f2, 0x0008248c, 0xf2620000, 0xd64028cd,
+0x28fdf162, 0x0824ac6f, 0x62000000, 0xd428d5f1,
+0xd5f162e6, 0x249cfb28, 0x00000028, 0x28f5f162,
+0x5bb8cafb, 0x62000005, 0x4028e5f2, 0xf5f362dc,
+0x00e31f28, 0xd493f9c5, 0x0f0ffa80, 0x0004c485,
+0xd5f26200, 0x248c4028, 0x00000028, 0x28f5f362,
+0x04b92d1f, 0xb8000000, 0x000005c8, 0xd593f9c5,
+0x0f0ffa80, 0x00049c85, 0xfdf16200, 0x249c6f28,
+0x00000048, 0x28d5f262, 0xf162d340, 0x947f28fd,
+0xffffe824, 0xf5f162ff, 0x24b47328, 0xffffffe8,
+0xfdf16203, 0x248c7f28, 0xffffffa8, 0x28ddf162,
+0xe824b473, 0x02ffffff, 0x28ddf162, 0xedb8f4d4,
+0x62000005, 0x1f28f5f3, 0xf9c500f6, 0xfa80d693,
+0x3e850f0f, 0x62000004, 0x7228f5f1, 0xffa824a4,
+0x6202ffff, 0xd428f5f1, 0x05f2b8c9, 0xf3620000,
+0xf91f28dd, 0x93f9c500, 0x0ffa80d7, 0x0413850f,
+0x44c70000, 0x00039424, 0x63480000, 0x62942444,
+0x6e08fdf1, 0xedf162c8, 0xc7c9f328, 0x02942444,
+0x48000000, 0x94244463, 0x08fdf162, 0xf162f86e,
+0xd7f328ed, 0x28edf162, 0x05b8e2d4, 0x62000006,
+0x1f28f5f3, 0xf9c500c4, 0xfa80d093, 0xc2850f0f,
+0x48000003, 0x94244463, 0x08fdf162, 0xf162f06e,
+0xcee228f5, 0x28f5f162, 0x09b8c9d4, 0x62000006,
+0x1f28edf3, 0xf9c500d1, 0xfa80d293, 0x92850f0f,
+0x62000003, 0x6f28fdf1, 0x006824bc, 0xf1620000,
+0xc9ef08f5, 0x28c5f362, 0x6206c91f, 0x40a9d5f2,
+0xfdf162cb, 0x248c7f28, 0xffffffe8, 0x28f5f262,
+0x6824a447, 0xb8000000, 0x00000001, 0x28fdf162,
+0x6824b46f, 0x62000000, 0x7c28fdf2, 0xcdf162d0,
+0x62d2fb28, 0x7f28fdf1, 0x00682494, 0xf2620000,
+0x8c4728f5, 0x00006824, 0x0621b800, 0xf1620000,
+0x8c7f28fd, 0xffffc824, 0xf5f162ff, 0x62c9d428,
+0x1f28ddf3, 0xf9c500d9, 0xfa80d393, 0x02850f0f,
+0x62000003, 0x6f28fdf1, 0xffc824bc, 0xf262ffff,
+0x8c4628c5, 0x00006824, 0x0626b800, 0xf3620000,
+0xa41f28f5, 0xffffe824, 0xf9c500ff, 0xfa80d493,
+0xce850f0f, 0x62000002, 0x6f28fdf1, 0x00282494,
+0xf2620000, 0xe34028d5, 0x28edf262, 0xf162cb40,
+0xa47f28fd, 0xffffa824, 0xfdf162ff, 0x248c7f28,
+0xffffffc8, 0x28ddf262, 0xc8248c3d, 0x62ffffff,
+0x3928ddf2, 0xffc824a4, 0xf162ffff, 0xa47f28fd,
+0xffffc824, 0xf5f162ff, 0x248cd428, 0xffffffc8,
+0x28d5f162, 0x3db8e2d4, 0x62000006, 0x4028f5f2,
+0xf5f362cb, 0x00ec1f28, 0xd593f9c5, 0x0f0ffa80,
+0x00025085, 0xfdf26200, 0x248c1f28, 0xffffffa8,
+0x28f5f362, 0xb800f51f, 0x00000644, 0xd693f9c5,
+0x0f0ffa80, 0x00022c85, 0xfdf16200, 0x24b46f28,
+0x00000008, 0x00064eb8, 0xcdf36200, 0x01ce4328,
+0x287df162, 0x624ec970, 0x1f28f5f3, 0xf9c500fa,
+0xfa80d793, 0xfa850f0f, 0xb8000001, 0x00000001,
+0x28fdf262, 0x53b8c87c, 0x62000006, 0xfb28edf1,
+0xf5f262c9, 0x248c3628, 0x00000008, 0x28f5f362,
+0xc500c21f, 0x80d093f9, 0x850f0ffa, 0x000001c5,
+0x28fdf362, 0x08248c00, 0x1b000000, 0x000658b8,
+0xf5f36200, 0x00ca1f28, 0xd193f9c5, 0x0f0ffa80,
+0x0001a085, 0xfdf16200, 0x248c6f28, 0x00000008,
+0x00065db8, 0x44c74800, 0x00059824, 0xf2620000,
+0x6c5928fd, 0xf162f324, 0xe2d428f5, 0x28d5f362,
+0xc500d41f, 0x80d293f9, 0x850f0ffa, 0x00000165,
+0x000005b8, 0xfdf26200, 0x62e87c28, 0x1f28d5f3,
+0x61b800dc, 0xc5000006, 0x80d393f9, 0x850f0ffa,
+0x00000141, 0x28fdf362, 0x98248c39, 0x00ffffff,
+0x28fdf262, 0x9824a45a, 0x62ffffff, 0x3828f5f3,
+0xff98248c, 0x6201ffff, 0x1f28ddf3, 0xf9c500e1,
+0x0f3cc493, 0x6cb80a74, 0xe9000006, 0x00000105,
+0x28fdf162, 0x88248c6f, 0x62000000, 0x7628edf2,
+0x0008248c, 0xf1620000, 0xbc6f28fd, 0x0000a824,
+0xc5f26200, 0x24947e28, 0x00000008, 0x28f5f162,
+0xa6b8cafb, 0x48000006, 0x982444c7, 0x00000002,
+0x28f5f262, 0xf262cb40, 0x545928fd, 0xf362f324,
+0xea1f28f5, 0x93f9c500, 0x0ffa80d5, 0x00a3850f,
+0x8b480000, 0x62302444, 0x6f28fdf1, 0x000824b4,
+0xf1620000, 0xb47f28fd, 0xffffc824, 0x448948ff,
+0x8b48d024, 0x48402444, 0xe0244489, 0x28fdf162,
+0x08248c6f, 0xb0000000, 0x92f9c5aa, 0x073ab8c8,
+0xf2620000, 0x946429f5, 0x00002824, 0xedf36200,
+0x24b41f28, 0xffffffc8, 0x93f9c500, 0x0ffa80d6,
+0xf3624375, 0xd90328f5, 0x0003b801, 0x00ba0000,
+0x62000000, 0x7c28fdf2, 0x0001b8d0, 0xf1620000,
+0xcadb28f5, 0x28fdf262, 0xf162d07c, 0xcad428f5,
+0x28e5f362, 0xc500f91f, 0x3cc793f9, 0x074ab80f,
+0x440f0000, 0x00c3c9c2, 0x00000000, 0x00000000,
+0x00000004, 0x00000000, 0x00000006, 0x00000000,
+0x00000006, 0x00000000, 0x00000004, 0x00000000,
+0003200,
+};
+asm(".type avx512dq_x86_64_D_32i8, STT_NOTYPE;");
+asm(".type avx512dq_x86_64_D_32i8, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512dq_x86_64_D_32u8[] = {
+0xb85500eb, 0x00000001, 0x000040be, 0x05ba4100,
+0x48000000, 0x8348e589, 0x8148e0e4, 0x0000c8ec,
+0xff488d00, 0x45d0894d, 0x8948c931, 0xca89c404,
+0x83c02949, 0xc18501e2, 0xc444894c, 0x940f4120,
+0xff7a8dc1, 0xe2c1e9d1, 0xff634802, 0x09ce2944,
+0x7c8948ca, 0xf78940c4, 0xc4948948, 0x00000080,
+0x02c28348, 0xc47c8948, 0x94894860, 0x0000a0c4,
+0xc0ff4800, 0x05f88348, 0xf162a775, 0xb46f28fd,
+0x00000824, 0xfdf16200, 0x24b47f28, 0xffffffa8,
+0x28fdf162, 0xa824946f, 0xb8ffffff, 0x00000539,
+0x28edf362, 0xc500c61f, 0x80d093f9, 0x850f0ffa,
+0x0000052f, 0x28edf162, 0x08248cd4, 0x62000000,
+0x7f28fdf1, 0xffc8248c, 0xf162ffff, 0x8c6f28fd,
+0xffffc824, 0xe5f162ff, 0x24b47328, 0x00000008,
+0x053fb801, 0xf3620000, 0xd31f28f5, 0x93f9c500,
+0x0ffa80d2, 0x04e9850f, 0xf1620000, 0x8cfb28f5,
+0x00000824, 0xfdf16200, 0x248c7f28, 0xffffffe8,
+0x28fdf162, 0xe8249c6f, 0xb8ffffff, 0x00000544,
+0x28edf362, 0xc500db1f, 0x80d393f9, 0x850f0ffa,
+0x000004af, 0x28edf162, 0x282494eb, 0x62000000,
+0x7f28fdf1, 0xffa82494, 0xf162ffff, 0x8cdb28f5,
+0x00002824, 0xe5f16200, 0x249cef28, 0x00000028,
+0x28f5f162, 0xa8248cdf, 0xb8ffffff, 0x00000550,
+0x28f5f362, 0xc500e31f, 0x80d493f9, 0x850f0ffa,
+0x0000045f, 0x28fdf162, 0x0824946f, 0x62000000,
+0x4028edf2, 0x0028248c, 0xf3620000, 0x2d1f28f5,
+0x0000045b, 0x05c8b800, 0xf9c50000, 0xfa80d593,
+0x2c850f0f, 0x62000004, 0x7f28fdf1, 0xffe82494,
+0xf162ffff, 0xb47328f5, 0xffffe824, 0xf16203ff,
+0x8c7f28fd, 0xffffa824, 0xe5f162ff, 0x24b47328,
+0xffffffe8, 0xe5f16202, 0xb8e3d428, 0x000005ed,
+0x28f5f362, 0xc500f41f, 0x80d693f9, 0x850f0ffa,
+0x000003df, 0x28f5f162, 0xa8249473, 0x02ffffff,
+0x28f5f162, 0xf2b8c9d4, 0x62000005, 0x1f28e5f3,
+0xf9c500f9, 0xfa80d793, 0xb4850f0f, 0xc7000003,
+0x03942444, 0x62000000, 0x6e087df1, 0x62e5244c,
+0xf328edf1, 0x2444c7c9, 0x00000294, 0x7df16200,
+0x245c6e08, 0xedf162e5, 0x62dbf328, 0xd428e5f1,
+0x0605b8e3, 0xf3620000, 0xc41f28f5, 0x93f9c500,
+0x0ffa80d0, 0x0369850f, 0xf1620000, 0x646e087d,
+0xf162e524, 0xccd328f5, 0x28f5f162, 0x09b8c9d4,
+0x62000006, 0x1f28e5f3, 0xf9c500c9, 0xfa80d193,
+0x3c850f0f, 0x62000003, 0xef08ddf1, 0x76f5c5e4,
+0xfdf162c9, 0xc4da6f28, 0x64295de2, 0xf3626824,
+0xdc2528f5, 0xfdf16240, 0x249c7f28, 0xffffffe8,
+0x28e5f262, 0x6824a447, 0x62000000, 0xd428f5f1,
+0x006824ac, 0xf1620000, 0xac7f28fd, 0x00006824,
+0xe5f26200, 0x249c4728, 0x00000068, 0x000621b8,
+0xfdf16200, 0x249c7f28, 0xffffffc8, 0x28e5f162,
+0xf362dbd4, 0xd31f28dd, 0x93f9c500, 0x0ffa80d2,
+0x02bd850f, 0xf1620000, 0xbc6f28fd, 0xffffc824,
+0xc5f262ff, 0x249c4528, 0x00000068, 0x000626b8,
+0xe5f36200, 0x249c1f28, 0xffffffe8, 0x93f9c500,
+0x0ffa80d3, 0x0289850f, 0xf2620000, 0x9c3b28ed,
+0x00002824, 0xedf26200, 0x24a43f28, 0x00000028,
+0x28edf162, 0x282494d4, 0x62000000, 0xd428e5f1,
+0x0634b8dc, 0xf3620000, 0xe21f28e5, 0x93f9c500,
+0x0ffa80d4, 0x0249850f, 0xf1620000, 0xb46f28fd,
+0x00000824, 0xfdf16200, 0x24946f28, 0x00000028,
+0x00064eb8, 0xcdf36200, 0x01de4328, 0x287df162,
+0x624edb70, 0x1f28e5f3, 0xf9c500ea, 0xfa80d593,
+0x0c850f0f, 0x62000002, 0xd428edf1, 0xe5f262d9,
+0x249c3628, 0x00000008, 0x000653b8, 0xe5f36200,
+0x00f21f28, 0xd693f9c5, 0x0f0ffa80, 0x0001e285,
+0xfdf36200, 0x249c0028, 0x00000008, 0x0658b81b,
+0xf3620000, 0xfa1f28e5, 0x93f9c500, 0x0ffa80d7,
+0x01bd850f, 0xf1620000, 0x9c6f28fd, 0x00000824,
+0x065db800, 0xc7480000, 0x05982444, 0x62000000,
+0x5928fdf2, 0x62f3246c, 0xd428e5f1, 0xd5f362e2,
+0x00c41f28, 0xd093f9c5, 0x0f0ffa80, 0x00018285,
+0x0005b800, 0xf2620000, 0xe87c28fd, 0x28d5f362,
+0xb800cc1f, 0x00000661, 0xd193f9c5, 0x0f0ffa80,
+0x00015e85, 0xfdf36200, 0x249c3928, 0xffffff98,
+0xfdf26200, 0x24a45a28, 0xffffff98, 0x28e5f362,
+0x98249c38, 0x01ffffff, 0x28ddf362, 0xc500d31f,
+0x3cc293f9, 0xb80a740f, 0x0000066c, 0x000122e9,
+0xfdf16200, 0x249c6f28, 0x00000088, 0x28edf262,
+0x08249c76, 0x62000000, 0x6f28fdf1, 0x00a824bc,
+0xf2620000, 0x947e28c5, 0x00000824, 0xf5f16200,
+0x62cad428, 0x2528edf3, 0x00482494, 0xb8550000,
+0x000006a6, 0x2444c748, 0x00000298, 0xf5f16200,
+0x62cbfb28, 0xef28f5f1, 0x0048248c, 0xf1620000,
+0xcafb28f5, 0x28fdf262, 0xf3245459, 0x28f5f362,
+0xc500da1f, 0x80d393f9, 0x850f0ffa, 0x000000a3,
+0x24448b48, 0xfdf16230, 0x24b46f28, 0x00000008,
+0x28fdf162, 0xc824b47f, 0x48ffffff, 0xd0244489,
+0x24448b48, 0x44894840, 0xf162e024, 0x8c6f28fd,
+0x00000824, 0xc5aab000, 0xb8c892f9, 0x0000073a,
+0x29f5f262, 0x28249464, 0x62000000, 0x1f28edf3,
+0xffc824a4, 0xc500ffff, 0x80d493f9, 0x43750ffa,
+0x28f5f362, 0xb801d903, 0x00000003, 0x000000ba,
+0xfdf26200, 0xb8d07c28, 0x00000001, 0x28f5f162,
+0xf262cadb, 0xd07c28fd, 0x28f5f162, 0xf362cad4,
+0xe91f28e5, 0x93f9c500, 0xb80f3cc5, 0x0000074a,
+0xc9c2440f, 0x000000c3, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000004, 0x00000000, 0x00000006, 0x00000000,
+0x00000006, 0x00000000, 0x00000004, 0x00000000,
+0003040,
+};
+asm(".type avx512dq_x86_64_D_32u8, STT_NOTYPE;");
+asm(".type avx512dq_x86_64_D_32u8, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512dq_x86_64_D_32f4[] = {
+0x000347e9, 0x01b85500, 0xb9000000, 0x00000009,
+0x48e58948, 0x48e0e483, 0x6208ec83, 0x10087ef1,
+0x000e3b0d, 0x7ef16200, 0x244c1108, 0x6ef162e9,
+0x89d02a08, 0x7ef162ca, 0x844c1108, 0x62c229f9,
+0x11087ef1, 0x62e98454, 0x2a086ef1, 0x7ef162d2,
+0x84541108, 0xc0ff48f1, 0x09f88348, 0xf162cf75,
+0x9428287c, 0xffffa824, 0x7cf162ff, 0x248c2828,
+0xffffffc8, 0x386cf162, 0x0de21d58, 0xf1620000,
+0xd9592864, 0x287cf162, 0xf262e128, 0xa4982875,
+0xffffa824, 0x00a7b8ff, 0xf1620000, 0xc4c22864,
+0x93f9c500, 0xfa8148d0, 0x000000ff, 0x0298850f,
+0xf1620000, 0xe928287c, 0x2875f262, 0xa824ac9e,
+0xb8ffffff, 0x000000ab, 0x287df262, 0x0d6e2518,
+0xf1620000, 0xdc572864, 0x2864f162, 0xc500cdc2,
+0x48d193f9, 0x00fffa81, 0x850f0000, 0x0000025a,
+0x386cf162, 0x0d4a1558, 0xf1620000, 0xd159286c,
+0x287cf162, 0xf262d928, 0x9c9a2875, 0xffffa824,
+0x00afb8ff, 0xf1620000, 0xd3c2286c, 0x93f9c500,
+0xfa8148d2, 0x000000ff, 0x021c850f, 0xf1620000,
+0xd928287c, 0x286cf162, 0xb3b8d457, 0x62000000,
+0x9c2875f2, 0xffa8249c, 0xf162ffff, 0xdbc2286c,
+0x93f9c500, 0xfa8148d3, 0x000000ff, 0x01e8850f,
+0xf1620000, 0x9428287c, 0xffffa824, 0x6cf162ff,
+0x62d95828, 0x18287df2, 0x62e9246c, 0x28287cf1,
+0xffc824b4, 0xbbb8ffff, 0x62000000, 0x98284df2,
+0x64f162ea, 0x00e5c228, 0xd493f9c5, 0xfffa8148,
+0x0f000000, 0x0001a185, 0x7cf16200, 0x24b42828,
+0xffffffc8, 0x287cf162, 0xf162ea28, 0xdc572864,
+0x0000c0b8, 0x4df26200, 0x246c9e38, 0x64f162e9,
+0x00edc228, 0xd593f9c5, 0xfffa8148, 0x0f000000,
+0x00016585, 0x6cf16200, 0x62c95c28, 0x18287df2,
+0x62e9245c, 0x28287cf1, 0xffc824bc, 0xc5b8ffff,
+0x62000000, 0x9a2845f2, 0x74f162da, 0x00f3c228,
+0xd693f9c5, 0xfffa8148, 0x0f000000, 0x00012985,
+0x7cf16200, 0x24b42828, 0xffffffc8, 0x287cf162,
+0xf162da28, 0xcc572874, 0x0000cab8, 0x4df26200,
+0x245c9c38, 0x74f162e9, 0x00fbc228, 0xd793f9c5,
+0xfffa8148, 0x0f000000, 0x0000ed85, 0x6cf16200,
+0x248c5928, 0xffffffc8, 0x287cf162, 0xe8249c28,
+0xc5ffffff, 0x62f3d0f7, 0x28287cf1, 0xffc824ac,
+0xf162ffff, 0xfa28287c, 0x0000d4b8, 0x55f26200,
+0x24bca628, 0xffffffe8, 0x284cf162, 0xc500c7c2,
+0x48d093f9, 0x00fffa81, 0x850f0000, 0x0000009a,
+0x2864f162, 0xf7c5dc57, 0xf262cbd0, 0xaca7286d,
+0xffffe824, 0x00d8b8ff, 0xf1620000, 0xcdc22874,
+0x93f9c500, 0xfa8148d1, 0x000000ff, 0xf1626c75,
+0x9c59286c, 0xffffc824, 0xd0e7c5ff, 0x62e8245c,
+0x28287cf1, 0xffe824a4, 0xf162ffff, 0xea28287c,
+0x0000deb8, 0x5df26200, 0x24ac9628, 0xffffffc8,
+0x2864f162, 0xc500d5c2, 0x48d293f9, 0x00fffa81,
+0x26750000, 0x285df262, 0xc8249497, 0xb8ffffff,
+0x000000e2, 0x2874f162, 0xc500dac2, 0x48d393f9,
+0x00fffa81, 0x02750000, 0xc3c9c031, 0xbec03155,
+0x00000008, 0x48e58948, 0x48e0e483, 0x0160ec81,
+0x508d0000, 0x62c18901, 0x2a0876f1, 0x29f289ca,
+0x7ef162c2, 0x844c1108, 0x76f16220, 0x89ca2a08,
+0x7ef162c2, 0x844c1108, 0x7ef16228, 0xb10d1008,
+0x8300000a, 0x0a7501e2, 0x087ef162, 0x0abe0d10,
+0xf1620000, 0x4c11087e, 0xe2c13084, 0x09e9d103,
+0x849489ca, 0x000000e0, 0x8904c283, 0x01008494,
+0xff480000, 0xf88348c0, 0x62977508, 0x28287cf1,
+0x62042474, 0x29287cf1, 0x62012474, 0x28287cf1,
+0xb801244c, 0x00000539, 0x2874f162, 0xc500c6c2,
+0x48d093f9, 0x00fffa81, 0x850f0000, 0x00000a28,
+0x2874f162, 0x04245458, 0x287cf162, 0x02245429,
+0x287cf162, 0x04247c28, 0x287cf162, 0x02245428,
+0x00053fb8, 0x44f16200, 0x62df5828, 0xc2286cf1,
+0xf9c500d3, 0x8148d293, 0x0000fffa, 0xe5850f00,
+0x62000009, 0x5c286cf1, 0x62042454, 0x29287cf1,
+0x62032454, 0xc22874f1, 0x0003245c, 0x000544b8,
+0x93f9c500, 0xfa8148d3, 0x000000ff, 0x09b6850f,
+0xf1620000, 0x7428287c, 0xf1620524, 0x4c592874,
+0xf1620424, 0xde59284c, 0x287cf162, 0x04245428,
+0x286cf162, 0xf162ee58, 0x645c286c, 0xf1620524,
+0xcb5c2874, 0x00055bb8, 0x5cf16200, 0x62e55928,
+0xc22874f1, 0xf9c500e4, 0x8148d493, 0x0000fffa,
+0x61850f00, 0x62000009, 0x59286cf1, 0x6206244c,
+0x29287cf1, 0x6201244c, 0x5e286cf1, 0xb8062454,
+0x00000564, 0x2874f162, 0xc500eac2, 0x48d593f9,
+0x00fffa81, 0x850f0000, 0x0000092c, 0x287df262,
+0x093a0d18, 0x67b80000, 0x62000005, 0x28287cf1,
+0x6206245c, 0x572864f1, 0x74f162d1, 0x244c5728,
+0x6cf16204, 0x24545928, 0x6cf16201, 0x00f1c228,
+0xd693f9c5, 0xfffa8148, 0x0f000000, 0x0008e785,
+0x7df16200, 0x244c5b28, 0x7cf16204, 0x62c95b28,
+0xc22874f1, 0x0004247c, 0x00056eb8, 0x93f9c500,
+0xfa8148d7, 0x000000ff, 0x08ba850f, 0xf2620000,
+0x4c4c287d, 0xf1620424, 0x4c29287c, 0xf2620124,
+0x4c4c287d, 0x75b80124, 0x62000005, 0x28287cf1,
+0x62042464, 0x5b287df1, 0x7cf162c9, 0x62c95b28,
+0xc22874f1, 0xf9c500c4, 0x8148d093, 0x0000fffa,
+0x71850f00, 0x62000008, 0x59285cf1, 0x7cf162cc,
+0x244c2928, 0x7df26201, 0x244c4e28, 0x7cf16201,
+0x244c2928, 0x7cf16202, 0x244c2828, 0x057cb802,
+0xf2620000, 0xd14c287d, 0x287df162, 0xf162d25b,
+0xd25b287c, 0x286cf162, 0xc500d4c2, 0x48d293f9,
+0x00fffa81, 0x850f0000, 0x0000081c, 0x287df262,
+0x0424544c, 0x287df162, 0x7eb8c95b, 0x62000005,
+0x5b287cf1, 0x7df162c9, 0x62d25b28, 0x5b287cf1,
+0x74f162d2, 0x00dac228, 0xd393f9c5, 0xfffa8148,
+0x0f000000, 0x0007df85, 0x7cf16200, 0x247c2828,
+0x7df36204, 0x247c1928, 0xf1620014, 0x7428087c,
+0xf1621424, 0x7429087c, 0xf3620124, 0x7c19287d,
+0x62011424, 0x28087cf1, 0x62142474, 0x7b287df1,
+0x6201244c, 0x7f287df1, 0x6209244c, 0x29087cf1,
+0x62012474, 0x7b287df1, 0x6201244c, 0x7f287df1,
+0x620a244c, 0x5b28fcf1, 0x620a2454, 0x5b28fcf1,
+0x6209244c, 0x182875f3, 0xf16201ca, 0x64c22874,
+0xb8000424, 0x00000588, 0xd493f9c5, 0xfffa8148,
+0x0f000000, 0x00074f85, 0x7cf16200, 0x244c7928,
+0x7ff16204, 0x62c97a28, 0xc22874f1, 0x0004246c,
+0x00058fb8, 0x93f9c500, 0xfa8148d5, 0x000000ff,
+0x0722850f, 0xf1620000, 0x7c28287c, 0xf3620424,
+0x7c19287d, 0x62001424, 0x28087cf1, 0x62142474,
+0x29087cf1, 0x62012474, 0x19287df3, 0x0114247c,
+0x087cf162, 0x14247428, 0x287df162, 0x01244c79,
+0x287df162, 0x09244c7f, 0x087cf162, 0x01247429,
+0x287df162, 0x01244c79, 0x287df162, 0x0a244c7f,
+0x28fff162, 0x0a244c7a, 0x28fff162, 0x0924547a,
+0x286df362, 0x6201d118, 0x28287cf1, 0xb804244c,
+0x00000596, 0x286cf162, 0xc500f1c2, 0x48d693f9,
+0x00fffa81, 0x850f0000, 0x0000068c, 0x2874f162,
+0xf162d159, 0x5429287c, 0xf1620124, 0x5451287c,
+0x9cb80124, 0x62000005, 0xc2286cf1, 0xf9c500f9,
+0x8148d793, 0x0000fffa, 0x59850f00, 0x62000006,
+0x18287df2, 0x00068715, 0x6cf16200, 0x62c95e28,
+0x29287cf1, 0x6201244c, 0x08287df3, 0x0b012464,
+0x0005a4b8, 0x7cf16200, 0x610d2828, 0x62000006,
+0xc22874f1, 0xf9c500c4, 0x8148d093, 0x0000fffa,
+0x11850f00, 0x62000006, 0x56287df3, 0x0b04244c,
+0x085cf162, 0xabb8e457, 0x62000005, 0xc22874f1,
+0xf9c500d4, 0x8148d293, 0x0000fffa, 0xe5850f00,
+0x62000005, 0x58286cf1, 0x6204244c, 0x5e286cf1,
+0x7cf162c9, 0x244c2928, 0x7df36201, 0x244c5628,
+0xf1620b01, 0x7c28287c, 0xb1b80124, 0x62000005,
+0xc22844f1, 0xf9c500d9, 0x8148d393, 0x0000fffa,
+0xa1850f00, 0x62000005, 0x18287df2, 0x0005b70d,
+0x74f16200, 0x244c5928, 0x7cf16204, 0x244c2928,
+0x7df36201, 0x244c0828, 0xf3620b01, 0x6456287d,
+0x620b0124, 0x582874f1, 0x7cf162cc, 0x24742828,
+0x05bbb801, 0xf1620000, 0xe1c2284c, 0x93f9c500,
+0xfa8148d4, 0x000000ff, 0x054a850f, 0xf1620000,
+0x64592864, 0xf1620424, 0x5c592864, 0xf1620524,
+0x5c29287c, 0xf3620224, 0x4c50285d, 0x62050224,
+0x50285df3, 0x04022464, 0x287cf162, 0x02246429,
+0x2874f162, 0x02244c58, 0x00063db8, 0x7cf16200,
+0x247c2828, 0x74f16204, 0x244c5928, 0x44f16206,
+0x245c5828, 0x74f16205, 0x00ebc228, 0xd593f9c5,
+0xfffa8148, 0x0f000000, 0x0004db85, 0x7cf16200,
+0x246c2828, 0x064eb804, 0xf1620000, 0x5c28287c,
+0xf3620524, 0xcd232855, 0x74f16201, 0x1bc9c628,
+0x2874f162, 0xc500f3c2, 0x48d693f9, 0x00fffa81,
+0x850f0000, 0x000004a0, 0x287cf162, 0x04244c28,
+0x000653b8, 0x75f36200, 0x01e12328, 0x287df362,
+0x621be404, 0xc2285cf1, 0xf9c500fb, 0x8148d793,
+0x0000fffa, 0x6d850f00, 0x62000004, 0x582864f1,
+0x065db8e9, 0x84c70000, 0x00014024, 0x10000000,
+0x7df26241, 0x24641828, 0x5cf16250, 0x00c5c228,
+0xd093f9c5, 0xfffa8148, 0x0f000000, 0x00043785,
+0x7df36200, 0x244c1928, 0xf2620014, 0x641a287d,
+0xf3621424, 0x6c182875, 0x62011424, 0xc2285cf1,
+0xf9c500d5, 0x3d48c293, 0x000000ff, 0x6cb80a74,
+0xe9000006, 0x00000400, 0x0875f362, 0x620ee121,
+0xc60874f1, 0xf36255e9, 0xe521085d, 0x7cf16210,
+0x24642908, 0x7df26214, 0x24641928, 0x7df36228,
+0x246c0408, 0x0cb04414, 0xc892f9c5, 0x2975f362,
+0xb000cd18, 0x92f9c530, 0x75f362c8, 0x244c1829,
+0xf3620114, 0x6c04087d, 0xb0441424, 0x92f9c5c0,
+0x75f362c8, 0x01cd1829, 0x285cf162, 0xc500d9c2,
+0x48c393f9, 0x0000ff3d, 0xb80a7400, 0x0000067c,
+0x000383e9, 0x7cf16200, 0x244c2828, 0x65f26207,
+0x244c7728, 0x7df16204, 0x24746f28, 0x4df26208,
+0x245c7f28, 0x7cf16204, 0x245c2928, 0x74f16202,
+0xb8cb5c28, 0x000006a6, 0x402484c7, 0x00000001,
+0x62408000, 0x592874f1, 0x6206244c, 0x18287df2,
+0x6250245c, 0xc22874f1, 0xf16200e3, 0x4c29287c,
+0xf9c50324, 0x8148d493, 0x0000fffa, 0x15850f00,
+0x62000003, 0x28287cf1, 0x6204247c, 0x19287df3,
+0x0014247c, 0x087cf162, 0x14246c28, 0x087cf162,
+0x12246c29, 0x287cf162, 0x12244c5a, 0x28fdf162,
+0x01244c29, 0x28fdf162, 0x01244c5a, 0x087cf162,
+0x14244c29, 0xf162c031, 0x4c10087e, 0xf1625004,
+0x4c2e087c, 0x027a2004, 0xf1b80a74, 0xe9000006,
+0x000002b4, 0x04c08348, 0x10f88348, 0xf162d875,
+0x5c12287e, 0xf2620424, 0x0d18287d, 0x000002b4,
+0x000717b8, 0x74f16200, 0x244c5828, 0x7df26206,
+0xa5251828, 0x62000002, 0x5c2864f1, 0x6204245c,
+0x592874f1, 0x64f162cc, 0x00e9c228, 0xd593f9c5,
+0xfffa8148, 0x0f000000, 0x00025b85, 0x7ef16200,
+0x244c1628, 0x6cf16204, 0x24545828, 0x071eb806,
+0xf1620000, 0x5c28287c, 0xf1620424, 0xcb5c2874,
+0x286cf162, 0xf162d459, 0xf2c22874, 0x93f9c500,
+0xfa8148d6, 0x000000ff, 0x021a850f, 0xf1620000,
+0x4c10087e, 0xf1622924, 0x5c29287c, 0xf1620224,
+0x4c11087e, 0xf1621124, 0x4c10087e, 0xf1622b24,
+0x4c11087e, 0xf1621324, 0x4c10087e, 0xf1622d24,
+0x4c11087e, 0xf1621524, 0x4c10087e, 0xf1622f24,
+0x4c11087e, 0xf1621724, 0x7428287c, 0xaab00424,
+0xc892f9c5, 0x00073ab8, 0x4df26200, 0x244c6529,
+0x74f16205, 0x247cc228, 0xf9c50002, 0x8148d793,
+0x0000fffa, 0x9d850f00, 0x62000001, 0x28287cf1,
+0xc5042474, 0x248cd0cf, 0x000000a0, 0x287cf162,
+0x04245428, 0x000743b8, 0x6cf16200, 0x245c5c28,
+0x6cf16205, 0x245c5829, 0x74f16205, 0x00c3c228,
+0xd093f9c5, 0xfffa8148, 0x0f000000, 0x00015785,
+0x7df16200, 0xa51d6f28, 0x62000001, 0x29287cf1,
+0xba012454, 0x00000003, 0x086cf162, 0xefc5d257,
+0x20244c7c, 0x2865f262, 0xf162c916, 0x4c29287c,
+0xcaff0124, 0xf362e875, 0xc9032875, 0x7cf16207,
+0x390d2e08, 0x0f000001, 0x0000f88a, 0xf2850f00,
+0x62000000, 0x28287cf1, 0xb804247c, 0x00000767,
+0x8c7dc7c5, 0x0000a024, 0x65f26200, 0xc5c91628,
+0x62ca7cf7, 0x162865f2, 0x7cf7c5c9, 0x65f262ca,
+0xc5c91628, 0x62ca7cf7, 0x162865f2, 0x74f162c9,
+0x00d2c228, 0xca93f9c5, 0xfff98148, 0x0f000000,
+0x0000b385, 0x7df36200, 0x244c2628, 0xf1620004,
+0x4c29287c, 0xf2620124, 0x4c42287d, 0xf1620424,
+0x4c29287c, 0xf1620224, 0x0d10087e, 0x000000c0,
+0xf162c031, 0xd27b086e, 0x087cf162, 0x1084542e,
+0x68756a7a, 0x8d01788d, 0xfe210270, 0x8301fe83,
+0xc78500d2, 0xf1620c75, 0x4c2e087c, 0x537a0884,
+0xff485175, 0xf88348c0, 0x62c77508, 0x28287cf1,
+0xb801247c, 0x0000077d, 0x287cf162, 0x04246c28,
+0x2845f262, 0x02244c2c, 0x2854f162, 0xc500d9c2,
+0x48d393f9, 0x00fffa81, 0x1c750000, 0xfff1f4e8,
+0xebd8f7ff, 0x075eb813, 0x0ceb0000, 0x000773b8,
+0xb805eb00, 0x00000778, 0x0000c3c9, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x80000000, 0xbf800000, 0x3e800000, 0x3f000000,
+0x42100000, 0x00000000, 0x00000000, 0x00000000,
+0x3f800000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000001, 0x00000004, 0x00000005,
+0x00000002, 0x00000003, 0x00000006, 0x00000007,
+0007240,
+};
+asm(".type avx512dq_x86_64_D_32f4, STT_NOTYPE;");
+asm(".type avx512dq_x86_64_D_32f4, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512dq_x86_64_D_32f8[] = {
+0x00034ae9, 0x89485500, 0xe48348e5, 0xec8348e0,
+0xfff16208, 0x650d1008, 0x6200000c, 0x1008fff1,
+0x000c2b15, 0xfff16200, 0x911d1008, 0x6200000b,
+0x1008fff1, 0x000c0f25, 0xfff16200, 0x244c1108,
+0xfff162f4, 0x244c1108, 0xfff162f5, 0x24541108,
+0xfff162f9, 0x244c1108, 0xfff162fd, 0x245c1108,
+0xfff162f6, 0x24641108, 0xfff162fa, 0x244c1108,
+0xfff162fe, 0x24641108, 0xfff162f7, 0x245c1108,
+0xfff162fb, 0x244c1108, 0xfff162ff, 0x24541108,
+0xfff162f8, 0x244c1108, 0xfff162fc, 0x240c1108,
+0x28fdf162, 0xc8248c28, 0xb8ffffff, 0x000000a7,
+0x28fdf162, 0x0b461528, 0xf1620000, 0xd92828fd,
+0x28f5f262, 0xa8249c98, 0x62ffffff, 0xc228edf1,
+0xf9c500c3, 0xfa80d093, 0x6e850f0f, 0x62000002,
+0x2828fdf1, 0xf5f262d9, 0x249c9e28, 0xffffffa8,
+0x0000abb8, 0xfdf16200, 0x21152828, 0x6200000b,
+0xc228edf1, 0xf9c500cb, 0xfa80d193, 0x3a850f0f,
+0x62000002, 0x2828fdf1, 0xf5f262d9, 0x249c9a28,
+0xffffffa8, 0x0000afb8, 0xfdf16200, 0x0d152828,
+0x6200000b, 0xc228edf1, 0xf9c500d3, 0xfa80d293,
+0x06850f0f, 0x62000002, 0x2828fdf1, 0xf5f262d9,
+0x249c9c28, 0xffffffa8, 0x0000b3b8, 0xfdf16200,
+0xf9152828, 0x6200000a, 0xc228edf1, 0xf9c500db,
+0xfa80d393, 0xd2850f0f, 0x62000001, 0x2828fdf1,
+0xffa82494, 0xf162ffff, 0xd95828ed, 0x28fdf262,
+0xf4246419, 0x28fdf162, 0xc824b428, 0xb8ffffff,
+0x000000bb, 0x28cdf262, 0xf162e298, 0xe4c228e5,
+0x93f9c500, 0x0ffa80d4, 0x018f850f, 0xf1620000,
+0xb42828fd, 0xffffc824, 0xfdf162ff, 0xb8e22828,
+0x000000c0, 0x28fdf262, 0x0a822d19, 0xf2620000,
+0x649e38cd, 0xf162f424, 0xdd5728e5, 0x28e5f162,
+0xc500ecc2, 0x80d593f9, 0x850f0ffa, 0x0000014d,
+0x28edf162, 0xf262c95c, 0x5c1928fd, 0xf162f424,
+0xbc2828fd, 0xffffc824, 0x00c5b8ff, 0xf2620000,
+0xda9a28c5, 0x28f5f162, 0xc500f3c2, 0x80d693f9,
+0x850f0ffa, 0x00000115, 0x28fdf162, 0xc824b428,
+0x62ffffff, 0x2828fdf1, 0xf5f162da, 0xb8cd5728,
+0x000000ca, 0x38cdf262, 0xf4245c9c, 0x28f5f162,
+0xc500fbc2, 0x80d793f9, 0x850f0ffa, 0x000000dd,
+0x28edf162, 0xc8248c59, 0x62ffffff, 0x2828fdf1,
+0xffe8249c, 0xf5c5ffff, 0xf162f3d0, 0xa42828fd,
+0xffffc824, 0xfdf162ff, 0xb8fa2828, 0x000000d4,
+0x28ddf262, 0xe824bca6, 0x62ffffff, 0xc228cdf1,
+0xf9c500c7, 0xfa80d093, 0x8e850f0f, 0x62000000,
+0x5728e5f1, 0xd0f5c5dd, 0xedf262cb, 0x24a4a728,
+0xffffffe8, 0x0000d8b8, 0xf5f16200, 0x00ccc228,
+0xd193f9c5, 0x750ffa80, 0xedf16264, 0x249c5928,
+0xffffffc8, 0x5cd0e5c5, 0xf162e824, 0xa42828fd,
+0xffffe824, 0xfdf162ff, 0xb8ea2828, 0x000000de,
+0x28ddf262, 0xc824ac96, 0x62ffffff, 0xc228e5f1,
+0xf9c500d5, 0xfa80d293, 0x6222750f, 0x9728ddf2,
+0xffc82494, 0xe2b8ffff, 0x62000000, 0xc228f5f1,
+0xf9c500da, 0xfa80d393, 0x3102750f, 0x55c3c9c0,
+0x48e58948, 0x48e0e483, 0x00e0ec81, 0xf1620000,
+0x0d1008ff, 0x00000918, 0x08fff162, 0x08de1d10,
+0xf1620000, 0x251008ff, 0x00000844, 0x08fff162,
+0x08c22d10, 0xf1620000, 0x151008ff, 0x00000838,
+0x08fff162, 0x10244c11, 0x08fff162, 0x14245c11,
+0x08fff162, 0x18244c11, 0x08fff162, 0x11246411,
+0x08fff162, 0x15246c11, 0x08fff162, 0x19245411,
+0x08fff162, 0x12246c11, 0x08fff162, 0x16246411,
+0x08fff162, 0x1a244c11, 0x08fff162, 0x13245c11,
+0x08fff162, 0x17244c11, 0x08fff162, 0x1b245411,
+0x28fdf162, 0x04247c28, 0x28fdf162, 0x01247c29,
+0x28fdf162, 0x01244c28, 0x000539b8, 0xf5f16200,
+0x00c7c228, 0xd093f9c5, 0x0f0ffa80, 0x00079285,
+0xf5f16200, 0x24545828, 0xfdf16204, 0x24542928,
+0xfdf16202, 0x24742828, 0xfdf16204, 0x24542828,
+0x053fb802, 0xf1620000, 0xde5828cd, 0x28edf162,
+0xc500d3c2, 0x80d293f9, 0x850f0ffa, 0x00000753,
+0x28edf162, 0x0424545c, 0x28fdf162, 0x03245429,
+0x28f5f162, 0x03245cc2, 0x0544b800, 0xf9c50000,
+0xfa80d393, 0x28850f0f, 0x62000007, 0x2828fdf1,
+0x6205247c, 0x5928f5f1, 0x6204244c, 0x5928c5f1,
+0xfdf162df, 0x24542828, 0xedf16204, 0x62f75828,
+0x5c28edf1, 0x6205246c, 0x5c28f5f1, 0x055bb8cb,
+0xf1620000, 0xee5928d5, 0x28f5f162, 0xc500e5c2,
+0x80d493f9, 0x850f0ffa, 0x000006d7, 0x28edf162,
+0x06244c59, 0x28fdf162, 0x01244c29, 0x28edf162,
+0x0624545e, 0x000564b8, 0xf5f16200, 0x00eac228,
+0xd593f9c5, 0x0f0ffa80, 0x0006a685, 0xfdf26200,
+0x490d1928, 0xb8000007, 0x00000567, 0x28fdf162,
+0x06245428, 0x28edf162, 0xf162d957, 0x4c5728f5,
+0xf1620424, 0x5c5928e5, 0xf1620124, 0xf1c228e5,
+0x93f9c500, 0x0ffa80d6, 0x0665850f, 0xf1620000,
+0x4ce628ff, 0xf1620424, 0xc9e6287e, 0x28f5f162,
+0x04247cc2, 0x056eb800, 0xf9c50000, 0xfa80d793,
+0x3c850f0f, 0x62000006, 0x4c28fdf2, 0x6204244c,
+0x2928fdf1, 0x6201244c, 0x4c28fdf2, 0xb801244c,
+0x00000575, 0x28fdf162, 0x04246c28, 0x28fff162,
+0xf162c9e6, 0xc9e6287e, 0x28f5f162, 0xc500c5c2,
+0x80d093f9, 0x850f0ffa, 0x000005f7, 0x28d5f162,
+0xf162cd59, 0x4c2928fd, 0xf2620124, 0x4c4e28fd,
+0xf1620124, 0x4c2928fd, 0xf1620224, 0x4c2828fd,
+0x7cb80224, 0x62000005, 0x4c28fdf2, 0xfff162d9,
+0x62dbe628, 0xe6287ef1, 0xe5f162db, 0x00d5c228,
+0xd293f9c5, 0x0f0ffa80, 0x0005a685, 0xfdf26200,
+0x245c4c28, 0xfff16204, 0x62c9e628, 0xe6287ef1,
+0x057eb8c9, 0xf1620000, 0xdbe628ff, 0x287ef162,
+0xf162dbe6, 0xdbc228f5, 0x93f9c500, 0x0ffa80d3,
+0x056d850f, 0xf1620000, 0x4c7b28fd, 0xf1620424,
+0xc9e628fe, 0x28f5f162, 0x042464c2, 0x0588b800,
+0xf9c50000, 0xfa80d493, 0x44850f0f, 0x62000005,
+0x7928fcf1, 0x6204244c, 0x7a287ef1, 0xf5f162c9,
+0x246cc228, 0x8fb80004, 0xc5000005, 0x80d593f9,
+0x850f0ffa, 0x0000051b, 0x28fdf162, 0x04245c79,
+0x28fef162, 0xf162db7a, 0x4c2828fd, 0x96b80424,
+0x62000005, 0xc228e5f1, 0xf9c500f1, 0xfa80d693,
+0xec850f0f, 0x62000004, 0x5928f5f1, 0xfdf162d9,
+0x245c2928, 0xfdf16201, 0x245c5128, 0x059cb801,
+0xf1620000, 0xf9c228e5, 0x93f9c500, 0x0ffa80d7,
+0x04bd850f, 0xf2620000, 0x1d1928fd, 0x00000580,
+0x28e5f162, 0xf162c95e, 0x4c2928fd, 0xf3620124,
+0x6c0928fd, 0xb80b0124, 0x000005a4, 0x28fdf162,
+0x055a0d28, 0xf1620000, 0xcdc228f5, 0x93f9c500,
+0x0ffa80d1, 0x0479850f, 0xf3620000, 0x4c5628fd,
+0x620b0424, 0x5708d5f1, 0x05abb8ed, 0xf1620000,
+0xc5c228f5, 0x93f9c500, 0x0ffa80d0, 0x0451850f,
+0xf1620000, 0x4c5828e5, 0xf1620424, 0xd95e28e5,
+0x28fdf162, 0x01245c29, 0x28fdf362, 0x01244c56,
+0xfdf1620b, 0x24742828, 0x05b1b801, 0xf1620000,
+0xd1c228cd, 0x93f9c500, 0x0ffa80d2, 0x0411850f,
+0xf2620000, 0x0d1928fd, 0x00000424, 0x28f5f162,
+0x04244c59, 0x28fdf162, 0x01244c29, 0x28fdf362,
+0x01244c09, 0xfdf3620b, 0x245c5628, 0xf1620b01,
+0xcb5828f5, 0x28fdf162, 0x01247c28, 0x0005bbb8,
+0xc5f16200, 0x00d9c228, 0xd393f9c5, 0x0f0ffa80,
+0x0003be85, 0xedf16200, 0x245c5928, 0xedf16204,
+0x24545928, 0xfdf16205, 0x24542928, 0xe5f36202,
+0x244c5028, 0xf3620502, 0x5c5028e5, 0x62040224,
+0x2928fdf1, 0x6202245c, 0x5828f5f1, 0xb802244c,
+0x0000063d, 0x28fdf162, 0x04247428, 0x28f5f162,
+0x06244c59, 0x28cdf162, 0x05245458, 0x28f5f162,
+0xc500e2c2, 0x80d493f9, 0x850f0ffa, 0x00000353,
+0x28fdf162, 0x04247c28, 0x00064eb8, 0xfdf16200,
+0x24542828, 0xc5f36205, 0x01cf2328, 0x28f5f162,
+0x6205c9c6, 0xc228f5f1, 0xf9c500ea, 0xfa80d593,
+0x1c850f0f, 0x62000003, 0x2828fdf1, 0xb804244c,
+0x00000653, 0x28f5f362, 0x6201d923, 0x0528fdf3,
+0xf16205db, 0xf2c228e5, 0x93f9c500, 0x0ffa80d6,
+0x02ed850f, 0xf1620000, 0xe95828ed, 0x45058b48,
+0x48000003, 0x10244489, 0x00065db8, 0xfdf26200,
+0x245c1928, 0xe5f16202, 0x00fdc228, 0xd793f9c5,
+0x0f0ffa80, 0x0002ba85, 0xfdf36200, 0x244c1928,
+0xf2620001, 0x5c1a28fd, 0xf3620124, 0x4c1828f5,
+0x62010124, 0xc228e5f1, 0xf9c500c9, 0x0f3cc193,
+0x6cb80a74, 0xe9000006, 0x00000287, 0x28fdf162,
+0x036a0d28, 0xf2620000, 0x4c7728ed, 0xf1620424,
+0x356f28fd, 0x00000378, 0x28cdf262, 0x0424547f,
+0x28f5f162, 0xf162ca5c, 0x641108ff, 0xa6b80224,
+0x62000006, 0x5928f5f1, 0x6206244c, 0x1928fdf2,
+0x62022454, 0xc228f5f1, 0xf16200c2, 0x4c2928fd,
+0xf9c50324, 0xfa80d093, 0x24850f0f, 0x62000002,
+0x1228fff1, 0x62042454, 0x1928fdf2, 0x0002270d,
+0x0717b800, 0xf1620000, 0x4c5828f5, 0xf1620624,
+0x5c2828fd, 0xf1620424, 0x0d5938f5, 0x00000218,
+0x28edf162, 0xf162d35c, 0xd1c228ed, 0x93f9c500,
+0x0ffa80d2, 0x01d9850f, 0xf1620000, 0x4c1008ff,
+0xf1621524, 0x5c2928fd, 0xf1620224, 0x4c1108ff,
+0xf1620924, 0x4c1008ff, 0xf1621724, 0x4c1108ff,
+0xf1620b24, 0x642828fd, 0xaab00424, 0xc892f9c5,
+0x00073ab8, 0xddf26200, 0x244c6529, 0xf5f16205,
+0x245cc228, 0xf9c50002, 0xfa80d393, 0x80850f0f,
+0x62000001, 0x2828fdf1, 0xc504247c, 0x248cd0c5,
+0x000000a0, 0x28fdf162, 0x04245428, 0x000743b8,
+0xedf16200, 0x245c5c28, 0xedf16205, 0x245c5829,
+0xf5f16205, 0x00e3c228, 0xd493f9c5, 0x0f0ffa80,
+0x00013e85, 0xfdf16200, 0x24542928, 0xedf16201,
+0xc5d25708, 0x244c7ced, 0xfdf36220, 0xd8c90128,
+0x28fdf162, 0x01244c29, 0x4c7cedc5, 0xf3622024,
+0xc90328f5, 0xfdf16203, 0x310d2e08, 0x0f000001,
+0x0000eb8a, 0xe5850f00, 0x62000000, 0x2828fdf1,
+0xb8042474, 0x00000767, 0x8c7dcdc5, 0x0000a024,
+0xfdf36200, 0xd8c90128, 0xca7cf5c5, 0x28fdf362,
+0xc5d8c901, 0x62ca7cf5, 0x0128fdf3, 0xf162d8c9,
+0xeac228f5, 0x93f9c500, 0x0ffa80d5, 0x00b1850f,
+0xf3620000, 0x4c2628fd, 0x62000424, 0x2928fdf1,
+0x6201244c, 0x4228fdf2, 0x6204244c, 0x2928fdf1,
+0x6202244c, 0x1008fff1, 0x0001530d, 0x31c03100,
+0x6ff162d2, 0x62d27b08, 0x2e08fdf1, 0x7a08c454,
+0x8d647566, 0x708d0178, 0x83fe2102, 0xd28301fe,
+0x75c78500, 0xfdf1620c, 0xc44c2e08, 0x754f7a04,
+0xc0ff484d, 0x04f88348, 0xf162c775, 0x642828fd,
+0x7db80124, 0x62000007, 0x2c28ddf2, 0x6202244c,
+0x2828fdf1, 0x62042464, 0xc228ddf1, 0xf9c500f1,
+0xfa80d693, 0xe81c750f, 0xfffff469, 0x13ebd8f7,
+0x00075eb8, 0xb80ceb00, 0x00000773, 0x78b805eb,
+0xc9000007, 0x000000c3, 0x00000000, 0x00000000,
+0x00000000, 0x40000000, 0x00000000, 0xbff00000,
+0x00000000, 0x3fd00000, 0x00000000, 0x3fe00000,
+0x00000000, 0x40240000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x40200000, 0x00000000, 0x40220000,
+0x00000000, 0x40200000, 0x00000000, 0x40140000,
+0x00000000, 0xc0200000, 0x00000000, 0xc0220000,
+0x00000000, 0xc0200000, 0x00000000, 0xc0140000,
+0x00000000, 0x00000000, 0x00000000, 0x40080000,
+0x00000000, 0x40100000, 0x00000000, 0x40080000,
+0x00000000, 0x80000000, 0x00000000, 0xc0080000,
+0x00000000, 0xc0100000, 0x00000000, 0xc0080000,
+0x00000000, 0x3ff00000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000004, 0x00000000,
+0x00000001, 0x00000000, 0x00000005, 0x00000000,
+0x00000002, 0x00000000, 0x00000006, 0x00000000,
+0x00000003, 0x00000000, 0x00000007, 0x00000000,
+0006340,
+};
+asm(".type avx512dq_x86_64_D_32f8, STT_NOTYPE;");
+asm(".type avx512dq_x86_64_D_32f8, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512dq_x86_64_D_f4[] = {
+0x000213e9, 0x89485500, 0x7ef162e5, 0xdd0d1008,
+0x62000008, 0x11087ef1, 0xf162ec4d, 0x4d11087e,
+0x7ef162ea, 0xeb4d1108, 0x087ef162, 0x62eb4d10,
+0x990875f2, 0xa7b8ea4d, 0xc7000000, 0x0000b445,
+0xf3624000, 0xc9210875, 0x76f1620e, 0xed45c208,
+0x93f8c500, 0xcaff66d0, 0x01b8850f, 0xf1620000,
+0x4d10087e, 0x75f262eb, 0xea4d9f08, 0x0000abb8,
+0xb445c700, 0xc0000000, 0x0875f362, 0x620ec921,
+0xc20876f1, 0xc500ed4d, 0x66d193f8, 0x850fcaff,
+0x00000182, 0x087ef162, 0x62eb4d10, 0x9b0875f2,
+0xafb8ea4d, 0xc7000000, 0x0000b445, 0xf3620000,
+0xc9210875, 0x76f1620e, 0xed55c208, 0x93f8c500,
+0xcaff66d2, 0x014c850f, 0xf1620000, 0x4d10087e,
+0x75f262eb, 0xea4d9d08, 0x0000b3b8, 0xb445c700,
+0x80000000, 0x0875f362, 0x620ec921, 0xc20876f1,
+0xc500ed5d, 0x66d393f8, 0x850fcaff, 0x00000116,
+0x087ef162, 0x62ea4d10, 0x10087ef1, 0xf162eb6d,
+0xd5580876, 0x087ef162, 0x62ec5d10, 0x10087ef1,
+0xbbb8eb75, 0x62000000, 0x11087ef1, 0xf262ed55,
+0x5d99084d, 0x65f362ea, 0x0edb2108, 0x0866f162,
+0x00ed65c2, 0xd493f8c5, 0x0fcaff66, 0x0000c585,
+0x7ef16200, 0xec5d1008, 0x087ef162, 0xb8eb7d10,
+0x000000c0, 0x087ef162, 0x07922510, 0xf2620000,
+0x5d9f0845, 0x57e8c5ea, 0x7ef162d4, 0xed551108,
+0x0865f362, 0x620ed321, 0xc2086ef1, 0xc500ed6d,
+0x66d593f8, 0x7e75caff, 0x0876f162, 0xf162cd5c,
+0x5510087e, 0x7ef162ec, 0xeb751008, 0x0000c5b8,
+0x7ef16200, 0xed4d1108, 0x084df262, 0x62ea559b,
+0x21086df3, 0xf1620ed2, 0x75c2086e, 0xf8c500ed,
+0xff66d693, 0x623f75ca, 0x10087ef1, 0xf0c5ec55,
+0xcab8cc57, 0x62000000, 0x10087ef1, 0xf262eb7d,
+0x559d0845, 0x7ef162ea, 0xed4d1108, 0x086df362,
+0x620eca21, 0xc20876f1, 0xc500ed7d, 0x66d793f8,
+0x0275caff, 0xc35dc031, 0xe5894855, 0xc0e48348,
+0x00ec8148, 0x62000001, 0x10087ef1, 0x0006bf0d,
+0x7ef16200, 0x244c1108, 0x7ef1621b, 0x244c1108,
+0x7ef1621c, 0x244c1108, 0x24448b1d, 0x2444896c,
+0x7ef16260, 0x24541008, 0x0539b818, 0xf1620000,
+0x5411087e, 0xf1623e24, 0x5410087e, 0xf1621b24,
+0x44c2086e, 0xc5003e24, 0x66d093f8, 0x850fcaff,
+0x00000664, 0x087ef162, 0x18245410, 0x086ef162,
+0x1b245458, 0x087ef162, 0x19245411, 0x087ef162,
+0x19245410, 0x00053fb8, 0x7ef16200, 0x24541108,
+0x7ef1623e, 0x24541008, 0x6ef1621b, 0x62d25808,
+0x21086df3, 0xf1620ed2, 0x4cc2086e, 0xc5003e24,
+0x66d193f8, 0x850fcaff, 0x0000060c, 0x087ef162,
+0x19245410, 0x086ef162, 0x1b24545c, 0x087ef162,
+0x8b241411, 0x84892404, 0x00009424, 0x24448900,
+0x24448964, 0x7ef16268, 0x24541008, 0x0544b818,
+0xf1620000, 0x5411087e, 0xf1623e24, 0x5410087e,
+0xf1621a24, 0x54c2086e, 0xc5003e24, 0x66d293f8,
+0x850fcaff, 0x000005b0, 0x087ef162, 0x18245410,
+0x086ef162, 0x1b245459, 0x087ef162, 0x18245411,
+0x087ef162, 0x1c245410, 0x086ef162, 0xf162d259,
+0x5411087e, 0xf1621924, 0x5410087e, 0xf1621b24,
+0x5458086e, 0xf1621c24, 0x5411087e, 0xf1621a24,
+0x5c10087e, 0xf1621b24, 0x545c0866, 0x5bb81c24,
+0x62000005, 0x59086ef1, 0x621a2454, 0x10087ef1,
+0x62182464, 0x5c085ef1, 0x62192464, 0x11087ef1,
+0x623e2464, 0x11087ef1, 0x621a2454, 0x21086df3,
+0xf1620ed2, 0x5cc2086e, 0xc5003e24, 0x66d393f8,
+0x850fcaff, 0x00000510, 0x0866f162, 0x1d245c59,
+0x087ef162, 0x18245c11, 0x087ef162, 0x18245c10,
+0x087ef162, 0x1b245410, 0x086ef162, 0x1d24545e,
+0x087ef162, 0x19245411, 0x086df362, 0xb80ed221,
+0x00000564, 0x087ef162, 0x3e245c11, 0x086ef162,
+0x3e2464c2, 0x93f8c500, 0xcaff66d4, 0x04b6850f,
+0xf1620000, 0x5410087e, 0x67b81d24, 0x62000005,
+0x10087ef1, 0x0004b71d, 0x57e8c500, 0x6ef162d3,
+0x24545908, 0x7ef16218, 0x24541108, 0x7ef1623e,
+0x24541008, 0x57e8c51b, 0x6df362d3, 0x0ed22108,
+0x086ef162, 0x3e246cc2, 0x93f8c500, 0xcaff66d5,
+0x0462850f, 0xfac50000, 0x6c24442c, 0xf8248489,
+0xc5000000, 0x24942aea, 0x000000f8, 0x087ef162,
+0x18245411, 0x087ef162, 0x18245410, 0x00056eb8,
+0x7ef16200, 0x24541108, 0x7ef1623e, 0x24541008,
+0x6ef1621b, 0x2474c208, 0xf8c5003e, 0xff66d693,
+0x11850fca, 0x62000004, 0x4d086df2, 0x621b2454,
+0x11087ef1, 0x62182454, 0x4d086df2, 0xc5182454,
+0x89c22cfa, 0x00f82484, 0xeac50000, 0xf824942a,
+0xb8000000, 0x00000575, 0x087ef162, 0x3e245411,
+0x087ef162, 0x1b245410, 0x086df362, 0x620eda21,
+0xc20866f1, 0x003e247c, 0xd793f8c5, 0x0fcaff66,
+0x0003b385, 0x6ef16200, 0x62d25908, 0x11087ef1,
+0x62182454, 0x4f086df2, 0x62182454, 0x11087ef1,
+0x62192454, 0x4d086df2, 0xc5192454, 0x89c22cfa,
+0x00f82484, 0xeac50000, 0xf824942a, 0xb8000000,
+0x0000057c, 0x087ef162, 0x3e245411, 0x087ef162,
+0x1b245410, 0x086ef162, 0x3e2444c2, 0x93f8c500,
+0xcaff66d0, 0x034e850f, 0xfac50000, 0x6424442c,
+0xf8248489, 0xc5000000, 0x24942aea, 0x000000f8,
+0x087ef162, 0x1e245411, 0x086df262, 0x1b24544d,
+0xc22cfac5, 0xf8248489, 0xc5000000, 0x24942aea,
+0x000000f8, 0x00057eb8, 0x6df36200, 0x0ed22108,
+0x086ef162, 0x1e244cc2, 0x93f8c500, 0xcaff66d1,
+0x02f2850f, 0xe1c40000, 0x24442cfa, 0x8489486c,
+0x0000f824, 0xeae1c400, 0xf824942a, 0x62000000,
+0x11087ef1, 0x62182454, 0x10087ef1, 0xb8182454,
+0x00000588, 0x087ef162, 0x3e245411, 0x087ef162,
+0x1b245410, 0x086ef162, 0x3e2454c2, 0x93f8c500,
+0xcaff66d2, 0x029e850f, 0xf1620000, 0x4479087e,
+0x84891b24, 0x0000f824, 0x6ef16200, 0x24547b08,
+0x7ef1623e, 0x24541108, 0x7ef16218, 0x24541008,
+0x058fb818, 0xf1620000, 0x5411087e, 0xf1623e24,
+0x5410087e, 0xf1621b24, 0x5cc2086e, 0xc5003e24,
+0x66d393f8, 0x850fcaff, 0x0000024c, 0x08fef162,
+0x1b244479, 0x24848948, 0x000000f8, 0x08eef162,
+0x1f24547b, 0x087ef162, 0x18245411, 0x087ef162,
+0x18245410, 0x000596b8, 0x7ef16200, 0x24541108,
+0x7ef1623e, 0x24541008, 0x6df3621b, 0x0eda2108,
+0x0866f162, 0x3e2464c2, 0x93f8c500, 0xcaff66d4,
+0x01f2850f, 0xf1620000, 0xd259086e, 0x087ef162,
+0x18245411, 0x086ef162, 0x18245451, 0x087ef162,
+0x3e245411, 0x00059cb8, 0x7ef16200, 0x24541008,
+0x6df3621b, 0x0eda2108, 0x0866f162, 0x3e246cc2,
+0x93f8c500, 0xcaff66d5, 0x01aa850f, 0xf1620000,
+0xd25e0876, 0x087ef162, 0x19244c11, 0x087ef162,
+0x18245411, 0x087ef162, 0x19245c10, 0x0005a4b8,
+0x6df36200, 0x24540a08, 0xf1620b18, 0x5c11087e,
+0xf1623e24, 0x5411087e, 0xf3621a24, 0xd221086d,
+0x6ef1620e, 0x2474c208, 0xf8c5003e, 0xff66d693,
+0x51850fca, 0x62000001, 0x10087ef1, 0x621d2454,
+0x59086ef1, 0x621b245c, 0x59086ef1, 0x621c2454,
+0x11087ef1, 0x6218245c, 0x11087ef1, 0x62192454,
+0x10087ef1, 0x62182454, 0x5f086ef1, 0x62192454,
+0x11087ef1, 0x621a2454, 0x10087ef1, 0x62182454,
+0x5d086ef1, 0x62192454, 0x11087ef1, 0x62192454,
+0x10087ef1, 0x62192454, 0x58086ef1, 0xb81a2454,
+0x0000063d, 0x086ef162, 0x1d245459, 0x6c24548b,
+0xf0249489, 0x62000000, 0x11087ef1, 0x623e2454,
+0x10087ef1, 0x623c2454, 0x58086ef1, 0x621c2454,
+0x21086df3, 0xf1620ed2, 0x7cc2086e, 0xc5003e24,
+0x66cf93f8, 0x850fc9ff, 0x0000009c, 0x64245489,
+0x086df362, 0x1b245427, 0x7ef16200, 0x24541108,
+0x6df26218, 0x24544308, 0x7ef1621b, 0x24541108,
+0x57e8c519, 0x7cf162d2, 0x24542e08, 0x755d7a19,
+0x7cf1625b, 0x244c2e08, 0x75587a18, 0x7ef16256,
+0x24541008, 0x7ef1621b, 0x244c1008, 0x077db818,
+0xf2620000, 0x4c2d0875, 0xf1621924, 0x5411087e,
+0xf1623e24, 0x4c11087e, 0xf3621a24, 0xc9210875,
+0x76f1620e, 0x2444c208, 0xf8c5003e, 0xff66d093,
+0xe81575ca, 0xfffff72d, 0x0cebd8f7, 0x000773b8,
+0xb805eb00, 0x00000778, 0x0000c3c9, 0x00000000,
+0x3f800000, 0x00000000, 0x00000000, 0x00000000,
+0x80000000, 0x00000000, 0x00000000, 0x00000000,
+0004420,
+};
+asm(".type avx512dq_x86_64_D_f4, STT_NOTYPE;");
+asm(".type avx512dq_x86_64_D_f4, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512dq_x86_64_D_f8[] = {
+0x000228e9, 0x89485500, 0xec8348e5, 0xfff16238,
+0xe90d1008, 0x62000008, 0x1108fff1, 0xf162ec4d,
+0x4d1108ff, 0xfff162ea, 0xeb4d1108, 0x08fff162,
+0x48eb4d10, 0x08ce058b, 0xf2620000, 0x4d9908f5,
+0x858948ea, 0xffffff68, 0x0000a7b8, 0xfef16200,
+0x62c97e08, 0xc208f7f1, 0xc500ed45, 0x66d093f8,
+0x850fcaff, 0x000001c3, 0x08fff162, 0x48eb4d10,
+0x089a058b, 0xf2620000, 0x4d9f08f5, 0x858948ea,
+0xffffff68, 0x0000abb8, 0xfef16200, 0x62c97e08,
+0xc208f7f1, 0xc500ed4d, 0x66d193f8, 0x850fcaff,
+0x00000187, 0x08fff162, 0xb8eb4d10, 0x000000af,
+0x08f5f262, 0x48ea4d9b, 0xff6885c7, 0x0000ffff,
+0xf1620000, 0xc97e08fe, 0x08f7f162, 0x00ed55c2,
+0xd293f8c5, 0x0fcaff66, 0x00014e85, 0xfff16200,
+0xeb4d1008, 0x35058b48, 0x62000008, 0x9d08f5f2,
+0x8948ea4d, 0xffff6885, 0x00b3b8ff, 0xf1620000,
+0xc97e08fe, 0x08f7f162, 0x00ed5dc2, 0xd393f8c5,
+0x0fcaff66, 0x00011285, 0xfff16200, 0xea4d1008,
+0x08fff162, 0x62eb6d10, 0x5808f7f1, 0xfff162d5,
+0xec5d1008, 0x0000bbb8, 0xfff16200, 0xeb751008,
+0x08fff162, 0x62ed5511, 0x9908cdf2, 0xf162ea5d,
+0xdb7e08fe, 0x08e7f162, 0x00ed65c2, 0xd493f8c5,
+0x0fcaff66, 0x0000c285, 0xfff16200, 0xec5d1008,
+0x0000c0b8, 0xfff16200, 0xeb7d1008, 0x08c5f262,
+0x62ea5d9f, 0x6e08fdf1, 0x00079325, 0x57e9c500,
+0xfff162d4, 0xed551108, 0x08fef162, 0xf162d37e,
+0x6dc208ef, 0xf8c500ed, 0xff66d593, 0x627c75ca,
+0x5c08f7f1, 0xfff162cd, 0xec551008, 0x0000c5b8,
+0xfff16200, 0xeb751008, 0x08fff162, 0x62ed4d11,
+0x9b08cdf2, 0xf162ea55, 0xd27e08fe, 0x08eff162,
+0x00ed75c2, 0xd693f8c5, 0x75caff66, 0xfff1623e,
+0xec551008, 0xcc57f1c5, 0x0000cab8, 0xfff16200,
+0xeb7d1008, 0x08c5f262, 0x62ea559d, 0x1108fff1,
+0xf162ed4d, 0xca7e08fe, 0x08f7f162, 0x00ed7dc2,
+0xd793f8c5, 0x75caff66, 0xc9c03102, 0x894855c3,
+0xe48348e5, 0xec8148c0, 0x00000180, 0x08fff162,
+0x06ba0d10, 0xf1620000, 0x4c1108ff, 0xf1620d24,
+0x4c1108ff, 0xf1620e24, 0x4c1108ff, 0x8b480f24,
+0x48682444, 0x50244489, 0x08fff162, 0x0a245410,
+0x000539b8, 0xfff16200, 0x24541108, 0xfdf16210,
+0x24546e08, 0xeff1620d, 0x2444c208, 0xf8c50010,
+0xff66d093, 0x5a850fca, 0x62000006, 0x1008fff1,
+0x620a2454, 0x5808eff1, 0x620d2454, 0x1108fff1,
+0x620b2454, 0x1008fff1, 0xb80b2454, 0x0000053f,
+0x08fff162, 0x10245411, 0x08fff162, 0x0d245410,
+0x08eff162, 0xf162d258, 0xd27e08fe, 0x08eff162,
+0x10244cc2, 0x93f8c500, 0xcaff66d1, 0x0603850f,
+0xf1620000, 0x541008ff, 0xf1620b24, 0x545c08ef,
+0xf1620d24, 0x141108ff, 0x048b4824, 0x84894824,
+0x0000b824, 0x44894800, 0x89485824, 0x62602444,
+0x1008fff1, 0xb80a2454, 0x00000544, 0x08fff162,
+0x10245411, 0x08fdf162, 0x0c24546e, 0x08eff162,
+0x102454c2, 0x93f8c500, 0xcaff66d2, 0x05a3850f,
+0xf1620000, 0x541008ff, 0xf1620a24, 0x545908ef,
+0xf1620d24, 0x541108ff, 0xf1620a24, 0x541008ff,
+0xf1620e24, 0xd25908ef, 0x08fff162, 0x0b245411,
+0x08fff162, 0x0d245410, 0x08eff162, 0x0e245458,
+0x08fff162, 0x0c245411, 0x08fff162, 0x0d245c10,
+0x08e7f162, 0x0e24545c, 0x00055bb8, 0xeff16200,
+0x24545908, 0xfff1620c, 0x24641008, 0xdff1620a,
+0x24645c08, 0xfff1620b, 0x24641108, 0xfff16210,
+0x24541108, 0xfef1620c, 0x62d27e08, 0xc208eff1,
+0x0010245c, 0xd393f8c5, 0x0fcaff66, 0x00050485,
+0xe7f16200, 0x245c5908, 0xfff1620f, 0x245c1108,
+0xfff1620a, 0x245c1008, 0xfff1620a, 0x24541008,
+0xeff1620d, 0x24545e08, 0xfff1620f, 0x24541108,
+0xfef1620b, 0xb8d27e08, 0x00000564, 0x08fff162,
+0x10245c11, 0x08eff162, 0x102464c2, 0x93f8c500,
+0xcaff66d4, 0x04ab850f, 0xf1620000, 0x1d6e08fd,
+0x000004cc, 0x08fff162, 0x0f245410, 0x000567b8,
+0x57e9c500, 0xeff162d3, 0x24545908, 0xfff1620a,
+0x24541108, 0xfff16210, 0x24541008, 0x57e9c50d,
+0xfef162d3, 0x62d27e08, 0xc208eff1, 0x0010246c,
+0xd593f8c5, 0x0fcaff66, 0x00045885, 0x2cfbc500,
+0x89682444, 0x00802484, 0xebc50000, 0x8024942a,
+0x62000000, 0x1108fff1, 0x620a2454, 0x1008fff1,
+0xb80a2454, 0x0000056e, 0x08fff162, 0x10245411,
+0x08fdf162, 0x0d24546e, 0x08eff162, 0x102474c2,
+0x93f8c500, 0xcaff66d6, 0x0407850f, 0xf2620000,
+0x544d08ed, 0xf1620d24, 0x541308fd, 0xf2620a24,
+0x544d08ed, 0xfbc50a24, 0x8489c22c, 0x00008024,
+0x2aebc500, 0x00802494, 0x75b80000, 0x62000005,
+0x1108fff1, 0x62102454, 0x1008fff1, 0x620d2454,
+0x7e08fef1, 0xe7f162da, 0x247cc208, 0xf8c50010,
+0xff66d793, 0xaa850fca, 0x62000003, 0x5908eff1,
+0xfff162d2, 0x24541108, 0xedf2620a, 0x24544f08,
+0xfdf1620a, 0x24541308, 0xedf2620b, 0x24544d08,
+0x2cfbc50b, 0x248489c2, 0x00000080, 0x942aebc5,
+0x00008024, 0x057cb800, 0xf1620000, 0x541108ff,
+0xf1621024, 0x546e08fd, 0xf1620d24, 0x44c208ef,
+0xc5001024, 0x66d093f8, 0x850fcaff, 0x00000345,
+0x442cfbc5, 0x84895824, 0x00008024, 0x2aebc500,
+0x00802494, 0xf1620000, 0x541108ff, 0xf2621024,
+0x544d08ed, 0xfbc50d24, 0x4489c22c, 0xebc54c24,
+0x4c24542a, 0x00057eb8, 0xfef16200, 0x62d27e08,
+0xc208eff1, 0x0010244c, 0xd193f8c5, 0x0fcaff66,
+0x0002f085, 0xfbe1c400, 0x6824442c, 0x24848948,
+0x00000080, 0x2aebe1c4, 0x00802494, 0xf1620000,
+0x541108ff, 0xf1620a24, 0x541008ff, 0x88b80a24,
+0x62000005, 0x1108fff1, 0x62102454, 0x6e08fdf1,
+0x620d2454, 0xc208eff1, 0x00102454, 0xd293f8c5,
+0x0fcaff66, 0x00029c85, 0x7ff16200, 0x24447908,
+0x2484890d, 0x00000080, 0x086ff162, 0x2024547b,
+0x08fdf162, 0x0a245413, 0x08fff162, 0x0a245410,
+0x00058fb8, 0xfff16200, 0x24541108, 0xfdf16210,
+0x24546e08, 0xeff1620d, 0x245cc208, 0xf8c50010,
+0xff66d393, 0x4a850fca, 0x62000002, 0x7908fff1,
+0x480d2444, 0x80248489, 0x62000000, 0x7b08eff1,
+0x62102454, 0x1308fdf1, 0x620a2454, 0x1008fff1,
+0xb80a2454, 0x00000596, 0x08fff162, 0x10245411,
+0x08fff162, 0x0d245410, 0x08fef162, 0xf162da7e,
+0x64c208e7, 0xc5001024, 0x66d493f8, 0x850fcaff,
+0x000001f1, 0x08eff162, 0xf162d259, 0x541108ff,
+0xf1620a24, 0x545108ef, 0xf1620a24, 0x541308fd,
+0x9cb81024, 0x62000005, 0x1008fff1, 0x620d2454,
+0x7e08fef1, 0xe7f162da, 0x246cc208, 0xf8c50010,
+0xff66d593, 0xaa850fca, 0x62000001, 0x5e08f7f1,
+0xfff162d2, 0x244c1108, 0xfff1620b, 0x24541108,
+0xfff1620a, 0x245c1008, 0x05a4b80b, 0xf3620000,
+0x540b08ed, 0x620b0a24, 0x1108fff1, 0x6210245c,
+0x1108fff1, 0x620c2454, 0x7e08fef1, 0xeff162d2,
+0x2474c208, 0xf8c50010, 0xff66d693, 0x52850fca,
+0x62000001, 0x1008fff1, 0x620f2454, 0x5908eff1,
+0x620d245c, 0x5908eff1, 0x620e2454, 0x1108fff1,
+0x620a245c, 0x1108fff1, 0x620b2454, 0x1008fff1,
+0x620a2454, 0x5f08eff1, 0x620b2454, 0x1108fff1,
+0x620c2454, 0x1008fff1, 0x620a2454, 0x5d08eff1,
+0x620b2454, 0x1108fff1, 0x620b2454, 0x1008fff1,
+0x620b2454, 0x5808eff1, 0xb80c2454, 0x0000063d,
+0x08eff162, 0x0f245459, 0x24548b48, 0x94894868,
+0x00017024, 0xfff16200, 0x24541108, 0xfff16210,
+0x24541008, 0xeff1622e, 0x24545808, 0xfef1620e,
+0x62d27e08, 0xc208eff1, 0x0010247c, 0xcf93f8c5,
+0x0fc9ff66, 0x00009c85, 0x54894800, 0xf3625824,
+0x542708ed, 0x62000d24, 0x1308fdf1, 0x620a2454,
+0x4308edf2, 0x620d2454, 0x1308fdf1, 0xc50b2454,
+0x62d257e9, 0x2e08fdf1, 0x7a0b2454, 0x625a755c,
+0x2e08fdf1, 0x7a0a244c, 0x62557557, 0x1008fff1,
+0x620d2454, 0x6e08fdf1, 0xb80a244c, 0x0000077d,
+0x08f5f262, 0x0b244c2d, 0x08fff162, 0x10245411,
+0x08fff162, 0x0c244c11, 0x08fef162, 0xf162c97e,
+0x44c208f7, 0xc5001024, 0x66d093f8, 0x1575caff,
+0xfff720e8, 0xebd8f7ff, 0x0773b80c, 0x05eb0000,
+0x000778b8, 0x00c3c900, 0x00000000, 0x00000000,
+0x00000000, 0x3ff00000, 0x00000000, 0x40000000,
+0x00000000, 0xc0000000, 0x00000000, 0x00000000,
+0x00000000, 0x80000000, 0x00000000, 0x00000000,
+0004460,
+};
+asm(".type avx512dq_x86_64_D_f8, STT_NOTYPE;");
+asm(".type avx512dq_x86_64_D_f8, STT_FUNC;");
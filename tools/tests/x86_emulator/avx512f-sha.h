@@ -0,0 +1,237 @@
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512f_sha_x86_32_D_16[] = {
+0x83e58955, 0x02e8f0e4, 0xc9000000, 0x01ba55c3,
+0x89000000, 0xec8153e5, 0x000000e4, 0x087df162,
+0x0720056f, 0xf1620010, 0x857f087d, 0xffffff78,
+0x087df162, 0xf162c0ef, 0x857f087d, 0xffffff88,
+0x88155488, 0x10fa8342, 0xf162f675, 0xad6f087d,
+0xffffff88, 0x0845f162, 0xf162ffef, 0xad7f087d,
+0xffffff68, 0xffcc3a0f, 0x7df16201, 0x18bd7f08,
+0x62ffffff, 0xef0855f1, 0x55f162ed, 0x6885fa08,
+0x62ffffff, 0x7f087df1, 0xffffa885, 0x7df162ff,
+0x0fd06f08, 0x6895c938, 0xc4ffffff, 0x8d0f79e3,
+0xffffff68, 0x7df16208, 0x62c9ef08, 0x1f086df3,
+0xf8c500c1, 0x0f3cc093, 0x05db850f, 0xf1620000,
+0xd06f087d, 0x95ca380f, 0xffffff68, 0x087df162,
+0xff68b56f, 0xe3c4ffff, 0x0cc80f49, 0x087df162,
+0xf162c9ef, 0x8d7f087d, 0xffffff98, 0x0875f162,
+0xff988d72, 0xc401ffff, 0xc90f49e3, 0x75f1620c,
+0x62c8ef08, 0x7f087df1, 0xffff988d, 0x75f162ff,
+0x988d7208, 0x01ffffff, 0x086df362, 0xc500c91f,
+0x3cc193f8, 0x75850f0f, 0x62000005, 0x6f087df1,
+0xca380fd0, 0xffff6895, 0x7df162ff, 0x68a56f08,
+0xc4ffffff, 0xc80f59e3, 0x7df1620c, 0x62c9ef08,
+0x151875f2, 0xe3c4de4d, 0x0cc90f59, 0x087df162,
+0xf262c9ef, 0x4d151875, 0x6df362de, 0x00d11f08,
+0xc293f8c5, 0x850f0f3c, 0x0000052b, 0x85c8380f,
+0xffffff68, 0x087df162, 0xffa8956f, 0xf162ffff,
+0xc2720875, 0x62c03102, 0x6f087df1, 0xffff68b5,
+0x7df162ff, 0x988d7f08, 0x89ffffff, 0x45899845,
+0xa045899c, 0x084df162, 0xff988dfe, 0xf362ffff,
+0xd91f087d, 0x93f8c500, 0x0f0f3cc3, 0x0004dd85,
+0x7df16200, 0x0ffa6f08, 0x68bdcc3a, 0x01ffffff,
+0x086df162, 0xffa89d73, 0x620cffff, 0x730865f1,
+0xffffa89d, 0xf16208ff, 0x85720855, 0xffffffa8,
+0x7df16202, 0x188d7208, 0x02ffffff, 0xf162c031,
+0x8d6f087d, 0xffffffa8, 0x0251e3c4, 0xf16203e9,
+0xad7f087d, 0xffffffb8, 0x084df162, 0xffb8bd73,
+0x6204ffff, 0x73085df1, 0xffffb89d, 0xf16204ff,
+0xb57f087d, 0xffffff48, 0x087df162, 0xff68b570,
+0x621bffff, 0x7f087df1, 0xffff58b5, 0x7df162ff,
+0x00f07008, 0x087df162, 0xff38b57f, 0xf162ffff,
+0xca72084d, 0x7df16205, 0x62c56f08, 0x25085df3,
+0xf88396c3, 0x7df16201, 0x62c6fe08, 0xfe087df1,
+0xffff5885, 0x7df162ff, 0x4885fe08, 0x62ffffff,
+0xfe087df1, 0xffff3885, 0x834374ff, 0x307402f8,
+0x4e75c085, 0x084df162, 0x6202c072, 0x7e087df1,
+0x59e3c4f0, 0x6203e022, 0x7e087df1, 0x61e3c4c0,
+0xc402d822, 0xd02269e3, 0x0001b801, 0x8eeb0000,
+0x1679e3c4, 0xe3c402c1, 0x03d12269, 0xe3c428eb,
+0x01c11679, 0x2261e3c4, 0xe3c403d9, 0x02d12269,
+0xe3c436eb, 0x03d11679, 0x1679e3c4, 0xd93902c3,
+0x039f850f, 0xe3c40000, 0x01c11679, 0x1679e3c4,
+0xcb3902d3, 0x0392850f, 0xe3c40000, 0x03d91679,
+0x850fd939, 0x0000038b, 0x087df162, 0xe3c4c17e,
+0x01d31679, 0x850fcb39, 0x0000037e, 0x1679e3c4,
+0xd93902d9, 0x0377850f, 0xf1620000, 0xc072084d,
+0x79e3c402, 0x6203e116, 0x7e087df1, 0x0fd939f3,
+0x00036385, 0xf8834000, 0xef850f04, 0xc4fffffe,
+0xf00249e3, 0x45f3620c, 0x00e61f08, 0xc493f8c5,
+0x850f0f3c, 0x00000347, 0x087df162, 0x380fd16f,
+0xff6895cc, 0xf162ffff, 0xbd6f087d, 0xffffff68,
+0x0f41e3c4, 0xf16204c1, 0x857f087d, 0xffffffe8,
+0x0865f162, 0xffe88572, 0x6207ffff, 0x72087df1,
+0xffffe88d, 0xf1620eff, 0xc0ef0865, 0x0865f162,
+0xffe89572, 0x6203ffff, 0xef087df1, 0x7df162c3,
+0x62c1fe08, 0x1f086df3, 0xf8c500e8, 0x0f3cc593,
+0x02e0850f, 0xf1620000, 0xd16f087d, 0x95cd380f,
+0xffffff68, 0x087df162, 0x0730256f, 0xe3c40010,
+0x68850f71, 0x08ffffff, 0x087df162, 0xffc8a57f,
+0xf162ffff, 0x2d6f087d, 0x00100740, 0x087df162,
+0x07503d6f, 0xf1620010, 0xad7f087d, 0xffffffd8,
+0x187df262, 0x62f26514, 0x14187df2, 0xf162f65d,
+0xbd7f087d, 0xffffffe8, 0x187df262, 0x62fa4545,
+0x250865f3, 0xf16296c4, 0xc1fe087d, 0x0f79e3c4,
+0xffff6885, 0xf26208ff, 0x6514187d, 0x7df262f2,
+0xf65d1418, 0x187df262, 0x62fa4545, 0x250865f3,
+0xf16296c4, 0xc1fe087d, 0x086df362, 0xc500f01f,
+0x3cc693f8, 0x32850f0f, 0x8b000002, 0xd0f7ac45,
+0x087df162, 0xf162e06e, 0xa57f087d, 0xffffff98,
+0x087df162, 0xff68ad6f, 0xf162ffff, 0xf96f087d,
+0x087df162, 0xf162c56f, 0xad7f087d, 0xffffff58,
+0x7dcb380f, 0x7df16298, 0x31c0ef08, 0x79e3c4c0,
+0x6208c10f, 0x6e087df1, 0xf162eb65, 0x857f087d,
+0xffffffb8, 0x2259e3c4, 0x62019845, 0x70087df1,
+0xf16244e1, 0xe86c08fd, 0x087df162, 0xff38a57f,
+0xf162ffff, 0xad7f087d, 0xffffff48, 0x0875f162,
+0xf162c9ef, 0x356f087d, 0x00100760, 0x0855f162,
+0x6206c172, 0x7f087df1, 0xffffc8b5, 0x5df162ff,
+0x0bc17208, 0x087df162, 0x0770356f, 0xf1620010,
+0x956f087d, 0xffffffb8, 0x087df162, 0xffd8b57f,
+0xf162ffff, 0xc9720865, 0x7df16207, 0x80356f08,
+0x62001007, 0x7f087df1, 0xffffe8b5, 0x6df262ff,
+0xc8b51408, 0x62ffffff, 0x7f087df1, 0xffff28b5,
+0x6df262ff, 0xd8b51408, 0x62ffffff, 0x15086df2,
+0xffffe895, 0x5df362ff, 0x96dd2508, 0x0875f162,
+0xff4885df, 0xf162ffff, 0xc3fe087d, 0x087df162,
+0xff589d70, 0x8544ffff, 0x7df162c0, 0x62c3fe08,
+0xfe087df1, 0xffff3885, 0x4df362ff, 0x28952508,
+0x96ffffff, 0x087df162, 0xe3c4c2fe, 0x02c01679,
+0x45891f75, 0x7df162c4, 0xc4c07e08, 0xc82271e3,
+0x71e3c401, 0xb803c822, 0x00000001, 0xffff11e9,
+0xc44539ff, 0x00ba850f, 0xf1620000, 0xc17e087d,
+0x1679e3c4, 0xc13901c8, 0x00ad850f, 0xe3c40000,
+0x03c81679, 0x850fc139, 0x000000a6, 0x0845f362,
+0xc500f81f, 0x3cc793f8, 0x9a850f0f, 0xb8000000,
+0x10101010, 0x7df2624a, 0x62c07c08, 0xfe087df1,
+0xffff6885, 0x7df162ff, 0x68857f08, 0x0fffffff,
+0xfff9de85, 0xebc031ff, 0x009ab875, 0x6eeb0000,
+0x0000a6b8, 0xb867eb00, 0x000000ae, 0xb7b860eb,
+0xeb000000, 0x0108b859, 0x52eb0000, 0x00010bb8,
+0xb84beb00, 0x0000010c, 0x0fb844eb, 0xeb000001,
+0x0110b83d, 0x36eb0000, 0x000111b8, 0xb82feb00,
+0x00000118, 0x1fb828eb, 0xeb000001, 0x0127b821,
+0x1aeb0000, 0x00017bb8, 0xb813eb00, 0x0000017d,
+0x7fb80ceb, 0xeb000001, 0x0182b805, 0xc4810000,
+0x000000e4, 0x00c35d5b, 0x00000000, 0x00000000,
+0x00000001, 0x00000000, 0x00000000, 0x00000000,
+0x00000011, 0x00000000, 0x00000000, 0x00000000,
+0x00000013, 0x00000000, 0x00000000, 0x00000000,
+0x0000000a, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000002, 0x00000002,
+0x00000000, 0x00000000, 0x0000000d, 0x0000000d,
+0x00000000, 0x00000000, 0x0000000a, 0x0000000a,
+0003620,
+};
+asm(".type avx512f_sha_x86_32_D_16, STT_NOTYPE;");
+asm(".type avx512f_sha_x86_32_D_16, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512f_sha_x86_64_D_16[] = {
+0xb85500eb, 0x00000001, 0x48e58948, 0x6218ec83,
+0x6f087df1, 0x00060705, 0x7df16200, 0xf8457f08,
+0x087df162, 0xf162c0ef, 0x457f087d, 0x054488f9,
+0xc0ff4890, 0x10f88348, 0xf162f375, 0xe4ef085d,
+0x000010ba, 0x7df16200, 0xf96d6f08, 0x087df162,
+0x05ea356f, 0xf1620000, 0x3d6f087d, 0x000005f0,
+0x087df162, 0x7162dc6f, 0x056f087d, 0x000005f0,
+0x087df162, 0x0ff76d7f, 0x01dccc3a, 0x087df162,
+0x05aa2d6f, 0x71620000, 0x0d6f087d, 0x000005e0,
+0x0865f162, 0x6202cb72, 0x6f087d71, 0x0005df15,
+0x7df16200, 0x00db7008, 0x085df162, 0x62f745fa,
+0x7f087df1, 0xf162fb45, 0xd06f087d, 0x95c9380f,
+0xffffff70, 0x0f79e3c4, 0xffff708d, 0xf16208ff,
+0xc9ef087d, 0x086df362, 0xc500c11f, 0x3cc093f8,
+0xb7850f0f, 0x62000004, 0x6f087d71, 0x380f44d8,
+0xff709dca, 0xf162ffff, 0x4d6f087d, 0x71e3c4f7,
+0x620cd00f, 0xef087df1, 0x7df162d2, 0xfa557f08,
+0x086df162, 0x01fa4d72, 0x0f71e3c4, 0xf1620cca,
+0xc8ef0875, 0x087df162, 0x62fa4d7f, 0x720875f1,
+0x6201fa4d, 0x1f0825f3, 0xf8c500c9, 0x0f3cc193,
+0x045f850f, 0x71620000, 0xd86f087d, 0xca380f44,
+0xffff709d, 0x7df162ff, 0xf74d6f08, 0x0f71e3c4,
+0xf1620cd0, 0xd2ef087d, 0x186df262, 0xc4e05515,
+0xca0f71e3, 0x7df1620c, 0x62c9ef08, 0x151875f2,
+0xf362e04d, 0xd11f0825, 0x93f8c500, 0x0f0f3cc2,
+0x00041785, 0xc8380f00, 0xffff7085, 0x7d7162ff,
+0xfb6d6f08, 0xc931c031, 0x087df162, 0x62f74d6f,
+0x72086dd1, 0xf16202c5, 0x557f087d, 0x458948fa,
+0xa84d89a0, 0x0875f162, 0x62fa55fe, 0x1f087df3,
+0xf8c500da, 0x0f3cc393, 0x03d5850f, 0x0f440000,
+0x70adcc3a, 0x01ffffff, 0x086df162, 0x0cfb5d73,
+0x0825f162, 0x08fb5d73, 0x0805f162, 0x02fb4572,
+0x087df162, 0x31fb4d6f, 0x7de162c0, 0xf7457008,
+0x0163c41b, 0x6203f902, 0x7f087d71, 0xf162fc7d,
+0x5d73081d, 0xf16204fc, 0x7d730075, 0xf16204fc,
+0xca72080d, 0x7dd16205, 0x62c76f08, 0x25081dd3,
+0xd16296c3, 0xc6fe087d, 0x087db162, 0xb162c0fe,
+0xc1fe087d, 0x087df162, 0xf883c3fe, 0x83437401,
+0x307402f8, 0x4e75c085, 0x080df162, 0x6202c072,
+0x7e087d71, 0x1963c4f0, 0x6203e022, 0x7e087df1,
+0x2163c4c0, 0xc402d822, 0xd02269e3, 0x0001b801,
+0x9aeb0000, 0x1679e3c4, 0xe3c402c1, 0x03d12269,
+0xe3c428eb, 0x01c11679, 0x222163c4, 0xe3c403d9,
+0x02d12269, 0xe3c436eb, 0x03d11679, 0x1679e3c4,
+0xf13902c6, 0x02f0850f, 0xe3c40000, 0x01c11679,
+0x1679e3c4, 0xce3902d6, 0x02e3850f, 0x63c40000,
+0x03d91679, 0x850ff139, 0x000002dc, 0x087df162,
+0xe3c4c17e, 0x01d61679, 0x850fce39, 0x000002cf,
+0x167963c4, 0xf13902d9, 0x02c8850f, 0xf1620000,
+0xc072080d, 0x7963c402, 0x6203e116, 0x7e087d71,
+0x0ff139f6, 0x0002b485, 0x83c0ff00, 0x850f04f8,
+0xfffffefa, 0x020963c4, 0xd3620cf0, 0xe61f0815,
+0x93f8c500, 0x0f0f3cc4, 0x00029785, 0x7df16200,
+0x0fd16f08, 0x7095cc38, 0x62ffffff, 0x6f087df1,
+0xe3c4f745, 0x04c10f79, 0x087df162, 0x62ff457f,
+0x72087df1, 0x6207ff45, 0x720825f1, 0x620eff4d,
+0xef087dd1, 0x25f162c3, 0xff557208, 0x7dd16203,
+0x62c3ef08, 0xfe087df1, 0x6df362c1, 0x00e81f08,
+0xc593f8c5, 0x850f0f3c, 0x0000023f, 0x087d7162,
+0x0f44d96f, 0x709dcd38, 0x62ffffff, 0x6f087df1,
+0xf162f755, 0x6d7f087d, 0x7df162fd, 0xfe757f08,
+0x0f71e3c4, 0xf16208c2, 0x7d7f087d, 0x7d7262ff,
+0xf8651418, 0x187d7262, 0x62f46d14, 0x45187df2,
+0xd362fc45, 0xc525081d, 0x7df16296, 0xc4c1fe08,
+0xc20f79e3, 0x7d726208, 0xf4651418, 0x187df262,
+0x62f85514, 0x45187df2, 0xd362fc45, 0xc425086d,
+0x7df16296, 0x62c1fe08, 0x1f0825f3, 0xf8c500f0,
+0x0f3cc693, 0x01b8850f, 0x458b0000, 0x62d0f7b4,
+0x6e087df1, 0x7df162d0, 0xfa557f08, 0x087df162,
+0x62f7456f, 0x6f087df1, 0xcb380fd1, 0xe162a055,
+0xc26f087d, 0x086df162, 0xe162d2ef, 0xc970087d,
+0xc4c03144, 0xd10f69e3, 0x7df16208, 0x44c07008,
+0x087df162, 0x62fc557f, 0x6e087df1, 0x63c4ed55,
+0xa06d2269, 0x6df16201, 0x62d2ef08, 0x6c089551,
+0x05f162ed, 0x06c27208, 0x087d7162, 0x62fc5d6f,
+0x7f087d71, 0xf162fd45, 0xc272080d, 0x7d71620b,
+0xfe4d7f08, 0x081df162, 0x6207ca72, 0x7f087d71,
+0xe262ff55, 0x5d140825, 0x25e262fd, 0xfe551408,
+0x08257262, 0x62ff5d15, 0xdf086dd1, 0x0d5362cd,
+0x96e72508, 0xd162c085, 0xccfe0875, 0x0875f162,
+0xb162c8fe, 0xc9fe0875, 0x006d3362, 0x6296db25,
+0xfe0875d1, 0x79e3c4cb, 0x7502c816, 0xcc45891f,
+0x087df162, 0xe3c4c87e, 0x01d02269, 0x2269e3c4,
+0x01b803d0, 0xe9000000, 0xffffff65, 0x0fcc4539,
+0x0000b485, 0x7df16200, 0xc4c97e08, 0xd01679e3,
+0x0fc13901, 0x0000a785, 0x79e3c400, 0x3903d016,
+0xa0850fc1, 0x62000000, 0x1f007df3, 0xf8c500f9,
+0x0f3cc793, 0x0094850f, 0xf1620000, 0x056f087d,
+0x0000010c, 0x087df162, 0x62f745fe, 0x7f087df1,
+0xcafff745, 0xfb0e850f, 0xc031ffff, 0x9ab875eb,
+0xeb000000, 0x00a6b86e, 0x67eb0000, 0x0000aeb8,
+0xb860eb00, 0x000000b7, 0x08b859eb, 0xeb000001,
+0x010bb852, 0x4beb0000, 0x00010cb8, 0xb844eb00,
+0x0000010f, 0x10b83deb, 0xeb000001, 0x0111b836,
+0x2feb0000, 0x000118b8, 0xb828eb00, 0x0000011f,
+0x27b821eb, 0xeb000001, 0x017bb81a, 0x13eb0000,
+0x00017db8, 0xb80ceb00, 0x0000017f, 0x82b805eb,
+0xc9000001, 0x000000c3, 0x00000000, 0x00000000,
+0x00000001, 0x00000000, 0x00000000, 0x00000000,
+0x00000011, 0x00000000, 0x00000000, 0x00000000,
+0x00000013, 0x00000000, 0x00000000, 0x00000000,
+0x0000000a, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000002, 0x00000002,
+0x00000000, 0x00000000, 0x0000000d, 0x0000000d,
+0x00000000, 0x00000000, 0x0000000a, 0x0000000a,
+0x10101010, 0x10101010, 0x10101010, 0x10101010,
+0003240,
+};
+asm(".type avx512f_sha_x86_64_D_16, STT_NOTYPE;");
+asm(".type avx512f_sha_x86_64_D_16, STT_FUNC;");
@@ -0,0 +1,5511 @@
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512f_x86_32_D_64i4[] = {
+0x315500eb, 0x57e589c0, 0x0020be56, 0x31530000,
+0xc0e483db, 0x02c0ec81, 0x44c70000, 0x00201c24,
+0xc2890000, 0x000011bf, 0x40d18900, 0x2901e183,
+0x244c89c7, 0x01f98308, 0xe183c919, 0xd0854902,
+0xb34e0375, 0x848c8901, 0x0000017c, 0x08244c8b,
+0x8489ead1, 0x0000fc84, 0x84bc8900, 0x0000013c,
+0xbc84b489, 0xc1000001, 0xca0904e1, 0xfc849489,
+0x83000001, 0xf88308c2, 0x84948910, 0x0000023c,
+0xdb84a075, 0x74890474, 0xf1621c24, 0x746f487d,
+0xf1620424, 0x747f487d, 0xf1620124, 0x4c6f487d,
+0xf3620124, 0xc61f4875, 0x93f8c500, 0xfff981c8,
+0xba0000ff, 0x00000539, 0x06f3850f, 0xf1620000,
+0x54fe4875, 0xf1620424, 0x547f487d, 0xf1620224,
+0x74724865, 0x62010424, 0x6f487df1, 0xba022454,
+0x0000053f, 0x486df362, 0xc500d31f, 0x81ca93f8,
+0x00fffff9, 0xb6850f00, 0x62000006, 0xfa486df1,
+0x62042454, 0x7f487df1, 0x62032454, 0x1f4875f3,
+0x0003245c, 0xcb93f8c5, 0xfffff981, 0x44ba0000,
+0x0f000005, 0x00068885, 0x7df16200, 0x247c6f48,
+0x75f26205, 0x24544048, 0x45f26204, 0x62df4048,
+0x7f487df1, 0x6202245c, 0x6f487df1, 0x6204244c,
+0xfe4875f1, 0x75f162ef, 0x2464fa48, 0x6df16205,
+0xbad3fa48, 0x0000055b, 0x485df262, 0xf362e540,
+0xe41f486d, 0x93f8c500, 0xfff981cc, 0x620000ff,
+0x7f487df1, 0x0f032464, 0x00062485, 0x75f26200,
+0x24544048, 0x7df16205, 0x24547f48, 0x2484c701,
+0x00000080, 0x00000010, 0x8024948d, 0xc7000000,
+0x00bc2484, 0x00100000, 0xd1890000, 0xe8831a8b,
+0x04c28302, 0x1a89c301, 0x8902f883, 0x751c415c,
+0x249c89eb, 0x000000a0, 0x487df162, 0x0124746f,
+0x0005c8ba, 0x4df16200, 0x246c7648, 0x93f8c502,
+0x2444c7c5, 0x0000021c, 0xffff3d00, 0x850f0000,
+0x000005ad, 0x4875f162, 0x062454ef, 0x487df162,
+0x0124547f, 0x48edf262, 0x05245428, 0x48fdf162,
+0x0224547f, 0x848bdb31, 0x0001409c, 0x9c6cf700,
+0x9c848940, 0x000000c0, 0xc49c9489, 0x83000000,
+0xfb8302c3, 0x62df7510, 0x6f487df1, 0x6202247c,
+0x764845f1, 0xc5032474, 0x3dc693f8, 0x0000ffff,
+0x0005e1ba, 0x46850f00, 0x62000005, 0x404875f2,
+0x6206245c, 0x7f487df1, 0x6203245c, 0x72486df1,
+0x03032474, 0x487df162, 0x0124547f, 0x485df162,
+0x03247472, 0x5df16202, 0xbaecfe48, 0x000005ed,
+0x486df362, 0xc500fd1f, 0x3dc793f8, 0x0000ffff,
+0x04fb850f, 0xf1620000, 0x6472486d, 0x62020124,
+0xfe486df1, 0x05f2bad2, 0xf3620000, 0xc21f485d,
+0x93f8c500, 0xffff3dc0, 0x850f0000, 0x000004d1,
+0x1c2444c7, 0x00000003, 0x1c24448b, 0x08244489,
+0x891ff8c1, 0x620c2444, 0x7e08fef1, 0x62012474,
+0xf24865f1, 0x2444c7d6, 0x0000021c, 0x24448b00,
+0x2444891c, 0x1ff8c108, 0x0c244489, 0x08fef162,
+0x01247c7e, 0x4865f162, 0xf162dff2, 0xe3fe4865,
+0x000605ba, 0x6df36200, 0x00d41f48, 0xc293f8c5,
+0x00ffff3d, 0x66850f00, 0x8b000004, 0x891c2444,
+0xc1082444, 0x44891ff8, 0xf1620c24, 0x747e08fe,
+0xf1620124, 0xd6e2486d, 0x486df162, 0x09bad2fe,
+0x62000006, 0x1f4865f3, 0xf8c500da, 0xff3dc393,
+0x0f0000ff, 0x00042885, 0xefe9c500, 0x7df162d2,
+0x247c6f48, 0x45f36207, 0x06ca1f48, 0xc975f262,
+0x06245c40, 0x4865f262, 0x07246447, 0x000001b8,
+0x7df16200, 0x24746f48, 0x7df26207, 0x62d07c48,
+0xfa484df1, 0x7df162d2, 0x24547f48, 0x65f26207,
+0x24544748, 0x0621ba07, 0xf1620000, 0xeafe486d,
+0x485df362, 0xc500e51f, 0x3dc493f8, 0x0000ffff,
+0x03bb850f, 0xf2620000, 0x5446486d, 0x26ba0724,
+0x62000006, 0x1f486df3, 0xf8c500eb, 0xff3dc593,
+0x0f0000ff, 0x00039885, 0x7df16200, 0x24546f48,
+0x6df26206, 0x245c4048, 0x6df26205, 0x24644048,
+0x7df16204, 0x245c7f48, 0x5df26202, 0x245c3d48,
+0x5df26202, 0x24643948, 0x7df16202, 0x24647f48,
+0x65f16202, 0x245cfe48, 0x063dba02, 0xf1620000,
+0x64fe4875, 0xf2620524, 0xda404865, 0x4865f362,
+0xc500f41f, 0x3dc693f8, 0x0000ffff, 0x032f850f,
+0xf2620000, 0xda404875, 0x487df162, 0x01245c7f,
+0x487df262, 0x01245c1e, 0x4865f362, 0xc500f91f,
+0x3dc793f8, 0x0000ffff, 0x000644ba, 0xfe850f00,
+0x62000002, 0x6f487df1, 0x6204247c, 0x6f487df1,
+0x62052464, 0x434845f3, 0xf1621bcf, 0xc970487d,
+0x75f3621b, 0x00c41f48, 0xc093f8c5, 0x00ffff3d,
+0x064eba00, 0x850f0000, 0x000002c5, 0x000001b8,
+0x7df16200, 0x244c6f48, 0x0653ba04, 0xf2620000,
+0xd87c487d, 0x485df162, 0xf262dbfa, 0xd9364865,
+0x4865f362, 0xc500d41f, 0x3dc293f8, 0x0000ffff,
+0x028b850f, 0x84c70000, 0x00028024, 0x00001100,
+0x5df16200, 0xbad9fe48, 0x0000065d, 0x487df262,
+0x8024ac58, 0x62000002, 0x1f4855f3, 0xf8c500db,
+0xff3dc393, 0x0f0000ff, 0x00025485, 0x0011b800,
+0x61ba0000, 0x62000006, 0x7c487df2, 0x55f362e8,
+0x00e31f48, 0xc493f8c5, 0x00ffff3d, 0x2e850f00,
+0x62000002, 0x39487df3, 0x0028244c, 0x487df262,
+0x28245c5a, 0x4875f362, 0x28244c38, 0x75f36201,
+0x244c3848, 0xf3620228, 0x4c384875, 0x62032824,
+0x1f4865f3, 0xf8c500e9, 0xff3dc593, 0xba0000ff,
+0x0000067c, 0x01e7850f, 0xf1620000, 0x5c6f487d,
+0xf1620824, 0xcc6f487d, 0x4865f262, 0x04244c7e,
+0x487df162, 0x09246c6f, 0x4855f262, 0x0424647e,
+0x802484c7, 0x08000002, 0x62000000, 0xfa4875f1,
+0x06a6bacc, 0xf2620000, 0xca404875, 0x487df262,
+0x8024a458, 0x62000002, 0x1f4875f3, 0xf8c500f4,
+0xff3dc693, 0x620000ff, 0x7f487df1, 0x0f03244c,
+0x00017c85, 0x6df26200, 0x244c4048, 0xefd9c504,
+0x6df362e4, 0x01cc1f48, 0xc96df362, 0x6281d225,
+0x7f487df1, 0x6201244c, 0x764875f2, 0x7df162da,
+0x245c7f48, 0x62c03102, 0x6f487df1, 0x62012474,
+0x7f487df1, 0x8b0a2474, 0x02808494, 0x54890000,
+0x83402084, 0xef7508f8, 0x487df262, 0x01244c25,
+0x48fdf162, 0x03244c7f, 0x4875f362, 0x02247c1f,
+0x93f8c500, 0xffff3dc7, 0xb3ba0000, 0x0f000006,
+0x0000fc85, 0x62c03100, 0x6f487df1, 0x6204244c,
+0x7f487df1, 0x8b0a244c, 0x02808494, 0x54890000,
+0x83402084, 0xef7508f8, 0x487df262, 0x01245425,
+0x48fdf162, 0x0124547f, 0x48fdf162, 0x01247c6f,
+0x487ef262, 0x14247c35, 0xb48bc031, 0x00010084,
+0x84b43900, 0x00000280, 0xf1ba0a74, 0xe9000006,
+0x0000009d, 0x08f88340, 0x01b8e075, 0x62000000,
+0x7f487df1, 0x8b02244c, 0x01408494, 0x14890000,
+0x02c08381, 0x7511f883, 0xaaaab8ee, 0xf162ffff,
+0x4c6f487d, 0x3aba0424, 0xc5000007, 0x62c892f8,
+0x644975f2, 0x62052454, 0x1f486df3, 0x00022444,
+0xc093f8c5, 0x00ffff3d, 0x62467500, 0x034875f3,
+0x0fb801d9, 0xba000000, 0x0000074a, 0x487df262,
+0x01b8d07c, 0x62000000, 0xdb4875f1, 0x7df262ca,
+0x62d07c48, 0xfe4875f1, 0x65f362ca, 0x00c91f48,
+0xc193f8c5, 0x00ffff3d, 0x0000b800, 0x440f0000,
+0xf4658dd0, 0x5e5bd089, 0x00c35d5f,
+0003673,
+};
+asm(".type avx512f_x86_32_D_64i4, STT_NOTYPE;");
+asm(".type avx512f_x86_32_D_64i4, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512f_x86_32_D_64u4[] = {
+0x315500eb, 0x57e589c0, 0x0020be56, 0x31530000,
+0xc0e483db, 0x02c0ec81, 0x44c70000, 0x00201c24,
+0xc1890000, 0x000011ba, 0xc2294000, 0x0c245489,
+0xe283ca89, 0x8dc88501, 0x7c89ff7a, 0x03750824,
+0x8b01b34e, 0xc10c247c, 0x848904e2, 0x0000fc84,
+0x89e9d100, 0x01bc84b4, 0xca090000, 0xfc849489,
+0x83000001, 0xf88308c2, 0x84bc8910, 0x0000013c,
+0x08247c8b, 0x3c849489, 0x89000002, 0x017c84bc,
+0x9e750000, 0x0474db84, 0x1c247489, 0x487df162,
+0x04247c6f, 0x487df162, 0x01247c7f, 0x487df162,
+0x0124546f, 0x486df362, 0xc500c71f, 0x81c893f8,
+0x00fffff9, 0x0539ba00, 0x850f0000, 0x00000659,
+0x486df162, 0x04244cfe, 0x487df162, 0x02244c7f,
+0x4865f162, 0x04247472, 0x7df16201, 0x244c6f48,
+0x053fba02, 0xf3620000, 0xd31f4875, 0x93f8c500,
+0xfff981ca, 0x0f0000ff, 0x00061c85, 0x75f16200,
+0x244cfa48, 0x7df16204, 0x244c7f48, 0x7df16203,
+0x245c6f48, 0x6df36203, 0x00db1f48, 0xcb93f8c5,
+0xfffff981, 0x44ba0000, 0x0f000005, 0x0005e885,
+0x6df16200, 0x2454eb48, 0x7df16205, 0x24547f48,
+0x75f16201, 0x244cdb48, 0x7df16205, 0x244c7f48,
+0x65f16202, 0x2454ef48, 0x7df16205, 0x24547f48,
+0x75f16203, 0x244cdf48, 0x75f36201, 0x00e21f48,
+0xcc93f8c5, 0xfffff981, 0x50ba0000, 0x0f000005,
+0x00059485, 0x7df16200, 0x24546f48, 0x6df26204,
+0x244c4048, 0x7df16205, 0x244c7f48, 0x2484c701,
+0x00000080, 0x00000010, 0x8024948d, 0xc7000000,
+0x00bc2484, 0x00100000, 0xd3890000, 0xe8830a8b,
+0x04c28302, 0x0a89c101, 0x8902f883, 0x751c434c,
+0x248c89eb, 0x000000a0, 0x487df162, 0x0124746f,
+0x0005c8ba, 0x4df16200, 0x246c7648, 0x93f8c502,
+0x2444c7c5, 0x0000021c, 0xffff3d00, 0x850f0000,
+0x00000515, 0x486df162, 0x06244cef, 0x487df162,
+0x01244c7f, 0x48f5f162, 0x05244cf4, 0x48fdf162,
+0x02244c7f, 0x848bc931, 0x0001408c, 0x8c64f700,
+0x8c848940, 0x000000c0, 0xc48c9489, 0x83000000,
+0xf98302c1, 0x62df7510, 0x6f487df1, 0x6202247c,
+0x764845f1, 0xc5032474, 0x3dc693f8, 0x0000ffff,
+0x0005e1ba, 0xae850f00, 0x62000004, 0x7f487df1,
+0x62032454, 0x724875f1, 0x03032474, 0x487df162,
+0x01244c7f, 0x4865f162, 0x03247472, 0x65f16202,
+0xbae3fe48, 0x000005ed, 0x4875f362, 0xc500fc1f,
+0x3dc793f8, 0x0000ffff, 0x046b850f, 0xf1620000,
+0x54724875, 0x62020124, 0xfe4875f1, 0x05f2bac9,
+0xf3620000, 0xc11f4865, 0x93f8c500, 0xffff3dc0,
+0x850f0000, 0x00000441, 0x1c2444c7, 0x00000003,
+0x087df162, 0x07244c6e, 0x486df162, 0x44c7c9f2,
+0x00021c24, 0xf1620000, 0x5c6e087d, 0xf1620724,
+0xdbf2486d, 0x4865f162, 0x05bae3fe, 0x62000006,
+0x1f4875f3, 0xf8c500d4, 0xff3dc293, 0x0f0000ff,
+0x0003f485, 0x7df16200, 0x24646e08, 0x75f16207,
+0x62ccd248, 0xfe4875f1, 0x0609bac9, 0xf3620000,
+0xd91f4865, 0x93f8c500, 0xffff3dc3, 0x850f0000,
+0x000003c5, 0xc9eff1c5, 0x487df162, 0x0724746f,
+0x484df362, 0x6204c91f, 0x254875f3, 0xf162ffc9,
+0xe16fc97d, 0x485df162, 0xf262e2db, 0x6c47485d,
+0xf1620724, 0x5cfe4875, 0xf1620724, 0x5c7f487d,
+0xf2620724, 0x5c47485d, 0x21ba0724, 0x62000006,
+0xfe4865f1, 0x55f362f3, 0x00e61f48, 0xc493f8c5,
+0x00ffff3d, 0x5e850f00, 0x62000003, 0x454865f2,
+0xba07245c, 0x00000626, 0x4865f362, 0xc500ec1f,
+0x3dc593f8, 0x0000ffff, 0x033b850f, 0xf2620000,
+0x5c3b486d, 0xf2620524, 0x643f486d, 0xf1620524,
+0x54fe486d, 0xf1620524, 0xdcfe4865, 0x000634ba,
+0x65f36200, 0x00f21f48, 0xc693f8c5, 0x00ffff3d,
+0x02850f00, 0x62000003, 0x6f487df1, 0x6204247c,
+0x6f487df1, 0x6205245c, 0x434845f3, 0xf1621bd7,
+0xd270487d, 0x6df3621b, 0x00fb1f48, 0xc793f8c5,
+0x00ffff3d, 0x064eba00, 0x850f0000, 0x000002c9,
+0x4865f162, 0xf162e1fe, 0x546f487d, 0x53ba0424,
+0x62000006, 0x36485df2, 0x5df362e2, 0x00c31f48,
+0xc093f8c5, 0x00ffff3d, 0x9a850f00, 0xc7000002,
+0x02802484, 0x00110000, 0xf1620000, 0xe2fe4865,
+0x00065dba, 0x7df26200, 0x24ac5848, 0x00000280,
+0x4855f362, 0xc500cc1f, 0x3dc193f8, 0x0000ffff,
+0x0263850f, 0x11b80000, 0xba000000, 0x00000661,
+0x487df262, 0xf362e87c, 0xd41f4855, 0x93f8c500,
+0xffff3dc2, 0x850f0000, 0x0000023d, 0x487df362,
+0x28245439, 0x7df26200, 0x24645a48, 0x6df36228,
+0x24543848, 0xf3620128, 0x5438486d, 0x62022824,
+0x38486df3, 0x03282454, 0x485df362, 0xc500da1f,
+0x3dc393f8, 0x0000ffff, 0x00067cba, 0xf6850f00,
+0x62000001, 0x6f487df1, 0x62082454, 0x6f487df1,
+0x6df262e3, 0x24647e48, 0x7df16204, 0x24647f48,
+0x7df16201, 0x246c6f48, 0x55f26209, 0x245c7e48,
+0x2484c704, 0x00000280, 0x00000008, 0x4875f162,
+0xf362cbfe, 0x5c254865, 0x62550624, 0xfa4875f1,
+0x06a6bacc, 0xf1620000, 0x4cef4875, 0xf1620624,
+0xcbfa4875, 0x487df262, 0x80249c58, 0x62000002,
+0x1f4875f3, 0xf8c500e3, 0xff3dc493, 0x0f0000ff,
+0x00017485, 0xefe1c500, 0x7df162db, 0x244c6f48,
+0x6df26204, 0x62cb7e48, 0x764875f2, 0x7df162d3,
+0x244c7f48, 0x7df16202, 0x24547f48, 0x62c03103,
+0x6f487df1, 0x62042474, 0x7f487df1, 0x8b0a2474,
+0x02808494, 0x54890000, 0x83402084, 0xef7508f8,
+0x487df262, 0x01244c35, 0x48fdf162, 0x01244c7f,
+0x4875f362, 0x02246c1f, 0x93f8c500, 0xffff3dc5,
+0xd3ba0000, 0x0f000006, 0x0000fc85, 0x62c03100,
+0x6f487df1, 0x6204244c, 0x7f487df1, 0x8b0a244c,
+0x02808494, 0x54890000, 0x83402084, 0xef7508f8,
+0x487df262, 0x01245435, 0x48fdf162, 0x0124547f,
+0x48fdf162, 0x01247c6f, 0x487ef262, 0x14247c35,
+0xbc8bc031, 0x00010084, 0x84bc3900, 0x00000280,
+0xf1ba0a74, 0xe9000006, 0x0000009d, 0x08f88340,
+0x01b8e075, 0x62000000, 0x7f487df1, 0x8b02244c,
+0x01408494, 0x14890000, 0x02c08383, 0x7511f883,
+0xaaaab8ee, 0xf162ffff, 0x4c6f487d, 0x3aba0424,
+0xc5000007, 0x62c892f8, 0x644975f2, 0x62052454,
+0x1f486df3, 0x00022474, 0xc693f8c5, 0x00ffff3d,
+0x62467500, 0x034875f3, 0x0fb801d9, 0xba000000,
+0x0000074a, 0x487df262, 0x01b8d07c, 0x62000000,
+0xdb4875f1, 0x7df262ca, 0x62d07c48, 0xfe4875f1,
+0x65f362ca, 0x00f91f48, 0xc793f8c5, 0x00ffff3d,
+0x0000b800, 0x440f0000, 0xf4658dd0, 0x5e5bd089,
+0x00c35d5f,
+0003443,
+};
+asm(".type avx512f_x86_32_D_64u4, STT_NOTYPE;");
+asm(".type avx512f_x86_32_D_64u4, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512f_x86_32_D_64i8[] = {
+0x895500eb, 0xff3157e5, 0x0001be56, 0xbb530000,
+0x00000040, 0x81c0e483, 0x000380ec, 0xff468d00,
+0x8489d231, 0x0000c024, 0x0009b800, 0xf1890000,
+0x802484c7, 0xff000000, 0x29ffffff, 0x244489f0,
+0x24848b40, 0x000000c0, 0x5489fa19, 0x84c74424,
+0x00008424, 0xffffff00, 0x01e083ff, 0x1475c289,
+0x802484c7, 0x01000000, 0x31000000, 0x248489c0,
+0x00000084, 0xc0248c85, 0x75000000, 0xb4894b01,
+0x0001f8cc, 0x03e2c100, 0x8489c031, 0x0002bccc,
+0x24848b00, 0x000000c0, 0x08fef162, 0x0824747e,
+0xfcccbc89, 0x62000001, 0x7e08fef1, 0x6210247c,
+0xd608fdf1, 0x8947cc74, 0x02b8cc9c, 0xf1620000,
+0x7cd608fd, 0xe8d14fcc, 0xd231d009, 0xf8cc8489,
+0x83000002, 0x948904c0, 0x0002fccc, 0x00d28300,
+0x8901c683, 0x0338cc84, 0xf0890000, 0x8900d783,
+0x033ccc94, 0xf0830000, 0x0ff80909, 0xffff1c85,
+0xfdf162ff, 0x247c6f48, 0xfdf16208, 0x247c7f48,
+0xfdf16205, 0x245c6f48, 0xe5f36205, 0x00c71f48,
+0xd093f8c5, 0x39b8c2fe, 0x0f000005, 0x00073585,
+0xe5f16200, 0x244cd448, 0xfdf16208, 0x244c7f48,
+0xedf16206, 0x24747348, 0xf1620108, 0x4c6f48fd,
+0x3fb80624, 0x62000005, 0x1f48f5f3, 0xf8c500d2,
+0xc2fed293, 0x06fc850f, 0xf1620000, 0x4cfb48f5,
+0xf1620824, 0x4c7f48fd, 0xf3620724, 0x5c1f48e5,
+0xc5000724, 0xfed393f8, 0x0544b8c2, 0x850f0000,
+0x000006d2, 0x48ddf162, 0x08245473, 0xf5f16220,
+0x20d37348, 0x487df162, 0x0924746f, 0x48f5f162,
+0x08244cf4, 0x48e5f162, 0x082454f4, 0x48ddf162,
+0xf162dbf4, 0xe6f448cd, 0x48f5f162, 0xf162cbd4,
+0xf17348f5, 0xedf16220, 0x62d1d448, 0x7348f5f1,
+0x20092454, 0x48f5f162, 0xf162cef4, 0xc9d448f5,
+0x48f5f162, 0x6220f173, 0xd448ddf1, 0xfdf162e1,
+0x247c6f48, 0xc5f16208, 0x244cd448, 0xc5f16209,
+0x2474fb48, 0xedf16209, 0xb8d4fb48, 0x0000055b,
+0x48d5f162, 0x6220d673, 0xf448cdf1, 0xfdf162d9,
+0x246c7f48, 0xd5f16203, 0x20d17348, 0x48f5f162,
+0x03244cf4, 0x48d5f162, 0xf162eef4, 0xcdd448f5,
+0x48f5f162, 0x6220f173, 0xd448e5f1, 0xedf362d9,
+0x00e31f48, 0xd493f8c5, 0x850fc2fe, 0x000005f6,
+0x48ddf162, 0x09245473, 0xe5f16220, 0x20d77348,
+0x48e5f162, 0x09244cf4, 0x48c5f162, 0x092454f4,
+0x48ddf162, 0xf162e7f4, 0xccd448f5, 0x48f5f162,
+0x6220f173, 0xd448edf1, 0xf5f362c9, 0x802d1f48,
+0x00001008, 0xd593f8c5, 0xc8b8c2fe, 0x0f000005,
+0x0005a185, 0xfdf16200, 0x244c6f48, 0xddf1620a,
+0x20d17348, 0x48e5f162, 0xf162d1f4, 0xf7f448dd,
+0x48c5f162, 0xf162e9f4, 0xd6d448ed, 0x48fdf162,
+0x0324747f, 0x48edf162, 0x6220f273, 0xd448d5f1,
+0xfdf162d2, 0x24547f48, 0xcdf16207, 0x24747348,
+0xf1620307, 0x747f48fd, 0xf1620524, 0x747348ed,
+0x62020724, 0xd448edf1, 0x05edb8e2, 0xf3620000,
+0xf41f48cd, 0x93f8c500, 0x62c2fed6, 0xf448e5f1,
+0x1f850ff1, 0x62000005, 0x7248e5f1, 0x02052464,
+0x48e5f162, 0xf2b8dbd4, 0x62000005, 0x1f48edf3,
+0xf8c500fb, 0xc2fed793, 0x04f8850f, 0xf1620000,
+0x54d448cd, 0x84c70324, 0x00011c24, 0x00000300,
+0xedf16200, 0x20f27348, 0x48d5f162, 0x848bd2d4,
+0x00011c24, 0x24848900, 0x00000080, 0x891ff8c1,
+0x00842484, 0xf1620000, 0x5c7e08fe, 0xf1621024,
+0xdbf348ed, 0x1c2484c7, 0x02000001, 0x8b000000,
+0x011c2484, 0x84890000, 0x00008024, 0x1ff8c100,
+0x84248489, 0x62000000, 0x7e08fef1, 0x62102464,
+0xf348edf1, 0xedf162d4, 0xb8e2d448, 0x00000605,
+0x48e5f362, 0xc500c41f, 0xfed093f8, 0x63850fc2,
+0x8b000004, 0x011c2484, 0x84890000, 0x00008024,
+0x1ff8c100, 0x84248489, 0x62000000, 0x7e08fef1,
+0x62102464, 0xe248e5f1, 0xe5f162dc, 0xb8dbd448,
+0x00000609, 0x48edf362, 0xc500d31f, 0xfed293f8,
+0x1f850fc2, 0x62000004, 0xd448cdf1, 0xc503245c,
+0x62d2efe9, 0x6f48fdf1, 0x620b2474, 0x1f48cdf3,
+0xf16206ca, 0xf37348e5, 0xd5f16220, 0x62d3d4c9,
+0x7f48fdf1, 0x62072454, 0x4748edf2, 0x620b2464,
+0x6f48fdf1, 0x620b2474, 0xfb58cdf1, 0x1008c01d,
+0xfdf16200, 0x245c7f48, 0xedf2620b, 0x24544748,
+0x0621b80b, 0xf1620000, 0x547f48fd, 0xf1620624,
+0xd2d448ed, 0x48ddf362, 0xc500da1f, 0xfed393f8,
+0x9f850fc2, 0x62000003, 0x6f48fdf1, 0x62062474,
+0x4648cdf2, 0xb80b2454, 0x00000626, 0x48edf362,
+0x0724641f, 0x93f8c500, 0x0fc2fed4, 0x00037585,
+0xedf16200, 0x20d77348, 0x48fdf162, 0xf162f56f,
+0xd17348d5, 0xfdf16220, 0x246c7f48, 0xfdf16203,
+0x24547f48, 0xc5f16202, 0x246cf448, 0xf5f16203,
+0x2454f448, 0xfdf16202, 0x245c6f48, 0xddf16209,
+0x20d37348, 0x48ddf162, 0xf162e1f4, 0x6c7f48fd,
+0xf1620124, 0xd5d448ed, 0x48e5f162, 0xf162e9f4,
+0x2c7f48fd, 0xe5f16224, 0x246cf448, 0xedf16203,
+0x20f27348, 0x48cdf162, 0xf162d2d4, 0xe5d448dd,
+0x48ddf162, 0x6220f473, 0xd448ddf1, 0xf162242c,
+0x6c7f48fd, 0xf2620624, 0x643d48ed, 0xf2620624,
+0x543948ed, 0xf1620624, 0x547f48fd, 0xf1620624,
+0x64d448dd, 0x3db80624, 0x62000006, 0xf448ddf1,
+0xedf162e9, 0x20d47348, 0x48ddf162, 0x032464f4,
+0x48edf162, 0xf162d1f4, 0xd4d448ed, 0x48edf162,
+0x6220f273, 0xd448d5f1, 0xc5f162ea, 0x62d3d448,
+0x1f48d5f3, 0xf8c500ea, 0xf162d593, 0x54f448f5,
+0xc2fe0224, 0x026c850f, 0xf1620000, 0x54d448ed,
+0xf1620124, 0xf27348ed, 0xcdf16220, 0x62d2d448,
+0x7f48fdf1, 0x62052454, 0x1f48fdf2, 0x62052454,
+0x1f48edf3, 0xf8c500f7, 0xc2fed693, 0x000644b8,
+0x2f850f00, 0x62000002, 0x6f48fdf1, 0x6208247c,
+0x4348c5f3, 0xf1621bd7, 0xd270487d, 0xedf3624e,
+0x00fb1f48, 0xd793f8c5, 0x4eb8c2fe, 0x0f000006,
+0x00020185, 0xfdf26200, 0xc0155948, 0x62001008,
+0xfb48e5f1, 0x0653b8e2, 0xf2620000, 0x643648dd,
+0xf3620824, 0xc31f48dd, 0x93f8c500, 0x0fc2fed0,
+0x0001d185, 0xfdf36200, 0x24640048, 0xf3621b08,
+0xe44348dd, 0xddf3624e, 0x00cb1f48, 0xd193f8c5,
+0x58b8c2fe, 0x0f000006, 0x0001a985, 0xfdf16200,
+0x24646f48, 0x2484c708, 0x00000120, 0x00000009,
+0x9489d231, 0x00012424, 0xddf16200, 0xb8f3d448,
+0x0000065d, 0x48fdf262, 0x24246c59, 0x48d5f362,
+0xc500d61f, 0xfed293f8, 0x67850fc2, 0x62000001,
+0x3b48fdf3, 0x00092464, 0x48fdf262, 0x09246c5b,
+0x48ddf362, 0x0924643a, 0xd5f36201, 0x00dc1f48,
+0xc393f8c5, 0x6cb8c0fe, 0x0f000006, 0x00013585,
+0xfdf16200, 0x24646f48, 0xe5f2620c, 0x24647648,
+0xfdf16208, 0x247c6f48, 0xc5f2620d, 0x245c7e48,
+0x2484c708, 0x00000120, 0x00000004, 0x48ddf162,
+0xc031e3fb, 0x48ddf162, 0x03247cf4, 0x48e5f162,
+0x8920d473, 0x01242484, 0xf1620000, 0xe9f448dd,
+0x48e5f162, 0xa6b8c9f4, 0x62000006, 0xd448f5f1,
+0xf5f162cf, 0x20f17348, 0x48d5f162, 0xf262e9d4,
+0x4c5948fd, 0xf3622424, 0xe11f48d5, 0x93f8c500,
+0x0fc2fed4, 0x0000ad85, 0xfef16200, 0x244c7e08,
+0xfdf16249, 0x247c6f48, 0xfdf16208, 0x247c7f48,
+0xfdf16206, 0x244cd608, 0xfef16231, 0x244c7e08,
+0xfdf1624b, 0x244cd608, 0xfef16233, 0x244c7e08,
+0xfdf1624d, 0x244cd608, 0xfef16235, 0x244c7e08,
+0xfdf1624f, 0x244cd608, 0x62aab037, 0x6f48fdf1,
+0xc508244c, 0x62c892f8, 0x6449f5f2, 0x6209245c,
+0x1f48e5f3, 0x0006246c, 0xd593f8c5, 0x3ab8c2fe,
+0x75000007, 0xf5f36231, 0x01d90348, 0x58f5f162,
+0x08c80ddb, 0xf1620010, 0xcad448f5, 0x000000ba,
+0xe5f36200, 0x00f11f48, 0xc693f8c5, 0x4ab8c0fe,
+0x0f000007, 0x658dc244, 0x5f5e5bf4, 0x0000c35d,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000008, 0x00000000, 0x0000000e, 0x00000000,
+0x00000012, 0x00000000, 0x00000014, 0x00000000,
+0x00000014, 0x00000000, 0x00000012, 0x00000000,
+0x0000000e, 0x00000000, 0x00000008, 0x00000000,
+0x00000001, 0x00000000, 0x00000007, 0x00000000,
+0004320,
+};
+asm(".type avx512f_x86_32_D_64i8, STT_NOTYPE;");
+asm(".type avx512f_x86_32_D_64i8, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512f_x86_32_D_64u8[] = {
+0x895500eb, 0xff3157e5, 0x0001be56, 0xbb530000,
+0x00000040, 0x81c0e483, 0x0002c0ec, 0xff468d00,
+0x4489d231, 0x09b84c24, 0x89000000, 0x89f029f1,
+0x8b402444, 0x194c2444, 0x245489fa, 0x01e08344,
+0x48244489, 0x24448948, 0x7485993c, 0x01754c24,
+0x7df1624b, 0xc4f86e08, 0xfa2241e3, 0xccb48901,
+0x00000138, 0x3cccbc89, 0x31000001, 0x24548bc0,
+0xcc848948, 0x000001fc, 0x4c24448b, 0x08fef162,
+0x0824747e, 0xf8cc9c89, 0x62000001, 0xd608fdf1,
+0x622fcc74, 0xd608fdf1, 0xc137cc7c, 0xe8d103e2,
+0xd231d009, 0x38cc8489, 0x83000002, 0x948904c0,
+0x00023ccc, 0x00d28300, 0x8901c683, 0x0278cc84,
+0xf0890000, 0x8900d783, 0x027ccc94, 0xf0830000,
+0x0ff80909, 0xffff4485, 0xfdf162ff, 0x24746f48,
+0xfdf16205, 0x24747f48, 0xfdf16202, 0x24546f48,
+0xedf36202, 0x00c61f48, 0xd093f8c5, 0x39b8c2fe,
+0x0f000005, 0x0004cb85, 0xedf16200, 0x244cd448,
+0xfdf16205, 0x244c7f48, 0xe5f16203, 0x24747348,
+0xf1620105, 0x4c6f48fd, 0x3fb80324, 0x62000005,
+0x1f48f5f3, 0xf8c500d3, 0xc2fed293, 0x0492850f,
+0xf1620000, 0x4cfb48f5, 0xf1620524, 0x4c7f48fd,
+0xf1620424, 0x5c6f48fd, 0xf3620424, 0xdb1f48ed,
+0x93f8c500, 0xb8c2fed3, 0x00000544, 0x0462850f,
+0xf1620000, 0x54eb48ed, 0xf1620624, 0x547f48fd,
+0xf1620224, 0x4cdb48f5, 0xf1620624, 0x5cef48e5,
+0xf1620624, 0x4cdf48f5, 0xf3620224, 0xe31f48f5,
+0x93f8c500, 0xb8c2fed4, 0x00000550, 0x0422850f,
+0xf1620000, 0x546f48fd, 0xf1620524, 0x547348dd,
+0x62200624, 0x7348f5f1, 0xf16220d2, 0x4cf448f5,
+0xf1620624, 0x5cf448ed, 0xf1620624, 0xe2f448dd,
+0x48f5f162, 0xf162ccd4, 0xf17348f5, 0xe5f16220,
+0x62c9d448, 0x1f48f5f3, 0x1006002d, 0xf8c50000,
+0xc2fed593, 0x0005c8b8, 0xc5850f00, 0x62000003,
+0x7f48fdf1, 0x62042454, 0x7348f5f1, 0x03042474,
+0x48fdf162, 0x02244c7f, 0x48e5f162, 0x04247473,
+0xe5f16202, 0xb8e3d448, 0x000005ed, 0x48f5f362,
+0xc500f41f, 0xfed693f8, 0x85850fc2, 0x62000003,
+0x7348f5f1, 0x02022454, 0x48f5f162, 0xf2b8c9d4,
+0x62000005, 0x1f48e5f3, 0xf8c500f9, 0xc2fed793,
+0x035e850f, 0x44c70000, 0x00035c24, 0xf1620000,
+0x4c6e087d, 0xf1621724, 0xc9f348ed, 0x5c2444c7,
+0x00000002, 0x087df162, 0x17245c6e, 0x48edf162,
+0xf162dbf3, 0xe3d448e5, 0x000605b8, 0xf5f36200,
+0x00c41f48, 0xd093f8c5, 0x850fc2fe, 0x00000314,
+0x087df162, 0x1724646e, 0x48f5f162, 0xf162ccd3,
+0xc9d448f5, 0x000609b8, 0xe5f36200, 0x00d11f48,
+0xd293f8c5, 0x850fc2fe, 0x000002e8, 0xc9eff1c5,
+0x48fdf162, 0x08247c6f, 0x48c5f362, 0x6204c91f,
+0x254875f3, 0xf162ffc9, 0xd96fc9fd, 0x48e5f162,
+0xf162dadb, 0x5c7f48fd, 0xf2620424, 0x644748e5,
+0xf1620824, 0x6cd448f5, 0xf1620824, 0x6c7f48fd,
+0xf2620824, 0x5c4748e5, 0x21b80824, 0x62000006,
+0x7f48fdf1, 0x6203245c, 0xd448e5f1, 0xddf362db,
+0x00db1f48, 0xd393f8c5, 0x850fc2fe, 0x00000274,
+0x48fdf162, 0x03246c6f, 0x48d5f262, 0x08245c45,
+0x000626b8, 0xe5f36200, 0x24641f48, 0xf8c50004,
+0xc2fed493, 0x024a850f, 0xf2620000, 0x5c3b48ed,
+0xf2620624, 0x643f48ed, 0xf1620624, 0x54d448ed,
+0xf1620624, 0xdcd448e5, 0x000634b8, 0xe5f36200,
+0x00ea1f48, 0xd593f8c5, 0x850fc2fe, 0x00000214,
+0x48fdf162, 0x0524746f, 0x48fdf162, 0x0624546f,
+0x48cdf362, 0x621bde43, 0x70487df1, 0xf3624edb,
+0xf21f48e5, 0x93f8c500, 0xb8c2fed6, 0x0000064e,
+0x01de850f, 0xf1620000, 0xd9d448ed, 0x000653b8,
+0xe5f26200, 0x245c3648, 0xe5f36205, 0x00fa1f48,
+0xd793f8c5, 0x850fc2fe, 0x000001b8, 0x48fdf362,
+0x05245c00, 0xe5f3621b, 0x4edb4348, 0x48e5f362,
+0xc500c21f, 0xfed093f8, 0x0658b8c2, 0x850f0000,
+0x00000190, 0x48fdf162, 0x05245c6f, 0x602444c7,
+0x00000009, 0x5489d231, 0xf1626424, 0xead448e5,
+0x00065db8, 0xfdf26200, 0x24645948, 0xddf3620c,
+0x00cd1f48, 0xd193f8c5, 0x850fc2fe, 0x00000154,
+0x48fdf362, 0x03245c3b, 0xfdf26200, 0x24645b48,
+0xe5f36203, 0x245c3a48, 0xf3620103, 0xd31f48dd,
+0x93f8c500, 0xb8c0fec2, 0x0000066c, 0x0122850f,
+0xf1620000, 0x5c6f48fd, 0xf2620924, 0x5c7648ed,
+0xf1620524, 0x7c6f48fd, 0xf2620a24, 0x547e48c5,
+0x44c70524, 0x00046024, 0xf1620000, 0xcad448f5,
+0xf362c031, 0x542548ed, 0x89550724, 0x62642444,
+0xfb48f5f1, 0xf5f162cb, 0x244cef48, 0xf5f16207,
+0xb8cafb48, 0x000006a6, 0x48fdf262, 0x0c245459,
+0x48f5f362, 0xc500da1f, 0xfed393f8, 0xb1850fc2,
+0x62000000, 0x7e08fef1, 0x6231244c, 0x6f48fdf1,
+0x6205246c, 0x7f48fdf1, 0x6203246c, 0xd608fdf1,
+0x6219244c, 0x7e08fef1, 0x6233244c, 0xd608fdf1,
+0x621b244c, 0x7e08fef1, 0x6235244c, 0xd608fdf1,
+0x621d244c, 0x7e08fef1, 0x6237244c, 0xd608fdf1,
+0xb01f244c, 0xfdf162aa, 0x244c6f48, 0x92f8c505,
+0xf5f262c8, 0x24546449, 0xedf36206, 0x24641f48,
+0xf8c50003, 0xc2fed493, 0x00073ab8, 0x62357500,
+0x0348f5f3, 0xf16201d1, 0x0ddb58f5, 0x00100640,
+0x58f5f162, 0x06480dd4, 0x00ba0010, 0x62000000,
+0x1f48edf3, 0xf8c500e9, 0xc0fec593, 0x00074ab8,
+0xc2440f00, 0x5bf4658d, 0xc35d5f5e, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000008, 0x00000000, 0x0000000e, 0x00000000,
+0x00000012, 0x00000000, 0x00000014, 0x00000000,
+0x00000014, 0x00000000, 0x00000012, 0x00000000,
+0x0000000e, 0x00000000, 0x00000008, 0x00000000,
+0x00000007, 0x00000000, 0x00000001, 0x00000000,
+0003120,
+};
+asm(".type avx512f_x86_32_D_64u8, STT_NOTYPE;");
+asm(".type avx512f_x86_32_D_64u8, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512f_x86_32_D_64f4[] = {
+0x000322e9, 0xc0315500, 0xe483e589, 0x81e8d9c0,
+0x000100ec, 0x0011b900, 0x54d90000, 0x89403824,
+0x244489ca, 0x83c2292c, 0x44db10f8, 0x54892c24,
+0x5cd92c24, 0x44db3c84, 0x5cd92c24, 0x94d97c84,
+0x0000bc84, 0x62d77500, 0x28487cf1, 0x62012454,
+0x28487cf1, 0x6202244c, 0x58586cf1, 0x100b4025,
+0x5cf16200, 0x62e15948, 0x28487cf1, 0x75f262d9,
+0x245c9848, 0x5cf16201, 0x00c3c248, 0xd093f8c5,
+0xfffffa81, 0xa7b80000, 0x0f000000, 0x00027685,
+0x7df26200, 0x001d1848, 0x6200100b, 0x28487cf1,
+0x5df162e9, 0x62e3ef48, 0x9e4875f2, 0x6201246c,
+0xc2485cf1, 0xf8c500cd, 0xfa81d193, 0x0000ffff,
+0x0000abb8, 0x40850f00, 0x62000002, 0x58586cf1,
+0x100b0415, 0x6cf16200, 0x62d15948, 0x28487cf1,
+0x75f262e1, 0x24649a48, 0x6cf16201, 0x00d4c248,
+0xd293f8c5, 0xfffffa81, 0xafb80000, 0x0f000000,
+0x00020a85, 0x7cf16200, 0x62e12848, 0xef486df1,
+0x75f262d3, 0x24649c48, 0x6cf16201, 0x00dcc248,
+0xd393f8c5, 0xfffffa81, 0xb3b80000, 0x0f000000,
+0x0001de85, 0x7cf16200, 0x24542848, 0x6cf16201,
+0x62e15848, 0x18487df2, 0x620e246c, 0x28487cf1,
+0x62022474, 0x98484df2, 0x5cf162ea, 0x00e5c248,
+0xd493f8c5, 0xfffffa81, 0xbbb80000, 0x0f000000,
+0x0001a285, 0x7cf16200, 0x62ea2848, 0x28487cf1,
+0x6202247c, 0xef485df1, 0x45f262e3, 0x246c9e58,
+0x5cf1620e, 0x00edc248, 0xd593f8c5, 0xfffffa81,
+0xc0b80000, 0x0f000000, 0x00016e85, 0x6cf16200,
+0x62c95c48, 0x18487df2, 0x620e2464, 0x28487cf1,
+0x62022474, 0x9a484df2, 0x74f162e2, 0x00f4c248,
+0xd693f8c5, 0xfffffa81, 0xc5b80000, 0x0f000000,
+0x00013a85, 0x7cf16200, 0x62e22848, 0x28487cf1,
+0x6202247c, 0xef4875f1, 0x45f262cb, 0x24649c58,
+0x74f1620e, 0x00fcc248, 0xd793f8c5, 0xfffffa81,
+0xcab80000, 0x0f000000, 0x00010685, 0x245cd900,
+0x6cf1623c, 0x246c5948, 0x7cf16202, 0x24642848,
+0x65f16203, 0x244cef48, 0x55f26203, 0x2464b658,
+0x55f2620f, 0x244cb658, 0x7cf1620f, 0x245c2848,
+0x7cf16202, 0x62ea2848, 0xa64865f2, 0x6203246c,
+0xc2485cf1, 0xf8c500c5, 0xfa81d093, 0x0000ffff,
+0x0000d4b8, 0xaa850f00, 0x62000000, 0xa7486df2,
+0x6203245c, 0xc24874f1, 0xf8c500cb, 0xfa81d193,
+0x0000ffff, 0x0000d8b8, 0x86850f00, 0x62000000,
+0x59486cf1, 0x6202246c, 0x28487cf1, 0x6203245c,
+0x28487cf1, 0x55f262e3, 0x2464b658, 0x7cf1620f,
+0x62ea2848, 0x964865f2, 0x6202246c, 0xc2485cf1,
+0xf8c500d5, 0xfa81d293, 0x0000ffff, 0x0000deb8,
+0x62427500, 0x974865f2, 0x62022454, 0xc24874f1,
+0xf8c500da, 0xfa81d393, 0x0000ffff, 0x0000e2b8,
+0x31227500, 0xdd1eebc0, 0xdd1aebd8, 0xdd16ebd8,
+0xdd12ebd8, 0xdd0eebd8, 0xdd0aebd8, 0xdd06ebd8,
+0xdd02ebd8, 0x55c3c9d8, 0xe589c031, 0xc0e48353,
+0x0280ec81, 0xc1890000, 0x24448940, 0x0011ba14,
+0x44db0000, 0xc2291424, 0x14245489, 0xe283ca89,
+0x849cd901, 0x000000fc, 0x142444db, 0x3c849cd9,
+0xd9000001, 0xd9e0d9e8, 0xddc9dbe8, 0x04e2c1d9,
+0x9cd9e9d1, 0x00017c84, 0x89ca0900, 0x01bc8494,
+0xc2830000, 0x10f88308, 0xfc849489, 0x75000001,
+0x7cf162a5, 0x24742848, 0x7cf16204, 0x24742948,
+0x7cf16201, 0x244c2848, 0x74f16201, 0x00c6c248,
+0xd093f8c5, 0xfffffa81, 0x39b80000, 0x0f000005,
+0x00072785, 0x74f16200, 0x24545848, 0x7cf16204,
+0x24542948, 0x7cf16202, 0x24542848, 0x7cf16202,
+0x247c2848, 0x44f16204, 0x62df5848, 0xc2486cf1,
+0xf8c500d3, 0xfa81d293, 0x0000ffff, 0x00053fb8,
+0xe5850f00, 0x62000006, 0x5c486cf1, 0x62042454,
+0x29487cf1, 0x62032454, 0xc24874f1, 0x0003245c,
+0xd393f8c5, 0xfffffa81, 0x44b80000, 0x0f000005,
+0x0006b785, 0x7cf16200, 0x24742848, 0x74f16205,
+0x244c5948, 0x4cf16204, 0x62de5948, 0x28487cf1,
+0x62042454, 0x58486cf1, 0x6cf162ee, 0x24645c48,
+0x74f16205, 0x62cb5c48, 0x59485cf1, 0x74f162e5,
+0x00e4c248, 0xd493f8c5, 0xfffffa81, 0x5bb80000,
+0x0f000005, 0x00066385, 0x6cf16200, 0x244c5948,
+0x7cf16206, 0x244c2948, 0x6cf16201, 0x24545e48,
+0x74f16206, 0x00eac248, 0xd593f8c5, 0xfffffa81,
+0x64b80000, 0x0f000005, 0x00062f85, 0x7df26200,
+0x000d1848, 0x6200100b, 0x28487cf1, 0x6206245c,
+0xef4865f1, 0x75f162d1, 0x244cef48, 0x6cf16204,
+0x24545948, 0x6cf16201, 0x00f1c248, 0xd693f8c5,
+0xfffffa81, 0x67b80000, 0x0f000005, 0x0005eb85,
+0x7df16200, 0x244c5b48, 0x7cf16204, 0x62c95b48,
+0xc24874f1, 0x0004247c, 0xd793f8c5, 0xfffffa81,
+0x6eb80000, 0x0f000005, 0x0005bf85, 0x7df26200,
+0x244c4c48, 0x7cf16204, 0x244c2948, 0x7cf16201,
+0x24642848, 0x7df26204, 0x244c4c48, 0x7df16201,
+0x62c95b48, 0x5b487cf1, 0x74f162c9, 0x00c4c248,
+0xd093f8c5, 0xfffffa81, 0x75b80000, 0x0f000005,
+0x00057785, 0x5cf16200, 0x62cc5948, 0x29487cf1,
+0x6201244c, 0x4e487df2, 0x6201244c, 0x29487cf1,
+0x6202244c, 0x28487cf1, 0x6202244c, 0x4c487df2,
+0x7df162d1, 0x62d25b48, 0x5b487cf1, 0x6cf162d2,
+0x00d4c248, 0xd293f8c5, 0xfffffa81, 0x7cb80000,
+0x0f000005, 0x00052385, 0x7df26200, 0x24544c48,
+0x7df16204, 0x62c95b48, 0x5b487df1, 0x7cf162d2,
+0x62c95b48, 0x5b487cf1, 0x74f162d2, 0x00dac248,
+0xd393f8c5, 0xfffffa81, 0x7eb80000, 0x0f000005,
+0x0004e785, 0x7cf16200, 0x24547948, 0x7ff16204,
+0x62d27a48, 0x28487cf1, 0x6204244c, 0xc2486cf1,
+0xf8c500e1, 0xfa81d493, 0x0000ffff, 0x00058fb8,
+0xb5850f00, 0x62000004, 0x594874f1, 0x7cf162d1,
+0x24542948, 0x7cf16201, 0x24545148, 0x6cf16201,
+0x00e9c248, 0xd593f8c5, 0xfffffa81, 0x9cb80000,
+0x0f000005, 0x00048385, 0x7df26200, 0x40151848,
+0x6200100b, 0x5e486cf1, 0x7cf162e1, 0x24642948,
+0x7df36201, 0x246c0848, 0xf1620b01, 0x2528487c,
+0x00100b40, 0x0005a4b8, 0x5cf16200, 0x00f5c248,
+0xd693f8c5, 0xfffffa81, 0x850f0000, 0x0000043c,
+0x4864f162, 0xf162e159, 0x5c594864, 0xf1620524,
+0x5c29487c, 0xf1620224, 0x5c5f485c, 0xf1620224,
+0x645d485c, 0xf1620224, 0x6429487c, 0xf1620224,
+0x5c584864, 0xf1620224, 0x4c584874, 0xf1620524,
+0x5c594864, 0xf1620624, 0xf9c24864, 0x93f8c500,
+0xfffa81d7, 0xb80000ff, 0x0000063d, 0x03da850f,
+0xf1620000, 0x7c28487c, 0xf1620424, 0x5c28487c,
+0xf3620524, 0xcf234845, 0x7df3621b, 0x1bc90448,
+0x4874f162, 0xc500cbc2, 0x81d193f8, 0x00fffffa,
+0x064eb800, 0x850f0000, 0x000003a0, 0x487cf162,
+0x04244c28, 0x4875f362, 0x621be123, 0x04487df3,
+0xf1621be4, 0xc3c2485c, 0x93f8c500, 0xfffa81d0,
+0xb80000ff, 0x00000653, 0x036e850f, 0x84c70000,
+0x00024024, 0x88000000, 0x64f16241, 0xb8e95848,
+0x0000065d, 0x487df262, 0x4024a418, 0x62000002,
+0xc2485cf1, 0xf8c500d5, 0xfa81d293, 0x0000ffff,
+0x0336850f, 0xf3620000, 0x4c19487d, 0x62002424,
+0x1a487df2, 0x62242464, 0x184875f3, 0x0124244c,
+0x4875f362, 0x24244c18, 0x75f36202, 0x244c1848,
+0xf1620324, 0xd9c2485c, 0x93f8c500, 0xffff3dc3,
+0x0a740000, 0x00067cb8, 0x02eee900, 0xf1620000,
+0x4c28487c, 0xf2620724, 0x4c774865, 0xf1620424,
+0x4c29487c, 0xf1620124, 0x746f487d, 0xf2620824,
+0x5c7f484d, 0xf1620424, 0x5c29487c, 0xf1620224,
+0xcb5c4874, 0x402484c7, 0x00000002, 0x62410000,
+0x594874f1, 0x6206244c, 0x18487df2, 0x0240249c,
+0xf1620000, 0xe3c24874, 0x93f8c500, 0xfffa81d4,
+0xb80000ff, 0x000006a6, 0x487cf162, 0x03244c29,
+0x0276850f, 0xc0310000, 0x487cf162, 0x04247c28,
+0x487cf162, 0x09247c29, 0x408484d9, 0xd9000002,
+0x4020845c, 0x7508f883, 0x7cf162ef, 0x244c5a48,
+0xfdf16201, 0x244c2948, 0xfdf16201, 0x244c5a48,
+0x29fcc501, 0x0240248c, 0xc0310000, 0x008484d9,
+0xd9000001, 0x02408484, 0xe9df0000, 0x027ad8dd,
+0xf1b80a74, 0xe9000006, 0x00000210, 0x08f88340,
+0xf162da75, 0x6412487e, 0xf2620424, 0x0d18487d,
+0x00100b04, 0x485cf162, 0x0424645c, 0x4874f162,
+0x06244c58, 0x487df262, 0x0b081d18, 0xf1620010,
+0xcb594874, 0x485cf162, 0xc500e9c2, 0x81d593f8,
+0x00fffffa, 0x0717b800, 0x850f0000, 0x000001bc,
+0x487ef162, 0x04244c16, 0x487cf162, 0x01244c29,
+0x487cf162, 0x04246428, 0x486cf162, 0x06245458,
+0x4874f162, 0xf162cc5c, 0xd359486c, 0x4874f162,
+0xc500f2c2, 0x81d693f8, 0x00fffffa, 0x071eb800,
+0x850f0000, 0x00000174, 0x000001b8, 0x7cf16200,
+0x24642948, 0x8484d902, 0x00000140, 0x80849cd9,
+0x83000000, 0xf88302c0, 0xb8ea7511, 0xffffaaaa,
+0x487cf162, 0x04246c28, 0xc892f8c5, 0x4955f262,
+0x05244c65, 0x4874f162, 0x02247cc2, 0x93f8c500,
+0xfffa81d7, 0xb80000ff, 0x0000073a, 0x011a850f,
+0xe8d90000, 0x487cf162, 0x05244c28, 0x487cf162,
+0x04247428, 0x402494d9, 0x62000002, 0xb6584df2,
+0x0240248c, 0xf1620000, 0x7c28487c, 0xf1620424,
+0x545c4844, 0xf1620524, 0x54584944, 0xf1620524,
+0xcac24874, 0x93f8c500, 0xfffa81d1, 0xb80000ff,
+0x00000743, 0x00c0850f, 0xf3620000, 0x4c26487d,
+0x62000424, 0x29487cf1, 0x6201244c, 0x42487df2,
+0x6204244c, 0x29487cf1, 0x3102244c, 0x62d231c9,
+0x6e087df1, 0xfdf162c9, 0x244cd608, 0x246cdf03,
+0x9484d918, 0x00000080, 0xd8dde9df, 0x6475627a,
+0x8d01428d, 0xc321025a, 0x8301fb83, 0xd08500d1,
+0x44d90a75, 0xe9df3c84, 0x5575537a, 0x7410f883,
+0xebc28904, 0x62d8ddba, 0x28487cf1, 0x62012474,
+0x2c484df2, 0x6202244c, 0x28487cf1, 0xb804247c,
+0x0000077d, 0x4844f162, 0xc500c1c2, 0x81d093f8,
+0x00fffffa, 0xe8257500, 0xfffff539, 0x1cebd8f7,
+0x02ebd8dd, 0x73b8d8dd, 0xeb000007, 0xebd8dd0f,
+0xb8d8dd02, 0x00000778, 0xd8dd02eb, 0xc9fc5d8b,
+0x000000c3, 0x00000000, 0x00000000, 0x00000000,
+0x80000000, 0xbf800000, 0x3f000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x3f800000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0005600,
+};
+asm(".type avx512f_x86_32_D_64f4, STT_NOTYPE;");
+asm(".type avx512f_x86_32_D_64f4, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512f_x86_32_D_64f8[] = {
+0x0002eee9, 0xc0315500, 0xe483e589, 0x00ec81c0,
+0xb9000001, 0x00000009, 0x54dde8d9, 0x89403024,
+0x892c2444, 0x2444dbca, 0x83c2292c, 0x548908f8,
+0x5cdd2c24, 0x44db38c4, 0x5cdd2c24, 0x94dd78c4,
+0x0000b8c4, 0x62d77500, 0x2848fdf1, 0x62012454,
+0x2848fdf1, 0x6202244c, 0x5858edf1, 0x100a0025,
+0xddf16200, 0x62e15948, 0x2848fdf1, 0xf5f262d9,
+0x245c9848, 0xddf16201, 0x00c3c248, 0xd093f8c5,
+0xa7b8c2fe, 0x0f000000, 0x00024685, 0xfdf26200,
+0xc01d1948, 0x62001009, 0x2848fdf1, 0xddf162e9,
+0x62e3ef48, 0x9e48f5f2, 0x6201246c, 0xc248ddf1,
+0xf8c500cd, 0xc2fed193, 0x0000abb8, 0x14850f00,
+0x62000002, 0x5858edf1, 0x1009c815, 0xedf16200,
+0x62d15948, 0x2848fdf1, 0xf5f262e1, 0x24649a48,
+0xedf16201, 0x00d4c248, 0xd293f8c5, 0xafb8c2fe,
+0x0f000000, 0x0001e285, 0xfdf16200, 0x62e12848,
+0xef48edf1, 0xf5f262d3, 0x24649c48, 0xedf16201,
+0x00dcc248, 0xd393f8c5, 0xb3b8c2fe, 0x0f000000,
+0x0001ba85, 0xfdf16200, 0x24542848, 0xedf16201,
+0x62e15848, 0x1948fdf2, 0x6206246c, 0x2848fdf1,
+0x62022474, 0x9848cdf2, 0xddf162ea, 0x00e5c248,
+0xd493f8c5, 0xbbb8c2fe, 0x0f000000, 0x00018285,
+0xfdf16200, 0x62ea2848, 0x2848fdf1, 0x6202247c,
+0xef48ddf1, 0xc5f262e3, 0x246c9e58, 0xddf16206,
+0x00edc248, 0xd593f8c5, 0xc0b8c2fe, 0x0f000000,
+0x00015285, 0xedf16200, 0x62c95c48, 0x1948fdf2,
+0x62062464, 0x2848fdf1, 0x62022474, 0x9a48cdf2,
+0xf5f162e2, 0x00f4c248, 0xd693f8c5, 0xc5b8c2fe,
+0x0f000000, 0x00012285, 0xfdf16200, 0x62e22848,
+0x2848fdf1, 0x6202247c, 0xef48f5f1, 0xc5f262cb,
+0x24649c58, 0xf5f16206, 0x00fcc248, 0xd793f8c5,
+0xcab8c2fe, 0x0f000000, 0x0000f285, 0x245cdd00,
+0xedf16238, 0x246c5948, 0xfdf16202, 0x24642848,
+0xe5f16203, 0x244cef48, 0xd5f26203, 0x2464b658,
+0xd5f26207, 0x244cb658, 0xfdf16207, 0x245c2848,
+0xfdf16202, 0x62ea2848, 0xa648e5f2, 0x6203246c,
+0xc248ddf1, 0xf8c500c5, 0xc2fed093, 0x0000d4b8,
+0x9a850f00, 0x62000000, 0xa748edf2, 0x6203245c,
+0xc248f5f1, 0xf8c500cb, 0xc2fed193, 0x0000d8b8,
+0x627e7500, 0x5948edf1, 0x6202246c, 0x2848fdf1,
+0x6203245c, 0x2848fdf1, 0xd5f262e3, 0x2464b658,
+0xfdf16207, 0x62ea2848, 0x9648e5f2, 0x6202246c,
+0xc248ddf1, 0xf8c500d5, 0xc2fed293, 0x0000deb8,
+0x623e7500, 0x9748e5f2, 0x62022454, 0xc248f5f1,
+0xf8c500da, 0xc2fed393, 0x0000e2b8, 0x31227500,
+0xdd1eebc0, 0xdd1aebd8, 0xdd16ebd8, 0xdd12ebd8,
+0xdd0eebd8, 0xdd0aebd8, 0xdd06ebd8, 0xdd02ebd8,
+0x55c3c9d8, 0xe589c031, 0x000009ba, 0xe4835300,
+0x40ec81c0, 0x89000002, 0x448940c3, 0xd1891424,
+0x142444db, 0x4c89c129, 0xd9891424, 0xdd01e183,
+0x00f8c49c, 0x44db0000, 0x9cdd1424, 0x000138c4,
+0xd9e8d900, 0xdbe8d9e0, 0xd1d9ddc9, 0x03e1c1eb,
+0x78c49cdd, 0x09000001, 0xc48c89d9, 0x000001b8,
+0xc183db31, 0xc49c8904, 0x000001bc, 0x8300d383,
+0x8c8908f8, 0x0001f8c4, 0xc49c8900, 0x000001fc,
+0xf1629575, 0x742848fd, 0xf1620424, 0x742948fd,
+0xf1620124, 0x4c2848fd, 0xf1620124, 0xc6c248f5,
+0x93f8c500, 0xb8c2fed0, 0x00000539, 0x0607850f,
+0xf1620000, 0x545848f5, 0xf1620424, 0x542948fd,
+0xf1620224, 0x542848fd, 0xf1620224, 0x7c2848fd,
+0xf1620424, 0xdf5848c5, 0x48edf162, 0xc500d3c2,
+0xfed293f8, 0x053fb8c2, 0x850f0000, 0x000005c9,
+0x48edf162, 0x0424545c, 0x48fdf162, 0x03245429,
+0x48f5f162, 0x03245cc2, 0x93f8c500, 0xb8c2fed3,
+0x00000544, 0x059f850f, 0xf1620000, 0x6c2848fd,
+0xf1620524, 0x4c5948f5, 0xf1620424, 0xdd5948d5,
+0x48fdf162, 0x04245428, 0x48edf162, 0xf162ed58,
+0x645c48ed, 0xf1620524, 0xcb5c48f5, 0x48ddf162,
+0xf162e559, 0xe4c248f5, 0x93f8c500, 0xb8c2fed4,
+0x0000055b, 0x054f850f, 0xf1620000, 0x4c5948ed,
+0xf1620624, 0x4c2948fd, 0xf1620124, 0x545e48ed,
+0xf1620624, 0xeac248f5, 0x93f8c500, 0xb8c2fed5,
+0x00000564, 0x051f850f, 0xf2620000, 0x0d1948fd,
+0x001009c0, 0x48fdf162, 0x06245428, 0x48edf162,
+0xf162d9ef, 0x4cef48f5, 0xf1620424, 0x5c5948e5,
+0xf1620124, 0xf1c248e5, 0x93f8c500, 0xb8c2fed6,
+0x00000567, 0x04df850f, 0xf1620000, 0x4ce648ff,
+0xf1620424, 0xc9e6487e, 0x48f5f162, 0x04247cc2,
+0x93f8c500, 0xb8c2fed7, 0x0000056e, 0x04b7850f,
+0xf2620000, 0x4c4c48fd, 0xf1620424, 0x4c2948fd,
+0xf1620124, 0x642848fd, 0xf2620424, 0x4c4c48fd,
+0xf1620124, 0xc9e648ff, 0x487ef162, 0xf162c9e6,
+0xc4c248f5, 0x93f8c500, 0xb8c2fed0, 0x00000575,
+0x0473850f, 0xf1620000, 0xcc5948dd, 0x48fdf162,
+0x01244c29, 0x48fdf262, 0x01244c4e, 0x48fdf162,
+0x02244c29, 0x48fdf162, 0x02244c28, 0x48fdf262,
+0xf162d94c, 0xdbe648ff, 0x487ef162, 0xf162dbe6,
+0xd4c248e5, 0x93f8c500, 0xb8c2fed2, 0x0000057c,
+0x0423850f, 0xf2620000, 0x5c4c48fd, 0xf1620424,
+0xc9e648ff, 0x48fff162, 0xf162dbe6, 0xc9e6487e,
+0x487ef162, 0xf162dbe6, 0xdbc248f5, 0x93f8c500,
+0xb8c2fed3, 0x0000057e, 0x03eb850f, 0xf1620000,
+0x5c7948fc, 0xf1620424, 0xdb7a487e, 0x48fdf162,
+0x04244c28, 0x48e5f162, 0xc500e1c2, 0xfed493f8,
+0x058fb8c2, 0x850f0000, 0x000003bd, 0x48f5f162,
+0xf162d959, 0x5c2948fd, 0xf1620124, 0x5c5148fd,
+0xf1620124, 0xe9c248e5, 0x93f8c500, 0xb8c2fed5,
+0x0000059c, 0x038f850f, 0xf2620000, 0x1d1948fd,
+0x00100a00, 0x48e5f162, 0xf162d95e, 0x5c2948fd,
+0xf3620124, 0x640948fd, 0x620b0124, 0x2848fdf1,
+0x100a001d, 0x05a4b800, 0xf1620000, 0xf4c248e5,
+0x93f8c500, 0x0fc2fed6, 0x00034c85, 0xedf16200,
+0x62d95948, 0x5948edf1, 0x62052454, 0x2948fdf1,
+0x62022454, 0x5f48e5f1, 0x62022454, 0x5d48e5f1,
+0x6202245c, 0x2948fdf1, 0x6202245c, 0x5848edf1,
+0x62022454, 0x5848f5f1, 0x6205244c, 0x5948edf1,
+0x62062454, 0xc248edf1, 0xf8c500f9, 0xc2fed793,
+0x00063db8, 0xee850f00, 0x62000002, 0x2848fdf1,
+0x62042474, 0x2848fdf1, 0x6205245c, 0x2348cdf3,
+0xf3621bce, 0xc90548fd, 0xf5f16255, 0x00cbc248,
+0xd193f8c5, 0x4eb8c2fe, 0x0f000006, 0x0002b885,
+0xfdf16200, 0x244c2848, 0xf5f36204, 0x1bd12348,
+0x48fdf362, 0x6255d205, 0xc248edf1, 0xf8c500c3,
+0xc2fed093, 0x000653b8, 0x8a850f00, 0xd9000002,
+0x100a4005, 0xe5f16200, 0xb8e15848, 0x0000065d,
+0x20245cdd, 0x48fdf262, 0x04245419, 0x48edf162,
+0xc500d4c2, 0xfed293f8, 0x5a850fc2, 0x62000002,
+0x1b48fdf3, 0x0001244c, 0x48fdf262, 0x0124541b,
+0x48f5f362, 0x01244c1a, 0xedf16201, 0x00d9c248,
+0xc393f8c5, 0x6cb8c0fe, 0x0f000006, 0x00022885,
+0xfdf16200, 0x244c2848, 0xe5f26207, 0x244c7748,
+0xfdf16204, 0x24542848, 0xe5f26208, 0x24547748,
+0x4405d904, 0x6200100a, 0x5c48f5f1, 0xf5f162ca,
+0x244c5948, 0x06a6b806, 0xf1620000, 0x4c2948fd,
+0x5cdd0324, 0xf2622024, 0x541948fd, 0xf1620424,
+0xe2c248f5, 0x93f8c500, 0x0fc2fed4, 0x0001c885,
+0xfff16200, 0x24541248, 0xfdf26204, 0xc80d1948,
+0x62001009, 0x2848fdf1, 0x6204245c, 0x5848f5f1,
+0x6206244c, 0x5c48edf1, 0xf5f162d3, 0xd00d5958,
+0x62001009, 0xc248edf1, 0xf8c500e9, 0xc2fed593,
+0x000717b8, 0x7e850f00, 0x62000001, 0x2948fdf1,
+0x6202245c, 0x1008fff1, 0x6229247c, 0x1008fff1,
+0x622b246c, 0x1108fff1, 0x6211247c, 0x1008fff1,
+0x622d2474, 0x1008fff1, 0x622f247c, 0x1108fff1,
+0x6213246c, 0x1108fff1, 0x62152474, 0x1108fff1,
+0xb017247c, 0xfdf162aa, 0x246c2848, 0x92f8c504,
+0xd5f262c8, 0x244c6549, 0xf5f16205, 0x2474c248,
+0xf8c50002, 0xc2fed693, 0x00073ab8, 0x06850f00,
+0xc7000001, 0x00242444, 0x313ff000, 0xfdf162c0,
+0x244c2848, 0x24448905, 0xfdf16220, 0x24742848,
+0xcdf26204, 0x244cb658, 0xfdf16204, 0x247c2848,
+0xc5f16204, 0x24545c48, 0xc5f16205, 0x24545849,
+0xf5f16205, 0x00fac248, 0xd793f8c5, 0x43b8c2fe,
+0x0f000007, 0x0000b085, 0xfdf36200, 0x244c2648,
+0xf1620004, 0x4c2948fd, 0xf2620124, 0x4c4248fd,
+0xf1620424, 0x4c2948fd, 0xc9310224, 0xf162d231,
+0xc96e087d, 0x08fdf162, 0x03244cd6, 0x18246cdf,
+0x80d484dd, 0xdf000000, 0x7ad8dde9, 0x8d5e7560,
+0x5a8d0142, 0x83c32102, 0xd18301fb, 0x75d08500,
+0xdde8d90e, 0xdf38c444, 0x7ad8dde9, 0x83457547,
+0x047408f8, 0xb6ebc289, 0x48fdf162, 0x01247428,
+0x48cdf262, 0x02244c2c, 0x48fdf162, 0x04247c28,
+0x00077db8, 0xc5f16200, 0x00c9c248, 0xd193f8c5,
+0x1575c2fe, 0xfff66ce8, 0xebd8f7ff, 0x0773b80c,
+0x05eb0000, 0x000778b8, 0xfc5d8b00, 0x0000c3c9,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x80000000, 0x00000000, 0xbff00000,
+0x00000000, 0x3fe00000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x3ff00000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x41100000, 0x40800000,
+0005110,
+};
+asm(".type avx512f_x86_32_D_64f8, STT_NOTYPE;");
+asm(".type avx512f_x86_32_D_64f8, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512f_x86_32_D_16i4[] = {
+0x83e58955, 0x02e8f0e4, 0xc9000000, 0x20b955c3,
+0x89000000, 0x57c031e5, 0x000005bf, 0x81535600,
+0x0000bcec, 0x89c38900, 0x40da89fe, 0x2901e283,
+0x01fa83c6, 0xe283d219, 0xd8854a02, 0x89490175,
+0x83848544, 0x748904f8, 0x54899485, 0x4c89a485,
+0xd175b485, 0x087df162, 0xff88b56f, 0xf162ffff,
+0xb57f087d, 0xffffff58, 0x087df162, 0xff588d6f,
+0xf362ffff, 0xc61f0875, 0x93f8c500, 0x0ffa80d0,
+0x000539b8, 0xd1850f00, 0x62000005, 0xfe0875f1,
+0xffff8895, 0x7df162ff, 0x68957f08, 0x62ffffff,
+0x720865f1, 0xffff88b5, 0xf16201ff, 0x956f087d,
+0xffffff68, 0x00053fb8, 0x6df36200, 0x00d31f08,
+0xd293f8c5, 0x0f0ffa80, 0x00058f85, 0x6df16200,
+0x8895fa08, 0x62ffffff, 0x7f087df1, 0xffff7895,
+0x75f362ff, 0x789d1f08, 0x00ffffff, 0xd393f8c5,
+0xb80ffa80, 0x00000544, 0x055e850f, 0xf1620000,
+0xbd6f087d, 0xffffff98, 0x0875f262, 0xff888d40,
+0xf262ffff, 0xdf400845, 0x087df162, 0xff88956f,
+0xf162ffff, 0xeffe086d, 0x086df162, 0xff98a5fa,
+0xf162ffff, 0xcbfa0875, 0x00055bb8, 0x5df26200,
+0x62e54008, 0x1f0875f3, 0xf8c500e4, 0xfa80d493,
+0x05850f0f, 0x62000005, 0x40086df2, 0xffff988d,
+0x75f362ff, 0x702d1f08, 0x00001006, 0xd593f8c5,
+0xb80ffa80, 0x000005c8, 0x04de850f, 0xf1620000,
+0x8def086d, 0xffffffa8, 0x087df162, 0xf162c87e,
+0x8d7f087d, 0xffffff58, 0x08f5f262, 0xff988d28,
+0x6df7ffff, 0x78858998, 0x8bffffff, 0x9589a045,
+0xffffff7c, 0xff60adf7, 0x4589ffff, 0x05e1b880,
+0x55890000, 0x75f36284, 0x78b51f08, 0x00ffffff,
+0xd693f8c5, 0x0f0ffa80, 0x00047f85, 0x6df26200,
+0xa89d4008, 0x62ffffff, 0x7f087df1, 0xffff789d,
+0x75f162ff, 0x78b57208, 0x03ffffff, 0x087df162,
+0xff588d7f, 0xf162ffff, 0xb572085d, 0xffffff78,
+0x5df16202, 0xb8ecfe08, 0x000005ed, 0x0875f362,
+0xc500fd1f, 0x80d793f8, 0x850f0ffa, 0x0000042c,
+0x0875f162, 0xff58a572, 0x6202ffff, 0xfe0875f1,
+0x05f2b8c9, 0xf3620000, 0xc11f085d, 0x93f8c500,
+0x0ffa80d0, 0x0402850f, 0x85c70000, 0xffffff54,
+0x00000003, 0xff54858b, 0x8589ffff, 0xffffff40,
+0x891ff8c1, 0xffff4485, 0xfef162ff, 0xe8757e08,
+0x0865f162, 0x85c7cef2, 0xffffff54, 0x00000002,
+0xff54858b, 0x8589ffff, 0xffffff40, 0x891ff8c1,
+0xffff4485, 0xfef162ff, 0xe87d7e08, 0x0865f162,
+0xf162dff2, 0xe3fe0865, 0x000605b8, 0x75f36200,
+0x00cc1f08, 0xd193f8c5, 0x0f0ffa80, 0x00038b85,
+0x54858b00, 0x89ffffff, 0xffff4085, 0x1ff8c1ff,
+0xff448589, 0xf162ffff, 0x757e08fe, 0x75f162e8,
+0x62cee208, 0xfe0875f1, 0x0609b8c9, 0xf3620000,
+0xd11f0865, 0x93f8c500, 0x0ffa80d2, 0x034a850f,
+0xf1620000, 0xc9ef0875, 0x087df162, 0xffb8bd6f,
+0xf362ffff, 0xc91f0845, 0x6df26206, 0xa89d4089,
+0x62ffffff, 0x470865f2, 0xffffb8a5, 0x0001b8ff,
+0xf1620000, 0xad6f087d, 0xffffffb8, 0x087df262,
+0xf162c87c, 0xc9fa0855, 0x087df162, 0xffb88d7f,
+0xf262ffff, 0x8d470865, 0xffffffb8, 0x000621b8,
+0x75f16200, 0x62e9fe08, 0x1f085df3, 0xf8c500dd,
+0xfa80d393, 0xd1850f0f, 0x62000002, 0x460875f2,
+0xffffb88d, 0x0626b8ff, 0xf3620000, 0xe31f0875,
+0x93f8c500, 0x0ffa80d4, 0x02ae850f, 0xf1620000,
+0x8d6f087d, 0xffffffa8, 0x0875f262, 0xff989d40,
+0xf262ffff, 0xe2400875, 0x087df162, 0xff689d7f,
+0xf262ffff, 0x9d3d085d, 0xffffff68, 0x085df262,
+0xff68a539, 0xf162ffff, 0xa57f087d, 0xffffff68,
+0x0865f162, 0xff689dfe, 0x3db8ffff, 0x62000006,
+0xfe086df1, 0xffff98a5, 0x65f262ff, 0x62d94008,
+0x1f0865f3, 0xf8c500ec, 0xfa80d593, 0x39850f0f,
+0x62000002, 0x40086df2, 0x7df162d9, 0x589d7f08,
+0x62ffffff, 0x1e087df2, 0xffff589d, 0x65f362ff,
+0x00f21f08, 0xd693f8c5, 0xb80ffa80, 0x00000644,
+0x0206850f, 0xf1620000, 0x956f087d, 0xffffff98,
+0x087df162, 0xff889d6f, 0xf162ffff, 0xe370087d,
+0x5df3621b, 0x00fa1f08, 0xd793f8c5, 0xb80ffa80,
+0x0000064e, 0x01d2850f, 0x45c70000, 0x000005d8,
+0x6df16200, 0xb8dbfe08, 0x0000065d, 0x087df262,
+0x62f66558, 0x1f085df3, 0xf8c500c3, 0xfa80d093,
+0xa5850f0f, 0xb8000001, 0x00000005, 0x087df262,
+0xf362e07c, 0xcb1f085d, 0x93f8c500, 0x0ffa80d1,
+0x000661b8, 0x81850f00, 0x62000001, 0x62086df1,
+0xffff889d, 0x6df162ff, 0x88956a08, 0xc7ffffff,
+0x0002d845, 0xf1620000, 0xd2fa0865, 0x0006a6b8,
+0x6df26200, 0x62d14008, 0x58087df2, 0xf362f65d,
+0xd31f086d, 0x93f8c500, 0x0ffa80d2, 0x013a850f,
+0xf2620000, 0x95400875, 0xffffff88, 0x0875f162,
+0x621fe172, 0x7f087df1, 0xffff5895, 0x6df162ff,
+0x62d16208, 0x6f087df1, 0xffff58b5, 0x7df262ff,
+0x62ce2508, 0x1f0875f3, 0xf8c500da, 0xfa80d393,
+0x06b3b80f, 0x850f0000, 0x000000f0, 0x087df162,
+0xff88956f, 0xf162ffff, 0x957f087d, 0xffffffc8,
+0x087df162, 0xffc8bd6f, 0xf262ffff, 0xcf25087d,
+0x087df162, 0xff588d7f, 0xf162ffff, 0xad6f087d,
+0xffffff58, 0x087ef262, 0xf162e935, 0x8d7f087d,
+0xffffffd8, 0x3988458b, 0x850fd845, 0x00000097,
+0x398c458b, 0x850fdc45, 0x0000008b, 0x629c458b,
+0x7f087df1, 0xffff6895, 0x6c8589ff, 0x8bffffff,
+0x8589a445, 0xffffff74, 0x087df162, 0xff888d6f,
+0xe3c4ffff, 0x98550271, 0x6df3620a, 0x68a51f08,
+0x00ffffff, 0xd493f8c5, 0xb80ffa80, 0x0000073a,
+0xf3624a75, 0xd9030875, 0x0003b801, 0x00ba0000,
+0x62000000, 0x7c087df2, 0x0001b8d0, 0xf1620000,
+0xcadb0875, 0x087df262, 0xf162d07c, 0xcafe0875,
+0x0865f362, 0xc500e91f, 0x3cc593f8, 0x074ab80f,
+0x440f0000, 0xb805ebc2, 0x000006f1, 0x00bcc481,
+0x5e5b0000, 0x00c35d5f, 0x00000000, 0x00000000,
+0x00000004, 0x00000006, 0x00000006, 0x00000004,
+0003200,
+};
+asm(".type avx512f_x86_32_D_16i4, STT_NOTYPE;");
+asm(".type avx512f_x86_32_D_16i4, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512f_x86_32_D_16u4[] = {
+0x83e58955, 0x02e8f0e4, 0xc9000000, 0x20ba55c3,
+0x89000000, 0x57c031e5, 0x000005bf, 0x81535600,
+0x0000acec, 0x89c38900, 0x40d989fe, 0x2901e183,
+0xd88549c6, 0x894a0175, 0x83848544, 0x748904f8,
+0x4c899485, 0x5489a485, 0xd975b485, 0x087df162,
+0xff88bd6f, 0xf162ffff, 0xbd7f087d, 0xffffff58,
+0x087df162, 0xff58956f, 0xf362ffff, 0xc71f086d,
+0x93f8c500, 0x0ffa80d0, 0x000539b8, 0x0a850f00,
+0x62000005, 0xfe086df1, 0xffff888d, 0x7df162ff,
+0x688d7f08, 0x62ffffff, 0x720865f1, 0xffff88b5,
+0xf16201ff, 0x8d6f087d, 0xffffff68, 0x00053fb8,
+0x75f36200, 0x00cb1f08, 0xd193f8c5, 0x0f0ffa80,
+0x0004c885, 0x75f16200, 0x888dfa08, 0x62ffffff,
+0x7f087df1, 0xffff788d, 0x7df162ff, 0x789d6f08,
+0x62ffffff, 0x1f086df3, 0xf8c500d3, 0xfa80d293,
+0x0544b80f, 0x850f0000, 0x00000491, 0x086df162,
+0xff9895eb, 0xf162ffff, 0x957f087d, 0xffffff58,
+0x0875f162, 0xff988ddb, 0xf162ffff, 0x9def0865,
+0xffffff98, 0x0875f162, 0xff588ddf, 0xf362ffff,
+0xdb1f0875, 0x93f8c500, 0x0ffa80d3, 0x000550b8,
+0x46850f00, 0x62000004, 0x6f087df1, 0xffff8895,
+0x6df262ff, 0x988d4008, 0x62ffffff, 0x1f0875f3,
+0x1005a025, 0xf8c50000, 0xfa80d493, 0x05c8b80f,
+0x850f0000, 0x00000415, 0x086df162, 0xffa88def,
+0xf162ffff, 0xc87e087d, 0x087df162, 0xff588d7f,
+0xf162ffff, 0x8df408f5, 0xffffff98, 0x899865f7,
+0xffff7885, 0xa0458bff, 0xff7c9589, 0xa5f7ffff,
+0xffffff60, 0xb8804589, 0x000005e1, 0x62845589,
+0x1f0875f3, 0xffff78ad, 0xf8c500ff, 0xfa80d593,
+0xb6850f0f, 0x62000003, 0x7f087df1, 0xffff7895,
+0x75f162ff, 0x78b57208, 0x03ffffff, 0x087df162,
+0xff588d7f, 0xf162ffff, 0xb5720865, 0xffffff78,
+0x65f16202, 0xb8e3fe08, 0x000005ed, 0x0875f362,
+0xc500f41f, 0x80d693f8, 0x850f0ffa, 0x0000036d,
+0x0875f162, 0xff589572, 0x6202ffff, 0xfe0875f1,
+0x05f2b8c9, 0xf3620000, 0xf91f0865, 0x93f8c500,
+0x0ffa80d7, 0x0343850f, 0x85c70000, 0xffffff54,
+0x00000003, 0x087df162, 0x62d54d6e, 0xf2086df1,
+0x5485c7c9, 0x02ffffff, 0x62000000, 0x6e087df1,
+0xf162d55d, 0xdbf2086d, 0x0865f162, 0x05b8e3fe,
+0x62000006, 0x1f0875f3, 0xf8c500c4, 0xfa80d093,
+0xf6850f0f, 0x62000002, 0x6e087df1, 0xf162d565,
+0xccd20875, 0x0875f162, 0x09b8c9fe, 0x62000006,
+0x1f0865f3, 0xf8c500c9, 0xfa80d193, 0xca850f0f,
+0xc5000002, 0x62c976f1, 0x6f087df1, 0x65f162e2,
+0xc5dbef08, 0xb85d76e1, 0x0875f362, 0x6240e325,
+0x47085df2, 0xffffb8ad, 0x75f162ff, 0xb89dfe08,
+0x62ffffff, 0x7f087df1, 0xffffb89d, 0x5df262ff,
+0xb89d4708, 0xb8ffffff, 0x00000621, 0x0865f162,
+0xf362f3fe, 0xd61f0855, 0x93f8c500, 0x0ffa80d2,
+0x0267850f, 0xf2620000, 0x9d450865, 0xffffffb8,
+0x000626b8, 0x65f36200, 0x00dc1f08, 0xd393f8c5,
+0x0f0ffa80, 0x00024485, 0x6df26200, 0x989d3b08,
+0x62ffffff, 0x3f086df2, 0xffff98a5, 0x6df162ff,
+0x9895fe08, 0x62ffffff, 0xfe0865f1, 0x0634b8dc,
+0xf3620000, 0xe21f0865, 0x93f8c500, 0x0ffa80d4,
+0x0207850f, 0xf1620000, 0x956f087d, 0xffffff98,
+0x087df162, 0xff889d6f, 0xf162ffff, 0xe370087d,
+0x5df3621b, 0x00ea1f08, 0xd593f8c5, 0xb80ffa80,
+0x0000064e, 0x01d3850f, 0x45c70000, 0x000005d8,
+0x6df16200, 0xb8dbfe08, 0x0000065d, 0x087df262,
+0x62f66558, 0x1f085df3, 0xf8c500f3, 0xfa80d693,
+0xa6850f0f, 0xb8000001, 0x00000005, 0x087df262,
+0xf362e07c, 0xfb1f085d, 0x93f8c500, 0x0ffa80d7,
+0x000661b8, 0x82850f00, 0x62000001, 0x62086df1,
+0xffff889d, 0x6df162ff, 0x88956a08, 0xc7ffffff,
+0x0002d845, 0xf1620000, 0xcafe0875, 0x086df362,
+0xffa89525, 0x6255ffff, 0xfa0875f1, 0x06a6b8cb,
+0xf1620000, 0x8def0875, 0xffffffa8, 0x0875f162,
+0xf262cafa, 0x5558087d, 0x75f362f6, 0x00c21f08,
+0xd093f8c5, 0x0f0ffa80, 0x00012085, 0x7df26200,
+0xf1553508, 0x087df162, 0xff88ad6f, 0xf262ffff,
+0xcd35087d, 0x0875f362, 0xc500ca1f, 0x80d193f8,
+0xd3b80ffa, 0x0f000006, 0x0000f085, 0x7df16200,
+0x88956f08, 0x62ffffff, 0x7f087df1, 0xffffc895,
+0x7df162ff, 0xc8b56f08, 0x62ffffff, 0x35087df2,
+0x7df162ce, 0x588d7f08, 0x62ffffff, 0x6f087df1,
+0xffff58bd, 0x7ef262ff, 0x62f93508, 0x7f087df1,
+0xffffd88d, 0x88458bff, 0x0fd84539, 0x00009785,
+0x8c458b00, 0x0fdc4539, 0x00008b85, 0x9c458b00,
+0x087df162, 0xff68957f, 0x8589ffff, 0xffffff6c,
+0x89a4458b, 0xffff7485, 0x7df162ff, 0x888d6f08,
+0xc4ffffff, 0x550271e3, 0xf3620a98, 0x951f086d,
+0xffffff68, 0x93f8c500, 0x0ffa80d2, 0x00073ab8,
+0x624a7500, 0x030875f3, 0x03b801d9, 0xba000000,
+0x00000000, 0x087df262, 0x01b8d07c, 0x62000000,
+0xdb0875f1, 0x7df262ca, 0x62d07c08, 0xfe0875f1,
+0x65f362ca, 0x00d91f08, 0xc393f8c5, 0x4ab80f3c,
+0x0f000007, 0x05ebc244, 0x0006f1b8, 0xacc48100,
+0x5b000000, 0xc35d5f5e, 0x00000000, 0x00000000,
+0x00000004, 0x00000006, 0x00000006, 0x00000004,
+0002660,
+};
+asm(".type avx512f_x86_32_D_16u4, STT_NOTYPE;");
+asm(".type avx512f_x86_32_D_16u4, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512f_x86_32_D_16i8[] = {
+0x83e58955, 0x02e8f0e4, 0xc9000000, 0xc03155c3,
+0xec81e589, 0x000000b8, 0x31cc4589, 0x89d231c0,
+0xc031dc45, 0x31ec4589, 0xd44589c0, 0x45c7c031,
+0x000001c8, 0xd845c700, 0x00000002, 0x3fe845c7,
+0xc7000000, 0x0002d045, 0x45c70000, 0x000001e0,
+0xe4458900, 0x3ef045c7, 0x89000000, 0xf162f455,
+0xb56f08fd, 0xffffffc8, 0x08fdf162, 0xff98b57f,
+0xf162ffff, 0x9d6f08fd, 0xffffff98, 0x08e5f362,
+0xc500c61f, 0x80d093f8, 0x39b803fa, 0x0f000005,
+0x0006e685, 0xe5f16200, 0xc88dd408, 0x62ffffff,
+0x7f08fdf1, 0xffffa88d, 0xedf162ff, 0xc8b57308,
+0x01ffffff, 0x08fdf162, 0xffa88d6f, 0x3fb8ffff,
+0x62000005, 0x1f08f5f3, 0xf8c500d2, 0xfa80d293,
+0xa4850f03, 0x62000006, 0xfb08f5f1, 0xffffc88d,
+0xfdf162ff, 0xb88d7f08, 0x62ffffff, 0x1f08e5f3,
+0xffffb89d, 0xf8c500ff, 0xfa80d393, 0x0544b803,
+0x850f0000, 0x00000673, 0x08ddf162, 0xffc89573,
+0x6220ffff, 0x7308f5f1, 0xf16220d3, 0x8df408f5,
+0xffffffc8, 0x08e5f162, 0xffc895f4, 0xf162ffff,
+0xdbf408dd, 0x08f5f162, 0xf162cbd4, 0x9d6f08fd,
+0xffffffd8, 0x08e5f162, 0xf162e3f4, 0xf17308f5,
+0xedf16220, 0x62d1d408, 0x7308f5f1, 0xf16220d3,
+0xcbf408f5, 0x08f5f162, 0xf162c9d4, 0xf17308f5,
+0xddf16220, 0x62e1d408, 0x6f08fdf1, 0xffffc8bd,
+0xc5f162ff, 0x62cbd408, 0xfb08c5f1, 0xffffd8b5,
+0xedf162ff, 0xb8d4fb08, 0x0000055b, 0x08d5f162,
+0x6220d673, 0xf408cdf1, 0xfdf162d9, 0x78ad7f08,
+0x62ffffff, 0x7308d5f1, 0xf16220d1, 0x8df408f5,
+0xffffff78, 0x08d5f162, 0xf162eef4, 0xcdd408f5,
+0x08f5f162, 0x6220f173, 0xd408e5f1, 0xedf362d9,
+0x00e31f08, 0xd493f8c5, 0x0f03fa80, 0x00058a85,
+0xe5f16200, 0xd8957308, 0x20ffffff, 0x08ddf162,
+0x6220d773, 0xf408ddf1, 0xffffd88d, 0xc5f162ff,
+0xd895f408, 0x62ffffff, 0xf408e5f1, 0xf5f162df,
+0x62cbd408, 0x7308f5f1, 0xf16220f1, 0xc9d408ed,
+0x08fdf262, 0x07801559, 0xf3620010, 0xea1f08f5,
+0x93f8c500, 0x03fa80d5, 0x0005c8b8, 0x28850f00,
+0xc7000005, 0xffff7885, 0x000001ff, 0x89c93100,
+0xffff7c8d, 0xfef162ff, 0xef4d7e08, 0x0874f162,
+0x07900d16, 0xf1620010, 0xd17308e5, 0xe5f16220,
+0x62f7f408, 0xf408ddf1, 0xedf162d1, 0x62d6d408,
+0xf408c5f1, 0xfdf162e9, 0x78b57f08, 0x62ffffff,
+0x7308edf1, 0xf16220f2, 0xd2d408d5, 0x08fdf162,
+0xffb8957f, 0xf162ffff, 0xb57308cd, 0xffffffb8,
+0xfdf16203, 0x98b57f08, 0x62ffffff, 0x7308edf1,
+0xffffb8b5, 0xf16202ff, 0xdad408ed, 0x0005edb8,
+0xcdf36200, 0x00f31f08, 0xd693f8c5, 0x6203fa80,
+0xf408ddf1, 0x80850ff1, 0x62000004, 0x7208ddf1,
+0xffff98a5, 0xf16202ff, 0xe4d408dd, 0x0005f2b8,
+0xedf36200, 0x00fc1f08, 0xd793f8c5, 0x0f03fa80,
+0x00045685, 0xcdf16200, 0x7895d408, 0xc7ffffff,
+0x00038c45, 0xf1620000, 0xf27308ed, 0xd5f16220,
+0x8bd2d408, 0x85898c45, 0xffffff68, 0x891ff8c1,
+0xffff6c85, 0xfef162ff, 0xed657e08, 0x08edf162,
+0x45c7e4f3, 0x0000028c, 0x8c458b00, 0xff688589,
+0xf8c1ffff, 0x6c85891f, 0x62ffffff, 0x7e08fef1,
+0xf162ed5d, 0xd3f308ed, 0x08edf162, 0x05b8dad4,
+0x62000006, 0x1f08ddf3, 0xf8c500c3, 0xfa80d093,
+0xd4850f03, 0x8b000003, 0x85898c45, 0xffffff68,
+0x891ff8c1, 0xffff6c85, 0xfef162ff, 0xed5d7e08,
+0x08ddf162, 0xf162e3e2, 0xe4d408dd, 0x000609b8,
+0xedf36200, 0x00cc1f08, 0xd193f8c5, 0x0f03fa80,
+0x00039685, 0xcdf16200, 0x789dd408, 0x62ffffff,
+0x6f08fdf1, 0xffffe8b5, 0xe5f162ff, 0x20f37308,
+0x08d5f162, 0xf162d3d4, 0xdbef08e5, 0x3749e2c4,
+0xd5f162eb, 0x62eadb08, 0x7f08fdf1, 0xffffb8ad,
+0xd5f262ff, 0xe89d4708, 0x62ffffff, 0x6f08fdf1,
+0xffffe8b5, 0xcdf162ff, 0x8815fb18, 0x62001007,
+0x7f08fdf1, 0xffffe895, 0xd5f262ff, 0xe8ad4708,
+0xb8ffffff, 0x00000621, 0x08fdf162, 0xffa8ad7f,
+0xf162ffff, 0xedd408d5, 0x08e5f362, 0xc500d51f,
+0x80d293f8, 0x850f03fa, 0x000002ff, 0x08fdf162,
+0xffa8b56f, 0xf262ffff, 0x954608cd, 0xffffffe8,
+0x000626b8, 0xedf36200, 0xb89d1f08, 0x00ffffff,
+0xd393f8c5, 0x0f03fa80, 0x0002ce85, 0xd5f16200,
+0x20d77308, 0x08fdf162, 0xffd89d6f, 0xf162ffff,
+0xe1f408e5, 0x08fdf162, 0xff68ad7f, 0xf162ffff,
+0xd17308d5, 0xfdf16220, 0x48a57f08, 0x62ffffff,
+0x7f08fdf1, 0xffff78ad, 0xf5f162ff, 0x6895f408,
+0x62ffffff, 0x7308ddf1, 0xf16220d3, 0xadf408c5,
+0xffffff78, 0x08ddf162, 0xf162e1f4, 0xf1f408c5,
+0x08edf162, 0xf162d5d4, 0xad7f08fd, 0xffffff58,
+0x08e5f162, 0xff78adf4, 0xf162ffff, 0xf27308ed,
+0xcdf16220, 0x62d2d408, 0xd408ddf1, 0xddf162e5,
+0x20f47308, 0x08ddf162, 0xff48add4, 0xf162ffff,
+0xad7f08fd, 0xffffffa8, 0x08edf262, 0xffa8a53d,
+0xf262ffff, 0x953908ed, 0xffffffa8, 0x08fdf162,
+0xffa8957f, 0xf162ffff, 0xa5d408dd, 0xffffffa8,
+0x00063db8, 0xddf16200, 0x62e9f408, 0x7308edf1,
+0xf16220d4, 0xa5f408dd, 0xffffff78, 0x08edf162,
+0xf162d1f4, 0xd4d408ed, 0x08edf162, 0x6220f273,
+0xd408d5f1, 0xc5f162ea, 0x62d3d408, 0x1f08d5f3,
+0xf8c500e2, 0xf162d493, 0x95f408f5, 0xffffff68,
+0x0f03fa80, 0x0001a285, 0xedf16200, 0x5895d408,
+0x62ffffff, 0x7308edf1, 0xf16220f2, 0xd2d408cd,
+0x08fdf162, 0xff98957f, 0xf262ffff, 0x951f08fd,
+0xffffff98, 0x08edf362, 0xc500ef1f, 0x80d593f8,
+0x44b803fa, 0x0f000006, 0x00015e85, 0xfdf16200,
+0xc8956f08, 0x62ffffff, 0x70087df1, 0xf3624ee2,
+0xf31f08dd, 0x93f8c500, 0x03fa80d6, 0x00064eb8,
+0x34850f00, 0xc7000001, 0x00039045, 0xd2310000,
+0x08e5f162, 0x5589d2d4, 0x065db894, 0xf2620000,
+0x655908fd, 0xddf362f2, 0x00fa1f08, 0xd793f8c5,
+0x0f03fa80, 0x00010285, 0xe5f16200, 0xc8956c08,
+0x62ffffff, 0x6d08e5f1, 0xffffc89d, 0x9045c7ff,
+0x00000001, 0x08edf162, 0xc031dbfb, 0x08e5f162,
+0xff78bdf4, 0xf162ffff, 0xd37308ed, 0x94458920,
+0x08e5f162, 0xf162e1f4, 0xc9f408ed, 0x08fdf262,
+0x62f25559, 0xd408f5f1, 0x06a6b8cf, 0xf1620000,
+0xf17308f5, 0xddf16220, 0x62c9d408, 0x1f08f5f3,
+0xf8c500c2, 0xfa80d093, 0x8c850f03, 0x62000000,
+0x6f08fdf1, 0xffffc8bd, 0xfef162ff, 0xfc4d7e08,
+0x08fdf162, 0xffa8bd7f, 0xf162ffff, 0x4dd608fd,
+0x62aab0f6, 0x6f08fdf1, 0xffffc88d, 0x92f8c5ff,
+0xf5f262c8, 0xd8956409, 0x62ffffff, 0x1f08edf3,
+0xffffa88d, 0xf8c500ff, 0xfa80d193, 0x073ab803,
+0x37750000, 0x08f5f362, 0x6201d903, 0x5908fdf2,
+0x10078815, 0xf5f16200, 0x62cadb08, 0xd408f5f1,
+0x0000baca, 0xf3620000, 0xd11f08e5, 0x93f8c500,
+0xb8033cc2, 0x0000074a, 0xc9c2440f, 0x000000c3,
+0x00000002, 0x00000000, 0x00000001, 0x00000000,
+0xffffffff, 0xffffffff,
+0003630,
+};
+asm(".type avx512f_x86_32_D_16i8, STT_NOTYPE;");
+asm(".type avx512f_x86_32_D_16i8, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512f_x86_32_D_16u8[] = {
+0x83e58955, 0x02e8f0e4, 0xc9000000, 0xc03155c3,
+0xec81e589, 0x00000088, 0x31dc4589, 0x89c931c0,
+0xc031ec45, 0x31d44589, 0xe44589c0, 0x45c7c031,
+0x000001c8, 0xcc4d8900, 0x02d845c7, 0xc7000000,
+0x003fe845, 0x45c70000, 0x000002d0, 0xe045c700,
+0x00000001, 0x3ef045c7, 0x89000000, 0xf162f445,
+0xb56f08fd, 0xffffffc8, 0x08fdf162, 0xff98b57f,
+0xf162ffff, 0x956f08fd, 0xffffff98, 0x08edf362,
+0xc500c61f, 0x80d093f8, 0x39b803fa, 0x0f000005,
+0x00046885, 0xedf16200, 0xc88dd408, 0x62ffffff,
+0x7f08fdf1, 0xffffa88d, 0xe5f162ff, 0xc8b57308,
+0x01ffffff, 0x08fdf162, 0xffa88d6f, 0x3fb8ffff,
+0x62000005, 0x1f08f5f3, 0xf8c500d3, 0xfa80d293,
+0x26850f03, 0x62000004, 0xfb08f5f1, 0xffffc88d,
+0xfdf162ff, 0xb88d7f08, 0x62ffffff, 0x6f08fdf1,
+0xffffb89d, 0xedf362ff, 0x00db1f08, 0xd393f8c5,
+0xb803fa80, 0x00000544, 0x03ef850f, 0xf1620000,
+0x95eb08ed, 0xffffffd8, 0x08fdf162, 0xff98957f,
+0xf162ffff, 0x8ddb08f5, 0xffffffd8, 0x08e5f162,
+0xffd89def, 0xf162ffff, 0x8ddf08f5, 0xffffff98,
+0x08f5f362, 0xc500e31f, 0x80d493f8, 0x50b803fa,
+0x0f000005, 0x0003a485, 0xfdf16200, 0xc88d6f08,
+0x62ffffff, 0x7308ddf1, 0xffffd895, 0xf16220ff,
+0xd17308ed, 0xedf16220, 0xd895f408, 0x62ffffff,
+0xf408f5f1, 0xffffd89d, 0xddf162ff, 0x62e1f408,
+0xd408edf1, 0xedf162d4, 0x20f27308, 0x08e5f162,
+0xf262d2d4, 0x1d5908fd, 0x00100500, 0x08edf362,
+0xc500eb1f, 0x80d593f8, 0xc8b803fa, 0x0f000005,
+0x00033885, 0xfdf16200, 0xb88d7f08, 0x62ffffff,
+0x7308edf1, 0xffffb8b5, 0xf16203ff, 0x957f08fd,
+0xffffff98, 0x08e5f162, 0xffb8b573, 0x6202ffff,
+0xd408e5f1, 0x05edb8e3, 0xf3620000, 0xf41f08ed,
+0x93f8c500, 0x03fa80d6, 0x02ef850f, 0xf1620000,
+0x957308ed, 0xffffff98, 0xedf16202, 0xb8d2d408,
+0x000005f2, 0x08e5f362, 0xc500fa1f, 0x80d793f8,
+0x850f03fa, 0x000002c5, 0x038c45c7, 0x62000000,
+0x6e087df1, 0xf162e355, 0xd2f308f5, 0x028c45c7,
+0x62000000, 0x6e087df1, 0xf162e35d, 0xdbf308f5,
+0x08e5f162, 0x05b8e3d4, 0x62000006, 0x1f08edf3,
+0xf8c500c4, 0xfa80d093, 0x7e850f03, 0x62000002,
+0x6e087df1, 0xf162e365, 0xd4d308ed, 0x08edf162,
+0x09b8d2d4, 0x62000006, 0x1f08e5f3, 0xf8c500ca,
+0xfa80d193, 0x52850f03, 0xc5000002, 0x62d276e9,
+0x6f08fdf1, 0xddf162d9, 0xc4e4ef08, 0x652959e2,
+0xedf362e8, 0x40dc2508, 0x08fdf162, 0xffb89d7f,
+0xf262ffff, 0xa54708e5, 0xffffffe8, 0x08edf162,
+0xffe8add4, 0xf162ffff, 0xad7f08fd, 0xffffffe8,
+0x08e5f262, 0xffe89d47, 0x21b8ffff, 0x62000006,
+0x7f08fdf1, 0xffffa89d, 0xe5f162ff, 0x62dbd408,
+0x1f08ddf3, 0xf8c500d3, 0xfa80d293, 0xda850f03,
+0x62000001, 0x6f08fdf1, 0xffffa8bd, 0xc5f262ff,
+0xe89d4508, 0xb8ffffff, 0x00000626, 0x08e5f362,
+0xffb89d1f, 0xc500ffff, 0x80d393f8, 0x850f03fa,
+0x000001a9, 0x08f5f262, 0xffd89d3b, 0xf262ffff,
+0xa53f08f5, 0xffffffd8, 0x08f5f162, 0xffd88dd4,
+0xf162ffff, 0xdcd408e5, 0x000634b8, 0xe5f36200,
+0x00e11f08, 0xd493f8c5, 0x0f03fa80, 0x00016c85,
+0xfdf16200, 0xd8a56f08, 0x62ffffff, 0x6f08fdf1,
+0xffffc89d, 0x7df162ff, 0x4ecb7008, 0x08f5f362,
+0xc500ec1f, 0x80d593f8, 0x4eb803fa, 0x0f000006,
+0x00013885, 0x9045c700, 0x00000003, 0xf162d231,
+0xdbd408dd, 0xb8945589, 0x0000065d, 0x08fdf262,
+0x62f24d59, 0x1f08f5f3, 0xf8c500f3, 0xfa80d693,
+0x06850f03, 0xc7000001, 0xffff8045, 0x45c7ffff,
+0xffffff84, 0xfef162ff, 0xf04d7e08, 0x08fef162,
+0xf162d97e, 0xad6c08dd, 0xffffffc8, 0x08ddf162,
+0xffc88d6d, 0x45c7ffff, 0x00000190, 0xedf16200,
+0x31d1d408, 0xf5f362c0, 0x55cb2508, 0x62944589,
+0xfb08edf1, 0xedf162d5, 0x62d3ef08, 0xfb08edf1,
+0x06a6b8d1, 0xf2620000, 0x4d5908fd, 0xedf362f2,
+0x00f91f08, 0xd793f8c5, 0x0f03fa80, 0x00008c85,
+0xfdf16200, 0xc8b56f08, 0x62ffffff, 0x7e08fef1,
+0xf162fc4d, 0xb57f08fd, 0xffffffa8, 0x08fdf162,
+0xb0f64dd6, 0xfdf162aa, 0xc88d6f08, 0xc5ffffff,
+0x62c892f8, 0x6409f5f2, 0xffffd895, 0xedf362ff,
+0xa8851f08, 0x00ffffff, 0xd093f8c5, 0xb803fa80,
+0x0000073a, 0xf3623775, 0xd90308f5, 0xfdf26201,
+0x08155908, 0x62001005, 0xdb08f5f1, 0xf5f162ca,
+0xbacad408, 0x00000000, 0x08e5f362, 0xc500c91f,
+0x3cc193f8, 0x074ab803, 0x440f0000, 0x00c3c9c2,
+0x00000002, 0x00000000, 0x00000001, 0x00000000,
+0002420,
+};
+asm(".type avx512f_x86_32_D_16u8, STT_NOTYPE;");
+asm(".type avx512f_x86_32_D_16u8, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512f_x86_32_D_16f4[] = {
+0x83e58955, 0x00e8f0e4, 0xc9000003, 0xe8d955c3,
+0xec83e589, 0xc455d948, 0xd9c855d9, 0x100bc805,
+0xd855d900, 0x55d9c9d9, 0x9005d9e8, 0xd900100b,
+0x05d9cc55, 0x00100bc4, 0xd9dc55d9, 0xec55d9ca,
+0x5dd9cad9, 0xe05dd9d0, 0xd9f055d9, 0xd45dd9c9,
+0xd9e455d9, 0xf162f45d, 0x8d28087c, 0xffffffd8,
+0x0000a7b8, 0x7cf16200, 0xa0152808, 0x6200100b,
+0x28087cf1, 0x75f262d9, 0xc89d9808, 0x62ffffff,
+0xc2086cf1, 0xf8c500c3, 0xe280d093, 0x0ffa800f,
+0x0273850f, 0xf1620000, 0x1528087c, 0x00100bb0,
+0x0000abb8, 0x7cf16200, 0x62d92808, 0x9e0875f2,
+0xffffc89d, 0x6cf162ff, 0x00cbc208, 0xd193f8c5,
+0x800fe280, 0x850f0ffa, 0x0000023d, 0x087cf162,
+0x0bc01528, 0xafb80010, 0x62000000, 0x28087cf1,
+0x75f262d9, 0xc89d9a08, 0x62ffffff, 0xc2086cf1,
+0xf8c500d3, 0xe280d293, 0x0ffa800f, 0x0207850f,
+0xf1620000, 0x1528087c, 0x00100bd0, 0x0000b3b8,
+0x7cf16200, 0x62d92808, 0x9c0875f2, 0xffffc89d,
+0x6cf162ff, 0x00dbc208, 0xd393f8c5, 0x800fe280,
+0x850f0ffa, 0x000001d1, 0x087cf162, 0xffc89528,
+0xf162ffff, 0xd958086c, 0x087df262, 0xb8f16518,
+0x000000bb, 0x087cf162, 0xffd8b528, 0xf262ffff,
+0xe298084d, 0x0864f162, 0xc500e4c2, 0x80d493f8,
+0xfa800fe2, 0x8e850f0f, 0x62000001, 0x18087df2,
+0x100bd025, 0x00c0b800, 0xf1620000, 0xea28087c,
+0x087cf162, 0xffd8b528, 0xe0c5ffff, 0xf262dc57,
+0x6d9e184d, 0x64f162f1, 0x00edc208, 0xd593f8c5,
+0x800fe280, 0x850f0ffa, 0x0000014d, 0x086cf162,
+0xf262c95c, 0x5d18087d, 0x00c5b8f1, 0xf1620000,
+0xbd28087c, 0xffffffd8, 0x0845f262, 0xf162da9a,
+0xf3c20874, 0x93f8c500, 0x0fe280d6, 0x0f0ffa80,
+0x00011485, 0x7cf16200, 0xd8b52808, 0xc5ffffff,
+0xb8cc57f0, 0x000000ca, 0x087cf162, 0xf262da28,
+0x5d9c184d, 0x74f162f1, 0x00fbc208, 0xd793f8c5,
+0x800fe280, 0x850f0ffa, 0x000000dd, 0x086cf162,
+0xffd8ad59, 0xf162ffff, 0x8d28087c, 0xffffffe8,
+0xf1d0d3c5, 0x087cf162, 0xffd89d28, 0xd4b8ffff,
+0x62000000, 0x28087cf1, 0x65f262fa, 0xe8bda608,
+0x62ffffff, 0xc2084cf1, 0xf8c500c7, 0xe280d093,
+0x0ffa800f, 0x008f850f, 0xf0c50000, 0xd3c5cc57,
+0xf262e9d0, 0x9da7086d, 0xffffffe8, 0x0854f162,
+0xb800cbc2, 0x000000d8, 0xd193f8c5, 0x800fe280,
+0x65750ffa, 0x086cf162, 0xffd88d59, 0xf3c5ffff,
+0x62e84dd0, 0x28087cf1, 0xffffe89d, 0x00deb8ff,
+0xf1620000, 0xe228087c, 0x0865f262, 0xffd8a596,
+0xf162ffff, 0xd4c20874, 0x93f8c500, 0x0fe280d2,
+0x750ffa80, 0x65f26224, 0xd8959708, 0x62ffffff,
+0xc20854f1, 0xe2b800da, 0xc5000000, 0x80d393f8,
+0xfa800fe2, 0x3102750f, 0x55c3c9c0, 0xe589e8d9,
+0x94ec8157, 0xd9000000, 0x05d9a855, 0x00100bc8,
+0xd9b855d9, 0xc855d9c9, 0x0b9005d9, 0x55d90010,
+0xc405d9ac, 0xd900100b, 0xe8d9bc55, 0x55d9e0d9,
+0xd9c9d9cc, 0xc9d9b05d, 0xd9c055d9, 0xd055d9ca,
+0x5dd9cbd9, 0xd9cad9b4, 0xc9d9c45d, 0x62d45dd9,
+0x28087cf1, 0xffffa8b5, 0x7cf162ff, 0x78b52908,
+0x62ffffff, 0x28087cf1, 0xffff788d, 0x0539b8ff,
+0xf1620000, 0xc6c20874, 0x93f8c500, 0x0fe280d0,
+0x0f0ffa80, 0x00079d85, 0x74f16200, 0xa8955808,
+0x62ffffff, 0x29087cf1, 0xffff8895, 0x7cf162ff,
+0xa8bd2808, 0xb8ffffff, 0x0000053f, 0x0844f162,
+0xf162df58, 0x9528087c, 0xffffff88, 0x086cf162,
+0xc500d3c2, 0x80d293f8, 0xfa800fe2, 0x57850f0f,
+0x62000007, 0x5c086cf1, 0xffffa895, 0x7cf162ff,
+0x98952908, 0x62ffffff, 0xc20874f1, 0xffff989d,
+0x44b800ff, 0xc5000005, 0x80d393f8, 0xfa800fe2,
+0x27850f0f, 0x62000007, 0x28087cf1, 0xffffb8b5,
+0x74f162ff, 0xa88d5908, 0x62ffffff, 0x59084cf1,
+0x7cf162de, 0xa8952808, 0x62ffffff, 0x58086cf1,
+0x6cf162ee, 0xb8a55c08, 0xb8ffffff, 0x0000055b,
+0x0874f162, 0xf162cb5c, 0xe559085c, 0x0874f162,
+0xc500e4c2, 0x80d493f8, 0xfa800fe2, 0xcf850f0f,
+0x62000006, 0x59086cf1, 0xffffc88d, 0x7cf162ff,
+0x788d2908, 0x62ffffff, 0x5e086cf1, 0xffffc895,
+0x0564b8ff, 0xf1620000, 0xeac20874, 0x93f8c500,
+0x0fe280d5, 0x0f0ffa80, 0x00069985, 0x7df26200,
+0xd00d1808, 0xb800100b, 0x00000567, 0x087cf162,
+0xffc89528, 0xe8c5ffff, 0xf162d957, 0x9d590864,
+0xffffff78, 0x4d57f0c5, 0x64f162a8, 0x00f1c208,
+0xd693f8c5, 0x800fe280, 0x850f0ffa, 0x0000065a,
+0x087df162, 0xffa88d5b, 0xf162ffff, 0xc95b087c,
+0x0874f162, 0xffa8bdc2, 0xb800ffff, 0x0000056e,
+0xd793f8c5, 0x800fe280, 0x850f0ffa, 0x0000062e,
+0x087df262, 0xffa88d4c, 0xf162ffff, 0x8d29087c,
+0xffffff78, 0x087df262, 0xff788d4c, 0x75b8ffff,
+0x62000005, 0x28087cf1, 0xffffa8a5, 0x7df162ff,
+0x62c95b08, 0x5b087cf1, 0x74f162c9, 0x00c4c208,
+0xd093f8c5, 0x800fe280, 0x850f0ffa, 0x000005e2,
+0x085cf162, 0xf162cc59, 0x8d29087c, 0xffffff78,
+0x087df262, 0xff788d4e, 0xf162ffff, 0x8d29087c,
+0xffffff88, 0x087cf162, 0xff888d28, 0x7cb8ffff,
+0x62000005, 0x4c087df2, 0x7df162d9, 0x62db5b08,
+0x5b087cf1, 0x64f162db, 0x00d4c208, 0xd293f8c5,
+0x800fe280, 0x850f0ffa, 0x0000058a, 0x087df262,
+0xffa89d4c, 0xf162ffff, 0xc95b087d, 0x00057eb8,
+0x7cf16200, 0x62c95b08, 0x5b087df1, 0x7cf162db,
+0x62db5b08, 0xc20874f1, 0xf8c500db, 0xe280d393,
+0x0ffa800f, 0x0550850f, 0xf1620000, 0x9d79087c,
+0xffffffa8, 0x087ff162, 0xf162db7a, 0x8d28087c,
+0xffffffa8, 0x00058fb8, 0x64f16200, 0x00e1c208,
+0xd493f8c5, 0x800fe280, 0x850f0ffa, 0x0000051e,
+0x0874f162, 0xf162d959, 0x9d29087c, 0xffffff78,
+0x087cf162, 0xff789d51, 0x9cb8ffff, 0x62000005,
+0xc20864f1, 0xf8c500e9, 0xe280d593, 0x0ffa800f,
+0x04ec850f, 0xf2620000, 0x1d18087d, 0x00100be0,
+0x0864f162, 0xf162e15e, 0xa529087c, 0xffffff78,
+0x087df362, 0xff78ad08, 0xb80bffff, 0x000005a4,
+0x087ef162, 0x0be02510, 0xf1620010, 0xf5c2085c,
+0x93f8c500, 0x0fe280d6, 0x0f0ffa80, 0x0004a585,
+0x6cf16200, 0xb8a55908, 0x62ffffff, 0x59086cf1,
+0x7cf162e9, 0x88a52908, 0x62ffffff, 0x5f0854f1,
+0xffff88a5, 0x54f162ff, 0x88ad5d08, 0x62ffffff,
+0x29087cf1, 0xffff88ad, 0x5cf162ff, 0x88a55808,
+0xb8ffffff, 0x0000063d, 0x0874f162, 0xffb88d58,
+0xf162ffff, 0xe259085c, 0x085cf162, 0xc500f9c2,
+0x80d793f8, 0xfa800fe2, 0x3b850f0f, 0x62000004,
+0x28087cf1, 0xffffa8bd, 0x064eb8ff, 0xf1620000,
+0x8d28087c, 0xffffffb8, 0x0844f162, 0x621be7c6,
+0xc2085cf1, 0xf8c500c9, 0xe280d193, 0x0ffa800f,
+0x0408850f, 0xf1620000, 0xa528087c, 0xffffffa8,
+0x000653b8, 0x7df36200, 0x1bec0408, 0x0854f162,
+0xc500c1c2, 0x80d093f8, 0xfa800fe2, 0xdf850f0f,
+0x62000003, 0x580874f1, 0x065db8e4, 0x45c70000,
+0xa00000e8, 0x7df26240, 0xfa6d1808, 0x0854f162,
+0xc500d4c2, 0x80d293f8, 0xfa800fe2, 0xb3850f0f,
+0x62000003, 0x140874f1, 0xffffa8a5, 0x74f162ff,
+0xa88d1508, 0x62ffffff, 0x5c085cf1, 0xe85dd9c9,
+0x087df262, 0xb8fa6518, 0x000006a6, 0x0874f162,
+0xf162ca59, 0xdcc20874, 0x7cf16200, 0x988d2908,
+0xc5ffffff, 0x80d393f8, 0xfa800fe2, 0x65850f0f,
+0x62000003, 0x28087cf1, 0xffffa8b5, 0x7cf162ff,
+0xd8b52908, 0x62ffffff, 0x5a087cf1, 0xf162fb4d,
+0x8d2908fd, 0xffffff78, 0x08fdf162, 0xff788d5a,
+0xf162ffff, 0x8d29087c, 0xffffffe8, 0xd9a845d9,
+0xe9dfe845, 0x617ad8dd, 0x45d95f75, 0xec45d9ac,
+0xd8dde9df, 0x5175537a, 0x087ef162, 0xffa8a512,
+0xf262ffff, 0x0d18087d, 0x00100b94, 0x000717b8,
+0x74f16200, 0x62ca5808, 0x18087df2, 0x100b982d,
+0x74f16200, 0x62cd5908, 0x5c085cf1, 0xffffa8a5,
+0x5cf162ff, 0x00e1c208, 0xd493f8c5, 0x800fe280,
+0x0f740ffa, 0x0002bfe9, 0x06f1b800, 0xb5e90000,
+0x62000002, 0x16087ef1, 0xffffa88d, 0x6cf162ff,
+0xb8db5808, 0x0000071e, 0x087cf162, 0xffa8a528,
+0xf162ffff, 0xdd590864, 0x0874f162, 0xf162cc5c,
+0xebc20874, 0x93f8c500, 0x0fe280d5, 0x0f0ffa80,
+0x00027385, 0xbc45d900, 0xc957f0c5, 0x62987d8d,
+0x29087cf1, 0xffff88a5, 0x072ab8ff, 0xf0c50000,
+0xd901d2c2, 0x45d98c5d, 0x945dd9c4, 0xe2f7f9c5,
+0x086df362, 0x6255d225, 0x6f087df1, 0xffffb8bd,
+0xf7f9c5ff, 0x7cf162fa, 0x88952808, 0x62ffffff,
+0x28087cf1, 0xffff98b5, 0x4cf162ff, 0x00f2c208,
+0xd693f8c5, 0x800fe280, 0x850f0ffa, 0x00000208,
+0x087cf162, 0xffa8bd28, 0x0ab0ffff, 0xc892f8c5,
+0x00073ab8, 0x45f26200, 0xb89d6509, 0x62ffffff,
+0xc20864f1, 0xf8c500fa, 0xe280d793, 0x0ffa800f,
+0x01d2850f, 0xf1620000, 0xb528087c, 0xffffffa8,
+0x55d0cbc5, 0x7cf162b8, 0xa89d2808, 0xb8ffffff,
+0x00000743, 0x0864f162, 0xffb8a55c, 0xf162ffff,
+0xa5580964, 0xffffffb8, 0x086cf162, 0xc500ccc2,
+0x80d193f8, 0xfa800fe2, 0x89850f0f, 0x62000001,
+0x29087cf1, 0xffff789d, 0x7cf3c5ff, 0xffff7895,
+0x7cf162ff, 0x78952908, 0xc5ffffff, 0x78957cf3,
+0xd9ffffff, 0x100b9c05, 0x7df36200, 0xdb551708,
+0x6c85d903, 0xdfffffff, 0x0fd8dde9, 0x0000f08a,
+0xea850f00, 0x62000000, 0x28087cf1, 0xffffa8bd,
+0x0767b8ff, 0xc3c50000, 0xc5b8557d, 0xc5d17ceb,
+0x62d17ceb, 0xc2086cf1, 0xf8c500c1, 0xe280d093,
+0x0ffa800f, 0x010e850f, 0xf3620000, 0x8d26087d,
+0xffffffa8, 0x7cf16200, 0x788d2908, 0x62ffffff,
+0x42087df2, 0xffffa88d, 0x7cf162ff, 0x888d2908,
+0x31ffffff, 0x62d231c9, 0x6e087df1, 0xfdf162c9,
+0xee4dd608, 0xff70addf, 0x44d9ffff, 0xe9df8895,
+0x747ad8dd, 0x428d7275, 0x027a8d01, 0xff83c721,
+0x00d18301, 0x1175d085, 0x84d9e8d9, 0xffff7485,
+0xdde9dfff, 0x75587ad8, 0x04f88356, 0xc2890474,
+0xf162b5eb, 0xb528087c, 0xffffff78, 0x00077db8,
+0x4df26200, 0x888d2c08, 0x62ffffff, 0x28087cf1,
+0xffffa8bd, 0x44f162ff, 0x00d1c208, 0xd293f8c5,
+0x800fe280, 0x60750ffa, 0xfff4f0e8, 0xebd8f7ff,
+0x075eb857, 0x50eb0000, 0x000773b8, 0xb849eb00,
+0x00000778, 0xd8dd42eb, 0xd8dd3eeb, 0xd8dd3aeb,
+0xd8dd36eb, 0xd8dd32eb, 0xd8dd2eeb, 0xd8dd2aeb,
+0xd8dd26eb, 0xd8dd22eb, 0xd8dd1eeb, 0xd8dd1aeb,
+0xd8dd16eb, 0xd8dd12eb, 0xd8dd0eeb, 0xd8dd0aeb,
+0xd8dd06eb, 0xd8dd02eb, 0x0094c481, 0x5d5f0000,
+0x000000c3, 0x00000000, 0x00000000, 0x00000000,
+0x40000000, 0xbf800000, 0x3f000000, 0x41200000,
+0x41000000, 0x41100000, 0x41000000, 0x40a00000,
+0xc1000000, 0xc1100000, 0xc1000000, 0xc0a00000,
+0x00000000, 0x40400000, 0x40800000, 0x40400000,
+0x80000000, 0xc0400000, 0xc0800000, 0xc0400000,
+0x3f800000, 0x00000000, 0x00000000, 0x00000000,
+0005760,
+};
+asm(".type avx512f_x86_32_D_16f4, STT_NOTYPE;");
+asm(".type avx512f_x86_32_D_16f4, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512f_x86_32_D_16f8[] = {
+0x83e58955, 0xbae8f0e4, 0xc9000002, 0xe8d955c3,
+0xec83e589, 0xc055dd48, 0xd9c855dd, 0x100a1005,
+0xd855dd00, 0x55ddc9d9, 0xddc9d9e8, 0x55ddd05d,
+0xf05ddde0, 0x08fdf162, 0x0a201528, 0xf1620010,
+0x8d2808fd, 0xffffffd8, 0x08fdf162, 0xf262d928,
+0x9d9808f5, 0xffffffc8, 0x08edf162, 0xc500c3c2,
+0x80d093f8, 0xa7b803fa, 0x0f000000, 0x00025285,
+0xfdf16200, 0x30152808, 0x6200100a, 0x2808fdf1,
+0xf5f262d9, 0xc89d9e08, 0x62ffffff, 0xc208edf1,
+0xf8c500cb, 0xfa80d193, 0x00abb803, 0x850f0000,
+0x0000021f, 0x08fdf162, 0x0a401528, 0xf1620010,
+0xd92808fd, 0x08f5f262, 0xffc89d9a, 0xf162ffff,
+0xd3c208ed, 0x93f8c500, 0x03fa80d2, 0x0000afb8,
+0xec850f00, 0x62000001, 0x2808fdf1, 0x100a5015,
+0xfdf16200, 0x62d92808, 0x9c08f5f2, 0xffffc89d,
+0xedf162ff, 0x00dbc208, 0xd393f8c5, 0xb803fa80,
+0x000000b3, 0x01b9850f, 0xf1620000, 0x952808fd,
+0xffffffc8, 0x08edf162, 0xf162d958, 0x651208ff,
+0xfdf162f8, 0xd8b52808, 0x62ffffff, 0x9808cdf2,
+0xe5f162e2, 0x00e4c208, 0xd493f8c5, 0xb803fa80,
+0x000000bb, 0x0179850f, 0xf1620000, 0x251208ff,
+0x00100a50, 0x08fdf162, 0xf162ea28, 0xb52808fd,
+0xffffffd8, 0xdc57e1c5, 0x18cdf262, 0x62f86d9e,
+0xc208e5f1, 0xf8c500ed, 0xfa80d593, 0x00c0b803,
+0x850f0000, 0x0000013b, 0x08edf162, 0xf162c95c,
+0x5d1208ff, 0xfdf162f8, 0xd8bd2808, 0x62ffffff,
+0x9a08c5f2, 0xf5f162da, 0x00f3c208, 0xd693f8c5,
+0xb803fa80, 0x000000c5, 0x0105850f, 0xf1620000,
+0xda2808fd, 0x08fdf162, 0xffd8b528, 0xf1c5ffff,
+0xf262cc57, 0x5d9c18cd, 0xf5f162f8, 0x00fbc208,
+0xd793f8c5, 0xb803fa80, 0x000000ca, 0x00d1850f,
+0xf1620000, 0x8d2808fd, 0xffffffe8, 0x08edf162,
+0xffd8ad59, 0xd1c5ffff, 0xf162f1d0, 0x9d2808fd,
+0xffffffd8, 0x08fdf162, 0xf262fa28, 0xbda608e5,
+0xffffffe8, 0x08cdf162, 0xc500c7c2, 0x80d093f8,
+0xd4b803fa, 0x0f000000, 0x00008685, 0x57f1c500,
+0xd0d1c5cc, 0xedf262e9, 0xe89da708, 0x62ffffff,
+0xc208d5f1, 0xf8c500cb, 0xfa80d193, 0x00d8b803,
+0x5f750000, 0x08edf162, 0xffd88d59, 0xf1c5ffff,
+0x62e84dd0, 0x2808fdf1, 0xffffe89d, 0xfdf162ff,
+0x62e22808, 0x9608e5f2, 0xffffd8a5, 0xf5f162ff,
+0x00d4c208, 0xd293f8c5, 0xb803fa80, 0x000000de,
+0xf2622175, 0x959708e5, 0xffffffd8, 0x08d5f162,
+0xc500dac2, 0x80d393f8, 0xe2b803fa, 0x75000000,
+0xc9c03102, 0xc03155c3, 0xe589e8d9, 0x84ec8157,
+0xdd000000, 0x05d9c855, 0x00100a10, 0xd9d855dd,
+0xf04589c9, 0xd9e855dd, 0xf445c7c9, 0xbff00000,
+0xddd05ddd, 0xf162e055, 0xb52808fd, 0xffffffc8,
+0x08fdf162, 0xff98b529, 0xf162ffff, 0x8d2808fd,
+0xffffff98, 0x08f5f162, 0xc500c6c2, 0x80d093f8,
+0x39b803fa, 0x0f000005, 0x00068285, 0xf5f16200,
+0xc8955808, 0x62ffffff, 0x2908fdf1, 0xffffa895,
+0xfdf162ff, 0xa8952808, 0x62ffffff, 0x2808fdf1,
+0xffffc8bd, 0xc5f162ff, 0x62df5808, 0xc208edf1,
+0xf8c500d3, 0xfa80d293, 0x053fb803, 0x850f0000,
+0x0000063f, 0x08edf162, 0xffc8955c, 0xf162ffff,
+0x952908fd, 0xffffffb8, 0x08f5f162, 0xffb89dc2,
+0xc500ffff, 0x80d393f8, 0x44b803fa, 0x0f000005,
+0x00061285, 0xfdf16200, 0xd8ad2808, 0x62ffffff,
+0x5908f5f1, 0xffffc88d, 0xd5f162ff, 0x62dd5908,
+0x2808fdf1, 0xffffc895, 0xedf162ff, 0x62ed5808,
+0x5c08edf1, 0xffffd8a5, 0xf5f162ff, 0x62cb5c08,
+0x5908ddf1, 0xf5f162e5, 0x00e4c208, 0xd493f8c5,
+0xb803fa80, 0x0000055b, 0x05bd850f, 0xf1620000,
+0x8d5908ed, 0xffffffe8, 0x08fdf162, 0xff988d29,
+0xf162ffff, 0x955e08ed, 0xffffffe8, 0x08f5f162,
+0xc500eac2, 0x80d593f8, 0x64b803fa, 0x0f000005,
+0x00058a85, 0xfff16200, 0x500d1208, 0x6200100a,
+0x2808fdf1, 0xffffe895, 0x57e9c5ff, 0x57f1c5d9,
+0xf162c84d, 0x9d5908e5, 0xffffff98, 0x08e5f162,
+0xc500f1c2, 0x80d693f8, 0x67b803fa, 0x0f000005,
+0x00054e85, 0xfff16200, 0xc88de608, 0x62ffffff,
+0xe6087ef1, 0xf5f162c9, 0xc8bdc208, 0x00ffffff,
+0xd793f8c5, 0xb803fa80, 0x0000056e, 0x0525850f,
+0xf2620000, 0x8d4c08fd, 0xffffffc8, 0x08fdf162,
+0xff988d29, 0xf162ffff, 0xa52808fd, 0xffffffc8,
+0x08fdf262, 0xff988d4c, 0xf162ffff, 0xc9e608ff,
+0x087ef162, 0xf162c9e6, 0xc4c208f5, 0x93f8c500,
+0x03fa80d0, 0x000575b8, 0xdc850f00, 0x62000004,
+0x5908ddf1, 0xfdf162cc, 0x988d2908, 0x62ffffff,
+0x4e08fdf2, 0xffff988d, 0xfdf162ff, 0xa88d2908,
+0x62ffffff, 0x2808fdf1, 0xffffa88d, 0xfdf262ff,
+0x62d94c08, 0xe608fff1, 0x7ef162db, 0x62dbe608,
+0xc208e5f1, 0xf8c500d4, 0xfa80d293, 0x057cb803,
+0x850f0000, 0x00000487, 0x08fdf262, 0xffc89d4c,
+0xf162ffff, 0xc9e608ff, 0x08fff162, 0xf162dbe6,
+0xc9e6087e, 0x087ef162, 0xf162dbe6, 0xdbc208f5,
+0x93f8c500, 0x03fa80d3, 0x00057eb8, 0x50850f00,
+0x62000004, 0x7908fcf1, 0xffffc89d, 0x7ef162ff,
+0x62db7a08, 0x2808fdf1, 0xffffc88d, 0xe5f162ff,
+0x00e1c208, 0xd493f8c5, 0xb803fa80, 0x0000058f,
+0x0421850f, 0xf1620000, 0xd95908f5, 0x08fdf162,
+0xff989d29, 0xf162ffff, 0x9d5108fd, 0xffffff98,
+0x08e5f162, 0xc500e9c2, 0x80d593f8, 0x9cb803fa,
+0x0f000005, 0x0003f285, 0xfff16200, 0x481d1208,
+0x6200100a, 0x5e08e5f1, 0xfdf162d9, 0x989d2908,
+0x62ffffff, 0x0908fdf3, 0xffff98a5, 0xf1620bff,
+0x1d7e08fe, 0x00100a60, 0x0005a4b8, 0xe5f16200,
+0x00f4c208, 0xd693f8c5, 0x0f03fa80, 0x0003ae85,
+0xedf16200, 0xd89d5908, 0x62ffffff, 0x5908edf1,
+0xfdf162e1, 0xa89d2908, 0x62ffffff, 0x5f08ddf1,
+0xffffa89d, 0xddf162ff, 0xa8a55d08, 0x62ffffff,
+0x2908fdf1, 0xffffa8a5, 0xe5f162ff, 0xa89d5808,
+0x62ffffff, 0x5808f5f1, 0xffffd88d, 0xe5f162ff,
+0x62da5908, 0xc208e5f1, 0xf8c500f9, 0xfa80d793,
+0x063db803, 0x850f0000, 0x00000347, 0x08fdf162,
+0xffc8b528, 0xf162ffff, 0x8d2808fd, 0xffffffd8,
+0x08cdf162, 0x6201dec6, 0xc208e5f1, 0xf8c500c9,
+0xfa80d193, 0x064eb803, 0x850f0000, 0x00000317,
+0x08fdf162, 0xffc89d28, 0xf362ffff, 0xe30508fd,
+0xddf16201, 0x00c1c208, 0xd093f8c5, 0xb803fa80,
+0x00000653, 0x02f1850f, 0x05d90000, 0x00100a14,
+0x08f5f162, 0x5db8db58, 0xdd000006, 0xf2629055,
+0x655908fd, 0xddf162f2, 0x00d3c208, 0xd293f8c5,
+0x0f03fa80, 0x0002c685, 0x62c9d900, 0x1608f5f1,
+0xf162f95d, 0xbd2808fd, 0xffffffc8, 0x08f5f162,
+0xf162cf15, 0xc95c08e5, 0x62905ddd, 0x5908f5f1,
+0xfdf262ca, 0xf25d5908, 0x08f5f162, 0xc500dbc2,
+0x80d393f8, 0xa6b803fa, 0x62000006, 0x2908fdf1,
+0xffffb88d, 0x7a850fff, 0xf2000002, 0xc84d120f,
+0x08fdf162, 0xffc89d28, 0xf162ffff, 0x255818ed,
+0x00100a58, 0x08f5f162, 0xf162cb5c, 0x255918dd,
+0x00100a70, 0x08f5f162, 0xc500e4c2, 0x80d493f8,
+0x17b803fa, 0x0f000007, 0x00023c85, 0xb87d8d00,
+0x08fdf162, 0xffa89d29, 0xf162ffff, 0x6d1008ff,
+0x57f1c5fc, 0xfff162c9, 0xf66d1108, 0xcac2f1c5,
+0xf7f9c501, 0x75f362d9, 0x55c92508, 0x08fdf162,
+0xffd8b56f, 0xf9c5ffff, 0xf162f1f7, 0x8d2808fd,
+0xffffffa8, 0x08fdf162, 0xffb8bd28, 0xf162ffff,
+0xe9c208c5, 0x93f8c500, 0x03fa80d5, 0x00072ab8,
+0xd6850f00, 0xb0000001, 0xfdf162aa, 0xc8ad2808,
+0xc5ffffff, 0x62c892f8, 0x6509d5f2, 0xffffd895,
+0xedf162ff, 0x00f1c208, 0xd693f8c5, 0xb803fa80,
+0x0000073a, 0x01a7850f, 0xf1620000, 0xb52808fd,
+0xffffffc8, 0x4dd0c9c5, 0xfdf162d8, 0xc8952808,
+0x62ffffff, 0x5c08edf1, 0xffffd89d, 0xedf162ff,
+0xd89d5809, 0x62ffffff, 0xc208f5f1, 0xf8c500fb,
+0xfa80d793, 0x0743b803, 0x850f0000, 0x00000165,
+0x08fdf162, 0xff989529, 0xe9c5ffff, 0xe9c5d257,
+0x62984d7c, 0x1708fdf1, 0x45ddf04d, 0xdde9df80,
+0xc78a0fd8, 0x0f000000, 0x0000c185, 0xfdf16200,
+0xc8bd2808, 0xc5ffffff, 0xd84d7dc1, 0xca7cf1c5,
+0x08f5f162, 0xc500cac2, 0x80d193f8, 0x67b803fa,
+0x0f000007, 0x00010e85, 0xfdf36200, 0xc88d2608,
+0x00ffffff, 0x08fdf162, 0xff988d29, 0xf262ffff,
+0x8d4208fd, 0xffffffc8, 0x08fdf162, 0xffa88d29,
+0xeed9ffff, 0xdfa845dd, 0x7ad8dde9, 0xd96c756e,
+0x9845dde8, 0x6a7ae9df, 0x45dd6c75, 0x7ae9dfb0,
+0xdd567554, 0xe9dfa045, 0x5c7ad8dd, 0xf1625a75,
+0xad2808fd, 0xffffff98, 0x08d5f262, 0xffa88d2c,
+0xf162ffff, 0xb52808fd, 0xffffffc8, 0x00077db8,
+0xcdf16200, 0x00c1c208, 0xd093f8c5, 0x0f03fa80,
+0x00008285, 0xf683e800, 0xd8f7ffff, 0x5eb879eb,
+0xeb000007, 0xebd8dd72, 0xb8d8dd02, 0x00000773,
+0xd8dd65eb, 0xd8dd02eb, 0x000778b8, 0xdd58eb00,
+0xdd54ebd8, 0xdd50ebd8, 0xdd4cebd8, 0xdd48ebd8,
+0xdd44ebd8, 0xdd40ebd8, 0xdd3cebd8, 0xdd38ebd8,
+0xdd34ebd8, 0xdd30ebd8, 0xdd2cebd8, 0xdd28ebd8,
+0xdd24ebd8, 0xdd20ebd8, 0xdd1cebd8, 0xdd18ebd8,
+0xebd8ddd8, 0xebd8dd12, 0xebd8dd0e, 0xebd8dd0a,
+0xebd8dd06, 0x81d8dd02, 0x000084c4, 0xc35d5f00,
+0x40000000, 0x40400000, 0x00000000, 0x00000000,
+0x00000000, 0x40100000, 0x00000000, 0x40080000,
+0x00000000, 0xc0100000, 0x00000000, 0xc0080000,
+0x00000000, 0x00000000, 0x00000000, 0x3ff00000,
+0x00000000, 0x80000000, 0x00000000, 0xbff00000,
+0x00000000, 0x3ff00000, 0x00000000, 0x00000000,
+0x00000000, 0x3fe00000,
+0005170,
+};
+asm(".type avx512f_x86_32_D_16f8, STT_NOTYPE;");
+asm(".type avx512f_x86_32_D_16f8, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512f_x86_32_D_32i4[] = {
+0xb95500eb, 0x00000020, 0xc031e589, 0x83535657,
+0xec81e0e4, 0x00000160, 0x09bfc389, 0x89000000,
+0xe28340da, 0x83c72901, 0xf61901fa, 0x4e02e683,
+0x0175d885, 0x84848949, 0x0000009c, 0x8903e2c1,
+0x00bc84bc, 0xebd10000, 0xdc84b489, 0x09000000,
+0x849489da, 0x0000011c, 0x8304c283, 0x8c8908f8,
+0x0000fc84, 0x84948900, 0x0000013c, 0xf162aa75,
+0x746f287d, 0xf1620524, 0x747f287d, 0xf1620224,
+0x4c6f287d, 0xf3620224, 0xc61f2875, 0x93f8c500,
+0xb8c2fed0, 0x00000539, 0x0628850f, 0xf1620000,
+0x54fe2875, 0xf1620524, 0x547f287d, 0xf1620324,
+0x74722865, 0x62010524, 0x6f287df1, 0xb8032454,
+0x0000053f, 0x286df362, 0xc500d31f, 0xfed293f8,
+0xef850fc2, 0x62000005, 0xfa286df1, 0x62052454,
+0x7f287df1, 0x62042454, 0x1f2875f3, 0x0004245c,
+0xd393f8c5, 0x44b8c2fe, 0x0f000005, 0x0005c585,
+0x7df16200, 0x247c6f28, 0x75f26206, 0x244c4028,
+0x45f26205, 0x62e74028, 0x6f287df1, 0x62052454,
+0xfe286df1, 0x6df162ef, 0x245cfa28, 0x75f16206,
+0xb8ccfa28, 0x0000055b, 0x2865f262, 0xf362dd40,
+0xe31f2875, 0x93f8c500, 0x62c2fed4, 0x7f287df1,
+0x0f04245c, 0x00056d85, 0x6df26200, 0x244c4028,
+0x75f36206, 0xe02d1f28, 0x00001006, 0xd593f8c5,
+0x1c2444c7, 0x00000002, 0xc8b8c2fe, 0x0f000005,
+0x00054185, 0x6df16200, 0x244cef28, 0x7df16207,
+0x244c7f28, 0xf5f26202, 0x244c2828, 0x7df16206,
+0x244c7f28, 0x8bc93103, 0x00c08c84, 0x6cf70000,
+0x8489408c, 0x0000808c, 0x8c948900, 0x00000084,
+0x8302c183, 0xdf7508f9, 0x287df162, 0x0324746f,
+0x284df162, 0x04247476, 0xd693f8c5, 0xe1b8c2fe,
+0x0f000005, 0x0004dd85, 0x6df26200, 0x245c4028,
+0x7df16207, 0x245c7f28, 0x75f16204, 0x24747228,
+0xf1620304, 0x4c7f287d, 0xf1620224, 0x7472285d,
+0x62020424, 0xfe285df1, 0x05edb8ec, 0xf3620000,
+0xfd1f2875, 0x93f8c500, 0x0fc2fed7, 0x00049585,
+0x75f16200, 0x24647228, 0xf1620202, 0xc9fe2875,
+0x0005f2b8, 0x5df36200, 0x00c11f28, 0xd093f8c5,
+0x850fc2fe, 0x0000046e, 0x1c2444c7, 0x00000003,
+0x1c24448b, 0x08244489, 0x891ff8c1, 0x620c2444,
+0x7e08fef1, 0x6201247c, 0xf22865f1, 0x2444c7cf,
+0x0000021c, 0x24448b00, 0x2444891c, 0x1ff8c108,
+0x0c244489, 0x08fef162, 0x0124747e, 0x2865f162,
+0xf162def2, 0xe3fe2865, 0x000605b8, 0x75f36200,
+0x00d41f28, 0xd293f8c5, 0x850fc2fe, 0x00000406,
+0x1c24448b, 0x08244489, 0x891ff8c1, 0x620c2444,
+0x7e08fef1, 0x6201247c, 0xe22875f1, 0x75f162cf,
+0xb8c9fe28, 0x00000609, 0x2865f362, 0xc500d91f,
+0xfed393f8, 0xcb850fc2, 0x62000003, 0xef0875f1,
+0x7df162c9, 0x24746f28, 0x4df36208, 0x06c91f28,
+0xa96df262, 0x07245c40, 0x2865f262, 0x08246447,
+0x000001b8, 0x7df16200, 0x247c6f28, 0x7df26208,
+0x62c87c28, 0xfa2845f1, 0x7df162c9, 0x244c7f28,
+0x65f26208, 0x244c4728, 0x0621b808, 0xf1620000,
+0xe9fe2875, 0x285df362, 0xc500e51f, 0xfed493f8,
+0x5f850fc2, 0x62000003, 0x462875f2, 0xb808244c,
+0x00000626, 0x2875f362, 0xc500eb1f, 0xfed593f8,
+0x3f850fc2, 0x62000003, 0x6f287df1, 0x6207244c,
+0x402875f2, 0x6206245c, 0x402875f2, 0x62052464,
+0x7f287df1, 0x6203245c, 0x3d285df2, 0x6203245c,
+0x39285df2, 0x62032464, 0x7f287df1, 0x62032464,
+0xfe2865f1, 0xb803245c, 0x0000063d, 0x286df162,
+0x062464fe, 0x2865f262, 0xf362d940, 0xf41f2865,
+0x93f8c500, 0x0fc2fed6, 0x0002d985, 0x6df26200,
+0x62d94028, 0x7f287df1, 0x6202245c, 0x1e287df2,
+0x6202245c, 0x1f2865f3, 0xf8c500fa, 0xc2fed793,
+0x000644b8, 0xab850f00, 0x62000002, 0x6f287df1,
+0x62052474, 0x6f287df1, 0x6206245c, 0x43284df3,
+0xf16201d6, 0xd270287d, 0x6df3621b, 0x00c31f28,
+0xd093f8c5, 0x4eb8c2fe, 0x0f000006, 0x00027585,
+0x0001b800, 0xf1620000, 0x6c6f287d, 0xf2620524,
+0xd07c287d, 0x2865f162, 0x53b8d2fa, 0x62000006,
+0x36286df2, 0x6df362d5, 0x00cb1f28, 0xd193f8c5,
+0x850fc2fe, 0x0000023e, 0x302444c7, 0x00000009,
+0x2865f162, 0x5db8e5fe, 0x62000006, 0x58287df2,
+0x620c2454, 0x1f286df3, 0xf8c500d4, 0xc2fed293,
+0x0210850f, 0x09b80000, 0x62000000, 0x7c287df2,
+0x6df362d0, 0x00dc1f28, 0xd393f8c5, 0x61b8c2fe,
+0x0f000006, 0x0001ed85, 0x7df36200, 0x246c3928,
+0xf2620003, 0x645a287d, 0xf3620324, 0x54382855,
+0x62010324, 0x1f285df3, 0xf8c500e2, 0xc0fec493,
+0x00066cb8, 0xbb850f00, 0x62000001, 0x6f287df1,
+0x62092454, 0x6f287df1, 0x6df262e3, 0x24647e28,
+0x7df16205, 0x247c6f28, 0x45f2620a, 0x245c7e28,
+0x2444c705, 0x00000430, 0x5df16200, 0xb8dbfa28,
+0x000006a6, 0x2865f262, 0xf262d940, 0x6458287d,
+0xf3620c24, 0xec1f2865, 0x93f8c500, 0x0fc2fed5,
+0x00016185, 0x75f26200, 0x245c4028, 0x75f16205,
+0x1fe17228, 0x2865f262, 0xf162d176, 0x5c7f287d,
+0xf1620224, 0x547f287d, 0xf1620324, 0x746f287d,
+0xf3620224, 0x7439287d, 0x62000324, 0x25287df2,
+0x6203244c, 0x7f287df1, 0x6204244c, 0x1f2875f3,
+0xf8c500f2, 0xc2fed693, 0x0006b3b8, 0x03850f00,
+0x62000001, 0x6f287df1, 0x6205244c, 0x39287df3,
+0x0003244c, 0x087df162, 0x03247c6f, 0x087df162,
+0x02247c7f, 0x287df262, 0x02245425, 0x287df162,
+0x0224547f, 0x287df162, 0x02246c6f, 0x287ef262,
+0x03246c35, 0xb48bc031, 0x0000a084, 0x84743900,
+0xb80a7430, 0x000006f1, 0x0000a9e9, 0xf8834000,
+0x8be37504, 0x00c42484, 0xf1620000, 0x4c7f287d,
+0x44890324, 0x848b6424, 0x0000cc24, 0x24448900,
+0x24848b6c, 0x000000d4, 0x74244489, 0xdc24848b,
+0x89000000, 0xb07c2444, 0x7df162aa, 0x244c6f28,
+0x92f8c505, 0x75f262c8, 0x24546429, 0x6df36206,
+0x247c1f28, 0xf8c50003, 0xc2fed793, 0x00073ab8,
+0x62437500, 0x032875f3, 0x07b801d9, 0xba000000,
+0x00000000, 0x287df262, 0x01b8d07c, 0x62000000,
+0xdb2875f1, 0x7df262ca, 0x62d07c28, 0xfe2875f1,
+0x65f362ca, 0x00c11f28, 0xc093f8c5, 0x4ab8c0fe,
+0x0f000007, 0x658dc244, 0x5f5e5bf4, 0x0000c35d,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000008, 0x0000000e, 0x00000012, 0x00000014,
+0x00000014, 0x00000012, 0x0000000e, 0x00000008,
+0003400,
+};
+asm(".type avx512f_x86_32_D_32i4, STT_NOTYPE;");
+asm(".type avx512f_x86_32_D_32i4, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512f_x86_32_D_32u4[] = {
+0xb95500eb, 0x00000020, 0xc031e589, 0x83535657,
+0xec81e0e4, 0x00000160, 0x09bec389, 0x40000000,
+0xe283da89, 0x8dc62901, 0xd885ff7a, 0x89490175,
+0x009c8484, 0xe2c10000, 0x84b48903, 0x000000bc,
+0xbc89ebd1, 0x0000dc84, 0x89da0900, 0x011c8494,
+0xc2830000, 0x08f88304, 0xfc848c89, 0x89000000,
+0x013c8494, 0xb0750000, 0x287df162, 0x05247c6f,
+0x287df162, 0x02247c7f, 0x287df162, 0x0224546f,
+0x286df362, 0xc500c71f, 0xfed093f8, 0x0539b8c2,
+0x850f0000, 0x0000058e, 0x286df162, 0x05244cfe,
+0x287df162, 0x03244c7f, 0x2865f162, 0x05247472,
+0x7df16201, 0x244c6f28, 0x053fb803, 0xf3620000,
+0xd31f2875, 0x93f8c500, 0x0fc2fed2, 0x00055585,
+0x75f16200, 0x244cfa28, 0x7df16205, 0x244c7f28,
+0x7df16204, 0x245c6f28, 0x6df36204, 0x00db1f28,
+0xd393f8c5, 0x44b8c2fe, 0x0f000005, 0x00052585,
+0x6df16200, 0x2454eb28, 0x7df16206, 0x24547f28,
+0x75f16202, 0x244cdb28, 0x65f16206, 0x2454ef28,
+0x7df16206, 0x24547f28, 0x75f16204, 0x244cdf28,
+0x75f36202, 0x00e21f28, 0xd493f8c5, 0x50b8c2fe,
+0x0f000005, 0x0004dd85, 0x7df16200, 0x24546f28,
+0x6df26205, 0x244c4028, 0x75f36206, 0x402d1f28,
+0x00001006, 0xd593f8c5, 0x1c2444c7, 0x00000002,
+0xc8b8c2fe, 0x0f000005, 0x0004a985, 0x6df16200,
+0x244cef28, 0x7df16207, 0x244c7f28, 0xf5f16202,
+0x244cf428, 0x7df16206, 0x244c7f28, 0x8bc93103,
+0x00c08c84, 0x64f70000, 0x8489408c, 0x0000808c,
+0x8c948900, 0x00000084, 0x8302c183, 0xdf7508f9,
+0x287df162, 0x0324746f, 0x284df162, 0x04247476,
+0xd693f8c5, 0xe1b8c2fe, 0x0f000005, 0x00044585,
+0x7df16200, 0x24547f28, 0x75f16204, 0x24747228,
+0xf1620304, 0x4c7f287d, 0xf1620224, 0x74722865,
+0x62020424, 0xfe2865f1, 0x05edb8e3, 0xf3620000,
+0xfc1f2875, 0x93f8c500, 0x0fc2fed7, 0x00040585,
+0x75f16200, 0x24547228, 0xf1620202, 0xc9fe2875,
+0x0005f2b8, 0x65f36200, 0x00c11f28, 0xd093f8c5,
+0x850fc2fe, 0x000003de, 0x1c2444c7, 0x00000003,
+0x087df162, 0x07244c6e, 0x286df162, 0x44c7c9f2,
+0x00021c24, 0xf1620000, 0x5c6e087d, 0xf1620724,
+0xdbf2286d, 0x2865f162, 0x05b8e3fe, 0x62000006,
+0x1f2875f3, 0xf8c500cc, 0xc2fed193, 0x0394850f,
+0xf1620000, 0x646e087d, 0xf1620724, 0xccd22875,
+0x2875f162, 0x09b8c9fe, 0x62000006, 0x1f2865f3,
+0xf8c500d1, 0xc2fed293, 0x0368850f, 0xf5c50000,
+0xf162c976, 0xe26f287d, 0x0865f162, 0xe5c5dbef,
+0x00249c76, 0x62000001, 0x252875f3, 0xf26240e3,
+0x6c47285d, 0xf1620824, 0x5cfe2875, 0xf1620824,
+0x5c7f287d, 0xf2620824, 0x5c47285d, 0x21b80824,
+0x62000006, 0xfe2865f1, 0x55f362f3, 0x00de1f28,
+0xd393f8c5, 0x850fc2fe, 0x0000030a, 0x2865f262,
+0x08245c45, 0x000626b8, 0x65f36200, 0x00e41f28,
+0xd493f8c5, 0x850fc2fe, 0x000002ea, 0x286df262,
+0x06245c3b, 0x286df262, 0x0624643f, 0x286df162,
+0x062454fe, 0x2865f162, 0x34b8dcfe, 0x62000006,
+0x1f2865f3, 0xf8c500ea, 0xc2fed593, 0x02b4850f,
+0xf1620000, 0x7c6f287d, 0xf1620524, 0x546f287d,
+0xf3620624, 0xdf432845, 0x7df16201, 0x1bdb7028,
+0x2865f362, 0xc500f21f, 0xfed693f8, 0x064eb8c2,
+0x850f0000, 0x0000027e, 0x286df162, 0xf162e1fe,
+0x5c6f287d, 0x53b80524, 0x62000006, 0x36285df2,
+0x5df362e3, 0x00fa1f28, 0xd793f8c5, 0x850fc2fe,
+0x00000252, 0x302444c7, 0x00000009, 0x286df162,
+0x5db8e3fe, 0x62000006, 0x58287df2, 0x620c246c,
+0x1f2855f3, 0xf8c500c4, 0xc2fed093, 0x0224850f,
+0x09b80000, 0x62000000, 0x7c287df2, 0x55f362e8,
+0x00cc1f28, 0xd193f8c5, 0x61b8c2fe, 0x0f000006,
+0x00020185, 0x7df36200, 0x245c3928, 0xf2620003,
+0x645a287d, 0xf3620324, 0x5c382865, 0x62010324,
+0x1f285df3, 0xf8c500d3, 0xc0fec293, 0x00066cb8,
+0xcf850f00, 0x62000001, 0x6f287df1, 0x6209245c,
+0x6f287df1, 0x65f262e2, 0x24647e28, 0x7df16205,
+0x24746f28, 0x4df2620a, 0x24547e28, 0x2444c705,
+0x00000430, 0x75f16200, 0x62cafe28, 0x25286df3,
+0x55072454, 0x2875f162, 0xa6b8ccfa, 0x62000006,
+0xef2875f1, 0x6207244c, 0xfa2875f1, 0x7df262ca,
+0x24545828, 0x75f3620c, 0x00da1f28, 0xd393f8c5,
+0x850fc2fe, 0x0000015e, 0x086df162, 0xf162d2ef,
+0x4c6f287d, 0xf2620524, 0xca7e2865, 0x2875f262,
+0xf162da76, 0x4c7f287d, 0xf1620324, 0x5c7f287d,
+0xf1620424, 0x7c6f287d, 0xf3620524, 0x7c39287d,
+0x62000324, 0x35287df2, 0x62032454, 0x1f286df3,
+0xf8c500e1, 0xc2fed493, 0x0006d3b8, 0x03850f00,
+0x62000001, 0x6f287df1, 0x6205244c, 0x39287df3,
+0x0003244c, 0x087df162, 0x03246c6f, 0x087df162,
+0x02246c7f, 0x287df262, 0x02245435, 0x287df162,
+0x0224547f, 0x287df162, 0x0224746f, 0x287ef262,
+0x03247435, 0xbc8bc031, 0x0000a084, 0x847c3900,
+0xb80a7430, 0x000006f1, 0x0000a9e9, 0xf8834000,
+0x8be37504, 0x00c42484, 0xf1620000, 0x4c7f287d,
+0x44890324, 0x848b6424, 0x0000cc24, 0x24448900,
+0x24848b6c, 0x000000d4, 0x74244489, 0xdc24848b,
+0x89000000, 0xb07c2444, 0x7df162aa, 0x244c6f28,
+0x92f8c505, 0x75f262c8, 0x24546429, 0x6df36206,
+0x246c1f28, 0xf8c50003, 0xc2fed593, 0x00073ab8,
+0x62437500, 0x032875f3, 0x07b801d9, 0xba000000,
+0x00000000, 0x287df262, 0x01b8d07c, 0x62000000,
+0xdb2875f1, 0x7df262ca, 0x62d07c28, 0xfe2875f1,
+0x65f362ca, 0x00f11f28, 0xc693f8c5, 0x4ab8c0fe,
+0x0f000007, 0x658dc244, 0x5f5e5bf4, 0x0000c35d,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000008, 0x0000000e, 0x00000012, 0x00000014,
+0x00000014, 0x00000012, 0x0000000e, 0x00000008,
+0003140,
+};
+asm(".type avx512f_x86_32_D_32u4, STT_NOTYPE;");
+asm(".type avx512f_x86_32_D_32u4, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512f_x86_32_D_32i8[] = {
+0x895500eb, 0xff3157e5, 0x0001be56, 0xbb530000,
+0x00000040, 0x81e0e483, 0x0001c0ec, 0xff468d00,
+0x4489d231, 0x05b86024, 0x89000000, 0x2444c7f1,
+0xffffff40, 0x89f029ff, 0x8b202444, 0x19602444,
+0x245489fa, 0x2444c724, 0xffffff44, 0x01e083ff,
+0x0e75c289, 0x402444c7, 0x00000001, 0x4489c031,
+0x4c854424, 0x01756024, 0xccb4894b, 0x000000f8,
+0x3102e2c1, 0xcc8489c0, 0x0000015c, 0x6024448b,
+0x08fef162, 0x0424747e, 0xfcccbc89, 0x62000000,
+0x7e08fef1, 0x6208247c, 0xd608fdf1, 0x8923cc74,
+0x0158cc9c, 0xf1620000, 0x7cd608fd, 0xe8d127cc,
+0xd231d009, 0x78cc8489, 0x83000001, 0x948902c0,
+0x00017ccc, 0x00d28300, 0x8901c683, 0x0198cc84,
+0xf0890000, 0x8900d783, 0x019ccc94, 0xf0830000,
+0x0ff80905, 0xffff3485, 0xfdf162ff, 0x24746f28,
+0xfdf16208, 0x24747f28, 0xfdf16205, 0x245c6f28,
+0xe5f36205, 0x00c61f28, 0xd093f8c5, 0xb80ffa80,
+0x00000539, 0x06e2850f, 0xf1620000, 0x4cd428e5,
+0xf1620824, 0x4c7f28fd, 0xf1620624, 0x747328ed,
+0x62010824, 0x6f28fdf1, 0xb806244c, 0x0000053f,
+0x28f5f362, 0xc500d21f, 0x80d293f8, 0x850f0ffa,
+0x000006a8, 0x28f5f162, 0x08244cfb, 0x28fdf162,
+0x07244c7f, 0x28e5f362, 0x07245c1f, 0x93f8c500,
+0x0ffa80d3, 0x000544b8, 0x7d850f00, 0x62000006,
+0x7328ddf1, 0x20082454, 0x28f5f162, 0x6220d373,
+0x6f28fdf1, 0x6209247c, 0xf428f5f1, 0x6208244c,
+0xf428e5f1, 0x62082454, 0xf428ddf1, 0xc5f162db,
+0x62e7f428, 0xd428f5f1, 0xf5f162cb, 0x20f17328,
+0x28edf162, 0xf162d1d4, 0x547328f5, 0x62200924,
+0xf428f5f1, 0xf5f162cf, 0x62c9d428, 0x7328f5f1,
+0xf16220f1, 0xe1d428dd, 0x28fdf162, 0x08247c6f,
+0x28c5f162, 0x09244cd4, 0x28c5f162, 0x092474fb,
+0x28edf162, 0x5bb8d4fb, 0x62000005, 0x7328d5f1,
+0xf16220d6, 0xd9f428cd, 0x28fdf162, 0x03246c7f,
+0x28d5f162, 0x6220d173, 0xf428f5f1, 0x6203244c,
+0xf428d5f1, 0xf5f162ee, 0x62cdd428, 0x7328f5f1,
+0xf16220f1, 0xd9d428e5, 0x28edf362, 0xc500e31f,
+0x80d493f8, 0x850f0ffa, 0x000005a0, 0x28ddf162,
+0x09245473, 0xe5f16220, 0x20d77328, 0x28e5f162,
+0x09244cf4, 0x28c5f162, 0x092454f4, 0x28ddf162,
+0xf162e7f4, 0xccd428f5, 0x28f5f162, 0x6220f173,
+0xd428edf1, 0xf5f362c9, 0x202d1f28, 0x00001008,
+0xd593f8c5, 0xb80ffa80, 0x000005c8, 0x054a850f,
+0xf1620000, 0x4c6f28fd, 0xf1620a24, 0xd17328d5,
+0xe5f16220, 0x62d1f428, 0xf428d5f1, 0xc5f162ef,
+0x62f1f428, 0xd428edf1, 0xfdf162d5, 0x24747f28,
+0xedf16203, 0x20f27328, 0x28edf162, 0xf162d6d4,
+0x547f28fd, 0xf1620724, 0x747328cd, 0x62030724,
+0x7f28fdf1, 0x62052474, 0x7328edf1, 0x02072474,
+0x28edf162, 0xedb8e2d4, 0x62000005, 0x1f28cdf3,
+0xf8c500f4, 0xfa80d693, 0xe5f1620f, 0x0ff1f428,
+0x0004c785, 0xe5f16200, 0x24647228, 0xf1620205,
+0xdbd428e5, 0x0005f2b8, 0xedf36200, 0x00fb1f28,
+0xd793f8c5, 0x0f0ffa80, 0x00049f85, 0x2484c700,
+0x00000094, 0x00000003, 0x28cdf162, 0xf162d5d4,
+0xf27328ed, 0xedf16220, 0x2454d428, 0x24848b03,
+0x00000094, 0x40244489, 0x891ff8c1, 0x62442444,
+0x7e08fef1, 0x6208245c, 0xf328edf1, 0x2484c7db,
+0x00000094, 0x00000002, 0x9424848b, 0x89000000,
+0xc1402444, 0x44891ff8, 0xf1624424, 0x647e08fe,
+0xf1620824, 0xd4f328ed, 0x28edf162, 0x05b8e2d4,
+0x62000006, 0x1f28e5f3, 0xf8c500c4, 0xfa80d093,
+0x15850f0f, 0x8b000004, 0x00942484, 0x44890000,
+0xf8c14024, 0x2444891f, 0xfef16244, 0x24647e08,
+0xe5f16208, 0x62dce228, 0xd428e5f1, 0x0609b8db,
+0xf3620000, 0xcb1f28ed, 0x93f8c500, 0x0ffa80d1,
+0x03d6850f, 0xf1620000, 0xddd428cd, 0x28fdf162,
+0x0b24746f, 0x28e5f162, 0x6220f373, 0xd428e5f1,
+0x62032454, 0xef08e5f1, 0x4de2c4db, 0xf162e337,
+0xe2db28dd, 0x28fdf162, 0x0724647f, 0x28ddf262,
+0x0b245c47, 0x28fdf162, 0x0b24746f, 0x38cdf162,
+0x084015fb, 0xf1620010, 0x547f28fd, 0xf2620b24,
+0x644728dd, 0x21b80b24, 0x62000006, 0x7f28fdf1,
+0x62062464, 0xd428ddf1, 0xe5f362e4, 0x00d41f28,
+0xd293f8c5, 0x0f0ffa80, 0x00034f85, 0xfdf16200,
+0x24746f28, 0xcdf26206, 0x24544628, 0x0626b80b,
+0xf3620000, 0x5c1f28ed, 0xc5000724, 0x80d393f8,
+0x850f0ffa, 0x00000324, 0x28edf162, 0x6220d773,
+0x7328d5f1, 0xf16220d1, 0x5c6f28fd, 0xf1620924,
+0x6c7f28fd, 0xf1620324, 0x547f28fd, 0xf1620224,
+0x6cf428c5, 0xf1620324, 0x54f428f5, 0xf1620224,
+0xd37328dd, 0xddf16220, 0x62e1f428, 0xf428c5f1,
+0xfdf162f1, 0x246c7f28, 0xedf16201, 0x62d5d428,
+0xf428e5f1, 0xfdf162e9, 0x242c7f28, 0x28e5f162,
+0x03246cf4, 0x28edf162, 0x6220f273, 0xd428cdf1,
+0xddf162d2, 0x62e5d428, 0x7328ddf1, 0xf16220f4,
+0x2cd428dd, 0xfdf16224, 0x246c7f28, 0xedf26206,
+0x24643d28, 0xedf26206, 0x24543928, 0xfdf16206,
+0x24547f28, 0xddf16206, 0x2464d428, 0x063db806,
+0xf1620000, 0xe9f428dd, 0x28edf162, 0x6220d473,
+0xf428ddf1, 0x62032464, 0xf428edf1, 0xedf162d1,
+0x62d4d428, 0x7328edf1, 0xf16220f2, 0xead428d5,
+0x28c5f162, 0xf362d3d4, 0xe21f28d5, 0x93f8c500,
+0xf5f162d4, 0x2454f428, 0x0ffa8002, 0x021a850f,
+0xf1620000, 0x54d428ed, 0xf1620124, 0xf27328ed,
+0xcdf16220, 0x62d2d428, 0x7f28fdf1, 0x62052454,
+0x1f28fdf2, 0x62052454, 0x1f28edf3, 0xf8c500ef,
+0xfa80d593, 0x0644b80f, 0x850f0000, 0x000001dc,
+0x28fdf162, 0x08247c6f, 0x28c5f362, 0x6201d743,
+0x70287df1, 0xf3624ed2, 0xf31f28ed, 0x93f8c500,
+0x0ffa80d6, 0x00064eb8, 0xad850f00, 0x62000001,
+0x5928fdf2, 0x10084015, 0xe5f16200, 0xb8e2fb28,
+0x00000653, 0x28ddf262, 0x08246436, 0x28ddf362,
+0xc500fb1f, 0x80d793f8, 0x850f0ffa, 0x0000017c,
+0x28fdf362, 0x08246400, 0xddf3621b, 0x00c31f28,
+0xd093f8c5, 0xb80ffa80, 0x00000658, 0x015a850f,
+0xf1620000, 0x7c6f28fd, 0x84c70824, 0x00009824,
+0x00000500, 0x89d23100, 0x009c2494, 0xf1620000,
+0xe3d428c5, 0x00065db8, 0xfdf26200, 0x246c5928,
+0xd5f36213, 0x00cc1f28, 0xd193f8c5, 0x0f0ffa80,
+0x00011785, 0xfdf16200, 0x24646f28, 0xe5f2620c,
+0x24647628, 0xfdf16208, 0x247c6f28, 0xc5f2620d,
+0x245c7e28, 0x2484c708, 0x00000098, 0x00000002,
+0x28ddf162, 0xc031e3fb, 0x28ddf162, 0x03247cf4,
+0x28e5f162, 0x8920d473, 0x009c2484, 0xf1620000,
+0xe9f428dd, 0x28e5f162, 0xa6b8c9f4, 0x62000006,
+0xd428f5f1, 0xf5f162cf, 0x20f17328, 0x28d5f162,
+0xf262e9d4, 0x4c5928fd, 0xf3621324, 0xd11f28d5,
+0x93f8c500, 0x0ffa80d2, 0x008e850f, 0xf1620000,
+0x4c7e08fe, 0xf1622524, 0x746f28fd, 0xf1620824,
+0x747f28fd, 0xf1620624, 0x4cd608fd, 0xf1621924,
+0x4c7e08fe, 0xf1622724, 0x4cd608fd, 0xaab01b24,
+0x28fdf162, 0x08244c6f, 0xc892f8c5, 0x29f5f262,
+0x09245c64, 0x28e5f362, 0x06245c1f, 0x93f8c500,
+0x0ffa80d3, 0x00073ab8, 0x62317500, 0x0328f5f3,
+0xf16201d9, 0x0ddb38f5, 0x00100848, 0x28f5f162,
+0x00bacad4, 0x62000000, 0x1f28e5f3, 0xf8c500e1,
+0x0f3cc493, 0x00074ab8, 0xc2440f00, 0x5bf4658d,
+0xc35d5f5e, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000004, 0x00000000, 0x00000006, 0x00000000,
+0x00000006, 0x00000000, 0x00000004, 0x00000000,
+0x00000001, 0x00000000, 0x00000003, 0x00000000,
+0004120,
+};
+asm(".type avx512f_x86_32_D_32i8, STT_NOTYPE;");
+asm(".type avx512f_x86_32_D_32i8, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512f_x86_32_D_32u8[] = {
+0x895500eb, 0xff3157e5, 0x0001be56, 0xbb530000,
+0x00000040, 0x81e0e483, 0x000160ec, 0xff468d00,
+0x4489d231, 0x05b82c24, 0x89000000, 0x89f029f1,
+0x8b202444, 0x192c2444, 0x245489fa, 0x01e08324,
+0x28244489, 0x24448948, 0x7485991c, 0x01752c24,
+0x7df1624b, 0xc4f86e08, 0xfa2241e3, 0xccb48901,
+0x00000098, 0x9cccbc89, 0x31000000, 0x24548bc0,
+0xcc848928, 0x000000fc, 0x2c24448b, 0x08fef162,
+0x0424747e, 0xf8cc9c89, 0x62000000, 0xd608fdf1,
+0x6217cc74, 0xd608fdf1, 0xc11bcc7c, 0xe8d102e2,
+0xd231d009, 0x18cc8489, 0x83000001, 0x948902c0,
+0x00011ccc, 0x00d28300, 0x8901c683, 0x0138cc84,
+0xf0890000, 0x8900d783, 0x013ccc94, 0xf0830000,
+0x0ff80905, 0xffff4485, 0xfdf162ff, 0x246c6f28,
+0xfdf16205, 0x246c7f28, 0xfdf16202, 0x24546f28,
+0xedf36202, 0x00c51f28, 0xd093f8c5, 0xb80ffa80,
+0x00000539, 0x047e850f, 0xf1620000, 0x4cd428ed,
+0xf1620524, 0x4c7f28fd, 0xf1620324, 0x747328e5,
+0x62010524, 0x6f28fdf1, 0xb803244c, 0x0000053f,
+0x28f5f362, 0xc500d31f, 0x80d293f8, 0x850f0ffa,
+0x00000444, 0x28f5f162, 0x05244cfb, 0x28fdf162,
+0x04244c7f, 0x28fdf162, 0x04245c6f, 0x28edf362,
+0xc500db1f, 0x80d393f8, 0x44b80ffa, 0x0f000005,
+0x00041385, 0xedf16200, 0x2454eb28, 0xfdf16206,
+0x24547f28, 0xf5f16202, 0x244cdb28, 0xe5f16206,
+0x245cef28, 0xf5f16206, 0x244cdf28, 0xf5f36202,
+0x00e31f28, 0xd493f8c5, 0xb80ffa80, 0x00000550,
+0x03d2850f, 0xf1620000, 0x546f28fd, 0xf1620524,
+0x547328dd, 0x62200624, 0x7328f5f1, 0xf16220d2,
+0x4cf428f5, 0xf1620624, 0x5cf428ed, 0xf1620624,
+0xe2f428dd, 0x28f5f162, 0xf162ccd4, 0xf17328f5,
+0xe5f16220, 0x62c9d428, 0x1f28f5f3, 0x1005a02d,
+0xf8c50000, 0xfa80d593, 0x05c8b80f, 0x850f0000,
+0x00000374, 0x28fdf162, 0x0424547f, 0x28f5f162,
+0x04247473, 0xfdf16203, 0x244c7f28, 0xe5f16202,
+0x24747328, 0xf1620204, 0xe3d428e5, 0x0005edb8,
+0xf5f36200, 0x00f41f28, 0xd693f8c5, 0x0f0ffa80,
+0x00033385, 0xf5f16200, 0x24547328, 0xf1620202,
+0xc9d428f5, 0x0005f2b8, 0xe5f36200, 0x00f91f28,
+0xd793f8c5, 0x0f0ffa80, 0x00030b85, 0x2444c700,
+0x00000334, 0x7df16200, 0x244c6e08, 0xedf1620d,
+0xc7c9f328, 0x02342444, 0x62000000, 0x6e087df1,
+0x620d245c, 0xf328edf1, 0xe5f162db, 0xb8e3d428,
+0x00000605, 0x28f5f362, 0xc500c41f, 0x80d093f8,
+0x850f0ffa, 0x000002c0, 0x087df162, 0x0d24646e,
+0x28f5f162, 0xf162ccd3, 0xc9d428f5, 0x000609b8,
+0xe5f36200, 0x00c91f28, 0xd193f8c5, 0x0f0ffa80,
+0x00029385, 0x76f5c500, 0xfdf162c9, 0x62da6f28,
+0xef08ddf1, 0x5de2c4e4, 0x0024a429, 0x62000001,
+0x2528f5f3, 0xf16240dc, 0x5c7f28fd, 0xf2620424,
+0x644728e5, 0xf1620824, 0x6cd428f5, 0xf1620824,
+0x6c7f28fd, 0xf2620824, 0x5c4728e5, 0x21b80824,
+0x62000006, 0x7f28fdf1, 0x6203245c, 0xd428e5f1,
+0xddf362db, 0x00d31f28, 0xd293f8c5, 0x0f0ffa80,
+0x00022385, 0xfdf16200, 0x24746f28, 0xcdf26203,
+0x245c4528, 0x0626b808, 0xf3620000, 0x5c1f28e5,
+0xc5000424, 0x80d393f8, 0x850f0ffa, 0x000001f8,
+0x28edf262, 0x06245c3b, 0x28edf262, 0x0624643f,
+0x28edf162, 0x062454d4, 0x28e5f162, 0x34b8dcd4,
+0x62000006, 0x1f28e5f3, 0xf8c500e2, 0xfa80d493,
+0xc1850f0f, 0x62000001, 0x6f28fdf1, 0x6205247c,
+0x6f28fdf1, 0x6206245c, 0x4328c5f3, 0xf16201d7,
+0xd270287d, 0xedf3624e, 0x00eb1f28, 0xd593f8c5,
+0xb80ffa80, 0x0000064e, 0x018a850f, 0xf1620000,
+0xd1d428e5, 0x000653b8, 0xedf26200, 0x24543628,
+0xedf36205, 0x00f31f28, 0xd693f8c5, 0x0f0ffa80,
+0x00016385, 0xfdf36200, 0x24540028, 0xf3621b05,
+0xfb1f28ed, 0x93f8c500, 0x0ffa80d7, 0x000658b8,
+0x41850f00, 0x62000001, 0x6f28fdf1, 0xc705246c,
+0x05382444, 0x31000000, 0x245489d2, 0xd5f1623c,
+0xb8d3d428, 0x0000065d, 0x28fdf262, 0x07246459,
+0x28ddf362, 0xc500c21f, 0x80d093f8, 0x850f0ffa,
+0x00000104, 0x28fdf162, 0x0924546f, 0x28e5f262,
+0x05245476, 0x28fdf162, 0x0a24746f, 0x28cdf262,
+0x05245c7e, 0x382444c7, 0x00000002, 0x28f5f162,
+0xc031cbd4, 0x3c244489, 0x28f5f162, 0xf362cafb,
+0x542528ed, 0x62550724, 0xef28f5f1, 0x6207244c,
+0xfb28f5f1, 0x06a6b8ca, 0xf2620000, 0x545928fd,
+0xf3620724, 0xca1f28f5, 0x93f8c500, 0x0ffa80d1,
+0x0092850f, 0xf1620000, 0x4c7e08fe, 0xf1621924,
+0x7c6f28fd, 0xf1620524, 0x7c7f28fd, 0xf1620324,
+0x4cd608fd, 0xf1620d24, 0x4c7e08fe, 0xf1621b24,
+0x4cd608fd, 0xaab00f24, 0x28fdf162, 0x05244c6f,
+0xc892f8c5, 0x29f5f262, 0x06245464, 0x28edf362,
+0x0324541f, 0x93f8c500, 0x0ffa80d2, 0x00073ab8,
+0x62357500, 0x0328f5f3, 0xf16201d1, 0x0ddb38f5,
+0x001005c0, 0x38f5f162, 0x05c80dd4, 0x00ba0010,
+0x62000000, 0x1f28edf3, 0xf8c500d9, 0x0f3cc393,
+0x00074ab8, 0xc2440f00, 0x5bf4658d, 0xc35d5f5e,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000004, 0x00000000, 0x00000006, 0x00000000,
+0x00000006, 0x00000000, 0x00000004, 0x00000000,
+0x00000003, 0x00000000, 0x00000001, 0x00000000,
+0002720,
+};
+asm(".type avx512f_x86_32_D_32u8, STT_NOTYPE;");
+asm(".type avx512f_x86_32_D_32u8, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512f_x86_32_D_32f4[] = {
+0x0002a6e9, 0xc0315500, 0xe483e589, 0x83e8d9e0,
+0x09b980c4, 0xd9000000, 0x401c2454, 0x4489ca89,
+0xc2290c24, 0xdb08f883, 0x890c2444, 0xd90c2454,
+0xdb1c845c, 0xd90c2444, 0xd93c845c, 0x755c8454,
+0x62d8ddda, 0x28287cf1, 0x62012454, 0x28287cf1,
+0x6202244c, 0x58386cf1, 0x100aa025, 0x5cf16200,
+0x62e15928, 0x28287cf1, 0x75f262d9, 0x245c9828,
+0x5cf16201, 0x04c3c228, 0xd093f8c5, 0xa7b8d284,
+0x0f000000, 0x00022085, 0x7df26200, 0x801d1828,
+0x6200100a, 0x28287cf1, 0x57dcc5e9, 0x75f262e3,
+0x246c9e28, 0x5cf16201, 0x04cdc228, 0xd193f8c5,
+0xabb8d284, 0x0f000000, 0x0001ec85, 0x6cf16200,
+0x84155838, 0x6200100a, 0x59286cf1, 0x7cf162d1,
+0x62e12828, 0x9a2875f2, 0x62012464, 0xc2286cf1,
+0xf8c504d4, 0xd284d293, 0x0000afb8, 0xb6850f00,
+0x62000001, 0x28287cf1, 0x57ecc5e1, 0x75f262d3,
+0x24649c28, 0x6cf16201, 0x04dcc228, 0xd393f8c5,
+0xb3b8d284, 0x0f000000, 0x00018c85, 0x7cf16200,
+0x24542828, 0x6cf16201, 0x62e15828, 0x18287df2,
+0x6207246c, 0x28287cf1, 0x62022474, 0x98284df2,
+0x5cf162ea, 0x04e5c228, 0xd493f8c5, 0xbbb8d284,
+0x0f000000, 0x00015085, 0x7cf16200, 0x62ea2828,
+0x28287cf1, 0xc5022474, 0x62e357dc, 0x9e384df2,
+0x6207246c, 0xc2285cf1, 0xf8c504ed, 0xd284d593,
+0x0000c0b8, 0x1e850f00, 0x62000001, 0x5c286cf1,
+0x7df262c9, 0x24641828, 0x7cf16207, 0x247c2828,
+0x45f26202, 0x62e29a28, 0xc22874f1, 0xf8c504f4,
+0xd284d693, 0x0000c5b8, 0xea850f00, 0x62000000,
+0x28287cf1, 0x7cf162e2, 0x24742828, 0x57f4c502,
+0x4df262cb, 0x24649c38, 0x74f16207, 0x04fcc228,
+0xd793f8c5, 0xcab8d284, 0x0f000000, 0x0000b885,
+0x7cf16200, 0x244c2828, 0x6cf16203, 0x246c5928,
+0xd0d7c502, 0x7cf162f1, 0x24642828, 0x7cf16202,
+0x62fa2828, 0xa6285df2, 0x6203247c, 0xc2284cf1,
+0xf8c504c7, 0xd284d093, 0x0000d4b8, 0xc57a7500,
+0xc5cb57f4, 0x62e9d0d7, 0xa7286df2, 0x62032464,
+0xc22854f1, 0xf8c504cc, 0xd284d193, 0x0000d8b8,
+0x62567500, 0x59286cf1, 0xc502244c, 0x244cd0f7,
+0x7cf16260, 0x245c2828, 0x7cf16203, 0x62e22828,
+0x962865f2, 0x62022464, 0xc22874f1, 0xf8c504d4,
+0xd284d293, 0x0000deb8, 0x621e7500, 0x972865f2,
+0x62022454, 0xc22854f1, 0xf8c504da, 0xd284d393,
+0x0000e2b8, 0x31027500, 0x55c3c9c0, 0xe589c031,
+0xe0e48353, 0x0140ec81, 0xc1890000, 0x24448940,
+0x0009ba14, 0x44db0000, 0xc2291424, 0x14245489,
+0xe283ca89, 0x849cd901, 0x0000009c, 0x142444db,
+0xbc849cd9, 0xd9000000, 0xd9e0d9e8, 0xddc9dbe8,
+0x03e2c1d9, 0x9cd9e9d1, 0x0000dc84, 0x89ca0900,
+0x00fc8494, 0xc2830000, 0x08f88304, 0x1c849489,
+0x75000001, 0x7cf162a5, 0x24742828, 0x7cf16205,
+0x24742928, 0x7cf16202, 0x244c2828, 0x74f16202,
+0x04c6c228, 0xd093f8c5, 0x39b8d284, 0x0f000005,
+0x00072e85, 0x74f16200, 0x24545828, 0x7cf16205,
+0x24542928, 0x7cf16203, 0x24542828, 0x7cf16203,
+0x247c2828, 0x44f16205, 0x62df5828, 0xc2286cf1,
+0xf8c504d3, 0xd284d293, 0x00053fb8, 0xf0850f00,
+0x62000006, 0x5c286cf1, 0x62052454, 0x29287cf1,
+0x62042454, 0xc22874f1, 0x0404245c, 0xd393f8c5,
+0x44b8d284, 0x0f000005, 0x0006c685, 0x7cf16200,
+0x24742828, 0x74f16206, 0x244c5928, 0x4cf16205,
+0x62de5928, 0x28287cf1, 0x62052454, 0x58286cf1,
+0x6cf162ee, 0x24645c28, 0x74f16206, 0x62cb5c28,
+0x59285cf1, 0x74f162e5, 0x04e4c228, 0xd493f8c5,
+0x5bb8d284, 0x0f000005, 0x00067685, 0x6cf16200,
+0x244c5928, 0x7cf16207, 0x244c2928, 0x6cf16202,
+0x24545e28, 0x74f16207, 0x04eac228, 0xd593f8c5,
+0x64b8d284, 0x0f000005, 0x00064685, 0x7df26200,
+0x800d1828, 0x6200100a, 0x28287cf1, 0xc507245c,
+0xc5d157e4, 0x248c57f4, 0x000000a0, 0x286cf162,
+0x02245459, 0x286cf162, 0xc504f1c2, 0x84d693f8,
+0x0567b8d2, 0x850f0000, 0x00000607, 0x287df162,
+0x05244c5b, 0x287cf162, 0xf162c95b, 0x7cc22874,
+0xc5040524, 0x84d793f8, 0x056eb8d2, 0x850f0000,
+0x000005df, 0x287df262, 0x05244c4c, 0x287cf162,
+0x02244c29, 0x287cf162, 0x05246428, 0x287df262,
+0x02244c4c, 0x287df162, 0xf162c95b, 0xc95b287c,
+0x2874f162, 0xc504c4c2, 0x84d093f8, 0x0575b8d2,
+0x850f0000, 0x0000059b, 0x285cf162, 0xf162cc59,
+0x4c29287c, 0xf2620224, 0x4c4e287d, 0xf1620224,
+0x4c29287c, 0xf1620324, 0x4c28287c, 0xf2620324,
+0xd14c287d, 0x287df162, 0xf162d25b, 0xd25b287c,
+0x286cf162, 0xc504d4c2, 0x84d293f8, 0x057cb8d2,
+0x850f0000, 0x0000054b, 0x287df262, 0x0524544c,
+0x287df162, 0xf162c95b, 0xd25b287d, 0x287cf162,
+0xf162c95b, 0xd25b287c, 0x2874f162, 0xc504dac2,
+0x84d393f8, 0x057eb8d2, 0x850f0000, 0x00000513,
+0x287cf162, 0x05245479, 0x287ff162, 0xf162d27a,
+0x4c28287c, 0xf1620524, 0xe1c2286c, 0x93f8c504,
+0xb8d284d4, 0x0000058f, 0x04e5850f, 0xf1620000,
+0xd1592874, 0x287cf162, 0x02245429, 0x287cf162,
+0x02245451, 0x286cf162, 0xc504e9c2, 0x84d593f8,
+0x059cb8d2, 0x850f0000, 0x000004b7, 0x287df262,
+0x0aa01518, 0xf1620010, 0xe15e286c, 0x287cf162,
+0x02246429, 0x287df362, 0x02246c08, 0x7cf1620b,
+0xa0252828, 0xb800100a, 0x000005a4, 0x285cf162,
+0xc504f5c2, 0x84d693f8, 0x74850fd2, 0x62000004,
+0x592864f1, 0x64f162e1, 0x245c5928, 0x7cf16206,
+0x245c2928, 0x5cf16203, 0x245c5f28, 0x5cf16203,
+0x24645d28, 0x7cf16203, 0x24642928, 0x64f16203,
+0x245c5828, 0x74f16203, 0x244c5828, 0x64f16206,
+0x245c5928, 0x64f16207, 0x04f9c228, 0xd793f8c5,
+0x3db8d284, 0x0f000006, 0x00041685, 0x7cf16200,
+0x247c2828, 0x7cf16205, 0x245c2828, 0x45f36206,
+0x01cf2328, 0x2874f162, 0x621bc9c6, 0xc22874f1,
+0xf8c504cb, 0xd284d193, 0x00064eb8, 0xe0850f00,
+0x62000003, 0x28287cf1, 0x6205244c, 0x232875f3,
+0xf36201e1, 0xe404287d, 0x5cf1621b, 0x04c3c228,
+0xd093f8c5, 0x53b8d284, 0x0f000006, 0x0003b285,
+0x2444c700, 0x10000030, 0x64f16241, 0xb8e95828,
+0x0000065d, 0x287df262, 0x0c246418, 0x285cf162,
+0xc504d5c2, 0x84d293f8, 0x84850fd2, 0x62000003,
+0x19287df3, 0x0003244c, 0x287df262, 0x0324641a,
+0x2875f362, 0x03244c18, 0x5cf16201, 0x04d9c228,
+0xc393f8c5, 0x0a74c084, 0x00066cb8, 0x0351e900,
+0xf1620000, 0x4c28287c, 0xf2620824, 0x4c772865,
+0xf1620524, 0x746f287d, 0xf2620924, 0x5c7f284d,
+0xf1620524, 0x5c29287c, 0xf1620324, 0xcb5c2874,
+0x302444c7, 0x40800000, 0x2874f162, 0x07244c59,
+0x287df262, 0x0c245c18, 0x2874f162, 0xc504e3c2,
+0x84d493f8, 0x06a6b8d2, 0xf1620000, 0x4c29287c,
+0x850f0424, 0x000002eb, 0x287cf162, 0x05247c28,
+0x287df362, 0x03247c19, 0x7cf16200, 0x246c2808,
+0x7cf16203, 0x246c2908, 0x7cf16202, 0x244c5a28,
+0xfdf16202, 0x244c2928, 0xfdf16202, 0x244c5a28,
+0x7cf16202, 0x244c2908, 0xd9c03103, 0x00a08484,
+0x44d90000, 0xe9df3084, 0x027ad8dd, 0xf1b80a74,
+0xe9000006, 0x0000028b, 0x04f88340, 0xf162dd75,
+0x6412287e, 0xf2620524, 0x0d18287d, 0x00100a84,
+0x285cf162, 0x0524645c, 0x2874f162, 0x07244c58,
+0x287df262, 0x0a881d18, 0xf1620010, 0xcb592874,
+0x285cf162, 0xc504e9c2, 0x84d593f8, 0x0717b8d2,
+0x850f0000, 0x0000023b, 0x287ef162, 0x05244c16,
+0x287cf162, 0x05246428, 0x286cf162, 0x07245458,
+0x2874f162, 0xf162cc5c, 0xd359286c, 0x2874f162,
+0xc504f2c2, 0x84d693f8, 0x071eb8d2, 0x850f0000,
+0x000001ff, 0xc42484d9, 0x62000000, 0x29287cf1,
+0xd9032464, 0xd964245c, 0x00cc2484, 0x5cd90000,
+0x84d96c24, 0x0000d424, 0x245cd900, 0x2484d974,
+0x000000dc, 0x7c245cd9, 0xf162aab0, 0x7428287c,
+0xf8c50524, 0xf262c892, 0x4c65294d, 0xf1620624,
+0x7cc22874, 0xc5040324, 0x84d793f8, 0x073ab8d2,
+0x850f0000, 0x0000019b, 0x287cf162, 0x05247c28,
+0x8cd0c7c5, 0x0000c024, 0x7cf16200, 0x24542828,
+0x6cf16205, 0x245c5c28, 0x6cf16206, 0x245c5829,
+0x74f16206, 0x04cbc228, 0xd193f8c5, 0x43b8d284,
+0x0f000007, 0x00015a85, 0x0003bb00, 0xf1620000,
+0x5429287c, 0xf1620224, 0x1d6f287d, 0x00100ac0,
+0xd257e8c5, 0x7cefc54b, 0x6240244c, 0x162865f2,
+0x7cf162c9, 0x244c2928, 0x62e97502, 0x032875f3,
+0x05d907e9, 0x00100a8c, 0x087ef162, 0x05246c11,
+0x142444d9, 0xd8dde9df, 0x00f28a0f, 0x850f0000,
+0x000000ec, 0x287cf162, 0x05247428, 0x8c7dcfc5,
+0x0000c024, 0x65f26200, 0xc5c91628, 0x62ca7cf7,
+0x162865f2, 0x7cf7c5c9, 0x65f262ca, 0xc5c91628,
+0x62ca7cf7, 0x162865f2, 0x74f162c9, 0x04c2c228,
+0xd093f8c5, 0x67b8d284, 0x0f000007, 0x0000b285,
+0x7df36200, 0x244c2628, 0xf1620005, 0x4c29287c,
+0xf2620224, 0x4c42287d, 0xf1620524, 0x4c29287c,
+0xd2310324, 0x087df162, 0xf162cb6e, 0x4cd608fd,
+0x6cdf0324, 0x44d91824, 0xe9df6094, 0x677ad8dd,
+0x428d6575, 0x024a8d01, 0xf983c121, 0x00d38301,
+0x0e75d085, 0x44d9e8d9, 0xe9df3c84, 0x4e7ad8dd,
+0xf8834c75, 0x89047408, 0x62b9ebc2, 0x28287cf1,
+0x6202247c, 0x2c2845f2, 0x6203244c, 0x28287cf1,
+0xb805246c, 0x0000077d, 0x2854f162, 0xc504d1c2,
+0x84d293f8, 0xe81c75d2, 0xfffff5a9, 0x13ebd8f7,
+0x00075eb8, 0xb80ceb00, 0x00000773, 0x78b805eb,
+0x8b000007, 0xc3c9fc5d, 0x00000000, 0x00000000,
+0x80000000, 0xbf800000, 0x3f000000, 0x42100000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x3f800000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000001, 0x00000004, 0x00000005,
+0x00000002, 0x00000003, 0x00000006, 0x00000007,
+0005340,
+};
+asm(".type avx512f_x86_32_D_32f4, STT_NOTYPE;");
+asm(".type avx512f_x86_32_D_32f4, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512f_x86_32_D_32f8[] = {
+0x0002c5e9, 0xe8d95500, 0xe483e589, 0x80c483e0,
+0x182454dd, 0x202454dd, 0x0a8005d9, 0x54dd0010,
+0xc9d94024, 0x602454dd, 0x0a8405d9, 0x54dd0010,
+0x05d92824, 0x00100a88, 0x482454dd, 0x54ddcad9,
+0xcad96824, 0x30245cdd, 0x50245cdd, 0x702454dd,
+0x5cddc9d9, 0x54dd3824, 0x5cdd5824, 0xf1627824,
+0x152828fd, 0x00100aa0, 0x28fdf162, 0x02244c28,
+0x28fdf162, 0xf262d928, 0x5c9828f5, 0xf1620124,
+0xc3c228ed, 0x93f8c500, 0x0ffa80d0, 0x0000a7b8,
+0x31850f00, 0x62000002, 0x2828fdf1, 0x100ac015,
+0xfdf16200, 0x62d92828, 0x9e28f5f2, 0x6201245c,
+0xc228edf1, 0xf8c500cb, 0xfa80d193, 0x00abb80f,
+0x850f0000, 0x00000200, 0x28fdf162, 0x0ae01528,
+0xf1620010, 0xd92828fd, 0x28f5f262, 0x01245c9a,
+0x28edf162, 0xc500d3c2, 0x80d293f8, 0xafb80ffa,
+0x0f000000, 0x0001cf85, 0xfdf16200, 0x00152828,
+0x6200100b, 0x2828fdf1, 0xf5f262d9, 0x245c9c28,
+0xedf16201, 0x00dbc228, 0xd393f8c5, 0xb80ffa80,
+0x000000b3, 0x019e850f, 0xf1620000, 0x542828fd,
+0xf1620124, 0xd95828ed, 0x28fdf262, 0x03246419,
+0x28fdf162, 0x02247428, 0x28cdf262, 0xf162e298,
+0xe4c228e5, 0x93f8c500, 0x0ffa80d4, 0x0000bbb8,
+0x61850f00, 0x62000001, 0x1928fdf2, 0x100b0025,
+0xfdf16200, 0x62ea2828, 0x2828fdf1, 0xc5022474,
+0x62dc57e5, 0x9e38cdf2, 0x6203246c, 0xc228e5f1,
+0xf8c500ed, 0xfa80d593, 0x00c0b80f, 0x850f0000,
+0x00000124, 0x28edf162, 0xf262c95c, 0x5c1928fd,
+0xf1620324, 0x7c2828fd, 0xf2620224, 0xda9a28c5,
+0x28f5f162, 0xc500f3c2, 0x80d693f8, 0xc5b80ffa,
+0x0f000000, 0x0000ef85, 0xfdf16200, 0x62da2828,
+0x2828fdf1, 0xc5022474, 0x62cc57f5, 0x9c38cdf2,
+0x6203245c, 0xc228f5f1, 0xf8c500fb, 0xfa80d793,
+0x00cab80f, 0x850f0000, 0x000000bc, 0x28fdf162,
+0x03244c28, 0x28edf162, 0x02246c59, 0xf1d0d5c5,
+0x28fdf162, 0x02245c28, 0x28fdf162, 0xf262fa28,
+0x7ca628e5, 0xf1620324, 0xc7c228cd, 0x93f8c500,
+0x0ffa80d0, 0x0000d4b8, 0xc57d7500, 0xc5cc57f5,
+0x62e9d0d5, 0xa728edf2, 0x6203245c, 0xc228d5f1,
+0xf8c500cb, 0xfa80d193, 0x00d8b80f, 0x58750000,
+0x28edf162, 0x02244c59, 0x4cd0f5c5, 0xf1626024,
+0x5c2828fd, 0xf1620324, 0xe22828fd, 0x28e5f262,
+0x02246496, 0x28f5f162, 0xc500d4c2, 0x80d293f8,
+0xdeb80ffa, 0x75000000, 0xe5f2621f, 0x24549728,
+0xd5f16202, 0x00dac228, 0xd393f8c5, 0xb80ffa80,
+0x000000e2, 0xc0310275, 0xd955c3c9, 0x53e589e8,
+0x81e0e483, 0x0000e0ec, 0x2494dd00, 0x00000080,
+0x0a8005d9, 0x94dd0010, 0x0000a024, 0xddc9d900,
+0x00c02494, 0x05d90000, 0x00100a84, 0x882494dd,
+0xd9000000, 0x100a8805, 0x2494dd00, 0x000000a8,
+0xe0d9e8d9, 0xc82494dd, 0xd9000000, 0x249cddc9,
+0x00000090, 0x94ddc9d9, 0x0000b024, 0xddcad900,
+0x00d02494, 0xcbd90000, 0x98249cdd, 0xd9000000,
+0x249cddca, 0x000000b8, 0x9cddc9d9, 0x0000d824,
+0xfdf16200, 0x24742828, 0xfdf16204, 0x24742928,
+0xfdf16201, 0x244c2828, 0xf5f16201, 0x00c6c228,
+0xd093f8c5, 0xb80ffa80, 0x00000539, 0x06b0850f,
+0xf1620000, 0x545828f5, 0xf1620424, 0x542928fd,
+0xf1620224, 0x542828fd, 0xf1620224, 0x7c2828fd,
+0xf1620424, 0xdf5828c5, 0x28edf162, 0xc500d3c2,
+0x80d293f8, 0x3fb80ffa, 0x0f000005, 0x00067585,
+0xedf16200, 0x24545c28, 0xfdf16204, 0x24542928,
+0xf5f16203, 0x245cc228, 0xf8c50003, 0xfa80d393,
+0x0544b80f, 0x850f0000, 0x0000064e, 0x28fdf162,
+0x05246c28, 0x28f5f162, 0x04244c59, 0x28d5f162,
+0xf162dd59, 0x542828fd, 0xf1620424, 0xed5828ed,
+0x28edf162, 0x0524645c, 0x28f5f162, 0xf162cb5c,
+0xe55928dd, 0x28f5f162, 0xc500e4c2, 0x80d493f8,
+0x5bb80ffa, 0x0f000005, 0x00060185, 0xedf16200,
+0x244c5928, 0xfdf16206, 0x244c2928, 0xedf16201,
+0x24545e28, 0xf5f16206, 0x00eac228, 0xd593f8c5,
+0xb80ffa80, 0x00000564, 0x05d4850f, 0xf2620000,
+0x0d1928fd, 0x00100b00, 0x28fdf162, 0x06245428,
+0xd957edc5, 0x8c57f5c5, 0x00008024, 0xe5f16200,
+0x245c5928, 0xe5f16201, 0x00f1c228, 0xd693f8c5,
+0xb80ffa80, 0x00000567, 0x0598850f, 0xf1620000,
+0x4ce628ff, 0xf1620424, 0xc9e6287e, 0x28f5f162,
+0x04247cc2, 0x93f8c500, 0x0ffa80d7, 0x00056eb8,
+0x73850f00, 0x62000005, 0x4c28fdf2, 0x6204244c,
+0x2928fdf1, 0x6201244c, 0x2828fdf1, 0x62042464,
+0x4c28fdf2, 0x6201244c, 0xe628fff1, 0x7ef162c9,
+0x62c9e628, 0xc228f5f1, 0xf8c500c4, 0xfa80d093,
+0x0575b80f, 0x850f0000, 0x00000532, 0x28ddf162,
+0xf162cc59, 0x4c2928fd, 0xf2620124, 0x4c4e28fd,
+0xf1620124, 0x4c2928fd, 0xf1620224, 0x4c2828fd,
+0xf2620224, 0xd94c28fd, 0x28fff162, 0xf162dbe6,
+0xdbe6287e, 0x28e5f162, 0xc500ccc2, 0x80d193f8,
+0x7cb80ffa, 0x0f000005, 0x0004e585, 0xfdf26200,
+0x245c4c28, 0xfff16204, 0x62c9e628, 0xe628fff1,
+0x7ef162db, 0x62c9e628, 0xe6287ef1, 0xf5f162db,
+0x00d3c228, 0xd293f8c5, 0xb80ffa80, 0x0000057e,
+0x04b0850f, 0xf1620000, 0x5c7928fc, 0xf1620424,
+0xdb7a287e, 0x28fdf162, 0x04244c28, 0x28e5f162,
+0xc500d9c2, 0x80d393f8, 0x8fb80ffa, 0x0f000005,
+0x00048585, 0xf5f16200, 0x62d95928, 0x2928fdf1,
+0x6201245c, 0x5128fdf1, 0x6201245c, 0xc228e5f1,
+0xf8c500e1, 0xfa80d493, 0x059cb80f, 0x850f0000,
+0x0000045a, 0x28fdf262, 0x0b201d19, 0xf1620010,
+0xd95e28e5, 0x28fdf162, 0x01245c29, 0x28fdf362,
+0x01246409, 0xfdf1620b, 0x201d2828, 0xb800100b,
+0x000005a4, 0x28e5f162, 0xc500ecc2, 0x80d593f8,
+0x850f0ffa, 0x0000041a, 0x28edf162, 0xf162d959,
+0x545928ed, 0xf1620524, 0x542928fd, 0xf1620224,
+0x545f28e5, 0xf1620224, 0x5c5d28e5, 0xf1620224,
+0x5c2928fd, 0xf1620224, 0x545828ed, 0xf1620224,
+0x4c5828f5, 0xf1620524, 0x545928ed, 0xf1620624,
+0xf1c228ed, 0x93f8c500, 0x0ffa80d6, 0x00063db8,
+0xbf850f00, 0x62000003, 0x2828fdf1, 0x62042474,
+0x2828fdf1, 0x6205245c, 0x2328cdf3, 0xf16201ce,
+0xc9c628f5, 0xf5f16205, 0x00fbc228, 0xd793f8c5,
+0xb80ffa80, 0x0000064e, 0x038c850f, 0xf1620000,
+0x4c2828fd, 0xf3620424, 0xd12328f5, 0xfdf36201,
+0x05d20528, 0x28edf162, 0xc500c3c2, 0x80d093f8,
+0x53b80ffa, 0x0f000006, 0x00036185, 0x8c05d900,
+0x6200100a, 0x5828e5f1, 0x065db8c9, 0x5cdd0000,
+0xf2621824, 0x541928fd, 0xf1620324, 0xc9c228ed,
+0x93f8c500, 0x0ffa80d1, 0x0334850f, 0x04c70000,
+0x00000124, 0x62c03100, 0xef08f5f1, 0x244489c9,
+0x74f16204, 0x500d1608, 0x6200100b, 0x7e08fef1,
+0xf1622414, 0x1516086c, 0x00100b58, 0x2875f362,
+0x6201ca38, 0x6f28fdf1, 0xe5f262d1, 0x24547728,
+0x2404c704, 0x00000002, 0xc931d231, 0x04245489,
+0x08fef162, 0xc7240c7e, 0x00032404, 0xf1620000,
+0x0d160874, 0x00100b60, 0x04244c89, 0x08fef162,
+0x6224247e, 0x16085cf1, 0x100b6825, 0x75f36200,
+0x01cc3828, 0x28e5f262, 0x04244c77, 0x28edf162,
+0x5cddc95c, 0xf1621824, 0x4c5928f5, 0xf2620624,
+0x541928fd, 0xf1620324, 0xd2c228f5, 0x93f8c500,
+0x0ffa80d2, 0x0006a6b8, 0xfdf16200, 0x244c2928,
+0x6d850f03, 0x62000002, 0x1228fff1, 0x62042454,
+0x1928fdf2, 0x100b400d, 0xfdf16200, 0x245c2828,
+0xf5f16204, 0x244c5828, 0xedf16206, 0x62d35c28,
+0x5938f5f1, 0x100b480d, 0xedf16200, 0x00d9c228,
+0xd393f8c5, 0xb80ffa80, 0x00000717, 0x0222850f,
+0xf1620000, 0x5c2928fd, 0xf1620224, 0x7c1008ff,
+0xf1621524, 0x6c1008ff, 0xf1621724, 0x7c1108ff,
+0xf1620924, 0x6c1108ff, 0xaab00b24, 0x28fdf162,
+0x04247428, 0xc892f8c5, 0x29cdf262, 0x05244c65,
+0x28f5f162, 0x022464c2, 0x93f8c500, 0x0ffa80d4,
+0x00073ab8, 0xc9850f00, 0x62000001, 0x2828fdf1,
+0xc504247c, 0x248cd0c5, 0x000000a0, 0x28fdf162,
+0x04245428, 0x9cd0edc5, 0x0000a024, 0xf5f16200,
+0x00ebc228, 0xd593f8c5, 0xb80ffa80, 0x00000743,
+0x018e850f, 0xf1620000, 0x542928fd, 0xe9c50124,
+0xedc5d257, 0x20244c7c, 0x28fdf362, 0x62d8c901,
+0x2928fdf1, 0xc501244c, 0x244c7ced, 0xf5f36220,
+0x03e90328, 0x0a9005d9, 0xf1620010, 0x2c1108ff,
+0x2404dd24, 0xd8dde9df, 0x00ef8a0f, 0x850f0000,
+0x000000e9, 0x28fdf162, 0x04247428, 0x8c7dcdc5,
+0x0000a024, 0xfdf36200, 0xd8c90128, 0xca7cf5c5,
+0x28fdf362, 0xc5d8c901, 0x62ca7cf5, 0x0128fdf3,
+0xf162d8c9, 0xf2c228f5, 0x93f8c500, 0x0ffa80d6,
+0x000767b8, 0xf9850f00, 0x62000000, 0x2628fdf3,
+0x0004244c, 0x28fdf162, 0x01244c29, 0x28fdf262,
+0x04244c42, 0x28fdf162, 0x02244c29, 0xd231c931,
+0x087df162, 0xf162c96e, 0x4cd608fd, 0x6cdf0124,
+0x44dd0824, 0xe9df40d4, 0x687ad8dd, 0x428d6675,
+0x025a8d01, 0xfb83c321, 0x00d18301, 0x0e75d085,
+0x44dde8d9, 0xe9df18c4, 0x4f7ad8dd, 0xf8834d75,
+0x89047404, 0x62b9ebc2, 0x2828fdf1, 0x6201247c,
+0x2c28c5f2, 0x6202244c, 0x2828fdf1, 0xb804246c,
+0x0000077d, 0x28d5f162, 0xc500f9c2, 0x80d793f8,
+0x60750ffa, 0xfff5ece8, 0xebd8f7ff, 0x075eb857,
+0x50eb0000, 0x000773b8, 0xb849eb00, 0x00000778,
+0xd8dd42eb, 0xd8dd3eeb, 0xd8dd3aeb, 0xd8dd36eb,
+0xd8dd32eb, 0xd8dd2eeb, 0xd8dd2aeb, 0xd8dd26eb,
+0xd8dd22eb, 0xd8dd1eeb, 0xd8dd1aeb, 0xd8dd16eb,
+0xd8dd12eb, 0xd8dd0eeb, 0xd8dd0aeb, 0xd8dd06eb,
+0xd8dd02eb, 0xc9fc5d8b, 0x000000c3, 0x00000000,
+0x40800000, 0x40000000, 0x40400000, 0x40a00000,
+0x41200000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x40200000, 0x00000000, 0x40220000,
+0x00000000, 0x40200000, 0x00000000, 0x40140000,
+0x00000000, 0xc0200000, 0x00000000, 0xc0220000,
+0x00000000, 0xc0200000, 0x00000000, 0xc0140000,
+0x00000000, 0x00000000, 0x00000000, 0x40080000,
+0x00000000, 0x40100000, 0x00000000, 0x40080000,
+0x00000000, 0x80000000, 0x00000000, 0xc0080000,
+0x00000000, 0xc0100000, 0x00000000, 0xc0080000,
+0x00000000, 0x3ff00000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0xbff00000, 0x00000000, 0x3fe00000,
+0x00000004, 0x00000000, 0x00000005, 0x00000000,
+0x00000006, 0x00000000, 0x00000007, 0x00000000,
+0005560,
+};
+asm(".type avx512f_x86_32_D_32f8, STT_NOTYPE;");
+asm(".type avx512f_x86_32_D_32f8, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512f_x86_32_D_f4[] = {
+0x00020de9, 0xe5895500, 0x6268ec83, 0x10087ef1,
+0x1008300d, 0x7ef16200, 0xea4d1108, 0x087ef162,
+0x62e84d11, 0x11087ef1, 0xf162e94d, 0x4d10087e,
+0x00a7b8e9, 0x45c70000, 0x000000ac, 0x75f26240,
+0xe84d9908, 0x0875f362, 0x620ec921, 0xc20876f1,
+0xc500eb45, 0x66d093f8, 0xb1850f4a, 0x62000001,
+0x10087ef1, 0xabb8e94d, 0xc7000000, 0x0000ac45,
+0xf262c000, 0x4d9f0875, 0x75f362e8, 0x0ec92108,
+0x0876f162, 0x00eb4dc2, 0xd193f8c5, 0x850f4a66,
+0x0000017c, 0x087ef162, 0xb8e94d10, 0x000000af,
+0x00ac45c7, 0x62000000, 0x9b0875f2, 0xf362e84d,
+0xc9210875, 0x76f1620e, 0xeb55c208, 0x93f8c500,
+0x0f4a66d2, 0x00014785, 0x7ef16200, 0xe94d1008,
+0x0000b3b8, 0xac45c700, 0x80000000, 0x0875f262,
+0x62e84d9d, 0x210875f3, 0xf1620ec9, 0x5dc20876,
+0xf8c500eb, 0x4a66d393, 0x0112850f, 0xf1620000,
+0x4d10087e, 0x7ef162e8, 0xe96d1008, 0x0876f162,
+0xf162d558, 0x5d10087e, 0x00bbb8ea, 0xf1620000,
+0x7510087e, 0x7ef162e9, 0xeb551108, 0x084df262,
+0x62e85d99, 0x210865f3, 0xf1620edb, 0x65c20866,
+0xf8c500eb, 0x4a66d493, 0x00c2850f, 0xf1620000,
+0x1d10087e, 0x00100840, 0x0000c0b8, 0x7ef16200,
+0xea651008, 0x087ef162, 0xc5e97d10, 0x62d357e8,
+0x9f0845f2, 0xf162e865, 0x5511087e, 0x5df362eb,
+0x0ed42108, 0x086ef162, 0x00eb6dc2, 0xd593f8c5,
+0x7c754a66, 0x0876f162, 0xf162cd5c, 0x5510087e,
+0x00c5b8ea, 0xf1620000, 0x7510087e, 0x7ef162e9,
+0xeb4d1108, 0x084df262, 0x62e8559b, 0x21086df3,
+0xf1620ed2, 0x75c2086e, 0xf8c500eb, 0x4a66d693,
+0xf0c53e75, 0xcab8cb57, 0x62000000, 0x10087ef1,
+0xf162ea55, 0x7d10087e, 0x7ef162e9, 0xeb4d1108,
+0x0845f262, 0x62e8559d, 0x21086df3, 0xf1620eca,
+0x7dc20876, 0xf8c500eb, 0x4a66d793, 0xc0310275,
+0x8955c3c9, 0xc0e483e5, 0x0100ec81, 0xf1620000,
+0x0d10087e, 0x00100830, 0x087ef162, 0x1c244c11,
+0x087ef162, 0x1d244c11, 0x087ef162, 0x1e244c11,
+0x7024448b, 0x64244489, 0x087ef162, 0x19245410,
+0x000539b8, 0x7ef16200, 0x24541108, 0x7ef16220,
+0x24541008, 0x6ef1621c, 0x2444c208, 0xf8c50020,
+0x4a66d093, 0x05af850f, 0xf1620000, 0x5410087e,
+0xf1621924, 0x5458086e, 0xf1621c24, 0x5411087e,
+0xf1621a24, 0x5410087e, 0x3fb81a24, 0x62000005,
+0x11087ef1, 0x62202454, 0x10087ef1, 0x621c2454,
+0x58086ef1, 0x6df362d2, 0x0ed22108, 0x086ef162,
+0x20244cc2, 0x93f8c500, 0x0f4a66d1, 0x00055885,
+0x7ef16200, 0x24541008, 0x6ef1621a, 0x24545c08,
+0x7ef1621c, 0x24141108, 0x8924048b, 0x009c2484,
+0x44890000, 0x44896824, 0xf1626c24, 0x5410087e,
+0x44b81924, 0x62000005, 0x11087ef1, 0x62202454,
+0x10087ef1, 0x621b2454, 0xc2086ef1, 0x00202454,
+0xd293f8c5, 0x850f4a66, 0x000004fd, 0x087ef162,
+0x19245410, 0x086ef162, 0x1c245459, 0x087ef162,
+0x19245411, 0x087ef162, 0x1d245410, 0x086ef162,
+0xf162d259, 0x5411087e, 0xf1621a24, 0x5410087e,
+0xf1621c24, 0x5458086e, 0xf1621d24, 0x5411087e,
+0xf1621b24, 0x5c10087e, 0x5bb81c24, 0x62000005,
+0x10087ef1, 0x62192464, 0x5c0866f1, 0x621d2454,
+0x5c085ef1, 0x621a2464, 0x59086ef1, 0x621b2454,
+0x11087ef1, 0x62202464, 0x11087ef1, 0x621b2454,
+0x21086df3, 0xf1620ed2, 0x5cc2086e, 0xc5002024,
+0x66d393f8, 0x5e850f4a, 0x62000004, 0x590866f1,
+0x621e245c, 0x11087ef1, 0x6219245c, 0x10087ef1,
+0xb819245c, 0x00000564, 0x087ef162, 0x1c245410,
+0x087ef162, 0x20245c11, 0x086ef162, 0x1e24545e,
+0x087ef162, 0x1a245411, 0x086df362, 0x620ed221,
+0xc2086ef1, 0x00202464, 0xd493f8c5, 0x850f4a66,
+0x00000405, 0x087ef162, 0x08401d10, 0x67b80010,
+0x62000005, 0x10087ef1, 0xc51e2454, 0x62d357e8,
+0x59086ef1, 0x62192454, 0x11087ef1, 0x62202454,
+0x10087ef1, 0xc51c2454, 0x62d357e8, 0x21086df3,
+0xf1620ed2, 0x6cc2086e, 0xc5002024, 0x66d593f8,
+0xb2850f4a, 0xc5000003, 0x24442cfa, 0x24848970,
+0x00000080, 0x942aeac5, 0x00008024, 0x7ef16200,
+0x24541108, 0x7ef16219, 0x24541008, 0x056eb819,
+0xf1620000, 0x5411087e, 0xf1622024, 0x5410087e,
+0xf1621c24, 0x74c2086e, 0xc5002024, 0x66d693f8,
+0x62850f4a, 0x62000003, 0x4d086df2, 0x621c2454,
+0x11087ef1, 0x62192454, 0x4d086df2, 0xc5192454,
+0x89c22cfa, 0x00802484, 0xeac50000, 0x8024942a,
+0xb8000000, 0x00000575, 0x087ef162, 0x20245411,
+0x087ef162, 0x1c245410, 0x086df362, 0x620eda21,
+0xc20866f1, 0x0020247c, 0xd793f8c5, 0x850f4a66,
+0x00000305, 0x086ef162, 0xf162d259, 0x5411087e,
+0xf2621924, 0x544f086d, 0xf1621924, 0x5411087e,
+0xf2621a24, 0x544d086d, 0xfac51a24, 0x8489c22c,
+0x00008024, 0x2aeac500, 0x00802494, 0x7cb80000,
+0x62000005, 0x11087ef1, 0x62202454, 0x10087ef1,
+0x621c2454, 0xc2086ef1, 0x00202444, 0xd093f8c5,
+0x850f4a66, 0x000002a1, 0x442cfac5, 0x84896824,
+0x00008024, 0x2aeac500, 0x00802494, 0xf1620000,
+0x5411087e, 0xf2621f24, 0x544d086d, 0xfac51c24,
+0x8489c22c, 0x00008024, 0x2aeac500, 0x00802494,
+0x7eb80000, 0x62000005, 0x21086df3, 0xf1620ed2,
+0x4cc2086e, 0xc5001f24, 0x66d193f8, 0x46850f4a,
+0x62000002, 0x79087ef1, 0x891c2444, 0x00802484,
+0xf1620000, 0x547b086e, 0xf1622024, 0x5411087e,
+0xf1621924, 0x5410087e, 0x8fb81924, 0x62000005,
+0x11087ef1, 0x62202454, 0x10087ef1, 0x621c2454,
+0x21086df3, 0xf1620eda, 0x54c20866, 0xc5002024,
+0x66d293f8, 0xee850f4a, 0x62000001, 0x59086ef1,
+0x7ef162d2, 0x24541108, 0x6ef16219, 0x24545108,
+0x7ef16219, 0x24541108, 0x059cb820, 0xf1620000,
+0x5410087e, 0xf3621c24, 0xda21086d, 0x66f1620e,
+0x245cc208, 0xf8c50020, 0x4a66d393, 0x01a7850f,
+0xf1620000, 0xd25e0876, 0x087ef162, 0x1a244c11,
+0x087ef162, 0x19245411, 0x087ef162, 0x1a245c10,
+0x0005a4b8, 0x6df36200, 0x24540a08, 0xf1620b19,
+0x5411087e, 0xf3621b24, 0xd221086d, 0x7ef1620e,
+0x245c1108, 0x6ef16220, 0x2464c208, 0xf8c50020,
+0x4a66d493, 0x014f850f, 0xf1620000, 0x5410087e,
+0xf1621e24, 0x5c59086e, 0xf1621c24, 0x5459086e,
+0xf1621d24, 0x5c11087e, 0xf1621924, 0x5411087e,
+0xf1621a24, 0x5410087e, 0xf1621924, 0x545f086e,
+0xf1621a24, 0x5411087e, 0xf1621b24, 0x5410087e,
+0xf1621924, 0x545d086e, 0xf1621a24, 0x5411087e,
+0xf1621a24, 0x5410087e, 0x3db81a24, 0x8b000006,
+0x62702454, 0x58086ef1, 0x621b2454, 0x59086ef1,
+0x891e2454, 0x00f82494, 0xf1620000, 0x5411087e,
+0xf1622024, 0x5410087e, 0xf1623e24, 0x5458086e,
+0xf3621d24, 0xd221086d, 0x6ef1620e, 0x246cc208,
+0xf8c50020, 0x4966cd93, 0x009b850f, 0x54890000,
+0xf3626824, 0x5427086d, 0x62001c24, 0x11087ef1,
+0x62192454, 0x43086df2, 0x621c2454, 0x11087ef1,
+0xc51a2454, 0x62d257e8, 0x2e087cf1, 0x7a1a2454,
+0x625a755c, 0x2e087cf1, 0x7a19244c, 0x62557557,
+0x10087ef1, 0xb81c2454, 0x0000077d, 0x087ef162,
+0x19244c10, 0x0875f262, 0x1a244c2d, 0x087ef162,
+0x20245411, 0x087ef162, 0x1b244c11, 0x0875f362,
+0x620ec921, 0xc20876f1, 0x00202474, 0xd693f8c5,
+0x15754a66, 0xfff7ece8, 0xebd8f7ff, 0x0773b80c,
+0x05eb0000, 0x000778b8, 0x00c3c900, 0x00000000,
+0x3f800000, 0x00000000, 0x00000000, 0x00000000,
+0x80000000, 0x00000000, 0x00000000, 0x00000000,
+0004120,
+};
+asm(".type avx512f_x86_32_D_f4, STT_NOTYPE;");
+asm(".type avx512f_x86_32_D_f4, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512f_x86_32_D_f8[] = {
+0x000230e9, 0xe5895500, 0x00b8ec81, 0xf1620000,
+0x0d1008ff, 0x00100860, 0x08fff162, 0x62eb4d11,
+0x1108fff1, 0xf162e94d, 0x4d1108ff, 0x6485c7ea,
+0x00ffffff, 0x31400000, 0xfff162c0, 0xea4d1008,
+0xff608589, 0xf262ffff, 0x4d9908f5, 0xfef162e9,
+0x62c97e08, 0xc208f7f1, 0xc500ec45, 0x66d093f8,
+0x00a7b84a, 0x850f0000, 0x000001c7, 0xff6485c7,
+0x0000ffff, 0xc931c000, 0x08fff162, 0x89ea4d10,
+0xffff608d, 0xf5f262ff, 0xe94d9f08, 0x08fef162,
+0xf162c97e, 0x4dc208f7, 0xf8c500ec, 0x4a66d193,
+0x0000abb8, 0x88850f00, 0x31000001, 0xfff162d2,
+0xea4d1008, 0x08f5f262, 0x89e94d9b, 0xffff6095,
+0xfef162ff, 0xb8c97e08, 0x000000af, 0xff649589,
+0xf162ffff, 0x55c208f7, 0xf8c500ec, 0x4a66d293,
+0x014d850f, 0x85c70000, 0xffffff64, 0x80000000,
+0xf162c031, 0x4d1008ff, 0x608589ea, 0x62ffffff,
+0x9d08f5f2, 0xf162e94d, 0xc97e08fe, 0x08f7f162,
+0x00ec5dc2, 0xd393f8c5, 0xb3b84a66, 0x0f000000,
+0x00010e85, 0xfff16200, 0xe94d1008, 0x08fff162,
+0x62ea6d10, 0x5808f7f1, 0xfff162d5, 0xeb5d1008,
+0x08fff162, 0x62ea7510, 0x1108fff1, 0xf262ec55,
+0x5d9908cd, 0xfef162e9, 0xb8db7e08, 0x000000bb,
+0x08e7f162, 0x00ec65c2, 0xd493f8c5, 0x850f4a66,
+0x000000bf, 0x08fef162, 0x08701d7e, 0xf1620010,
+0x651008ff, 0x57e9c5eb, 0xfff162d3, 0xea7d1008,
+0x08fff162, 0x62ec5511, 0x9f08c5f2, 0xf162e965,
+0xd47e08fe, 0x0000c0b8, 0xeff16200, 0xec6dc208,
+0x93f8c500, 0x754a66d5, 0xf7f1627a, 0x62cd5c08,
+0x1008fff1, 0xf162eb55, 0x751008ff, 0xfff162ea,
+0xec4d1108, 0x08cdf262, 0x62e9559b, 0x7e08fef1,
+0x00c5b8d2, 0xf1620000, 0x75c208ef, 0xf8c500ec,
+0x4a66d693, 0xf1c53d75, 0xf162cb57, 0x551008ff,
+0xfff162eb, 0xec4d1108, 0x08fff162, 0x62ea7d10,
+0x9d08c5f2, 0xf162e955, 0xca7e08fe, 0x08f7f162,
+0x00ec7dc2, 0xd793f8c5, 0xcab84a66, 0x75000000,
+0xc9c03102, 0xe58955c3, 0x81c0e483, 0x000180ec,
+0xfff16200, 0x600d1008, 0x62001008, 0x1108fff1,
+0x620d244c, 0x1108fff1, 0x620e244c, 0x1108fff1,
+0x620f244c, 0x7e08fef1, 0x620d2454, 0xd608fdf1,
+0x620a2454, 0x1008fff1, 0x620a246c, 0x7e08fef1,
+0x620d2454, 0x1108fff1, 0x6210246c, 0xc208eff1,
+0x00102444, 0xd093f8c5, 0x39b84a66, 0x0f000005,
+0x0005b285, 0xfff16200, 0x24741008, 0xcff1620a,
+0x24545808, 0xfff1620d, 0x24541108, 0xfff1620b,
+0x247c1008, 0xfff1620b, 0x24541008, 0xfff1620d,
+0x247c1108, 0xeff16210, 0x62d25808, 0x7e08fef1,
+0x053fb8d2, 0xf1620000, 0x4cc208ef, 0xc5001024,
+0x66d193f8, 0x5c850f4a, 0x62000005, 0x1008fff1,
+0x620b2464, 0x5c08dff1, 0x620d2454, 0x1108fff1,
+0xf1622414, 0x147e08fe, 0xfdf16224, 0x2454d608,
+0xfdf16217, 0x2454d608, 0xfdf1620b, 0x2454d608,
+0xfff1620c, 0x246c1008, 0xfef1620a, 0x24547e08,
+0xfff1620c, 0x246c1108, 0xeff16210, 0x2454c208,
+0xf8c50010, 0x4a66d293, 0x000544b8, 0xf4850f00,
+0x62000004, 0x1008fff1, 0x620a2474, 0x5908cff1,
+0x620d2454, 0x1108fff1, 0x620a2454, 0x1008fff1,
+0x620e2454, 0x5908eff1, 0xfff162d2, 0x24541108,
+0xfff1620b, 0x247c1008, 0xc7f1620d, 0x24545808,
+0xfff1620e, 0x24541108, 0xfff1620c, 0x245c1008,
+0xfff1620d, 0x24641008, 0xe7f1620a, 0x24545c08,
+0xdff1620e, 0x24645c08, 0xeff1620b, 0x24545908,
+0xfff1620c, 0x24641108, 0xfff16210, 0x24541108,
+0xfef1620c, 0xb8d27e08, 0x0000055b, 0x08eff162,
+0x10245cc2, 0x93f8c500, 0x0f4a66d3, 0x00045685,
+0xe7f16200, 0x245c5908, 0xfff1620f, 0x245c1108,
+0xfff1620a, 0x246c1008, 0xfff1620d, 0x24741008,
+0xd7f1620a, 0x24545e08, 0xfff1620f, 0x24741108,
+0xfff16210, 0x24541108, 0xfef1620b, 0x62d27e08,
+0xc208eff1, 0x00102464, 0xd493f8c5, 0x64b84a66,
+0x0f000005, 0x0003fe85, 0xfef16200, 0x701d7e08,
+0x62001008, 0x1008fff1, 0x620f247c, 0x1008fff1,
+0xc50d2464, 0x62d357c1, 0x5908eff1, 0x620a2454,
+0x1108fff1, 0xc5102454, 0x62d357d9, 0x7e08fef1,
+0x0567b8d2, 0xf1620000, 0x6cc208ef, 0xc5001024,
+0x66d593f8, 0xac850f4a, 0xc5000003, 0x24442cfb,
+0x24848968, 0x00000080, 0x942aebc5, 0x00008024,
+0xfff16200, 0x24541108, 0xfff1620a, 0x246c1008,
+0xfef1620a, 0x24547e08, 0xfff1620d, 0x246c1108,
+0xeff16210, 0x2474c208, 0xf8c50010, 0x4a66d693,
+0x00056eb8, 0x5c850f00, 0x62000003, 0x4d08edf2,
+0x620d2454, 0x1308fdf1, 0x620a2454, 0x4d08edf2,
+0xc50a2454, 0x89c22cfb, 0x00802484, 0xebc50000,
+0x8024942a, 0xb8000000, 0x00000575, 0x08fff162,
+0x10245411, 0x08fff162, 0x0d245410, 0x08fef162,
+0xf162da7e, 0x7cc208e7, 0xc5001024, 0x66d793f8,
+0x00850f4a, 0x62000003, 0x5908eff1, 0xfff162d2,
+0x24541108, 0xedf2620a, 0x24544f08, 0xfdf1620a,
+0x24541308, 0xedf2620b, 0x24544d08, 0x2cfbc50b,
+0x248489c2, 0x00000080, 0x942aebc5, 0x00008024,
+0x057cb800, 0xf1620000, 0x541108ff, 0xf1621024,
+0x547e08fe, 0xf1620d24, 0x44c208ef, 0xc5001024,
+0x66d093f8, 0x9c850f4a, 0xc5000002, 0x24442cfb,
+0x24848958, 0x00000080, 0x942aebc5, 0x00008024,
+0xfff16200, 0x24541108, 0xedf26210, 0x24544d08,
+0x2cfbc50d, 0x244489c2, 0x2aebc54c, 0xb84c2454,
+0x0000057e, 0x08fef162, 0xf162d27e, 0x4cc208ef,
+0xc5001024, 0x66d193f8, 0x48850f4a, 0x62000002,
+0x79087ff1, 0x890d2444, 0x00802484, 0xf1620000,
+0x547b086f, 0xf1622024, 0x541308fd, 0xf1620a24,
+0x741008ff, 0xf1620a24, 0x541008ff, 0xf1620d24,
+0x741108ff, 0xf1621024, 0xda7e08fe, 0x00058fb8,
+0xe7f16200, 0x2454c208, 0xf8c50010, 0x4a66d293,
+0x01f1850f, 0xf1620000, 0xd25908ef, 0x08fff162,
+0x0a245411, 0x08eff162, 0x0a245451, 0x08fdf162,
+0x10245413, 0x08fff162, 0x0d245410, 0x08fef162,
+0xf162da7e, 0x5cc208e7, 0xc5001024, 0x66d393f8,
+0x059cb84a, 0x850f0000, 0x000001ab, 0x08f7f162,
+0xf162d25e, 0x4c1108ff, 0xf1620b24, 0x541108ff,
+0xf3620a24, 0x540b08ed, 0x620b0a24, 0x1008fff1,
+0x620b247c, 0x1108fff1, 0x620c2454, 0x1108fff1,
+0x6210247c, 0x7e08fef1, 0x05a4b8d2, 0xf1620000,
+0x64c208ef, 0xc5001024, 0x66d493f8, 0x54850f4a,
+0x62000001, 0x1008fff1, 0x620f2454, 0x5908eff1,
+0x620d245c, 0x5908eff1, 0x620e2454, 0x1108fff1,
+0x620a245c, 0x1108fff1, 0x620b2454, 0x1008fff1,
+0x620a2464, 0x5f08dff1, 0x620b2454, 0x1108fff1,
+0x620c2454, 0x1008fff1, 0x620a246c, 0x5d08d7f1,
+0x620b2454, 0x1108fff1, 0x620b2454, 0x1008fff1,
+0x620b2474, 0x7e08fef1, 0x620d245c, 0x5808cff1,
+0x620c2454, 0xd608fdf1, 0x622e245c, 0x5908eff1,
+0x620f2454, 0x1008fff1, 0x622e247c, 0x1108fff1,
+0x62102454, 0x5808c7f1, 0x620e2454, 0x7e08fef1,
+0xeff162d2, 0x246cc208, 0xf8c50010, 0x4a66d593,
+0x00063db8, 0x9c850f00, 0x62000000, 0xd608fdf1,
+0x620b245c, 0x2708edf3, 0x000d2454, 0x08fdf162,
+0x0a245413, 0x08edf262, 0x0d245443, 0x08fdf162,
+0x0b245413, 0xd257e9c5, 0x08fdf162, 0x0b24542e,
+0x5775597a, 0x08fdf162, 0x0a244c2e, 0x5275547a,
+0x08fef162, 0x0a244c7e, 0x08fff162, 0x0d246410,
+0x00077db8, 0xf5f26200, 0x244c2d08, 0xfff1620b,
+0x24641108, 0xfff16210, 0x244c1108, 0x14f1c50c,
+0xf7f162ca, 0x2474c208, 0xf8c50010, 0x4a66d693,
+0xbee81575, 0xf7fffff7, 0xb80cebd8, 0x00000773,
+0x78b805eb, 0xc9000007, 0x000000c3, 0x00000000,
+0x00000000, 0x3ff00000, 0x00000000, 0x00000000,
+0x00000000, 0x80000000, 0x00000000, 0x00000000,
+0004200,
+};
+asm(".type avx512f_x86_32_D_f8, STT_NOTYPE;");
+asm(".type avx512f_x86_32_D_f8, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512f_x86_64_D_64i4[] = {
+0xb85500eb, 0x00000001, 0xbfc03145, 0x00000020,
+0x0011bb41, 0x89480000, 0xe48348e5, 0xec8148c0,
+0x00000248, 0xa42444c7, 0x00000020, 0x45ff488d,
+0x8941da89, 0x41ca89c1, 0xe283c229, 0x01fa8301,
+0xe683f619, 0x85ceff02, 0xff0575c8, 0x01b041cf,
+0xd104e2c1, 0x8c8944e9, 0x00008484, 0x44ca0900,
+0xc4849489, 0x89000000, 0x01848494, 0xc2830000,
+0x84b48908, 0x00000104, 0x4484bc89, 0x89000001,
+0x01c48494, 0xff480000, 0xf88348c0, 0x459d7511,
+0x0474c084, 0xa4247c89, 0x487df162, 0x8824b46f,
+0x62000000, 0x7f487df1, 0xffc824b4, 0xf162ffff,
+0x8c6f487d, 0xffffc824, 0x0539b8ff, 0xf3620000,
+0xc61f4875, 0x93f8c500, 0xc2ff66d0, 0x079d850f,
+0xf1620000, 0x94fe4875, 0x00008824, 0x7df16200,
+0x24947f48, 0x00000008, 0x487df162, 0x0824946f,
+0xb8000000, 0x0000053f, 0x4865f162, 0x8824b472,
+0x01000000, 0x486df362, 0xc500d31f, 0x66d293f8,
+0x850fc2ff, 0x00000757, 0x486df162, 0x882494fa,
+0x62000000, 0x7f487df1, 0x00482494, 0xf3620000,
+0x9c1f4875, 0x00004824, 0x44b80000, 0xc5000005,
+0x66d393f8, 0x850fc2ff, 0x00000723, 0x487df162,
+0xc824bc6f, 0x62000000, 0x404875f2, 0x0088248c,
+0xf2620000, 0xd7404845, 0x487df162, 0x0824947f,
+0x62000000, 0x6f487df1, 0x008824a4, 0xf1620000,
+0xeffe485d, 0x485df162, 0xc8249cfa, 0x62000000,
+0xfa4875f1, 0x055bb8ca, 0xf2620000, 0xdd404865,
+0x4875f362, 0x6200e31f, 0x7f487df1, 0x0048249c,
+0xf8c50000, 0xff66d493, 0xb0850fc2, 0x62000006,
+0x40485df2, 0x00c8248c, 0xf1620000, 0x8c7f487d,
+0xffffc824, 0x2444c7ff, 0x00001008, 0x448d4800,
+0x0eba0824, 0xc7000000, 0x10442444, 0x48000000,
+0x8948c789, 0x48308bc1, 0x4804ef83, 0x0104c083,
+0x893089d6, 0xea833c77, 0x89ea7502, 0x62282474,
+0x6f487df1, 0xffc824b4, 0xc8b8ffff, 0xc7000005,
+0x02a42444, 0x62000000, 0x76484df1, 0x000824ac,
+0xf8c50000, 0xff66d593, 0x30850fc2, 0x62000006,
+0xef485df1, 0x0108248c, 0xf1620000, 0x8c7f487d,
+0xffffc824, 0xf5f262ff, 0x248c2848, 0x000000c8,
+0x48fdf162, 0x08248c7f, 0x31000000, 0x546348c0,
+0x6348c804, 0x00c804b4, 0x0f480000, 0x5489d6af,
+0xc1484804, 0x548920ea, 0x83484c04, 0x834808c0,
+0xd97540f8, 0x487df162, 0x0824bc6f, 0xb8000000,
+0x000005e1, 0x4845f162, 0x4824b476, 0xc5000000,
+0x66d693f8, 0x850fc2ff, 0x000005b3, 0x485df262,
+0x08249440, 0x62000001, 0x7f487df1, 0x00482494,
+0xf1620000, 0xb4724875, 0x00004824, 0xf1620300,
+0x8c7f487d, 0xffffc824, 0x65f162ff, 0x24b47248,
+0x00000048, 0x65f16202, 0xb8ebfe48, 0x000005ed,
+0x4875f362, 0xc500fd1f, 0x66d793f8, 0x850fc2ff,
+0x0000055b, 0x4875f162, 0xc824a472, 0x02ffffff,
+0x4875f162, 0xf2b8c9fe, 0x62000005, 0x1f4865f3,
+0xf8c500c1, 0xff66d093, 0x30850fc2, 0xc7000005,
+0x03a42444, 0x48000000, 0xa4244463, 0x08fdf162,
+0xf162c86e, 0xc9f2486d, 0xa42444c7, 0x00000002,
+0x24446348, 0xfdf162a4, 0x62f06e08, 0xf2486df1,
+0x6df162d6, 0xb8dafe48, 0x00000605, 0x4875f362,
+0xc500d31f, 0x66d293f8, 0x850fc2ff, 0x000004df,
+0x24446348, 0xfdf162a4, 0x62f86e08, 0xe24875f1,
+0x75f162cf, 0xb8c9fe48, 0x00000609, 0x486df362,
+0xc500d91f, 0x66d393f8, 0x850fc2ff, 0x000004af,
+0x487df162, 0x4824b46f, 0xc5000001, 0x62c9eff1,
+0x1f484df3, 0xf26206c9, 0x9440c95d, 0x00010824,
+0x6df26200, 0x249c4748, 0x00000148, 0x487df162,
+0x4824bc6f, 0xb8000001, 0x00000001, 0x487df262,
+0xf162c87c, 0xc9fa4845, 0x487df162, 0x48248c7f,
+0x62000001, 0x47486df2, 0x0148248c, 0x21b80000,
+0x62000006, 0xfe4875f1, 0x65f362e9, 0x00e51f48,
+0xd493f8c5, 0x0fc2ff66, 0x00043285, 0x75f26200,
+0x248c4648, 0x00000148, 0x000626b8, 0x75f36200,
+0x00ea1f48, 0xd593f8c5, 0x0fc2ff66, 0x00040e85,
+0x7df16200, 0x24ac6f48, 0x00000108, 0x4855f262,
+0xc8248c40, 0x62000000, 0x404855f2, 0x00882494,
+0xf1620000, 0x8c7f487d, 0x00000824, 0x6df26200,
+0x248c3d48, 0x00000008, 0x486df262, 0x08249439,
+0x62000000, 0x7f487df1, 0x00082494, 0xf1620000,
+0x8cfe4875, 0x00000824, 0x063db800, 0xf1620000,
+0x94fe485d, 0x0000c824, 0x75f26200, 0x62cd4048,
+0x1f4875f3, 0xf8c500f2, 0xff66d693, 0x8c850fc2,
+0x62000003, 0x40485df2, 0x7df162cd, 0x248c7f48,
+0xffffffc8, 0x487df262, 0xc8248c1e, 0x62ffffff,
+0x1f4875f3, 0x44b800fc, 0xc5000006, 0x66d793f8,
+0x850fc2ff, 0x00000357, 0x487df162, 0x8824b46f,
+0xb8000000, 0x0000064e, 0x487df162, 0xc8249c6f,
+0x62000000, 0x43484df3, 0xf1621bce, 0xc970487d,
+0x75f3621b, 0x00c31f48, 0xd093f8c5, 0x0fc2ff66,
+0x00031a85, 0x7df16200, 0x248c6f48, 0x00000088,
+0x000001b8, 0x7df26200, 0xb8d07c48, 0x00000653,
+0x4865f162, 0xf262d2fa, 0xd136486d, 0x486df362,
+0xc500d31f, 0x66d293f8, 0x850fc2ff, 0x000002df,
+0x4865f162, 0x5db8d1fe, 0xc7000006, 0x02082484,
+0x00110000, 0xf2620000, 0xa458487d, 0x00020824,
+0x5df36200, 0x00da1f48, 0xd393f8c5, 0x0fc2ff66,
+0x0002aa85, 0x0011b800, 0xf2620000, 0xe07c487d,
+0x485df362, 0xb800e21f, 0x00000661, 0xd493f8c5,
+0x0fc2ff66, 0x00028685, 0x7df36200, 0x248c3948,
+0x00000208, 0x7df26200, 0x24945a48, 0x00000208,
+0x4875f362, 0x08248c38, 0x01000002, 0x4875f362,
+0x08248c38, 0x02000002, 0x4875f362, 0x08248c38,
+0x03000002, 0x486df362, 0xc500e91f, 0x66c593f8,
+0x7cb8c0ff, 0x0f000006, 0x00023285, 0x7df16200,
+0x24946f48, 0x00000188, 0x487df162, 0xf262cb6f,
+0x8c7e486d, 0x00008824, 0x7df16200, 0x24bc6f48,
+0x000001c8, 0x4845f262, 0x88249c7e, 0x62000000,
+0xfa4875f1, 0x06a6b8cb, 0x84c70000, 0x00020824,
+0x00000800, 0x75f26200, 0x62cd4048, 0x58487df2,
+0x0208249c, 0xf3620000, 0xf31f4875, 0x7df16200,
+0x248c7f48, 0x00000048, 0xd693f8c5, 0x0fc2ff66,
+0x0001ba85, 0xefe1c500, 0x55f262db, 0x248c4048,
+0x00000088, 0x487df162, 0xc8248c7f, 0x62ffffff,
+0x1f4855f3, 0xf36201cb, 0xdb25c965, 0x75f26281,
+0x62d37648, 0x7f487df1, 0x00082494, 0xf1620000,
+0xb46f487d, 0xffffc824, 0x62c031ff, 0x7f487df1,
+0x020824b4, 0x948b0000, 0x00020804, 0xc0834800,
+0x04548904, 0xf88348a4, 0x62eb7520, 0x25487df2,
+0xffa8248c, 0xf162ffff, 0x8c7f48fd, 0x00004824,
+0x75f36200, 0x24bc1f48, 0x00000008, 0x06b3b800,
+0xf8c50000, 0xff66d793, 0x20850fc2, 0x62000001,
+0x6f487df1, 0x0088248c, 0xc0310000, 0x487df162,
+0x08248c7f, 0x8b000002, 0x02080494, 0x54890000,
+0x8348a804, 0x834804c0, 0xeb7520f8, 0x487df262,
+0xa8249425, 0x62ffffff, 0x7f48fdf1, 0xffc82494,
+0xf162ffff, 0xbc6f48fd, 0xffffc824, 0x7ef262ff,
+0x24bc3548, 0x00000208, 0xbc8bc031, 0x00008804,
+0x04bc3900, 0x00000208, 0xf1b80a74, 0xe9000006,
+0x000000ab, 0x04c08348, 0x20f88348, 0xf162dc75,
+0x8c7f487d, 0x00000824, 0x0004b800, 0x948b0000,
+0x0000c804, 0x01148900, 0x08c08348, 0x44f88348,
+0xf162ec75, 0x8c6f487d, 0x00008824, 0xaaaab800,
+0xf8c5ffff, 0x3ab8c892, 0x62000007, 0x644975f2,
+0x00c82494, 0xf3620000, 0x841f486d, 0x00000824,
+0xf8c50000, 0xff66d093, 0x624475c2, 0x034875f3,
+0x0fb801d9, 0xba000000, 0x00000000, 0x487df262,
+0x01b8d07c, 0x62000000, 0xdb4875f1, 0x7df262ca,
+0x62d07c48, 0xfe4875f1, 0x65f362ca, 0x00c91f48,
+0xc193f8c5, 0xb8c0ff66, 0x0000074a, 0xc9c2440f,
+0x000000c3,
+0004161,
+};
+asm(".type avx512f_x86_64_D_64i4, STT_NOTYPE;");
+asm(".type avx512f_x86_64_D_64i4, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512f_x86_64_D_64u4[] = {
+0x315500eb, 0xb9ff31c0, 0x00000020, 0x0010bb41,
+0x89480000, 0xe48348e5, 0xec8148c0, 0x00000248,
+0xa42444c7, 0x00000020, 0x8945c289, 0x408d44da,
+0x83c68901, 0x294101e2, 0x4a8d44c2, 0xc08541ff,
+0xc9ff0575, 0xc101b740, 0xeed104e2, 0x84848944,
+0x00000088, 0x8944f209, 0x00c88494, 0x94890000,
+0x00018884, 0x08c28300, 0x848c8944, 0x00000108,
+0x48848c89, 0x89000001, 0x01c88494, 0xff480000,
+0xf88348c0, 0x40a17510, 0x0474ff84, 0xa4244c89,
+0x487df162, 0x8824bc6f, 0x62000000, 0x7f487df1,
+0xffc824bc, 0xf162ffff, 0x946f487d, 0xffffc824,
+0x0539b8ff, 0xf3620000, 0xc71f486d, 0x93f8c500,
+0xc2ff66d0, 0x0715850f, 0xf1620000, 0x8cfe486d,
+0x00008824, 0x7df16200, 0x248c7f48, 0x00000008,
+0x487df162, 0x08248c6f, 0xb8000000, 0x0000053f,
+0x4865f162, 0x8824b472, 0x01000000, 0x4875f362,
+0xc500d31f, 0x66d293f8, 0x850fc2ff, 0x000006cf,
+0x4875f162, 0x88248cfa, 0x62000000, 0x7f487df1,
+0x0048248c, 0xf1620000, 0x9c6f487d, 0x00004824,
+0x0544b800, 0xf3620000, 0xdb1f486d, 0x93f8c500,
+0xc2ff66d3, 0x0695850f, 0xf1620000, 0x94eb486d,
+0x0000c824, 0x7df16200, 0x24947f48, 0xffffffc8,
+0x4875f162, 0xc8248cdb, 0x62000000, 0x7f487df1,
+0x0008248c, 0xf1620000, 0x94ef4865, 0x0000c824,
+0x7df16200, 0x24947f48, 0x00000048, 0x4875f162,
+0xc8248cdf, 0xb8ffffff, 0x00000550, 0x4875f362,
+0xc500e21f, 0x66d493f8, 0x850fc2ff, 0x0000062f,
+0x487df162, 0x8824946f, 0x62000000, 0x40486df2,
+0x00c8248c, 0xf1620000, 0x8c7f487d, 0xffffc824,
+0x2444c7ff, 0x00001008, 0x448d4800, 0x0eba0824,
+0xc7000000, 0x10442444, 0x48000000, 0x8948c789,
+0x48308bc1, 0x4804ef83, 0x0104c083, 0x893089d6,
+0xea833c77, 0x89ea7502, 0x62282474, 0x6f487df1,
+0xffc824b4, 0xc8b8ffff, 0xc7000005, 0x02a42444,
+0x62000000, 0x76484df1, 0x000824ac, 0xf8c50000,
+0xff66d593, 0xa4850fc2, 0x62000005, 0xef486df1,
+0x0108248c, 0xf1620000, 0x8c7f487d, 0xffffc824,
+0xf5f162ff, 0x248cf448, 0x000000c8, 0x48fdf162,
+0x08248c7f, 0x31000000, 0x04548bc0, 0x04b48bc8,
+0x000000c8, 0xd6af0f48, 0x48045489, 0x20eac148,
+0x4c045489, 0x08c08348, 0x40f88348, 0xf162db75,
+0xbc6f487d, 0x00000824, 0x05e1b800, 0xf1620000,
+0xb4764845, 0x00004824, 0x93f8c500, 0xc2ff66d6,
+0x0529850f, 0xf1620000, 0x947f487d, 0x00004824,
+0x75f16200, 0x24b47248, 0x00000048, 0x7df16203,
+0x248c7f48, 0xffffffc8, 0x4865f162, 0x4824b472,
+0x02000000, 0x4865f162, 0xedb8e3fe, 0x62000005,
+0x1f4875f3, 0xf8c500fc, 0xff66d793, 0xdc850fc2,
+0x62000004, 0x724875f1, 0xffc82494, 0x6202ffff,
+0xfe4875f1, 0x05f2b8c9, 0xf3620000, 0xc11f4865,
+0x93f8c500, 0xc2ff66d0, 0x04b1850f, 0x44c70000,
+0x0003a424, 0xf1620000, 0x4c6e087d, 0xf162e924,
+0xc9f2486d, 0xa42444c7, 0x00000002, 0x087df162,
+0xe9245c6e, 0x486df162, 0xf162dbf2, 0xe3fe4865,
+0x000605b8, 0x75f36200, 0x00d41f48, 0xd293f8c5,
+0x0fc2ff66, 0x00046685, 0x7df16200, 0x24646e08,
+0x75f162e9, 0x62ccd248, 0xfe4875f1, 0x0609b8c9,
+0xf3620000, 0xd91f4865, 0x93f8c500, 0xc2ff66d3,
+0x0439850f, 0xf1620000, 0xb46f487d, 0x00014824,
+0xeff1c500, 0x4df362c9, 0x04c91f48, 0x4875f362,
+0x62ffc925, 0x6fc97df1, 0x5df162e1, 0x62e2db48,
+0x47485df2, 0x014824ac, 0xf1620000, 0x9cfe4875,
+0x00014824, 0x7df16200, 0x249c7f48, 0x00000148,
+0x485df262, 0x48249c47, 0xb8000001, 0x00000621,
+0x4865f162, 0xf362f3fe, 0xe61f4855, 0x93f8c500,
+0xc2ff66d4, 0x03c5850f, 0xf2620000, 0x9c454865,
+0x00014824, 0x0626b800, 0xf3620000, 0xec1f4865,
+0x93f8c500, 0xc2ff66d5, 0x03a1850f, 0xf2620000,
+0x9c3b486d, 0x0000c824, 0x6df26200, 0x24a43f48,
+0x000000c8, 0x486df162, 0xc82494fe, 0x62000000,
+0xfe4865f1, 0x0634b8dc, 0xf3620000, 0xf21f4865,
+0x93f8c500, 0xc2ff66d6, 0x0361850f, 0xf1620000,
+0xbc6f487d, 0x00008824, 0x064eb800, 0xf1620000,
+0x9c6f487d, 0x0000c824, 0x45f36200, 0x1bd74348,
+0x487df162, 0x621bd270, 0x1f486df3, 0xf8c500fb,
+0xff66d793, 0x24850fc2, 0x62000003, 0x6f487df1,
+0x00882494, 0xf1620000, 0xe1fe4865, 0x000653b8,
+0x5df26200, 0x62e23648, 0x1f485df3, 0xf8c500c3,
+0xff66d093, 0xf4850fc2, 0x62000002, 0xfe4865f1,
+0x065db8e2, 0x84c70000, 0x00020824, 0x00001100,
+0x7df26200, 0x24ac5848, 0x00000208, 0x4855f362,
+0xc500cc1f, 0x66d193f8, 0x850fc2ff, 0x000002bf,
+0x000011b8, 0x7df26200, 0x62e87c48, 0x1f4855f3,
+0x61b800d4, 0xc5000006, 0x66d293f8, 0x850fc2ff,
+0x0000029b, 0x487df362, 0x08249439, 0x00000002,
+0x487df262, 0x0824a45a, 0x62000002, 0x38486df3,
+0x02082494, 0x62010000, 0x38486df3, 0x02082494,
+0x62020000, 0x38486df3, 0x02082494, 0x62030000,
+0x1f485df3, 0xf8c500da, 0xff66c393, 0x067cb8c0,
+0x850f0000, 0x00000247, 0x487df162, 0x8824946f,
+0x62000001, 0x6f487df1, 0x6df262e3, 0x24a47e48,
+0x00000088, 0x487df162, 0xc824a47f, 0x62ffffff,
+0x6f487df1, 0x01c824ac, 0xf2620000, 0x9c7e4855,
+0x00008824, 0x75f16200, 0xb8cbfe48, 0x000006a6,
+0x4865f362, 0x08249c25, 0x55000001, 0x082484c7,
+0x08000002, 0x62000000, 0xfa4875f1, 0x75f162cc,
+0x248cef48, 0x00000108, 0x4875f162, 0xf262cbfa,
+0x9c58487d, 0x00020824, 0x75f36200, 0x00e31f48,
+0xd493f8c5, 0x0fc2ff66, 0x0001b285, 0x7df16200,
+0x248c6f48, 0x00000088, 0xdbefe1c5, 0x486df262,
+0xf262cb7e, 0xd3764875, 0x487df162, 0x08248c7f,
+0x62000000, 0x7f487df1, 0x00482494, 0xf1620000,
+0xb46f487d, 0x00008824, 0x62c03100, 0x7f487df1,
+0x020824b4, 0x948b0000, 0x00020804, 0xc0834800,
+0x04548904, 0xf88348a4, 0x62eb7520, 0x35487df2,
+0xffa8248c, 0xf162ffff, 0x8c7f48fd, 0xffffc824,
+0x75f362ff, 0x24ac1f48, 0x00000008, 0x06d3b800,
+0xf8c50000, 0xff66d593, 0x20850fc2, 0x62000001,
+0x6f487df1, 0x0088248c, 0xc0310000, 0x487df162,
+0x08248c7f, 0x8b000002, 0x02080494, 0x54890000,
+0x8348a804, 0x834804c0, 0xeb7520f8, 0x487df262,
+0xa8249435, 0x62ffffff, 0x7f48fdf1, 0xffc82494,
+0xf162ffff, 0xbc6f48fd, 0xffffc824, 0x7ef262ff,
+0x24bc3548, 0x00000208, 0xbc8bc031, 0x00008804,
+0x04bc3900, 0x00000208, 0xf1b80a74, 0xe9000006,
+0x000000ab, 0x04c08348, 0x20f88348, 0xf162dc75,
+0x8c7f487d, 0x00000824, 0x0004b800, 0x948b0000,
+0x0000c804, 0x01148900, 0x08c08348, 0x44f88348,
+0xf162ec75, 0x8c6f487d, 0x00008824, 0xaaaab800,
+0xf8c5ffff, 0x3ab8c892, 0x62000007, 0x644975f2,
+0x00c82494, 0xf3620000, 0xb41f486d, 0x00000824,
+0xf8c50000, 0xff66d693, 0x624475c2, 0x034875f3,
+0x0fb801d9, 0xba000000, 0x00000000, 0x487df262,
+0x01b8d07c, 0x62000000, 0xdb4875f1, 0x7df262ca,
+0x62d07c48, 0xfe4875f1, 0x65f362ca, 0x00f91f48,
+0xc793f8c5, 0xb8c0ff66, 0x0000074a, 0xc9c2440f,
+0x000000c3,
+0003741,
+};
+asm(".type avx512f_x86_64_D_64u4, STT_NOTYPE;");
+asm(".type avx512f_x86_64_D_64u4, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512f_x86_64_D_64i8[] = {
+0xb85500eb, 0x00000001, 0x000040bf, 0x09ba4100,
+0x48000000, 0x8348e589, 0x8148c0e4, 0x000208ec,
+0xff488d00, 0x48d0894d, 0x80c48489, 0x89000000,
+0xc02949ca, 0x4c01e283, 0xc0c48489, 0x83000000,
+0x194801fa, 0xc93145f6, 0x4802e683, 0xc185ceff,
+0xc1940f41, 0x4803e2c1, 0x00c4b489, 0xd1000001,
+0xcf2944e9, 0xfe89ca09, 0xc4948948, 0x00000180,
+0x04c28348, 0xc4b48948, 0x00000140, 0xc4948948,
+0x000001c0, 0x48c0ff48, 0x7509f883, 0xfdf16294,
+0x24bc6f48, 0x00000088, 0x48fdf162, 0xc824bc7f,
+0x62ffffff, 0x6f48fdf1, 0xffc82494, 0x39b8ffff,
+0x62000005, 0x1f48edf3, 0xf8c500c7, 0xc2fed093,
+0x0770850f, 0xf1620000, 0x8cd448ed, 0x00008824,
+0xfdf16200, 0x248c7f48, 0x00000008, 0x48fdf162,
+0x08248c6f, 0xb8000000, 0x0000053f, 0x48e5f162,
+0x8824b473, 0x01000000, 0x48f5f362, 0xc500d31f,
+0xfed293f8, 0x2b850fc2, 0x62000007, 0xfb48f5f1,
+0x0088248c, 0xf1620000, 0x8c7f48fd, 0x00004824,
+0xedf36200, 0x249c1f48, 0x00000048, 0x0544b800,
+0xf8c50000, 0xc2fed393, 0x06f8850f, 0xf1620000,
+0x947348dd, 0x00008824, 0xf1622000, 0x9cf448ed,
+0x00008824, 0xf5f16200, 0x20d27348, 0x48f5f162,
+0x88248cf4, 0x62000000, 0x6f487df1, 0x00c824bc,
+0xf1620000, 0xd2f448dd, 0x48c5f162, 0xf162eff4,
+0xcad448f5, 0x48f5f162, 0x6220f173, 0xd448e5f1,
+0xf5f162d9, 0x24947348, 0x000000c8, 0xf5f16220,
+0x62cff448, 0xd448f5f1, 0xf5f162c9, 0x20f17348,
+0x48d5f162, 0xf162e9d4, 0x946f48fd, 0x00008824,
+0xed716200, 0x2484d448, 0x000000c8, 0x48edf162,
+0xc824bcfb, 0x62000000, 0x7348cdd1, 0x5bb820d0,
+0x62000005, 0x7348f5f1, 0xf16220d7, 0xf7f448cd,
+0x48f5d162, 0xd162c8f4, 0xe0f448c5, 0x48f5f162,
+0xf162ced4, 0xf17348f5, 0xddf16220, 0x62e1d448,
+0xfb48e5f1, 0xf5f362cd, 0x00e41f48, 0xd493f8c5,
+0x850fc2fe, 0x0000060e, 0x48d5f162, 0xc8249473,
+0x20000000, 0x48e5f162, 0x6220d273, 0xf448e5f1,
+0x00c8248c, 0xf1620000, 0xa4f448ed, 0x0000c824,
+0xd5f16200, 0x62eaf448, 0xd448f5f1, 0xf5f162cd,
+0x20f17348, 0x48ddf162, 0xf362c9d4, 0x2d1f48f5,
+0x000005cb, 0x05c8b800, 0xf8c50000, 0xc2fed593,
+0x05b0850f, 0xf1620000, 0x8c6f48fd, 0x00010824,
+0xcdf16200, 0x20d17348, 0x48e5f162, 0xf162e1f4,
+0xf2f448cd, 0x48edf162, 0xf162f9f4, 0xe6d448dd,
+0x48ddf162, 0x6220f473, 0xd448c5f1, 0xfdf162e4,
+0x24a47f48, 0x00000048, 0x48ddf162, 0x4824b473,
+0x03000000, 0x48fdf162, 0xc824a47f, 0x62ffffff,
+0x7348d5f1, 0x004824b4, 0x62020000, 0xd448d571,
+0xe5f162c5, 0xb8d9f448, 0x000005ed, 0x48ddd362,
+0xc500f01f, 0xfed693f8, 0x27850fc2, 0x62000005,
+0x7248ddf1, 0xffc824a4, 0x6202ffff, 0xd448ddf1,
+0x05f2b8e4, 0xf3620000, 0xfc1f48d5, 0x93f8c500,
+0x0fc2fed7, 0x0004fd85, 0xe5f16200, 0xc7e6d448,
+0x03a42444, 0x62000000, 0x7348ddf1, 0xf16220f4,
+0xe4d448c5, 0x24446348, 0xfdf162a4, 0x62e86e08,
+0xf348ddf1, 0x2444c7ed, 0x000002a4, 0x44634800,
+0x7162a424, 0xe06e08fd, 0x48ddd162, 0x7162e4f3,
+0xc4d448dd, 0x000605b8, 0xd5d36200, 0x00c01f48,
+0xd093f8c5, 0x850fc2fe, 0x0000049a, 0x24446348,
+0xfd7162a4, 0x62e86e08, 0xe248d5d1, 0xd5f162ed,
+0xb8edd448, 0x00000609, 0x48ddf362, 0xc500d51f,
+0xfed293f8, 0x6b850fc2, 0x62000004, 0xd448e5f1,
+0xefd9c5de, 0xfdf162e4, 0x24b46f48, 0x00000148,
+0x48e5f162, 0x6220f373, 0x1f48cdf3, 0xf16206cc,
+0xe3d4c9c5, 0x48fdf162, 0x4824a47f, 0x62000000,
+0x4748ddf2, 0x014824ac, 0xf1620000, 0xbc6f48fd,
+0x00014824, 0x0001b800, 0xf2620000, 0xd87c48fd,
+0x48c5f162, 0xf162dbfb, 0x9c7f48fd, 0x00014824,
+0xddf26200, 0x249c4748, 0x00000148, 0x000621b8,
+0xfdf16200, 0x249c7f48, 0x00000008, 0x48e5f162,
+0xf362dbd4, 0xdb1f48d5, 0x93f8c500, 0x0fc2fed3,
+0x0003d185, 0xfdf16200, 0x24bc6f48, 0x00000008,
+0x000626b8, 0xc5f26200, 0x249c4648, 0x00000148,
+0x48e5f362, 0xc500e41f, 0xfed493f8, 0xa3850fc2,
+0x62000003, 0x7348c5f1, 0xf16220d1, 0xd27348e5,
+0xfdf16220, 0x24ac6f48, 0x000000c8, 0x48e5f162,
+0x7162e1f4, 0xd2f448c5, 0x48cdf162, 0x6220d573,
+0xf448c571, 0xcdf162dd, 0x62f1f448, 0xf448d571,
+0xed7162c9, 0x62c1f448, 0xd448ddd1, 0xddf162e2,
+0x20f47348, 0x48cdd162, 0xf162f3d4, 0xf67348cd,
+0xbdf16220, 0x62e4d448, 0xd448b5f1, 0xfdf162f6,
+0x24b47f48, 0x00000008, 0x48ddf262, 0x0824b43d,
+0x62000000, 0x3948ddf2, 0x000824a4, 0xf1620000,
+0xa47f48fd, 0x00000824, 0xcdf16200, 0x24b4d448,
+0x00000008, 0x48e5f162, 0x3db8d9f4, 0x62000006,
+0x7348ddf1, 0x716220d6, 0xc9f448cd, 0x48ddf162,
+0xf162e1f4, 0xf6f448c5, 0x48ddf162, 0xf162e6d4,
+0xf5d448ed, 0x48ddf162, 0x6220f473, 0xd448b5f1,
+0xddf362e4, 0x00ee1f48, 0xd593f8c5, 0x850fc2fe,
+0x000002b2, 0x48e5d162, 0xf162dad4, 0xf37348e5,
+0xbd716220, 0x62c3d448, 0x7f48fd71, 0xffc82484,
+0xf262ffff, 0x9c1f48fd, 0xffffc824, 0xe5f362ff,
+0x00f21f48, 0x000644b8, 0x93f8c500, 0x0fc2fed6,
+0x00027185, 0xfdf16200, 0x24b46f48, 0x00000088,
+0x00064eb8, 0xcdf36200, 0x1bd64348, 0x487df162,
+0x624ed270, 0x1f48edf3, 0xf8c500fd, 0xc2fed793,
+0x0240850f, 0x01b80000, 0x62000000, 0x7c48fdf2,
+0x0653b8d0, 0xf1620000, 0xd2fb48d5, 0x48edf262,
+0x88249436, 0x62000000, 0x1f48edf3, 0xf8c500c5,
+0xc2fed093, 0x020c850f, 0xf3620000, 0x940048fd,
+0x00008824, 0x58b81b00, 0x62000006, 0x4348edf3,
+0xf3624ed2, 0xcd1f48ed, 0x93f8c500, 0x0fc2fed1,
+0x0001e185, 0xfdf16200, 0x24946f48, 0x00000088,
+0x00065db8, 0x44c74800, 0x0009a824, 0xf2620000,
+0x645948fd, 0xf162f524, 0xddd448ed, 0x48ddf362,
+0xc500d31f, 0xfed293f8, 0xa7850fc2, 0xb8000001,
+0x00000009, 0x48fdf262, 0xf362e07c, 0xdb1f48dd,
+0x0661b800, 0xf8c50000, 0xc2fed393, 0x0184850f,
+0xf3620000, 0x943b48fd, 0xffffa824, 0xf26200ff,
+0x9c5b48fd, 0xffffa824, 0xedf362ff, 0x24943a48,
+0xffffffa8, 0xe5f36201, 0x00e21f48, 0xc493f8c5,
+0x6cb8c0fe, 0x0f000006, 0x00014985, 0xfdf16200,
+0x249c6f48, 0x00000188, 0x48d5f262, 0x88249c76,
+0x62000000, 0x6f48fdf1, 0x01c82494, 0xf2620000,
+0x947648d5, 0x00008824, 0xe5f16200, 0xb8dafb48,
+0x000006a6, 0x2444c748, 0x000004a8, 0xedf16200,
+0x20d37348, 0x48e5f162, 0xf162e1f4, 0xfbf448c5,
+0x48edf162, 0xf262c9f4, 0x545948fd, 0xf162f524,
+0xcfd448f5, 0x48f5f162, 0x6220f173, 0xd448ddf1,
+0xf5f362c9, 0x00ea1f48, 0xd593f8c5, 0x850fc2fe,
+0x000000c2, 0x24848b48, 0x000000d0, 0x48fdf162,
+0x8824bc6f, 0x62000000, 0x7f48fdf1, 0x000824bc,
+0x89480000, 0x48102444, 0xe024848b, 0x48000000,
+0x20244489, 0x24848b48, 0x000000f0, 0x24448948,
+0x848b4830, 0x00010024, 0x44894800, 0xf1624024,
+0x8c6f48fd, 0x00008824, 0xc5aab000, 0xb8c892f8,
+0x0000073a, 0x49f5f262, 0xc8249464, 0x62000000,
+0x1f48edf3, 0x000824b4, 0xc5000000, 0xfed693f8,
+0x624375c2, 0x0348f5f3, 0x07b801d9, 0xba000000,
+0x00000000, 0x48fdf262, 0x01b8d07c, 0x62000000,
+0xdb48f5f1, 0xfdf262ca, 0x62d07c48, 0xd448f5f1,
+0xe5f362ca, 0x00f91f48, 0xc793f8c5, 0x4ab8c0fe,
+0x0f000007, 0xc3c9c244, 0x00000000, 0x00000000,
+0x00000008, 0x00000000, 0x0000000e, 0x00000000,
+0x00000012, 0x00000000, 0x00000014, 0x00000000,
+0x00000014, 0x00000000, 0x00000012, 0x00000000,
+0x0000000e, 0x00000000, 0x00000008, 0x00000000,
+0004200,
+};
+asm(".type avx512f_x86_64_D_64i8, STT_NOTYPE;");
+asm(".type avx512f_x86_64_D_64i8, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512f_x86_64_D_64u8[] = {
+0xb85500eb, 0x00000001, 0x000040be, 0x09ba4100,
+0x48000000, 0x8348e589, 0x8148c0e4, 0x000208ec,
+0xff488d00, 0x45d0894d, 0x8948c931, 0x0080c484,
+0xca890000, 0x83c02949, 0xc18501e2, 0xc484894c,
+0x000000c0, 0xc1940f41, 0xd1ff7a8d, 0x03e2c1e9,
+0x44ff6348, 0xca09ce29, 0xc4bc8948, 0x00000100,
+0x8948f789, 0x0180c494, 0x83480000, 0x894804c2,
+0x0140c4bc, 0x89480000, 0x01c0c494, 0xff480000,
+0xf88348c0, 0x629a7509, 0x6f48fdf1, 0x008824b4,
+0xf1620000, 0xb47f48fd, 0xffffc824, 0xfdf162ff,
+0x24946f48, 0xffffffc8, 0x000539b8, 0xedf36200,
+0x00c61f48, 0xd093f8c5, 0x850fc2fe, 0x00000585,
+0x48edf162, 0x88248cd4, 0x62000000, 0x7f48fdf1,
+0x0008248c, 0xf1620000, 0x8c6f48fd, 0x00000824,
+0x053fb800, 0xf1620000, 0xb47348e5, 0x00008824,
+0xf3620100, 0xd31f48f5, 0x93f8c500, 0x0fc2fed2,
+0x00054085, 0xf5f16200, 0x248cfb48, 0x00000088,
+0x48fdf162, 0x48248c7f, 0x62000000, 0x6f48fdf1,
+0x0048249c, 0x44b80000, 0x62000005, 0x1f48edf3,
+0xf8c500db, 0xc2fed393, 0x0507850f, 0xf1620000,
+0x94eb48ed, 0x0000c824, 0xfdf16200, 0x24947f48,
+0xffffffc8, 0x48f5f162, 0xc8248cdb, 0x62000000,
+0xef48e5f1, 0x00c8249c, 0xf1620000, 0x8cdf48f5,
+0xffffc824, 0x0550b8ff, 0xf3620000, 0xe31f48f5,
+0x93f8c500, 0x0fc2fed4, 0x0004b885, 0xfdf16200,
+0x24946f48, 0x00000088, 0x48ddf162, 0xc8249473,
+0x20000000, 0x48edf162, 0xc8249cf4, 0x62000000,
+0xf448ddf1, 0xf5f162e2, 0x20d27348, 0x48f5f162,
+0xc8248cf4, 0x62000000, 0xd448f5f1, 0xf5f162cc,
+0x20f17348, 0x48e5f162, 0xf362c9d4, 0x2d1f48f5,
+0x0000049b, 0x05c8b800, 0xf8c50000, 0xc2fed593,
+0x044f850f, 0xf1620000, 0x947f48fd, 0x00004824,
+0xf5f16200, 0x24b47348, 0x00000048, 0xfdf16203,
+0x248c7f48, 0xffffffc8, 0x48e5f162, 0x4824b473,
+0x02000000, 0x48e5f162, 0xedb8e3d4, 0x62000005,
+0x1f48f5f3, 0xf8c500f4, 0xc2fed693, 0x0403850f,
+0xf1620000, 0x947348f5, 0xffffc824, 0xf16202ff,
+0xc9d448f5, 0x0005f2b8, 0xe5f36200, 0x00f91f48,
+0xd793f8c5, 0x850fc2fe, 0x000003d9, 0xa42444c7,
+0x00000003, 0x087df162, 0xe9244c6e, 0x48edf162,
+0x44c7c9f3, 0x0002a424, 0xf1620000, 0x5c6e087d,
+0xf162e924, 0xdbf348ed, 0x48e5f162, 0x05b8e3d4,
+0x62000006, 0x1f48f5f3, 0xf8c500c4, 0xc2fed093,
+0x038f850f, 0xf1620000, 0x646e087d, 0xf162e924,
+0xccd348f5, 0x48f5f162, 0x09b8c9d4, 0x62000006,
+0x1f48e5f3, 0xf8c500d1, 0xc2fed293, 0x0363850f,
+0xf1620000, 0xbc6f48fd, 0x00014824, 0xeff1c500,
+0xc5f362c9, 0x04c91f48, 0x4875f362, 0x62ffc925,
+0x6fc9fdf1, 0xe5f162d9, 0x62dadb48, 0x7f48fdf1,
+0x0048249c, 0xf2620000, 0xa44748e5, 0x00014824,
+0xf5f16200, 0x24acd448, 0x00000148, 0x48fdf162,
+0x4824ac7f, 0x62000001, 0x4748e5f2, 0x0148249c,
+0x21b80000, 0x62000006, 0x7f48fdf1, 0x0008249c,
+0xf1620000, 0xdbd448e5, 0x48ddf362, 0xc500db1f,
+0xfed393f8, 0xda850fc2, 0x62000002, 0x6f48fdf1,
+0x000824b4, 0x26b80000, 0x62000006, 0x4548cdf2,
+0x0148249c, 0xf3620000, 0xa41f48e5, 0x00004824,
+0xf8c50000, 0xc2fed493, 0x02a7850f, 0xf2620000,
+0x9c3b48ed, 0x0000c824, 0xedf26200, 0x24a43f48,
+0x000000c8, 0x48edf162, 0xc82494d4, 0x62000000,
+0xd448e5f1, 0x0634b8dc, 0xf3620000, 0xea1f48e5,
+0x93f8c500, 0x0fc2fed5, 0x00026885, 0xfdf16200,
+0x24bc6f48, 0x00000088, 0x00064eb8, 0xfdf16200,
+0x24946f48, 0x000000c8, 0x48c5f362, 0x621bdf43,
+0x70487df1, 0xf3624edb, 0xf21f48e5, 0x93f8c500,
+0x0fc2fed6, 0x00022c85, 0xedf16200, 0xb8d9d448,
+0x00000653, 0x48e5f262, 0x88249c36, 0x62000000,
+0x1f48e5f3, 0xf8c500fa, 0xc2fed793, 0x0203850f,
+0xf3620000, 0x9c0048fd, 0x00008824, 0x58b81b00,
+0x62000006, 0x4348e5f3, 0xf3624edb, 0xc21f48e5,
+0x93f8c500, 0x0fc2fed0, 0x0001d885, 0xfdf16200,
+0x249c6f48, 0x00000088, 0x00065db8, 0x44c74800,
+0x0009a824, 0xf2620000, 0x6c5948fd, 0xf162f524,
+0xe2d448e5, 0x48d5f362, 0xc500cc1f, 0xfed193f8,
+0x9e850fc2, 0xb8000001, 0x00000009, 0x48fdf262,
+0xf362e87c, 0xd41f48d5, 0x0661b800, 0xf8c50000,
+0xc2fed293, 0x017b850f, 0xf3620000, 0x9c3b48fd,
+0xffffa824, 0xf26200ff, 0xa45b48fd, 0xffffa824,
+0xe5f362ff, 0x249c3a48, 0xffffffa8, 0xddf36201,
+0x00db1f48, 0xc393f8c5, 0x6cb8c0fe, 0x0f000006,
+0x00014085, 0xfdf16200, 0x249c6f48, 0x00000188,
+0x48edf262, 0x88249c76, 0x62000000, 0x6f48fdf1,
+0x01c824b4, 0xf2620000, 0x947e48cd, 0x00008824,
+0xf5f16200, 0xb8cad448, 0x000006a6, 0x48edf362,
+0x08249425, 0x55000001, 0x2444c748, 0x000004a8,
+0xf5f16200, 0x62cbfb48, 0xef48f5f1, 0x0108248c,
+0xf1620000, 0xcafb48f5, 0x48fdf262, 0xf5245459,
+0x48f5f362, 0xc500e21f, 0xfed493f8, 0xc2850fc2,
+0x48000000, 0xd024848b, 0x62000000, 0x6f48fdf1,
+0x008824bc, 0xf1620000, 0xbc7f48fd, 0x00000824,
+0x44894800, 0x8b481024, 0x00e02484, 0x89480000,
+0x48202444, 0xf024848b, 0x48000000, 0x30244489,
+0x24848b48, 0x00000100, 0x24448948, 0xfdf16240,
+0x248c6f48, 0x00000088, 0xf8c5aab0, 0x3ab8c892,
+0x62000007, 0x6449f5f2, 0x00c82494, 0xf3620000,
+0xac1f48ed, 0x00000824, 0xf8c50000, 0xc2fed593,
+0xf3624375, 0xd90348f5, 0x0007b801, 0x00ba0000,
+0x62000000, 0x7c48fdf2, 0x0001b8d0, 0xf1620000,
+0xcadb48f5, 0x48fdf262, 0xf162d07c, 0xcad448f5,
+0x48e5f362, 0xc500f11f, 0xfec693f8, 0x074ab8c0,
+0x440f0000, 0x00c3c9c2, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000008, 0x00000000, 0x0000000e, 0x00000000,
+0x00000012, 0x00000000, 0x00000014, 0x00000000,
+0x00000014, 0x00000000, 0x00000012, 0x00000000,
+0x0000000e, 0x00000000, 0x00000008, 0x00000000,
+0003300,
+};
+asm(".type avx512f_x86_64_D_64u8, STT_NOTYPE;");
+asm(".type avx512f_x86_64_D_64u8, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512f_x86_64_D_64f4[] = {
+0x000333e9, 0x01b85500, 0xb9000000, 0x00000011,
+0x48e58948, 0x48c0e483, 0x0088ec81, 0xf1620000,
+0x2d10087e, 0x00000b18, 0x087ef162, 0xf0246c11,
+0xc82af2c5, 0xf162ca89, 0x6c11087e, 0xc2291184,
+0x087ef162, 0xf1844c11, 0xca2af2c5, 0x087ef162,
+0x01844c11, 0x48c0ff48, 0x7511f883, 0x7cf162d3,
+0x24942848, 0xffffffc8, 0x487cf162, 0x08248c28,
+0x62000000, 0x58586cf1, 0x000ac31d, 0x64f16200,
+0x62d95948, 0x28487cf1, 0x75f262e1, 0x24a49848,
+0xffffffc8, 0x0000a7b8, 0x64f16200, 0x00c4c248,
+0xd093f8c5, 0x0fc2ff66, 0x00028985, 0x7cf16200,
+0x62f12848, 0x9e4875f2, 0xffc824b4, 0xabb8ffff,
+0x62000000, 0x18487df2, 0x000a3325, 0x65f16200,
+0x62dcef48, 0xc24864f1, 0xf8c500ce, 0xff66d193,
+0x4f850fc2, 0x62000002, 0x58586cf1, 0x000a1315,
+0x6cf16200, 0x62d15948, 0x28487cf1, 0x75f262d9,
+0x249c9a48, 0xffffffc8, 0x0000afb8, 0x6cf16200,
+0x00d3c248, 0xd293f8c5, 0x0fc2ff66, 0x00021585,
+0x7cf16200, 0x62d92848, 0xef486df1, 0x00b3b8d4,
+0xf2620000, 0x9c9c4875, 0xffffc824, 0x6cf162ff,
+0x00dbc248, 0xd393f8c5, 0x0fc2ff66, 0x0001e585,
+0x7cf16200, 0x24942848, 0xffffffc8, 0x486cf162,
+0xf262d958, 0x7418487d, 0xf162f024, 0xbc28487c,
+0x00000824, 0x00bbb800, 0xf2620000, 0xf2984845,
+0x4864f162, 0xc500e6c2, 0x66d493f8, 0x850fc2ff,
+0x000001a2, 0x487cf162, 0x0824bc28, 0x62000000,
+0x28487cf1, 0x65f162f2, 0xb8dcef48, 0x000000c0,
+0x5845f262, 0xf024749e, 0x4864f162, 0xc500eec2,
+0x66d593f8, 0x850fc2ff, 0x0000016a, 0x486cf162,
+0xf262c95c, 0x5c18487d, 0xf162f024, 0xbc28487c,
+0x00000824, 0x00c5b800, 0xf2620000, 0xda9a4845,
+0x4874f162, 0xc500f3c2, 0x66d693f8, 0x850fc2ff,
+0x00000132, 0x487cf162, 0x0824bc28, 0x62000000,
+0x28487cf1, 0x75f162da, 0xb8ccef48, 0x000000ca,
+0x5845f262, 0xf0245c9c, 0x4874f162, 0xc500fbc2,
+0x66d793f8, 0x850fc2ff, 0x000000fa, 0x486cf162,
+0x08249c59, 0x62000000, 0x11087ef1, 0x62f1246c,
+0x28487cf1, 0x004824b4, 0xf1620000, 0x8cef485d,
+0x00004824, 0x65f26200, 0x2474b658, 0x65f262f1,
+0x244cb658, 0x7cf162f1, 0x249c2848, 0x00000008,
+0x487cf162, 0xd4b8e228, 0x62000000, 0xa64865f2,
+0x004824a4, 0xf1620000, 0xc4c2484c, 0x93f8c500,
+0xc2ff66d0, 0x008c850f, 0xf2620000, 0x9ca7486d,
+0x00004824, 0x00d8b800, 0xf1620000, 0xcbc24874,
+0x93f8c500, 0xc2ff66d1, 0xf1626c75, 0x9c28487c,
+0x00004824, 0x6cf16200, 0x24ac5948, 0x00000008,
+0x487cf162, 0xf262e328, 0x64b65855, 0xf162f124,
+0xea28487c, 0x4865f262, 0x0824ac96, 0xb8000000,
+0x000000de, 0x485cf162, 0xc500d5c2, 0x66d293f8,
+0x2275c2ff, 0x4865f262, 0x08249497, 0xb8000000,
+0x000000e2, 0x4874f162, 0xc500dac2, 0x66d393f8,
+0x0275c2ff, 0xc3c9c031, 0xbec03155, 0x00000010,
+0x48e58948, 0x48c0e483, 0x0280ec81, 0x508d0000,
+0xc5c18901, 0x89ca2af2, 0x62c229f2, 0x11087ef1,
+0xc540844c, 0x89ca2af2, 0x7ef162c2, 0x844c1108,
+0x7ef16250, 0x890d1008, 0x83000007, 0x0a7501e2,
+0x087ef162, 0x07b60d10, 0xf1620000, 0x4c11087e,
+0xe2c16084, 0x09e9d104, 0x849489ca, 0x000001c0,
+0x8908c283, 0x02008494, 0xff480000, 0xf88348c0,
+0x629b7510, 0x28487cf1, 0x62042474, 0x29487cf1,
+0x62012474, 0x28487cf1, 0xb801244c, 0x00000539,
+0x4874f162, 0xc500c6c2, 0x66d093f8, 0x850fc2ff,
+0x000006e4, 0x4874f162, 0x04245458, 0x487cf162,
+0x02245429, 0x487cf162, 0x04247c28, 0x00053fb8,
+0x7cf16200, 0x24542848, 0x44f16202, 0x62df5848,
+0xc2486cf1, 0xf8c500d3, 0xff66d293, 0xa5850fc2,
+0x62000006, 0x5c486cf1, 0x62042454, 0x29487cf1,
+0x62032454, 0xc24874f1, 0x0003245c, 0x000544b8,
+0x93f8c500, 0xc2ff66d3, 0x067a850f, 0xf1620000,
+0x7428487c, 0xf1620524, 0x4c594874, 0xf1620424,
+0xde59484c, 0x487cf162, 0x04245428, 0x486cf162,
+0xf162ee58, 0x645c486c, 0xf1620524, 0xcb5c4874,
+0x00055bb8, 0x5cf16200, 0x62e55948, 0xc24874f1,
+0xf8c500e4, 0xff66d493, 0x29850fc2, 0x62000006,
+0x59486cf1, 0x6206244c, 0x29487cf1, 0x6201244c,
+0x5e486cf1, 0xb8062454, 0x00000564, 0x4874f162,
+0xc500eac2, 0x66d593f8, 0x850fc2ff, 0x000005f8,
+0x487df262, 0x06260d18, 0x67b80000, 0x62000005,
+0x28487cf1, 0x6206245c, 0xef4865f1, 0x75f162d1,
+0x244cef48, 0x6cf16204, 0x24545948, 0x6cf16201,
+0x00f1c248, 0xd693f8c5, 0x0fc2ff66, 0x0005b785,
+0x7df16200, 0x244c5b48, 0x7cf16204, 0x62c95b48,
+0xc24874f1, 0x0004247c, 0x00056eb8, 0x93f8c500,
+0xc2ff66d7, 0x058e850f, 0xf2620000, 0x4c4c487d,
+0xf1620424, 0x4c29487c, 0xf1620124, 0x6428487c,
+0xf2620424, 0x4c4c487d, 0xf1620124, 0xc95b487d,
+0x487cf162, 0x75b8c95b, 0x62000005, 0xc24874f1,
+0xf8c500c4, 0xff66d093, 0x49850fc2, 0x62000005,
+0x59485cf1, 0x7cf162cc, 0x244c2948, 0x7df26201,
+0x244c4e48, 0x7cf16201, 0x244c2948, 0x7cf16202,
+0x244c2848, 0x057cb802, 0xf2620000, 0xd14c487d,
+0x487df162, 0xf162d25b, 0xd25b487c, 0x486cf162,
+0xc500d4c2, 0x66d293f8, 0x850fc2ff, 0x000004f8,
+0x487df262, 0x0424544c, 0x487df162, 0xf162c95b,
+0xd25b487d, 0x487cf162, 0xf162c95b, 0xd25b487c,
+0x4874f162, 0xb800dac2, 0x0000057e, 0xd393f8c5,
+0x0fc2ff66, 0x0004bf85, 0x7cf16200, 0x24547948,
+0x7ff16204, 0x62d27a48, 0x28487cf1, 0xb804244c,
+0x0000058f, 0x486cf162, 0xc500e1c2, 0x66d493f8,
+0x850fc2ff, 0x00000490, 0x4874f162, 0xf162d159,
+0x5429487c, 0xf1620124, 0x5451487c, 0xf1620124,
+0xe9c2486c, 0x059cb800, 0xf8c50000, 0xff66d593,
+0x61850fc2, 0x62000004, 0x18487df2, 0x0004cf15,
+0x6cf16200, 0x62e15e48, 0x29487cf1, 0x62012464,
+0x08487df3, 0x0b01246c, 0x0005a4b8, 0x7cf16200,
+0xa9252848, 0x62000004, 0xc2485cf1, 0xf8c500f5,
+0xff66d693, 0x1d850fc2, 0x62000004, 0x594864f1,
+0x64f162e1, 0x245c5948, 0x7cf16205, 0x245c2948,
+0x5cf16202, 0x245c5f48, 0x5cf16202, 0x24645d48,
+0x7cf16202, 0x24642948, 0x64f16202, 0x245c5848,
+0x063db802, 0xf1620000, 0x4c584874, 0xf1620524,
+0x5c594864, 0xf1620624, 0xf9c24864, 0x93f8c500,
+0xc2ff66d7, 0x03be850f, 0xf1620000, 0x7c28487c,
+0x4eb80424, 0x62000006, 0x28487cf1, 0x6205245c,
+0x234845f3, 0xf3621bcf, 0xc904487d, 0x74f1621b,
+0x00cbc248, 0xd193f8c5, 0x0fc2ff66, 0x00038785,
+0x7cf16200, 0x244c2848, 0x0653b804, 0xf3620000,
+0xe1234875, 0x7df3621b, 0x1be40448, 0x485cf162,
+0xc500c3c2, 0x66d093f8, 0x850fc2ff, 0x00000358,
+0x4864f162, 0x5db8e958, 0xc7000006, 0x02402484,
+0x00000000, 0xf2624188, 0xa418487d, 0x00024024,
+0x5cf16200, 0x00d5c248, 0xd293f8c5, 0x0fc2ff66,
+0x00032385, 0x7df36200, 0x244c1948, 0xf2620024,
+0x641a487d, 0xf3622424, 0x4c184875, 0x62012424,
+0x184875f3, 0x0224244c, 0x4875f362, 0x24244c18,
+0x5cf16203, 0x00d9c248, 0xc393f8c5, 0xb8c0ff66,
+0x0000067c, 0x02de850f, 0xf1620000, 0x4c28487c,
+0xf2620724, 0x4c774865, 0xf1620424, 0x4c29487c,
+0xf1620124, 0x746f487d, 0xf2620824, 0x5c7f484d,
+0xf1620424, 0x5c29487c, 0xf1620224, 0xcb5c4874,
+0x0006a6b8, 0x2484c700, 0x00000240, 0x41000000,
+0x4874f162, 0x06244c59, 0x487df262, 0x40249c18,
+0x62000002, 0xc24874f1, 0xf16200e3, 0x4c29487c,
+0xf8c50324, 0xff66d493, 0x69850fc2, 0x62000002,
+0x28487cf1, 0x3104247c, 0x7cf162c0, 0x247c2948,
+0x7ef16209, 0x048c1008, 0x00000240, 0x087ef162,
+0x08044c11, 0x04c08348, 0x20f88348, 0xf162e375,
+0x4c5a487c, 0xf1620124, 0x4c2948fd, 0xf1620124,
+0x4c5a48fd, 0xfcc50124, 0x40248c29, 0x31000002,
+0x7ef162c0, 0x048c1008, 0x00000240, 0x087cf162,
+0x40044c2e, 0x0a74027a, 0x0006f1b8, 0x01f6e900,
+0x83480000, 0x834804c0, 0xd57520f8, 0x487ef162,
+0x04245c12, 0x487df262, 0x02160d18, 0x17b80000,
+0x62000007, 0x584874f1, 0x6206244c, 0x18487df2,
+0x00020325, 0x64f16200, 0x245c5c48, 0x74f16204,
+0x62cc5948, 0xc24864f1, 0xf8c500e9, 0xff66d593,
+0xa1850fc2, 0x62000001, 0x16487ef1, 0x6204244c,
+0x29487cf1, 0x6201244c, 0x58486cf1, 0xb8062454,
+0x0000071e, 0x487cf162, 0x04245c28, 0x4874f162,
+0xf162cb5c, 0xd459486c, 0x4874f162, 0xc500f2c2,
+0x66d693f8, 0x850fc2ff, 0x0000015c, 0x487cf162,
+0x02245c29, 0x000004b8, 0x7ef16200, 0x044c1008,
+0xc0834850, 0x7ef16208, 0x044c1108, 0xf883481e,
+0x62e67544, 0x28487cf1, 0xb804246c, 0xffffaaaa,
+0xc892f8c5, 0x00073ab8, 0x55f26200, 0x244c6549,
+0x74f16205, 0x247cc248, 0xf8c50002, 0xff66d793,
+0x01850fc2, 0x62000001, 0x10087ef1, 0x00016f1d,
+0x7cf16200, 0x244c2848, 0x7cf16205, 0x24742848,
+0x7ef16204, 0x249c1108, 0x00000240, 0x584df262,
+0x40248cb6, 0x62000002, 0x28487cf1, 0xb804247c,
+0x00000743, 0x4844f162, 0x0524545c, 0x4944f162,
+0x05245458, 0x4874f162, 0xc500cac2, 0x66d193f8,
+0x850fc2ff, 0x000000a0, 0x487df362, 0x04244c26,
+0x7cf16200, 0x244c2948, 0x7df26201, 0x244c4248,
+0x7cf16204, 0x244c2948, 0x31c03102, 0x76f162d2,
+0x62ca7b08, 0x2e087cf1, 0x7a20844c, 0x8d5d755f,
+0x708d0178, 0x83fe2102, 0xd28301fe, 0x75c78500,
+0x7cf1620c, 0x845c2e08, 0x75487a10, 0xc0ff4846,
+0x10f88348, 0xf162c775, 0x7428487c, 0x7db80124,
+0x62000007, 0x28487cf1, 0x6204247c, 0x2c484df2,
+0x6202244c, 0xc24844f1, 0xf8c500c1, 0xff66d093,
+0xe81575c2, 0xfffff54d, 0x0cebd8f7, 0x000773b8,
+0xb805eb00, 0x00000778, 0x0000c3c9, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x80000000, 0xbf800000, 0x3f000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x3f800000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0005600,
+};
+asm(".type avx512f_x86_64_D_64f4, STT_NOTYPE;");
+asm(".type avx512f_x86_64_D_64f4, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512f_x86_64_D_64f8[] = {
+0x000326e9, 0x01b85500, 0xb9000000, 0x00000009,
+0x48e58948, 0x48c0e483, 0x0088ec81, 0xf1620000,
+0x2d1008ff, 0x00000a18, 0x08fff162, 0xf7246c11,
+0xc82af3c5, 0xf162ca89, 0x6c1108ff, 0xc22908c4,
+0x08fff162, 0xf8c44c11, 0xca2af3c5, 0x08fff162,
+0x48c40c11, 0x8348c0ff, 0xd47509f8, 0x48fdf162,
+0xc8249428, 0x62ffffff, 0x2848fdf1, 0x0008248c,
+0xf1620000, 0x1d5858ed, 0x000009c4, 0x48e5f162,
+0xf162d959, 0xe12848fd, 0x48f5f262, 0xc824a498,
+0xb8ffffff, 0x000000a7, 0x48e5f162, 0xc500c4c2,
+0xfed093f8, 0x7e850fc2, 0x62000002, 0x2848fdf1,
+0xf5f262f1, 0x24b49e48, 0xffffffc8, 0x0000abb8,
+0xfdf26200, 0x35251948, 0x62000009, 0xef48e5f1,
+0xe5f162dc, 0x00cec248, 0xd193f8c5, 0x850fc2fe,
+0x00000245, 0x58edf162, 0x091a1558, 0xf1620000,
+0xd15948ed, 0x48fdf162, 0xf262d928, 0x9c9a48f5,
+0xffffc824, 0x00afb8ff, 0xf1620000, 0xd3c248ed,
+0x93f8c500, 0x0fc2fed2, 0x00020c85, 0xfdf16200,
+0x62d92848, 0xef48edf1, 0x00b3b8d4, 0xf2620000,
+0x9c9c48f5, 0xffffc824, 0xedf162ff, 0x00dbc248,
+0xd393f8c5, 0x850fc2fe, 0x000001dd, 0x48fdf162,
+0xc8249428, 0x62ffffff, 0x5848edf1, 0xfdf262d9,
+0x24741948, 0xfdf162f7, 0x24bc2848, 0x00000008,
+0x0000bbb8, 0xc5f26200, 0x62f29848, 0xc248e5f1,
+0xf8c500e6, 0xc2fed493, 0x019b850f, 0xf1620000,
+0xbc2848fd, 0x00000824, 0xfdf16200, 0x62f22848,
+0xef48e5f1, 0x00c0b8dc, 0xf2620000, 0x749e58c5,
+0xf162f724, 0xeec248e5, 0x93f8c500, 0x0fc2fed5,
+0x00016485, 0xedf16200, 0x62c95c48, 0x1948fdf2,
+0x62f7245c, 0x2848fdf1, 0x000824bc, 0xc5b80000,
+0x62000000, 0x9a48c5f2, 0xf5f162da, 0x00f3c248,
+0xd693f8c5, 0x850fc2fe, 0x0000012d, 0x48fdf162,
+0x0824bc28, 0x62000000, 0x2848fdf1, 0xf5f162da,
+0xb8ccef48, 0x000000ca, 0x58c5f262, 0xf7245c9c,
+0x48f5f162, 0xc500fbc2, 0xfed793f8, 0xf6850fc2,
+0x62000000, 0x5948edf1, 0x0008249c, 0xf1620000,
+0x6c1108ff, 0xf162f824, 0xb42848fd, 0x00004824,
+0xddf16200, 0x248cef48, 0x00000048, 0x58e5f262,
+0xf82474b6, 0x58e5f262, 0xf8244cb6, 0x48fdf162,
+0x08249c28, 0x62000000, 0x2848fdf1, 0x00d4b8e2,
+0xf2620000, 0xa4a648e5, 0x00004824, 0xcdf16200,
+0x00c4c248, 0xd093f8c5, 0x850fc2fe, 0x00000089,
+0x48edf262, 0x48249ca7, 0xb8000000, 0x000000d8,
+0x48f5f162, 0xc500cbc2, 0xfed193f8, 0x626a75c2,
+0x2848fdf1, 0x0048249c, 0xf1620000, 0xac5948ed,
+0x00000824, 0xfdf16200, 0x62e32848, 0xb658d5f2,
+0x62f82464, 0x2848fdf1, 0xe5f262ea, 0x24ac9648,
+0x00000008, 0x0000deb8, 0xddf16200, 0x00d5c248,
+0xd293f8c5, 0x2175c2fe, 0x48e5f262, 0x08249497,
+0xb8000000, 0x000000e2, 0x48f5f162, 0xc500dac2,
+0xfed393f8, 0x310275c2, 0x55c3c9c0, 0x08bec031,
+0x48000000, 0x8348e589, 0x8148c0e4, 0x000240ec,
+0x01508d00, 0xbd3d8b48, 0x89000006, 0x2af3c5c1,
+0x29f289ca, 0xfff162c2, 0xc44c1108, 0x2af3c520,
+0x62c289ca, 0x1108fff1, 0x6228c44c, 0x6e08fdf1,
+0x01e283cf, 0x8b480d75, 0x0006c33d, 0xfdf16200,
+0x62cf6e08, 0x1108fff1, 0xc130c44c, 0xe9d103e2,
+0x8948ca09, 0x01c0c494, 0x83480000, 0x894804c2,
+0x0200c494, 0xff480000, 0xf88348c0, 0x62927508,
+0x2848fdf1, 0x62042474, 0x2948fdf1, 0x62012474,
+0x2848fdf1, 0xb801244c, 0x00000539, 0x48f5f162,
+0xc500c6c2, 0xfed093f8, 0xfe850fc2, 0x62000005,
+0x5848f5f1, 0x62042454, 0x2948fdf1, 0x62022454,
+0x2848fdf1, 0xb804247c, 0x0000053f, 0x48fdf162,
+0x02245428, 0x48c5f162, 0xf162df58, 0xd3c248ed,
+0x93f8c500, 0x0fc2fed2, 0x0005c085, 0xedf16200,
+0x24545c48, 0xfdf16204, 0x24542948, 0xf5f16203,
+0x245cc248, 0x44b80003, 0xc5000005, 0xfed393f8,
+0x96850fc2, 0x62000005, 0x2848fdf1, 0x6205246c,
+0x5948f5f1, 0x6204244c, 0x5948d5f1, 0xfdf162dd,
+0x24542848, 0xedf16204, 0x62ed5848, 0x5c48edf1,
+0x62052464, 0x5c48f5f1, 0x055bb8cb, 0xf1620000,
+0xe55948dd, 0x48f5f162, 0xc500e4c2, 0xfed493f8,
+0x46850fc2, 0x62000005, 0x5948edf1, 0x6206244c,
+0x2948fdf1, 0x6201244c, 0x5e48edf1, 0xb8062454,
+0x00000564, 0x48f5f162, 0xc500eac2, 0xfed593f8,
+0x16850fc2, 0x62000005, 0x1948fdf2, 0x00052f0d,
+0x0567b800, 0xf1620000, 0x542848fd, 0xf1620624,
+0xd9ef48ed, 0x48f5f162, 0x04244cef, 0x48e5f162,
+0x01245c59, 0x48e5f162, 0xc500f1c2, 0xfed693f8,
+0xd6850fc2, 0x62000004, 0xe648fff1, 0x6204244c,
+0xe6487ef1, 0xf5f162c9, 0x247cc248, 0x6eb80004,
+0xc5000005, 0xfed793f8, 0xae850fc2, 0x62000004,
+0x4c48fdf2, 0x6204244c, 0x2948fdf1, 0x6201244c,
+0x2848fdf1, 0x62042464, 0x4c48fdf2, 0x6201244c,
+0xe648fff1, 0x7ef162c9, 0xb8c9e648, 0x00000575,
+0x48f5f162, 0xc500c4c2, 0xfed093f8, 0x6a850fc2,
+0x62000004, 0x5948ddf1, 0xfdf162cc, 0x244c2948,
+0xfdf26201, 0x244c4e48, 0xfdf16201, 0x244c2948,
+0xfdf16202, 0x244c2848, 0x057cb802, 0xf2620000,
+0xd94c48fd, 0x48fff162, 0xf162dbe6, 0xdbe6487e,
+0x48e5f162, 0xc500d4c2, 0xfed293f8, 0x1a850fc2,
+0x62000004, 0x4c48fdf2, 0x6204245c, 0xe648fff1,
+0xfff162c9, 0x62dbe648, 0xe6487ef1, 0x7ef162c9,
+0x62dbe648, 0xc248f5f1, 0x7eb800db, 0xc5000005,
+0xfed393f8, 0xe2850fc2, 0x62000003, 0x7948fcf1,
+0x6204244c, 0x7a487ef1, 0xfdf162d9, 0x244c2848,
+0x058fb804, 0xf1620000, 0xe1c248e5, 0x93f8c500,
+0x0fc2fed4, 0x0003b485, 0xf5f16200, 0x62d95948,
+0x2948fdf1, 0x6201245c, 0x5148fdf1, 0x6201245c,
+0xc248e5f1, 0x9cb800e9, 0xc5000005, 0xfed593f8,
+0x86850fc2, 0x62000003, 0x1948fdf2, 0x0003df1d,
+0xe5f16200, 0x62d95e48, 0x2948fdf1, 0x6201245c,
+0x0948fdf3, 0x0b012464, 0x0005a4b8, 0xfdf16200,
+0xb91d2848, 0x62000003, 0xc248e5f1, 0xf8c500f4,
+0xc2fed693, 0x0343850f, 0xf1620000, 0xd95948ed,
+0x48edf162, 0x05245459, 0x48fdf162, 0x02245429,
+0x48e5f162, 0x0224545f, 0x48e5f162, 0x02245c5d,
+0x48fdf162, 0x02245c29, 0x48edf162, 0x02245458,
+0x00063db8, 0xf5f16200, 0x244c5848, 0xedf16205,
+0x24545948, 0xedf16206, 0x00f9c248, 0xd793f8c5,
+0x850fc2fe, 0x000002e5, 0x48fdf162, 0x04247428,
+0x00064eb8, 0xfdf16200, 0x24542848, 0xcdf36205,
+0x1bce2348, 0x48fdf362, 0x6255c905, 0xc248f5f1,
+0xf8c500ca, 0xc2fed193, 0x02af850f, 0xf1620000,
+0x4c2848fd, 0x53b80424, 0x62000006, 0x2348f5f3,
+0xf3621bd9, 0xdb0548fd, 0xe5f16255, 0x00c2c248,
+0xd093f8c5, 0x850fc2fe, 0x00000281, 0x48edf162,
+0x8b48e158, 0x0002a705, 0x44894800, 0x5db82024,
+0x62000006, 0x1948fdf2, 0x6204245c, 0xc248e5f1,
+0xf8c500d4, 0xc2fed293, 0x024f850f, 0xf3620000,
+0x4c1b48fd, 0x62000124, 0x1b48fdf2, 0x6201245c,
+0x1a48f5f3, 0x0101244c, 0x48e5f162, 0xc500d9c2,
+0xfec393f8, 0x066cb8c0, 0x850f0000, 0x0000021d,
+0x48fdf162, 0x07244c28, 0x48edf262, 0x04244c77,
+0x48fdf162, 0x08247c6f, 0x48c5f262, 0x0424547f,
+0x48f5f162, 0x8b48ca5c, 0x00022b05, 0xf5f16200,
+0x244c5948, 0x44894806, 0xa6b82024, 0x62000006,
+0x1948fdf2, 0x62042454, 0xc248f5f1, 0xf16200e2,
+0x4c2948fd, 0xf8c50324, 0xc2fed493, 0x01bb850f,
+0xf1620000, 0x541248ff, 0xf2620424, 0x0d1948fd,
+0x000001d4, 0x000717b8, 0xf5f16200, 0x244c5848,
+0xfdf16206, 0x245c2848, 0xf5f16204, 0xcd0d5958,
+0x62000001, 0x5c48edf1, 0xedf162d3, 0x00e9c248,
+0xd593f8c5, 0x850fc2fe, 0x00000171, 0x08fff162,
+0x29244c10, 0x48fdf162, 0x02245c29, 0x08fff162,
+0x11244c11, 0x08fff162, 0x2b244c10, 0x08fff162,
+0x13244c11, 0x08fff162, 0x2d244c10, 0x08fff162,
+0x15244c11, 0x08fff162, 0x2f244c10, 0x08fff162,
+0x17244c11, 0x48fdf162, 0x04246c28, 0xf8c5aab0,
+0x3ab8c892, 0x62000007, 0x6549d5f2, 0x6205244c,
+0xc248f5f1, 0x00022474, 0xd693f8c5, 0x850fc2fe,
+0x000000f9, 0x08fff162, 0x01521d10, 0xf1620000,
+0x4c2848fd, 0xf1620524, 0x742848fd, 0xf1620424,
+0x5c1108ff, 0xf2620424, 0x4cb658cd, 0xf1620424,
+0x7c2848fd, 0x43b80424, 0x62000007, 0x5c48c5f1,
+0x62052454, 0x5849c5f1, 0x62052454, 0xc248f5f1,
+0xf8c500fa, 0xc2fed793, 0x009f850f, 0xf3620000,
+0x4c2648fd, 0x62000424, 0x2948fdf1, 0x6201244c,
+0x4248fdf2, 0x6204244c, 0x2948fdf1, 0x3102244c,
+0x62d231c0, 0x7b0877f1, 0xfdf162ca, 0xc44c2e08,
+0x755e7a10, 0x01788d5c, 0x2102708d, 0x01fe83fe,
+0x8500d283, 0x620c75c7, 0x2e08fdf1, 0x7a08c45c,
+0x48457547, 0x8348c0ff, 0xc77508f8, 0x48fdf162,
+0x01247428, 0x00077db8, 0xfdf16200, 0x247c2848,
+0xcdf26204, 0x244c2c48, 0xc5f16202, 0x00c9c248,
+0xd193f8c5, 0x1575c2fe, 0xfff638e8, 0xebd8f7ff,
+0x0773b80c, 0x05eb0000, 0x000778b8, 0x00c3c900,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x80000000, 0x00000000, 0xbff00000,
+0x00000000, 0x40220000, 0x00000000, 0x40100000,
+0x00000000, 0x3fe00000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x3ff00000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0005200,
+};
+asm(".type avx512f_x86_64_D_64f8, STT_NOTYPE;");
+asm(".type avx512f_x86_64_D_64f8, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512f_x86_64_D_16i4[] = {
+0xb85500eb, 0x00000001, 0x000020b9, 0x05b94100,
+0x48000000, 0x8348e589, 0x788d28ec, 0xc88945ff,
+0x9c854489, 0x2941fa89, 0x01e283c0, 0x85448944,
+0x01fa83ac, 0xe283d219, 0x85caff02, 0x940f40f8,
+0x855489c7, 0xb60f40bc, 0x89f929ff, 0x48cc854c,
+0x8348c0ff, 0xc27505f8, 0x087df162, 0x62fa556f,
+0x7f087df1, 0xf162f755, 0x4d6f087d, 0x0539b8f7,
+0xf3620000, 0xc21f0875, 0x93f8c500, 0x0ffa80d0,
+0x04e0850f, 0xf1620000, 0x55fe0875, 0x7df162fa,
+0xf8557f08, 0x087df162, 0x62f8556f, 0x720865f1,
+0xb801fa75, 0x0000053f, 0x086df362, 0xc500d31f,
+0x80d293f8, 0x850f0ffa, 0x000004aa, 0x086df162,
+0x62fa55fa, 0x7f087df1, 0xf362f955, 0x5d1f0875,
+0x44b800f9, 0xc5000005, 0x80d393f8, 0x850f0ffa,
+0x00000482, 0x087df162, 0x62fb556f, 0x400875f2,
+0xf262fa4d, 0xd240086d, 0x087df162, 0x62fa656f,
+0xfe085df1, 0xf162fb6d, 0x5dfa085d, 0x75f162fb,
+0xb8cafa08, 0x0000055b, 0x0865f262, 0xf362dd40,
+0xe31f0875, 0x93f8c500, 0x0ffa80d4, 0x0434850f,
+0xf2620000, 0x4d40085d, 0x75f362fb, 0x2c2d1f08,
+0x00000004, 0x0005c8b8, 0x93f8c500, 0x0ffa80d5,
+0x0410850f, 0xf1620000, 0x4def085d, 0x7df162fc,
+0xf74d7f08, 0x087df162, 0xf262c87e, 0x4d2808f5,
+0x556348fb, 0x489848b0, 0x48c2af0f, 0x48b85563,
+0x48904589, 0xff788563, 0x0f48ffff, 0x8948c2af,
+0xe1b89845, 0x62000005, 0x1f0875f3, 0xc500f975,
+0x80d693f8, 0x850f0ffa, 0x000003ba, 0x085df262,
+0x62fc5540, 0x7f087df1, 0xf162f955, 0x75720875,
+0xf16203f9, 0x4d7f087d, 0x65f162f7, 0xf9757208,
+0x65f16202, 0xb8ebfe08, 0x000005ed, 0x0875f362,
+0xc500fd1f, 0x80d793f8, 0x850f0ffa, 0x00000376,
+0x0875f162, 0x02f76572, 0x0875f162, 0xf2b8c9fe,
+0x62000005, 0x1f0865f3, 0xf8c500c1, 0xfa80d093,
+0x4f850f0f, 0xc7000003, 0xffff6c85, 0x000003ff,
+0x85634800, 0xffffff6c, 0x08fdf162, 0xf162c86e,
+0xc9f2086d, 0xff6c85c7, 0x0002ffff, 0x63480000,
+0xffff6c85, 0xfdf162ff, 0x62f06e08, 0xf2086df1,
+0x6df162d6, 0xb8dafe08, 0x00000605, 0x0875f362,
+0xc500cb1f, 0x80d193f8, 0x850f0ffa, 0x000002f6,
+0x6c856348, 0x62ffffff, 0x6e08fdf1, 0x75f162f8,
+0x62cfe208, 0xfe0875f1, 0x0609b8c9, 0xf3620000,
+0xd11f086d, 0x93f8c500, 0x0ffa80d2, 0x02c4850f,
+0xf1620000, 0x756f087d, 0x75f162fd, 0x62c9ef08,
+0x1f084df3, 0xf26206c9, 0x5540895d, 0x6df262fc,
+0xfd5d4708, 0x087df162, 0x62fd7d6f, 0xfa0845f1,
+0x0002ab0d, 0x7df16200, 0xfd4d7f08, 0x086df262,
+0xb8fd4d47, 0x00000621, 0x0875f162, 0xf362e9fe,
+0xdd1f0865, 0x93f8c500, 0x0ffa80d3, 0x0264850f,
+0xf2620000, 0x4d460875, 0x0626b8fd, 0xf3620000,
+0xe21f0875, 0x93f8c500, 0x0ffa80d4, 0x0244850f,
+0xf1620000, 0x4d6f087d, 0x75f262fc, 0xfb554008,
+0x087df162, 0x62f8557f, 0x400875f2, 0x65f262dc,
+0xf8553d08, 0x0865f262, 0x62f85d39, 0x7f087df1,
+0xf162f85d, 0x55fe086d, 0x5df162f8, 0xfb5dfe08,
+0x00063db8, 0x6df26200, 0x62d14008, 0x1f086df3,
+0xf8c500eb, 0xfa80d593, 0xe7850f0f, 0x62000001,
+0x40085df2, 0x7df162d1, 0xf7557f08, 0x087df262,
+0xb8f7551e, 0x00000644, 0x086df362, 0xc500f41f,
+0x80d693f8, 0x850f0ffa, 0x000001ba, 0x087df162,
+0x62fa5d6f, 0x6f087df1, 0x4eb8fb55, 0x62000006,
+0x70087df1, 0xf3621be3, 0xfa1f085d, 0x93f8c500,
+0x0ffa80d7, 0x018c850f, 0xf1620000, 0xdbfe086d,
+0x05f045c7, 0xb8000000, 0x0000065d, 0x087df262,
+0x62fc6558, 0x1f085df3, 0xf8c500c3, 0xfa80d093,
+0x5f850f0f, 0xb8000001, 0x00000005, 0x087df262,
+0xf362e07c, 0xcb1f085d, 0x0661b800, 0xf8c50000,
+0xfa80d193, 0x3b850f0f, 0x62000001, 0x62086df1,
+0xf162fa5d, 0x556a086d, 0x65f162fa, 0xc7d2fa08,
+0x0002f045, 0xa6b80000, 0x62000006, 0x40086df2,
+0x7df262d1, 0xfc5d5808, 0x086df362, 0xc500d31f,
+0x80d293f8, 0x850f0ffa, 0x000000fa, 0x0875f262,
+0x62fa5540, 0x720875f1, 0xf1621fe1, 0x557f087d,
+0x6df162f7, 0x62d16208, 0x6f087df1, 0xf262f775,
+0xce25087d, 0x0875f362, 0xb800da1f, 0x000006b3,
+0xd393f8c5, 0x0f0ffa80, 0x0000b985, 0x7df16200,
+0xfa556f08, 0x087df162, 0x62fe557f, 0x6f087df1,
+0xf262fe7d, 0xcf25087d, 0x087df162, 0x62f74d7f,
+0x6f087df1, 0xf262f76d, 0xe935087e, 0x087df162,
+0x8bff4d7f, 0x4539a045, 0x8b7675f0, 0x4539a445,
+0x8b6e75f4, 0xf162b445, 0x557f087d, 0x844589f8,
+0x89bc458b, 0xf1628c45, 0x4d6f087d, 0x073ab8fa,
+0xe3c40000, 0xb0550271, 0x6df3620a, 0xf8651f08,
+0x93f8c500, 0x0ffa80d4, 0xf3623c75, 0xd1030875,
+0x75f16201, 0x550ddb08, 0xba000000, 0x00000000,
+0x0875f162, 0x00360dfe, 0xf3620000, 0xe91f086d,
+0x93f8c500, 0xb80f3cc5, 0x0000074a, 0xebc2440f,
+0x06f1b805, 0xc3c90000, 0x00000000, 0x00000000,
+0x00000004, 0x00000006, 0x00000006, 0x00000004,
+0x00000001, 0x00000001, 0x00000001, 0x00000001,
+0x00000003, 0x00000003, 0x00000003, 0x00000003,
+0002640,
+};
+asm(".type avx512f_x86_64_D_16i4, STT_NOTYPE;");
+asm(".type avx512f_x86_64_D_16i4, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512f_x86_64_D_16u4[] = {
+0x315500eb, 0x0020bac0, 0xb9410000, 0x00000004,
+0x48e58948, 0x8928ec83, 0x01708dc1, 0x45cf8944,
+0xe183c031, 0x89c72901, 0xffa08574, 0x89c685c9,
+0x41b0857c, 0x89c0940f, 0x44c0854c, 0x5489c229,
+0xff48d085, 0xf88348c0, 0x62cc7504, 0x6f087df1,
+0xf162fa4d, 0x4d7f087d, 0x7df162f7, 0xf7556f08,
+0x000539b8, 0x6df36200, 0x00c11f08, 0xd093f8c5,
+0x0f0ffa80, 0x00045f85, 0x6df16200, 0xfa4dfe08,
+0x087df162, 0x62f84d7f, 0x6f087df1, 0xf162f84d,
+0x75720865, 0x3fb801fa, 0x62000005, 0x1f0875f3,
+0xf8c500cb, 0xfa80d193, 0x29850f0f, 0x62000004,
+0xfa0875f1, 0xf162fa4d, 0x4d7f087d, 0x7df162f9,
+0xf95d6f08, 0x000544b8, 0x6df36200, 0x00d31f08,
+0xd293f8c5, 0x0f0ffa80, 0x0003fb85, 0x6df16200,
+0xfb55eb08, 0x087df162, 0x62f7557f, 0xdb0875f1,
+0xf162fb4d, 0x5def0865, 0x75f162fb, 0xf74ddf08,
+0x000550b8, 0x75f36200, 0x00db1f08, 0xd393f8c5,
+0x0f0ffa80, 0x0003bf85, 0x7df16200, 0xfa556f08,
+0x086df262, 0x62fb4d40, 0x1f0875f3, 0x0003ae25,
+0xc8b80000, 0xc5000005, 0x80d493f8, 0x850f0ffa,
+0x00000394, 0x086df162, 0x62fc4def, 0x7f087df1,
+0xf162f74d, 0xc87e087d, 0x08f5f162, 0x8bfb4df4,
+0x0f48b055, 0x558bc2af, 0x458948b8, 0x78858b90,
+0x48ffffff, 0x48c2af0f, 0xb8984589, 0x000005e1,
+0x0875f362, 0x00f96d1f, 0xd593f8c5, 0x0f0ffa80,
+0x00034385, 0x7df16200, 0xf9557f08, 0x0875f162,
+0x03f97572, 0x087df162, 0x62f74d7f, 0x720865f1,
+0x6202f975, 0xfe0865f1, 0x05edb8e3, 0xf3620000,
+0xf41f0875, 0x93f8c500, 0x0ffa80d6, 0x0306850f,
+0xf1620000, 0x55720875, 0xf16202f7, 0xc9fe0875,
+0x0005f2b8, 0x65f36200, 0x00f91f08, 0xd793f8c5,
+0x0f0ffa80, 0x0002df85, 0x6c85c700, 0x03ffffff,
+0x62000000, 0x6e087df1, 0xf162db4d, 0xc9f2086d,
+0xff6c85c7, 0x0002ffff, 0xf1620000, 0x5d6e087d,
+0x6df162db, 0x62dbf208, 0xfe0865f1, 0x0605b8e3,
+0xf3620000, 0xc41f0875, 0x93f8c500, 0x0ffa80d0,
+0x0292850f, 0xf1620000, 0x656e087d, 0x75f162db,
+0x62ccd208, 0xfe0875f1, 0x0609b8c9, 0xf3620000,
+0xc91f0865, 0x93f8c500, 0x0ffa80d1, 0x0266850f,
+0xf1620000, 0xdbef0865, 0xc976f1c5, 0x087df162,
+0xe1c5e26f, 0x62d05d76, 0x250875f3, 0xf26240e3,
+0x6d47085d, 0x75f162fd, 0xfd5dfe08, 0x087df162,
+0x62fd5d7f, 0x47085df2, 0x21b8fd5d, 0x62000006,
+0xfe0865f1, 0x55f362f3, 0x00d61f08, 0xd293f8c5,
+0x0f0ffa80, 0x00020f85, 0x65f26200, 0xfd5d4508,
+0x000626b8, 0x65f36200, 0x00dc1f08, 0xd393f8c5,
+0x0f0ffa80, 0x0001ef85, 0x6df26200, 0xfb5d3b08,
+0x086df262, 0x62fb653f, 0xfe086df1, 0xf162fb55,
+0xdcfe0865, 0x000634b8, 0x65f36200, 0x00e21f08,
+0xd493f8c5, 0x0f0ffa80, 0x0001bb85, 0x7df16200,
+0xfa5d6f08, 0x087df162, 0xb8fb556f, 0x0000064e,
+0x087df162, 0x621be370, 0x1f085df3, 0xf8c500ea,
+0xfa80d593, 0x8d850f0f, 0x62000001, 0xfe086df1,
+0xf045c7db, 0x00000005, 0x00065db8, 0x7df26200,
+0xfc655808, 0x085df362, 0xc500f31f, 0x80d693f8,
+0x850f0ffa, 0x00000160, 0x000005b8, 0x7df26200,
+0x62e07c08, 0x1f085df3, 0x61b800fb, 0xc5000006,
+0x80d793f8, 0x850f0ffa, 0x0000013c, 0x086df162,
+0x62fa5d62, 0x6a086df1, 0xf162fa55, 0xcafe0875,
+0x086df362, 0x55fc5525, 0x0006a6b8, 0xf045c700,
+0x00000002, 0x0875f162, 0xf162cbfa, 0x4def0875,
+0x75f162fc, 0x62cafa08, 0x58087df2, 0xf362fc55,
+0xc21f0875, 0x93f8c500, 0x0ffa80d0, 0x00e6850f,
+0xf2620000, 0x5535087d, 0x7df162f4, 0xfa7d6f08,
+0x087df262, 0xf362cf35, 0xca1f0875, 0x06d3b800,
+0xf8c50000, 0xfa80d193, 0xb9850f0f, 0x62000000,
+0x6f087df1, 0xf162fa55, 0x557f087d, 0x7df162fe,
+0xfe6d6f08, 0x087df262, 0xf162cd35, 0x4d7f087d,
+0x7df162f7, 0xf7756f08, 0x087ef262, 0xf162f135,
+0x4d7f087d, 0xa0458bff, 0x75f04539, 0xa4458b76,
+0x75f44539, 0xb4458b6e, 0x087df162, 0x89f8557f,
+0x458b8445, 0x8c4589bc, 0x087df162, 0xb8fa4d6f,
+0x0000073a, 0x0271e3c4, 0x620ab055, 0x1f086df3,
+0xc500f855, 0x80d293f8, 0x3c750ffa, 0x0875f362,
+0x6201d103, 0xdb0875f1, 0x0000430d, 0x0000ba00,
+0xf1620000, 0x0dfe0875, 0x00000044, 0x086df362,
+0xc500d91f, 0x3cc393f8, 0x074ab80f, 0x440f0000,
+0xb805ebc2, 0x000006f1, 0x0000c3c9, 0x00000000,
+0x00000004, 0x00000006, 0x00000006, 0x00000004,
+0x00000003, 0x00000003, 0x00000003, 0x00000003,
+0x00000001, 0x00000001, 0x00000001, 0x00000001,
+0002420,
+};
+asm(".type avx512f_x86_64_D_16u4, STT_NOTYPE;");
+asm(".type avx512f_x86_64_D_16u4, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512f_x86_64_D_16i8[] = {
+0x485500eb, 0xc748e589, 0x0001d045, 0xc7480000,
+0x0002e045, 0xc7480000, 0x003ff045, 0xc7480000,
+0x0002d845, 0xc7480000, 0x0001e845, 0xc7480000,
+0x003ef845, 0xf1620000, 0x4d6f08fd, 0xfdf162fd,
+0xfa4d7f08, 0x08fdf162, 0xb8fa556f, 0x00000539,
+0x08edf362, 0xc500c11f, 0x80d093f8, 0x850f03fa,
+0x000005c0, 0x08edf162, 0x62fd4dd4, 0x7f08fdf1,
+0xf162fb4d, 0x4d6f08fd, 0xe5f162fb, 0xfd757308,
+0x053fb801, 0xf3620000, 0xd31f08f5, 0x93f8c500,
+0x03fa80d2, 0x058a850f, 0xf1620000, 0x4dfb08f5,
+0xfdf162fd, 0xfc4d7f08, 0x08edf362, 0x00fc5d1f,
+0x000544b8, 0x93f8c500, 0x03fa80d3, 0x0562850f,
+0xf1620000, 0x6d6f08fd, 0xf5f162fd, 0x20d27308,
+0x08ddf162, 0x6220d573, 0xf408edf1, 0xf5f162dd,
+0x62cdf408, 0xf408ddf1, 0xf5f162d2, 0x62cad408,
+0x7308f5f1, 0xf16220f1, 0xd1d408e5, 0x08fdf162,
+0x62fe5d6f, 0x7308f5f1, 0xf16220d3, 0xebf408e5,
+0x08f5f162, 0xf162cbf4, 0xc9d408f5, 0x08f5f162,
+0x6220f173, 0xd408d5f1, 0xfdf162e9, 0xfd5d6f08,
+0x08e57162, 0x62fe45d4, 0xfb08e5f1, 0xd162fe7d,
+0xd07308cd, 0x055bb820, 0xf1620000, 0xd77308f5,
+0xcdf16220, 0x62f7f408, 0xf408f5d1, 0xc5d162c8,
+0x62e0f408, 0xd408f5f1, 0xf5f162ce, 0x20f17308,
+0x08ddf162, 0xf162e1d4, 0xcdfb08ed, 0x08f5f362,
+0xc500e41f, 0x80d493f8, 0x850f03fa, 0x00000494,
+0x08fdf162, 0x62fe4d6f, 0x7308ddf1, 0xf16220d3,
+0xd17308d5, 0xe5f16220, 0x62d1f408, 0xf408d5f1,
+0xddf162eb, 0x62c9f408, 0xd408f5f1, 0xf5f162cd,
+0x20f17308, 0x08edf162, 0xf362c9d4, 0x2d1f08f5,
+0x0000045b, 0x05c8b800, 0xf8c50000, 0xfa80d593,
+0x3d850f03, 0x62000004, 0x6f08fdf1, 0x00045f0d,
+0xd5f16200, 0x20d17308, 0x08ddf162, 0xf162d1f4,
+0xf3f408d5, 0x08e57162, 0xf162c1f4, 0xd6d408ed,
+0x08edf162, 0x6220f273, 0xd408bdf1, 0xfdf162d2,
+0xfc557f08, 0x08edf162, 0x03fc7573, 0x08fdf162,
+0x62fa557f, 0x7308b5f1, 0x6202fc75, 0xd408b5d1,
+0x05edb8f9, 0xf3620000, 0xf71f08ed, 0xddf16200,
+0xc5f9f408, 0x80d693f8, 0x850f03fa, 0x000003c4,
+0x08edf162, 0x02fa6572, 0x08edf162, 0xf2b8d2d4,
+0x62000005, 0x1f08b5f3, 0xf8c500fa, 0xfa80d793,
+0x9d850f03, 0x62000003, 0xd408c5f1, 0x9445c7d6,
+0x00000003, 0x08edf162, 0x6220f273, 0xd408bdf1,
+0x456348d2, 0xfdf16294, 0x62e06e08, 0xf308edf1,
+0x9445c7e4, 0x00000002, 0x94456348, 0x08fd7162,
+0xd162e06e, 0xd4f308ed, 0x08ed7162, 0x05b8cad4,
+0x62000006, 0x1f08ddd3, 0xf8c500c1, 0xfa80d093,
+0x3d850f03, 0x48000003, 0x62944563, 0x6e08fd71,
+0xddd162e8, 0x62e5e208, 0xd408ddf1, 0x0609b8e4,
+0xf3620000, 0xcc1f08ed, 0x93f8c500, 0x03fa80d1,
+0x030e850f, 0xf1620000, 0xd7d408cd, 0x08fdf162,
+0x62ff7d6f, 0x7308edf1, 0x716220f2, 0xc2d408bd,
+0x08edf162, 0xe2c4d2ef, 0x62d23741, 0xdb08edd1,
+0xfdf162d0, 0xfc557f08, 0x08edf262, 0xb8ff7547,
+0x00000001, 0x08fdf162, 0x62ff7d6f, 0x7c08fdf2,
+0xc5f162e0, 0x62e4fb08, 0x7f08fdf1, 0xf262ff65,
+0x554708ed, 0x0621b8ff, 0xf1620000, 0x557f08fd,
+0xedf162fb, 0x62d2d408, 0x1f08cdf3, 0xf8c500d2,
+0xfa80d293, 0x89850f03, 0x62000002, 0x6f08fdf1,
+0xf262fb7d, 0x554608c5, 0x0626b8ff, 0xf3620000,
+0x5d1f08ed, 0xf8c500fc, 0xfa80d393, 0x61850f03,
+0x62000002, 0x6f08fd71, 0xf162fe5d, 0xd37308dd,
+0xd5716220, 0x62d3f408, 0xf408ddf1, 0xe57162d1,
+0x62c1f408, 0x7308cdd1, 0x516220d3, 0xcbf408d5,
+0x08cdf162, 0xf162f1f4, 0xf9f408a5, 0x08edd162,
+0xf162d2d4, 0xf27308ed, 0xcdd16220, 0x62f1d408,
+0xd408bdf1, 0xcdf162d2, 0x20f67308, 0x08c5f162,
+0xf162f6d4, 0x757f08fd, 0xedf262fb, 0xfb7d3d08,
+0x08edf262, 0x62fb5539, 0x7f08fdf1, 0xf162fb55,
+0x7dd408c5, 0xe5d162fb, 0xb8d3d408, 0x0000063d,
+0x08ddf162, 0xf162e1f4, 0xd77308cd, 0xc5716220,
+0x62c9f408, 0xf408cdf1, 0xd5f162f1, 0x62fff408,
+0xd408cdf1, 0xcdf162f7, 0x20f67308, 0x08b5f162,
+0xf362f6d4, 0xe21f08cd, 0x93f8c500, 0x03fa80d4,
+0x018e850f, 0xd1620000, 0xe2d408dd, 0x08ddf162,
+0x6220f473, 0xd408bd71, 0xfd7162c4, 0xfa457f08,
+0x08fdf262, 0x62fa551f, 0x1f08edf3, 0x44b800eb,
+0xc5000006, 0x80d593f8, 0x850f03fa, 0x00000154,
+0x08fdf162, 0xb8fd5d6f, 0x0000064e, 0x087df162,
+0x624ed370, 0x1f08edd3, 0xf8c500f3, 0xfa80d693,
+0x2d850f03, 0x62000001, 0xd408a5f1, 0x45c748db,
+0x00000398, 0x065db800, 0xf2620000, 0x555908fd,
+0xedf362f3, 0x00fb1f08, 0xd793f8c5, 0x0f03fa80,
+0x0000ff85, 0x0003b800, 0xf2620000, 0xd07c08fd,
+0x08edf362, 0xb800c31f, 0x00000661, 0xd093f8c5,
+0x0f03fa80, 0x0000db85, 0xa5f16200, 0xfd5d6c08,
+0x08a5f162, 0x62fd556d, 0xfb08e5f1, 0x45c748da,
+0x00000198, 0x06a6b800, 0xf1620000, 0xd37308ed,
+0xe5f16220, 0x62e1f408, 0xf408d5f1, 0xedf162eb,
+0x62c9f408, 0x5908fdf2, 0xf162f355, 0xcdd408f5,
+0x08f5f162, 0x6220f173, 0xd408ddf1, 0xf5f362c9,
+0x00ca1f08, 0xd193f8c5, 0x7503fa80, 0xfdf16277,
+0xfd6d6f08, 0xe8458b48, 0x08fdf162, 0x48fb6d7f,
+0x62b84589, 0x6f08fdf1, 0xaab0fd4d, 0xc892f8c5,
+0x00073ab8, 0xf5f26200, 0xfe556409, 0x08edf362,
+0x00fb551f, 0xd293f8c5, 0x7503fa80, 0xf5f36237,
+0x01d90308, 0x000000ba, 0xfdf16200, 0x3d156f08,
+0x62000000, 0xdb08f5f1, 0xf5f162ca, 0x62cad408,
+0x1f08e5f3, 0xf8c500d9, 0x033cc393, 0x00074ab8,
+0xc2440f00, 0x0000c35d, 0x00000000, 0x00000000,
+0x00000002, 0x00000000, 0x00000002, 0x00000000,
+0x00000001, 0x00000000, 0x00000001, 0x00000000,
+0x00000001, 0x00000000, 0xffffffff, 0xffffffff,
+0003140,
+};
+asm(".type avx512f_x86_64_D_16i8, STT_NOTYPE;");
+asm(".type avx512f_x86_64_D_16i8, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512f_x86_64_D_16u8[] = {
+0x485500eb, 0xc748e589, 0x0001d045, 0xc7480000,
+0x0002e045, 0xc7480000, 0x003ff045, 0xc7480000,
+0x0002d845, 0xc7480000, 0x0001e845, 0xc7480000,
+0x003ef845, 0xf1620000, 0x4d6f08fd, 0xfdf162fd,
+0xfa4d7f08, 0x08fdf162, 0xb8fa556f, 0x00000539,
+0x08edf362, 0xc500c11f, 0x80d093f8, 0x850f03fa,
+0x000003e7, 0x08edf162, 0x62fd4dd4, 0x7f08fdf1,
+0xf162fb4d, 0x4d6f08fd, 0xe5f162fb, 0xfd757308,
+0x053fb801, 0xf3620000, 0xd31f08f5, 0x93f8c500,
+0x03fa80d2, 0x03b1850f, 0xf1620000, 0x4dfb08f5,
+0xfdf162fd, 0xfc4d7f08, 0x08fdf162, 0xb8fc5d6f,
+0x00000544, 0x08edf362, 0xc500db1f, 0x80d393f8,
+0x850f03fa, 0x00000383, 0x08edf162, 0x62fe55eb,
+0x7f08fdf1, 0xf162fa55, 0x4ddb08f5, 0xe5f162fe,
+0xfe5def08, 0x08f5f162, 0xb8fa4ddf, 0x00000550,
+0x08f5f362, 0xc500e31f, 0x80d493f8, 0x850f03fa,
+0x00000347, 0x08fdf162, 0x62fd4d6f, 0x6f08fdf1,
+0xf162fe6d, 0xd17308ed, 0xddf16220, 0x20d57308,
+0x08edf162, 0xf162d5f4, 0xe1f408dd, 0x08f5f162,
+0xf162ddf4, 0xd4d408ed, 0x08edf162, 0x6220f273,
+0xd408e5f1, 0xedf362d2, 0x002d1f08, 0x00000003,
+0x0005c8b8, 0x93f8c500, 0x03fa80d5, 0x02e9850f,
+0xf1620000, 0x4d7f08fd, 0xedf162fc, 0xfc757308,
+0xfdf16203, 0xfa557f08, 0x08e5f162, 0x02fc7573,
+0x08e5f162, 0xedb8e3d4, 0x62000005, 0x1f08edf3,
+0xf8c500f4, 0xfa80d693, 0xac850f03, 0x62000002,
+0x7308edf1, 0x6202fa55, 0xd408edf1, 0x05f2b8d2,
+0xf3620000, 0xfa1f08e5, 0x93f8c500, 0x03fa80d7,
+0x0285850f, 0x45c70000, 0x00000394, 0x7df16200,
+0xe5556e08, 0x08f5f162, 0x45c7d2f3, 0x00000294,
+0x7df16200, 0xe55d6e08, 0x08f5f162, 0xf162dbf3,
+0xe3d408e5, 0x000605b8, 0xedf36200, 0x00c41f08,
+0xd093f8c5, 0x0f03fa80, 0x00023e85, 0x7df16200,
+0xe5656e08, 0x08edf162, 0xf162d4d3, 0xd2d408ed,
+0x000609b8, 0xe5f36200, 0x00ca1f08, 0xd193f8c5,
+0x0f03fa80, 0x00021285, 0xddf16200, 0xc5e4ef08,
+0x62d276e9, 0x6f08fdf1, 0x59e2c4d9, 0x62f06529,
+0x2508edf3, 0xf16240dc, 0x5d7f08fd, 0xe5f262fc,
+0xff654708, 0x08edf162, 0x62ff6dd4, 0x7f08fdf1,
+0xf262ff6d, 0x5d4708e5, 0x0621b8ff, 0xf1620000,
+0x5d7f08fd, 0xe5f162fb, 0x62dbd408, 0x1f08ddf3,
+0xf8c500d3, 0xfa80d293, 0xac850f03, 0x62000001,
+0x6f08fdf1, 0xf262fb75, 0x5d4508cd, 0x0626b8ff,
+0xf3620000, 0x5d1f08e5, 0xf8c500fc, 0xfa80d393,
+0x84850f03, 0x62000001, 0x3b08f5f2, 0xf262fe5d,
+0x653f08f5, 0xf5f162fe, 0xfe4dd408, 0x08e5f162,
+0x34b8dcd4, 0x62000006, 0x1f08e5f3, 0xf8c500e1,
+0xfa80d493, 0x50850f03, 0x62000001, 0x6f08fdf1,
+0xf162fd5d, 0x4d6f08fd, 0x064eb8fe, 0xf1620000,
+0xe370087d, 0xddf3624e, 0x00e91f08, 0xd593f8c5,
+0x0f03fa80, 0x00012285, 0xf5f16200, 0x48dbd408,
+0x039845c7, 0xb8000000, 0x0000065d, 0x08fdf262,
+0x62f36559, 0x1f08ddf3, 0xf8c500f3, 0xfa80d693,
+0xf4850f03, 0xb8000000, 0x00000003, 0x08fdf262,
+0xf362e07c, 0xfb1f08dd, 0x0661b800, 0xf8c50000,
+0xfa80d793, 0xd0850f03, 0x62000000, 0x6c08f5f1,
+0xf162fd5d, 0x4d6d08f5, 0xedf162fd, 0x48d1d408,
+0x019845c7, 0xb8000000, 0x000006a6, 0x08f5f362,
+0x00c90d25, 0x62550000, 0xfb08edf1, 0xedf162d3,
+0xb915ef08, 0x62000000, 0xfb08edf1, 0xfdf262d1,
+0xf34d5908, 0x08edf362, 0xc500c11f, 0x80d093f8,
+0x777503fa, 0x08fdf162, 0x48fd7d6f, 0x62e8458b,
+0x7f08fdf1, 0x8948fb7d, 0xf162b845, 0x4d6f08fd,
+0xc5aab0fd, 0xb8c892f8, 0x0000073a, 0x09f5f262,
+0x62fe5564, 0x1f08edf3, 0xc500fb4d, 0x80d193f8,
+0x377503fa, 0x08f5f362, 0xba01d903, 0x00000000,
+0x08fdf162, 0x0036156f, 0xf1620000, 0xcadb08f5,
+0x08f5f162, 0xf362cad4, 0xd11f08e5, 0x93f8c500,
+0xb8033cc2, 0x0000074a, 0x5dc2440f, 0x000000c3,
+0x00000002, 0x00000000, 0x00000002, 0x00000000,
+0x00000001, 0x00000000, 0x00000001, 0x00000000,
+0xffffffff, 0xffffffff, 0x00000000, 0x00000000,
+0002200,
+};
+asm(".type avx512f_x86_64_D_16u8, STT_NOTYPE;");
+asm(".type avx512f_x86_64_D_16u8, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512f_x86_64_D_16f4[] = {
+0x0002cce9, 0x00b84800, 0x003f8000, 0x55400000,
+0x48e58948, 0x48d04589, 0x400000b8, 0x80000040,
+0x45894840, 0x00b848d8, 0x00408000, 0x48404000,
+0xb8e04589, 0xfe000001, 0x1ee0c148, 0x00cc45c7,
+0x483f8000, 0x48e84589, 0x8000002d, 0x45894800,
+0x458948f0, 0x7cf162f8, 0xfe4d2808, 0x0000a7b8,
+0x7cf16200, 0xb5152808, 0x62000009, 0x28087cf1,
+0x75f262d9, 0xfd5d9808, 0x086cf162, 0xc500c3c2,
+0x83d093f8, 0xfa800fe2, 0x40850f0f, 0x62000002,
+0x28087cf1, 0x75f262d9, 0xfd5d9e08, 0x0000abb8,
+0x7cf16200, 0x85152808, 0x62000009, 0xc2086cf1,
+0xf8c500cb, 0xe283d193, 0x0ffa800f, 0x020d850f,
+0xf1620000, 0xd928087c, 0x0875f262, 0xb8fd5d9a,
+0x000000af, 0x087cf162, 0x09621528, 0xf1620000,
+0xd3c2086c, 0x93f8c500, 0x0fe283d2, 0x0f0ffa80,
+0x0001da85, 0x7cf16200, 0x62d92808, 0x9c0875f2,
+0xb3b8fd5d, 0x62000000, 0x28087cf1, 0x00093f15,
+0x6cf16200, 0x00dbc208, 0xd393f8c5, 0x800fe283,
+0x850f0ffa, 0x000001a7, 0x087cf162, 0x62fd5528,
+0x58086cf1, 0x7df262d9, 0xf3651808, 0x087cf162,
+0xb8fe7528, 0x000000bb, 0x084df262, 0xf162e298,
+0xe4c20864, 0x93f8c500, 0x0fe283d4, 0x0f0ffa80,
+0x00016a85, 0x7cf16200, 0xfe752808, 0x087cf162,
+0xc0b8e228, 0x62000000, 0x18087df2, 0x0008cf2d,
+0x4df26200, 0xf3659e18, 0xdd57e0c5, 0x0864f162,
+0xc500ecc2, 0x83d593f8, 0xfa800fe2, 0x2c850f0f,
+0x62000001, 0x5c086cf1, 0x7df262c9, 0xf35d1808,
+0x087cf162, 0xb8fe7d28, 0x000000c5, 0x0845f262,
+0xf162da9a, 0xf3c20874, 0x93f8c500, 0x0fe283d6,
+0x0f0ffa80, 0x0000f685, 0x7cf16200, 0xfe752808,
+0x087cf162, 0xf0c5da28, 0xcab8cd57, 0x62000000,
+0x9c184df2, 0xf162f35d, 0xfbc20874, 0x93f8c500,
+0x0fe283d7, 0x0f0ffa80, 0x0000c285, 0x6cf16200,
+0xfe4d5908, 0x087cf162, 0xc5ff5d28, 0x62f3d0f3,
+0x28087cf1, 0xf162fe65, 0xfa28087c, 0x0000d4b8,
+0x5df26200, 0xff7da608, 0x084cf162, 0xc500c7c2,
+0x83d093f8, 0xfa800fe2, 0x80850f0f, 0xc5000000,
+0xc5dd57e0, 0x62cbd0f3, 0xa7086df2, 0xd8b8ff65,
+0x62000000, 0xc20874f1, 0xf8c500cc, 0xe283d193,
+0x0ffa800f, 0xf1625975, 0x5d59086c, 0xd0e3c5fe,
+0xf162f05d, 0x6528087c, 0x7cf162ff, 0xb8ea2808,
+0x000000de, 0x085df262, 0x62fe6d96, 0xc20864f1,
+0xf8c500d5, 0xe283d293, 0x0ffa800f, 0xf2622175,
+0x5597085d, 0x00e2b8fe, 0xf1620000, 0xdac20874,
+0x93f8c500, 0x0fe283d3, 0x750ffa80, 0x5dc03102,
+0x00b848c3, 0x003f8000, 0x55400000, 0x48e58948,
+0x4880c483, 0x48b04589, 0x400000b8, 0x80000040,
+0x45894840, 0x00b848b8, 0x00408000, 0x48404000,
+0xb8c04589, 0xfe000001, 0x1ee0c148, 0xc8458948,
+0x0000b848, 0x00003f80, 0x8948bf80, 0x8948d045,
+0xf162d845, 0x5528087c, 0x7cf162fb, 0xf8552908,
+0x087cf162, 0xb8f84d28, 0x00000539, 0x0874f162,
+0xc500c2c2, 0x83d093f8, 0xfa800fe2, 0xc8850f0f,
+0x62000006, 0x580874f1, 0xf162fb55, 0x5529087c,
+0x7cf162f9, 0xfb5d2808, 0x087cf162, 0xb8f95528,
+0x0000053f, 0x0864f162, 0xf162db58, 0xd3c2086c,
+0x93f8c500, 0x0fe283d2, 0x0f0ffa80, 0x00068a85,
+0x6cf16200, 0xfb555c08, 0x087cf162, 0x62fa5529,
+0xc20874f1, 0xb800fa5d, 0x00000544, 0xd393f8c5,
+0x800fe283, 0x850f0ffa, 0x0000065f, 0x087cf162,
+0x62fc5528, 0x590874f1, 0xf162fb4d, 0xda59086c,
+0x087cf162, 0x62fb5528, 0x58086cf1, 0xf162fc6d,
+0x655c086c, 0x74f162fc, 0xb8cb5c08, 0x0000055b,
+0x085cf162, 0xf162e559, 0xe4c20874, 0x93f8c500,
+0x0fe283d4, 0x0f0ffa80, 0x00060e85, 0x6cf16200,
+0xfd4d5908, 0x087cf162, 0x62f84d29, 0x5e086cf1,
+0xf162fd55, 0xeac20874, 0x0564b800, 0xf8c50000,
+0xe283d593, 0x0ffa800f, 0x05dd850f, 0xf2620000,
+0x0d18087d, 0x00000608, 0x087cf162, 0xb8fd5528,
+0x00000567, 0xd957e8c5, 0x4d57f0c5, 0x64f162b0,
+0xf85d5908, 0x0864f162, 0xc500f1c2, 0x83d693f8,
+0xfa800fe2, 0xa0850f0f, 0x62000005, 0x5b087df1,
+0xf162fb4d, 0xc95b087c, 0x0874f162, 0x00fb7dc2,
+0x00056eb8, 0x93f8c500, 0x0fe283d7, 0x0f0ffa80,
+0x00057685, 0x7df26200, 0xfb4d4c08, 0x087cf162,
+0x62f84d29, 0x4c087df2, 0xf162f84d, 0x6528087c,
+0x0575b8fb, 0xf1620000, 0xc95b087d, 0x087cf162,
+0xf162c95b, 0xc4c20874, 0x93f8c500, 0x0fe283d0,
+0x0f0ffa80, 0x00053285, 0x5cf16200, 0x62cc5908,
+0x29087cf1, 0xf262f84d, 0x4d4e087d, 0x7cf162f8,
+0xf94d2908, 0x087cf162, 0xb8f94d28, 0x0000057c,
+0x087df262, 0xf162d94c, 0xdb5b087d, 0x087cf162,
+0xf162db5b, 0xd4c20864, 0x93f8c500, 0x0fe283d2,
+0x0f0ffa80, 0x0004e285, 0x7df26200, 0xfb5d4c08,
+0x087df162, 0x7eb8c95b, 0x62000005, 0x5b087cf1,
+0x7df162c9, 0x62db5b08, 0x5b087cf1, 0x74f162db,
+0x00dbc208, 0xd393f8c5, 0x800fe283, 0x850f0ffa,
+0x000004a7, 0x087cf162, 0x62fb5d79, 0x7a087ff1,
+0x7cf162db, 0xfb4d2808, 0x00058fb8, 0x64f16200,
+0x00e1c208, 0xd493f8c5, 0x800fe283, 0x850f0ffa,
+0x00000477, 0x0874f162, 0xf162d959, 0x5d29087c,
+0x7cf162f8, 0xf85d5108, 0x00059cb8, 0x64f16200,
+0x00e9c208, 0xd593f8c5, 0x800fe283, 0x850f0ffa,
+0x00000447, 0x087df262, 0x04821d18, 0xf1620000,
+0xe15e0864, 0x087cf162, 0x62f86529, 0x08087df3,
+0xb80bf86d, 0x000005a4, 0x087ef162, 0x045e2510,
+0xf1620000, 0xf5c2085c, 0x93f8c500, 0x0fe283d6,
+0x0f0ffa80, 0x00040285, 0x6cf16200, 0xfc655908,
+0x086cf162, 0xf162e959, 0x6529087c, 0x54f162f9,
+0xf9655f08, 0x0854f162, 0x62f96d5d, 0x29087cf1,
+0xf162f96d, 0x6558085c, 0x74f162f9, 0xfc4d5808,
+0x00063db8, 0x5cf16200, 0x62e25908, 0xc2085cf1,
+0xf8c500f9, 0xe283d793, 0x0ffa800f, 0x03a9850f,
+0xf1620000, 0x4d28087c, 0x064eb8fb, 0xf1620000,
+0xe1c60874, 0x7cf1621b, 0xfc4d2808, 0x085cf162,
+0xc500c9c2, 0x83d193f8, 0xfa800fe2, 0x78850f0f,
+0x62000003, 0x28087cf1, 0x53b8fb65, 0x62000006,
+0x04087df3, 0xf1621bec, 0xc1c20854, 0x93f8c500,
+0x0fe283d0, 0x0f0ffa80, 0x00034e85, 0x74f16200,
+0xc7e45808, 0x0000f045, 0x5db840a0, 0x62000006,
+0x18087df2, 0xf162fc6d, 0xd4c20854, 0x93f8c500,
+0x0fe283d2, 0x0f0ffa80, 0x00031e85, 0x74f16200,
+0xfb651408, 0x0874f162, 0x62fb4d15, 0x5c085cf1,
+0xf045c7c9, 0x40000000, 0x0006a6b8, 0x7df26200,
+0xfc651808, 0x0874f162, 0xf162ca59, 0xdcc20874,
+0x7cf16200, 0xfa4d2908, 0xd393f8c5, 0x800fe283,
+0x850f0ffa, 0x000002d3, 0x087cf162, 0x62fb7d28,
+0x29087cf1, 0xf162fe7d, 0x4d5a087c, 0xfdf162fc,
+0xf84d2908, 0x08fdf162, 0x62f84d5a, 0x29087cf1,
+0xf162ff4d, 0x4d10087e, 0x7cf162fc, 0xec4d2e08,
+0x5d755f7a, 0x087ef162, 0x62fd4d10, 0x2e087cf1,
+0x4d7aed4d, 0xf1624b75, 0x6512087e, 0x7df262fb,
+0xc90d1808, 0x62000002, 0x5c085cf1, 0x17b8fb65,
+0x62000007, 0x18087df2, 0x0002b72d, 0x74f16200,
+0x62ca5808, 0x590874f1, 0x5cf162cd, 0x00e1c208,
+0xd493f8c5, 0x800fe283, 0x0f740ffa, 0x00023ae9,
+0x06f1b800, 0x30e90000, 0x62000002, 0x16087ef1,
+0xf162fb4d, 0xdb58086c, 0x087cf162, 0xb8fb6528,
+0x0000071e, 0x0874f162, 0xf162cc5c, 0xdd590864,
+0x0874f162, 0xc500ebc2, 0x83d593f8, 0xfa800fe2,
+0xf4850f0f, 0x62000001, 0x10087ef1, 0xf162f14d,
+0x6529087c, 0x7d8d48f9, 0x072ab8a0, 0xf1620000,
+0x4d11087e, 0x7ef162e5, 0xf34d1008, 0x087ef162,
+0xc5e74d11, 0xc5c957f0, 0x01d2c2f0, 0xe2f7f9c5,
+0x087df162, 0x62fc756f, 0x250865f3, 0xf9c555da,
+0xf162f3f7, 0x5528087c, 0x7cf162f9, 0xfa752808,
+0x084cf162, 0xc500f2c2, 0x83d693f8, 0xfa800fe2,
+0x84850f0f, 0x62000001, 0x28087cf1, 0x0ab0fb7d,
+0xc892f8c5, 0x00073ab8, 0x45f26200, 0xfc5d6509,
+0x0864f162, 0xc500fac2, 0x83d793f8, 0xfa800fe2,
+0x54850f0f, 0x62000001, 0x28087cf1, 0xc3c5fb7d,
+0x62c055d0, 0x28087cf1, 0xf162fb5d, 0x6d28087c,
+0x0743b8fc, 0xf1620000, 0xe55c0864, 0x0964f162,
+0xf162e558, 0xccc2086c, 0x93f8c500, 0x0fe283d1,
+0x0f0ffa80, 0x00011285, 0x7cf16200, 0xf85d2908,
+0x557cf3c5, 0x7cf16280, 0xf8552908, 0x557cf3c5,
+0x6cf16280, 0xffd2c608, 0x087cf162, 0x0146152e,
+0x8a0f0000, 0x000000d0, 0x00ca850f, 0xf1620000,
+0x7528087c, 0x7dcbc5fb, 0x67b8c055, 0xc5000007,
+0xc5d17ceb, 0x62d17ceb, 0xc2086cf1, 0xf8c500c1,
+0xe283d093, 0x0ffa800f, 0x00ad850f, 0xf3620000,
+0x4d26087d, 0xf16200fb, 0x4d29087c, 0x7df262f8,
+0xfb4d4208, 0x087cf162, 0x62f94d29, 0x10087ef1,
+0x0000cb0d, 0x31c03100, 0x6ef162d2, 0x62d27b08,
+0x2e087cf1, 0x7ae48554, 0x8d647566, 0x708d0178,
+0x83fe2102, 0xd28301fe, 0x75c78500, 0x7cf1620c,
+0x854c2e08, 0x754f7ae0, 0xc0ff484d, 0x04f88348,
+0xf162c775, 0x7528087c, 0x7cf162f8, 0xfb7d2808,
+0x00077db8, 0x4df26200, 0xf94d2c08, 0x0844f162,
+0xc500d1c2, 0x83d293f8, 0xfa800fe2, 0xe81c750f,
+0xfffff601, 0x13ebd8f7, 0x00075eb8, 0xb80ceb00,
+0x00000773, 0x78b805eb, 0xc9000007, 0x000000c3,
+0x41000000, 0x41100000, 0x41000000, 0x40a00000,
+0xc1000000, 0xc1100000, 0xc1000000, 0xc0a00000,
+0x00000000, 0x40400000, 0x40800000, 0x40400000,
+0x80000000, 0xc0400000, 0xc0800000, 0xc0400000,
+0x3f800000, 0x00000000, 0x00000000, 0x00000000,
+0xbf800000, 0x3f000000, 0x41200000,
+0005174,
+};
+asm(".type avx512f_x86_64_D_16f4, STT_NOTYPE;");
+asm(".type avx512f_x86_64_D_16f4, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512f_x86_64_D_16f8[] = {
+0x00029de9, 0x89485500, 0xfff162e5, 0x050d1008,
+0x62000009, 0x1008fff1, 0x0008c315, 0xfff16200,
+0xf94d1108, 0x08fff162, 0x62fa4d11, 0x1108fff1,
+0xf162fc55, 0x4d1108ff, 0xfff162fe, 0xfb551108,
+0x08fff162, 0x62fd4d11, 0x1108fff1, 0xf162ff4d,
+0x4d2808fd, 0x00a7b8fe, 0xf1620000, 0x152808fd,
+0x0000088c, 0x08fdf162, 0xf262d928, 0x5d9808f5,
+0xedf162fd, 0x00c3c208, 0xd093f8c5, 0x0f03fa80,
+0x00021b85, 0xfdf16200, 0x62d92808, 0x9e08f5f2,
+0xabb8fd5d, 0x62000000, 0x2808fdf1, 0x00085f15,
+0xedf16200, 0x00cbc208, 0xd193f8c5, 0x0f03fa80,
+0x0001eb85, 0xfdf16200, 0x62d92808, 0x9a08f5f2,
+0xafb8fd5d, 0x62000000, 0x2808fdf1, 0x00083f15,
+0xedf16200, 0x00d3c208, 0xd293f8c5, 0x0f03fa80,
+0x0001bb85, 0xfdf16200, 0x62d92808, 0x9c08f5f2,
+0xb3b8fd5d, 0x62000000, 0x2808fdf1, 0x00081f15,
+0xedf16200, 0x00dbc208, 0xd393f8c5, 0x0f03fa80,
+0x00018b85, 0xfdf16200, 0xfd552808, 0x08edf162,
+0xf162d958, 0x752808fd, 0xfff162fe, 0xf9651208,
+0x0000bbb8, 0xcdf26200, 0x62e29808, 0xc208e5f1,
+0xf8c500e4, 0xfa80d493, 0x51850f03, 0x62000001,
+0x2808fdf1, 0xf162fe75, 0xe22808fd, 0x0000c0b8,
+0xfff16200, 0xb52d1208, 0xc5000007, 0x62dd57e1,
+0x9e18cdf2, 0xf162f965, 0xecc208e5, 0x93f8c500,
+0x03fa80d5, 0x0116850f, 0xf1620000, 0xc95c08ed,
+0x08fdf162, 0x62fe7d28, 0x1208fff1, 0xc5b8f95d,
+0x62000000, 0x9a08c5f2, 0xf5f162da, 0x00f3c208,
+0xd693f8c5, 0x0f03fa80, 0x0000e385, 0xfdf16200,
+0xfe752808, 0x08fdf162, 0xf1c5da28, 0xcab8cd57,
+0x62000000, 0x9c18cdf2, 0xf162f95d, 0xfbc208f5,
+0x93f8c500, 0x03fa80d7, 0x00b2850f, 0xf1620000,
+0x4d5908ed, 0xfdf162fe, 0xff5d2808, 0xf3d0f1c5,
+0x08fdf162, 0x62fe6528, 0x2808fdf1, 0x00d4b8fa,
+0xf2620000, 0x7da608dd, 0xcdf162ff, 0x00c7c208,
+0xd093f8c5, 0x7503fa80, 0x57e1c577, 0xd0f1c5dd,
+0xedf262cb, 0xff65a708, 0x0000d8b8, 0xf5f16200,
+0x00ccc208, 0xd193f8c5, 0x7503fa80, 0xedf16253,
+0xfe5d5908, 0x5dd0e1c5, 0xfdf162f0, 0xff652808,
+0x08fdf162, 0xdeb8ea28, 0x62000000, 0x9608ddf2,
+0xf162fe6d, 0xd5c208e5, 0x93f8c500, 0x03fa80d2,
+0xf2621e75, 0x559708dd, 0x00e2b8fe, 0xf1620000,
+0xdac208f5, 0x93f8c500, 0x03fa80d3, 0xc0310275,
+0x4855c35d, 0x8348e589, 0x8b4870ec, 0x00067705,
+0xfff16200, 0x5d151008, 0x62000006, 0x1008fff1,
+0x00061b0d, 0x45894800, 0xfff162f8, 0xfa551108,
+0x08fff162, 0x62fc4d11, 0x1108fff1, 0xf162fe55,
+0x4d1108ff, 0xfff162fb, 0xfd551108, 0x08fdf162,
+0x62fd5d28, 0x2908fdf1, 0xf162fa5d, 0x4d2808fd,
+0x0539b8fa, 0xf1620000, 0xc3c208f5, 0x93f8c500,
+0x03fa80d0, 0x05bc850f, 0xf1620000, 0x5d5808f5,
+0xfdf162fd, 0xfb5d2908, 0x08fdf162, 0x62fd6528,
+0x2808fdf1, 0x3fb8fb5d, 0x62000005, 0x5808ddf1,
+0xe5f162e4, 0x00d4c208, 0xd293f8c5, 0x0f03fa80,
+0x00058185, 0xe5f16200, 0xfd5d5c08, 0x08fdf162,
+0x62fc5d29, 0xc208f5f1, 0xb800fc5d, 0x00000544,
+0xd393f8c5, 0x0f03fa80, 0x00055985, 0xfdf16200,
+0xfe5d2808, 0x08f5f162, 0x62fd4d59, 0x5908e5f1,
+0xfdf162e3, 0xfd5d2808, 0x08e5f162, 0x62fe7558,
+0x5c08e5f1, 0xf162fe6d, 0xcc5c08f5, 0x00055bb8,
+0xd5f16200, 0x62ee5908, 0xc208f5f1, 0xf8c500e5,
+0xfa80d493, 0x0b850f03, 0x62000005, 0x5908e5f1,
+0xf162ff4d, 0x4d2908fd, 0xe5f162fa, 0xff5d5e08,
+0x08f5f162, 0xb800ebc2, 0x00000564, 0xd593f8c5,
+0x0f03fa80, 0x0004dd85, 0xfdf16200, 0xff652808,
+0x000567b8, 0xfff16200, 0x110d1208, 0xc5000005,
+0xc5d957d9, 0xd04d57f1, 0x08e5f162, 0x62fa5d59,
+0xc208e5f1, 0xf8c500f1, 0xfa80d693, 0xa3850f03,
+0x62000004, 0xe608fff1, 0xf162fd4d, 0xc9e6087e,
+0x08f5f162, 0x00fd7dc2, 0x00056eb8, 0x93f8c500,
+0x03fa80d7, 0x047c850f, 0xf2620000, 0x4d4c08fd,
+0xfdf162fd, 0xfa4d2908, 0x08fdf162, 0x62fd6d28,
+0x4c08fdf2, 0xf162fa4d, 0xc9e608ff, 0x087ef162,
+0x75b8c9e6, 0x62000005, 0xc208f5f1, 0xf8c500c5,
+0xfa80d093, 0x3b850f03, 0x62000004, 0x5908d5f1,
+0xfdf162cd, 0xfa4d2908, 0x08fdf262, 0x62fa4d4e,
+0x2908fdf1, 0xf162fb4d, 0x4d2808fd, 0x057cb8fb,
+0xf2620000, 0xd94c08fd, 0x08fff162, 0xf162dbe6,
+0xdbe6087e, 0x08e5f162, 0xc500d5c2, 0x80d293f8,
+0x850f03fa, 0x000003ee, 0x08fdf262, 0x62fd5d4c,
+0xe608fff1, 0xfff162c9, 0x62dbe608, 0xe6087ef1,
+0x7ef162c9, 0x62dbe608, 0xc208f5f1, 0x7eb800db,
+0xc5000005, 0x80d393f8, 0x850f03fa, 0x000003b6,
+0x08fcf162, 0x62fd5d79, 0x7a087ef1, 0xfdf162db,
+0xfd4d2808, 0x00058fb8, 0xe5f16200, 0x00e1c208,
+0xd493f8c5, 0x0f03fa80, 0x00038985, 0xf5f16200,
+0x62d95908, 0x2908fdf1, 0xf162fa5d, 0x5d5108fd,
+0xe5f162fa, 0x00e9c208, 0x00059cb8, 0x93f8c500,
+0x03fa80d5, 0x035c850f, 0xf1620000, 0xda1208ff,
+0x08e5f162, 0xf162d95e, 0x5d2908fd, 0xfdf362fa,
+0xfa6d0908, 0x05a4b80b, 0xf1620000, 0x1d6e08fd,
+0x0000038c, 0x08e5f162, 0xc500f5c2, 0x80d693f8,
+0x850f03fa, 0x0000031e, 0x08ddf162, 0x62fe5d59,
+0x5908ddf1, 0xfdf162e9, 0xfb5d2908, 0x08d5f162,
+0x62fb5d5f, 0x5d08d5f1, 0xf162fb6d, 0x6d2908fd,
+0xe5f162fb, 0xfb5d5808, 0x08f5f162, 0xb8fe4d58,
+0x0000063d, 0x08e5f162, 0xf162dc59, 0xf9c208e5,
+0x93f8c500, 0x03fa80d7, 0x02c8850f, 0xf1620000,
+0x4d2808fd, 0x064eb8fd, 0xf1620000, 0xd9c608f5,
+0xfdf16201, 0xfe4d2808, 0x08e5f162, 0xc500c9c2,
+0x80d193f8, 0x850f03fa, 0x0000029a, 0x08fdf162,
+0xb8fd5d28, 0x00000653, 0x08fdf362, 0x6201eb05,
+0xc208d5f1, 0xf8c500c1, 0xfa80d093, 0x73850f03,
+0x62000002, 0x5808f5f1, 0x065db8db, 0xf1620000,
+0x351008ff, 0x00000280, 0x08fff162, 0x62f37511,
+0x5908fdf2, 0xf162f36d, 0xd3c208d5, 0x93f8c500,
+0x03fa80d2, 0x023c850f, 0xf1620000, 0x5d1608f5,
+0xfdf162fa, 0xfd7d2808, 0x08f5f162, 0xf162cf15,
+0xc95c08e5, 0x08fff162, 0xb8f35511, 0x000006a6,
+0x08fdf262, 0x62f35d59, 0x5908f5f1, 0xf5f162cc,
+0x00dbc208, 0x08fdf162, 0xc5fc4d29, 0x80d393f8,
+0x850f03fa, 0x000001ee, 0x4d120ff2, 0xddf162d0,
+0x311d5818, 0x62000002, 0x2808fdf1, 0x17b8fd6d,
+0x62000007, 0x5c08f5f1, 0xe5f162cd, 0xd51d5918,
+0x62000001, 0xc208f5f1, 0xf8c500e3, 0xfa80d493,
+0xaf850f03, 0x62000001, 0x1008fff1, 0xf162fd4d,
+0x6d2908fd, 0x7d8d48fb, 0x072ab8c0, 0xf1620000,
+0x4d1108ff, 0x57f1c5f7, 0xc2f1c5c9, 0xf9c501cc,
+0xf162e9f7, 0x7d6f08fd, 0x65f362fe, 0x55d92508,
+0xfbf7f9c5, 0x08fdf162, 0x62fb4d28, 0x2808fdf1,
+0xf162fc7d, 0xe9c208c5, 0x93f8c500, 0x03fa80d5,
+0x0150850f, 0xf1620000, 0x7d2808fd, 0xc5aab0fd,
+0xb8c892f8, 0x0000073a, 0x09c5f262, 0x62fe5d65,
+0xc208e5f1, 0xf8c500f1, 0xfa80d693, 0x23850f03,
+0x62000001, 0x2808fdf1, 0xc1c5fd7d, 0x62e04dd0,
+0x2808fdf1, 0xf162fd5d, 0x6d2808fd, 0x0743b8fe,
+0xf1620000, 0xe55c08e5, 0x09e5f162, 0xf162e558,
+0xfcc208f5, 0x93f8c500, 0x03fa80d7, 0x00e4850f,
+0xf1620000, 0x5d2908fd, 0x57e1c5fa, 0x7ce1c5db,
+0xf162a04d, 0xc91508f5, 0x08fdf162, 0x8a0fce2e,
+0x000000af, 0x00a9850f, 0xf1620000, 0x7d2808fd,
+0x7dc1c5fd, 0x67b8e04d, 0xc5000007, 0x62cb7cf1,
+0xc208f5f1, 0xf8c500cb, 0xfa80d193, 0x93850f03,
+0x62000000, 0x2608fdf3, 0x6200fd4d, 0x2908fdf1,
+0xf262fa4d, 0x4d4208fd, 0xfdf162fd, 0xfb4d2908,
+0xc957f1c5, 0x08fdf162, 0x7af64d2e, 0x625b755d,
+0x2e08fdf1, 0x597af455, 0xf1625775, 0x552e08fd,
+0x75477af7, 0xfdf16245, 0xf5552e08, 0x4175437a,
+0x08fdf162, 0xb8fa7528, 0x0000077d, 0x08cdf262,
+0x62fb4d2c, 0x2808fdf1, 0xf162fd75, 0xc1c208cd,
+0x93f8c500, 0x03fa80d0, 0x46e81c75, 0xf7fffff7,
+0xb813ebd8, 0x0000075e, 0x73b80ceb, 0xeb000007,
+0x0778b805, 0xc3c90000, 0x00000000, 0x00000000,
+0x00000000, 0x40000000, 0x00000000, 0x3fe00000,
+0x00000000, 0x40100000, 0x00000000, 0x40080000,
+0x00000000, 0xc0100000, 0x00000000, 0xc0080000,
+0x00000000, 0x00000000, 0x00000000, 0x3ff00000,
+0x00000000, 0x80000000, 0x00000000, 0xbff00000,
+0x00000000, 0x3ff00000, 0x00000000, 0x00000000,
+0004500,
+};
+asm(".type avx512f_x86_64_D_16f8, STT_NOTYPE;");
+asm(".type avx512f_x86_64_D_16f8, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512f_x86_64_D_32i4[] = {
+0xb85500eb, 0x00000001, 0x000020bf, 0x09bb4100,
+0x48000000, 0x8348e589, 0x8148e0e4, 0x0000e8ec,
+0xff488d00, 0x89d98945, 0x89248444, 0xc12941ca,
+0x4401e283, 0x44844c89, 0x1901fa83, 0xd23145f6,
+0xff02e683, 0x41c885ce, 0xc1c2940f, 0x748903e2,
+0xe9d16484, 0x09d72944, 0x84bc89ca, 0x00000084,
+0xa4849489, 0x83000000, 0x948904c2, 0x0000c484,
+0xc0ff4800, 0x09f88348, 0xf162a775, 0xb46f287d,
+0x00002824, 0x7df16200, 0x24b47f28, 0xffffffc8,
+0x287df162, 0xc8248c6f, 0xb8ffffff, 0x00000539,
+0x2875f362, 0xc500c61f, 0xfed093f8, 0xd4850fc2,
+0x62000006, 0xfe2875f1, 0x00282494, 0xf1620000,
+0x947f287d, 0xffffe824, 0x7df162ff, 0x24946f28,
+0xffffffe8, 0x2865f162, 0x2824b472, 0x01000000,
+0x00053fb8, 0x6df36200, 0x00d31f28, 0xd293f8c5,
+0x850fc2fe, 0x0000068f, 0x286df162, 0x282494fa,
+0x62000000, 0x7f287df1, 0x00082494, 0xf3620000,
+0x9c1f2875, 0x00000824, 0x44b80000, 0xc5000005,
+0xfed393f8, 0x5c850fc2, 0x62000006, 0x6f287df1,
+0x004824bc, 0xf2620000, 0x8c402875, 0x00002824,
+0x45f26200, 0x62df4028, 0x6f287df1, 0x002824a4,
+0xf1620000, 0xeffe285d, 0x285df162, 0x482494fa,
+0x62000000, 0xfa2875f1, 0x055bb8cb, 0xf2620000,
+0xd540286d, 0x2875f362, 0x6200e21f, 0x7f287df1,
+0x00082494, 0xf8c50000, 0xc2fed493, 0x05f5850f,
+0xf2620000, 0x8c40285d, 0x00004824, 0x75f36200,
+0xf82d1f28, 0x00000005, 0xa42444c7, 0x00000002,
+0x0005c8b8, 0x93f8c500, 0x0fc2fed5, 0x0005c685,
+0x5df16200, 0x248cef28, 0x00000068, 0x287df162,
+0xc8248c7f, 0x62ffffff, 0x2828f5f2, 0x0048248c,
+0xf1620000, 0x8c7f287d, 0xffffe824, 0x48c031ff,
+0xc8045463, 0x044c6348, 0xaf0f4848, 0x045489d1,
+0xeac14808, 0x04548920, 0xc083480c, 0xf8834808,
+0x62dc7520, 0x6f287df1, 0xffe824b4, 0xe1b8ffff,
+0x62000005, 0x76284df1, 0x000824b4, 0xf8c50000,
+0xc2fed693, 0x054d850f, 0xf2620000, 0x9440285d,
+0x00006824, 0x7df16200, 0x24947f28, 0x00000008,
+0x2875f162, 0x0824b472, 0x03000000, 0x287df162,
+0xc8248c7f, 0x62ffffff, 0x722865f1, 0x000824b4,
+0x62020000, 0xfe2865f1, 0x05edb8eb, 0xf3620000,
+0xfd1f2875, 0x93f8c500, 0x0fc2fed7, 0x0004f685,
+0x75f16200, 0x24a47228, 0xffffffc8, 0x75f16202,
+0xb8c9fe28, 0x000005f2, 0x2865f362, 0xc500c11f,
+0xfed093f8, 0xcc850fc2, 0xc7000004, 0x03a42444,
+0x48000000, 0xa4244463, 0x08fdf162, 0xf162c86e,
+0xc9f2286d, 0xa42444c7, 0x00000002, 0x24446348,
+0xfdf162a4, 0x62f86e08, 0xf2286df1, 0x6df162d7,
+0xb8dafe28, 0x00000605, 0x2875f362, 0xc500d31f,
+0xfed293f8, 0x7c850fc2, 0x48000004, 0xa4244463,
+0x08fdf162, 0xf162f06e, 0xcee22875, 0x2875f162,
+0x09b8c9fe, 0x62000006, 0x1f286df3, 0xf8c500d9,
+0xc2fed393, 0x044d850f, 0xf1620000, 0xbc6f287d,
+0x00008824, 0x75f16200, 0x62c9ef08, 0x1f2845f3,
+0xf26206c9, 0x9440a95d, 0x00006824, 0x6df26200,
+0x249c4728, 0x00000088, 0x287df162, 0x8824b46f,
+0xb8000000, 0x00000001, 0x287df262, 0xf162c87c,
+0xc9fa284d, 0x287df162, 0x88248c7f, 0x62000000,
+0x47286df2, 0x0088248c, 0x21b80000, 0x62000006,
+0xfe2875f1, 0x65f362e9, 0x00e51f28, 0xd493f8c5,
+0x850fc2fe, 0x000003cf, 0x2875f262, 0x88248c46,
+0xb8000000, 0x00000626, 0x2875f362, 0xc500ea1f,
+0xfed593f8, 0xac850fc2, 0x62000003, 0x6f287df1,
+0x0068248c, 0xf2620000, 0x94402875, 0x00004824,
+0x75f26200, 0x249c4028, 0x00000028, 0x287df162,
+0xe824947f, 0x62ffffff, 0x3d2865f2, 0xffe82494,
+0xf262ffff, 0x9c392865, 0xffffe824, 0x7df162ff,
+0x249c7f28, 0xffffffe8, 0x286df162, 0xe82494fe,
+0x62ffffff, 0xfe285df1, 0x0048249c, 0x3db80000,
+0x62000006, 0x40286df2, 0x6df362d1, 0x00f31f28,
+0xd693f8c5, 0x850fc2fe, 0x0000032b, 0x285df262,
+0xf162d140, 0x947f287d, 0xffffc824, 0x7df262ff,
+0x24941e28, 0xffffffc8, 0x286df362, 0xb800fc1f,
+0x00000644, 0xd793f8c5, 0x850fc2fe, 0x000002f7,
+0x287df162, 0x2824bc6f, 0x62000000, 0x6f287df1,
+0x0048249c, 0x4eb80000, 0x62000006, 0x432845f3,
+0xf16201d7, 0xd270287d, 0x6df3621b, 0x00c31f28,
+0xd093f8c5, 0x850fc2fe, 0x000002bb, 0x000001b8,
+0x7df16200, 0x24a46f28, 0x00000028, 0x287df262,
+0x53b8d07c, 0x62000006, 0xfa2865f1, 0x6df262d2,
+0x62d43628, 0x1f286df3, 0xf8c500cb, 0xc2fed193,
+0x0281850f, 0xf1620000, 0xd4fe2865, 0xb82444c7,
+0x00000009, 0x00065db8, 0x7df26200, 0x246c5828,
+0x55f362ee, 0x00d21f28, 0xd293f8c5, 0x850fc2fe,
+0x00000253, 0x000009b8, 0x7df26200, 0x62e87c28,
+0x1f2855f3, 0x61b800da, 0xc5000006, 0xfed393f8,
+0x30850fc2, 0x62000002, 0x39287df3, 0xffb824a4,
+0x6200ffff, 0x5a287df2, 0xffb82494, 0xf362ffff,
+0xa438285d, 0xffffb824, 0xf36201ff, 0xe41f286d,
+0x93f8c500, 0xb8c0fec4, 0x0000066c, 0x01f5850f,
+0xf1620000, 0x946f287d, 0x0000a824, 0x7df16200,
+0x62e36f28, 0x7e286df2, 0x002824a4, 0xf1620000,
+0xb46f287d, 0x0000c824, 0x4df26200, 0x249c7e28,
+0x00000028, 0x285df162, 0x44c7dbfa, 0x0004b824,
+0xa6b80000, 0x62000006, 0x402865f2, 0x7df262d9,
+0x24645828, 0x65f362ee, 0x00ec1f28, 0xd593f8c5,
+0x850fc2fe, 0x0000018f, 0x2875f262, 0x28249c40,
+0x62000000, 0x722875f1, 0xf1621fe1, 0x9c7f287d,
+0xffffc824, 0x65f262ff, 0x62d17628, 0x7f287df1,
+0xffe82494, 0xf162ffff, 0xbc6f287d, 0xffffc824,
+0x7df362ff, 0x24bc3928, 0xffffffb8, 0x7df26200,
+0x248c2528, 0xffffffb8, 0x287df162, 0x08248c7f,
+0x62000000, 0x1f2875f3, 0xb3b800f2, 0xc5000006,
+0xfed693f8, 0x1c850fc2, 0x62000001, 0x6f287df1,
+0x0028248c, 0xf3620000, 0x8c39287d, 0xffffb824,
+0xf16200ff, 0xac6f087d, 0xffffb824, 0x7df162ff,
+0x24ac7f08, 0xffffffa8, 0x287df262, 0xa8249425,
+0x62ffffff, 0x7f287df1, 0xffc82494, 0xf162ffff,
+0xb46f287d, 0xffffc824, 0x7ef262ff, 0x24b43528,
+0xffffffb8, 0x7c8bc031, 0x7c392804, 0x0a74b804,
+0x0006f1b8, 0x00ade900, 0x83480000, 0x834804c0,
+0xe27510f8, 0x4c24448b, 0x287df162, 0xe8248c7f,
+0x89ffffff, 0x8bec2444, 0x89542444, 0x8bf42444,
+0x895c2444, 0x8bfc2444, 0x89642444, 0x62042444,
+0x6f287df1, 0x0028248c, 0xaab00000, 0xc892f8c5,
+0x00073ab8, 0x75f26200, 0x24946429, 0x00000048,
+0x286df362, 0xe824bc1f, 0x00ffffff, 0xd793f8c5,
+0x4375c2fe, 0x2875f362, 0xb801d903, 0x00000007,
+0x000000ba, 0x7df26200, 0xb8d07c28, 0x00000001,
+0x2875f162, 0xf262cadb, 0xd07c287d, 0x2875f162,
+0xf362cafe, 0xc11f2865, 0x93f8c500, 0xb8c0fec0,
+0x0000074a, 0xc9c2440f, 0x000000c3, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000008, 0x0000000e, 0x00000012, 0x00000014,
+0x00000014, 0x00000012, 0x0000000e, 0x00000008,
+0003700,
+};
+asm(".type avx512f_x86_64_D_32i4, STT_NOTYPE;");
+asm(".type avx512f_x86_64_D_32i4, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512f_x86_64_D_32u4[] = {
+0x315500eb, 0x0020bec0, 0xbb410000, 0x00000008,
+0x48e58948, 0x48e0e483, 0x00e8ec81, 0x788d0000,
+0x45c28901, 0xc189d989, 0x83c12941, 0x314501e2,
+0x41c785d2, 0x44c2940f, 0xd1ff428d, 0x847c89e9,
+0x03e2c128, 0x44d62944, 0x48844c89, 0x8944ca09,
+0x89688444, 0x00a88494, 0xc2830000, 0x84b48904,
+0x00000088, 0xc8849489, 0x48000000, 0x8348c0ff,
+0xaa7508f8, 0x287df162, 0x2824bc6f, 0x62000000,
+0x7f287df1, 0xffc824bc, 0xf162ffff, 0x946f287d,
+0xffffc824, 0x0539b8ff, 0xf3620000, 0xc71f286d,
+0x93f8c500, 0x0fc2fed0, 0x00064485, 0x6df16200,
+0x248cfe28, 0x00000028, 0x287df162, 0xe8248c7f,
+0x62ffffff, 0x6f287df1, 0xffe8248c, 0xf162ffff,
+0xb4722865, 0x00002824, 0x3fb80100, 0x62000005,
+0x1f2875f3, 0xf8c500d3, 0xc2fed293, 0x05ff850f,
+0xf1620000, 0x8cfa2875, 0x00002824, 0x7df16200,
+0x248c7f28, 0x00000008, 0x287df162, 0x08249c6f,
+0xb8000000, 0x00000544, 0x286df362, 0xc500db1f,
+0xfed393f8, 0xc6850fc2, 0x62000005, 0xeb286df1,
+0x00482494, 0xf1620000, 0x947f287d, 0xffffc824,
+0x75f162ff, 0x248cdb28, 0x00000048, 0x2865f162,
+0x482494ef, 0x62000000, 0x7f287df1, 0x00082494,
+0xf1620000, 0x8cdf2875, 0xffffc824, 0x0550b8ff,
+0xf3620000, 0xe21f2875, 0x93f8c500, 0x0fc2fed4,
+0x00056c85, 0x7df16200, 0x24946f28, 0x00000028,
+0x286df262, 0x48248c40, 0x62000000, 0x1f2875f3,
+0x00055a2d, 0x44c70000, 0x0002a424, 0xc8b80000,
+0xc5000005, 0xfed593f8, 0x32850fc2, 0x62000005,
+0xef286df1, 0x0068248c, 0xf1620000, 0x8c7f287d,
+0xffffc824, 0xf5f162ff, 0x248cf428, 0x00000048,
+0x287df162, 0xe8248c7f, 0x31ffffff, 0x04548bc0,
+0x044c8bc8, 0xaf0f4848, 0x045489d1, 0xeac14808,
+0x04548920, 0xc083480c, 0xf8834808, 0x62de7520,
+0x6f287df1, 0xffe824b4, 0xe1b8ffff, 0x62000005,
+0x76284df1, 0x000824b4, 0xf8c50000, 0xc2fed693,
+0x04bb850f, 0xf1620000, 0x947f287d, 0x00000824,
+0x75f16200, 0x24b47228, 0x00000008, 0x7df16203,
+0x248c7f28, 0xffffffc8, 0x2865f162, 0x0824b472,
+0x02000000, 0x2865f162, 0xedb8e3fe, 0x62000005,
+0x1f2875f3, 0xf8c500fc, 0xc2fed793, 0x046f850f,
+0xf1620000, 0x94722875, 0xffffc824, 0xf16202ff,
+0xc9fe2875, 0x0005f2b8, 0x65f36200, 0x00c11f28,
+0xd093f8c5, 0x850fc2fe, 0x00000445, 0xa42444c7,
+0x00000003, 0x087df162, 0xe9244c6e, 0x286df162,
+0x44c7c9f2, 0x0002a424, 0xf1620000, 0x5c6e087d,
+0xf162e924, 0xdbf2286d, 0x2865f162, 0x05b8e3fe,
+0x62000006, 0x1f2875f3, 0xf8c500cc, 0xc2fed193,
+0x03fb850f, 0xf1620000, 0x646e087d, 0xf162e924,
+0xccd22875, 0x2875f162, 0x09b8c9fe, 0x62000006,
+0x1f2865f3, 0xf8c500d1, 0xc2fed293, 0x03cf850f,
+0xf1620000, 0xdbef0865, 0xc976f5c5, 0x287df162,
+0xe5c5e26f, 0x88249c76, 0x62000000, 0x252875f3,
+0xf26240e3, 0xac47285d, 0x00008824, 0x75f16200,
+0x249cfe28, 0x00000088, 0x287df162, 0x88249c7f,
+0x62000000, 0x47285df2, 0x0088249c, 0x21b80000,
+0x62000006, 0xfe2865f1, 0x55f362f3, 0x00de1f28,
+0xd393f8c5, 0x850fc2fe, 0x00000365, 0x2865f262,
+0x88249c45, 0xb8000000, 0x00000626, 0x2865f362,
+0xc500e41f, 0xfed493f8, 0x42850fc2, 0x62000003,
+0x3b286df2, 0x0048249c, 0xf2620000, 0xa43f286d,
+0x00004824, 0x6df16200, 0x2494fe28, 0x00000048,
+0x2865f162, 0x34b8dcfe, 0x62000006, 0x1f2865f3,
+0xf8c500ea, 0xc2fed593, 0x0303850f, 0xf1620000,
+0xbc6f287d, 0x00002824, 0x7df16200, 0x24946f28,
+0x00000048, 0x00064eb8, 0x45f36200, 0x01df4328,
+0x287df162, 0x621bdb70, 0x1f2865f3, 0xf8c500f2,
+0xc2fed693, 0x02c7850f, 0xf1620000, 0x9c6f287d,
+0x00002824, 0x6df16200, 0xb8e1fe28, 0x00000653,
+0x285df262, 0xf362e336, 0xfa1f285d, 0x93f8c500,
+0x0fc2fed7, 0x00029885, 0x6df16200, 0xc7e3fe28,
+0x09b82444, 0xb8000000, 0x0000065d, 0x287df262,
+0xee246c58, 0x2855f362, 0xc500c41f, 0xfed093f8,
+0x6a850fc2, 0xb8000002, 0x00000009, 0x287df262,
+0xf362e87c, 0xcc1f2855, 0x0661b800, 0xf8c50000,
+0xc2fed193, 0x0247850f, 0xf3620000, 0x9c39287d,
+0xffffb824, 0xf26200ff, 0xa45a287d, 0xffffb824,
+0x65f362ff, 0x249c3828, 0xffffffb8, 0x5df36201,
+0x00d31f28, 0xc293f8c5, 0x6cb8c0fe, 0x0f000006,
+0x00020c85, 0x7df16200, 0x249c6f28, 0x000000a8,
+0x287df162, 0xf262e26f, 0xa47e2865, 0x00002824,
+0x7df16200, 0x24b46f28, 0x000000c8, 0x284df262,
+0x2824947e, 0x62000000, 0xfe2875f1, 0x6df362ca,
+0x24942528, 0x00000068, 0x06a6b855, 0x44c70000,
+0x0004b824, 0xf1620000, 0xccfa2875, 0x2875f162,
+0x68248cef, 0x62000000, 0xfa2875f1, 0x7df262ca,
+0x24545828, 0x75f362ee, 0x00da1f28, 0xd393f8c5,
+0x850fc2fe, 0x00000189, 0x287df162, 0x28248c6f,
+0x62000000, 0xef086df1, 0x65f262d2, 0x62ca7e28,
+0x762875f2, 0x7df162da, 0x248c7f28, 0xffffffe8,
+0x287df162, 0x08249c7f, 0x62000000, 0x6f287df1,
+0x002824bc, 0xf3620000, 0xbc39287d, 0xffffb824,
+0xf26200ff, 0x9435287d, 0xffffb824, 0x6df362ff,
+0x00e11f28, 0x0006d3b8, 0x93f8c500, 0x0fc2fed4,
+0x00011c85, 0x7df16200, 0x248c6f28, 0x00000028,
+0x287df362, 0xb8248c39, 0x00ffffff, 0x087df162,
+0xb824ac6f, 0x62ffffff, 0x7f087df1, 0xffa824ac,
+0xf262ffff, 0x9435287d, 0xffffa824, 0x7df162ff,
+0x24947f28, 0xffffffc8, 0x287df162, 0xc824b46f,
+0x62ffffff, 0x35287ef2, 0xffb824b4, 0xc031ffff,
+0x2804748b, 0xb8047439, 0xf1b80a74, 0xe9000006,
+0x000000ad, 0x04c08348, 0x10f88348, 0x448be275,
+0xf1624c24, 0x8c7f287d, 0xffffe824, 0x244489ff,
+0x24448bec, 0x24448954, 0x24448bf4, 0x2444895c,
+0x24448bfc, 0x24448964, 0x7df16204, 0x248c6f28,
+0x00000028, 0xf8c5aab0, 0x3ab8c892, 0x62000007,
+0x642975f2, 0x00482494, 0xf3620000, 0xac1f286d,
+0xffffe824, 0xf8c500ff, 0xc2fed593, 0xf3624375,
+0xd9032875, 0x0007b801, 0x00ba0000, 0x62000000,
+0x7c287df2, 0x0001b8d0, 0xf1620000, 0xcadb2875,
+0x287df262, 0xf162d07c, 0xcafe2875, 0x2865f362,
+0xc500f11f, 0xfec693f8, 0x074ab8c0, 0x440f0000,
+0x00c3c9c2, 0x00000000, 0x00000000, 0x00000000,
+0x00000008, 0x0000000e, 0x00000012, 0x00000014,
+0x00000014, 0x00000012, 0x0000000e, 0x00000008,
+0003440,
+};
+asm(".type avx512f_x86_64_D_32u4, STT_NOTYPE;");
+asm(".type avx512f_x86_64_D_32u4, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512f_x86_64_D_32i8[] = {
+0xb85500eb, 0x00000001, 0x000040bf, 0x05ba4100,
+0x48000000, 0x8348e589, 0x8148e0e4, 0x0000c8ec,
+0xff488d00, 0x48d0894d, 0x89c40489, 0xc02949ca,
+0x4c01e283, 0x20c44489, 0x4801fa83, 0x3145f619,
+0x02e683c9, 0x85ceff48, 0x940f41c1, 0x02e2c1c1,
+0xc4748948, 0x44e9d140, 0xca09cf29, 0x8948fe89,
+0x0080c494, 0x83480000, 0x894802c2, 0x4860c474,
+0xa0c49489, 0x48000000, 0x8348c0ff, 0xa17505f8,
+0x28fdf162, 0x0824b46f, 0x62000000, 0x7f28fdf1,
+0xffa824b4, 0xf162ffff, 0x946f28fd, 0xffffa824,
+0x0539b8ff, 0xf3620000, 0xc61f28ed, 0x93f8c500,
+0x0ffa80d0, 0x0727850f, 0xf1620000, 0x8cd428ed,
+0x00000824, 0xfdf16200, 0x248c7f28, 0xffffffc8,
+0x28fdf162, 0xc8248c6f, 0x62ffffff, 0x7328e5f1,
+0x000824b4, 0xb8010000, 0x0000053f, 0x28f5f362,
+0xc500d31f, 0x80d293f8, 0x850f0ffa, 0x000006e1,
+0x28f5f162, 0x08248cfb, 0x62000000, 0x7f28fdf1,
+0xffe8248c, 0xf362ffff, 0x9c1f28ed, 0xffffe824,
+0x44b800ff, 0xc5000005, 0x80d393f8, 0x850f0ffa,
+0x000006ad, 0x28ddf162, 0x08249473, 0x20000000,
+0x28edf162, 0x08249cf4, 0x62000000, 0x7328f5f1,
+0xf16220d2, 0x8cf428f5, 0x00000824, 0xddf16200,
+0x62d2f428, 0xd428f5f1, 0xf5f162ca, 0x20f17328,
+0x28e5f162, 0xf162d1d4, 0x9c6f28fd, 0x00002824,
+0xf5f16200, 0x20d37328, 0x28e5f162, 0xf162ebf4,
+0xcbf428f5, 0x28f5f162, 0xf162c9d4, 0xf17328f5,
+0xd5f16220, 0x62e9d428, 0x6f28fdf1, 0x0008249c,
+0x71620000, 0x84d428e5, 0x00002824, 0xe5f16200,
+0x24bcfb28, 0x00000028, 0x28cdd162, 0xb820d073,
+0x0000055b, 0x28f5f162, 0x6220d773, 0xf428cdf1,
+0xf5d162f7, 0x62c8f428, 0xf428c5d1, 0xf5f162e0,
+0x62ced428, 0x7328f5f1, 0xf16220f1, 0xe1d428dd,
+0x28edf162, 0xf362cdfb, 0xe41f28f5, 0x93f8c500,
+0x0ffa80d4, 0x05c7850f, 0xf1620000, 0x947328d5,
+0x00002824, 0xf1622000, 0xd37328ed, 0xedf16220,
+0x248cf428, 0x00000028, 0x28e5f162, 0x2824a4f4,
+0x62000000, 0xf428d5f1, 0xf5f162eb, 0x62cdd428,
+0x7328f5f1, 0xf16220f1, 0xc9d428dd, 0x28f5f362,
+0x05992d1f, 0xb8000000, 0x000005c8, 0xd593f8c5,
+0x0f0ffa80, 0x00056885, 0xfdf16200, 0x248c6f28,
+0x00000048, 0x28c5f162, 0x6220d173, 0xf428edf1,
+0xc5f162e1, 0x62fbf428, 0xf428e5f1, 0xddf162f1,
+0x62e7d428, 0x7328ddf1, 0xf16220f4, 0xe4d428cd,
+0x28fdf162, 0xe824a47f, 0x62ffffff, 0x7328ddf1,
+0xffe824b4, 0x6203ffff, 0x7f28fdf1, 0xffa824a4,
+0xf162ffff, 0xb47328d5, 0xffffe824, 0x716202ff,
+0xc5d428d5, 0x28edf162, 0xedb8d1f4, 0x62000005,
+0x1f28ddd3, 0xf8c500f0, 0xfa80d693, 0xde850f0f,
+0x62000004, 0x7228ddf1, 0xffa824a4, 0x6202ffff,
+0xd428ddf1, 0x05f2b8e4, 0xf3620000, 0xfc1f28d5,
+0x93f8c500, 0x0ffa80d7, 0x04b3850f, 0xf1620000,
+0xe7d428ed, 0x9c2444c7, 0x00000003, 0x28ddf162,
+0x6220f473, 0xd428cdf1, 0x446348e4, 0xf1629c24,
+0xe86e08fd, 0x28ddf162, 0x44c7edf3, 0x00029c24,
+0x63480000, 0x629c2444, 0x6e08fd71, 0xddd162e0,
+0x62e4f328, 0xd428dd71, 0x0605b8c4, 0xd3620000,
+0xc01f28d5, 0x93f8c500, 0x0ffa80d0, 0x044f850f,
+0x63480000, 0x629c2444, 0x6e08fd71, 0xd5d162e8,
+0x62ede228, 0xd428d5f1, 0x0609b8ed, 0xf3620000,
+0xcd1f28dd, 0x93f8c500, 0x0ffa80d1, 0x041f850f,
+0xf1620000, 0xd7d428ed, 0x28fdf162, 0x6824bc6f,
+0x62000000, 0x7328edf1, 0xf16220f2, 0xf2d428cd,
+0x08edf162, 0xe2c4d2ef, 0x62d23745, 0xdb28edf1,
+0xfdf162d6, 0x24947f28, 0xffffffe8, 0x28edf262,
+0x6824ac47, 0xb8000000, 0x00000001, 0x28fdf162,
+0x6824bc6f, 0x62000000, 0x7c28fdf2, 0xc5f162e0,
+0x62e4fb28, 0x7f28fdf1, 0x006824a4, 0xf2620000,
+0x944728ed, 0x00006824, 0x0621b800, 0xf1620000,
+0x947f28fd, 0xffffc824, 0xedf162ff, 0x62d2d428,
+0x1f28d5f3, 0xf8c500d2, 0xfa80d293, 0x7e850f0f,
+0x62000003, 0x6f28fdf1, 0xffc824b4, 0xf262ffff,
+0x944628cd, 0x00006824, 0x0626b800, 0xf3620000,
+0x9c1f28ed, 0xffffe824, 0xf8c500ff, 0xfa80d393,
+0x4a850f0f, 0x62000003, 0x6f28fd71, 0x00282494,
+0xf1620000, 0xd17328cd, 0xedf16220, 0x20d37328,
+0x28edf162, 0x7162e1f4, 0xcbf428cd, 0x28d5d162,
+0x6220d273, 0xf428cd51, 0xd5f162da, 0x62e9f428,
+0xf428ad71, 0xe5f162c1, 0x62f9f428, 0xd428ddd1,
+0xddf162e1, 0x20f47328, 0x28d5d162, 0xf162ebd4,
+0xf57328d5, 0xc5f16220, 0x62e4d428, 0xd428bdf1,
+0xfdf162ed, 0x24ac7f28, 0xffffffc8, 0x28ddf262,
+0xc824ac3d, 0x62ffffff, 0x3928ddf2, 0xffc824a4,
+0xf162ffff, 0xa47f28fd, 0xffffc824, 0xd5f162ff,
+0x24acd428, 0xffffffc8, 0x28edf162, 0x3db8d1f4,
+0x62000006, 0x7328ddf1, 0x716220d5, 0xc1f428d5,
+0x28ddf162, 0xf162e1f4, 0xedf428cd, 0x28ddf162,
+0xd162e5d4, 0xead428e5, 0x28ddf162, 0x6220f473,
+0xd428bdf1, 0xddf362e4, 0x00e51f28, 0xd493f8c5,
+0x0f0ffa80, 0x00025885, 0xedd16200, 0x62d1d428,
+0x7328edf1, 0xf16220f2, 0xfad428c5, 0x28fdf162,
+0xa824bc7f, 0x62ffffff, 0x1f28fdf2, 0xffa82494,
+0xf362ffff, 0xeb1f28ed, 0x0644b800, 0xf8c50000,
+0xfa80d593, 0x16850f0f, 0x62000002, 0x6f28fdf1,
+0x000824bc, 0x4eb80000, 0x62000006, 0x4328c5f3,
+0xf16201d7, 0xd270287d, 0xedd3624e, 0x00f21f28,
+0xd693f8c5, 0x0f0ffa80, 0x0001e485, 0x0001b800,
+0xf2620000, 0xd07c28fd, 0x000653b8, 0xadf16200,
+0x62d2fb28, 0x3628edf2, 0x00082494, 0xd3620000,
+0xfa1f28ed, 0x93f8c500, 0x0ffa80d7, 0x01af850f,
+0xf3620000, 0x940028fd, 0x00000824, 0x58b81b00,
+0x62000006, 0x1f28edd3, 0xf8c500c2, 0xfa80d093,
+0x8a850f0f, 0x62000001, 0x6f28fdf1, 0x000824bc,
+0x5db80000, 0x48000006, 0xa02444c7, 0x00000005,
+0x28fdf262, 0xf4245c59, 0x28c5d162, 0xf362d2d4,
+0xca1f28e5, 0x93f8c500, 0x0ffa80d1, 0x014f850f,
+0x05b80000, 0x62000000, 0x7c28fdf2, 0xe5f362d8,
+0x00d21f28, 0x000661b8, 0x93f8c500, 0x0ffa80d2,
+0x012b850f, 0xf1620000, 0x9c6f28fd, 0x00008824,
+0xadf26200, 0x249c7628, 0x00000008, 0x28fdf162,
+0xa824946f, 0x62000000, 0x7628adf2, 0x00082494,
+0xf1620000, 0xdafb28e5, 0x0006a6b8, 0x44c74800,
+0x0002a024, 0xf1620000, 0xd37328ed, 0xe5f16220,
+0x62e1f428, 0xf428cdf1, 0xedf162f3, 0x62c9f428,
+0x5928fdf2, 0x62f42454, 0xd428f5f1, 0xf5f162ce,
+0x20f17328, 0x28ddf162, 0xf362c9d4, 0xda1f28f5,
+0x93f8c500, 0x0ffa80d3, 0x00a3850f, 0x8b480000,
+0x62302444, 0x6f28fdf1, 0x000824b4, 0xf1620000,
+0xb47f28fd, 0xffffc824, 0x448948ff, 0x8b48d024,
+0x48402444, 0xe0244489, 0x28fdf162, 0x08248c6f,
+0xb0000000, 0x92f8c5aa, 0x073ab8c8, 0xf2620000,
+0x946429f5, 0x00002824, 0xedf36200, 0x24a41f28,
+0xffffffc8, 0x93f8c500, 0x0ffa80d4, 0xf3624375,
+0xd90328f5, 0x0003b801, 0x00ba0000, 0x62000000,
+0x7c28fdf2, 0x0001b8d0, 0xf1620000, 0xcadb28f5,
+0x28fdf262, 0xf162d07c, 0xcad428f5, 0x28e5f362,
+0xc500e91f, 0x3cc593f8, 0x074ab80f, 0x440f0000,
+0x00c3c9c2, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000004, 0x00000000, 0x00000006, 0x00000000,
+0x00000006, 0x00000000, 0x00000004, 0x00000000,
+0004040,
+};
+asm(".type avx512f_x86_64_D_32i8, STT_NOTYPE;");
+asm(".type avx512f_x86_64_D_32i8, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512f_x86_64_D_32u8[] = {
+0xb85500eb, 0x00000001, 0x000040be, 0x05ba4100,
+0x48000000, 0x8348e589, 0x8148e0e4, 0x0000c8ec,
+0xff488d00, 0x45d0894d, 0x8948c931, 0xca89c404,
+0x83c02949, 0xc18501e2, 0xc444894c, 0x940f4120,
+0xff7a8dc1, 0xe2c1e9d1, 0xff634802, 0x09ce2944,
+0x7c8948ca, 0xf78940c4, 0xc4948948, 0x00000080,
+0x02c28348, 0xc47c8948, 0x94894860, 0x0000a0c4,
+0xc0ff4800, 0x05f88348, 0xf162a775, 0xb46f28fd,
+0x00000824, 0xfdf16200, 0x24b47f28, 0xffffffa8,
+0x28fdf162, 0xa824946f, 0xb8ffffff, 0x00000539,
+0x28edf362, 0xc500c61f, 0x80d093f8, 0x850f0ffa,
+0x0000052a, 0x28edf162, 0x08248cd4, 0x62000000,
+0x7f28fdf1, 0xffc8248c, 0xf162ffff, 0x8c6f28fd,
+0xffffc824, 0xe5f162ff, 0x24b47328, 0x00000008,
+0x053fb801, 0xf3620000, 0xd31f28f5, 0x93f8c500,
+0x0ffa80d2, 0x04e4850f, 0xf1620000, 0x8cfb28f5,
+0x00000824, 0xfdf16200, 0x248c7f28, 0xffffffe8,
+0x28fdf162, 0xe8249c6f, 0xb8ffffff, 0x00000544,
+0x28edf362, 0xc500db1f, 0x80d393f8, 0x850f0ffa,
+0x000004aa, 0x28edf162, 0x282494eb, 0x62000000,
+0x7f28fdf1, 0xffa82494, 0xf162ffff, 0x8cdb28f5,
+0x00002824, 0xe5f16200, 0x249cef28, 0x00000028,
+0x28f5f162, 0xa8248cdf, 0xb8ffffff, 0x00000550,
+0x28f5f362, 0xc500e31f, 0x80d493f8, 0x850f0ffa,
+0x0000045a, 0x28fdf162, 0x0824946f, 0x62000000,
+0x7328ddf1, 0x00282494, 0x62200000, 0xf428edf1,
+0x0028249c, 0xf1620000, 0xe2f428dd, 0x28f5f162,
+0x6220d273, 0xf428f5f1, 0x0028248c, 0xf1620000,
+0xccd428f5, 0x28f5f162, 0x6220f173, 0xd428e5f1,
+0xf5f362c9, 0x042d1f28, 0x00000004, 0x0005c8b8,
+0x93f8c500, 0x0ffa80d5, 0x03f0850f, 0xf1620000,
+0x947f28fd, 0xffffe824, 0xf5f162ff, 0x24b47328,
+0xffffffe8, 0xfdf16203, 0x248c7f28, 0xffffffa8,
+0x28e5f162, 0xe824b473, 0x02ffffff, 0x28e5f162,
+0xedb8e3d4, 0x62000005, 0x1f28f5f3, 0xf8c500f4,
+0xfa80d693, 0xa3850f0f, 0x62000003, 0x7328f5f1,
+0xffa82494, 0x6202ffff, 0xd428f5f1, 0x05f2b8c9,
+0xf3620000, 0xf91f28e5, 0x93f8c500, 0x0ffa80d7,
+0x0378850f, 0x44c70000, 0x00039c24, 0xf1620000,
+0x4c6e087d, 0xf162e724, 0xc9f328ed, 0x9c2444c7,
+0x00000002, 0x087df162, 0xe7245c6e, 0x28edf162,
+0xf162dbf3, 0xe3d428e5, 0x000605b8, 0xf5f36200,
+0x00c41f28, 0xd093f8c5, 0x0f0ffa80, 0x00032d85,
+0x7df16200, 0x24646e08, 0xf5f162e7, 0x62ccd328,
+0xd428f5f1, 0x0609b8c9, 0xf3620000, 0xc91f28e5,
+0x93f8c500, 0x0ffa80d1, 0x0300850f, 0xf1620000,
+0xe4ef08dd, 0xc976f5c5, 0x28fdf162, 0xe2c4da6f,
+0x2464295d, 0xf5f36268, 0x40dc2528, 0x28fdf162,
+0xe8249c7f, 0x62ffffff, 0x4728e5f2, 0x006824a4,
+0xf1620000, 0xacd428f5, 0x00006824, 0xfdf16200,
+0x24ac7f28, 0x00000068, 0x28e5f262, 0x68249c47,
+0xb8000000, 0x00000621, 0x28fdf162, 0xc8249c7f,
+0x62ffffff, 0xd428e5f1, 0xddf362db, 0x00d31f28,
+0xd293f8c5, 0x0f0ffa80, 0x00028185, 0xfdf16200,
+0x24bc6f28, 0xffffffc8, 0x28c5f262, 0x68249c45,
+0xb8000000, 0x00000626, 0x28e5f362, 0xe8249c1f,
+0x00ffffff, 0xd393f8c5, 0x0f0ffa80, 0x00024d85,
+0xedf26200, 0x249c3b28, 0x00000028, 0x28edf262,
+0x2824a43f, 0x62000000, 0xd428edf1, 0x00282494,
+0xf1620000, 0xdcd428e5, 0x000634b8, 0xe5f36200,
+0x00e21f28, 0xd493f8c5, 0x0f0ffa80, 0x00020d85,
+0xfdf16200, 0x24ac6f28, 0x00000008, 0x28fdf162,
+0x2824946f, 0xb8000000, 0x0000064e, 0x28d5f362,
+0x6201dd43, 0x70287df1, 0xf3624edb, 0xea1f28e5,
+0x93f8c500, 0x0ffa80d5, 0x01d0850f, 0xf1620000,
+0xd9d428ed, 0x28e5f262, 0x08249c36, 0xb8000000,
+0x00000653, 0x28e5f362, 0xc500f21f, 0x80d693f8,
+0x850f0ffa, 0x000001a6, 0x28fdf362, 0x08249c00,
+0x1b000000, 0x000658b8, 0xe5f36200, 0x00fa1f28,
+0xd793f8c5, 0x0f0ffa80, 0x00018185, 0xfdf16200,
+0x24b46f28, 0x00000008, 0x00065db8, 0x44c74800,
+0x0005a024, 0xf2620000, 0x645928fd, 0xf162f424,
+0xdad428cd, 0x28ddf362, 0xc500c31f, 0x80d093f8,
+0x850f0ffa, 0x00000146, 0x000005b8, 0xfdf26200,
+0x62e07c28, 0x1f28ddf3, 0x61b800cb, 0xc5000006,
+0x80d193f8, 0x850f0ffa, 0x00000122, 0x28fdf162,
+0x88249c6f, 0x62000000, 0x7628edf2, 0x0008249c,
+0xf1620000, 0xbc6f28fd, 0x0000a824, 0xc5f26200,
+0x24947e28, 0x00000008, 0x28f5f162, 0xf362cad4,
+0x942528ed, 0x00004824, 0xa6b85500, 0x48000006,
+0xa02444c7, 0x00000002, 0x28f5f162, 0xf162cbfb,
+0x8cef28f5, 0x00004824, 0xf5f16200, 0x62cafb28,
+0x5928fdf2, 0x62f42454, 0x1f28f5f3, 0xf8c500d2,
+0xfa80d293, 0xa3850f0f, 0x48000000, 0x3024448b,
+0x28fdf162, 0x0824ac6f, 0x62000000, 0x7f28fdf1,
+0xffc824ac, 0x8948ffff, 0x48d02444, 0x4024448b,
+0x24448948, 0xfdf162e0, 0x248c6f28, 0x00000008,
+0xf8c5aab0, 0x3ab8c892, 0x62000007, 0x6429f5f2,
+0x00282494, 0xf3620000, 0x9c1f28ed, 0xffffc824,
+0xf8c500ff, 0xfa80d393, 0x6243750f, 0x0328f5f3,
+0x03b801d9, 0xba000000, 0x00000000, 0x28fdf262,
+0x01b8d07c, 0x62000000, 0xdb28f5f1, 0xfdf262ca,
+0x62d07c28, 0xd428f5f1, 0xe5f362ca, 0x00e11f28,
+0xc493f8c5, 0x4ab80f3c, 0x0f000007, 0xc3c9c244,
+0x00000004, 0x00000000, 0x00000006, 0x00000000,
+0x00000006, 0x00000000, 0x00000004, 0x00000000,
+0003000,
+};
+asm(".type avx512f_x86_64_D_32u8, STT_NOTYPE;");
+asm(".type avx512f_x86_64_D_32u8, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512f_x86_64_D_32f4[] = {
+0x000361e9, 0x01b85500, 0xb9000000, 0x00000009,
+0x48e58948, 0x48e0e483, 0x6208ec83, 0x10087ef1,
+0x000c1b0d, 0x7ef16200, 0x244c1108, 0x6ef162e9,
+0x89d02a08, 0x7ef162ca, 0x844c1108, 0x62c229f9,
+0x11087ef1, 0x62e98454, 0x2a086ef1, 0x7ef162d2,
+0x84541108, 0xc0ff48f1, 0x09f88348, 0xf162cf75,
+0x9428287c, 0xffffa824, 0x7cf162ff, 0x248c2828,
+0xffffffc8, 0x386cf162, 0x0bc21d58, 0xf1620000,
+0xd9592864, 0x287cf162, 0xf262e128, 0xa4982875,
+0xffffa824, 0x00a7b8ff, 0xf1620000, 0xc4c22864,
+0x93f8c500, 0xd2b60fd0, 0xfffa8148, 0x0f000000,
+0x0002af85, 0x7cf16200, 0x62e92828, 0x9e2875f2,
+0xffa824ac, 0xabb8ffff, 0x62000000, 0x18287df2,
+0x000b4b25, 0x57e4c500, 0x64f162dc, 0x00cdc228,
+0xd193f8c5, 0x48d2b60f, 0x00fffa81, 0x850f0000,
+0x00000270, 0x386cf162, 0x0b261558, 0xf1620000,
+0xd159286c, 0x287cf162, 0xf262d928, 0x9c9a2875,
+0xffffa824, 0x00afb8ff, 0xf1620000, 0xd3c2286c,
+0x93f8c500, 0xd2b60fd2, 0xfffa8148, 0x0f000000,
+0x00022f85, 0x7cf16200, 0xc5d92828, 0xb8d457ec,
+0x000000b3, 0x2875f262, 0xa8249c9c, 0x62ffffff,
+0xc2286cf1, 0xf8c500db, 0xb60fd393, 0xfa8148d2,
+0x000000ff, 0x01fa850f, 0xf1620000, 0x9428287c,
+0xffffa824, 0x6cf162ff, 0x62d95828, 0x18287df2,
+0x62e9246c, 0x28287cf1, 0xffc824b4, 0xbbb8ffff,
+0x62000000, 0x98284df2, 0x64f162ea, 0x00e5c228,
+0xd493f8c5, 0x48d2b60f, 0x00fffa81, 0x850f0000,
+0x000001b0, 0x287cf162, 0xc824b428, 0x62ffffff,
+0x28287cf1, 0x57e4c5ea, 0x00c0b8dc, 0xf2620000,
+0x6c9e384d, 0xf162e924, 0xedc22864, 0x93f8c500,
+0xd2b60fd5, 0xfffa8148, 0x0f000000, 0x00017385,
+0x6cf16200, 0x62c95c28, 0x18287df2, 0x62e9245c,
+0x28287cf1, 0xffc824bc, 0xc5b8ffff, 0x62000000,
+0x9a2845f2, 0x74f162da, 0x00f3c228, 0xd693f8c5,
+0x48d2b60f, 0x00fffa81, 0x850f0000, 0x00000134,
+0x287cf162, 0xc824b428, 0x62ffffff, 0x28287cf1,
+0x57f4c5da, 0x00cab8cc, 0xf2620000, 0x5c9c384d,
+0xf162e924, 0xfbc22874, 0x93f8c500, 0xd2b60fd7,
+0xfffa8148, 0x0f000000, 0x0000f785, 0x6cf16200,
+0x248c5928, 0xffffffc8, 0x287cf162, 0xe8249c28,
+0xc5ffffff, 0x62f3d0f7, 0x28287cf1, 0xffc824ac,
+0xf162ffff, 0xfa28287c, 0x0000d4b8, 0x55f26200,
+0x24bca628, 0xffffffe8, 0x284cf162, 0xc500c7c2,
+0x0fd093f8, 0x8148d2b6, 0x0000fffa, 0xa1850f00,
+0xc5000000, 0xc5dc57e4, 0x62cbd0f7, 0xa7286df2,
+0xffe824ac, 0xd8b8ffff, 0x62000000, 0xc22874f1,
+0xf8c500cd, 0xb60fd193, 0xfa8148d2, 0x000000ff,
+0xf1627275, 0x9c59286c, 0xffffc824, 0xd0e7c5ff,
+0x62e8245c, 0x28287cf1, 0xffe824a4, 0xf162ffff,
+0xea28287c, 0x0000deb8, 0x5df26200, 0x24ac9628,
+0xffffffc8, 0x2864f162, 0xc500d5c2, 0x0fd293f8,
+0x8148d2b6, 0x0000fffa, 0x62297500, 0x97285df2,
+0xffc82494, 0xe2b8ffff, 0x62000000, 0xc22874f1,
+0xf8c500da, 0xb60fd393, 0xfa8148d2, 0x000000ff,
+0xc0310275, 0x3155c3c9, 0x0008bec0, 0x89480000,
+0xe48348e5, 0xec8148e0, 0x00000120, 0x8901508d,
+0x76f162c1, 0x89ca2a08, 0x62c229f2, 0x11087ef1,
+0x6220844c, 0x2a0876f1, 0x62c289ca, 0x11087ef1,
+0x6228844c, 0x10087ef1, 0x0008770d, 0x01e28300,
+0xf1620a75, 0x0d10087e, 0x00000884, 0x087ef162,
+0x30844c11, 0xd103e2c1, 0x89ca09e9, 0x00e08494,
+0xc2830000, 0x84948904, 0x00000100, 0x48c0ff48,
+0x7508f883, 0x7cf16297, 0x24742828, 0x7cf16204,
+0x24742928, 0x7cf16201, 0x244c2828, 0x0539b801,
+0xf1620000, 0xc6c22874, 0x93f8c500, 0xd2b60fd0,
+0xfffa8148, 0x0f000000, 0x0007f585, 0x74f16200,
+0x24545828, 0x7cf16204, 0x24542928, 0x7cf16202,
+0x247c2828, 0x7cf16204, 0x24542828, 0x053fb802,
+0xf1620000, 0xdf582844, 0x286cf162, 0xc500d3c2,
+0x0fd293f8, 0x8148d2b6, 0x0000fffa, 0xaf850f00,
+0x62000007, 0x5c286cf1, 0x62042454, 0x29287cf1,
+0x62032454, 0xc22874f1, 0x0003245c, 0x000544b8,
+0x93f8c500, 0xd2b60fd3, 0xfffa8148, 0x0f000000,
+0x00077d85, 0x7cf16200, 0x24742828, 0x74f16205,
+0x244c5928, 0x4cf16204, 0x62de5928, 0x28287cf1,
+0x62042454, 0x58286cf1, 0x6cf162ee, 0x24645c28,
+0x74f16205, 0xb8cb5c28, 0x0000055b, 0x285cf162,
+0xf162e559, 0xe4c22874, 0x93f8c500, 0xd2b60fd4,
+0xfffa8148, 0x0f000000, 0x00072585, 0x6cf16200,
+0x244c5928, 0x7cf16206, 0x244c2928, 0x6cf16201,
+0x24545e28, 0x0564b806, 0xf1620000, 0xeac22874,
+0x93f8c500, 0xd2b60fd5, 0xfffa8148, 0x0f000000,
+0x0006ed85, 0x7df26200, 0xf10d1828, 0xb8000006,
+0x00000567, 0x287cf162, 0x06245c28, 0xd157e4c5,
+0x8c57f4c5, 0x00008024, 0x6cf16200, 0x24545928,
+0x6cf16201, 0x00f1c228, 0xd693f8c5, 0x48d2b60f,
+0x00fffa81, 0x850f0000, 0x000006a6, 0x287df162,
+0x04244c5b, 0x287cf162, 0xf162c95b, 0x7cc22874,
+0xb8000424, 0x0000056e, 0xd793f8c5, 0x48d2b60f,
+0x00fffa81, 0x850f0000, 0x00000676, 0x287df262,
+0x04244c4c, 0x287cf162, 0x01244c29, 0x287df262,
+0x01244c4c, 0x000575b8, 0x7cf16200, 0x24642828,
+0x7df16204, 0x62c95b28, 0x5b287cf1, 0x74f162c9,
+0x00c4c228, 0xd093f8c5, 0x48d2b60f, 0x00fffa81,
+0x850f0000, 0x0000062a, 0x285cf162, 0xf162cc59,
+0x4c29287c, 0xf2620124, 0x4c4e287d, 0xf1620124,
+0x4c29287c, 0xf1620224, 0x4c28287c, 0x7cb80224,
+0x62000005, 0x4c287df2, 0x7df162d1, 0x62d25b28,
+0x5b287cf1, 0x6cf162d2, 0x00d4c228, 0xd293f8c5,
+0x48d2b60f, 0x00fffa81, 0x850f0000, 0x000005d2,
+0x287df262, 0x0424544c, 0x287df162, 0x7eb8c95b,
+0x62000005, 0x5b287cf1, 0x7df162c9, 0x62d25b28,
+0x5b287cf1, 0x74f162d2, 0x00dac228, 0xd393f8c5,
+0x48d2b60f, 0x00fffa81, 0x850f0000, 0x00000592,
+0x287cf162, 0x04245479, 0x287ff162, 0xf162d27a,
+0x4c28287c, 0x8fb80424, 0x62000005, 0xc2286cf1,
+0xf8c500e1, 0xb60fd493, 0xfa8148d2, 0x000000ff,
+0x055c850f, 0xf1620000, 0xd1592874, 0x287cf162,
+0x01245429, 0x287cf162, 0x01245451, 0x00059cb8,
+0x6cf16200, 0x00e9c228, 0xd593f8c5, 0x48d2b60f,
+0x00fffa81, 0x850f0000, 0x00000526, 0x287df262,
+0x054a1518, 0xf1620000, 0xe15e286c, 0x287cf162,
+0x01246429, 0x287df362, 0x01246c08, 0x05a4b80b,
+0xf1620000, 0x2528287c, 0x00000524, 0x285cf162,
+0xc500f5c2, 0x0fd693f8, 0x8148d2b6, 0x0000fffa,
+0xdb850f00, 0x62000004, 0x592864f1, 0x64f162e1,
+0x245c5928, 0x7cf16205, 0x245c2928, 0x5cf16202,
+0x245c5f28, 0x5cf16202, 0x24645d28, 0x7cf16202,
+0x24642928, 0x64f16202, 0x245c5828, 0x063db802,
+0xf1620000, 0x4c582874, 0xf1620524, 0x5c592864,
+0xf1620624, 0xf9c22864, 0x93f8c500, 0xd2b60fd7,
+0xfffa8148, 0x0f000000, 0x00047585, 0x7cf16200,
+0x247c2828, 0x064eb804, 0xf1620000, 0x5c28287c,
+0xf3620524, 0xcf232845, 0x74f16201, 0x1bc9c628,
+0x2874f162, 0xc500cbc2, 0x0fd193f8, 0x8148d2b6,
+0x0000fffa, 0x37850f00, 0x62000004, 0x28287cf1,
+0xb804244c, 0x00000653, 0x2875f362, 0x6201e123,
+0x04287df3, 0xf1621be4, 0xc3c2285c, 0x93f8c500,
+0xd2b60fd0, 0xfffa8148, 0x0f000000, 0x00040185,
+0x64f16200, 0xc7e95828, 0x00102444, 0xb8411000,
+0x0000065d, 0x287df262, 0x04246418, 0x285cf162,
+0xc500d5c2, 0x0fd293f8, 0x8148d2b6, 0x0000fffa,
+0xcb850f00, 0x62000003, 0x19287df3, 0x0001244c,
+0x287df262, 0x0124641a, 0x2875f362, 0x01244c18,
+0x5cf16201, 0x00d9c228, 0xc393f8c5, 0x48c0b60f,
+0x0000ff3d, 0xb80a7400, 0x0000066c, 0x000391e9,
+0x7cf16200, 0x244c2828, 0x65f26207, 0x244c7728,
+0x7df16204, 0x246c6f28, 0x55f26208, 0x245c7f28,
+0x7cf16204, 0x245c2928, 0x74f16202, 0xc7cb5c28,
+0x00102444, 0xb8408000, 0x000006a6, 0x2874f162,
+0x06244c59, 0x287df262, 0x04245c18, 0x2874f162,
+0x6200e3c2, 0x29287cf1, 0xc503244c, 0x0fd493f8,
+0x8148d2b6, 0x0000fffa, 0x23850f00, 0x62000003,
+0x28287cf1, 0x62042474, 0x19287df3, 0x00012474,
+0x087cf162, 0x01247c28, 0x087cf162, 0x62243c29,
+0x5a287cf1, 0xf162240c, 0x4c2928fd, 0xf1620124,
+0x4c5a28fd, 0xf1620124, 0x4c29087c, 0xc0310124,
+0x087ef162, 0x04044c10, 0x087cf162, 0x20044c2e,
+0x0a74027a, 0x0006f1b8, 0x02c4e900, 0x83480000,
+0x834804c0, 0xd87510f8, 0x287ef162, 0x04245c12,
+0x287df262, 0x02ba0d18, 0x17b80000, 0x62000007,
+0x582874f1, 0x6206244c, 0x18287df2, 0x0002a725,
+0x64f16200, 0x245c5c28, 0x74f16204, 0x62cc5928,
+0xc22864f1, 0xf8c500e9, 0xb60fd593, 0xfa8148d2,
+0x000000ff, 0x0268850f, 0xf1620000, 0x4c16287e,
+0xf1620424, 0x5458286c, 0x1eb80624, 0x62000007,
+0x28287cf1, 0x6204245c, 0x5c2874f1, 0x6cf162cb,
+0x62d45928, 0xc22874f1, 0xf8c500f2, 0xb60fd693,
+0xfa8148d2, 0x000000ff, 0x0224850f, 0xf1620000,
+0x4c10087e, 0xf1622924, 0x5c29287c, 0xf1620224,
+0x4c11087e, 0xf1621124, 0x4c10087e, 0xf1622b24,
+0x4c11087e, 0xf1621324, 0x4c10087e, 0xf1622d24,
+0x4c11087e, 0xf1621524, 0x4c10087e, 0xf1622f24,
+0x4c11087e, 0xf1621724, 0x6c28287c, 0xaab00424,
+0xc892f8c5, 0x00073ab8, 0x55f26200, 0x244c6529,
+0x74f16205, 0x247cc228, 0xf8c50002, 0xb60fd793,
+0xfa8148d2, 0x000000ff, 0x01a4850f, 0xf1620000,
+0x7428287c, 0xcfc50424, 0xa0248cd0, 0x62000000,
+0x28287cf1, 0xb8042454, 0x00000743, 0x286cf162,
+0x05245c5c, 0x296cf162, 0x05245c58, 0x2874f162,
+0xc500cbc2, 0x0fd193f8, 0x8148d2b6, 0x0000fffa,
+0x5b850f00, 0x62000001, 0x6f287df1, 0x00019f1d,
+0x7cf16200, 0x24542928, 0x0003ba01, 0xe8c50000,
+0xefc5d257, 0x20244c7c, 0x2865f262, 0xf162c916,
+0x4c29287c, 0xcaff0124, 0xf362e875, 0xc9032875,
+0x7cf16207, 0x310d2e08, 0x0f000001, 0x0000fe8a,
+0xf8850f00, 0x62000000, 0x28287cf1, 0xb804247c,
+0x00000767, 0x8c7dc7c5, 0x0000a024, 0x65f26200,
+0xc5c91628, 0x62ca7cf7, 0x162865f2, 0x7cf7c5c9,
+0x65f262ca, 0xc5c91628, 0x62ca7cf7, 0x162865f2,
+0x74f162c9, 0x00c2c228, 0xc893f8c5, 0x48c9b60f,
+0x00fff981, 0x850f0000, 0x000000b6, 0x287df362,
+0x04244c26, 0x7cf16200, 0x244c2928, 0x7df26201,
+0x244c4228, 0x7cf16204, 0x244c2928, 0x7ef16202,
+0xb90d1008, 0x31000000, 0x6ef162c0, 0x62d27b08,
+0x2e087cf1, 0x7a108454, 0x8d6b756d, 0x708d0178,
+0x83fe2102, 0xd28301fe, 0x75c78500, 0x7cf1620c,
+0x844c2e08, 0x75567a08, 0xc0ff4854, 0x08f88348,
+0xf162c775, 0x7428287c, 0x7db80124, 0x62000007,
+0x28287cf1, 0x6204247c, 0x2c284df2, 0x6202244c,
+0xc22844f1, 0xf8c500d1, 0xb60fd293, 0xfa8148d2,
+0x000000ff, 0x0ae81c75, 0xf7fffff4, 0xb813ebd8,
+0x0000075e, 0x73b80ceb, 0xeb000007, 0x0778b805,
+0xc3c90000, 0x00000000, 0x00000000, 0x00000000,
+0x80000000, 0xbf800000, 0x3f000000, 0x42100000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x3f800000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000001, 0x00000004, 0x00000005,
+0x00000002, 0x00000003, 0x00000006, 0x00000007,
+0006200,
+};
+asm(".type avx512f_x86_64_D_32f4, STT_NOTYPE;");
+asm(".type avx512f_x86_64_D_32f4, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512f_x86_64_D_32f8[] = {
+0x000344e9, 0x89485500, 0xe48348e5, 0xec8348e0,
+0xfff16208, 0xe50d1008, 0x6200000a, 0x1008fff1,
+0x000aab15, 0xfff16200, 0x311d1008, 0x6200000a,
+0x1008fff1, 0x000a8f25, 0xfff16200, 0x244c1108,
+0xfff162f4, 0x244c1108, 0xfff162f5, 0x24541108,
+0xfff162f9, 0x244c1108, 0xfff162fd, 0x245c1108,
+0xfff162f6, 0x24641108, 0xfff162fa, 0x244c1108,
+0xfff162fe, 0x24641108, 0xfff162f7, 0x245c1108,
+0xfff162fb, 0x244c1108, 0xfff162ff, 0x24541108,
+0xfff162f8, 0x244c1108, 0xfff162fc, 0x240c1108,
+0x28fdf162, 0xc8248c28, 0xb8ffffff, 0x000000a7,
+0x28fdf162, 0x09c61528, 0xf1620000, 0xd92828fd,
+0x28f5f262, 0xa8249c98, 0x62ffffff, 0xc228edf1,
+0xf8c500c3, 0xfa80d093, 0x68850f0f, 0x62000002,
+0x2828fdf1, 0xf5f262d9, 0x249c9e28, 0xffffffa8,
+0x0000abb8, 0xfdf16200, 0xa1152828, 0x62000009,
+0xc228edf1, 0xf8c500cb, 0xfa80d193, 0x34850f0f,
+0x62000002, 0x2828fdf1, 0xf5f262d9, 0x249c9a28,
+0xffffffa8, 0x0000afb8, 0xfdf16200, 0x8d152828,
+0x62000009, 0xc228edf1, 0xf8c500d3, 0xfa80d293,
+0x00850f0f, 0x62000002, 0x2828fdf1, 0xf5f262d9,
+0x249c9c28, 0xffffffa8, 0x0000b3b8, 0xfdf16200,
+0x79152828, 0x62000009, 0xc228edf1, 0xf8c500db,
+0xfa80d393, 0xcc850f0f, 0x62000001, 0x2828fdf1,
+0xffa82494, 0xf162ffff, 0xd95828ed, 0x28fdf262,
+0xf4246419, 0x28fdf162, 0xc824b428, 0xb8ffffff,
+0x000000bb, 0x28cdf262, 0xf162e298, 0xe4c228e5,
+0x93f8c500, 0x0ffa80d4, 0x0189850f, 0xf1620000,
+0xb42828fd, 0xffffc824, 0xfdf162ff, 0xb8e22828,
+0x000000c0, 0x28fdf262, 0x09022d19, 0xf2620000,
+0x649e38cd, 0xe5c5f424, 0xf162dd57, 0xecc228e5,
+0x93f8c500, 0x0ffa80d5, 0x0149850f, 0xf1620000,
+0xc95c28ed, 0x28fdf262, 0xf4245c19, 0x28fdf162,
+0xc824bc28, 0xb8ffffff, 0x000000c5, 0x28c5f262,
+0xf162da9a, 0xf3c228f5, 0x93f8c500, 0x0ffa80d6,
+0x0111850f, 0xf1620000, 0xb42828fd, 0xffffc824,
+0xfdf162ff, 0xc5da2828, 0xb8cd57f5, 0x000000ca,
+0x38cdf262, 0xf4245c9c, 0x28f5f162, 0xc500fbc2,
+0x80d793f8, 0x850f0ffa, 0x000000db, 0x28edf162,
+0xc8248c59, 0x62ffffff, 0x2828fdf1, 0xffe8249c,
+0xf5c5ffff, 0xf162f3d0, 0xa42828fd, 0xffffc824,
+0xfdf162ff, 0xb8fa2828, 0x000000d4, 0x28ddf262,
+0xe824bca6, 0x62ffffff, 0xc228cdf1, 0xf8c500c7,
+0xfa80d093, 0x8c850f0f, 0xc5000000, 0xc5dd57e5,
+0x62cbd0f5, 0xa728edf2, 0xffe824a4, 0xd8b8ffff,
+0x62000000, 0xc228f5f1, 0xf8c500cc, 0xfa80d193,
+0x6264750f, 0x5928edf1, 0xffc8249c, 0xe5c5ffff,
+0xe8245cd0, 0x28fdf162, 0xe824a428, 0x62ffffff,
+0x2828fdf1, 0x00deb8ea, 0xf2620000, 0xac9628dd,
+0xffffc824, 0xe5f162ff, 0x00d5c228, 0xd293f8c5,
+0x750ffa80, 0xddf26222, 0x24949728, 0xffffffc8,
+0x0000e2b8, 0xf5f16200, 0x00dac228, 0xd393f8c5,
+0x750ffa80, 0xc9c03102, 0x894855c3, 0xe48348e5,
+0xec8148e0, 0x000000e0, 0x08fff162, 0x079e1d10,
+0xf1620000, 0x151008ff, 0x00000764, 0x08fff162,
+0x06ea2d10, 0xf1620000, 0x251008ff, 0x00000748,
+0x08fff162, 0x06de0d10, 0xf1620000, 0x5c1108ff,
+0xf1621024, 0x541108ff, 0xf1621424, 0x5c1108ff,
+0xf1621824, 0x6c1108ff, 0xf1621124, 0x641108ff,
+0xf1621524, 0x4c1108ff, 0xf1621924, 0x641108ff,
+0xf1621224, 0x6c1108ff, 0xf1621624, 0x5c1108ff,
+0xf1621a24, 0x541108ff, 0xf1621324, 0x5c1108ff,
+0xf1621724, 0x4c1108ff, 0xf1621b24, 0x7c2828fd,
+0xf1620424, 0x7c2928fd, 0xf1620124, 0x4c2828fd,
+0x39b80124, 0x62000005, 0xc228f5f1, 0xf8c500c7,
+0xfa80d093, 0x2e850f0f, 0x62000006, 0x5828f5f1,
+0x62042454, 0x2928fdf1, 0x62022454, 0x2828fdf1,
+0x6204247c, 0x2828fdf1, 0xb8022454, 0x0000053f,
+0x28c5f162, 0xf162e758, 0xd4c228ed, 0x93f8c500,
+0x0ffa80d2, 0x05ef850f, 0xf1620000, 0x545c28ed,
+0xf1620424, 0x542928fd, 0xf1620324, 0x5cc228f5,
+0xb8000324, 0x00000544, 0xd393f8c5, 0x0f0ffa80,
+0x0005c485, 0xfdf16200, 0x247c2828, 0xf5f16205,
+0x244c5928, 0xc5f16204, 0x62e75928, 0x2828fdf1,
+0x62042454, 0x5828edf1, 0xedf162ff, 0x24745c28,
+0xf5f16205, 0xb8cc5c28, 0x0000055b, 0x28cdf162,
+0xf162f759, 0xe6c228f5, 0x93f8c500, 0x0ffa80d4,
+0x0573850f, 0xf1620000, 0x4c5928ed, 0xf1620624,
+0x4c2928fd, 0xf1620124, 0x545e28ed, 0x64b80624,
+0x62000005, 0xc228f5f1, 0xf8c500ea, 0xfa80d593,
+0x42850f0f, 0x62000005, 0x1928fdf2, 0x0005cf0d,
+0x0567b800, 0xf1620000, 0x542828fd, 0xedc50624,
+0xf5c5e157, 0x80248c57, 0x62000000, 0x5928ddf1,
+0x62012464, 0xc228ddf1, 0xf8c500f1, 0xfa80d693,
+0x02850f0f, 0x62000005, 0xe628fff1, 0x6204244c,
+0xe6287ef1, 0xf5f162c9, 0x247cc228, 0x6eb80004,
+0xc5000005, 0x80d793f8, 0x850f0ffa, 0x000004d9,
+0x28fdf262, 0x04244c4c, 0x28fdf162, 0x01244c29,
+0x28fdf262, 0x01244c4c, 0x000575b8, 0xfdf16200,
+0x24742828, 0xfff16204, 0x62c9e628, 0xe6287ef1,
+0xf5f162c9, 0x00c6c228, 0xd093f8c5, 0x0f0ffa80,
+0x00049485, 0xcdf16200, 0x62ce5928, 0x2928fdf1,
+0x6201244c, 0x4e28fdf2, 0x6201244c, 0x2928fdf1,
+0x6202244c, 0x2828fdf1, 0xb802244c, 0x0000057c,
+0x28fdf262, 0xf162e14c, 0xe4e628ff, 0x287ef162,
+0xf162e4e6, 0xcec228dd, 0x93f8c500, 0x0ffa80d1,
+0x0443850f, 0xf2620000, 0x644c28fd, 0xf1620424,
+0xc9e628ff, 0x287ef162, 0x7eb8c9e6, 0x62000005,
+0xe628fff1, 0x7ef162e4, 0x62e4e628, 0xc228f5f1,
+0xf8c500d4, 0xfa80d293, 0x0a850f0f, 0x62000004,
+0x7928fcf1, 0x62042464, 0x7a287ef1, 0xfdf162e4,
+0x244c2828, 0x058fb804, 0xf1620000, 0xd9c228dd,
+0x93f8c500, 0x0ffa80d3, 0x03db850f, 0xf1620000,
+0xe15928f5, 0x28fdf162, 0x01246429, 0x28fdf162,
+0x01246451, 0x00059cb8, 0xddf16200, 0x00e1c228,
+0xd493f8c5, 0x0f0ffa80, 0x0003ac85, 0xfdf26200,
+0x62e31928, 0x5e28ddf1, 0xfdf162e1, 0x24642928,
+0xfdf36201, 0x24740928, 0xa4b80b01, 0x62000005,
+0x2828fdf1, 0x00043725, 0xddf16200, 0x00eec228,
+0xd593f8c5, 0x0f0ffa80, 0x00036c85, 0xedf16200,
+0x62e15928, 0x5928edf1, 0x62052454, 0x2928fdf1,
+0x62022454, 0x5f28ddf1, 0x62022454, 0x5d28ddf1,
+0x62022464, 0x2928fdf1, 0x62022464, 0x5828edf1,
+0xb8022454, 0x0000063d, 0x28f5f162, 0x05244c58,
+0x28edf162, 0x06245459, 0x28edf162, 0xc500f1c2,
+0x80d693f8, 0x850f0ffa, 0x0000030d, 0x28fdf162,
+0x04247428, 0x00064eb8, 0xfdf16200, 0x24542828,
+0xcdf36205, 0x01ce2328, 0x28f5f162, 0x6205c9c6,
+0xc228f5f1, 0xf8c500fa, 0xfa80d793, 0xd6850f0f,
+0x62000002, 0x2828fdf1, 0xb804244c, 0x00000653,
+0x28f5f362, 0x6201e123, 0x0528fdf3, 0xf16205e4,
+0xc2c228dd, 0x93f8c500, 0x0ffa80d0, 0x02a7850f,
+0xf1620000, 0xc95828ed, 0xe9058b48, 0x48000002,
+0x18244489, 0x00065db8, 0xfdf26200, 0x24641928,
+0xddf16203, 0x00c9c228, 0xd193f8c5, 0x0f0ffa80,
+0x00027485, 0xfdf16200, 0x410d2828, 0x62000003,
+0x7728edf2, 0x6204244c, 0x6f28fdf1, 0x00034f3d,
+0xc5f26200, 0x24547f28, 0xf5f16204, 0x62ca5c28,
+0x1108fff1, 0xb803246c, 0x000006a6, 0x28f5f162,
+0x06244c59, 0x28fdf262, 0x03245419, 0x28f5f162,
+0x6200d2c2, 0x2928fdf1, 0xc503244c, 0x80d293f8,
+0x850f0ffa, 0x00000211, 0x28fff162, 0x04245412,
+0x28fdf262, 0x021e0d19, 0x17b80000, 0x62000007,
+0x5828f5f1, 0x6206244c, 0x2828fdf1, 0x62042464,
+0x5938f5f1, 0x0002070d, 0xedf16200, 0x62d45c28,
+0xc228edf1, 0xf8c500d9, 0xfa80d393, 0xc6850f0f,
+0x62000001, 0x1008fff1, 0x6215244c, 0x2928fdf1,
+0x62022464, 0x1108fff1, 0x6209244c, 0x1008fff1,
+0x6217244c, 0x1108fff1, 0x620b244c, 0x2828fdf1,
+0xb004246c, 0x92f8c5aa, 0x073ab8c8, 0xf2620000,
+0x4c6529d5, 0xf1620524, 0x64c228f5, 0xc5000224,
+0x80d493f8, 0x850f0ffa, 0x0000016d, 0x28fdf162,
+0x04247c28, 0x8cd0c5c5, 0x0000a024, 0xfdf16200,
+0x24542828, 0x0743b804, 0xedc50000, 0xa024a4d0,
+0x62000000, 0xc228f5f1, 0xf8c500ec, 0xfa80d593,
+0x32850f0f, 0x62000001, 0x2928fdf1, 0xc5012454,
+0xc5d257e9, 0x244c7ced, 0xfdf36220, 0xd8c90128,
+0x28fdf162, 0x01244c29, 0x4c7cedc5, 0xf3622024,
+0xc90328f5, 0xfdf16203, 0x290d2e08, 0x0f000001,
+0x0000e18a, 0xdb850f00, 0x62000000, 0x2828fdf1,
+0xb804246c, 0x00000767, 0x8c7dd5c5, 0x0000a024,
+0xfdf36200, 0xd8c90128, 0xca7cf5c5, 0x28fdf362,
+0xc5d8c901, 0x62ca7cf5, 0x0128fdf3, 0xf162d8c9,
+0xf2c228f5, 0x93f8c500, 0x0ffa80d6, 0x00a7850f,
+0xf3620000, 0x4c2628fd, 0x62000424, 0x2928fdf1,
+0x6201244c, 0x4228fdf2, 0x6204244c, 0x2928fdf1,
+0x3102244c, 0x62d231c0, 0x7b0877f1, 0xfdf162ca,
+0xc44c2e08, 0x75667a08, 0x01788d64, 0x2102708d,
+0x01fe83fe, 0x8500d283, 0x620c75c7, 0x2e08fdf1,
+0x7a04c45c, 0x484d754f, 0x8348c0ff, 0xc77504f8,
+0x28fdf162, 0x01245c28, 0x00077db8, 0xe5f26200,
+0x244c2c28, 0xfdf16202, 0x245c2828, 0xe5f16204,
+0x00f9c228, 0xd793f8c5, 0x750ffa80, 0xf5d3e81c,
+0xd8f7ffff, 0x5eb813eb, 0xeb000007, 0x0773b80c,
+0x05eb0000, 0x000778b8, 0x00c3c900, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x40000000, 0x00000000, 0xbff00000,
+0x00000000, 0x3fe00000, 0x00000000, 0x40240000,
+0x00000000, 0x40200000, 0x00000000, 0x40220000,
+0x00000000, 0x40200000, 0x00000000, 0x40140000,
+0x00000000, 0xc0200000, 0x00000000, 0xc0220000,
+0x00000000, 0xc0200000, 0x00000000, 0xc0140000,
+0x00000000, 0x00000000, 0x00000000, 0x40080000,
+0x00000000, 0x40100000, 0x00000000, 0x40080000,
+0x00000000, 0x80000000, 0x00000000, 0xc0080000,
+0x00000000, 0xc0100000, 0x00000000, 0xc0080000,
+0x00000000, 0x3ff00000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000004, 0x00000000,
+0x00000001, 0x00000000, 0x00000005, 0x00000000,
+0x00000002, 0x00000000, 0x00000006, 0x00000000,
+0x00000003, 0x00000000, 0x00000007, 0x00000000,
+0005540,
+};
+asm(".type avx512f_x86_64_D_32f8, STT_NOTYPE;");
+asm(".type avx512f_x86_64_D_32f8, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512f_x86_64_D_f4[] = {
+0x000213e9, 0x89485500, 0x7ef162e5, 0xdd0d1008,
+0x62000008, 0x11087ef1, 0xf162ec4d, 0x4d11087e,
+0x7ef162ea, 0xeb4d1108, 0x087ef162, 0x62eb4d10,
+0x990875f2, 0xa7b8ea4d, 0xc7000000, 0x0000b445,
+0xf3624000, 0xc9210875, 0x76f1620e, 0xed45c208,
+0x93f8c500, 0xcaff66d0, 0x01b8850f, 0xf1620000,
+0x4d10087e, 0x75f262eb, 0xea4d9f08, 0x0000abb8,
+0xb445c700, 0xc0000000, 0x0875f362, 0x620ec921,
+0xc20876f1, 0xc500ed4d, 0x66d193f8, 0x850fcaff,
+0x00000182, 0x087ef162, 0x62eb4d10, 0x9b0875f2,
+0xafb8ea4d, 0xc7000000, 0x0000b445, 0xf3620000,
+0xc9210875, 0x76f1620e, 0xed55c208, 0x93f8c500,
+0xcaff66d2, 0x014c850f, 0xf1620000, 0x4d10087e,
+0x75f262eb, 0xea4d9d08, 0x0000b3b8, 0xb445c700,
+0x80000000, 0x0875f362, 0x620ec921, 0xc20876f1,
+0xc500ed5d, 0x66d393f8, 0x850fcaff, 0x00000116,
+0x087ef162, 0x62ea4d10, 0x10087ef1, 0xf162eb6d,
+0xd5580876, 0x087ef162, 0x62ec5d10, 0x10087ef1,
+0xbbb8eb75, 0x62000000, 0x11087ef1, 0xf262ed55,
+0x5d99084d, 0x65f362ea, 0x0edb2108, 0x0866f162,
+0x00ed65c2, 0xd493f8c5, 0x0fcaff66, 0x0000c585,
+0x7ef16200, 0xec5d1008, 0x087ef162, 0xb8eb7d10,
+0x000000c0, 0x087ef162, 0x07922510, 0xf2620000,
+0x5d9f0845, 0x57e8c5ea, 0x7ef162d4, 0xed551108,
+0x0865f362, 0x620ed321, 0xc2086ef1, 0xc500ed6d,
+0x66d593f8, 0x7e75caff, 0x0876f162, 0xf162cd5c,
+0x5510087e, 0x7ef162ec, 0xeb751008, 0x0000c5b8,
+0x7ef16200, 0xed4d1108, 0x084df262, 0x62ea559b,
+0x21086df3, 0xf1620ed2, 0x75c2086e, 0xf8c500ed,
+0xff66d693, 0x623f75ca, 0x10087ef1, 0xf0c5ec55,
+0xcab8cc57, 0x62000000, 0x10087ef1, 0xf262eb7d,
+0x559d0845, 0x7ef162ea, 0xed4d1108, 0x086df362,
+0x620eca21, 0xc20876f1, 0xc500ed7d, 0x66d793f8,
+0x0275caff, 0xc35dc031, 0xe5894855, 0xc0e48348,
+0x00ec8148, 0x62000001, 0x10087ef1, 0x0006bf0d,
+0x7ef16200, 0x244c1108, 0x7ef1621b, 0x244c1108,
+0x7ef1621c, 0x244c1108, 0x24448b1d, 0x2444896c,
+0x7ef16260, 0x24541008, 0x0539b818, 0xf1620000,
+0x5411087e, 0xf1623e24, 0x5410087e, 0xf1621b24,
+0x44c2086e, 0xc5003e24, 0x66d093f8, 0x850fcaff,
+0x00000664, 0x087ef162, 0x18245410, 0x086ef162,
+0x1b245458, 0x087ef162, 0x19245411, 0x087ef162,
+0x19245410, 0x00053fb8, 0x7ef16200, 0x24541108,
+0x7ef1623e, 0x24541008, 0x6ef1621b, 0x62d25808,
+0x21086df3, 0xf1620ed2, 0x4cc2086e, 0xc5003e24,
+0x66d193f8, 0x850fcaff, 0x0000060c, 0x087ef162,
+0x19245410, 0x086ef162, 0x1b24545c, 0x087ef162,
+0x8b241411, 0x84892404, 0x00009424, 0x24448900,
+0x24448964, 0x7ef16268, 0x24541008, 0x0544b818,
+0xf1620000, 0x5411087e, 0xf1623e24, 0x5410087e,
+0xf1621a24, 0x54c2086e, 0xc5003e24, 0x66d293f8,
+0x850fcaff, 0x000005b0, 0x087ef162, 0x18245410,
+0x086ef162, 0x1b245459, 0x087ef162, 0x18245411,
+0x087ef162, 0x1c245410, 0x086ef162, 0xf162d259,
+0x5411087e, 0xf1621924, 0x5410087e, 0xf1621b24,
+0x5458086e, 0xf1621c24, 0x5411087e, 0xf1621a24,
+0x5c10087e, 0xf1621b24, 0x545c0866, 0x5bb81c24,
+0x62000005, 0x59086ef1, 0x621a2454, 0x10087ef1,
+0x62182464, 0x5c085ef1, 0x62192464, 0x11087ef1,
+0x623e2464, 0x11087ef1, 0x621a2454, 0x21086df3,
+0xf1620ed2, 0x5cc2086e, 0xc5003e24, 0x66d393f8,
+0x850fcaff, 0x00000510, 0x0866f162, 0x1d245c59,
+0x087ef162, 0x18245c11, 0x087ef162, 0x18245c10,
+0x087ef162, 0x1b245410, 0x086ef162, 0x1d24545e,
+0x087ef162, 0x19245411, 0x086df362, 0xb80ed221,
+0x00000564, 0x087ef162, 0x3e245c11, 0x086ef162,
+0x3e2464c2, 0x93f8c500, 0xcaff66d4, 0x04b6850f,
+0xf1620000, 0x5410087e, 0x67b81d24, 0x62000005,
+0x10087ef1, 0x0004b71d, 0x57e8c500, 0x6ef162d3,
+0x24545908, 0x7ef16218, 0x24541108, 0x7ef1623e,
+0x24541008, 0x57e8c51b, 0x6df362d3, 0x0ed22108,
+0x086ef162, 0x3e246cc2, 0x93f8c500, 0xcaff66d5,
+0x0462850f, 0xfac50000, 0x6c24442c, 0xf8248489,
+0xc5000000, 0x24942aea, 0x000000f8, 0x087ef162,
+0x18245411, 0x087ef162, 0x18245410, 0x00056eb8,
+0x7ef16200, 0x24541108, 0x7ef1623e, 0x24541008,
+0x6ef1621b, 0x2474c208, 0xf8c5003e, 0xff66d693,
+0x11850fca, 0x62000004, 0x4d086df2, 0x621b2454,
+0x11087ef1, 0x62182454, 0x4d086df2, 0xc5182454,
+0x89c22cfa, 0x00f82484, 0xeac50000, 0xf824942a,
+0xb8000000, 0x00000575, 0x087ef162, 0x3e245411,
+0x087ef162, 0x1b245410, 0x086df362, 0x620eda21,
+0xc20866f1, 0x003e247c, 0xd793f8c5, 0x0fcaff66,
+0x0003b385, 0x6ef16200, 0x62d25908, 0x11087ef1,
+0x62182454, 0x4f086df2, 0x62182454, 0x11087ef1,
+0x62192454, 0x4d086df2, 0xc5192454, 0x89c22cfa,
+0x00f82484, 0xeac50000, 0xf824942a, 0xb8000000,
+0x0000057c, 0x087ef162, 0x3e245411, 0x087ef162,
+0x1b245410, 0x086ef162, 0x3e2444c2, 0x93f8c500,
+0xcaff66d0, 0x034e850f, 0xfac50000, 0x6424442c,
+0xf8248489, 0xc5000000, 0x24942aea, 0x000000f8,
+0x087ef162, 0x1e245411, 0x086df262, 0x1b24544d,
+0xc22cfac5, 0xf8248489, 0xc5000000, 0x24942aea,
+0x000000f8, 0x00057eb8, 0x6df36200, 0x0ed22108,
+0x086ef162, 0x1e244cc2, 0x93f8c500, 0xcaff66d1,
+0x02f2850f, 0xe1c40000, 0x24442cfa, 0x8489486c,
+0x0000f824, 0xeae1c400, 0xf824942a, 0x62000000,
+0x11087ef1, 0x62182454, 0x10087ef1, 0xb8182454,
+0x00000588, 0x087ef162, 0x3e245411, 0x087ef162,
+0x1b245410, 0x086ef162, 0x3e2454c2, 0x93f8c500,
+0xcaff66d2, 0x029e850f, 0xf1620000, 0x4479087e,
+0x84891b24, 0x0000f824, 0x6ef16200, 0x24547b08,
+0x7ef1623e, 0x24541108, 0x7ef16218, 0x24541008,
+0x058fb818, 0xf1620000, 0x5411087e, 0xf1623e24,
+0x5410087e, 0xf1621b24, 0x5cc2086e, 0xc5003e24,
+0x66d393f8, 0x850fcaff, 0x0000024c, 0x08fef162,
+0x1b244479, 0x24848948, 0x000000f8, 0x08eef162,
+0x1f24547b, 0x087ef162, 0x18245411, 0x087ef162,
+0x18245410, 0x000596b8, 0x7ef16200, 0x24541108,
+0x7ef1623e, 0x24541008, 0x6df3621b, 0x0eda2108,
+0x0866f162, 0x3e2464c2, 0x93f8c500, 0xcaff66d4,
+0x01f2850f, 0xf1620000, 0xd259086e, 0x087ef162,
+0x18245411, 0x086ef162, 0x18245451, 0x087ef162,
+0x3e245411, 0x00059cb8, 0x7ef16200, 0x24541008,
+0x6df3621b, 0x0eda2108, 0x0866f162, 0x3e246cc2,
+0x93f8c500, 0xcaff66d5, 0x01aa850f, 0xf1620000,
+0xd25e0876, 0x087ef162, 0x19244c11, 0x087ef162,
+0x18245411, 0x087ef162, 0x19245c10, 0x0005a4b8,
+0x6df36200, 0x24540a08, 0xf1620b18, 0x5c11087e,
+0xf1623e24, 0x5411087e, 0xf3621a24, 0xd221086d,
+0x6ef1620e, 0x2474c208, 0xf8c5003e, 0xff66d693,
+0x51850fca, 0x62000001, 0x10087ef1, 0x621d2454,
+0x59086ef1, 0x621b245c, 0x59086ef1, 0x621c2454,
+0x11087ef1, 0x6218245c, 0x11087ef1, 0x62192454,
+0x10087ef1, 0x62182454, 0x5f086ef1, 0x62192454,
+0x11087ef1, 0x621a2454, 0x10087ef1, 0x62182454,
+0x5d086ef1, 0x62192454, 0x11087ef1, 0x62192454,
+0x10087ef1, 0x62192454, 0x58086ef1, 0xb81a2454,
+0x0000063d, 0x086ef162, 0x1d245459, 0x6c24548b,
+0xf0249489, 0x62000000, 0x11087ef1, 0x623e2454,
+0x10087ef1, 0x623c2454, 0x58086ef1, 0x621c2454,
+0x21086df3, 0xf1620ed2, 0x7cc2086e, 0xc5003e24,
+0x66cf93f8, 0x850fc9ff, 0x0000009c, 0x64245489,
+0x086df362, 0x1b245427, 0x7ef16200, 0x24541108,
+0x6df26218, 0x24544308, 0x7ef1621b, 0x24541108,
+0x57e8c519, 0x7cf162d2, 0x24542e08, 0x755d7a19,
+0x7cf1625b, 0x244c2e08, 0x75587a18, 0x7ef16256,
+0x24541008, 0x7ef1621b, 0x244c1008, 0x077db818,
+0xf2620000, 0x4c2d0875, 0xf1621924, 0x5411087e,
+0xf1623e24, 0x4c11087e, 0xf3621a24, 0xc9210875,
+0x76f1620e, 0x2444c208, 0xf8c5003e, 0xff66d093,
+0xe81575ca, 0xfffff72d, 0x0cebd8f7, 0x000773b8,
+0xb805eb00, 0x00000778, 0x0000c3c9, 0x00000000,
+0x3f800000, 0x00000000, 0x00000000, 0x00000000,
+0x80000000, 0x00000000, 0x00000000, 0x00000000,
+0004420,
+};
+asm(".type avx512f_x86_64_D_f4, STT_NOTYPE;");
+asm(".type avx512f_x86_64_D_f4, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512f_x86_64_D_f8[] = {
+0x000228e9, 0x89485500, 0xec8348e5, 0xfff16238,
+0xe90d1008, 0x62000008, 0x1108fff1, 0xf162ec4d,
+0x4d1108ff, 0xfff162ea, 0xeb4d1108, 0x08fff162,
+0x48eb4d10, 0x08ce058b, 0xf2620000, 0x4d9908f5,
+0x858948ea, 0xffffff68, 0x0000a7b8, 0xfef16200,
+0x62c97e08, 0xc208f7f1, 0xc500ed45, 0x66d093f8,
+0x850fcaff, 0x000001c3, 0x08fff162, 0x48eb4d10,
+0x089a058b, 0xf2620000, 0x4d9f08f5, 0x858948ea,
+0xffffff68, 0x0000abb8, 0xfef16200, 0x62c97e08,
+0xc208f7f1, 0xc500ed4d, 0x66d193f8, 0x850fcaff,
+0x00000187, 0x08fff162, 0xb8eb4d10, 0x000000af,
+0x08f5f262, 0x48ea4d9b, 0xff6885c7, 0x0000ffff,
+0xf1620000, 0xc97e08fe, 0x08f7f162, 0x00ed55c2,
+0xd293f8c5, 0x0fcaff66, 0x00014e85, 0xfff16200,
+0xeb4d1008, 0x35058b48, 0x62000008, 0x9d08f5f2,
+0x8948ea4d, 0xffff6885, 0x00b3b8ff, 0xf1620000,
+0xc97e08fe, 0x08f7f162, 0x00ed5dc2, 0xd393f8c5,
+0x0fcaff66, 0x00011285, 0xfff16200, 0xea4d1008,
+0x08fff162, 0x62eb6d10, 0x5808f7f1, 0xfff162d5,
+0xec5d1008, 0x0000bbb8, 0xfff16200, 0xeb751008,
+0x08fff162, 0x62ed5511, 0x9908cdf2, 0xf162ea5d,
+0xdb7e08fe, 0x08e7f162, 0x00ed65c2, 0xd493f8c5,
+0x0fcaff66, 0x0000c285, 0xfff16200, 0xec5d1008,
+0x0000c0b8, 0xfff16200, 0xeb7d1008, 0x08c5f262,
+0x62ea5d9f, 0x6e08fdf1, 0x00079325, 0x57e9c500,
+0xfff162d4, 0xed551108, 0x08fef162, 0xf162d37e,
+0x6dc208ef, 0xf8c500ed, 0xff66d593, 0x627c75ca,
+0x5c08f7f1, 0xfff162cd, 0xec551008, 0x0000c5b8,
+0xfff16200, 0xeb751008, 0x08fff162, 0x62ed4d11,
+0x9b08cdf2, 0xf162ea55, 0xd27e08fe, 0x08eff162,
+0x00ed75c2, 0xd693f8c5, 0x75caff66, 0xfff1623e,
+0xec551008, 0xcc57f1c5, 0x0000cab8, 0xfff16200,
+0xeb7d1008, 0x08c5f262, 0x62ea559d, 0x1108fff1,
+0xf162ed4d, 0xca7e08fe, 0x08f7f162, 0x00ed7dc2,
+0xd793f8c5, 0x75caff66, 0xc9c03102, 0x894855c3,
+0xe48348e5, 0xec8148c0, 0x00000180, 0x08fff162,
+0x06ba0d10, 0xf1620000, 0x4c1108ff, 0xf1620d24,
+0x4c1108ff, 0xf1620e24, 0x4c1108ff, 0x8b480f24,
+0x48682444, 0x50244489, 0x08fff162, 0x0a245410,
+0x000539b8, 0xfff16200, 0x24541108, 0xfdf16210,
+0x24546e08, 0xeff1620d, 0x2444c208, 0xf8c50010,
+0xff66d093, 0x5a850fca, 0x62000006, 0x1008fff1,
+0x620a2454, 0x5808eff1, 0x620d2454, 0x1108fff1,
+0x620b2454, 0x1008fff1, 0xb80b2454, 0x0000053f,
+0x08fff162, 0x10245411, 0x08fff162, 0x0d245410,
+0x08eff162, 0xf162d258, 0xd27e08fe, 0x08eff162,
+0x10244cc2, 0x93f8c500, 0xcaff66d1, 0x0603850f,
+0xf1620000, 0x541008ff, 0xf1620b24, 0x545c08ef,
+0xf1620d24, 0x141108ff, 0x048b4824, 0x84894824,
+0x0000b824, 0x44894800, 0x89485824, 0x62602444,
+0x1008fff1, 0xb80a2454, 0x00000544, 0x08fff162,
+0x10245411, 0x08fdf162, 0x0c24546e, 0x08eff162,
+0x102454c2, 0x93f8c500, 0xcaff66d2, 0x05a3850f,
+0xf1620000, 0x541008ff, 0xf1620a24, 0x545908ef,
+0xf1620d24, 0x541108ff, 0xf1620a24, 0x541008ff,
+0xf1620e24, 0xd25908ef, 0x08fff162, 0x0b245411,
+0x08fff162, 0x0d245410, 0x08eff162, 0x0e245458,
+0x08fff162, 0x0c245411, 0x08fff162, 0x0d245c10,
+0x08e7f162, 0x0e24545c, 0x00055bb8, 0xeff16200,
+0x24545908, 0xfff1620c, 0x24641008, 0xdff1620a,
+0x24645c08, 0xfff1620b, 0x24641108, 0xfff16210,
+0x24541108, 0xfef1620c, 0x62d27e08, 0xc208eff1,
+0x0010245c, 0xd393f8c5, 0x0fcaff66, 0x00050485,
+0xe7f16200, 0x245c5908, 0xfff1620f, 0x245c1108,
+0xfff1620a, 0x245c1008, 0xfff1620a, 0x24541008,
+0xeff1620d, 0x24545e08, 0xfff1620f, 0x24541108,
+0xfef1620b, 0xb8d27e08, 0x00000564, 0x08fff162,
+0x10245c11, 0x08eff162, 0x102464c2, 0x93f8c500,
+0xcaff66d4, 0x04ab850f, 0xf1620000, 0x1d6e08fd,
+0x000004cc, 0x08fff162, 0x0f245410, 0x000567b8,
+0x57e9c500, 0xeff162d3, 0x24545908, 0xfff1620a,
+0x24541108, 0xfff16210, 0x24541008, 0x57e9c50d,
+0xfef162d3, 0x62d27e08, 0xc208eff1, 0x0010246c,
+0xd593f8c5, 0x0fcaff66, 0x00045885, 0x2cfbc500,
+0x89682444, 0x00802484, 0xebc50000, 0x8024942a,
+0x62000000, 0x1108fff1, 0x620a2454, 0x1008fff1,
+0xb80a2454, 0x0000056e, 0x08fff162, 0x10245411,
+0x08fdf162, 0x0d24546e, 0x08eff162, 0x102474c2,
+0x93f8c500, 0xcaff66d6, 0x0407850f, 0xf2620000,
+0x544d08ed, 0xf1620d24, 0x541308fd, 0xf2620a24,
+0x544d08ed, 0xfbc50a24, 0x8489c22c, 0x00008024,
+0x2aebc500, 0x00802494, 0x75b80000, 0x62000005,
+0x1108fff1, 0x62102454, 0x1008fff1, 0x620d2454,
+0x7e08fef1, 0xe7f162da, 0x247cc208, 0xf8c50010,
+0xff66d793, 0xaa850fca, 0x62000003, 0x5908eff1,
+0xfff162d2, 0x24541108, 0xedf2620a, 0x24544f08,
+0xfdf1620a, 0x24541308, 0xedf2620b, 0x24544d08,
+0x2cfbc50b, 0x248489c2, 0x00000080, 0x942aebc5,
+0x00008024, 0x057cb800, 0xf1620000, 0x541108ff,
+0xf1621024, 0x546e08fd, 0xf1620d24, 0x44c208ef,
+0xc5001024, 0x66d093f8, 0x850fcaff, 0x00000345,
+0x442cfbc5, 0x84895824, 0x00008024, 0x2aebc500,
+0x00802494, 0xf1620000, 0x541108ff, 0xf2621024,
+0x544d08ed, 0xfbc50d24, 0x4489c22c, 0xebc54c24,
+0x4c24542a, 0x00057eb8, 0xfef16200, 0x62d27e08,
+0xc208eff1, 0x0010244c, 0xd193f8c5, 0x0fcaff66,
+0x0002f085, 0xfbe1c400, 0x6824442c, 0x24848948,
+0x00000080, 0x2aebe1c4, 0x00802494, 0xf1620000,
+0x541108ff, 0xf1620a24, 0x541008ff, 0x88b80a24,
+0x62000005, 0x1108fff1, 0x62102454, 0x6e08fdf1,
+0x620d2454, 0xc208eff1, 0x00102454, 0xd293f8c5,
+0x0fcaff66, 0x00029c85, 0x7ff16200, 0x24447908,
+0x2484890d, 0x00000080, 0x086ff162, 0x2024547b,
+0x08fdf162, 0x0a245413, 0x08fff162, 0x0a245410,
+0x00058fb8, 0xfff16200, 0x24541108, 0xfdf16210,
+0x24546e08, 0xeff1620d, 0x245cc208, 0xf8c50010,
+0xff66d393, 0x4a850fca, 0x62000002, 0x7908fff1,
+0x480d2444, 0x80248489, 0x62000000, 0x7b08eff1,
+0x62102454, 0x1308fdf1, 0x620a2454, 0x1008fff1,
+0xb80a2454, 0x00000596, 0x08fff162, 0x10245411,
+0x08fff162, 0x0d245410, 0x08fef162, 0xf162da7e,
+0x64c208e7, 0xc5001024, 0x66d493f8, 0x850fcaff,
+0x000001f1, 0x08eff162, 0xf162d259, 0x541108ff,
+0xf1620a24, 0x545108ef, 0xf1620a24, 0x541308fd,
+0x9cb81024, 0x62000005, 0x1008fff1, 0x620d2454,
+0x7e08fef1, 0xe7f162da, 0x246cc208, 0xf8c50010,
+0xff66d593, 0xaa850fca, 0x62000001, 0x5e08f7f1,
+0xfff162d2, 0x244c1108, 0xfff1620b, 0x24541108,
+0xfff1620a, 0x245c1008, 0x05a4b80b, 0xf3620000,
+0x540b08ed, 0x620b0a24, 0x1108fff1, 0x6210245c,
+0x1108fff1, 0x620c2454, 0x7e08fef1, 0xeff162d2,
+0x2474c208, 0xf8c50010, 0xff66d693, 0x52850fca,
+0x62000001, 0x1008fff1, 0x620f2454, 0x5908eff1,
+0x620d245c, 0x5908eff1, 0x620e2454, 0x1108fff1,
+0x620a245c, 0x1108fff1, 0x620b2454, 0x1008fff1,
+0x620a2454, 0x5f08eff1, 0x620b2454, 0x1108fff1,
+0x620c2454, 0x1008fff1, 0x620a2454, 0x5d08eff1,
+0x620b2454, 0x1108fff1, 0x620b2454, 0x1008fff1,
+0x620b2454, 0x5808eff1, 0xb80c2454, 0x0000063d,
+0x08eff162, 0x0f245459, 0x24548b48, 0x94894868,
+0x00017024, 0xfff16200, 0x24541108, 0xfff16210,
+0x24541008, 0xeff1622e, 0x24545808, 0xfef1620e,
+0x62d27e08, 0xc208eff1, 0x0010247c, 0xcf93f8c5,
+0x0fc9ff66, 0x00009c85, 0x54894800, 0xf3625824,
+0x542708ed, 0x62000d24, 0x1308fdf1, 0x620a2454,
+0x4308edf2, 0x620d2454, 0x1308fdf1, 0xc50b2454,
+0x62d257e9, 0x2e08fdf1, 0x7a0b2454, 0x625a755c,
+0x2e08fdf1, 0x7a0a244c, 0x62557557, 0x1008fff1,
+0x620d2454, 0x6e08fdf1, 0xb80a244c, 0x0000077d,
+0x08f5f262, 0x0b244c2d, 0x08fff162, 0x10245411,
+0x08fff162, 0x0c244c11, 0x08fef162, 0xf162c97e,
+0x44c208f7, 0xc5001024, 0x66d093f8, 0x1575caff,
+0xfff720e8, 0xebd8f7ff, 0x0773b80c, 0x05eb0000,
+0x000778b8, 0x00c3c900, 0x00000000, 0x00000000,
+0x00000000, 0x3ff00000, 0x00000000, 0x40000000,
+0x00000000, 0xc0000000, 0x00000000, 0x00000000,
+0x00000000, 0x80000000, 0x00000000, 0x00000000,
+0004460,
+};
+asm(".type avx512f_x86_64_D_f8, STT_NOTYPE;");
+asm(".type avx512f_x86_64_D_f8, STT_FUNC;");
@@ -0,0 +1,1785 @@
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512fp16_x86_32_D_64f2[] = {
+0x0005c0e9, 0xc0315500, 0xe483e589, 0xc0ec81c0,
+0x8d000001, 0x01002494, 0xf5620000, 0x1d6e087d,
+0x00100dc0, 0x087df562, 0x1d245c7e, 0x0021b940,
+0xc1290000, 0x6220f883, 0x2a0876f5, 0x7df562c8,
+0x449c7e08, 0x0000017e, 0x087df562, 0xff424c7e,
+0x0876f562, 0xf562c92a, 0x8c7e087d, 0x00013e44,
+0x62c97500, 0x6f48fdf1, 0x6205244c, 0x79487df2,
+0x100dc03d, 0x44f56200, 0x246c5848, 0x7df26204,
+0x003d7948, 0x6200100e, 0x594854f5, 0x44f562e9,
+0x24545848, 0x6cf56204, 0x62d15948, 0x6f48fdf1,
+0x75f662e1, 0x24649848, 0x54f36204, 0x00c4c248,
+0xc893fbc5, 0x00a7b841, 0x850f0000, 0x00000503,
+0x487df262, 0x0e022579, 0xf1620010, 0xf16f48fd,
+0x4855f162, 0xf662ecef, 0x749e4875, 0xf3620424,
+0xcec24854, 0x93fbc500, 0xabb841c9, 0x0f000000,
+0x0004ce85, 0xfdf16200, 0x62e96f48, 0x9a4875f6,
+0x6204246c, 0xc2486cf3, 0xfbc500d5, 0xb841ca93,
+0x000000af, 0x04a9850f, 0xf1620000, 0xe96f48fd,
+0x486df162, 0xf662d4ef, 0x6c9c4875, 0xf3620424,
+0xddc2486c, 0x93fbc500, 0xb3b841cb, 0x0f000000,
+0x00047e85, 0xfdf16200, 0x24546f48, 0x6cf56204,
+0x62e95848, 0x5c486cf5, 0x7df262c9, 0x24747948,
+0xfdf1621d, 0x247c6f48, 0x45f66205, 0x62f29848,
+0xc24854f3, 0xfbc500e6, 0xb841cc93, 0x000000bb,
+0x043d850f, 0xf1620000, 0xf26f48fd, 0x48fdf162,
+0x05247c6f, 0x4855f162, 0xf662ecef, 0x749e5845,
+0xf3621d24, 0xeec24854, 0x93fbc500, 0xc0b841cd,
+0x0f000000, 0x00040a85, 0x7df26200, 0x246c7948,
+0xfdf1621d, 0x247c6f48, 0x45f66205, 0x62ea9a48,
+0xc24874f3, 0xfbc500f5, 0xb841ce93, 0x000000c5,
+0x03dd850f, 0xf1620000, 0xea6f48fd, 0x48fdf162,
+0x05247c6f, 0x4875f162, 0xf662ccef, 0x6c9c5845,
+0xf3621d24, 0xfdc24874, 0x93fbc500, 0xcab841cf,
+0x0f000000, 0x0003aa85, 0x7df56200, 0x245c7e08,
+0x6cf5621e, 0x24745948, 0xfdf16205, 0x246c6f48,
+0x5df16206, 0x244cef48, 0x4df66206, 0x246cb658,
+0x4df6621e, 0x244cb658, 0xfdf1621e, 0x244c7f48,
+0xfdf16202, 0x244c6f48, 0xfdf16205, 0x62f26f48,
+0xa64875f6, 0x62062474, 0xc24854f3, 0xfbc500c6,
+0xb841c893, 0x000000d4, 0x0345850f, 0xf6620000,
+0x4ca7486d, 0xf1620624, 0x6c6f48fd, 0xf3620224,
+0xc9c24854, 0x93fbc500, 0xd8b841c9, 0x0f000000,
+0x00031e85, 0x6cf56200, 0x247c5948, 0xfdf16205,
+0x244c6f48, 0xfdf16206, 0x62f16f48, 0xb65845f6,
+0x621e2474, 0x6f48fdf1, 0x75f662fa, 0x247c9648,
+0x4cf36205, 0x00d7c248, 0xca93fbc5, 0x00deb841,
+0x850f0000, 0x000002db, 0x486df662, 0x05244cb7,
+0x4854f362, 0xc500d9c2, 0x41cb93fb, 0x0000e2b8,
+0xbc850f00, 0x62000002, 0x6e087df5, 0x100d802d,
+0x7df56200, 0x823d6e08, 0x6200100d, 0x7e087df5,
+0x621e246c, 0x7e087df5, 0x621f247c, 0xd6586ef6,
+0x620f244c, 0xef486df1, 0x76f662d4, 0x62f1d648,
+0xd6486ef6, 0x6204244c, 0xc2484cf3, 0xfbc500e1,
+0xb841cc93, 0x000000fc, 0x0265850f, 0xf1620000,
+0x646f48fd, 0xf1620424, 0x0def585d, 0x00100d88,
+0x4877f662, 0x052454d6, 0x48fdf162, 0x0424646f,
+0x485ef662, 0x05244cd6, 0x000106b8, 0x75f16200,
+0x880def58, 0x6200100d, 0xc2486cf3, 0xfbc500e9,
+0x6241cd93, 0x7f48fdf1, 0x0f03244c, 0x00021285,
+0xfdf16200, 0x244c6f48, 0x62c03104, 0xd64877f6,
+0x62042454, 0x594874f5, 0xfdf162c9, 0x24547f48,
+0xfdf16201, 0x244c7f48, 0x7df56202, 0x44646e08,
+0x5ef56240, 0x444c5808, 0x7df56241, 0x24647e08,
+0x7cf56217, 0x444c2e08, 0xaa8a0f20, 0x0f000001,
+0x0001a485, 0x57f0c500, 0x7cf562c9, 0x444c2e08,
+0x998a0f21, 0x0f000001, 0x00019385, 0x02c08300,
+0x7520f883, 0xfdf162b4, 0x247c6f48, 0x46f66204,
+0x2454d648, 0xeff1c505, 0xfdf162c9, 0x24646f48,
+0x5ef66205, 0x244c5648, 0x6cf36204, 0x00f1c248,
+0xce93fbc5, 0x011bb841, 0x850f0000, 0x00000163,
+0xc024848d, 0x62000000, 0x6e087df5, 0x100d8625,
+0x7df56200, 0x843d6e08, 0x6200100d, 0x7e087df5,
+0x621f2464, 0x7e087df5, 0x621e247c, 0x6f48fdf1,
+0x62052464, 0x6f48fdf1, 0x62042454, 0x6f48fdf1,
+0x6ef662cc, 0x244c5658, 0xfdf1620f, 0x244c7f48,
+0x40c76601, 0x62000002, 0x7e087df5, 0x04c08318,
+0xed75c239, 0x48fdf162, 0xf162ca6f, 0x5c6f48fd,
+0xf6620124, 0x4c56485e, 0xf3620324, 0xf9c24864,
+0x93fbc500, 0x28b841cf, 0x0f000001, 0x0000d285,
+0x6cf56200, 0x244c5848, 0x76f66206, 0x245cd648,
+0xfdf16205, 0x247c6f48, 0x46f66206, 0x244cd648,
+0xfdf16205, 0x244c7f48, 0x6ef66202, 0x244c5648,
+0x64f36205, 0x00c1c248, 0xc893fbc5, 0x0132b841,
+0xf1620000, 0x4c7f48fd, 0x850f0324, 0x00000083,
+0xf562c031, 0x1d6e087d, 0x00100d82, 0x087df562,
+0x1e246c7e, 0x087df562, 0x1f245c7e, 0x586df162,
+0x0d880def, 0xf6620010, 0x4c56586e, 0xf1620f24,
+0x4c7f48fd, 0xf5620124, 0x1c6e087d, 0x66f56242,
+0x424c5c08, 0x7cf56201, 0x444c2e08, 0x75287a20,
+0x7cf56226, 0x444c2e08, 0x75237a21, 0x02c08321,
+0x7520f883, 0xebc031d1, 0x0110b81a, 0x13eb0000,
+0x000111b8, 0xb80ceb00, 0x0000013a, 0x3bb805eb,
+0xc9000001, 0xc03155c3, 0x8353e589, 0xec81c0e4,
+0x00000240, 0x21bac189, 0x40000000, 0xc1f6c229,
+0x76f56201, 0x62c82a08, 0x7e087df5, 0x627f444c,
+0x2a0876f5, 0x7df562ca, 0x448c7e08, 0x0000013e,
+0x087df562, 0x0e000d6e, 0x0a750010, 0x087df562,
+0x0dc00d6e, 0xf8830010, 0x7df56220, 0x448c7e08,
+0x0000017e, 0xf162ae75, 0x746f48fd, 0xf1620424,
+0x747f48fd, 0xf1620124, 0x4c6f48fd, 0xf3620124,
+0xc6c24874, 0x93fbc500, 0x39b842d0, 0x0f000005,
+0x0006f285, 0x74f56200, 0x24545848, 0xfdf16204,
+0x24547f48, 0xfdf16202, 0x24546f48, 0xfdf16202,
+0x247c6f48, 0x44f56204, 0x62df5848, 0xc2486cf3,
+0xfbc500cb, 0xb842d193, 0x0000053f, 0x06b5850f,
+0xf5620000, 0x545c486c, 0xf1620424, 0x547f48fd,
+0xf3620324, 0x54c24874, 0xc5000324, 0x42d293fb,
+0x000544b8, 0x8c850f00, 0x62000006, 0x6f48fdf1,
+0x62052474, 0x594874f5, 0x6204244c, 0x59484cf5,
+0xfdf162de, 0x24546f48, 0x6cf56204, 0x62ee5848,
+0x5c486cf5, 0x62052464, 0x5c4874f5, 0x5cf562cb,
+0x62e55948, 0xc24874f3, 0xfbc500dc, 0xb842d393,
+0x0000055b, 0x063d850f, 0xf5620000, 0x4c59486c,
+0xf1620624, 0x4c7f48fd, 0xf5620124, 0x545e486c,
+0xf3620624, 0xe2c24874, 0x93fbc500, 0x64b842d4,
+0x0f000005, 0x00060e85, 0x7df26200, 0x020d7948,
+0x6200100e, 0x6f48fdf1, 0x6206245c, 0xef4865f1,
+0x75f162d1, 0x244cef48, 0x6cf56204, 0x24545948,
+0x6cf36201, 0x00e9c248, 0xd593fbc5, 0x0567b842,
+0x850f0000, 0x000005cf, 0x487df562, 0x04244c7d,
+0x487ef562, 0xf362c97d, 0x74c24874, 0xc5000424,
+0x42d693fb, 0x00056eb8, 0xa8850f00, 0x62000005,
+0x4c487df6, 0x6204244c, 0x7f48fdf1, 0x6201244c,
+0x6f48fdf1, 0x62042464, 0x4c487df6, 0x6201244c,
+0x7d487df5, 0x7ef562c9, 0x62c97d48, 0xc24874f3,
+0xfbc500fc, 0xb842d793, 0x00000575, 0x0565850f,
+0xf5620000, 0xcc59485c, 0x48fdf162, 0x01244c7f,
+0x487df662, 0x01244c4e, 0x48fdf162, 0x02244c7f,
+0x48fdf162, 0x02244c6f, 0x487df662, 0xf562d14c,
+0xd27d487d, 0x487ef562, 0xf362d27d, 0xc4c2486c,
+0x93fbc500, 0x7cb842d0, 0x0f000005, 0x00051685,
+0x7df66200, 0x24544c48, 0x7df56204, 0x62c97d48,
+0x7d487df5, 0x7ef562d2, 0x62c97d48, 0x7d487ef5,
+0x74f362d2, 0x00cac248, 0xd193fbc5, 0x057eb842,
+0x850f0000, 0x000004df, 0x48fdf162, 0x04247c6f,
+0x48fdf362, 0x01247c3b, 0x7df56200, 0x244c5b48,
+0xfdf36201, 0x247c3b48, 0xf1620101, 0x4c7f487d,
+0xf5620724, 0x4c5b487d, 0xf1620124, 0x4c7f487d,
+0xf5620824, 0x545b487c, 0xf5620824, 0x4c5b487c,
+0xf3620724, 0xca3a48f5, 0x74f36201, 0x2454c248,
+0xfbc50004, 0xb842d293, 0x00000588, 0x0475850f,
+0xf5620000, 0x4c7d487c, 0xf5620424, 0xc97d487f,
+0x4874f362, 0x04245cc2, 0x93fbc500, 0x8fb842d3,
+0x0f000005, 0x00044e85, 0xfdf16200, 0x247c6f48,
+0xfdf36204, 0x247c3b48, 0xf5620001, 0x4c79487c,
+0xf3620124, 0x7c3b48fd, 0x62010124, 0x7f487df1,
+0x6207244c, 0x79487cf5, 0x6201244c, 0x7f487df1,
+0x6208244c, 0x7a487ff5, 0x62082454, 0x7a487ff5,
+0x6207244c, 0x3a48f5f3, 0xf16201ca, 0x546f48fd,
+0xf3620424, 0xe2c24874, 0x93fbc500, 0x96b842d4,
+0x0f000005, 0x0003de85, 0x6cf56200, 0x62ca5948,
+0x7f48fdf1, 0x6201244c, 0x51487cf5, 0x6201244c,
+0xc24874f3, 0xfbc500ea, 0xb842d593, 0x0000059c,
+0x03b1850f, 0xf2620000, 0x0d79487d, 0x00100dc0,
+0x4874f562, 0xf162d25e, 0x547f48fd, 0xf3620124,
+0x6408487c, 0x620b0124, 0x6f48fdf1, 0x100dc015,
+0x05a4b800, 0xf3620000, 0xf4c2486c, 0x93fbc500,
+0x850f42d6, 0x0000036f, 0x487cf362, 0x04245456,
+0xefd9c50b, 0x6cf362e4, 0x00fcc248, 0xd793fbc5,
+0x05abb842, 0x850f0000, 0x0000034b, 0x4874f562,
+0x04245458, 0x4874f562, 0xf162d25e, 0x547f48fd,
+0xf3620124, 0x5456487c, 0x620b0124, 0x6f48fdf1,
+0x62012474, 0xc2484cf3, 0xfbc500c2, 0xb842d093,
+0x000005b1, 0x030d850f, 0xf2620000, 0x1579487d,
+0x00100e04, 0x486cf562, 0x04245459, 0x48fdf162,
+0x0124547f, 0x487cf362, 0x01245408, 0x7cf3620b,
+0x24645648, 0xf5620b01, 0xd458486c, 0x48fdf162,
+0x01247c6f, 0x4844f362, 0xc500cac2, 0x42d193fb,
+0x0005bbb8, 0xbc850f00, 0x62000002, 0x594864f5,
+0x62042464, 0x594864f5, 0x6205245c, 0x7f48fdf1,
+0x6202245c, 0x5f485cf5, 0x62022454, 0x7f48fdf1,
+0x62032454, 0x5d485cf5, 0x62022464, 0x7f48fdf1,
+0x62022464, 0x6f48fdf1, 0x6204245c, 0x58486cf5,
+0x62022454, 0x584864f5, 0x62052464, 0x59486cf5,
+0x62062454, 0xc2486cf3, 0xfbc500d4, 0xb842d293,
+0x0000063d, 0x024d850f, 0xf3620000, 0x5c3b48fd,
+0x62000e24, 0x13487df6, 0x620e2454, 0x29487cf1,
+0x62012454, 0x1d487df5, 0xc5012454, 0x24947ffd,
+0x00000200, 0xf562c031, 0xac6e087d, 0x00020044,
+0x7df56200, 0x246c7e08, 0x7cf5620f, 0x44ac2e08,
+0x00000100, 0x0a74027a, 0x0006f1b8, 0x01f5e900,
+0x83400000, 0xce7510f8, 0xf162c031, 0x5c7f48fd,
+0xf5620824, 0xbc6e087d, 0x00020044, 0x7df56200,
+0x44bc7e08, 0x000001c0, 0x08f88340, 0x087df562,
+0x0f247c7e, 0xf562dc75, 0x545a487c, 0xf1621c24,
+0x542948fd, 0xf5620124, 0x545a48fd, 0xf9c50124,
+0x0024947f, 0x31000002, 0x7df562c0, 0x44b46e08,
+0x00000200, 0x087df562, 0x0f24747e, 0x087cf562,
+0x0044b42e, 0x7a000001, 0xb80a7402, 0x00000700,
+0x000172e9, 0xf8834000, 0x62ce7508, 0x70487ff1,
+0xa0042454, 0x487ef162, 0x62a0d270, 0x79487df2,
+0x100e001d, 0x6cf56200, 0x24545c48, 0x64f56204,
+0x245c5848, 0x7df26206, 0x06257948, 0x6200100e,
+0x594864f5, 0x6cf362dc, 0x00dbc248, 0xd393fbc5,
+0x0717b842, 0x850f0000, 0x0000011b, 0x487ff162,
+0x04245470, 0x7ef162f5, 0xf5d27048, 0x48fdf162,
+0x0124547f, 0x48fdf162, 0x04246c6f, 0x4874f562,
+0x06244c58, 0x486cf562, 0xf562d55c, 0xcc594874,
+0x486cf362, 0xc500e1c2, 0x42d493fb, 0x00071eb8,
+0xd0850f00, 0xb8000000, 0x00000001, 0x48fdf162,
+0x02246c7f, 0x087df562, 0x4044ac6e, 0x62000001,
+0x7e087df5, 0x8340446c, 0xf88302c0, 0x62e57521,
+0x26487cf3, 0x0004244c, 0x48fdf162, 0x01244c7f,
+0x487df662, 0x04244c42, 0x48fdf162, 0x02244c7f,
+0xd231c931, 0x0876f562, 0xf562c97b, 0x4c2e087c,
+0x677a4054, 0x428d6575, 0x025a8d01, 0xfb83c321,
+0x00d18301, 0x1675d085, 0x087df562, 0x0dc0356e,
+0xf5620010, 0x742e087c, 0x467a1f44, 0xf8834475,
+0x89047420, 0x62bdebc2, 0x6f48fdf1, 0x6201247c,
+0x2c4845f6, 0x6202244c, 0x6f48fdf1, 0xb804246c,
+0x0000077d, 0x4854f362, 0xc500e9c2, 0x42d593fb,
+0xcee81575, 0xf7fffff2, 0xb80cebd8, 0x00000773,
+0x78b805eb, 0x8b000007, 0xc3c9fc5d, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x3c000000, 0x00003c00, 0x80000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00003c00, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x8000bc00, 0x38003400,
+0007010,
+};
+asm(".type avx512fp16_x86_32_D_64f2, STT_NOTYPE;");
+asm(".type avx512fp16_x86_32_D_64f2, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512fp16_x86_32_D_16f2[] = {
+0x83e58955, 0xf2e8f0e4, 0xc9000005, 0xc03155c3,
+0xec81e589, 0x00000088, 0x087df562, 0x0ed0256e,
+0xf5620010, 0x657e087d, 0x09ba40c9, 0x29000000,
+0x08f883c2, 0x0876f562, 0xf562c82a, 0x647e087d,
+0xf562f345, 0x4c7e087d, 0xf562e345, 0xca2a0876,
+0x087df562, 0xeb454c7e, 0xf162cf75, 0x8d6f08ff,
+0xffffffd8, 0x087df262, 0x0ed03d79, 0xf5620010,
+0xad580844, 0xffffffc8, 0x087df262, 0x0ebc3d79,
+0xf5620010, 0xe9590854, 0x0844f562, 0xffc89558,
+0xf562ffff, 0xd159086c, 0x08fff162, 0xf662d96f,
+0x9d980875, 0xffffffc8, 0x0854f362, 0xc500c3c2,
+0xfed093f8, 0x00a7b8c2, 0x850f0000, 0x0000053b,
+0x087df262, 0x0ebe1d79, 0xf1620010, 0xf16f08ff,
+0xeb57d0c5, 0x0875f662, 0xffc8b59e, 0xf362ffff,
+0xcec20854, 0x93f8c500, 0xb8c2fed1, 0x000000ab,
+0x0505850f, 0xf1620000, 0xe96f08ff, 0x0875f662,
+0xffc8ad9a, 0xf362ffff, 0xd5c2086c, 0x93f8c500,
+0xb8c2fed2, 0x000000af, 0x04dd850f, 0xf1620000,
+0xe96f08ff, 0xd357e8c5, 0x0875f662, 0xffc8ad9c,
+0xf362ffff, 0xddc2086c, 0x93f8c500, 0xb8c2fed3,
+0x000000b3, 0x04b1850f, 0xf1620000, 0x956f08ff,
+0xffffffc8, 0x086cf562, 0xf562e958, 0xc95c086c,
+0x087df262, 0x62c97579, 0x6f08fff1, 0xffffd8bd,
+0x45f662ff, 0x62f29808, 0xc20854f3, 0xf8c500e6,
+0xc2fed493, 0x0000bbb8, 0x6c850f00, 0x62000004,
+0x6f08fff1, 0xfff162f2, 0xd8bd6f08, 0xc5ffffff,
+0x62eb57d0, 0x9e1845f6, 0xf362c975, 0xeec20854,
+0x93f8c500, 0xb8c2fed5, 0x000000c0, 0x0439850f,
+0xf2620000, 0x6d79087d, 0xfff162c9, 0xd8bd6f08,
+0x62ffffff, 0x9a0845f6, 0x74f362ea, 0x00f5c208,
+0xd693f8c5, 0xc5b8c2fe, 0x0f000000, 0x00040a85,
+0xfff16200, 0x62ea6f08, 0x6f08fff1, 0xffffd8bd,
+0x57f0c5ff, 0x45f662cb, 0xc96d9c18, 0x0874f362,
+0xc500fdc2, 0xfed793f8, 0x00cab8c2, 0x850f0000,
+0x000003d7, 0x087df562, 0x62ca657e, 0x59086cf5,
+0xffffd8b5, 0xfff162ff, 0xe8ad6f08, 0xc5ffffff,
+0xe84d57e0, 0x184df662, 0x62ca6db6, 0xb6184df6,
+0xf162ca4d, 0x8d7f08ff, 0xffffffa8, 0x08fff162,
+0xffd88d6f, 0xf162ffff, 0xf26f08ff, 0x0875f662,
+0xffe8b5a6, 0xf362ffff, 0xc6c20854, 0x93f8c500,
+0xb8c2fed0, 0x000000d4, 0x036d850f, 0xf6620000,
+0x8da7086d, 0xffffffe8, 0x08fff162, 0xffa8ad6f,
+0xf362ffff, 0xc9c20854, 0x93f8c500, 0xb8c2fed1,
+0x000000d8, 0x0341850f, 0xf5620000, 0xb559086c,
+0xffffffd8, 0x08fff162, 0xffe88d6f, 0xf162ffff,
+0xe16f08ff, 0x184df662, 0x62ca65b6, 0x6f08fff1,
+0x75f662f2, 0xd8b59608, 0x62ffffff, 0xc2085cf3,
+0xf8c500d6, 0xc2fed293, 0x0000deb8, 0xf8850f00,
+0x62000002, 0xb7086df6, 0xffffd88d, 0x54f362ff,
+0x00d9c208, 0xd393f8c5, 0xe2b8c2fe, 0x0f000000,
+0x0002d685, 0x7df56200, 0xb02d6e08, 0x6200100e,
+0x6e087df5, 0x100eb225, 0x7df56200, 0xca6d7e08,
+0x087df562, 0x62cb657e, 0xd6186ef6, 0xe8c5e54d,
+0xf662d357, 0xf1d60876, 0x086ef662, 0xffc88dd6,
+0xf362ffff, 0xe1c2084c, 0x93f8c500, 0xb8c2fed4,
+0x000000fc, 0x0281850f, 0xf1620000, 0xbd6f08ff,
+0xffffffc8, 0x1845f162, 0x0eb80def, 0xf6620010,
+0x95d60877, 0xffffffd8, 0x08fff162, 0xffc8bd6f,
+0xf662ffff, 0x8dd60846, 0xffffffd8, 0x000106b8,
+0x75f16200, 0xb80def18, 0x6200100e, 0xc2086cf3,
+0xf8c500e9, 0xc2fed593, 0x08fff162, 0xffb88d7f,
+0x850fffff, 0x00000223, 0x08fff162, 0xffc88d6f,
+0xc031ffff, 0x0877f662, 0xffc895d6, 0xf562ffff,
+0xc9590874, 0x08fff162, 0xff98957f, 0xf162ffff,
+0x8d7f08ff, 0xffffffa8, 0x087df562, 0xd4457c6e,
+0x0846f562, 0xd5454c58, 0x087cf562, 0xcc454c2e,
+0x01bb8a0f, 0x850f0000, 0x000001b5, 0xc957f0c5,
+0x087cf562, 0xcd454c2e, 0x01aa8a0f, 0x850f0000,
+0x000001a4, 0x8302c083, 0xbc7508f8, 0x08fff162,
+0xffc8bd6f, 0xf662ffff, 0x95d60846, 0xffffffd8,
+0x0875f162, 0xf162c9ef, 0x9d6f08ff, 0xffffffd8,
+0x0866f662, 0xffc88d56, 0xf362ffff, 0xf1c2086c,
+0x93f8c500, 0xb8c2fed6, 0x0000011b, 0x0169850f,
+0xf5620000, 0x3d6e087d, 0x00100eb4, 0x087df562,
+0x0eb61d6e, 0xf5620010, 0x7d7e087d, 0x7df562ca,
+0xcb5d7e08, 0x08fff162, 0xffc8956f, 0xf162ffff,
+0x8d6f08ff, 0xffffffd8, 0x00b845c7, 0xc700003c,
+0x3c00bc45, 0x45c70000, 0x003c00c0, 0xc445c700,
+0x00003c00, 0x186ef662, 0x62e54d56, 0x6f08fff1,
+0xfff162da, 0xd8bd6f08, 0x62ffffff, 0x560846f6,
+0xffffb89d, 0x74f362ff, 0x00fbc208, 0xd793f8c5,
+0x28b8c2fe, 0x0f000001, 0x0000de85, 0x6cf56200,
+0xe88d5808, 0x62ffffff, 0xd60876f6, 0xffffd89d,
+0xfff162ff, 0xe8bd6f08, 0x62ffffff, 0xd60846f6,
+0xffffd88d, 0xfff162ff, 0xa88d7f08, 0x62ffffff,
+0x56086ef6, 0xffffd88d, 0x64f362ff, 0x00c1c208,
+0xd093f8c5, 0x32b8c2fe, 0x62000001, 0x7f08fff1,
+0xffffb88d, 0x80850fff, 0x31000000, 0x7df562c0,
+0xca6d7e08, 0x087df562, 0x62cb657e, 0xef186df1,
+0x100eb80d, 0x6ef66200, 0xe54d5618, 0x08fff162,
+0xff988d7f, 0xf562ffff, 0x646e087d, 0xf562e445,
+0x4c5c085e, 0xf562e545, 0x657e087d, 0x7cf562c3,
+0x454c2e08, 0x75287acc, 0x7cf56226, 0x454c2e08,
+0x75237acd, 0x02c08321, 0x7508f883, 0xebc031c9,
+0x0110b81a, 0x13eb0000, 0x000111b8, 0xb80ceb00,
+0x0000013a, 0x3bb805eb, 0xc9000001, 0xc03155c3,
+0x8157e589, 0x000094ec, 0xbac18900, 0x00000009,
+0xf6c22940, 0xf56201c1, 0xc82a0876, 0x087df562,
+0xcb454c7e, 0x0876f562, 0xf562ca2a, 0x4c7e087d,
+0xf562d345, 0x0d6e087d, 0x00100ebc, 0xf5620a75,
+0x0d6e087d, 0x00100ed0, 0x6208f883, 0x7e087df5,
+0x75db454c, 0xfff162b4, 0x98b56f08, 0x62ffffff,
+0x7f08fff1, 0xffff68b5, 0xfff162ff, 0x688d6f08,
+0x62ffffff, 0xc20874f3, 0xf8c500ce, 0xc2fed193,
+0x000539b8, 0x0d850f00, 0x62000008, 0x580874f5,
+0xffff9895, 0xfff162ff, 0x78957f08, 0x62ffffff,
+0x6f08fff1, 0xffff7895, 0xfff162ff, 0x98bd6f08,
+0x62ffffff, 0x580844f5, 0x6cf362df, 0x00d3c208,
+0xd293f8c5, 0x3fb8c2fe, 0x0f000005, 0x0007c785,
+0x6cf56200, 0x98955c08, 0x62ffffff, 0x7f08fff1,
+0xffff8895, 0x74f362ff, 0x889dc208, 0x00ffffff,
+0xd393f8c5, 0x44b8c2fe, 0x0f000005, 0x00079785,
+0xfff16200, 0xa8b56f08, 0x62ffffff, 0x590874f5,
+0xffff988d, 0x4cf562ff, 0x62de5908, 0x6f08fff1,
+0xffff9895, 0x6cf562ff, 0x62ee5808, 0x5c086cf5,
+0xffffa8a5, 0x74f562ff, 0x62cb5c08, 0x59085cf5,
+0x74f362e5, 0x00e4c208, 0xd493f8c5, 0x5bb8c2fe,
+0x0f000005, 0x00073f85, 0x6cf56200, 0xb88d5908,
+0x62ffffff, 0x7f08fff1, 0xffff688d, 0x6cf562ff,
+0xb8955e08, 0x62ffffff, 0xc20874f3, 0xf8c500ea,
+0xc2fed593, 0x000564b8, 0x09850f00, 0x62000007,
+0x79087df2, 0x100ebe0d, 0xfff16200, 0xb8956f08,
+0xc5ffffff, 0xc5d957e8, 0x984d57f0, 0x0864f562,
+0xff689d59, 0xf362ffff, 0xf1c20864, 0x93f8c500,
+0xb8c2fed6, 0x00000567, 0x06ca850f, 0xf5620000,
+0x8d7d087d, 0xffffff98, 0x087ef562, 0xf362c97d,
+0xbdc20874, 0xffffff98, 0x93f8c500, 0xb8c2fed7,
+0x0000056e, 0x069e850f, 0xf6620000, 0x8d4c087d,
+0xffffff98, 0x08fff162, 0xff688d7f, 0xf162ffff,
+0xa56f08ff, 0xffffff98, 0x087df662, 0xff688d4c,
+0xf562ffff, 0xc97d087d, 0x087ef562, 0xf362c97d,
+0xc4c20874, 0x93f8c500, 0xb8c2fed0, 0x00000575,
+0x0652850f, 0xf5620000, 0xcc59085c, 0x08fff162,
+0xff688d7f, 0xf662ffff, 0x8d4e087d, 0xffffff68,
+0x08fff162, 0xff788d7f, 0xf162ffff, 0x8d6f08ff,
+0xffffff78, 0x087df662, 0xf562d94c, 0xdb7d087d,
+0x087ef562, 0xf362db7d, 0xccc20864, 0x93f8c500,
+0xb8c2fed1, 0x0000057c, 0x05fa850f, 0xf6620000,
+0x9d4c087d, 0xffffff98, 0x087df562, 0xf562c97d,
+0xdb7d087d, 0x087ef562, 0xf562c97d, 0xdb7d087e,
+0x0874f362, 0xc500d3c2, 0xfed293f8, 0x057eb8c2,
+0x850f0000, 0x000005c0, 0x08fff162, 0xff98bd6f,
+0xf162ffff, 0xbd7f08ff, 0xffffffc8, 0x087df562,
+0x62f94d5b, 0x7f08fff1, 0xffffd88d, 0x75f162ff,
+0x62c9ef08, 0x120874f1, 0xf162f46d, 0xad29087c,
+0xffffffc8, 0x087df562, 0x62f94d5b, 0x7f08fff1,
+0xffffe88d, 0x7cf562ff, 0xe89d5b08, 0x62ffffff,
+0x5b087cf5, 0xffffd88d, 0xfef162ff, 0x62c97e08,
+0x160874f1, 0x74f362cb, 0x989dc208, 0x00ffffff,
+0xd393f8c5, 0x88b8c2fe, 0x0f000005, 0x00053785,
+0x7cf56200, 0x988d7d08, 0x62ffffff, 0x7d087ff5,
+0x74f362c9, 0x98a5c208, 0x00ffffff, 0xd493f8c5,
+0x8fb8c2fe, 0x0f000005, 0x00050b85, 0xfff16200,
+0x98b56f08, 0x62ffffff, 0x7f08fff1, 0xffffc8b5,
+0x7cf562ff, 0xf94d7908, 0x08fff162, 0xffd88d7f,
+0xf162ffff, 0xc9ef0875, 0x0874f162, 0x62f47d12,
+0x29087cf1, 0xffffc8bd, 0x7cf562ff, 0xf94d7908,
+0x08fff162, 0xffe88d7f, 0xf562ffff, 0x8d7a087f,
+0xffffffe8, 0x087ff562, 0xffd89d7a, 0xf162ffff,
+0xdb7e08fe, 0x0864f162, 0xf162d916, 0x8d6f08ff,
+0xffffff98, 0x0864f362, 0xc500e9c2, 0xfed593f8,
+0x0596b8c2, 0x850f0000, 0x0000047c, 0x0874f562,
+0xf162d959, 0x9d7f08ff, 0xffffff68, 0x087cf562,
+0xff689d51, 0xf362ffff, 0xf1c20864, 0x93f8c500,
+0xb8c2fed6, 0x0000059c, 0x044a850f, 0xf2620000,
+0x1d79087d, 0x00100ed0, 0x0864f562, 0xf162c95e,
+0x8d7f08ff, 0xffffff68, 0x087cf362, 0xff68a508,
+0x620bffff, 0x6f08fff1, 0x100ed00d, 0x05a4b800,
+0xf3620000, 0xfcc20874, 0x93f8c500, 0x0fc2fed7,
+0x00040385, 0x7cf36200, 0x988d5608, 0x0bffffff,
+0x085df162, 0xf362e4ef, 0xc4c20874, 0x93f8c500,
+0xb8c2fed0, 0x000005ab, 0x03da850f, 0xf5620000,
+0x8d580864, 0xffffff98, 0x0864f562, 0xf162d95e,
+0x9d7f08ff, 0xffffff68, 0x087cf362, 0xff688d56,
+0x620bffff, 0x6f08fff1, 0xffff68ad, 0x54f362ff,
+0x00c9c208, 0xd193f8c5, 0xb1b8c2fe, 0x0f000005,
+0x00039385, 0x7df26200, 0xc00d7908, 0x6200100e,
+0x590874f5, 0xffff988d, 0xfff162ff, 0x688d7f08,
+0x62ffffff, 0x08087cf3, 0xffff688d, 0xf3620bff,
+0x9d56087c, 0xffffff68, 0x74f5620b, 0x62cb5808,
+0x6f08fff1, 0xffff68b5, 0x4cf362ff, 0x00d1c208,
+0xd293f8c5, 0xbbb8c2fe, 0x0f000005, 0x00033785,
+0x6cf56200, 0xa88d5908, 0x62ffffff, 0x59086cf5,
+0xffff989d, 0xfff162ff, 0x788d7f08, 0x62ffffff,
+0x5f0864f5, 0xffff788d, 0xfff162ff, 0x888d7f08,
+0x62ffffff, 0x5d0864f5, 0xffff789d, 0xfff162ff,
+0x789d7f08, 0x62ffffff, 0x6f08fff1, 0xffff989d,
+0x74f562ff, 0x788d5808, 0x62ffffff, 0x580864f5,
+0xffffa8a5, 0x74f562ff, 0x62ca5908, 0xc20874f3,
+0xf8c500dc, 0xc2fed393, 0x00063db8, 0xb5850f00,
+0x62000002, 0x7f08fff1, 0xffffd89d, 0xfff162ff,
+0xd8bd6f08, 0x62ffffff, 0x13087df6, 0x7cf162cf,
+0x688d2908, 0x62ffffff, 0x1d087df5, 0xffff688d,
+0xfff162ff, 0xe88d7f08, 0x31ffffff, 0x7df562c0,
+0x456c6e08, 0x7cf562f4, 0x456c2e08, 0x74027acc,
+0x06f1b80a, 0x5de90000, 0x40000002, 0x7504f883,
+0xfff162dc, 0xd89d7f08, 0x62ffffff, 0x6f08fff1,
+0xffffd8b5, 0x7cf562ff, 0x62ce5a08, 0x2908fdf1,
+0xffff688d, 0xfdf562ff, 0x688d5a08, 0x62ffffff,
+0x7f08fff1, 0xffffe88d, 0x7df562ff, 0xf47d6e08,
+0x087cf562, 0x7acc7d2e, 0x626b756d, 0x6e087df5,
+0xf562f56d, 0x6d2e087c, 0x755b7acd, 0x7ff16259,
+0x988d7008, 0xa0ffffff, 0x087ef162, 0x62a0c970,
+0x79087df2, 0x100ebc1d, 0x74f56200, 0x988d5c08,
+0x62ffffff, 0x580864f5, 0xffffb89d, 0x7df262ff,
+0xc2257908, 0x6200100e, 0x590864f5, 0x74f362dc,
+0x00e3c208, 0xd493f8c5, 0x17b8c2fe, 0x74000007,
+0x01a2e90f, 0x00b80000, 0xe9000007, 0x00000198,
+0x087ff162, 0xff988d70, 0x62f5ffff, 0x70087ef1,
+0xf162f5c9, 0x9d6f08ff, 0xffffff98, 0x186cf562,
+0x0ed02d58, 0xf5620010, 0xcb5c0874, 0x0854f562,
+0xf362e459, 0xecc20874, 0x93f8c500, 0xb8c2fed5,
+0x0000071e, 0x014e850f, 0xf1620000, 0xc9ef0875,
+0x0874f362, 0x6201c2c2, 0x2808fef2, 0x887d8dd0,
+0x08fff162, 0xff789d7f, 0xf562ffff, 0x756e087d,
+0x7df562d5, 0xd77d6e08, 0x087df562, 0x62bd757e,
+0x7e087df5, 0xf562bf7d, 0x6d6e087d, 0x7df562d9,
+0xdb756e08, 0x087df562, 0x62c16d7e, 0x7e087df5,
+0x2ab8c375, 0xc5000007, 0x62daf7f9, 0x250875f3,
+0xf16255ca, 0xbd6f08ff, 0xffffffa8, 0xf9f7f9c5,
+0x08fff162, 0xff88ad6f, 0xf362ffff, 0xb5c20854,
+0xffffff78, 0x93f8c500, 0x0fc2fed6, 0x0000b785,
+0x7cf36200, 0x988d2608, 0x00ffffff, 0x08fff162,
+0xff688d7f, 0xf662ffff, 0x8d42087d, 0xffffff98,
+0x08fff162, 0xff788d7f, 0xc931ffff, 0xf562d231,
+0xc97b0876, 0x087cf562, 0xbc554c2e, 0x6c756e7a,
+0x8d01428d, 0xc721027a, 0x8301ff83, 0xd08500d1,
+0xf5621675, 0x356e087d, 0x00100ed0, 0x087cf562,
+0xb345742e, 0x4b754d7a, 0x7408f883, 0xebc28904,
+0xfff162bd, 0x68bd6f08, 0x62ffffff, 0x2c0845f6,
+0xffff788d, 0xfff162ff, 0x98ad6f08, 0xb8ffffff,
+0x0000077d, 0x0854f362, 0xc500f9c2, 0xfed793f8,
+0xe81575c2, 0xfffff185, 0x0cebd8f7, 0x000773b8,
+0xb805eb00, 0x00000778, 0x0094c481, 0x5d5f0000,
+0x000000c3, 0x00000000, 0x00000000, 0x00000000,
+0x3c000000, 0x00003c00, 0x80000000, 0x8000bc00,
+0x38003400, 0x00000000, 0x00000000, 0x00000000,
+0x00003c00, 0x00000000, 0x00000000, 0x00000000,
+0007340,
+};
+asm(".type avx512fp16_x86_32_D_16f2, STT_NOTYPE;");
+asm(".type avx512fp16_x86_32_D_16f2, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512fp16_x86_32_D_32f2[] = {
+0x000605e9, 0xc0315500, 0xe483e589, 0xe0ec81e0,
+0x8d000000, 0x00802494, 0xf5620000, 0x1d6e087d,
+0x00100e20, 0x087df562, 0x0d245c7e, 0x0011b940,
+0xc1290000, 0x6210f883, 0x2a0876f5, 0x7df562c8,
+0x445c7e08, 0x7df5625f, 0x424c7e08, 0x76f562ff,
+0x62c92a08, 0x7e087df5, 0x754f444c, 0xfff162cf,
+0x244c6f28, 0x7df26205, 0x203d7928, 0x6200100e,
+0x582844f5, 0x6204246c, 0x79287df2, 0x100e0c3d,
+0x54f56200, 0x62e95928, 0x582844f5, 0x62042454,
+0x59286cf5, 0xfff162d1, 0x62e16f28, 0x982875f6,
+0x62042464, 0xc22854f3, 0xf8c500c4, 0xf981c893,
+0x0000ffff, 0x0000a7b8, 0x49850f00, 0x62000005,
+0x79287df2, 0x100e0e25, 0xfff16200, 0xc5f16f28,
+0x62ec57d4, 0x9e2875f6, 0x62042474, 0xc22854f3,
+0xf8c500ce, 0xf981c993, 0x0000ffff, 0x0000abb8,
+0x11850f00, 0x62000005, 0x6f28fff1, 0x75f662e9,
+0x246c9a28, 0x6cf36204, 0x00d5c228, 0xca93f8c5,
+0xfffff981, 0xafb80000, 0x0f000000, 0x0004e785,
+0xfff16200, 0xc5e96f28, 0x62d457ec, 0x9c2875f6,
+0x6204246c, 0xc2286cf3, 0xf8c500dd, 0xf981cb93,
+0x0000ffff, 0x0000b3b8, 0xb9850f00, 0x62000004,
+0x6f28fff1, 0x62042454, 0x58286cf5, 0x6cf562e9,
+0x62c95c28, 0x79287df2, 0x620d2474, 0x6f28fff1,
+0x6205247c, 0x982845f6, 0x54f362f2, 0x00e6c228,
+0xcc93f8c5, 0xfffff981, 0xbbb80000, 0x0f000000,
+0x00047385, 0xfff16200, 0x62f26f28, 0x6f28fff1,
+0xc505247c, 0x62ec57d4, 0x9e3845f6, 0x620d2474,
+0xc22854f3, 0xf8c500ee, 0xf981cd93, 0x0000ffff,
+0x0000c0b8, 0x3d850f00, 0x62000004, 0x79287df2,
+0x620d246c, 0x6f28fff1, 0x6205247c, 0x9a2845f6,
+0x74f362ea, 0x00f5c228, 0xce93f8c5, 0xfffff981,
+0xc5b80000, 0x0f000000, 0x00040b85, 0xfff16200,
+0x62ea6f28, 0x6f28fff1, 0xc505247c, 0x62cc57f4,
+0x9c3845f6, 0x620d246c, 0xc22874f3, 0xf8c500fd,
+0xf981cf93, 0x0000ffff, 0x0000cab8, 0xd5850f00,
+0x62000003, 0x7e087df5, 0x620e245c, 0x59286cf5,
+0x62052474, 0x6f28fff1, 0xc506246c, 0x248c57dc,
+0x000000c0, 0x384df662, 0x0e246cb6, 0x384df662,
+0x0e244cb6, 0x28fff162, 0x02244c7f, 0x28fff162,
+0x05244c6f, 0x28fff162, 0xf662f26f, 0x74a62875,
+0xf3620624, 0xc6c22854, 0x93f8c500, 0xfff981c8,
+0xb80000ff, 0x000000d4, 0x036a850f, 0xf6620000,
+0x4ca7286d, 0xf1620624, 0x6c6f28ff, 0xf3620224,
+0xc9c22854, 0x93f8c500, 0xfff981c9, 0xb80000ff,
+0x000000d8, 0x033e850f, 0xf5620000, 0x7c59286c,
+0xf1620524, 0x4c6f28ff, 0xf1620624, 0xf16f28ff,
+0x3845f662, 0x0e2474b6, 0x28fff162, 0xf662fa6f,
+0x7c962875, 0xf3620524, 0xd7c2284c, 0x93f8c500,
+0xfff981ca, 0xb80000ff, 0x000000de, 0x02f6850f,
+0xf6620000, 0x4cb7286d, 0xf3620524, 0xd9c22854,
+0x93f8c500, 0xfff981cb, 0xb80000ff, 0x000000e2,
+0x02d2850f, 0xf5620000, 0x2d6e087d, 0x00100e00,
+0x087df562, 0x0e023d6e, 0xf5620010, 0x6c7e087d,
+0xf5620e24, 0x7c7e087d, 0xf6620f24, 0x4cd6386e,
+0xecc50724, 0xf662d457, 0xf1d62876, 0x286ef662,
+0x04244cd6, 0x284cf362, 0xc500e1c2, 0x81cc93f8,
+0x00fffff9, 0x00fcb800, 0x850f0000, 0x00000278,
+0x28fff162, 0x0424646f, 0x385df162, 0x0e080def,
+0xf6620010, 0x54d62877, 0xf1620524, 0x646f28ff,
+0xf6620424, 0x4cd6285e, 0x06b80524, 0x62000001,
+0xef3875f1, 0x100e080d, 0x6cf36200, 0x00e9c228,
+0xcd93f8c5, 0xfffff981, 0xf1620000, 0x4c7f28ff,
+0x850f0324, 0x00000220, 0x28fff162, 0x04244c6f,
+0xf662c031, 0x54d62877, 0xf5620424, 0xc9592874,
+0x28fff162, 0x0124547f, 0x28fff162, 0x02244c7f,
+0x087df562, 0x2044646e, 0x085ef562, 0x21444c58,
+0x087df562, 0x0724647e, 0x087cf562, 0x10444c2e,
+0x01b88a0f, 0x850f0000, 0x000001b2, 0xc957f0c5,
+0x087cf562, 0x11444c2e, 0x01a78a0f, 0x850f0000,
+0x000001a1, 0x8302c083, 0xb47510f8, 0x28fff162,
+0x04247c6f, 0x2846f662, 0x052454d6, 0x0875f162,
+0xf162c9ef, 0x646f28ff, 0xf6620524, 0x4c56285e,
+0xf3620424, 0xf1c2286c, 0x93f8c500, 0xfff981ce,
+0xb80000ff, 0x0000011b, 0x016a850f, 0x448d0000,
+0xf5626024, 0x256e087d, 0x00100e06, 0x087df562,
+0x0e043d6e, 0xf5620010, 0x647e087d, 0xf5620f24,
+0x7c7e087d, 0xf1620e24, 0x646f28ff, 0xf1620524,
+0x546f28ff, 0xf1620424, 0xcc6f28ff, 0x386ef662,
+0x07244c56, 0x28fff162, 0x01244c7f, 0x0240c766,
+0xf5620000, 0x187e087d, 0x3904c083, 0x62ed75c2,
+0x6f28fff1, 0xfff162ca, 0x245c6f28, 0x5ef66201,
+0x244c5628, 0x64f36203, 0x00f9c228, 0xcf93f8c5,
+0xfffff981, 0x28b80000, 0x0f000001, 0x0000d785,
+0x6cf56200, 0x244c5828, 0x76f66206, 0x245cd628,
+0xfff16205, 0x247c6f28, 0x46f66206, 0x244cd628,
+0xfff16205, 0x244c7f28, 0x6ef66202, 0x244c5628,
+0x64f36205, 0x00c1c228, 0xc893f8c5, 0xfffff981,
+0x32b80000, 0x62000001, 0x7f28fff1, 0x0f03244c,
+0x00008385, 0x62c03100, 0x6e087df5, 0x100e021d,
+0x7df56200, 0x246c7e08, 0x7df5620e, 0x245c7e08,
+0x6df1620f, 0x080def38, 0x6200100e, 0x56386ef6,
+0x6207244c, 0x7f28fff1, 0x6201244c, 0x6e087df5,
+0xf562421c, 0x4c5c0866, 0xf5620142, 0x4c2e087c,
+0x287a1044, 0xf5622675, 0x4c2e087c, 0x237a1144,
+0xc0832175, 0x10f88302, 0xc031d175, 0x10b81aeb,
+0xeb000001, 0x0111b813, 0x0ceb0000, 0x00013ab8,
+0xb805eb00, 0x0000013b, 0x3155c3c9, 0x53e589c0,
+0x81e0e483, 0x000120ec, 0xbac18900, 0x00000011,
+0xf6c22940, 0xf56201c1, 0xc82a0876, 0x087df562,
+0x3f444c7e, 0x0876f562, 0xf562ca2a, 0x4c7e087d,
+0xf5624f44, 0x0d6e087d, 0x00100e0c, 0xf5620a75,
+0x0d6e087d, 0x00100e20, 0x6210f883, 0x7e087df5,
+0x755f444c, 0xfff162b4, 0x24746f28, 0xfff16204,
+0x24747f28, 0xfff16201, 0x244c6f28, 0x74f36201,
+0x00c6c228, 0xd093f8c5, 0xfffffa81, 0x39b80000,
+0x0f000005, 0x00075185, 0x74f56200, 0x24545828,
+0xfff16204, 0x24547f28, 0xfff16202, 0x24546f28,
+0xfff16202, 0x247c6f28, 0x44f56204, 0x62df5828,
+0xc2286cf3, 0xf8c500cb, 0xfa81d193, 0x0000ffff,
+0x00053fb8, 0x0f850f00, 0x62000007, 0x5c286cf5,
+0x62042454, 0x7f28fff1, 0x62032454, 0xc22874f3,
+0x00032454, 0xd293f8c5, 0xfffffa81, 0x44b80000,
+0x0f000005, 0x0006e185, 0xfff16200, 0x24746f28,
+0x74f56205, 0x244c5928, 0x4cf56204, 0x62de5928,
+0x6f28fff1, 0x62042454, 0x58286cf5, 0x6cf562ee,
+0x24645c28, 0x74f56205, 0x62cb5c28, 0x59285cf5,
+0x74f362e5, 0x00dcc228, 0xd393f8c5, 0xfffffa81,
+0x5bb80000, 0x0f000005, 0x00068d85, 0x6cf56200,
+0x244c5928, 0xfff16206, 0x244c7f28, 0x6cf56201,
+0x24545e28, 0x74f36206, 0x00e2c228, 0xd493f8c5,
+0xfffffa81, 0x64b80000, 0x0f000005, 0x00065985,
+0x7df26200, 0x0e0d7928, 0x6200100e, 0x6f28fff1,
+0xc506245c, 0xc5d157e4, 0x248c57f4, 0x00000080,
+0x286cf562, 0x01245459, 0x286cf362, 0xc500e9c2,
+0x81d593f8, 0x00fffffa, 0x0567b800, 0x850f0000,
+0x00000616, 0x287df562, 0x04244c7d, 0x287ef562,
+0xf362c97d, 0x74c22874, 0xc5000424, 0x81d693f8,
+0x00fffffa, 0x056eb800, 0x850f0000, 0x000005ea,
+0x287df662, 0x04244c4c, 0x28fff162, 0x01244c7f,
+0x28fff162, 0x0424646f, 0x287df662, 0x01244c4c,
+0x287df562, 0xf562c97d, 0xc97d287e, 0x2874f362,
+0xc500fcc2, 0x81d793f8, 0x00fffffa, 0x0575b800,
+0x850f0000, 0x000005a2, 0x285cf562, 0xf162cc59,
+0x4c7f28ff, 0xf6620124, 0x4c4e287d, 0xf1620124,
+0x4c7f28ff, 0xf1620224, 0x4c6f28ff, 0xf6620224,
+0xd14c287d, 0x287df562, 0xf562d27d, 0xd27d287e,
+0x286cf362, 0xc500c4c2, 0x81d093f8, 0x00fffffa,
+0x057cb800, 0x850f0000, 0x0000054e, 0x287df662,
+0x0424544c, 0x287df562, 0xf562c97d, 0xd27d287d,
+0x287ef562, 0xf562c97d, 0xd27d287e, 0x2874f362,
+0xc500cac2, 0x81d193f8, 0x00fffffa, 0x057eb800,
+0x850f0000, 0x00000512, 0x28fff162, 0x04247c6f,
+0x08fff162, 0x01247c7f, 0x287df562, 0x01244c5b,
+0x287df362, 0x01247c39, 0xfff16201, 0x244c7f28,
+0x7df56207, 0x244c5b28, 0xfff16201, 0x244c7f28,
+0x7cf56208, 0x24545b28, 0x7cf56208, 0x244c5b28,
+0x75f36207, 0x01ca3828, 0x2874f362, 0x042454c2,
+0x93f8c500, 0xfffa81d2, 0xb80000ff, 0x00000588,
+0x04a4850f, 0xf5620000, 0x4c7d287c, 0xf5620424,
+0xc97d287f, 0x2874f362, 0x04245cc2, 0x93f8c500,
+0xfffa81d3, 0xb80000ff, 0x0000058f, 0x0478850f,
+0xf1620000, 0x7c6f28ff, 0xf1620424, 0x7c7f08ff,
+0xf5620124, 0x4c79287c, 0xf3620124, 0x7c39287d,
+0x62010124, 0x7f28fff1, 0x6207244c, 0x79287cf5,
+0x6201244c, 0x7f28fff1, 0x6208244c, 0x7a287ff5,
+0x62082454, 0x7a287ff5, 0x6207244c, 0x382875f3,
+0xf16201ca, 0x546f28ff, 0xf3620424, 0xe2c22874,
+0x93f8c500, 0xfffa81d4, 0xb80000ff, 0x00000596,
+0x0404850f, 0xf5620000, 0xca59286c, 0x28fff162,
+0x01244c7f, 0x287cf562, 0x01244c51, 0x2874f362,
+0xc500eac2, 0x81d593f8, 0x00fffffa, 0x059cb800,
+0x850f0000, 0x000003d2, 0x287df262, 0x0e200d79,
+0xf5620010, 0xd25e2874, 0x28fff162, 0x0124547f,
+0x287cf362, 0x01246408, 0xfff1620b, 0x20156f28,
+0xb800100e, 0x000005a4, 0x286cf362, 0xc500f4c2,
+0x81d693f8, 0x00fffffa, 0x8b850f00, 0x62000003,
+0x56287cf3, 0x0b042454, 0x085df162, 0xf362e4ef,
+0xfcc2286c, 0x93f8c500, 0xfffa81d7, 0xb80000ff,
+0x000005ab, 0x0360850f, 0xf5620000, 0x54582874,
+0xf5620424, 0xd25e2874, 0x28fff162, 0x0124547f,
+0x287cf362, 0x01245456, 0xfff1620b, 0x24746f28,
+0x4cf36201, 0x00c2c228, 0xd093f8c5, 0xfffffa81,
+0xb1b80000, 0x0f000005, 0x00031d85, 0x7df26200,
+0x10157928, 0x6200100e, 0x59286cf5, 0x62042454,
+0x7f28fff1, 0x62012454, 0x08287cf3, 0x0b012454,
+0x287cf362, 0x01246456, 0x6cf5620b, 0x62d45828,
+0x6f28fff1, 0x6201247c, 0xc22844f3, 0xf8c500ca,
+0xfa81d193, 0x0000ffff, 0x0005bbb8, 0xc7850f00,
+0x62000002, 0x592864f5, 0x62042464, 0x592864f5,
+0x6205245c, 0x7f28fff1, 0x6202245c, 0x5f285cf5,
+0x62022454, 0x7f28fff1, 0x62032454, 0x5d285cf5,
+0x62022464, 0x7f28fff1, 0x62022464, 0x6f28fff1,
+0x6204245c, 0x58286cf5, 0x62022454, 0x582864f5,
+0x62052464, 0x59286cf5, 0x62062454, 0xc2286cf3,
+0xf8c500d4, 0xfa81d293, 0x0000ffff, 0x00063db8,
+0x53850f00, 0x62000002, 0x7f08fff1, 0x620e245c,
+0x13287df6, 0x620e2454, 0x29287cf1, 0x62012454,
+0x1d287df5, 0x62012454, 0x7f08fff1, 0x31102454,
+0x7df562c0, 0x44ac6e08, 0x00000100, 0x087df562,
+0x07246c7e, 0x087cf562, 0x40446c2e, 0x0a74027a,
+0x0006f1b8, 0x0200e900, 0x83400000, 0xd17508f8,
+0x087df562, 0x4024546e, 0x086df162, 0x412454c4,
+0x6df16201, 0x2454c408, 0xf1620242, 0x54c4086d,
+0x62034324, 0x7f08fff1, 0x620e2454, 0x6f08fff1,
+0x620e247c, 0x5a287cf5, 0xfdf162d7, 0x24542928,
+0xfdf56201, 0x24545a28, 0xfff16201, 0x24547f08,
+0x62c03110, 0x6e087df5, 0x010044ac, 0xf5620000,
+0x6c7e087d, 0xf5620724, 0x6c2e087c, 0x027a4044,
+0x00b80a74, 0xe9000007, 0x0000017e, 0x04f88340,
+0xf162d175, 0x5470287f, 0x62a00424, 0x70287ef1,
+0xf262a0d2, 0x1d79287d, 0x00100e0c, 0x286cf562,
+0x0424545c, 0x2864f562, 0x06245c58, 0x287df262,
+0x0e122579, 0xf5620010, 0xdc592864, 0x286cf362,
+0xc500dbc2, 0x81d393f8, 0x00fffffa, 0x0717b800,
+0x850f0000, 0x00000122, 0x287ff162, 0x04245470,
+0x7ef162f5, 0xf5d27028, 0x28fff162, 0x0124547f,
+0x28fff162, 0x04246c6f, 0x2874f562, 0x06244c58,
+0x286cf562, 0xf562d55c, 0xcc592874, 0x286cf362,
+0xc500e1c2, 0x81d493f8, 0x00fffffa, 0x071eb800,
+0x850f0000, 0x000000d2, 0x000001b8, 0xfff16200,
+0x246c7f28, 0x7df56202, 0x447c6e08, 0x7df56250,
+0x447c7e08, 0x02c08320, 0x7511f883, 0x7cf362e8,
+0x244c2628, 0xf1620004, 0x4c7f28ff, 0xf6620124,
+0x4c42287d, 0xf1620424, 0x4c7f28ff, 0xc9310224,
+0xf562d231, 0xc97b0876, 0x087cf562, 0x20544c2e,
+0x6a756c7a, 0x8d01428d, 0xc321025a, 0x8301fb83,
+0xd08500d1, 0xf5621675, 0x2d6e087d, 0x00100e20,
+0x087cf562, 0x0f446c2e, 0x49754b7a, 0x7410f883,
+0xebc28904, 0xfff162bd, 0x24746f28, 0x4df66201,
+0x244c2c28, 0xfff16202, 0x247c6f28, 0x077db804,
+0xf3620000, 0xe9c22844, 0x93f8c500, 0xfffa81d5,
+0x750000ff, 0xf22be815, 0xd8f7ffff, 0x73b80ceb,
+0xeb000007, 0x0778b805, 0x5d8b0000, 0x00c3c9fc,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x3c000000, 0x00003c00, 0x80000000, 0x8000bc00,
+0x38003400, 0x00000000, 0x00000000, 0x00000000,
+0x00003c00, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0007100,
+};
+asm(".type avx512fp16_x86_32_D_32f2, STT_NOTYPE;");
+asm(".type avx512fp16_x86_32_D_32f2, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512fp16_x86_32_D_f2[] = {
+0x0004eae9, 0xe5895500, 0x6258ec83, 0x6e087df5,
+0x100b600d, 0x7df56200, 0xdd4d7e08, 0x087df562,
+0x62db4d7e, 0x7e087df5, 0xc766dc4d, 0x4000f445,
+0x087df562, 0x62dc4d6e, 0x990875f6, 0xf562db4d,
+0xc87e087d, 0x087df562, 0xa7b8c86e, 0x62000000,
+0xc20876f3, 0xc500fa45, 0x4ad093fb, 0x048b850f,
+0xc7660000, 0xc000f445, 0x087df562, 0x62dc4d6e,
+0x9f0875f6, 0xf562db4d, 0xc87e087d, 0x087df562,
+0xabb8c86e, 0x62000000, 0xc20876f3, 0xc500fa4d,
+0x4ad193fb, 0x0453850f, 0xc7660000, 0x0000f445,
+0x087df562, 0x62dc4d6e, 0x9b0875f6, 0xf562db4d,
+0xc87e087d, 0x087df562, 0xafb8c86e, 0x62000000,
+0xc20876f3, 0xc500fa55, 0x4ad293fb, 0x041b850f,
+0xc7660000, 0x8000f445, 0x087df562, 0x62dc4d6e,
+0x9d0875f6, 0xf562db4d, 0xc87e087d, 0x087df562,
+0xb3b8c86e, 0x62000000, 0xc20876f3, 0xc500fa5d,
+0x4ad393fb, 0x03e3850f, 0xf5620000, 0x4d6e087d,
+0x7df562db, 0xdc656e08, 0x0876f562, 0xf562d458,
+0x5d6e087d, 0x7df562dd, 0xdc7d6e08, 0x087df562,
+0x62fa557e, 0x990845f6, 0xf562db5d, 0xd87e087d,
+0x087df562, 0xf362d86e, 0x65c20866, 0xfbc500fa,
+0xb84ad493, 0x000000bb, 0x038f850f, 0xf9c50000,
+0x0b501d6f, 0xf5620010, 0x7d6e087d, 0x57e8c5dd,
+0x7df562d3, 0xdc756e08, 0x087df562, 0x62fa557e,
+0x9f084df6, 0xf562db7d, 0xf87e087d, 0x087df562,
+0xc0b8d06e, 0x62000000, 0xc2086ef3, 0xc500fa6d,
+0x4ad593fb, 0x0343850f, 0xf5620000, 0xcc5c0876,
+0x087df562, 0x62dd556e, 0x6e087df5, 0xf562dc7d,
+0x4d7e087d, 0x45f662fa, 0xdb559b08, 0x087df562,
+0xf562d07e, 0xd06e087d, 0x086ef362, 0x00fa75c2,
+0xd693fbc5, 0x00c5b84a, 0x850f0000, 0x000002fd,
+0xcb57f0c5, 0x087df562, 0x62dd756e, 0x7e087df5,
+0xf562fa4d, 0x7d6e087d, 0x45f662dc, 0xdb759d08,
+0x087df562, 0xf562f07e, 0xc86e087d, 0x0000cab8,
+0x76f36200, 0xfa7dc208, 0x93fbc500, 0x850f4ad7,
+0x000002b9, 0x100b64a1, 0x7df56200, 0x401d6e08,
+0x6200100b, 0x6e087df5, 0x100b4215, 0x7ef16200,
+0x60251008, 0x6200100b, 0x7e087df5, 0xf562fa5d,
+0x557e087d, 0x5ef662fb, 0xfd4dd708, 0x087ef162,
+0x89f84d11, 0x68a1ec45, 0x6200100b, 0x11087ef1,
+0xf662fa65, 0x65d70876, 0xf04589f8, 0x087ef162,
+0x0b6c2d10, 0xfcb80010, 0x62000000, 0xd70856f6,
+0xf362fa4d, 0xc4c20874, 0x93fbc500, 0x03e283d0,
+0x0f03fa83, 0x00023485, 0xe8458b00, 0x00000035,
+0x7df16280, 0x62f06e08, 0xd7084ff6, 0xf162fb4d,
+0x6d10087e, 0x56f662fa, 0xfb65d708, 0x087df162,
+0x0035e07e, 0x62800000, 0x6e087df1, 0x0106b8f8,
+0xf3620000, 0xc9c20844, 0x93fbc500, 0x03e283d1,
+0x0f03fa83, 0x0001e485, 0xe8458b00, 0x087df162,
+0xf562f06e, 0xe06e087d, 0x6210e8c1, 0x6e087df5,
+0x76f562c8, 0x62c95908, 0xd7084ff6, 0xf162fa6d,
+0xea7e087d, 0xf662d089, 0xe6990875, 0x087cf562,
+0x8a0fe52e, 0x0000018b, 0x0185850f, 0xf0c50000,
+0xe8c1c957, 0x7df56210, 0x62e06e08, 0x2e087cf5,
+0x738a0fe1, 0x0f000001, 0x00016d85, 0x7ef16200,
+0xfa4d1008, 0x0876f662, 0xc5fb65d7, 0xb8c957f0,
+0x0000011b, 0x087ef162, 0x62fb6d10, 0x570856f6,
+0xf362fa4d, 0xd4c20874, 0x93fbc500, 0x03e283d2,
+0x0f03fa83, 0x00014485, 0x7df56200, 0x46356e08,
+0x6200100b, 0x7e087df5, 0xf162fb75, 0x7510087e,
+0x7df562fb, 0x442d6e08, 0xc700100b, 0x3c00e445,
+0xf5620000, 0x6d7e087d, 0x7ef162fa, 0xfa6d1008,
+0xce28f8c5, 0x0856f662, 0xc5fd4d57, 0xb8e528f8,
+0x00000128, 0x084ef662, 0x62f96557, 0xc2085cf3,
+0xfbc500d9, 0xe283d393, 0x03fa8303, 0x00db850f,
+0xf5620000, 0x656e087d, 0x5ef562f4, 0xf87d5808,
+0x087df562, 0xf562f87e, 0x7d6e087d, 0x46f562f5,
+0xf9755808, 0x62c0b70f, 0x7e087df5, 0x10e2c1f2,
+0xf162d009, 0xf86e087d, 0x0846f662, 0x62fb75d7,
+0x10087ef1, 0xf662fc7d, 0x4dd70846, 0x56f662fb,
+0xfb4d5708, 0x0874f362, 0xc500e6c2, 0x83d493fb,
+0x32b803e2, 0x83000001, 0x717503fa, 0x085ef562,
+0x62f5655c, 0x7e087df5, 0xf562fa5d, 0x557e087d,
+0x7df162fb, 0x35e87e08, 0x80000000, 0x087df162,
+0xf662c86e, 0x4d570856, 0x7df162fd, 0x62c87e08,
+0x2e087cf5, 0x752a7ae1, 0x10e8c128, 0x087df562,
+0xf562d86e, 0xe32e087c, 0x00b81e7a, 0x74000000,
+0xb815eb1c, 0x00000110, 0x11b813eb, 0xeb000001,
+0x013ab80c, 0x05eb0000, 0x00013bb8, 0x55c3c900,
+0xe483e589, 0xc0ec81c0, 0x62000000, 0x6e087df5,
+0x100b600d, 0x7df56200, 0x244c7e08, 0x7df5623b,
+0x244c7e08, 0x7df5623c, 0x244c7e08, 0x448b663d,
+0x89667624, 0x62702444, 0x6e087df5, 0x6238246c,
+0x6e087df5, 0x623b2454, 0x7e087df5, 0x625e246c,
+0xc2086ef3, 0x005e2444, 0xd093fbc5, 0x0539b84a,
+0x850f0000, 0x000005e1, 0x087df562, 0x3824746e,
+0x084ef562, 0x3b245458, 0x087df562, 0x3924547e,
+0x087df562, 0x3b24546e, 0x086ef562, 0xf562d258,
+0x7c6e087d, 0xf5623924, 0x7c7e087d, 0xf5625e24,
+0xd07e087d, 0x087df562, 0x3fb8d06e, 0x62000005,
+0xc2086ef3, 0x005e244c, 0xd193fbc5, 0x86850f4a,
+0x62000005, 0x6e087df5, 0x62392464, 0x5c085ef5,
+0x623b2454, 0x7e087df5, 0x048b2414, 0x84896624,
+0x00008a24, 0x44896600, 0x89667224, 0x62742444,
+0x6e087df5, 0x6238246c, 0x6e087df5, 0x623a2454,
+0x7e087df5, 0x625e246c, 0xc2086ef3, 0x005e2454,
+0xd293fbc5, 0x0544b84a, 0x850f0000, 0x00000529,
+0x087df562, 0x3824746e, 0x084ef562, 0x3b245459,
+0x087df562, 0x3824547e, 0x087df562, 0x3c24546e,
+0x086ef562, 0xf562d259, 0x547e087d, 0xf5623924,
+0x7c6e087d, 0xf5623b24, 0x54580846, 0xf5623c24,
+0x547e087d, 0xf5623a24, 0x5c6e087d, 0xf5623b24,
+0x545c0866, 0xf5623c24, 0x646e087d, 0xf5623824,
+0x645c085e, 0xf5623924, 0x5459086e, 0xf5623a24,
+0x647e087d, 0xf5625e24, 0xd07e087d, 0x087df562,
+0x3a24547e, 0x087df562, 0xf362d06e, 0x5cc2086e,
+0xc5005e24, 0x4ad393fb, 0x00055bb8, 0x86850f00,
+0x62000004, 0x590866f5, 0x623d245c, 0x7e087df5,
+0x6238245c, 0x6e087df5, 0x623b246c, 0x5e0856f5,
+0x623d2454, 0x6e087df5, 0x62382474, 0x7e087df5,
+0x625e2474, 0x7e087df5, 0x7df562d0, 0x24547e08,
+0x7df56239, 0x62d06e08, 0xc2086ef3, 0x005e2464,
+0xd493fbc5, 0x0564b84a, 0x850f0000, 0x00000429,
+0x1d6ff9c5, 0x00100b50, 0x087df562, 0x3d247c6e,
+0xd357c0c5, 0x086ef562, 0x38245459, 0x087df562,
+0x3b24646e, 0x087df562, 0x5e24547e, 0xd357d8c5,
+0x087df562, 0xf562d07e, 0xd06e087d, 0x000567b8,
+0x6ef36200, 0x246cc208, 0xfbc5005e, 0x0f4ad593,
+0x0003d485, 0x7ef56200, 0x24442c08, 0x2484893b,
+0x000000bc, 0x086ef562, 0x2f24542a, 0x087df562,
+0x3824547e, 0x087df562, 0x38246c6e, 0x087df562,
+0x3b24546e, 0x087df562, 0x5e246c7e, 0x086ef362,
+0x5e2474c2, 0x93fbc500, 0x6eb84ad6, 0x0f000005,
+0x00038485, 0x6df66200, 0x24544d08, 0x7df5623b,
+0x24547e08, 0x6df66238, 0x24544d08, 0x7ef56238,
+0x89c22c08, 0x00bc2484, 0xf5620000, 0x542a086e,
+0xf5622f24, 0x547e087d, 0xf5625e24, 0x546e087d,
+0xf5623b24, 0xd07e087d, 0x087df562, 0x75b8d86e,
+0x62000005, 0xc20866f3, 0x005e247c, 0xd793fbc5,
+0x22850f4a, 0x62000003, 0x59086ef5, 0x7df562d2,
+0x24547e08, 0x6df66238, 0x24544f08, 0x7df56238,
+0x24547e08, 0x6df66239, 0x24544d08, 0x7ef56239,
+0x89c22c08, 0x00bc2484, 0xf5620000, 0x542a086e,
+0xf5622f24, 0x547e087d, 0xf5625e24, 0x546e087d,
+0xf3623b24, 0x44c2086e, 0xc5005e24, 0x4ad093fb,
+0x00057cb8, 0xbe850f00, 0x62000002, 0x2c087ef5,
+0x89392444, 0x00bc2484, 0xf5620000, 0x542a086e,
+0xf5622f24, 0x547e087d, 0xf6623e24, 0x544d086d,
+0xf5623b24, 0xc22c087e, 0xbc248489, 0x62000000,
+0x2a086ef5, 0x622f2454, 0x7e087df5, 0x7df562d0,
+0x62d06e08, 0xc2086ef3, 0x003e244c, 0xd193fbc5,
+0x057eb84a, 0x850f0000, 0x0000025d, 0x087ef562,
+0x3b244479, 0xbc248489, 0x62000000, 0x7b086ef5,
+0x622f2454, 0x7e087df5, 0x62382454, 0x6e087df5,
+0x62382474, 0x6e087df5, 0x623b2454, 0x7e087df5,
+0x625e2474, 0x7e087df5, 0x7df562d0, 0xb8d86e08,
+0x0000058f, 0x0866f362, 0x5e2454c2, 0x93fbc500,
+0x850f4ad2, 0x00000201, 0x086ef562, 0xf562d259,
+0x547e087d, 0xf5623824, 0x5451086e, 0xf5623824,
+0x547e087d, 0xf5625e24, 0x546e087d, 0xf5623b24,
+0xd07e087d, 0x087df562, 0x9cb8d86e, 0x62000005,
+0xc20866f3, 0x005e245c, 0xd393fbc5, 0xb6850f4a,
+0x62000001, 0x5e0876f5, 0x7df562d2, 0x244c7e08,
+0x7df56239, 0x24547e08, 0x6cf36238, 0x24540a08,
+0xf5620b38, 0x646e087d, 0xf5623924, 0xd07e087d,
+0x087df562, 0x3a24547e, 0x087df562, 0x5e24647e,
+0x087df562, 0xa4b8d06e, 0x62000005, 0xc2086ef3,
+0x005e2464, 0xd493fbc5, 0x5a850f4a, 0x62000001,
+0x6e087df5, 0x623d2454, 0x59086ef5, 0x623b245c,
+0x59086ef5, 0x623c2454, 0x7e087df5, 0x6238245c,
+0x7e087df5, 0x62392454, 0x6e087df5, 0x6238246c,
+0x5f0856f5, 0x62392454, 0x7e087df5, 0x623a2454,
+0x6e087df5, 0x62382474, 0x5d084ef5, 0x62392454,
+0x7e087df5, 0x62392454, 0x6e087df5, 0x6239247c,
+0x580846f5, 0x663a2454, 0x7624548b, 0x24948966,
+0x000000b8, 0x087df562, 0x5c24646e, 0x086ef562,
+0x3d245459, 0x087df562, 0x5e24547e, 0x085ef562,
+0x3c245458, 0x087df562, 0xf562d07e, 0xd06e087d,
+0x00063db8, 0x6ef36200, 0x246cc208, 0xfbc5005e,
+0x0f49cd93, 0x0000a085, 0x54896600, 0xf3627224,
+0x5427086c, 0x62003b24, 0x7e087df5, 0x62382454,
+0x43086df6, 0x623b2454, 0x7e087df5, 0xc5392454,
+0x62d257e8, 0x2e087cf5, 0x7a392454, 0x625e7560,
+0x2e087cf5, 0x7a38244c, 0x6259755b, 0x6e087df5,
+0x6238244c, 0x6e087df5, 0x623b2474, 0x2d0875f6,
+0x6239244c, 0x7e087df5, 0x625e2474, 0x7e087df5,
+0x7df562c8, 0x244c7e08, 0x7df5623a, 0xb8c86e08,
+0x0000077d, 0x0876f362, 0x5e2474c2, 0x93fbc500,
+0x15754ad6, 0xfff4dce8, 0xebd8f7ff, 0x0773b80c,
+0x05eb0000, 0x000778b8, 0x00c3c900, 0x00000000,
+0x3c000000, 0x00003c00, 0x00000000, 0x00000000,
+0x00008000, 0x00000000, 0x00000000, 0x00000000,
+0x40003c00, 0x3c004000, 0x3c003c00, 0xc000bc00,
+0005560,
+};
+asm(".type avx512fp16_x86_32_D_f2, STT_NOTYPE;");
+asm(".type avx512fp16_x86_32_D_f2, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512fp16_x86_64_D_64f2[] = {
+0x000662e9, 0x01b85500, 0xbe000000, 0x00000021,
+0x48e58948, 0x48c0e483, 0x0148ec81, 0x8d480000,
+0x00882494, 0xf5620000, 0x2d6e087d, 0x00000e50,
+0x087df562, 0xe1246c7e, 0x0876f562, 0xf189c82a,
+0x087df562, 0x0644ac7e, 0x29000001, 0x7df562c1,
+0x424c7e08, 0x76f562ff, 0x62c92a08, 0x7e087df5,
+0x4863444c, 0x8348c0ff, 0xcc7521f8, 0x487df262,
+0x0e0a3d79, 0xf5620000, 0xa4584844, 0x00008824,
+0x7df26200, 0x353d7948, 0x6200000e, 0x584844f5,
+0x00882494, 0xf1620000, 0x8c6f48fd, 0x0000c824,
+0x5cf56200, 0x62e15948, 0x59486cf5, 0xfdf162d1,
+0xb8d96f48, 0x000000a7, 0x4875f662, 0x88249c98,
+0x62000000, 0xc2485cf3, 0xfbc500c3, 0xc1ffc893,
+0x058f850f, 0xf1620000, 0xf16f48fd, 0x0000abb8,
+0x7df26200, 0xd71d7948, 0x6200000d, 0x9e4875f6,
+0x008824b4, 0xf1620000, 0xe3ef485d, 0x485cf362,
+0xc500cec2, 0xffc993fb, 0x56850fc1, 0x62000005,
+0x6f48fdf1, 0x00afb8e1, 0xf6620000, 0xa49a4875,
+0x00008824, 0x6cf36200, 0x00d4c248, 0xca93fbc5,
+0x850fc1ff, 0x0000052d, 0x48fdf162, 0xf162e16f,
+0xd3ef486d, 0x0000b3b8, 0x75f66200, 0x24a49c48,
+0x00000088, 0x486cf362, 0xc500dcc2, 0xffcb93fb,
+0xfe850fc1, 0x62000004, 0x6f48fdf1, 0x00882494,
+0xf5620000, 0xe158486c, 0x486cf562, 0xf262c95c,
+0x7479487d, 0xbbb8e124, 0x62000000, 0x6f48fdf1,
+0x00c824bc, 0xf6620000, 0xf2984845, 0x485cf362,
+0xc500e6c2, 0xffcc93fb, 0xb6850fc1, 0x62000004,
+0x6f48fdf1, 0x00c824bc, 0xf1620000, 0xf26f48fd,
+0x485df162, 0xc0b8e3ef, 0x62000000, 0x9e5845f6,
+0x62e12474, 0xc2485cf3, 0xfbc500ee, 0xc1ffcd93,
+0x047f850f, 0xf2620000, 0x6479487d, 0xc5b8e124,
+0x62000000, 0x6f48fdf1, 0x00c824bc, 0xf6620000,
+0xe29a4845, 0x4874f362, 0xc500f4c2, 0xffce93fb,
+0x4e850fc1, 0x62000004, 0x6f48fdf1, 0x00c824bc,
+0xf1620000, 0xe26f48fd, 0x4875f162, 0xcab8cbef,
+0x62000000, 0x9c5845f6, 0x62e12464, 0xc24874f3,
+0xfbc500fc, 0xc1ffcf93, 0x0417850f, 0xf5620000,
+0xb459486c, 0x0000c824, 0x7df56200, 0x246c7e08,
+0xfdf162e2, 0x24a46f48, 0x00000108, 0x4865f162,
+0x08248cef, 0x62000001, 0xb6584df6, 0x62e22464,
+0xb6584df6, 0x62e2244c, 0x7f48fdf1, 0x0008248c,
+0xf1620000, 0x8c6f48fd, 0x0000c824, 0xfdf16200,
+0xb8f26f48, 0x000000d4, 0x4875f662, 0x0824b4a6,
+0x62000001, 0xc2485cf3, 0xfbc500c6, 0xc1ffc893,
+0x039f850f, 0xf6620000, 0x8ca7486d, 0x00010824,
+0xfdf16200, 0x24b46f48, 0x00000008, 0x0000d8b8,
+0x4cf36200, 0x00c9c248, 0xc993fbc5, 0x850fc1ff,
+0x00000371, 0x48fdf162, 0x08248c6f, 0x62000001,
+0x59486cf5, 0x00c824bc, 0xf1620000, 0xe16f48fd,
+0x5845f662, 0xe22464b6, 0x48fdf162, 0xdeb8fa6f,
+0x62000000, 0x964875f6, 0x00c824bc, 0xf3620000,
+0xd7c2485c, 0x93fbc500, 0x0fc1ffca, 0x00032485,
+0x6df66200, 0x248cb748, 0x000000c8, 0x0000e2b8,
+0x4cf36200, 0x00d9c248, 0xcb93fbc5, 0x850fc1ff,
+0x00000301, 0x087df562, 0x0ad2356e, 0xf5620000,
+0x256e087d, 0x00000aca, 0x087df562, 0xe224747e,
+0x087df562, 0xe324647e, 0x586ef662, 0xf1244cd6,
+0x4876f662, 0xf162f9d6, 0xd3ef486d, 0x486ef662,
+0x88248cd6, 0xb8000000, 0x000000fc, 0x4844f362,
+0xc500e1c2, 0xffcc93fb, 0xa6850fc1, 0x62000002,
+0x6f48fdf1, 0x0088249c, 0xf1620000, 0x0def5865,
+0x00000a74, 0x4877f662, 0xc82494d6, 0x62000000,
+0x6f48fdf1, 0x0088249c, 0x06b80000, 0x62000001,
+0xd64866f6, 0x00c8248c, 0xf1620000, 0x0def5875,
+0x00000a44, 0x486cf362, 0x6200e9c2, 0x7f48fdf1,
+0x0048248c, 0xfbc50000, 0xc1ffcd93, 0x0243850f,
+0xf1620000, 0x8c6f48fd, 0x00008824, 0x77f66200,
+0x2494d648, 0x00000088, 0xf562c031, 0xc9594874,
+0x48fdf162, 0xc824947f, 0xc5ffffff, 0x62d257e8,
+0x7f48fdf1, 0x0008248c, 0xf5620000, 0x5c6e087d,
+0xf5620404, 0x4c580866, 0xf5620504, 0x4c2e087c,
+0x8a0fe404, 0x000001d3, 0x01cd850f, 0xf5620000,
+0x542e087c, 0x8a0fe504, 0x000001c6, 0x01c0850f,
+0x83480000, 0x834804c0, 0xbe7540f8, 0x48fdf162,
+0x8824bc6f, 0x62000000, 0xd64846f6, 0x00c82494,
+0xf1c50000, 0x1bb8c9ef, 0x62000001, 0x6f48fdf1,
+0x00c8249c, 0xf6620000, 0x8c564866, 0x00008824,
+0x6cf36200, 0x00f1c248, 0xce93fbc5, 0x850fc1ff,
+0x00000181, 0x087df562, 0x09581d6e, 0x8d480000,
+0x62482444, 0x6e087df5, 0x0009473d, 0xfdf16200,
+0x248c6f48, 0x00000088, 0x087df562, 0xe3245c7e,
+0x48fdf162, 0xc8249c6f, 0x62000000, 0x7e087df5,
+0x62e2247c, 0x6f48fdf1, 0x76f662d3, 0x24545658,
+0xfdf162f1, 0x24947f48, 0xffffffc8, 0x0240c766,
+0x83480000, 0xf56204c0, 0x687e087d, 0xc23948fe,
+0xf162ea75, 0xd16f48fd, 0x4866f662, 0x48249456,
+0xb8000000, 0x00000128, 0x48fdf162, 0xc824ac6f,
+0x62ffffff, 0xc24854f3, 0xfbc500fa, 0xc1ffcf93,
+0x00df850f, 0xf5620000, 0x94584874, 0x00010824,
+0x6ef66200, 0x249cd648, 0x000000c8, 0x48fdf162,
+0x0824ac6f, 0x62000001, 0xd64856f6, 0x00c82494,
+0xf1620000, 0x947f48fd, 0x00000824, 0x76f66200,
+0x24945648, 0x000000c8, 0x000132b8, 0x64f36200,
+0x00c2c248, 0x48fdf162, 0x4824947f, 0xc5000000,
+0xffc893fb, 0x627e75c1, 0x7e087df5, 0x31e22474,
+0x7df562c0, 0x24647e08, 0x75f162e3, 0x4515ef58,
+0x62000008, 0x565876f6, 0x62f12454, 0x7f48fdf1,
+0xffc82494, 0xf562ffff, 0x2c6e087d, 0x56f56202,
+0x044c5c08, 0x7cf56245, 0x044c2e08, 0x752a7ae4,
+0x7cf56228, 0x044c2e08, 0x75257ae5, 0xc0834823,
+0xf8834804, 0x31cf7540, 0xb81aebc0, 0x00000110,
+0x11b813eb, 0xeb000001, 0x013ab80c, 0x05eb0000,
+0x00013bb8, 0x55c3c900, 0x20bac031, 0x48000000,
+0x8348e589, 0x8148c0e4, 0x000240ec, 0x01488d00,
+0x0876f562, 0xd189c92a, 0xf562c129, 0x8c7e087d,
+0x00010044, 0x76f56200, 0x62c92a08, 0x7e087df5,
+0x0140448c, 0xf5620000, 0x0d6e087d, 0x00000810,
+0x0a7501a8, 0x087df562, 0x07c20d6e, 0xf5620000,
+0x8c7e087d, 0x00018044, 0xc0ff4800, 0x20f88348,
+0xf162ab75, 0x746f48fd, 0xf1620424, 0x747f48fd,
+0xf1620124, 0x4c6f48fd, 0x39b80124, 0x62000005,
+0xc24874f3, 0xfbc500c6, 0xc2ffd093, 0x0715850f,
+0xf5620000, 0x54584874, 0xf1620424, 0x547f48fd,
+0xf1620224, 0x7c6f48fd, 0x3fb80424, 0x62000005,
+0x6f48fdf1, 0x62022454, 0x584844f5, 0x6cf362df,
+0x00cbc248, 0xd193fbc5, 0x850fc2ff, 0x000006d7,
+0x486cf562, 0x0424545c, 0x48fdf162, 0x0324547f,
+0x4874f362, 0x032454c2, 0x0544b800, 0xfbc50000,
+0xc2ffd293, 0x06ad850f, 0xf1620000, 0x746f48fd,
+0xf5620524, 0x4c594874, 0xf5620424, 0xde59484c,
+0x48fdf162, 0x0424546f, 0x486cf562, 0xf562ee58,
+0x645c486c, 0xf5620524, 0xcb5c4874, 0x00055bb8,
+0x5cf56200, 0x62e55948, 0xc24874f3, 0xfbc500dc,
+0xc2ffd393, 0x065d850f, 0xf5620000, 0x4c59486c,
+0xf1620624, 0x4c7f48fd, 0xf5620124, 0x545e486c,
+0x64b80624, 0x62000005, 0xc24874f3, 0xfbc500e2,
+0xc2ffd493, 0x062d850f, 0xf2620000, 0x0d79487d,
+0x000006ce, 0x000567b8, 0xfdf16200, 0x245c6f48,
+0x65f16206, 0x62d1ef48, 0xef4875f1, 0x6204244c,
+0x59486cf5, 0x62012454, 0xc2486cf3, 0xfbc500e9,
+0xc2ffd593, 0x05ed850f, 0xf5620000, 0x4c7d487d,
+0xf5620424, 0xc97d487e, 0x4874f362, 0x042474c2,
+0x056eb800, 0xfbc50000, 0xc2ffd693, 0x05c5850f,
+0xf6620000, 0x4c4c487d, 0xf1620424, 0x4c7f48fd,
+0xf1620124, 0x646f48fd, 0xf6620424, 0x4c4c487d,
+0xf5620124, 0xc97d487d, 0x487ef562, 0x75b8c97d,
+0x62000005, 0xc24874f3, 0xfbc500fc, 0xc2ffd793,
+0x0581850f, 0xf5620000, 0xcc59485c, 0x48fdf162,
+0x01244c7f, 0x487df662, 0x01244c4e, 0x48fdf162,
+0x02244c7f, 0x48fdf162, 0x02244c6f, 0x00057cb8,
+0x7df66200, 0x62d14c48, 0x7d487df5, 0x7ef562d2,
+0x62d27d48, 0xc2486cf3, 0xfbc500c4, 0xc2ffd093,
+0x0531850f, 0xf6620000, 0x544c487d, 0xf5620424,
+0xc97d487d, 0x487df562, 0xf562d27d, 0xc97d487e,
+0x487ef562, 0xf362d27d, 0xcac24874, 0x057eb800,
+0xfbc50000, 0xc2ffd193, 0x04f9850f, 0xf1620000,
+0x7c6f48fd, 0xf3620424, 0x7c3b48fd, 0x62000124,
+0x5b487df5, 0x6201244c, 0x3b48fdf3, 0x0101247c,
+0x487df162, 0x07244c7f, 0x487df562, 0x01244c5b,
+0x487df162, 0x08244c7f, 0x487cf562, 0x0824545b,
+0x487cf562, 0x07244c5b, 0x48f5f362, 0x6201ca3a,
+0xc24874f3, 0x00042454, 0x000588b8, 0x93fbc500,
+0x0fc2ffd2, 0x00048e85, 0x7cf56200, 0x244c7d48,
+0x7ff56204, 0x62c97d48, 0xc24874f3, 0x0004245c,
+0x00058fb8, 0x93fbc500, 0x0fc2ffd3, 0x00046685,
+0xfdf16200, 0x247c6f48, 0xfdf36204, 0x247c3b48,
+0xf5620001, 0x4c79487c, 0xf3620124, 0x7c3b48fd,
+0x62010124, 0x7f487df1, 0x6207244c, 0x79487cf5,
+0x6201244c, 0x7f487df1, 0x6208244c, 0x7a487ff5,
+0x62082454, 0x7a487ff5, 0x6207244c, 0x3a48f5f3,
+0xf16201ca, 0x546f48fd, 0x96b80424, 0x62000005,
+0xc24874f3, 0xfbc500e2, 0xc2ffd493, 0x03f5850f,
+0xf5620000, 0xca59486c, 0x48fdf162, 0x01244c7f,
+0x487cf562, 0x01244c51, 0x4874f362, 0xb800eac2,
+0x0000059c, 0xd593fbc5, 0x850fc2ff, 0x000003c7,
+0x487df262, 0x04260d79, 0xf5620000, 0xd25e4874,
+0x48fdf162, 0x0124547f, 0x487cf362, 0x01246408,
+0x05a4b80b, 0xf1620000, 0x156f48fd, 0x00000400,
+0x486cf362, 0xc500f4c2, 0xffd693fb, 0x84850fc2,
+0x62000003, 0x56487cf3, 0x0b042454, 0xe4efd9c5,
+0x0005abb8, 0x6cf36200, 0x00fcc248, 0xd793fbc5,
+0x850fc2ff, 0x0000035f, 0x4874f562, 0x04245458,
+0x4874f562, 0xf162d25e, 0x547f48fd, 0xf3620124,
+0x5456487c, 0x620b0124, 0x6f48fdf1, 0xb8012474,
+0x000005b1, 0x484cf362, 0xc500c2c2, 0xffd093fb,
+0x20850fc2, 0x62000003, 0x79487df2, 0x0003c315,
+0x6cf56200, 0x24545948, 0xfdf16204, 0x24547f48,
+0x7cf36201, 0x24540848, 0xf3620b01, 0x6456487c,
+0x620b0124, 0x58486cf5, 0xfdf162d4, 0x247c6f48,
+0x05bbb801, 0xf3620000, 0xcac24844, 0x93fbc500,
+0x0fc2ffd1, 0x0002ce85, 0x64f56200, 0x24645948,
+0x64f56204, 0x245c5948, 0xfdf16205, 0x245c7f48,
+0x5cf56202, 0x24545f48, 0xfdf16202, 0x24547f48,
+0x5cf56203, 0x24645d48, 0xfdf16202, 0x24647f48,
+0x6cf56202, 0x24545848, 0x063db802, 0xf1620000,
+0x5c6f48fd, 0xf5620424, 0x5459486c, 0xf5620624,
+0x64584864, 0xf3620524, 0xd4c2486c, 0x93fbc500,
+0x0fc2ffd2, 0x00025e85, 0xfdf36200, 0x245c3b48,
+0xf662000e, 0x5413487d, 0xf1620e24, 0x5429487c,
+0xf5620124, 0x541d487d, 0xfdc50124, 0x0024947f,
+0x31000002, 0x7df562c0, 0x04ac6e08, 0x00000200,
+0x087cf562, 0x0004ac2e, 0x62000001, 0x7e087df5,
+0x7a0f246c, 0xb80a7402, 0x000006f1, 0x000206e9,
+0xc0834800, 0xf8834802, 0x62ca7520, 0x7f48fdf1,
+0x3108245c, 0x7df562c0, 0x04bc6e08, 0x00000200,
+0x087df562, 0xc004bc7e, 0x48000001, 0x6202c083,
+0x7e087df5, 0x480f247c, 0x7510f883, 0x7cf562d8,
+0x24545a48, 0xfdf1621c, 0x24542948, 0xfdf56201,
+0x24545a48, 0x7ff9c501, 0x02002494, 0xc0310000,
+0x087df562, 0x0004b46e, 0x62000002, 0x2e087cf5,
+0x010004b4, 0xf5620000, 0x747e087d, 0x027a0f24,
+0x00b80a74, 0xe9000007, 0x0000017b, 0x02c08348,
+0x10f88348, 0xf162ca75, 0x5470487f, 0x62a00424,
+0x70487ef1, 0xf262a0d2, 0x1d79487d, 0x00000200,
+0x000717b8, 0x64f56200, 0x245c5848, 0x7df26206,
+0xef2d7948, 0x62000001, 0x5c486cf5, 0x62042454,
+0x594864f5, 0x6cf362dd, 0x00dbc248, 0xd393fbc5,
+0x850fc2ff, 0x0000011f, 0x487ff162, 0x04245470,
+0x7ef162f5, 0xf5d27048, 0x48fdf162, 0x0124547f,
+0x4874f562, 0x06244c58, 0x00071eb8, 0xfdf16200,
+0x24646f48, 0x6cf56204, 0x62d45c48, 0x594874f5,
+0x6cf362cd, 0x00e1c248, 0xd493fbc5, 0x850fc2ff,
+0x000000d3, 0x48fdf162, 0x0224647f, 0x000002b8,
+0x7df56200, 0x04ac6e08, 0x00000140, 0x04c08348,
+0x087df562, 0x3e046c7e, 0x42f88348, 0xf362e375,
+0x4c26487c, 0x62000424, 0x7f48fdf1, 0x6201244c,
+0x42487df6, 0x6204244c, 0x7f48fdf1, 0x3102244c,
+0x62d231c0, 0x7b0876f5, 0x7cf562ca, 0x444c2e08,
+0x75687a40, 0x01788d66, 0x2102708d, 0x01fe83fe,
+0x8500d283, 0x621675c7, 0x6e087df5, 0x0000bf35,
+0x7cf56200, 0x44742e08, 0x75477a20, 0xc0ff4845,
+0x20f88348, 0xf162bd75, 0x7c6f48fd, 0x7db80124,
+0x62000007, 0x6f48fdf1, 0x6204246c, 0x2c4845f6,
+0x6202244c, 0xc24854f3, 0xfbc500e9, 0xc2ffd593,
+0xfee81575, 0xf7fffff1, 0xb80cebd8, 0x00000773,
+0x78b805eb, 0xc9000007, 0x000000c3, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x3c000000, 0x00003c00, 0x80000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00003c00, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x8000bc00, 0x38003400,
+0007310,
+};
+asm(".type avx512fp16_x86_64_D_64f2, STT_NOTYPE;");
+asm(".type avx512fp16_x86_64_D_64f2, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512fp16_x86_64_D_16f2[] = {
+0x000552e9, 0x01b85500, 0xb9000000, 0x00000009,
+0x48e58948, 0x6208ec83, 0x6e087df5, 0x000cdf2d,
+0x7df56200, 0xcd6d7e08, 0x0876f562, 0xca89c82a,
+0x087df562, 0xf7456c7e, 0xf562c229, 0x4c7e087d,
+0xf562e745, 0xca2a0876, 0x087df562, 0xef454c7e,
+0x48c0ff48, 0x7509f883, 0xfff162cf, 0xfd556f08,
+0x08fff162, 0x62fe4d6f, 0x58186cf5, 0x000c8f25,
+0x6cf56200, 0x71155818, 0x6200000c, 0x59085cf5,
+0x6cf562e1, 0x62d15908, 0x6f08fff1, 0x75f662d9,
+0xfd5d9808, 0x0000a7b8, 0x5cf36200, 0x00c3c208,
+0xd093f8c5, 0x850fc2fe, 0x000004a9, 0x08fff162,
+0xf662f16f, 0x759e0875, 0x00abb8fd, 0xf2620000,
+0x1d79087d, 0x00000c26, 0xe357d8c5, 0x085cf362,
+0xc500cec2, 0xfed193f8, 0x76850fc2, 0x62000004,
+0x6f08fff1, 0x75f662e1, 0xfd659a08, 0x0000afb8,
+0x6cf36200, 0x00d4c208, 0xd293f8c5, 0x850fc2fe,
+0x00000451, 0x08fff162, 0xf662e16f, 0x659c0875,
+0x57e8c5fd, 0x00b3b8d3, 0xf3620000, 0xdcc2086c,
+0x93f8c500, 0x0fc2fed3, 0x00042885, 0xfff16200,
+0xfd556f08, 0x086cf562, 0xf562e158, 0xc95c086c,
+0x087df262, 0x62cd7579, 0x6f08fff1, 0xbbb8fe7d,
+0x62000000, 0x980845f6, 0x5cf362f2, 0x00e6c208,
+0xd493f8c5, 0x850fc2fe, 0x000003e9, 0x08fff162,
+0x62fe7d6f, 0x6f08fff1, 0x57d8c5f2, 0x00c0b8e3,
+0xf6620000, 0x759e1845, 0x5cf362cd, 0x00eec208,
+0xd593f8c5, 0x850fc2fe, 0x000003b9, 0x087df262,
+0x62cd6579, 0x6f08fff1, 0xc5b8fe7d, 0x62000000,
+0x9a0845f6, 0x74f362e2, 0x00f4c208, 0xd693f8c5,
+0x850fc2fe, 0x0000038d, 0x08fff162, 0x62fe7d6f,
+0x6f08fff1, 0x57f0c5e2, 0x00cab8cb, 0xf6620000,
+0x659c1845, 0x74f362cd, 0x00fcc208, 0xd793f8c5,
+0x850fc2fe, 0x0000035d, 0x086cf562, 0x62fe7559,
+0x7e087df5, 0xf162ce6d, 0x656f08ff, 0x57e0c5ff,
+0xf662f04d, 0x65b6184d, 0x4df662ce, 0xce4db618,
+0x08fff162, 0x62fb4d7f, 0x6f08fff1, 0xf162fe4d,
+0xf26f08ff, 0x0000d4b8, 0x75f66200, 0xff75a608,
+0x085cf362, 0xc500c6c2, 0xfed093f8, 0x02850fc2,
+0x62000003, 0xa7086df6, 0xf162ff4d, 0x756f08ff,
+0x00d8b8fb, 0xf3620000, 0xc9c2084c, 0x93f8c500,
+0x0fc2fed1, 0x0002dc85, 0xfff16200, 0xff4d6f08,
+0x086cf562, 0x62fe6d59, 0x6f08fff1, 0x55f662e1,
+0xce65b618, 0x08fff162, 0xf662ea6f, 0x6d960875,
+0x00deb8fe, 0xf3620000, 0xd5c2085c, 0x93f8c500,
+0x0fc2fed2, 0x00029c85, 0x6df66200, 0xfe4db708,
+0x0000e2b8, 0x4cf36200, 0x00d9c208, 0xd393f8c5,
+0x850fc2fe, 0x0000027d, 0x087df562, 0x09fe2d6e,
+0xf5620000, 0x256e087d, 0x000009f6, 0x087df562,
+0x62ce6d7e, 0x7e087df5, 0xf662cf65, 0x4dd6186e,
+0x76f662e7, 0xc5f1d608, 0x62d357e8, 0xd6086ef6,
+0xfcb8fd4d, 0x62000000, 0xc2084cf3, 0xf8c500e1,
+0xc2fed493, 0x022b850f, 0xf1620000, 0x7d6f08ff,
+0x45f162fd, 0xad0def18, 0x62000009, 0xd60877f6,
+0xf162fe55, 0x7d6f08ff, 0x46f662fd, 0xfe4dd608,
+0x000106b8, 0x75f16200, 0x890def18, 0x62000009,
+0xc2086cf3, 0xf16200e9, 0x4d7f08ff, 0x93f8c5fc,
+0x0fc2fed5, 0x0001dc85, 0xfff16200, 0xfd4d6f08,
+0x0877f662, 0x31fd55d6, 0x74f562c0, 0x62c95908,
+0x7f08fff1, 0xe8c5fa55, 0xf162d257, 0x4d7f08ff,
+0x7df562fb, 0x057c6e08, 0x46f562d8, 0x054c5808,
+0x7cf562d9, 0x284c2e08, 0x7c8a0fd0, 0x0f000001,
+0x00017685, 0x7cf56200, 0x05542e08, 0x6f8a0fd1,
+0x0f000001, 0x00016985, 0xc0834800, 0xf8834804,
+0x62be7510, 0x6f08fff1, 0xf662fd7d, 0x55d60846,
+0x75f162fe, 0x62c9ef08, 0x6f08fff1, 0xf662fe7d,
+0x4d560846, 0x011bb8fd, 0xf3620000, 0xf1c2086c,
+0x93f8c500, 0x0fc2fed6, 0x00013885, 0x7df56200,
+0xbd1d6e08, 0x62000008, 0x6f08fff1, 0xb848fd4d,
+0x00003c00, 0x00003c00, 0x087df562, 0x08a43d6e,
+0x89480000, 0xf562c045, 0x5d7e087d, 0xfff162ce,
+0xfe5d6f08, 0x087df562, 0x62cf7d7e, 0x6f08fff1,
+0x458948d3, 0x76f662c8, 0xe7555618, 0x08fff162,
+0xf662f16f, 0x75560866, 0x0128b8fc, 0xf3620000,
+0xfec2086c, 0x93f8c500, 0x0fc2fed7, 0x0000c485,
+0x74f56200, 0xff555808, 0x086ef662, 0x62fe5dd6,
+0x6f08fff1, 0xf662ff7d, 0x55d60846, 0xfff162fe,
+0xfb557f08, 0x0876f662, 0xb8fe5556, 0x00000132,
+0x0864f362, 0x6200c2c2, 0x7f08fff1, 0xf8c5fc55,
+0xc2fed093, 0xf5627f75, 0x6d7e087d, 0x62c031ce,
+0x7e087df5, 0xf162cf65, 0x15ef1875, 0x000007f8,
+0x1876f662, 0x62e75556, 0x7f08fff1, 0xf562fa55,
+0x6c6e087d, 0xf562e805, 0x4c5c0856, 0xf562e905,
+0x6d7e087d, 0x7cf562c7, 0x054c2e08, 0x752a7ad0,
+0x7cf56228, 0x054c2e08, 0x75257ad1, 0xc0834823,
+0xf8834804, 0x31c77510, 0xb81aebc0, 0x00000110,
+0x11b813eb, 0xeb000001, 0x013ab80c, 0x05eb0000,
+0x00013bb8, 0x55c3c900, 0x08bac031, 0x48000000,
+0x8148e589, 0x000090ec, 0x01488d00, 0x0876f562,
+0xd189c92a, 0xf562c129, 0x4c7e087d, 0xf562d045,
+0xc92a0876, 0x087df562, 0xd8454c7e, 0x087df562,
+0x07560d6e, 0x01a80000, 0xf5620a75, 0x0d6e087d,
+0x0000075c, 0x087df562, 0xe0454c7e, 0x48c0ff48,
+0x7508f883, 0xfff162b4, 0xfa556f08, 0x08fff162,
+0x62f7557f, 0x6f08fff1, 0x39b8f74d, 0x62000005,
+0xc20874f3, 0xf8c500ca, 0xc2fed193, 0x06f2850f,
+0xf5620000, 0x55580874, 0xfff162fa, 0xf8557f08,
+0x08fff162, 0x62fa5d6f, 0x6f08fff1, 0x3fb8f855,
+0x62000005, 0x580864f5, 0x6cf362db, 0x00d3c208,
+0xd293f8c5, 0x850fc2fe, 0x000006b8, 0x086cf562,
+0x62fa555c, 0x7f08fff1, 0xf362f955, 0x5dc20874,
+0x44b800f9, 0xc5000005, 0xfed393f8, 0x91850fc2,
+0x62000006, 0x6f08fff1, 0xf562fb55, 0x4d590874,
+0x6cf562fa, 0x62da5908, 0x6f08fff1, 0xf562fa55,
+0x6d58086c, 0x6cf562fb, 0xfb655c08, 0x0874f562,
+0x5bb8cb5c, 0x62000005, 0x59085cf5, 0x74f362e5,
+0x00e4c208, 0xd493f8c5, 0x850fc2fe, 0x00000644,
+0x086cf562, 0x62fc4d59, 0x7f08fff1, 0xf562f74d,
+0x555e086c, 0x74f362fc, 0x00eac208, 0x000564b8,
+0x93f8c500, 0x0fc2fed5, 0x00061785, 0x7df26200,
+0x270d7908, 0x62000006, 0x6f08fff1, 0x67b8fc5d,
+0xc5000005, 0xc5d157e0, 0xa04d57f0, 0x086cf562,
+0x62f75559, 0xc2086cf3, 0xf8c500f1, 0xc2fed693,
+0x05de850f, 0xf5620000, 0x4d7d087d, 0x7ef562fa,
+0x62c97d08, 0xc20874f3, 0xb800fa7d, 0x0000056e,
+0xd793f8c5, 0x850fc2fe, 0x000005b8, 0x087df662,
+0x62fa4d4c, 0x7f08fff1, 0xf162f74d, 0x656f08ff,
+0x0575b8fa, 0xf6620000, 0x4d4c087d, 0x7df562f7,
+0x62c97d08, 0x7d087ef5, 0x74f362c9, 0x00c4c208,
+0xd093f8c5, 0x850fc2fe, 0x00000578, 0x085cf562,
+0xf162cc59, 0x4d7f08ff, 0x7df662f7, 0xf74d4e08,
+0x08fff162, 0x62f84d7f, 0x6f08fff1, 0x7cb8f84d,
+0x62000005, 0x4c087df6, 0x7df562d1, 0x62d27d08,
+0x7d087ef5, 0x6cf362d2, 0x00ccc208, 0xd193f8c5,
+0x850fc2fe, 0x0000052c, 0x087df662, 0x62fa554c,
+0x7d087df5, 0x7df562c9, 0x62d27d08, 0x7d087ef5,
+0x7ef562c9, 0x62d27d08, 0xc20874f3, 0x7eb800d2,
+0xc5000005, 0xfed293f8, 0xf5850fc2, 0x62000004,
+0x6f08fff1, 0xf162fa7d, 0x7d7f08ff, 0x7df562fd,
+0xfa4d5b08, 0x08fff162, 0x62fe4d7f, 0xef0875f1,
+0x74f162c9, 0xf5751208, 0x087cf162, 0x62fd7529,
+0x5b087df5, 0xf162fa4d, 0x4d7f08ff, 0x7cf562ff,
+0xfe4d5b08, 0x08fef162, 0xf562c97e, 0x555b087c,
+0x74f162ff, 0x62ca1608, 0xc20874f3, 0xb800fa5d,
+0x00000588, 0xd393f8c5, 0x850fc2fe, 0x00000484,
+0x087cf562, 0x62fa4d7d, 0x7d087ff5, 0x74f362c9,
+0xfa65c208, 0x058fb800, 0xf8c50000, 0xc2fed493,
+0x045e850f, 0xf1620000, 0x7d6f08ff, 0xfff162fa,
+0xfd7d7f08, 0x087cf562, 0x62fa4d79, 0x7f08fff1,
+0xf162fe4d, 0xc9ef0875, 0x0874f162, 0x62f57512,
+0x29087cf1, 0xf562fd75, 0x4d79087c, 0xfff162fa,
+0xff4d7f08, 0x087ff562, 0x62fe4d7a, 0x7e08fef1,
+0x7ff562c9, 0xff557a08, 0x0874f162, 0xf162ca16,
+0x556f08ff, 0x0596b8fa, 0xf3620000, 0xeac20874,
+0x93f8c500, 0x0fc2fed5, 0x0003e785, 0x6cf56200,
+0x62ca5908, 0x7f08fff1, 0xf562f74d, 0x4d51087c,
+0x059cb8f7, 0xf3620000, 0xf2c20874, 0x93f8c500,
+0x0fc2fed6, 0x0003bb85, 0x7df26200, 0xdd0d7908,
+0x62000003, 0x5e0874f5, 0xfff162d2, 0xf7557f08,
+0x087cf362, 0x0bf76508, 0x0005a4b8, 0xfff16200,
+0xb9156f08, 0x62000003, 0xc2086cf3, 0xf8c500fc,
+0xc2fed793, 0x037a850f, 0xf3620000, 0x5556087c,
+0xf1620bfa, 0xe4ef085d, 0x0005abb8, 0x6cf36200,
+0x00c4c208, 0xd093f8c5, 0x850fc2fe, 0x00000354,
+0x0874f562, 0x62fa5558, 0x5e0874f5, 0xfff162d2,
+0xf7557f08, 0x087cf362, 0x0bf75556, 0x08fff162,
+0xb8f77d6f, 0x000005b1, 0x0844f362, 0xc500cac2,
+0xfed193f8, 0x19850fc2, 0x62000003, 0x79087df2,
+0x00032b15, 0x6cf56200, 0xfa555908, 0x08fff162,
+0x62f7557f, 0x08087cf3, 0x620bf755, 0x56087cf3,
+0x620bf765, 0x58086cf5, 0x05bbb8d4, 0xf1620000,
+0x756f08ff, 0x4cf362f7, 0x00d2c208, 0xd293f8c5,
+0x850fc2fe, 0x000002cc, 0x0864f562, 0x62fb5559,
+0x590864f5, 0xf162fa65, 0x557f08ff, 0x5cf562f8,
+0xf8555f08, 0x08fff162, 0x62f9557f, 0x5d085cf5,
+0xf162f865, 0x657f08ff, 0x6cf562f8, 0xf8555808,
+0x08fff162, 0xb8fa656f, 0x0000063d, 0x085cf562,
+0x62fb6d58, 0x59086cf5, 0x6cf362d3, 0x00ddc208,
+0xd393f8c5, 0x850fc2fe, 0x00000268, 0x08fff162,
+0x62fe657f, 0x6f08fff1, 0xf662fe7d, 0xd713087d,
+0x087cf162, 0x62f75529, 0x1d087df5, 0xf162f755,
+0x557f08ff, 0x62c031ff, 0x6e087df5, 0x62f8056c,
+0x2e087cf5, 0x7ad0056c, 0xb80a7402, 0x000006f1,
+0x00021fe9, 0xc0834800, 0xf8834802, 0x62d87508,
+0x7f08fff1, 0xf162fe65, 0x756f08ff, 0x7cf562fe,
+0x62d65a08, 0x2908fdf1, 0xf562f755, 0x555a08fd,
+0xfff162f7, 0xff557f08, 0x087df562, 0x62f87d6e,
+0x2e087cf5, 0x647ad07d, 0xf5626275, 0x6d6e087d,
+0x7cf562f9, 0xd16d2e08, 0x5075527a, 0x087ff162,
+0xa0fa5570, 0x087ef162, 0x62a0d270, 0x79087df2,
+0x0001c725, 0x5cf56200, 0xfc655808, 0x000717b8,
+0x7df26200, 0xb72d7908, 0x62000001, 0x5c086cf5,
+0xf562fa55, 0xe559085c, 0x086cf362, 0xc500e4c2,
+0xfed493f8, 0xe90f74c2, 0x00000178, 0x000700b8,
+0x016ee900, 0xf1620000, 0x5570087f, 0xf162f5fa,
+0xd270087e, 0x64f562f5, 0x62c95808, 0x6f08fff1,
+0x1eb8fa65, 0x62000007, 0x5c086cf5, 0x74f562d4,
+0x62cd5908, 0xc2086cf3, 0xf8c500e9, 0xc2fed593,
+0x012e850f, 0xf1620000, 0xc9ef0875, 0x087df562,
+0x62d9756e, 0x7f08fff1, 0xf562f865, 0x7d6e087d,
+0x74f362db, 0x01c3c208, 0x087df562, 0x48dd6d6e,
+0xb8907d8d, 0x0000072a, 0x087df562, 0x62c1757e,
+0x6e087df5, 0xf562df75, 0x7d7e087d, 0xfef262c3,
+0x62d02808, 0x7e087df5, 0xf562c775, 0x6d7e087d,
+0xf7f9c5c5, 0xfff162e2, 0xfb756f08, 0x0875f362,
+0xc555ca25, 0x62f1f7f9, 0x6f08fff1, 0xf362f95d,
+0x75c20864, 0xf8c500f8, 0xc2fed693, 0x00a2850f,
+0xf3620000, 0x4d26087c, 0xf16200fa, 0x4d7f08ff,
+0x7df662f7, 0xfa4d4208, 0x08fff162, 0x31f84d7f,
+0x62d231c0, 0x7b0876f5, 0x7cf562ca, 0x454c2e08,
+0x75657ac0, 0x01788d63, 0x2102708d, 0x01fe83fe,
+0x8500d283, 0x621675c7, 0x6e087df5, 0x00007f3d,
+0x7cf56200, 0x457c2e08, 0x75447ab8, 0xc0ff4842,
+0x08f88348, 0xf162bd75, 0x6d6f08ff, 0xfff162f7,
+0xfa5d6f08, 0x00077db8, 0x55f66200, 0xf84d2c08,
+0x0864f362, 0xc500f9c2, 0xfed793f8, 0xe81575c2,
+0xfffff341, 0x0cebd8f7, 0x000773b8, 0xb805eb00,
+0x00000778, 0x0000c3c9, 0x00000000, 0x00000000,
+0x3c000000, 0x00003c00, 0x80000000, 0x8000bc00,
+0x38003400, 0x00000000, 0x00000000, 0x00000000,
+0x00003c00, 0x00000000, 0x00000000, 0x00000000,
+0006420,
+};
+asm(".type avx512fp16_x86_64_D_16f2, STT_NOTYPE;");
+asm(".type avx512fp16_x86_64_D_16f2, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512fp16_x86_64_D_32f2[] = {
+0x00065de9, 0x01b85500, 0xbe000000, 0x00000011,
+0x48e58948, 0x48e0e483, 0x4868ec83, 0x0824548d,
+0x087df562, 0x0e162d6e, 0xf5620000, 0x6c7e087d,
+0xf562d124, 0xc82a0876, 0xf562f189, 0x6c7e087d,
+0xc1292344, 0x087df562, 0xff424c7e, 0x0876f562,
+0xf562c92a, 0x4c7e087d, 0xff481344, 0xf88348c0,
+0x62cf7511, 0x79287df2, 0x000dd33d, 0x44f56200,
+0x24a45828, 0x00000008, 0x287df262, 0x0daa3d79,
+0xf5620000, 0x94582844, 0x00000824, 0xfff16200,
+0x248c6f28, 0x00000028, 0x285cf562, 0xf562e159,
+0xd159286c, 0x28fff162, 0xf662d96f, 0x9c982875,
+0x00000824, 0x00a7b800, 0xf3620000, 0xc3c2285c,
+0x93f8c500, 0xc1ff66c8, 0x0592850f, 0xf1620000,
+0xf16f28ff, 0x2875f662, 0x0824b49e, 0xb8000000,
+0x000000ab, 0x287df262, 0x0d401d79, 0xdcc50000,
+0xf362e357, 0xcec2285c, 0x93f8c500, 0xc1ff66c9,
+0x055a850f, 0xf1620000, 0xe16f28ff, 0x2875f662,
+0x0824a49a, 0xb8000000, 0x000000af, 0x286cf362,
+0xc500d4c2, 0x66ca93f8, 0x850fc1ff, 0x00000530,
+0x28fff162, 0xecc5e16f, 0xb3b8d357, 0x62000000,
+0x9c2875f6, 0x000824a4, 0xf3620000, 0xdcc2286c,
+0x93f8c500, 0xc1ff66cb, 0x0502850f, 0xf1620000,
+0x946f28ff, 0x00000824, 0x6cf56200, 0x62e15828,
+0x5c286cf5, 0x7df262c9, 0x24747928, 0xfff162d1,
+0x24bc6f28, 0x00000028, 0x0000bbb8, 0x45f66200,
+0x62f29828, 0xc2285cf3, 0xf8c500e6, 0xff66cc93,
+0xb9850fc1, 0x62000004, 0x6f28fff1, 0x002824bc,
+0xf1620000, 0xf26f28ff, 0xe357dcc5, 0x0000c0b8,
+0x45f66200, 0x24749e38, 0x5cf362d1, 0x00eec228,
+0xcd93f8c5, 0x0fc1ff66, 0x00048385, 0x7df26200,
+0x24647928, 0xfff162d1, 0x24bc6f28, 0x00000028,
+0x0000c5b8, 0x45f66200, 0x62e29a28, 0xc22874f3,
+0xf8c500f4, 0xff66ce93, 0x51850fc1, 0x62000004,
+0x6f28fff1, 0x002824bc, 0xf1620000, 0xe26f28ff,
+0xcb57f4c5, 0x0000cab8, 0x45f66200, 0x24649c38,
+0x74f362d1, 0x00fcc228, 0xcf93f8c5, 0x0fc1ff66,
+0x00041b85, 0x6cf56200, 0x24b45928, 0x00000028,
+0x087df562, 0xd2246c7e, 0x28fff162, 0x4824a46f,
+0xc5000000, 0x244c57e4, 0x4df66248, 0x2464b638,
+0x4df662d2, 0x244cb638, 0xfff162d2, 0x248c7f28,
+0xffffffc8, 0x28fff162, 0x28248c6f, 0x62000000,
+0x6f28fff1, 0x00d4b8f2, 0xf6620000, 0xb4a62875,
+0x00004824, 0x5cf36200, 0x00c6c228, 0xc893f8c5,
+0x0fc1ff66, 0x0003a785, 0x6df66200, 0x248ca728,
+0x00000048, 0x28fff162, 0xc824b46f, 0xb8ffffff,
+0x000000d8, 0x284cf362, 0xc500c9c2, 0x66c993f8,
+0x850fc1ff, 0x00000378, 0x28fff162, 0x48248c6f,
+0x62000000, 0x59286cf5, 0x002824bc, 0xf1620000,
+0xe16f28ff, 0x3845f662, 0xd22464b6, 0x28fff162,
+0xf662fa6f, 0xbc962875, 0x00002824, 0x00deb800,
+0xf3620000, 0xd7c2285c, 0x93f8c500, 0xc1ff66ca,
+0x032a850f, 0xf6620000, 0x8cb7286d, 0x00002824,
+0x00e2b800, 0xf3620000, 0xd9c2284c, 0x93f8c500,
+0xc1ff66cb, 0x0306850f, 0xf5620000, 0x356e087d,
+0x00000abc, 0x087df562, 0x0ab4256e, 0xf5620000,
+0x747e087d, 0xf562d224, 0x647e087d, 0xf662d324,
+0x4cd6386e, 0xf662e924, 0xf9d62876, 0xd357ecc5,
+0x286ef662, 0x08248cd6, 0xb8000000, 0x000000fc,
+0x2844f362, 0xc500e1c2, 0x66cc93f8, 0x850fc1ff,
+0x000002ac, 0x28fff162, 0x08249c6f, 0x62000000,
+0xef3865f1, 0x000a5f0d, 0x77f66200, 0x2494d628,
+0x00000028, 0x28fff162, 0x08249c6f, 0x62000000,
+0xd62866f6, 0x0028248c, 0x06b80000, 0x62000001,
+0xef3875f1, 0x000a2f0d, 0x6cf36200, 0x00e9c228,
+0x28fff162, 0xe8248c7f, 0xc5ffffff, 0x66cd93f8,
+0x850fc1ff, 0x00000248, 0x28fff162, 0x08248c6f,
+0x62000000, 0xd62877f6, 0x00082494, 0xc0310000,
+0x2874f562, 0xf162c959, 0x947f28ff, 0xffffa824,
+0x57e8c5ff, 0xfff162d2, 0x248c7f28, 0xffffffc8,
+0x087df562, 0xe4045c6e, 0x0866f562, 0xe5044c58,
+0x087cf562, 0xd4044c2e, 0x01d88a0f, 0x850f0000,
+0x000001d2, 0x087cf562, 0xd504542e, 0x01cb8a0f,
+0x850f0000, 0x000001c5, 0x04c08348, 0x20f88348,
+0xf162be75, 0xbc6f28ff, 0x00000824, 0x46f66200,
+0x2494d628, 0x00000028, 0x0875f162, 0xf162c9ef,
+0x9c6f28ff, 0x00002824, 0x011bb800, 0xf6620000,
+0x8c562866, 0x00000824, 0x6cf36200, 0x00f1c228,
+0xce93f8c5, 0x0fc1ff66, 0x00018385, 0x7df56200,
+0x3f1d6e08, 0x62000009, 0x6f28fff1, 0x0008248c,
+0x8d480000, 0x62e82444, 0x6e087df5, 0x0009233d,
+0x7df56200, 0x245c7e08, 0xfff162d3, 0x249c6f28,
+0x00000028, 0x087df562, 0xd2247c7e, 0x28fff162,
+0xf662d36f, 0x54563876, 0xf162e924, 0x947f28ff,
+0xffffa824, 0x40c766ff, 0x48000002, 0x6204c083,
+0x7e087df5, 0x3948fe68, 0x62ea75c2, 0x6f28fff1,
+0x66f662d1, 0x24945628, 0xffffffe8, 0x000128b8,
+0xfff16200, 0x24ac6f28, 0xffffffa8, 0x2854f362,
+0xc500fac2, 0x66cf93f8, 0x850fc1ff, 0x000000e0,
+0x2874f562, 0x48249458, 0x62000000, 0xd6286ef6,
+0x0028249c, 0xf1620000, 0xac6f28ff, 0x00004824,
+0x56f66200, 0x2494d628, 0x00000028, 0x28fff162,
+0xc824947f, 0x62ffffff, 0x562876f6, 0x00282494,
+0x32b80000, 0x62000001, 0xc22864f3, 0xf16200c2,
+0x947f28ff, 0xffffe824, 0x93f8c5ff, 0xc1ff66c8,
+0xf5627e75, 0x747e087d, 0xc031d224, 0x087df562,
+0xd324647e, 0x3875f162, 0x082a15ef, 0xf6620000,
+0x54563876, 0xf162e924, 0x947f28ff, 0xffffa824,
+0x7df562ff, 0x022c6e08, 0x0856f562, 0x05044c5c,
+0x087cf562, 0xd4044c2e, 0x28752a7a, 0x087cf562,
+0xd5044c2e, 0x2375257a, 0x04c08348, 0x20f88348,
+0xc031cf75, 0x10b81aeb, 0xeb000001, 0x0111b813,
+0x0ceb0000, 0x00013ab8, 0xb805eb00, 0x0000013b,
+0x3155c3c9, 0x0010bac0, 0x89480000, 0xe48348e5,
+0xec8148e0, 0x00000120, 0x6201488d, 0x2a0876f5,
+0x29d189c9, 0x7df562c1, 0x444c7e08, 0x76f56240,
+0x62c92a08, 0x7e087df5, 0x6250444c, 0x6e087df5,
+0x0007870d, 0x7501a800, 0x7df5620a, 0x8d0d6e08,
+0x62000007, 0x7e087df5, 0x4860444c, 0x8348c0ff,
+0xb47510f8, 0x28fff162, 0x0424746f, 0x28fff162,
+0x0124747f, 0x28fff162, 0x01244c6f, 0x000539b8,
+0x74f36200, 0x00c6c228, 0xd093f8c5, 0x0fc2ff66,
+0x00071c85, 0x74f56200, 0x24545828, 0xfff16204,
+0x24547f28, 0xfff16202, 0x247c6f28, 0xfff16204,
+0x24546f28, 0x053fb802, 0xf5620000, 0xdf582844,
+0x286cf362, 0xc500cbc2, 0x66d193f8, 0x850fc2ff,
+0x000006dd, 0x286cf562, 0x0424545c, 0x28fff162,
+0x0324547f, 0x2874f362, 0x032454c2, 0x0544b800,
+0xf8c50000, 0xff66d293, 0xb2850fc2, 0x62000006,
+0x6f28fff1, 0x62052474, 0x592874f5, 0x6204244c,
+0x59284cf5, 0xfff162de, 0x24546f28, 0x6cf56204,
+0x62ee5828, 0x5c286cf5, 0x62052464, 0x5c2874f5,
+0x055bb8cb, 0xf5620000, 0xe559285c, 0x2874f362,
+0xc500dcc2, 0x66d393f8, 0x850fc2ff, 0x00000661,
+0x286cf562, 0x06244c59, 0x28fff162, 0x01244c7f,
+0x286cf562, 0x0624545e, 0x000564b8, 0x74f36200,
+0x00e2c228, 0xd493f8c5, 0x0fc2ff66, 0x00063085,
+0x7df26200, 0x430d7928, 0xb8000006, 0x00000567,
+0x28fff162, 0x06245c6f, 0xd157e4c5, 0x8c57f4c5,
+0x00008024, 0x6cf56200, 0x24545928, 0x6cf36201,
+0x00e9c228, 0xd593f8c5, 0x0fc2ff66, 0x0005f085,
+0x7df56200, 0x244c7d28, 0x7ef56204, 0x62c97d28,
+0xc22874f3, 0x00042474, 0x00056eb8, 0x93f8c500,
+0xc2ff66d6, 0x05c7850f, 0xf6620000, 0x4c4c287d,
+0xf1620424, 0x4c7f28ff, 0xf1620124, 0x646f28ff,
+0xf6620424, 0x4c4c287d, 0xf5620124, 0xc97d287d,
+0x287ef562, 0x75b8c97d, 0x62000005, 0xc22874f3,
+0xf8c500fc, 0xff66d793, 0x82850fc2, 0x62000005,
+0x59285cf5, 0xfff162cc, 0x244c7f28, 0x7df66201,
+0x244c4e28, 0xfff16201, 0x244c7f28, 0xfff16202,
+0x244c6f28, 0x057cb802, 0xf6620000, 0xd14c287d,
+0x287df562, 0xf562d27d, 0xd27d287e, 0x286cf362,
+0xc500c4c2, 0x66d093f8, 0x850fc2ff, 0x00000531,
+0x287df662, 0x0424544c, 0x287df562, 0xf562c97d,
+0xd27d287d, 0x287ef562, 0xf562c97d, 0xd27d287e,
+0x2874f362, 0xb800cac2, 0x0000057e, 0xd193f8c5,
+0x0fc2ff66, 0x0004f885, 0xfff16200, 0x247c6f28,
+0xfff16204, 0x247c7f08, 0x7df56201, 0x244c5b28,
+0x7df36201, 0x247c3928, 0xf1620101, 0x4c7f28ff,
+0xf5620724, 0x4c5b287d, 0xf1620124, 0x4c7f28ff,
+0xf5620824, 0x545b287c, 0xf5620824, 0x4c5b287c,
+0xf3620724, 0xca382875, 0x74f36201, 0x2454c228,
+0x88b80004, 0xc5000005, 0x66d293f8, 0x850fc2ff,
+0x0000048d, 0x287cf562, 0x04244c7d, 0x287ff562,
+0xf362c97d, 0x5cc22874, 0xb8000424, 0x0000058f,
+0xd393f8c5, 0x0fc2ff66, 0x00046485, 0xfff16200,
+0x246c6f28, 0xfff16204, 0x246c7f08, 0x7cf56201,
+0x244c7928, 0x7df36201, 0x246c3928, 0xf1620101,
+0x4c7f28ff, 0xf5620724, 0x4c79287c, 0xf1620124,
+0x4c7f28ff, 0xf5620824, 0x547a287f, 0xf5620824,
+0x4c7a287f, 0xf3620724, 0xca382875, 0xfff16201,
+0x24546f28, 0x0596b804, 0xf3620000, 0xe2c22874,
+0x93f8c500, 0xc2ff66d4, 0x03f3850f, 0xf5620000,
+0xca59286c, 0x28fff162, 0x01244c7f, 0x287cf562,
+0x01244c51, 0x2874f362, 0xb800eac2, 0x0000059c,
+0xd593f8c5, 0x0fc2ff66, 0x0003c485, 0x7df26200,
+0xe90d7928, 0x62000003, 0x5e2874f5, 0xfff162d2,
+0x24547f28, 0x7cf36201, 0x24640828, 0xa4b80b01,
+0x62000005, 0x6f28fff1, 0x0003c315, 0x6cf36200,
+0x00f4c228, 0xd693f8c5, 0x0fc2ff66, 0x00038085,
+0x7cf36200, 0x24545628, 0xf1620b04, 0xe4ef085d,
+0x0005abb8, 0x6cf36200, 0x00fcc228, 0xd793f8c5,
+0x0fc2ff66, 0x00035885, 0x74f56200, 0x24545828,
+0x74f56204, 0x62d25e28, 0x7f28fff1, 0x62012454,
+0x56287cf3, 0x0b012454, 0x28fff162, 0x0124746f,
+0x0005b1b8, 0x4cf36200, 0x00c2c228, 0xd093f8c5,
+0x0fc2ff66, 0x00031885, 0x7df26200, 0x2d157928,
+0x62000003, 0x59286cf5, 0x62042454, 0x7f28fff1,
+0x62012454, 0x08287cf3, 0x0b012454, 0x287cf362,
+0x01246456, 0x6cf5620b, 0x62d45828, 0x6f28fff1,
+0xb801247c, 0x000005bb, 0x2844f362, 0xc500cac2,
+0x66d193f8, 0x850fc2ff, 0x000002c5, 0x2864f562,
+0x04246459, 0x2864f562, 0x05245c59, 0x28fff162,
+0x02245c7f, 0x285cf562, 0x0224545f, 0x28fff162,
+0x0324547f, 0x285cf562, 0x0224645d, 0x28fff162,
+0x0224647f, 0x286cf562, 0x02245458, 0x00063db8,
+0xfff16200, 0x245c6f28, 0x6cf56204, 0x24545928,
+0x64f56206, 0x24645828, 0x6cf36205, 0x00d4c228,
+0xd293f8c5, 0x0fc2ff66, 0x00025485, 0xfff16200,
+0x245c7f08, 0x7df6620e, 0x24541328, 0x7cf1620e,
+0x24542928, 0x7df56201, 0x24541d28, 0xfff16201,
+0x24547f08, 0x62c03110, 0x6e087df5, 0x010004ac,
+0xf5620000, 0x6c2e087c, 0xf5624004, 0x6c7e087d,
+0x027a0724, 0xf1b80a74, 0xe9000006, 0x00000201,
+0x02c08348, 0x10f88348, 0xf562cd75, 0x546e087d,
+0xf1624024, 0x54c4086d, 0x62014124, 0xc4086df1,
+0x02422454, 0x086df162, 0x432454c4, 0xfff16203,
+0x24547f08, 0xfff1620e, 0x247c6f08, 0x7cf5620e,
+0x62d75a28, 0x2928fdf1, 0x62012454, 0x5a28fdf5,
+0x62012454, 0x7f08fff1, 0x31102454, 0x7df562c0,
+0x04ac6e08, 0x00000100, 0x087cf562, 0x40046c2e,
+0x087df562, 0x07246c7e, 0x0a74027a, 0x000700b8,
+0x017be900, 0x83480000, 0x834802c0, 0xcd7508f8,
+0x287ff162, 0x04245470, 0x7ef162a0, 0xa0d27028,
+0x287df262, 0x01721d79, 0x17b80000, 0x62000007,
+0x582864f5, 0x6206245c, 0x79287df2, 0x0001612d,
+0x6cf56200, 0x24545c28, 0x64f56204, 0x62dd5928,
+0xc2286cf3, 0xf8c500db, 0xff66d393, 0x1e850fc2,
+0x62000001, 0x70287ff1, 0xf5042454, 0x287ef162,
+0x62f5d270, 0x7f28fff1, 0x62012454, 0x582874f5,
+0xb806244c, 0x0000071e, 0x28fff162, 0x0424646f,
+0x286cf562, 0xf562d45c, 0xcd592874, 0x286cf362,
+0xc500e1c2, 0x66d493f8, 0x850fc2ff, 0x000000d1,
+0x28fff162, 0x0224647f, 0x000002b8, 0x7df56200,
+0x047c6e08, 0xc0834850, 0x7df56204, 0x047c7e08,
+0xf883481e, 0x62e67522, 0x26287cf3, 0x0004244c,
+0x28fff162, 0x01244c7f, 0x287df662, 0x04244c42,
+0x28fff162, 0x02244c7f, 0xd231c031, 0x0876f562,
+0xf562ca7b, 0x4c2e087c, 0x697a2044, 0x788d6775,
+0x02708d01, 0xfe83fe21, 0x00d28301, 0x1675c785,
+0x087df562, 0x00862d6e, 0xf5620000, 0x6c2e087c,
+0x487a1044, 0xff484675, 0xf88348c0, 0x62bd7510,
+0x6f28fff1, 0xb8012474, 0x0000077d, 0x28fff162,
+0x04247c6f, 0x284df662, 0x02244c2c, 0x2844f362,
+0xc500e9c2, 0x66d593f8, 0x1575c2ff, 0xfff204e8,
+0xebd8f7ff, 0x0773b80c, 0x05eb0000, 0x000778b8,
+0x00c3c900, 0x00000000, 0x00000000, 0x00000000,
+0x3c000000, 0x00003c00, 0x80000000, 0x8000bc00,
+0x38003400, 0x00000000, 0x00000000, 0x00000000,
+0x00003c00, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0007140,
+};
+asm(".type avx512fp16_x86_64_D_32f2, STT_NOTYPE;");
+asm(".type avx512fp16_x86_64_D_32f2, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512fp16_x86_64_D_f2[] = {
+0x0004f2e9, 0x89485500, 0x7df562e5, 0x0d0d6e08,
+0x6200000c, 0x7e087df5, 0xf562e14d, 0x4d7e087d,
+0x7df562df, 0xe04d7e08, 0x087df562, 0x62e04d6e,
+0x990875f6, 0xc766df4d, 0x4000fc45, 0x087df562,
+0xf562c87e, 0xc86e087d, 0x0000a7b8, 0x76f36200,
+0xfe45c208, 0x93fbc500, 0x0fcaffd0, 0x00049485,
+0x7df56200, 0xe04d6e08, 0x0875f662, 0x66df4d9f,
+0x00fc45c7, 0x7df562c0, 0x62c87e08, 0x6e087df5,
+0x00abb8c8, 0xf3620000, 0x4dc20876, 0xfbc500fe,
+0xcaffd193, 0x045b850f, 0xf5620000, 0x4d6e087d,
+0x75f662e0, 0xdf4d9b08, 0xfc45c766, 0xf5620000,
+0xc87e087d, 0x087df562, 0xafb8c86e, 0x62000000,
+0xc20876f3, 0xc500fe55, 0xffd293fb, 0x22850fca,
+0x62000004, 0x6e087df5, 0xf662e04d, 0x4d9d0875,
+0x45c766df, 0x628000fc, 0x7e087df5, 0x7df562c8,
+0xb8c86e08, 0x000000b3, 0x0876f362, 0x00fe5dc2,
+0xd393fbc5, 0x850fcaff, 0x000003e9, 0x087df562,
+0x62df4d6e, 0x6e087df5, 0xf562e065, 0xd4580876,
+0x087df562, 0x62e15d6e, 0x6e087df5, 0xf562e06d,
+0x557e087d, 0x55f662fe, 0xdf5d9908, 0x087df562,
+0xf562d87e, 0xd86e087d, 0x0000bbb8, 0x66f36200,
+0xfe65c208, 0x93fbc500, 0x0fcaffd4, 0x00039485,
+0x7df56200, 0xe16d6e08, 0x087df562, 0xc5e0756e,
+0x991d6ff9, 0x6200000a, 0x9f084df6, 0xe8c5df6d,
+0xf562d357, 0x557e087d, 0x7df562fe, 0x62e87e08,
+0x6e087df5, 0x00c0b8d0, 0xf3620000, 0x6dc2086e,
+0xfbc500fe, 0xcaffd593, 0x0347850f, 0xf5620000,
+0xcc5c0876, 0x087df562, 0x62e1556e, 0x6e087df5,
+0xf562e06d, 0x4d7e087d, 0x55f662fe, 0xdf559b08,
+0x087df562, 0xf562d07e, 0xd06e087d, 0x0000c5b8,
+0x6ef36200, 0xfe75c208, 0x93fbc500, 0x0fcaffd6,
+0x00030085, 0x7df56200, 0xe1756e08, 0x087df562,
+0xc5e06d6e, 0x62cb57f0, 0x9d0855f6, 0xf562df75,
+0x4d7e087d, 0x7df562fe, 0x62f07e08, 0x6e087df5,
+0x00cab8c8, 0xf3620000, 0x7dc20876, 0xfbc500fe,
+0xcaffd793, 0x02bb850f, 0xf1620000, 0x1510087e,
+0x000009dc, 0x09da058b, 0xf5620000, 0x356e087d,
+0x000009ac, 0x087df562, 0x09a42d6e, 0x45890000,
+0xc1058bf4, 0x62000009, 0x11087ef1, 0xf562fc55,
+0x757e087d, 0x7df562fe, 0xff6d7e08, 0x62f84589,
+0xd7086ef6, 0xf162ff4d, 0x4d11087e, 0x76f662fa,
+0xfa55d708, 0x087ef162, 0x098e1d10, 0xfcb80000,
+0x62000000, 0xd70866f6, 0xf362fc4d, 0xc2c20874,
+0x93fbc500, 0x03e283d0, 0x0f03fa83, 0x00023485,
+0xf0458b00, 0x00000035, 0x7df16280, 0x62f86e08,
+0xd70847f6, 0xf162fd4d, 0x5d10087e, 0x66f662fc,
+0xfd55d708, 0x087df162, 0x0035d07e, 0x62800000,
+0x6e087df1, 0x0106b8f8, 0xf3620000, 0xc9c20844,
+0x93fbc500, 0x03e283d1, 0x0f03fa83, 0x0001e485,
+0xf0458b00, 0x087df162, 0xf562e06e, 0xd06e087d,
+0x6210e8c1, 0x6e087df5, 0x76f562c8, 0x62c95908,
+0xd7085ff6, 0xf162fc7d, 0xfa7e087d, 0xf662d089,
+0xd4990875, 0x087cf562, 0x8a0fd72e, 0x0000018b,
+0x0185850f, 0xe8c10000, 0x57e8c510, 0x7df562d2,
+0x62c86e08, 0x2e087cf5, 0x738a0fca, 0x0f000001,
+0x00016d85, 0x7ef16200, 0xfc4d1008, 0x0876f662,
+0xc5fd55d7, 0x62c957f0, 0x10087ef1, 0x1bb8fd5d,
+0x62000001, 0x570866f6, 0xf362fc4d, 0xd2c20874,
+0x93fbc500, 0x03e283d2, 0x0f03fa83, 0x00014485,
+0x7ef16200, 0xfc5d1008, 0x00ec45c7, 0x6200003c,
+0x6e087df5, 0x00083d25, 0x7df56200, 0x313d6e08,
+0x62000008, 0x7e087df5, 0xf162ff65, 0x6510087e,
+0x7df562fd, 0xfe7d7e08, 0xcc28f8c5, 0x0866f662,
+0xc5ff4d57, 0xb8d328f8, 0x00000128, 0x085ef662,
+0x62fb5557, 0xc2086cf3, 0xfbc500d9, 0xe283d393,
+0x03fa8303, 0x00db850f, 0xf5620000, 0x556e087d,
+0x6ef562f8, 0xfc7d5808, 0x087df562, 0xf562f87e,
+0x7d6e087d, 0xc0b70ff9, 0x0846f562, 0x62fd6558,
+0x7e087df5, 0x10e2c1e2, 0xf162d009, 0xf86e087d,
+0x0846f662, 0x62fd4dd7, 0x10087ef1, 0xf662fe7d,
+0x65d70846, 0x66f662fd, 0xfd655708, 0x085cf362,
+0xc500e1c2, 0x83d493fb, 0x32b803e2, 0x83000001,
+0x717503fa, 0x086ef562, 0x62f9555c, 0x7e087df5,
+0xf162fe75, 0xd87e087d, 0x087df562, 0x35ff6d7e,
+0x80000000, 0x087df162, 0xf662c86e, 0x4d570866,
+0x7df162ff, 0x62c87e08, 0x2e087cf5, 0x752a7ad1,
+0x10e8c128, 0x087df562, 0xf562f06e, 0xd62e087c,
+0x00b81e7a, 0x74000000, 0xb815eb1c, 0x00000110,
+0x11b813eb, 0xeb000001, 0x013ab80c, 0x05eb0000,
+0x00013bb8, 0x55c35d00, 0x48e58948, 0x48c0e483,
+0x00c0ec81, 0xf5620000, 0x0d6e087d, 0x00000710,
+0x087df562, 0x39244c7e, 0x087df562, 0x3a244c7e,
+0x087df562, 0x3b244c7e, 0x24448b66, 0x44896672,
+0xf5626c24, 0x7c6e087d, 0xf5623624, 0x546e087d,
+0x39b83924, 0x62000005, 0x7e087df5, 0x625c247c,
+0xc2086ef3, 0x005c2444, 0xd093fbc5, 0x850fcaff,
+0x00000693, 0x087df562, 0x3624646e, 0x085ef562,
+0x39245458, 0x087df562, 0x3724547e, 0x087df562,
+0x3924546e, 0x087df562, 0x37246c6e, 0x086ef562,
+0xf562d258, 0x6c7e087d, 0xf5625c24, 0xd07e087d,
+0x087df562, 0x3fb8d06e, 0x62000005, 0xc2086ef3,
+0x005c244c, 0xd193fbc5, 0x850fcaff, 0x00000637,
+0x087df562, 0x3724746e, 0x084ef562, 0x3924545c,
+0x087df562, 0x8b24147e, 0x89662404, 0x00862484,
+0x89660000, 0x666e2444, 0x70244489, 0x087df562,
+0x36247c6e, 0x087df562, 0x3824546e, 0x000544b8,
+0x7df56200, 0x247c7e08, 0x6ef3625c, 0x2454c208,
+0xfbc5005c, 0xcaffd293, 0x05d9850f, 0xf5620000,
+0x646e087d, 0xf5623624, 0x5459085e, 0xf5623924,
+0x547e087d, 0xf5623624, 0x546e087d, 0xf5623a24,
+0xd259086e, 0x087df562, 0x3724547e, 0x087df562,
+0x39246c6e, 0x0856f562, 0x3a245458, 0x087df562,
+0x3824547e, 0x087df562, 0x39245c6e, 0x087df562,
+0x3624746e, 0x0866f562, 0x3a24545c, 0x084ef562,
+0x3724645c, 0x086ef562, 0x38245459, 0x087df562,
+0x5c24647e, 0x087df562, 0xf562d07e, 0x547e087d,
+0xf5623824, 0xd06e087d, 0x00055bb8, 0x6ef36200,
+0x245cc208, 0xfbc5005c, 0xcaffd393, 0x0535850f,
+0xf5620000, 0x5c590866, 0xf5623b24, 0x5c7e087d,
+0xf5623624, 0x7c6e087d, 0xf5623924, 0x646e087d,
+0xf5623624, 0x545e0846, 0xf5623b24, 0x647e087d,
+0xf5625c24, 0xd07e087d, 0x087df562, 0x3724547e,
+0x087df562, 0x64b8d06e, 0x62000005, 0xc2086ef3,
+0x005c2464, 0xd493fbc5, 0x850fcaff, 0x000004d7,
+0x087df562, 0x3b246c6e, 0x087df562, 0x3924746e,
+0x1d6ff9c5, 0x000004d8, 0xd357d0c5, 0x086ef562,
+0x36245459, 0x087df562, 0x5c24547e, 0xd357c8c5,
+0x087df562, 0xf562d07e, 0xd06e087d, 0x000567b8,
+0x6ef36200, 0x246cc208, 0xfbc5005c, 0xcaffd593,
+0x0481850f, 0xf5620000, 0x442c087e, 0x84893924,
+0x0000b824, 0x6ef56200, 0x24542a08, 0x7df5622e,
+0x24547e08, 0x7df56236, 0x246c6e08, 0x7df56236,
+0x24546e08, 0x056eb839, 0xf5620000, 0x6c7e087d,
+0xf3625c24, 0x74c2086e, 0xc5005c24, 0xffd693fb,
+0x30850fca, 0x62000004, 0x4d086df6, 0x62392454,
+0x7e087df5, 0x62362454, 0x4d086df6, 0x62362454,
+0x2c087ef5, 0x248489c2, 0x000000b8, 0x086ef562,
+0x2e24542a, 0x087df562, 0x5c24547e, 0x087df562,
+0x3924546e, 0x087df562, 0xf562d07e, 0xd86e087d,
+0x000575b8, 0x66f36200, 0x247cc208, 0xfbc5005c,
+0xcaffd793, 0x03cd850f, 0xf5620000, 0xd259086e,
+0x087df562, 0x3624547e, 0x086df662, 0x3624544f,
+0x087df562, 0x3724547e, 0x086df662, 0x3724544d,
+0x087ef562, 0x8489c22c, 0x0000b824, 0x6ef56200,
+0x24542a08, 0x057cb82e, 0xf5620000, 0x547e087d,
+0xf5625c24, 0x546e087d, 0xf3623924, 0x44c2086e,
+0xc5005c24, 0xffd093fb, 0x68850fca, 0x62000003,
+0x2c087ef5, 0x89372444, 0x00b82484, 0xf5620000,
+0x542a086e, 0xf5622e24, 0x547e087d, 0xf6623c24,
+0x544d086d, 0xf5623924, 0xc22c087e, 0xb8248489,
+0x62000000, 0x2a086ef5, 0x622e2454, 0x7e087df5,
+0x7df562d0, 0xb8d06e08, 0x0000057e, 0x086ef362,
+0x3c244cc2, 0x93fbc500, 0x0fcaffd1, 0x00030685,
+0xfef56200, 0x24442c08, 0x84894839, 0x0000b824,
+0xeef56200, 0x24542a08, 0x7df56217, 0x24547e08,
+0x7df56236, 0x24746e08, 0x7df56236, 0x24546e08,
+0x0588b839, 0xf5620000, 0x747e087d, 0xf3625c24,
+0x54c2086e, 0xc5005c24, 0xffd293fb, 0xb4850fca,
+0x62000002, 0x79087ef5, 0x89392444, 0x00b82484,
+0xf5620000, 0x547b086e, 0xf5622e24, 0x547e087d,
+0xf5623624, 0x7c6e087d, 0xf5623624, 0x546e087d,
+0x8fb83924, 0x62000005, 0x7e087df5, 0x625c247c,
+0xc2086ef3, 0x005c245c, 0xd393fbc5, 0x850fcaff,
+0x00000263, 0x08fef562, 0x39244479, 0x24848948,
+0x000000b8, 0x08eef562, 0x1724547b, 0x087df562,
+0x3624547e, 0x087df562, 0x3924546e, 0x087df562,
+0x3624646e, 0x087df562, 0xf562d07e, 0x647e087d,
+0xf5625c24, 0xd86e087d, 0x000596b8, 0x66f36200,
+0x2464c208, 0xfbc5005c, 0xcaffd493, 0x0205850f,
+0xf5620000, 0xd259086e, 0x087df562, 0x3624547e,
+0x086ef562, 0x36245451, 0x087df562, 0x5c24547e,
+0x087df562, 0x3924546e, 0x087df562, 0xf562d07e,
+0xd86e087d, 0x00059cb8, 0x66f36200, 0x246cc208,
+0xfbc5005c, 0xcaffd593, 0x01b9850f, 0xf5620000,
+0xd25e0876, 0x087df562, 0x37244c7e, 0x087df562,
+0x3624547e, 0x087df562, 0x3724746e, 0x086cf362,
+0x3624540a, 0x7df5620b, 0x62d07e08, 0x7e087df5,
+0x62382454, 0x7e087df5, 0x625c2474, 0x6e087df5,
+0x05a4b8d0, 0xf3620000, 0x74c2086e, 0xc5005c24,
+0xffd693fb, 0x5c850fca, 0x62000001, 0x6e087df5,
+0x623b2454, 0x59086ef5, 0x6239245c, 0x59086ef5,
+0x623a2454, 0x7e087df5, 0x6236245c, 0x7e087df5,
+0x62372454, 0x6e087df5, 0x6236247c, 0x5f0846f5,
+0x62372454, 0x7e087df5, 0x62382454, 0x6e087df5,
+0x62362464, 0x5d085ef5, 0x62372454, 0x7e087df5,
+0x62372454, 0x6e087df5, 0x6637246c, 0x7224548b,
+0x0856f562, 0x38245458, 0x24948966, 0x000000b4,
+0x087df562, 0x5a24746e, 0x086ef562, 0x3b245459,
+0x087df562, 0x5c24547e, 0x084ef562, 0x3a245458,
+0x087df562, 0xf562d07e, 0xd06e087d, 0x00063db8,
+0x6ef36200, 0x247cc208, 0xfbc5005c, 0xc9ffcf93,
+0x00a1850f, 0x89660000, 0x626e2454, 0x27086cf3,
+0x00392454, 0x087df562, 0x3624547e, 0x086df662,
+0x39245443, 0x087df562, 0x3724547e, 0xd257e8c5,
+0x087cf562, 0x3724542e, 0x5f75617a, 0x087cf562,
+0x36244c2e, 0x5a755c7a, 0x087df562, 0x3924646e,
+0x087df562, 0x36244c6e, 0x0875f662, 0x37244c2d,
+0x087df562, 0xf562c87e, 0x4c7e087d, 0xf5623824,
+0x647e087d, 0xf5625c24, 0xc86e087d, 0x00077db8,
+0x76f36200, 0x2444c208, 0xfbc5005c, 0xcaffd093,
+0x1ee81575, 0xf7fffff4, 0xb80cebd8, 0x00000773,
+0x78b805eb, 0xc9000007, 0x000000c3, 0x00000000,
+0x3c000000, 0x00003c00, 0x00000000, 0x00000000,
+0x00008000, 0x00000000, 0x00000000, 0x00000000,
+0x40003c00, 0x3c004000, 0x3c003c00, 0xc000bc00,
+0006060,
+};
+asm(".type avx512fp16_x86_64_D_f2, STT_NOTYPE;");
+asm(".type avx512fp16_x86_64_D_f2, STT_FUNC;");
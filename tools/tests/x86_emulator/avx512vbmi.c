@@ -0,0 +1 @@
+simd.c
\ No newline at end of file
@@ -0,0 +1,361 @@
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512vbmi2_vpclmulqdq_x86_32_D_64[] = {
+0xb85500eb, 0x00000001, 0xc9eff1c5, 0x5657e589,
+0xc0e48353, 0x0240ec81, 0xf1620000, 0x4c7f48fd,
+0x84880224, 0x00008004, 0xf8834000, 0xc7f37540,
+0x043c2444, 0x62000000, 0x6f48fdf1, 0x6202247c,
+0x7f48fdf1, 0xc501247c, 0x62e4efd9, 0x7f48fdf1,
+0x62032464, 0x6f48fdf1, 0x62012474, 0x44484df3,
+0x0003244c, 0x48f5f362, 0x0324441f, 0x93f8c500,
+0x0fc0fec0, 0x00033585, 0x31c03100, 0x2484c7d2,
+0x000000c0, 0x00000001, 0xdb31c931, 0xc4248489,
+0xc7000000, 0x00d02484, 0x00010000, 0x94890000,
+0x0000d424, 0x2484c700, 0x000000e0, 0x00000001,
+0xe4248c89, 0xc7000000, 0x00f02484, 0x00010000,
+0x9c890000, 0x0000f424, 0xfdf16200, 0x246c6f48,
+0x55f36203, 0x244c4448, 0xf1620001, 0x4c7f48fd,
+0xf3620424, 0x4c444855, 0xc4100124, 0xca1679e3,
+0xfdf16201, 0x244c7f48, 0x24948905, 0x0000010c,
+0x087df162, 0x42244c7e, 0x08fef162, 0x2a244c7e,
+0x08fdf162, 0x23244cd6, 0x08fef162, 0x2c244c7e,
+0x08fdf162, 0x25244cd6, 0x08fef162, 0x2e244c7e,
+0x08fdf162, 0x27244cd6, 0x48fdf162, 0x01244c6f,
+0x48f5f362, 0x04245c1f, 0x93f8c500, 0x0fc0fec3,
+0x00026085, 0x75f36200, 0x24544448, 0xf3621001,
+0x5c444875, 0x62010124, 0x1f48edf3, 0xf8c500e3,
+0xc0fec493, 0x0242850f, 0xf3620000, 0x6c444875,
+0x62000124, 0x7f48fdf1, 0x6204246c, 0x444875f3,
+0x1101244c, 0x48fdf162, 0x05244c7f, 0x302444c7,
+0x00ff00ff, 0xdb31c931, 0x342444c7, 0x00ff00ff,
+0xe1c4d231, 0x244c90f8, 0x55f36230, 0x08f50fc9,
+0x90f8e1c4, 0x6230244c, 0x0fc975f3, 0x8c8908f9,
+0x00020024, 0x3ff98300, 0x04249c89, 0x77000002,
+0xfdf16226, 0x62dd6f48, 0x6f48fdf1, 0xcdf262d1,
+0x245c7358, 0xc5f26240, 0x24547358, 0xfdf16240,
+0x245c7f48, 0xc73eeb06, 0xff302444, 0x8d00ff00,
+0x44c71204, 0x00ff3424, 0xe88300ff, 0xf8e1c440,
+0x30245490, 0xca75f362, 0x6208d10f, 0x6e087df1,
+0xcdf162e0, 0x62dcd348, 0xd348edf1, 0xfdf162d4,
+0x245c7f48, 0xe5f36206, 0x246c1f48, 0xf8c50004,
+0xc0fec593, 0x48fdf162, 0x0724547f, 0x0108850f,
+0xf3620000, 0x741f48ed, 0xc5000524, 0xfec693f8,
+0xfa850fc0, 0x62000000, 0x6e087df1, 0xfdf162d2,
+0x24646f48, 0x62c03101, 0xd348ddf1, 0xfdf162d2,
+0x24547f48, 0xc4b48b03, 0x000000c0, 0xe683ff31,
+0x24748901, 0xc4b48b30, 0x00000180, 0x8503e683,
+0xc1850fff, 0x39000000, 0x0f302474, 0x0000b785,
+0xc4bc8b00, 0x000000c8, 0xc0c4b48b, 0x83000001,
+0x7c8901e7, 0xff313024, 0x8503e683, 0x9c850fff,
+0x39000000, 0x0f302474, 0x00009285, 0x02c08300,
+0x7508f883, 0xfdf162a0, 0x24646f48, 0x5df36204,
+0x08d40fc9, 0x48fdf162, 0x0824547f, 0x48fdf162,
+0x0424646f, 0x48ddf362, 0x08245473, 0xfdf16202,
+0x24547f48, 0xfdf16204, 0x245c6f48, 0x65f36205,
+0x08d30fc9, 0x48fdf162, 0x0824547f, 0x48fdf162,
+0x0524646f, 0x48ddf362, 0x08245473, 0xc1834202,
+0x83c88902, 0x803400d3, 0xf162d809, 0x547f48fd,
+0x850f0524, 0xfffffe66, 0x81b81ceb, 0xeb000000,
+0x0082b850, 0x49eb0000, 0x000088b8, 0xb842eb00,
+0x00000089, 0x4cff3beb, 0xf2623c24, 0x0d5948fd,
+0x001003d0, 0x48f5f162, 0x01244cd4, 0x48fdf162,
+0x01244c7f, 0xfc9d850f, 0xc031ffff, 0x56b813eb,
+0xeb000000, 0x0064b80c, 0x05eb0000, 0x000073b8,
+0xf4658d00, 0x5d5f5e5b, 0x000000c3, 0x00000000,
+0x40404040, 0x40404040,
+0001730,
+};
+asm(".type avx512vbmi2_vpclmulqdq_x86_32_D_64, STT_NOTYPE;");
+asm(".type avx512vbmi2_vpclmulqdq_x86_32_D_64, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512vbmi2_vpclmulqdq_x86_32_D_16[] = {
+0x83e58955, 0x02e8f0e4, 0xc9000000, 0x01b955c3,
+0x62000000, 0xef08f5f1, 0x57e589c9, 0xec815356,
+0x0000008c, 0x08fdf162, 0xff988d7f, 0x4c88ffff,
+0x8341980d, 0xf67510f9, 0x08fdf162, 0xff98bd6f,
+0xf162ffff, 0xbd7f08fd, 0xffffff88, 0x08cdf162,
+0xf162f6ef, 0xb57f08fd, 0xffffffa8, 0x08fdf162,
+0xff88ad6f, 0xf362ffff, 0x8d440855, 0xffffffa8,
+0xf5f36200, 0xa8851f08, 0x00ffffff, 0xc093f8c5,
+0x850f033c, 0x0000026f, 0x01a845c7, 0x31000000,
+0xac4589c0, 0x08fdf162, 0xffa8bd6f, 0xf362ffff,
+0x8d440845, 0xffffff88, 0xfdf16200, 0xb88d7f08,
+0x62ffffff, 0x440845f3, 0xffff888d, 0xe3c410ff,
+0x01ca1679, 0x62c45589, 0x7e087df1, 0xf162f04d,
+0x8d6f08fd, 0xffffff88, 0x08f5f262, 0xffb89d29,
+0xf8c5ffff, 0x033cc393, 0x0210850f, 0xf3620000,
+0x95440875, 0xffffff88, 0x75f36210, 0x889d4408,
+0x01ffffff, 0x08edf362, 0xc500e31f, 0x3cc493f8,
+0xee850f03, 0x62000001, 0x440875f3, 0xffff88ad,
+0xf16200ff, 0xad7f08fd, 0xffffffb8, 0x0875f362,
+0xff888d44, 0x6211ffff, 0x7f08fdf1, 0xffffc88d,
+0x00ffb8ff, 0xf1620000, 0xffef08c5, 0xf8c5f631,
+0xff31c892, 0x0975f362, 0x6208f90f, 0x0f8955f3,
+0xdb3108f5, 0x08fdf162, 0xff68bd7f, 0x7589ffff,
+0x3ffe83d8, 0x77dc7d89, 0xfdf16226, 0x62dd6f08,
+0x6f08fdf1, 0xfdf162d1, 0x68a56f08, 0x62ffffff,
+0x7318cdf2, 0xf262fb5d, 0x557318dd, 0x8d28ebfb,
+0xe8831b04, 0x7df16240, 0xb8e06e08, 0x000000ff,
+0x08cdf162, 0xf8c5dcd3, 0xf362d092, 0xd10f8a75,
+0xedf16208, 0x62d4d308, 0x1f08e5f3, 0xffffb8ad,
+0xf8c500ff, 0x033cc593, 0x012e850f, 0xf3620000,
+0xb51f08ed, 0xffffffc8, 0x93f8c500, 0x0f033cc6,
+0x00011e85, 0x7df16200, 0x62e36e08, 0x6f08fdf1,
+0xffff88bd, 0xc5f162ff, 0x31e4d308, 0x7df162d2,
+0x83e07e08, 0x458901e0, 0x7df16280, 0x83d87e08,
+0xd28503e0, 0x00f0850f, 0x45390000, 0xe7850f80,
+0x62000000, 0x17087cf1, 0x458bf065, 0x83d23180,
+0x458901e0, 0x7df16280, 0x83d07e08, 0xd28503e0,
+0x00cb850f, 0x45390000, 0xc2850f80, 0x62000000,
+0x6f08fdf1, 0xffffb895, 0x6df362ff, 0x08da0f89,
+0x08fdf162, 0xffd89d7f, 0xf362ffff, 0x957308ed,
+0xffffffd8, 0xfdf16202, 0xb8957f08, 0x62ffffff,
+0x6f08fdf1, 0xffffc895, 0x6df362ff, 0x08da0f89,
+0x08fdf162, 0xffd89d7f, 0xf362ffff, 0x957308ed,
+0xffffffd8, 0xc6834302, 0x83f08902, 0x803400d7,
+0xf162f809, 0x957f08fd, 0xffffffc8, 0xfe9c850f,
+0xf262ffff, 0x0d5908fd, 0x00100338, 0xf5f16249,
+0x62cfd408, 0x7f08fdf1, 0xffff888d, 0x59850fff,
+0x31fffffd, 0xb82febc0, 0x00000056, 0x64b828eb,
+0xeb000000, 0x0073b821, 0x1aeb0000, 0x000081b8,
+0xb813eb00, 0x00000082, 0x88b80ceb, 0xeb000000,
+0x0089b805, 0xc4810000, 0x0000008c, 0x5d5f5e5b,
+0x000000c3, 0x00000000, 0x10101010, 0x10101010,
+0001500,
+};
+asm(".type avx512vbmi2_vpclmulqdq_x86_32_D_16, STT_NOTYPE;");
+asm(".type avx512vbmi2_vpclmulqdq_x86_32_D_16, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512vbmi2_vpclmulqdq_x86_32_D_32[] = {
+0xb85500eb, 0x00000001, 0x08f5f162, 0xe589c9ef,
+0x83535657, 0xec81e0e4, 0x00000100, 0x28fdf162,
+0x03244c7f, 0x60044488, 0x20f88340, 0x44c7f675,
+0x00083c24, 0xf1620000, 0x7c6f28fd, 0xf1620324,
+0x7c7f28fd, 0xf1620224, 0xedef08d5, 0x28fdf162,
+0x04246c7f, 0x28fdf162, 0x02247c6f, 0x2845f362,
+0x04244c44, 0xf5f36200, 0x24441f28, 0xf8c50004,
+0x0f3cc093, 0x02fd850f, 0x84c70000, 0x00008024,
+0x00000100, 0x31c03100, 0x248489d2, 0x00000084,
+0x902484c7, 0x01000000, 0x89000000, 0x00942494,
+0xf1620000, 0x6c6f28fd, 0xf3620424, 0x4c442855,
+0x62000224, 0x7f28fdf1, 0x6205244c, 0x442855f3,
+0x1002244c, 0x1679e3c4, 0xf16201ca, 0x4c7f28fd,
+0x94890624, 0x0000ac24, 0x7df16200, 0x244c7e08,
+0xfef1622a, 0x244c7e08, 0xfdf1621a, 0x244cd608,
+0xfdf16217, 0x244c6f28, 0xf5f36202, 0x245c1f28,
+0xf8c50005, 0x0f3cc393, 0x0270850f, 0xf3620000,
+0x54442875, 0x62100224, 0x442875f3, 0x0102245c,
+0x28edf362, 0xc500e31f, 0x3cc493f8, 0x52850f0f,
+0x62000002, 0x442875f3, 0x0002246c, 0x28fdf162,
+0x05246c7f, 0x2875f362, 0x02244c44, 0xfdf16211,
+0x244c7f28, 0x00ffb806, 0xf16200ff, 0xf6ef08cd,
+0xfbc5f631, 0xff31c892, 0x2975f362, 0x6208f10f,
+0x0fa955f3, 0xc03108fd, 0x28fdf162, 0x8924347f,
+0x00e024b4, 0xfe830000, 0x24bc893f, 0x000000e4,
+0xf1622577, 0xdd6f28fd, 0x28fdf162, 0xf162d16f,
+0x346f28fd, 0xc5f26224, 0x245c7338, 0xcdf2621c,
+0x24547338, 0x8d28eb1c, 0xffbb0014, 0x8300ff00,
+0xfbc540ea, 0xf362d392, 0xd10faa75, 0x7df16208,
+0x62e26e08, 0xd328c5f1, 0xedf162dc, 0x62d4d328,
+0x1f28e5f3, 0x0005246c, 0xd593f8c5, 0x0f0ffa80,
+0x00019785, 0xedf36200, 0x24741f28, 0xf8c50006,
+0xfa80d693, 0x88850f0f, 0x31000001, 0x7df162db,
+0x62e06e08, 0x6f28fdf1, 0x62022474, 0xd328cdf1,
+0x7df162e4, 0x83d97e08, 0xf16203e1, 0xe27e087d,
+0x8501e283, 0xfdf162db, 0x24647f08, 0x57850f02,
+0x39000001, 0x4f850fca, 0x62000001, 0x17087cf1,
+0x8b042464, 0x31202454, 0x7df162db, 0x83d17e08,
+0xe28303e1, 0x0fdb8501, 0x00013485, 0x0fca3900,
+0x00012c85, 0xfdf36200, 0x01db3928, 0x287df362,
+0x6201e639, 0x3928fdf3, 0xf16201e4, 0xda7e087d,
+0x6203e283, 0x7e087df1, 0x01e183e1, 0x850fdb85,
+0x000000f6, 0x850fd139, 0x000000ee, 0x28fdf362,
+0x6201d239, 0x17087cf1, 0x8b042474, 0x8320244c,
+0xf16201e1, 0xd27e087d, 0x8503e283, 0xce850fdb,
+0x39000000, 0xc6850fd1, 0x62000000, 0x6f28fdf1,
+0x62052464, 0x0fa95df3, 0xf16208d4, 0x547f28fd,
+0xf1620724, 0x5c6f28fd, 0xf3620524, 0x547328e5,
+0x62020724, 0x7f28fdf1, 0x62052454, 0x6f28fdf1,
+0x62062464, 0x0fa95df3, 0xf16208d4, 0x547f28fd,
+0xf1620724, 0x746f28fd, 0xf3620624, 0x547328cd,
+0x40020724, 0x8902c683, 0x00d783f2, 0x0980f280,
+0xfdf162fa, 0x24547f28, 0x30850f06, 0xfffffffe,
+0x623c244c, 0x5928fdf2, 0x1003b00d, 0xf5f16200,
+0x244cd428, 0xfdf16202, 0x244c7f28, 0xd3850f02,
+0x31fffffc, 0xb82febc0, 0x00000056, 0x64b828eb,
+0xeb000000, 0x0073b821, 0x1aeb0000, 0x000081b8,
+0xb813eb00, 0x00000082, 0x88b80ceb, 0xeb000000,
+0x0089b805, 0x658d0000, 0x5f5e5bf4, 0x0000c35d,
+0x20202020, 0x20202020,
+0001670,
+};
+asm(".type avx512vbmi2_vpclmulqdq_x86_32_D_32, STT_NOTYPE;");
+asm(".type avx512vbmi2_vpclmulqdq_x86_32_D_32, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512vbmi2_vpclmulqdq_x86_64_D_64[] = {
+0xc55500eb, 0xb8c9eff1, 0x00000001, 0x48e58948,
+0x48c0e483, 0x01c8ec81, 0xf1620000, 0x8c7f48fd,
+0x00000824, 0x04448800, 0xc0ff4808, 0x40f88348,
+0xf162f375, 0xbc6f48fd, 0x00000824, 0x0004be00,
+0xf1620000, 0xbc7f48fd, 0xffffc824, 0xefc1c5ff,
+0xfdf162ff, 0x24bc7f48, 0x00000048, 0x48fdf162,
+0xc824ac6f, 0x62ffffff, 0x444855f3, 0x0048248c,
+0x62000000, 0x1f48f5f3, 0x00482484, 0xc5000000,
+0xfec093f8, 0x27850fc0, 0x48000003, 0x482444c7,
+0x00000001, 0x2444c748, 0x00000158, 0x44c74800,
+0x00016824, 0xc7480000, 0x01782444, 0x62000000,
+0x6f48fdf1, 0x004824b4, 0xf3620000, 0x8c44484d,
+0xffffc824, 0xf16200ff, 0x8c7f48fd, 0x00008824,
+0x4df36200, 0x24944448, 0xffffffc8, 0xfdf16210,
+0x24947f48, 0x000000c8, 0x24848b48, 0x000000d8,
+0x48fdf162, 0xc8248c6f, 0x62ffffff, 0x7e08fdf1,
+0x48122454, 0xa0248489, 0x48000000, 0xe824848b,
+0x48000000, 0xb0248489, 0x48000000, 0xf824848b,
+0x48000000, 0xc0248489, 0x62000000, 0x1f48f5f3,
+0x0088249c, 0xc5000000, 0xfec393f8, 0x76850fc0,
+0x62000002, 0x444875f3, 0xffc82494, 0x6210ffff,
+0x444875f3, 0xffc8249c, 0x6201ffff, 0x1f48edf3,
+0xf8c500e3, 0xc0fec493, 0x0252850f, 0xf3620000,
+0xa4444875, 0xffffc824, 0xf16200ff, 0xa47f48fd,
+0x00008824, 0x75f36200, 0x248c4448, 0xffffffc8,
+0xfdf16211, 0x248c7f48, 0x000000c8, 0x00ffb848,
+0x00ff00ff, 0xd23100ff, 0xe1c4c931, 0x62c892fb,
+0x0fc95df3, 0x736208ec, 0xc10fc975, 0x94894808,
+0x00018824, 0xfa834800, 0x6229773f, 0x6f48fdf1,
+0xfdf162dc, 0x62d16f48, 0x7358d5f2, 0x6231245c,
+0x7358bdf2, 0x62312454, 0x7f48fdf1, 0x0108249c,
+0x36eb0000, 0x62c0428d, 0x6e08fdf1, 0xffb848f0,
+0xff00ff00, 0x6200ff00, 0xd348d5f1, 0xfbe1c4de,
+0xf362d092, 0xd10fca75, 0xedf16208, 0x62d6d348,
+0x7f48fdf1, 0x0108249c, 0xf3620000, 0xac1f48e5,
+0x00008824, 0xf1620000, 0x947f48fd, 0x00014824,
+0x93f8c500, 0x0fc0fec5, 0x00011785, 0xedf36200,
+0x24b41f48, 0x000000c8, 0x93f8c500, 0x0fc0fec6,
+0x00010685, 0xfdf16200, 0x24b46f48, 0xffffffc8,
+0x087df162, 0xc031d16e, 0x48cdf162, 0xf162d2d3,
+0x947f48fd, 0x00004824, 0x448b4c00, 0x8b484804,
+0x010804bc, 0x83410000, 0xe78301e0, 0xf8394903,
+0x00cc850f, 0x8b480000, 0x4950047c, 0x8948f889,
+0x48c0247c, 0x4804bc8b, 0x41000001, 0x8301e083,
+0x394903e7, 0xae850ff8, 0x48000000, 0x4810c083,
+0x7540f883, 0xfdf162b4, 0x24b46f48, 0x00000088,
+0xc94df362, 0x6208d60f, 0x7f48fdf1, 0x01882494,
+0xf1620000, 0xb46f48fd, 0x00008824, 0xcdf36200,
+0x24947348, 0x00000188, 0xfdf16202, 0x24947f48,
+0x00000088, 0x48fdf162, 0xc8249c6f, 0x62000000,
+0x0fc965f3, 0xf16208d3, 0x947f48fd, 0x00018824,
+0xfdf16200, 0x24b46f48, 0x000000c8, 0x8348c1ff,
+0xf36202c2, 0x947348cd, 0x00018824, 0xf1620200,
+0x947f48fd, 0x0000c824, 0x40f98300, 0xfe5b850f,
+0x1cebffff, 0x000081b8, 0xb85aeb00, 0x00000082,
+0x88b853eb, 0xeb000000, 0x0089b84c, 0x45eb0000,
+0x4040b848, 0x40404040, 0xf2624040, 0xc87c48fd,
+0x48f5f162, 0xc8248cd4, 0x62ffffff, 0x7f48fdf1,
+0xffc8248c, 0xceffffff, 0xfca3850f, 0xc031ffff,
+0x56b813eb, 0xeb000000, 0x0064b80c, 0x05eb0000,
+0x000073b8, 0x00c3c900,
+0001707,
+};
+asm(".type avx512vbmi2_vpclmulqdq_x86_64_D_64, STT_NOTYPE;");
+asm(".type avx512vbmi2_vpclmulqdq_x86_64_D_64, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512vbmi2_vpclmulqdq_x86_64_D_16[] = {
+0x625500eb, 0xef08f5f1, 0x0001b8c9, 0x89480000,
+0xfdf162e5, 0xfb4d7f08, 0xb0054488, 0x48c0ff48,
+0x7510f883, 0xfdf162f3, 0xfb7d6f08, 0x000010bf,
+0xfdf16200, 0xfa7d7f08, 0x08c5f162, 0xf162ffef,
+0x7d7f08fd, 0xfdf162fc, 0xfa756f08, 0x084df362,
+0x00fc4d44, 0x08f5f362, 0x00fc451f, 0xc093f8c5,
+0x850f033c, 0x000001df, 0xc045c748, 0x00000001,
+0x08fdf162, 0x62fc4d6f, 0x440875f3, 0x6200fa55,
+0x7f08fdf1, 0xf362fd55, 0x4d440875, 0xf16210fa,
+0x556f08fd, 0xfdf162fa, 0xfb4d7e08, 0x08edf262,
+0xc5fd5d29, 0x3cc393f8, 0x9f850f03, 0x62000001,
+0x44086df3, 0x6210fa4d, 0x44086df3, 0x6201fa5d,
+0x1f08f5f3, 0xf8c500e3, 0x033cc493, 0x0183850f,
+0xf3620000, 0x6d44086d, 0xf16200fa, 0x6d7f08fd,
+0x6df362fd, 0xfa554408, 0xfdf16211, 0xfe557f08,
+0x0000ffb8, 0x31c93100, 0x92f8c5f6, 0x55f362c8,
+0x08f50f89, 0x896d7362, 0x4808c20f, 0x48f04d89,
+0x773ff983, 0xfdf1621c, 0x62dd6f08, 0x6f08fdf1,
+0xcdf262ca, 0xfe5d7318, 0x18bdf262, 0xebfe4d73,
+0xc0418d25, 0x08fdf162, 0xffb8e06e, 0xc5000000,
+0x62d092f8, 0x0f8a6df3, 0xf16208ca, 0xdcd308cd,
+0x08f5f162, 0xf362ccd3, 0x6d1f08e5, 0xf8c500fd,
+0x033cc593, 0x00f2850f, 0xf3620000, 0x751f08f5,
+0xf8c500fe, 0x033cc693, 0x00e5850f, 0x71620000,
+0x4d6f08fd, 0x7df162fa, 0x62e66e08, 0x7e08fdf1,
+0x03e083d8, 0x08b5f162, 0xf162e4d3, 0xe27e08fd,
+0x4801e283, 0x850fc239, 0x000000be, 0x16f9e3c4,
+0xf16201e2, 0xc87e08fd, 0x8301e283, 0x394803e0,
+0xaa850fc2, 0x62000000, 0x6f08fdf1, 0xf362fd4d,
+0xd90f8975, 0xfdf16208, 0xff5d7f08, 0x08f5f362,
+0x02ff4d73, 0x08fdf162, 0x62fd4d7f, 0x6f08fdf1,
+0xf362fe4d, 0xd90f8975, 0xfdf16208, 0xff5d7f08,
+0x08f5f362, 0x02ff4d73, 0x8348c6ff, 0xf16202c1,
+0x4d7f08fd, 0x40fe83fe, 0xfeed850f, 0xb848ffff,
+0x10101010, 0x10101010, 0x08fdf262, 0xd162c87c,
+0xc9d408f5, 0x08fdf162, 0xfffa4d7f, 0xfb850fcf,
+0x31fffffd, 0xb82febc0, 0x00000056, 0x64b828eb,
+0xeb000000, 0x0073b821, 0x1aeb0000, 0x000081b8,
+0xb813eb00, 0x00000082, 0x88b80ceb, 0xeb000000,
+0x0089b805, 0xc35d0000,
+0001170,
+};
+asm(".type avx512vbmi2_vpclmulqdq_x86_64_D_16, STT_NOTYPE;");
+asm(".type avx512vbmi2_vpclmulqdq_x86_64_D_16, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512vbmi2_vpclmulqdq_x86_64_D_32[] = {
+0x625500eb, 0xef08f5f1, 0x0001b8c9, 0x89480000,
+0xe48348e5, 0xec8348e0, 0xfdf16248, 0x248c7f28,
+0xffffffa8, 0xa8044488, 0x48c0ff48, 0x7520f883,
+0xfdf162f3, 0x24b46f28, 0xffffffa8, 0x000008be,
+0xb5516200, 0x62c9ef08, 0x7f28fdf1, 0xff8824b4,
+0x7162ffff, 0x8c7f28fd, 0xffffc824, 0xfdf162ff,
+0x24b46f28, 0xffffff88, 0x284df362, 0xc8248c44,
+0x00ffffff, 0x28f5f362, 0xc824841f, 0x00ffffff,
+0xc093f8c5, 0x850f0f3c, 0x000002b8, 0x2444c748,
+0x000001c8, 0x44c74800, 0x0001d824, 0xf1620000,
+0xbc6f28fd, 0xffffc824, 0x45f362ff, 0x248c4428,
+0xffffff88, 0xfdf16200, 0x248c7f28, 0xffffffe8,
+0x2845f362, 0x88248c44, 0x10ffffff, 0x28fdf162,
+0x08248c7f, 0x48000000, 0x1824448b, 0x28fdf162,
+0x8824946f, 0x62ffffff, 0x7e08fdf1, 0x48fe244c,
+0x62240489, 0x2928edf2, 0xffe8249c, 0xf8c5ffff,
+0x0f3cc393, 0x0241850f, 0xf3620000, 0x8c44286d,
+0xffff8824, 0xf36210ff, 0x9c44286d, 0xffff8824,
+0xf36201ff, 0xe31f28f5, 0x93f8c500, 0x0f0f3cc4,
+0x00021d85, 0x6df36200, 0x24bc4428, 0xffffff88,
+0xfdf16200, 0x24bc7f28, 0xffffffe8, 0x286df362,
+0x88249444, 0x11ffffff, 0x28fdf162, 0x0824947f,
+0xb8000000, 0x00ff00ff, 0xff31c931, 0xc892fbc5,
+0xa9457362, 0x6208c70f, 0x0fa96d73, 0x894808d2,
+0x4828244c, 0x773ff983, 0xfdf1621e, 0x62df6f28,
+0x6f28fdf1, 0xbdf262ca, 0x245c7338, 0xadf26205,
+0x244c7338, 0x8d25eb05, 0xf162c041, 0xe06e08fd,
+0xff00ffb8, 0x92fbc500, 0x6df362d0, 0x08ca0faa,
+0x28bdf162, 0xf162dcd3, 0xccd328f5, 0x28e5f362,
+0xe824ac1f, 0x00ffffff, 0xc593f8c5, 0x850f0f3c,
+0x00000175, 0x28f5f362, 0x0824b41f, 0x00000000,
+0xc693f8c5, 0x850f0f3c, 0x00000164, 0x28fdf162,
+0x8824ac6f, 0x62ffffff, 0x6e087df1, 0xfdf162e7,
+0x83d87e08, 0xf16203e0, 0xe4d328d5, 0x08fdf162,
+0xe283e27e, 0xc2394801, 0x0139850f, 0xe3c40000,
+0x01e016f9, 0x08fdf162, 0xe083ca7e, 0x03e28301,
+0x0fd03948, 0x00012585, 0xfdf36200, 0x01e63928,
+0x287df362, 0x6201e539, 0x3928fdf3, 0xf16201dc,
+0xf27e08fd, 0x08fdf162, 0xe283e07e, 0x03e08301,
+0x0fc23948, 0x0000ee85, 0xf9e3c400, 0x6201ea16,
+0x3928fdf3, 0xe28301cd, 0xfdf16201, 0x83e87e08,
+0x394803e0, 0xd3850fc2, 0x62000000, 0x6f28fdf1,
+0xffe8248c, 0xf362ffff, 0xd90fa975, 0xfdf16208,
+0x249c7f28, 0x00000028, 0x28f5f362, 0x28248c73,
+0x02000000, 0x28fdf162, 0xe8248c7f, 0x62ffffff,
+0x6f28fdf1, 0x0008248c, 0xf3620000, 0xd90fa975,
+0xfdf16208, 0x249c7f28, 0x00000028, 0x28f5f362,
+0x28248c73, 0x02000000, 0x8348c7ff, 0xf16202c1,
+0x8c7f28fd, 0x00000824, 0x40ff8300, 0xfe6c850f,
+0xb848ffff, 0x20202020, 0x20202020, 0x28fdf262,
+0xf162c87c, 0x8cd428f5, 0xffff8824, 0xfdf162ff,
+0x248c7f28, 0xffffff88, 0x850fceff, 0xfffffd12,
+0x2febc031, 0x000056b8, 0xb828eb00, 0x00000064,
+0x73b821eb, 0xeb000000, 0x0081b81a, 0x13eb0000,
+0x000082b8, 0xb80ceb00, 0x00000088, 0x89b805eb,
+0xc9000000, 0x000000c3,
+0001565,
+};
+asm(".type avx512vbmi2_vpclmulqdq_x86_64_D_32, STT_NOTYPE;");
+asm(".type avx512vbmi2_vpclmulqdq_x86_64_D_32, STT_FUNC;");
@@ -0,0 +1 @@
+simd-fma.c
\ No newline at end of file
@@ -0,0 +1,485 @@
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) fma_x86_32_D_16f4[] = {
+0x83e58955, 0x02e8f0e4, 0xc9000000, 0xe8d955c3,
+0xec83e589, 0xc855d938, 0x026805d9, 0x55d90010,
+0xd9c9d9d8, 0x05d9e855, 0x00100230, 0xd9cc55d9,
+0x10026405, 0xdc55d900, 0x55d9cad9, 0xd9cad9ec,
+0x5dd9d05d, 0xf055d9e0, 0x5dd9c9d9, 0xe455d9d4,
+0xc5f45dd9, 0xd84d28f8, 0xdb76e1c5, 0x0000a7b8,
+0x28f8c500, 0x71e2c4d1, 0xc5c85598, 0x4015c2e8,
+0x00001002, 0x0e79e2c4, 0xa8830fd3, 0xc5000001,
+0xb8d128f8, 0x000000ab, 0x9e71e2c4, 0xe8c5c855,
+0x025015c2, 0xc4000010, 0xd30e79e2, 0x0185830f,
+0xf8c50000, 0xafb8d128, 0xc4000000, 0x559a71e2,
+0xc2e8c5c8, 0x10026015, 0xe2c40000, 0x0fd30e79,
+0x00016283, 0x28f8c500, 0x00b3b8d1, 0xe2c40000,
+0xc8559c71, 0x15c2e8c5, 0x00100270, 0x79e2c400,
+0x830fd30e, 0x0000013f, 0x5528f8c5, 0x58e8c5c8,
+0x28f8c5e9, 0xbbb8d87d, 0xc5000000, 0xc4e228f8,
+0x659841e2, 0xc2d0c5e8, 0xe2c400e4, 0x0fe30e79,
+0x00011283, 0x79e2c400, 0x02702518, 0xc0b80010,
+0xc5000000, 0xc5f228f8, 0xd87d28f8, 0xec57d0c5,
+0x9e41e2c4, 0xd0c5e875, 0xc400eec2, 0xeb0e79e2,
+0x00e1830f, 0xe8c50000, 0xf8c5c95c, 0xb8d87d28,
+0x000000c5, 0xea28f8c5, 0x9a41e2c4, 0xf0c5e86d,
+0xc400edc2, 0xeb0e79e2, 0x00b9830f, 0xf8c50000,
+0xc5d87d28, 0xb8cc57f0, 0x000000ca, 0xea28f8c5,
+0x9c41e2c4, 0xf0c5e86d, 0xc400cdc2, 0xcb0e79e2,
+0x0091830f, 0xe8c50000, 0xc5d84d59, 0xe86557d8,
+0x6dd0f3c5, 0xd0f3c5e8, 0x28f8c5cc, 0xd4b8d865,
+0xc5000000, 0xc4f228f8, 0x75a659e2, 0xc2d0c5e8,
+0xe2c400ee, 0x73eb0e79, 0x69e2c45e, 0xc5e865a7,
+0x00e4c2f0, 0x0000d8b8, 0x79e2c400, 0x4773e30e,
+0x5d59e8c5, 0xd0e3c5d8, 0xf8c5e85d, 0xb8e86d28,
+0x000000de, 0xe228f8c5, 0x9651e2c4, 0xe0c5d865,
+0xc500dcc2, 0xc4e476d9, 0xdc0e79e2, 0xe2c41973,
+0xd8559751, 0xcac2f0c5, 0x00e2b800, 0xe2c40000,
+0x73cc0e79, 0xc9c03102, 0x000000c3, 0x00000000,
+0x40000000, 0x00000000, 0x00000000, 0x00000000,
+0x41000000, 0x41100000, 0x41000000, 0x40a00000,
+0xc1000000, 0xc1100000, 0xc1000000, 0xc0a00000,
+0x00000000, 0x40400000, 0x40800000, 0x40400000,
+0x80000000, 0xc0400000, 0xc0800000, 0xc0400000,
+0001200,
+};
+asm(".type fma_x86_32_D_16f4, STT_NOTYPE;");
+asm(".type fma_x86_32_D_16f4, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) fma_x86_32_D_16f8[] = {
+0x83e58955, 0x02e8f0e4, 0xc9000000, 0xe8d955c3,
+0xec83e589, 0xc855dd38, 0x021005d9, 0x55dd0010,
+0xddc9d9d8, 0xc9d9e855, 0xddd05ddd, 0x5ddde055,
+0x76e1c5f0, 0x28f9c5db, 0xa7b8d84d, 0xc5000000,
+0xc4d128f9, 0x5598f1e2, 0xc2e9c5c8, 0x10022015,
+0xe2c40000, 0x0fd30f79, 0x0001a783, 0x00abb800,
+0xf9c50000, 0xe2c4d128, 0xc8559ef1, 0x15c2e9c5,
+0x00100230, 0x79e2c400, 0x830fd30f, 0x00000184,
+0x0000afb8, 0x28f9c500, 0xf1e2c4d1, 0xc5c8559a,
+0x4015c2e9, 0x00001002, 0x0f79e2c4, 0x61830fd3,
+0xb8000001, 0x000000b3, 0xd128f9c5, 0x9cf1e2c4,
+0xe9c5c855, 0x025015c2, 0xc4000010, 0xd30f79e2,
+0x013e830f, 0xf9c50000, 0xc5c85528, 0xb8e958e9,
+0x000000bb, 0xe228f9c5, 0x7d28f9c5, 0xc1e2c4d8,
+0xc5e86598, 0x00e4c2d1, 0x0f79e2c4, 0x11830fe3,
+0xc5000001, 0x502512fb, 0xc5001002, 0xc5f228f9,
+0xd87d28f9, 0xec57d1c5, 0x9ec1e2c4, 0xc0b8e875,
+0xc5000000, 0x00eec2d1, 0x0f79e2c4, 0xe1830feb,
+0xc5000000, 0xb8c95ce9, 0x000000c5, 0xea28f9c5,
+0x7d28f9c5, 0xc1e2c4d8, 0xc5e86d9a, 0x00edc2f1,
+0x0f79e2c4, 0xb9830feb, 0xb8000000, 0x000000ca,
+0xea28f9c5, 0x7d28f9c5, 0x57f1c5d8, 0xc1e2c4cc,
+0xc5e86d9c, 0x00cdc2f1, 0x0f79e2c4, 0x91830fcb,
+0xc5000000, 0xd84d59e9, 0x6557d9c5, 0xd0f1c5e8,
+0xf1c5e86d, 0xd4b8ccd0, 0xc5000000, 0xd86528f9,
+0xf228f9c5, 0xa6d9e2c4, 0xd1c5e875, 0xc400eec2,
+0xeb0f79e2, 0xd8b85e73, 0xc4000000, 0x65a7e9e2,
+0xc2f1c5e8, 0xe2c400e4, 0x73e30f79, 0x59e9c547,
+0xe1c5d85d, 0xb8e85dd0, 0x000000de, 0x6d28f9c5,
+0x28f9c5e8, 0xd1e2c4e2, 0xc5d86596, 0x00dcc2e1,
+0xe476d9c5, 0x0f79e2c4, 0xb81973dc, 0x000000e2,
+0x97d1e2c4, 0xf1c5d855, 0xc400cac2, 0xcc0f79e2,
+0xc0310273, 0x0000c3c9, 0x00000000, 0x00000000,
+0x40000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x40100000, 0x00000000, 0x40080000,
+0x00000000, 0xc0100000, 0x00000000, 0xc0080000,
+0x00000000, 0x00000000, 0x00000000, 0x3ff00000,
+0x00000000, 0x80000000, 0x00000000, 0xbff00000,
+0001140,
+};
+asm(".type fma_x86_32_D_16f8, STT_NOTYPE;");
+asm(".type fma_x86_32_D_16f8, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) fma_x86_32_D_32f4[] = {
+0x315500eb, 0x83e589c0, 0xc483e0e4, 0x0009b980,
+0x89400000, 0x244489ca, 0x83c2291c, 0x44c708f8,
+0x00005c84, 0x44db3f80, 0x54891c24, 0x5cd91c24,
+0x44db1c84, 0x5cd91c24, 0xd6753c84, 0x5428fcc5,
+0xfcc52024, 0x60247428, 0x4c28fcc5, 0xecc54024,
+0xd4c5ee58, 0xe2c4e959, 0x441d187d, 0xc5001002,
+0xb8e128fc, 0x000000a7, 0x9875e2c4, 0xc5202464,
+0x00e4c2d4, 0x0e7de2c4, 0xc3830fe3, 0xc4000001,
+0x25187de2, 0x00100248, 0xf928fcc5, 0xec57d4c5,
+0x9e75e2c4, 0xb820247c, 0x000000ab, 0xefc2d4c5,
+0x7de2c400, 0x830feb0e, 0x00000196, 0xd65cecc5,
+0xd159ecc5, 0x0000afb8, 0x28fcc500, 0x75e2c4e9,
+0x20246c9a, 0xedc2ecc5, 0x7de2c400, 0x830feb0e,
+0x0000016e, 0x0000b3b8, 0x28fcc500, 0x57ecc5e9,
+0x75e2c4d4, 0x20246c9c, 0xd5c2ecc5, 0x7de2c400,
+0x830fd30e, 0x0000014a, 0x5428fcc5, 0xecc52024,
+0xbbb8e958, 0xc5000000, 0xc5f228fc, 0x247c28fc,
+0x45e2c440, 0x60247498, 0xf6c2d4c5, 0x7de2c400,
+0x830ff30e, 0x0000011a, 0x0000c0b8, 0x28fcc500,
+0x28fcc5f2, 0xc540247c, 0xc4ec57d4, 0x749e45e2,
+0xd4c56024, 0xc400eec2, 0xeb0e7de2, 0x00f0830f,
+0xecc50000, 0xc5b8c95c, 0xc5000000, 0xc5ea28fc,
+0x247c28fc, 0x45e2c440, 0x60246c9a, 0xedc2f4c5,
+0x7de2c400, 0x830feb0e, 0x000000c6, 0x0000cab8,
+0x28fcc500, 0x28fcc5ea, 0xc540247c, 0xc4cc57f4,
+0x6c9c45e2, 0xf4c56024, 0xc400cdc2, 0xcb0e7de2,
+0x009c830f, 0xecc50000, 0x40244c59, 0x6457dcc5,
+0xf7c56024, 0x60246cd0, 0xccd0f7c5, 0x0000d4b8,
+0x28fcc500, 0xc5402464, 0xc4f228fc, 0x74a65de2,
+0xd4c56024, 0xc400eec2, 0xeb0e7de2, 0xd8b86473,
+0xc4000000, 0x64a76de2, 0xfcc56024, 0xf4c5eb28,
+0xc400e4c2, 0xe30e7de2, 0xecc54873, 0x40245c59,
+0x5cd0e7c5, 0xdeb86024, 0xc5000000, 0x246428fc,
+0x28fcc560, 0x5de2c4f2, 0x40247496, 0xdec2e4c5,
+0x7de2c400, 0x1a73dd0e, 0x0000e2b8, 0x5de2c400,
+0x40245497, 0xcac2f4c5, 0x7de2c400, 0x0273cd0e,
+0xc3c9c031, 0xffffffff, 0x80000000,
+0001114,
+};
+asm(".type fma_x86_32_D_32f4, STT_NOTYPE;");
+asm(".type fma_x86_32_D_32f4, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) fma_x86_32_D_32f8[] = {
+0x315500eb, 0x83e589c0, 0xc483e0e4, 0x0005b980,
+0x89400000, 0x244489ca, 0xc7c2291c, 0x005cc444,
+0xdb3ff000, 0x891c2444, 0x311c2454, 0x04f883d2,
+0x58c45489, 0x18c45cdd, 0x1c2444db, 0x38c45cdd,
+0xfdc5d075, 0x20245428, 0x7428fdc5, 0xfdc56024,
+0x40244c28, 0xee58edc5, 0xe959d5c5, 0x197de2c4,
+0x1002501d, 0x28fdc500, 0x00a7b8e1, 0xe2c40000,
+0x246498f5, 0xc2d5c520, 0xe2c400e4, 0x0fe30f7d,
+0x0001c383, 0x7de2c400, 0x02582519, 0xfdc50010,
+0xd5c5f928, 0xe2c4ec57, 0x247c9ef5, 0x00abb820,
+0xd5c50000, 0xc400efc2, 0xeb0f7de2, 0x0196830f,
+0xedc50000, 0xedc5d65c, 0xafb8d159, 0xc5000000,
+0xc4e928fd, 0x6c9af5e2, 0xedc52024, 0xc400edc2,
+0xeb0f7de2, 0x016e830f, 0xb3b80000, 0xc5000000,
+0xc5e928fd, 0xc4d457ed, 0x6c9cf5e2, 0xedc52024,
+0xc400d5c2, 0xd30f7de2, 0x014a830f, 0xfdc50000,
+0x20245428, 0xe958edc5, 0x0000bbb8, 0x28fdc500,
+0x28fdc5f2, 0xc440247c, 0x7498c5e2, 0xd5c56024,
+0xc400f6c2, 0xf30f7de2, 0x011a830f, 0xc0b80000,
+0xc5000000, 0xc5f228fd, 0x247c28fd, 0x57d5c540,
+0xc5e2c4ec, 0x6024749e, 0xeec2d5c5, 0x7de2c400,
+0x830feb0f, 0x000000f0, 0xc95cedc5, 0x0000c5b8,
+0x28fdc500, 0x28fdc5ea, 0xc440247c, 0x6c9ac5e2,
+0xf5c56024, 0xc400edc2, 0xeb0f7de2, 0x00c6830f,
+0xcab80000, 0xc5000000, 0xc5ea28fd, 0x247c28fd,
+0x57f5c540, 0xc5e2c4cc, 0x60246c9c, 0xcdc2f5c5,
+0x7de2c400, 0x830fcb0f, 0x0000009c, 0x4c59edc5,
+0xddc54024, 0x60246457, 0x6cd0f5c5, 0xf5c56024,
+0xd4b8ccd0, 0xc5000000, 0x246428fd, 0x28fdc540,
+0xdde2c4f2, 0x602474a6, 0xeec2d5c5, 0x7de2c400,
+0x6473eb0f, 0x0000d8b8, 0xede2c400, 0x602464a7,
+0xeb28fdc5, 0xe4c2f5c5, 0x7de2c400, 0x4873e30f,
+0x5c59edc5, 0xe5c54024, 0x60245cd0, 0x0000deb8,
+0x28fdc500, 0xc5602464, 0xc4f228fd, 0x7496dde2,
+0xe5c54024, 0xc400dec2, 0xdd0f7de2, 0xe2b81a73,
+0xc4000000, 0x5497dde2, 0xf5c54024, 0xc400cac2,
+0xcd0f7de2, 0xc0310273, 0x0000c3c9, 0x00000000,
+0xffffffff, 0xffffffff, 0x00000000, 0x80000000,
+0001140,
+};
+asm(".type fma_x86_32_D_32f8, STT_NOTYPE;");
+asm(".type fma_x86_32_D_32f8, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) fma_x86_32_D_f4[] = {
+0x895500eb, 0x70ec83e5, 0x0d10fac5, 0x00100160,
+0x4d11fac5, 0x11fac59c, 0xfac5a04d, 0xc5a44d11,
+0xa04d10fa, 0x9971e2c4, 0xf8c59c4d, 0x01640d2e,
+0x8a0f0010, 0x000000e5, 0x00df850f, 0xfac50000,
+0xc4a04d10, 0x4d9f71e2, 0x2ef8c59c, 0x1001680d,
+0xcd8a0f00, 0x0f000000, 0x0000c785, 0x10fac500,
+0xe8c5a04d, 0xe2c4d257, 0x9c4d9b71, 0xca2ef8c5,
+0x00b58a0f, 0x850f0000, 0x000000af, 0x4d10fac5,
+0x71e2c4a0, 0xc59c4d9d, 0x0fca2ef8, 0x0000a18a,
+0x9b850f00, 0xc5000000, 0x9c4d10fa, 0x6510fac5,
+0x58f2c5a0, 0x10fac5d4, 0xfac59c5d, 0xc4a07510,
+0x5d9949e2, 0x2ef8c5a4, 0x757e7ad3, 0x10fac57c,
+0x1001701d, 0x10fac500, 0xfac59c6d, 0xc5a07d10,
+0xc4d357e8, 0x6d9f41e2, 0x2ef8c5a4, 0x75617aea,
+0x5cf2c55f, 0x10fac5cc, 0xfac59c55, 0xc4a07510,
+0x559b49e2, 0x2ef8c5a4, 0x754c7aca, 0x10fac54a,
+0xf0c59c55, 0xfac5cb57, 0xc4a07d10, 0x559d41e2,
+0x2ef8c5a4, 0x75377ad1, 0xebc03135, 0x00a7b836,
+0x2feb0000, 0x0000abb8, 0xb828eb00, 0x000000af,
+0xb3b821eb, 0xeb000000, 0x00bbb81a, 0x13eb0000,
+0x0000c0b8, 0xb80ceb00, 0x000000c5, 0xcab805eb,
+0xc9000000, 0x000000c3, 0x00000000, 0x00000000,
+0x3f800000, 0x40000000, 0xc0000000, 0x00000000,
+0x80000000, 0x00000000, 0x00000000, 0x00000000,
+0000600,
+};
+asm(".type fma_x86_32_D_f4, STT_NOTYPE;");
+asm(".type fma_x86_32_D_f4, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) fma_x86_32_D_f8[] = {
+0x895500eb, 0xd0ec81e5, 0xc5000000, 0xb00d10fb,
+0xc5001001, 0x388d11fb, 0xc5ffffff, 0x408d11fb,
+0xc5ffffff, 0x488d11fb, 0xc5ffffff, 0x408d10fb,
+0xc4ffffff, 0x8d99f1e2, 0xffffff38, 0x0d2ef9c5,
+0x001001b8, 0x01298a0f, 0x850f0000, 0x00000123,
+0x8d10fbc5, 0xffffff40, 0x9ff1e2c4, 0xffff388d,
+0x2ef9c5ff, 0x1001c00d, 0x0b8a0f00, 0x0f000001,
+0x00010585, 0x57e9c500, 0x10fbc5d2, 0xffff408d,
+0xf1e2c4ff, 0xff388d9b, 0xf9c5ffff, 0x8a0fca2e,
+0x000000ed, 0x00e7850f, 0xfbc50000, 0xff408d10,
+0xe2c4ffff, 0x388d9df1, 0xc5ffffff, 0x0fca2ef9,
+0x0000d38a, 0xcd850f00, 0xc5000000, 0x388d10fb,
+0xc5ffffff, 0x40a510fb, 0xc5ffffff, 0xc5d458f3,
+0x389d10fb, 0xc5ffffff, 0x40b510fb, 0xc4ffffff,
+0x9d99c9e2, 0xffffff48, 0xd32ef9c5, 0x009d8a0f,
+0x850f0000, 0x00000097, 0x1d7efac5, 0x001001d0,
+0xad10fbc5, 0xffffff38, 0xbd10fbc5, 0xffffff40,
+0xd357e9c5, 0x9fc1e2c4, 0xffff48ad, 0x2ef9c5ff,
+0x75737aea, 0x5cf3c571, 0x10fbc5cc, 0xffff3895,
+0x10fbc5ff, 0xffff40b5, 0xc9e2c4ff, 0xff48959b,
+0xf9c5ffff, 0x557aca2e, 0xfbc55375, 0xff389510,
+0xfbc5ffff, 0xff40bd10, 0xf1c5ffff, 0xe2c4cb57,
+0x48959dc1, 0xc5ffffff, 0x7ad12ef9, 0x31357537,
+0xb836ebc0, 0x000000a7, 0xabb82feb, 0xeb000000,
+0x00afb828, 0x21eb0000, 0x0000b3b8, 0xb81aeb00,
+0x000000bb, 0xc0b813eb, 0xeb000000, 0x00c5b80c,
+0x05eb0000, 0x0000cab8, 0x00c3c900, 0x00000000,
+0x00000000, 0x3ff00000, 0x00000000, 0x40000000,
+0x00000000, 0xc0000000, 0x00000000, 0x00000000,
+0x00000000, 0x80000000, 0x00000000, 0x00000000,
+0000740,
+};
+asm(".type fma_x86_32_D_f8, STT_NOTYPE;");
+asm(".type fma_x86_32_D_f8, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) fma_x86_64_D_16f4[] = {
+0xb84800eb, 0x3f800000, 0x40000000, 0xe5894855,
+0xd0458948, 0x0000b848, 0x00004040, 0x89484080,
+0xb848d845, 0x40800000, 0x40400000, 0xe0458948,
+0x000001b8, 0xe0c148fe, 0x4589481e, 0x002d48e8,
+0x48008000, 0x48f04589, 0xc5f84589, 0xe04d28f8,
+0xd276e9c5, 0x0000a7b8, 0x28f8c500, 0x71e2c4d9,
+0xc5d05d98, 0xb41dc2e0, 0x00000001, 0x0e79e2c4,
+0xa4830fda, 0xc5000001, 0xc4d928f8, 0x5d9e71e2,
+0x00abb8d0, 0xe0c50000, 0x01a11dc2, 0xc4000000,
+0xda0e79e2, 0x0181830f, 0xf8c50000, 0xe2c4d928,
+0xd05d9a71, 0x0000afb8, 0xc2e0c500, 0x00018e1d,
+0xe2c40000, 0x0fda0e79, 0x00015e83, 0x28f8c500,
+0x71e2c4d9, 0xb8d05d9c, 0x000000b3, 0x1dc2e0c5,
+0x0000017b, 0x79e2c400, 0x830fda0e, 0x0000013b,
+0x5d28f8c5, 0x58e0c5d0, 0x28f8c5e1, 0xf8c5e07d,
+0xe2c4eb28, 0xf06d9841, 0x0000bbb8, 0xc2d8c500,
+0xe2c400ed, 0x0fea0e79, 0x00010e83, 0x28f8c500,
+0xf8c5e07d, 0xe2c4eb28, 0xf06d9e41, 0x0000c0b8,
+0x79e2c400, 0x01263518, 0xd8c50000, 0xd8c5e657,
+0xc400e5c2, 0xe20e79e2, 0x00dd830f, 0xe0c50000,
+0xf8c5c95c, 0xc5e07d28, 0xc4e328f8, 0x659a41e2,
+0x00c5b8f0, 0xf0c50000, 0xc400e4c2, 0xe20e79e2,
+0x00b5830f, 0xf8c50000, 0xc5e07d28, 0xc4e328f8,
+0x659c41e2, 0x57f0c5f0, 0x00cab8ce, 0xf0c50000,
+0xc400ccc2, 0xca0e79e2, 0x008d830f, 0xe0c50000,
+0xc5e04d59, 0xf06557c8, 0x6dd0f3c5, 0xd0f3c5f0,
+0x28f8c5cc, 0xf8c5e065, 0xe2c4f328, 0xf075a659,
+0x0000d4b8, 0xc2d0c500, 0xe2c400ee, 0x73ea0e79,
+0x61e2c45a, 0xb8f065a7, 0x000000d8, 0xe4c2f0c5,
+0x79e2c400, 0x4373e20e, 0x6559e0c5, 0xd0dbc5e0,
+0xf8c5f065, 0xc5f06d28, 0xc4f328f8, 0x759651e2,
+0x00deb8e0, 0xd8c50000, 0xc400e6c2, 0xe20e79e2,
+0xe2c41973, 0xe05d9751, 0x0000e2b8, 0xc2f0c500,
+0xe2c400cb, 0x73ca0e79, 0x5dc03102, 0x000000c3,
+0x41000000, 0x41100000, 0x41000000, 0x40a00000,
+0xc1000000, 0xc1100000, 0xc1000000, 0xc0a00000,
+0x00000000, 0x40400000, 0x40800000, 0x40400000,
+0x80000000, 0xc0400000, 0xc0800000, 0xc0400000,
+0001140,
+};
+asm(".type fma_x86_64_D_16f4, STT_NOTYPE;");
+asm(".type fma_x86_64_D_16f4, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) fma_x86_64_D_16f8[] = {
+0x485500eb, 0xfbc5e589, 0x023a0d10, 0xfbc50000,
+0x01fa1510, 0xfbc50000, 0xc5d04d11, 0xe05511fb,
+0x4d11fbc5, 0x11fbc5f0, 0xfbc5d855, 0xc5e84d11,
+0xf84d11fb, 0x4d28f9c5, 0x76e9c5e0, 0x00a7b8d2,
+0xf9c50000, 0xe2c4d928, 0xd05d98f1, 0x1dc2e1c5,
+0x000001cb, 0x79e2c400, 0x830fda0f, 0x000001a3,
+0xd928f9c5, 0x9ef1e2c4, 0xabb8d05d, 0xc5000000,
+0xb81dc2e1, 0x00000001, 0x0f79e2c4, 0x80830fda,
+0xc5000001, 0xc4d928f9, 0x5d9af1e2, 0x00afb8d0,
+0xe1c50000, 0x01a51dc2, 0xc4000000, 0xda0f79e2,
+0x015d830f, 0xf9c50000, 0xe2c4d928, 0xd05d9cf1,
+0x0000b3b8, 0xc2e1c500, 0x0001921d, 0xe2c40000,
+0x0fda0f79, 0x00013a83, 0x28f9c500, 0xe1c5d05d,
+0xf9c5e158, 0xc5e07d28, 0xc4eb28f9, 0x6d98c1e2,
+0x00bbb8f0, 0xd9c50000, 0xc400edc2, 0xea0f79e2,
+0x010d830f, 0xf9c50000, 0xc5e07d28, 0xc4eb28f9,
+0x6d9ec1e2, 0x12fbc5f0, 0x00014335, 0x57d9c500,
+0x00c0b8e6, 0xd9c50000, 0xc400e5c2, 0xe20f79e2,
+0x00dd830f, 0xe1c50000, 0xf9c5c95c, 0xc5e07d28,
+0xc4e328f9, 0x659ac1e2, 0x00c5b8f0, 0xf1c50000,
+0xc400e4c2, 0xe20f79e2, 0x00b5830f, 0xf9c50000,
+0xc5e07d28, 0xc4e328f9, 0x659cc1e2, 0x57f1c5f0,
+0x00cab8ce, 0xf1c50000, 0xc400ccc2, 0xca0f79e2,
+0x008d830f, 0xe1c50000, 0xc5e04d59, 0xf06557c9,
+0x6dd0f1c5, 0xd0f1c5f0, 0x28f9c5cc, 0xf9c5e065,
+0xe2c4f328, 0xf075a6d9, 0x0000d4b8, 0xc2d1c500,
+0xe2c400ee, 0x73ea0f79, 0xe1e2c45a, 0xb8f065a7,
+0x000000d8, 0xe4c2f1c5, 0x79e2c400, 0x4373e20f,
+0x6559e1c5, 0xd0d9c5e0, 0xf9c5f065, 0xc5f06d28,
+0xc4f328f9, 0x7596d1e2, 0x00deb8e0, 0xd9c50000,
+0xc400e6c2, 0xe20f79e2, 0xe2c41973, 0xe05d97d1,
+0x0000e2b8, 0xc2f1c500, 0xe2c400cb, 0x73ca0f79,
+0x5dc03102, 0x000000c3, 0x00000000, 0x00000000,
+0x00000000, 0x40000000, 0x00000000, 0x00000000,
+0x00000000, 0x40100000, 0x00000000, 0x40080000,
+0x00000000, 0xc0100000, 0x00000000, 0xc0080000,
+0x00000000, 0x00000000, 0x00000000, 0x3ff00000,
+0x00000000, 0x80000000, 0x00000000, 0xbff00000,
+0001140,
+};
+asm(".type fma_x86_64_D_16f8, STT_NOTYPE;");
+asm(".type fma_x86_64_D_16f8, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) fma_x86_64_D_32f4[] = {
+0xb85500eb, 0x00000001, 0x000009b9, 0xe5894800,
+0xe0e48348, 0x0d10fac5, 0x0000022c, 0xd02aeac5,
+0xfac5ca89, 0xdc844c11, 0xfac5c229, 0x9c845411,
+0xd22aeac5, 0x5411fac5, 0xff48bc84, 0xf88348c0,
+0xc5d97509, 0x245c28fc, 0x28fcc5a0, 0xc5e02474,
+0x244c28fc, 0x58e4c5c0, 0x59dcc5e6, 0x28fcc5e1,
+0x75e2c4e9, 0xa0246c98, 0x0000a7b8, 0x7de2c400,
+0x01d61518, 0xdcc50000, 0xc400edc2, 0xea0e7de2,
+0x01bf830f, 0xfcc50000, 0xe2c4f928, 0x247c9e75,
+0x00abb8a0, 0xe2c40000, 0xb12d187d, 0xc5000001,
+0xc5e557dc, 0x00e7c2dc, 0x0e7de2c4, 0x92830fe2,
+0xc5000001, 0xc5de5ce4, 0xc5d959e4, 0xc4e128fc,
+0x649a75e2, 0xafb8a024, 0xc5000000, 0x00e4c2e4,
+0x0e7de2c4, 0x6a830fe2, 0xc5000001, 0xc4e128fc,
+0x649c75e2, 0xe4c5a024, 0xb3b8dd57, 0xc5000000,
+0x00dcc2e4, 0x0e7de2c4, 0x46830fda, 0xc5000001,
+0x245c28fc, 0x58e4c5a0, 0x28fcc5e1, 0xc5c0247c,
+0xb8f328fc, 0x000000bb, 0x9845e2c4, 0xc5e02474,
+0x00f6c2dc, 0x0e7de2c4, 0x16830ff2, 0xc5000001,
+0x247c28fc, 0x28fcc5c0, 0x57dcc5f3, 0x00c0b8e5,
+0xe2c40000, 0x24749e45, 0xc2dcc5e0, 0xe2c400e6,
+0x0fe20e7d, 0x0000ec83, 0x5ce4c500, 0x28fcc5c9,
+0xc5c0247c, 0xb8e328fc, 0x000000c5, 0x9a45e2c4,
+0xc5e02464, 0x00e4c2f4, 0x0e7de2c4, 0xc2830fe2,
+0xc5000000, 0x247c28fc, 0x28fcc5c0, 0x57f4c5e3,
+0x00cab8cd, 0xe2c40000, 0x24649c45, 0xc2f4c5e0,
+0xe2c400cc, 0x0fca0e7d, 0x00009883, 0x59e4c500,
+0xc5c0244c, 0x246457d4, 0xd0f7c5e0, 0xc5e02474,
+0xc5ccd0f7, 0x246428fc, 0x28fcc5c0, 0x00d4b8eb,
+0xe2c40000, 0x246ca65d, 0xc2ccc5e0, 0xe2c400ed,
+0x73ea0e7d, 0x65e2c460, 0xe02464a7, 0x0000d8b8,
+0xc2f4c500, 0xe2c400e4, 0x73e20e7d, 0x59e4c548,
+0xc5c02464, 0x2464d0df, 0x28fcc5e0, 0xc5e0246c,
+0xb8f328fc, 0x000000de, 0x9655e2c4, 0xc5c02474,
+0x00e6c2dc, 0x0e7de2c4, 0xc41a73e2, 0x5c9755e2,
+0xe2b8c024, 0xc5000000, 0x00cbc2f4, 0x0e7de2c4,
+0x310273ca, 0x00c3c9c0, 0x3f800000, 0xffffffff,
+0x80000000,
+0001124,
+};
+asm(".type fma_x86_64_D_32f4, STT_NOTYPE;");
+asm(".type fma_x86_64_D_32f4, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) fma_x86_64_D_32f8[] = {
+0x485500eb, 0x8348e589, 0xfbc5e0e4, 0x026e0d10,
+0xfbc50000, 0x02d61510, 0xfbc50000, 0x02661d10,
+0xfbc50000, 0x02be2510, 0xfbc50000, 0xa0244c11,
+0x5411fbc5, 0xfbc5c024, 0xe0244c11, 0x5c11fbc5,
+0xfbc5a824, 0xc8246411, 0x4c11fbc5, 0xfbc5e824,
+0xb0246411, 0x5c11fbc5, 0xfbc5d024, 0xf0244c11,
+0x5411fbc5, 0xfbc5b824, 0xd8244c11, 0x4c11fbc5,
+0xfdc5f824, 0xc0244c28, 0x0000a7b8, 0x7de2c400,
+0x020a1519, 0xfdc50000, 0xe2c4d928, 0x245c98f5,
+0xc2e5c5a0, 0x0002061d, 0xe2c40000, 0x0fda0f7d,
+0x0001bb83, 0x28fdc500, 0xf5e2c4d9, 0xa0245c9e,
+0x0000abb8, 0xc2e5c500, 0x0002021d, 0xe2c40000,
+0x0fda0f7d, 0x00019783, 0x28fdc500, 0xf5e2c4d9,
+0xa0245c9a, 0x0000afb8, 0xc2e5c500, 0x0001fe1d,
+0xe2c40000, 0x0fda0f7d, 0x00017383, 0x28fdc500,
+0xf5e2c4d9, 0xa0245c9c, 0x0000b3b8, 0xc2e5c500,
+0x0001fa1d, 0xe2c40000, 0x0fda0f7d, 0x00014f83,
+0x28fdc500, 0xc5a0245c, 0xc5e158e5, 0x247c28fd,
+0x28fdc5c0, 0x00bbb8eb, 0xe2c40000, 0x246c98c5,
+0xc2ddc5e0, 0xe2c400ed, 0x0fea0f7d, 0x00011f83,
+0x28fdc500, 0xc5c0247c, 0xc4eb28fd, 0x6c9ec5e2,
+0xc0b8e024, 0xc4000000, 0x35197de2, 0x000001a0,
+0xe657ddc5, 0xe5c2ddc5, 0x7de2c400, 0x830fe20f,
+0x000000ec, 0xc95ce5c5, 0x7c28fdc5, 0xfdc5c024,
+0xc5b8e328, 0xc4000000, 0x649ac5e2, 0xf5c5e024,
+0xc400e4c2, 0xe20f7de2, 0x00c2830f, 0xfdc50000,
+0xc0247c28, 0xe328fdc5, 0xce57f5c5, 0x0000cab8,
+0xc5e2c400, 0xe024649c, 0xccc2f5c5, 0x7de2c400,
+0x830fca0f, 0x00000098, 0x4c59e5c5, 0xcdc5c024,
+0xe0246457, 0x6cd0f5c5, 0xf5c5e024, 0xfdc5ccd0,
+0xc0246428, 0xf328fdc5, 0x0000d4b8, 0xdde2c400,
+0xe02474a6, 0xeec2d5c5, 0x7de2c400, 0x6073ea0f,
+0xa7e5e2c4, 0xb8e02464, 0x000000d8, 0xe4c2f5c5,
+0x7de2c400, 0x4873e20f, 0x6459e5c5, 0xddc5c024,
+0xe02464d0, 0x6c28fdc5, 0xfdc5e024, 0xdeb8f328,
+0xc4000000, 0x7496d5e2, 0xddc5c024, 0xc400e6c2,
+0xe20f7de2, 0xe2c41a73, 0x245c97d5, 0x00e2b8c0,
+0xf5c50000, 0xc400cbc2, 0xca0f7de2, 0xc0310273,
+0x0000c3c9, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x3ff00000, 0x00000000, 0x40000000,
+0xffffffff, 0xffffffff, 0x00000000, 0x00000000,
+0x00000000, 0x40200000, 0x00000000, 0x40220000,
+0x00000000, 0x40200000, 0x00000000, 0x40140000,
+0x00000000, 0xc0200000, 0x00000000, 0xc0220000,
+0x00000000, 0xc0200000, 0x00000000, 0xc0140000,
+0x00000000, 0x00000000, 0x00000000, 0x40080000,
+0x00000000, 0x40100000, 0x00000000, 0x40080000,
+0x00000000, 0x80000000, 0x00000000, 0xc0080000,
+0x00000000, 0xc0100000, 0x00000000, 0xc0080000,
+0001440,
+};
+asm(".type fma_x86_64_D_32f8, STT_NOTYPE;");
+asm(".type fma_x86_64_D_32f8, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) fma_x86_64_D_f4[] = {
+0x485500eb, 0xfac5e589, 0x01520d10, 0xfac50000,
+0xc59c4d11, 0xa04d11fa, 0x4d11fac5, 0x10fac5a4,
+0xe2c4a04d, 0x9c4d9971, 0x0d2ef8c5, 0x00000134,
+0x00e58a0f, 0x850f0000, 0x000000df, 0x4d10fac5,
+0x71e2c4a0, 0xc59c4d9f, 0x190d2ef8, 0x0f000001,
+0x0000cd8a, 0xc7850f00, 0xc5000000, 0xa04d10fa,
+0x9b71e2c4, 0xe8c59c4d, 0xf8c5d257, 0x8a0fca2e,
+0x000000b5, 0x00af850f, 0xfac50000, 0xc4a04d10,
+0x4d9d71e2, 0x2ef8c59c, 0xa18a0fca, 0x0f000000,
+0x00009b85, 0x10fac500, 0xfac59c4d, 0xc5a06510,
+0xc5d458f2, 0x9c5d10fa, 0x7510fac5, 0x49e2c4a0,
+0xc5a45d99, 0x7ad32ef8, 0xc57c757e, 0x9c6d10fa,
+0x7d10fac5, 0x10fac5a0, 0x0000a31d, 0x41e2c400,
+0xc5a46d9f, 0xc5d357e8, 0x7aea2ef8, 0xc55f7561,
+0xc5cc5cf2, 0x9c5510fa, 0x7510fac5, 0x49e2c4a0,
+0xc5a4559b, 0x7aca2ef8, 0xc54a754c, 0x9c5510fa,
+0x7d10fac5, 0x57f0c5a0, 0x41e2c4cb, 0xc5a4559d,
+0x7ad12ef8, 0x31357537, 0xb836ebc0, 0x000000a7,
+0xabb82feb, 0xeb000000, 0x00afb828, 0x21eb0000,
+0x0000b3b8, 0xb81aeb00, 0x000000bb, 0xc0b813eb,
+0xeb000000, 0x00c5b80c, 0x05eb0000, 0x0000cab8,
+0x00c35d00, 0x00000000, 0x00000000, 0x00000000,
+0x3f800000, 0x40000000, 0xc0000000, 0x00000000,
+0x80000000, 0x00000000, 0x00000000, 0x00000000,
+0000600,
+};
+asm(".type fma_x86_64_D_f4, STT_NOTYPE;");
+asm(".type fma_x86_64_D_f4, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) fma_x86_64_D_f8[] = {
+0x485500eb, 0x8348e589, 0xfbc558ec, 0x019e0d10,
+0xfbc50000, 0xff388d11, 0xfbc5ffff, 0xff408d11,
+0xfbc5ffff, 0xff488d11, 0xfbc5ffff, 0xff408d10,
+0xe2c4ffff, 0x388d99f1, 0xc5ffffff, 0x750d2ef9,
+0x0f000001, 0x0001298a, 0x23850f00, 0xc5000001,
+0x408d10fb, 0xc4ffffff, 0x8d9ff1e2, 0xffffff38,
+0x0d2ef9c5, 0x00000158, 0x010b8a0f, 0x850f0000,
+0x00000105, 0x8d10fbc5, 0xffffff40, 0xd257e9c5,
+0x9bf1e2c4, 0xffff388d, 0x2ef9c5ff, 0xed8a0fca,
+0x0f000000, 0x0000e785, 0x10fbc500, 0xffff408d,
+0xf1e2c4ff, 0xff388d9d, 0xf9c5ffff, 0x8a0fca2e,
+0x000000d3, 0x00cd850f, 0xfbc50000, 0xff388d10,
+0xfbc5ffff, 0xff40a510, 0xf3c5ffff, 0xfbc5d458,
+0xff389d10, 0xfbc5ffff, 0xff40b510, 0xe2c4ffff,
+0x489d99c9, 0xc5ffffff, 0x0fd32ef9, 0x00009d8a,
+0x97850f00, 0xc5000000, 0x38ad10fb, 0xc5ffffff,
+0x40bd10fb, 0xc4ffffff, 0xad9fc1e2, 0xffffff48,
+0x1d7efac5, 0x000000b8, 0xd357e9c5, 0xea2ef9c5,
+0x7175737a, 0xcc5cf3c5, 0x9510fbc5, 0xffffff38,
+0xb510fbc5, 0xffffff40, 0x9bc9e2c4, 0xffff4895,
+0x2ef9c5ff, 0x75557aca, 0x10fbc553, 0xffff3895,
+0x10fbc5ff, 0xffff40bd, 0x57f1c5ff, 0xc1e2c4cb,
+0xff48959d, 0xf9c5ffff, 0x377ad12e, 0xc0313575,
+0xa7b836eb, 0xeb000000, 0x00abb82f, 0x28eb0000,
+0x0000afb8, 0xb821eb00, 0x000000b3, 0xbbb81aeb,
+0xeb000000, 0x00c0b813, 0x0ceb0000, 0x0000c5b8,
+0xb805eb00, 0x000000ca, 0x0000c3c9, 0x00000000,
+0x00000000, 0x3ff00000, 0x00000000, 0x40000000,
+0x00000000, 0xc0000000, 0x00000000, 0x00000000,
+0x00000000, 0x80000000, 0x00000000, 0x00000000,
+0000740,
+};
+asm(".type fma_x86_64_D_f8, STT_NOTYPE;");
+asm(".type fma_x86_64_D_f8, STT_FUNC;");
@@ -0,0 +1,38 @@
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) sse2_gf_x86_32_D_16[] = {
+0x83e58955, 0x02e8f0e4, 0xc9000000, 0xc03155c3,
+0xec83e589, 0x05448838, 0x0544c6c8, 0x834001d8,
+0xf17510f8, 0xc01d280f, 0xb8001000, 0x0000000f,
+0x00d845c6, 0xd015280f, 0x0f001000, 0x0fe85d29,
+0x66c84528, 0x45cf3a0f, 0x290f00e8, 0x280fe845,
+0x0f66c845, 0xe845cf38, 0xd84d280f, 0xc1740f66,
+0xd0d70f66, 0xfffffa81, 0x30750000, 0xc845280f,
+0x66e0280f, 0x65cf380f, 0x740f66e8, 0xd70f66cc,
+0xfffa81d1, 0x750000ff, 0xd845c61a, 0xfc0f6601,
+0x290f48c2, 0xa375c845, 0x0cebc031, 0x000043b8,
+0xb805eb00, 0x00000047, 0x0000c3c9, 0x00000000,
+0x10204080, 0x01020408, 0x00000000, 0x00000000,
+0x10204080, 0x01020408, 0x10204080, 0x01020408,
+0x10101010, 0x10101010, 0x10101010, 0x10101010,
+0000340,
+};
+asm(".type sse2_gf_x86_32_D_16, STT_NOTYPE;");
+asm(".type sse2_gf_x86_32_D_16, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) sse2_gf_x86_64_D_16[] = {
+0x315500eb, 0xe58948c0, 0xd0054488, 0xe00544c6,
+0xc0ff4801, 0x10f88348, 0x45c6ee75, 0x280f00e0,
+0x00009b25, 0x000fb800, 0x280f0000, 0x00009f1d,
+0x65290f00, 0x45280ff0, 0x3a0f66d0, 0x00f045cf,
+0xf045290f, 0xd045280f, 0xe04d280f, 0xcf380f66,
+0x0f66f045, 0x0f66c174, 0xfa81d0d7, 0x0000ffff,
+0x280f3175, 0x280fd045, 0x380f66d0, 0x66f055cf,
+0x66ca740f, 0x81d1d70f, 0x00fffffa, 0x661b7500,
+0xc6c3fc0f, 0x0f01e045, 0xffd04529, 0x31a275c8,
+0xb80cebc0, 0x00000043, 0x47b805eb, 0x5d000000,
+0x000000c3, 0x00000000, 0x00000000, 0x00000000,
+0x10204080, 0x01020408, 0x00000000, 0x00000000,
+0x10204080, 0x01020408, 0x10204080, 0x01020408,
+0x10101010, 0x10101010, 0x10101010, 0x10101010,
+0000340,
+};
+asm(".type sse2_gf_x86_64_D_16, STT_NOTYPE;");
+asm(".type sse2_gf_x86_64_D_16, STT_FUNC;");
@@ -0,0 +1,256 @@
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) sse4_sha_x86_32_D_16[] = {
+0x83e58955, 0x77e8f0e4, 0xc9000000, 0x280f55c3,
+0x83e589c8, 0x280f48ec, 0x10071005, 0xd1280f00,
+0xb845290f, 0x2005280f, 0x0f001007, 0x290fd928,
+0x280fc845, 0x10073005, 0x45290f00, 0x05280fd8,
+0x00100740, 0xe845290f, 0x66c1280f, 0xb845d20f,
+0x55f20f66, 0xeb0f66e8, 0x15280fc2, 0x00100750,
+0xe855290f, 0x66d1280f, 0xc855d20f, 0x5df20f66,
+0xeb0f66e8, 0xc2570fd3, 0x4dd20f66, 0x570fc9d8,
+0xba55c3c1, 0x00000001, 0x5356e589, 0x00e0ec81,
+0x280f0000, 0x10076005, 0x85290f00, 0xffffff68,
+0x0fc0570f, 0xff788529, 0x9488ffff, 0xffff7815,
+0xfa8342ff, 0x0ff37510, 0xff78b528, 0x570fffff,
+0xb5290fed, 0xffffff58, 0xedcc3a0f, 0xad290f01,
+0xffffff48, 0x66c0570f, 0x5885fa0f, 0x0fffffff,
+0x0f984529, 0x380fd028, 0xff5895c9, 0x280fffff,
+0x3a0f66c8, 0xff588d0f, 0x0f08ffff, 0x0f66c857,
+0x0f66ca76, 0xff3dc1d7, 0x0f0000ff, 0x00057285,
+0xd8280f00, 0x9dca380f, 0xffffff58, 0x588d280f,
+0x66ffffff, 0xc80f3a0f, 0xc8570f0c, 0x884d290f,
+0x884d280f, 0x8855280f, 0xf1720f66, 0x720f6601,
+0x560f1fd2, 0x8d280fd1, 0xffffff58, 0x0f3a0f66,
+0x570f0cca, 0x4d290fc8, 0x4d280f88, 0x55280f88,
+0x720f6688, 0x0f6601f1, 0x0f1fd272, 0x0f66ca56,
+0x0f66cb76, 0xff3dc1d7, 0x0f0000ff, 0x00050985,
+0xd8280f00, 0x9dca380f, 0xffffff58, 0x700d280f,
+0x66001007, 0x688dfa0f, 0x0fffffff, 0x0fe84d29,
+0xff588d28, 0x0f66ffff, 0x0cc80f3a, 0x0fc8570f,
+0x0f66d128, 0xff6895f2, 0x0f66ffff, 0x66e84dd2,
+0x0fd1eb0f, 0xff588d28, 0x0f66ffff, 0x0cca0f3a,
+0x0fc8570f, 0x0f66d128, 0xff6895f2, 0x0f66ffff,
+0x66e84dd2, 0x66d1eb0f, 0x66da760f, 0x3dc3d70f,
+0x0000ffff, 0x0497850f, 0x380f0000, 0xff5885c8,
+0x280fffff, 0xc031984d, 0x0fd1280f, 0x0f66d928,
+0x661ef272, 0x02d3720f, 0x0fd3560f, 0x0f885529,
+0xff589528, 0x4589ffff, 0x8c458988, 0x66904589,
+0x8855fe0f, 0xc2760f66, 0xc0d70f66, 0x00ffff3d,
+0x51850f00, 0x0f000004, 0x588dcc3a, 0x01ffffff,
+0x188d290f, 0x0fffffff, 0x0f987d28, 0x66987528,
+0x0cdf730f, 0x66d7280f, 0x08de730f, 0x0fde280f,
+0x0f984528, 0x66984d28, 0x1ef0720f, 0xd1720f66,
+0xa5280f02, 0xffffff48, 0x31c1560f, 0x700f66c0,
+0xffff58b5, 0x0f661bff, 0x98450e3a, 0xe8280f0f,
+0xf4720f66, 0xf8280f02, 0x3885290f, 0x66ffffff,
+0x04ff730f, 0x4885280f, 0x66ffffff, 0x04dd730f,
+0x28bd290f, 0x66ffffff, 0x1ed0720f, 0x66e0560f,
+0x00e4700f, 0x83c3280f, 0x280f01f8, 0xfa280fca,
+0x66c5570f, 0x05f1720f, 0xd7720f66, 0x85570f1b,
+0xffffff38, 0x66cf560f, 0x66c1fe0f, 0x66c6fe0f,
+0x2885fe0f, 0x66ffffff, 0x74c4fe0f, 0x02f8834b,
+0xc0853874, 0x280f5675, 0xf8280fc8, 0xf1720f66,
+0x720f661e, 0x560f02d7, 0x7e0f66cf, 0x3a0f66c8,
+0x6603e822, 0x66c07e0f, 0xd8223a0f, 0x3a0f6602,
+0xb801d022, 0x00000001, 0x0f668aeb, 0x02c1163a,
+0x223a0f66, 0x28eb03d1, 0x163a0f66, 0x0f6601c1,
+0x03d9223a, 0x223a0f66, 0x36eb02d1, 0x163a0f66,
+0x0f6602c1, 0x03d3163a, 0x850fd939, 0x0000031f,
+0x163a0f66, 0x0f6601c1, 0x02d3163a, 0x850fcb39,
+0x00000312, 0x163a0f66, 0xd93903d9, 0x030b850f,
+0x0f660000, 0x0f66c17e, 0x01d3163a, 0x850fcb39,
+0x00000300, 0x163a0f66, 0xd93902d9, 0x02f9850f,
+0x280f0000, 0x3a0f66c8, 0x0f03e916, 0x0f66f828,
+0x661ef172, 0x02d7720f, 0x66cf560f, 0x39cb7e0f,
+0xdb850fd9, 0x40000002, 0x0f04f883, 0xfffee385,
+0x3a0f66ff, 0x66f0c80e, 0x188d760f, 0x66ffffff,
+0x3dc1d70f, 0x0000ffff, 0x02bb850f, 0x280f0000,
+0x280f9865, 0xcc380fdc, 0xffff589d, 0x85280fff,
+0xffffff58, 0x0f3a0f66, 0x290f04c4, 0x280fe845,
+0x280fe855, 0x0f66e845, 0x6607d272, 0x19f0720f,
+0x0fd0560f, 0x0fe84528, 0x66e84d28, 0x0ef0720f,
+0xd1720f66, 0xc1560f12, 0x0fc2570f, 0x66e84d28,
+0x03d1720f, 0x66c1570f, 0x66c4fe0f, 0x66c3760f,
+0x3dc0d70f, 0x0000ffff, 0x0252850f, 0x280f0000,
+0xcd380fec, 0xffff58ad, 0xb5280fff, 0xffffff58,
+0x66fc280f, 0xfe0f3a0f, 0xc7280f08, 0xfffb6ce8,
+0xfe0f66ff, 0x3a0f66c4, 0xe808c60f, 0xfffffb5d,
+0xc4fe0f66, 0xc5760f66, 0xc0d70f66, 0x00ffff3d,
+0x10850f00, 0x8b000002, 0xd0f79c45, 0xe86e0f66,
+0x886d290f, 0x5885280f, 0x0fffffff, 0x380ff428,
+0x0f8875cb, 0xff38b529, 0x570fffff, 0x6e0f66d2,
+0x0f669c4d, 0x884d223a, 0xf1280f01, 0x0f66db31,
+0x290ff16c, 0xffff28b5, 0xc9570fff, 0xf4700f66,
+0x3a0f6644, 0x0f08d40f, 0xff18b529, 0x280fffff,
+0x1007a035, 0xd9280f00, 0xe8700f66, 0xe1280f44,
+0xf4720f66, 0xf9280f1a, 0xd3720f66, 0x55290f06,
+0xdc560fa8, 0x66e1280f, 0x15f7720f, 0xd875290f,
+0xd4720f66, 0xe7560f0b, 0x0ff9280f, 0x280fe357,
+0x720f66d9, 0x0f6619d7, 0x0f07f372, 0x570fdf56,
+0xe1280fdc, 0x28a5550f, 0x66ffffff, 0x66e3fe0f,
+0x0fe5fe0f, 0x07802d28, 0x290f0010, 0x280fb86d,
+0x1007902d, 0xfe0f6600, 0xffff18a5, 0x6d290fff,
+0x8bc031c8, 0x8bb8854c, 0xd3a88574, 0x857489ce,
+0xf88340e8, 0x0fec7504, 0x31e85d28, 0x854c8bc0,
+0x85748bc8, 0x89ced3a8, 0x40e88574, 0x7504f883,
+0x5d570fec, 0x8bc031e8, 0x8bd8854c, 0xd3a88574,
+0x857489c6, 0xf88340e8, 0x0fec7504, 0x85e85d57,
+0xfe0f66db, 0x3a0f66dc, 0x7502d916, 0x7e0f6620,
+0x0001bbd8, 0x0f660000, 0x01c8223a, 0x223a0f66,
+0x0f6603d1, 0x03c8223a, 0xffff08e9, 0x3a0f66ff,
+0x3903d016, 0xb3850fc8, 0x66000000, 0x66d87e0f,
+0xc9163a0f, 0x0fc13901, 0x0000a885, 0x3a0f6600,
+0x3903c816, 0xa1850fc8, 0x66000000, 0x389d760f,
+0x66ffffff, 0x3dc3d70f, 0x0000ffff, 0x0091850f,
+0x280f0000, 0x1007b005, 0x0f664a00, 0xff5885fe,
+0x290fffff, 0xffff5885, 0x55850fff, 0x31fffffa,
+0xb875ebc0, 0x0000009a, 0xa6b86eeb, 0xeb000000,
+0x00aeb867, 0x60eb0000, 0x0000b7b8, 0xb859eb00,
+0x00000108, 0x0bb852eb, 0xeb000001, 0x010cb84b,
+0x44eb0000, 0x00010fb8, 0xb83deb00, 0x00000110,
+0x11b836eb, 0xeb000001, 0x0118b82f, 0x28eb0000,
+0x00011fb8, 0xb821eb00, 0x00000127, 0x7bb81aeb,
+0xeb000001, 0x017db813, 0x0ceb0000, 0x00017fb8,
+0xb805eb00, 0x00000182, 0x00e0c481, 0x5e5b0000,
+0x0000c35d, 0x00000000, 0x00000000, 0x00000000,
+0x00000011, 0x00000000, 0x00000000, 0x00000000,
+0x00000013, 0x00000000, 0x00000000, 0x00000000,
+0x0000000a, 0x00000000, 0x00000000, 0x00000000,
+0x0000000f, 0x00000000, 0x00000000, 0x00000000,
+0x0000000d, 0x00000000, 0x00000000, 0x00000000,
+0x00000001, 0x00000000, 0x00000000, 0x00000000,
+0x00000020, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000002, 0x00000002,
+0x00000000, 0x00000000, 0x0000000d, 0x0000000d,
+0x00000000, 0x00000000, 0x0000000a, 0x0000000a,
+0x10101010, 0x10101010, 0x10101010, 0x10101010,
+0003700,
+};
+asm(".type sse4_sha_x86_32_D_16, STT_NOTYPE;");
+asm(".type sse4_sha_x86_32_D_16, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) sse4_sha_x86_64_D_16[] = {
+0x0f5570eb, 0x280fd028, 0xe58948d8, 0xdd0d280f,
+0x0f000006, 0x0fc04d29, 0x06e20d28, 0x290f0000,
+0x280fd04d, 0x0006e70d, 0x4d290f00, 0x0d280fe0,
+0x000006ec, 0xf04d290f, 0x66c8280f, 0xc04dd20f,
+0x55f20f66, 0xeb0f66f0, 0x15280fca, 0x000006e0,
+0xf055290f, 0x66d0280f, 0xe045d20f, 0x55d20f66,
+0xf20f66d0, 0x0f66f05d, 0x570fd3eb, 0xc1570fca,
+0xb855c35d, 0x00000001, 0x48e58948, 0x00b0ec81,
+0x280f0000, 0x0006b705, 0x85290f00, 0xffffff70,
+0x0fc0570f, 0x88804529, 0x48800544, 0x8348c0ff,
+0xf37510f8, 0x0ff6570f, 0x44807d28, 0xad05280f,
+0xba000006, 0x00000010, 0x44c6280f, 0xad0d280f,
+0x44000006, 0xb515280f, 0x0f000006, 0x01c6cc3a,
+0x60bd290f, 0x0fffffff, 0x06723d28, 0x280f0000,
+0x720f66e8, 0x0f661ed0, 0x0f02f572, 0x0f66e856,
+0x0f00ed70, 0x0f66c628, 0xff6085fa, 0x290fffff,
+0x280fa045, 0xc9380fd0, 0xffff6095, 0xc8280fff,
+0x0f3a0f66, 0xffff608d, 0x570f08ff, 0x760f66c8,
+0xd70f66ca, 0xffff3dc1, 0x850f0000, 0x00000542,
+0x0fd8280f, 0x609dca38, 0x0fffffff, 0xff608d28,
+0x280fffff, 0x3a0f66d1, 0x0f0cd00f, 0x290fd057,
+0x280f9055, 0x280f9055, 0x720f66e2, 0x0f661fd2,
+0x0f01f472, 0x0f66d456, 0x0cca0f3a, 0x0fc8570f,
+0x0f904d29, 0x0f905528, 0x0f66ca28, 0x661fd272,
+0x01f1720f, 0x66ca560f, 0x66cb760f, 0x3dc1d70f,
+0x0000ffff, 0x04df850f, 0x280f0000, 0xca380fd8,
+0xffff609d, 0xcf280fff, 0x8dfa0f66, 0xffffff70,
+0xf04d290f, 0x608d280f, 0x0fffffff, 0x0f66d128,
+0x0cd00f3a, 0x0fd0570f, 0x0f66e228, 0xff70a5f2,
+0x0f66ffff, 0x66f055d2, 0x66e2eb0f, 0xcc0f3a0f,
+0xc8570f0c, 0x66d1280f, 0x7095f20f, 0x66ffffff,
+0xf04dd20f, 0xd1eb0f66, 0xda760f66, 0xc3d70f66,
+0x00ffff3d, 0x75850f00, 0x0f000004, 0x6085c838,
+0x44ffffff, 0xa05d280f, 0xc931c031, 0xcb280f41,
+0xd3280f41, 0xf1720f66, 0x720f661e, 0x560f02d2,
+0x4d290fca, 0x8d280f90, 0xffffff60, 0x90458948,
+0x66984d89, 0x904dfe0f, 0xc1760f66, 0xc0d70f66,
+0x00ffff3d, 0x2c850f00, 0x44000004, 0x9dcc3a0f,
+0xffffff60, 0x5d280f01, 0xe3280fa0, 0xdb730f66,
+0x730f6608, 0x280f0cdc, 0x45280fcc, 0xe0280fa0,
+0xd0720f66, 0x720f6602, 0x44661ef4, 0x60b5700f,
+0x1bffffff, 0x31e0560f, 0x3a0f66c0, 0x0fa0650e,
+0x44d4280f, 0x66ec280f, 0x04da730f, 0xfc730f66,
+0x280f4404, 0xc3280fe2, 0x44d1280f, 0x66f9280f,
+0x05f2720f, 0x720f4166, 0x0f411bd7, 0x0f41c457,
+0x0f41c557, 0x0f66d756, 0x4166c2fe, 0x66c6fe0f,
+0x66c4fe0f, 0x83c5fe0f, 0x4f7401f8, 0x7402f883,
+0x75c0853c, 0xd0280f5a, 0xf8280f44, 0xf2720f66,
+0x0f41661e, 0x4102d772, 0x66d7560f, 0x66d07e0f,
+0x223a0f44, 0x0f6603e0, 0x0f66c07e, 0x02d8223a,
+0x223a0f66, 0x01b801c8, 0xeb000000, 0x3a0f6688,
+0x6602c116, 0xc9223a0f, 0x6628eb03, 0xc1163a0f,
+0x3a0f6601, 0x6603d922, 0xc9223a0f, 0x6636eb02,
+0xc1163a0f, 0x3a0f6602, 0x3903ce16, 0x2b850ff1,
+0x66000003, 0xc1163a0f, 0x3a0f6601, 0x3902ce16,
+0x1e850fce, 0x66000003, 0xd9163a0f, 0x0ff13903,
+0x00031785, 0x7e0f6600, 0x3a0f66c1, 0x3901ce16,
+0x0c850fce, 0x66000003, 0xd9163a0f, 0x0ff13902,
+0x00030585, 0xd0280f00, 0xf8280f44, 0x3a0f4466,
+0x6603e116, 0x1ef2720f, 0x720f4166, 0x0f4102d7,
+0x0f66d756, 0xf139d67e, 0x02e3850f, 0xc0ff0000,
+0x0f04f883, 0xfffedc85, 0x3a0f66ff, 0x66f0d00e,
+0xd3760f41, 0xc2d70f66, 0x00ffff3d, 0xc5850f00,
+0x44000002, 0xa06d280f, 0xd5280f41, 0x95cc380f,
+0xffffff60, 0x6085280f, 0x66ffffff, 0x0f3a0f41,
+0x290f04c5, 0x280ff045, 0x280ff045, 0x720f66d8,
+0x0f6619f0, 0x0f07d372, 0x280fd856, 0x280ff04d,
+0x720f66c1, 0x0f6612d1, 0x0f0ef072, 0x570fc156,
+0x4d280fc3, 0x720f66f0, 0x570f03d1, 0x0f4166c1,
+0x0f66c5fe, 0x0f66c276, 0xff3dc0d7, 0x0f0000ff,
+0x00025a85, 0x280f4100, 0xcd380fe5, 0xffff60a5,
+0x280f44ff, 0xffff609d, 0x280f41ff, 0x0f4166dd,
+0x08db0f3a, 0xe8c3280f, 0xfffffb76, 0xfe0f4166,
+0x0f4166c5, 0x08c30f3a, 0xfffb65e8, 0x0f4166ff,
+0x0f66c5fe, 0x0f66c476, 0xff3dc0d7, 0x0f0000ff,
+0x00021185, 0xa4458b00, 0x0f66d0f7, 0x290fd86e,
+0x280f905d, 0xffff6085, 0x280f45ff, 0x380f44e5,
+0x669065cb, 0x5d6e0f44, 0xe4570fa4, 0x570ff631,
+0x0f4466d2, 0x905d223a, 0x0f416601, 0x6644dd70,
+0x44c0700f, 0x3a0f4166, 0x6608e50f, 0xdb6c0f45,
+0xea280f44, 0x44ca280f, 0x0ff2280f, 0x66b06529,
+0x1af1720f, 0x720f4166, 0x0f4406d5, 0x44c04529,
+0x0fe9560f, 0x0f44ca28, 0x66d04d29, 0xf6720f41,
+0x720f6615, 0x0f440bd1, 0x41e05529, 0x44ce560f,
+0x44f2280f, 0x66e9570f, 0xd6720f41, 0xca280f19,
+0xf1720f66, 0x560f4107, 0x570f44ce, 0xca280fe9,
+0xcb550f41, 0xfe0f4466, 0x0f4466e9, 0x4466e8fe,
+0x31ebfe0f, 0x287c8bc0, 0x054c8bb0, 0xc08348c0,
+0x5cbd8904, 0xd3ffffff, 0x287c89cf, 0xf88348ec,
+0x0fe27510, 0x31f04d28, 0x057c8bc0, 0x054c8bb0,
+0x5cbd89d0, 0xd3ffffff, 0x057c89cf, 0xc08348f0,
+0xf8834804, 0x0fe27510, 0x31f04d57, 0x057c8bc0,
+0x054c8bb0, 0x5cbd89e0, 0xd3ffffff, 0x057c89c7,
+0xc08348f0, 0xf8834804, 0x0fe27510, 0x85f04d57,
+0x0f4166f6, 0x0f66cdfe, 0x02c9163a, 0x0f662075,
+0x0f66c87e, 0x03e1223a, 0x000001be, 0x3a0f6600,
+0x6601d022, 0xd0223a0f, 0xfef2e903, 0x0f66ffff,
+0x03e0163a, 0x850fc839, 0x000000b1, 0xc87e0f66,
+0x163a0f66, 0xc13901d1, 0x00a6850f, 0x0f660000,
+0x03d0163a, 0x850fc839, 0x0000009f, 0x760f4166,
+0xd70f66cc, 0xffff3dc1, 0x850f0000, 0x00000092,
+0x3905280f, 0x66000001, 0x6085fe0f, 0x0fffffff,
+0xff608529, 0xcaffffff, 0xfa85850f, 0xc031ffff,
+0x9ab875eb, 0xeb000000, 0x00a6b86e, 0x67eb0000,
+0x0000aeb8, 0xb860eb00, 0x000000b7, 0x08b859eb,
+0xeb000001, 0x010bb852, 0x4beb0000, 0x00010cb8,
+0xb844eb00, 0x0000010f, 0x10b83deb, 0xeb000001,
+0x0111b836, 0x2feb0000, 0x000118b8, 0xb828eb00,
+0x0000011f, 0x27b821eb, 0xeb000001, 0x017bb81a,
+0x13eb0000, 0x00017db8, 0xb80ceb00, 0x0000017f,
+0x82b805eb, 0xc9000001, 0x000000c3, 0x00000000,
+0x00000011, 0x00000000, 0x00000000, 0x00000000,
+0x00000013, 0x00000000, 0x00000000, 0x00000000,
+0x0000000a, 0x00000000, 0x00000000, 0x00000000,
+0x0000000f, 0x00000000, 0x00000000, 0x00000000,
+0x0000000d, 0x00000000, 0x00000000, 0x00000000,
+0x00000001, 0x00000000, 0x00000000, 0x00000000,
+0x00000020, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000002, 0x00000002,
+0x00000000, 0x00000000, 0x0000000d, 0x0000000d,
+0x00000000, 0x00000000, 0x0000000a, 0x0000000a,
+0x10101010, 0x10101010, 0x10101010, 0x10101010,
+0003640,
+};
+asm(".type sse4_sha_x86_64_D_16, STT_NOTYPE;");
+asm(".type sse4_sha_x86_64_D_16, STT_FUNC;");
@@ -0,0 +1,140 @@
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) ssse3_pclmul_x86_32_D_16[] = {
+0x83e58955, 0x02e8f0e4, 0xc9000000, 0x570f55c3,
+0x57e589c9, 0xec815356, 0x000000ac, 0xa84d290f,
+0x019445c7, 0x8b000000, 0x458a945d, 0x9445ff94,
+0x10947d83, 0xa81d4488, 0x280fed75, 0x290fa875,
+0x570f9875, 0x75290ff6, 0x4d280fb8, 0x3a0f6698,
+0x00b84d44, 0x4dd60f66, 0x4d290f88, 0x88458bc8,
+0x338c558b, 0x0ff3b845, 0xf3d04d7e, 0xc0557e0f,
+0x0fbc5533, 0xd009ca57, 0x31c0940f, 0xc0b60fd2,
+0x4589d8f7, 0x00d28388, 0x5589daf7, 0x7e0f668c,
+0x730f66ca, 0x0f6620d1, 0xc209c87e, 0x4d7e0ff3,
+0xc0940f88, 0xb60fd231, 0x89d8f7c0, 0xd2838845,
+0x89daf700, 0x160f8c55, 0x0f66884d, 0xff3dc1d7,
+0x0f0000ff, 0x00038d85, 0xb845c700, 0x00000001,
+0x4589c031, 0x4d280fbc, 0x3a0f66b8, 0x00984d44,
+0x4dd60f66, 0x884d8b88, 0x0f8c5d8b, 0x66b84d28,
+0x4d443a0f, 0x0f661098, 0x8b884dd6, 0x7d8b8875,
+0x65280f8c, 0xd60f6698, 0x458b8865, 0x65170f88,
+0x8c558b80, 0xda31c831, 0x940fd009, 0x0fd231c0,
+0xd8f7c0b6, 0x83884589, 0x458b00d2, 0x89daf780,
+0x558b8c55, 0x7e0ff384, 0xf031884d, 0xd009fa31,
+0x31c0940f, 0xc0b60fd2, 0x4589d8f7, 0x00d28388,
+0x5589daf7, 0x4d160f8c, 0xd70f6688, 0xffff3dc1,
+0x850f0000, 0x000002f5, 0x66cc280f, 0x4d443a0f,
+0x0f661098, 0x0f884dd6, 0x8bc84d29, 0x558b8845,
+0xcc280f8c, 0x443a0f66, 0x6601984d, 0x884dd60f,
+0x8b884d8b, 0x170f8c5d, 0xc131804d, 0xd331c031,
+0x940fd909, 0xf7d231c0, 0x884589d8, 0x8b00d283,
+0x45338045, 0x89daf7d0, 0x558b8c55, 0xd4553384,
+0x4d7e0ff3, 0x0fd00988, 0xd231c094, 0xf7c0b60f,
+0x884589d8, 0xf700d283, 0x8c5589da, 0x884d160f,
+0xc1d70f66, 0x00ffff3d, 0x75850f00, 0x0f000002,
+0x0f66ec28, 0x986d443a, 0x6d290f00, 0x3a0f66c8,
+0x11986544, 0xd865290f, 0x31fe280f, 0x3a0f66c9,
+0x0f08fd0f, 0xff68bd29, 0xff31ffff, 0x66fe280f,
+0xfc0f3a0f, 0xbd290f08, 0xffffff58, 0x0fdd280f,
+0xc889d428, 0xf96e0f66, 0xe083d8f7, 0x6e0f663f,
+0xf30f66c8, 0xcc280fd1, 0xcfd30f66, 0x66d1560f,
+0x885dd60f, 0x0f88458b, 0xff789d17, 0x558bffff,
+0x33cb898c, 0x5533c845, 0x0fd009cc, 0xd231c094,
+0xf7c0b60f, 0x804589d8, 0x8b00d283, 0xffff7885,
+0xd04533ff, 0x5589daf7, 0x7c958b84, 0x33ffffff,
+0x0ff3d455, 0x09804d7e, 0xc0940fd0, 0xb60fd231,
+0x89d8f7c0, 0xd2838045, 0x89daf700, 0x160f8455,
+0x0f66804d, 0xff3dc1d7, 0x0f0000ff, 0x0001aa85,
+0xd60f6600, 0x458b8055, 0x95170f80, 0xffffff50,
+0x3384558b, 0x5533d845, 0x0fd009dc, 0xd231c094,
+0xf7c0b60f, 0x788589d8, 0x83ffffff, 0x858b00d2,
+0xffffff50, 0xf7e04533, 0x7c9589da, 0x8bffffff,
+0xffff5495, 0xe45533ff, 0x8d7e0ff3, 0xffffff78,
+0x940fd009, 0x0fd231c0, 0xd8f7c0b6, 0xff788589,
+0xd283ffff, 0x89daf700, 0xffff7c95, 0x8d160fff,
+0xffffff78, 0xc1d70f66, 0x00ffff3d, 0x2f850f00,
+0x0f000001, 0x66984d28, 0x31d76e0f, 0xd30f66f6,
+0x88458bca, 0x8dd60f66, 0xffffff78, 0xff78958b,
+0xe083ffff, 0x01e28303, 0x850ff685, 0x00000109,
+0x850fc239, 0x00000101, 0x0f80458b, 0x8b884d17,
+0xe0838855, 0x01e28303, 0x850ff685, 0x000000f0,
+0x850fc239, 0x000000e8, 0x66d6280f, 0x550f3a0f,
+0x280f08c8, 0x0f66c84d, 0x663ef273, 0x02d1730f,
+0x0fca560f, 0x0fc84d29, 0x6647d628, 0x550f3a0f,
+0x280f08d8, 0xc183d84d, 0x40ff8302, 0xd1730f66,
+0x730f6602, 0x560f3ef2, 0x4d290fca, 0x0f5a74d8,
+0xff589528, 0xf983ffff, 0x0f2c773f, 0xff689d28,
+0xfeb8ffff, 0x66ffffff, 0x29f96e0f, 0x3fe083d8,
+0xc86e0f66, 0xd9f30f66, 0x66cd280f, 0x0fcfd30f,
+0x1be9d956, 0x0ffffffe, 0xff689d28, 0x438dffff,
+0x6e0f66c2, 0x95280fc8, 0xffffff58, 0xd9d30f66,
+0xd1d30f66, 0xfffe16e9, 0x0d280fff, 0x00100490,
+0x66944dff, 0x984dd40f, 0x984d290f, 0xfbf0850f,
+0xc031ffff, 0x56b82feb, 0xeb000000, 0x0064b828,
+0x21eb0000, 0x000073b8, 0xb81aeb00, 0x00000081,
+0x82b813eb, 0xeb000000, 0x0088b80c, 0x05eb0000,
+0x000089b8, 0xacc48100, 0x5b000000, 0xc35d5f5e,
+0x10101010, 0x10101010, 0x10101010, 0x10101010,
+0002240,
+};
+asm(".type ssse3_pclmul_x86_32_D_16, STT_NOTYPE;");
+asm(".type ssse3_pclmul_x86_32_D_16, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) ssse3_pclmul_x86_64_D_16[] = {
+0x0f5500eb, 0x01b8c957, 0x48000000, 0x290fe589,
+0x4488c04d, 0xff48c005, 0xf88348c0, 0x0ff37510,
+0xbec06d28, 0x00000010, 0xc0570f45, 0xb06d290f,
+0x45290f44, 0x4d280fd0, 0x3a0f66b0, 0x00d04d44,
+0x7e0f4866, 0x4d290fc8, 0x453b48e0, 0xc0940fd0,
+0x48c0b60f, 0x4866d8f7, 0x48c86e0f, 0x48d8458b,
+0x0fe84539, 0xb60fc094, 0xd8f748c0, 0x6e0f4866,
+0x6c0f66f0, 0xd70f66ce, 0xffff3dc1, 0x850f0000,
+0x000002b6, 0xd045c748, 0x00000001, 0xd04d280f,
+0x66d1280f, 0x55443a0f, 0x486600b0, 0x66d27e0f,
+0x4d443a0f, 0x486610b0, 0x0fc87e0f, 0x66b04d28,
+0xc97e0f48, 0x48f9120f, 0x940fca39, 0xd2b60fc2,
+0x66daf748, 0xd26e0f48, 0x7e0f4866, 0xd03948fa,
+0x0fc0940f, 0xf748c0b6, 0x0f4866d8, 0x0f66e86e,
+0x0f66d56c, 0xff3dc2d7, 0x0f0000ff, 0x00025085,
+0xd1280f00, 0x443a0f66, 0x6610b055, 0xd27e0f48,
+0xe055290f, 0x66d9280f, 0x5d443a0f, 0x486601b0,
+0x0fd87e0f, 0x3948e312, 0xc0940fc2, 0x48c0b60f,
+0x4866d8f7, 0x66d06e0f, 0xe07e0f48, 0xe8453948,
+0x0fc0940f, 0xf748c0b6, 0x0f4866d8, 0x0f66f06e,
+0x0f66d66c, 0xff3dc2d7, 0x0f0000ff, 0x0001f785,
+0xe1280f00, 0x443a0f66, 0x0f00b065, 0x66e06529,
+0x4d443a0f, 0x290f11b0, 0x570ff04d, 0xdc280fed,
+0x31d1280f, 0xfd280fd2, 0x31f5280f, 0xfeba41ff,
+0x66ffffff, 0xf90f3a0f, 0x3a0f6608, 0x4408f40f,
+0x89cf280f, 0x0f4466d0, 0x0f44da6e, 0xd8f7d128,
+0xd30f4566, 0x3fe083d3, 0x6e0f4c66, 0x0f4166e8,
+0x0f41d5f3, 0x4966d256, 0x31db7e0f, 0x5d394cc0,
+0x730f66e0, 0x940f08db, 0xd18941c0, 0x48d8f748,
+0x4866c189, 0x48d87e0f, 0x0fe84539, 0x4866c094,
+0x0fd96e0f, 0xf748c0b6, 0x0f4c66d8, 0x4166f06e,
+0x66de6c0f, 0x3dc3d70f, 0x0000ffff, 0x014d850f,
+0x49660000, 0x31d07e0f, 0xda120fc0, 0xf045394c,
+0x48c0940f, 0x8948d8f7, 0x0f4866c1, 0x3948d87e,
+0x940ff845, 0x0f4866c0, 0xb60fd16e, 0xd8f748c0,
+0x6e0f4866, 0x6c0f66d8, 0xd70f66d3, 0xffff3dc2,
+0x850f0000, 0x0000010e, 0x280ff889, 0x8341b055,
+0x486603e3, 0x66d86e0f, 0x66d3d30f, 0xd07e0f48,
+0x4c01e083, 0x850fd839, 0x000000f1, 0x41da120f,
+0x6603e083, 0xd87e0f48, 0x4c01e083, 0x850fc039,
+0x000000e0, 0xe055280f, 0x66dd280f, 0xda0f3a0f,
+0x730f6608, 0x0f6602d2, 0x0f3ef373, 0x290fd356,
+0x280fe055, 0x280ff055, 0x83c7ffdd, 0x0f6602c2,
+0x08da0f3a, 0xd2730f66, 0x730f6602, 0x560f3ef3,
+0x55290fd3, 0x40ff83f0, 0x0f415474, 0xfa83d128,
+0x0f2d773f, 0x4466de28, 0x44da6e0f, 0x44d4280f,
+0x2944d089, 0x0f4566c8, 0xe083d3d3, 0x0f4c663f,
+0x4166e06e, 0x41dcf30f, 0xe9da560f, 0xfffffe93,
+0xc2418d41, 0x0fde280f, 0x4c66d728, 0x66d06e0f,
+0xdad30f41, 0xd30f4166, 0xfe98e9d2, 0x280fffff,
+0x00004b0d, 0xd40f6600, 0x290fb04d, 0xceffb04d,
+0xfcfa850f, 0xc031ffff, 0x56b82feb, 0xeb000000,
+0x0064b828, 0x21eb0000, 0x000073b8, 0xb81aeb00,
+0x00000081, 0x82b813eb, 0xeb000000, 0x0088b80c,
+0x05eb0000, 0x000089b8, 0x00c35d00, 0x00000000,
+0x10101010, 0x10101010, 0x10101010, 0x10101010,
+0001600,
+};
+asm(".type ssse3_pclmul_x86_64_D_16, STT_NOTYPE;");
+asm(".type ssse3_pclmul_x86_64_D_16, STT_FUNC;");
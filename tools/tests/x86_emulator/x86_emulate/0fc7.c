@@ -0,0 +1 @@
+/root/repo/tools/tests/x86_emulator/../../../xen/arch/x86/x86_emulate/0fc7.c
\ No newline at end of file
@@ -0,0 +1,1049 @@
+/* SPDX-License-Identifier: GPL-2.0-only */
+/*
+ * bench-xenstore.c
+ *
+ * Generate Xenstore load and measure the performance of xenstored.
+ *
+ * A number of client processes connect to xenstored via its socket and
+ * replay the Xenstore traffic of a toolstack creating and destroying
+ * domains: domain directories written in transactions, frontend and backend
+ * device directories with their permissions, the device state handshake
+ * using watches, and the removal of it all.  Another process plays the
+ * backend driver of dom0, watching the whole backend directory.  All nodes
+ * are created below a private directory, so the benchmark can be run
+ * against a live system.
+ *
+ * Reported are latency percentiles per operation, the request throughput
+ * per phase and the memory used by xenstored per node.
+ */
+
+#define _GNU_SOURCE
+#include <ctype.h>
+#include <dirent.h>
+#include <err.h>
+#include <errno.h>
+#include <getopt.h>
+#include <inttypes.h>
+#include <poll.h>
+#include <signal.h>
+#include <stdarg.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <xenstore.h>
+
+#include <xen-tools/common-macros.h>
+
+#define BENCH_PATH      "/bench-xenstore"
+#define PATH_LEN        256
+#define UUID_LEN        37
+#define EVENT_TIMEOUT   10000   /* msecs */
+#define MAX_TA_LOOPS    100
+
+enum op {
+    OP_READ,
+    OP_WRITE,
+    OP_DIRECTORY,
+    OP_MKDIR,
+    OP_RM,
+    OP_SET_PERMS,
+    OP_WATCH,
+    OP_UNWATCH,
+    OP_TRANSACTION,
+    OP_EVENT,
+    OP_N
+};
+
+static const char *op_names[OP_N] = {
+    [OP_READ]        = "read",
+    [OP_WRITE]       = "write",
+    [OP_DIRECTORY]   = "directory",
+    [OP_MKDIR]       = "mkdir",
+    [OP_RM]          = "rm",
+    [OP_SET_PERMS]   = "set-perms",
+    [OP_WATCH]       = "watch",
+    [OP_UNWATCH]     = "unwatch",
+    [OP_TRANSACTION] = "transaction",
+    [OP_EVENT]       = "watch-event",
+};
+
+enum phase {
+    PHASE_CREATE,
+    PHASE_DESTROY,
+    PHASE_N
+};
+
+static const char *phase_names[PHASE_N] = {
+    [PHASE_CREATE]  = "create",
+    [PHASE_DESTROY] = "destroy",
+};
+
+struct latencies {
+    uint64_t *ns;
+    uint32_t n;
+    uint32_t size;
+};
+
+/* Results of a client, sent to the parent at the end. */
+struct client_stats {
+    uint64_t requests[PHASE_N];
+    uint64_t ta_retries;
+    uint64_t errors[OP_N];
+};
+
+static unsigned int n_clients = 16;
+static unsigned int n_domains = 10;
+static unsigned int n_devices = 4;
+static unsigned int n_vcpus = 2;
+static unsigned int n_rounds = 1;
+static pid_t xenstored_pid;
+
+static char *root;
+
+/* Pipes for synchronizing the phases of the clients. */
+static int go_pipe[2], done_pipe[2];
+
+/* Client state. */
+static struct xs_handle *xsh;
+static struct latencies lats[OP_N];
+static struct client_stats stats;
+static enum phase phase;
+
+static struct option options[] = {
+    { "clients", 1, NULL, 'c' },
+    { "domains", 1, NULL, 'd' },
+    { "devices", 1, NULL, 'D' },
+    { "vcpus", 1, NULL, 'v' },
+    { "rounds", 1, NULL, 'r' },
+    { "pid", 1, NULL, 'p' },
+    { "help", 0, NULL, 'h' },
+    { NULL, 0, NULL, 0 }
+};
+
+static void usage(int ret)
+{
+    FILE *out;
+
+    out = ret ? stderr : stdout;
+
+    fprintf(out, "usage: bench-xenstore [<options>]\n");
+    fprintf(out, "  <options> are:\n");
+    fprintf(out, "  -c|--clients <n>   number of concurrent clients (default 16)\n");
+    fprintf(out, "  -d|--domains <n>   domains created by each client (default 10)\n");
+    fprintf(out, "  -D|--devices <n>   devices per domain (default 4)\n");
+    fprintf(out, "  -v|--vcpus <n>     vcpus per domain (default 2)\n");
+    fprintf(out, "  -r|--rounds <n>    create/destroy rounds (default 1)\n");
+    fprintf(out, "  -p|--pid <pid>     pid of xenstored for memory statistics\n");
+    fprintf(out, "                     (default: search for it in /proc)\n");
+    fprintf(out, "  -h|--help          print this usage information\n");
+    fprintf(out, "The Xenstore socket is taken from XENSTORED_PATH, if set.\n");
+    exit(ret);
+}
+
+static uint64_t now_ns(void)
+{
+    struct timespec tp;
+
+    clock_gettime(CLOCK_MONOTONIC, &tp);
+
+    return tp.tv_sec * 1000000000ULL + tp.tv_nsec;
+}
+
+/* Format a path into a buffer of PATH_LEN bytes. */
+static void __attribute__((format(printf, 2, 3)))
+path_fmt(char *buf, const char *fmt, ...)
+{
+    va_list ap;
+
+    va_start(ap, fmt);
+    if ( vsnprintf(buf, PATH_LEN, fmt, ap) >= PATH_LEN )
+        errx(2, "path too long");
+    va_end(ap);
+}
+
+static void record(enum op op, uint64_t start, bool ok)
+{
+    struct latencies *lat = lats + op;
+
+    if ( lat->n == lat->size )
+    {
+        lat->size = lat->size ? 2 * lat->size : 1024;
+        lat->ns = realloc(lat->ns, lat->size * sizeof(*lat->ns));
+        if ( !lat->ns )
+            err(2, "realloc() failure");
+    }
+    lat->ns[lat->n++] = now_ns() - start;
+
+    if ( op != OP_EVENT && op != OP_TRANSACTION )
+        stats.requests[phase]++;
+    if ( !ok )
+        stats.errors[op]++;
+}
+
+/*
+ * Wrappers of the Xenstore operations, recording their latencies.
+ * Failing operations are counted, but don't stop the benchmark.
+ */
+static char *b_read(xs_transaction_t t, const char *path)
+{
+    uint64_t start = now_ns();
+    unsigned int len;
+    char *val;
+
+    val = xs_read(xsh, t, path, &len);
+    record(OP_READ, start, val);
+
+    return val;
+}
+
+static void b_write(xs_transaction_t t, const char *path, const char *val)
+{
+    uint64_t start = now_ns();
+
+    record(OP_WRITE, start, xs_write(xsh, t, path, val, strlen(val)));
+}
+
+static void b_directory(xs_transaction_t t, const char *path)
+{
+    uint64_t start = now_ns();
+    unsigned int num;
+    char **dir;
+
+    dir = xs_directory(xsh, t, path, &num);
+    record(OP_DIRECTORY, start, dir);
+    free(dir);
+}
+
+static void b_mkdir(xs_transaction_t t, const char *path,
+                    struct xs_permissions *perms, unsigned int num_perms)
+{
+    uint64_t start = now_ns();
+
+    record(OP_MKDIR, start, xs_mkdir(xsh, t, path));
+
+    start = now_ns();
+    record(OP_SET_PERMS, start,
+           xs_set_permissions(xsh, t, path, perms, num_perms));
+}
+
+static void b_rm(xs_transaction_t t, const char *path)
+{
+    uint64_t start = now_ns();
+
+    record(OP_RM, start, xs_rm(xsh, t, path));
+}
+
+static void b_watch(const char *path, const char *token)
+{
+    uint64_t start = now_ns();
+
+    record(OP_WATCH, start, xs_watch(xsh, path, token));
+}
+
+static void b_unwatch(const char *path, const char *token)
+{
+    uint64_t start = now_ns();
+
+    record(OP_UNWATCH, start, xs_unwatch(xsh, path, token));
+}
+
+static xs_transaction_t b_transaction_start(void)
+{
+    xs_transaction_t t;
+
+    t = xs_transaction_start(xsh);
+    stats.requests[phase]++;
+    if ( t == XBT_NULL )
+        stats.errors[OP_TRANSACTION]++;
+
+    return t;
+}
+
+/* Returns true if the transaction needs to be repeated. */
+static bool b_transaction_end(xs_transaction_t t, uint64_t start,
+                              unsigned int loop)
+{
+    bool ok;
+
+    ok = xs_transaction_end(xsh, t, false);
+    stats.requests[phase]++;
+    if ( !ok && errno == EAGAIN && loop < MAX_TA_LOOPS )
+    {
+        stats.ta_retries++;
+        return true;
+    }
+
+    record(OP_TRANSACTION, start, ok);
+
+    return false;
+}
+
+/* Wait for the watch event of path, returns false after a timeout. */
+static bool wait_event(const char *path)
+{
+    struct pollfd pfd = { .fd = xs_fileno(xsh), .events = POLLIN };
+    unsigned int num;
+    char **vec;
+    bool found;
+
+    for ( ;; )
+    {
+        if ( poll(&pfd, 1, EVENT_TIMEOUT) <= 0 )
+            return false;
+        vec = xs_read_watch(xsh, &num);
+        if ( !vec )
+            return false;
+        found = !strcmp(vec[XS_WATCH_PATH], path);
+        free(vec);
+        if ( found )
+            return true;
+    }
+}
+
+/* Write a list of key/value pairs, terminated by NULL, below dir. */
+static void write_kvs(xs_transaction_t t, const char *dir, const char **kvs)
+{
+    char path[PATH_LEN];
+
+    for ( ; kvs[0]; kvs += 2 )
+    {
+        path_fmt(path, "%s/%s", dir, kvs[0]);
+        b_write(t, path, kvs[1]);
+    }
+}
+
+static void domain_uuid(unsigned int domid, char *uuid)
+{
+    snprintf(uuid, UUID_LEN, "%08x-%04x-4000-8000-000000000000",
+             domid, getpid() & 0xffff);
+}
+
+static void domain_paths(unsigned int domid, char *dom, char *vm, char *lx)
+{
+    char uuid[UUID_LEN];
+
+    domain_uuid(domid, uuid);
+    path_fmt(dom, "%s/local/domain/%u", root, domid);
+    path_fmt(vm, "%s/vm/%s", root, uuid);
+    path_fmt(lx, "%s/libxl/%u", root, domid);
+}
+
+static void domain_create(unsigned int domid)
+{
+    static const char *rw_dirs[] = {
+        "device", "control/shutdown", "control/feature-poweroff",
+        "control/feature-reboot", "data", "drivers", "feature", "attr",
+        "error",
+    };
+    struct xs_permissions ro_perms[2] = {
+        { .id = 0, .perms = XS_PERM_NONE },
+        { .id = domid, .perms = XS_PERM_READ },
+    };
+    /*
+     * The guest should own the nodes it may write, but the domains don't
+     * exist, and xenstored refuses to make an unknown domain the owner.
+     * Grant write access explicitly instead, costing the same requests.
+     */
+    struct xs_permissions rw_perms[2] = {
+        { .id = 0, .perms = XS_PERM_NONE },
+        { .id = domid, .perms = XS_PERM_READ | XS_PERM_WRITE },
+    };
+    char dom[PATH_LEN], vm[PATH_LEN], lx[PATH_LEN], path[PATH_LEN];
+    char id[12], name[32], uuid[UUID_LEN];
+    const char *dom_kvs[] = {
+        "name", name,
+        "domid", id,
+        "vm", vm + strlen(root),
+        "memory/static-max", "1048576",
+        "memory/target", "1048576",
+        "memory/videoram", "-1",
+        "control/platform-feature-multiprocessor-suspend", "1",
+        "control/platform-feature-xs_reset_watches", "1",
+        NULL
+    };
+    const char *vm_kvs[] = {
+        "uuid", uuid,
+        "name", name,
+        "start_time", "1700000000.00",
+        "image/ostype", "hvm",
+        NULL
+    };
+    const char *lx_kvs[] = {
+        "type", "hvm",
+        "dm-version", "qemu_xen",
+        NULL
+    };
+    xs_transaction_t t;
+    unsigned int i, loop = 0;
+    uint64_t start;
+
+    domain_paths(domid, dom, vm, lx);
+    domain_uuid(domid, uuid);
+    snprintf(id, sizeof(id), "%u", domid);
+    snprintf(name, sizeof(name), "bench-%u", domid);
+
+    do {
+        start = now_ns();
+        t = b_transaction_start();
+
+        b_rm(t, dom);
+        b_mkdir(t, dom, ro_perms, ARRAY_SIZE(ro_perms));
+        for ( i = 0; i < ARRAY_SIZE(rw_dirs); i++ )
+        {
+            path_fmt(path, "%s/%s", dom, rw_dirs[i]);
+            b_mkdir(t, path, rw_perms, ARRAY_SIZE(rw_perms));
+        }
+        b_mkdir(t, vm, ro_perms, ARRAY_SIZE(ro_perms));
+        b_mkdir(t, lx, ro_perms, 1);
+
+        write_kvs(t, dom, dom_kvs);
+        for ( i = 0; i < n_vcpus; i++ )
+        {
+            path_fmt(path, "%s/cpu/%u/availability", dom, i);
+            b_write(t, path, "online");
+        }
+        write_kvs(t, vm, vm_kvs);
+        write_kvs(t, lx, lx_kvs);
+    } while ( b_transaction_end(t, start, loop++) );
+
+    /* The toolstack checks the domain is there. */
+    path_fmt(path, "%s/name", dom);
+    free(b_read(XBT_NULL, path));
+}
+
+/* Devices are alternating network and disk devices. */
+static void device_paths(unsigned int domid, unsigned int dev, char *be,
+                         char *fe, char *lx, unsigned int *devid)
+{
+    const char *type = (dev & 1) ? "vbd" : "vif";
+
+    *devid = (dev & 1) ? 51712 + (dev / 2) * 16 : dev / 2;
+    path_fmt(be, "%s/local/domain/0/backend/%s/%u/%u",
+             root, type, domid, *devid);
+    path_fmt(fe, "%s/local/domain/%u/device/%s/%u",
+             root, domid, type, *devid);
+    path_fmt(lx, "%s/libxl/%u/device/%s/%u",
+             root, domid, type, *devid);
+}
+
+static void device_add(unsigned int domid, unsigned int dev)
+{
+    struct xs_permissions be_perms[2] = {
+        { .id = 0, .perms = XS_PERM_NONE },
+        { .id = domid, .perms = XS_PERM_READ },
+    };
+    struct xs_permissions fe_perms[2] = {
+        { .id = 0, .perms = XS_PERM_NONE },
+        { .id = domid, .perms = XS_PERM_READ | XS_PERM_WRITE },
+    };
+    char be[PATH_LEN], fe[PATH_LEN], lx[PATH_LEN], path[PATH_LEN];
+    char id[12], handle[12], mac[18];
+    const char *be_kvs[] = {
+        "frontend", fe + strlen(root),
+        "frontend-id", id,
+        "online", "1",
+        "state", "1",
+        "handle", handle,
+        NULL, NULL,
+        NULL, NULL,
+        NULL, NULL,
+        NULL
+    };
+    const char *fe_kvs[] = {
+        "backend", be + strlen(root),
+        "backend-id", "0",
+        "state", "1",
+        "handle", handle,
+        NULL, NULL,
+        NULL
+    };
+    const char *lx_kvs[] = {
+        "frontend", fe + strlen(root),
+        "backend", be + strlen(root),
+        NULL
+    };
+    xs_transaction_t t;
+    unsigned int devid, loop = 0;
+    uint64_t start;
+
+    device_paths(domid, dev, be, fe, lx, &devid);
+    snprintf(id, sizeof(id), "%u", domid);
+    snprintf(handle, sizeof(handle), "%u", devid);
+    snprintf(mac, sizeof(mac), "00:16:3e:%02x:%02x:%02x",
+             (domid >> 8) & 0xff, domid & 0xff, devid & 0xff);
+    if ( dev & 1 )
+    {
+        be_kvs[10] = "params";
+        be_kvs[11] = "/dev/vg/disk";
+        be_kvs[12] = "type";
+        be_kvs[13] = "phy";
+        be_kvs[14] = "mode";
+        be_kvs[15] = "w";
+        fe_kvs[8] = "virtual-device";
+        fe_kvs[9] = handle;
+    }
+    else
+    {
+        be_kvs[10] = "mac";
+        be_kvs[11] = mac;
+        be_kvs[12] = "bridge";
+        be_kvs[13] = "xenbr0";
+        be_kvs[14] = "script";
+        be_kvs[15] = "/etc/xen/scripts/vif-bridge";
+        fe_kvs[8] = "mac";
+        fe_kvs[9] = mac;
+    }
+
+    do {
+        start = now_ns();
+        t = b_transaction_start();
+
+        b_mkdir(t, be, be_perms, ARRAY_SIZE(be_perms));
+        b_mkdir(t, fe, fe_perms, ARRAY_SIZE(fe_perms));
+        write_kvs(t, be, be_kvs);
+        write_kvs(t, fe, fe_kvs);
+        write_kvs(t, lx, lx_kvs);
+    } while ( b_transaction_end(t, start, loop++) );
+
+    /* State handshake of backend and frontend. */
+    path_fmt(path, "%s/state", fe);
+    b_watch(path, "fe");
+    if ( !wait_event(path) )
+        stats.errors[OP_EVENT]++;
+
+    path_fmt(path, "%s/state", be);
+    b_write(XBT_NULL, path, "2");
+
+    path_fmt(path, "%s/state", fe);
+    free(b_read(XBT_NULL, path));
+    start = now_ns();
+    b_write(XBT_NULL, path, "4");
+    record(OP_EVENT, start, wait_event(path));
+
+    path_fmt(path, "%s/state", be);
+    b_write(XBT_NULL, path, "4");
+    path_fmt(path, "%s/hotplug-status", be);
+    b_write(XBT_NULL, path, "connected");
+
+    /* The toolstack waits for the device. */
+    free(b_read(XBT_NULL, path));
+    path_fmt(path, "%s/state", be);
+    free(b_read(XBT_NULL, path));
+}
+
+static void device_remove(unsigned int domid, unsigned int dev)
+{
+    char be[PATH_LEN], fe[PATH_LEN], lx[PATH_LEN], path[PATH_LEN];
+    xs_transaction_t t;
+    unsigned int devid, loop = 0;
+    uint64_t start;
+
+    device_paths(domid, dev, be, fe, lx, &devid);
+
+    path_fmt(path, "%s/state", be);
+    b_write(XBT_NULL, path, "5");
+    path_fmt(path, "%s/state", fe);
+    b_write(XBT_NULL, path, "6");
+    if ( !wait_event(path) )
+        stats.errors[OP_EVENT]++;
+    b_unwatch(path, "fe");
+    path_fmt(path, "%s/state", be);
+    b_write(XBT_NULL, path, "6");
+    free(b_read(XBT_NULL, path));
+
+    do {
+        start = now_ns();
+        t = b_transaction_start();
+
+        b_rm(t, be);
+        b_rm(t, fe);
+        b_rm(t, lx);
+    } while ( b_transaction_end(t, start, loop++) );
+}
+
+static void domain_destroy(unsigned int domid)
+{
+    char dom[PATH_LEN], vm[PATH_LEN], lx[PATH_LEN], path[PATH_LEN];
+    xs_transaction_t t;
+    unsigned int loop = 0;
+    uint64_t start;
+
+    domain_paths(domid, dom, vm, lx);
+
+    do {
+        start = now_ns();
+        t = b_transaction_start();
+
+        b_rm(t, dom);
+        b_rm(t, vm);
+        b_rm(t, lx);
+        path_fmt(path, "%s/local/domain/0/backend/vif/%u",
+                 root, domid);
+        b_rm(t, path);
+        path_fmt(path, "%s/local/domain/0/backend/vbd/%u",
+                 root, domid);
+        b_rm(t, path);
+    } while ( b_transaction_end(t, start, loop++) );
+}
+
+static void read_all(int fd, void *data, size_t len)
+{
+    char *buf = data;
+    ssize_t ret;
+
+    while ( len )
+    {
+        ret = read(fd, buf, len);
+        if ( ret <= 0 )
+            errx(2, "short read from client");
+        buf += ret;
+        len -= ret;
+    }
+}
+
+static void write_all(int fd, const void *data, size_t len)
+{
+    const char *buf = data;
+    ssize_t ret;
+
+    while ( len )
+    {
+        ret = write(fd, buf, len);
+        if ( ret <= 0 )
+            err(2, "write to parent failed");
+        buf += ret;
+        len -= ret;
+    }
+}
+
+static void client_sync(void)
+{
+    char c = 0;
+
+    write_all(done_pipe[1], &c, 1);
+    read_all(go_pipe[0], &c, 1);
+}
+
+static void client(unsigned int idx, int result_fd)
+{
+    char path[PATH_LEN];
+    unsigned int r, d, dev, domid;
+    enum op op;
+
+    xsh = xs_open(0);
+    if ( !xsh )
+        err(2, "client %u: could not connect to xenstore", idx);
+
+    client_sync();
+
+    for ( r = 0; r < n_rounds; r++ )
+    {
+        phase = PHASE_CREATE;
+        for ( d = 0; d < n_domains; d++ )
+        {
+            domid = 1 + idx * n_domains + d;
+            domain_create(domid);
+            for ( dev = 0; dev < n_devices; dev++ )
+                device_add(domid, dev);
+
+            /* The toolstack lists the devices of the new domain. */
+            path_fmt(path, "%s/local/domain/%u/device/vif",
+                     root, domid);
+            b_directory(XBT_NULL, path);
+            path_fmt(path, "%s/local/domain/%u/device/vbd",
+                     root, domid);
+            b_directory(XBT_NULL, path);
+        }
+        client_sync();
+
+        phase = PHASE_DESTROY;
+        for ( d = 0; d < n_domains; d++ )
+        {
+            domid = 1 + idx * n_domains + d;
+            for ( dev = 0; dev < n_devices; dev++ )
+                device_remove(domid, dev);
+            domain_destroy(domid);
+        }
+        client_sync();
+    }
+
+    xs_close(xsh);
+
+    for ( op = 0; op < OP_N; op++ )
+    {
+        write_all(result_fd, &lats[op].n, sizeof(lats[op].n));
+        write_all(result_fd, lats[op].ns, lats[op].n * sizeof(*lats[op].ns));
+    }
+    write_all(result_fd, &stats, sizeof(stats));
+
+    exit(0);
+}
+
+/* Play the dom0 backend driver, counting the events of all backends. */
+static void watcher(volatile uint64_t *events)
+{
+    char path[PATH_LEN];
+    unsigned int num;
+    char **vec;
+
+    xsh = xs_open(0);
+    if ( !xsh )
+        err(2, "watcher: could not connect to xenstore");
+
+    path_fmt(path, "%s/local/domain/0/backend", root);
+    if ( !xs_watch(xsh, path, "backend") )
+        err(2, "watcher: could not set watch");
+
+    while ( (vec = xs_read_watch(xsh, &num)) )
+    {
+        (*events)++;
+        free(vec);
+    }
+
+    exit(0);
+}
+
+/* Wait for all clients reaching the next synchronization point. */
+static void clients_wait(void)
+{
+    unsigned int i;
+    char c;
+
+    for ( i = 0; i < n_clients; i++ )
+        read_all(done_pipe[0], &c, 1);
+}
+
+static void clients_go(void)
+{
+    unsigned int i;
+    char c = 0;
+
+    for ( i = 0; i < n_clients; i++ )
+        write_all(go_pipe[1], &c, 1);
+}
+
+static unsigned long xenstored_rss(pid_t pid)
+{
+    char path[64], line[128];
+    unsigned long rss = 0;
+    FILE *f;
+
+    if ( !pid )
+        return 0;
+
+    path_fmt(path, "/proc/%d/status", pid);
+    f = fopen(path, "r");
+    if ( !f )
+        return 0;
+
+    while ( fgets(line, sizeof(line), f) )
+        if ( sscanf(line, "VmRSS: %lu", &rss) == 1 )
+            break;
+
+    fclose(f);
+
+    return rss;
+}
+
+static pid_t find_xenstored(void)
+{
+    char path[64], comm[32];
+    struct dirent *de;
+    pid_t pid = 0;
+    DIR *dir;
+    FILE *f;
+
+    dir = opendir("/proc");
+    if ( !dir )
+        return 0;
+
+    while ( !pid && (de = readdir(dir)) )
+    {
+        if ( !isdigit(de->d_name[0]) )
+            continue;
+        path_fmt(path, "/proc/%s/comm", de->d_name);
+        f = fopen(path, "r");
+        if ( !f )
+            continue;
+        if ( fgets(comm, sizeof(comm), f) &&
+             (!strcmp(comm, "xenstored\n") || !strcmp(comm, "oxenstored\n")) )
+            pid = atoi(de->d_name);
+        fclose(f);
+        /* Skip zombies of a previous instance. */
+        if ( pid && !xenstored_rss(pid) )
+            pid = 0;
+    }
+
+    closedir(dir);
+
+    return pid;
+}
+
+/* Resident memory of xenstored in kB, 0 if unknown. */
+static unsigned long count_nodes(const char *path)
+{
+    char child[PATH_LEN];
+    unsigned long nodes = 1;
+    unsigned int i, num;
+    char **dir;
+
+    dir = xs_directory(xsh, XBT_NULL, path, &num);
+    if ( !dir )
+        return 0;
+
+    for ( i = 0; i < num; i++ )
+    {
+        path_fmt(child, "%s/%s", strcmp(path, "/") ? path : "", dir[i]);
+        nodes += count_nodes(child);
+    }
+    free(dir);
+
+    return nodes;
+}
+
+static int cmp_u64(const void *a, const void *b)
+{
+    const uint64_t *x = a, *y = b;
+
+    return (*x > *y) - (*x < *y);
+}
+
+static void print_latencies(const uint64_t *errors)
+{
+    struct latencies *lat;
+    enum op op;
+
+    printf("%-12s %10s %10s %10s %10s %10s\n", "operation", "count",
+           "p50 (us)", "p99 (us)", "max (us)", "errors");
+    for ( op = 0; op < OP_N; op++ )
+    {
+        lat = lats + op;
+        if ( !lat->n )
+            continue;
+        qsort(lat->ns, lat->n, sizeof(*lat->ns), cmp_u64);
+        printf("%-12s %10u %10.1f %10.1f %10.1f %10"PRIu64"\n",
+               op_names[op], lat->n, lat->ns[lat->n / 2] / 1000.0,
+               lat->ns[(uint64_t)lat->n * 99 / 100] / 1000.0,
+               lat->ns[lat->n - 1] / 1000.0, errors[op]);
+    }
+}
+
+/* Add the results of a client to the totals. */
+static void collect_results(int fd, struct client_stats *total)
+{
+    struct client_stats cs;
+    struct latencies *lat;
+    enum phase ph;
+    uint32_t n;
+    enum op op;
+
+    for ( op = 0; op < OP_N; op++ )
+    {
+        lat = lats + op;
+        read_all(fd, &n, sizeof(n));
+        if ( lat->n + n > lat->size )
+        {
+            lat->size = lat->n + n;
+            lat->ns = realloc(lat->ns, lat->size * sizeof(*lat->ns));
+            if ( !lat->ns )
+                err(2, "realloc() failure");
+        }
+        read_all(fd, lat->ns + lat->n, n * sizeof(*lat->ns));
+        lat->n += n;
+    }
+
+    read_all(fd, &cs, sizeof(cs));
+    for ( ph = 0; ph < PHASE_N; ph++ )
+        total->requests[ph] += cs.requests[ph];
+    total->ta_retries += cs.ta_retries;
+    for ( op = 0; op < OP_N; op++ )
+        total->errors[op] += cs.errors[op];
+}
+
+int main(int argc, char *argv[])
+{
+    struct client_stats total = { };
+    uint64_t phase_ns[PHASE_N] = { }, start;
+    char path[PATH_LEN];
+    unsigned long rss_base, rss_peak = 0, rss;
+    unsigned long nodes_base, nodes_peak = 0;
+    volatile uint64_t *events;
+    pid_t watcher_pid, *pids;
+    int *result_fds, fds[2];
+    unsigned int i, r;
+    enum phase ph;
+    int opt, status, ret = 0;
+
+    while ( (opt = getopt_long(argc, argv, "c:d:D:v:r:p:h", options,
+                               NULL)) != -1 )
+    {
+        switch ( opt )
+        {
+        case 'c':
+            n_clients = atoi(optarg);
+            break;
+        case 'd':
+            n_domains = atoi(optarg);
+            break;
+        case 'D':
+            n_devices = atoi(optarg);
+            break;
+        case 'v':
+            n_vcpus = atoi(optarg);
+            break;
+        case 'r':
+            n_rounds = atoi(optarg);
+            break;
+        case 'p':
+            xenstored_pid = atoi(optarg);
+            break;
+        case 'h':
+            usage(0);
+            break;
+        default:
+            usage(1);
+        }
+    }
+    if ( optind != argc || !n_clients )
+        usage(1);
+
+    if ( asprintf(&root, "%s/%u", BENCH_PATH, getpid()) < 0 )
+        err(2, "asprintf() malloc failure");
+    if ( !xenstored_pid )
+        xenstored_pid = find_xenstored();
+
+    xsh = xs_open(0);
+    if ( !xsh )
+    {
+        fprintf(stderr, "could not connect to xenstore\n");
+        exit(2);
+    }
+
+    events = mmap(NULL, sizeof(*events), PROT_READ | PROT_WRITE,
+                  MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+    pids = calloc(n_clients, sizeof(*pids));
+    result_fds = calloc(n_clients, sizeof(*result_fds));
+    if ( events == MAP_FAILED || !pids || !result_fds )
+        err(2, "allocation failure");
+    if ( pipe(go_pipe) || pipe(done_pipe) )
+        err(2, "pipe() failure");
+
+    nodes_base = count_nodes("/");
+    rss_base = xenstored_rss(xenstored_pid);
+
+    path_fmt(path, "%s/local/domain/0/backend", root);
+    if ( !xs_mkdir(xsh, XBT_NULL, path) )
+        err(2, "could not create %s", path);
+    path_fmt(path, "%s/vm", root);
+    if ( !xs_mkdir(xsh, XBT_NULL, path) )
+        err(2, "could not create %s", path);
+    path_fmt(path, "%s/libxl", root);
+    if ( !xs_mkdir(xsh, XBT_NULL, path) )
+        err(2, "could not create %s", path);
+
+    watcher_pid = fork();
+    if ( watcher_pid < 0 )
+        err(2, "fork() failure");
+    if ( !watcher_pid )
+        watcher(events);
+
+    for ( i = 0; i < n_clients; i++ )
+    {
+        if ( pipe(fds) )
+            err(2, "pipe() failure");
+        pids[i] = fork();
+        if ( pids[i] < 0 )
+            err(2, "fork() failure");
+        if ( !pids[i] )
+        {
+            close(fds[0]);
+            client(i, fds[1]);
+        }
+        close(fds[1]);
+        result_fds[i] = fds[0];
+    }
+
+    clients_wait();
+
+    for ( r = 0; r < n_rounds; r++ )
+    {
+        for ( ph = 0; ph < PHASE_N; ph++ )
+        {
+            start = now_ns();
+            clients_go();
+            clients_wait();
+            phase_ns[ph] += now_ns() - start;
+
+            if ( ph == PHASE_CREATE )
+            {
+                rss = xenstored_rss(xenstored_pid);
+                if ( rss > rss_peak )
+                    rss_peak = rss;
+                if ( !r )
+                    nodes_peak = count_nodes("/");
+            }
+        }
+    }
+
+    clients_go();
+    for ( i = 0; i < n_clients; i++ )
+    {
+        collect_results(result_fds[i], &total);
+        close(result_fds[i]);
+        if ( waitpid(pids[i], &status, 0) < 0 || !WIFEXITED(status) ||
+             WEXITSTATUS(status) )
+            ret = 3;
+    }
+
+    kill(watcher_pid, SIGTERM);
+    waitpid(watcher_pid, &status, 0);
+
+    xs_rm(xsh, XBT_NULL, root);
+    xs_rm(xsh, XBT_NULL, BENCH_PATH);
+    xs_close(xsh);
+
+    printf("%u clients, %u domains per client, %u devices per domain, "
+           "%u rounds\n\n", n_clients, n_domains, n_devices, n_rounds);
+
+    printf("%-12s %10s %10s %10s\n", "phase", "requests", "time (s)",
+           "requests/s");
+    for ( ph = 0; ph < PHASE_N; ph++ )
+        printf("%-12s %10"PRIu64" %10.3f %10.0f\n", phase_names[ph],
+               total.requests[ph], phase_ns[ph] / 1e9,
+               total.requests[ph] * 1e9 / phase_ns[ph]);
+    printf("\n");
+
+    print_latencies(total.errors);
+    printf("\n");
+
+    printf("transaction retries: %"PRIu64"\n", total.ta_retries);
+    printf("backend watch events: %"PRIu64"\n", *events);
+    printf("nodes: %lu before, %lu with all domains created\n",
+           nodes_base, nodes_peak);
+    if ( rss_base && rss_peak > rss_base && nodes_peak > nodes_base )
+        printf("xenstored RSS: %lu kB before, %lu kB peak, %lu bytes per node\n",
+               rss_base, rss_peak,
+               (rss_peak - rss_base) * 1024 / (nodes_peak - nodes_base));
+    else
+        printf("xenstored RSS: unknown\n");
+
+    for ( i = 0; i < OP_N; i++ )
+        if ( total.errors[i] )
+            ret = 3;
+
+    return ret;
+}
+
+/*
+ * Local variables:
+ * mode: C
+ * c-file-style: "BSD"
+ * c-basic-offset: 4
+ * indent-tabs-mode: nil
+ * End:
+ */
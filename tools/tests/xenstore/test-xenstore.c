@@ -199,6 +199,54 @@ static int test_write_deinit(uintptr_t par)
     return verify_node(paths[0], write_buffers[0], par);
 }
 
+static int test_watch_init(uintptr_t par)
+{
+    char node[64], token[16];
+    unsigned int i, num;
+    char **vec;
+
+    /* Watches on siblings of the written node, so none of them fires. */
+    for ( i = 0; i < par; i++ )
+    {
+        snprintf(node, sizeof(node), "%s/w%u", path, i);
+        snprintf(token, sizeof(token), "w%u", i);
+        if ( !xs_watch(xsh, node, token) )
+            return errno;
+    }
+
+    /* Consume the initial event of each watch. */
+    for ( i = 0; i < par; i++ )
+    {
+        vec = xs_read_watch(xsh, &num);
+        if ( !vec )
+            return errno;
+        free(vec);
+    }
+
+    return 0;
+}
+
+static int test_watch(uintptr_t par)
+{
+    return xs_write(xsh, XBT_NULL, paths[0], write_buffers[0], 1) ? 0 : errno;
+}
+
+static int test_watch_deinit(uintptr_t par)
+{
+    char node[64], token[16];
+    unsigned int i;
+
+    for ( i = 0; i < par; i++ )
+    {
+        snprintf(node, sizeof(node), "%s/w%u", path, i);
+        snprintf(token, sizeof(token), "w%u", i);
+        if ( !xs_unwatch(xsh, node, token) )
+            return errno;
+    }
+
+    return verify_node(paths[0], write_buffers[0], 1);
+}
+
 static int test_dir_init(uintptr_t par)
 {
     unsigned int i;
@@ -405,12 +453,141 @@ static int test_ta3_deinit(uintptr_t par)
     return verify_node(paths[0], "b", 1);
 }
 
+#define test_ta4_init ret0
+
+static int test_ta4(uintptr_t par)
+{
+    xs_transaction_t t1, t2;
+    char **dir;
+    unsigned int num;
+    int ret;
+
+    t1 = xs_transaction_start(xsh);
+    if ( t1 == XBT_NULL )
+        return errno;
+    t2 = xs_transaction_start(xsh);
+    if ( t2 == XBT_NULL )
+    {
+        ret = errno;
+        xs_transaction_end(xsh, t1, true);
+        return ret;
+    }
+    /* Reading the children list makes concurrent child creation fatal. */
+    if ( par )
+    {
+        dir = xs_directory(xsh, t2, path, &num);
+        if ( !dir )
+            goto out;
+        free(dir);
+    }
+    if ( !xs_write(xsh, t1, paths[0], write_buffers[0], 1) ||
+         !xs_write(xsh, t2, paths[1], write_buffers[1], 1) )
+        goto out;
+    if ( !xs_transaction_end(xsh, t1, false) )
+    {
+        ret = errno;
+        xs_transaction_end(xsh, t2, true);
+        return ret;
+    }
+    if ( xs_transaction_end(xsh, t2, false) )
+        return par ? EEXIST : 0;
+    return (par && errno == EAGAIN) ? 0 : errno;
+
+ out:
+    ret = errno;
+    xs_transaction_end(xsh, t1, true);
+    xs_transaction_end(xsh, t2, true);
+    return ret;
+}
+
+static int test_ta4_deinit(uintptr_t par)
+{
+    char *buf;
+    int ret;
+
+    ret = verify_node(paths[0], write_buffers[0], 1);
+    if ( ret )
+        return ret;
+    if ( !par )
+        return verify_node(paths[1], write_buffers[1], 1);
+
+    buf = xs_read(xsh, XBT_NULL, paths[1], NULL);
+    if ( buf )
+    {
+        free(buf);
+        return EEXIST;
+    }
+    return (errno == ENOENT) ? 0 : errno;
+}
+
+#define test_batch_init ret0
+
+static int test_batch(uintptr_t par)
+{
+    struct xs_batch *b;
+    struct xs_permissions perms = { .id = 0, .perms = XS_PERM_READ };
+    unsigned int i, len;
+    void *buf;
+    int ret;
+
+    b = xs_batch_new(xsh, XBT_NULL);
+    if ( !b )
+        return errno;
+    for ( i = 0; i < WRITE_BUFFERS_N; i++ )
+        xs_batch_write(b, paths[i], write_buffers[i], 1);
+    xs_batch_set_permissions(b, paths[0], &perms, 1);
+    xs_batch_read(b, paths[1], &buf, &len);
+    /* An invalid node name lets the whole batch fail. */
+    if ( par )
+        xs_batch_write(b, "invalid name", "", 0);
+
+    if ( !xs_batch_commit(b) )
+        return (par && errno == EINVAL) ? 0 : errno;
+    if ( par )
+        return EEXIST;
+
+    ret = (len == 1 && !memcmp(buf, write_buffers[1], 1)) ? 0 : ENOENT;
+    free(buf);
+    return ret;
+}
+
+static int test_batch_deinit(uintptr_t par)
+{
+    unsigned int i;
+    char *buf;
+    int ret;
+
+    if ( par )
+    {
+        buf = xs_read(xsh, XBT_NULL, paths[0], NULL);
+        if ( buf )
+        {
+            free(buf);
+            return EEXIST;
+        }
+        return (errno == ENOENT) ? 0 : errno;
+    }
+
+    for ( i = 0; i < WRITE_BUFFERS_N; i++ )
+    {
+        ret = verify_node(paths[i], write_buffers[i], 1);
+        if ( ret )
+            return ret;
+    }
+
+    return 0;
+}
+
 #define TEST(s, f, p, l) { s, f ## _init, f, f ## _deinit, (uintptr_t)(p), l }
 struct test tests[] = {
 TEST("read 1", test_read, 1, "Read node with 1 byte data"),
 TEST("read 2000", test_read, 2000, "Read node with 2000 bytes data"),
 TEST("write 1", test_write, 1, "Write node with 1 byte data"),
 TEST("write 2000", test_write, 2000, "Write node with 2000 bytes data"),
+TEST("watch 100", test_watch, 100, "Write node with 100 other watches set"),
+TEST("watch 1000", test_watch, 1000, "Write node with 1000 other watches set"),
+TEST("watch 10000", test_watch, 10000,
+     "Write node with 10000 other watches set"),
 TEST("dir", test_dir, 0, "List directory"),
 TEST("rm node", test_rm, 0, "Remove single node"),
 TEST("rm dir", test_rm, WRITE_BUFFERS_N, "Remove node with sub-nodes"),
@@ -419,6 +596,11 @@ TEST("ta empty x", test_ta1, 1, "Empty transaction abort"),
 TEST("ta rmw", test_ta2, 0, "Read-modify-write transaction"),
 TEST("ta rmw x", test_ta2, 1, "Read-modify-write transaction abort"),
 TEST("ta err", test_ta3, 0, "Transaction with conflict"),
+TEST("ta merge", test_ta4, 0, "Transactions creating different children"),
+TEST("ta merge x", test_ta4, 1,
+     "Transactions creating children, one reading the children list"),
+TEST("batch", test_batch, 0, "Batch of writes, a permission change and a read"),
+TEST("batch x", test_batch, 1, "Batch failing completely due to an error"),
 };
 
 static void cleanup(void)
@@ -0,0 +1,527 @@
+/*
+ * Unit tests for the persistent node store of xenstored.
+ *
+ * persist.c is linked against a simple table of nodes standing in for the
+ * data base of xenstored.  Each daemon lifetime runs in a child process, so
+ * the static state of persist.c starts out fresh, and leaving it with _exit()
+ * is as good as a crash for the data written through the shared mapping of
+ * the log.  The files left behind are damaged in the ways a crash or a
+ * broken disk would, and the nodes restored from them are checked.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms and conditions of the GNU General Public
+ * License, version 2, as published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public
+ * License along with this program; If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#define _GNU_SOURCE
+#include <fcntl.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
+
+#include "utils.h"
+#include "talloc.h"
+#include "core.h"
+#include "persist.h"
+
+#define MAX_NODES 16
+
+/* Exit code of a child stopped by barf(). */
+#define EXIT_BARF 2
+
+struct test_node {
+    char *name;
+    char *data;
+    size_t size;
+};
+
+static struct test_node nodes[MAX_NODES];
+static unsigned int nr_failures;
+
+/* Stand-ins for the parts of xenstored persist.c is using. */
+
+void barf(const char *fmt, ...)
+{
+    va_list ap;
+
+    va_start(ap, fmt);
+    vprintf(fmt, ap);
+    va_end(ap);
+    printf("\n");
+
+    _exit(EXIT_BARF);
+}
+
+void barf_perror(const char *fmt, ...)
+{
+    va_list ap;
+
+    va_start(ap, fmt);
+    vprintf(fmt, ap);
+    va_end(ap);
+    printf(": %m\n");
+
+    _exit(EXIT_BARF);
+}
+
+char *talloc_asprintf(const void *t, const char *fmt, ...)
+{
+    va_list ap;
+    char *s;
+
+    va_start(ap, fmt);
+    if (vasprintf(&s, fmt, ap) < 0)
+        s = NULL;
+    va_end(ap);
+
+    return s;
+}
+
+void send_reply(struct connection *conn, enum xsd_sockmsg_type type,
+                const void *data, unsigned int len)
+{
+}
+
+void send_ack(struct connection *conn, enum xsd_sockmsg_type type)
+{
+}
+
+static struct test_node *find_node(const char *name)
+{
+    unsigned int i;
+
+    for (i = 0; i < MAX_NODES; i++)
+        if (nodes[i].name && !strcmp(nodes[i].name, name))
+            return nodes + i;
+
+    return NULL;
+}
+
+void db_restore_delete(const char *db_name)
+{
+    struct test_node *node = find_node(db_name);
+
+    if (node) {
+        free(node->name);
+        free(node->data);
+        memset(node, 0, sizeof(*node));
+    }
+}
+
+void db_restore_node(const char *db_name, const void *data, size_t size)
+{
+    struct test_node *node;
+
+    db_restore_delete(db_name);
+    for (node = nodes; node->name; node++)
+        if (node == nodes + MAX_NODES - 1)
+            barf("too many nodes");
+
+    node->name = strdup(db_name);
+    node->data = malloc(size);
+    memcpy(node->data, data, size);
+    node->size = size;
+}
+
+void db_restore_finish(void)
+{
+}
+
+int db_for_each_node(int (*func)(const char *db_name,
+                                 const struct node_hdr *hdr, size_t size,
+                                 void *arg),
+                     void *arg)
+{
+    unsigned int i;
+
+    for (i = 0; i < MAX_NODES; i++)
+        if (nodes[i].name &&
+            func(nodes[i].name, (void *)nodes[i].data, nodes[i].size, arg))
+            return -1;
+
+    return 0;
+}
+
+/* Helpers for the tests. */
+
+static void write_node(const char *name, const char *value)
+{
+    db_restore_node(name, value, strlen(value) + 1);
+    persist_write(name, value, strlen(value) + 1);
+}
+
+static void delete_node(const char *name)
+{
+    db_restore_delete(name);
+    persist_delete(name);
+}
+
+/*
+ * Run fn() in a child process, as one lifetime of the daemon.  Returns the
+ * exit code of the child.
+ */
+static int run_child(void (*fn)(void))
+{
+    int status;
+    pid_t pid;
+
+    fflush(stdout);
+    pid = fork();
+    if (pid < 0) {
+        perror("fork");
+        exit(1);
+    }
+    if (!pid) {
+        fn();
+        _exit(0);
+    }
+
+    if (waitpid(pid, &status, 0) != pid || !WIFEXITED(status))
+        return -1;
+
+    return WEXITSTATUS(status);
+}
+
+/*
+ * Restore the data base and compare it with the nodes passed as name/value
+ * pairs, terminated by NULL.  Exits with 1 on a mismatch.
+ */
+static void check_restore(int found, ...)
+{
+    const struct test_node *node;
+    unsigned int i, n = 0;
+    const char *name, *value;
+    bool ok = true;
+    va_list ap;
+
+    if (persist_restore() != found) {
+        printf("persist_restore() didn't return %d\n", found);
+        _exit(1);
+    }
+
+    va_start(ap, found);
+    while ((name = va_arg(ap, const char *))) {
+        value = va_arg(ap, const char *);
+        n++;
+        node = find_node(name);
+        if (!node) {
+            printf("node %s missing\n", name);
+            ok = false;
+        } else if (node->size != strlen(value) + 1 ||
+                   memcmp(node->data, value, node->size)) {
+            printf("node %s has wrong value\n", name);
+            ok = false;
+        }
+    }
+    va_end(ap);
+
+    for (i = 0; i < MAX_NODES; i++)
+        if (nodes[i].name)
+            n--;
+    if (n) {
+        printf("unexpected nodes restored\n");
+        ok = false;
+    }
+
+    if (!ok)
+        _exit(1);
+}
+
+static char dir[] = "/tmp/test-persist.XXXXXX";
+static char path[PATH_MAX];
+
+static const char *file_path(const char *name)
+{
+    snprintf(path, sizeof(path), "%s/%s", dir, name);
+    return path;
+}
+
+static void remove_files(void)
+{
+    unlink(file_path("snapshot"));
+    unlink(file_path("log"));
+    unlink(file_path("log.old"));
+}
+
+/*
+ * Offset of the record of node name in file, found via the name, which
+ * follows the 16 byte record header.
+ */
+static off_t find_record(const char *file, const char *name)
+{
+    struct stat statbuf;
+    char *buf, *p;
+    off_t off;
+    int fd;
+
+    fd = open(file_path(file), O_RDONLY);
+    if (fd < 0 || fstat(fd, &statbuf))
+        return -1;
+    buf = malloc(statbuf.st_size);
+    if (!buf || read(fd, buf, statbuf.st_size) != statbuf.st_size) {
+        close(fd);
+        free(buf);
+        return -1;
+    }
+    close(fd);
+
+    p = memmem(buf, statbuf.st_size, name, strlen(name) + 1);
+    off = p ? p - buf - 16 : -1;
+    free(buf);
+
+    return off;
+}
+
+static void truncate_file(const char *file, off_t size)
+{
+    if (truncate(file_path(file), size))
+        perror("truncate");
+}
+
+static void poke_file(const char *file, off_t off, uint32_t val)
+{
+    int fd = open(file_path(file), O_WRONLY);
+
+    if (fd < 0 || pwrite(fd, &val, sizeof(val), off) != sizeof(val))
+        perror("pwrite");
+    if (fd >= 0)
+        close(fd);
+}
+
+/* Lifetimes of the daemon used by the tests. */
+
+/*
+ * Start with an empty directory: the request writing /c is interrupted by
+ * the crash.
+ */
+static void daemon_first(void)
+{
+    persist_init();
+    write_node("/a", "1");
+    persist_commit();
+    write_node("/b", "2");
+    write_node("/x", "3");
+    persist_commit();
+    delete_node("/x");
+    persist_commit();
+    write_node("/c", "4");
+}
+
+static void restore_all(void)
+{
+    check_restore(true, "/a", "1", "/b", "2", NULL);
+}
+
+static void restore_a(void)
+{
+    check_restore(true, "/a", "1", NULL);
+}
+
+static void restore_none(void)
+{
+    check_restore(true, NULL);
+}
+
+/* Restore, then continue logging after a torn record. */
+static void daemon_after_torn(void)
+{
+    check_restore(true, "/a", "1", "/b", "2", NULL);
+    persist_init();
+    write_node("/d", "5");
+    persist_commit();
+}
+
+static void restore_after_torn(void)
+{
+    check_restore(true, "/a", "1", "/b", "2", "/d", "5", NULL);
+}
+
+/* Log requests for /c and /e after /a. */
+static void daemon_more(void)
+{
+    persist_init();
+    write_node("/a", "1");
+    persist_commit();
+    write_node("/c", "4");
+    persist_commit();
+    write_node("/e", "6");
+    persist_commit();
+}
+
+/* Restore, then log a request of the same size as the one for /c. */
+static void daemon_after_broken(void)
+{
+    check_restore(true, "/a", "1", NULL);
+    persist_init();
+    write_node("/d", "5");
+    persist_commit();
+}
+
+static void restore_after_broken(void)
+{
+    check_restore(true, "/a", "1", "/d", "5", NULL);
+}
+
+/* Take a snapshot of the restored nodes, the old log being obsolete. */
+static void daemon_snapshot(void)
+{
+    check_restore(true, "/a", "1", "/b", "2", NULL);
+    unlink(file_path("snapshot"));
+    persist_init();
+}
+
+/* The tests. */
+
+static void expect(const char *what, void (*fn)(void), int code)
+{
+    int ret = run_child(fn);
+
+    if (ret != code) {
+        printf("FAIL %s: exit code %d instead of %d\n", what, ret, code);
+        nr_failures++;
+    }
+}
+
+static void setup(void)
+{
+    remove_files();
+    expect("initial daemon", daemon_first, 0);
+}
+
+static void test_restore(void)
+{
+    setup();
+    expect("restore", restore_all, 0);
+    /* Restoring is not destructive. */
+    expect("restore again", restore_all, 0);
+}
+
+static void test_truncated_log(void)
+{
+    off_t off;
+
+    /* Cut in the middle of the record header of /b. */
+    setup();
+    off = find_record("log", "/b");
+    truncate_file("log", off + 8);
+    expect("log truncated in header", restore_a, 0);
+
+    /* Cut in the middle of the node name of /b. */
+    setup();
+    off = find_record("log", "/b");
+    truncate_file("log", off + 17);
+    expect("log truncated in record", restore_a, 0);
+
+    /* Only the file header left, the snapshot is still empty. */
+    setup();
+    truncate_file("log", 16);
+    expect("log truncated to header", restore_none, 0);
+}
+
+static void test_torn_record(void)
+{
+    off_t off;
+
+    /* An invalid name length in the record of the interrupted request. */
+    setup();
+    off = find_record("log", "/c");
+    poke_file("log", off + 4, 0);
+    expect("torn record", restore_all, 0);
+
+    /* The torn record must not be taken for a new one later. */
+    expect("log after torn record", daemon_after_torn, 0);
+    expect("restore after torn record", restore_after_torn, 0);
+}
+
+static void test_broken_record(void)
+{
+    off_t off;
+
+    /*
+     * Nothing following a broken record can be trusted, so the log ends
+     * there even if valid looking records follow.
+     */
+    setup();
+    off = find_record("log", "/b");
+    poke_file("log", off + 4, 0);
+    expect("broken record", restore_a, 0);
+
+    /*
+     * The records following the broken one must not come back to life once
+     * new records have been logged in front of them.
+     */
+    remove_files();
+    expect("initial daemon", daemon_more, 0);
+    off = find_record("log", "/c");
+    poke_file("log", off + 4, 0);
+    expect("broken record", restore_a, 0);
+    expect("log after broken record", daemon_after_broken, 0);
+    expect("restore after broken record", restore_after_broken, 0);
+}
+
+static void test_snapshot_corruption(void)
+{
+    off_t off;
+
+    /* Anything wrong in the snapshot is fatal. */
+    setup();
+    expect("snapshot", daemon_snapshot, 0);
+    off = find_record("snapshot", "/b");
+    poke_file("snapshot", off + 4, 0);
+    expect("corrupted snapshot", restore_all, EXIT_BARF);
+
+    setup();
+    expect("snapshot", daemon_snapshot, 0);
+    off = find_record("snapshot", "/b");
+    truncate_file("snapshot", off + 17);
+    expect("truncated snapshot", restore_all, EXIT_BARF);
+}
+
+int main(int argc, char *argv[])
+{
+    if (!mkdtemp(dir)) {
+        perror("mkdtemp");
+        return 1;
+    }
+    persist_dir = dir;
+
+    test_restore();
+    test_truncated_log();
+    test_torn_record();
+    test_broken_record();
+    test_snapshot_corruption();
+
+    remove_files();
+    rmdir(dir);
+
+    if (nr_failures) {
+        printf("%u test(s) failed\n", nr_failures);
+        return 1;
+    }
+
+    printf("All tests passed\n");
+
+    return 0;
+}
+
+/*
+ * Local variables:
+ * mode: C
+ * c-file-style: "BSD"
+ * c-basic-offset: 4
+ * tab-width: 4
+ * indent-tabs-mode: nil
+ * End:
+ */
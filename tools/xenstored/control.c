@@ -31,6 +31,9 @@
 #include "control.h"
 #include "domain.h"
 #include "lu.h"
+#include "nodedb.h"
+#include "persist.h"
+#include "transaction.h"
 
 struct cmd_s {
 	char *cmd;
@@ -141,6 +144,8 @@ static int quota_set(const void *ctx, struct connection *conn,
 	for (i = 0; i < ACC_N; i++) {
 		if (quotas[i].name && !strcmp(vec[0], quotas[i].name)) {
 			quotas[i].val = val;
+			/* A raised quota might unblock any domain. */
+			conn_mark_all_busy();
 			send_ack(conn, XS_CONTROL);
 			return 0;
 		}
@@ -254,12 +259,46 @@ static int do_control_memreport(const void *ctx, struct connection *conn,
 		return EBADF;
 
 	talloc_report_full(NULL, fp);
+	request_pool_report(fp);
+	db_nodes_report(fp);
 	fclose(fp);
 
 	send_ack(conn, XS_CONTROL);
 	return 0;
 }
 
+static int do_control_transactions(const void *ctx, struct connection *conn,
+				   const char **vec, int num)
+{
+	if (num > 1)
+		return EINVAL;
+
+	if (num == 1) {
+		if (!strcmp(vec[0], "-r"))
+			transaction_stats_reset();
+		else
+			return EINVAL;
+	}
+
+	return transaction_stats(ctx, conn);
+}
+
+static int do_control_watch_events(const void *ctx, struct connection *conn,
+				   const char **vec, int num)
+{
+	if (num > 1)
+		return EINVAL;
+
+	if (num == 1) {
+		if (!strcmp(vec[0], "-r"))
+			watch_event_stats_reset();
+		else
+			return EINVAL;
+	}
+
+	return watch_event_stats(ctx, conn);
+}
+
 static int do_control_print(const void *ctx, struct connection *conn,
 			    const char **vec, int num)
 {
@@ -302,10 +341,15 @@ static struct cmd_s cmds[] = {
 #endif
 	{ "logfile", do_control_logfile, "<file>" },
 	{ "memreport", do_control_memreport, "[<file>]" },
+#ifndef NO_PERSIST
+	{ "persist", do_control_persist, "[snapshot]" },
+#endif
 	{ "print", do_control_print, "<string>" },
 	{ "quota", do_control_quota,
 		"[set <name> <val>|<domid>|max [-r]]" },
 	{ "quota-soft", do_control_quota_s, "[set <name> <val>]" },
+	{ "transactions", do_control_transactions, "[-r]" },
+	{ "watch-events", do_control_watch_events, "[-r]" },
 	{ "help", do_control_help, "" },
 };
 
@@ -49,10 +49,17 @@
 #include "domain.h"
 #include "control.h"
 #include "lu.h"
+#include "nodedb.h"
+#include "reader.h"
+#include "persist.h"
+#include "osdep.h"
+
+#ifdef XENSTORED_USE_EPOLL
+#include <sys/epoll.h>
+#endif
 
 extern xenevtchn_handle *xce_handle; /* in domain.c */
-static int xce_pollfd_idx = -1;
-struct pollfd *poll_fds;
+static struct fd_event xce_fd_event = FD_EVENT_INIT;
 static unsigned int current_array_size;
 static unsigned int nr_fds;
 static unsigned int delayed_requests;
@@ -180,6 +187,29 @@ uint64_t get_now_msec(void)
 	return now_ts.tv_sec * 1000 + now_ts.tv_nsec / 1000000;
 }
 
+/*
+ * A struct buffered_data is needed for each request and each watch event, so
+ * keep some of the freed ones for reuse.
+ */
+#define BUFFER_CACHE_SIZE 32
+static struct buffered_data *buffer_cache[BUFFER_CACHE_SIZE];
+static unsigned int buffer_cache_n;
+
+static void free_buffer(struct buffered_data *data)
+{
+	if (data->buffer != data->default_buffer)
+		talloc_free(data->buffer);
+
+	/* Don't cache it if anything else is hanging off it. */
+	if (buffer_cache_n == BUFFER_CACHE_SIZE ||
+	    talloc_total_blocks(data) != 1) {
+		talloc_free(data);
+		return;
+	}
+
+	buffer_cache[buffer_cache_n++] = talloc_steal(NULL, data);
+}
+
 /*
  * Remove a struct buffered_data from the list of outgoing data.
  * A struct buffered_data related to a request having caused watch events to be
@@ -198,6 +228,7 @@ static void free_buffered_data(struct buffered_data *out,
 
 	list_del(&out->list);
 	out->on_out_list = false;
+	conn_mark_busy(conn);
 
 	/*
 	 * Update conn->timeout_msec with the next found timeout value in the
@@ -217,6 +248,10 @@ static void free_buffered_data(struct buffered_data *out,
 				-out->hdr.msg.len - sizeof(out->hdr));
 
 	if (out->hdr.msg.type == XS_WATCH_EVENT) {
+		conn->events_pending--;
+		if (conn->events && hashtable_search(conn->events, out) == out)
+			hashtable_remove(conn->events, out);
+
 		req = out->pend.req;
 		if (req) {
 			req->pend.ref.event_cnt--;
@@ -240,7 +275,7 @@ static void free_buffered_data(struct buffered_data *out,
 	} else
 		domain_outstanding_dec(conn, conn->id);
 
-	talloc_free(out);
+	free_buffer(out);
 }
 
 static void check_event_timeout(struct connection *conn, uint64_t msecs,
@@ -412,14 +447,20 @@ static int destroy_conn(void *_conn)
 	/* Flush outgoing if possible, but don't block. */
 	if (!conn->domain) {
 		struct pollfd pfd;
-		pfd.fd = conn->fd;
-		pfd.events = POLLOUT;
 
-		while (!list_empty(&conn->out_list)
-		       && poll(&pfd, 1, 0) == 1)
-			if (!write_messages(conn))
-				break;
-		close(conn->fd);
+		fd_event_del(&conn->fd_event);
+
+		/* Otherwise the reader thread's job will close the fd. */
+		if (!reader_release_conn(conn)) {
+			pfd.fd = conn->fd;
+			pfd.events = POLLOUT;
+
+			while (!list_empty(&conn->out_list)
+			       && poll(&pfd, 1, 0) == 1)
+				if (!write_messages(conn))
+					break;
+			close(conn->fd);
+		}
 	}
 
 	conn_free_buffered_data(conn);
@@ -429,6 +470,8 @@ static int destroy_conn(void *_conn)
 
         if (conn->target)
                 talloc_unlink(conn, conn->target);
+	list_del_init(&conn->busy_list);
+	list_del_init(&conn->timeout_list);
 	list_del(&conn->list);
 	trace_destroy(conn, "connection");
 	return 0;
@@ -439,6 +482,10 @@ static bool conn_can_read(struct connection *conn)
 	if (conn->is_ignored)
 		return false;
 
+	/* The reply to a request handed off needs to be sent first. */
+	if (conn->read_job)
+		return false;
+
 	if (!conn->funcs->can_read(conn))
 		return false;
 
@@ -454,15 +501,157 @@ static bool conn_can_read(struct connection *conn)
 
 static bool conn_can_write(struct connection *conn)
 {
-	return !conn->is_ignored && conn->funcs->can_write(conn);
+	/* A reader thread might be writing to the socket. */
+	return !conn->is_ignored && !conn->read_job &&
+	       conn->funcs->can_write(conn);
+}
+
+/*
+ * Connections the main loop needs to look at, because their state has
+ * changed or their fd is ready.  Connections with a timeout pending are kept
+ * sorted by the time of their next timeout.  Only these are visited, so idle
+ * connections cost nothing per iteration.
+ */
+static LIST_HEAD(busy_conns);
+static LIST_HEAD(timeout_conns);
+
+void conn_mark_busy(struct connection *conn)
+{
+	if (list_empty(&conn->busy_list))
+		list_add_tail(&conn->busy_list, &busy_conns);
 }
 
-/* This function returns index inside the array if succeed, -1 if fail */
-int set_fd(int fd, short events)
+void conn_mark_all_busy(void)
+{
+	struct connection *conn;
+
+	list_for_each_entry(conn, &connections, list)
+		conn_mark_busy(conn);
+}
+
+#ifdef XENSTORED_USE_EPOLL
+/*
+ * The fds stay registered with the kernel, so a wait only costs in the
+ * number of ready fds.  ready[] holds the result of the last wait, idx of a
+ * ready fd_event is its index there.
+ */
+static int epoll_fd = -1;
+static struct epoll_event *ready;
+static unsigned int nr_ready;
+
+void fd_event_add(struct fd_event *fe, int fd, short events)
+{
+	struct epoll_event ev = { .events = events, .data.ptr = fe };
+
+	/* The poll() and epoll event bits are the same. */
+	BUILD_BUG_ON(POLLIN != EPOLLIN || POLLPRI != EPOLLPRI ||
+		     POLLOUT != EPOLLOUT || POLLERR != EPOLLERR ||
+		     POLLHUP != EPOLLHUP);
+
+	if (epoll_fd < 0) {
+		epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+		if (epoll_fd < 0)
+			barf_perror("Could not create epoll fd");
+	}
+
+	if (epoll_ctl(epoll_fd, EPOLL_CTL_ADD, fd, &ev)) {
+		syslog(LOG_ERR, "epoll_ctl failed, ignoring fd %d\n", fd);
+		return;
+	}
+
+	fe->fd = fd;
+	fe->events = events;
+	fe->revents = 0;
+	fe->idx = -1;
+	nr_fds++;
+}
+
+void fd_event_set(struct fd_event *fe, short events)
+{
+	struct epoll_event ev = { .events = events, .data.ptr = fe };
+
+	if (fe->events == events)
+		return;
+
+	if (epoll_ctl(epoll_fd, EPOLL_CTL_MOD, fe->fd, &ev))
+		syslog(LOG_ERR, "epoll_ctl failed for fd %d\n", fe->fd);
+	else
+		fe->events = events;
+}
+
+void fd_event_del(struct fd_event *fe)
+{
+	if (fe->fd < 0)
+		return;
+
+	epoll_ctl(epoll_fd, EPOLL_CTL_DEL, fe->fd, NULL);
+	if (fe->idx >= 0)
+		ready[fe->idx].data.ptr = NULL;
+
+	fe->fd = -1;
+	fe->revents = 0;
+	fe->idx = -1;
+	nr_fds--;
+}
+
+static int fd_events_wait(int timeout)
+{
+	struct fd_event *fe;
+	unsigned int i;
+	int n;
+
+	for (i = 0; i < nr_ready; i++) {
+		fe = ready[i].data.ptr;
+		if (fe) {
+			fe->revents = 0;
+			fe->idx = -1;
+		}
+	}
+	nr_ready = 0;
+
+	if (current_array_size < nr_fds) {
+		struct epoll_event *new_ready;
+		unsigned long newsize = ROUNDUP(nr_fds, 8);
+
+		new_ready = realloc(ready, sizeof(*ready) * newsize);
+		if (new_ready) {
+			ready = new_ready;
+			current_array_size = newsize;
+		}
+	}
+
+	/* Nothing registered yet, sleep for the timeout only. */
+	if (!current_array_size)
+		return poll(NULL, 0, timeout);
+
+	n = epoll_wait(epoll_fd, ready, current_array_size, timeout);
+	if (n < 0)
+		return n;
+
+	for (i = 0; i < n; i++) {
+		fe = ready[i].data.ptr;
+		fe->revents = ready[i].events;
+		fe->idx = i;
+		if (fe->conn)
+			conn_mark_busy(fe->conn);
+	}
+	nr_ready = n;
+
+	return n;
+}
+#else
+/*
+ * The pollfd array is kept across waits, fds are only added, removed or
+ * changed when needed.  idx of an fd_event is its index in poll_fds[].
+ */
+static struct pollfd *poll_fds;
+static struct fd_event **poll_fd_events;
+
+void fd_event_add(struct fd_event *fe, int fd, short events)
 {
-	int ret;
 	if (current_array_size < nr_fds + 1) {
-		struct pollfd *new_fds = NULL;
+		struct pollfd *new_fds;
+		struct fd_event **new_fes;
 		unsigned long newsize;
 
 		/* Round up to 2^8 boundary, in practice this just
@@ -470,69 +659,175 @@ int set_fd(int fd, short events)
 		 */
 		newsize = ROUNDUP(nr_fds + 1, 8);
 
-		new_fds = realloc(poll_fds, sizeof(struct pollfd)*newsize);
-		if (!new_fds)
+		new_fds = realloc(poll_fds, sizeof(*poll_fds) * newsize);
+		if (new_fds)
+			poll_fds = new_fds;
+		new_fes = realloc(poll_fd_events,
+				  sizeof(*poll_fd_events) * newsize);
+		if (new_fes)
+			poll_fd_events = new_fes;
+		if (!new_fds || !new_fes)
 			goto fail;
-		poll_fds = new_fds;
-
-		memset(&poll_fds[0] + current_array_size, 0,
-		       sizeof(struct pollfd ) * (newsize-current_array_size));
 		current_array_size = newsize;
 	}
 
+	fe->fd = fd;
+	fe->events = events;
+	fe->revents = 0;
+	fe->idx = nr_fds;
 	poll_fds[nr_fds].fd = fd;
 	poll_fds[nr_fds].events = events;
-	ret = nr_fds;
+	poll_fds[nr_fds].revents = 0;
+	poll_fd_events[nr_fds] = fe;
 	nr_fds++;
 
-	return ret;
+	return;
 fail:
 	syslog(LOG_ERR, "realloc failed, ignoring fd %d\n", fd);
-	return -1;
+}
+
+void fd_event_set(struct fd_event *fe, short events)
+{
+	fe->events = events;
+	poll_fds[fe->idx].events = events;
+}
+
+void fd_event_del(struct fd_event *fe)
+{
+	if (fe->fd < 0)
+		return;
+
+	/* Move the last entry into the hole. */
+	nr_fds--;
+	poll_fds[fe->idx] = poll_fds[nr_fds];
+	poll_fd_events[fe->idx] = poll_fd_events[nr_fds];
+	poll_fd_events[fe->idx]->idx = fe->idx;
+
+	fe->fd = -1;
+	fe->revents = 0;
+	fe->idx = -1;
+}
+
+static int fd_events_wait(int timeout)
+{
+	unsigned int i;
+	int n;
+
+	n = poll(poll_fds, nr_fds, timeout);
+	if (n < 0)
+		return n;
+
+	for (i = 0; i < nr_fds; i++) {
+		poll_fd_events[i]->revents = poll_fds[i].revents;
+		if (poll_fds[i].revents && poll_fd_events[i]->conn)
+			conn_mark_busy(poll_fd_events[i]->conn);
+	}
+
+	return n;
+}
+#endif
+
+/*
+ * Handle the watch event and write rate limit timeouts of a connection and
+ * (re)queue it in the timeout list if one is left.
+ */
+static void conn_check_timeouts(struct connection *conn, uint64_t msecs)
+{
+	struct connection *pos;
+	int timeout = -1;
+
+	if (conn->domain) {
+		wrl_check_timeout(conn->domain, msecs, &timeout);
+		check_event_timeout(conn, msecs, &timeout);
+	}
+
+	list_del_init(&conn->timeout_list);
+	if (timeout < 0)
+		return;
+
+	conn->timeout_wake = msecs + timeout;
+	list_for_each_entry(pos, &timeout_conns, timeout_list)
+		if (pos->timeout_wake > conn->timeout_wake)
+			break;
+	list_add_tail(&conn->timeout_list, &pos->timeout_list);
+}
+
+/*
+ * Update the events waited for on the fd of a busy connection.  Returns
+ * whether it needs to be handled without waiting for any event.
+ */
+static bool conn_update_events(struct connection *conn)
+{
+	short events = POLLIN|POLLPRI;
+
+	if (conn->domain)
+		return conn_can_read(conn) ||
+		       (conn_can_write(conn) && !list_empty(&conn->out_list));
+
+	if (!list_empty(&conn->out_list) && !conn->read_job)
+		events |= POLLOUT;
+	if (conn->fd_event.fd < 0)
+		fd_event_add(&conn->fd_event, conn->fd, events);
+	else
+		fd_event_set(&conn->fd_event, events);
+
+	/* Watch events queued behind a handed off request. */
+	if (conn->read_job && !list_empty(&conn->out_list))
+		reader_want_wakeup();
+
+	/*
+	 * For stalled connection, we want to process the pending command as
+	 * soon as live-update has aborted.
+	 */
+	return conn->is_stalled && !lu_is_pending();
 }
 
 static void initialize_fds(int *ptimeout)
 {
-	struct connection *conn;
+	struct connection *conn, *tmp;
 	uint64_t msecs;
-
-	if (poll_fds)
-		memset(poll_fds, 0, sizeof(struct pollfd) * current_array_size);
-	nr_fds = 0;
+	int wait;
 
 	/* In case of delayed requests pause for max 1 second. */
 	*ptimeout = delayed_requests ? 1000 : -1;
 
 	set_special_fds();
 
-	if (xce_handle != NULL)
-		xce_pollfd_idx = set_fd(xenevtchn_fd(xce_handle),
-					POLLIN|POLLPRI);
+	if (xce_handle != NULL && xce_fd_event.fd < 0)
+		fd_event_add(&xce_fd_event, xenevtchn_fd(xce_handle),
+			     POLLIN|POLLPRI);
 
 	msecs = get_now_msec();
 	wrl_log_periodic(msecs);
 
-	list_for_each_entry(conn, &connections, list) {
-		if (conn->domain) {
-			wrl_check_timeout(conn->domain, msecs, ptimeout);
-			check_event_timeout(conn, msecs, ptimeout);
-			if (conn_can_read(conn) ||
-			    (conn_can_write(conn) &&
-			     !list_empty(&conn->out_list)))
-				*ptimeout = 0;
-		} else {
-			short events = POLLIN|POLLPRI;
-			if (!list_empty(&conn->out_list))
-				events |= POLLOUT;
-			conn->pollfd_idx = set_fd(conn->fd, events);
-			/*
-			 * For stalled connection, we want to process the
-			 * pending command as soon as live-update has aborted.
-			 */
-			if (conn->is_stalled && !lu_is_pending())
-				*ptimeout = 0;
-		}
+	/* Connections whose timeout has expired might be able to continue. */
+	list_for_each_entry(conn, &timeout_conns, timeout_list) {
+		if (conn->timeout_wake > msecs)
+			break;
+		conn_mark_busy(conn);
+	}
+
+	list_for_each_entry_safe(conn, tmp, &busy_conns, busy_list) {
+		conn_check_timeouts(conn, msecs);
+		if (!conn_update_events(conn))
+			list_del_init(&conn->busy_list);
 	}
+
+	/* The connections left are to be handled right away. */
+	if (!list_empty(&busy_conns))
+		*ptimeout = 0;
+
+	/* Wait no longer than until the next timeout. */
+	conn = list_top(&timeout_conns, struct connection, timeout_list);
+	if (conn) {
+		wait = (conn->timeout_wake > msecs) ?
+		       conn->timeout_wake - msecs : 0;
+		if (*ptimeout == -1 || *ptimeout > wait)
+			*ptimeout = wait;
+	}
+
+	reader_set_fds(ptimeout);
+	persist_set_fds(ptimeout);
 }
 
 static size_t calc_node_acc_size(const struct node_hdr *hdr)
@@ -541,17 +836,20 @@ static size_t calc_node_acc_size(const struct node_hdr *hdr)
 	       hdr->datalen + hdr->childlen;
 }
 
-const struct node_hdr *db_fetch(const char *db_name, size_t *size)
+struct node_hdr *db_fetch(const void *ctx, const char *db_name, size_t *size)
 {
-	const struct node_hdr *hdr;
+	const struct db_node *node;
+	struct node_hdr *hdr;
 
-	hdr = hashtable_search(nodes, db_name);
-	if (!hdr) {
+	node = hashtable_search(nodes, db_name);
+	if (!node) {
 		errno = ENOENT;
 		return NULL;
 	}
 
-	*size = calc_node_acc_size(hdr);
+	hdr = db_node_decode(ctx, node, size);
+	if (!hdr)
+		return NULL;
 
 	trace_tdb("read %s size %zu\n", db_name, *size + strlen(db_name));
 
@@ -564,19 +862,35 @@ static const struct xs_permissions *perms_from_node_hdr(
 	return (const struct xs_permissions *)(hdr + 1);
 }
 
-static void get_acc_data(const char *name, struct node_account_data *acc)
+#ifndef NO_READER_THREADS
+/*
+ * Copy the payload of the XS_READ or XS_DIRECTORY reply for a node into a
+ * malloc()-ed buffer.  Called by the reader threads, so no talloc and no
+ * tracing.
+ */
+int db_read_reply(const char *name, enum xsd_sockmsg_type type, char **data,
+		  unsigned int *len)
 {
-	size_t size;
-	const struct node_hdr *hdr;
+	const struct db_node *node;
 
+	node = hashtable_search(nodes, name);
+	if (!node)
+		return ENOENT;
+
+	return db_node_payload(node, type == XS_DIRECTORY, data, len);
+}
+#endif
+
+static void get_acc_data(const struct db_node *node,
+			 struct node_account_data *acc)
+{
 	if (acc->memory < 0) {
-		hdr = db_fetch(name, &size);
-		/* No check for error, as the node might not exist. */
-		if (hdr == NULL) {
+		/* The node might not exist. */
+		if (node == NULL) {
 			acc->memory = 0;
 		} else {
-			acc->memory = size;
-			acc->domid = perms_from_node_hdr(hdr)->id;
+			acc->memory = db_node_size(node);
+			acc->domid = db_node_owner(node);
 		}
 	}
 }
@@ -593,15 +907,34 @@ static unsigned int get_acc_domid(struct connection *conn, const char *name,
 	return (!conn || name[0] == '/' || name[0] == '@') ? domid : conn->id;
 }
 
-int db_write(struct connection *conn, const char *db_name, void *data,
-	     size_t size, struct node_account_data *acc,
+/* Add a new node to the data base or replace the existing one (old). */
+static int db_store(struct db_node *node, struct db_node *old,
+		    enum write_node_mode mode)
+{
+	int ret;
+
+	if (mode == NODE_CREATE)
+		return hashtable_add(nodes, node, node);
+
+	if (!old)
+		return ENOENT;
+	/* The node is the key, too. */
+	ret = hashtable_replace(nodes, node, node);
+	if (!ret)
+		db_node_free(old);
+
+	return ret;
+}
+
+int db_write(struct connection *conn, const char *db_name,
+	     const void *data, size_t size, struct node_account_data *acc,
 	     enum write_node_mode mode, bool no_quota_check)
 {
 	const struct node_hdr *hdr = data;
 	struct node_account_data old_acc = {};
 	unsigned int old_domid, new_domid;
 	size_t name_len = strlen(db_name);
-	const char *name;
+	struct db_node *node, *old = NULL;
 	int ret;
 
 	if (!acc)
@@ -609,7 +942,14 @@ int db_write(struct connection *conn, const char *db_name, void *data,
 	else
 		old_acc = *acc;
 
-	get_acc_data(db_name, &old_acc);
+	if (mode == NODE_MODIFY || old_acc.memory < 0)
+		old = hashtable_search(nodes, db_name);
+	get_acc_data(old, &old_acc);
+
+	node = db_node_encode(db_name, hdr, old);
+	if (!node)
+		return errno;
+
 	old_domid = get_acc_domid(conn, db_name, old_acc.domid);
 	new_domid = get_acc_domid(conn, db_name, perms_from_node_hdr(hdr)->id);
 
@@ -623,6 +963,7 @@ int db_write(struct connection *conn, const char *db_name, void *data,
 	ret = domain_memory_add(conn, new_domid, size + name_len,
 				no_quota_check);
 	if (ret) {
+		db_node_free(node);
 		/* Error path, so no quota check. */
 		if (old_acc.memory)
 			domain_memory_add_nochk(conn, old_domid,
@@ -630,16 +971,9 @@ int db_write(struct connection *conn, const char *db_name, void *data,
 		return ret;
 	}
 
-	if (mode == NODE_CREATE) {
-		/* db_name could be modified later, so allocate a copy. */
-		name = talloc_strdup(data, db_name);
-		ret = name ? hashtable_add(nodes, name, data) : ENOMEM;
-	} else
-		ret = hashtable_replace(nodes, db_name, data);
-
+	ret = db_store(node, old, mode);
 	if (ret) {
-		/* Free data, as it isn't owned by hashtable now. */
-		talloc_free(data);
+		db_node_free(node);
 		domain_memory_add_nochk(conn, new_domid, -size - name_len);
 		/* Error path, so no quota check. */
 		if (old_acc.memory)
@@ -650,6 +984,9 @@ int db_write(struct connection *conn, const char *db_name, void *data,
 	}
 	trace_tdb("store %s size %zu\n", db_name, size + name_len);
 
+	if (persist_enabled())
+		persist_write(db_name, data, size);
+
 	if (acc) {
 		/* Don't use new_domid, as it might be a transaction node. */
 		acc->domid = perms_from_node_hdr(hdr)->id;
@@ -663,6 +1000,7 @@ void db_delete(struct connection *conn, const char *name,
 	       struct node_account_data *acc)
 {
 	struct node_account_data tmp_acc;
+	struct db_node *node;
 	unsigned int domid;
 
 	if (!acc) {
@@ -670,11 +1008,18 @@ void db_delete(struct connection *conn, const char *name,
 		acc->memory = -1;
 	}
 
-	get_acc_data(name, acc);
+	node = hashtable_search(nodes, name);
+	get_acc_data(node, acc);
 
-	hashtable_remove(nodes, name);
+	if (node) {
+		hashtable_remove(nodes, node);
+		db_node_free(node);
+	}
 	trace_tdb("delete %s\n", name);
 
+	if (persist_enabled())
+		persist_delete(name);
+
 	if (acc->memory) {
 		domid = get_acc_domid(conn, name, acc->domid);
 		domain_memory_add_nochk(conn, domid,
@@ -682,16 +1027,138 @@ void db_delete(struct connection *conn, const char *name,
 	}
 }
 
+#ifndef NO_PERSIST
+/*
+ * Add or replace a persisted node.  Accounting is done for all nodes by
+ * db_restore_finish() when all persisted data has been read.
+ */
+void db_restore_node(const char *db_name, const void *data, size_t size)
+{
+	const struct node_hdr *hdr = data;
+	struct db_node *node, *old;
+
+	if (size < sizeof(*hdr) || !hdr->num_perms ||
+	    calc_node_acc_size(hdr) != size)
+		barf("persist: corrupted node %s", db_name);
+
+	old = hashtable_search(nodes, db_name);
+	node = db_node_encode(db_name, hdr, old);
+	if (!node || db_store(node, old, old ? NODE_MODIFY : NODE_CREATE))
+		barf("persist: adding node %s failed", db_name);
+}
+
+void db_restore_delete(const char *db_name)
+{
+	struct db_node *node = hashtable_search(nodes, db_name);
+
+	if (node) {
+		hashtable_remove(nodes, node);
+		db_node_free(node);
+	}
+}
+
+static int db_restore_acc(const void *k, void *v, void *arg)
+{
+	struct db_node *node = v;
+	struct node_perms perms;
+	char *name;
+
+	name = db_node_name(NULL, node);
+	perms.num = node->perms->perms.num;
+	perms.p = talloc_memdup(name, node->perms->p,
+				perms.num * sizeof(*perms.p));
+	if (!name || !perms.p)
+		barf("persist: allocation failure");
+
+	/* Permissions of domains not existing any longer are ignored. */
+	if (domain_alloc_permrefs(&perms))
+		barf("persist: allocation failure");
+
+	/* Nodes of such domains are taken over by dom0, as orphans are. */
+	if (perms.p[0].perms & XS_PERM_IGNORE) {
+		perms.p[0].perms &= ~XS_PERM_IGNORE;
+		perms.p[0].id = priv_domid;
+		trace("persist: orphaned node %s moved to dom0\n", name);
+	}
+
+	if (memcmp(perms.p, node->perms->p, perms.num * sizeof(*perms.p)) &&
+	    db_node_set_perms(node, perms.p, perms.num))
+		barf("persist: allocation failure");
+
+	/* Younger than all domains referenced. */
+	node->generation = ++generation;
+
+	if (domain_nbentry_inc(NULL, perms.p[0].id))
+		barf("persist: node accounting error for %s", name);
+	domain_memory_add_nochk(NULL, perms.p[0].id,
+				db_node_size(node) + strlen(name));
+
+	talloc_free(name);
+
+	return 0;
+}
+
+void db_restore_finish(void)
+{
+	if (!hashtable_search(nodes, "/"))
+		barf("persist: no root node found");
+
+	hashtable_iterate(nodes, db_restore_acc, NULL);
+}
+
+struct db_for_each_data {
+	int (*func)(const char *db_name, const struct node_hdr *hdr,
+		    size_t size, void *arg);
+	void *arg;
+};
+
+static int db_for_each_sub(const void *k, void *v, void *arg)
+{
+	struct db_for_each_data *data = arg;
+	struct node_hdr *hdr;
+	size_t size;
+	char *name;
+	int ret;
+
+	name = db_node_name(NULL, v);
+	if (!name)
+		return ENOMEM;
+
+	/* Skip transaction specific nodes. */
+	if (name[0] != '/' && name[0] != '@') {
+		talloc_free(name);
+		return 0;
+	}
+
+	hdr = db_node_decode(name, v, &size);
+	ret = hdr ? data->func(name, hdr, size, data->arg) : ENOMEM;
+	talloc_free(name);
+
+	return ret;
+}
+
+/* Call func for each node of the global data base. */
+int db_for_each_node(int (*func)(const char *db_name,
+				 const struct node_hdr *hdr, size_t size,
+				 void *arg),
+		     void *arg)
+{
+	struct db_for_each_data data = { .func = func, .arg = arg };
+
+	return hashtable_iterate(nodes, db_for_each_sub, &data);
+}
+#endif
+
 /*
  * If it fails, returns NULL and sets errno.
  * Temporary memory allocations will be done with ctx.
  */
 static struct node *read_node_alloc(struct connection *conn, const void *ctx,
-				    const char *name,
-				    const struct node_hdr **hdr)
+				    const char *name)
 {
 	size_t size;
 	struct node *node;
+	struct node_hdr *hdr;
 	const char *db_name;
 	int err;
 
@@ -708,8 +1175,10 @@ static struct node *read_node_alloc(struct connection *conn, const void *ctx,
 	}
 
 	db_name = transaction_prepend(conn, name);
-	*hdr = db_fetch(db_name, &size);
-	if (*hdr == NULL) {
+	hdr = db_fetch(node, db_name, &size);
+	if (hdr == NULL) {
+		if (errno == ENOMEM)
+			goto error;
 		node->hdr.generation = NO_GENERATION;
 		err = access_node(conn, node, NODE_ACCESS_READ, NULL);
 		errno = err ? : ENOENT;
@@ -719,10 +1188,13 @@ static struct node *read_node_alloc(struct connection *conn, const void *ctx,
 	node->parent = NULL;
 
 	/* Datalen, childlen, number of permissions */
-	node->hdr = **hdr;
-	node->acc.domid = perms_from_node_hdr(*hdr)->id;
+	node->hdr = *hdr;
+	node->acc.domid = perms_from_node_hdr(hdr)->id;
 	node->acc.memory = size;
 
+	/* The node owns the copy of the data base contents. */
+	node->perms = (struct xs_permissions *)perms_from_node_hdr(hdr);
+
 	return node;
 
  error:
@@ -753,53 +1225,25 @@ static bool read_node_helper(struct connection *conn, struct node *node)
 struct node *read_node(struct connection *conn, const void *ctx,
 		       const char *name)
 {
-	size_t size;
-	const struct node_hdr *hdr;
 	struct node *node;
 
-	node = read_node_alloc(conn, ctx, name, &hdr);
+	node = read_node_alloc(conn, ctx, name);
 	if (!node)
 		return NULL;
 
-	/* Copy node data to new memory area, starting with permissions. */
-	size = node->acc.memory - sizeof(*hdr);
-	node->perms = talloc_memdup(node, perms_from_node_hdr(hdr), size);
-	if (node->perms == NULL) {
-		errno = ENOMEM;
-		goto error;
+	if (!read_node_helper(conn, node)) {
+		talloc_free(node);
+		return NULL;
 	}
 
-	if (!read_node_helper(conn, node))
-		goto error;
-
 	return node;
-
- error:
-	talloc_free(node);
-	return NULL;
 }
 
 const struct node *read_node_const(struct connection *conn, const void *ctx,
 				   const char *name)
 {
-	const struct node_hdr *hdr;
-	struct node *node;
-
-	node = read_node_alloc(conn, ctx, name, &hdr);
-	if (!node)
-		return NULL;
-
-	/* Unfortunately node->perms isn't const. */
-	node->perms = (void *)perms_from_node_hdr(hdr);
-
-	if (!read_node_helper(conn, node))
-		goto error;
-
-	return node;
-
- error:
-	talloc_free(node);
-	return NULL;
+	/* Nodes are decoded from the data base anyway, so nothing to save. */
+	return read_node(conn, ctx, name);
 }
 
 static bool read_node_can_propagate_errno(void)
@@ -1002,9 +1446,14 @@ static struct buffered_data *new_buffer(void *ctx)
 {
 	struct buffered_data *data;
 
-	data = talloc_zero(ctx, struct buffered_data);
-	if (data == NULL)
-		return NULL;
+	if (buffer_cache_n) {
+		data = talloc_steal(ctx, buffer_cache[--buffer_cache_n]);
+		memset(data, 0, sizeof(*data));
+	} else {
+		data = talloc_zero(ctx, struct buffered_data);
+		if (data == NULL)
+			return NULL;
+	}
 	
 	data->inhdr = true;
 	return data;
@@ -1048,10 +1497,26 @@ unsigned int get_strings(struct buffered_data *data,
 	return i;
 }
 
+/*
+ * The replies of the operations of a XS_MULTI request, each with its own
+ * struct xsd_sockmsg header, or the error of the first failing operation.
+ */
+struct multi_reply {
+	unsigned int len;
+	int err;
+	char buf[XENSTORE_PAYLOAD_MAX];
+};
+
 static void send_error(struct connection *conn, int error)
 {
 	unsigned int i;
 
+	if (conn->multi) {
+		acc_drop(conn);
+		conn->multi->err = error;
+		return;
+	}
+
 	for (i = 0; error != xsd_errors[i].errnum; i++) {
 		if (i == ARRAY_SIZE(xsd_errors) - 1) {
 			eprintf("xenstored: error %i untranslatable", error);
@@ -1081,6 +1546,20 @@ void send_reply(struct connection *conn, enum xsd_sockmsg_type type,
 		return;
 	}
 
+	if (conn->multi) {
+		struct multi_reply *multi = conn->multi;
+		struct xsd_sockmsg hdr = { .type = type, .len = len };
+
+		if (len + sizeof(hdr) > sizeof(multi->buf) - multi->len) {
+			multi->err = E2BIG;
+			return;
+		}
+		memcpy(multi->buf + multi->len, &hdr, sizeof(hdr));
+		memcpy(multi->buf + multi->len + sizeof(hdr), data, len);
+		multi->len += sizeof(hdr) + len;
+		return;
+	}
+
 	if (!bdata)
 		return;
 	bdata->inhdr = true;
@@ -1113,67 +1592,188 @@ void send_reply(struct connection *conn, enum xsd_sockmsg_type type,
 	/* Queue for later transmission. */
 	list_add_tail(&bdata->list, &conn->out_list);
 	bdata->on_out_list = true;
+	conn_mark_busy(conn);
 	domain_outstanding_inc(conn);
 }
 
+#ifndef NO_READER_THREADS
 /*
- * Send a watch event.
+ * A reader thread has written "written" bytes of a reply, queue the rest.
+ * Watch events might have been queued meanwhile, so it goes to the head.
+ */
+void conn_read_done(struct connection *conn, const struct xsd_sockmsg *hdr,
+		    const char *data, unsigned int written, bool failed)
+{
+	struct buffered_data *bdata, reply = { .hdr.msg = *hdr };
+
+	/* Waiting for output can be resumed. */
+	conn_mark_busy(conn);
+
+	reply.buffer = (char *)data;
+	if (!data)
+		reply.hdr.msg.len = 0;
+	trace_io(conn, &reply, failed ? "OUT(ERR)" : "OUT");
+
+	if (failed) {
+		ignore_connection(conn, XENSTORE_ERROR_RINGIDX);
+		return;
+	}
+	if (written == sizeof(*hdr) + hdr->len)
+		return;
+
+	bdata = new_buffer(conn);
+	if (bdata && hdr->len > DEFAULT_BUFFER_SIZE)
+		bdata->buffer = talloc_array(bdata, char, hdr->len);
+	else if (bdata)
+		bdata->buffer = bdata->default_buffer;
+	if (!bdata || !bdata->buffer) {
+		ignore_connection(conn, XENSTORE_ERROR_RINGIDX);
+		return;
+	}
+
+	bdata->hdr.msg = *hdr;
+	memcpy(bdata->buffer, data, hdr->len);
+	if (written < sizeof(*hdr))
+		bdata->used = written;
+	else {
+		bdata->inhdr = false;
+		bdata->used = written - sizeof(*hdr);
+	}
+
+	domain_memory_add_nochk(conn, conn->id, hdr->len + sizeof(bdata->hdr));
+	list_add(&bdata->list, &conn->out_list);
+	bdata->on_out_list = true;
+	conn_mark_busy(conn);
+	domain_outstanding_inc(conn);
+}
+#endif
+
+static struct {
+	unsigned long queued;
+	unsigned long coalesced;
+	unsigned long overflows;
+	unsigned long dropped;
+	unsigned int pending_max;
+} event_stats;
+
+/* Pending watch events of a connection are hashed by their payload. */
+static unsigned int event_hash_fn(const void *k)
+{
+	const struct buffered_data *bdata = k;
+	const unsigned char *data = (const unsigned char *)bdata->buffer;
+	unsigned int i, hash = 5381;
+
+	for (i = 0; i < bdata->hdr.msg.len; i++)
+		hash = ((hash << 5) + hash) + data[i];
+
+	return hash;
+}
+
+static int event_equal_fn(const void *key1, const void *key2)
+{
+	const struct buffered_data *bdata1 = key1, *bdata2 = key2;
+
+	return bdata1->hdr.msg.len == bdata2->hdr.msg.len &&
+	       !memcmp(bdata1->buffer, bdata2->buffer, bdata1->hdr.msg.len);
+}
+
+/*
+ * Make a watch event queued for conn known for coalescing.  Special events
+ * are excluded from that.
+ */
+static int event_register(struct connection *conn,
+			  struct buffered_data *bdata)
+{
+	int ret;
+
+	if (bdata->buffer[0] != '@') {
+		if (!conn->events) {
+			conn->events = create_hashtable(conn, "events",
+							event_hash_fn,
+							event_equal_fn, 0);
+			if (!conn->events)
+				return ENOMEM;
+		}
+		ret = hashtable_add(conn->events, bdata, bdata);
+		if (ret)
+			return ret;
+	}
+
+	bdata->watch_event = true;
+	conn->events_pending++;
+	if (event_stats.pending_max < conn->events_pending)
+		event_stats.pending_max = conn->events_pending;
+
+	return 0;
+}
+
+/*
+ * Send a watch event for path to a watch of conn on watch_path.
  * As this is not directly related to the current command, errors can't be
  * reported.
  */
 void send_event(struct buffered_data *req, struct connection *conn,
-		const char *path, const char *token)
+		const char *path, const char *token, const char *watch_path)
 {
-	struct buffered_data *bdata, *bd;
+	struct buffered_data *bdata;
 	unsigned int len;
 
+	/*
+	 * A connection not consuming its events gets a single event for the
+	 * watched node instead of one per modified node below it, telling
+	 * it to look at all of them.  This bounds the queue by the number of
+	 * watches.  Special events are never merged, but they are rare.
+	 */
+	if (path[0] != '@' &&
+	    domain_max_chk(conn, ACC_EVENTS, conn->events_pending + 1)) {
+		if (strcmp(path, watch_path))
+			event_stats.overflows++;
+		path = watch_path;
+	}
+
 	len = strlen(path) + 1 + strlen(token) + 1;
 	/* Don't try to send over-long events. */
 	if (len > XENSTORE_PAYLOAD_MAX)
-		return;
+		goto drop;
 
 	bdata = new_buffer(conn);
 	if (!bdata)
-		return;
+		goto drop;
 
 	bdata->buffer = talloc_array(bdata, char, len);
-	if (!bdata->buffer) {
-		talloc_free(bdata);
-		return;
-	}
+	if (!bdata->buffer)
+		goto drop_buf;
 	strcpy(bdata->buffer, path);
 	strcpy(bdata->buffer + strlen(path) + 1, token);
 	bdata->hdr.msg.type = XS_WATCH_EVENT;
 	bdata->hdr.msg.len = len;
 
-	/*
-	 * Check whether an identical event is pending already.
-	 * Special events are excluded from that check.
-	 */
-	if (path[0] != '@') {
-		list_for_each_entry(bd, &conn->out_list, list) {
-			if (bd->watch_event && bd->hdr.msg.len == len &&
-			    !memcmp(bdata->buffer, bd->buffer, len)) {
-				trace("dropping duplicate watch %s %s for domain %u\n",
-				      path, token, conn->id);
-				talloc_free(bdata);
-				return;
-			}
-		}
-	}
-
-	if (domain_memory_add_chk(conn, conn->id, len + sizeof(bdata->hdr))) {
+	/* Check whether an identical event is pending already. */
+	if (conn->events && path[0] != '@' &&
+	    hashtable_search(conn->events, bdata)) {
+		trace("dropping duplicate watch %s %s for domain %u\n",
+		      path, token, conn->id);
+		event_stats.coalesced++;
 		talloc_free(bdata);
 		return;
 	}
 
+	if (domain_memory_add_chk(conn, conn->id, len + sizeof(bdata->hdr)))
+		goto drop_buf;
+
+	if (event_register(conn, bdata)) {
+		domain_memory_add_nochk(conn, conn->id,
+					-len - sizeof(bdata->hdr));
+		goto drop_buf;
+	}
+	event_stats.queued++;
+
 	if (timeout_watch_event_msec && domain_is_unprivileged(conn)) {
 		bdata->timeout_msec = get_now_msec() + timeout_watch_event_msec;
 		if (!conn->timeout_msec)
 			conn->timeout_msec = bdata->timeout_msec;
 	}
 
-	bdata->watch_event = true;
 	bdata->pend.req = req;
 	if (req)
 		req->pend.ref.event_cnt++;
@@ -1181,6 +1781,50 @@ void send_event(struct buffered_data *req, struct connection *conn,
 	/* Queue for later transmission. */
 	list_add_tail(&bdata->list, &conn->out_list);
 	bdata->on_out_list = true;
+	conn_mark_busy(conn);
+	return;
+
+ drop_buf:
+	talloc_free(bdata);
+ drop:
+	trace("dropping watch %s %s for domain %u\n", path, token, conn->id);
+	event_stats.dropped++;
+}
+
+int watch_event_stats(const void *ctx, struct connection *conn)
+{
+	struct connection *i;
+	unsigned long pending = 0;
+	char *resp;
+
+	list_for_each_entry(i, &connections, list)
+		pending += i->events_pending;
+
+	resp = talloc_asprintf(ctx,
+		"Watch events:\n"
+		"%-17s: %8lu\n"
+		"%-17s: %8lu\n"
+		"%-17s: %8lu\n"
+		"%-17s: %8lu\n"
+		"%-17s: %8lu\n"
+		"%-17s: %8u\n",
+		"queued", event_stats.queued,
+		"coalesced", event_stats.coalesced,
+		"overflows", event_stats.overflows,
+		"dropped", event_stats.dropped,
+		"pending", pending,
+		"pending-max", event_stats.pending_max);
+	if (!resp)
+		return ENOMEM;
+
+	send_reply(conn, XS_CONTROL, resp, strlen(resp) + 1);
+
+	return 0;
+}
+
+void watch_event_stats_reset(void)
+{
+	memset(&event_stats, 0, sizeof(event_stats));
 }
 
 /* Some routines (write, mkdir, etc) just need a non-error return */
@@ -1318,6 +1962,9 @@ static int send_directory(const void *ctx, struct connection *conn,
 	if (!node)
 		return errno;
 
+	if (conn->transaction)
+		ta_node_children_read(conn->transaction, node->name);
+
 	send_reply(conn, XS_DIRECTORY, node->children, node->hdr.childlen);
 
 	return 0;
@@ -1339,6 +1986,9 @@ static int send_directory_part(const void *ctx, struct connection *conn,
 	if (!node)
 		return errno;
 
+	if (conn->transaction)
+		ta_node_children_read(conn->transaction, node->name);
+
 	/* Second arg is childlist offset. */
 	off = atoi(in->buffer + strlen(in->buffer) + 1);
 
@@ -1994,6 +2644,9 @@ int walk_node_tree(const void *ctx, struct connection *conn, const char *root,
 	return ret < 0 ? ret : WALK_TREE_OK;
 }
 
+static int do_multi(const void *ctx, struct connection *conn,
+		    struct buffered_data *in);
+
 static struct {
 	const char *str;
 	int (*func)(const void *ctx, struct connection *conn,
@@ -2001,12 +2654,15 @@ static struct {
 	unsigned int flags;
 #define XS_FLAG_NOTID		(1U << 0)	/* Ignore transaction id. */
 #define XS_FLAG_PRIV		(1U << 1)	/* Privileged domain only. */
+#define XS_FLAG_MULTI		(1U << 2)	/* Allowed in XS_MULTI. */
 } const wire_funcs[XS_TYPE_COUNT] = {
 	[XS_CONTROL]           =
 	    { "CONTROL",       do_control,      XS_FLAG_PRIV },
-	[XS_DIRECTORY]         = { "DIRECTORY",         send_directory },
-	[XS_READ]              = { "READ",              do_read },
-	[XS_GET_PERMS]         = { "GET_PERMS",         do_get_perms },
+	[XS_DIRECTORY]         =
+	    { "DIRECTORY",     send_directory,  XS_FLAG_MULTI },
+	[XS_READ]              = { "READ",      do_read,         XS_FLAG_MULTI },
+	[XS_GET_PERMS]         =
+	    { "GET_PERMS",     do_get_perms,    XS_FLAG_MULTI },
 	[XS_WATCH]             =
 	    { "WATCH",         do_watch,        XS_FLAG_NOTID },
 	[XS_UNWATCH]           =
@@ -2018,10 +2674,11 @@ static struct {
 	[XS_RELEASE]           =
 	    { "RELEASE",       do_release,      XS_FLAG_PRIV },
 	[XS_GET_DOMAIN_PATH]   = { "GET_DOMAIN_PATH",   do_get_domain_path },
-	[XS_WRITE]             = { "WRITE",             do_write },
-	[XS_MKDIR]             = { "MKDIR",             do_mkdir },
-	[XS_RM]                = { "RM",                do_rm },
-	[XS_SET_PERMS]         = { "SET_PERMS",         do_set_perms },
+	[XS_WRITE]             = { "WRITE",     do_write,        XS_FLAG_MULTI },
+	[XS_MKDIR]             = { "MKDIR",     do_mkdir,        XS_FLAG_MULTI },
+	[XS_RM]                = { "RM",        do_rm,           XS_FLAG_MULTI },
+	[XS_SET_PERMS]         =
+	    { "SET_PERMS",     do_set_perms,    XS_FLAG_MULTI },
 	[XS_WATCH_EVENT]       = { "WATCH_EVENT",       NULL },
 	[XS_ERROR]             = { "ERROR",             NULL },
 	[XS_IS_DOMAIN_INTRODUCED] =
@@ -2032,6 +2689,7 @@ static struct {
 	    { "SET_TARGET",    do_set_target,   XS_FLAG_PRIV },
 	[XS_RESET_WATCHES]     = { "RESET_WATCHES",     do_reset_watches },
 	[XS_DIRECTORY_PART]    = { "DIRECTORY_PART",    send_directory_part },
+	[XS_MULTI]             = { "MULTI",             do_multi },
 };
 
 static const char *sockmsg_string(enum xsd_sockmsg_type type)
@@ -2042,6 +2700,131 @@ static const char *sockmsg_string(enum xsd_sockmsg_type type)
 	return "**UNKNOWN**";
 }
 
+/*
+ * Execute the operations contained in a XS_MULTI request, each consisting of
+ * a struct xsd_sockmsg header and the payload of the single request.  All of
+ * them are done or none: outside of a transaction an internal one is used,
+ * inside of a transaction it is marked to fail if an operation fails.
+ */
+static int do_multi(const void *ctx, struct connection *conn,
+		    struct buffered_data *in)
+{
+	struct transaction *trans = NULL;
+	struct multi_reply *multi;
+	struct buffered_data *op;
+	struct xsd_sockmsg hdr;
+	unsigned int off;
+	void *opctx;
+	int ret = 0;
+
+	multi = talloc_zero(ctx, struct multi_reply);
+	op = talloc_zero(ctx, struct buffered_data);
+	if (!multi || !op)
+		return ENOMEM;
+
+	if (!conn->transaction) {
+		trans = transaction_new(ctx, conn);
+		if (!trans)
+			return ENOMEM;
+		conn->transaction = trans;
+	}
+
+	conn->multi = multi;
+	for (off = 0; off < in->used && !ret; off += sizeof(hdr) + hdr.len) {
+		if (in->used - off < sizeof(hdr)) {
+			ret = EINVAL;
+			break;
+		}
+		memcpy(&hdr, in->buffer + off, sizeof(hdr));
+		if (hdr.len > in->used - off - sizeof(hdr) ||
+		    hdr.type >= XS_TYPE_COUNT ||
+		    !(wire_funcs[hdr.type].flags & XS_FLAG_MULTI)) {
+			ret = EINVAL;
+			break;
+		}
+
+		op->hdr.msg = hdr;
+		op->buffer = in->buffer + off + sizeof(hdr);
+		op->used = hdr.len;
+
+		opctx = talloc_new(ctx);
+		if (!opctx) {
+			ret = ENOMEM;
+			break;
+		}
+		ret = wire_funcs[hdr.type].func(opctx, conn, op);
+		talloc_free(opctx);
+		if (!ret)
+			ret = multi->err;
+	}
+	conn->multi = NULL;
+
+	if (trans) {
+		conn->transaction = NULL;
+		if (!ret)
+			ret = transaction_commit(conn, trans);
+	} else if (ret)
+		fail_transaction(conn->transaction);
+
+	if (ret)
+		return ret;
+
+	send_reply(conn, XS_MULTI, multi->buf, multi->len);
+
+	return 0;
+}
+
+/*
+ * The temporary allocations of a request are carved from a pool, which is
+ * reused for the next request once they have all been freed.  Anything
+ * allocated for longer lived objects must not use the request's context as
+ * parent, but be moved to it after allocation, see write_node_raw().
+ */
+#define REQUEST_POOL_SIZE 16384
+static void *request_pool;
+static size_t request_pool_max;
+static unsigned int request_pool_lost;
+
+static void *request_ctx_new(void)
+{
+	/* If the pool can't be allocated, this is a normal context. */
+	if (!request_pool)
+		request_pool = talloc_pool(NULL, REQUEST_POOL_SIZE);
+
+	return talloc_new(request_pool);
+}
+
+static void request_ctx_free(void *ctx)
+{
+	size_t used;
+
+	if (request_pool) {
+		used = talloc_pool_used(request_pool);
+		if (used > request_pool_max)
+			request_pool_max = used;
+	}
+
+	talloc_free(ctx);
+
+	/*
+	 * Something allocated from the pool is still in use.  Leave the pool
+	 * to it and start a new one.
+	 */
+	if (request_pool && talloc_pool_used(request_pool)) {
+		talloc_free(request_pool);
+		request_pool = NULL;
+		request_pool_lost++;
+	}
+}
+
+void request_pool_report(FILE *fp)
+{
+	fprintf(fp, "request pool: size %u, max. used %zu, replaced %u times\n",
+		REQUEST_POOL_SIZE, request_pool_max, request_pool_lost);
+	fprintf(fp, "buffer cache: %u of %u entries\n", buffer_cache_n,
+		BUFFER_CACHE_SIZE);
+}
+
 /* Process "in" for conn: "in" will vanish after this conversation, so
  * we can talloc off it for temporary variables.  May free "conn".
  */
@@ -2075,7 +2858,7 @@ static void process_message(struct connection *conn, struct buffered_data *in)
 		return;
 	}
 
-	ctx = talloc_new(NULL);
+	ctx = request_ctx_new();
 	if (!ctx) {
 		send_error(conn, ENOMEM);
 		return;
@@ -2085,11 +2868,13 @@ static void process_message(struct connection *conn, struct buffered_data *in)
 	conn->transaction = trans;
 
 	ret = wire_funcs[type].func(ctx, conn, in);
-	talloc_free(ctx);
+	request_ctx_free(ctx);
 	if (ret)
 		send_error(conn, ret);
 
 	conn->transaction = NULL;
+
+	persist_commit();
 }
 
 static bool process_delayed_message(struct delayed_request *req)
@@ -2112,6 +2897,34 @@ static bool process_delayed_message(struct delayed_request *req)
 	return true;
 }
 
+/*
+ * Hand a read-only request to a reader thread.  Only requests whose reply
+ * depends on nothing but the node qualify: outside of a transaction and from
+ * a privileged socket connection, so without permission checks.  Invalid
+ * paths are left to the main thread for the error handling.
+ */
+static bool offload_read(struct connection *conn, struct buffered_data *in)
+{
+	const char *name;
+
+	if (!reader_enabled() || conn->domain ||
+	    domain_is_unprivileged(conn) || in->hdr.msg.tx_id ||
+	    !list_empty(&conn->out_list) || lu_is_pending())
+		return false;
+	if (in->hdr.msg.type != XS_READ && in->hdr.msg.type != XS_DIRECTORY)
+		return false;
+
+	name = canonicalize(conn, in, onearg(in), false);
+	if (!name || !reader_queue(conn, &in->hdr.msg, name))
+		return false;
+
+	trace_io(conn, in, "IN");
+	conn->in = NULL;
+	talloc_free(in);
+
+	return true;
+}
+
 static void consider_message(struct connection *conn)
 {
 	conn->is_stalled = false;
@@ -2138,7 +2951,8 @@ static void consider_message(struct connection *conn)
 		return;
 	}
 
-	process_message(conn, conn->in);
+	if (!offload_read(conn, conn->in))
+		process_message(conn, conn->in);
 
 	assert(conn->in == NULL);
 }
@@ -2235,7 +3049,9 @@ struct connection *new_connection(const struct interface_funcs *funcs)
 		return NULL;
 
 	new->fd = -1;
-	new->pollfd_idx = -1;
+	new->fd_event.fd = -1;
+	new->fd_event.idx = -1;
+	new->fd_event.conn = new;
 	new->funcs = funcs;
 	new->is_ignored = false;
 	new->is_stalled = false;
@@ -2245,8 +3061,11 @@ struct connection *new_connection(const struct interface_funcs *funcs)
 	INIT_LIST_HEAD(&new->watches);
 	INIT_LIST_HEAD(&new->transaction_list);
 	INIT_LIST_HEAD(&new->delayed);
+	INIT_LIST_HEAD(&new->busy_list);
+	INIT_LIST_HEAD(&new->timeout_list);
 
 	list_add_tail(&new->list, &connections);
+	conn_mark_busy(new);
 	talloc_set_destructor(new, destroy_conn);
 	trace_create(new, "connection");
 	return new;
@@ -2286,7 +3105,7 @@ static void manual_node(const char *name, const char *child)
 	talloc_free(node);
 }
 
-static unsigned int hash_from_key_fn(const void *k)
+unsigned int hash_from_key_fn(const void *k)
 {
 	const char *str = k;
 	unsigned int hash = 5381;
@@ -2298,21 +3117,22 @@ static unsigned int hash_from_key_fn(const void *k)
 	return hash;
 }
 
-static int keys_equal_fn(const void *key1, const void *key2)
+int keys_equal_fn(const void *key1, const void *key2)
 {
 	return 0 == strcmp(key1, key2);
 }
 
 void setup_structure(bool live_update)
 {
-	nodes = create_hashtable(NULL, "nodes", hash_from_key_fn, keys_equal_fn,
-				 HASHTABLE_FREE_KEY | HASHTABLE_FREE_VALUE);
+	db_nodes_init();
+	nodes = create_hashtable(NULL, "nodes", db_node_hash_fn,
+				 db_node_equal_fn, 0);
 	if (!nodes)
 		barf_perror("Could not create nodes hashtable");
 
 	if (live_update)
 		manual_node("/", NULL);
-	else {
+	else if (!persist_restore()) {
 		manual_node("/", "tool");
 		manual_node("/tool", "xenstored");
 		manual_node("/tool/xenstored", NULL);
@@ -2381,7 +3201,7 @@ static int clean_store_(const void *key, void *val, void *private)
 {
 	struct hashtable *reachable = private;
 	char *slash;
-	char *name = talloc_strdup(NULL, key);
+	char *name = db_node_name(NULL, val);
 
 	if (!name) {
 		log("clean_store: ENOMEM");
@@ -2528,6 +3348,8 @@ static void usage(void)
 "                          path-length: length of a node path\n"
 "                          transactions: number of concurrent transactions\n"
 "                                        per domain\n"
+"                          watch-events: number of pending watch events per\n"
+"                                        connection\n"
 "                          watches: number of watches per domain"
 "  -q, --quota-soft <what>=<nb> set a soft quota <what> to the value <nb>,\n"
 "                          causing a warning to be issued via syslog() if the\n"
@@ -2537,7 +3359,11 @@ static void usage(void)
 "                          allowed timeout candidates are:\n"
 "                          watch-event: time a watch-event is kept pending\n"
 "  -K, --keep-orphans      don't delete nodes owned by a domain when the\n"
-"                          domain is deleted (this is a security risk!)\n");
+"                          domain is deleted (this is a security risk!)\n"
+"      --reader-threads <nb> serve read requests of privileged socket\n"
+"                          connections by <nb> additional threads\n"
+"      --persist <dir>     keep all nodes in <dir>, restoring them from there\n"
+"                          when starting\n");
 }
 
 
@@ -2562,6 +3388,12 @@ static struct option options[] = {
 	{ "watch-nb", 1, NULL, 'W' },
 #ifndef NO_LIVE_UPDATE
 	{ "live-update", 0, NULL, 'U' },
+#endif
+#ifndef NO_READER_THREADS
+	{ "reader-threads", 1, NULL, 'r' },
+#endif
+#ifndef NO_PERSIST
+	{ "persist", 1, NULL, 'P' },
 #endif
 	{ NULL, 0, NULL, 0 } };
 
@@ -2743,6 +3575,16 @@ int main(int argc, char *argv[])
 		case 'U':
 			live_update = true;
 			break;
+#endif
+#ifndef NO_READER_THREADS
+		case 'r':
+			reader_threads = get_optval_uint(optarg);
+			break;
+#endif
+#ifndef NO_PERSIST
+		case 'P':
+			persist_dir = optarg;
+			break;
 #endif
 		}
 	}
@@ -2780,52 +3622,57 @@ int main(int argc, char *argv[])
 
 	stubdom_init();
 
-	check_store();
+	persist_init();
+
+	/* Walking a large restored data base would delay the start. */
+	if (!persist_restored())
+		check_store();
 
 	/* Get ready to listen to the tools. */
 	initialize_fds(&timeout);
 
 	late_init(live_update);
 
+	reader_init();
+
 	/* Main loop. */
 	for (;;) {
-		struct connection *conn, *next;
-
-		if (poll(poll_fds, nr_fds, timeout) < 0) {
+		LIST_HEAD(round);
+		struct connection *conn;
+		int ret;
+
+		/* Let reader threads in while idle and between requests. */
+		reader_store_unlock();
+		ret = fd_events_wait(timeout);
+		reader_store_lock();
+		if (ret < 0) {
 			if (errno == EINTR)
 				continue;
 			barf_perror("Poll failed");
 		}
 
 		handle_special_fds();
+		reader_handle_fds();
 
-		if (xce_pollfd_idx != -1) {
-			if (poll_fds[xce_pollfd_idx].revents & ~POLLIN) {
-				barf_perror("xce_handle poll failed");
-				break;
-			} else if (poll_fds[xce_pollfd_idx].revents & POLLIN) {
-				handle_event();
-				xce_pollfd_idx = -1;
-			}
+		if (xce_fd_event.revents & ~POLLIN) {
+			barf_perror("xce_handle poll failed");
+			break;
+		} else if (xce_fd_event.revents & POLLIN) {
+			handle_event();
+			xce_fd_event.revents = 0;
 		}
 
 		/*
-		 * list_for_each_entry_safe is not suitable here because
-		 * handle_input may delete entries besides the current one, but
-		 * those may be in the temporary next which would trigger a
-		 * use-after-free.  list_for_each_entry_safe is only safe for
-		 * deleting the current entry.
+		 * Take the busy connections off the list one by one, as
+		 * handle_input may delete connections besides the current one.
+		 * A connection getting busy again meanwhile is left to the
+		 * next iteration, so ready fds get a look in between.
 		 */
-		next = list_entry(connections.next, typeof(*conn), list);
-		if (&next->list != &connections)
-			talloc_increase_ref_count(next);
-		while (&next->list != &connections) {
-			conn = next;
-
-			next = list_entry(conn->list.next,
-					  typeof(*conn), list);
-			if (&next->list != &connections)
-				talloc_increase_ref_count(next);
+		list_splice_init(&busy_conns, &round);
+		while ((conn = list_top(&round, struct connection,
+					busy_list))) {
+			list_del_init(&conn->busy_list);
+			talloc_increase_ref_count(conn);
 
 			if (conn_can_read(conn))
 				handle_input(conn);
@@ -2839,7 +3686,12 @@ int main(int argc, char *argv[])
 			if (talloc_free(conn) == 0)
 				continue;
 
-			conn->pollfd_idx = -1;
+			conn->fd_event.revents = 0;
+			/* Its state needs a look before waiting again. */
+			conn_mark_busy(conn);
+
+			reader_store_unlock();
+			reader_store_lock();
 		}
 
 		if (delayed_requests) {
@@ -3119,6 +3971,9 @@ static void add_buffered_data(struct buffered_data *bdata,
 		barf("error restoring buffered data");
 
 	memcpy(bdata->buffer, data, len);
+	if (bdata->hdr.msg.type == XS_WATCH_EVENT &&
+	    event_register(conn, bdata))
+		barf("error restoring watch event");
 	if (bdata->hdr.msg.type == XS_WATCH_EVENT && timeout_watch_event_msec &&
 	    domain_is_unprivileged(conn)) {
 		bdata->timeout_msec = get_now_msec() + timeout_watch_event_msec;
@@ -3129,6 +3984,7 @@ static void add_buffered_data(struct buffered_data *bdata,
 	/* Queue for later transmission. */
 	list_add_tail(&bdata->list, &conn->out_list);
 	bdata->on_out_list = true;
+	conn_mark_busy(conn);
 	/*
 	 * Watch events are never "outstanding", but the request causing them
 	 * are instead kept "outstanding" until all watch events caused by that
@@ -46,6 +46,16 @@
 #endif
 #endif
 
+/* Reader threads need pthreads. */
+#ifdef __MINIOS__
+#define NO_READER_THREADS
+#endif
+
+/* Persisting nodes needs a file system and fork(). */
+#ifdef __MINIOS__
+#define NO_PERSIST
+#endif
+
 /* DEFAULT_BUFFER_SIZE should be large enough for each errno string. */
 #define DEFAULT_BUFFER_SIZE 16
 
@@ -112,14 +122,41 @@ struct interface_funcs {
 	bool (*can_read)(struct connection *);
 };
 
+/*
+ * A file descriptor the main loop waits on.  The main loop keeps the wanted
+ * events, so they only need to be passed on when they change.  revents
+ * holds the events seen by the last wait, until the fd has been handled.
+ */
+struct fd_event
+{
+	int fd;			/* -1 if not registered */
+	short events;
+	short revents;
+	int idx;		/* Private to the main loop. */
+	struct connection *conn;	/* Marked busy when ready, if any. */
+};
+
+void fd_event_add(struct fd_event *fe, int fd, short events);
+void fd_event_set(struct fd_event *fe, short events);
+void fd_event_del(struct fd_event *fe);
+
+#define FD_EVENT_INIT { .fd = -1, .idx = -1 }
+
 struct connection
 {
 	struct list_head list;
 
+	/* Entry in the list of connections the main loop needs to look at. */
+	struct list_head busy_list;
+	/* Entry in the list of connections with a timeout pending. */
+	struct list_head timeout_list;
+	/* Time of the next timeout, while on the timeout list. */
+	uint64_t timeout_wake;
+
 	/* The file descriptor we came in on. */
 	int fd;
-	/* The index of pollfd in global pollfd array */
-	int pollfd_idx;
+	/* Its registration with the main loop */
+	struct fd_event fd_event;
 
 	/* Who am I? Domid of connection. */
 	unsigned int id;
@@ -137,6 +174,10 @@ struct connection
 	struct list_head out_list;
 	uint64_t timeout_msec;
 
+	/* Watch events in out_list, hashed by payload for coalescing. */
+	unsigned int events_pending;
+	struct hashtable *events;
+
 	/* Not yet committed accounting data (valid if in != NULL). */
 	struct list_head acc_list;
 
@@ -166,6 +207,12 @@ struct connection
 	/* Methods for communicating over this connection. */
 	const struct interface_funcs *funcs;
 
+	/* Request being served by a reader thread, if any. */
+	struct reader_job *read_job;
+
+	/* Replies of the operations of a XS_MULTI request being processed. */
+	struct multi_reply *multi;
+
 	/* Support for live update: connection id. */
 	unsigned int conn_id;
 };
@@ -237,7 +284,11 @@ unsigned int get_string(const struct buffered_data *data, unsigned int offset);
 void send_reply(struct connection *conn, enum xsd_sockmsg_type type,
 		const void *data, unsigned int len);
 void send_event(struct buffered_data *req, struct connection *conn,
-		const char *path, const char *token);
+		const char *path, const char *token, const char *watch_path);
+
+/* Statistics of watch events for "xenstore-control watch-events". */
+int watch_event_stats(const void *ctx, struct connection *conn);
+void watch_event_stats_reset(void);
 
 /* Some routines (write, mkdir, etc) just need a non-error return */
 void send_ack(struct connection *conn, enum xsd_sockmsg_type type);
@@ -305,6 +356,12 @@ void setup_structure(bool live_update);
 struct connection *new_connection(const struct interface_funcs *funcs);
 struct connection *add_socket_connection(int fd);
 struct connection *get_connection_by_id(unsigned int conn_id);
+/*
+ * Have the main loop look at a connection whose state might need action, or
+ * at all of them.
+ */
+void conn_mark_busy(struct connection *conn);
+void conn_mark_all_busy(void);
 void check_store(void);
 void corrupt(struct connection *conn, const char *fmt, ...);
 
@@ -366,8 +423,6 @@ extern int priv_domid;
 extern domid_t stub_domid;
 extern bool keep_orphans;
 
-extern struct pollfd *poll_fds;
-
 extern unsigned int timeout_watch_event_msec;
 
 /* Get internal time in milliseconds. */
@@ -394,7 +449,6 @@ evtchn_port_t get_xenbus_evtchn(void);
 void early_init(bool live_update, bool dofork, const char *pidfile);
 void late_init(bool live_update);
 
-int set_fd(int fd, short events);
 void set_special_fds(void);
 void handle_special_fds(void);
 
@@ -415,16 +469,38 @@ extern xengnttab_handle **xgt_handle;
 
 int remember_string(struct hashtable *hash, const char *str);
 
+/* Hash functions for hashtables keyed by strings. */
+unsigned int hash_from_key_fn(const void *k);
+int keys_equal_fn(const void *key1, const void *key2);
+
 /* Data base access functions. */
-const struct node_hdr *db_fetch(const char *db_name, size_t *size);
-int db_write(struct connection *conn, const char *db_name, void *data,
-	     size_t size, struct node_account_data *acc,
+/*
+ * Nodes are stored in a compact encoding (see nodedb.h): db_fetch() returns
+ * a copy allocated with ctx, and db_write() copies the data.
+ */
+struct node_hdr *db_fetch(const void *ctx, const char *db_name, size_t *size);
+int db_write(struct connection *conn, const char *db_name,
+	     const void *data, size_t size, struct node_account_data *acc,
 	     enum write_node_mode mode, bool no_quota_check);
 void db_delete(struct connection *conn, const char *name,
 	       struct node_account_data *acc);
 
+#ifndef NO_PERSIST
+/* Restoring the data base from persisted nodes, see persist.c. */
+void db_restore_node(const char *db_name, const void *data, size_t size);
+void db_restore_delete(const char *db_name);
+void db_restore_finish(void);
+int db_for_each_node(int (*func)(const char *db_name,
+				 const struct node_hdr *hdr, size_t size,
+				 void *arg),
+		     void *arg);
+#endif
+
 void conn_free_buffered_data(struct connection *conn);
 
+/* Statistics of the request memory pool for "xenstore-control memreport". */
+void request_pool_report(FILE *fp);
+
 const char *dump_state_global(FILE *fp);
 const char *dump_state_buffered_data(FILE *fp, const struct connection *c,
 				     struct xs_state_connection *sc);
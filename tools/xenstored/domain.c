@@ -93,6 +93,11 @@ struct quota hard_quotas[ACC_N] = {
 		.descr = "Max. size of a node",
 		.val = 2048,
 	},
+	[ACC_EVENTS] = {
+		.name = "watch-events",
+		.descr = "Pending watch events per connection",
+		.val = 512,
+	},
 };
 
 struct quota soft_quotas[ACC_N] = {
@@ -163,6 +168,22 @@ struct changed_domain
 
 static struct hashtable *domhash;
 
+/* Domains by local event channel port, for handle_event(). */
+static struct hashtable *porthash;
+
+static void domain_set_port(struct domain *domain, evtchn_port_t port)
+{
+	if (domain->port)
+		hashtable_remove(porthash, &domain->port);
+
+	domain->port = port;
+
+	/* A missing entry only makes handle_event() look at all domains. */
+	if (port && hashtable_add(porthash, &domain->port, domain))
+		syslog(LOG_WARNING, "Failed to add port %u of domain %u\n",
+		       port, domain->domid);
+}
+
 /* Write rate limiting */
 
 /* Satisfies non-overflow condition for wrl_xfer_credit. */
@@ -601,6 +622,9 @@ static int destroy_domain(void *_domain)
 
 	hashtable_remove(domhash, &domain->domid);
 
+	if (domain->port)
+		hashtable_remove(porthash, &domain->port);
+
 	if (!domain->introduced)
 		return 0;
 
@@ -672,16 +696,24 @@ void check_domains(void)
 		fire_special_watches("@releaseDomain");
 }
 
-/* We scan all domains rather than use the information given here. */
+/* Only the connection of the signalling domain needs to be looked at. */
 void handle_event(void)
 {
 	evtchn_port_t port;
+	struct domain *domain;
 
 	if ((port = xenevtchn_pending(xce_handle)) == -1)
 		barf_perror("Failed to read from event fd");
 
 	if (port == virq_port)
 		check_domains();
+	else {
+		domain = hashtable_search(porthash, &port);
+		if (!domain)
+			conn_mark_all_busy();
+		else if (domain->conn)
+			conn_mark_busy(domain->conn);
+	}
 
 	if (xenevtchn_unmask(xce_handle, port) == -1)
 		barf_perror("Failed to write to event fd");
@@ -754,7 +786,8 @@ static struct domain *alloc_domain(const void *context, unsigned int domid)
 {
 	struct domain *domain;
 
-	domain = talloc_zero(context, struct domain);
+	/* Don't take it from the request pool, it will outlive the request. */
+	domain = talloc_steal(context, talloc_zero(NULL, struct domain));
 	if (!domain) {
 		errno = ENOMEM;
 		return NULL;
@@ -799,7 +832,7 @@ static int new_domain(struct domain *domain, int port, bool restore)
 {
 	int rc;
 
-	domain->port = 0;
+	domain_set_port(domain, 0);
 	domain->shutdown = false;
 	domain->path = talloc_domain_path(domain, domain->domid);
 	if (!domain->path) {
@@ -810,14 +843,14 @@ static int new_domain(struct domain *domain, int port, bool restore)
 	wrl_domain_new(domain);
 
 	if (restore)
-		domain->port = port;
+		domain_set_port(domain, port);
 	else {
 		/* Tell kernel we're interested in this event. */
 		rc = xenevtchn_bind_interdomain(xce_handle, domain->domid,
 						port);
 		if (rc == -1)
 			return errno;
-		domain->port = rc;
+		domain_set_port(domain, rc);
 	}
 
 	domain->introduced = true;
@@ -986,6 +1019,9 @@ static struct domain *introduce_domain(const void *ctx,
 			return NULL;
 		}
 		domain->interface = interface;
+		if (interface)
+			interface->server_features |=
+				XENSTORE_SERVER_FEATURE_MULTI;
 
 		if (is_master_domain)
 			setup_structure(restore);
@@ -1000,7 +1036,7 @@ static struct domain *introduce_domain(const void *ctx,
 		if (domain->port)
 			xenevtchn_unbind(xce_handle, domain->port);
 		rc = xenevtchn_bind_interdomain(xce_handle, domid, port);
-		domain->port = (rc == -1) ? 0 : rc;
+		domain_set_port(domain, (rc == -1) ? 0 : rc);
 	}
 
 	return domain;
@@ -1258,6 +1294,10 @@ void domain_early_init(void)
 	if (!domhash)
 		barf_perror("Failed to allocate domain hashtable");
 
+	porthash = create_hashtable(NULL, "ports", domhash_fn, domeq_fn, 0);
+	if (!porthash)
+		barf_perror("Failed to allocate port hashtable");
+
 	xc_handle = talloc(talloc_autofree_context(), xc_interface*);
 	if (!xc_handle)
 		barf_perror("Failed to allocate domain handle");
@@ -1478,6 +1518,10 @@ static int domain_acc_add(struct connection *conn, unsigned int domid,
 		  d->acc[what].val, add);
 	d->acc[what].val = domain_acc_add_valid(d, what, add);
 
+	/* Dropping below a hard quota might let the domain read again. */
+	if (add < 0 && d->conn && (what == ACC_OUTST || what == ACC_MEM))
+		conn_mark_busy(d->conn);
+
 	return d->acc[what].val;
 }
 
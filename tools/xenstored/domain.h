@@ -37,6 +37,7 @@ enum accitem {
 	ACC_NPERM,
 	ACC_PATHLEN,
 	ACC_NODESZ,
+	ACC_EVENTS,
 	ACC_N,			/* Number of elements per domain. */
 };
 
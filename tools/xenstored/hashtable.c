@@ -56,6 +56,28 @@ static unsigned int loadlimit(unsigned int pindex)
     return ((uint64_t)primes[pindex] * MAX_LOAD_PERCENT) / 100;
 }
 
+/*
+ * Entries are allocated with malloc(), as a talloc header would more than
+ * double their size.  Keys and values to be freed are children of the table.
+ */
+static int hashtable_free_entries(void *ptr)
+{
+    struct hashtable *h = ptr;
+    struct entry *e, *f;
+    unsigned int i;
+
+    for (i = 0; i < h->tablelength; i++)
+    {
+        for (e = h->table[i]; e; e = f)
+        {
+            f = e->next;
+            free(e);
+        }
+    }
+
+    return 0;
+}
+
 struct hashtable *create_hashtable(const void *ctx, const char *name,
                                    unsigned int (*hashf) (const void *),
                                    int (*eqf) (const void *, const void *),
@@ -78,6 +100,7 @@ struct hashtable *create_hashtable(const void *ctx, const char *name,
     h->hashfn       = hashf;
     h->eqfn         = eqf;
     h->loadlimit    = loadlimit(h->primeindex);
+    talloc_set_destructor(h, hashtable_free_entries);
     return h;
 
 err1:
@@ -177,7 +200,7 @@ int hashtable_add(struct hashtable *h, const void *k, void *v)
          * element may be ok. Next time we insert, we'll try expanding again.*/
         hashtable_expand(h);
     }
-    e = talloc_zero(h, struct entry);
+    e = malloc(sizeof(*e));
     if (NULL == e)
     {
         --h->entrycount;
@@ -187,10 +210,10 @@ int hashtable_add(struct hashtable *h, const void *k, void *v)
     index = indexFor(h->tablelength,e->h);
     e->k = k;
     if (h->flags & HASHTABLE_FREE_KEY)
-        talloc_steal(e, k);
+        talloc_steal(h, k);
     e->v = v;
     if (h->flags & HASHTABLE_FREE_VALUE)
-        talloc_steal(e, v);
+        talloc_steal(h, v);
     e->next = h->table[index];
     h->table[index] = e;
     return 0;
@@ -213,12 +236,19 @@ int hashtable_replace(struct hashtable *h, const void *k, void *v)
     if (!e)
         return ENOENT;
 
+    if ((h->flags & HASHTABLE_FREE_KEY) && e->k != k)
+    {
+        talloc_free((void *)e->k);
+        talloc_steal(h, k);
+    }
+
     if (h->flags & HASHTABLE_FREE_VALUE)
     {
         talloc_free(e->v);
-        talloc_steal(e, v);
+        talloc_steal(h, v);
     }
 
+    e->k = k;
     e->v = v;
 
     return 0;
@@ -245,7 +275,11 @@ hashtable_remove(struct hashtable *h, const void *k)
         {
             *pE = e->next;
             h->entrycount--;
-            talloc_free(e);
+            if (h->flags & HASHTABLE_FREE_KEY)
+                talloc_free((void *)e->k);
+            if (h->flags & HASHTABLE_FREE_VALUE)
+                talloc_free(e->v);
+            free(e);
             return;
         }
         pE = &(e->next);
@@ -55,7 +55,8 @@ hashtable_add(struct hashtable *h, const void *k, void *v);
  * @return      zero for successful insertion
  *
  * This function does check for an entry being present before replacing it
- * with a new value.
+ * with a new value.  The key of the entry is replaced by k, allowing the key
+ * to be part of the value.
  */
 
 int
@@ -18,6 +18,7 @@
 #include "core.h"
 #include "domain.h"
 #include "lu.h"
+#include "reader.h"
 #include "watch.h"
 
 #ifndef NO_LIVE_UPDATE
@@ -35,6 +36,9 @@ static int lu_destroy(void *data)
 {
 	lu_status = NULL;
 
+	/* Let stalled connections resume after an abort. */
+	conn_mark_all_busy();
+
 	return 0;
 }
 
@@ -211,6 +215,10 @@ static bool lu_check_lu_allowed(void)
 	time_t now = time(NULL);
 	unsigned int ta_total = 0, ta_long = 0;
 
+	/* Replies being written by reader threads would be lost. */
+	if (reader_busy())
+		return false;
+
 	list_for_each_entry(conn, &connections, list) {
 		if (conn->ta_start_time) {
 			ta_total++;
@@ -0,0 +1,487 @@
+/* SPDX-License-Identifier: GPL-2.0-or-later */
+
+/*
+ * Compact encoding of the nodes in the data base of Xen Store Daemon.
+ *
+ * Path components are interned in a hashtable like the strings recorded by
+ * remember_string(), but reference counted and numbered: the id of a
+ * component is its index in comp_table[], so resolving an id is cheap enough
+ * for comparing names while searching the data base.  Ids of components no
+ * longer used are recycled.
+ */
+
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+#include <xen-tools/xenstore-common.h>
+
+#include "utils.h"
+#include "talloc.h"
+#include "core.h"
+#include "nodedb.h"
+
+struct db_comp {
+	unsigned int refs;
+	uint32_t id;
+	unsigned int len;
+	char name[];
+};
+
+/* Components by name and by id. */
+static struct hashtable *comps;
+static struct db_comp **comp_table;
+static uint32_t comp_table_size;
+static uint32_t comp_table_used;
+
+/* Ids of removed components, to be used again. */
+static uint32_t *comp_free;
+static uint32_t comp_free_n;
+
+static struct hashtable *perms_sets;
+static unsigned int perms_sets_n;
+
+/* Memory used by the nodes themselves. */
+static unsigned int db_nodes_n;
+static size_t db_nodes_mem;
+
+static unsigned int perms_hash_fn(const void *k)
+{
+	const struct node_perms *perms = k;
+	const unsigned char *p = (const unsigned char *)perms->p;
+	size_t i, size = perms->num * sizeof(*perms->p);
+	unsigned int hash = 5381;
+
+	for (i = 0; i < size; i++)
+		hash = ((hash << 5) + hash) + p[i];
+
+	return hash;
+}
+
+static int perms_equal_fn(const void *key1, const void *key2)
+{
+	const struct node_perms *perms1 = key1, *perms2 = key2;
+
+	return perms1->num == perms2->num &&
+	       !memcmp(perms1->p, perms2->p, perms1->num * sizeof(*perms1->p));
+}
+
+void db_nodes_init(void)
+{
+	comps = create_hashtable(NULL, "components", hash_from_key_fn,
+				 keys_equal_fn, HASHTABLE_FREE_VALUE);
+	perms_sets = create_hashtable(NULL, "permissions", perms_hash_fn,
+				      perms_equal_fn, HASHTABLE_FREE_VALUE);
+	if (!comps || !perms_sets)
+		barf_perror("Could not create node encoding hashtables");
+}
+
+static int comp_get(const char *name, uint32_t *id)
+{
+	struct db_comp *comp;
+	struct db_comp **table;
+	uint32_t *free_ids;
+	unsigned int len;
+
+	comp = hashtable_search(comps, name);
+	if (comp) {
+		comp->refs++;
+		*id = comp->id;
+		return 0;
+	}
+
+	if (!comp_free_n && comp_table_used == comp_table_size) {
+		len = comp_table_size ? 2 * comp_table_size : 1024;
+		table = talloc_realloc(NULL, comp_table, struct db_comp *, len);
+		if (!table)
+			return ENOMEM;
+		comp_table = table;
+		free_ids = talloc_realloc(NULL, comp_free, uint32_t, len);
+		if (!free_ids)
+			return ENOMEM;
+		comp_free = free_ids;
+		comp_table_size = len;
+	}
+
+	len = strlen(name);
+	comp = talloc_size(NULL, sizeof(*comp) + len + 1);
+	if (!comp)
+		return ENOMEM;
+	comp->refs = 1;
+	comp->id = comp_free_n ? comp_free[comp_free_n - 1] : comp_table_used;
+	comp->len = len;
+	memcpy(comp->name, name, len + 1);
+
+	if (hashtable_add(comps, comp->name, comp)) {
+		talloc_free(comp);
+		return ENOMEM;
+	}
+
+	if (comp_free_n)
+		comp_free_n--;
+	else
+		comp_table_used++;
+	comp_table[comp->id] = comp;
+	*id = comp->id;
+
+	return 0;
+}
+
+/*
+ * Take the id of a child from the old version of a node, its position being
+ * at most one after pos, as children are appended or removed one by one.
+ */
+static bool comp_reuse(const struct db_node *old, unsigned int *pos,
+		       const char *name, uint32_t *id)
+{
+	const uint32_t *ids = old->comps + old->num_comps;
+	struct db_comp *comp;
+	unsigned int i;
+
+	for (i = *pos; i < old->num_children && i <= *pos + 1; i++) {
+		comp = comp_table[ids[i]];
+		if (!strcmp(comp->name, name)) {
+			comp->refs++;
+			*id = ids[i];
+			*pos = i + 1;
+			return true;
+		}
+	}
+
+	return false;
+}
+
+static void comp_put(uint32_t id)
+{
+	struct db_comp *comp = comp_table[id];
+
+	if (--comp->refs)
+		return;
+
+	comp_table[id] = NULL;
+	comp_free[comp_free_n++] = id;
+	hashtable_remove(comps, comp->name);
+}
+
+static struct db_perms *perms_get(const struct xs_permissions *p,
+				  unsigned int num)
+{
+	struct node_perms key = { .num = num, .p = (struct xs_permissions *)p };
+	struct db_perms *set;
+
+	set = hashtable_search(perms_sets, &key);
+	if (set) {
+		set->refs++;
+		return set;
+	}
+
+	set = talloc_size(NULL, sizeof(*set) + num * sizeof(*p));
+	if (!set)
+		return NULL;
+	set->perms.num = num;
+	set->perms.p = set->p;
+	set->refs = 1;
+	memcpy(set->p, p, num * sizeof(*p));
+
+	if (hashtable_add(perms_sets, &set->perms, set)) {
+		talloc_free(set);
+		return NULL;
+	}
+	perms_sets_n++;
+
+	return set;
+}
+
+static void perms_put(struct db_perms *set)
+{
+	if (--set->refs)
+		return;
+
+	perms_sets_n--;
+	hashtable_remove(perms_sets, &set->perms);
+}
+
+static const char *node_data(const struct db_node *node)
+{
+	return (const char *)(node->comps + node->num_comps +
+			      node->num_children);
+}
+
+unsigned int db_node_hash_fn(const void *k)
+{
+	const struct db_node *node = k;
+	const struct db_comp *comp;
+	unsigned int hash = 5381;
+	unsigned int i;
+	const char *str;
+	char c;
+
+	if (*(const char *)k)
+		return hash_from_key_fn(k);
+
+	/* Same as hash_from_key_fn() of the name. */
+	for (i = 0; i < node->num_comps; i++) {
+		if (i)
+			hash = ((hash << 5) + hash) + (unsigned int)'/';
+		comp = comp_table[node->comps[i]];
+		for (str = comp->name; (c = *str); str++)
+			hash = ((hash << 5) + hash) + (unsigned int)c;
+	}
+
+	return hash;
+}
+
+int db_node_equal_fn(const void *key1, const void *key2)
+{
+	/* key2 is always a node in the hashtable. */
+	const struct db_node *node = key2, *other = key1;
+	const struct db_comp *comp;
+	const char *name = key1;
+	unsigned int i;
+
+	if (!*name)
+		return other->num_comps == node->num_comps &&
+		       !memcmp(other->comps, node->comps,
+			       node->num_comps * sizeof(*node->comps));
+
+	for (i = 0; i < node->num_comps; i++) {
+		if (i && *name++ != '/')
+			return 0;
+		comp = comp_table[node->comps[i]];
+		if (strncmp(name, comp->name, comp->len))
+			return 0;
+		name += comp->len;
+	}
+
+	return !*name;
+}
+
+static size_t node_mem(const struct db_node *node)
+{
+	return sizeof(*node) +
+	       (node->num_comps + node->num_children) * sizeof(*node->comps) +
+	       node->datalen;
+}
+
+static void node_put_refs(struct db_node *node)
+{
+	unsigned int i;
+
+	for (i = 0; i < node->num_comps + node->num_children; i++)
+		comp_put(node->comps[i]);
+	if (node->perms)
+		perms_put(node->perms);
+}
+
+void db_node_free(struct db_node *node)
+{
+	db_nodes_n--;
+	db_nodes_mem -= node_mem(node);
+
+	node_put_refs(node);
+	free(node);
+}
+
+struct db_node *db_node_encode(const char *db_name,
+			       const struct node_hdr *hdr,
+			       const struct db_node *old)
+{
+	const struct xs_permissions *perms = (const void *)(hdr + 1);
+	const char *data = (const char *)(perms + hdr->num_perms);
+	const char *children = data + hdr->datalen;
+	unsigned int num_comps = 1, num_children, off, pos = 0;
+	uint32_t *id;
+	struct db_node *node;
+	char *name, *comp, *slash;
+	size_t size;
+	int ret;
+
+	/* The children must be a list of strings. */
+	if (!hdr->num_perms ||
+	    (hdr->childlen && children[hdr->childlen - 1])) {
+		errno = EINVAL;
+		return NULL;
+	}
+
+	for (slash = strchr(db_name, '/'); slash; slash = strchr(slash + 1, '/'))
+		num_comps++;
+	num_children = xenstore_count_strings(children, hdr->childlen);
+
+	size = sizeof(*node) + (num_comps + num_children) * sizeof(*node->comps) +
+	       hdr->datalen;
+	node = malloc(size);
+	name = strdup(db_name);
+	if (!node || !name) {
+		free(node);
+		free(name);
+		errno = ENOMEM;
+		return NULL;
+	}
+
+	node->key_tag = 0;
+	node->num_comps = 0;
+	node->datalen = hdr->datalen;
+	node->childlen = hdr->childlen;
+	node->num_children = 0;
+	node->generation = hdr->generation;
+	node->perms = NULL;
+
+	/* Keep the counts valid for node_put_refs() in case of errors. */
+	if (old) {
+		for (; node->num_comps < num_comps; node->num_comps++) {
+			node->comps[node->num_comps] =
+				old->comps[node->num_comps];
+			comp_table[old->comps[node->num_comps]]->refs++;
+		}
+	}
+	for (comp = name; node->num_comps < num_comps; comp = slash) {
+		slash = strchr(comp, '/');
+		if (slash)
+			*slash++ = 0;
+		ret = comp_get(comp, node->comps + node->num_comps);
+		if (ret)
+			goto error;
+		node->num_comps++;
+	}
+
+	for (off = 0; off < hdr->childlen; off += strlen(children + off) + 1) {
+		id = node->comps + num_comps + node->num_children;
+		if (!old || !comp_reuse(old, &pos, children + off, id)) {
+			ret = comp_get(children + off, id);
+			if (ret)
+				goto error;
+		}
+		node->num_children++;
+	}
+
+	node->perms = perms_get(perms, hdr->num_perms);
+	if (!node->perms) {
+		ret = ENOMEM;
+		goto error;
+	}
+
+	memcpy((char *)node_data(node), data, hdr->datalen);
+	free(name);
+
+	db_nodes_n++;
+	db_nodes_mem += size;
+
+	return node;
+
+ error:
+	free(name);
+	node_put_refs(node);
+	free(node);
+	errno = ret;
+	return NULL;
+}
+
+size_t db_node_size(const struct db_node *node)
+{
+	return sizeof(struct node_hdr) +
+	       node->perms->perms.num * sizeof(struct xs_permissions) +
+	       node->datalen + node->childlen;
+}
+
+static void copy_children(char *p, const struct db_node *node)
+{
+	const struct db_comp *comp;
+	unsigned int i;
+
+	for (i = 0; i < node->num_children; i++) {
+		comp = comp_table[node->comps[node->num_comps + i]];
+		memcpy(p, comp->name, comp->len + 1);
+		p += comp->len + 1;
+	}
+}
+
+struct node_hdr *db_node_decode(const void *ctx, const struct db_node *node,
+				size_t *size)
+{
+	struct node_hdr *hdr;
+	struct xs_permissions *perms;
+	char *data;
+
+	*size = db_node_size(node);
+	hdr = talloc_size(ctx, *size);
+	if (!hdr) {
+		errno = ENOMEM;
+		return NULL;
+	}
+
+	hdr->generation = node->generation;
+	hdr->num_perms = node->perms->perms.num;
+	hdr->datalen = node->datalen;
+	hdr->childlen = node->childlen;
+
+	perms = (struct xs_permissions *)(hdr + 1);
+	memcpy(perms, node->perms->p, hdr->num_perms * sizeof(*perms));
+	data = (char *)(perms + hdr->num_perms);
+	memcpy(data, node_data(node), node->datalen);
+	copy_children(data + node->datalen, node);
+
+	return hdr;
+}
+
+char *db_node_name(const void *ctx, const struct db_node *node)
+{
+	const struct db_comp *comp;
+	unsigned int i;
+	size_t len = 0;
+	char *name, *p;
+
+	for (i = 0; i < node->num_comps; i++)
+		len += comp_table[node->comps[i]]->len + 1;
+
+	name = talloc_size(ctx, len);
+	if (!name)
+		return NULL;
+
+	for (i = 0, p = name; i < node->num_comps; i++) {
+		if (i)
+			*p++ = '/';
+		comp = comp_table[node->comps[i]];
+		memcpy(p, comp->name, comp->len);
+		p += comp->len;
+	}
+	*p = 0;
+
+	return name;
+}
+
+int db_node_payload(const struct db_node *node, bool children, char **data,
+		    unsigned int *len)
+{
+	*len = children ? node->childlen : node->datalen;
+	*data = malloc(*len ? : 1);
+	if (!*data)
+		return ENOMEM;
+
+	if (children)
+		copy_children(*data, node);
+	else
+		memcpy(*data, node_data(node), *len);
+
+	return 0;
+}
+
+int db_node_set_perms(struct db_node *node, const struct xs_permissions *p,
+		      unsigned int num)
+{
+	struct db_perms *set;
+
+	set = perms_get(p, num);
+	if (!set)
+		return ENOMEM;
+
+	perms_put(node->perms);
+	node->perms = set;
+
+	return 0;
+}
+
+void db_nodes_report(FILE *fp)
+{
+	fprintf(fp, "nodes: %u using %zu bytes, %u path components, "
+		"%u permission sets\n", db_nodes_n, db_nodes_mem,
+		comp_table_used - comp_free_n, perms_sets_n);
+}
@@ -0,0 +1,97 @@
+/* SPDX-License-Identifier: MIT */
+
+/*
+ * Compact encoding of the nodes in the data base of Xen Store Daemon.
+ *
+ * The nodes of a large host share a lot: the same names appear in the paths
+ * and the children lists of thousands of nodes ("device", "backend", "state",
+ * domids), and most nodes of a domain have the same permissions.  So each
+ * path component is stored once, and a node refers to the components of its
+ * name and to its children by their ids.  Identical permission sets are
+ * shared between nodes, too.
+ *
+ * A node is a single malloc()-ed memory chunk.  The other parts of the
+ * daemon see nodes in the flat format of struct node_hdr only, so the
+ * encoding is private to the data base access functions in core.c.
+ */
+
+#ifndef _XENSTORED_NODEDB_H
+#define _XENSTORED_NODEDB_H
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include "core.h"
+
+/* Permission set, shared by all nodes having identical permissions. */
+struct db_perms {
+	/* Hashtable key, perms.p pointing to p[] below. */
+	struct node_perms perms;
+	unsigned int refs;
+	struct xs_permissions p[];
+};
+
+struct db_node {
+	/*
+	 * Always 0.  The data base hashtable is searched with names, but
+	 * nodes are added with themselves as key, so the first byte tells
+	 * both apart (a name is never empty).
+	 */
+	char key_tag;
+	uint16_t num_comps;
+	uint16_t datalen;
+	uint32_t childlen;	/* Length of the children in node_hdr format. */
+	uint32_t num_children;
+	uint64_t generation;
+	struct db_perms *perms;
+	/*
+	 * Ids of the components of the name (the parts between the "/"), then
+	 * ids of the children, followed by the data.
+	 */
+	uint32_t comps[];
+};
+
+void db_nodes_init(void);
+
+/* Hash functions of the data base hashtable. */
+unsigned int db_node_hash_fn(const void *k);
+int db_node_equal_fn(const void *key1, const void *key2);
+
+/*
+ * Encode a node in node_hdr format. Returns NULL with errno set on failure.
+ * The component ids are taken from old where possible, which must be the
+ * node of the same name being replaced, if not NULL.
+ */
+struct db_node *db_node_encode(const char *db_name,
+			       const struct node_hdr *hdr,
+			       const struct db_node *old);
+void db_node_free(struct db_node *node);
+
+/* Return the node in node_hdr format, allocated with ctx. */
+struct node_hdr *db_node_decode(const void *ctx, const struct db_node *node,
+				size_t *size);
+char *db_node_name(const void *ctx, const struct db_node *node);
+
+/* Size of the node in node_hdr format, as used for memory accounting. */
+size_t db_node_size(const struct db_node *node);
+
+static inline unsigned int db_node_owner(const struct db_node *node)
+{
+	return node->perms->p[0].id;
+}
+
+/*
+ * Copy the data or (with children set) the children of a node into a
+ * malloc()-ed buffer.  Safe to be called by the reader threads.
+ */
+int db_node_payload(const struct db_node *node, bool children, char **data,
+		    unsigned int *len);
+
+/* Replace the permissions of a node. */
+int db_node_set_perms(struct db_node *node, const struct xs_permissions *p,
+		      unsigned int num);
+
+/* Statistics for "xenstore-control memreport". */
+void db_nodes_report(FILE *fp);
+
+#endif /* _XENSTORED_NODEDB_H */
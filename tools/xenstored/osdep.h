@@ -11,6 +11,8 @@
 #if defined(__linux__)
 #define XENSTORED_KVA_DEV  "/proc/xen/xsd_kva"
 #define XENSTORED_PORT_DEV "/proc/xen/xsd_port"
+/* Wait for fds with epoll instead of poll. */
+#define XENSTORED_USE_EPOLL
 #elif defined(__NetBSD__)
 #define XENSTORED_KVA_DEV  "/dev/xsd_kva"
 #define XENSTORED_PORT_DEV "/kern/xen/xsd_port"
@@ -0,0 +1,608 @@
+/* SPDX-License-Identifier: GPL-2.0-or-later */
+
+/*
+ * Persistent node store for Xen Store Daemon.
+ *
+ * The persist directory contains up to three files, all of them starting with
+ * a struct persist_file_hdr followed by records (struct persist_rec, the node
+ * name and the node as stored in the data base, padded to 8 bytes):
+ * - "snapshot": all nodes of the data base, terminated by an end record.
+ * - "log": node writes and deletions after the snapshot has been taken.  It
+ *   is terminated by the first record with type 0.  The type of a record is
+ *   written last, so a record being written when the daemon died is ignored.
+ * - "log.old": the log of the time before a snapshot being written.  It is
+ *   removed when the new snapshot is complete.
+ * A commit record is written after each request, so the log is replayed up to
+ * the last commit record only, never leaving a request half done.
+ * Each record contains the complete node, so replaying a log on top of a
+ * snapshot already containing some of its modifications is fine.  This allows
+ * to replay "log.old" and "log" after loading whatever snapshot has been
+ * found, without having to know at which point the snapshot was taken.
+ */
+
+#include <errno.h>
+#include <fcntl.h>
+#include <limits.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <syslog.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
+
+#include "utils.h"
+#include "talloc.h"
+#include "core.h"
+#include "persist.h"
+
+#define PERSIST_IDENT		"xsnodes"
+#define PERSIST_VERSION		1
+#define PERSIST_KIND_SNAPSHOT	1
+#define PERSIST_KIND_LOG	2
+
+#define PERSIST_REC_END		0
+#define PERSIST_REC_WRITE	1
+#define PERSIST_REC_DELETE	2
+#define PERSIST_REC_COMMIT	3
+
+/* Grow the log in steps of this size. */
+#define PERSIST_LOG_CHUNK	(1024 * 1024)
+/* Don't write a snapshot before the log has reached this size. */
+#define PERSIST_LOG_MIN		(4 * PERSIST_LOG_CHUNK)
+
+struct persist_file_hdr {
+	char ident[8];
+	uint32_t version;
+	uint32_t kind;
+};
+
+struct persist_rec {
+	uint32_t type;
+	uint32_t name_len;	/* Including the terminating NUL. */
+	uint32_t size;		/* Size of the node data. */
+	uint32_t pad;
+	char name[];
+};
+
+const char *persist_dir;
+bool persist_logging;
+
+static struct {
+	int fd;
+	char *map;
+	size_t map_size;
+	size_t used;
+	/* Records have been written since the last commit record. */
+	bool dirty;
+} plog = { .fd = -1 };
+
+/* The data base has been loaded from the persist directory. */
+static bool restored;
+
+static char *snapshot_path, *log_path, *log_old_path;
+
+/* Child writing a snapshot. */
+static pid_t snapshot_pid;
+static size_t snapshot_size;
+
+static struct {
+	unsigned long snapshots;
+	unsigned long failed;
+	unsigned long records;
+} persist_stats;
+
+static size_t persist_rec_len(uint32_t name_len, uint32_t size)
+{
+	return ROUNDUP(sizeof(struct persist_rec) + name_len + size, 3);
+}
+
+/*
+ * Walk the records of a mapped file, applying them to the data base up to
+ * offset "apply".  Returns the offset of the end record, and via "committed"
+ * the offset following the last commit record.  The log is written through a
+ * shared mapping, so a crash may leave a torn record behind: it is treated as
+ * the end of the log, dropping it with the rest of the uncommitted tail.
+ */
+static size_t persist_scan(const char *path, const char *buf, size_t size,
+			   uint32_t kind, size_t apply, size_t *committed)
+{
+	const struct persist_file_hdr *fhdr = (const void *)buf;
+	const struct persist_rec *rec;
+	size_t off, len;
+
+	if (size < sizeof(*fhdr) ||
+	    memcmp(fhdr->ident, PERSIST_IDENT, sizeof(fhdr->ident)) ||
+	    fhdr->version != PERSIST_VERSION || fhdr->kind != kind)
+		barf("persist: %s has unknown format", path);
+
+	*committed = sizeof(*fhdr);
+	for (off = sizeof(*fhdr); off + sizeof(*rec) <= size; off += len) {
+		rec = (const void *)(buf + off);
+		if (rec->type == PERSIST_REC_END)
+			return off;
+
+		len = persist_rec_len(rec->name_len, rec->size);
+		if (off + len > size || !rec->name_len ||
+		    rec->name[rec->name_len - 1]) {
+			if (kind != PERSIST_KIND_LOG || off < apply)
+				barf("persist: %s corrupted at offset %zu",
+				     path, off);
+			syslog(LOG_WARNING,
+			       "persist: %s ends with torn record at offset %zu\n",
+			       path, off);
+			return off;
+		}
+		if (rec->type == PERSIST_REC_COMMIT)
+			*committed = off + len;
+		if (off >= apply)
+			continue;
+
+		switch (rec->type) {
+		case PERSIST_REC_COMMIT:
+			break;
+		case PERSIST_REC_WRITE:
+			db_restore_node(rec->name, rec->name + rec->name_len,
+					rec->size);
+			break;
+		case PERSIST_REC_DELETE:
+			db_restore_delete(rec->name);
+			break;
+		default:
+			barf("persist: %s has unknown record type %u", path,
+			     rec->type);
+		}
+	}
+
+	/* Only the log may end without end record. */
+	if (kind != PERSIST_KIND_LOG)
+		barf("persist: %s is truncated", path);
+
+	return off;
+}
+
+static bool persist_replay(const char *path, uint32_t kind)
+{
+	struct stat statbuf;
+	size_t end, committed;
+	void *buf;
+	int fd;
+
+	fd = open(path, O_RDONLY | O_CLOEXEC);
+	if (fd < 0) {
+		if (errno == ENOENT)
+			return false;
+		barf_perror("persist: can't open %s", path);
+	}
+	if (fstat(fd, &statbuf))
+		barf_perror("persist: can't stat %s", path);
+
+	buf = mmap(NULL, statbuf.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+	if (buf == MAP_FAILED)
+		barf_perror("persist: can't map %s", path);
+	close(fd);
+
+	if (kind == PERSIST_KIND_SNAPSHOT) {
+		persist_scan(path, buf, statbuf.st_size, kind, SIZE_MAX,
+			     &committed);
+		snapshot_size = statbuf.st_size;
+	} else {
+		/* Drop the tail of a request interrupted by a crash. */
+		end = persist_scan(path, buf, statbuf.st_size, kind, 0,
+				   &committed);
+		persist_scan(path, buf, end, kind, committed, &committed);
+	}
+
+	munmap(buf, statbuf.st_size);
+
+	return true;
+}
+
+static void persist_set_paths(void)
+{
+	if (snapshot_path)
+		return;
+
+	snapshot_path = talloc_asprintf(NULL, "%s/snapshot", persist_dir);
+	log_path = talloc_asprintf(NULL, "%s/log", persist_dir);
+	log_old_path = talloc_asprintf(NULL, "%s/log.old", persist_dir);
+	if (!snapshot_path || !log_path || !log_old_path)
+		barf("persist: allocation failure");
+}
+
+bool persist_restore(void)
+{
+	bool found;
+
+	if (!persist_dir)
+		return false;
+
+	persist_set_paths();
+
+	found = persist_replay(snapshot_path, PERSIST_KIND_SNAPSHOT);
+	found |= persist_replay(log_old_path, PERSIST_KIND_LOG);
+	found |= persist_replay(log_path, PERSIST_KIND_LOG);
+	if (!found)
+		return false;
+
+	db_restore_finish();
+	syslog(LOG_INFO, "persist: nodes restored from %s\n", persist_dir);
+	restored = true;
+
+	return true;
+}
+
+bool persist_restored(void)
+{
+	return restored;
+}
+
+static int persist_snapshot_node(const char *name, const struct node_hdr *hdr,
+				 size_t size, void *arg)
+{
+	static const char pad[8];
+	FILE *fp = arg;
+	struct persist_rec rec = {
+		.type = PERSIST_REC_WRITE,
+		.name_len = strlen(name) + 1,
+		.size = size,
+	};
+	size_t len = persist_rec_len(rec.name_len, size);
+
+	if (fwrite(&rec, sizeof(rec), 1, fp) != 1 ||
+	    fwrite(name, rec.name_len, 1, fp) != 1 ||
+	    fwrite(hdr, size, 1, fp) != 1)
+		return -1;
+
+	len -= sizeof(rec) + rec.name_len + size;
+	if (len && fwrite(pad, len, 1, fp) != 1)
+		return -1;
+
+	return 0;
+}
+
+/* Write a snapshot of the data base.  Might run in a child process. */
+static int persist_write_snapshot(void)
+{
+	char tmp_path[PATH_MAX];
+	struct persist_file_hdr fhdr = {
+		.ident = PERSIST_IDENT,
+		.version = PERSIST_VERSION,
+		.kind = PERSIST_KIND_SNAPSHOT,
+	};
+	struct persist_rec end = { .type = PERSIST_REC_END };
+	FILE *fp;
+	int fd, ret;
+
+	snprintf(tmp_path, sizeof(tmp_path), "%s.%ld", snapshot_path,
+		 (long)getpid());
+	fd = open(tmp_path, O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0600);
+	if (fd < 0)
+		return -1;
+	fp = fdopen(fd, "w");
+	if (!fp) {
+		close(fd);
+		unlink(tmp_path);
+		return -1;
+	}
+
+	ret = (fwrite(&fhdr, sizeof(fhdr), 1, fp) != 1 ||
+	       db_for_each_node(persist_snapshot_node, fp) ||
+	       fwrite(&end, sizeof(end), 1, fp) != 1 ||
+	       fflush(fp) || fsync(fileno(fp))) ? -1 : 0;
+	if (fclose(fp))
+		ret = -1;
+
+	if (!ret)
+		ret = rename(tmp_path, snapshot_path);
+	if (ret)
+		unlink(tmp_path);
+
+	return ret;
+}
+
+static void persist_unmap_log(void)
+{
+	if (plog.map)
+		munmap(plog.map, plog.map_size);
+	plog.map = NULL;
+	plog.map_size = 0;
+	if (plog.fd >= 0)
+		close(plog.fd);
+	plog.fd = -1;
+}
+
+static int persist_map_log(size_t size)
+{
+	void *map;
+	int err;
+
+	/* Allocate the space, writing to a hole of a full disk would crash. */
+	err = posix_fallocate(plog.fd, 0, size);
+	if (err) {
+		errno = err;
+		return -1;
+	}
+
+	map = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, plog.fd, 0);
+	if (map == MAP_FAILED)
+		return -1;
+
+	if (plog.map)
+		munmap(plog.map, plog.map_size);
+	plog.map = map;
+	plog.map_size = size;
+
+	return 0;
+}
+
+static int persist_open_log(void)
+{
+	struct persist_file_hdr *fhdr;
+	struct persist_rec *tail;
+	struct stat statbuf;
+	size_t end;
+
+	plog.fd = open(log_path, O_RDWR | O_CREAT | O_CLOEXEC, 0600);
+	if (plog.fd < 0 || fstat(plog.fd, &statbuf) ||
+	    persist_map_log(max_t(size_t, statbuf.st_size, PERSIST_LOG_CHUNK)))
+		return -1;
+
+	if (statbuf.st_size) {
+		end = persist_scan(log_path, plog.map, plog.map_size,
+				   PERSIST_KIND_LOG, 0, &plog.used);
+		/* Don't let the remains of a torn record follow new ones. */
+		tail = (void *)(plog.map + end);
+		if (end + sizeof(*tail) <= plog.map_size && tail->type)
+			memset(tail, 0, plog.map_size - end);
+		if (restored) {
+			/* Overwrite the records not replayed. */
+			memset(plog.map + plog.used, 0, end - plog.used);
+		} else {
+			/*
+			 * Continue the log of our predecessor after live
+			 * update, all its modifications are in our data base.
+			 */
+			plog.used = end;
+			plog.dirty = true;
+		}
+		return 0;
+	}
+
+	fhdr = (void *)plog.map;
+	memcpy(fhdr->ident, PERSIST_IDENT, sizeof(fhdr->ident));
+	fhdr->version = PERSIST_VERSION;
+	fhdr->kind = PERSIST_KIND_LOG;
+	plog.used = sizeof(*fhdr);
+
+	return 0;
+}
+
+/*
+ * The persisted data can't be kept up to date any longer.  Remove it, as
+ * restoring an outdated data base after a restart would be worse than
+ * starting with an empty one.
+ */
+static void persist_fail(const char *what)
+{
+	syslog(LOG_ERR, "persist: %s failed (%m), persistence disabled\n",
+	       what);
+
+	persist_logging = false;
+	persist_unmap_log();
+	unlink(snapshot_path);
+	unlink(log_old_path);
+	unlink(log_path);
+}
+
+void persist_init(void)
+{
+	struct stat statbuf;
+
+	if (!persist_dir)
+		return;
+
+	persist_set_paths();
+	if (mkdir(persist_dir, 0700) && errno != EEXIST)
+		barf_perror("persist: can't create %s", persist_dir);
+
+	/* Without a snapshot there is nothing the logs could be applied to. */
+	if (stat(snapshot_path, &statbuf)) {
+		unlink(log_old_path);
+		unlink(log_path);
+		if (persist_write_snapshot() || stat(snapshot_path, &statbuf))
+			barf_perror("persist: can't write %s", snapshot_path);
+	}
+	snapshot_size = statbuf.st_size;
+
+	if (persist_open_log())
+		barf_perror("persist: can't open %s", log_path);
+	persist_logging = true;
+}
+
+static void persist_append(uint32_t type, const char *name, const void *data,
+			   size_t size)
+{
+	struct persist_rec *rec;
+	uint32_t name_len;
+	size_t len;
+
+	name_len = strlen(name) + 1;
+	len = persist_rec_len(name_len, size);
+	/* Leave room for the end record. */
+	if (plog.used + len + sizeof(*rec) > plog.map_size &&
+	    persist_map_log(ROUNDUP(plog.used + len + sizeof(*rec) +
+				    PERSIST_LOG_CHUNK, 20))) {
+		persist_fail("growing log");
+		return;
+	}
+
+	rec = (void *)(plog.map + plog.used);
+	rec->name_len = name_len;
+	rec->size = size;
+	memcpy(rec->name, name, name_len);
+	memcpy(rec->name + name_len, data, size);
+
+	/* Make the record valid only after it is complete. */
+	__atomic_store_n(&rec->type, type, __ATOMIC_RELEASE);
+	plog.used += len;
+	persist_stats.records++;
+}
+
+/* Transaction specific nodes are not persisted. */
+static bool persist_node(const char *db_name)
+{
+	return db_name[0] == '/' || db_name[0] == '@';
+}
+
+void persist_write(const char *db_name, const void *data, size_t size)
+{
+	if (!persist_node(db_name))
+		return;
+
+	persist_append(PERSIST_REC_WRITE, db_name, data, size);
+	plog.dirty = true;
+}
+
+void persist_delete(const char *db_name)
+{
+	if (!persist_node(db_name))
+		return;
+
+	persist_append(PERSIST_REC_DELETE, db_name, NULL, 0);
+	plog.dirty = true;
+}
+
+void persist_commit(void)
+{
+	if (!persist_logging || !plog.dirty)
+		return;
+
+	persist_append(PERSIST_REC_COMMIT, "", NULL, 0);
+	plog.dirty = false;
+}
+
+static void persist_start_snapshot(void)
+{
+	struct stat statbuf;
+	pid_t pid;
+
+	/*
+	 * Switch to a new log, unless the last snapshot failed.  In that case
+	 * log.old is still needed, and the current log is kept, too.
+	 */
+	if (stat(log_old_path, &statbuf)) {
+		persist_unmap_log();
+		if (rename(log_path, log_old_path) || persist_open_log()) {
+			persist_fail("switching log");
+			return;
+		}
+	}
+
+	pid = fork();
+	if (pid < 0) {
+		syslog(LOG_ERR, "persist: can't fork for snapshot: %m\n");
+		persist_stats.failed++;
+		return;
+	}
+
+	if (!pid)
+		_exit(persist_write_snapshot() ? 1 : 0);
+
+	snapshot_pid = pid;
+}
+
+static void persist_check_snapshot(void)
+{
+	struct stat statbuf;
+	int status;
+	pid_t pid;
+
+	pid = waitpid(snapshot_pid, &status, WNOHANG);
+	if (!pid)
+		return;
+
+	snapshot_pid = 0;
+	if (pid < 0 || !WIFEXITED(status) || WEXITSTATUS(status)) {
+		syslog(LOG_ERR, "persist: writing snapshot failed\n");
+		persist_stats.failed++;
+		return;
+	}
+
+	persist_stats.snapshots++;
+	unlink(log_old_path);
+	if (!stat(snapshot_path, &statbuf))
+		snapshot_size = statbuf.st_size;
+}
+
+void persist_set_fds(int *ptimeout)
+{
+	/* Modifications not done by a request, e.g. domain cleanup. */
+	persist_commit();
+
+	if (snapshot_pid) {
+		persist_check_snapshot();
+		/* Look again in a while. */
+		if (snapshot_pid && (*ptimeout < 0 || *ptimeout > 1000))
+			*ptimeout = 1000;
+	}
+
+	if (persist_logging && !snapshot_pid &&
+	    plog.used > max_t(size_t, snapshot_size, PERSIST_LOG_MIN))
+		persist_start_snapshot();
+}
+
+int do_control_persist(const void *ctx, struct connection *conn,
+		       const char **vec, int num)
+{
+	char *resp;
+
+	if (!persist_logging)
+		return ENOENT;
+
+	if (num > 1)
+		return EINVAL;
+
+	if (num == 1) {
+		if (strcmp(vec[0], "snapshot"))
+			return EINVAL;
+		if (snapshot_pid)
+			return EBUSY;
+		persist_start_snapshot();
+		send_ack(conn, XS_CONTROL);
+		return 0;
+	}
+
+	resp = talloc_asprintf(ctx,
+		"Persist directory %s:\n"
+		"%-17s: %8zu bytes\n"
+		"%-17s: %8zu bytes\n"
+		"%-17s: %8lu\n"
+		"%-17s: %8lu\n"
+		"%-17s: %8lu\n"
+		"%-17s: %8s\n",
+		persist_dir,
+		"log", plog.used,
+		"snapshot", snapshot_size,
+		"records", persist_stats.records,
+		"snapshots", persist_stats.snapshots,
+		"snapshots-failed", persist_stats.failed,
+		"snapshot-running", snapshot_pid ? "yes" : "no");
+	if (!resp)
+		return ENOMEM;
+
+	send_reply(conn, XS_CONTROL, resp, strlen(resp) + 1);
+
+	return 0;
+}
+
+/*
+ * Local variables:
+ *  mode: C
+ *  c-file-style: "linux"
+ *  indent-tabs-mode: t
+ *  c-basic-offset: 8
+ *  tab-width: 8
+ * End:
+ */
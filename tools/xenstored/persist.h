@@ -0,0 +1,93 @@
+/* SPDX-License-Identifier: MIT */
+
+/*
+ * Persistent node store for Xen Store Daemon.
+ *
+ * Optionally all nodes are kept in a directory on disk, so a restarted daemon
+ * can pick up the data base where its predecessor left off, instead of the
+ * toolstack having to repopulate it.  The directory holds a snapshot of all
+ * nodes and a log of the node modifications done since the snapshot has been
+ * taken.  The log is written via a shared mapping, so appending to it costs a
+ * memcpy() only, and everything written survives a crash of the daemon.
+ * When the log has grown larger than the snapshot, a new snapshot is written
+ * by a child process, which sees a frozen copy of the data base.
+ */
+
+#ifndef _XENSTORED_PERSIST_H
+#define _XENSTORED_PERSIST_H
+
+#ifndef NO_PERSIST
+extern const char *persist_dir;
+extern bool persist_logging;
+
+static inline bool persist_enabled(void)
+{
+	return persist_logging;
+}
+
+/*
+ * Load the nodes from the persist directory into the still empty data base.
+ * Returns false if there was nothing to load.
+ */
+bool persist_restore(void);
+
+/*
+ * Has the data base been loaded by persist_restore()?  It is consistent then,
+ * as the persisted data is always the state between two requests.
+ */
+bool persist_restored(void);
+
+/* Start logging modifications, writing an initial snapshot if needed. */
+void persist_init(void);
+
+/* Log writing or deleting a node of the global data base. */
+void persist_write(const char *db_name, const void *data, size_t size);
+void persist_delete(const char *db_name);
+
+/* Make the modifications logged so far visible to persist_restore(). */
+void persist_commit(void);
+
+/* Start writing a new snapshot if needed and check for it finishing. */
+void persist_set_fds(int *ptimeout);
+
+int do_control_persist(const void *ctx, struct connection *conn,
+		       const char **vec, int num);
+#else
+static inline bool persist_enabled(void)
+{
+	return false;
+}
+
+static inline bool persist_restore(void)
+{
+	return false;
+}
+
+static inline bool persist_restored(void)
+{
+	return false;
+}
+
+static inline void persist_init(void)
+{
+}
+
+static inline void persist_write(const char *db_name, const void *data,
+				 size_t size)
+{
+}
+
+static inline void persist_delete(const char *db_name)
+{
+}
+
+static inline void persist_commit(void)
+{
+}
+
+static inline void persist_set_fds(int *ptimeout)
+{
+}
+#endif
+
+#endif /* _XENSTORED_PERSIST_H */
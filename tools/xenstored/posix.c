@@ -36,10 +36,10 @@
 #include "osdep.h"
 #include "talloc.h"
 
-static int reopen_log_pipe0_pollfd_idx = -1;
+static struct fd_event reopen_log_fd_event = FD_EVENT_INIT;
 static int reopen_log_pipe[2];
 
-static int sock_pollfd_idx = -1;
+static struct fd_event sock_fd_event = FD_EVENT_INIT;
 static int sock = -1;
 
 static void write_pidfile(const char *pidfile)
@@ -226,15 +226,12 @@ static int readfd(struct connection *conn, void *data, unsigned int len)
 
 static bool socket_can_process(struct connection *conn, int mask)
 {
-	if (conn->pollfd_idx == -1)
-		return false;
-
-	if (poll_fds[conn->pollfd_idx].revents & ~(POLLIN | POLLOUT)) {
+	if (conn->fd_event.revents & ~(POLLIN | POLLOUT)) {
 		talloc_free(conn);
 		return false;
 	}
 
-	return (poll_fds[conn->pollfd_idx].revents & mask);
+	return (conn->fd_event.revents & mask);
 }
 
 static bool socket_can_write(struct connection *conn)
@@ -352,39 +349,35 @@ void early_init(bool live_update, bool dofork, const char *pidfile)
 
 void set_special_fds(void)
 {
-	if (reopen_log_pipe[0] != -1)
-		reopen_log_pipe0_pollfd_idx =
-			set_fd(reopen_log_pipe[0], POLLIN|POLLPRI);
+	if (reopen_log_pipe[0] != -1 && reopen_log_fd_event.fd == -1)
+		fd_event_add(&reopen_log_fd_event, reopen_log_pipe[0],
+			     POLLIN|POLLPRI);
 
-	if (sock != -1)
-		sock_pollfd_idx = set_fd(sock, POLLIN|POLLPRI);
+	if (sock != -1 && sock_fd_event.fd == -1)
+		fd_event_add(&sock_fd_event, sock, POLLIN|POLLPRI);
 }
 
 void handle_special_fds(void)
 {
-	if (reopen_log_pipe0_pollfd_idx != -1) {
-		if (poll_fds[reopen_log_pipe0_pollfd_idx].revents & ~POLLIN) {
-			close(reopen_log_pipe[0]);
-			close(reopen_log_pipe[1]);
-			init_pipe();
-		} else if (poll_fds[reopen_log_pipe0_pollfd_idx].revents &
-			   POLLIN) {
-			char c;
-
-			if (read(reopen_log_pipe[0], &c, 1) != 1)
-				barf_perror("read failed");
-			reopen_log();
-		}
-		reopen_log_pipe0_pollfd_idx = -1;
+	if (reopen_log_fd_event.revents & ~POLLIN) {
+		fd_event_del(&reopen_log_fd_event);
+		close(reopen_log_pipe[0]);
+		close(reopen_log_pipe[1]);
+		init_pipe();
+	} else if (reopen_log_fd_event.revents & POLLIN) {
+		char c;
+
+		if (read(reopen_log_pipe[0], &c, 1) != 1)
+			barf_perror("read failed");
+		reopen_log();
 	}
+	reopen_log_fd_event.revents = 0;
 
-	if (sock_pollfd_idx != -1) {
-		if (poll_fds[sock_pollfd_idx].revents & ~POLLIN) {
-			barf_perror("sock poll failed");
-		} else if (poll_fds[sock_pollfd_idx].revents & POLLIN) {
-			accept_connection(sock);
-			sock_pollfd_idx = -1;
-		}
+	if (sock_fd_event.revents & ~POLLIN) {
+		barf_perror("sock poll failed");
+	} else if (sock_fd_event.revents & POLLIN) {
+		accept_connection(sock);
+		sock_fd_event.revents = 0;
 	}
 }
 
@@ -0,0 +1,317 @@
+/* SPDX-License-Identifier: GPL-2.0-or-later */
+
+/*
+ * Reader threads for Xen Store Daemon.
+ */
+
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <pthread.h>
+#include <signal.h>
+#include <stdlib.h>
+#include <string.h>
+#include <syslog.h>
+#include <unistd.h>
+#include <sys/uio.h>
+
+#include "utils.h"
+#include "core.h"
+#include "reader.h"
+
+unsigned int reader_threads;
+
+struct reader_job {
+	struct list_head list;
+	/* Main thread only: NULL if the connection has gone away. */
+	struct connection *conn;
+	int fd;
+
+	/* Header of the reply, starting as a copy of the request's one. */
+	struct xsd_sockmsg hdr;
+	char *data;
+	unsigned int written;
+	bool failed;
+
+	char name[];
+};
+
+static pthread_rwlock_t store_lock;
+
+/* Protects the job lists. */
+static pthread_mutex_t reader_mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t reader_cond = PTHREAD_COND_INITIALIZER;
+static LIST_HEAD(reader_queued);
+static LIST_HEAD(reader_done);
+
+/*
+ * Completed jobs are picked up by the main thread in each iteration of its
+ * loop, usually woken up by the next request of the same connection.  Only
+ * if the main thread can't wait for that it sets main_waiting before going
+ * to sleep, and the next reader thread completing a job writes to the pipe.
+ */
+static bool main_waiting;
+static int done_pipe[2] = { -1, -1 };
+static struct fd_event done_fd_event = FD_EVENT_INIT;
+
+/* Main thread only: jobs not yet seen completing, and the reason to wait. */
+static unsigned int reader_pending;
+static unsigned int reader_orphans;
+static bool reader_wake_needed;
+
+static void reader_set_error(struct reader_job *job, int err)
+{
+	unsigned int i;
+
+	for (i = 0; err != xsd_errors[i].errnum; i++) {
+		if (i == ARRAY_SIZE(xsd_errors) - 1) {
+			i = 0; /* EINVAL */
+			break;
+		}
+	}
+
+	free(job->data);
+	job->hdr.type = XS_ERROR;
+	job->hdr.len = strlen(xsd_errors[i].errstring) + 1;
+	job->data = strdup(xsd_errors[i].errstring);
+	if (!job->data)
+		job->failed = true;
+}
+
+static void reader_process(struct reader_job *job)
+{
+	struct iovec iov[2];
+	unsigned int len;
+	ssize_t ret;
+	int err;
+
+	pthread_rwlock_rdlock(&store_lock);
+	err = db_read_reply(job->name, job->hdr.type, &job->data, &len);
+	pthread_rwlock_unlock(&store_lock);
+
+	if (!err && len > XENSTORE_PAYLOAD_MAX)
+		err = E2BIG;
+	if (err) {
+		reader_set_error(job, err);
+		if (job->failed)
+			return;
+	} else
+		job->hdr.len = len;
+
+	iov[0].iov_base = &job->hdr;
+	iov[0].iov_len = sizeof(job->hdr);
+	iov[1].iov_base = job->data;
+	iov[1].iov_len = job->hdr.len;
+
+	while ((ret = writev(job->fd, iov, 2)) < 0) {
+		if (errno == EAGAIN) {
+			/* The main thread will send it. */
+			ret = 0;
+			break;
+		}
+		if (errno != EINTR) {
+			job->failed = true;
+			return;
+		}
+	}
+
+	job->written = ret;
+}
+
+static void *reader_thread(void *arg)
+{
+	struct reader_job *job;
+	bool wake;
+
+	for (;;) {
+		pthread_mutex_lock(&reader_mutex);
+		while (list_empty(&reader_queued))
+			pthread_cond_wait(&reader_cond, &reader_mutex);
+		job = list_top(&reader_queued, struct reader_job, list);
+		list_del(&job->list);
+		pthread_mutex_unlock(&reader_mutex);
+
+		reader_process(job);
+
+		pthread_mutex_lock(&reader_mutex);
+		list_add_tail(&job->list, &reader_done);
+		wake = main_waiting;
+		main_waiting = false;
+		pthread_mutex_unlock(&reader_mutex);
+
+		/* A full pipe means the main thread will look anyway. */
+		if (wake && write(done_pipe[1], "", 1) < 0 && errno != EAGAIN)
+			syslog(LOG_ERR, "reader thread wakeup failed: %m");
+	}
+
+	return NULL;
+}
+
+void reader_init(void)
+{
+	pthread_rwlockattr_t attr;
+	pthread_t thread;
+	sigset_t set, old;
+	unsigned int i;
+	int flags;
+
+	if (!reader_threads)
+		return;
+
+	/* The main thread must not be starved by a flood of reads. */
+	pthread_rwlockattr_init(&attr);
+#ifdef PTHREAD_RWLOCK_PREFER_WRITER_NONRECURSIVE_NP
+	pthread_rwlockattr_setkind_np(&attr,
+			PTHREAD_RWLOCK_PREFER_WRITER_NONRECURSIVE_NP);
+#endif
+	if (pthread_rwlock_init(&store_lock, &attr))
+		barf("reader store lock init failed");
+	pthread_rwlockattr_destroy(&attr);
+	pthread_rwlock_wrlock(&store_lock);
+
+	if (pipe(done_pipe))
+		barf_perror("reader pipe");
+	for (i = 0; i < 2; i++) {
+		if (fcntl(done_pipe[i], F_SETFD, FD_CLOEXEC) < 0)
+			barf_perror("reader pipe set flags");
+		flags = fcntl(done_pipe[i], F_GETFL);
+		if (flags < 0 ||
+		    fcntl(done_pipe[i], F_SETFL, flags | O_NONBLOCK) < 0)
+			barf_perror("reader pipe set flags");
+	}
+
+	/* Signals are for the main thread only. */
+	sigfillset(&set);
+	pthread_sigmask(SIG_SETMASK, &set, &old);
+	for (i = 0; i < reader_threads; i++) {
+		if (pthread_create(&thread, NULL, reader_thread, NULL))
+			barf("reader thread creation failed");
+		pthread_detach(thread);
+	}
+	pthread_sigmask(SIG_SETMASK, &old, NULL);
+}
+
+bool reader_queue(struct connection *conn, const struct xsd_sockmsg *hdr,
+		  const char *name)
+{
+	struct reader_job *job;
+	size_t len = strlen(name) + 1;
+
+	job = malloc(sizeof(*job) + len);
+	if (!job)
+		return false;
+
+	job->conn = conn;
+	job->fd = conn->fd;
+	job->hdr = *hdr;
+	job->data = NULL;
+	job->written = 0;
+	job->failed = false;
+	memcpy(job->name, name, len);
+
+	conn->read_job = job;
+	reader_pending++;
+
+	pthread_mutex_lock(&reader_mutex);
+	list_add_tail(&job->list, &reader_queued);
+	pthread_cond_signal(&reader_cond);
+	pthread_mutex_unlock(&reader_mutex);
+
+	return true;
+}
+
+bool reader_release_conn(struct connection *conn)
+{
+	if (!conn->read_job)
+		return false;
+
+	conn->read_job->conn = NULL;
+	conn->read_job = NULL;
+	reader_orphans++;
+
+	return true;
+}
+
+void reader_want_wakeup(void)
+{
+	reader_wake_needed = true;
+}
+
+bool reader_busy(void)
+{
+	return reader_pending;
+}
+
+void reader_store_lock(void)
+{
+	if (reader_threads)
+		pthread_rwlock_wrlock(&store_lock);
+}
+
+void reader_store_unlock(void)
+{
+	if (reader_threads)
+		pthread_rwlock_unlock(&store_lock);
+}
+
+void reader_set_fds(int *ptimeout)
+{
+	if (done_pipe[0] != -1 && done_fd_event.fd == -1)
+		fd_event_add(&done_fd_event, done_pipe[0], POLLIN);
+
+	if (!reader_pending || (!reader_wake_needed && !reader_orphans))
+		return;
+	reader_wake_needed = false;
+
+	pthread_mutex_lock(&reader_mutex);
+	if (list_empty(&reader_done))
+		main_waiting = true;
+	else
+		*ptimeout = 0;
+	pthread_mutex_unlock(&reader_mutex);
+}
+
+void reader_handle_fds(void)
+{
+	LIST_HEAD(done);
+	struct reader_job *job, *tmp;
+	char buf[64];
+
+	if (done_fd_event.revents) {
+		done_fd_event.revents = 0;
+		while (read(done_pipe[0], buf, sizeof(buf)) > 0)
+			;
+	}
+
+	if (!reader_pending)
+		return;
+
+	pthread_mutex_lock(&reader_mutex);
+	main_waiting = false;
+	list_splice_init(&reader_done, &done);
+	pthread_mutex_unlock(&reader_mutex);
+
+	list_for_each_entry_safe(job, tmp, &done, list) {
+		reader_pending--;
+		if (job->conn) {
+			job->conn->read_job = NULL;
+			conn_read_done(job->conn, &job->hdr, job->data,
+				       job->written, job->failed);
+		} else {
+			reader_orphans--;
+			close(job->fd);
+		}
+		free(job->data);
+		free(job);
+	}
+}
+
+/*
+ * Local variables:
+ *  mode: C
+ *  c-file-style: "linux"
+ *  indent-tabs-mode: t
+ *  c-basic-offset: 8
+ *  tab-width: 8
+ * End:
+ */
@@ -0,0 +1,110 @@
+/* SPDX-License-Identifier: MIT */
+
+/*
+ * Reader threads for Xen Store Daemon.
+ *
+ * Read-only requests of privileged socket connections can be handed off to
+ * a pool of threads, so a flood of them doesn't delay the requests processed
+ * by the main thread.  The main thread stays the only one modifying the data
+ * base.  It holds the store lock for writing all the time, with the exception
+ * of the points between two requests and while waiting for events, so the
+ * reader threads always see a consistent data base.
+ */
+
+#ifndef _XENSTORED_READER_H
+#define _XENSTORED_READER_H
+
+#ifndef NO_READER_THREADS
+extern unsigned int reader_threads;
+
+static inline bool reader_enabled(void)
+{
+	return reader_threads;
+}
+
+void reader_init(void);
+
+/*
+ * Queue a XS_READ or XS_DIRECTORY request of conn for node name.  The reply
+ * is written to the socket by the reader thread, conn mustn't be read from or
+ * written to until the main thread has seen the request completing.
+ */
+bool reader_queue(struct connection *conn, const struct xsd_sockmsg *hdr,
+		  const char *name);
+
+/*
+ * Called when conn is going away.  Returns true if a reader thread might
+ * still be using the fd of conn, which will be closed when it is done.
+ */
+bool reader_release_conn(struct connection *conn);
+
+/* The main thread needs to see the next job completing. */
+void reader_want_wakeup(void);
+
+/* Are there requests in flight? */
+bool reader_busy(void);
+
+/* Store lock, taken by the main thread for writing. */
+void reader_store_lock(void);
+void reader_store_unlock(void);
+
+void reader_set_fds(int *ptimeout);
+void reader_handle_fds(void);
+
+/*
+ * Provided by core.c: get the payload of the reply for a request, to be
+ * called with the store lock held; and finish a request on the main thread.
+ */
+int db_read_reply(const char *name, enum xsd_sockmsg_type type, char **data,
+		  unsigned int *len);
+void conn_read_done(struct connection *conn, const struct xsd_sockmsg *hdr,
+		    const char *data, unsigned int written, bool failed);
+#else
+static inline bool reader_enabled(void)
+{
+	return false;
+}
+
+static inline void reader_init(void)
+{
+}
+
+static inline bool reader_queue(struct connection *conn,
+				const struct xsd_sockmsg *hdr,
+				const char *name)
+{
+	return false;
+}
+
+static inline bool reader_release_conn(struct connection *conn)
+{
+	return false;
+}
+
+static inline bool reader_busy(void)
+{
+	return false;
+}
+
+static inline void reader_store_lock(void)
+{
+}
+
+static inline void reader_store_unlock(void)
+{
+}
+
+static inline void reader_want_wakeup(void)
+{
+}
+
+static inline void reader_set_fds(int *ptimeout)
+{
+}
+
+static inline void reader_handle_fds(void)
+{
+}
+#endif
+
+#endif /* _XENSTORED_READER_H */
@@ -61,6 +61,8 @@
 #define TALLOC_MAGIC 0xe814ec70
 #define TALLOC_FLAG_FREE 0x01
 #define TALLOC_FLAG_LOOP 0x02
+#define TALLOC_FLAG_POOL 0x04		/* This is a talloc pool */
+#define TALLOC_FLAG_POOLMEM 0x08	/* This is allocated in a pool */
 #define TALLOC_MAGIC_REFERENCE ((const char *)1)
 
 /* by default we abort when given a bad pointer (such as when talloc_free() is called 
@@ -96,17 +98,34 @@ struct talloc_chunk {
 	struct talloc_chunk *next, *prev;
 	struct talloc_chunk *parent, *child;
 	struct talloc_reference_handle *refs;
-	unsigned int null_refs; /* references from null_context */
 	talloc_destructor_t destructor;
 	const char *name;
 	size_t size;
+	unsigned int null_refs; /* references from null_context */
 	unsigned flags;
+	struct talloc_chunk *pool; /* if TALLOC_FLAG_POOLMEM is set */
 };
 
 /* 16 byte alignment seems to keep everyone happy */
-#define TC_HDR_SIZE ((sizeof(struct talloc_chunk)+15)&~15)
+#define TC_ALIGN(size) (((size)+15)&~15)
+#define TC_HDR_SIZE TC_ALIGN(sizeof(struct talloc_chunk))
 #define TC_PTR_FROM_CHUNK(tc) ((void *)(TC_HDR_SIZE + (char*)tc))
 
+/*
+  a pool is a chunk with a size of 0 to its user, followed by the pool
+  header and the memory its members are carved from. The pool memory is
+  released when the pool and all its members have been freed.
+*/
+struct talloc_pool_hdr {
+	char *next;	/* first free byte */
+	char *end;
+	unsigned int object_count; /* the pool itself and its members */
+};
+
+#define TP_HDR_SIZE TC_ALIGN(sizeof(struct talloc_pool_hdr))
+#define TP_HDR_FROM_CHUNK(tc) ((struct talloc_pool_hdr *)TC_PTR_FROM_CHUNK(tc))
+#define TP_FIRST_CHUNK(tc) (TP_HDR_SIZE + (char *)TC_PTR_FROM_CHUNK(tc))
+
 /* panic if we get a bad magic value */
 static struct talloc_chunk *talloc_chunk_from_ptr(const void *ptr)
 {
@@ -165,12 +184,81 @@ void *talloc_parent(const void *ptr)
 	return tc? TC_PTR_FROM_CHUNK(tc) : NULL;
 }
 
+/*
+  carve a chunk out of the pool the parent belongs to, if there is one
+  and there is enough space left in it
+*/
+static struct talloc_chunk *talloc_alloc_pool(struct talloc_chunk *parent,
+					      size_t size)
+{
+	struct talloc_chunk *pool, *tc;
+	struct talloc_pool_hdr *ph;
+	size_t chunk_size = TC_ALIGN(TC_HDR_SIZE + size);
+
+	if (parent == NULL) {
+		return NULL;
+	}
+	if (parent->flags & TALLOC_FLAG_POOL) {
+		pool = parent;
+	} else if (parent->flags & TALLOC_FLAG_POOLMEM) {
+		pool = parent->pool;
+	} else {
+		return NULL;
+	}
+	if (pool->flags & TALLOC_FLAG_FREE) {
+		return NULL;
+	}
+
+	ph = TP_HDR_FROM_CHUNK(pool);
+	if ((size_t)(ph->end - ph->next) < chunk_size) {
+		return NULL;
+	}
+
+	tc = (struct talloc_chunk *)ph->next;
+	ph->next += chunk_size;
+	ph->object_count++;
+
+	tc->flags = TALLOC_MAGIC | TALLOC_FLAG_POOLMEM;
+	tc->pool = pool;
+
+	return tc;
+}
+
+/*
+  give the memory of a chunk back, either to the pool it was carved from
+  or to the system
+*/
+static void talloc_free_chunk(struct talloc_chunk *tc)
+{
+	struct talloc_chunk *pool;
+	struct talloc_pool_hdr *ph;
+
+	if (tc->flags & TALLOC_FLAG_POOLMEM) {
+		pool = tc->pool;
+	} else if (tc->flags & TALLOC_FLAG_POOL) {
+		pool = tc;
+	} else {
+		free(tc);
+		return;
+	}
+
+	ph = TP_HDR_FROM_CHUNK(pool);
+	ph->object_count--;
+	if (ph->object_count == 0) {
+		free(pool);
+	} else if (ph->object_count == 1 &&
+		   !(pool->flags & TALLOC_FLAG_FREE)) {
+		/* only the pool itself is left, so start all over */
+		ph->next = TP_FIRST_CHUNK(pool);
+	}
+}
+
 /* 
    Allocate a bit of memory as a child of an existing pointer
 */
 void *_talloc(const void *context, size_t size)
 {
-	struct talloc_chunk *tc;
+	struct talloc_chunk *tc, *parent = NULL;
 
 	if (context == NULL) {
 		context = null_context;
@@ -180,20 +268,25 @@ void *_talloc(const void *context, size_t size)
 		return NULL;
 	}
 
-	tc = malloc(TC_HDR_SIZE+size);
-	if (tc == NULL) return NULL;
+	if (context) {
+		parent = talloc_chunk_from_ptr(context);
+	}
+
+	tc = talloc_alloc_pool(parent, size);
+	if (tc == NULL) {
+		tc = malloc(TC_HDR_SIZE+size);
+		if (tc == NULL) return NULL;
+		tc->flags = TALLOC_MAGIC;
+	}
 
 	tc->size = size;
-	tc->flags = TALLOC_MAGIC;
 	tc->destructor = NULL;
 	tc->child = NULL;
 	tc->name = NULL;
 	tc->refs = NULL;
 	tc->null_refs = 0;
 
-	if (context) {
-		struct talloc_chunk *parent = talloc_chunk_from_ptr(context);
-
+	if (parent) {
 		tc->parent = parent;
 
 		if (parent->child) {
@@ -209,6 +302,57 @@ void *_talloc(const void *context, size_t size)
 }
 
 
+/*
+  create a talloc pool: all children of the pool and their children are
+  carved from one memory block of the given size, as long as they fit.
+  When only the pool itself is left the block is reused from its start.
+*/
+void *talloc_pool(const void *context, size_t size)
+{
+	void *ptr;
+	struct talloc_chunk *tc;
+	struct talloc_pool_hdr *ph;
+
+	if (size >= MAX_TALLOC_SIZE) {
+		return NULL;
+	}
+
+	/* don't let the pool itself be carved from another pool */
+	ptr = _talloc(NULL, TP_HDR_SIZE + size);
+	if (ptr == NULL) {
+		return NULL;
+	}
+	if (context) {
+		talloc_steal(context, ptr);
+	}
+
+	tc = talloc_chunk_from_ptr(ptr);
+	tc->flags |= TALLOC_FLAG_POOL;
+	tc->size = 0;
+	talloc_set_name_const(ptr, "talloc_pool");
+
+	ph = TP_HDR_FROM_CHUNK(tc);
+	ph->next = TP_FIRST_CHUNK(tc);
+	ph->end = ph->next + size;
+	ph->object_count = 1;
+
+	return ptr;
+}
+
+/*
+  return the number of bytes in use in a talloc pool
+*/
+size_t talloc_pool_used(const void *ptr)
+{
+	struct talloc_chunk *tc = talloc_chunk_from_ptr(ptr);
+
+	if (!(tc->flags & TALLOC_FLAG_POOL)) {
+		return 0;
+	}
+
+	return TP_HDR_FROM_CHUNK(tc)->next - TP_FIRST_CHUNK(tc);
+}
+
 /*
   setup a destructor to be called on free of a pointer
   the destructor should return 0 on success, or -1 on failure.
@@ -596,7 +740,7 @@ int talloc_free(const void *ptr)
 
 	tc->flags |= TALLOC_FLAG_FREE;
 
-	free(tc);
+	talloc_free_chunk(tc);
  success:
 	errno = saved_errno;
 	return 0;
@@ -632,23 +776,43 @@ void *_talloc_realloc(const void *context, void *ptr, size_t size, const char *n
 
 	tc = talloc_chunk_from_ptr(ptr);
 
-	/* don't allow realloc on referenced pointers */
-	if (tc->refs) {
+	/* don't allow realloc on referenced pointers or pools */
+	if (tc->refs || (tc->flags & TALLOC_FLAG_POOL)) {
 		return NULL;
 	}
 
 	/* by resetting magic we catch users of the old memory */
 	tc->flags |= TALLOC_FLAG_FREE;
 
+	if (tc->flags & TALLOC_FLAG_POOLMEM) {
+		/* shrink in place, otherwise move to new memory */
+		struct talloc_chunk *new_tc = tc;
+		unsigned flags;
+
+		if (size > tc->size) {
+			new_tc = talloc_alloc_pool(tc->pool, size);
+			flags = new_tc ? new_tc->flags : TALLOC_MAGIC;
+			if (new_tc == NULL) {
+				new_tc = malloc(size + TC_HDR_SIZE);
+			}
+			if (new_tc) {
+				memcpy(new_tc, tc, tc->size + TC_HDR_SIZE);
+				new_tc->flags = flags | TALLOC_FLAG_FREE;
+				talloc_free_chunk(tc);
+			}
+		}
+		new_ptr = new_tc;
+	} else {
 #if ALWAYS_REALLOC
-	new_ptr = malloc(size + TC_HDR_SIZE);
-	if (new_ptr) {
-		memcpy(new_ptr, tc, tc->size + TC_HDR_SIZE);
-		free(tc);
-	}
+		new_ptr = malloc(size + TC_HDR_SIZE);
+		if (new_ptr) {
+			memcpy(new_ptr, tc, tc->size + TC_HDR_SIZE);
+			free(tc);
+		}
 #else
-	new_ptr = realloc(tc, size + TC_HDR_SIZE);
+		new_ptr = realloc(tc, size + TC_HDR_SIZE);
 #endif
+	}
 	if (!new_ptr) {	
 		tc->flags &= ~TALLOC_FLAG_FREE; 
 		return NULL; 
@@ -28,6 +28,7 @@
 #include <stdlib.h>
 #include <fcntl.h>
 #include <unistd.h>
+#include <xen-tools/xenstore-common.h>
 #include "talloc.h"
 #include "list.h"
 #include "transaction.h"
@@ -106,6 +107,26 @@
  *    TA2: write node A:   g(2:A) = 6, G = 7
  *    End TA1: g(1:A) == g(A) => okay, B = 1:B, g(B) = 7, G = 8
  *    End TA2: g(2:B) != g(B) => EAGAIN
+ *
+ * A generation mismatch of a node is no conflict if the concurrent
+ * modification didn't change the node's data or permissions, but only its
+ * list of children, and the transaction didn't read that list. This is the
+ * common case of e.g. backends creating their device nodes under the same
+ * parent directory. Any children added or removed in the transaction are
+ * then applied to the current children list of the global node. The
+ * children themselves are nodes accessed in the transaction, so creating or
+ * deleting the same child concurrently is still detected as a conflict.
+ *
+ * 5. Two transactions creating different children of the same node
+ *    I: g(A) = 1, G = 2
+ *    Start transaction 1: G(1) = 2, G = 3
+ *    Start transaction 2: G(2) = 3, G = 4
+ *    TA1: create A/B:     g(1:A) = 1, g(1:B) = 4, g(1:A) = 5, G = 6
+ *    TA2: create A/C:     g(2:A) = 1, g(2:C) = 6, g(2:A) = 7, G = 8
+ *    End TA1: g(1:A) == g(A) => okay, A = 1:A, B = 1:B, g(A) = 9, ...
+ *    End TA2: g(2:A) != g(A), but only children of A changed and children
+ *             of A not read in TA2 => merge: A = 2:A with child B added,
+ *             C = 2:C
  */
 
 struct accessed_node
@@ -123,9 +144,15 @@ struct accessed_node
 	/* Original node permissions. */
 	struct node_perms perms;
 
+	/* Data base record of the node as read, saved when modifying it. */
+	struct node_hdr *orig;
+
 	/* Generation count checking required? */
 	bool check_gen;
 
+	/* Children list has been returned to the client? */
+	bool children_read;
+
 	/* Modified? */
 	bool modified;
 
@@ -169,6 +196,15 @@ struct transaction
 
 uint64_t generation;
 
+/* Statistics for "xenstore-control transactions". */
+static struct {
+	unsigned long started;
+	unsigned long committed;
+	unsigned long merged;
+	unsigned long conflicts;
+	unsigned long failed;
+} ta_stats;
+
 void ta_node_created(struct transaction *trans)
 {
 	trans->node_created = true;
@@ -297,6 +333,21 @@ int access_node(struct connection *conn, struct node *node,
 		list_add_tail(&i->list, &trans->accessed);
 	}
 
+	/*
+	 * Before the transaction copy of a read node is overwritten the first
+	 * time, save it for being able to merge concurrent children changes.
+	 */
+	if (type == NODE_ACCESS_WRITE && !i->modified && i->ta_node) {
+		size_t size;
+
+		i->orig = db_fetch(i, i->trans_name, &size);
+		if (!i->orig && errno == ENOMEM) {
+			/* Don't free i, it is in the list already. */
+			trans->fail = true;
+			return ENOMEM;
+		}
+	}
+
 	if (type != NODE_ACCESS_READ)
 		i->modified = true;
 
@@ -346,31 +397,219 @@ void queue_watches(struct connection *conn, const char *name, bool watch_exact)
 	}
 }
 
+/* The children list of a node has been returned to the client. */
+void ta_node_children_read(struct transaction *trans, const char *name)
+{
+	struct accessed_node *i;
+
+	i = find_accessed_node(trans, name);
+	if (!i) {
+		trans->fail = true;
+		return;
+	}
+
+	i->children_read = true;
+}
+
+static const char *hdr_data(const struct node_hdr *hdr)
+{
+	return (const char *)((const struct xs_permissions *)(hdr + 1) +
+			      hdr->num_perms);
+}
+
+static const char *hdr_children(const struct node_hdr *hdr)
+{
+	return hdr_data(hdr) + hdr->datalen;
+}
+
+static int cmp_child(const void *a, const void *b)
+{
+	return strcmp(*(const char * const *)a, *(const char * const *)b);
+}
+
+static bool find_child(const char **sorted, unsigned int num,
+		       const char *name)
+{
+	return bsearch(&name, sorted, num, sizeof(*sorted), cmp_child);
+}
+
+/* Return the children of a node as sorted array of strings. */
+static const char **sort_children(const void *ctx, const struct node_hdr *hdr,
+				  unsigned int *num)
+{
+	const char *children = hdr_children(hdr);
+	const char **sorted;
+	unsigned int i, off;
+
+	*num = xenstore_count_strings(children, hdr->childlen);
+	sorted = talloc_array(ctx, const char *, *num ? : 1);
+	if (!sorted)
+		return NULL;
+
+	for (i = 0, off = 0; i < *num; i++) {
+		sorted[i] = children + off;
+		off += strlen(children + off) + 1;
+	}
+	qsort(sorted, *num, sizeof(*sorted), cmp_child);
+
+	return sorted;
+}
+
+/*
+ * Apply the children added and removed in the transaction (the difference
+ * between orig and ta) to the children of the current global node cur.
+ * Returns the new children list, or NULL with errno set to EAGAIN if the
+ * same child has been added or removed concurrently.
+ */
+static char *merge_children(const void *ctx, const struct node_hdr *orig,
+			    const struct node_hdr *ta,
+			    const struct node_hdr *cur, unsigned int *len)
+{
+	const char **o, **t, **c;
+	unsigned int n_o, n_t, n_c, i;
+	const char *child;
+	char *children;
+
+	o = sort_children(ctx, orig, &n_o);
+	t = sort_children(ctx, ta, &n_t);
+	c = sort_children(ctx, cur, &n_c);
+	children = talloc_array(ctx, char, cur->childlen + ta->childlen + 1);
+	if (!o || !t || !c || !children) {
+		errno = ENOMEM;
+		return NULL;
+	}
+
+	/* Removed in the transaction, so must still be there. */
+	for (i = 0; i < n_o; i++) {
+		if (!find_child(t, n_t, o[i]) && !find_child(c, n_c, o[i])) {
+			errno = EAGAIN;
+			return NULL;
+		}
+	}
+
+	*len = 0;
+	for (child = hdr_children(cur); child < hdr_children(cur) + cur->childlen;
+	     child += strlen(child) + 1) {
+		if (find_child(o, n_o, child) && !find_child(t, n_t, child))
+			continue;
+		strcpy(children + *len, child);
+		*len += strlen(child) + 1;
+	}
+
+	/* Added in the transaction, so must not have been added globally. */
+	for (child = hdr_children(ta); child < hdr_children(ta) + ta->childlen;
+	     child += strlen(child) + 1) {
+		if (find_child(o, n_o, child))
+			continue;
+		if (find_child(c, n_c, child)) {
+			errno = EAGAIN;
+			return NULL;
+		}
+		strcpy(children + *len, child);
+		*len += strlen(child) + 1;
+	}
+
+	return children;
+}
+
+/*
+ * The global node has been modified since the transaction has read it.
+ * Check whether only the children list has changed and the transaction
+ * didn't look at it. If so, rebase the transaction's copy of the node onto
+ * the current children list, otherwise return EAGAIN.
+ */
+static int rebase_node(struct connection *conn, struct accessed_node *i,
+		       const struct node_hdr *cur)
+{
+	const struct node_hdr *ta, *orig;
+	struct node_hdr *hdr;
+	unsigned int childlen;
+	char *children;
+	size_t size;
+	int ret;
+
+	if (i->children_read || !i->ta_node || !cur)
+		return EAGAIN;
+
+	ta = db_fetch(i, i->trans_name, &size);
+	if (!ta)
+		return EAGAIN;
+	/* An unmodified copy is the node as read. */
+	orig = i->modified ? i->orig : ta;
+	if (!orig)
+		return EAGAIN;
+
+	/* Permissions and data must be unchanged. */
+	size = hdr_children(orig) - (const char *)(orig + 1);
+	if (orig->num_perms != cur->num_perms ||
+	    orig->datalen != cur->datalen || memcmp(orig + 1, cur + 1, size))
+		return EAGAIN;
+
+	/* Nothing read has changed, and there is nothing to write. */
+	if (!i->modified)
+		return 0;
+
+	if (orig->childlen == ta->childlen &&
+	    !memcmp(hdr_children(orig), hdr_children(ta), ta->childlen)) {
+		/* No children changed in the transaction, take the new ones. */
+		children = (char *)hdr_children(cur);
+		childlen = cur->childlen;
+	} else {
+		children = merge_children(i, orig, ta, cur, &childlen);
+		if (!children)
+			return errno;
+	}
+
+	size = hdr_children(ta) - (const char *)ta;
+	hdr = talloc_size(i, size + childlen);
+	if (!hdr)
+		return ENOMEM;
+	memcpy(hdr, ta, size);
+	memcpy((char *)hdr + size, children, childlen);
+	hdr->childlen = childlen;
+
+	ret = db_write(conn, i->trans_name, hdr, size + childlen, NULL,
+		       NODE_MODIFY, true);
+	talloc_free(hdr);
+
+	return ret ? EIO : 0;
+}
+
 /*
  * Finalize transaction:
  * Walk through accessed nodes and check generation against global data.
- * If all entries match, read the transaction entries and write them without
- * transaction prepended. Delete all transaction specific nodes in the data
- * base.
+ * If all entries match (or the concurrent changes could be merged), read the
+ * transaction entries and write them without transaction prepended. Delete
+ * all transaction specific nodes in the data base.
  */
 static int finalize_transaction(struct connection *conn,
 				struct transaction *trans, bool *is_corrupt)
 {
 	struct accessed_node *i, *n;
 	size_t size;
-	const struct node_hdr *hdr;
+	struct node_hdr *hdr;
 	uint64_t gen;
+	bool merged = false;
+	int ret;
 
 	list_for_each_entry_safe(i, n, &trans->accessed, list) {
 		if (i->check_gen) {
-			hdr = db_fetch(i->node, &size);
+			hdr = db_fetch(i, i->node, &size);
 			if (!hdr) {
+				if (errno == ENOMEM)
+					return ENOMEM;
 				gen = NO_GENERATION;
 			} else {
 				gen = hdr->generation;
 			}
-			if (i->generation != gen)
-				return EAGAIN;
+			ret = 0;
+			if (i->generation != gen) {
+				ret = rebase_node(conn, i, hdr);
+				merged = true;
+			}
+			talloc_free(hdr);
+			if (ret)
+				return ret;
 		}
 
 		/* Entries for unmodified nodes can be removed early. */
@@ -384,27 +623,21 @@ static int finalize_transaction(struct connection *conn,
 
 	while ((i = list_top(&trans->accessed, struct accessed_node, list))) {
 		if (i->ta_node) {
-			hdr = db_fetch(i->trans_name, &size);
+			hdr = db_fetch(i, i->trans_name, &size);
 			if (hdr) {
 				/*
-				 * Delete transaction entry and write it as
-				 * no-TA entry. As we only hold a reference
-				 * to the data, increment its ref count, then
-				 * delete it from the DB. Now we own it and can
-				 * drop the const attribute for changing the
-				 * generation count.
+				 * Delete transaction entry and write our copy
+				 * of it as no-TA entry with a new generation
+				 * count.
 				 */
 				enum write_node_mode mode;
-				struct node_hdr *own;
 
-				talloc_increase_ref_count(hdr);
 				db_delete(conn, i->trans_name, NULL);
 
-				own = (struct node_hdr *)hdr;
-				own->generation = ++generation;
+				hdr->generation = ++generation;
 				mode = (i->generation == NO_GENERATION)
 				       ? NODE_CREATE : NODE_MODIFY;
-				*is_corrupt |= db_write(conn, i->node, own,
+				*is_corrupt |= db_write(conn, i->node, hdr,
 							size, NULL, mode, true);
 			} else {
 				*is_corrupt = true;
@@ -426,6 +659,9 @@ static int finalize_transaction(struct connection *conn,
 		talloc_free(i);
 	}
 
+	if (merged)
+		ta_stats.merged++;
+
 	return 0;
 }
 
@@ -460,6 +696,66 @@ struct transaction *transaction_lookup(struct connection *conn, uint32_t id)
 	return ERR_PTR(-ENOENT);
 }
 
+struct transaction *transaction_new(const void *ctx, struct connection *conn)
+{
+	struct transaction *trans;
+
+	/*
+	 * Attach transaction to ctx for autofree until it's complete.  It must
+	 * not be taken from the request pool, as it will outlive the request.
+	 */
+	trans = talloc_steal(ctx, talloc_zero(NULL, struct transaction));
+	if (!trans)
+		return NULL;
+
+	trace_create(trans, "transaction");
+	INIT_LIST_HEAD(&trans->accessed);
+	INIT_LIST_HEAD(&trans->changed_domains);
+	trans->conn = conn;
+	trans->fail = false;
+	trans->generation = ++generation;
+	talloc_set_destructor(trans, destroy_transaction);
+	wrl_ntransactions++;
+	ta_stats.started++;
+
+	return trans;
+}
+
+int transaction_commit(struct connection *conn, struct transaction *trans)
+{
+	bool is_corrupt = false;
+	bool chk_quota;
+	int ret;
+
+	if (trans->fail) {
+		ta_stats.failed++;
+		return ENOMEM;
+	}
+
+	chk_quota = trans->node_created && domain_is_unprivileged(conn);
+	ret = acc_fix_domains(&trans->changed_domains, chk_quota, false);
+	if (!ret)
+		ret = finalize_transaction(conn, trans, &is_corrupt);
+	if (ret) {
+		if (ret == EAGAIN)
+			ta_stats.conflicts++;
+		else
+			ta_stats.failed++;
+		return ret;
+	}
+
+	ta_stats.committed++;
+	wrl_apply_debit_trans_commit(conn);
+
+	/* fix domain entry for each changed domain */
+	acc_fix_domains(&trans->changed_domains, false, true);
+
+	if (is_corrupt)
+		corrupt(conn, "transaction inconsistency");
+
+	return 0;
+}
+
 int do_transaction_start(const void *ctx, struct connection *conn,
 			 struct buffered_data *in)
 {
@@ -473,18 +769,10 @@ int do_transaction_start(const void *ctx, struct connection *conn,
 	if (domain_transaction_get(conn) > hard_quotas[ACC_TRANS].val)
 		return ENOSPC;
 
-	/* Attach transaction to ctx for autofree until it's complete */
-	trans = talloc_zero(ctx, struct transaction);
+	trans = transaction_new(ctx, conn);
 	if (!trans)
 		return ENOMEM;
 
-	trace_create(trans, "transaction");
-	INIT_LIST_HEAD(&trans->accessed);
-	INIT_LIST_HEAD(&trans->changed_domains);
-	trans->conn = conn;
-	trans->fail = false;
-	trans->generation = ++generation;
-
 	/* Pick an unused transaction identifier. */
 	do {
 		trans->id = conn->next_transaction_id;
@@ -497,9 +785,7 @@ int do_transaction_start(const void *ctx, struct connection *conn,
 	/* Now we own it. */
 	list_add_tail(&trans->list, &conn->transaction_list);
 	talloc_steal(conn, trans);
-	talloc_set_destructor(trans, destroy_transaction);
 	domain_transaction_inc(conn);
-	wrl_ntransactions++;
 
 	snprintf(id_str, sizeof(id_str), "%u", trans->id);
 	send_reply(conn, XS_TRANSACTION_START, id_str, strlen(id_str)+1);
@@ -512,8 +798,6 @@ int do_transaction_end(const void *ctx, struct connection *conn,
 {
 	const char *arg = onearg(in);
 	struct transaction *trans;
-	bool is_corrupt = false;
-	bool chk_quota;
 	int ret;
 
 	if (!arg || (!streq(arg, "T") && !streq(arg, "F")))
@@ -528,29 +812,13 @@ int do_transaction_end(const void *ctx, struct connection *conn,
 	if (list_empty(&conn->transaction_list))
 		conn->ta_start_time = 0;
 
-	chk_quota = trans->node_created && domain_is_unprivileged(conn);
-
 	/* Attach transaction to ctx for auto-cleanup */
 	talloc_steal(ctx, trans);
 
 	if (streq(arg, "T")) {
-		if (trans->fail)
-			return ENOMEM;
-		ret = acc_fix_domains(&trans->changed_domains, chk_quota,
-				      false);
+		ret = transaction_commit(conn, trans);
 		if (ret)
 			return ret;
-		ret = finalize_transaction(conn, trans, &is_corrupt);
-		if (ret)
-			return ret;
-
-		wrl_apply_debit_trans_commit(conn);
-
-		/* fix domain entry for each changed domain */
-		acc_fix_domains(&trans->changed_domains, false, true);
-
-		if (is_corrupt)
-			corrupt(conn, "transaction inconsistency");
 	}
 	send_ack(conn, XS_TRANSACTION_END);
 
@@ -582,6 +850,44 @@ void conn_delete_all_transactions(struct connection *conn)
 	conn->ta_start_time = 0;
 }
 
+void transaction_stats_reset(void)
+{
+	memset(&ta_stats, 0, sizeof(ta_stats));
+}
+
+int transaction_stats(const void *ctx, struct connection *conn)
+{
+	unsigned long ended, rate = 0;
+	char *resp;
+
+	ended = ta_stats.committed + ta_stats.conflicts + ta_stats.failed;
+	if (ended)
+		rate = ta_stats.conflicts * 1000 / ended;
+
+	resp = talloc_asprintf(ctx,
+		"Transaction statistics:\n"
+		"%-17s: %8lu\n"
+		"%-17s: %8lu\n"
+		"%-17s: %8lu %s\n"
+		"%-17s: %8lu %s\n"
+		"%-17s: %8lu %s\n"
+		"%-17s: %6lu.%lu%% %s\n",
+		"started", ta_stats.started,
+		"committed", ta_stats.committed,
+		"merged", ta_stats.merged,
+		"Committed after merging concurrent children changes",
+		"conflicts", ta_stats.conflicts, "Commits failed with EAGAIN",
+		"failed", ta_stats.failed, "Commits failed otherwise",
+		"conflict-rate", rate / 10, rate % 10,
+		"Conflicts per commit attempt");
+	if (!resp)
+		return ENOMEM;
+
+	send_reply(conn, XS_CONTROL, resp, strlen(resp) + 1);
+
+	return 0;
+}
+
 int check_transactions(struct hashtable *hash)
 {
 	struct connection *conn;
@@ -36,9 +36,20 @@ int do_transaction_end(const void *ctx, struct connection *conn,
 
 struct transaction *transaction_lookup(struct connection *conn, uint32_t id);
 
+/*
+ * Create a transaction freed together with ctx and commit it.  Without being
+ * added to the connection's transactions it is not visible to the client, so
+ * it can be used to make a single request atomic.
+ */
+struct transaction *transaction_new(const void *ctx, struct connection *conn);
+int transaction_commit(struct connection *conn, struct transaction *trans);
+
 /* Set flag for created node. */
 void ta_node_created(struct transaction *trans);
 
+/* The children list of an accessed node has been read. */
+void ta_node_children_read(struct transaction *trans, const char *name);
+
 /* This node was accessed. */
 int __must_check access_node(struct connection *conn, struct node *node,
                              enum node_access_type type, const char **db_name);
@@ -58,4 +69,8 @@ struct list_head *transaction_get_changed_domains(struct transaction *trans);
 void conn_delete_all_transactions(struct connection *conn);
 int check_transactions(struct hashtable *hash);
 
+/* Statistics for "xenstore-control transactions". */
+int transaction_stats(const void *ctx, struct connection *conn);
+void transaction_stats_reset(void);
+
 #endif /* _XENSTORED_TRANSACTION_H */
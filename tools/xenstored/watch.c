@@ -36,6 +36,12 @@ struct watch
 	/* Watches on this connection */
 	struct list_head list;
 
+	/* Watches on the same path, of all connections */
+	struct list_head path_list;
+	struct watch_path *path;
+
+	struct connection *conn;
+
 	/* Offset into path for skipping prefix (used for relative paths). */
 	unsigned int prefix_len;
 
@@ -43,22 +49,46 @@ struct watch
 	char *node;
 };
 
-/* Is child a subnode of parent, or equal? */
-static bool is_child(const char *child, const char *parent)
+/*
+ * All watches are indexed by their path, so a modification of a node only
+ * has to look at the watches of the node itself and of its ancestors
+ * instead of at all watches of all connections.
+ */
+struct watch_path
 {
-	unsigned int len = strlen(parent);
+	struct list_head watches;
+	char *name;
+};
 
-	/*
-	 * / should really be "" for this algorithm to work, but that's a
-	 * usability nightmare.
-	 */
-	if (streq(parent, "/"))
-		return true;
+static struct hashtable *watch_paths;
 
-	if (strncmp(child, parent, len) != 0)
-		return false;
+static struct watch_path *get_watch_path_entry(const char *name)
+{
+	struct watch_path *wp;
+
+	if (!watch_paths) {
+		watch_paths = create_hashtable(NULL, "watch_paths",
+					       hash_from_key_fn, keys_equal_fn,
+					       0);
+		if (!watch_paths)
+			return NULL;
+	}
+
+	wp = hashtable_search(watch_paths, name);
+	if (wp)
+		return wp;
+
+	wp = talloc(watch_paths, struct watch_path);
+	if (!wp)
+		return NULL;
+	wp->name = talloc_strdup(wp, name);
+	if (!wp->name || hashtable_add(watch_paths, wp->name, wp)) {
+		talloc_free(wp);
+		return NULL;
+	}
+	INIT_LIST_HEAD(&wp->watches);
 
-	return child[len] == '/' || child[len] == '\0';
+	return wp;
 }
 
 static const char *get_watch_path(const struct watch *watch, const char *name)
@@ -111,6 +141,26 @@ static bool watch_permitted(struct connection *conn, const void *ctx,
 	return perm & XS_PERM_READ;
 }
 
+/* Create an event for each permitted watch on the path wpath. */
+static void fire_watch_path(struct buffered_data *req, const void *ctx,
+			    const char *wpath, const char *name,
+			    const struct node *node, struct node_perms *perms)
+{
+	struct watch_path *wp;
+	struct watch *watch;
+
+	wp = watch_paths ? hashtable_search(watch_paths, wpath) : NULL;
+	if (!wp)
+		return;
+
+	list_for_each_entry(watch, &wp->watches, path_list) {
+		if (watch_permitted(watch->conn, ctx, name, node, perms))
+			send_event(req, watch->conn,
+				   get_watch_path(watch, name), watch->token,
+				   get_watch_path(watch, watch->node));
+	}
+}
+
 /*
  * Check whether any watch events are to be sent.
  * Temporary memory allocations are done with ctx.
@@ -121,9 +171,8 @@ static bool watch_permitted(struct connection *conn, const void *ctx,
 void fire_watches(struct connection *conn, const void *ctx, const char *name,
 		  const struct node *node, bool exact, struct node_perms *perms)
 {
-	struct connection *i;
 	struct buffered_data *req;
-	struct watch *watch;
+	char *wpath, *slash;
 
 	/* During transactions, don't fire watches, but queue them. */
 	if (conn && conn->transaction) {
@@ -133,29 +182,41 @@ void fire_watches(struct connection *conn, const void *ctx, const char *name,
 
 	req = domain_is_unprivileged(conn) ? conn->in : NULL;
 
-	/* Create an event for each watch. */
-	list_for_each_entry(i, &connections, list) {
-		if (!watch_permitted(i, ctx, name, node, perms))
-			continue;
-
-		list_for_each_entry(watch, &i->watches, list) {
-			if (exact) {
-				if (streq(name, watch->node))
-					send_event(req, i,
-						   get_watch_path(watch, name),
-						   watch->token);
-			} else {
-				if (is_child(name, watch->node))
-					send_event(req, i,
-						   get_watch_path(watch, name),
-						   watch->token);
-			}
-		}
+	fire_watch_path(req, ctx, name, name, node, perms);
+	if (exact)
+		return;
+
+	/* Watches on all ancestors are fired, too. */
+	wpath = talloc_strdup(ctx, name);
+	if (!wpath)
+		return;
+	while ((slash = strrchr(wpath, '/')) && slash != wpath) {
+		*slash = 0;
+		fire_watch_path(req, ctx, wpath, name, node, perms);
 	}
+
+	/*
+	 * / should really be "" for this to work, but that's a usability
+	 * nightmare.  A watch on / fires for everything, special nodes
+	 * included.
+	 */
+	if (!streq(name, "/"))
+		fire_watch_path(req, ctx, "/", name, node, perms);
 }
 
 static int destroy_watch(void *_watch)
 {
+	struct watch *watch = _watch;
+	struct watch_path *wp = watch->path;
+
+	if (wp) {
+		list_del(&watch->path_list);
+		if (list_empty(&wp->watches)) {
+			hashtable_remove(watch_paths, wp->name);
+			talloc_free(wp);
+		}
+	}
+
 	trace_destroy(_watch, "watch");
 	return 0;
 }
@@ -175,7 +236,7 @@ static struct watch *add_watch(struct connection *conn, const char *path,
 {
 	struct watch *watch;
 
-	watch = talloc(conn, struct watch);
+	watch = talloc_zero(conn, struct watch);
 	if (!watch)
 		goto nomem;
 	watch->node = talloc_strdup(watch, path);
@@ -185,11 +246,19 @@ static struct watch *add_watch(struct connection *conn, const char *path,
 	if (domain_memory_add(conn, conn->id, strlen(path) + strlen(token),
 			      no_quota_check))
 		goto nomem;
+	watch->path = get_watch_path_entry(path);
+	if (!watch->path) {
+		domain_memory_add_nochk(conn, conn->id,
+					-strlen(path) - strlen(token));
+		goto nomem;
+	}
 
+	watch->conn = conn;
 	watch->prefix_len = relative ? strlen(get_implicit_path(conn)) + 1 : 0;
 
 	domain_watch_inc(conn);
 	list_add_tail(&watch->list, &conn->watches);
+	list_add_tail(&watch->path_list, &watch->path->watches);
 	talloc_set_destructor(watch, destroy_watch);
 
 	return watch;
@@ -235,7 +304,7 @@ int do_watch(const void *ctx, struct connection *conn, struct buffered_data *in)
 	 * This event will not be linked to the XS_WATCH request.
 	 */
 	send_event(NULL, conn, get_watch_path(watch, watch->node),
-		   watch->token);
+		   watch->token, get_watch_path(watch, watch->node));
 
 	return 0;
 }
@@ -47,6 +47,8 @@ struct domain_create {
     bool userspace_colo_proxy;
     int migrate_fd; /* -1 means none */
     int send_back_fd; /* -1 means none */
+    const int *stripe_fds; /* further page data streams, with migrate_fd */
+    int num_stripe_fds;
     char **migration_domname_r; /* from malloc */
 };
 
@@ -174,6 +174,11 @@ const struct cmd_spec cmd_table[] = {
       "-e              Do not wait in the background (on <host>) for the death\n"
       "                of the domain.\n"
       "--debug         Print huge (!) amount of debug during the migration process.\n"
+      "--compress      Compress guest memory for the transfer.\n"
+      "--stripe-fds FD[,FD...]\n"
+      "                Also send guest memory over these already connected\n"
+      "                fds.  The receiving xl migrate-receive needs matching\n"
+      "                --stripe-fds, so this wants a custom -s transport.\n"
       "-p              Do not unpause domain after migrating it.\n"
       "-D              Preserve the domain id"
     },
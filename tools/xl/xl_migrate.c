@@ -12,8 +12,10 @@
  * GNU Lesser General Public License for more details.
  */
 
+#include <errno.h>
 #include <fcntl.h>
 #include <inttypes.h>
+#include <limits.h>
 #include <signal.h>
 #include <stdlib.h>
 #include <sys/stat.h>
@@ -176,8 +178,37 @@ static void migrate_do_preamble(int send_fd, int recv_fd, pid_t child,
 
 }
 
+/* Parses "FD[,FD...]" as given to --stripe-fds. */
+static void parse_stripe_fds(const char *arg, int **fds_r, int *num_r)
+{
+    const char *p = arg;
+    char *ep;
+    long fd;
+    int num = 0, *fds = NULL;
+
+    for (;;) {
+        errno = 0;
+        fd = strtol(p, &ep, 10);
+        if (errno || ep == p || fd <= 2 || fd > INT_MAX ||
+            (*ep && *ep != ',')) {
+            fprintf(stderr, "Invalid --stripe-fds '%s': expected a comma"
+                    " separated list of fds above 2\n", arg);
+            exit(EXIT_FAILURE);
+        }
+        fds = xrealloc(fds, (num + 1) * sizeof(*fds));
+        fds[num++] = fd;
+        if (!*ep)
+            break;
+        p = ep + 1;
+    }
+
+    *fds_r = fds;
+    *num_r = num;
+}
+
 static void migrate_domain(uint32_t domid, int preserve_domid,
-                           const char *rune, int debug,
+                           const char *rune, int debug, int compress,
+                           const int *stripe_fds, int num_stripe_fds,
                            const char *override_config_file)
 {
     pid_t child = -1;
@@ -206,7 +237,14 @@ static void migrate_domain(uint32_t domid, int preserve_domid,
 
     if (debug)
         flags |= LIBXL_SUSPEND_DEBUG;
-    rc = libxl_domain_suspend(ctx, domid, send_fd, flags, NULL);
+    if (compress)
+        flags |= LIBXL_SUSPEND_COMPRESS;
+    if (num_stripe_fds)
+        rc = libxl_domain_suspend_striped(ctx, domid, send_fd,
+                                          stripe_fds, num_stripe_fds,
+                                          flags, NULL);
+    else
+        rc = libxl_domain_suspend(ctx, domid, send_fd, flags, NULL);
     if (rc) {
         fprintf(stderr, "migration sender: libxl_domain_suspend failed"
                 " (rc=%d)\n", rc);
@@ -321,7 +359,8 @@ static void migrate_receive(int debug, int daemonize, int monitor,
                             int send_fd, int recv_fd,
                             libxl_checkpointed_stream checkpointed,
                             char *colo_proxy_script,
-                            bool userspace_colo_proxy)
+                            bool userspace_colo_proxy,
+                            const int *stripe_fds, int num_stripe_fds)
 {
     uint32_t domid;
     int rc, rc2;
@@ -350,6 +389,8 @@ static void migrate_receive(int debug, int daemonize, int monitor,
     dom_info.checkpointed_stream = checkpointed;
     dom_info.colo_proxy_script = colo_proxy_script;
     dom_info.userspace_colo_proxy = userspace_colo_proxy;
+    dom_info.stripe_fds = stripe_fds;
+    dom_info.num_stripe_fds = num_stripe_fds;
 
     rc = create_domain(&dom_info);
     if (rc < 0) {
@@ -480,7 +521,7 @@ int main_migrate_receive(int argc, char **argv)
 {
     int debug = 0, daemonize = 1, monitor = 1, pause_after_migration = 0;
     libxl_checkpointed_stream checkpointed = LIBXL_CHECKPOINTED_STREAM_NONE;
-    int opt;
+    int opt, num_stripe_fds = 0, *stripe_fds = NULL;
     bool userspace_colo_proxy = false;
     char *script = NULL;
     static struct option opts[] = {
@@ -488,6 +529,7 @@ int main_migrate_receive(int argc, char **argv)
         /* It is a shame that the management code for disk is not here. */
         {"coloft-script", 1, 0, 0x200},
         {"userspace-colo-proxy", 0, 0, 0x300},
+        {"stripe-fds", 1, 0, 0x400},
         COMMON_LONG_OPTS
     };
 
@@ -514,6 +556,9 @@ int main_migrate_receive(int argc, char **argv)
     case 0x300:
         userspace_colo_proxy = true;
         break;
+    case 0x400:
+        parse_stripe_fds(optarg, &stripe_fds, &num_stripe_fds);
+        break;
     case 'p':
         pause_after_migration = 1;
         break;
@@ -523,9 +568,14 @@ int main_migrate_receive(int argc, char **argv)
         help("migrate-receive");
         return EXIT_FAILURE;
     }
+    if (num_stripe_fds && checkpointed != LIBXL_CHECKPOINTED_STREAM_NONE) {
+        fprintf(stderr, "--stripe-fds can't be used with Remus or COLO\n");
+        return EXIT_FAILURE;
+    }
     migrate_receive(debug, daemonize, monitor, pause_after_migration,
                     STDOUT_FILENO, STDIN_FILENO,
-                    checkpointed, script, userspace_colo_proxy);
+                    checkpointed, script, userspace_colo_proxy,
+                    stripe_fds, num_stripe_fds);
 
     return EXIT_SUCCESS;
 }
@@ -538,10 +588,13 @@ int main_migrate(int argc, char **argv)
     char *rune = NULL;
     char *host;
     int opt, daemonize = 1, monitor = 1, debug = 0, pause_after_migration = 0;
-    int preserve_domid = 0;
+    int preserve_domid = 0, compress = 0;
+    int num_stripe_fds = 0, *stripe_fds = NULL;
     static struct option opts[] = {
         {"debug", 0, 0, 0x100},
         {"live", 0, 0, 0x200},
+        {"compress", 0, 0, 0x300},
+        {"stripe-fds", 1, 0, 0x400},
         COMMON_LONG_OPTS
     };
 
@@ -571,6 +624,12 @@ int main_migrate(int argc, char **argv)
     case 0x200: /* --live */
         /* ignored for compatibility with xm */
         break;
+    case 0x300: /* --compress */
+        compress = 1;
+        break;
+    case 0x400: /* --stripe-fds */
+        parse_stripe_fds(optarg, &stripe_fds, &num_stripe_fds);
+        break;
     }
 
     domid = find_domain(argv[optind]);
@@ -602,7 +661,8 @@ int main_migrate(int argc, char **argv)
                   pause_after_migration ? " -p" : "");
     }
 
-    migrate_domain(domid, preserve_domid, rune, debug, config_filename);
+    migrate_domain(domid, preserve_domid, rune, debug, compress,
+                   stripe_fds, num_stripe_fds, config_filename);
     return EXIT_SUCCESS;
 }
 
@@ -925,6 +925,13 @@ start:
         params.colo_proxy_script = dom_info->colo_proxy_script;
         libxl_defbool_set(&params.userspace_colo_proxy,
                           dom_info->userspace_colo_proxy);
+        if (dom_info->num_stripe_fds) {
+            params.num_stripe_fds = dom_info->num_stripe_fds;
+            params.stripe_fds = xmalloc(params.num_stripe_fds *
+                                        sizeof(*params.stripe_fds));
+            memcpy(params.stripe_fds, dom_info->stripe_fds,
+                   params.num_stripe_fds * sizeof(*params.stripe_fds));
+        }
 
         ret = libxl_domain_create_restore(ctx, &d_config,
                                           &domid, restore_fd,
@@ -0,0 +1 @@
+cmd_arch/x86/alternative.init.o :=     objdump -h arch/x86/alternative.o | while read idx name sz rest; do case "$$name" in .*.local) ;; .text|.text.*|.data|.data.*|.bss|.bss.*) test $$(echo $$sz | sed 's,00*,0,') != 0 || continue; echo "Error: size of arch/x86/alternative.o:$$name is 0x$$sz" >&2; exit $$(expr $$idx + 1);; esac; done || exit $$?; objcopy --rename-section .rodata=.init.rodata --rename-section .rodata.str1.1=.init.rodata.str1.1 --rename-section .rodata.str2.1=.init.rodata.str2.1 --rename-section .rodata.str4.1=.init.rodata.str4.1 --rename-section .rodata.cst1=.init.rodata.cst1 --rename-section .rodata.str1.2=.init.rodata.str1.2 --rename-section .rodata.str2.2=.init.rodata.str2.2 --rename-section .rodata.str4.2=.init.rodata.str4.2 --rename-section .rodata.cst2=.init.rodata.cst2 --rename-section .rodata.str1.4=.init.rodata.str1.4 --rename-section .rodata.str2.4=.init.rodata.str2.4 --rename-section .rodata.str4.4=.init.rodata.str4.4 --rename-section .rodata.cst4=.init.rodata.cst4 --rename-section .rodata.str1.8=.init.rodata.str1.8 --rename-section .rodata.str2.8=.init.rodata.str2.8 --rename-section .rodata.str4.8=.init.rodata.str4.8 --rename-section .rodata.cst8=.init.rodata.cst8 --rename-section .rodata.str1.16=.init.rodata.str1.16 --rename-section .rodata.str2.16=.init.rodata.str2.16 --rename-section .rodata.str4.16=.init.rodata.str4.16 --rename-section .rodata.cst16=.init.rodata.cst16 --rename-section .data.rel.local=.init.data.rel.local --rename-section .data.rel.ro.local=.init.data.rel.ro.local arch/x86/alternative.o arch/x86/alternative.init.o
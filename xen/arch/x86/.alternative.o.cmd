@@ -0,0 +1,252 @@
+cmd_arch/x86/alternative.o := gcc -MMD -MP -MF arch/x86/.alternative.o.d -m64 -DBUILD_ID -fno-strict-aliasing -std=gnu99 -Wall -Wstrict-prototypes -Wno-unused-but-set-variable -Wno-unused-local-typedefs   -O1 -fno-omit-frame-pointer -nostdinc -fno-builtin -fno-common -Werror -Wredundant-decls -Wwrite-strings -Wno-pointer-arith -Wdeclaration-after-statement -Wuninitialized -Wvla -Winit-self -pipe -D__XEN__ -include ./include/xen/config.h -Wa,--strip-local-absolute -g  -I./include -I./arch/x86/include -I./arch/x86/include/generated -I./arch/x86/include/asm/mach-generic -I./arch/x86/include/asm/mach-default -DXEN_IMG_OFFSET=0x200000 -msoft-float -fno-pie -fno-stack-protector -fno-exceptions -fno-asynchronous-unwind-tables -Wnested-externs -DHAVE_AS_VMX -DHAVE_AS_SSE4_2 -DHAVE_AS_EPT -DHAVE_AS_RDRAND -DHAVE_AS_FSGSBASE -DHAVE_AS_XSAVEOPT -DHAVE_AS_RDSEED -DHAVE_AS_CLAC_STAC -DHAVE_AS_CLWB -DHAVE_AS_QUOTED_SYM -DHAVE_AS_INVPCID -DHAVE_AS_MOVDIR -DHAVE_AS_ENQCMD -DHAVE_AS_NOPS_DIRECTIVE -mno-red-zone -fpic -mno-mmx -mno-sse -mskip-rax-setup -fcf-protection=none -Wa,-I./include -Wa,-I./include '-D__OBJECT_LABEL__=arch/x86/alternative.o' -mpreferred-stack-boundary=3  -DXEN_BUILD_EFI -DBUILD_ID_EFI -DINIT_SECTIONS_ONLY -c arch/x86/alternative.c -o arch/x86/alternative.o
+
+source_arch/x86/alternative.o := arch/x86/alternative.c
+
+deps_arch/x86/alternative.o := \
+    $(wildcard include/config/xen/ibt.h) \
+    $(wildcard include/config/livepatch.h) \
+  include/xen/config.h \
+    $(wildcard include/config/enforce/unique/symbols.h) \
+    $(wildcard include/config/nr/cpus.h) \
+    $(wildcard include/config/debug.h) \
+  include/xen/kconfig.h \
+    $(wildcard include/config/booger.h) \
+    $(wildcard include/config/foo.h) \
+  include/xen/compiler.h \
+    $(wildcard include/config/cc/is/gcc.h) \
+    $(wildcard include/config/arm/32.h) \
+    $(wildcard include/config/gcc/version.h) \
+    $(wildcard include/config/arm/64.h) \
+    $(wildcard include/config/cc/is/clang.h) \
+    $(wildcard include/config/clang/version.h) \
+    $(wildcard include/config/cc/has/visibility/attribute.h) \
+  include/xen/init.h \
+    $(wildcard include/config/late/hwdom.h) \
+  arch/x86/include/asm/config.h \
+    $(wildcard include/config/paging/levels.h) \
+    $(wildcard include/config/have/efficient/unaligned/access.h) \
+    $(wildcard include/config/numa/emu.h) \
+    $(wildcard include/config/pagealloc/max/order.h) \
+    $(wildcard include/config/domu/max/order.h) \
+    $(wildcard include/config/hwdom/max/order.h) \
+    $(wildcard include/config/x86/l1/cache/shift.h) \
+    $(wildcard include/config/acpi/cstate.h) \
+    $(wildcard include/config/watchdog.h) \
+    $(wildcard include/config/multiboot.h) \
+    $(wildcard include/config/function/alignment.h) \
+    $(wildcard include/config/pv32.h) \
+    $(wildcard include/config/bigmem.h) \
+  include/xen/const.h \
+  include/xen/delay.h \
+  include/xen/types.h \
+  include/xen/stdbool.h \
+  include/xen/stdint.h \
+  arch/x86/include/asm/types.h \
+  arch/x86/include/asm/apic.h \
+  arch/x86/include/asm/apicdef.h \
+  arch/x86/include/asm/fixmap.h \
+    $(wildcard include/config/xhci.h) \
+    $(wildcard include/config/xen/guest.h) \
+    $(wildcard include/config/hyperv/guest.h) \
+  include/xen/page-size.h \
+  arch/x86/include/asm/page-bits.h \
+  include/xen/acpi.h \
+    $(wildcard include/config/acpi.h) \
+    $(wildcard include/config/acpi/hotplug/cpu.h) \
+    $(wildcard include/config/intel/iommu.h) \
+  include/xen/errno.h \
+  include/public/errno.h \
+  include/xen/list.h \
+  include/xen/bug.h \
+    $(wildcard include/config/generic/bug/frame.h) \
+  arch/x86/include/asm/bug.h \
+  include/xen/macros.h \
+  arch/x86/include/asm/system.h \
+  include/xen/bitops.h \
+  arch/x86/include/asm/bitops.h \
+  arch/x86/include/asm/alternative.h \
+  include/xen/lib.h \
+    $(wildcard include/config/debug/trace.h) \
+  include/xen/inttypes.h \
+  include/xen/stdarg.h \
+  include/xen/xmalloc.h \
+  include/xen/cache.h \
+  arch/x86/include/asm/cache.h \
+  include/xen/string.h \
+  arch/x86/include/asm/string.h \
+  include/xen/sections.h \
+  include/xen/stringify.h \
+  arch/x86/include/asm/asm-macros.h \
+    $(wildcard include/config/indirect/thunk.h) \
+  arch/x86/include/asm/asm_defns.h \
+    $(wildcard include/config/frame/pointer.h) \
+  arch/x86/include/asm/asm-offsets.h \
+  arch/x86/include/asm/x86-defns.h \
+  arch/x86/include/asm/cpufeature.h \
+    $(wildcard include/config/require/nx.h) \
+    $(wildcard include/config/xen/shstk.h) \
+  arch/x86/include/asm/cpuid.h \
+  arch/x86/include/asm/cpufeatureset.h \
+  include/public/arch-x86/cpufeatureset.h \
+  arch/x86/include/asm/cpufeatures.h \
+  include/xen/lib/x86/cpuid-autogen.h \
+  include/xen/kernel.h \
+  include/xen/percpu.h \
+  arch/x86/include/generated/asm/percpu.h \
+  include/asm-generic/percpu.h \
+  arch/x86/include/asm/current.h \
+  include/public/xen.h \
+  include/public/xen-compat.h \
+  include/public/arch-x86/xen.h \
+  include/public/arch-x86/xen-x86_64.h \
+  include/public/sysctl.h \
+  include/public/xen.h \
+  include/public/domctl.h \
+  include/public/event_channel.h \
+  include/public/grant_table.h \
+  include/public/hvm/save.h \
+  include/public/hvm/../arch-x86/hvm/save.h \
+  include/public/hvm/../arch-x86/hvm/../../xen.h \
+  include/public/memory.h \
+  include/public/physdev.h \
+  arch/x86/include/asm/x86_64/system.h \
+  include/acpi/acpi.h \
+  include/acpi/acnames.h \
+  include/acpi/acconfig.h \
+  include/acpi/platform/acenv.h \
+  include/acpi/platform/aclinux.h \
+  include/xen/ctype.h \
+  include/xen/spinlock.h \
+    $(wildcard include/config/debug/locks.h) \
+    $(wildcard include/config/debug/lock/profile.h) \
+  include/xen/nospec.h \
+    $(wildcard include/config/speculative/harden/array.h) \
+    $(wildcard include/config/speculative/harden/lock.h) \
+  arch/x86/include/asm/nospec.h \
+    $(wildcard include/config/speculative/harden/branch.h) \
+  include/xen/time.h \
+  arch/x86/include/asm/time.h \
+  arch/x86/include/asm/msr.h \
+  arch/x86/include/asm/msr-index.h \
+  include/xen/lib/x86/cpu-policy.h \
+  arch/x86/include/asm/processor.h \
+    $(wildcard include/config/pv.h) \
+    $(wildcard include/config/intel.h) \
+  include/xen/smp.h \
+  arch/x86/include/asm/smp.h \
+  include/xen/cpumask.h \
+    $(wildcard include/config/hotplug/cpu.h) \
+    $(wildcard include/config/smp.h) \
+  include/xen/bitmap.h \
+  arch/x86/include/asm/byteorder.h \
+  include/xen/byteorder/little_endian.h \
+  include/xen/byteorder/swab.h \
+  include/xen/byteorder/generic.h \
+  include/xen/random.h \
+  arch/x86/include/asm/mpspec.h \
+  arch/x86/include/asm/mpspec_def.h \
+  arch/x86/include/asm/mach-default/mach_mpspec.h \
+  arch/x86/include/asm/desc.h \
+  arch/x86/include/asm/page.h \
+  arch/x86/include/asm/x86_64/page.h \
+  include/xen/pdx.h \
+    $(wildcard include/config/pdx/compression.h) \
+  arch/x86/include/asm/x86-vendors.h \
+  arch/x86/include/asm/spinlock.h \
+  arch/x86/include/asm/atomic.h \
+  include/xen/atomic.h \
+  arch/x86/include/generated/asm/div64.h \
+  include/asm-generic/div64.h \
+  arch/x86/include/asm/acpi.h \
+    $(wildcard include/config/amd/iommu.h) \
+  include/acpi/pdc_intel.h \
+  include/acpi/acconfig.h \
+  include/acpi/actbl.h \
+  include/acpi/actbl1.h \
+  include/acpi/actbl2.h \
+  include/acpi/actbl3.h \
+  include/acpi/platform/acgcc.h \
+  include/acpi/actypes.h \
+  include/acpi/acexcep.h \
+  include/acpi/acmacros.h \
+    $(wildcard include/config/acpi/debug/func/trace.h) \
+  include/acpi/actbl.h \
+  include/acpi/aclocal.h \
+  include/acpi/acoutput.h \
+  include/acpi/acpiosxf.h \
+  include/acpi/acpixf.h \
+  include/acpi/acglobal.h \
+  include/acpi/achware.h \
+  include/acpi/acutils.h \
+  include/xen/pfn.h \
+  arch/x86/include/asm/msi.h \
+  include/xen/pci.h \
+    $(wildcard include/config/has/pci.h) \
+    $(wildcard include/config/hvm.h) \
+  include/xen/irq.h \
+    $(wildcard include/config/irq/has/multiple/action.h) \
+    $(wildcard include/config/x86.h) \
+  include/xen/rcupdate.h \
+  include/xen/preempt.h \
+  arch/x86/include/asm/regs.h \
+  arch/x86/include/asm/x86_64/regs.h \
+  arch/x86/include/asm/hardirq.h \
+  include/xen/irq_cpustat.h \
+  include/public/event_channel.h \
+  arch/x86/include/asm/irq.h \
+  arch/x86/include/asm/numa.h \
+  arch/x86/include/asm/hvm/irq.h \
+  include/xen/timer.h \
+  arch/x86/include/asm/hvm/hvm.h \
+    $(wildcard include/config/hvm/fep.h) \
+    $(wildcard include/config/intel/vmx.h) \
+    $(wildcard include/config/amd/svm.h) \
+    $(wildcard include/config/altp2m.h) \
+  include/xen/mm.h \
+    $(wildcard include/config/mem/sharing.h) \
+  include/xen/mm-frame.h \
+  include/xen/typesafe.h \
+  include/xen/perfc.h \
+    $(wildcard include/config/perf/counters.h) \
+    $(wildcard include/config/perf/arrays.h) \
+  include/public/memory.h \
+  arch/x86/include/asm/mm.h \
+    $(wildcard include/config/shadow/paging.h) \
+  include/xen/rwlock.h \
+  arch/x86/include/asm/io.h \
+  include/xen/vmap.h \
+    $(wildcard include/config/has/vmap.h) \
+  arch/x86/include/asm/uaccess.h \
+  include/xen/prefetch.h \
+  arch/x86/include/asm/x86_64/uaccess.h \
+    $(wildcard include/config/speculative/harden/guest/access.h) \
+  arch/x86/include/asm/x86_emulate.h \
+  arch/x86/include/asm/../../x86_emulate/x86_emulate.h \
+  arch/x86/include/asm/flushtlb.h \
+  arch/x86/include/asm/hvm/asid.h \
+  arch/x86/include/asm/hvm/vpic.h \
+  arch/x86/include/asm/hvm/vioapic.h \
+  include/public/hvm/save.h \
+  include/xen/numa.h \
+    $(wildcard include/config/numa.h) \
+    $(wildcard include/config/nr/numa/nodes.h) \
+  include/xen/pci_regs.h \
+  arch/x86/include/asm/device.h \
+  arch/x86/include/asm/pci.h \
+  arch/x86/include/asm/hvm/vmx/vmcs.h \
+  include/acpi/apei.h \
+  include/xen/cper.h \
+  arch/x86/include/asm/endbr.h \
+  arch/x86/include/asm/setup.h \
+  include/xen/multiboot.h \
+  include/xen/const.h \
+  arch/x86/include/asm/traps.h \
+  arch/x86/include/asm/nmi.h \
+  include/public/nmi.h \
+  arch/x86/include/asm/nops.h \
+  include/xen/livepatch.h \
+  include/xen/elfstructs.h \
+
+arch/x86/alternative.o: $(deps_arch/x86/alternative.o)
+
+$(deps_arch/x86/alternative.o):
@@ -0,0 +1,42 @@
+cmd_arch/x86/asm-macros.i := gcc -E -MMD -MP -MF arch/x86/.asm-macros.i.d -D__ASSEMBLY__ -m64 -DBUILD_ID -fno-strict-aliasing -Wall -Wstrict-prototypes -Wno-unused-but-set-variable -Wno-unused-local-typedefs -O1 -fno-omit-frame-pointer -nostdinc -fno-builtin -fno-common -Werror -Wredundant-decls -Wwrite-strings -Wno-pointer-arith -Wdeclaration-after-statement -Wuninitialized -Wvla -Winit-self -pipe -D__XEN__ -include ./include/xen/config.h -g -I./include -I./arch/x86/include -I./arch/x86/include/generated -I./arch/x86/include/asm/mach-generic -I./arch/x86/include/asm/mach-default -DXEN_IMG_OFFSET=0x200000 -msoft-float -fno-pie -fno-stack-protector -fno-exceptions -fno-asynchronous-unwind-tables -Wnested-externs -DHAVE_AS_VMX -DHAVE_AS_SSE4_2 -DHAVE_AS_EPT -DHAVE_AS_RDRAND -DHAVE_AS_FSGSBASE -DHAVE_AS_XSAVEOPT -DHAVE_AS_RDSEED -DHAVE_AS_CLAC_STAC -DHAVE_AS_CLWB -DHAVE_AS_QUOTED_SYM -DHAVE_AS_INVPCID -DHAVE_AS_MOVDIR -DHAVE_AS_ENQCMD -DHAVE_AS_NOPS_DIRECTIVE -mno-red-zone -fpic -mno-mmx -mno-sse -mskip-rax-setup -fcf-protection=none -DHAVE_LD_SORT_BY_INIT_PRIORITY '-D__OBJECT_LABEL__=arch/x86/asm-macros.i' -mpreferred-stack-boundary=3 -DXEN_BUILD_EFI -DBUILD_ID_EFI -P -MQ arch/x86/asm-macros.i -o arch/x86/asm-macros.i arch/x86/asm-macros.S
+
+source_arch/x86/asm-macros.i := arch/x86/asm-macros.S
+
+deps_arch/x86/asm-macros.i := \
+  include/xen/config.h \
+    $(wildcard include/config/enforce/unique/symbols.h) \
+    $(wildcard include/config/nr/cpus.h) \
+    $(wildcard include/config/debug.h) \
+  include/xen/kconfig.h \
+    $(wildcard include/config/booger.h) \
+    $(wildcard include/config/foo.h) \
+  arch/x86/include/asm/config.h \
+    $(wildcard include/config/paging/levels.h) \
+    $(wildcard include/config/have/efficient/unaligned/access.h) \
+    $(wildcard include/config/numa/emu.h) \
+    $(wildcard include/config/pagealloc/max/order.h) \
+    $(wildcard include/config/domu/max/order.h) \
+    $(wildcard include/config/hwdom/max/order.h) \
+    $(wildcard include/config/x86/l1/cache/shift.h) \
+    $(wildcard include/config/acpi/cstate.h) \
+    $(wildcard include/config/watchdog.h) \
+    $(wildcard include/config/multiboot.h) \
+    $(wildcard include/config/function/alignment.h) \
+    $(wildcard include/config/pv32.h) \
+    $(wildcard include/config/bigmem.h) \
+  include/xen/const.h \
+  arch/x86/include/asm/asm-defns.h \
+    $(wildcard include/config/indirect/thunk.h) \
+    $(wildcard include/config/xen/ibt.h) \
+    $(wildcard include/config/speculative/harden/guest/access.h) \
+    $(wildcard include/config/pv.h) \
+  arch/x86/include/asm/alternative-asm.h \
+  arch/x86/include/asm/nops.h \
+  arch/x86/include/asm/spec_ctrl_asm.h \
+    $(wildcard include/config/xen/shstk.h) \
+  arch/x86/include/asm/msr-index.h \
+  arch/x86/include/asm/spec_ctrl.h \
+
+arch/x86/asm-macros.i: $(deps_arch/x86/asm-macros.i)
+
+$(deps_arch/x86/asm-macros.i):
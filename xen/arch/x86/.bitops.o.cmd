@@ -0,0 +1,98 @@
+cmd_arch/x86/bitops.o := gcc -MMD -MP -MF arch/x86/.bitops.o.d -m64 -DBUILD_ID -fno-strict-aliasing -std=gnu99 -Wall -Wstrict-prototypes -Wno-unused-but-set-variable -Wno-unused-local-typedefs   -O1 -fno-omit-frame-pointer -nostdinc -fno-builtin -fno-common -Werror -Wredundant-decls -Wwrite-strings -Wno-pointer-arith -Wdeclaration-after-statement -Wuninitialized -Wvla -Winit-self -pipe -D__XEN__ -include ./include/xen/config.h -Wa,--strip-local-absolute -g  -I./include -I./arch/x86/include -I./arch/x86/include/generated -I./arch/x86/include/asm/mach-generic -I./arch/x86/include/asm/mach-default -DXEN_IMG_OFFSET=0x200000 -msoft-float -fno-pie -fno-stack-protector -fno-exceptions -fno-asynchronous-unwind-tables -Wnested-externs -DHAVE_AS_VMX -DHAVE_AS_SSE4_2 -DHAVE_AS_EPT -DHAVE_AS_RDRAND -DHAVE_AS_FSGSBASE -DHAVE_AS_XSAVEOPT -DHAVE_AS_RDSEED -DHAVE_AS_CLAC_STAC -DHAVE_AS_CLWB -DHAVE_AS_QUOTED_SYM -DHAVE_AS_INVPCID -DHAVE_AS_MOVDIR -DHAVE_AS_ENQCMD -DHAVE_AS_NOPS_DIRECTIVE -mno-red-zone -fpic -mno-mmx -mno-sse -mskip-rax-setup -fcf-protection=none -Wa,-I./include -Wa,-I./include '-D__OBJECT_LABEL__=arch/x86/bitops.o' -mpreferred-stack-boundary=3  -DXEN_BUILD_EFI -DBUILD_ID_EFI -c arch/x86/bitops.c -o arch/x86/bitops.o
+
+source_arch/x86/bitops.o := arch/x86/bitops.c
+
+deps_arch/x86/bitops.o := \
+  include/xen/config.h \
+    $(wildcard include/config/enforce/unique/symbols.h) \
+    $(wildcard include/config/nr/cpus.h) \
+    $(wildcard include/config/debug.h) \
+  include/xen/kconfig.h \
+    $(wildcard include/config/booger.h) \
+    $(wildcard include/config/foo.h) \
+  include/xen/compiler.h \
+    $(wildcard include/config/cc/is/gcc.h) \
+    $(wildcard include/config/arm/32.h) \
+    $(wildcard include/config/gcc/version.h) \
+    $(wildcard include/config/arm/64.h) \
+    $(wildcard include/config/cc/is/clang.h) \
+    $(wildcard include/config/clang/version.h) \
+    $(wildcard include/config/xen/ibt.h) \
+    $(wildcard include/config/cc/has/visibility/attribute.h) \
+  arch/x86/include/asm/config.h \
+    $(wildcard include/config/paging/levels.h) \
+    $(wildcard include/config/have/efficient/unaligned/access.h) \
+    $(wildcard include/config/numa/emu.h) \
+    $(wildcard include/config/pagealloc/max/order.h) \
+    $(wildcard include/config/domu/max/order.h) \
+    $(wildcard include/config/hwdom/max/order.h) \
+    $(wildcard include/config/x86/l1/cache/shift.h) \
+    $(wildcard include/config/acpi/cstate.h) \
+    $(wildcard include/config/watchdog.h) \
+    $(wildcard include/config/multiboot.h) \
+    $(wildcard include/config/function/alignment.h) \
+    $(wildcard include/config/pv32.h) \
+    $(wildcard include/config/bigmem.h) \
+  include/xen/const.h \
+  include/xen/bitops.h \
+  include/xen/types.h \
+  include/xen/stdbool.h \
+  include/xen/stdint.h \
+  arch/x86/include/asm/types.h \
+  arch/x86/include/asm/bitops.h \
+  arch/x86/include/asm/alternative.h \
+  include/xen/lib.h \
+    $(wildcard include/config/debug/trace.h) \
+  include/xen/macros.h \
+  include/xen/inttypes.h \
+  include/xen/stdarg.h \
+  include/xen/xmalloc.h \
+  include/xen/cache.h \
+  arch/x86/include/asm/cache.h \
+  include/xen/string.h \
+  arch/x86/include/asm/string.h \
+  include/xen/sections.h \
+  include/xen/stringify.h \
+  arch/x86/include/asm/asm-macros.h \
+    $(wildcard include/config/indirect/thunk.h) \
+  arch/x86/include/asm/asm_defns.h \
+    $(wildcard include/config/frame/pointer.h) \
+  arch/x86/include/asm/asm-offsets.h \
+  arch/x86/include/asm/x86-defns.h \
+  include/xen/bug.h \
+    $(wildcard include/config/generic/bug/frame.h) \
+  arch/x86/include/asm/bug.h \
+  arch/x86/include/asm/cpufeature.h \
+    $(wildcard include/config/require/nx.h) \
+    $(wildcard include/config/xen/shstk.h) \
+  arch/x86/include/asm/cpuid.h \
+  arch/x86/include/asm/cpufeatureset.h \
+  include/public/arch-x86/cpufeatureset.h \
+  arch/x86/include/asm/cpufeatures.h \
+  include/xen/lib/x86/cpuid-autogen.h \
+  include/xen/kernel.h \
+  include/xen/percpu.h \
+  arch/x86/include/generated/asm/percpu.h \
+  include/asm-generic/percpu.h \
+  arch/x86/include/asm/current.h \
+    $(wildcard include/config/livepatch.h) \
+  include/xen/page-size.h \
+  arch/x86/include/asm/page-bits.h \
+  include/public/xen.h \
+  include/public/xen-compat.h \
+  include/public/arch-x86/xen.h \
+  include/public/arch-x86/xen-x86_64.h \
+  include/public/sysctl.h \
+  include/public/xen.h \
+  include/public/domctl.h \
+  include/public/event_channel.h \
+  include/public/grant_table.h \
+  include/public/hvm/save.h \
+  include/public/hvm/../arch-x86/hvm/save.h \
+  include/public/hvm/../arch-x86/hvm/../../xen.h \
+  include/public/memory.h \
+  include/public/physdev.h \
+
+arch/x86/bitops.o: $(deps_arch/x86/bitops.o)
+
+$(deps_arch/x86/bitops.o):
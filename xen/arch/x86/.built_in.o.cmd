@@ -0,0 +1 @@
+cmd_arch/x86/built_in.o := ld    -melf_x86_64 --no-warn-rwx-segments -r -o arch/x86/built_in.o arch/x86/acpi/built_in.o arch/x86/boot/built_in.o arch/x86/cpu/built_in.o arch/x86/efi/built_in.o arch/x86/genapic/built_in.o arch/x86/hvm/built_in.o arch/x86/mm/built_in.o arch/x86/pv/built_in.o arch/x86/x86_64/built_in.o arch/x86/x86_emulate/built_in.o arch/x86/apic.o arch/x86/bhb-thunk.o arch/x86/bitops.o arch/x86/cpu-policy.o arch/x86/cpuid.o arch/x86/compat.o arch/x86/crash.o arch/x86/debug.o arch/x86/delay.o arch/x86/desc.o arch/x86/domain.o arch/x86/domain_page.o arch/x86/e820.o arch/x86/emul-i8254.o arch/x86/extable.o arch/x86/flushtlb.o arch/x86/gdbsx.o arch/x86/hypercall.o arch/x86/i387.o arch/x86/i8259.o arch/x86/io_apic.o arch/x86/msi.o arch/x86/msr.o arch/x86/ioport_emulate.o arch/x86/irq.o arch/x86/machine_kexec.o arch/x86/mm.o arch/x86/x86_64/mm.o arch/x86/monitor.o arch/x86/mpparse.o arch/x86/nmi.o arch/x86/numa.o arch/x86/pci.o arch/x86/percpu.o arch/x86/physdev.o arch/x86/x86_64/physdev.o arch/x86/psr.o arch/x86/setup.o arch/x86/shutdown.o arch/x86/smp.o arch/x86/smpboot.o arch/x86/spec_ctrl.o arch/x86/srat.o arch/x86/string.o arch/x86/time.o arch/x86/traps.o arch/x86/tsx.o arch/x86/usercopy.o arch/x86/x86_emulate.o arch/x86/hpet.o arch/x86/vm_event.o arch/x86/xstate.o arch/x86/domctl.o arch/x86/platform_hypercall.o arch/x86/x86_64/platform_hypercall.o arch/x86/sysctl.o arch/x86/alternative.init.o arch/x86/bzimage.init.o arch/x86/clear_page.o arch/x86/copy_page.o arch/x86/dmi_scan.init.o arch/x86/dom0_build.init.o
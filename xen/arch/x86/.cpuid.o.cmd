@@ -0,0 +1,272 @@
+cmd_arch/x86/cpuid.o := gcc -MMD -MP -MF arch/x86/.cpuid.o.d -m64 -DBUILD_ID -fno-strict-aliasing -std=gnu99 -Wall -Wstrict-prototypes -Wno-unused-but-set-variable -Wno-unused-local-typedefs   -O1 -fno-omit-frame-pointer -nostdinc -fno-builtin -fno-common -Werror -Wredundant-decls -Wwrite-strings -Wno-pointer-arith -Wdeclaration-after-statement -Wuninitialized -Wvla -Winit-self -pipe -D__XEN__ -include ./include/xen/config.h -Wa,--strip-local-absolute -g  -I./include -I./arch/x86/include -I./arch/x86/include/generated -I./arch/x86/include/asm/mach-generic -I./arch/x86/include/asm/mach-default -DXEN_IMG_OFFSET=0x200000 -msoft-float -fno-pie -fno-stack-protector -fno-exceptions -fno-asynchronous-unwind-tables -Wnested-externs -DHAVE_AS_VMX -DHAVE_AS_SSE4_2 -DHAVE_AS_EPT -DHAVE_AS_RDRAND -DHAVE_AS_FSGSBASE -DHAVE_AS_XSAVEOPT -DHAVE_AS_RDSEED -DHAVE_AS_CLAC_STAC -DHAVE_AS_CLWB -DHAVE_AS_QUOTED_SYM -DHAVE_AS_INVPCID -DHAVE_AS_MOVDIR -DHAVE_AS_ENQCMD -DHAVE_AS_NOPS_DIRECTIVE -mno-red-zone -fpic -mno-mmx -mno-sse -mskip-rax-setup -fcf-protection=none -Wa,-I./include -Wa,-I./include '-D__OBJECT_LABEL__=arch/x86/cpuid.o' -mpreferred-stack-boundary=3  -DXEN_BUILD_EFI -DBUILD_ID_EFI -c arch/x86/cpuid.c -o arch/x86/cpuid.o
+
+source_arch/x86/cpuid.o := arch/x86/cpuid.c
+
+deps_arch/x86/cpuid.o := \
+  include/xen/config.h \
+    $(wildcard include/config/enforce/unique/symbols.h) \
+    $(wildcard include/config/nr/cpus.h) \
+    $(wildcard include/config/debug.h) \
+  include/xen/kconfig.h \
+    $(wildcard include/config/booger.h) \
+    $(wildcard include/config/foo.h) \
+  include/xen/compiler.h \
+    $(wildcard include/config/cc/is/gcc.h) \
+    $(wildcard include/config/arm/32.h) \
+    $(wildcard include/config/gcc/version.h) \
+    $(wildcard include/config/arm/64.h) \
+    $(wildcard include/config/cc/is/clang.h) \
+    $(wildcard include/config/clang/version.h) \
+    $(wildcard include/config/xen/ibt.h) \
+    $(wildcard include/config/cc/has/visibility/attribute.h) \
+  arch/x86/include/asm/config.h \
+    $(wildcard include/config/paging/levels.h) \
+    $(wildcard include/config/have/efficient/unaligned/access.h) \
+    $(wildcard include/config/numa/emu.h) \
+    $(wildcard include/config/pagealloc/max/order.h) \
+    $(wildcard include/config/domu/max/order.h) \
+    $(wildcard include/config/hwdom/max/order.h) \
+    $(wildcard include/config/x86/l1/cache/shift.h) \
+    $(wildcard include/config/acpi/cstate.h) \
+    $(wildcard include/config/watchdog.h) \
+    $(wildcard include/config/multiboot.h) \
+    $(wildcard include/config/function/alignment.h) \
+    $(wildcard include/config/pv32.h) \
+    $(wildcard include/config/bigmem.h) \
+  include/xen/const.h \
+  include/xen/sched.h \
+    $(wildcard include/config/compat.h) \
+    $(wildcard include/config/perf/counters.h) \
+    $(wildcard include/config/late/hwdom.h) \
+    $(wildcard include/config/xsm.h) \
+    $(wildcard include/config/xsm/flask.h) \
+    $(wildcard include/config/x86.h) \
+    $(wildcard include/config/ioreq/server.h) \
+    $(wildcard include/config/static/memory.h) \
+    $(wildcard include/config/mem/sharing.h) \
+    $(wildcard include/config/mem/paging.h) \
+    $(wildcard include/config/has/pirq.h) \
+    $(wildcard include/config/has/pci.h) \
+    $(wildcard include/config/has/vpci/guest/support.h) \
+    $(wildcard include/config/has/passthrough.h) \
+    $(wildcard include/config/argo.h) \
+    $(wildcard include/config/pv/shim/exclusive.h) \
+    $(wildcard include/config/pv.h) \
+    $(wildcard include/config/hvm.h) \
+    $(wildcard include/config/boot/time/cpupools.h) \
+    $(wildcard include/config/has/device/tree.h) \
+  include/xen/types.h \
+  include/xen/stdbool.h \
+  include/xen/stdint.h \
+  arch/x86/include/asm/types.h \
+  include/xen/spinlock.h \
+    $(wildcard include/config/debug/locks.h) \
+    $(wildcard include/config/debug/lock/profile.h) \
+  include/xen/nospec.h \
+    $(wildcard include/config/speculative/harden/array.h) \
+    $(wildcard include/config/speculative/harden/lock.h) \
+  arch/x86/include/asm/nospec.h \
+    $(wildcard include/config/speculative/harden/branch.h) \
+  arch/x86/include/asm/alternative.h \
+  include/xen/lib.h \
+    $(wildcard include/config/debug/trace.h) \
+  include/xen/macros.h \
+  include/xen/inttypes.h \
+  include/xen/stdarg.h \
+  include/xen/xmalloc.h \
+  include/xen/cache.h \
+  arch/x86/include/asm/cache.h \
+  include/xen/string.h \
+  arch/x86/include/asm/string.h \
+  include/xen/sections.h \
+  include/xen/stringify.h \
+  arch/x86/include/asm/asm-macros.h \
+    $(wildcard include/config/indirect/thunk.h) \
+  include/xen/time.h \
+  include/public/xen.h \
+  include/public/xen-compat.h \
+  include/public/arch-x86/xen.h \
+  include/public/arch-x86/xen-x86_64.h \
+  arch/x86/include/asm/time.h \
+  arch/x86/include/asm/msr.h \
+  arch/x86/include/asm/msr-index.h \
+  include/xen/percpu.h \
+  arch/x86/include/generated/asm/percpu.h \
+  include/asm-generic/percpu.h \
+  arch/x86/include/asm/current.h \
+    $(wildcard include/config/livepatch.h) \
+    $(wildcard include/config/xen/shstk.h) \
+  include/xen/page-size.h \
+  arch/x86/include/asm/page-bits.h \
+  include/xen/errno.h \
+  include/public/errno.h \
+  include/xen/kernel.h \
+  include/xen/lib/x86/cpu-policy.h \
+  include/xen/lib/x86/cpuid-autogen.h \
+  arch/x86/include/asm/asm_defns.h \
+    $(wildcard include/config/frame/pointer.h) \
+  arch/x86/include/asm/asm-offsets.h \
+  arch/x86/include/asm/x86-defns.h \
+  include/xen/bug.h \
+    $(wildcard include/config/generic/bug/frame.h) \
+  arch/x86/include/asm/bug.h \
+  arch/x86/include/asm/cpufeature.h \
+    $(wildcard include/config/require/nx.h) \
+  arch/x86/include/asm/cpuid.h \
+  arch/x86/include/asm/cpufeatureset.h \
+  include/public/arch-x86/cpufeatureset.h \
+  arch/x86/include/asm/cpufeatures.h \
+  include/public/sysctl.h \
+  include/public/xen.h \
+  include/public/domctl.h \
+  include/public/event_channel.h \
+  include/public/grant_table.h \
+  include/public/hvm/save.h \
+  include/public/hvm/../arch-x86/hvm/save.h \
+  include/public/hvm/../arch-x86/hvm/../../xen.h \
+  include/public/memory.h \
+  include/public/physdev.h \
+  arch/x86/include/asm/processor.h \
+    $(wildcard include/config/intel.h) \
+  include/xen/smp.h \
+  arch/x86/include/asm/smp.h \
+  include/xen/bitops.h \
+  arch/x86/include/asm/bitops.h \
+  include/xen/cpumask.h \
+    $(wildcard include/config/hotplug/cpu.h) \
+    $(wildcard include/config/smp.h) \
+  include/xen/bitmap.h \
+  arch/x86/include/asm/byteorder.h \
+  include/xen/byteorder/little_endian.h \
+  include/xen/byteorder/swab.h \
+  include/xen/byteorder/generic.h \
+  include/xen/random.h \
+  arch/x86/include/asm/mpspec.h \
+    $(wildcard include/config/acpi.h) \
+  arch/x86/include/asm/mpspec_def.h \
+  arch/x86/include/asm/mach-default/mach_mpspec.h \
+  arch/x86/include/asm/desc.h \
+  arch/x86/include/asm/page.h \
+  arch/x86/include/asm/x86_64/page.h \
+  include/xen/pdx.h \
+    $(wildcard include/config/pdx/compression.h) \
+  arch/x86/include/asm/x86-vendors.h \
+  arch/x86/include/asm/system.h \
+  arch/x86/include/asm/x86_64/system.h \
+  arch/x86/include/asm/spinlock.h \
+  include/xen/rwlock.h \
+  include/xen/preempt.h \
+  arch/x86/include/asm/atomic.h \
+  include/xen/atomic.h \
+  include/xen/shared.h \
+  include/compat/xen.h \
+  include/xen/compat.h \
+    $(wildcard include/config/has/compat.h) \
+  arch/x86/include/asm/compat.h \
+  include/compat/xlat.h \
+  include/public/xen-compat.h \
+  include/compat/arch-x86/xen.h \
+  include/compat/arch-x86/xen-x86_32.h \
+  include/xen/timer.h \
+  include/xen/list.h \
+  include/xen/rangeset.h \
+  include/xen/domain.h \
+    $(wildcard include/config/arm.h) \
+  include/xen/numa.h \
+    $(wildcard include/config/numa.h) \
+    $(wildcard include/config/nr/numa/nodes.h) \
+  include/xen/mm-frame.h \
+  include/xen/typesafe.h \
+  arch/x86/include/asm/numa.h \
+  arch/x86/include/asm/domain.h \
+    $(wildcard include/config/shadow/paging.h) \
+  include/xen/mm.h \
+  include/xen/perfc.h \
+    $(wildcard include/config/perf/arrays.h) \
+  include/public/memory.h \
+  arch/x86/include/asm/mm.h \
+  arch/x86/include/asm/io.h \
+  include/xen/vmap.h \
+    $(wildcard include/config/has/vmap.h) \
+  arch/x86/include/asm/uaccess.h \
+  include/xen/prefetch.h \
+  arch/x86/include/asm/x86_64/uaccess.h \
+    $(wildcard include/config/speculative/harden/guest/access.h) \
+  arch/x86/include/asm/x86_emulate.h \
+  arch/x86/include/asm/regs.h \
+  arch/x86/include/asm/x86_64/regs.h \
+  arch/x86/include/asm/../../x86_emulate/x86_emulate.h \
+  arch/x86/include/asm/flushtlb.h \
+  include/xen/radix-tree.h \
+  include/xen/rcupdate.h \
+  arch/x86/include/asm/hvm/vcpu.h \
+  include/xen/tasklet.h \
+  arch/x86/include/asm/hvm/vlapic.h \
+  arch/x86/include/asm/hvm/vpt.h \
+  arch/x86/include/asm/hvm/vmx/vmcs.h \
+    $(wildcard include/config/intel/vmx.h) \
+  arch/x86/include/asm/hvm/vmx/vvmx.h \
+  arch/x86/include/asm/hvm/svm/vmcb.h \
+  arch/x86/include/asm/hvm/svm/nestedsvm.h \
+  arch/x86/include/asm/mtrr.h \
+  include/public/hvm/ioreq.h \
+  arch/x86/include/asm/hvm/domain.h \
+  arch/x86/include/asm/hvm/io.h \
+  include/xen/pci.h \
+  include/xen/irq.h \
+    $(wildcard include/config/irq/has/multiple/action.h) \
+  arch/x86/include/asm/hardirq.h \
+  include/xen/irq_cpustat.h \
+  include/public/event_channel.h \
+  arch/x86/include/asm/irq.h \
+  arch/x86/include/asm/hvm/irq.h \
+  arch/x86/include/asm/hvm/hvm.h \
+    $(wildcard include/config/hvm/fep.h) \
+    $(wildcard include/config/amd/svm.h) \
+    $(wildcard include/config/altp2m.h) \
+  arch/x86/include/asm/hvm/asid.h \
+  arch/x86/include/asm/hvm/vpic.h \
+  arch/x86/include/asm/hvm/vioapic.h \
+  include/public/hvm/save.h \
+  include/xen/pci_regs.h \
+  include/xen/pfn.h \
+  arch/x86/include/asm/device.h \
+  arch/x86/include/asm/pci.h \
+  arch/x86/include/asm/e820.h \
+  arch/x86/include/asm/mce.h \
+  arch/x86/include/asm/vpmu.h \
+  include/public/pmu.h \
+  include/public/arch-x86/pmu.h \
+  include/public/vcpu.h \
+  include/public/hvm/hvm_info_table.h \
+  include/xen/iommu.h \
+    $(wildcard include/config/intel/iommu.h) \
+    $(wildcard include/config/iommu/force/pt/share.h) \
+  include/xen/init.h \
+  include/xen/page-defs.h \
+  include/public/domctl.h \
+  arch/x86/include/asm/iommu.h \
+  include/xen/mem_access.h \
+    $(wildcard include/config/mem/access.h) \
+  arch/x86/include/asm/mem_access.h \
+  arch/x86/include/asm/apicdef.h \
+  include/xen/nodemask.h \
+  include/xen/multicall.h \
+  include/xen/vpci.h \
+    $(wildcard include/config/has/vpci.h) \
+  include/xen/wait.h \
+  include/compat/vcpu.h \
+  include/compat/xen.h \
+  include/public/hvm/params.h \
+  include/public/hvm/hvm_op.h \
+  include/public/hvm/../xen.h \
+  include/public/hvm/../trace.h \
+  include/public/hvm/../event_channel.h \
+  arch/x86/include/asm/cpu-policy.h \
+  arch/x86/include/asm/hvm/viridian.h \
+  arch/x86/include/asm/guest/hyperv-tlfs.h \
+  arch/x86/include/asm/xstate.h \
+
+arch/x86/cpuid.o: $(deps_arch/x86/cpuid.o)
+
+$(deps_arch/x86/cpuid.o):
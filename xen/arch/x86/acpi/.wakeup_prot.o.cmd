@@ -0,0 +1,70 @@
+cmd_arch/x86/acpi/wakeup_prot.o := gcc -MMD -MP -MF arch/x86/acpi/.wakeup_prot.o.d -D__ASSEMBLY__ -Wa,--noexecstack -m64 -DBUILD_ID -fno-strict-aliasing -Wall -Wstrict-prototypes -Wno-unused-but-set-variable -Wno-unused-local-typedefs -O1 -fno-omit-frame-pointer -nostdinc -fno-builtin -fno-common -Werror -Wredundant-decls -Wwrite-strings -Wno-pointer-arith -Wdeclaration-after-statement -Wuninitialized -Wvla -Winit-self -pipe -D__XEN__ -include ./include/xen/config.h -Wa,--strip-local-absolute -g -I./include -I./arch/x86/include -I./arch/x86/include/generated -I./arch/x86/include/asm/mach-generic -I./arch/x86/include/asm/mach-default -DXEN_IMG_OFFSET=0x200000 -msoft-float -fno-pie -fno-stack-protector -fno-exceptions -fno-asynchronous-unwind-tables -Wnested-externs -DHAVE_AS_VMX -DHAVE_AS_SSE4_2 -DHAVE_AS_EPT -DHAVE_AS_RDRAND -DHAVE_AS_FSGSBASE -DHAVE_AS_XSAVEOPT -DHAVE_AS_RDSEED -DHAVE_AS_CLAC_STAC -DHAVE_AS_CLWB -DHAVE_AS_QUOTED_SYM -DHAVE_AS_INVPCID -DHAVE_AS_MOVDIR -DHAVE_AS_ENQCMD -DHAVE_AS_NOPS_DIRECTIVE -mno-red-zone -fpic -mno-mmx -mno-sse -mskip-rax-setup -fcf-protection=none -Wa,-I./include -Wa,-I./include -DHAVE_LD_SORT_BY_INIT_PRIORITY '-D__OBJECT_LABEL__=arch/x86/acpi/wakeup_prot.o' -mpreferred-stack-boundary=3    -c arch/x86/acpi/wakeup_prot.S -o arch/x86/acpi/wakeup_prot.o
+
+source_arch/x86/acpi/wakeup_prot.o := arch/x86/acpi/wakeup_prot.S
+
+deps_arch/x86/acpi/wakeup_prot.o := \
+    $(wildcard include/config/xen/shstk.h) \
+    $(wildcard include/config/xen/ibt.h) \
+  include/xen/config.h \
+    $(wildcard include/config/enforce/unique/symbols.h) \
+    $(wildcard include/config/nr/cpus.h) \
+    $(wildcard include/config/debug.h) \
+  include/xen/kconfig.h \
+    $(wildcard include/config/booger.h) \
+    $(wildcard include/config/foo.h) \
+  arch/x86/include/asm/config.h \
+    $(wildcard include/config/paging/levels.h) \
+    $(wildcard include/config/have/efficient/unaligned/access.h) \
+    $(wildcard include/config/numa/emu.h) \
+    $(wildcard include/config/pagealloc/max/order.h) \
+    $(wildcard include/config/domu/max/order.h) \
+    $(wildcard include/config/hwdom/max/order.h) \
+    $(wildcard include/config/x86/l1/cache/shift.h) \
+    $(wildcard include/config/acpi/cstate.h) \
+    $(wildcard include/config/watchdog.h) \
+    $(wildcard include/config/multiboot.h) \
+    $(wildcard include/config/function/alignment.h) \
+    $(wildcard include/config/pv32.h) \
+    $(wildcard include/config/bigmem.h) \
+  include/xen/const.h \
+  arch/x86/include/asm/asm_defns.h \
+    $(wildcard include/config/indirect/thunk.h) \
+    $(wildcard include/config/frame/pointer.h) \
+  arch/x86/include/asm/asm-offsets.h \
+  arch/x86/include/asm/x86-defns.h \
+  include/xen/bug.h \
+    $(wildcard include/config/generic/bug/frame.h) \
+  arch/x86/include/asm/bug.h \
+  include/xen/stringify.h \
+  arch/x86/include/asm/cpufeature.h \
+    $(wildcard include/config/require/nx.h) \
+  include/xen/cache.h \
+  arch/x86/include/asm/cache.h \
+  arch/x86/include/asm/cpuid.h \
+  arch/x86/include/asm/cpufeatureset.h \
+  include/public/arch-x86/cpufeatureset.h \
+  arch/x86/include/asm/cpufeatures.h \
+  include/xen/lib/x86/cpuid-autogen.h \
+  arch/x86/include/asm/alternative.h \
+    $(wildcard include/config/cc/is/clang.h) \
+  arch/x86/include/asm/alternative-asm.h \
+  arch/x86/include/asm/nops.h \
+  include/xen/linkage.h \
+  include/xen/macros.h \
+  arch/x86/include/asm/asm-defns.h \
+    $(wildcard include/config/speculative/harden/guest/access.h) \
+    $(wildcard include/config/pv.h) \
+  arch/x86/include/asm/spec_ctrl_asm.h \
+  arch/x86/include/asm/msr-index.h \
+  arch/x86/include/asm/spec_ctrl.h \
+  arch/x86/include/asm/page.h \
+  include/xen/page-size.h \
+  arch/x86/include/asm/page-bits.h \
+  arch/x86/include/asm/x86_64/page.h \
+  arch/x86/include/asm/processor.h \
+    $(wildcard include/config/intel.h) \
+  arch/x86/include/asm/x86-vendors.h \
+
+arch/x86/acpi/wakeup_prot.o: $(deps_arch/x86/acpi/wakeup_prot.o)
+
+$(deps_arch/x86/acpi/wakeup_prot.o):
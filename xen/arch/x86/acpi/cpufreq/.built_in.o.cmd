@@ -0,0 +1 @@
+cmd_arch/x86/acpi/cpufreq/built_in.o := ld    -melf_x86_64 --no-warn-rwx-segments -r -o arch/x86/acpi/cpufreq/built_in.o arch/x86/acpi/cpufreq/acpi.o arch/x86/acpi/cpufreq/cpufreq.o arch/x86/acpi/cpufreq/hwp.o arch/x86/acpi/cpufreq/powernow.o
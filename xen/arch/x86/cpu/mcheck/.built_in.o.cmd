@@ -0,0 +1 @@
+cmd_arch/x86/cpu/mcheck/built_in.o := ld    -melf_x86_64 --no-warn-rwx-segments -r -o arch/x86/cpu/mcheck/built_in.o arch/x86/cpu/mcheck/amd_nonfatal.o arch/x86/cpu/mcheck/mce_amd.o arch/x86/cpu/mcheck/mcaction.o arch/x86/cpu/mcheck/barrier.o arch/x86/cpu/mcheck/intel-nonfatal.o arch/x86/cpu/mcheck/mctelem.o arch/x86/cpu/mcheck/mce.o arch/x86/cpu/mcheck/mce-apei.o arch/x86/cpu/mcheck/mce_intel.o arch/x86/cpu/mcheck/non-fatal.o arch/x86/cpu/mcheck/util.o arch/x86/cpu/mcheck/vmce.o
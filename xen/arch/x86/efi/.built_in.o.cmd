@@ -0,0 +1 @@
+cmd_arch/x86/efi/built_in.o := ld    -melf_x86_64 --no-warn-rwx-segments -r -o arch/x86/efi/built_in.o arch/x86/efi/ebmalloc.o arch/x86/efi/runtime.o arch/x86/efi/compat.o arch/x86/efi/boot.init.o arch/x86/efi/pe.init.o
@@ -0,0 +1 @@
+../../../common/efi/boot.c
\ No newline at end of file
@@ -148,9 +148,83 @@ void hvmemul_cancel(struct vcpu *v)
     hvmemul_cache_disable(v);
 }
 
+/* Number of reps starting at <gpa> which fit within its page. */
+static unsigned long hvmemul_reps_in_page(paddr_t gpa, unsigned int size,
+                                          bool df)
+{
+    unsigned int off = gpa & ~PAGE_MASK;
+    unsigned int tail = PAGE_SIZE - off;
+
+    if ( tail < size ) /* single rep spans GFN */
+        return 0;
+
+    return (df ? (off + size) : tail) / size;
+}
+
+/*
+ * Split up to <reps> further reps of the string request <p> into per-page
+ * requests for the batch slots of ioreq server <s>.  Each of them has to
+ * be handled by <s> as well, with the data side being RAM, so batching
+ * stops at the first rep not meeting this.
+ */
+static unsigned int hvmemul_batch_reps(const struct ioreq_server *s,
+                                       const ioreq_t *p, unsigned long reps,
+                                       ioreq_t *batch, unsigned int max)
+{
+    struct domain *currd = current->domain;
+    const ioreq_t *prev = p;
+    unsigned int nr = 0;
+
+    ASSERT(p->data_is_ptr);
+
+    while ( reps && nr < min(max, s->batch_slots) )
+    {
+        ioreq_t *b = &batch[nr];
+        unsigned long delta = prev->count * (unsigned long)p->size;
+        struct page_info *page;
+        p2m_type_t p2mt;
+
+        *b = *p;
+        b->data = p->df ? prev->data - delta : prev->data + delta;
+        if ( p->type == IOREQ_TYPE_COPY )
+            b->addr = p->df ? prev->addr - delta : prev->addr + delta;
+
+        b->count = min(reps, hvmemul_reps_in_page(b->data, p->size, p->df));
+        if ( p->type == IOREQ_TYPE_COPY )
+            b->count = min_t(unsigned long, b->count,
+                             hvmemul_reps_in_page(b->addr, p->size, p->df));
+        if ( !b->count )
+            break;
+
+        if ( check_get_page_from_gfn(currd, _gfn(paddr_to_pfn(b->data)),
+                                     false, &p2mt, &page) )
+            break;
+        put_page(page);
+        if ( p2m_is_mmio(p2mt) )
+            break;
+
+        if ( p->type == IOREQ_TYPE_COPY )
+        {
+            get_gfn_query_unlocked(currd, paddr_to_pfn(b->addr), &p2mt);
+            if ( p2mt != p2m_mmio_dm ||
+                 hvm_mmio_internal(ioreq_mmio_first_byte(b)) ||
+                 hvm_mmio_internal(ioreq_mmio_last_byte(b)) ||
+                 ioreq_server_select(currd, b) != s )
+                break;
+        }
+
+        reps -= b->count;
+        prev = b;
+        nr++;
+    }
+
+    return nr;
+}
+
 static int hvmemul_do_io(
     bool is_mmio, paddr_t addr, unsigned long *reps, unsigned int size,
-    uint8_t dir, bool df, bool data_is_addr, uintptr_t data)
+    uint8_t dir, bool df, bool data_is_addr, uintptr_t data,
+    unsigned long batch_reps)
 {
     struct vcpu *curr = current;
     struct domain *currd = curr->domain;
@@ -167,6 +241,7 @@ static int hvmemul_do_io(
         .state = STATE_IOREQ_READY,
     };
     void *p_data = (void *)data;
+    unsigned long max_reps = *reps + batch_reps;
     int rc;
 
     /*
@@ -329,11 +404,27 @@ static int hvmemul_do_io(
         }
         else
         {
-            rc = ioreq_send(s, &p, 0);
+            ioreq_t batch[8];
+            unsigned int i, nr = 0;
+
+            /*
+             * Reps beyond the current page can be handed to the server in
+             * the same request, as long as there is no data to wait for.
+             */
+            if ( s->batch_slots && data_is_addr && max_reps > p.count &&
+                 p2mt != p2m_ioreq_server )
+                nr = hvmemul_batch_reps(s, &p, max_reps - p.count, batch,
+                                        ARRAY_SIZE(batch));
+
+            rc = ioreq_send_batch(s, &p, batch, nr);
             if ( rc != X86EMUL_RETRY || vio->suspended )
                 vio->req.state = STATE_IOREQ_NONE;
             else if ( !ioreq_needs_completion(&vio->req) )
+            {
                 rc = X86EMUL_OKAY;
+                for ( i = 0; i < nr; i++ )
+                    *reps += batch[i].count;
+            }
         }
         break;
     }
@@ -370,7 +461,7 @@ static int hvmemul_do_io_buffer(
     BUG_ON(buffer == NULL);
 
     rc = hvmemul_do_io(is_mmio, addr, reps, size, dir, df, 0,
-                       (uintptr_t)buffer);
+                       (uintptr_t)buffer, 0);
 
     ASSERT(rc != X86EMUL_UNIMPLEMENTED);
 
@@ -462,7 +553,7 @@ static int hvmemul_do_io_addr(
     }
 
     rc = hvmemul_do_io(is_mmio, addr, &count, size, dir, df, 1,
-                       ram_gpa);
+                       ram_gpa, *reps - count);
 
     ASSERT(rc != X86EMUL_UNIMPLEMENTED);
 
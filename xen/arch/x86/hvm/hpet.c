@@ -727,11 +727,16 @@ static void hpet_set(HPETState *h)
 
 void hpet_init(struct domain *d)
 {
+    struct hvm_io_handler *handler;
+
     if ( !has_vhpet(d) )
         return;
 
     hpet_set(domain_vhpet(d));
-    register_mmio_handler(d, &hpet_mmio_ops);
+    handler = register_mmio_handler(d, &hpet_mmio_ops);
+    if ( handler )
+        hvm_set_io_handler_range(d, handler, HPET_BASE_ADDRESS,
+                                 HPET_BASE_ADDRESS + HPET_MMAP_SIZE - 1);
     d->arch.hvm.params[HVM_PARAM_HPET_ENABLED] = 1;
 }
 
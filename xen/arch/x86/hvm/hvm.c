@@ -616,14 +616,21 @@ int hvm_domain_initialise(struct domain *d,
     d->arch.hvm.params = xzalloc_array(uint64_t, HVM_NR_PARAMS);
     d->arch.hvm.io_handler = xzalloc_array(struct hvm_io_handler,
                                            NR_IO_HANDLERS);
+    /* One index each for IOREQ_TYPE_PIO and IOREQ_TYPE_COPY. */
+    d->arch.hvm.io_index[IOREQ_TYPE_PIO] = xzalloc(struct hvm_io_index);
+    d->arch.hvm.io_index[IOREQ_TYPE_COPY] = xzalloc(struct hvm_io_index);
     d->arch.hvm.irq = xzalloc_flex_struct(struct hvm_irq,
                                           gsi_assert_count, nr_gsis);
 
     rc = -ENOMEM;
     if ( !d->arch.hvm.pl_time || !d->arch.hvm.irq ||
-         !d->arch.hvm.params  || !d->arch.hvm.io_handler )
+         !d->arch.hvm.params  || !d->arch.hvm.io_handler ||
+         !d->arch.hvm.io_index[IOREQ_TYPE_PIO] ||
+         !d->arch.hvm.io_index[IOREQ_TYPE_COPY] )
         goto fail1;
 
+    spin_lock_init(&d->arch.hvm.io_index_lock);
+
     /* Set the number of GSIs */
     hvm_domain_irq(d)->nr_gsis = nr_gsis;
 
@@ -712,6 +719,8 @@ int hvm_domain_initialise(struct domain *d,
  fail:
     hvm_domain_relinquish_resources(d);
     XFREE(d->arch.hvm.io_handler);
+    XFREE(d->arch.hvm.io_index[IOREQ_TYPE_PIO]);
+    XFREE(d->arch.hvm.io_index[IOREQ_TYPE_COPY]);
     XFREE(d->arch.hvm.pl_time);
     return rc;
 }
@@ -755,6 +764,8 @@ void hvm_domain_destroy(struct domain *d)
     hvm_domain_relinquish_resources(d);
 
     XFREE(d->arch.hvm.io_handler);
+    XFREE(d->arch.hvm.io_index[IOREQ_TYPE_PIO]);
+    XFREE(d->arch.hvm.io_index[IOREQ_TYPE_COPY]);
     XFREE(d->arch.hvm.params);
 
     hvm_destroy_cacheattr_region_list(d);
@@ -20,6 +20,7 @@
 #include <io_ports.h>
 #include <xen/event.h>
 #include <xen/iommu.h>
+#include <xen/perfc.h>
 
 static bool cf_check hvm_mmio_accept(
     const struct hvm_io_handler *handler, const ioreq_t *p)
@@ -213,15 +214,157 @@ int hvm_process_io_intercept(const struct hvm_io_handler *handler,
     return rc;
 }
 
+/*
+ * Handlers with a static range never accept an access whose first byte is
+ * outside of it, so only the handlers claiming the part of the index the
+ * access starts in and those without a static range need to be asked.
+ * A changed index is built anew and replaces the old one under RCU, so
+ * lookups don't need to take any lock.
+ */
+static DEFINE_RCU_READ_LOCK(hvm_io_index_rcu_lock);
+
+static void cf_check hvm_io_index_free(struct rcu_head *rcu)
+{
+    xfree(container_of(rcu, struct hvm_io_index, rcu));
+}
+
+static void hvm_io_index_split(struct hvm_io_index *idx, uint64_t start)
+{
+    unsigned int i = idx->nr;
+
+    while ( idx->part[i - 1].start > start )
+        i--;
+
+    if ( idx->part[i - 1].start == start )
+        return;
+
+    ASSERT(idx->nr < ARRAY_SIZE(idx->part));
+    memmove(&idx->part[i + 1], &idx->part[i],
+            (idx->nr - i) * sizeof(idx->part[0]));
+    idx->part[i].start = start;
+    idx->part[i].handlers = idx->part[i - 1].handlers;
+    idx->nr++;
+}
+
+static int hvm_io_index_build(struct domain *d, uint8_t type)
+{
+    struct hvm_io_index *idx, *old;
+    unsigned int j;
+
+    ASSERT(spin_is_locked(&d->arch.hvm.io_index_lock));
+
+    idx = xmalloc(struct hvm_io_index);
+    if ( !idx )
+        return -ENOMEM;
+
+    idx->ranged = d->arch.hvm.io_handler_ranged;
+    idx->nr = 1;
+    idx->part[0].start = 0;
+    idx->part[0].handlers = 0;
+
+    for_each_set_bit ( i, d->arch.hvm.io_handler_ranged )
+    {
+        const struct hvm_io_handler *handler = &d->arch.hvm.io_handler[i];
+
+        if ( handler->type != type )
+            continue;
+
+        hvm_io_index_split(idx, handler->first);
+        if ( handler->last != ~0ULL )
+            hvm_io_index_split(idx, handler->last + 1);
+
+        for ( j = 0; j < idx->nr; j++ )
+            if ( idx->part[j].start >= handler->first &&
+                 idx->part[j].start <= handler->last )
+                idx->part[j].handlers |= 1U << i;
+    }
+
+    old = rcu_dereference(d->arch.hvm.io_index[type]);
+    rcu_assign_pointer(d->arch.hvm.io_index[type], idx);
+    call_rcu(&old->rcu, hvm_io_index_free);
+
+    perfc_incr(hvm_io_index_rebuild);
+
+    return 0;
+}
+
+/* Bitmap of the handlers which may accept an access to <addr>. */
+static uint32_t hvm_io_index_lookup(struct domain *d, uint8_t type,
+                                    uint64_t addr)
+{
+    const struct hvm_io_index *idx;
+    uint32_t handlers = 0;
+    unsigned int lo = 0, hi;
+
+    rcu_read_lock(&hvm_io_index_rcu_lock);
+
+    idx = rcu_dereference(d->arch.hvm.io_index[type]);
+    hi = idx->nr;
+    if ( hi )
+    {
+        /* The part with the highest start not above addr. */
+        while ( hi - lo > 1 )
+        {
+            unsigned int mid = lo + (hi - lo) / 2;
+
+            if ( idx->part[mid].start <= addr )
+                lo = mid;
+            else
+                hi = mid;
+        }
+
+        handlers = idx->part[lo].handlers;
+    }
+
+    handlers |= ~ACCESS_ONCE(idx->ranged) &
+                ((1ULL << min_t(unsigned int, d->arch.hvm.io_handler_count,
+                                NR_IO_HANDLERS)) - 1);
+
+    rcu_read_unlock(&hvm_io_index_rcu_lock);
+
+    return handlers;
+}
+
+void hvm_set_io_handler_range(struct domain *d,
+                              struct hvm_io_handler *handler,
+                              uint64_t first, uint64_t last)
+{
+    unsigned int i = handler - d->arch.hvm.io_handler;
+
+    ASSERT(i < d->arch.hvm.io_handler_count);
+    ASSERT(first <= last);
+
+    spin_lock(&d->arch.hvm.io_index_lock);
+
+    handler->first = first;
+    handler->last = last;
+    d->arch.hvm.io_handler_ranged |= 1U << i;
+    if ( hvm_io_index_build(d, handler->type) )
+    {
+        /* Keep the old index, but have the handler asked for any access. */
+        d->arch.hvm.io_handler_ranged &= ~(1U << i);
+        clear_bit(i, &d->arch.hvm.io_index[handler->type]->ranged);
+    }
+
+    spin_unlock(&d->arch.hvm.io_index_lock);
+}
+
 static const struct hvm_io_handler *hvm_find_io_handler(const ioreq_t *p)
 {
     struct domain *curr_d = current->domain;
-    unsigned int i;
+    uint32_t handlers;
 
     BUG_ON((p->type != IOREQ_TYPE_PIO) &&
            (p->type != IOREQ_TYPE_COPY));
 
-    for ( i = 0; i < curr_d->arch.hvm.io_handler_count; i++ )
+    perfc_incra(hvm_io_lookup, p->type);
+
+    handlers = hvm_io_index_lookup(curr_d, p->type,
+                                   p->type == IOREQ_TYPE_COPY ?
+                                   ioreq_mmio_first_byte(p) : p->addr);
+
+    /* Ask the candidates in order of registration. */
+    for_each_set_bit ( i, handlers )
     {
         const struct hvm_io_handler *handler =
             &curr_d->arch.hvm.io_handler[i];
@@ -230,8 +373,12 @@ static const struct hvm_io_handler *hvm_find_io_handler(const ioreq_t *p)
         if ( handler->type != p->type )
             continue;
 
+        perfc_incra(hvm_io_accept, p->type);
         if ( ops->accept(handler, p) )
+        {
+            perfc_incra(hvm_io_handled, p->type);
             return handler;
+        }
     }
 
     return NULL;
@@ -253,6 +400,8 @@ struct hvm_io_handler *hvm_next_io_handler(struct domain *d)
 {
     unsigned int i = d->arch.hvm.io_handler_count++;
 
+    BUILD_BUG_ON(NR_IO_HANDLERS > 32);
+
     ASSERT(d->arch.hvm.io_handler);
 
     if ( i == NR_IO_HANDLERS )
@@ -264,17 +413,19 @@ struct hvm_io_handler *hvm_next_io_handler(struct domain *d)
     return &d->arch.hvm.io_handler[i];
 }
 
-void register_mmio_handler(struct domain *d,
-                           const struct hvm_mmio_ops *ops)
+struct hvm_io_handler *register_mmio_handler(struct domain *d,
+                                             const struct hvm_mmio_ops *ops)
 {
     struct hvm_io_handler *handler = hvm_next_io_handler(d);
 
     if ( handler == NULL )
-        return;
+        return NULL;
 
     handler->type = IOREQ_TYPE_COPY;
     handler->ops = &mmio_ops;
     handler->mmio.ops = ops;
+
+    return handler;
 }
 
 void register_portio_handler(struct domain *d, unsigned int port,
@@ -290,6 +441,8 @@ void register_portio_handler(struct domain *d, unsigned int port,
     handler->portio.port = port;
     handler->portio.size = size;
     handler->portio.action = action;
+
+    hvm_set_io_handler_range(d, handler, port, port + size - 1);
 }
 
 bool relocate_portio_handler(struct domain *d, unsigned int old_port,
@@ -306,9 +459,14 @@ bool relocate_portio_handler(struct domain *d, unsigned int old_port,
             continue;
 
         if ( (handler->portio.port == old_port) &&
-             (handler->portio.size = size) )
+             (handler->portio.size == size) )
         {
-            handler->portio.port = new_port;
+            if ( new_port != old_port )
+            {
+                handler->portio.port = new_port;
+                hvm_set_io_handler_range(d, handler, new_port,
+                                         new_port + size - 1);
+            }
             return true;
         }
     }
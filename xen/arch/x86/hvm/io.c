@@ -340,6 +340,7 @@ void register_vpci_portio_handler(struct domain *d)
 
     handler->type = IOREQ_TYPE_PIO;
     handler->ops = &vpci_portio_ops;
+    hvm_set_io_handler_range(d, handler, 0xcf8, 0xcff);
 }
 
 struct hvm_mmcfg {
@@ -100,6 +100,8 @@ void stdvga_init(struct domain *d)
     {
         handler->type = IOREQ_TYPE_COPY;
         handler->ops = &stdvga_mem_ops;
+        hvm_set_io_handler_range(d, handler, VGA_MEM_BASE,
+                                 VGA_MEM_BASE + VGA_MEM_SIZE - 1);
     }
 }
 
@@ -183,11 +183,25 @@ struct log_dirty_domain {
     unsigned long  fault_count;
     unsigned long  dirty_count;
 
+    /* Optional ring of pfns in the order they were first dirtied. */
+    struct log_dirty_ring {
+        unsigned long *pfns;
+        unsigned int   size;       /* A power of two. */
+        unsigned int   prod, cons; /* Free running. */
+        bool           overflowed;
+    } ring;
+
     /* functions which are paging mode specific */
     const struct log_dirty_ops {
         int        (*enable  )(struct domain *d);
         int        (*disable )(struct domain *d);
         void       (*clean   )(struct domain *d);
+        /* Optional: as clean, for the pfns [begin, end) only. */
+        void       (*clean_range)(struct domain *d, unsigned long begin,
+                                  unsigned long end);
+        /* Optional: as clean, for the nr pfns listed only. */
+        void       (*clean_pfns)(struct domain *d, const unsigned long *pfns,
+                                 unsigned int nr);
     } *ops;
 };
 
@@ -222,6 +236,7 @@ struct paging_domain {
                 unsigned long done:PADDR_BITS - PAGE_SHIFT;
                 unsigned long i4:PAGETABLE_ORDER;
                 unsigned long i3:PAGETABLE_ORDER;
+                unsigned long found:PADDR_BITS - PAGE_SHIFT;
             } log_dirty;
         };
     } preempt;
@@ -66,6 +66,14 @@ struct hvm_domain {
     struct hvm_io_handler *io_handler;
     unsigned int          io_handler_count;
 
+    /*
+     * Handlers with a static range, and the index of these ranges by type.
+     * The lock serialises updates, the index is looked up under RCU.
+     */
+    spinlock_t            io_index_lock;
+    uint32_t              io_handler_ranged;
+    struct hvm_io_index __rcu *io_index[2];
+
     /* Lock protects access to irq, vpic and vioapic. */
     spinlock_t             irq_lock;
     struct hvm_irq        *irq;
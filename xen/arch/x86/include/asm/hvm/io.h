@@ -9,6 +9,7 @@
 #define __ASM_X86_HVM_IO_H__
 
 #include <xen/pci.h>
+#include <xen/rcupdate.h>
 #include <public/hvm/ioreq.h>
 
 #define NR_IO_HANDLERS 32
@@ -44,6 +45,25 @@ struct hvm_io_handler {
     };
     const struct hvm_io_ops *ops;
     uint8_t type;
+    /* Static range, see hvm_set_io_handler_range(). */
+    uint64_t first, last;
+};
+
+/*
+ * Index of the static ranges of the I/O handlers of one type.  The address
+ * space is split into parts claimed by a fixed set of handlers, each part
+ * extending up to the start of the next one.  An index is never modified
+ * once published, except for dropping handlers from <ranged>.
+ */
+struct hvm_io_index {
+    struct rcu_head rcu;
+    /* Handlers with a static range, the others are asked for any access. */
+    uint32_t ranged;
+    unsigned int nr;
+    struct {
+        uint64_t start;
+        uint32_t handlers;
+    } part[2 * NR_IO_HANDLERS + 1];
 };
 
 typedef int (*hvm_io_read_t)(const struct hvm_io_handler *handler,
@@ -69,11 +89,14 @@ int hvm_process_io_intercept(const struct hvm_io_handler *handler,
 int hvm_io_intercept(ioreq_t *p);
 
 struct hvm_io_handler *hvm_next_io_handler(struct domain *d);
+void hvm_set_io_handler_range(struct domain *d,
+                              struct hvm_io_handler *handler,
+                              uint64_t first, uint64_t last);
 
 bool hvm_mmio_internal(paddr_t gpa);
 
-void register_mmio_handler(struct domain *d,
-                           const struct hvm_mmio_ops *ops);
+struct hvm_io_handler *register_mmio_handler(struct domain *d,
+                                             const struct hvm_mmio_ops *ops);
 
 void register_portio_handler(
     struct domain *d, unsigned int port, unsigned int size,
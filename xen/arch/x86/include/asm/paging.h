@@ -170,6 +170,12 @@ bool paging_mfn_is_dirty(const struct domain *d, mfn_t gmfn);
                               (LOGDIRTY_NODE_ENTRIES-1))
 #define L4_LOGDIRTY_IDX(pfn) ((pfn_x(pfn) >> (PAGE_SHIFT + 3 + PAGETABLE_ORDER * 2)) & \
                               (LOGDIRTY_NODE_ENTRIES-1))
+/* Pfns covered by one leaf, and by the whole tree. */
+#define LOGDIRTY_LEAF_PFNS   (1UL << (PAGE_SHIFT + 3))
+#define LOGDIRTY_MAX_PFNS    (LOGDIRTY_LEAF_PFNS << (PAGETABLE_ORDER * 3))
+/* Bounds on the size of the dirty ring, as orders of its entries. */
+#define LOGDIRTY_RING_MIN_ORDER 10
+#define LOGDIRTY_RING_MAX_ORDER 20
 
 #ifdef CONFIG_HVM
 /* VRAM dirty tracking support */
@@ -15,6 +15,12 @@ PERFCOUNTER_ARRAY(vmexits,              "vmexits",
 #define VMX_PERF_VECTOR_SIZE 0x20
 PERFCOUNTER_ARRAY(cause_vector,         "cause vector", VMX_PERF_VECTOR_SIZE)
 
+/* Indexed by IOREQ_TYPE_PIO / IOREQ_TYPE_COPY. */
+PERFCOUNTER_ARRAY(hvm_io_lookup,        "hvm io handler lookups", 2)
+PERFCOUNTER_ARRAY(hvm_io_accept,        "hvm io handler accept calls", 2)
+PERFCOUNTER_ARRAY(hvm_io_handled,       "hvm io handled internally", 2)
+PERFCOUNTER(hvm_io_index_rebuild,       "hvm io handler index rebuilds")
+
 #endif /* CONFIG_HVM */
 
 PERFCOUNTER(seg_fixups,             "segmentation fixups")
@@ -223,6 +223,31 @@ static void cf_check hap_clean_dirty_bitmap(struct domain *d)
     guest_flush_tlb_mask(d, d->dirty_cpumask);
 }
 
+static void cf_check hap_clean_dirty_range(struct domain *d,
+                                           unsigned long begin,
+                                           unsigned long end)
+{
+    /* Nothing beyond the highest mapped pfn needs switching back. */
+    end = min(end, p2m_get_hostp2m(d)->max_mapped_pfn + 1);
+    if ( begin >= end )
+        return;
+
+    p2m_change_type_range(d, begin, end, p2m_ram_rw, p2m_ram_logdirty);
+    guest_flush_tlb_mask(d, d->dirty_cpumask);
+}
+
+static void cf_check hap_clean_dirty_pfns(struct domain *d,
+                                          const unsigned long *pfns,
+                                          unsigned int nr)
+{
+    unsigned int i;
+
+    for ( i = 0; i < nr; i++ )
+        p2m_change_type_one(d, pfns[i], p2m_ram_rw, p2m_ram_logdirty);
+
+    guest_flush_tlb_mask(d, d->dirty_cpumask);
+}
+
 /************************************************/
 /*             HAP SUPPORT FUNCTIONS            */
 /************************************************/
@@ -439,6 +464,8 @@ void hap_domain_init(struct domain *d)
         .enable  = hap_enable_log_dirty,
         .disable = hap_disable_log_dirty,
         .clean   = hap_clean_dirty_bitmap,
+        .clean_range = hap_clean_dirty_range,
+        .clean_pfns  = hap_clean_dirty_pfns,
     };
 
     /* Use HAP logdirty mechanism. */
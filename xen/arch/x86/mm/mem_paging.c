@@ -319,6 +319,47 @@ static int evict(struct domain *d, gfn_t gfn)
     return ret;
 }
 
+/*
+ * populate_evicted - Mark an unpopulated gfn as paged-out
+ * @d: guest domain
+ * @gfn: guest page with no backing memory
+ *
+ * Returns 0 for success or negative errno values if the gfn is in use.
+ *
+ * populate_evicted() is called by a pager which holds the contents of a page
+ * the guest has not yet been given, such as the receiver of a post-copy
+ * migration.  It leaves the gfn as evict() would have done, without a page
+ * first having to be allocated, nominated and freed.  Any access to the gfn
+ * then raises a paging request, and prepare() supplies the contents.
+ */
+static int populate_evicted(struct domain *d, gfn_t gfn)
+{
+    struct p2m_domain *p2m = p2m_get_hostp2m(d);
+    p2m_type_t p2mt;
+    p2m_access_t a;
+    mfn_t mfn;
+    int ret = -EBUSY;
+
+    gfn_lock(p2m, gfn, 0);
+
+    mfn = p2m->get_entry(p2m, gfn, &p2mt, &a, 0, NULL, NULL);
+
+    /* Allow only gfns with nothing behind them */
+    if ( mfn_valid(mfn) || (p2mt != p2m_invalid && p2mt != p2m_mmio_dm) )
+        goto out;
+
+    ret = p2m_set_entry(p2m, gfn, INVALID_MFN, PAGE_ORDER_4K,
+                        p2m_ram_paged, p2m->default_access);
+
+    /* Track number of paged gfns */
+    if ( !ret )
+        atomic_inc(&d->paged_pages);
+
+ out:
+    gfn_unlock(p2m, gfn, 0);
+    return ret;
+}
+
 /*
  * prepare - Allocate a new page for the guest
  * @d: guest domain
@@ -464,6 +505,10 @@ int mem_paging_memop(XEN_GUEST_HANDLE_PARAM(xen_mem_paging_op_t) arg)
             copyback = 1;
         break;
 
+    case XENMEM_paging_op_populate_evicted:
+        rc = populate_evicted(d, _gfn(mpo.gfn));
+        break;
+
     default:
         rc = -ENOSYS;
         break;
@@ -10,6 +10,7 @@
 #include <xen/init.h>
 #include <xen/guest_access.h>
 #include <xen/hypercall.h>
+#include <xen/xvmalloc.h>
 #include <asm/paging.h>
 #include <asm/shadow.h>
 #include <asm/p2m.h>
@@ -201,7 +202,62 @@ static int paging_free_log_dirty_bitmap(struct domain *d, int rc)
     return rc;
 }
 
-static int paging_log_dirty_enable(struct domain *d)
+static int paging_alloc_log_dirty_ring(struct domain *d)
+{
+    int order = min(max(get_count_order(d->max_pages),
+                        LOGDIRTY_RING_MIN_ORDER),
+                    LOGDIRTY_RING_MAX_ORDER);
+    unsigned long *pfns = xvmalloc_array(unsigned long, 1U << order);
+
+    if ( !pfns )
+        return -ENOMEM;
+
+    paging_lock(d);
+    ASSERT(!d->arch.paging.log_dirty.ring.pfns);
+    d->arch.paging.log_dirty.ring.pfns = pfns;
+    d->arch.paging.log_dirty.ring.size = 1U << order;
+    d->arch.paging.log_dirty.ring.prod = 0;
+    d->arch.paging.log_dirty.ring.cons = 0;
+    d->arch.paging.log_dirty.ring.overflowed = false;
+    paging_unlock(d);
+
+    return 0;
+}
+
+static void paging_free_log_dirty_ring(struct domain *d)
+{
+    unsigned long *pfns;
+
+    paging_lock(d);
+    pfns = d->arch.paging.log_dirty.ring.pfns;
+    memset(&d->arch.paging.log_dirty.ring, 0,
+           sizeof(d->arch.paging.log_dirty.ring));
+    paging_unlock(d);
+
+    xvfree(pfns);
+}
+
+/* Queue a pfn which has just become dirty on the ring, if there is one. */
+static void paging_log_dirty_ring_push(struct domain *d, pfn_t pfn)
+{
+    struct log_dirty_ring *ring = &d->arch.paging.log_dirty.ring;
+
+    ASSERT(paging_locked_by_me(d));
+
+    if ( !ring->pfns )
+        return;
+
+    /* What is lost is still in the bitmap, for a CLEAN of all of it. */
+    if ( ring->prod - ring->cons == ring->size )
+    {
+        ring->overflowed = true;
+        return;
+    }
+
+    ring->pfns[ring->prod++ & (ring->size - 1)] = pfn_x(pfn);
+}
+
+static int paging_log_dirty_enable(struct domain *d, bool ring)
 {
     int ret;
 
@@ -217,10 +273,23 @@ static int paging_log_dirty_enable(struct domain *d)
     if ( paging_mode_log_dirty(d) )
         return -EINVAL;
 
+    if ( ring )
+    {
+        if ( !d->arch.paging.log_dirty.ops->clean_pfns )
+            return -EOPNOTSUPP;
+
+        ret = paging_alloc_log_dirty_ring(d);
+        if ( ret )
+            return ret;
+    }
+
     domain_pause(d);
     ret = d->arch.paging.log_dirty.ops->enable(d);
     domain_unpause(d);
 
+    if ( ret && ring )
+        paging_free_log_dirty_ring(d);
+
     return ret;
 }
 
@@ -243,6 +312,8 @@ static int paging_log_dirty_disable(struct domain *d, bool resuming)
     if ( ret == -ERESTART )
         return ret;
 
+    paging_free_log_dirty_ring(d);
+
     domain_unpause(d);
 
     return ret;
@@ -319,6 +390,7 @@ void paging_mark_pfn_dirty(struct domain *d, pfn_t pfn)
                      "d%d: marked mfn %" PRI_mfn " (pfn %" PRI_pfn ")\n",
                      d->domain_id, mfn_x(mfn), pfn_x(pfn));
         d->arch.paging.log_dirty.dirty_count++;
+        paging_log_dirty_ring_push(d, pfn);
     }
 
 out:
@@ -390,6 +462,68 @@ bool paging_mfn_is_dirty(const struct domain *d, mfn_t gmfn)
 }
 #endif
 
+/*
+ * Map the leaf of the log-dirty bitmap covering pfn, or return NULL if no
+ * pfn it covers has been dirtied.
+ */
+static unsigned long *paging_map_log_dirty_leaf(const mfn_t *l4, pfn_t pfn)
+{
+    mfn_t mfn, *node;
+
+    if ( !l4 )
+        return NULL;
+
+    mfn = l4[L4_LOGDIRTY_IDX(pfn)];
+    if ( mfn_eq(mfn, INVALID_MFN) )
+        return NULL;
+
+    node = map_domain_page(mfn);
+    mfn = node[L3_LOGDIRTY_IDX(pfn)];
+    unmap_domain_page(node);
+    if ( mfn_eq(mfn, INVALID_MFN) )
+        return NULL;
+
+    node = map_domain_page(mfn);
+    mfn = node[L2_LOGDIRTY_IDX(pfn)];
+    unmap_domain_page(node);
+    if ( mfn_eq(mfn, INVALID_MFN) )
+        return NULL;
+
+    return map_domain_page(mfn);
+}
+
+/*
+ * Count, and if list is set report, the dirty pfns among the nr from pfn,
+ * all covered by the leaf l1.  Returns how many pfns were dealt with, fewer
+ * than nr if the list filled, or -EFAULT.
+ */
+static long paging_log_dirty_list(struct xen_domctl_shadow_op *sc,
+                                  const unsigned long *l1, unsigned long pfn,
+                                  unsigned int nr, bool list,
+                                  unsigned long *found)
+{
+    unsigned int idx = L1_LOGDIRTY_IDX(_pfn(pfn)), end = idx + nr, i;
+    uint64_t gfn;
+
+    for ( i = find_next_bit(l1, end, idx); i < end;
+          i = find_next_bit(l1, end, i + 1) )
+    {
+        if ( list )
+        {
+            if ( *found == sc->nr_dirty_pfns )
+                return i - idx;
+
+            gfn = pfn + (i - idx);
+            if ( copy_to_guest_offset(sc->dirty_pfns, *found, &gfn, 1) )
+                return -EFAULT;
+        }
+
+        ++*found;
+    }
+
+    return nr;
+}
+
 /* Read a domain's log-dirty bitmap and stats.  If the operation is a CLEAN,
  * clear the bitmap and stats as well. */
 static int paging_log_dirty_op(struct domain *d,
@@ -397,10 +531,12 @@ static int paging_log_dirty_op(struct domain *d,
                                bool resuming)
 {
     int rv = 0, clean = 0, peek = 1;
-    unsigned long pages = 0;
-    mfn_t *l4 = NULL, *l3 = NULL, *l2 = NULL;
-    unsigned long *l1 = NULL;
-    int i4, i3, i2;
+    bool range = sc->mode & XEN_DOMCTL_SHADOW_LOGDIRTY_RANGE;
+    bool list = sc->mode & XEN_DOMCTL_SHADOW_LOGDIRTY_PFN_LIST;
+    unsigned long begin = range ? sc->start_pfn : 0;
+    unsigned long pages = 0, found = 0;
+    mfn_t *l4 = NULL;
+    unsigned long *l1;
 
     if ( !resuming )
     {
@@ -449,7 +585,8 @@ static int paging_log_dirty_op(struct domain *d,
     sc->stats.dirty_count = min(d->arch.paging.log_dirty.dirty_count,
                                 UINT32_MAX + 0UL);
 
-    if ( guest_handle_is_null(sc->dirty_bitmap) )
+    if ( list ? guest_handle_is_null(sc->dirty_pfns)
+              : guest_handle_is_null(sc->dirty_bitmap) )
         /* caller may have wanted just to clean the state or access stats. */
         peek = 0;
 
@@ -462,70 +599,65 @@ static int paging_log_dirty_op(struct domain *d,
     }
 
     l4 = paging_map_log_dirty_bitmap(d);
-    i4 = d->arch.paging.preempt.log_dirty.i4;
-    i3 = d->arch.paging.preempt.log_dirty.i3;
     pages = d->arch.paging.preempt.log_dirty.done;
+    found = d->arch.paging.preempt.log_dirty.found;
 
-    for ( ; (pages < sc->pages) && (i4 < LOGDIRTY_NODE_ENTRIES); i4++, i3 = 0 )
+    /* One leaf, or the part of one in the range, at a time. */
+    while ( pages < sc->pages && begin + pages < LOGDIRTY_MAX_PFNS )
     {
-        l3 = ((l4 && !mfn_eq(l4[i4], INVALID_MFN)) ?
-              map_domain_page(l4[i4]) : NULL);
-        for ( ; (pages < sc->pages) && (i3 < LOGDIRTY_NODE_ENTRIES); i3++ )
+        unsigned long pfn = begin + pages;
+        unsigned int idx = L1_LOGDIRTY_IDX(_pfn(pfn));
+        unsigned int nr = min_t(unsigned long, sc->pages - pages,
+                                LOGDIRTY_LEAF_PFNS - idx);
+        long done = nr;
+
+        l1 = paging_map_log_dirty_leaf(l4, _pfn(pfn));
+
+        if ( !list && peek )
         {
-            l2 = ((l3 && !mfn_eq(l3[i3], INVALID_MFN)) ?
-                  map_domain_page(l3[i3]) : NULL);
-            for ( i2 = 0;
-                  (pages < sc->pages) && (i2 < LOGDIRTY_NODE_ENTRIES);
-                  i2++ )
-            {
-                unsigned int bytes = PAGE_SIZE;
-                l1 = ((l2 && !mfn_eq(l2[i2], INVALID_MFN)) ?
-                      map_domain_page(l2[i2]) : NULL);
-                if ( unlikely(((sc->pages - pages + 7) >> 3) < bytes) )
-                    bytes = (unsigned int)((sc->pages - pages + 7) >> 3);
-                if ( likely(peek) )
-                {
-                    if ( (l1 ? copy_to_guest_offset(sc->dirty_bitmap,
-                                                    pages >> 3, (uint8_t *)l1,
-                                                    bytes)
-                             : clear_guest_offset(sc->dirty_bitmap,
-                                                  pages >> 3, bytes)) != 0 )
-                    {
-                        rv = -EFAULT;
-                        goto out;
-                    }
-                }
-                pages += bytes << 3;
-                if ( l1 )
-                {
-                    if ( clean )
-                        clear_page(l1);
-                    unmap_domain_page(l1);
-                }
-            }
-            if ( l2 )
-                unmap_domain_page(l2);
+            unsigned int bytes = (nr + 7) >> 3;
+
+            if ( (l1 ? copy_to_guest_offset(sc->dirty_bitmap, pages >> 3,
+                                            (uint8_t *)l1 + (idx >> 3),
+                                            bytes)
+                     : clear_guest_offset(sc->dirty_bitmap, pages >> 3,
+                                          bytes)) != 0 )
+                done = -EFAULT;
+        }
 
-            if ( i3 < LOGDIRTY_NODE_ENTRIES - 1 && hypercall_preempt_check() )
+        if ( l1 && done > 0 && (range || list) )
+            done = paging_log_dirty_list(sc, l1, pfn, nr, list && peek,
+                                         &found);
+
+        if ( l1 )
+        {
+            if ( clean && done > 0 )
             {
-                d->arch.paging.preempt.log_dirty.i4 = i4;
-                d->arch.paging.preempt.log_dirty.i3 = i3 + 1;
-                rv = -ERESTART;
-                break;
+                if ( done == LOGDIRTY_LEAF_PFNS )
+                    clear_page(l1);
+                else
+                    bitmap_clear(l1, idx, done);
             }
+            unmap_domain_page(l1);
         }
-        if ( l3 )
-            unmap_domain_page(l3);
 
-        if ( !rv && i4 < LOGDIRTY_NODE_ENTRIES - 1 &&
-             hypercall_preempt_check() )
+        if ( done < 0 )
         {
-            d->arch.paging.preempt.log_dirty.i4 = i4 + 1;
-            d->arch.paging.preempt.log_dirty.i3 = 0;
-            rv = -ERESTART;
+            rv = done;
+            goto out;
         }
-        if ( rv )
+
+        pages += done;
+
+        /* The list is full. */
+        if ( done < nr )
+            break;
+
+        if ( pages < sc->pages && hypercall_preempt_check() )
+        {
+            rv = -ERESTART;
             break;
+        }
     }
     if ( l4 )
         unmap_domain_page(l4);
@@ -533,17 +665,25 @@ static int paging_log_dirty_op(struct domain *d,
     if ( !rv )
     {
         d->arch.paging.preempt.dom = NULL;
-        if ( clean )
+        if ( clean && !range )
         {
             d->arch.paging.log_dirty.fault_count = 0;
             d->arch.paging.log_dirty.dirty_count = 0;
         }
+        /* Everything dirty has been reported, so the ring can start over. */
+        if ( clean && !range && !list )
+        {
+            d->arch.paging.log_dirty.ring.prod = 0;
+            d->arch.paging.log_dirty.ring.cons = 0;
+            d->arch.paging.log_dirty.ring.overflowed = false;
+        }
     }
     else
     {
         d->arch.paging.preempt.dom = current->domain;
         d->arch.paging.preempt.op = sc->op;
         d->arch.paging.preempt.log_dirty.done = pages;
+        d->arch.paging.preempt.log_dirty.found = found;
     }
 
     paging_unlock(d);
@@ -557,11 +697,18 @@ static int paging_log_dirty_op(struct domain *d,
 
     if ( pages < sc->pages )
         sc->pages = pages;
+    if ( range || list )
+        sc->stats.dirty_count = min(found, UINT32_MAX + 0UL);
+    if ( list )
+        sc->nr_dirty_pfns = found;
     if ( clean )
     {
         /* We need to further call clean_dirty_bitmap() functions of specific
          * paging modes (shadow or hap).  Safe because the domain is paused. */
-        d->arch.paging.log_dirty.ops->clean(d);
+        if ( range && d->arch.paging.log_dirty.ops->clean_range )
+            d->arch.paging.log_dirty.ops->clean_range(d, begin, begin + pages);
+        else
+            d->arch.paging.log_dirty.ops->clean(d);
     }
     domain_unpause(d);
     return rv;
@@ -571,18 +718,137 @@ static int paging_log_dirty_op(struct domain *d,
     paging_unlock(d);
     domain_unpause(d);
 
-    if ( l1 )
-        unmap_domain_page(l1);
-    if ( l2 )
-        unmap_domain_page(l2);
-    if ( l3 )
-        unmap_domain_page(l3);
     if ( l4 )
         unmap_domain_page(l4);
 
     return rv;
 }
 
+/*
+ * Take up to sc->nr_dirty_pfns pfns from the dirty ring into sc->dirty_pfns,
+ * cleaning just those.  Entries for pfns since cleaned some other way are
+ * stale, and skipped, as are repeats of a pfn already taken.
+ */
+#define LOGDIRTY_DRAIN_BATCH 128
+
+static int paging_log_dirty_drain(struct domain *d,
+                                  struct xen_domctl_shadow_op *sc,
+                                  bool resuming)
+{
+    struct log_dirty_domain *ld = &d->arch.paging.log_dirty;
+    unsigned long batch[LOGDIRTY_DRAIN_BATCH], found, *l1;
+    unsigned int nr;
+    uint64_t gfn;
+    mfn_t *l4;
+    int rv = 0;
+
+    if ( !resuming )
+    {
+        if ( is_hvm_domain(d) &&
+             (sc->mode & XEN_DOMCTL_SHADOW_LOGDIRTY_FINAL) )
+            hvm_mapped_guest_frames_mark_dirty(d);
+
+        domain_pause(d);
+
+        /* Queues what e.g. PML has logged, so it is taken now too. */
+        p2m_flush_hardware_cached_dirty(d);
+    }
+
+    paging_lock(d);
+
+    if ( !d->arch.paging.preempt.dom )
+        memset(&d->arch.paging.preempt.log_dirty, 0,
+               sizeof(d->arch.paging.preempt.log_dirty));
+    else if ( d->arch.paging.preempt.dom != current->domain ||
+              d->arch.paging.preempt.op != sc->op )
+    {
+        paging_unlock(d);
+        if ( !resuming )
+            domain_unpause(d);
+        return -EBUSY;
+    }
+
+    if ( !ld->ring.pfns )
+        rv = -EOPNOTSUPP;
+    else if ( unlikely(ld->failed_allocs) )
+        rv = -ENOMEM;
+    else if ( ld->ring.overflowed && !resuming )
+        rv = -ENOBUFS;
+    if ( rv )
+        goto out;
+
+    sc->stats.fault_count = min(ld->fault_count, UINT32_MAX + 0UL);
+    found = d->arch.paging.preempt.log_dirty.found;
+
+    while ( found < sc->nr_dirty_pfns && ld->ring.cons != ld->ring.prod )
+    {
+        l4 = paging_map_log_dirty_bitmap(d);
+
+        for ( nr = 0;
+              nr < ARRAY_SIZE(batch) && found + nr < sc->nr_dirty_pfns &&
+              ld->ring.cons != ld->ring.prod;
+              ld->ring.cons++ )
+        {
+            pfn_t pfn = _pfn(ld->ring.pfns[ld->ring.cons &
+                                           (ld->ring.size - 1)]);
+            bool dirty;
+
+            l1 = paging_map_log_dirty_leaf(l4, pfn);
+            if ( !l1 )
+                continue;
+            dirty = __test_and_clear_bit(L1_LOGDIRTY_IDX(pfn), l1);
+            unmap_domain_page(l1);
+            if ( !dirty )
+                continue;
+
+            batch[nr++] = pfn_x(pfn);
+
+            gfn = pfn_x(pfn);
+            if ( copy_to_guest_offset(sc->dirty_pfns, found + nr - 1,
+                                      &gfn, 1) )
+            {
+                ld->ring.cons++;
+                rv = -EFAULT;
+                break;
+            }
+        }
+
+        if ( l4 )
+            unmap_domain_page(l4);
+
+        /* The paging mode's hooks mustn't be called with the lock held. */
+        paging_unlock(d);
+        if ( nr )
+            ld->ops->clean_pfns(d, batch, nr);
+        paging_lock(d);
+
+        found += nr;
+
+        if ( rv )
+            goto out;
+
+        if ( found < sc->nr_dirty_pfns && ld->ring.cons != ld->ring.prod &&
+             hypercall_preempt_check() )
+        {
+            d->arch.paging.preempt.dom = current->domain;
+            d->arch.paging.preempt.op = sc->op;
+            d->arch.paging.preempt.log_dirty.found = found;
+            paging_unlock(d);
+            return -ERESTART;
+        }
+    }
+
+    sc->nr_dirty_pfns = found;
+    sc->stats.dirty_count = min(found, UINT32_MAX + 0UL);
+
+ out:
+    d->arch.paging.preempt.dom = NULL;
+    paging_unlock(d);
+    domain_unpause(d);
+
+    return rv;
+}
+
 #ifdef CONFIG_HVM
 void paging_log_dirty_range(struct domain *d,
                            unsigned long begin_pfn,
@@ -728,7 +994,9 @@ int paging_domctl(struct domain *d, struct xen_domctl_shadow_op *sc,
             break;
         fallthrough;
     case XEN_DOMCTL_SHADOW_OP_ENABLE_LOGDIRTY:
-        return paging_log_dirty_enable(d);
+        return paging_log_dirty_enable(
+            d, (sc->op == XEN_DOMCTL_SHADOW_OP_ENABLE &&
+                (sc->mode & XEN_DOMCTL_SHADOW_ENABLE_DIRTY_RING)));
 
     case XEN_DOMCTL_SHADOW_OP_OFF:
         if ( (rc = paging_log_dirty_disable(d, resuming)) != 0 )
@@ -737,7 +1005,24 @@ int paging_domctl(struct domain *d, struct xen_domctl_shadow_op *sc,
 
     case XEN_DOMCTL_SHADOW_OP_CLEAN:
     case XEN_DOMCTL_SHADOW_OP_PEEK:
-        if ( sc->mode & ~XEN_DOMCTL_SHADOW_LOGDIRTY_FINAL )
+        if ( sc->mode & ~(XEN_DOMCTL_SHADOW_LOGDIRTY_FINAL |
+                          XEN_DOMCTL_SHADOW_LOGDIRTY_RANGE |
+                          XEN_DOMCTL_SHADOW_LOGDIRTY_PFN_LIST |
+                          XEN_DOMCTL_SHADOW_LOGDIRTY_RING) )
+            return -EINVAL;
+        if ( sc->mode & XEN_DOMCTL_SHADOW_LOGDIRTY_RING )
+        {
+            if ( sc->op != XEN_DOMCTL_SHADOW_OP_CLEAN ||
+                 (sc->mode & (XEN_DOMCTL_SHADOW_LOGDIRTY_RANGE |
+                              XEN_DOMCTL_SHADOW_LOGDIRTY_PFN_LIST)) !=
+                 XEN_DOMCTL_SHADOW_LOGDIRTY_PFN_LIST )
+                return -EINVAL;
+            return paging_log_dirty_drain(d, sc, resuming);
+        }
+        /* Ranges copied out as a bitmap start on a byte of it. */
+        if ( (sc->mode & (XEN_DOMCTL_SHADOW_LOGDIRTY_RANGE |
+                          XEN_DOMCTL_SHADOW_LOGDIRTY_PFN_LIST)) ==
+             XEN_DOMCTL_SHADOW_LOGDIRTY_RANGE && (sc->start_pfn & 7) )
             return -EINVAL;
         return paging_log_dirty_op(d, sc, resuming);
     }
@@ -819,6 +1104,7 @@ int paging_teardown(struct domain *d)
     rc = paging_free_log_dirty_bitmap(d, 0);
     if ( rc == -ERESTART )
         return rc;
+    paging_free_log_dirty_ring(d);
 #endif
 
     /* Move populate-on-demand cache back to domain_list for destruction */
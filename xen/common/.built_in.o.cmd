@@ -0,0 +1 @@
+cmd_common/built_in.o := ld    -melf_x86_64 --no-warn-rwx-segments -r -o common/built_in.o common/bitmap.o common/bug.o common/config_data.o common/core_parking.o common/cpu.o common/dm.o common/domain.o common/event_2l.o common/event_channel.o common/event_fifo.o common/grant_table.o common/guestcopy.o common/gzip/built_in.o common/hypfs.o common/ioreq.o common/irq.o common/kernel.o common/keyhandler.o common/kexec.o common/kimage.o common/mem_access.o common/memory.o common/multicall.o common/notifier.o common/numa.o common/page_alloc.o common/pdx.o common/preempt.o common/random.o common/rangeset.o common/radix-tree.o common/rcupdate.o common/rwlock.o common/shutdown.o common/softirq.o common/smp.o common/spinlock.o common/stop_machine.o common/symbols.o common/tasklet.o common/time.o common/timer.o common/trace.o common/version.o common/virtual_region.o common/vm_event.o common/vmap.o common/vsprintf.o common/wait.o common/xmalloc_tlsf.o common/compat/domain.o common/compat/memory.o common/compat/multicall.o common/compat/xlat.o common/domctl.o common/monitor.o common/sysctl.o common/sched/built_in.o common/libelf/built_in.o common/bitops.init.o common/warning.init.o common/decompress.init.o common/bunzip2.init.o common/unxz.init.o common/unlzma.init.o common/lzo.init.o common/unlzo.init.o common/unlz4.init.o common/unzstd.init.o common/earlycpio.init.o
@@ -0,0 +1 @@
+cmd_common/config_data.S := /bin/sh ./tools/binfile  common/config_data.S common/config.gz xen_config_data
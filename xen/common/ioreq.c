@@ -24,8 +24,11 @@
 #include <xen/irq.h>
 #include <xen/lib.h>
 #include <xen/paging.h>
+#include <xen/perfc.h>
 #include <xen/sched.h>
+#include <xen/sort.h>
 #include <xen/trace.h>
+#include <xen/xvmalloc.h>
 
 #include <asm/guest_atomics.h>
 #include <asm/ioreq.h>
@@ -258,9 +261,9 @@ bool vcpu_ioreq_handle_completion(struct vcpu *v)
     return res;
 }
 
-static int ioreq_server_alloc_mfn(struct ioreq_server *s, bool buf)
+static int ioreq_server_alloc_mfn(struct ioreq_server *s,
+                                  struct ioreq_page *iorp)
 {
-    struct ioreq_page *iorp = buf ? &s->bufioreq : &s->ioreq;
     struct page_info *page;
 
     if ( iorp->page )
@@ -306,9 +309,9 @@ static int ioreq_server_alloc_mfn(struct ioreq_server *s, bool buf)
     return -ENOMEM;
 }
 
-static void ioreq_server_free_mfn(struct ioreq_server *s, bool buf)
+static void ioreq_server_free_mfn(struct ioreq_server *s,
+                                  struct ioreq_page *iorp)
 {
-    struct ioreq_page *iorp = buf ? &s->bufioreq : &s->ioreq;
     struct page_info *page = iorp->page;
 
     if ( !page )
@@ -333,7 +336,8 @@ bool is_ioreq_server_page(struct domain *d, const struct page_info *page)
 
     FOR_EACH_IOREQ_SERVER(d, id, s)
     {
-        if ( (s->ioreq.page == page) || (s->bufioreq.page == page) )
+        if ( (s->ioreq.page == page) || (s->bufioreq.page == page) ||
+             (s->batch.page == page) )
         {
             found = true;
             break;
@@ -468,21 +472,22 @@ static int ioreq_server_alloc_pages(struct ioreq_server *s)
 {
     int rc;
 
-    rc = ioreq_server_alloc_mfn(s, false);
+    rc = ioreq_server_alloc_mfn(s, &s->ioreq);
 
     if ( !rc && (s->bufioreq_handling != HVM_IOREQSRV_BUFIOREQ_OFF) )
-        rc = ioreq_server_alloc_mfn(s, true);
+        rc = ioreq_server_alloc_mfn(s, &s->bufioreq);
 
     if ( rc )
-        ioreq_server_free_mfn(s, false);
+        ioreq_server_free_mfn(s, &s->ioreq);
 
     return rc;
 }
 
 static void ioreq_server_free_pages(struct ioreq_server *s)
 {
-    ioreq_server_free_mfn(s, true);
-    ioreq_server_free_mfn(s, false);
+    ioreq_server_free_mfn(s, &s->batch);
+    ioreq_server_free_mfn(s, &s->bufioreq);
+    ioreq_server_free_mfn(s, &s->ioreq);
 }
 
 static void ioreq_server_free_rangesets(struct ioreq_server *s)
@@ -592,6 +597,7 @@ static int ioreq_server_init(struct ioreq_server *s,
 
     s->ioreq.gfn = INVALID_GFN;
     s->bufioreq.gfn = INVALID_GFN;
+    s->batch.gfn = INVALID_GFN;
 
     rc = ioreq_server_alloc_rangesets(s, id);
     if ( rc )
@@ -640,6 +646,277 @@ static void ioreq_server_deinit(struct ioreq_server *s)
     put_domain(s->emulator);
 }
 
+/*
+ * Routing of I/O accesses to the ioreq servers.
+ *
+ * The ranges of all servers are merged into one sorted array per range type,
+ * splitting the I/O space into parts claimed by a fixed set of servers.  The
+ * ranges of different servers may overlap, so each part has a bitmap of the
+ * ids of the servers claiming it.  The map is rebuilt whenever the ranges of
+ * a server change, and each vCPU remembers the part it looked up last.
+ */
+struct ioreq_route {
+    unsigned long s, e;
+    unsigned int servers;
+};
+
+struct ioreq_route_map {
+    unsigned int nr[NR_IO_RANGE_TYPES];
+    struct ioreq_route *route[NR_IO_RANGE_TYPES];
+};
+
+/* Start or end of a range of a server. */
+struct ioreq_route_edge {
+    unsigned long pos;
+    unsigned int id;
+};
+
+struct ioreq_route_edges {
+    struct ioreq_route_edge *edge;
+    unsigned int nr;
+    unsigned int id;
+};
+
+static int cf_check route_count_edges(unsigned long s, unsigned long e,
+                                      void *ctxt)
+{
+    unsigned int *nr = ctxt;
+
+    *nr += (e == ~0UL) ? 1 : 2;
+
+    return 0;
+}
+
+static int cf_check route_add_edges(unsigned long s, unsigned long e,
+                                    void *ctxt)
+{
+    struct ioreq_route_edges *edges = ctxt;
+
+    edges->edge[edges->nr].pos = s;
+    edges->edge[edges->nr++].id = edges->id;
+
+    /* A range up to the end of the I/O space has no end. */
+    if ( e != ~0UL )
+    {
+        edges->edge[edges->nr].pos = e + 1;
+        edges->edge[edges->nr++].id = edges->id;
+    }
+
+    return 0;
+}
+
+static int cf_check route_edge_cmp(const void *a, const void *b)
+{
+    const struct ioreq_route_edge *x = a, *y = b;
+
+    return (x->pos > y->pos) - (x->pos < y->pos);
+}
+
+static void cf_check route_edge_swap(void *a, void *b, size_t size)
+{
+    SWAP(*(struct ioreq_route_edge *)a, *(struct ioreq_route_edge *)b);
+}
+
+static int ioreq_route_build(struct domain *d, unsigned int type,
+                             struct ioreq_route_map *map)
+{
+    struct ioreq_route_edges edges = {};
+    struct ioreq_route *route;
+    struct ioreq_server *s;
+    unsigned int id, i, n = 0, nr = 0, servers = 0;
+
+    FOR_EACH_IOREQ_SERVER(d, id, s)
+        rangeset_report_ranges(s->range[type], 0, ~0UL, route_count_edges,
+                               &n);
+
+    if ( !n )
+        return 0;
+
+    edges.edge = xvmalloc_array(struct ioreq_route_edge, n);
+    route = xvmalloc_array(struct ioreq_route, n);
+    if ( !edges.edge || !route )
+    {
+        xvfree(edges.edge);
+        xvfree(route);
+        return -ENOMEM;
+    }
+
+    FOR_EACH_IOREQ_SERVER(d, id, s)
+    {
+        edges.id = id;
+        rangeset_report_ranges(s->range[type], 0, ~0UL, route_add_edges,
+                               &edges);
+    }
+    ASSERT(edges.nr == n);
+
+    sort(edges.edge, n, sizeof(*edges.edge), route_edge_cmp,
+         route_edge_swap);
+
+    for ( i = 0; i < n; )
+    {
+        unsigned long pos = edges.edge[i].pos;
+
+        /* The ranges of a server don't overlap: each edge toggles its id. */
+        for ( ; i < n && edges.edge[i].pos == pos; i++ )
+            servers ^= 1U << edges.edge[i].id;
+
+        if ( !servers )
+            continue;
+
+        if ( !nr || route[nr - 1].servers != servers ||
+             route[nr - 1].e + 1 != pos )
+        {
+            route[nr].s = pos;
+            route[nr].servers = servers;
+            nr++;
+        }
+        route[nr - 1].e = (i < n) ? edges.edge[i].pos - 1 : ~0UL;
+    }
+
+    xvfree(edges.edge);
+
+    map->route[type] = route;
+    map->nr[type] = nr;
+
+    return 0;
+}
+
+static void ioreq_route_free(struct ioreq_route_map *map)
+{
+    unsigned int type;
+
+    if ( !map )
+        return;
+
+    for ( type = 0; type < NR_IO_RANGE_TYPES; type++ )
+        xvfree(map->route[type]);
+
+    xfree(map);
+}
+
+/* Called with ioreq_server lock held, after the ranges of a server changed. */
+static void ioreq_route_update(struct domain *d)
+{
+    struct ioreq_route_map *map = xzalloc(struct ioreq_route_map), *old;
+    unsigned int type;
+
+    perfc_incr(ioreq_route_rebuild);
+
+    for ( type = 0; map && type < NR_IO_RANGE_TYPES; type++ )
+    {
+        if ( ioreq_route_build(d, type, map) )
+        {
+            ioreq_route_free(map);
+            map = NULL;
+        }
+    }
+
+    /* Without a map, ioreq_server_select() checks the servers one by one. */
+    write_lock(&d->ioreq_server.route_lock);
+
+    old = d->ioreq_server.route;
+    d->ioreq_server.route = map;
+
+    /* Invalidate the cached lookups.  Generation 0 is never valid. */
+    if ( !++d->ioreq_server.route_gen )
+        d->ioreq_server.route_gen = 1;
+
+    write_unlock(&d->ioreq_server.route_lock);
+
+    ioreq_route_free(old);
+}
+
+/*
+ * Return the bitmap of the ids of the servers claiming all of start ... end,
+ * or -1 if there's no routing map.
+ */
+static int ioreq_route_lookup(struct domain *d, uint8_t type,
+                              unsigned long start, unsigned long end)
+{
+    struct vcpu *curr = current;
+    typeof(curr->io.route_cache) *cache = &curr->io.route_cache;
+    const struct ioreq_route_map *map;
+    const struct ioreq_route *route;
+    unsigned long s, e;
+    unsigned int lo, hi, i, nr, servers;
+    bool cacheable;
+
+    BUILD_BUG_ON(MAX_NR_IOREQ_SERVERS > 8 * sizeof(cache->servers));
+
+    if ( curr->domain == d &&
+         cache->gen == ACCESS_ONCE(d->ioreq_server.route_gen) &&
+         cache->type == type && cache->s <= start && end <= cache->e )
+    {
+        perfc_incr(ioreq_route_hit);
+        return cache->servers;
+    }
+
+    read_lock(&d->ioreq_server.route_lock);
+
+    map = d->ioreq_server.route;
+    if ( !map )
+    {
+        read_unlock(&d->ioreq_server.route_lock);
+        return -1;
+    }
+
+    perfc_incr(ioreq_route_lookup);
+
+    route = map->route[type];
+    nr = map->nr[type];
+
+    /* Find the number of parts starting at or below start. */
+    for ( lo = 0, hi = nr; lo < hi; )
+    {
+        i = lo + (hi - lo) / 2;
+        if ( route[i].s <= start )
+            lo = i + 1;
+        else
+            hi = i;
+    }
+
+    if ( lo && route[lo - 1].e >= start )
+    {
+        i = lo - 1;
+        s = route[i].s;
+        e = route[i].e;
+        servers = route[i].servers;
+
+        /* An access spanning several parts must be claimed for all of them. */
+        while ( servers && end > route[i].e )
+        {
+            if ( i + 1 == nr || route[i + 1].s != route[i].e + 1 )
+                servers = 0;
+            else
+                servers &= route[++i].servers;
+        }
+
+        cacheable = (i == lo - 1) && end <= e;
+    }
+    else
+    {
+        /* In a gap between the parts. */
+        s = lo ? route[lo - 1].e + 1 : 0;
+        e = (lo < nr) ? route[lo].s - 1 : ~0UL;
+        servers = 0;
+
+        cacheable = end <= e;
+    }
+
+    if ( cacheable && curr->domain == d )
+    {
+        cache->gen = d->ioreq_server.route_gen;
+        cache->type = type;
+        cache->servers = servers;
+        cache->s = s;
+        cache->e = e;
+    }
+
+    read_unlock(&d->ioreq_server.route_lock);
+
+    return servers;
+}
+
 static int ioreq_server_create(struct domain *d, int bufioreq_handling,
                                ioservid_t *id)
 {
@@ -729,6 +1006,8 @@ static int ioreq_server_destroy(struct domain *d, ioservid_t id)
     ioreq_server_deinit(s);
     set_ioreq_server(d, id, NULL);
 
+    ioreq_route_update(d);
+
     domain_unpause(d);
 
     xfree(s);
@@ -828,6 +1107,15 @@ int ioreq_server_get_frame(struct domain *d, ioservid_t id,
         rc = 0;
         break;
 
+    case XENMEM_resource_ioreq_server_frame_batch:
+        rc = -ENOENT;
+        if ( !s->batch.page )
+            goto out;
+
+        *mfn = page_to_mfn(s->batch.page);
+        rc = 0;
+        break;
+
     default:
         rc = -EINVAL;
         break;
@@ -884,6 +1172,8 @@ static int ioreq_server_map_io_range(struct domain *d, ioservid_t id,
         goto out;
 
     rc = rangeset_add_range(r, start, end);
+    if ( !rc )
+        ioreq_route_update(d);
 
  out:
     rspin_unlock(&d->ioreq_server.lock);
@@ -936,6 +1226,8 @@ static int ioreq_server_unmap_io_range(struct domain *d, ioservid_t id,
         goto out;
 
     rc = rangeset_remove_range(r, start, end);
+    if ( !rc )
+        ioreq_route_update(d);
 
  out:
     rspin_unlock(&d->ioreq_server.lock);
@@ -1020,6 +1312,54 @@ static int ioreq_server_set_state(struct domain *d, ioservid_t id,
     return rc;
 }
 
+static int ioreq_server_set_batch(struct domain *d, ioservid_t id,
+                                  uint32_t *nr_slots)
+{
+    struct ioreq_server *s;
+    unsigned int max_slots;
+    int rc;
+
+    rspin_lock(&d->ioreq_server.lock);
+
+    s = get_ioreq_server(d, id);
+
+    rc = -ENOENT;
+    if ( !s )
+        goto out;
+
+    rc = -EPERM;
+    if ( s->emulator != current->domain )
+        goto out;
+
+    rc = -EBUSY;
+    if ( s->enabled )
+        goto out;
+
+    /* All slots of all vCPUs have to fit in the single batch frame. */
+    max_slots = PAGE_SIZE / (d->max_vcpus * sizeof(ioreq_t));
+
+    if ( *nr_slots && max_slots )
+    {
+        /*
+         * The batch frame can only be mapped via XENMEM_acquire_resource,
+         * so commit the server to that by allocating its other pages too.
+         */
+        rc = ioreq_server_alloc_pages(s);
+        if ( !rc )
+            rc = ioreq_server_alloc_mfn(s, &s->batch);
+        if ( rc )
+            goto out;
+    }
+
+    s->batch_slots = min(*nr_slots, max_slots);
+    *nr_slots = s->batch_slots;
+    rc = 0;
+
+ out:
+    rspin_unlock(&d->ioreq_server.lock);
+    return rc;
+}
+
 int ioreq_server_add_vcpu_all(struct domain *d, struct vcpu *v)
 {
     struct ioreq_server *s;
@@ -1094,6 +1434,9 @@ void ioreq_server_destroy_all(struct domain *d)
         xfree(s);
     }
 
+    ioreq_route_free(d->ioreq_server.route);
+    d->ioreq_server.route = NULL;
+
     rspin_unlock(&d->ioreq_server.lock);
 }
 
@@ -1103,54 +1446,68 @@ struct ioreq_server *ioreq_server_select(struct domain *d,
     struct ioreq_server *s;
     uint8_t type;
     uint64_t addr;
+    unsigned long start, end;
     unsigned int id;
+    int servers;
 
     if ( !arch_ioreq_server_get_type_addr(d, p, &type, &addr) )
         return NULL;
 
-    FOR_EACH_IOREQ_SERVER(d, id, s)
+    switch ( type )
     {
-        struct rangeset *r;
+    case XEN_DMOP_IO_RANGE_PORT:
+        start = addr;
+        end = start + p->size - 1;
+        break;
 
-        if ( !s->enabled )
-            continue;
+    case XEN_DMOP_IO_RANGE_MEMORY:
+        start = ioreq_mmio_first_byte(p);
+        end = ioreq_mmio_last_byte(p);
+        break;
 
-        r = s->range[type];
+    case XEN_DMOP_IO_RANGE_PCI:
+        start = end = addr >> 32;
+        break;
 
-        switch ( type )
-        {
-            unsigned long start, end;
+    default:
+        ASSERT_UNREACHABLE();
+        return NULL;
+    }
 
-        case XEN_DMOP_IO_RANGE_PORT:
-            start = addr;
-            end = start + p->size - 1;
-            if ( rangeset_contains_range(r, start, end) )
-                return s;
+    servers = ioreq_route_lookup(d, type, start, end);
+    if ( servers < 0 )
+    {
+        perfc_incr(ioreq_route_fallback);
 
-            break;
+        FOR_EACH_IOREQ_SERVER(d, id, s)
+            if ( s->enabled &&
+                 rangeset_contains_range(s->range[type], start, end) )
+                goto found;
 
-        case XEN_DMOP_IO_RANGE_MEMORY:
-            start = ioreq_mmio_first_byte(p);
-            end = ioreq_mmio_last_byte(p);
+        return NULL;
+    }
 
-            if ( rangeset_contains_range(r, start, end) )
-                return s;
+    /* Favour the most recently created server, as FOR_EACH_IOREQ_SERVER. */
+    while ( servers )
+    {
+        id = fls(servers) - 1;
+        servers &= ~(1U << id);
 
-            break;
+        s = GET_IOREQ_SERVER(d, id);
+        if ( s && s->enabled )
+            goto found;
+    }
 
-        case XEN_DMOP_IO_RANGE_PCI:
-            if ( rangeset_contains_singleton(r, addr >> 32) )
-            {
-                p->type = IOREQ_TYPE_PCI_CONFIG;
-                p->addr = addr;
-                return s;
-            }
+    return NULL;
 
-            break;
-        }
+ found:
+    if ( type == XEN_DMOP_IO_RANGE_PCI )
+    {
+        p->type = IOREQ_TYPE_PCI_CONFIG;
+        p->addr = addr;
     }
 
-    return NULL;
+    return s;
 }
 
 static int ioreq_send_buffered(struct ioreq_server *s, ioreq_t *p)
@@ -1248,6 +1605,22 @@ static int ioreq_send_buffered(struct ioreq_server *s, ioreq_t *p)
 
 int ioreq_send(struct ioreq_server *s, ioreq_t *proto_p,
                bool buffered)
+{
+    ASSERT(s);
+
+    if ( buffered )
+        return ioreq_send_buffered(s, proto_p);
+
+    return ioreq_send_batch(s, proto_p, NULL, 0);
+}
+
+/*
+ * Send a synchronous request, followed by <nr> further requests in the
+ * batch slots of the server.  The caller has to make sure they are all
+ * data_is_ptr requests, which need no completion.
+ */
+int ioreq_send_batch(struct ioreq_server *s, ioreq_t *proto_p,
+                     const ioreq_t *batch, unsigned int nr)
 {
     struct vcpu *curr = current;
     struct domain *d = curr->domain;
@@ -1255,9 +1628,7 @@ int ioreq_send(struct ioreq_server *s, ioreq_t *proto_p,
     struct vcpu_io *vio = &curr->io;
 
     ASSERT(s);
-
-    if ( buffered )
-        return ioreq_send_buffered(s, proto_p);
+    ASSERT(nr <= s->batch_slots);
 
     if ( unlikely(!vcpu_start_shutdown_deferral(curr)) )
     {
@@ -1290,8 +1661,29 @@ int ioreq_send(struct ioreq_server *s, ioreq_t *proto_p,
 
             proto_p->state = STATE_IOREQ_NONE;
             proto_p->vp_eport = port;
+            proto_p->batch = nr;
             *p = *proto_p;
 
+            if ( nr )
+            {
+                ioreq_t *slot = (ioreq_t *)s->batch.va +
+                                curr->vcpu_id * s->batch_slots;
+                unsigned int i;
+
+                for ( i = 0; i < nr; i++ )
+                {
+                    ASSERT(batch[i].data_is_ptr);
+
+                    slot[i] = batch[i];
+                    slot[i].state = STATE_IOREQ_READY;
+                    slot[i].vp_eport = port;
+                    slot[i].batch = 0;
+                }
+
+                perfc_incr(ioreq_batch_send);
+                perfc_add(ioreq_batch_slots, nr);
+            }
+
             prepare_wait_on_xen_event_channel(port);
 
             /*
@@ -1332,6 +1724,8 @@ unsigned int ioreq_broadcast(ioreq_t *p, bool buffered)
 void ioreq_domain_init(struct domain *d)
 {
     rspin_lock_init(&d->ioreq_server.lock);
+    rwlock_init(&d->ioreq_server.route_lock);
+    d->ioreq_server.route_gen = 1;
 
     arch_ioreq_domain_init(d);
 }
@@ -1433,6 +1827,21 @@ int ioreq_server_dm_op(struct xen_dm_op *op, struct domain *d, bool *const_op)
         break;
     }
 
+    case XEN_DMOP_set_ioreq_server_batch:
+    {
+        struct xen_dm_op_set_ioreq_server_batch *data =
+            &op->u.set_ioreq_server_batch;
+
+        *const_op = false;
+
+        rc = -EINVAL;
+        if ( data->pad )
+            break;
+
+        rc = ioreq_server_set_batch(d, data->id, &data->nr_slots);
+        break;
+    }
+
     default:
         rc = -EOPNOTSUPP;
         break;
@@ -1128,7 +1128,10 @@ static unsigned int ioreq_server_max_frames(const struct domain *d)
 
 #ifdef CONFIG_IOREQ_SERVER
     if ( is_hvm_domain(d) )
-        /* One frame for the buf-ioreq ring, and one frame per 128 vcpus. */
+        /*
+         * One frame for the buf-ioreq ring, and one frame per 128 vcpus.
+         * The batch slot frame lives at a fixed index outside this range.
+         */
         nr = 1 + DIV_ROUND_UP(d->max_vcpus * sizeof(struct ioreq), PAGE_SIZE);
 #endif
 
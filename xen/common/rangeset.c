@@ -10,11 +10,15 @@
 #include <xen/sched.h>
 #include <xen/errno.h>
 #include <xen/rangeset.h>
+#include <xen/rbtree.h>
 #include <xsm/xsm.h>
 
-/* An inclusive range [s,e] and pointer to next range in ascending order. */
+/*
+ * An inclusive range [s,e].  The ranges of a set never overlap, so they are
+ * kept in a tree ordered by their start.
+ */
 struct range {
-    struct list_head list;
+    struct rb_node node;
     unsigned long s, e;
 };
 
@@ -23,8 +27,8 @@ struct rangeset {
     struct list_head rangeset_list;
     struct domain   *domain;
 
-    /* Ordered list of ranges contained in this set, and protecting lock. */
-    struct list_head range_list;
+    /* Ordered tree of ranges contained in this set, and protecting lock. */
+    struct rb_root   range_tree;
 
     /* Number of ranges that can be allocated */
     long             nr_ranges;
@@ -38,20 +42,26 @@ struct rangeset {
 };
 
 /*****************************
- * Private range functions hide the underlying linked-list implemnetation.
+ * Private range functions hide the underlying red-black tree implementation.
  */
 
 /* Find highest range lower than or containing s. NULL if no such range. */
 static struct range *find_range(
     struct rangeset *r, unsigned long s)
 {
+    struct rb_node *n = r->range_tree.rb_node;
     struct range *x = NULL, *y;
 
-    list_for_each_entry ( y, &r->range_list, list )
+    while ( n != NULL )
     {
+        y = rb_entry(n, struct range, node);
         if ( y->s > s )
-            break;
-        x = y;
+            n = n->rb_left;
+        else
+        {
+            x = y;
+            n = n->rb_right;
+        }
     }
 
     return x;
@@ -61,34 +71,46 @@ static struct range *find_range(
 static struct range *first_range(
     struct rangeset *r)
 {
-    if ( list_empty(&r->range_list) )
-        return NULL;
-    return list_entry(r->range_list.next, struct range, list);
+    struct rb_node *n = rb_first(&r->range_tree);
+
+    return n ? rb_entry(n, struct range, node) : NULL;
 }
 
 /* Return range following x in ascending order, or NULL if x is the highest. */
 static struct range *next_range(
     struct rangeset *r, struct range *x)
 {
-    if ( x->list.next == &r->range_list )
-        return NULL;
-    return list_entry(x->list.next, struct range, list);
+    struct rb_node *n = rb_next(&x->node);
+
+    return n ? rb_entry(n, struct range, node) : NULL;
 }
 
 /* Insert range y after range x in r. Insert as first range if x is NULL. */
 static void insert_range(
     struct rangeset *r, struct range *x, struct range *y)
 {
-    list_add(&y->list, (x != NULL) ? &x->list : &r->range_list);
+    struct rb_node *parent = (x != NULL) ? &x->node : NULL;
+    struct rb_node **link = (x != NULL) ? &x->node.rb_right
+                                        : &r->range_tree.rb_node;
+
+    /* y becomes the leftmost node of the subtree following x. */
+    while ( *link != NULL )
+    {
+        parent = *link;
+        link = &parent->rb_left;
+    }
+
+    rb_link_node(&y->node, parent, link);
+    rb_insert_color(&y->node, &r->range_tree);
 }
 
-/* Remove a range from its list and free it. */
+/* Remove a range from its tree and free it. */
 static void destroy_range(
     struct rangeset *r, struct range *x)
 {
     r->nr_ranges++;
 
-    list_del(&x->list);
+    rb_erase(&x->node, &r->range_tree);
     xfree(x);
 }
 
@@ -224,6 +246,8 @@ int rangeset_remove_range(
     {
         if ( x == NULL )
             x = first_range(r);
+        else if ( x->e < s )
+            x = next_range(r, x);
 
         if ( x->s < s )
         {
@@ -295,7 +319,9 @@ int rangeset_report_ranges(
 
     read_lock(&r->lock);
 
-    for ( x = first_range(r); x && (x->s <= e) && !rc; x = next_range(r, x) )
+    for ( x = find_range(r, s) ?: first_range(r);
+          x && (x->s <= e) && !rc;
+          x = next_range(r, x) )
         if ( x->e >= s )
             rc = cb(max(x->s, s), min(x->e, e), ctxt);
 
@@ -345,10 +371,19 @@ int rangeset_claim_range(struct rangeset *r, unsigned long size,
         next->s = start;
         next->e = start + size - 1;
         insert_range(r, prev, next);
+        prev = next;
     }
     else
         prev->e += size;
 
+    /* Merge with the following range if the gap has been filled. */
+    next = next_range(r, prev);
+    if ( next && (prev->e + 1) == next->s )
+    {
+        prev->e = next->e;
+        destroy_range(r, next);
+    }
+
     write_unlock(&r->lock);
 
     *s = start;
@@ -417,7 +452,7 @@ bool rangeset_contains_singleton(
 bool rangeset_is_empty(
     const struct rangeset *r)
 {
-    return ((r == NULL) || list_empty(&r->range_list));
+    return ((r == NULL) || RB_EMPTY_ROOT(&r->range_tree));
 }
 
 struct rangeset *rangeset_new(
@@ -430,7 +465,7 @@ struct rangeset *rangeset_new(
         return NULL;
 
     rwlock_init(&r->lock);
-    INIT_LIST_HEAD(&r->range_list);
+    r->range_tree = RB_ROOT;
     r->nr_ranges = -1;
 
     BUG_ON(flags & ~(RANGESETF_prettyprint_hex | RANGESETF_no_print));
@@ -512,7 +547,7 @@ void rangeset_domain_destroy(
 
 void rangeset_swap(struct rangeset *a, struct rangeset *b)
 {
-    LIST_HEAD(tmp);
+    struct rb_root tmp;
 
     if ( a < b )
     {
@@ -525,9 +560,9 @@ void rangeset_swap(struct rangeset *a, struct rangeset *b)
         write_lock(&a->lock);
     }
 
-    list_splice_init(&a->range_list, &tmp);
-    list_splice_init(&b->range_list, &a->range_list);
-    list_splice(&tmp, &b->range_list);
+    tmp = a->range_tree;
+    a->range_tree = b->range_tree;
+    b->range_tree = tmp;
 
     write_unlock(&a->lock);
     write_unlock(&b->lock);
@@ -0,0 +1 @@
+cmd_common/sched/built_in.o := ld    -melf_x86_64 --no-warn-rwx-segments -r -o common/sched/built_in.o common/sched/cpupool.o common/sched/arinc653.o common/sched/credit.o common/sched/credit2.o common/sched/rt.o common/sched/null.o common/sched/core.o
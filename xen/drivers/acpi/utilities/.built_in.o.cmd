@@ -0,0 +1 @@
+cmd_drivers/acpi/utilities/built_in.o := ld    -melf_x86_64 --no-warn-rwx-segments -r -o drivers/acpi/utilities/built_in.o drivers/acpi/utilities/utglobal.o drivers/acpi/utilities/utmisc.init.o
@@ -0,0 +1 @@
+cmd_drivers/char/built_in.o := ld    -melf_x86_64 --no-warn-rwx-segments -r -o drivers/char/built_in.o drivers/char/console.o drivers/char/ns16550.o drivers/char/ehci-dbgp.o drivers/char/serial.o
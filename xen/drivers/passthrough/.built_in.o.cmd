@@ -0,0 +1 @@
+cmd_drivers/passthrough/built_in.o := ld    -melf_x86_64 --no-warn-rwx-segments -r -o drivers/passthrough/built_in.o drivers/passthrough/vtd/built_in.o drivers/passthrough/amd/built_in.o drivers/passthrough/x86/built_in.o drivers/passthrough/iommu.o drivers/passthrough/pci.o drivers/passthrough/ats.o drivers/passthrough/msi.o
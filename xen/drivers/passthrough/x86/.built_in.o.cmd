@@ -0,0 +1 @@
+cmd_drivers/passthrough/x86/built_in.o := ld    -melf_x86_64 --no-warn-rwx-segments -r -o drivers/passthrough/x86/built_in.o drivers/passthrough/x86/iommu.o drivers/passthrough/x86/hvm.o
@@ -108,6 +108,8 @@ void vpci_deassign_device(struct pci_dev *pdev)
         list_del(&r->node);
         xfree(r);
     }
+    for ( i = 0; i < ARRAY_SIZE(pdev->vpci->map); i++ )
+        XFREE(pdev->vpci->map[i]);
     spin_unlock(&pdev->vpci->lock);
     if ( pdev->vpci->msix )
     {
@@ -190,6 +192,36 @@ static int vpci_register_cmp(const struct vpci_register *r1,
     return 0;
 }
 
+/* Slot of the register map for the dword containing offset. */
+static struct vpci_register **vpci_map_slot(const struct vpci *vpci,
+                                            unsigned int offset)
+{
+    struct vpci_register **chunk = vpci->map[offset / 4 / VPCI_MAP_CHUNK];
+
+    return chunk ? &chunk[(offset / 4) % VPCI_MAP_CHUNK] : NULL;
+}
+
+/*
+ * First handler which may overlap an access, to start the walk of the
+ * sorted list of handlers from.  If there is none, this is the entry of
+ * the list head, ending the walk straight away.
+ */
+static const struct vpci_register *vpci_first_register(
+    const struct vpci *vpci, unsigned int reg, unsigned int size)
+{
+    unsigned int offset;
+
+    for ( offset = reg & ~3; offset < reg + size; offset += 4 )
+    {
+        struct vpci_register **slot = vpci_map_slot(vpci, offset);
+
+        if ( slot && *slot )
+            return *slot;
+    }
+
+    return list_entry(&vpci->handlers, const struct vpci_register, node);
+}
+
 /* Dummy hooks, writes are ignored, reads return 1's */
 static uint32_t cf_check vpci_ignored_read(
     const struct pci_dev *pdev, unsigned int reg, void *data)
@@ -239,7 +271,8 @@ int vpci_add_register_mask(struct vpci *vpci, vpci_read_t *read_handler,
                            uint32_t rsvdz_mask)
 {
     struct list_head *prev;
-    struct vpci_register *r;
+    struct vpci_register *r, **slot, **chunk = NULL;
+    unsigned int idx = offset / 4 / VPCI_MAP_CHUNK;
 
     /* Some sanity checks. */
     if ( (size != 1 && size != 2 && size != 4) ||
@@ -258,6 +291,16 @@ int vpci_add_register_mask(struct vpci *vpci, vpci_read_t *read_handler,
     if ( !r )
         return -ENOMEM;
 
+    if ( !vpci->map[idx] )
+    {
+        chunk = xzalloc_array(struct vpci_register *, VPCI_MAP_CHUNK);
+        if ( !chunk )
+        {
+            xfree(r);
+            return -ENOMEM;
+        }
+    }
+
     r->read = read_handler ?: vpci_ignored_read;
     r->write = write_handler ?: vpci_ignored_write;
     r->size = size;
@@ -282,13 +325,25 @@ int vpci_add_register_mask(struct vpci *vpci, vpci_read_t *read_handler,
         if ( cmp == 0 )
         {
             spin_unlock(&vpci->lock);
+            xfree(chunk);
             xfree(r);
             return -EEXIST;
         }
     }
 
     list_add_tail(&r->node, prev);
+
+    if ( !vpci->map[idx] )
+    {
+        vpci->map[idx] = chunk;
+        chunk = NULL;
+    }
+    slot = vpci_map_slot(vpci, offset);
+    if ( !*slot || r->offset < (*slot)->offset )
+        *slot = r;
+
     spin_unlock(&vpci->lock);
+    xfree(chunk);
 
     return 0;
 }
@@ -310,6 +365,17 @@ int vpci_remove_register(struct vpci *vpci, unsigned int offset,
          */
         if ( !cmp && rm->offset == offset && rm->size == size )
         {
+            struct vpci_register **slot = vpci_map_slot(vpci, offset);
+
+            if ( *slot == rm )
+            {
+                struct vpci_register *next =
+                    list_is_last(&rm->node, &vpci->handlers) ? NULL
+                    : list_next_entry(rm, node);
+
+                *slot = next && next->offset / 4 == offset / 4 ? next : NULL;
+            }
+
             list_del(&rm->node);
             spin_unlock(&vpci->lock);
             xfree(rm);
@@ -465,7 +531,8 @@ uint32_t vpci_read(pci_sbdf_t sbdf, unsigned int reg, unsigned int size)
     spin_lock(&pdev->vpci->lock);
 
     /* Read from the hardware or the emulated register handlers. */
-    list_for_each_entry ( r, &pdev->vpci->handlers, node )
+    r = vpci_first_register(pdev->vpci, reg, size);
+    list_for_each_entry_from ( r, &pdev->vpci->handlers, node )
     {
         const struct vpci_register emu = {
             .offset = reg + data_offset,
@@ -589,7 +656,8 @@ void vpci_write(pci_sbdf_t sbdf, unsigned int reg, unsigned int size,
     spin_lock(&pdev->vpci->lock);
 
     /* Write the value to the hardware or emulated registers. */
-    list_for_each_entry ( r, &pdev->vpci->handlers, node )
+    r = vpci_first_register(pdev->vpci, reg, size);
+    list_for_each_entry_from ( r, &pdev->vpci->handlers, node )
     {
         const struct vpci_register emu = {
             .offset = reg + data_offset,
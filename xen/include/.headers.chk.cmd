@@ -0,0 +1 @@
+cmd_include/headers.chk := for i in include/public/argo.h include/public/callback.h include/public/device_tree_defs.h include/public/elfnote.h include/public/errno.h include/public/event_channel.h include/public/features.h include/public/grant_table.h include/public/hypfs.h include/public/kexec.h include/public/memory.h include/public/nmi.h include/public/physdev.h include/public/platform.h include/public/pmu.h include/public/sched.h include/public/tmem.h include/public/trace.h include/public/vcpu.h include/public/version.h include/public/vm_event.h include/public/xen-compat.h include/public/xen.h include/public/xencomm.h include/public/xenoprof.h include/public/hvm/dm_op.h include/public/hvm/e820.h include/public/hvm/hvm_info_table.h include/public/hvm/hvm_op.h include/public/hvm/hvm_vcpu.h include/public/hvm/hvm_xs_strings.h include/public/hvm/ioreq.h include/public/hvm/params.h include/public/hvm/pvdrivers.h include/public/io/blkif.h include/public/io/cameraif.h include/public/io/console.h include/public/io/displif.h include/public/io/fbif.h include/public/io/fsif.h include/public/io/kbdif.h include/public/io/libxenvchan.h include/public/io/netif.h include/public/io/pciif.h include/public/io/protocols.h include/public/io/ring.h include/public/io/sndif.h include/public/io/tpmif.h include/public/io/usbif.h include/public/io/vscsiif.h include/public/io/xenbus.h include/public/io/xs_wire.h; do gcc -x c -ansi -Wall -Werror -include stdint.h -S -o /dev/null $$i || exit 1; echo $$i; done >include/headers.chk.new; mv include/headers.chk.new include/headers.chk
@@ -0,0 +1 @@
+cmd_include/compat/arch-x86_32.h := /root/.pyenv/shims/python3 ./tools/compat-build-header.py <include/compat/arch-x86_32.i compat/arch-x86_32.h >>include/compat/arch-x86_32.h.new; mv -f include/compat/arch-x86_32.h.new include/compat/arch-x86_32.h
@@ -0,0 +1 @@
+cmd_include/compat/argo.h := echo '/* SAF-9-safe empty header */' >include/compat/argo.h
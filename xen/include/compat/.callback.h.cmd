@@ -0,0 +1 @@
+cmd_include/compat/callback.h := /root/.pyenv/shims/python3 ./tools/compat-build-header.py <include/compat/callback.i compat/callback.h >>include/compat/callback.h.new; mv -f include/compat/callback.h.new include/compat/callback.h
@@ -0,0 +1 @@
+cmd_include/compat/elfnote.c := /root/.pyenv/shims/python3 ./tools/compat-build-source.py ./include/xlat.lst <include/public/elfnote.h >include/compat/elfnote.c.new; mv -f include/compat/elfnote.c.new include/compat/elfnote.c
@@ -0,0 +1 @@
+cmd_include/compat/features.c := /root/.pyenv/shims/python3 ./tools/compat-build-source.py ./include/xlat.lst <include/public/features.h >include/compat/features.c.new; mv -f include/compat/features.c.new include/compat/features.c
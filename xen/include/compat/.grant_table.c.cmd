@@ -0,0 +1 @@
+cmd_include/compat/grant_table.c := /root/.pyenv/shims/python3 ./tools/compat-build-source.py ./include/xlat.lst <include/public/grant_table.h >include/compat/grant_table.c.new; mv -f include/compat/grant_table.c.new include/compat/grant_table.c
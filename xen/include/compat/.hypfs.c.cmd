@@ -0,0 +1 @@
+cmd_include/compat/hypfs.c := /root/.pyenv/shims/python3 ./tools/compat-build-source.py ./include/xlat.lst <include/public/hypfs.h >include/compat/hypfs.c.new; mv -f include/compat/hypfs.c.new include/compat/hypfs.c
@@ -0,0 +1 @@
+cmd_include/compat/memory.c := /root/.pyenv/shims/python3 ./tools/compat-build-source.py ./include/xlat.lst <include/public/memory.h >include/compat/memory.c.new; mv -f include/compat/memory.c.new include/compat/memory.c
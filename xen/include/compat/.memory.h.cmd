@@ -0,0 +1 @@
+cmd_include/compat/memory.h := /root/.pyenv/shims/python3 ./tools/compat-build-header.py <include/compat/memory.i compat/memory.h >>include/compat/memory.h.new; mv -f include/compat/memory.h.new include/compat/memory.h
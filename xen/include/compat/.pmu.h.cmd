@@ -0,0 +1 @@
+cmd_include/compat/pmu.h := /root/.pyenv/shims/python3 ./tools/compat-build-header.py <include/compat/pmu.i compat/pmu.h >>include/compat/pmu.h.new; mv -f include/compat/pmu.h.new include/compat/pmu.h
@@ -0,0 +1 @@
+cmd_include/compat/sched.c := /root/.pyenv/shims/python3 ./tools/compat-build-source.py ./include/xlat.lst <include/public/sched.h >include/compat/sched.c.new; mv -f include/compat/sched.c.new include/compat/sched.c
@@ -0,0 +1 @@
+cmd_include/compat/version.h := /root/.pyenv/shims/python3 ./tools/compat-build-header.py <include/compat/version.i compat/version.h >>include/compat/version.h.new; mv -f include/compat/version.h.new include/compat/version.h
@@ -0,0 +1 @@
+cmd_include/compat/xen.h := /root/.pyenv/shims/python3 ./tools/compat-build-header.py <include/compat/xen.i compat/xen.h >>include/compat/xen.h.new; mv -f include/compat/xen.h.new include/compat/xen.h
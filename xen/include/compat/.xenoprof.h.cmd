@@ -0,0 +1 @@
+cmd_include/compat/xenoprof.h := echo '/* SAF-9-safe empty header */' >include/compat/xenoprof.h
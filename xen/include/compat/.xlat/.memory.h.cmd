@@ -0,0 +1 @@
+cmd_include/compat/.xlat/memory.h := /root/.pyenv/shims/python3 ./tools/compat-xlat-header.py include/compat/memory.h include/compat/.xlat/memory.lst > include/compat/.xlat/memory.h.new; mv -f include/compat/.xlat/memory.h.new include/compat/.xlat/memory.h
@@ -0,0 +1 @@
+cmd_include/compat/.xlat/pmu.h := /root/.pyenv/shims/python3 ./tools/compat-xlat-header.py include/compat/pmu.h include/compat/.xlat/pmu.lst > include/compat/.xlat/pmu.h.new; mv -f include/compat/.xlat/pmu.h.new include/compat/.xlat/pmu.h
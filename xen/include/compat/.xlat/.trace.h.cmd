@@ -0,0 +1 @@
+cmd_include/compat/.xlat/trace.h := /root/.pyenv/shims/python3 ./tools/compat-xlat-header.py include/compat/trace.h include/compat/.xlat/trace.lst > include/compat/.xlat/trace.h.new; mv -f include/compat/.xlat/trace.h.new include/compat/.xlat/trace.h
@@ -0,0 +1 @@
+cmd_include/compat/.xlat/vcpu.h := /root/.pyenv/shims/python3 ./tools/compat-xlat-header.py include/compat/vcpu.h include/compat/.xlat/vcpu.lst > include/compat/.xlat/vcpu.h.new; mv -f include/compat/.xlat/vcpu.h.new include/compat/.xlat/vcpu.h
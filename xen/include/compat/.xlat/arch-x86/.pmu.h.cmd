@@ -0,0 +1 @@
+cmd_include/compat/.xlat/arch-x86/pmu.h := /root/.pyenv/shims/python3 ./tools/compat-xlat-header.py include/compat/arch-x86/pmu.h include/compat/.xlat/arch-x86/pmu.lst > include/compat/.xlat/arch-x86/pmu.h.new; mv -f include/compat/.xlat/arch-x86/pmu.h.new include/compat/.xlat/arch-x86/pmu.h
@@ -0,0 +1 @@
+cmd_include/compat/arch-x86/xen.h := /root/.pyenv/shims/python3 ./tools/compat-build-header.py <include/compat/arch-x86/xen.i compat/arch-x86/xen.h >>include/compat/arch-x86/xen.h.new; mv -f include/compat/arch-x86/xen.h.new include/compat/arch-x86/xen.h
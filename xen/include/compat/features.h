@@ -0,0 +1,5 @@
+#ifndef _COMPAT_FEATURES_H
+#define _COMPAT_FEATURES_H
+#include <xen/compat.h>
+#include <public/features.h>
+#endif /* _COMPAT_FEATURES_H */
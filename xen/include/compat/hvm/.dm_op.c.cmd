@@ -0,0 +1 @@
+cmd_include/compat/hvm/dm_op.c := /root/.pyenv/shims/python3 ./tools/compat-build-source.py ./include/xlat.lst <include/public/hvm/dm_op.h >include/compat/hvm/dm_op.c.new; mv -f include/compat/hvm/dm_op.c.new include/compat/hvm/dm_op.c
@@ -0,0 +1 @@
+cmd_include/compat/hvm/hvm_op.h := /root/.pyenv/shims/python3 ./tools/compat-build-header.py <include/compat/hvm/hvm_op.i compat/hvm/hvm_op.h >>include/compat/hvm/hvm_op.h.new; mv -f include/compat/hvm/hvm_op.h.new include/compat/hvm/hvm_op.h
@@ -0,0 +1,385 @@
+# 0 "include/compat/memory.c"
+# 1 "/root/repo/xen//"
+# 0 "<built-in>"
+# 0 "<command-line>"
+# 1 "./include/public/xen-compat.h" 1
+# 0 "<command-line>" 2
+# 1 "include/compat/memory.c"
+# 13 "include/compat/memory.c"
+__InClUdE__ "xen.h"
+__InClUdE__ "physdev.h"
+# 46 "include/compat/memory.c"
+struct xen_memory_reservation {
+# 60 "include/compat/memory.c"
+    COMPAT_HANDLE(xen_pfn_t) extent_start;
+
+
+    xen_ulong_t nr_extents;
+    unsigned int extent_order;
+
+
+
+    unsigned int mem_flags;
+# 77 "include/compat/memory.c"
+    domid_t domid;
+};
+typedef struct xen_memory_reservation xen_memory_reservation_t;
+DEFINE_COMPAT_HANDLE(xen_memory_reservation_t);
+# 92 "include/compat/memory.c"
+struct xen_memory_exchange {
+
+
+
+
+    struct xen_memory_reservation in;
+# 109 "include/compat/memory.c"
+    struct xen_memory_reservation out;
+# 122 "include/compat/memory.c"
+    xen_ulong_t nr_exchanged;
+};
+typedef struct xen_memory_exchange xen_memory_exchange_t;
+DEFINE_COMPAT_HANDLE(xen_memory_exchange_t);
+# 134 "include/compat/memory.c"
+struct xen_memory_domain {
+
+    domid_t domid;
+};
+# 161 "include/compat/memory.c"
+struct xen_machphys_mfn_list {
+
+
+
+
+    unsigned int max_extents;
+
+
+
+
+
+
+    COMPAT_HANDLE(xen_pfn_t) extent_start;
+
+
+
+
+
+    unsigned int nr_extents;
+};
+typedef struct xen_machphys_mfn_list xen_machphys_mfn_list_t;
+DEFINE_COMPAT_HANDLE(xen_machphys_mfn_list_t);
+# 200 "include/compat/memory.c"
+struct xen_machphys_mapping {
+    xen_ulong_t v_start, v_end;
+    xen_ulong_t max_mfn;
+};
+typedef struct xen_machphys_mapping xen_machphys_mapping_t;
+DEFINE_COMPAT_HANDLE(xen_machphys_mapping_t);
+# 228 "include/compat/memory.c"
+struct xen_add_to_physmap {
+
+    domid_t domid;
+
+
+    uint16_t size;
+
+    unsigned int space;
+
+
+
+
+    xen_ulong_t idx;
+
+
+    xen_pfn_t gpfn;
+};
+typedef struct xen_add_to_physmap xen_add_to_physmap_t;
+DEFINE_COMPAT_HANDLE(xen_add_to_physmap_t);
+
+
+
+struct xen_add_to_physmap_batch {
+
+
+    domid_t domid;
+    uint16_t space;
+
+
+    uint16_t size;
+
+
+
+
+    union xen_add_to_physmap_batch_extra {
+        domid_t foreign_domid;
+        uint16_t res0;
+    } u;
+
+
+
+    COMPAT_HANDLE(xen_ulong_t) idxs;
+
+
+    COMPAT_HANDLE(xen_pfn_t) gpfns;
+
+
+
+
+    COMPAT_HANDLE(int) errs;
+};
+typedef struct xen_add_to_physmap_batch xen_add_to_physmap_batch_t;
+DEFINE_COMPAT_HANDLE(xen_add_to_physmap_batch_t);
+# 295 "include/compat/memory.c"
+struct xen_remove_from_physmap {
+
+    domid_t domid;
+
+
+    xen_pfn_t gpfn;
+};
+typedef struct xen_remove_from_physmap xen_remove_from_physmap_t;
+DEFINE_COMPAT_HANDLE(xen_remove_from_physmap_t);
+# 314 "include/compat/memory.c"
+struct xen_memory_map {
+
+
+
+
+
+    unsigned int nr_entries;
+
+
+
+
+
+    COMPAT_HANDLE(void) buffer;
+};
+typedef struct xen_memory_map xen_memory_map_t;
+DEFINE_COMPAT_HANDLE(xen_memory_map_t);
+# 346 "include/compat/memory.c"
+struct xen_foreign_memory_map {
+    domid_t domid;
+    struct xen_memory_map map;
+};
+typedef struct xen_foreign_memory_map xen_foreign_memory_map_t;
+DEFINE_COMPAT_HANDLE(xen_foreign_memory_map_t);
+
+
+
+struct xen_pod_target {
+
+    uint64_t target_pages;
+
+    uint64_t tot_pages;
+    uint64_t pod_cache_pages;
+    uint64_t pod_entries;
+
+    domid_t domid;
+};
+typedef struct xen_pod_target xen_pod_target_t;
+# 386 "include/compat/memory.c"
+struct xen_mem_paging_op {
+    uint8_t op;
+    domid_t domain;
+
+
+    COMPAT_HANDLE_64(const_uint8) buffer;
+
+    uint64_t gfn;
+};
+typedef struct xen_mem_paging_op xen_mem_paging_op_t;
+DEFINE_COMPAT_HANDLE(xen_mem_paging_op_t);
+# 410 "include/compat/memory.c"
+typedef enum {
+    XENMEM_access_n,
+    XENMEM_access_r,
+    XENMEM_access_w,
+    XENMEM_access_rw,
+    XENMEM_access_x,
+    XENMEM_access_rx,
+    XENMEM_access_wx,
+    XENMEM_access_rwx,
+
+
+
+
+    XENMEM_access_rx2rw,
+
+
+
+
+
+    XENMEM_access_n2rwx,
+
+    XENMEM_access_default
+} xenmem_access_t;
+
+struct xen_mem_access_op {
+
+    uint8_t op;
+
+    uint8_t access;
+    domid_t domid;
+
+
+
+
+
+    uint32_t nr;
+
+
+
+
+
+    uint64_t pfn;
+
+
+
+
+    COMPAT_HANDLE(const_uint64) pfn_list;
+
+
+
+
+    COMPAT_HANDLE(const_uint8) access_list;
+};
+typedef struct xen_mem_access_op xen_mem_access_op_t;
+DEFINE_COMPAT_HANDLE(xen_mem_access_op_t);
+# 495 "include/compat/memory.c"
+struct xen_mem_sharing_op {
+    uint8_t op;
+    domid_t domain;
+
+    union {
+        struct mem_sharing_op_nominate {
+            union {
+                uint64_t gfn;
+                uint32_t grant_ref;
+            } u;
+            uint64_t handle;
+        } nominate;
+        struct mem_sharing_op_share {
+            uint64_t source_gfn;
+            uint64_t source_handle;
+            uint64_t client_gfn;
+            uint64_t client_handle;
+            domid_t client_domain;
+        } share;
+        struct mem_sharing_op_range {
+            uint64_t first_gfn;
+            uint64_t last_gfn;
+            uint64_t opaque;
+            domid_t client_domain;
+            uint16_t _pad[3];
+        } range;
+        struct mem_sharing_op_debug {
+            union {
+                uint64_t gfn;
+                uint64_t mfn;
+                uint32_t gref;
+            } u;
+        } debug;
+        struct mem_sharing_op_fork {
+            domid_t parent_domain;
+
+
+
+
+
+
+            uint16_t flags;
+            uint32_t pad;
+        } fork;
+    } u;
+};
+typedef struct xen_mem_sharing_op xen_mem_sharing_op_t;
+DEFINE_COMPAT_HANDLE(xen_mem_sharing_op_t);
+# 578 "include/compat/memory.c"
+struct xen_reserved_device_memory {
+    xen_pfn_t start_pfn;
+    xen_ulong_t nr_pages;
+};
+typedef struct xen_reserved_device_memory xen_reserved_device_memory_t;
+DEFINE_COMPAT_HANDLE(xen_reserved_device_memory_t);
+
+struct xen_reserved_device_memory_map {
+
+
+    uint32_t flags;
+
+
+
+
+
+
+    unsigned int nr_entries;
+
+    COMPAT_HANDLE(xen_reserved_device_memory_t) buffer;
+
+    union {
+        physdev_pci_device_t pci;
+    } dev;
+};
+typedef struct xen_reserved_device_memory_map xen_reserved_device_memory_map_t;
+DEFINE_COMPAT_HANDLE(xen_reserved_device_memory_map_t);
+# 613 "include/compat/memory.c"
+struct xen_mem_acquire_resource {
+
+    domid_t domid;
+
+    uint16_t type;
+# 630 "include/compat/memory.c"
+    uint32_t id;
+# 650 "include/compat/memory.c"
+    uint32_t nr_frames;
+
+
+
+
+
+
+
+    uint32_t pad;
+
+
+
+
+
+    uint64_t frame;
+# 687 "include/compat/memory.c"
+    COMPAT_HANDLE(xen_pfn_t) frame_list;
+};
+typedef struct xen_mem_acquire_resource xen_mem_acquire_resource_t;
+DEFINE_COMPAT_HANDLE(xen_mem_acquire_resource_t);
+# 699 "include/compat/memory.c"
+struct xen_vmemrange {
+    uint64_t start, end;
+    unsigned int flags;
+    unsigned int nid;
+};
+typedef struct @KeeP@xen_vmemrange xen_vmemrange_t;
+DEFINE_COMPAT_HANDLE(xen_vmemrange_t);
+# 716 "include/compat/memory.c"
+struct xen_vnuma_topology_info {
+
+    domid_t domid;
+    uint16_t pad;
+
+    unsigned int nr_vnodes;
+    unsigned int nr_vcpus;
+    unsigned int nr_vmemranges;
+
+    union {
+        COMPAT_HANDLE(uint) h;
+        uint64_t pad;
+    } vdistance;
+    union {
+        COMPAT_HANDLE(uint) h;
+        uint64_t pad;
+    } vcpu_to_vnode;
+    union {
+        COMPAT_HANDLE(xen_vmemrange_t) h;
+        uint64_t pad;
+    } vmemrange;
+};
+typedef struct xen_vnuma_topology_info xen_vnuma_topology_info_t;
+DEFINE_COMPAT_HANDLE(xen_vnuma_topology_info_t);
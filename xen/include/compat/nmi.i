@@ -0,0 +1,16 @@
+# 0 "include/compat/nmi.c"
+# 1 "/root/repo/xen//"
+# 0 "<built-in>"
+# 0 "<command-line>"
+# 1 "./include/public/xen-compat.h" 1
+# 0 "<command-line>" 2
+# 1 "include/compat/nmi.c"
+# 13 "include/compat/nmi.c"
+__InClUdE__ "xen.h"
+# 45 "include/compat/nmi.c"
+struct xennmi_callback {
+    unsigned long handler_address;
+    unsigned long pad;
+};
+typedef struct xennmi_callback xennmi_callback_t;
+DEFINE_COMPAT_HANDLE(xennmi_callback_t);
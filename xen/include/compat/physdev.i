@@ -0,0 +1,271 @@
+# 0 "include/compat/physdev.c"
+# 1 "/root/repo/xen//"
+# 0 "<built-in>"
+# 0 "<command-line>"
+# 1 "./include/public/xen-compat.h" 1
+# 0 "<command-line>" 2
+# 1 "include/compat/physdev.c"
+# 9 "include/compat/physdev.c"
+__InClUdE__ "xen.h"
+# 23 "include/compat/physdev.c"
+struct physdev_eoi {
+
+    uint32_t irq;
+};
+typedef struct @KeeP@physdev_eoi physdev_eoi_t;
+DEFINE_COMPAT_HANDLE(physdev_eoi_t);
+# 46 "include/compat/physdev.c"
+struct physdev_pirq_eoi_gmfn {
+
+    xen_pfn_t gmfn;
+};
+typedef struct physdev_pirq_eoi_gmfn physdev_pirq_eoi_gmfn_t;
+DEFINE_COMPAT_HANDLE(physdev_pirq_eoi_gmfn_t);
+
+
+
+
+
+
+struct physdev_irq_status_query {
+
+    uint32_t irq;
+
+    uint32_t flags;
+};
+typedef struct @KeeP@physdev_irq_status_query physdev_irq_status_query_t;
+DEFINE_COMPAT_HANDLE(physdev_irq_status_query_t);
+# 80 "include/compat/physdev.c"
+struct physdev_set_iopl {
+
+    uint32_t iopl;
+};
+typedef struct @KeeP@physdev_set_iopl physdev_set_iopl_t;
+DEFINE_COMPAT_HANDLE(physdev_set_iopl_t);
+
+
+
+
+
+
+struct physdev_set_iobitmap {
+
+
+    COMPAT_HANDLE(uint8) bitmap;
+
+
+
+    uint32_t nr_ports;
+};
+typedef struct physdev_set_iobitmap physdev_set_iobitmap_t;
+DEFINE_COMPAT_HANDLE(physdev_set_iobitmap_t);
+
+
+
+
+
+
+
+struct physdev_apic {
+
+    unsigned long apic_physbase;
+    uint32_t reg;
+
+    uint32_t value;
+};
+typedef struct physdev_apic physdev_apic_t;
+DEFINE_COMPAT_HANDLE(physdev_apic_t);
+
+
+
+
+
+
+
+struct physdev_irq {
+
+    uint32_t irq;
+
+    uint32_t vector;
+};
+typedef struct @KeeP@physdev_irq physdev_irq_t;
+DEFINE_COMPAT_HANDLE(physdev_irq_t);
+# 142 "include/compat/physdev.c"
+struct physdev_map_pirq {
+    domid_t domid;
+
+    int type;
+
+    int index;
+
+    int pirq;
+
+    int bus;
+
+    int devfn;
+
+    int entry_nr;
+
+    uint64_t table_base;
+};
+typedef struct physdev_map_pirq physdev_map_pirq_t;
+DEFINE_COMPAT_HANDLE(physdev_map_pirq_t);
+
+
+struct physdev_unmap_pirq {
+    domid_t domid;
+
+    int pirq;
+};
+
+typedef struct @KeeP@physdev_unmap_pirq physdev_unmap_pirq_t;
+DEFINE_COMPAT_HANDLE(physdev_unmap_pirq_t);
+
+
+
+struct physdev_manage_pci {
+
+    uint8_t bus;
+    uint8_t devfn;
+};
+
+typedef struct @KeeP@physdev_manage_pci physdev_manage_pci_t;
+DEFINE_COMPAT_HANDLE(physdev_manage_pci_t);
+
+
+struct physdev_restore_msi {
+
+    uint8_t bus;
+    uint8_t devfn;
+};
+typedef struct @KeeP@physdev_restore_msi physdev_restore_msi_t;
+DEFINE_COMPAT_HANDLE(physdev_restore_msi_t);
+
+
+struct physdev_manage_pci_ext {
+
+    uint8_t bus;
+    uint8_t devfn;
+    uint32_t is_extfn;
+    uint32_t is_virtfn;
+    struct {
+        uint8_t bus;
+        uint8_t devfn;
+    } physfn;
+};
+
+typedef struct @KeeP@physdev_manage_pci_ext physdev_manage_pci_ext_t;
+DEFINE_COMPAT_HANDLE(physdev_manage_pci_ext_t);
+
+
+
+
+
+struct physdev_op {
+    uint32_t cmd;
+    union {
+        physdev_irq_status_query_t irq_status_query;
+        physdev_set_iopl_t set_iopl;
+        physdev_set_iobitmap_t set_iobitmap;
+        physdev_apic_t apic_op;
+        physdev_irq_t irq_op;
+    } u;
+};
+typedef struct physdev_op physdev_op_t;
+DEFINE_COMPAT_HANDLE(physdev_op_t);
+
+
+struct physdev_setup_gsi {
+    int gsi;
+
+    uint8_t triggering;
+
+    uint8_t polarity;
+
+};
+
+typedef struct @KeeP@physdev_setup_gsi physdev_setup_gsi_t;
+DEFINE_COMPAT_HANDLE(physdev_setup_gsi_t);
+
+
+
+
+
+
+struct physdev_get_free_pirq {
+
+    int type;
+
+    uint32_t pirq;
+};
+
+typedef struct @KeeP@physdev_get_free_pirq physdev_get_free_pirq_t;
+DEFINE_COMPAT_HANDLE(physdev_get_free_pirq_t);
+
+
+
+
+struct physdev_pci_mmcfg_reserved {
+    uint64_t address;
+    uint16_t segment;
+    uint8_t start_bus;
+    uint8_t end_bus;
+    uint32_t flags;
+};
+typedef struct @KeeP@physdev_pci_mmcfg_reserved physdev_pci_mmcfg_reserved_t;
+DEFINE_COMPAT_HANDLE(physdev_pci_mmcfg_reserved_t);
+
+
+
+
+
+
+struct physdev_pci_device_add {
+
+    uint16_t seg;
+    uint8_t bus;
+    uint8_t devfn;
+    uint32_t flags;
+    struct {
+        uint8_t bus;
+        uint8_t devfn;
+    } physfn;
+
+
+
+
+
+    uint32_t optarr[XEN_FLEX_ARRAY_DIM];
+};
+typedef struct @KeeP@physdev_pci_device_add physdev_pci_device_add_t;
+DEFINE_COMPAT_HANDLE(physdev_pci_device_add_t);
+# 306 "include/compat/physdev.c"
+struct physdev_pci_device {
+
+    uint16_t seg;
+    uint8_t bus;
+    uint8_t devfn;
+};
+typedef struct @KeeP@physdev_pci_device physdev_pci_device_t;
+DEFINE_COMPAT_HANDLE(physdev_pci_device_t);
+
+struct pci_device_reset {
+    physdev_pci_device_t dev;
+
+
+
+
+
+    uint32_t flags;
+};
+# 332 "include/compat/physdev.c"
+struct physdev_dbgp_op {
+
+    uint8_t op;
+    uint8_t bus;
+    union {
+        physdev_pci_device_t pci;
+    } u;
+};
+typedef struct physdev_dbgp_op physdev_dbgp_op_t;
+DEFINE_COMPAT_HANDLE(physdev_dbgp_op_t);
@@ -0,0 +1,573 @@
+# 0 "include/compat/platform.c"
+# 1 "/root/repo/xen//"
+# 0 "<built-in>"
+# 0 "<command-line>"
+# 1 "./include/public/xen-compat.h" 1
+# 0 "<command-line>" 2
+# 1 "include/compat/platform.c"
+# 13 "include/compat/platform.c"
+__InClUdE__ "xen.h"
+# 22 "include/compat/platform.c"
+struct xenpf_settime32 {
+
+    uint32_t secs;
+    uint32_t nsecs;
+    uint64_t system_time;
+};
+typedef struct xenpf_settime32 xenpf_settime32_t;
+
+struct xenpf_settime64 {
+
+    uint64_t secs;
+    uint32_t nsecs;
+    uint32_t mbz;
+    uint64_t system_time;
+};
+typedef struct xenpf_settime64 xenpf_settime64_t;
+
+
+
+
+
+
+
+typedef struct xenpf_settime64 xenpf_settime_t;
+DEFINE_COMPAT_HANDLE(xenpf_settime_t);
+# 56 "include/compat/platform.c"
+struct xenpf_add_memtype {
+
+    xen_pfn_t mfn;
+    uint64_t nr_mfns;
+    uint32_t type;
+
+    uint32_t handle;
+    uint32_t reg;
+};
+typedef struct xenpf_add_memtype xenpf_add_memtype_t;
+DEFINE_COMPAT_HANDLE(xenpf_add_memtype_t);
+# 76 "include/compat/platform.c"
+struct xenpf_del_memtype {
+
+    uint32_t handle;
+    uint32_t reg;
+};
+typedef struct xenpf_del_memtype xenpf_del_memtype_t;
+DEFINE_COMPAT_HANDLE(xenpf_del_memtype_t);
+
+
+
+struct xenpf_read_memtype {
+
+    uint32_t reg;
+
+    xen_pfn_t mfn;
+    uint64_t nr_mfns;
+    uint32_t type;
+};
+typedef struct xenpf_read_memtype xenpf_read_memtype_t;
+DEFINE_COMPAT_HANDLE(xenpf_read_memtype_t);
+
+
+struct xenpf_microcode_update {
+
+    COMPAT_HANDLE(const_void) data;
+    uint32_t length;
+};
+typedef struct xenpf_microcode_update xenpf_microcode_update_t;
+DEFINE_COMPAT_HANDLE(xenpf_microcode_update_t);
+
+
+
+
+
+struct xenpf_platform_quirk {
+
+    uint32_t quirk_id;
+};
+typedef struct xenpf_platform_quirk xenpf_platform_quirk_t;
+DEFINE_COMPAT_HANDLE(xenpf_platform_quirk_t);
+# 130 "include/compat/platform.c"
+struct xenpf_efi_time {
+    uint16_t year;
+    uint8_t month;
+    uint8_t day;
+    uint8_t hour;
+    uint8_t min;
+    uint8_t sec;
+    uint32_t ns;
+    int16_t tz;
+    uint8_t daylight;
+};
+
+struct xenpf_efi_guid {
+    uint32_t data1;
+    uint16_t data2;
+    uint16_t data3;
+    uint8_t data4[8];
+};
+
+struct xenpf_efi_runtime_call {
+    uint32_t function;
+
+
+
+
+
+    uint32_t misc;
+    xen_ulong_t status;
+    union {
+
+        struct {
+            struct xenpf_efi_time time;
+            uint32_t resolution;
+            uint32_t accuracy;
+        } get_time;
+
+        struct xenpf_efi_time set_time;
+
+
+
+        struct xenpf_efi_time get_wakeup_time;
+
+
+
+        struct xenpf_efi_time set_wakeup_time;
+
+
+
+
+        struct {
+            COMPAT_HANDLE(void) name;
+            xen_ulong_t size;
+            COMPAT_HANDLE(void) data;
+            struct xenpf_efi_guid vendor_guid;
+        } get_variable, set_variable;
+
+        struct {
+            xen_ulong_t size;
+            COMPAT_HANDLE(void) name;
+            struct xenpf_efi_guid vendor_guid;
+        } get_next_variable_name;
+
+
+        struct {
+            uint32_t attr;
+            uint64_t max_store_size;
+            uint64_t remain_store_size;
+            uint64_t max_size;
+        } query_variable_info;
+
+        struct {
+            COMPAT_HANDLE(void) capsule_header_array;
+            xen_ulong_t capsule_count;
+            uint64_t max_capsule_size;
+            uint32_t reset_type;
+        } query_capsule_capabilities;
+
+        struct {
+            COMPAT_HANDLE(void) capsule_header_array;
+            xen_ulong_t capsule_count;
+            uint64_t sg_list;
+        } update_capsule;
+    } u;
+};
+typedef struct xenpf_efi_runtime_call xenpf_efi_runtime_call_t;
+DEFINE_COMPAT_HANDLE(xenpf_efi_runtime_call_t);
+# 230 "include/compat/platform.c"
+struct xenpf_firmware_info {
+
+    uint32_t type;
+    uint32_t index;
+
+    union {
+        struct {
+
+            uint8_t device;
+            uint8_t version;
+            uint16_t interface_support;
+
+            uint16_t legacy_max_cylinder;
+            uint8_t legacy_max_head;
+            uint8_t legacy_sectors_per_track;
+
+
+            COMPAT_HANDLE(void) edd_params;
+        } disk_info;
+        struct {
+            uint8_t device;
+            uint32_t mbr_signature;
+        } disk_mbr_signature;
+        struct {
+
+            uint8_t capabilities;
+            uint8_t edid_transfer_time;
+
+            COMPAT_HANDLE(uint8) edid;
+        } vbeddc_info;
+        union xenpf_efi_info {
+            uint32_t version;
+            struct {
+                uint64_t addr;
+                uint32_t nent;
+            } cfg;
+            struct {
+                uint32_t revision;
+                uint32_t bufsz;
+                COMPAT_HANDLE(void) name;
+            } vendor;
+            struct {
+                uint64_t addr;
+                uint64_t size;
+                uint64_t attr;
+                uint32_t type;
+            } mem;
+            struct {
+
+                uint16_t segment;
+                uint8_t bus;
+                uint8_t devfn;
+                uint16_t vendor;
+                uint16_t devid;
+
+                uint64_t address;
+                xen_ulong_t size;
+            } pci_rom;
+            struct {
+
+                uint64_t address;
+                xen_ulong_t size;
+            } apple_properties;
+        } efi_info;
+
+
+        uint8_t kbd_shift_flags;
+    } u;
+};
+typedef struct xenpf_firmware_info xenpf_firmware_info_t;
+DEFINE_COMPAT_HANDLE(xenpf_firmware_info_t);
+
+
+struct xenpf_enter_acpi_sleep {
+
+
+
+
+
+    uint16_t val_a;
+    uint16_t val_b;
+
+    uint32_t sleep_state;
+
+    uint32_t flags;
+};
+typedef struct @KeeP@xenpf_enter_acpi_sleep xenpf_enter_acpi_sleep_t;
+DEFINE_COMPAT_HANDLE(xenpf_enter_acpi_sleep_t);
+
+
+struct xenpf_change_freq {
+
+    uint32_t flags;
+    uint32_t cpu;
+    uint64_t freq;
+};
+typedef struct xenpf_change_freq xenpf_change_freq_t;
+DEFINE_COMPAT_HANDLE(xenpf_change_freq_t);
+# 338 "include/compat/platform.c"
+struct xenpf_getidletime {
+
+
+    COMPAT_HANDLE(uint8) cpumap_bitmap;
+
+
+    uint32_t cpumap_nr_cpus;
+
+    COMPAT_HANDLE(uint64) idletime;
+
+
+    uint64_t now;
+};
+typedef struct xenpf_getidletime xenpf_getidletime_t;
+DEFINE_COMPAT_HANDLE(xenpf_getidletime_t);
+# 373 "include/compat/platform.c"
+struct xen_power_register {
+    uint32_t space_id;
+    uint32_t bit_width;
+    uint32_t bit_offset;
+    uint32_t access_size;
+    uint64_t address;
+};
+
+struct xen_processor_csd {
+    uint32_t domain;
+    uint32_t coord_type;
+    uint32_t num;
+};
+typedef struct @KeeP@xen_processor_csd xen_processor_csd_t;
+DEFINE_COMPAT_HANDLE(xen_processor_csd_t);
+
+struct xen_processor_cx {
+    struct xen_power_register reg;
+    uint8_t type;
+    uint32_t latency;
+    uint32_t power;
+    uint32_t dpcnt;
+    COMPAT_HANDLE(xen_processor_csd_t) dp;
+};
+typedef struct xen_processor_cx xen_processor_cx_t;
+DEFINE_COMPAT_HANDLE(xen_processor_cx_t);
+
+struct xen_processor_flags {
+    uint32_t bm_control:1;
+    uint32_t bm_check:1;
+    uint32_t has_cst:1;
+    uint32_t power_setup_done:1;
+    uint32_t bm_rld_set:1;
+};
+
+struct xen_processor_power {
+    uint32_t count;
+    struct xen_processor_flags flags;
+    COMPAT_HANDLE(xen_processor_cx_t) states;
+};
+
+struct xen_pct_register {
+    uint8_t descriptor;
+    uint16_t length;
+    uint8_t space_id;
+    uint8_t bit_width;
+    uint8_t bit_offset;
+    uint8_t reserved;
+    uint64_t address;
+};
+
+struct xen_processor_px {
+    uint64_t core_frequency;
+    uint64_t power;
+    uint64_t transition_latency;
+    uint64_t bus_master_latency;
+    uint64_t control;
+    uint64_t status;
+};
+typedef struct @KeeP@xen_processor_px xen_processor_px_t;
+DEFINE_COMPAT_HANDLE(xen_processor_px_t);
+
+struct xen_psd_package {
+    uint64_t num_entries;
+    uint64_t revision;
+    uint64_t domain;
+    uint64_t coord_type;
+    uint64_t num_processors;
+};
+
+struct xen_processor_performance {
+    uint32_t flags;
+    uint32_t platform_limit;
+    struct xen_pct_register control_register;
+    struct xen_pct_register status_register;
+    uint32_t state_count;
+    COMPAT_HANDLE(xen_processor_px_t) states;
+    struct xen_psd_package domain_info;
+
+
+
+
+    uint32_t shared_type;
+};
+typedef struct xen_processor_performance xen_processor_performance_t;
+DEFINE_COMPAT_HANDLE(xen_processor_performance_t);
+
+struct xenpf_set_processor_pminfo {
+
+    uint32_t id;
+    uint32_t type;
+    union {
+        struct xen_processor_power power;
+        struct xen_processor_performance perf;
+        COMPAT_HANDLE(uint32) pdc;
+    } u;
+};
+typedef struct xenpf_set_processor_pminfo xenpf_set_processor_pminfo_t;
+DEFINE_COMPAT_HANDLE(xenpf_set_processor_pminfo_t);
+
+
+struct xenpf_pcpuinfo {
+
+    uint32_t xen_cpuid;
+
+
+    uint32_t max_present;
+
+
+
+    uint32_t flags;
+    uint32_t apic_id;
+    uint32_t acpi_id;
+};
+typedef struct @KeeP@xenpf_pcpuinfo xenpf_pcpuinfo_t;
+DEFINE_COMPAT_HANDLE(xenpf_pcpuinfo_t);
+
+
+struct xenpf_pcpu_version {
+
+    uint32_t xen_cpuid;
+
+
+    uint32_t max_present;
+    char vendor_id[12];
+    uint32_t family;
+    uint32_t model;
+    uint32_t stepping;
+};
+typedef struct @KeeP@xenpf_pcpu_version xenpf_pcpu_version_t;
+DEFINE_COMPAT_HANDLE(xenpf_pcpu_version_t);
+
+
+
+struct xenpf_cpu_ol
+{
+    uint32_t cpuid;
+};
+typedef struct xenpf_cpu_ol xenpf_cpu_ol_t;
+DEFINE_COMPAT_HANDLE(xenpf_cpu_ol_t);
+
+
+struct xenpf_cpu_hotadd
+{
+ uint32_t apic_id;
+ uint32_t acpi_id;
+ uint32_t pxm;
+};
+typedef struct xenpf_cpu_hotadd xenpf_cpu_hotadd_t;
+
+
+struct xenpf_mem_hotadd
+{
+    uint64_t spfn;
+    uint64_t epfn;
+    uint32_t pxm;
+    uint32_t flags;
+};
+typedef struct xenpf_mem_hotadd xenpf_mem_hotadd_t;
+
+
+
+
+
+struct xenpf_core_parking {
+
+    uint32_t type;
+
+
+    uint32_t idle_nums;
+};
+typedef struct xenpf_core_parking xenpf_core_parking_t;
+DEFINE_COMPAT_HANDLE(xenpf_core_parking_t);
+# 570 "include/compat/platform.c"
+struct xenpf_resource_entry {
+    union {
+        uint32_t cmd;
+        int32_t ret;
+    } u;
+    uint32_t rsvd;
+    uint64_t idx;
+    uint64_t val;
+};
+typedef struct @KeeP@xenpf_resource_entry xenpf_resource_entry_t;
+DEFINE_COMPAT_HANDLE(xenpf_resource_entry_t);
+
+struct xenpf_resource_op {
+    uint32_t nr_entries;
+    uint32_t cpu;
+    COMPAT_HANDLE(xenpf_resource_entry_t) entries;
+};
+typedef struct xenpf_resource_op xenpf_resource_op_t;
+DEFINE_COMPAT_HANDLE(xenpf_resource_op_t);
+
+
+struct xenpf_symdata {
+
+    uint32_t namelen;
+
+
+    uint32_t symnum;
+
+
+
+
+    COMPAT_HANDLE(char) name;
+    uint64_t address;
+    char type;
+};
+typedef struct xenpf_symdata xenpf_symdata_t;
+DEFINE_COMPAT_HANDLE(xenpf_symdata_t);
+
+
+
+
+
+
+
+typedef struct @KeeP@dom0_vga_console_info xenpf_dom0_console_t;
+DEFINE_COMPAT_HANDLE(xenpf_dom0_console_t);
+
+
+struct xenpf_ucode_revision {
+    uint32_t cpu;
+    uint32_t signature;
+    uint32_t pf;
+    uint32_t revision;
+};
+typedef struct @KeeP@xenpf_ucode_revision xenpf_ucode_revision_t;
+DEFINE_COMPAT_HANDLE(xenpf_ucode_revision_t);
+
+
+
+struct xenpf_microcode_update2 {
+
+    uint32_t flags;
+
+
+    uint32_t length;
+    COMPAT_HANDLE(const_void) data;
+};
+typedef struct xenpf_microcode_update2 xenpf_microcode_update2_t;
+DEFINE_COMPAT_HANDLE(xenpf_microcode_update2_t);
+
+
+
+
+
+struct xen_platform_op {
+    uint32_t cmd;
+    uint32_t interface_version;
+    union {
+        xenpf_settime_t settime;
+        xenpf_settime32_t settime32;
+        xenpf_settime64_t settime64;
+        xenpf_add_memtype_t add_memtype;
+        xenpf_del_memtype_t del_memtype;
+        xenpf_read_memtype_t read_memtype;
+        xenpf_microcode_update_t microcode;
+        xenpf_platform_quirk_t platform_quirk;
+        xenpf_efi_runtime_call_t efi_runtime_call;
+        xenpf_firmware_info_t firmware_info;
+        xenpf_enter_acpi_sleep_t enter_acpi_sleep;
+        xenpf_change_freq_t change_freq;
+        xenpf_getidletime_t getidletime;
+        xenpf_set_processor_pminfo_t set_pminfo;
+        xenpf_pcpuinfo_t pcpu_info;
+        xenpf_pcpu_version_t pcpu_version;
+        xenpf_cpu_ol_t cpu_ol;
+        xenpf_cpu_hotadd_t cpu_add;
+        xenpf_mem_hotadd_t mem_add;
+        xenpf_core_parking_t core_parking;
+        xenpf_resource_op_t resource_op;
+        xenpf_symdata_t symdata;
+        xenpf_dom0_console_t dom0_console;
+        xenpf_ucode_revision_t ucode_revision;
+        xenpf_microcode_update2_t microcode2;
+        uint8_t pad[128];
+    } u;
+};
+typedef struct xen_platform_op xen_platform_op_t;
+DEFINE_COMPAT_HANDLE(xen_platform_op_t);
@@ -0,0 +1,43 @@
+# 0 "include/compat/sched.c"
+# 1 "/root/repo/xen//"
+# 0 "<built-in>"
+# 0 "<command-line>"
+# 1 "./include/public/xen-compat.h" 1
+# 0 "<command-line>" 2
+# 1 "include/compat/sched.c"
+# 13 "include/compat/sched.c"
+__InClUdE__ "event_channel.h"
+# 118 "include/compat/sched.c"
+struct sched_shutdown {
+    unsigned int reason;
+};
+typedef struct @KeeP@sched_shutdown sched_shutdown_t;
+DEFINE_COMPAT_HANDLE(sched_shutdown_t);
+
+struct sched_poll {
+    COMPAT_HANDLE(evtchn_port_t) ports;
+    unsigned int nr_ports;
+    uint64_t timeout;
+};
+typedef struct sched_poll sched_poll_t;
+DEFINE_COMPAT_HANDLE(sched_poll_t);
+
+struct sched_remote_shutdown {
+    domid_t domain_id;
+    unsigned int reason;
+};
+typedef struct @KeeP@sched_remote_shutdown sched_remote_shutdown_t;
+DEFINE_COMPAT_HANDLE(sched_remote_shutdown_t);
+
+struct sched_watchdog {
+    uint32_t id;
+    uint32_t timeout;
+};
+typedef struct sched_watchdog sched_watchdog_t;
+DEFINE_COMPAT_HANDLE(sched_watchdog_t);
+
+struct sched_pin_override {
+    int32_t pcpu;
+};
+typedef struct @KeeP@sched_pin_override sched_pin_override_t;
+DEFINE_COMPAT_HANDLE(sched_pin_override_t);
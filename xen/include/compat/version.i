@@ -0,0 +1,58 @@
+# 0 "include/compat/version.c"
+# 1 "/root/repo/xen//"
+# 0 "<built-in>"
+# 0 "<command-line>"
+# 1 "./include/public/xen-compat.h" 1
+# 0 "<command-line>" 2
+# 1 "include/compat/version.c"
+# 14 "include/compat/version.c"
+__InClUdE__ "xen.h"
+# 24 "include/compat/version.c"
+typedef char xen_extraversion_t[16];
+
+
+
+
+struct xen_compile_info {
+    char compiler[64];
+    char compile_by[16];
+    char compile_domain[32];
+    char compile_date[32];
+};
+typedef struct @KeeP@xen_compile_info xen_compile_info_t;
+
+
+typedef char xen_capabilities_info_t[1024];
+
+
+
+typedef char xen_changeset_info_t[64];
+# 73 "include/compat/version.c"
+struct xen_platform_parameters {
+    xen_ulong_t virt_start;
+};
+typedef struct xen_platform_parameters xen_platform_parameters_t;
+
+
+struct xen_feature_info {
+    uint32_t submap_idx;
+    uint32_t submap;
+};
+typedef struct @KeeP@xen_feature_info xen_feature_info_t;
+
+
+__InClUdE__ "features.h"
+# 99 "include/compat/version.c"
+typedef char xen_commandline_t[1024];
+
+
+
+
+
+
+struct xen_build_id {
+        uint32_t len;
+        unsigned char buf[XEN_FLEX_ARRAY_DIM];
+
+};
+typedef struct @KeeP@xen_build_id xen_build_id_t;
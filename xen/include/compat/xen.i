@@ -0,0 +1,249 @@
+# 0 "include/compat/xen.c"
+# 1 "/root/repo/xen//"
+# 0 "<built-in>"
+# 0 "<command-line>"
+# 1 "./include/public/xen-compat.h" 1
+# 0 "<command-line>" 2
+# 1 "include/compat/xen.c"
+# 13 "include/compat/xen.c"
+__InClUdE__ "xen-compat.h"
+
+
+__InClUdE__ "arch-x86/xen.h"
+# 29 "include/compat/xen.c"
+DEFINE_COMPAT_HANDLE(char);
+__DEFINE_COMPAT_HANDLE(uchar, unsigned char);
+DEFINE_COMPAT_HANDLE(int);
+__DEFINE_COMPAT_HANDLE(uint, unsigned int);
+
+
+
+DEFINE_COMPAT_HANDLE(void);
+
+DEFINE_COMPAT_HANDLE(uint64_t);
+DEFINE_COMPAT_HANDLE(xen_pfn_t);
+DEFINE_COMPAT_HANDLE(xen_ulong_t);
+# 431 "include/compat/xen.c"
+struct mmuext_op {
+    unsigned int cmd;
+    union {
+
+
+        xen_pfn_t mfn;
+
+        unsigned long linear_addr;
+    } arg1;
+    union {
+
+        unsigned int nr_ents;
+
+
+        COMPAT_HANDLE(const_void) vcpumask;
+
+
+
+
+        xen_pfn_t src_mfn;
+    } arg2;
+};
+typedef struct mmuext_op mmuext_op_t;
+DEFINE_COMPAT_HANDLE(mmuext_op_t);
+# 609 "include/compat/xen.c"
+typedef uint16_t domid_t;
+
+
+
+
+
+struct mmu_update {
+    uint64_t ptr;
+    uint64_t val;
+};
+typedef struct @KeeP@mmu_update mmu_update_t;
+DEFINE_COMPAT_HANDLE(mmu_update_t);
+# 631 "include/compat/xen.c"
+struct multicall_entry {
+    xen_ulong_t op, result;
+    xen_ulong_t args[6];
+};
+typedef struct multicall_entry multicall_entry_t;
+DEFINE_COMPAT_HANDLE(multicall_entry_t);
+# 646 "include/compat/xen.c"
+struct vcpu_time_info {
+# 656 "include/compat/xen.c"
+    uint32_t version;
+    uint32_t pad0;
+    uint64_t tsc_timestamp;
+    uint64_t system_time;
+
+
+
+
+
+
+
+    uint32_t tsc_to_system_mul;
+    int8_t tsc_shift;
+
+    uint8_t flags;
+    uint8_t pad1[2];
+
+
+
+};
+typedef struct @KeeP@vcpu_time_info vcpu_time_info_t;
+
+
+
+
+struct vcpu_info {
+# 707 "include/compat/xen.c"
+    uint8_t evtchn_upcall_pending;
+__IfDeF__ XEN_HAVE_PV_UPCALL_MASK
+    uint8_t evtchn_upcall_mask;
+__ElSe__
+    uint8_t pad0;
+__EnDif__
+    xen_ulong_t evtchn_pending_sel;
+    struct arch_vcpu_info arch;
+    vcpu_time_info_t time;
+};
+# 730 "include/compat/xen.c"
+struct shared_info {
+    struct vcpu_info vcpu_info[XEN_LEGACY_MAX_VCPUS];
+# 764 "include/compat/xen.c"
+    xen_ulong_t evtchn_pending[sizeof(xen_ulong_t) * 8];
+    xen_ulong_t evtchn_mask[sizeof(xen_ulong_t) * 8];
+# 776 "include/compat/xen.c"
+    uint32_t wc_version;
+    uint32_t wc_sec;
+    uint32_t wc_nsec;
+
+
+
+
+
+
+
+    struct arch_shared_info arch;
+
+};
+# 830 "include/compat/xen.c"
+__IfDeF__ XEN_HAVE_PV_GUEST_ENTRY
+struct start_info {
+
+    char magic[32];
+    unsigned long nr_pages;
+    unsigned long shared_info;
+    uint32_t flags;
+    xen_pfn_t store_mfn;
+    uint32_t store_evtchn;
+    union {
+        struct {
+            xen_pfn_t mfn;
+            uint32_t evtchn;
+        } domU;
+        struct {
+            uint32_t info_off;
+            uint32_t info_size;
+        } dom0;
+    } console;
+
+    unsigned long pt_base;
+    unsigned long nr_pt_frames;
+    unsigned long mfn_list;
+    unsigned long mod_start;
+
+
+    unsigned long mod_len;
+
+    int8_t cmd_line[1024];
+
+    unsigned long first_p2m_pfn;
+    unsigned long nr_p2m_frames;
+};
+typedef struct start_info start_info_t;
+
+
+
+
+
+
+__EnDif__
+# 895 "include/compat/xen.c"
+struct xen_multiboot_mod_list
+{
+
+    uint32_t mod_start;
+
+    uint32_t mod_end;
+
+    uint32_t cmdline;
+
+    uint32_t pad;
+};
+# 914 "include/compat/xen.c"
+typedef struct dom0_vga_console_info {
+    uint8_t video_type;
+
+
+
+
+    union {
+        struct {
+
+            uint16_t font_height;
+
+            uint16_t cursor_x, cursor_y;
+
+            uint16_t rows, columns;
+        } text_mode_3;
+
+        struct {
+
+            uint16_t width, height;
+
+            uint16_t bytes_per_line;
+
+            uint16_t bits_per_pixel;
+
+            uint32_t lfb_base;
+            uint32_t lfb_size;
+
+            uint8_t red_pos, red_size;
+            uint8_t green_pos, green_size;
+            uint8_t blue_pos, blue_size;
+            uint8_t rsvd_pos, rsvd_size;
+
+
+            uint32_t gbl_caps;
+
+            uint16_t mode_attrs;
+            uint16_t pad;
+
+
+
+            uint32_t ext_lfb_base;
+
+        } vesa_lfb;
+    } u;
+} dom0_vga_console_info_t;
+
+
+
+typedef uint8_t xen_domain_handle_t[16];
+
+__DEFINE_COMPAT_HANDLE(uint8, uint8_t);
+__DEFINE_COMPAT_HANDLE(uint16, uint16_t);
+__DEFINE_COMPAT_HANDLE(uint32, uint32_t);
+__DEFINE_COMPAT_HANDLE(uint64, uint64_t);
+
+typedef struct {
+    uint8_t a[16];
+} xen_uuid_t;
+# 1016 "include/compat/xen.c"
+struct xenctl_bitmap {
+    COMPAT_HANDLE_64(uint8) bitmap;
+    uint32_t nr_bits;
+};
+typedef struct @KeeP@xenctl_bitmap xenctl_bitmap_t;
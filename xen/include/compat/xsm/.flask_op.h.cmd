@@ -0,0 +1 @@
+cmd_include/compat/xsm/flask_op.h := echo '/* SAF-9-safe empty header */' >include/compat/xsm/flask_op.h
@@ -253,6 +253,13 @@ struct xen_domctl_getpageframeinfo3 {
   * Requires HVM support.
   */
 #define XEN_DOMCTL_SHADOW_ENABLE_EXTERNAL  (1 << 4)
+ /*
+  * With ENABLE_LOG_DIRTY: also queue each pfn, as it is first dirtied, on a
+  * ring drained by CLEAN with XEN_DOMCTL_SHADOW_LOGDIRTY_RING.  Pages logged
+  * by hardware (e.g. Intel PML) are queued in the order each vCPU dirtied
+  * them.  Fails with EOPNOTSUPP where the paging mode can't support this.
+  */
+#define XEN_DOMCTL_SHADOW_ENABLE_DIRTY_RING (1 << 5)
 
 /* Mode flags for XEN_DOMCTL_SHADOW_OP_{CLEAN,PEEK}. */
  /*
@@ -260,6 +267,31 @@ struct xen_domctl_getpageframeinfo3 {
   * writably by the hypervisor in the dirty bitmap.
   */
 #define XEN_DOMCTL_SHADOW_LOGDIRTY_FINAL   (1 << 0)
+ /*
+  * Operate on the pfns [start_pfn, start_pfn + pages) rather than
+  * [0, pages), with the bitmap (or list) describing just those.  Unless
+  * with XEN_DOMCTL_SHADOW_LOGDIRTY_PFN_LIST, start_pfn must be a multiple
+  * of 8.  A CLEAN restarts logging for the range only, so large guests can
+  * be dealt with in chunks.  stats.dirty_count is the number of pfns found
+  * dirty in the range.
+  */
+#define XEN_DOMCTL_SHADOW_LOGDIRTY_RANGE   (1 << 1)
+ /*
+  * Return the dirty pfns as a list in dirty_pfns, rather than as a bitmap
+  * in dirty_bitmap.  Should the list fill, the operation stops early, with
+  * pages updated to the number of pfns dealt with, and only those cleaned.
+  * stats.dirty_count is as for XEN_DOMCTL_SHADOW_LOGDIRTY_RANGE.
+  */
+#define XEN_DOMCTL_SHADOW_LOGDIRTY_PFN_LIST (1 << 2)
+ /*
+  * CLEAN only, with XEN_DOMCTL_SHADOW_LOGDIRTY_PFN_LIST and without
+  * XEN_DOMCTL_SHADOW_LOGDIRTY_RANGE: take the pfns from the dirty ring, in
+  * the order first dirtied, cleaning just those.  pages is not used.  Fails
+  * with ENOBUFS, having taken nothing, if pfns were lost to the ring filling
+  * up; a CLEAN of the whole bitmap (neither RANGE nor PFN_LIST) reports
+  * everything dirty and empties the ring.
+  */
+#define XEN_DOMCTL_SHADOW_LOGDIRTY_RING    (1 << 3)
 
 struct xen_domctl_shadow_op_stats {
     uint32_t fault_count;
@@ -281,6 +313,14 @@ struct xen_domctl_shadow_op {
     XEN_GUEST_HANDLE_64(uint8) dirty_bitmap;
     uint64_aligned_t pages; /* Size of buffer. Updated with actual size. */
     struct xen_domctl_shadow_op_stats stats;
+
+    /* OP_PEEK / OP_CLEAN with XEN_DOMCTL_SHADOW_LOGDIRTY_RANGE */
+    uint64_aligned_t start_pfn;
+
+    /* OP_PEEK / OP_CLEAN with XEN_DOMCTL_SHADOW_LOGDIRTY_{PFN_LIST,RING} */
+    XEN_GUEST_HANDLE_64(uint64) dirty_pfns;
+    uint64_aligned_t nr_dirty_pfns; /* Size of list. Updated with number
+                                       of entries used. */
 };
 
 
@@ -444,6 +444,35 @@ struct xen_dm_op_nr_vcpus {
 };
 typedef struct xen_dm_op_nr_vcpus xen_dm_op_nr_vcpus_t;
 
+/*
+ * XEN_DMOP_set_ioreq_server_batch: Set the number of batch slots IOREQ
+ *                                  Server <id> is prepared to handle per
+ *                                  vCPU.
+ *
+ * With batch slots, a single synchronous emulation request may carry
+ * further independent requests, allowing e.g. a string or rep instruction
+ * spanning several pages to be handed to the emulator in one go (see the
+ * description of the <batch> field of struct ioreq). The slots live in
+ * frame XENMEM_resource_ioreq_server_frame_batch of the server, which can
+ * only be obtained via XENMEM_acquire_resource: the server must not have
+ * its synchronous ioreq page mapped into guest memory. Slot <n> of vCPU
+ * <v> is element (<v> * <nr_slots> + <n>) of the ioreq array in that frame.
+ *
+ * The number of slots granted is bounded by the number of vCPUs of the
+ * domain, and may be lower than requested (including 0). Setting 0 slots
+ * turns batching off. The IOREQ Server must be disabled.
+ */
+#define XEN_DMOP_set_ioreq_server_batch 21
+
+struct xen_dm_op_set_ioreq_server_batch {
+    /* IN - server id */
+    ioservid_t id;
+    uint16_t pad;
+    /* IN - number of slots requested, OUT - number of slots granted */
+    uint32_t nr_slots;
+};
+typedef struct xen_dm_op_set_ioreq_server_batch xen_dm_op_set_ioreq_server_batch_t;
+
 struct xen_dm_op {
     uint32_t op;
     uint32_t pad;
@@ -468,6 +497,7 @@ struct xen_dm_op {
         xen_dm_op_relocate_memory_t relocate_memory;
         xen_dm_op_pin_memory_cacheattr_t pin_memory_cacheattr;
         xen_dm_op_nr_vcpus_t nr_vcpus;
+        xen_dm_op_set_ioreq_server_batch_t set_ioreq_server_batch;
     } u;
 };
 
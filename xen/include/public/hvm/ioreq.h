@@ -31,6 +31,15 @@
  *
  * 63....48|47..40|39..35|34..32|31........0
  * SEGMENT |BUS   |DEV   |FN    |OFFSET
+ *
+ * If the ioreq server has negotiated batch slots (XEN_DMOP_set_ioreq_server_
+ * batch), a synchronous request with non-zero <batch> is followed by that
+ * many further requests in the first slots of the vCPU. They are in guest
+ * order and independent of each other, and are only ever requests with
+ * data_is_ptr set, so no data needs to be passed back for any of them.
+ * The device model carries out the request and then all its batch slots
+ * before signalling completion of the request.  <batch> is always 0 in
+ * the slots themselves.
  */
 struct ioreq {
     uint64_t addr;          /* physical address */
@@ -38,7 +47,7 @@ struct ioreq {
     uint32_t count;         /* for rep prefixes */
     uint32_t size;          /* size in bytes */
     uint32_t vp_eport;      /* evtchn for notifications to/from device model */
-    uint16_t _pad0;
+    uint16_t batch;         /* number of batch slots following this request */
     uint8_t state:4;
     uint8_t data_is_ptr:1;  /* if 1, data above is the guest paddr
                              * of the real data to use. */
@@ -381,6 +381,7 @@ typedef struct xen_pod_target xen_pod_target_t;
 #define XENMEM_paging_op_nominate           0
 #define XENMEM_paging_op_evict              1
 #define XENMEM_paging_op_prep               2
+#define XENMEM_paging_op_populate_evicted   3
 
 struct xen_mem_paging_op {
     uint8_t     op;         /* XENMEM_paging_op_* */
@@ -664,6 +665,12 @@ struct xen_mem_acquire_resource {
 
 #define XENMEM_resource_ioreq_server_frame_bufioreq 0
 #define XENMEM_resource_ioreq_server_frame_ioreq(n) (1 + (n))
+/*
+ * Batch slots, see XEN_DMOP_set_ioreq_server_batch.  This index is kept
+ * clear of the frame_ioreq(n) range, and is not included in the size of
+ * the resource.
+ */
+#define XENMEM_resource_ioreq_server_frame_batch 0x80000000U
 
     /*
      * IN/OUT - If the tools domain is PV then, upon return, frame_list
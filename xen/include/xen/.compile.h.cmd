@@ -0,0 +1 @@
+cmd_include/xen/compile.h :=     if [ ! -r include/xen/compile.h -o -O include/xen/compile.h ]; then cat .banner; sed -e 's/@@date@@/Sun Oct 18 11:45:18 UTC 2026/g' -e 's/@@time@@/11:45:18/g' -e 's/@@whoami@@//g' -e 's/@@domain@@//g' -e 's/@@hostname@@/vm/g' -e 's!@@compiler@@!gcc (Debian 12.2.0-14+deb12u1) 12.2.0!g' -e 's/@@version@@/4/g' -e 's/@@subversion@@/20/g' -e 's/@@extraversion@@/-unstable/g' -e 's!@@changeset@@!Sun Oct 18 10:26:10 2026 +0000 git:da42fd4!g' < include/xen/compile.h.in > include/xen/.compile.h.tmp; sed -rf ./tools/process-banner.sed < .banner >> include/xen/.compile.h.tmp; mv -f include/xen/.compile.h.tmp include/xen/compile.h; fi
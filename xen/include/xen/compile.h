@@ -0,0 +1,15 @@
+#define XEN_COMPILE_DATE	"Sun Oct 18 11:45:18 UTC 2026"
+#define XEN_COMPILE_TIME	"11:45:18"
+#define XEN_COMPILE_BY		""
+#define XEN_COMPILE_DOMAIN	""
+#define XEN_COMPILE_HOST	"vm"
+#define XEN_COMPILER		"gcc (Debian 12.2.0-14+deb12u1) 12.2.0"
+
+#define XEN_VERSION		4
+#define XEN_SUBVERSION		20
+#define XEN_VERSION_STRING	"4.20"
+#define XEN_EXTRAVERSION	"-unstable"
+
+#define XEN_CHANGESET		"Sun Oct 18 10:26:10 2026 +0000 git:da42fd4"
+#define XEN_BANNER		\
+"Xen 4.20-unstable\n"
@@ -49,6 +49,10 @@ struct ioreq_server {
     struct list_head       ioreq_vcpu_list;
     struct ioreq_page      bufioreq;
 
+    /* Batch slots, see XEN_DMOP_set_ioreq_server_batch */
+    struct ioreq_page      batch;
+    unsigned int           batch_slots;
+
     /* Lock to serialize access to buffered ioreq ring */
     spinlock_t             bufioreq_lock;
     evtchn_port_t          bufioreq_evtchn;
@@ -102,6 +106,8 @@ struct ioreq_server *ioreq_server_select(struct domain *d,
                                          ioreq_t *p);
 int ioreq_send(struct ioreq_server *s, ioreq_t *proto_p,
                bool buffered);
+int ioreq_send_batch(struct ioreq_server *s, ioreq_t *proto_p,
+                     const ioreq_t *batch, unsigned int nr);
 unsigned int ioreq_broadcast(ioreq_t *p, bool buffered);
 void ioreq_request_mapcache_invalidate(const struct domain *d);
 void ioreq_signal_mapcache_invalidate(void);
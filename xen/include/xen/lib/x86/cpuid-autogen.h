@@ -0,0 +1,1466 @@
+/*
+ * Automatically generated by /root/repo/xen/../xen/tools/gen-cpuid.py - Do not edit!
+ * Source data: /root/repo/xen/../xen/include/public/arch-x86/cpufeatureset.h
+ */
+#ifndef __XEN_X86__FEATURESET_DATA__
+#define __XEN_X86__FEATURESET_DATA__
+
+#define FEATURESET_NR_ENTRIES 18
+
+#define CPUID_COMMON_1D_FEATURES 0x0183f3ffU
+
+#define INIT_KNOWN_FEATURES { \
+    0xbfebfbffU, \
+    0xfffefbffU, \
+    0xee500800U, \
+    0x6469bfffU, \
+    0x0000001fU, \
+    0xffbfffffU, \
+    0xfb417fffU, \
+    0x00000780U, \
+    0x779fd205U, \
+    0xffddef3eU, \
+    0x00a81cb7U, \
+    0x381e0d47U, \
+    0x00000001U, \
+    0x0000003fU, \
+    0x00000000U, \
+    0x00044530U, \
+    0x1fbeffffU, \
+    0x00000000U, \
+}
+
+#define INIT_SPECIAL_FEATURES { \
+    0x10000200U, \
+    0xc8200000U, \
+    0x00000000U, \
+    0x00000002U, \
+    0x00000000U, \
+    0x01002850U, \
+    0x00000010U, \
+    0x00000000U, \
+    0x02000000U, \
+    0x20000c00U, \
+    0x00000000U, \
+    0x00000000U, \
+    0x00000000U, \
+    0x00000000U, \
+    0x00000000U, \
+    0x00000000U, \
+    0x100a0004U, \
+    0x00000000U, \
+}
+
+#define INIT_SIMPLE_OR { \
+    0x00000000U, \
+    0x00000000U, \
+    0x00000000U, \
+    0x00000000U, \
+    0x00000000U, \
+    0x00000000U, \
+    0x00000000U, \
+    0x00000000U, \
+    0x00100000U, \
+    0x00000400U, \
+    0x00000000U, \
+    0x00000002U, \
+    0x00000000U, \
+    0x00000000U, \
+    0x00000000U, \
+    0x00000000U, \
+    0x10020000U, \
+    0x00000000U, \
+}
+
+#define INIT_PV_DEF_FEATURES { \
+    0x1fc9cbf5U, \
+    0xf6d83203U, \
+    0xea500800U, \
+    0x442109e3U, \
+    0x00000007U, \
+    0xf1af0b29U, \
+    0x02405f43U, \
+    0x00000000U, \
+    0x64001005U, \
+    0xac804410U, \
+    0x00801c37U, \
+    0x381c0c45U, \
+    0x00000000U, \
+    0x00000021U, \
+    0x00000000U, \
+    0x00004430U, \
+    0x1d12e173U, \
+    0x00000000U, \
+}
+
+#define INIT_PV_MAX_FEATURES { \
+    0x1fc9cbf5U, \
+    0xf6d83203U, \
+    0xea500800U, \
+    0x442109e3U, \
+    0x00000007U, \
+    0xf1af0b39U, \
+    0x1a405f43U, \
+    0x00000100U, \
+    0x64001005U, \
+    0xac814510U, \
+    0x00801cb7U, \
+    0x381c0c45U, \
+    0x00000000U, \
+    0x00000021U, \
+    0x00000000U, \
+    0x00004430U, \
+    0x1d12e173U, \
+    0x00000000U, \
+}
+
+#define INIT_HVM_SHADOW_DEF_FEATURES { \
+    0x1fcbfbffU, \
+    0xf7f83203U, \
+    0xea500800U, \
+    0x442109f3U, \
+    0x0000000fU, \
+    0xf1bf0babU, \
+    0x02405f47U, \
+    0x00000000U, \
+    0x751fd005U, \
+    0xbc804410U, \
+    0x00881c37U, \
+    0x381c0d47U, \
+    0x00000000U, \
+    0x00000037U, \
+    0x00000000U, \
+    0x00004430U, \
+    0x1d12e173U, \
+    0x00000000U, \
+}
+
+#define INIT_HVM_SHADOW_MAX_FEATURES { \
+    0x1fcbfbffU, \
+    0xf7f83203U, \
+    0xea500800U, \
+    0x442109f3U, \
+    0x0000000fU, \
+    0xf1bf4bbbU, \
+    0x1a405f47U, \
+    0x00000100U, \
+    0x751fd005U, \
+    0xbc814510U, \
+    0x00881cb7U, \
+    0x381c0d47U, \
+    0x00000000U, \
+    0x00000037U, \
+    0x00000000U, \
+    0x00004430U, \
+    0x1d12e173U, \
+    0x00000000U, \
+}
+
+#define INIT_HVM_HAP_DEF_FEATURES { \
+    0x1fcbfbffU, \
+    0xf7fa3203U, \
+    0xee500800U, \
+    0x442109f3U, \
+    0x0000000fU, \
+    0xf1bf0fabU, \
+    0x82405f4fU, \
+    0x00000000U, \
+    0x751fd005U, \
+    0xbc804410U, \
+    0x00881c37U, \
+    0x381c0d47U, \
+    0x00000000U, \
+    0x00000037U, \
+    0x00000000U, \
+    0x00004430U, \
+    0x1d12e173U, \
+    0x00000000U, \
+}
+
+#define INIT_HVM_HAP_MAX_FEATURES { \
+    0x1fcbfbffU, \
+    0xf7fa3223U, \
+    0xee500800U, \
+    0x442109f7U, \
+    0x0000000fU, \
+    0xf1bf4fbbU, \
+    0x9a405f4fU, \
+    0x00000100U, \
+    0x751fd005U, \
+    0xbc814510U, \
+    0x00881cb7U, \
+    0x381c0d47U, \
+    0x00000000U, \
+    0x00000037U, \
+    0x00000000U, \
+    0x00004430U, \
+    0x1d12e173U, \
+    0x00000000U, \
+}
+
+#define NR_DEEP_DEPS 31U
+
+#define INIT_DEEP_FEATURES { \
+    0x07800259U, \
+    0x16080203U, \
+    0xa0100000U, \
+    0x00000000U, \
+    0x00000000U, \
+    0x40010820U, \
+    0x00000000U, \
+    0x00000000U, \
+    0x1000d000U, \
+    0x25000000U, \
+    0x00000000U, \
+    0x00000000U, \
+    0x00000000U, \
+    0x00000000U, \
+    0x00000000U, \
+    0x00000000U, \
+    0x00000002U, \
+    0x00000000U, \
+}
+
+#define INIT_DEEP_DEPS { \
+    { 0x0U, /* FPU */ { \
+        0x00800000U, \
+        0x00000000U, \
+        0xc0400000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000004U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+    }, }, \
+    { 0x3U, /* PSE */ { \
+        0x00020000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+    }, }, \
+    { 0x4U, /* TSC */ { \
+        0x00000000U, \
+        0x01000000U, \
+        0x08000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000002U, \
+        0x00000000U, \
+        0x00000100U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+    }, }, \
+    { 0x6U, /* PAE */ { \
+        0x00000000U, \
+        0x00022000U, \
+        0x24100000U, \
+        0x00000001U, \
+        0x00000000U, \
+        0x00100000U, \
+        0x00000008U, \
+        0x00000000U, \
+        0x00100000U, \
+        0x03400000U, \
+        0x00200080U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000100U, \
+        0x00000000U, \
+        0x00000000U, \
+    }, }, \
+    { 0x9U, /* APIC */ { \
+        0x00000000U, \
+        0x01200000U, \
+        0x00000000U, \
+        0x00000008U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+    }, }, \
+    { 0x17U, /* MMX */ { \
+        0x00000000U, \
+        0x00000000U, \
+        0xc0400000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+    }, }, \
+    { 0x18U, /* FXSR */ { \
+        0x06000000U, \
+        0x021a2203U, \
+        0x26000000U, \
+        0x000000c1U, \
+        0x00000000U, \
+        0x20000000U, \
+        0x00000708U, \
+        0x00000000U, \
+        0x00100000U, \
+        0x03400000U, \
+        0x00200080U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000100U, \
+        0x00000000U, \
+        0x00000000U, \
+    }, }, \
+    { 0x19U, /* SSE */ { \
+        0x04000000U, \
+        0x021a2203U, \
+        0x24000000U, \
+        0x000000c1U, \
+        0x00000000U, \
+        0x20000000U, \
+        0x00000708U, \
+        0x00000000U, \
+        0x00100000U, \
+        0x03400000U, \
+        0x00200080U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000100U, \
+        0x00000000U, \
+        0x00000000U, \
+    }, }, \
+    { 0x1aU, /* SSE2 */ { \
+        0x00000000U, \
+        0x021a2203U, \
+        0x24000000U, \
+        0x00000041U, \
+        0x00000000U, \
+        0x20000000U, \
+        0x00000708U, \
+        0x00000000U, \
+        0x00100000U, \
+        0x03400000U, \
+        0x00200080U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000100U, \
+        0x00000000U, \
+        0x00000000U, \
+    }, }, \
+    { 0x20U, /* SSE3 */ { \
+        0x00000000U, \
+        0x00180200U, \
+        0x00000000U, \
+        0x00000040U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+    }, }, \
+    { 0x21U, /* PCLMULQDQ */ { \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000400U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+    }, }, \
+    { 0x29U, /* SSSE3 */ { \
+        0x00000000U, \
+        0x00180000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+    }, }, \
+    { 0x33U, /* SSE4_1 */ { \
+        0x00000000U, \
+        0x00100000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+    }, }, \
+    { 0x39U, /* AESNI */ { \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000200U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+    }, }, \
+    { 0x3aU, /* XSAVE */ { \
+        0x00000000U, \
+        0x30001000U, \
+        0x00000000U, \
+        0x00018800U, \
+        0x0000000fU, \
+        0xdc234020U, \
+        0x00005e4aU, \
+        0x00000000U, \
+        0x00000000U, \
+        0x03c0010cU, \
+        0x00a00037U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000530U, \
+        0x00000000U, \
+        0x00000000U, \
+    }, }, \
+    { 0x3cU, /* AVX */ { \
+        0x00000000U, \
+        0x20001000U, \
+        0x00000000U, \
+        0x00010800U, \
+        0x00000000U, \
+        0xdc230020U, \
+        0x00005e42U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x0080010cU, \
+        0x00800037U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000430U, \
+        0x00000000U, \
+        0x00000000U, \
+    }, }, \
+    { 0x54U, /* NX */ { \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00100000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+    }, }, \
+    { 0x5dU, /* LM */ { \
+        0x00000000U, \
+        0x00022000U, \
+        0x04000000U, \
+        0x00000001U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000008U, \
+        0x00000000U, \
+        0x00100000U, \
+        0x03400000U, \
+        0x00200080U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000100U, \
+        0x00000000U, \
+        0x00000000U, \
+    }, }, \
+    { 0x5fU, /* 3DNOW */ { \
+        0x00000000U, \
+        0x00000000U, \
+        0x40000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+    }, }, \
+    { 0xa5U, /* AVX2 */ { \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0xdc230000U, \
+        0x00005e42U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x0080010cU, \
+        0x00800035U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000410U, \
+        0x00000000U, \
+        0x00000000U, \
+    }, }, \
+    { 0xabU, /* RTM */ { \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00010000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+    }, }, \
+    { 0xb0U, /* AVX512F */ { \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0xdc220000U, \
+        0x00005842U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x0080010cU, \
+        0x00000020U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+    }, }, \
+    { 0xbeU, /* AVX512BW */ { \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00001042U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00800000U, \
+        0x00000020U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+    }, }, \
+    { 0x10cU, /* IBPB */ { \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x40000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x18000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+    }, }, \
+    { 0x10eU, /* IBRS */ { \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x110f8000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00040100U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+    }, }, \
+    { 0x10fU, /* AMD_STIBP */ { \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00020000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+    }, }, \
+    { 0x11cU, /* PSFD */ { \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00040000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+    }, }, \
+    { 0x138U, /* AMX_TILE */ { \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x02400000U, \
+        0x00200000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000100U, \
+        0x00000000U, \
+        0x00000000U, \
+    }, }, \
+    { 0x13aU, /* IBRSB */ { \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x88000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000017U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00080002U, \
+        0x00000000U, \
+    }, }, \
+    { 0x13dU, /* ARCH_CAPS */ { \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0xffffffffU, \
+        0xffffffffU, \
+    }, }, \
+    { 0x201U, /* EIBRS */ { \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00000000U, \
+        0x00080000U, \
+        0x00000000U, \
+    }, }, \
+}
+
+#define INIT_FEATURE_NAME_TO_VAL { \
+    { "3dnow", 95U },\
+    { "3dnowext", 94U },\
+    { "3dnowprefetch", 104U },\
+    { "abm", 101U },\
+    { "acpi", 22U },\
+    { "addr-msk-ext", 126U },\
+    { "adx", 179U },\
+    { "aesni", 57U },\
+    { "amd-fsrc", 363U },\
+    { "amd-fsrs", 362U },\
+    { "amd-ppin", 279U },\
+    { "amd-prefetchi", 372U },\
+    { "amd-ssbd", 280U },\
+    { "amd-stibp", 271U },\
+    { "amx-bf16", 310U },\
+    { "amx-complex", 488U },\
+    { "amx-fp16", 341U },\
+    { "amx-int8", 313U },\
+    { "amx-tile", 312U },\
+    { "apic", 9U },\
+    { "arch-caps", 317U },\
+    { "arch-lbr", 307U },\
+    { "auto-ibrs", 360U },\
+    { "avx", 60U },\
+    { "avx-ifma", 343U },\
+    { "avx-ne-convert", 485U },\
+    { "avx-vnni", 324U },\
+    { "avx-vnni-int16", 490U },\
+    { "avx-vnni-int8", 484U },\
+    { "avx2", 165U },\
+    { "avx512-4fmaps", 291U },\
+    { "avx512-4vnniw", 290U },\
+    { "avx512-bf16", 325U },\
+    { "avx512-bitalg", 204U },\
+    { "avx512-fp16", 311U },\
+    { "avx512-ifma", 181U },\
+    { "avx512-vbmi", 193U },\
+    { "avx512-vbmi2", 198U },\
+    { "avx512-vnni", 203U },\
+    { "avx512-vp2intersect", 296U },\
+    { "avx512-vpopcntdq", 206U },\
+    { "avx512bw", 190U },\
+    { "avx512cd", 188U },\
+    { "avx512dq", 177U },\
+    { "avx512er", 187U },\
+    { "avx512f", 176U },\
+    { "avx512pf", 186U },\
+    { "avx512vl", 191U },\
+    { "bhi-ctrl", 420U },\
+    { "bhi-no", 532U },\
+    { "bld", 216U },\
+    { "bmi1", 163U },\
+    { "bmi2", 168U },\
+    { "btc-no", 285U },\
+    { "cet-ibt", 308U },\
+    { "cet-ss", 199U },\
+    { "cet-sss", 498U },\
+    { "cldemote", 217U },\
+    { "clflush", 19U },\
+    { "clflushopt", 183U },\
+    { "clwb", 184U },\
+    { "clzero", 256U },\
+    { "cmov", 15U },\
+    { "cmp-legacy", 97U },\
+    { "cmpccxadd", 327U },\
+    { "core-caps", 318U },\
+    { "cpb", 233U },\
+    { "cpuid-user-dis", 369U },\
+    { "cr8-legacy", 100U },\
+    { "cx16", 45U },\
+    { "cx8", 8U },\
+    { "dbext", 122U },\
+    { "dca", 50U },\
+    { "ddp-ctrl", 419U },\
+    { "de", 2U },\
+    { "doitm", 524U },\
+    { "ds", 21U },\
+    { "dscpl", 36U },\
+    { "dtes64", 34U },\
+    { "efro", 234U },\
+    { "eibrs", 513U },\
+    { "eist", 39U },\
+    { "energy-filtering", 523U },\
+    { "enqcmd", 221U },\
+    { "epsf", 370U },\
+    { "erms", 169U },\
+    { "extapic", 99U },\
+    { "f16c", 61U },\
+    { "fb-clear", 529U },\
+    { "fb-clear-ctrl", 530U },\
+    { "fbsdp-no", 526U },\
+    { "fdp-excp-only", 166U },\
+    { "ffxsr", 89U },\
+    { "fma", 44U },\
+    { "fma4", 112U },\
+    { "fpu", 0U },\
+    { "fs-gs-ns", 353U },\
+    { "fsgsbase", 160U },\
+    { "fsrcs", 332U },\
+    { "fsrm", 292U },\
+    { "fsrs", 331U },\
+    { "fsrsc", 371U },\
+    { "fxsr", 24U },\
+    { "fzrm", 330U },\
+    { "gds-ctrl", 537U },\
+    { "gds-no", 538U },\
+    { "gfni", 200U },\
+    { "hle", 164U },\
+    { "htt", 28U },\
+    { "hw-pstate", 231U },\
+    { "hybrid", 303U },\
+    { "hypervisor", 63U },\
+    { "ibpb", 268U },\
+    { "ibpb-brtype", 380U },\
+    { "ibpb-ret", 286U },\
+    { "ibrs", 270U },\
+    { "ibrs-always", 272U },\
+    { "ibrs-fast", 274U },\
+    { "ibrs-same-mode", 275U },\
+    { "ibrsb", 314U },\
+    { "ibs", 106U },\
+    { "if-pschange-mc-no", 518U },\
+    { "intel-ppin", 384U },\
+    { "intel-psfd", 416U },\
+    { "intel-ssb-no", 516U },\
+    { "invpcid", 170U },\
+    { "ipred-ctrl", 417U },\
+    { "itsc", 232U },\
+    { "l1d-flush", 316U },\
+    { "la57", 208U },\
+    { "lahf-lm", 96U },\
+    { "lfence-dispatch", 354U },\
+    { "lm", 93U },\
+    { "lwp", 111U },\
+    { "mca", 14U },\
+    { "mcdt-no", 421U },\
+    { "mce", 7U },\
+    { "mcu-ctrl", 521U },\
+    { "md-clear", 298U },\
+    { "mds-no", 517U },\
+    { "misalignsse", 103U },\
+    { "misc-pkg-ctrl", 522U },\
+    { "mmx", 23U },\
+    { "mmxext", 86U },\
+    { "monitor", 35U },\
+    { "monitorx", 125U },\
+    { "movbe", 54U },\
+    { "movdir64b", 220U },\
+    { "movdiri", 219U },\
+    { "mpx", 174U },\
+    { "msr", 5U },\
+    { "mtrr", 12U },\
+    { "no-fpu-sel", 173U },\
+    { "no-lmsl", 276U },\
+    { "no-nest-bp", 352U },\
+    { "nodeid-msr", 115U },\
+    { "nscb", 358U },\
+    { "nx", 84U },\
+    { "ospke", 196U },\
+    { "osvw", 105U },\
+    { "osxsave", 59U },\
+    { "ovrclk-status", 535U },\
+    { "pae", 6U },\
+    { "page1gb", 90U },\
+    { "pat", 16U },\
+    { "pbe", 31U },\
+    { "pbrsb-no", 536U },\
+    { "pcid", 49U },\
+    { "pclmulqdq", 33U },\
+    { "pconfig", 306U },\
+    { "pdcm", 47U },\
+    { "pge", 13U },\
+    { "pks", 223U },\
+    { "pku", 195U },\
+    { "popcnt", 55U },\
+    { "pqe", 175U },\
+    { "pqm", 172U },\
+    { "prefetchi", 494U },\
+    { "prefetchwt1", 192U },\
+    { "proc-trace", 185U },\
+    { "psdp-no", 527U },\
+    { "pse", 3U },\
+    { "pse36", 17U },\
+    { "psfd", 284U },\
+    { "rdcl-no", 512U },\
+    { "rdpid", 214U },\
+    { "rdrand", 62U },\
+    { "rdseed", 178U },\
+    { "rdtscp", 91U },\
+    { "rfds-clear", 540U },\
+    { "rfds-no", 539U },\
+    { "rrsba", 531U },\
+    { "rrsba-ctrl", 418U },\
+    { "rsba", 514U },\
+    { "rstr-fp-err-ptrs", 258U },\
+    { "rtm", 171U },\
+    { "rtm-always-abort", 299U },\
+    { "sbdr-ssdp-no", 525U },\
+    { "sbpb", 379U },\
+    { "sdbg", 43U },\
+    { "sep", 11U },\
+    { "serialize", 302U },\
+    { "sgx", 162U },\
+    { "sgx-keys", 289U },\
+    { "sgx-lc", 222U },\
+    { "sha", 189U },\
+    { "sha512", 320U },\
+    { "skinit", 108U },\
+    { "skip-l1dfl", 515U },\
+    { "sm3", 321U },\
+    { "sm4", 322U },\
+    { "smap", 180U },\
+    { "smep", 167U },\
+    { "smx", 38U },\
+    { "srbds-ctrl", 297U },\
+    { "srso-no", 381U },\
+    { "ss", 27U },\
+    { "ssb-no", 282U },\
+    { "ssbd", 319U },\
+    { "sse", 25U },\
+    { "sse2", 26U },\
+    { "sse3", 32U },\
+    { "sse4-1", 51U },\
+    { "sse4-2", 52U },\
+    { "sse4a", 102U },\
+    { "ssse3", 41U },\
+    { "stibp", 315U },\
+    { "stibp-always", 273U },\
+    { "svm", 98U },\
+    { "syscall", 75U },\
+    { "taa-no", 520U },\
+    { "tbm", 117U },\
+    { "tm1", 29U },\
+    { "tm2", 40U },\
+    { "tme", 205U },\
+    { "topoext", 118U },\
+    { "tsc", 4U },\
+    { "tsc-adjust", 161U },\
+    { "tsc-deadline", 56U },\
+    { "tsx-ctrl", 519U },\
+    { "tsx-force-abort", 301U },\
+    { "tsxldtrk", 304U },\
+    { "uintr", 293U },\
+    { "umip", 194U },\
+    { "vaes", 201U },\
+    { "virt-ssbd", 281U },\
+    { "vme", 1U },\
+    { "vmx", 37U },\
+    { "vpclmulqdq", 202U },\
+    { "waitpkg", 197U },\
+    { "wbnoinvd", 265U },\
+    { "wdt", 109U },\
+    { "wrmsrns", 339U },\
+    { "x2apic", 53U },\
+    { "xapic-status", 533U },\
+    { "xfd", 132U },\
+    { "xgetbv1", 130U },\
+    { "xop", 107U },\
+    { "xsave", 58U },\
+    { "xsavec", 129U },\
+    { "xsaveopt", 128U },\
+    { "xsaves", 131U },\
+    { "xtpr", 46U },\
+}
+
+
+#define INIT_FEATURE_VAL_TO_NAME { \
+    [95] = "3dnow",\
+    [94] = "3dnowext",\
+    [104] = "3dnowprefetch",\
+    [101] = "abm",\
+    [22] = "acpi",\
+    [126] = "addr-msk-ext",\
+    [179] = "adx",\
+    [57] = "aesni",\
+    [363] = "amd-fsrc",\
+    [362] = "amd-fsrs",\
+    [279] = "amd-ppin",\
+    [372] = "amd-prefetchi",\
+    [280] = "amd-ssbd",\
+    [271] = "amd-stibp",\
+    [310] = "amx-bf16",\
+    [488] = "amx-complex",\
+    [341] = "amx-fp16",\
+    [313] = "amx-int8",\
+    [312] = "amx-tile",\
+    [9] = "apic",\
+    [73] = "apic",\
+    [317] = "arch-caps",\
+    [307] = "arch-lbr",\
+    [360] = "auto-ibrs",\
+    [60] = "avx",\
+    [343] = "avx-ifma",\
+    [485] = "avx-ne-convert",\
+    [324] = "avx-vnni",\
+    [490] = "avx-vnni-int16",\
+    [484] = "avx-vnni-int8",\
+    [165] = "avx2",\
+    [291] = "avx512-4fmaps",\
+    [290] = "avx512-4vnniw",\
+    [325] = "avx512-bf16",\
+    [204] = "avx512-bitalg",\
+    [311] = "avx512-fp16",\
+    [181] = "avx512-ifma",\
+    [193] = "avx512-vbmi",\
+    [198] = "avx512-vbmi2",\
+    [203] = "avx512-vnni",\
+    [296] = "avx512-vp2intersect",\
+    [206] = "avx512-vpopcntdq",\
+    [190] = "avx512bw",\
+    [188] = "avx512cd",\
+    [177] = "avx512dq",\
+    [187] = "avx512er",\
+    [176] = "avx512f",\
+    [186] = "avx512pf",\
+    [191] = "avx512vl",\
+    [420] = "bhi-ctrl",\
+    [532] = "bhi-no",\
+    [216] = "bld",\
+    [163] = "bmi1",\
+    [168] = "bmi2",\
+    [285] = "btc-no",\
+    [308] = "cet-ibt",\
+    [199] = "cet-ss",\
+    [498] = "cet-sss",\
+    [217] = "cldemote",\
+    [19] = "clflush",\
+    [183] = "clflushopt",\
+    [184] = "clwb",\
+    [256] = "clzero",\
+    [15] = "cmov",\
+    [79] = "cmov",\
+    [97] = "cmp-legacy",\
+    [327] = "cmpccxadd",\
+    [318] = "core-caps",\
+    [233] = "cpb",\
+    [369] = "cpuid-user-dis",\
+    [100] = "cr8-legacy",\
+    [45] = "cx16",\
+    [8] = "cx8",\
+    [72] = "cx8",\
+    [122] = "dbext",\
+    [50] = "dca",\
+    [419] = "ddp-ctrl",\
+    [2] = "de",\
+    [66] = "de",\
+    [524] = "doitm",\
+    [21] = "ds",\
+    [36] = "dscpl",\
+    [34] = "dtes64",\
+    [234] = "efro",\
+    [513] = "eibrs",\
+    [39] = "eist",\
+    [523] = "energy-filtering",\
+    [221] = "enqcmd",\
+    [370] = "epsf",\
+    [169] = "erms",\
+    [99] = "extapic",\
+    [61] = "f16c",\
+    [529] = "fb-clear",\
+    [530] = "fb-clear-ctrl",\
+    [526] = "fbsdp-no",\
+    [166] = "fdp-excp-only",\
+    [89] = "ffxsr",\
+    [44] = "fma",\
+    [112] = "fma4",\
+    [0] = "fpu",\
+    [64] = "fpu",\
+    [353] = "fs-gs-ns",\
+    [160] = "fsgsbase",\
+    [332] = "fsrcs",\
+    [292] = "fsrm",\
+    [331] = "fsrs",\
+    [371] = "fsrsc",\
+    [24] = "fxsr",\
+    [88] = "fxsr",\
+    [330] = "fzrm",\
+    [537] = "gds-ctrl",\
+    [538] = "gds-no",\
+    [200] = "gfni",\
+    [164] = "hle",\
+    [28] = "htt",\
+    [231] = "hw-pstate",\
+    [303] = "hybrid",\
+    [63] = "hypervisor",\
+    [268] = "ibpb",\
+    [380] = "ibpb-brtype",\
+    [286] = "ibpb-ret",\
+    [270] = "ibrs",\
+    [272] = "ibrs-always",\
+    [274] = "ibrs-fast",\
+    [275] = "ibrs-same-mode",\
+    [314] = "ibrsb",\
+    [106] = "ibs",\
+    [518] = "if-pschange-mc-no",\
+    [384] = "intel-ppin",\
+    [416] = "intel-psfd",\
+    [516] = "intel-ssb-no",\
+    [170] = "invpcid",\
+    [417] = "ipred-ctrl",\
+    [232] = "itsc",\
+    [316] = "l1d-flush",\
+    [208] = "la57",\
+    [96] = "lahf-lm",\
+    [354] = "lfence-dispatch",\
+    [93] = "lm",\
+    [111] = "lwp",\
+    [14] = "mca",\
+    [78] = "mca",\
+    [421] = "mcdt-no",\
+    [7] = "mce",\
+    [71] = "mce",\
+    [521] = "mcu-ctrl",\
+    [298] = "md-clear",\
+    [517] = "mds-no",\
+    [103] = "misalignsse",\
+    [522] = "misc-pkg-ctrl",\
+    [23] = "mmx",\
+    [87] = "mmx",\
+    [86] = "mmxext",\
+    [35] = "monitor",\
+    [125] = "monitorx",\
+    [54] = "movbe",\
+    [220] = "movdir64b",\
+    [219] = "movdiri",\
+    [174] = "mpx",\
+    [5] = "msr",\
+    [69] = "msr",\
+    [12] = "mtrr",\
+    [76] = "mtrr",\
+    [173] = "no-fpu-sel",\
+    [276] = "no-lmsl",\
+    [352] = "no-nest-bp",\
+    [115] = "nodeid-msr",\
+    [358] = "nscb",\
+    [84] = "nx",\
+    [196] = "ospke",\
+    [105] = "osvw",\
+    [59] = "osxsave",\
+    [535] = "ovrclk-status",\
+    [6] = "pae",\
+    [70] = "pae",\
+    [90] = "page1gb",\
+    [16] = "pat",\
+    [80] = "pat",\
+    [31] = "pbe",\
+    [536] = "pbrsb-no",\
+    [49] = "pcid",\
+    [33] = "pclmulqdq",\
+    [306] = "pconfig",\
+    [47] = "pdcm",\
+    [13] = "pge",\
+    [77] = "pge",\
+    [223] = "pks",\
+    [195] = "pku",\
+    [55] = "popcnt",\
+    [175] = "pqe",\
+    [172] = "pqm",\
+    [494] = "prefetchi",\
+    [192] = "prefetchwt1",\
+    [185] = "proc-trace",\
+    [527] = "psdp-no",\
+    [3] = "pse",\
+    [67] = "pse",\
+    [17] = "pse36",\
+    [81] = "pse36",\
+    [284] = "psfd",\
+    [512] = "rdcl-no",\
+    [214] = "rdpid",\
+    [62] = "rdrand",\
+    [178] = "rdseed",\
+    [91] = "rdtscp",\
+    [540] = "rfds-clear",\
+    [539] = "rfds-no",\
+    [531] = "rrsba",\
+    [418] = "rrsba-ctrl",\
+    [514] = "rsba",\
+    [258] = "rstr-fp-err-ptrs",\
+    [171] = "rtm",\
+    [299] = "rtm-always-abort",\
+    [525] = "sbdr-ssdp-no",\
+    [379] = "sbpb",\
+    [43] = "sdbg",\
+    [11] = "sep",\
+    [302] = "serialize",\
+    [162] = "sgx",\
+    [289] = "sgx-keys",\
+    [222] = "sgx-lc",\
+    [189] = "sha",\
+    [320] = "sha512",\
+    [108] = "skinit",\
+    [515] = "skip-l1dfl",\
+    [321] = "sm3",\
+    [322] = "sm4",\
+    [180] = "smap",\
+    [167] = "smep",\
+    [38] = "smx",\
+    [297] = "srbds-ctrl",\
+    [381] = "srso-no",\
+    [27] = "ss",\
+    [282] = "ssb-no",\
+    [319] = "ssbd",\
+    [25] = "sse",\
+    [26] = "sse2",\
+    [32] = "sse3",\
+    [51] = "sse4-1",\
+    [52] = "sse4-2",\
+    [102] = "sse4a",\
+    [41] = "ssse3",\
+    [315] = "stibp",\
+    [273] = "stibp-always",\
+    [98] = "svm",\
+    [75] = "syscall",\
+    [520] = "taa-no",\
+    [117] = "tbm",\
+    [29] = "tm1",\
+    [40] = "tm2",\
+    [205] = "tme",\
+    [118] = "topoext",\
+    [4] = "tsc",\
+    [68] = "tsc",\
+    [161] = "tsc-adjust",\
+    [56] = "tsc-deadline",\
+    [519] = "tsx-ctrl",\
+    [301] = "tsx-force-abort",\
+    [304] = "tsxldtrk",\
+    [293] = "uintr",\
+    [194] = "umip",\
+    [201] = "vaes",\
+    [281] = "virt-ssbd",\
+    [1] = "vme",\
+    [65] = "vme",\
+    [37] = "vmx",\
+    [202] = "vpclmulqdq",\
+    [197] = "waitpkg",\
+    [265] = "wbnoinvd",\
+    [109] = "wdt",\
+    [339] = "wrmsrns",\
+    [53] = "x2apic",\
+    [533] = "xapic-status",\
+    [132] = "xfd",\
+    [130] = "xgetbv1",\
+    [107] = "xop",\
+    [58] = "xsave",\
+    [129] = "xsavec",\
+    [128] = "xsaveopt",\
+    [131] = "xsaves",\
+    [46] = "xtpr",\
+    [575] = NULL,\
+}
+
+#define CPUID_BITFIELD_0 \
+    bool fpu:1, vme:1, de:1, pse:1, tsc:1, msr:1, pae:1, mce:1, cx8:1, :1, :1, sep:1, mtrr:1, pge:1, mca:1, cmov:1, pat:1, pse36:1, :1, clflush:1, :1, ds:1, acpi:1, mmx:1, fxsr:1, sse:1, sse2:1, ss:1, htt:1, tm1:1, :1, pbe:1
+
+#define CPUID_BITFIELD_1 \
+    bool sse3:1, pclmulqdq:1, dtes64:1, monitor:1, dscpl:1, vmx:1, smx:1, eist:1, tm2:1, ssse3:1, :1, sdbg:1, fma:1, cx16:1, xtpr:1, pdcm:1, :1, pcid:1, dca:1, sse4_1:1, sse4_2:1, x2apic:1, movbe:1, popcnt:1, tsc_deadline:1, aesni:1, xsave:1, :1, avx:1, f16c:1, rdrand:1, hypervisor:1
+
+#define CPUID_BITFIELD_2 \
+    bool :1, :1, :1, :1, :1, :1, :1, :1, :1, :1, :1, syscall:1, :1, :1, :1, :1, :1, :1, :1, :1, nx:1, :1, mmxext:1, :1, :1, ffxsr:1, page1gb:1, rdtscp:1, :1, lm:1, _3dnowext:1, _3dnow:1
+
+#define CPUID_BITFIELD_3 \
+    bool lahf_lm:1, cmp_legacy:1, svm:1, extapic:1, cr8_legacy:1, abm:1, sse4a:1, misalignsse:1, _3dnowprefetch:1, osvw:1, ibs:1, xop:1, skinit:1, wdt:1, :1, lwp:1, fma4:1, :1, :1, nodeid_msr:1, :1, tbm:1, topoext:1, :1, :1, :1, dbext:1, :1, :1, monitorx:1, addr_msk_ext:1, :1
+
+#define CPUID_BITFIELD_4 \
+    bool xsaveopt:1, xsavec:1, xgetbv1:1, xsaves:1, xfd:1, :1, :1, :1, :1, :1, :1, :1, :1, :1, :1, :1, :1, :1, :1, :1, :1, :1, :1, :1, :1, :1, :1, :1, :1, :1, :1, :1
+
+#define CPUID_BITFIELD_5 \
+    bool fsgsbase:1, tsc_adjust:1, sgx:1, bmi1:1, hle:1, avx2:1, fdp_excp_only:1, smep:1, bmi2:1, erms:1, invpcid:1, rtm:1, pqm:1, no_fpu_sel:1, mpx:1, pqe:1, avx512f:1, avx512dq:1, rdseed:1, adx:1, smap:1, avx512_ifma:1, :1, clflushopt:1, clwb:1, proc_trace:1, avx512pf:1, avx512er:1, avx512cd:1, sha:1, avx512bw:1, avx512vl:1
+
+#define CPUID_BITFIELD_6 \
+    bool prefetchwt1:1, avx512_vbmi:1, umip:1, pku:1, :1, waitpkg:1, avx512_vbmi2:1, cet_ss:1, gfni:1, vaes:1, vpclmulqdq:1, avx512_vnni:1, avx512_bitalg:1, tme:1, avx512_vpopcntdq:1, :1, la57:1, :1, :1, :1, :1, :1, rdpid:1, :1, bld:1, cldemote:1, :1, movdiri:1, movdir64b:1, enqcmd:1, sgx_lc:1, pks:1
+
+#define CPUID_BITFIELD_7 \
+    bool :1, :1, :1, :1, :1, :1, :1, hw_pstate:1, itsc:1, cpb:1, efro:1, :1, :1, :1, :1, :1, :1, :1, :1, :1, :1, :1, :1, :1, :1, :1, :1, :1, :1, :1, :1, :1
+
+#define CPUID_BITFIELD_8 \
+    bool clzero:1, :1, rstr_fp_err_ptrs:1, :1, :1, :1, :1, :1, :1, wbnoinvd:1, :1, :1, ibpb:1, :1, ibrs:1, amd_stibp:1, ibrs_always:1, stibp_always:1, ibrs_fast:1, ibrs_same_mode:1, no_lmsl:1, :1, :1, amd_ppin:1, amd_ssbd:1, virt_ssbd:1, ssb_no:1, :1, psfd:1, btc_no:1, ibpb_ret:1, :1
+
+#define CPUID_BITFIELD_9 \
+    bool :1, sgx_keys:1, avx512_4vnniw:1, avx512_4fmaps:1, fsrm:1, uintr:1, :1, :1, avx512_vp2intersect:1, srbds_ctrl:1, md_clear:1, rtm_always_abort:1, :1, tsx_force_abort:1, serialize:1, hybrid:1, tsxldtrk:1, :1, pconfig:1, arch_lbr:1, cet_ibt:1, :1, amx_bf16:1, avx512_fp16:1, amx_tile:1, amx_int8:1, ibrsb:1, stibp:1, l1d_flush:1, arch_caps:1, core_caps:1, ssbd:1
+
+#define CPUID_BITFIELD_10 \
+    bool sha512:1, sm3:1, sm4:1, :1, avx_vnni:1, avx512_bf16:1, :1, cmpccxadd:1, :1, :1, fzrm:1, fsrs:1, fsrcs:1, :1, :1, :1, :1, :1, :1, wrmsrns:1, :1, amx_fp16:1, :1, avx_ifma:1, :1, :1, :1, :1, :1, :1, :1, :1
+
+#define CPUID_BITFIELD_11 \
+    bool no_nest_bp:1, fs_gs_ns:1, lfence_dispatch:1, :1, :1, :1, nscb:1, :1, auto_ibrs:1, :1, amd_fsrs:1, amd_fsrc:1, :1, :1, :1, :1, :1, cpuid_user_dis:1, epsf:1, fsrsc:1, amd_prefetchi:1, :1, :1, :1, :1, :1, :1, sbpb:1, ibpb_brtype:1, srso_no:1, :1, :1
+
+#define CPUID_BITFIELD_12 \
+    bool intel_ppin:1, :1, :1, :1, :1, :1, :1, :1, :1, :1, :1, :1, :1, :1, :1, :1, :1, :1, :1, :1, :1, :1, :1, :1, :1, :1, :1, :1, :1, :1, :1, :1
+
+#define CPUID_BITFIELD_13 \
+    bool intel_psfd:1, ipred_ctrl:1, rrsba_ctrl:1, ddp_ctrl:1, bhi_ctrl:1, mcdt_no:1, :1, :1, :1, :1, :1, :1, :1, :1, :1, :1, :1, :1, :1, :1, :1, :1, :1, :1, :1, :1, :1, :1, :1, :1, :1, :1
+
+#define CPUID_BITFIELD_14 \
+    uint32_t _placeholder_14
+
+#define CPUID_BITFIELD_15 \
+    bool :1, :1, :1, :1, avx_vnni_int8:1, avx_ne_convert:1, :1, :1, amx_complex:1, :1, avx_vnni_int16:1, :1, :1, :1, prefetchi:1, :1, :1, :1, cet_sss:1, :1, :1, :1, :1, :1, :1, :1, :1, :1, :1, :1, :1, :1
+
+#define CPUID_BITFIELD_16 \
+    bool rdcl_no:1, eibrs:1, rsba:1, skip_l1dfl:1, intel_ssb_no:1, mds_no:1, if_pschange_mc_no:1, tsx_ctrl:1, taa_no:1, mcu_ctrl:1, misc_pkg_ctrl:1, energy_filtering:1, doitm:1, sbdr_ssdp_no:1, fbsdp_no:1, psdp_no:1, :1, fb_clear:1, fb_clear_ctrl:1, rrsba:1, bhi_no:1, xapic_status:1, :1, ovrclk_status:1, pbrsb_no:1, gds_ctrl:1, gds_no:1, rfds_no:1, rfds_clear:1, :1, :1, :1
+
+#define CPUID_BITFIELD_17 \
+    uint32_t _placeholder_17
+
+#define CPUID_BITFIELD_18 \
+    uint32_t _placeholder_18
+
+#define CPUID_BITFIELD_19 \
+    uint32_t _placeholder_19
+
+#define CPUID_BITFIELD_20 \
+    uint32_t _placeholder_20
+
+#define CPUID_BITFIELD_21 \
+    uint32_t _placeholder_21
+
+
+#endif /* __XEN_X86__FEATURESET_DATA__ */
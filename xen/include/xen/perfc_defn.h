@@ -83,4 +83,13 @@ PERFCOUNTER(tickled_cpu_overridden, "csched2: tickled_cpu_overridden")
 
 PERFCOUNTER(need_flush_tlb_flush,   "PG_need_flush tlb flushes")
 
+#ifdef CONFIG_IOREQ_SERVER
+PERFCOUNTER(ioreq_route_hit,        "ioreq: route cache hits")
+PERFCOUNTER(ioreq_route_lookup,     "ioreq: route map lookups")
+PERFCOUNTER(ioreq_route_fallback,   "ioreq: selections without route map")
+PERFCOUNTER(ioreq_route_rebuild,    "ioreq: route map rebuilds")
+PERFCOUNTER(ioreq_batch_send,       "ioreq: batched requests sent")
+PERFCOUNTER(ioreq_batch_slots,      "ioreq: batch slots used")
+#endif
+
 /*#endif*/ /* __XEN_PERFC_DEFN_H__ */
@@ -168,6 +168,16 @@ struct vcpu_io {
     ioreq_t              req;
     /* Arch specific info pertaining to the io request */
     struct arch_vcpu_io  info;
+    /*
+     * Part of the I/O space last looked up in the ioreq routing map, and
+     * the ioreq servers claiming it.  Valid while gen matches the map.
+     */
+    struct {
+        unsigned int     gen;
+        uint8_t          type;
+        uint8_t          servers;
+        unsigned long    s, e;
+    } route_cache;
 };
 
 struct vcpu
@@ -362,6 +372,7 @@ struct sched_unit {
 #define domain_unlock(d) rspin_unlock(&(d)->domain_lock)
 
 struct evtchn_port_ops;
+struct ioreq_route_map;
 
 #define MAX_NR_IOREQ_SERVERS 8
 
@@ -632,6 +643,13 @@ struct domain
     struct {
         rspinlock_t             lock;
         struct ioreq_server     *server[MAX_NR_IOREQ_SERVERS];
+        /*
+         * Routing of I/O accesses to the servers, rebuilt whenever the
+         * ranges of a server change.  Readers take route_lock only.
+         */
+        rwlock_t                route_lock;
+        struct ioreq_route_map  *route;
+        unsigned int            route_gen;
     } ioreq_server;
 #endif
 
@@ -85,9 +85,19 @@ void cf_check vpci_hw_write16(
  */
 bool __must_check vpci_process_pending(struct vcpu *v);
 
+/* Dwords per chunk of the register map of a device. */
+#define VPCI_MAP_CHUNK 64
+
+struct vpci_register;
+
 struct vpci {
     /* List of vPCI handlers for a device. */
     struct list_head handlers;
+    /*
+     * First handler overlapping each dword of the config space, in chunks
+     * only allocated once a handler is added to them.
+     */
+    struct vpci_register **map[PCI_CFG_SPACE_EXP_SIZE / 4 / VPCI_MAP_CHUNK];
     spinlock_t lock;
 
 #ifdef __XEN__
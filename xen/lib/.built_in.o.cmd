@@ -0,0 +1 @@
+cmd_lib/built_in.o := ld    -melf_x86_64 --no-warn-rwx-segments -r -o lib/built_in.o lib/x86/built_in.o
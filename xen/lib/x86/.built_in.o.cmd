@@ -0,0 +1 @@
+cmd_lib/x86/built_in.o := ld    -melf_x86_64 --no-warn-rwx-segments -r -o lib/x86/built_in.o lib/x86/cpuid.o lib/x86/msr.o lib/x86/policy.o